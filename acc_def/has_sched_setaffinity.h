@@ -0,0 +1,58 @@
+/* This file is part of UCESB - a tool for data unpacking and processing.
+ *
+ * Copyright (C) 2016  Haakan T. Johansson  <f96hajo@chalmers.se>
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+ * MA  02110-1301  USA
+ */
+
+#ifndef __HAS_SCHED_SETAFFINITY_H__
+#define __HAS_SCHED_SETAFFINITY_H__
+
+#ifndef ACC_DEF_RUN
+# include "gen/acc_auto_def/has_sched_setaffinity.h"
+#endif
+
+#if ACC_DEF_HAS_SCHED_SETAFFINITY_sched_h
+# define HAS_SCHED_SETAFFINITY 1
+# ifndef _GNU_SOURCE
+# define _GNU_SOURCE /* for sched_setaffinity, sched_getcpu */
+# endif
+#endif
+#if ACC_DEF_HAS_SCHED_SETAFFINITY_notavail
+# define HAS_SCHED_SETAFFINITY 0
+#endif
+
+#ifdef ACC_DEF_RUN
+# include <sched.h>
+
+int acc_test_func(void)
+{
+#if HAS_SCHED_SETAFFINITY
+  cpu_set_t set;
+
+  CPU_ZERO(&set);
+  if (sched_getaffinity(0, sizeof (set), &set) != 0)
+    return -1;
+  if (sched_setaffinity(0, sizeof (set), &set) != 0)
+    return -1;
+  return sched_getcpu();
+#else
+  return 0;
+#endif
+}
+#endif
+
+#endif/*__HAS_SCHED_SETAFFINITY_H__*/
@@ -47,6 +47,24 @@ void print_lineno(FILE* fid,int internal)
   fprintf(fid,"%s:%d:",map->_file,map->_line + internal - map->_internal);
 }
 
+// Same as ucesb_loc_format() in the unpacker: file:line.
+
+void format_lineno(char *dest,size_t size,int internal)
+{
+  lineno_map *map = _last_lineno_map;
+
+  while (map && internal < map->_internal)
+    map = map->_prev;
+
+  if (!map)
+    {
+      snprintf(dest,size,"loc:%d",internal);
+      return;
+    }
+
+  snprintf(dest,size,"%s:%d",map->_file,map->_line + internal - map->_internal);
+}
+
 
 #ifdef UCESB_SRC
 void generate_locations()
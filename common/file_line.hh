@@ -38,6 +38,7 @@ extern lineno_map *_last_lineno_map;
 extern lineno_map *_first_lineno_map;
 
 void print_lineno(FILE* fid,int internal);
+void format_lineno(char *dest,size_t size,int internal);
 
 class file_line
 {
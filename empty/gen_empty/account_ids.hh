@@ -0,0 +1,14 @@
+/** BEGIN_ACCOUNT_IDS **************************************************
+ *
+ * Structure and identifier for raw data items.
+ *
+ * Do not edit - automatically generated.
+ */
+
+account_id _account_ids[] =
+{ 
+};
+
+#define NUM_ACCOUNT_IDS  0
+
+/** END_ACCOUNT_IDS ***************************************************/
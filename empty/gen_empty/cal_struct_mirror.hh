@@ -0,0 +1,23 @@
+/** BEGIN_MIRROR_STRUCT ************************************************
+ *
+ * Mirror (1 to 1) structure.
+ *
+ * Do not edit - automatically generated.
+ */
+
+#include "gen/default_mirror_define.hh"
+
+#ifndef USER_DEF_cal_event
+STRUCT_MIRROR_TEMPLATE
+class STRUCT_MIRROR_STRUCT(cal_event) : public STRUCT_MIRROR_BASE(cal_event_base)
+{
+public:
+  STRUCT_MIRROR_ITEM_CTRL_BASE(cal_event_base);
+  STRUCT_MIRROR_FCNS_DECL(cal_event);
+};
+#endif//USER_DEF_cal_event
+
+#include "gen/default_mirror_undef.hh"
+
+
+/** END_MIRROR_STRUCT *************************************************/
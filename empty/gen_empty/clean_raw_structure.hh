@@ -0,0 +1,8 @@
+class raw_event : public raw_event_base
+{
+  STRUCT_FCNS_DECL(raw_event);
+} ;
+class raw_sticky : public raw_sticky_base
+{
+  STRUCT_FCNS_DECL(raw_sticky);
+} ;
@@ -0,0 +1,22 @@
+class unpack_event : public unpack_event_base
+{
+  bitsone<1> __visited;
+  void __clear_visited() { __visited.clear(); }
+  subevent_match_cache __match_cache;
+  bool ignore_unknown_subevent() { return true; }
+template<typename __data_src_t>
+  int __unpack_subevent(subevent_header *__header,__data_src_t &__buffer);
+  int __revoke_subevent(subevent_header *__header);
+  STRUCT_FCNS_DECL(unpack_event);
+};
+class unpack_sticky_event : public unpack_sticky_event_base
+{
+  bitsone<1> __visited;
+  void __clear_visited() { __visited.clear(); }
+  subevent_match_cache __match_cache;
+  bool ignore_unknown_subevent() { return true; }
+template<typename __data_src_t>
+  int __unpack_subevent(subevent_header *__header,__data_src_t &__buffer);
+  int __revoke_subevent(subevent_header *__header);
+  STRUCT_FCNS_DECL(unpack_sticky_event);
+};
@@ -0,0 +1,37 @@
+/***********************************************************************
+ *
+ * Default define for mirror,
+ *
+ * Do not edit - automatically generated.
+ */
+
+#ifndef               STRUCT_MIRROR_ITEM_CTRL
+#define __DEFAULT_DEF_STRUCT_MIRROR_ITEM_CTRL
+#define               STRUCT_MIRROR_ITEM_CTRL(name) 
+#endif
+
+#ifndef               STRUCT_MIRROR_ITEM_CTRL_ARRAY
+#define __DEFAULT_DEF_STRUCT_MIRROR_ITEM_CTRL_ARRAY
+#define               STRUCT_MIRROR_ITEM_CTRL_ARRAY(name,name2,last_index) 
+#endif
+
+#ifndef               STRUCT_MIRROR_ITEM_CTRL_BASE
+#define __DEFAULT_DEF_STRUCT_MIRROR_ITEM_CTRL_BASE
+#define               STRUCT_MIRROR_ITEM_CTRL_BASE(name) 
+#endif
+
+#ifndef               STRUCT_MIRROR_TEMPLATE
+#define __DEFAULT_DEF_STRUCT_MIRROR_TEMPLATE
+#define               STRUCT_MIRROR_TEMPLATE 
+#endif
+
+#ifndef               STRUCT_MIRROR_TYPE_TEMPLATE
+#define __DEFAULT_DEF_STRUCT_MIRROR_TYPE_TEMPLATE
+#define               STRUCT_MIRROR_TYPE_TEMPLATE 
+#endif
+
+#ifndef               STRUCT_MIRROR_TYPE_TEMPLATE_FULL
+#define __DEFAULT_DEF_STRUCT_MIRROR_TYPE_TEMPLATE_FULL
+#define               STRUCT_MIRROR_TYPE_TEMPLATE_FULL 
+#endif
+
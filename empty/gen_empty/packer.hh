@@ -0,0 +1,26 @@
+/** BEGIN_PACKER *******************************************************
+ *
+ * Event packer for EVENT.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// EVENT
+  // ignore_unknown_subevent;
+{
+}
+
+/** END_PACKER ********************************************************/
+/** BEGIN_PACKER *******************************************************
+ *
+ * Event packer for EVENT.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// STICKY_EVENT
+  // ignore_unknown_subevent;
+{
+}
+
+/** END_PACKER ********************************************************/
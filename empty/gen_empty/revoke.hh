@@ -0,0 +1,48 @@
+/** BEGIN_REVOKE *******************************************************
+ *
+ * Event revoker for EVENT.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// EVENT
+int unpack_event::__revoke_subevent(subevent_header *__header)
+  // ignore_unknown_subevent;
+{
+  int __match_no = 0;
+  SUBEVENT_MATCH_CACHE_LOOKUP(__match_no)
+  {
+    SUBEVENT_MATCH_CACHE_STORE(__match_no);
+  }
+  if (!__match_no) return 0;
+  switch (__match_no)
+  {
+  }
+  return 0;
+}
+
+/** END_REVOKE ********************************************************/
+/** BEGIN_REVOKE *******************************************************
+ *
+ * Event revoker for EVENT.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// STICKY_EVENT
+int unpack_sticky_event::__revoke_subevent(subevent_header *__header)
+  // ignore_unknown_subevent;
+{
+  int __match_no = 0;
+  SUBEVENT_MATCH_CACHE_LOOKUP(__match_no)
+  {
+    SUBEVENT_MATCH_CACHE_STORE(__match_no);
+  }
+  if (!__match_no) return 0;
+  switch (__match_no)
+  {
+  }
+  return 0;
+}
+
+/** END_REVOKE ********************************************************/
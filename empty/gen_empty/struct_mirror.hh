@@ -0,0 +1,33 @@
+/** BEGIN_MIRROR_STRUCT ************************************************
+ *
+ * Mirror (1 to 1) structure.
+ *
+ * Do not edit - automatically generated.
+ */
+
+#include "gen/default_mirror_define.hh"
+
+#ifndef USER_DEF_unpack_event
+STRUCT_MIRROR_TEMPLATE
+class STRUCT_MIRROR_STRUCT(unpack_event) : public STRUCT_MIRROR_BASE(unpack_event_base)
+{
+public:
+  STRUCT_MIRROR_ITEM_CTRL_BASE(unpack_event_base);
+  STRUCT_MIRROR_FCNS_DECL(unpack_event);
+};
+#endif//USER_DEF_unpack_event
+
+#ifndef USER_DEF_unpack_sticky_event
+STRUCT_MIRROR_TEMPLATE
+class STRUCT_MIRROR_STRUCT(unpack_sticky_event) : public STRUCT_MIRROR_BASE(unpack_sticky_event_base)
+{
+public:
+  STRUCT_MIRROR_ITEM_CTRL_BASE(unpack_sticky_event_base);
+  STRUCT_MIRROR_FCNS_DECL(unpack_sticky_event);
+};
+#endif//USER_DEF_unpack_sticky_event
+
+#include "gen/default_mirror_undef.hh"
+
+
+/** END_MIRROR_STRUCT *************************************************/
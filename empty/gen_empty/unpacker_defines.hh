@@ -0,0 +1,22 @@
+/** BEGIN_UNPACKER_DEFINES *********************************************
+ *
+ * Control
+ *
+ * Do not edit - automatically generated.
+ */
+
+#define STICKY_EVENT_IS_NONTRIVIAL  1
+
+
+/** END_UNPACKER_DEFINES **********************************************/
+/** BEGIN_UNPACKER_DEFINES *********************************************
+ *
+ * Data item sizes
+ *
+ * Do not edit - automatically generated.
+ */
+
+#define UNPACK_HAS_DATA64  0
+
+
+/** END_UNPACKER_DEFINES **********************************************/
@@ -57,6 +57,13 @@ typedef std::vector<char *> config_calib_vect;
 
 typedef std::vector<char *> config_command_vect;
 
+// Processing stops after this stage (for timing the stages).
+#define LAST_STAGE_ALL     0
+#define LAST_STAGE_READ    1  // read events, locate subevents
+#define LAST_STAGE_UNPACK  2  // ... unpack
+#define LAST_STAGE_RAW     3  // ... map to raw
+#define LAST_STAGE_CAL     4  // ... calibrate (no ntuple)
+
 struct config_opts
 {
   // General info control
@@ -77,6 +84,11 @@ struct config_opts
   int _show_members;
   int _event_sizes;
   int _account;
+  int _trusted_data;
+  int _trusted_check; // every Nth event with checks (0: none)
+  int _profile;
+  const char *_profile_json;
+  const char *_match_profile;
   int _show_calib;
 
   char const *_ts_align_hist_command;
@@ -87,11 +99,24 @@ struct config_opts
   int64_t _last_event;
   int64_t _downscale;
 
+  int _last_stage;
+  int _stage_timing; // report event loop time (--last-stage given)
+  int _full_clean;
+  int _multi_event_threads;
+  const char *_numa;
+  const char *_huge_pages;
+
 #ifdef USE_LMD_INPUT
   int _scramble;
+  int _bulk_swap;
 #endif
   uint64_t _input_buffer;
 
+#ifdef USE_LMD_INPUT
+  uint64_t _tcp_rcvbuf;
+  int _stream_conns;
+#endif
+
 #ifdef USE_LMD_INPUT
   int _event_stitch_mode;
   int _event_stitch_value;
@@ -103,6 +128,11 @@ struct config_opts
   {
     const char *_name; // NULL if inactive
   } _file_output_bad;
+
+  struct
+  {
+    const char *_name; // NULL if inactive
+  } _file_record;
 #endif
 
   struct
@@ -28,16 +28,75 @@
 
 #include <stdlib.h>
 
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
 #define SWAPPING_BSWAP_16(x) (swapping ? bswap_16(x) : (x))
 #define SWAPPING_BSWAP_32(x) (swapping ? bswap_32(x) : (x))
 
+// Number of leading items in src[0..n) with (item & mask) == value.
+// Used by the generated code for 'several' items where all checked
+// bits are constant: the run is validated up front, such that the
+// items then need no checks.  Compares 8 (AVX2) or 4 (SSE2) items at
+// a time when the compiler is allowed to.
+
+inline size_t bulk_run_uint32(const uint32 *src,size_t n,
+			      uint32 mask,uint32 value)
+{
+  size_t i = 0;
+
+#if defined(__AVX2__)
+  const __m256i mask256  = _mm256_set1_epi32((int) mask);
+  const __m256i value256 = _mm256_set1_epi32((int) value);
+
+  for ( ; i + 8 <= n; i += 8)
+    {
+      __m256i v = _mm256_loadu_si256((const __m256i *) (src + i));
+      __m256i eq = _mm256_cmpeq_epi32(_mm256_and_si256(v,mask256),value256);
+      unsigned int bad =
+	~(unsigned int) _mm256_movemask_ps(_mm256_castsi256_ps(eq)) & 0xff;
+
+      if (bad)
+	return i + (size_t) __builtin_ctz(bad);
+    }
+#endif
+#if defined(__SSE2__)
+  const __m128i mask128  = _mm_set1_epi32((int) mask);
+  const __m128i value128 = _mm_set1_epi32((int) value);
+
+  for ( ; i + 4 <= n; i += 4)
+    {
+      __m128i v = _mm_loadu_si128((const __m128i *) (src + i));
+      __m128i eq = _mm_cmpeq_epi32(_mm_and_si128(v,mask128),value128);
+      unsigned int bad =
+	~(unsigned int) _mm_movemask_ps(_mm_castsi128_ps(eq)) & 0xf;
+
+      if (bad)
+	return i + (size_t) __builtin_ctz(bad);
+    }
+#endif
+
+  for ( ; i < n; i++)
+    if ((src[i] & mask) != value)
+      break;
+
+  return i;
+}
+
 // If the compiler has any wits at all, all branching on swapping and
 // scramble below will never happen, since they are compile time
 // constants
 
+// Last template parameter: compile time mode of unpacking.
+#define DATA_SRC_ACCOUNT  0x01 // account data sizes (--data-sizes)
+#define DATA_SRC_TRUSTED  0x02 // CHECK_ macros skipped (--trusted-data)
+
 #if defined(USE_LMD_INPUT) || defined(USE_HLD_INPUT) || defined(USE_MVLC_INPUT) || defined(USE_RIDF_INPUT)
 
-template<int swapping,int scramble,int account>
+template<int swapping,int scramble,int mode>
 class __data_src
 {
 public:
@@ -62,7 +121,8 @@ public:
 public:
   int is_swapping()  { return swapping; }
   int is_scrambled() { return scramble; }
-  int is_account()   { return account; }
+  int is_account()   { return mode & DATA_SRC_ACCOUNT; }
+  int is_trusted()   { return mode & DATA_SRC_TRUSTED; }
 
 public:
   char *_data;
@@ -247,6 +307,22 @@ public:
     return true;
   }
 
+  // Number of uint32 items from the current position that have
+  // (item & mask) == value.  Nothing is consumed.
+  size_t run_uint32(uint32 mask,uint32 value)
+  {
+    if (((size_t) _data) & 3)
+      return 0;
+    if (swapping)
+      {
+	mask  = bswap_32(mask);
+	value = bswap_32(value);
+      }
+    return bulk_run_uint32((const uint32 *) _data,
+			   (size_t) (_end - _data) / sizeof (uint32),
+			   mask,value);
+  }
+
 public:
   bool empty() { return _data == _end; }
 
@@ -260,7 +336,7 @@ public:
 
 #if defined(USE_PAX_INPUT) || defined(USE_GENF_INPUT) || defined(USE_EBYE_INPUT_16)
 
-template<int swapping,int account>
+template<int swapping,int mode>
 class __data_src
 {
 public:
@@ -284,7 +360,8 @@ public:
 
 public:
   int is_swapping()  { return swapping; }
-  int is_account()   { return account; }
+  int is_account()   { return mode & DATA_SRC_ACCOUNT; }
+  int is_trusted()   { return mode & DATA_SRC_TRUSTED; }
 
 public:
   uint16 *_data;
@@ -351,7 +428,7 @@ public:
 
 #if defined(USE_EBYE_INPUT_32)
 
-template<int swapping,int account>
+template<int swapping,int mode>
 class __data_src
 {
 public:
@@ -375,7 +452,8 @@ public:
 
 public:
   int is_swapping()  { return swapping; }
-  int is_account()   { return account; }
+  int is_account()   { return mode & DATA_SRC_ACCOUNT; }
+  int is_trusted()   { return mode & DATA_SRC_TRUSTED; }
 
 public:
   uint32 *_data;
@@ -424,6 +502,16 @@ public:
     return true;
   }
 
+  size_t run_uint32(uint32 mask,uint32 value)
+  {
+    if (swapping)
+      {
+	mask  = bswap_32(mask);
+	value = bswap_32(value);
+      }
+    return bulk_run_uint32(_data,(size_t) (_end - _data),mask,value);
+  }
+
 public:
   bool empty() { return _data == _end; }
 
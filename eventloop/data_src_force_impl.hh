@@ -34,7 +34,11 @@
   FORCE_IMPL_FCN(returns,fcn_name,__data_src<0,0,1> &__buffer); \
   FORCE_IMPL_FCN(returns,fcn_name,__data_src<0,1,1> &__buffer); \
   FORCE_IMPL_FCN(returns,fcn_name,__data_src<1,0,1> &__buffer); \
-  FORCE_IMPL_FCN(returns,fcn_name,__data_src<1,1,1> &__buffer);
+  FORCE_IMPL_FCN(returns,fcn_name,__data_src<1,1,1> &__buffer); \
+  FORCE_IMPL_FCN(returns,fcn_name,__data_src<0,0,2> &__buffer); \
+  FORCE_IMPL_FCN(returns,fcn_name,__data_src<0,1,2> &__buffer); \
+  FORCE_IMPL_FCN(returns,fcn_name,__data_src<1,0,2> &__buffer); \
+  FORCE_IMPL_FCN(returns,fcn_name,__data_src<1,1,2> &__buffer);
 
 #define FORCE_IMPL_DATA_SRC_FCN_ARG(returns,fcn_name,...) \
   FORCE_IMPL_FCN(returns,fcn_name,__data_src<0,0,0> &__buffer,__VA_ARGS__); \
@@ -44,7 +48,11 @@
   FORCE_IMPL_FCN(returns,fcn_name,__data_src<0,0,1> &__buffer,__VA_ARGS__); \
   FORCE_IMPL_FCN(returns,fcn_name,__data_src<0,1,1> &__buffer,__VA_ARGS__); \
   FORCE_IMPL_FCN(returns,fcn_name,__data_src<1,0,1> &__buffer,__VA_ARGS__); \
-  FORCE_IMPL_FCN(returns,fcn_name,__data_src<1,1,1> &__buffer,__VA_ARGS__);
+  FORCE_IMPL_FCN(returns,fcn_name,__data_src<1,1,1> &__buffer,__VA_ARGS__); \
+  FORCE_IMPL_FCN(returns,fcn_name,__data_src<0,0,2> &__buffer,__VA_ARGS__); \
+  FORCE_IMPL_FCN(returns,fcn_name,__data_src<0,1,2> &__buffer,__VA_ARGS__); \
+  FORCE_IMPL_FCN(returns,fcn_name,__data_src<1,0,2> &__buffer,__VA_ARGS__); \
+  FORCE_IMPL_FCN(returns,fcn_name,__data_src<1,1,2> &__buffer,__VA_ARGS__);
 
 #define FORCE_IMPL_DATA_SRC_FCN_HDR(returns,fcn_name) \
   FORCE_IMPL_FCN(returns,fcn_name,subevent_header *__header,__data_src<0,0,0> &__buffer); \
@@ -54,7 +62,11 @@
   FORCE_IMPL_FCN(returns,fcn_name,subevent_header *__header,__data_src<0,0,1> &__buffer); \
   FORCE_IMPL_FCN(returns,fcn_name,subevent_header *__header,__data_src<0,1,1> &__buffer); \
   FORCE_IMPL_FCN(returns,fcn_name,subevent_header *__header,__data_src<1,0,1> &__buffer); \
-  FORCE_IMPL_FCN(returns,fcn_name,subevent_header *__header,__data_src<1,1,1> &__buffer);
+  FORCE_IMPL_FCN(returns,fcn_name,subevent_header *__header,__data_src<1,1,1> &__buffer); \
+  FORCE_IMPL_FCN(returns,fcn_name,subevent_header *__header,__data_src<0,0,2> &__buffer); \
+  FORCE_IMPL_FCN(returns,fcn_name,subevent_header *__header,__data_src<0,1,2> &__buffer); \
+  FORCE_IMPL_FCN(returns,fcn_name,subevent_header *__header,__data_src<1,0,2> &__buffer); \
+  FORCE_IMPL_FCN(returns,fcn_name,subevent_header *__header,__data_src<1,1,2> &__buffer);
 
 #else
 
@@ -62,19 +74,25 @@
   FORCE_IMPL_FCN(returns,fcn_name,__data_src<0,0> &__buffer); \
   FORCE_IMPL_FCN(returns,fcn_name,__data_src<1,0> &__buffer); \
   FORCE_IMPL_FCN(returns,fcn_name,__data_src<0,1> &__buffer); \
-  FORCE_IMPL_FCN(returns,fcn_name,__data_src<1,1> &__buffer);
+  FORCE_IMPL_FCN(returns,fcn_name,__data_src<1,1> &__buffer); \
+  FORCE_IMPL_FCN(returns,fcn_name,__data_src<0,2> &__buffer); \
+  FORCE_IMPL_FCN(returns,fcn_name,__data_src<1,2> &__buffer);
 
 #define FORCE_IMPL_DATA_SRC_FCN_ARG(returns,fcn_name,...) \
   FORCE_IMPL_FCN(returns,fcn_name,__data_src<0,0> &__buffer,__VA_ARGS__); \
   FORCE_IMPL_FCN(returns,fcn_name,__data_src<1,0> &__buffer,__VA_ARGS__); \
   FORCE_IMPL_FCN(returns,fcn_name,__data_src<0,1> &__buffer,__VA_ARGS__); \
-  FORCE_IMPL_FCN(returns,fcn_name,__data_src<1,1> &__buffer,__VA_ARGS__);
+  FORCE_IMPL_FCN(returns,fcn_name,__data_src<1,1> &__buffer,__VA_ARGS__); \
+  FORCE_IMPL_FCN(returns,fcn_name,__data_src<0,2> &__buffer,__VA_ARGS__); \
+  FORCE_IMPL_FCN(returns,fcn_name,__data_src<1,2> &__buffer,__VA_ARGS__);
 
 #define FORCE_IMPL_DATA_SRC_FCN_HDR(returns,fcn_name) \
   FORCE_IMPL_FCN(returns,fcn_name,subevent_header *__header,__data_src<0,0> &__buffer); \
   FORCE_IMPL_FCN(returns,fcn_name,subevent_header *__header,__data_src<1,0> &__buffer); \
   FORCE_IMPL_FCN(returns,fcn_name,subevent_header *__header,__data_src<0,1> &__buffer); \
-  FORCE_IMPL_FCN(returns,fcn_name,subevent_header *__header,__data_src<1,1> &__buffer);
+  FORCE_IMPL_FCN(returns,fcn_name,subevent_header *__header,__data_src<1,1> &__buffer); \
+  FORCE_IMPL_FCN(returns,fcn_name,subevent_header *__header,__data_src<0,2> &__buffer); \
+  FORCE_IMPL_FCN(returns,fcn_name,subevent_header *__header,__data_src<1,2> &__buffer);
 
 #endif
 
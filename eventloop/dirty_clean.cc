@@ -0,0 +1,115 @@
+/* This file is part of UCESB - a tool for data unpacking and processing.
+ *
+ * Copyright (C) 2016  GSI Helmholtzzentrum fuer Schwerionenforschung GmbH
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+ * MA  02110-1301  USA
+ */
+
+#include "dirty_clean.hh"
+
+#include "error.hh"
+
+#include <string.h>
+
+dirty_clean _dirty_clean_raw;
+dirty_clean _dirty_clean_cal;
+
+dirty_clean_dest _dirty_dest_raw = { 0, &_dirty_clean_raw };
+dirty_clean_dest _dirty_dest_cal = { 0, &_dirty_clean_cal };
+
+#ifdef USE_MULTI_EVENT_POOL
+bool _dirty_dest_per_thread = false;
+__thread dirty_clean_dest *_dirty_dest_thread_raw = &_dirty_dest_raw;
+__thread dirty_clean_dest *_dirty_dest_thread_cal = &_dirty_dest_cal;
+#endif
+
+dirty_clean::dirty_clean()
+{
+  _enabled = false;
+
+  _base  = NULL;
+  _image = NULL;
+  _size  = 0;
+  _num_blocks = 0;
+
+  _dirty = NULL;
+  _list  = NULL;
+  _num_list = 0;
+}
+
+void dirty_clean::setup(void *base,size_t size)
+{
+  _num_blocks = (size + DIRTY_CLEAN_BLOCK_SIZE - 1) >> DIRTY_CLEAN_BLOCK_BITS;
+
+  _image = (char *)   malloc (size);
+  _dirty = (uint32 *) malloc (((_num_blocks + 31) / 32) * sizeof (uint32));
+  _list  = (uint32 *) malloc (_num_blocks * sizeof (uint32));
+
+  if (!_image || !_dirty || !_list)
+    ERROR("Memory allocation failure!");
+
+  memcpy(_image,base,size);
+  memset(_dirty,0,((_num_blocks + 31) / 32) * sizeof (uint32));
+  _num_list = 0;
+
+  // Marking starts now.
+  _base = (char *) base;
+  _size = size;
+}
+
+void dirty_clean::restore()
+{
+  for (size_t i = 0; i < _num_list; i++)
+    {
+      size_t block  = _list[i];
+      size_t offset = block << DIRTY_CLEAN_BLOCK_BITS;
+      size_t length = DIRTY_CLEAN_BLOCK_SIZE;
+
+      if (offset + length > _size)
+	length = _size - offset;
+
+      memcpy(_base + offset,_image + offset,length);
+      _dirty[block / 32] = 0;
+    }
+  _num_list = 0;
+}
+
+void dirty_clean::copy_dirty(void *dest_base,dirty_clean *dest) const
+{
+  if (dest && !dest->_image)
+    dest = NULL;
+
+  for (size_t i = 0; i < _num_list; i++)
+    {
+      size_t block  = _list[i];
+      size_t offset = block << DIRTY_CLEAN_BLOCK_BITS;
+      size_t length = DIRTY_CLEAN_BLOCK_SIZE;
+
+      if (offset + length > _size)
+	length = _size - offset;
+
+      memcpy((char *) dest_base + offset,_base + offset,length);
+      if (dest)
+	dest->mark_block(block);
+    }
+}
+
+void dirty_clean_mark(const void *ptr,size_t size)
+{
+  // User functions get the structures of the thread.
+  dirty_dest_raw()._dirty->mark(ptr,size);
+  dirty_dest_cal()._dirty->mark(ptr,size);
+}
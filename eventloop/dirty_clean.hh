@@ -0,0 +1,218 @@
+/* This file is part of UCESB - a tool for data unpacking and processing.
+ *
+ * Copyright (C) 2016  GSI Helmholtzzentrum fuer Schwerionenforschung GmbH
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+ * MA  02110-1301  USA
+ */
+
+#ifndef __DIRTY_CLEAN_HH__
+#define __DIRTY_CLEAN_HH__
+
+#include "typedef.hh"
+#include "zero_suppress_map.hh"
+#include "control_include.hh"
+#include "optimise.hh"
+
+#include <stdlib.h>
+#include <stddef.h>
+
+/* Cleaning of the raw and cal level structures between events, by
+ * only resetting what the mapping and calibration actually wrote.
+ *
+ * After the first (full) __clean(), an image of the clean structure
+ * is kept.  The structure is divided into blocks, and every write
+ * (including the valid bits / item counts of zero-suppressed arrays
+ * and lists) marks its block(s) dirty.  Cleaning then copies back
+ * only the dirty blocks from the image.
+ *
+ * Writes by user functions (also UNPACK_EVENT_USER_FUNCTION, which
+ * may fill the raw level) are not seen, so unless they report
+ * themselves (USER_MARK_DIRTY), a full clean is done instead.
+ */
+
+#define DIRTY_CLEAN_BLOCK_BITS  6   // 64 bytes per block
+#define DIRTY_CLEAN_BLOCK_SIZE  (1 << DIRTY_CLEAN_BLOCK_BITS)
+
+class dirty_clean
+{
+public:
+  dirty_clean();
+
+public:
+  bool    _enabled;
+
+  char   *_base;
+  char   *_image;
+  size_t  _size;
+  size_t  _num_blocks;
+
+  uint32 *_dirty;     // bitmask, one bit per block
+  uint32 *_list;      // dirty blocks, in order of marking
+  size_t  _num_list;
+
+public:
+  void setup(void *base,size_t size);
+  void restore();
+
+public:
+  void mark_block(size_t block)
+  {
+    uint32 *word = &_dirty[block / 32];
+    uint32  mask = ((uint32) 1) << (block % 32);
+
+    if (*word & mask)
+      return;
+    *word |= mask;
+    _list[_num_list++] = (uint32) block;
+  }
+
+  void mark(const void *ptr,size_t size)
+  {
+    // Anything not within the structure (e.g. sticky events, or
+    // before setup) is outside the range and ignored.
+    size_t first = (size_t) ((const char *) ptr - _base);
+
+    if (first >= _size)
+      return;
+
+    size_t last = first + size - 1;
+
+    if (last >= _size)
+      last = _size - 1;
+
+    for (size_t block = first >> DIRTY_CLEAN_BLOCK_BITS;
+	 block <= (last >> DIRTY_CLEAN_BLOCK_BITS); block++)
+      mark_block(block);
+  }
+
+  // The insert calls of zero-suppressed containers modify the
+  // valid bit / item count of the container.  The info has the
+  // addresses within _static_event, reloc moves them (see below).
+  void mark_zzp(const zero_suppress_info *info,ptrdiff_t reloc)
+  {
+    switch (info->_type)
+      {
+      case ZZP_INFO_CALL_ARRAY_INDEX:
+      case ZZP_INFO_CALL_ARRAY_MULTI_INDEX:
+      case ZZP_INFO_CALL_ARRAY_LIST_II_INDEX:
+	mark((const char *) (info->_array._limit_mask +
+			     info->_array._index / BITSONE_CONTAINER_BITS) +
+	     reloc,
+	     sizeof (info->_array._limit_mask[0]));
+	break;
+      case ZZP_INFO_CALL_LIST_INDEX:
+      case ZZP_INFO_CALL_LIST_LIST_II_INDEX:
+	mark((const char *) info->_list._limit + reloc,
+	     sizeof (info->_list._limit[0]));
+	break;
+      }
+    switch (info->_type)
+      {
+      case ZZP_INFO_CALL_ARRAY_MULTI_INDEX:
+      case ZZP_INFO_CALL_ARRAY_LIST_II_INDEX:
+      case ZZP_INFO_CALL_LIST_LIST_II_INDEX:
+      case ZZP_INFO_CALL_LIST_II_INDEX:
+	mark((const char *) info->_list_ii._limit + reloc,
+	     sizeof (info->_list_ii._limit[0]));
+	break;
+      }
+  }
+
+  // Copy the dirty blocks to another instance of the structure at
+  // dest_base.  Its tracker (if any, i.e. set up) is marked
+  // accordingly.  (Parallel multi-events.)
+  void copy_dirty(void *dest_base,dirty_clean *dest) const;
+};
+
+template<typename T>
+void dirty_clean_struct(dirty_clean &dirty,T &item)
+{
+  if (dirty._enabled && dirty._image)
+    {
+      dirty.restore();
+      return;
+    }
+  item.__clean();
+  if (dirty._enabled)
+    dirty.setup(&item,sizeof (item));
+}
+
+extern dirty_clean _dirty_clean_raw;
+extern dirty_clean _dirty_clean_cal;
+
+// Mapping and calibration of the multi-events within one file event
+// by several threads, see multi_event_pool.hh.
+
+#if USING_MULTI_EVENTS && defined(USE_PTHREAD) && \
+  defined(HAVE_THREAD_LOCAL_STORAGE) && \
+  !USE_THREADING && !defined(USE_MERGING)
+#define USE_MULTI_EVENT_POOL 1
+#endif
+
+// Where the signal mapping (raw) and the calibration (cal) write.
+// The destinations are set up as addresses within _static_event.
+// Worker threads processing multi-events in parallel instead write
+// to their own copy of the structure, _reloc bytes away, which has
+// its own tracking.  For the main thread, _reloc is 0.
+
+struct dirty_clean_dest
+{
+  ptrdiff_t    _reloc;
+  dirty_clean *_dirty;
+};
+
+extern dirty_clean_dest _dirty_dest_raw;
+extern dirty_clean_dest _dirty_dest_cal;
+
+#ifdef USE_MULTI_EVENT_POOL
+// Only when worker threads are in use (--multi-event-threads), the
+// destinations are looked up per thread.
+extern bool _dirty_dest_per_thread;
+extern __thread dirty_clean_dest *_dirty_dest_thread_raw;
+extern __thread dirty_clean_dest *_dirty_dest_thread_cal;
+#endif
+
+inline dirty_clean_dest &dirty_dest_raw()
+{
+#ifdef USE_MULTI_EVENT_POOL
+  if (UNLIKELY(_dirty_dest_per_thread))
+    return *_dirty_dest_thread_raw;
+#endif
+  return _dirty_dest_raw;
+}
+
+inline dirty_clean_dest &dirty_dest_cal()
+{
+#ifdef USE_MULTI_EVENT_POOL
+  if (UNLIKELY(_dirty_dest_per_thread))
+    return *_dirty_dest_thread_cal;
+#endif
+  return _dirty_dest_cal;
+}
+
+template<typename T>
+T *dirty_dest_reloc(const dirty_clean_dest &dest,T *ptr)
+{
+  return (T *) (((char *) ptr) + dest._reloc);
+}
+
+void dirty_clean_mark(const void *ptr,size_t size);
+
+// For user functions that write to the raw or cal level, when the
+// unpacker defines USER_FUNCTIONS_MARK_DIRTY.
+#define USER_MARK_DIRTY(item) dirty_clean_mark(&(item),sizeof (item))
+
+#endif//__DIRTY_CLEAN_HH__
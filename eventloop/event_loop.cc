@@ -25,6 +25,8 @@
 #include "zero_suppress_map.hh"
 #include "signal_id_map.hh"
 #include "struct_mapping.hh"
+#include "dirty_clean.hh"
+#include "multi_event_pool.hh"
 
 #include "error.hh"
 #include "colourtext.hh"
@@ -44,11 +46,14 @@
 #include "struct_calib.hh"
 
 #include "mc_def.hh"
+#include "calib_valid.hh"
 
 #include "reclaim.hh"
 
 #include "event_sizes.hh"
 #include "accounting.hh"
+#include "stage_profile.hh"
+#include "match_profile.hh"
 #include "tstamp_alignment.hh"
 #include "select_event.hh"
 
@@ -68,6 +73,7 @@ ucesb_event_loop::ucesb_event_loop()
 {
 #ifdef USE_LMD_INPUT
   _file_output_bad = NULL;
+  _record = NULL;
 #endif
 #ifdef USE_EXT_WRITER
   _ext_source = NULL;
@@ -195,6 +201,36 @@ void ucesb_event_loop::preprocess()
   _calib.__clean();
 #endif
 
+#if !USE_THREADING && !defined(USE_MERGING)
+  // Writes by user functions are not tracked, unless they say so.
+  if (!_conf._full_clean && !_conf._reverse)
+    {
+#if !(defined(UNPACK_EVENT_USER_FUNCTION) || \
+       defined(RAW_EVENT_USER_FUNCTION) || \
+       defined(CAL_EVENT_USER_FUNCTION)) || \
+  defined(USER_FUNCTIONS_MARK_DIRTY)
+      _dirty_clean_raw._enabled = true;
+#endif
+#if !defined(CAL_EVENT_USER_FUNCTION) || defined(USER_FUNCTIONS_MARK_DIRTY)
+      _dirty_clean_cal._enabled = true;
+#endif
+    }
+#endif
+
+#ifdef USE_MULTI_EVENT_POOL
+  if (_conf._multi_event_threads)
+    {
+#if (defined(RAW_EVENT_USER_FUNCTION) || defined(CAL_EVENT_USER_FUNCTION)) && \
+  !defined(MULTI_EVENT_USER_FUNCTIONS_REENTRANT)
+      ERROR("--multi-event-threads requires raw/cal user functions "
+	    "that only use their arguments "
+	    "(MULTI_EVENT_USER_FUNCTIONS_REENTRANT).");
+#endif
+      _multi_event_pool = new multi_event_pool;
+      _multi_event_pool->init(_conf._multi_event_threads);
+    }
+#endif
+
 #ifndef USE_MERGING
   read_map_calib_info();
 
@@ -204,9 +240,15 @@ void ucesb_event_loop::preprocess()
 
   process_map_calib_info();
 
+#ifndef USE_LMD_INPUT
+  if (_calib_valid_kinds & CALIB_VALID_KIND_WR)
+    ERROR("CALIB_VALID(WR,...) requires LMD input (WR time stamps).");
+#endif
+
   if (_conf._show_calib)
     {
       show_calib_map();
+      show_calib_valid();
 #ifdef CALIB_STRUCT
       pretty_dump_info pdi;
       memset(&pdi,0,sizeof(pdi));
@@ -248,15 +290,40 @@ void ucesb_event_loop::postprocess()
 {
   bool boom = false;
 
+#ifdef USE_MULTI_EVENT_POOL
+  if (_multi_event_pool)
+    {
+      _multi_event_pool->stop();
+      delete _multi_event_pool;
+      _multi_event_pool = NULL;
+    }
+#endif
+
 #ifdef USE_LMD_INPUT
   if (_ts_align_hist)
     _ts_align_hist->show();
 #endif
 
   if (_conf._event_sizes)
-    _event_sizes.show();
+    {
+      _event_sizes.show();
+#if !USE_THREADING && !USE_MERGING
+#if defined(USE_LMD_INPUT) || defined(USE_HLD_INPUT) || defined(USE_MVLC_INPUT) || defined(USE_RIDF_INPUT)
+      const kbm_stats &stats = _file_event._defrag_event_many._stats;
+
+      printf ("Event arena: %" PRIu64 " allocations, "
+	      "%" PRIu64 " mallocs, %" PRIu64 " events, "
+	      "max %zd bytes/event.\n",
+	      stats._allocs, stats._mallocs, stats._releases,
+	      stats._max_used);
+#endif
+#endif
+    }
   if (_conf._account)
     account_show();
+  if (_conf._profile)
+    stage_profile_show();
+  match_profile_write();
 
 #ifdef EXIT_USER_FUNCTION
   EXIT_USER_FUNCTION();
@@ -357,6 +424,16 @@ void ucesb_event_loop::close_output()
       delete _file_output_bad;
       _file_output_bad = NULL;
     }
+  if (_record)
+    {
+      try {
+	_record->close();
+      } catch (error &e) {
+	boom = true;
+      }
+      delete _record;
+      _record = NULL;
+    }
 #endif
   if (boom)
     throw error();
@@ -819,6 +896,9 @@ void ucesb_event_loop::open_source(source_type &source,
   if (input._type == INPUT_TYPE_EXTERNAL)
     {
       _ext_source = paw_ntuple_open_stage(input._name,true);
+      // Data is read directly into the structures.
+      _dirty_clean_raw._enabled = false;
+      _dirty_clean_cal._enabled = false;
       *file_input = NULL;
       return;
     }
@@ -827,7 +907,8 @@ void ucesb_event_loop::open_source(source_type &source,
 #ifdef USE_LMD_INPUT
   if (input._type != INPUT_TYPE_FILE &&
       input._type != INPUT_TYPE_RFIO &&
-      input._type != INPUT_TYPE_FILE_SRM)
+      input._type != INPUT_TYPE_FILE_SRM &&
+      input._type != LMD_INPUT_TYPE_REPLAY)
     {
       source.connect(input._name,
 		     input._type
@@ -845,10 +926,15 @@ void ucesb_event_loop::open_source(source_type &source,
   source.new_file();
   *file_input = source._input._input;
 
+  calib_valid_new_file();
+
 #ifdef USE_LMD_INPUT
+  source._replay = (input._type == LMD_INPUT_TYPE_REPLAY);
+
   if (input._type != INPUT_TYPE_RFIO &&
       input._type != INPUT_TYPE_FILE &&
-      input._type != INPUT_TYPE_FILE_SRM)
+      input._type != INPUT_TYPE_FILE_SRM &&
+      input._type != LMD_INPUT_TYPE_REPLAY)
     {
       source._expect_file_header = false;
       source._buffers_maybe_missing = true;
@@ -1153,6 +1239,13 @@ void show_remaining(event_base_t &eb,
 #pragma GCC diagnostic pop
 #endif
 
+#if USE_THREADING
+// The threaded event processing has no per-worker counters (yet).
+#define LOOP_STAGE_PROFILE  ((stage_profile_thread *) NULL)
+#else
+#define LOOP_STAGE_PROFILE  _stage_profile_main
+#endif
+
 template<typename __data_src_t,typename start_ptr_t,
 	 typename event_base_t,typename subevent_header_t>
 void unpack_subevent(event_base_t &eb,
@@ -1182,6 +1275,9 @@ void unpack_subevent(event_base_t &eb,
    */
 
   int loc;
+
+  STAGE_PROFILE_BEGIN(LOOP_STAGE_PROFILE,t_subevent);
+
   try {
     loc = eb._unpack.__unpack_subevent((subevent_header*) ev_header,src);
   } catch (error &e) {
@@ -1190,6 +1286,10 @@ void unpack_subevent(event_base_t &eb,
     throw;
   }
 
+  if (UNLIKELY(LOOP_STAGE_PROFILE != NULL) && loc)
+    stage_profile_account_subevent(LOOP_STAGE_PROFILE,loc,
+				   stage_profile_cycles() - t_subevent);
+
   if (!loc)
     {
       char headermsg[128];
@@ -1239,6 +1339,77 @@ void revoke_subevent(event_base_t &eb,
     }
 }
 
+#if defined(USE_LMD_INPUT) && !defined(USE_THREADING)
+static void bulk_swap_unmap(void *&ptr,
+			    char *swap_start,char *swap_end,char *start)
+{
+  if ((char *) ptr >= swap_start && (char *) ptr <= swap_end)
+    ptr = start + ((char *) ptr - swap_start);
+}
+
+/* For --bulk-swap: the subevent is swapped in one go into scratch
+ * memory (living as long as the event), and then unpacked without
+ * swapping.  As whole 32-bit words are swapped, 8 and 16 bit items
+ * end up at the other end of the word, i.e. scrambling toggles.
+ */
+
+template<int account,typename event_base_t>
+void unpack_subevent_bulk_swap(event_base_t &eb,
+			       lmd_event *src_event,
+			       lmd_subevent *subevent_info,
+			       char *start,char *end,int scramble)
+{
+  // Swap entire (aligned) words.  A partial word at the end must
+  // not be read in full (may be beyond the mapped data), its bytes
+  // are swapped one by one.
+  size_t pre = ((size_t) start) & 3;
+  uint32 *src_words = (uint32 *) (start - pre);
+  size_t length = (size_t) (end - (char *) src_words);
+  size_t words = length / 4;
+  size_t tail = length & 3;
+
+  char *scratch = (char *)
+    src_event->_defrag_event_many.allocate((words + 1) * sizeof (uint32) +
+					   32);
+  uint32 *dest_words = (uint32 *) (((size_t) scratch + 31) & ~(size_t) 31);
+
+  byteswap_32_copy(dest_words,src_words,words);
+
+  if (tail)
+    {
+      const char *src_tail = (const char *) (src_words + words);
+      char *dest_tail = (char *) (dest_words + words);
+
+      memset(dest_tail,0,sizeof (uint32));
+      for (size_t i = 0; i < tail; i++)
+	dest_tail[3 - i] = src_tail[i];
+    }
+
+  char *swap_start = ((char *) dest_words) + pre;
+  char *swap_end   = swap_start + (end - start);
+
+  try {
+    if (scramble)
+      {
+	__data_src<0,0,account> src(swap_start,swap_end);
+	unpack_subevent(eb,&subevent_info->_header,src,swap_start);
+      }
+    else
+      {
+	__data_src<0,1,account> src(swap_start,swap_end);
+	unpack_subevent(eb,&subevent_info->_header,src,swap_start);
+      }
+  } catch (error &e) {
+    // Error marks shall point into the original event data.
+    bulk_swap_unmap(eb._unpack_fail._prev,swap_start,swap_end,start);
+    bulk_swap_unmap(eb._unpack_fail._this,swap_start,swap_end,start);
+    bulk_swap_unmap(eb._unpack_fail._next,swap_start,swap_end,start);
+    throw;
+  }
+  bulk_swap_unmap(eb._unpack_fail._next,swap_start,swap_end,start);
+}
+#endif
+
 void unpack_clean(event_base &eb)
 {
   eb._unpack.__clean();
@@ -1427,14 +1598,10 @@ void ucesb_event_loop::unpack_event(T_event_base &eb)
       // in our (or lmd) buffers fragmented, we should check that it is not
       // a subevent that is just to be skipped
 
-      // This could be fixed by arranging for a hash table (of some
-      // sorts) for the subevents, giving a function pointer etc to do
-      // the actual unpacking work, instead of the current method
-      // (which scales horribly when there are many kinds of
-      // subevents)
-
-      // Also, with a hash table, we can directly fix up the
-      // swap/scramble correct pointers...  (he, he)
+      // Which SUBEVENT declaration a header matches is remembered
+      // by the generated __unpack_subevent (subevent_match_cache.hh),
+      // so many kinds of subevents only cost a full linear match the
+      // first time each is seen.
 
       typedef __typeof__(*src_event->_subevents) subevent_t;
 
@@ -1473,6 +1640,12 @@ void ucesb_event_loop::unpack_event(T_event_base &eb)
       scramble ^= src_event->_swapping;
       scramble ^= _conf._scramble;
 
+#ifndef USE_THREADING
+      if (src_event->_swapping && _conf._bulk_swap)
+	unpack_subevent_bulk_swap<account>(eb,src_event,subevent_info,
+					   start,end,scramble);
+      else
+#endif
       if (src_event->_swapping)
 	{
 	  if (scramble)
@@ -1558,6 +1731,8 @@ template
 void ucesb_event_loop::unpack_event<sticky_event_base,0>(sticky_event_base &eb);
 template
 void ucesb_event_loop::unpack_event<sticky_event_base,1>(sticky_event_base &eb);
+template
+void ucesb_event_loop::unpack_event<event_base,DATA_SRC_TRUSTED>(event_base &eb);
 
 void ucesb_event_loop::force_event_data(event_base &eb
 #if defined(USE_LMD_INPUT) || defined(USE_HLD_INPUT) || defined(USE_MVLC_INPUT) || defined(USE_RIDF_INPUT)
@@ -1631,8 +1806,8 @@ void set_sticky_idx(unpack_sticky_event_base& unpack)
 void event_base::raw_cal_user_clean()
 {
 #ifndef USE_MERGING
-  _raw.__clean();
-  _cal.__clean();
+  dirty_clean_struct(_dirty_clean_raw,_raw);
+  dirty_clean_struct(_dirty_clean_cal,_cal);
 #ifdef USER_STRUCT
   _user.__clean();
 #endif
@@ -1757,10 +1932,148 @@ void wrap_paw_ntuple_event(sticky_event_base &eb_dummy)
 #endif
 }
 
+#ifndef USE_MERGING
+void wrap_calib_valid_select(event_base &eb,FILE_INPUT_EVENT *src_event)
+{
+  if (!_calib_valid_kinds)
+    return;
+
+  const uint64_t *wr_timestamp = NULL;
+
+#ifdef USE_LMD_INPUT
+  uint64_t timestamp;
+
+  if ((_calib_valid_kinds & CALIB_VALID_KIND_WR) &&
+      src_event && src_event->_nsubevents)
+    {
+      if (get_timestamp(TIMESTAMP_TYPE_WR, src_event, &timestamp, NULL))
+	wr_timestamp = &timestamp;
+    }
+#endif
+
+  calib_valid_select(eb._unpack.event_no, wr_timestamp);
+}
+
+void wrap_calib_valid_select(sticky_event_base &eb,
+			     FILE_INPUT_EVENT *src_event)
+{
+}
+#endif
+
+#if USING_MULTI_EVENTS
+void set_multi_map_info(map_members_info &map_info,
+			int mev,int multievents)
+{
+  map_info._multi_event_no = mev;
+  map_info._event_type = 0;
+
+  if (mev == 0)
+    map_info._event_type |= MAP_MEMBER_TYPE_MULTI_FIRST;
+  if (mev == multievents-1)
+    map_info._event_type |= MAP_MEMBER_TYPE_MULTI_LAST;
+  if (!(map_info._event_type & (MAP_MEMBER_TYPE_MULTI_FIRST |
+				MAP_MEMBER_TYPE_MULTI_LAST)))
+    map_info._event_type |= MAP_MEMBER_TYPE_MULTI_OTHER;
+}
+#endif
+
+#ifdef USE_MULTI_EVENT_POOL
+// Executed by the worker threads, see multi_event_pool.hh.
+void multi_event_map_calib(event_base &eb,
+			   raw_event *raw,cal_event *cal
+#ifdef USER_STRUCT
+			   ,USER_STRUCT *user
+#endif
+			   ,int mev,int multievents,
+			   stage_profile_thread *prof)
+{
+  map_members_info map_info;
+
+  set_multi_map_info(map_info,mev,multievents);
+
+  {
+  STAGE_PROFILE_BEGIN(prof,t_map_raw);
+
+  do_unpack_map(&eb._unpack, map_info);
+
+  copy_eventno_sub_trig(*raw, eb._unpack,
+			mev+1,
+			mev == multievents-1);
+
+  STAGE_PROFILE_END(prof,STAGE_PROFILE_MAP_RAW,t_map_raw);
+  }
+
+  {
+  STAGE_PROFILE_BEGIN(prof,t_raw_user);
+
+  wrap_RAW_EVENT_USER_FUNCTION(&eb._unpack,raw,map_info);
+
+  STAGE_PROFILE_END(prof,STAGE_PROFILE_RAW_USER,t_raw_user);
+  }
+
+  if (_conf._last_stage == LAST_STAGE_RAW)
+    return;
+
+  {
+  STAGE_PROFILE_BEGIN(prof,t_calib);
+
+  do_calib_map(raw);
+
+  STAGE_PROFILE_END(prof,STAGE_PROFILE_CALIB,t_calib);
+  }
+
+  {
+  STAGE_PROFILE_BEGIN(prof,t_cal_user);
+
+  wrap_CAL_EVENT_USER_FUNCTION(&eb._unpack,raw,cal
+#ifdef USER_STRUCT
+			       ,user
+#endif
+			       ,map_info);
+
+  STAGE_PROFILE_END(prof,STAGE_PROFILE_CAL_USER,t_cal_user);
+  }
+}
+
+bool multi_event_pool_begin(event_base &eb,int multievents)
+{
+  if (!_multi_event_pool ||
+      multievents <= 1 ||
+      &eb != &_static_event)
+    return false;
+
+  _multi_event_pool->begin(&eb,multievents);
+  return true;
+}
+
+bool multi_event_pool_begin(sticky_event_base &eb,int multievents)
+{
+  return false;
+}
+
+void multi_event_pool_retire(event_base &eb,int mev)
+{
+  _multi_event_pool->retire(mev);
+}
+
+void multi_event_pool_retire(sticky_event_base &eb,int mev)
+{
+}
+
+void multi_event_pool_drain(bool pooled)
+{
+  if (pooled)
+    _multi_event_pool->drain();
+}
+#endif
+
 template<typename T_event_base>
 bool ucesb_event_loop::handle_event(T_event_base &eb,int *num_multi)
 {
   int multievents = 1;
+#ifdef USE_MULTI_EVENT_POOL
+  bool pooled = false;
+#endif
 
   set_sticky_idx(eb._unpack);
 
@@ -1768,7 +2081,12 @@ bool ucesb_event_loop::handle_event(T_event_base &eb,int *num_multi)
   if (!_ext_source)
 #endif
     {
+      STAGE_PROFILE_BEGIN(LOOP_STAGE_PROFILE,t_unpack_user);
+
       multievents = wrap_UNPACK_EVENT_USER_FUNCTION(&eb._unpack);
+
+      STAGE_PROFILE_END(LOOP_STAGE_PROFILE,STAGE_PROFILE_UNPACK_USER,
+			t_unpack_user);
     }
 
   try {
@@ -1795,6 +2113,24 @@ bool ucesb_event_loop::handle_event(T_event_base &eb,int *num_multi)
       // TODO: if (!good_stamp) { do we want to account 0 at all? }
       _ts_align_hist->account(ts_align_index, timestamp);
     }
+#endif
+  {
+#if USE_THREADING
+    FILE_INPUT_EVENT *src_event = (FILE_INPUT_EVENT *) eb._file_event;
+#else
+    FILE_INPUT_EVENT *src_event = &_file_event;
+#endif
+#if defined(USE_EXT_WRITER)
+    if (_ext_source)
+      src_event = NULL;
+#endif
+    wrap_calib_valid_select(eb, src_event);
+  }
+#ifdef USE_MULTI_EVENT_POOL
+#if defined(USE_EXT_WRITER)
+  if (!_ext_source)
+#endif
+    pooled = multi_event_pool_begin(eb, multievents);
 #endif
   for (int mev = 0; mev < multievents; mev++)
     {
@@ -1850,17 +2186,42 @@ bool ucesb_event_loop::handle_event(T_event_base &eb,int *num_multi)
 #if USING_MULTI_EVENTS
       map_members_info map_info;
 
-      map_info._multi_event_no = mev;
-      map_info._event_type = 0;
+      set_multi_map_info(map_info, mev, multievents);
+#endif
+
+#ifdef USE_MULTI_EVENT_POOL
+      if (pooled)
+	{
+	  // Mapped and calibrated by the worker threads.
+	  multi_event_pool_retire(eb, mev);
 
-      if (mev == 0)
-	map_info._event_type |= MAP_MEMBER_TYPE_MULTI_FIRST;
-      if (mev == multievents-1)
-	map_info._event_type |= MAP_MEMBER_TYPE_MULTI_LAST;
-      if (!(map_info._event_type & (MAP_MEMBER_TYPE_MULTI_FIRST |
-				    MAP_MEMBER_TYPE_MULTI_LAST)))
-	map_info._event_type |= MAP_MEMBER_TYPE_MULTI_OTHER;
+	  // Not dirty-tracked, so not part of the copied-back blocks.
+	  copy_eventno_sub_trig(eb._raw, eb._unpack,
+				mev+1,
+				mev == multievents-1);
 
+	  level_dump(DUMP_LEVEL_RAW,"RAW",eb._raw);
+
+	  if (_conf._last_stage == LAST_STAGE_RAW)
+	    continue;
+
+	  level_dump(DUMP_LEVEL_CAL,"CAL",eb._cal);
+
+#ifdef USER_STRUCT
+	  level_dump(DUMP_LEVEL_USER,"USER",eb._user);
+#endif
+
+	  if (_conf._last_stage == LAST_STAGE_CAL)
+	    continue;
+
+	  goto map_process_done;
+	}
+#endif
+
+      {
+      STAGE_PROFILE_BEGIN(LOOP_STAGE_PROFILE,t_map_raw);
+
+#if USING_MULTI_EVENTS
       do_unpack_map(&eb._unpack, map_info);
 
       copy_eventno_sub_trig(eb._raw, eb._unpack,
@@ -1870,16 +2231,37 @@ bool ucesb_event_loop::handle_event(T_event_base &eb,int *num_multi)
       do_unpack_map(&eb._unpack);
 #endif
 
+      STAGE_PROFILE_END(LOOP_STAGE_PROFILE,STAGE_PROFILE_MAP_RAW,t_map_raw);
+      }
+
+      {
+      STAGE_PROFILE_BEGIN(LOOP_STAGE_PROFILE,t_raw_user);
+
       wrap_RAW_EVENT_USER_FUNCTION(&eb._unpack,&eb._raw
 #if USING_MULTI_EVENTS
 				   ,map_info
 #endif
 				   );
 
+      STAGE_PROFILE_END(LOOP_STAGE_PROFILE,STAGE_PROFILE_RAW_USER,t_raw_user);
+      }
+
       level_dump(DUMP_LEVEL_RAW,"RAW",eb._raw);
 
+      if (_conf._last_stage == LAST_STAGE_RAW)
+	continue;
+
+      {
+      STAGE_PROFILE_BEGIN(LOOP_STAGE_PROFILE,t_calib);
+
       do_calib_map(&eb._raw);
 
+      STAGE_PROFILE_END(LOOP_STAGE_PROFILE,STAGE_PROFILE_CALIB,t_calib);
+      }
+
+      {
+      STAGE_PROFILE_BEGIN(LOOP_STAGE_PROFILE,t_cal_user);
+
       wrap_CAL_EVENT_USER_FUNCTION(&eb._unpack,&eb._raw,&eb._cal
 #ifdef USER_STRUCT
 				   ,&eb._user
@@ -1889,12 +2271,18 @@ bool ucesb_event_loop::handle_event(T_event_base &eb,int *num_multi)
 #endif
 				   );
 
+      STAGE_PROFILE_END(LOOP_STAGE_PROFILE,STAGE_PROFILE_CAL_USER,t_cal_user);
+      }
+
       level_dump(DUMP_LEVEL_CAL,"CAL",eb._cal);
 
 #ifdef USER_STRUCT
       level_dump(DUMP_LEVEL_USER,"USER",eb._user);
 #endif
 
+      if (_conf._last_stage == LAST_STAGE_CAL)
+	continue;
+
     map_process_done:
 
 #ifdef USE_CURSES
@@ -1935,8 +2323,15 @@ bool ucesb_event_loop::handle_event(T_event_base &eb,int *num_multi)
 	      }
 #endif
 	    /* Produce the event. */
+	    STAGE_PROFILE_BEGIN(LOOP_STAGE_PROFILE,t_ntuple);
+
 	    wrap_paw_ntuple_event(eb);
+
+	    STAGE_PROFILE_END(LOOP_STAGE_PROFILE,STAGE_PROFILE_NTUPLE,t_ntuple);
 	  } catch (error &e) {
+#ifdef USE_MULTI_EVENT_POOL
+	    multi_event_pool_drain(pooled);
+#endif
 	    wrap_UNPACK_EVENT_END_USER_FUNCTION(&eb._unpack);
 	    *num_multi = mev;
 	    return false;
@@ -1946,6 +2341,9 @@ bool ucesb_event_loop::handle_event(T_event_base &eb,int *num_multi)
     }
 #endif//!USE_MERGING
   } catch (error &e) {
+#ifdef USE_MULTI_EVENT_POOL
+    multi_event_pool_drain(pooled);
+#endif
     wrap_UNPACK_EVENT_END_USER_FUNCTION(&eb._unpack);
     throw;
   }
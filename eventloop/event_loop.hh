@@ -24,6 +24,7 @@
 #include "lmd_input.hh"
 #include "lmd_output.hh"
 #include "lmd_output_tcp.hh"
+#include "lmd_replay.hh"
 #include "pax_input.hh"
 #include "genf_input.hh"
 #include "ebye_input.hh"
@@ -150,6 +151,7 @@ public:
   typedef lmd_event_hint source_event_hint_t;
   std::vector<output_info> _output;
   lmd_output_file *_file_output_bad;
+  lmd_replay_writer *_record;
 #endif
 #ifdef USE_PAX_INPUT
   pax_source  _source;
@@ -28,6 +28,8 @@
 
 #include "config.hh"
 
+#include "ucesb_probe.hh"
+
 event_processor::~event_processor()
 {
 
@@ -126,11 +128,15 @@ void *event_processor::worker()
 
 	    event_base *eb = (event_base *) send_item._event;
 
+	    UCESB_PROBE1(unpack_start,0);
+
 #if defined(USE_LMD_INPUT) || defined(USE_HLD_INPUT) || defined(USE_MVLC_INPUT) || defined(USE_RIDF_INPUT)
 	    ucesb_event_loop::pre_unpack_event(*eb, &_hints);
 #endif
 
 	    ucesb_event_loop::unpack_event(*eb);
+
+	    UCESB_PROBE2(unpack_end,eb->_unpack.event_no,eb->_unpack.trigger);
 	    /*
 	    int a, b;
 
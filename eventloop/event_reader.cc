@@ -27,6 +27,8 @@
 
 #include "config.hh"
 
+#include "ucesb_probe.hh"
+
 // When running threaded, the event reader is put in it's own thread.
 
 // The main reason is that file reading (map_range (both of file_mmap
@@ -264,6 +266,8 @@ void event_reader::process_file(data_input_source *source)
 	if (!eb->_file_event)
 	  break; // we are done with this file.  (no event will be inserted...)
 
+	UCESB_PROBE1(event_read,insert_queue);
+
 	// It does not really matter that we are after the
 	// if-statement, but this way, the _event pointer is null when
 	// there anyhow is nothing.  The buffer space will be
@@ -331,6 +335,7 @@ void event_reader::process_file(data_input_source *source)
       _wt._last_reclaim = NULL;
 
       // The event is available for processing, insert it
+      UCESB_PROBE2(event_dispatch,insert_queue,(insert_queue-1) % MAX_THREADS);
       _unpack_event_queue.insert();
     }
 
@@ -49,3 +49,21 @@ void ucesb_loc_print_lineno(FILE *fid,int internal)
     }
   FID_PRINTF("LINE_NO_TOO_EARLY(%d):0:",internal);
 }
+
+void ucesb_loc_format(char *dest,size_t size,int internal)
+{
+  location *start = spec_locations;
+  location *map   = spec_locations + countof(spec_locations) - 1;
+
+  while (map >= start)
+    {
+      if (internal >= map->_internal)
+	{
+	  snprintf(dest,size,"%s:%d",
+		   map->_file,map->_line + internal - map->_internal);
+	  return;
+	}
+      map--;
+    }
+  snprintf(dest,size,"loc:%d",internal);
+}
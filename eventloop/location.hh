@@ -36,4 +36,6 @@ class formatted_error;
 void ucesb_loc_print_lineno(FILE *fid,int internal);
 void ucesb_loc_print_lineno(formatted_error &fe,int internal);
 
+void ucesb_loc_format(char *dest,size_t size,int internal);
+
 #endif//__LOCATION_HH__
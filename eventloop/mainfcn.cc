@@ -19,12 +19,19 @@
  */
 
 #include "event_loop.hh"
+#include "multi_event_pool.hh"
 #include "config.hh"
 #include "monitor.hh"
 #include "error.hh"
 #include "colourtext.hh"
 #include "parse_util.hh"
 #include "format_prefix.hh"
+#include "stage_profile.hh"
+#include "match_profile.hh"
+#include "ucesb_probe.hh"
+#include "numa_place.hh"
+#include "huge_pages.hh"
+#include "pipe_buffer.hh"
 
 #include "mc_def.hh"
 
@@ -86,11 +93,27 @@ void usage()
   printf ("  event://HOST      Read from event server HOST.\n");
   printf ("  stream://HOST     Read from stream server HOST.\n");
   printf ("  trans://HOST      Read from transport HOST.\n");
+#ifdef USE_PTHREAD
+  printf ("  shm://NAME        Read streams of local server (--server=...,shm=NAME).\n");
+#endif
+  printf ("  (...)://HOST,reconnect  Reconnect when server goes away.\n");
+  printf ("  replay://FILE     Read events recorded with --record.\n");
   printf ("  --scramble        Toggle scrambling of data.\n");
+#ifndef USE_THREADING
+  printf ("  --bulk-swap       Byte-swap foreign-endian subevents in one go.\n");
+#endif
 #else
   printf (" (stream,event,trans://)  No MBS input support compiled in.\n");
 #endif
   printf ("  --input-buffer=N  Input buffer size.\n");
+  printf ("  --numa=auto|NODE  Run threads (and thus buffers) on one NUMA node.\n");
+  printf ("  --huge-pages=off|thp|hugetlb  Huge pages for input buffers and event structures.\n");
+#if defined(USE_LMD_INPUT) && defined(USE_PTHREAD)
+  printf ("  --stream-conns=N  Receive from stream server over N connections.\n");
+#endif
+#if defined(USE_LMD_INPUT)
+  printf ("  --tcp-rcvbuf=N    Socket receive buffer size for network input.\n");
+#endif
 #if defined(USE_EXT_WRITER) && !defined(USE_MERGING)
   printf ("  --in-tuple=LVL,DET,FILE  Read data from ROOT/STRUCT.\n");
   //printf ("  --reverse         Run mapping in reverse (only with --in-tuple).\n");
@@ -118,6 +141,15 @@ void usage()
   printf ("  --first-event=N   Skip initial events until event # N.\n");
   printf ("  --last-event=N    Stop processing at (before) event # N.\n");
   printf ("  --downscale=N     Only process every Nth event.\n");
+#ifndef USE_THREADING
+  printf ("  --last-stage=STG  Stop processing after read|unpack|raw|cal|all stage.\n");
+#endif
+#if !USE_THREADING && !defined(USE_MERGING)
+  printf ("  --full-clean      Clean all raw/cal items each event (no dirty tracking).\n");
+#endif
+#ifdef USE_MULTI_EVENT_POOL
+  printf ("  --multi-event-threads=N  Map and calibrate multi-events with N threads.\n");
+#endif
 #if 0
   printf ("  --rate=real|NHz   Process events at original or given rate.\n");
 #endif
@@ -128,6 +160,12 @@ void usage()
   printf ("  --colour=yes|no   Force colour and markup on or off.\n");
   printf ("  --event-sizes     Show average sizes of events and subevents.\n");
   printf ("  --data-sizes      Show data size usage by data members.\n");
+  printf ("  --trusted-data[=N]  Skip consistency checks of unpacked data, except\n"
+	  "                    for every Nth event.\n");
+  printf ("  --profile[=FILE]  Show time spent in processing stages (at end and\n"
+	  "                    on SIGUSR1), and write it as JSON to FILE.\n");
+  printf ("  --match-profile=FILE  Count matches of select candidates, write to FILE\n"
+	  "                    (for ucesbgen --match-profile).\n");
 
 #if defined(USE_EXT_WRITER)
   printf ("  --monitor[=PORT]  Status information server.\n");
@@ -145,6 +183,7 @@ void usage()
 #if defined(USE_LMD_INPUT)
   printf ("  --output=OPT,FILE  Save events in LMD file (native/net/big/little,size=nM).\n");
   printf ("  --bad-events=FILE  Save events with unpack errors in LMD file.\n");
+  printf ("  --record=FILE     Save located subevents for replay://FILE.\n");
 # if defined(USE_LMD_OUTPUT_TCP)
   printf ("  --server=OPT      Data server (stream:port,trans:port,size=nM,hold).\n");
 # else
@@ -271,6 +310,11 @@ void sigalarm_handler(int sig)
   _update_progress = 1;
 }
 
+void sigusr1_profile_handler(int sig)
+{
+  _stage_profile_show_request = 1;
+}
+
 
 /********************************************************************/
 
@@ -343,6 +387,22 @@ bool add_input_try_follow_link(const char *path,
     input._name = strdup(post);
     return true;
   }
+#ifdef USE_PTHREAD
+  if ((match_opt_dashes &&
+       MATCH_PATH_PREFIX("--shm=",post)) ||
+      MATCH_PATH_PREFIX("shm://",post)) {
+    input._type = LMD_INPUT_TYPE_SHM; // local stream server
+    input._name = strdup(post);
+    return true;
+  }
+#endif
+  if ((match_opt_dashes &&
+       MATCH_PATH_PREFIX("--replay=",post)) ||
+      MATCH_PATH_PREFIX("replay://",post)) {
+    input._type = LMD_INPUT_TYPE_REPLAY; // located subevents (--record)
+    input._name = strdup(post);
+    return true;
+  }
 #endif//USE_LMD_INPUT
 
   struct stat buf;
@@ -631,9 +691,21 @@ int main(int argc, char **argv)
       else if (MATCH_PREFIX("--bad-events=",post)) {
 	_conf._file_output_bad._name = post;
       }
+      else if (MATCH_PREFIX("--record=",post)) {
+	_conf._file_record._name = post;
+      }
       else if (MATCH_ARG("--scramble")) {
 	_conf._scramble = 1;
       }
+#ifndef USE_THREADING
+      else if (MATCH_ARG("--bulk-swap")) {
+#if UNPACK_HAS_DATA64
+	// The two halves of 64-bit items would come in native order.
+	ERROR("--bulk-swap not supported, specification has 64-bit items.");
+#endif
+	_conf._bulk_swap = 1;
+      }
+#endif
       else if (MATCH_PREFIX("--time-stitch=",post)) {
 	parse_time_stitch_options(post);
       }
@@ -643,6 +715,23 @@ int main(int argc, char **argv)
       else if (MATCH_PREFIX("--tstamp-hist=",post)) {
         _conf._ts_align_hist_command = post;
       }
+      else if (MATCH_PREFIX("--numa=",post)) {
+	_conf._numa = post;
+      }
+      else if (MATCH_PREFIX("--huge-pages=",post)) {
+	_conf._huge_pages = post;
+      }
+#ifdef USE_PTHREAD
+      else if (MATCH_PREFIX("--stream-conns=",post)) {
+	_conf._stream_conns = atoi(post);
+      }
+#endif
+      else if (MATCH_PREFIX("--tcp-rcvbuf=",post)) {
+	_conf._tcp_rcvbuf =
+	  parse_size_postfix(post,"kM","TCP receive buffer size",false);
+	if (_conf._tcp_rcvbuf > 0x40000000)
+	  ERROR("TCP receive buffer size larger than 1 GB.");
+      }
 #endif//USE_LMD_INPUT
       else if (MATCH_PREFIX("--input-buffer=",post)) {
 	_conf._input_buffer =
@@ -678,6 +767,19 @@ int main(int argc, char **argv)
       else if (MATCH_ARG("--reverse")) {
 	_conf._reverse = 1;
       }
+#endif
+#if !USE_THREADING && !defined(USE_MERGING)
+      else if (MATCH_ARG("--full-clean")) {
+	_conf._full_clean = 1;
+      }
+#endif
+#ifdef USE_MULTI_EVENT_POOL
+      else if (MATCH_PREFIX("--multi-event-threads=",post)) {
+	_conf._multi_event_threads = atoi(post);
+	if (_conf._multi_event_threads < 0 ||
+	    _conf._multi_event_threads > 256)
+	  ERROR("Bad number of multi-event threads: %s.",post);
+      }
 #endif
       else if (MATCH_PREFIX("--calib=",post)) {
 	_conf_calib.push_back(post);
@@ -712,6 +814,23 @@ int main(int argc, char **argv)
         if (*end != 0 || end == post)
           ERROR("Invalid number for --downscale.");
       }
+#ifndef USE_THREADING
+      else if (MATCH_PREFIX("--last-stage=",post)) {
+	if (strcmp(post,"read") == 0)
+	  _conf._last_stage = LAST_STAGE_READ;
+	else if (strcmp(post,"unpack") == 0)
+	  _conf._last_stage = LAST_STAGE_UNPACK;
+	else if (strcmp(post,"raw") == 0)
+	  _conf._last_stage = LAST_STAGE_RAW;
+	else if (strcmp(post,"cal") == 0)
+	  _conf._last_stage = LAST_STAGE_CAL;
+	else if (strcmp(post,"all") == 0)
+	  _conf._last_stage = LAST_STAGE_ALL;
+	else
+	  ERROR("Bad option '%s' for --last-stage=",post);
+	_conf._stage_timing = 1;
+      }
+#endif
       else if (MATCH_ARG("--print-buffer")) {
 	_conf._print_buffer = 1;
       }
@@ -729,6 +848,25 @@ int main(int argc, char **argv)
       else if (MATCH_ARG("--data-sizes")) {
 	_conf._account = 1;
       }
+      else if (MATCH_ARG("--trusted-data")) {
+	_conf._trusted_data = 1;
+      }
+      else if (MATCH_PREFIX("--trusted-data=",post)) {
+	_conf._trusted_data = 1;
+	_conf._trusted_check = atoi(post);
+	if (_conf._trusted_check < 0)
+	  ERROR("Bad check interval for --trusted-data: %s.",post);
+      }
+      else if (MATCH_ARG("--profile")) {
+	_conf._profile = 1;
+      }
+      else if (MATCH_PREFIX("--profile=",post)) {
+	_conf._profile = 1;
+	_conf._profile_json = post;
+      }
+      else if (MATCH_PREFIX("--match-profile=",post)) {
+	_conf._match_profile = post;
+      }
       else if (MATCH_ARG("--print")) {
 	_conf._print = 1;
       }
@@ -946,6 +1084,40 @@ int main(int argc, char **argv)
   action.sa_flags   = 0;
   sigaction(SIGALRM,&action,NULL);
 
+  // Before any input buffers are allocated, or threads started.
+  if (_conf._numa)
+    numa_place_init(_conf._numa,_conf._multi_event_threads);
+
+  if (_conf._huge_pages)
+    {
+      huge_pages_init(_conf._huge_pages);
+
+      // Already allocated, but khugepaged may collapse them.
+      huge_pages_advise(&_static_event,sizeof (_static_event));
+      huge_pages_advise(&_static_sticky_event,
+			sizeof (_static_sticky_event));
+    }
+
+  if (_conf._match_profile)
+    match_profile_init(_conf._match_profile);
+
+  if (_conf._trusted_data && _conf._account)
+    {
+      WARNING("--trusted-data ignored with --data-sizes.");
+      _conf._trusted_data = 0;
+    }
+
+  if (_conf._profile)
+    {
+      stage_profile_init(_conf._profile_json);
+
+      memset(&action,0,sizeof(action));
+      action.sa_handler = sigusr1_profile_handler;
+      sigemptyset(&action.sa_mask);
+      action.sa_flags   = 0;
+      sigaction(SIGUSR1,&action,NULL);
+    }
+
   // We don't want any SIGPIPE signals to kill us
 
   sigset_t sigmask;
@@ -1092,6 +1264,8 @@ int main(int argc, char **argv)
 
     uint64_t   last_show = 0;
     uint64_t   last_show_multi = 0;
+    uint64_t   last_show_faults = 0;
+    uint64_t   last_show_input = 0;
 
 #endif
 
@@ -1109,6 +1283,11 @@ int main(int argc, char **argv)
       return 1;
     }
 
+    // For --last-stage: the time of the event loop itself, without
+    // the start-up (reading mapping files etc).
+    timeval loop_start_time;
+
+    gettimeofday(&loop_start_time,NULL);
 
 
     // Fire up the worker threads
@@ -1166,6 +1345,11 @@ int main(int argc, char **argv)
 
 	loop._file_output_bad->set_file_header(NULL,msg);
       }
+    if (_conf._file_record._name)
+      {
+	loop._record = new lmd_replay_writer();
+	loop._record->open(_conf._file_record._name);
+      }
     for (config_output_vect::iterator output = _outputs.begin();
 	 output != _outputs.end() ; ++output)
 	{
@@ -1331,7 +1515,14 @@ get_next_event:
 		  source->release_events();
 #endif
 
-		if (!source->get_event())
+		STAGE_PROFILE_BEGIN(_stage_profile_main,t_get_event);
+
+		bool got_event = source->get_event();
+
+		STAGE_PROFILE_END(_stage_profile_main,STAGE_PROFILE_GET_EVENT,
+				  t_get_event);
+
+		if (!got_event)
 		  {
 #ifdef USE_MERGING
 		    // This file is over.
@@ -1356,6 +1547,8 @@ get_next_event:
 	      goto no_more_events;
 	    }
 
+	    UCESB_PROBE1(event_read,_status._events);
+
             // Determine event skipping right after we have an event.
             bool do_skip = false;
             if (skip_events_counter < _conf._skip_events)
@@ -1422,6 +1615,8 @@ get_next_event:
 #endif
 		{
 #if defined(USE_LMD_INPUT) || defined(USE_HLD_INPUT) || defined(USE_MVLC_INPUT) || defined(USE_RIDF_INPUT)
+		  STAGE_PROFILE_BEGIN(_stage_profile_main,t_pre_unpack);
+
 		  loop.pre1_unpack_event(file_event);
 #if defined(USE_LMD_INPUT)
 		  if (file_event->is_sticky())
@@ -1431,6 +1626,13 @@ get_next_event:
 #endif
 		    loop.pre2_unpack_event(*event,
 					   &loop._source_event_hint);
+
+		  STAGE_PROFILE_END(_stage_profile_main,
+				    STAGE_PROFILE_PRE_UNPACK,t_pre_unpack);
+#endif
+#if defined(USE_LMD_INPUT)
+		  if (loop._record)
+		    loop._record->write_event(file_event);
 #endif
 
 	      if (_conf._print)
@@ -1454,21 +1656,39 @@ get_next_event:
 		loop.stitch_event(*event,&stitch);
 #endif
 
-#if defined(USE_LMD_INPUT)
-	      if (file_event->is_sticky())
+	      if (_conf._last_stage != LAST_STAGE_READ)
 		{
-		  if (_conf._account)
-		    loop.unpack_event<sticky_event_base,1>(*sticky_event);
+		  UCESB_PROBE1(unpack_start,_status._events);
+
+		  STAGE_PROFILE_BEGIN(_stage_profile_main,t_unpack);
+#if defined(USE_LMD_INPUT)
+		  if (file_event->is_sticky())
+		    {
+		      if (_conf._account)
+			loop.unpack_event<sticky_event_base,1>(*sticky_event);
+		      else
+			loop.unpack_event<sticky_event_base,0>(*sticky_event);
+		    }
 		  else
-		    loop.unpack_event<sticky_event_base,0>(*sticky_event);
-		}
-	      else
 #endif
-		{
-		  if (_conf._account)
-		    loop.unpack_event<event_base,1>(*event);
-		  else
-		    loop.unpack_event<event_base,0>(*event);
+		    {
+		      // With --trusted-data, every Nth event still gets the
+		      // checks, to notice if the data is not as expected.
+		      if (_conf._account)
+			loop.unpack_event<event_base,1>(*event);
+		      else if (_conf._trusted_data &&
+			       (!_conf._trusted_check ||
+				_status._events % (uint64) _conf._trusted_check))
+			loop.unpack_event<event_base,
+					  DATA_SRC_TRUSTED>(*event);
+		      else
+			loop.unpack_event<event_base,0>(*event);
+		    }
+		  STAGE_PROFILE_END(_stage_profile_main,STAGE_PROFILE_UNPACK,
+				    t_unpack);
+
+		  UCESB_PROBE2(unpack_end,
+			       event->_unpack.event_no,event->_unpack.trigger);
 		}
 		}
 
@@ -1476,12 +1696,16 @@ get_next_event:
 
 	      bool write_ok = true;
 
+	      if (_conf._last_stage == LAST_STAGE_ALL ||
+		  _conf._last_stage > LAST_STAGE_UNPACK)
+		{
 #if defined(USE_LMD_INPUT)
-	      if (file_event->is_sticky())
-		write_ok = loop.handle_event(*sticky_event,&num_multi);
-	      else
+		  if (file_event->is_sticky())
+		    write_ok = loop.handle_event(*sticky_event,&num_multi);
+		  else
 #endif
-		write_ok = loop.handle_event(*event,&num_multi);
+		    write_ok = loop.handle_event(*event,&num_multi);
+		}
 
 	      _status._multi_events += (uint64_t) num_multi;
 
@@ -1662,6 +1886,11 @@ get_next_event:
 		}
 
 #if defined(USE_LMD_INPUT)
+	      stage_profile_thread *prof_output =
+		loop._output.empty() ? NULL : _stage_profile_main;
+
+	      STAGE_PROFILE_BEGIN(prof_output,t_output);
+
 	      try {
 	      if (check_new_file_header)
 		{
@@ -1778,6 +2007,8 @@ get_next_event:
 		goto no_more_files;
 	      }
 
+	      STAGE_PROFILE_END(prof_output,STAGE_PROFILE_OUTPUT,t_output);
+
 	      // printf ("%d %d\n", _conf._event_stitch_mode, stitch._combine);
 
 #if defined(USE_LMD_INPUT)
@@ -1809,8 +2040,8 @@ get_next_event:
 #endif
 #else
 	      UNUSED(file_event);
-	      UNUSED(unpack_event);
 #endif
+	      UCESB_PROBE2(event_retire,unpack_event->event_no,_status._events);
 	    }
 	    _status._events++;
 
@@ -1819,6 +2050,12 @@ get_next_event:
 		_status._events >= (uint64_t)_conf._max_events)
 	      goto no_more_files;
 
+	    if (UNLIKELY(_stage_profile_show_request))
+	      {
+		_stage_profile_show_request = 0;
+		stage_profile_show();
+	      }
+
 #ifndef USE_MERGING
 #ifdef USE_CURSES
 	    if (_conf._watcher._command)
@@ -1994,6 +2231,29 @@ get_next_event:
 				    spinner_current);
 			      }
 			    unsigned int nlines = 0;
+			    if (_huge_pages_stat)
+			      {
+				uint64_t faults = huge_pages_faults();
+				uint64_t input = input_bytes_released();
+
+				double faults_per_gb =
+				  input > last_show_input ?
+				  (double) (faults - last_show_faults) /
+				  ((double) (input - last_show_input) * 1.e-9) : 0;
+
+				fprintf (stderr,
+					 "\nPages: %s%.0f%s faults/GB "
+					 "(%" PRIu64 " faults, %.1f MB input)   \r",
+					 CT_ERR(BOLD),
+					 faults_per_gb,
+					 CT_ERR(NORM),
+					 faults,
+					 (double) input * 1.e-6);
+				nlines++;
+
+				last_show_faults = faults;
+				last_show_input  = input;
+			      }
 #if defined(USE_LMD_INPUT)
 			    for (unsigned int i = 0; i < loop._output.size(); i++)
 			      {
@@ -2076,6 +2336,27 @@ get_next_event:
 	 ERR_BLUE "%" PRIu64 ERR_ENDCOL "             ("
 	 ERR_RED "%" PRIu64 ERR_ENDCOL " errors)                \n",
 	 _status._events,_status._multi_events,_status._errors);
+    if (_conf._stage_timing)
+      {
+	timeval loop_end_time;
+
+	gettimeofday(&loop_end_time,NULL);
+
+	INFO("Event loop time: %.6f s",
+	     (double) (loop_end_time.tv_sec - loop_start_time.tv_sec) +
+	     1.e-6 * (double) (loop_end_time.tv_usec -
+			       loop_start_time.tv_usec));
+      }
+    if (_huge_pages_stat)
+      {
+	uint64_t faults = huge_pages_faults();
+	uint64_t input = input_bytes_released();
+
+	INFO("Page faults: %" PRIu64 " (%.0f/GB of %.1f MB input).",
+	     faults,
+	     input ? (double) faults / ((double) input * 1.e-9) : 0,
+	     (double) input * 1.e-6);
+      }
     try {
       loop.postprocess();
     } catch (error &e) {
@@ -0,0 +1,122 @@
+/* This file is part of UCESB - a tool for data unpacking and processing.
+ *
+ * Copyright (C) 2016  GSI Helmholtzzentrum fuer Schwerionenforschung GmbH
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+ * MA  02110-1301  USA
+ */
+
+#include "match_profile.hh"
+#include "location.hh"
+#include "error.hh"
+
+#include <stdio.h>
+#include <string.h>
+
+bool _match_profile_enabled = false;
+
+static const char         *_match_profile_file = NULL;
+static match_profile_item *_match_profile_items = NULL;
+
+void match_profile_init(const char *filename)
+{
+  _match_profile_enabled = true;
+  _match_profile_file = filename;
+}
+
+void match_profile_register(match_profile_item *item)
+{
+  // Kept sorted by location, such that the file is ordered, and
+  // instances of the same candidate in different template
+  // instantiations of the unpacker follow each other.
+
+  match_profile_item **pp = &_match_profile_items;
+
+  while (*pp &&
+	 ((*pp)->_loc < item->_loc ||
+	  ((*pp)->_loc == item->_loc &&
+	   strcmp((*pp)->_name,item->_name) <= 0)))
+    pp = &(*pp)->_next;
+
+  item->_next = *pp;
+  *pp = item;
+}
+
+void match_profile_write()
+{
+  if (!_match_profile_enabled)
+    return;
+
+  size_t len = strlen(_match_profile_file);
+  char *tmp_name = (char *) malloc (len + 5);
+
+  if (!tmp_name)
+    ERROR("Memory allocation failure!");
+
+  strcpy(tmp_name,_match_profile_file);
+  strcpy(tmp_name + len,".tmp");
+
+  FILE *fid = fopen(tmp_name,"w");
+
+  if (!fid)
+    {
+      perror("fopen");
+      WARNING("Failed to open match profile output %s.",tmp_name);
+      free(tmp_name);
+      return;
+    }
+
+  fprintf (fid,
+	   "# ucesb select match profile, version 1\n"
+	   "# location name count\n");
+
+  int candidates = 0;
+
+  for (match_profile_item *item = _match_profile_items;
+       item; item = item->_next)
+    {
+      uint64 count = item->_count;
+
+      // Add the instances of the same candidate.
+
+      while (item->_next &&
+	     item->_next->_loc == item->_loc &&
+	     strcmp(item->_next->_name,item->_name) == 0)
+	{
+	  item = item->_next;
+	  count += item->_count;
+	}
+
+      char loc[256];
+
+      ucesb_loc_format(loc,sizeof (loc),item->_loc);
+
+      fprintf (fid,"%s %s %llu\n",
+	       loc,item->_name,(unsigned long long) count);
+      candidates++;
+    }
+
+  if (fclose(fid) != 0 ||
+      rename(tmp_name,_match_profile_file) != 0)
+    {
+      perror("fclose/rename");
+      WARNING("Failed to write match profile %s.",_match_profile_file);
+    }
+  else
+    INFO("Wrote match profile (%d candidates) to %s.",
+	 candidates,_match_profile_file);
+
+  free(tmp_name);
+}
@@ -0,0 +1,69 @@
+/* This file is part of UCESB - a tool for data unpacking and processing.
+ *
+ * Copyright (C) 2016  GSI Helmholtzzentrum fuer Schwerionenforschung GmbH
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+ * MA  02110-1301  USA
+ */
+
+#ifndef __MATCH_PROFILE_HH__
+#define __MATCH_PROFILE_HH__
+
+#include "typedef.hh"
+#include "optimise.hh"
+
+#include <stdlib.h>
+
+// How often each candidate of select statements matched
+// (--match-profile=FILE).  The file is read by ucesbgen
+// (--match-profile=FILE, make UCESB_MATCH_PROFILE=FILE) to try the
+// most frequent candidates first.
+//
+// Candidates are identified by the location of their declaration in
+// the specification (and the name), not by internal numbers, such
+// that the profile stays valid when the unpacker is rebuilt.
+
+struct match_profile_item
+{
+  int         _loc;
+  const char *_name;
+
+  uint64      _count;
+
+  match_profile_item *_next;
+};
+
+extern bool _match_profile_enabled;
+
+void match_profile_init(const char *filename);
+
+void match_profile_register(match_profile_item *item);
+
+void match_profile_write();
+
+// One counter per candidate (and template instance of the unpacker),
+// registered when first used.
+
+#define MATCH_PROFILE_COUNT(loc,declname) do {				\
+    if (UNLIKELY(_match_profile_enabled)) {				\
+      static match_profile_item __match_profile_item =			\
+	{ loc, #declname, 0, NULL };					\
+      if (UNLIKELY(!__match_profile_item._count))			\
+	match_profile_register(&__match_profile_item);			\
+      __match_profile_item._count++;					\
+    }									\
+  } while (0)
+
+#endif//__MATCH_PROFILE_HH__
@@ -0,0 +1,328 @@
+/* This file is part of UCESB - a tool for data unpacking and processing.
+ *
+ * Copyright (C) 2016  GSI Helmholtzzentrum fuer Schwerionenforschung GmbH
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+ * MA  02110-1301  USA
+ */
+
+#include "multi_event_pool.hh"
+
+#include "stage_profile.hh"
+#include "set_thread_name.hh"
+#include "huge_pages.hh"
+#include "error.hh"
+
+#include <string.h>
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <assert.h>
+
+#ifdef USE_MULTI_EVENT_POOL
+
+struct multi_event_slot
+{
+  raw_event    _raw;
+  cal_event    _cal;
+#ifdef USER_STRUCT
+  USER_STRUCT  _user;
+#endif
+
+  dirty_clean  _dirty_raw;
+  dirty_clean  _dirty_cal;
+
+  bool         _done;
+  bool         _failed;
+};
+
+multi_event_pool *_multi_event_pool = NULL;
+
+multi_event_pool::multi_event_pool()
+{
+  _num_threads = 0;
+  _started = 0;
+  _threads = NULL;
+
+  _num_slots = 0;
+  _slots = NULL;
+
+  _eb = NULL;
+  _multievents = 0;
+  _next_run = 0;
+  _queued_to = 0;
+  _running = 0;
+  _quit = false;
+}
+
+multi_event_pool::~multi_event_pool()
+{
+  assert(!_started); // stop() must have been called
+}
+
+void multi_event_pool::init(int threads)
+{
+  _num_threads = threads;
+  // Twice as many slots as threads, such that the workers can go on
+  // while the main thread retires.
+  _num_slots = 2 * threads;
+
+  _threads = (pthread_t *) malloc (_num_threads * sizeof (_threads[0]));
+  _slots = (multi_event_slot **)
+    malloc (_num_slots * sizeof (_slots[0]));
+
+  if (!_threads || !_slots)
+    ERROR("Memory allocation failure!");
+
+  for (int i = 0; i < _num_slots; i++)
+    {
+      multi_event_slot *slot = new multi_event_slot;
+
+      // The slots are tracked whenever all writes are seen, also
+      // if _static_event is fully cleaned, such that only the dirty
+      // blocks need to be copied back.  (Raw/cal user functions
+      // that do not report their writes prevent this.)
+#if !(defined(RAW_EVENT_USER_FUNCTION) || \
+      defined(CAL_EVENT_USER_FUNCTION)) || \
+  defined(USER_FUNCTIONS_MARK_DIRTY)
+      slot->_dirty_raw._enabled = true;
+#endif
+#if !defined(CAL_EVENT_USER_FUNCTION) || defined(USER_FUNCTIONS_MARK_DIRTY)
+      slot->_dirty_cal._enabled = true;
+#endif
+
+      slot->_done = false;
+      slot->_failed = false;
+
+      huge_pages_advise(slot,sizeof (*slot));
+
+      _slots[i] = slot;
+    }
+
+  pthread_mutex_init(&_mutex,NULL);
+  pthread_cond_init(&_cond_work,NULL);
+  pthread_cond_init(&_cond_done,NULL);
+
+  // Before any worker starts.
+  _dirty_dest_per_thread = true;
+
+  for (_started = 0; _started < _num_threads; _started++)
+    {
+      if (pthread_create(&_threads[_started],NULL,
+			 multi_event_pool::worker_thread,this) != 0)
+	{
+	  perror("pthread_create()");
+	  exit(1);
+	}
+
+      set_thread_name(_threads[_started], "MULTIEV", 7);
+    }
+
+  INFO("Processing multi-events with %d threads.",_num_threads);
+}
+
+void multi_event_pool::stop()
+{
+  if (!_started)
+    return;
+
+  pthread_mutex_lock(&_mutex);
+  _quit = true;
+  pthread_cond_broadcast(&_cond_work);
+  pthread_mutex_unlock(&_mutex);
+
+  for (int i = 0; i < _started; i++)
+    if (pthread_join(_threads[i],NULL) != 0)
+      {
+	perror("pthread_join()");
+	exit(1);
+      }
+  _started = 0;
+
+  _dirty_dest_per_thread = false;
+
+  pthread_cond_destroy(&_cond_done);
+  pthread_cond_destroy(&_cond_work);
+  pthread_mutex_destroy(&_mutex);
+
+  for (int i = 0; i < _num_slots; i++)
+    delete _slots[i];
+  free(_slots);
+  free(_threads);
+  _slots = NULL;
+  _threads = NULL;
+}
+
+void *multi_event_pool::worker_thread(void *us)
+{
+  return ((multi_event_pool *) us)->worker();
+}
+
+void *multi_event_pool::worker()
+{
+  sigset_t sigmask;
+
+  sigemptyset(&sigmask);
+  sigaddset(&sigmask,SIGINT);
+
+  pthread_sigmask(SIG_BLOCK,&sigmask,NULL);
+
+  stage_profile_thread *prof = stage_profile_register("MULTIEV");
+
+  dirty_clean_dest dest_raw;
+  dirty_clean_dest dest_cal;
+
+  _dirty_dest_thread_raw = &dest_raw;
+  _dirty_dest_thread_cal = &dest_cal;
+
+  pthread_mutex_lock(&_mutex);
+
+  for ( ; ; )
+    {
+      while (!_quit && _next_run >= _queued_to)
+	pthread_cond_wait(&_cond_work,&_mutex);
+
+      if (_quit)
+	break;
+
+      int mev = _next_run++;
+      multi_event_slot *slot = _slots[mev % _num_slots];
+
+      _running++;
+
+      pthread_mutex_unlock(&_mutex);
+
+      bool failed = false;
+
+      // Mapping and calibration write into the slot.
+      dest_raw._reloc =
+	((char *) &slot->_raw) - ((char *) &_static_event._raw);
+      dest_raw._dirty = &slot->_dirty_raw;
+      dest_cal._reloc =
+	((char *) &slot->_cal) - ((char *) &_static_event._cal);
+      dest_cal._dirty = &slot->_dirty_cal;
+
+      try {
+	dirty_clean_struct(slot->_dirty_raw,slot->_raw);
+	dirty_clean_struct(slot->_dirty_cal,slot->_cal);
+#ifdef USER_STRUCT
+	slot->_user.__clean();
+#endif
+
+	multi_event_map_calib(*_eb,&slot->_raw,&slot->_cal
+#ifdef USER_STRUCT
+			      ,&slot->_user
+#endif
+			      ,mev,_multievents,prof);
+      } catch (error &e) {
+	// Already reported.
+	failed = true;
+      }
+
+      pthread_mutex_lock(&_mutex);
+
+      slot->_failed = failed;
+      slot->_done = true;
+      _running--;
+
+      pthread_cond_broadcast(&_cond_done);
+    }
+
+  pthread_mutex_unlock(&_mutex);
+
+  return NULL;
+}
+
+void multi_event_pool::begin(event_base *eb,int multievents)
+{
+  pthread_mutex_lock(&_mutex);
+
+  assert(!_running);
+
+  _eb = eb;
+  _multievents = multievents;
+
+  for (int i = 0; i < _num_slots; i++)
+    _slots[i]->_done = false;
+
+  _next_run = 0;
+  _queued_to = multievents < _num_slots ? multievents : _num_slots;
+
+  pthread_cond_broadcast(&_cond_work);
+  pthread_mutex_unlock(&_mutex);
+}
+
+void multi_event_pool::retire(int mev)
+{
+  multi_event_slot *slot = _slots[mev % _num_slots];
+
+  pthread_mutex_lock(&_mutex);
+  while (!slot->_done)
+    pthread_cond_wait(&_cond_done,&_mutex);
+  pthread_mutex_unlock(&_mutex);
+
+  if (slot->_failed)
+    {
+      drain();
+      throw error();
+    }
+
+  // _static_event has been cleaned (raw_cal_user_clean()), so only
+  // what was written in the slot needs to be copied.  The full copy
+  // is only needed when the user functions' writes are not seen.
+
+  if (slot->_dirty_raw._image)
+    slot->_dirty_raw.copy_dirty(&_eb->_raw,&_dirty_clean_raw);
+  else
+    memcpy(&_eb->_raw,&slot->_raw,sizeof (_eb->_raw));
+
+  if (slot->_dirty_cal._image)
+    slot->_dirty_cal.copy_dirty(&_eb->_cal,&_dirty_clean_cal);
+  else
+    memcpy(&_eb->_cal,&slot->_cal,sizeof (_eb->_cal));
+
+#if defined(USER_STRUCT) && defined(CAL_EVENT_USER_FUNCTION)
+  // Only the cal user function writes the user structure.
+  memcpy(&_eb->_user,&slot->_user,sizeof (_eb->_user));
+#endif
+
+  pthread_mutex_lock(&_mutex);
+
+  slot->_done = false;
+
+  // The slot is free for the next multi-event.
+  if (mev + _num_slots < _multievents &&
+      _queued_to == mev + _num_slots)
+    {
+      _queued_to++;
+      pthread_cond_broadcast(&_cond_work);
+    }
+
+  pthread_mutex_unlock(&_mutex);
+}
+
+void multi_event_pool::drain()
+{
+  pthread_mutex_lock(&_mutex);
+
+  _queued_to = _next_run;
+
+  while (_running)
+    pthread_cond_wait(&_cond_done,&_mutex);
+
+  pthread_mutex_unlock(&_mutex);
+}
+
+#endif//USE_MULTI_EVENT_POOL
@@ -0,0 +1,114 @@
+/* This file is part of UCESB - a tool for data unpacking and processing.
+ *
+ * Copyright (C) 2016  GSI Helmholtzzentrum fuer Schwerionenforschung GmbH
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+ * MA  02110-1301  USA
+ */
+
+#ifndef __MULTI_EVENT_POOL_HH__
+#define __MULTI_EVENT_POOL_HH__
+
+#include "event_base.hh"
+#include "multi_info.hh"
+#include "dirty_clean.hh"
+
+// Mapping, calibration and the raw/cal user functions of the
+// multi-events within one file event, by several worker threads
+// (--multi-event-threads=N).
+//
+// Each task (multi-event) works on its own raw/cal/user structures
+// (a slot).  The mapping and calibration, which are set up with
+// destinations within _static_event, write to the slot by the
+// relocation of the per-thread destination (dirty_dest_raw/cal()),
+// and mark what they write in the trackers of the slot.  The tasks
+// are retired in order by the main thread, which copies the (dirty
+// parts of the) slot into _static_event, and then does the dumps,
+// watcher, correlation and ntuple output, just as for sequential
+// processing.
+//
+// The raw and cal user functions get the structures of the slot.
+// They must not use global state (MULTI_EVENT_USER_FUNCTIONS_REENTRANT).
+//
+// USE_MULTI_EVENT_POOL is decided in dirty_clean.hh.
+
+#ifdef USE_MULTI_EVENT_POOL
+
+#include <pthread.h>
+
+struct stage_profile_thread;
+struct multi_event_slot;
+
+class multi_event_pool
+{
+public:
+  multi_event_pool();
+  ~multi_event_pool();
+
+public:
+  void init(int threads);
+  void stop();
+
+public:
+  // Queue the multi-events of the current (unpacked) event.
+  void begin(event_base *eb,int multievents);
+  // Wait for multi-event mev, and copy its structures into *eb.
+  // Multi-events must be retired in order.  If the task failed,
+  // all outstanding tasks are waited for, and the error thrown.
+  void retire(int mev);
+  // Wait for all started tasks, and queue no more (on errors).
+  void drain();
+
+protected:
+  static void *worker_thread(void *us);
+  void *worker();
+
+protected:
+  int                _num_threads;
+  int                _started;
+  pthread_t         *_threads;
+
+  int                _num_slots;
+  multi_event_slot **_slots;
+
+  pthread_mutex_t    _mutex;
+  pthread_cond_t     _cond_work;
+  pthread_cond_t     _cond_done;
+
+  event_base        *_eb;
+  int                _multievents;
+  int                _next_run;   // next multi-event to be picked up
+  int                _queued_to;  // multi-events before are queued
+  int                _running;
+  bool               _quit;
+};
+
+extern multi_event_pool *_multi_event_pool;
+
+// In event_loop.cc, the work of one task.
+void multi_event_map_calib(event_base &eb,
+			   raw_event *raw,cal_event *cal
+#ifdef USER_STRUCT
+			   ,USER_STRUCT *user
+#endif
+			   ,int mev,int multievents,
+			   stage_profile_thread *prof);
+
+void set_multi_map_info(map_members_info &map_info,
+			int mev,int multievents);
+
+#endif//USE_MULTI_EVENT_POOL
+
+#endif//__MULTI_EVENT_POOL_HH__
@@ -427,6 +427,7 @@ void paw_ntuple_usage()
   printf ("excl=               Subevent exclusion.\n");
 #endif
   printf ("BITPACK             Bitpack STRUCT data even if not using network server.\n");
+  printf ("blockpack           Bitpack STRUCT data in block format (newer clients).\n");
   printf ("noshm               Do not use shared memory communication.\n");
   printf ("dumpraw             Dump raw protocol data.\n");
   printf ("gdb                 Run the external program via gdb (backtrace fault).\n");
@@ -619,6 +620,8 @@ paw_ntuple *paw_ntuple_open_stage(const char *command,bool reading)
 #endif
       else if (MATCH_ARG("BITPACK"))
 	ntuple_opt |= NTUPLE_OPT_WRITER_BITPACK;
+      else if (MATCH_ARG("blockpack"))
+	ntuple_opt |= NTUPLE_OPT_WRITER_BLOCKPACK;
       else if (MATCH_ARG("NOSHM"))
 	{
 	  WARNING("Option --ntuple=NOSHM is deprecated, "
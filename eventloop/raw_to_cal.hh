@@ -22,6 +22,7 @@
 #define __RAW_TO_CAL_HH__
 
 #include "util.hh"
+#include "dirty_clean.hh"
 
 #include <stdlib.h>
 
@@ -281,7 +282,9 @@ void call_r2c_convert(void *r2c_ptr,const void *src_ptr)
   if (!success) // no result to store
     return;
 
-  void *dest = r2c->_dest;
+  dirty_clean_dest &dd = dirty_dest_cal();
+
+  void *dest = dirty_dest_reloc(dd,r2c->_dest);
   const zero_suppress_info *zzp_info = r2c->_zzp_info;
 
   switch (zzp_info->_type)
@@ -301,31 +304,31 @@ void call_r2c_convert(void *r2c_ptr,const void *src_ptr)
 	break;
       }
     case ZZP_INFO_CALL_ARRAY_INDEX:
-      (*zzp_info->_array._call)(zzp_info->_array._item,
+      (*zzp_info->_array._call)(dirty_dest_reloc(dd,zzp_info->_array._item),
 				zzp_info->_array._index);
       break;
     case ZZP_INFO_CALL_ARRAY_MULTI_INDEX:
       {
-	size_t offset = (*zzp_info->_array._call_multi)(zzp_info->_array._item,
+	size_t offset = (*zzp_info->_array._call_multi)(dirty_dest_reloc(dd,zzp_info->_array._item),
 							zzp_info->_array._index);
 	dest = (((char *) dest) + offset);
 	break;
       }
     case ZZP_INFO_CALL_LIST_INDEX:
       {
-	size_t offset = (*zzp_info->_list._call)(zzp_info->_list._item,
+	size_t offset = (*zzp_info->_list._call)(dirty_dest_reloc(dd,zzp_info->_list._item),
 						 zzp_info->_list._index);
 	dest = (((char *) dest) + offset);
 	// printf ("%d - %d\n",zzp_info->_array._index,offset);
 	break;
       }
     case ZZP_INFO_CALL_ARRAY_LIST_II_INDEX:
-      (*zzp_info->_array._call)(zzp_info->_array._item,
+      (*zzp_info->_array._call)(dirty_dest_reloc(dd,zzp_info->_array._item),
 				zzp_info->_array._index);
       goto call_list_ii_index;
     case ZZP_INFO_CALL_LIST_LIST_II_INDEX:
       {
-	size_t offset = (*zzp_info->_list._call)(zzp_info->_list._item,
+	size_t offset = (*zzp_info->_list._call)(dirty_dest_reloc(dd,zzp_info->_list._item),
 						 zzp_info->_list._index);
 	dest = (((char *) dest) + offset);
 	goto call_list_ii_index;
@@ -333,7 +336,7 @@ void call_r2c_convert(void *r2c_ptr,const void *src_ptr)
     case ZZP_INFO_CALL_LIST_II_INDEX:
     call_list_ii_index:
       {
-	size_t offset = (*zzp_info->_list_ii._call_ii)(zzp_info->_list_ii._item);
+	size_t offset = (*zzp_info->_list_ii._call_ii)(dirty_dest_reloc(dd,zzp_info->_list_ii._item));
 	dest = (((char *) dest) + offset);
 	// printf ("%d - %d\n",zzp_info->_array._index,offset);
 	break;
@@ -342,7 +345,9 @@ void call_r2c_convert(void *r2c_ptr,const void *src_ptr)
       ERROR("Internal error in calib data mapping! (type=%d)",zzp_info->_type);
       break;
     }
+  dd._dirty->mark_zzp(zzp_info,dd._reloc);
   *((T_dest *) dest) = value;
+  dd._dirty->mark(dest,sizeof (T_dest));
 }
 
 template<typename T_r2c,typename T_src,typename T_dest>
@@ -284,6 +284,12 @@ sid_leaf *find_leaf(const signal_id &id,
 
 sid_node *signal_id_map_base[SID_MAP_MAX_NUM];
 
+// The maps are only built when first looked up.  Most runs only use a
+// few of them (e.g. no calibration file), and walking all members of
+// large generated structures takes noticeable time at startup.
+
+bool _signal_id_map_built[SID_MAP_MAX_NUM];
+
 void enumerate_member_signal_id(const signal_id &id,
 				const enumerate_info &info,
 				void *extra)
@@ -339,6 +345,9 @@ signal_id_info *find_signal_id_info(const signal_id &id,
 const signal_id_info *get_signal_id_info(const signal_id &id,
 					 int map_no)
 {
+  if (!_signal_id_map_built[map_no])
+    build_signal_id_map(map_no);
+
   sid_leaf *leaf;
 
   leaf = find_leaf<0>(id,&signal_id_map_base[map_no]);
@@ -402,6 +411,9 @@ void enumerate_member_signal_id_zzp_part(const signal_id &id,
 const signal_id_zzp_info *get_signal_id_zzp_info(const signal_id &id,
 						 int map_no)
 {
+  if (!_signal_id_map_built[map_no])
+    build_signal_id_map(map_no);
+
   signal_id_zzp_info_map *map = &_signal_id_zzp_info_map[map_no];
 
   signal_id_zzp_info_map::iterator iter = map->find(id);
@@ -412,87 +424,88 @@ const signal_id_zzp_info *get_signal_id_zzp_info(const signal_id &id,
   return &(iter->second);
 }
 
-void setup_signal_id_map()
+template<typename T>
+void setup_signal_id_map_members(T &level,enumerate_msid_info *extra,
+				 bool zzp_part)
 {
-  // used_zero_suppress_info used_info(new zero_suppress_info);
+  enumerate_info info;
 
-  for (int i = 0; i < SID_MAP_MAX_NUM; i++)
-    signal_id_map_base[i] = NULL;
+  level.enumerate_members(signal_id(),info,
+			  enumerate_member_signal_id,extra);
 
-  enumerate_info info;
-  enumerate_info info_zzp_part;
+  if (zzp_part)
+    {
+      enumerate_info info_zzp_part;
+
+      info_zzp_part._only_index0 = true;
+
+      level.enumerate_members(signal_id(),info_zzp_part,
+			      enumerate_member_signal_id_zzp_part,extra);
+    }
+}
 
-  info_zzp_part._only_index0 = true;
+void build_signal_id_map(int map_no)
+{
+  _signal_id_map_built[map_no] = true;
 
   enumerate_msid_info extra;
 
   memset(&extra,0,sizeof(extra));
 
-  extra._map_no = SID_MAP_UNPACK;
-  _static_event._unpack.enumerate_members(signal_id(),info,
-					  enumerate_member_signal_id,&extra);
-  _static_event._unpack.enumerate_members(signal_id(),info_zzp_part,
-					  enumerate_member_signal_id_zzp_part,
-					  &extra);
-
-  extra._map_no = SID_MAP_UNPACK | SID_MAP_STICKY;
-  _static_sticky_event._unpack.enumerate_members(signal_id(),info,
-					  enumerate_member_signal_id,&extra);
-  _static_sticky_event._unpack.enumerate_members(signal_id(),info_zzp_part,
-					  enumerate_member_signal_id_zzp_part,
-					  &extra);
+  extra._map_no = map_no;
 
+  switch (map_no)
+    {
+    case SID_MAP_UNPACK:
+      setup_signal_id_map_members(_static_event._unpack,&extra,true);
+      break;
+    case SID_MAP_UNPACK | SID_MAP_STICKY:
+      setup_signal_id_map_members(_static_sticky_event._unpack,&extra,true);
+      break;
 #ifndef USE_MERGING
-  extra._map_no = SID_MAP_RAW;
-  _static_event._raw.enumerate_members(signal_id(),info,
-				       enumerate_member_signal_id,&extra);
-  _static_event._raw.enumerate_members(signal_id(),info_zzp_part,
-				       enumerate_member_signal_id_zzp_part,
-				       &extra);
-
-  extra._map_no = SID_MAP_RAW | SID_MAP_STICKY;
-  _static_sticky_event._raw.enumerate_members(signal_id(),info,
-				       enumerate_member_signal_id,&extra);
-  _static_sticky_event._raw.enumerate_members(signal_id(),info_zzp_part,
-				       enumerate_member_signal_id_zzp_part,
-				       &extra);
-
-  extra._map_no = SID_MAP_CAL;
-  _static_event._cal.enumerate_members(signal_id(),info,
-				       enumerate_member_signal_id,&extra);
-  _static_event._cal.enumerate_members(signal_id(),info_zzp_part,
-				       enumerate_member_signal_id_zzp_part,
-				       &extra);
-
+    case SID_MAP_RAW:
+      setup_signal_id_map_members(_static_event._raw,&extra,true);
+      break;
+    case SID_MAP_RAW | SID_MAP_STICKY:
+      setup_signal_id_map_members(_static_sticky_event._raw,&extra,true);
+      break;
+    case SID_MAP_CAL:
+      setup_signal_id_map_members(_static_event._cal,&extra,true);
+      break;
 #ifdef USER_STRUCT
-  extra._map_no = SID_MAP_USER;
-  _static_event._user.enumerate_members(signal_id(),info,
-					enumerate_member_signal_id,&extra);
-  _static_event._user.enumerate_members(signal_id(),info_zzp_part,
-					enumerate_member_signal_id_zzp_part,
-					&extra);
+    case SID_MAP_USER:
+      setup_signal_id_map_members(_static_event._user,&extra,true);
+      break;
 #endif
-
 #ifdef CALIB_STRUCT
-  extra._map_no = SID_MAP_CALIB;
-  _calib.enumerate_members(signal_id(),info,
-			   enumerate_member_signal_id,&extra);
+    case SID_MAP_CALIB:
+      setup_signal_id_map_members(_calib,&extra,false);
+      break;
 #endif
-
-  extra._map_no = SID_MAP_UNPACK | SID_MAP_MIRROR_MAP;
-  setup_signal_id_map_unpack_map(&extra);
-
-  extra._map_no = SID_MAP_UNPACK | SID_MAP_STICKY | SID_MAP_MIRROR_MAP;
-  setup_signal_id_map_unpack_sticky_map(&extra);
-
-  extra._map_no = SID_MAP_RAW | SID_MAP_MIRROR_MAP;
-  setup_signal_id_map_raw_map(&extra);
-
-  extra._map_no = SID_MAP_RAW | SID_MAP_MIRROR_MAP | SID_MAP_REVERSE;
-  setup_signal_id_map_raw_reverse_map(&extra);
-
-  extra._map_no =
-    SID_MAP_RAW | SID_MAP_STICKY | SID_MAP_MIRROR_MAP | SID_MAP_REVERSE;
-  setup_signal_id_map_raw_sticky_reverse_map(&extra);
+    case SID_MAP_UNPACK | SID_MAP_MIRROR_MAP:
+      setup_signal_id_map_unpack_map(&extra);
+      break;
+    case SID_MAP_UNPACK | SID_MAP_STICKY | SID_MAP_MIRROR_MAP:
+      setup_signal_id_map_unpack_sticky_map(&extra);
+      break;
+    case SID_MAP_RAW | SID_MAP_MIRROR_MAP:
+      setup_signal_id_map_raw_map(&extra);
+      break;
+    case SID_MAP_RAW | SID_MAP_MIRROR_MAP | SID_MAP_REVERSE:
+      setup_signal_id_map_raw_reverse_map(&extra);
+      break;
+    case SID_MAP_RAW | SID_MAP_STICKY | SID_MAP_MIRROR_MAP | SID_MAP_REVERSE:
+      setup_signal_id_map_raw_sticky_reverse_map(&extra);
+      break;
 #endif//!USE_MERGING
+    }
+}
+
+void setup_signal_id_map()
+{
+  for (int i = 0; i < SID_MAP_MAX_NUM; i++)
+    {
+      signal_id_map_base[i] = NULL;
+      _signal_id_map_built[i] = false;
+    }
 }
@@ -77,6 +77,7 @@ const signal_id_zzp_info *get_signal_id_zzp_info(const signal_id &id,
 						 int map_no);
 
 void setup_signal_id_map();
+void build_signal_id_map(int map_no);
 
 void setup_signal_id_map_unpack_map(void *extra);
 void setup_signal_id_map_raw_map(void *extra);
@@ -0,0 +1,334 @@
+/* This file is part of UCESB - a tool for data unpacking and processing.
+ *
+ * Copyright (C) 2016  GSI Helmholtzzentrum fuer Schwerionenforschung GmbH
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+ * MA  02110-1301  USA
+ */
+
+#include "stage_profile.hh"
+#include "location.hh"
+#include "colourtext.hh"
+#include "error.hh"
+
+#include <string.h>
+#define __STDC_FORMAT_MACROS
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <sys/time.h>
+
+#ifdef USE_PTHREAD
+#include <pthread.h>
+#endif
+
+static const char *_stage_profile_names[STAGE_PROFILE_NUM] =
+{
+  "get_event",
+  "pre_unpack",
+  "unpack",
+  "unpack_user",
+  "map_raw",
+  "raw_user",
+  "calib",
+  "cal_user",
+  "ntuple",
+  "output",
+  "write",
+  "compress",
+};
+
+stage_profile_thread *_stage_profile_main = NULL;
+
+volatile int _stage_profile_show_request = 0;
+
+static bool                  _stage_profile_enabled = false;
+static const char           *_stage_profile_json = NULL;
+static stage_profile_thread *_stage_profile_threads = NULL;
+
+// For conversion of cycles to seconds.
+static uint64_t _stage_profile_start_cycles;
+static double   _stage_profile_start_time;
+
+#ifdef USE_PTHREAD
+static pthread_mutex_t _stage_profile_mutex = PTHREAD_MUTEX_INITIALIZER;
+#endif
+
+static double stage_profile_time()
+{
+  timeval now;
+
+  gettimeofday(&now,NULL);
+
+  return (double) now.tv_sec + 1.e-6 * (double) now.tv_usec;
+}
+
+void stage_profile_init(const char *json_file)
+{
+  _stage_profile_enabled = true;
+  _stage_profile_json = json_file;
+
+  _stage_profile_start_cycles = stage_profile_cycles();
+  _stage_profile_start_time   = stage_profile_time();
+
+  _stage_profile_main = stage_profile_register("MAIN");
+}
+
+stage_profile_thread *stage_profile_register(const char *name)
+{
+  if (!_stage_profile_enabled)
+    return NULL;
+
+  stage_profile_thread *prof =
+    (stage_profile_thread *) malloc (sizeof (stage_profile_thread));
+
+  if (!prof)
+    ERROR("Memory allocation failure!");
+
+  memset(prof,0,sizeof (*prof));
+
+  prof->_name = name;
+
+  // Counters are kept until the end, also after the thread is gone.
+
+#ifdef USE_PTHREAD
+  pthread_mutex_lock(&_stage_profile_mutex);
+#endif
+  stage_profile_thread **pp = &_stage_profile_threads;
+  while (*pp)
+    pp = &(*pp)->_next;
+  *pp = prof;
+#ifdef USE_PTHREAD
+  pthread_mutex_unlock(&_stage_profile_mutex);
+#endif
+
+  return prof;
+}
+
+void stage_profile_account_subevent(stage_profile_thread *prof,
+				    int loc,uint64_t cycles)
+{
+  stage_profile_subevent *subev = &prof->_subevent[prof->_last_subevent];
+
+  if (subev->_loc != loc)
+    {
+      int i;
+
+      for (i = 0; i < prof->_num_subevent; i++)
+	if (prof->_subevent[i]._loc == loc)
+	  break;
+
+      if (i == prof->_num_subevent)
+	{
+	  if (prof->_num_subevent >= STAGE_PROFILE_MAX_SUBEVENT)
+	    return; // The stage total still has it.
+	  prof->_subevent[i]._loc = loc;
+	  prof->_num_subevent++;
+	}
+      prof->_last_subevent = i;
+      subev = &prof->_subevent[i];
+    }
+
+  subev->_count._calls++;
+  subev->_count._cycles += cycles;
+}
+
+static void stage_profile_show_line(const char *name,
+				    const stage_profile_count *count,
+				    uint64_t thread_cycles,
+				    double cycles_per_s)
+{
+  printf ("  %-22s %12" PRIu64 " %11.0f %10.3f %10.3f %6.1f%%\n",
+	  name,
+	  count->_calls,
+	  (double) count->_cycles / (double) count->_calls,
+	  1.e6 * (double) count->_cycles / (double) count->_calls /
+	  cycles_per_s,
+	  (double) count->_cycles / cycles_per_s,
+	  100. * (double) count->_cycles / (double) thread_cycles);
+}
+
+static void stage_profile_json_count(FILE *fid,const char *name,
+				     const stage_profile_count *count,
+				     double cycles_per_s,bool last)
+{
+  fprintf (fid,
+	   "\"%s\": { \"calls\": %" PRIu64 ", \"cycles\": %" PRIu64 ", "
+	   "\"seconds\": %.6f }%s\n",
+	   name, count->_calls, count->_cycles,
+	   (double) count->_cycles / cycles_per_s,
+	   last ? "" : ",");
+}
+
+static void stage_profile_write_json(double cycles_per_s,double elapsed)
+{
+  size_t len = strlen(_stage_profile_json);
+  char *tmp_name = (char *) malloc (len + 5);
+
+  if (!tmp_name)
+    ERROR("Memory allocation failure!");
+
+  strcpy(tmp_name,_stage_profile_json);
+  strcpy(tmp_name + len,".tmp");
+
+  FILE *fid = fopen(tmp_name,"w");
+
+  if (!fid)
+    {
+      perror("fopen");
+      WARNING("Failed to open profile output %s.",tmp_name);
+      free(tmp_name);
+      return;
+    }
+
+  fprintf (fid,"{\n");
+  fprintf (fid,"  \"cycles_per_second\": %.0f,\n",cycles_per_s);
+  fprintf (fid,"  \"elapsed_seconds\": %.3f,\n",elapsed);
+  fprintf (fid,"  \"threads\": [\n");
+
+  for (stage_profile_thread *prof = _stage_profile_threads;
+       prof; prof = prof->_next)
+    {
+      fprintf (fid,"    {\n");
+      fprintf (fid,"      \"name\": \"%s\",\n",prof->_name);
+      fprintf (fid,"      \"stages\": {\n");
+
+      int last_stage = -1;
+
+      for (int i = 0; i < STAGE_PROFILE_NUM; i++)
+	if (prof->_stage[i]._calls)
+	  last_stage = i;
+
+      for (int i = 0; i < STAGE_PROFILE_NUM; i++)
+	if (prof->_stage[i]._calls)
+	  {
+	    fprintf (fid,"        ");
+	    stage_profile_json_count(fid,_stage_profile_names[i],
+				     &prof->_stage[i],cycles_per_s,
+				     i == last_stage);
+	  }
+
+      fprintf (fid,"      },\n");
+      fprintf (fid,"      \"subevents\": {\n");
+
+      for (int i = 0; i < prof->_num_subevent; i++)
+	{
+	  char loc[256];
+
+	  ucesb_loc_format(loc,sizeof (loc),prof->_subevent[i]._loc);
+
+	  fprintf (fid,"        ");
+	  stage_profile_json_count(fid,loc,
+				   &prof->_subevent[i]._count,cycles_per_s,
+				   i == prof->_num_subevent - 1);
+	}
+
+      fprintf (fid,"      }\n");
+      fprintf (fid,"    }%s\n",prof->_next ? "," : "");
+    }
+
+  fprintf (fid,"  ]\n");
+  fprintf (fid,"}\n");
+
+  if (fclose(fid) != 0 ||
+      rename(tmp_name,_stage_profile_json) != 0)
+    {
+      perror("fclose/rename");
+      WARNING("Failed to write profile output %s.",_stage_profile_json);
+    }
+
+  free(tmp_name);
+}
+
+void stage_profile_show()
+{
+  if (!_stage_profile_enabled)
+    return;
+
+  double elapsed = stage_profile_time() - _stage_profile_start_time;
+  uint64_t cycles = stage_profile_cycles() - _stage_profile_start_cycles;
+
+  double cycles_per_s = elapsed > 0 ? (double) cycles / elapsed : 1.e9;
+
+  printf ("\nStage profile after %.1f s (%.0f MHz counter):\n",
+	  elapsed,cycles_per_s * 1.e-6);
+
+  // The counters of other threads are read without locking.  They
+  // only ever increase, so a report while running is off by at most
+  // the current item.  The lock only protects the list of threads.
+
+#ifdef USE_PTHREAD
+  pthread_mutex_lock(&_stage_profile_mutex);
+#endif
+
+  for (stage_profile_thread *prof = _stage_profile_threads;
+       prof; prof = prof->_next)
+    {
+      uint64_t thread_cycles = 0;
+
+      for (int i = 0; i < STAGE_PROFILE_NUM; i++)
+	thread_cycles += prof->_stage[i]._cycles;
+
+      if (!thread_cycles)
+	continue;
+
+      printf ("\n%s%s%s:\n",CT_OUT(BOLD),prof->_name,CT_OUT(NORM));
+      printf ("  %s%-22s%s %s%12s%s %s%11s%s %s%10s%s %s%10s%s %s%7s%s\n",
+	      CT_OUT(UL),"stage",CT_OUT(NORM),
+	      CT_OUT(UL),"calls",CT_OUT(NORM),
+	      CT_OUT(UL),"cycles/call",CT_OUT(NORM),
+	      CT_OUT(UL),"us/call",CT_OUT(NORM),
+	      CT_OUT(UL),"total s",CT_OUT(NORM),
+	      CT_OUT(UL),"frac",CT_OUT(NORM));
+
+      for (int i = 0; i < STAGE_PROFILE_NUM; i++)
+	{
+	  if (!prof->_stage[i]._calls)
+	    continue;
+
+	  stage_profile_show_line(_stage_profile_names[i],
+				  &prof->_stage[i],
+				  thread_cycles,cycles_per_s);
+
+	  if (i != STAGE_PROFILE_UNPACK)
+	    continue;
+
+	  // Subevents are part of the unpack stage.
+
+	  for (int j = 0; j < prof->_num_subevent; j++)
+	    {
+	      char loc[256];
+
+	      loc[0] = ' ';
+	      loc[1] = ' ';
+	      ucesb_loc_format(loc + 2,sizeof (loc) - 2,
+			       prof->_subevent[j]._loc);
+
+	      stage_profile_show_line(loc,
+				      &prof->_subevent[j]._count,
+				      thread_cycles,cycles_per_s);
+	    }
+	}
+    }
+
+  fflush(stdout);
+
+  if (_stage_profile_json)
+    stage_profile_write_json(cycles_per_s,elapsed);
+
+#ifdef USE_PTHREAD
+  pthread_mutex_unlock(&_stage_profile_mutex);
+#endif
+}
@@ -0,0 +1,118 @@
+/* This file is part of UCESB - a tool for data unpacking and processing.
+ *
+ * Copyright (C) 2016  GSI Helmholtzzentrum fuer Schwerionenforschung GmbH
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+ * MA  02110-1301  USA
+ */
+
+#ifndef __STAGE_PROFILE_HH__
+#define __STAGE_PROFILE_HH__
+
+#include "optimise.hh"
+
+#include <stdint.h>
+#include <time.h>
+
+// Time spent in the processing stages (--profile).
+//
+// Each thread that does work has its own counters, such that no
+// locking is needed when accounting.  When profiling is not enabled,
+// the thread has no counters (NULL), and the cost is one branch.
+
+#define STAGE_PROFILE_GET_EVENT     0
+#define STAGE_PROFILE_PRE_UNPACK    1
+#define STAGE_PROFILE_UNPACK        2
+#define STAGE_PROFILE_UNPACK_USER   3
+#define STAGE_PROFILE_MAP_RAW       4
+#define STAGE_PROFILE_RAW_USER      5
+#define STAGE_PROFILE_CALIB         6
+#define STAGE_PROFILE_CAL_USER      7
+#define STAGE_PROFILE_NTUPLE        8
+#define STAGE_PROFILE_OUTPUT        9
+#define STAGE_PROFILE_WRITE        10
+#define STAGE_PROFILE_COMPRESS     11
+#define STAGE_PROFILE_NUM          12
+
+// Distinct subevent declarations kept per thread.
+#define STAGE_PROFILE_MAX_SUBEVENT 64
+
+struct stage_profile_count
+{
+  uint64_t _calls;
+  uint64_t _cycles;
+};
+
+struct stage_profile_subevent
+{
+  int                 _loc; // of the declaration in the specification
+  stage_profile_count _count;
+};
+
+struct stage_profile_thread
+{
+  const char *_name;
+
+  stage_profile_count    _stage[STAGE_PROFILE_NUM];
+
+  stage_profile_subevent _subevent[STAGE_PROFILE_MAX_SUBEVENT];
+  int                    _num_subevent;
+  int                    _last_subevent;
+
+  stage_profile_thread  *_next;
+};
+
+inline uint64_t stage_profile_cycles()
+{
+#if defined(__x86_64__) || defined(__i386__)
+  uint32_t lo, hi;
+
+  __asm__ __volatile__ ("rdtsc" : "=a" (lo), "=d" (hi));
+
+  return (((uint64_t) hi) << 32) | lo;
+#else
+  struct timespec ts;
+
+  clock_gettime(CLOCK_MONOTONIC,&ts);
+
+  return ((uint64_t) ts.tv_sec) * 1000000000 + (uint64_t) ts.tv_nsec;
+#endif
+}
+
+#define STAGE_PROFILE_BEGIN(prof,start)				\
+  uint64_t start = UNLIKELY((prof) != NULL) ? stage_profile_cycles() : 0
+
+#define STAGE_PROFILE_END(prof,stage,start) do {			\
+    if (UNLIKELY((prof) != NULL)) {					\
+      (prof)->_stage[stage]._calls++;					\
+      (prof)->_stage[stage]._cycles += stage_profile_cycles() - (start); \
+    }									\
+  } while (0)
+
+void stage_profile_init(const char *json_file);
+
+// Returns NULL unless profiling is enabled.
+stage_profile_thread *stage_profile_register(const char *name);
+
+void stage_profile_account_subevent(stage_profile_thread *prof,
+				    int loc,uint64_t cycles);
+
+void stage_profile_show();
+
+extern stage_profile_thread *_stage_profile_main;
+
+extern volatile int _stage_profile_show_request; // SIGUSR1
+
+#endif//__STAGE_PROFILE_HH__
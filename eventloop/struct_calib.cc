@@ -30,6 +30,8 @@
 
 #include "mc_def.hh"
 
+#include "calib_valid.hh"
+
 raw_event_calib_map the_raw_event_calib_map;
 
 template<typename T,int n_toggle>
@@ -622,7 +624,7 @@ raw_to_tcal_base *new_raw_to_tcal(const calib_param *param)
 
 template<typename T, int n_toggle>
 bool set_raw_to_tcal(void *info,
-		     void *dummy,
+		     void *void_slots,
 		     int toggle_i)
 {
   // We know the source type (via T)
@@ -656,8 +658,12 @@ bool set_raw_to_tcal(void *info,
   else if (toggle_i == 2)
     use0 = use1;
 
-  if (src->_calib[use0] ||
-      src->_calib[use1])
+  calib_valid_slots *slots = (calib_valid_slots *) void_slots;
+
+  // Parameters with a validity interval may override the default.
+  if (!slots &&
+      (src->_calib[use0] ||
+       src->_calib[use1]))
     return false;   // one could try to merge!!!
 
   // info->_src   _addr  _type
@@ -705,6 +711,15 @@ bool set_raw_to_tcal(void *info,
       return false;
     }
 
+  if (slots)
+    {
+      // Installed (and removed) by calib_valid_select().
+      slots->_slot[0] = &src->_calib[use0];
+      slots->_slot[1] = &src->_calib[use1];
+      slots->_r2c = r2c;
+      return true;
+    }
+
   src->_calib[use0] = r2c;
   src->_calib[use1] = r2c;
 
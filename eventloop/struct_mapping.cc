@@ -25,6 +25,7 @@
 #include "event_base.hh"
 
 #include "signal_id_map.hh"
+#include "dirty_clean.hh"
 
 #include <stddef.h>
 
@@ -160,7 +161,9 @@ void map_members(const data_map<T> &map,const T &src MAP_MEMBERS_PARAM)
   
   if (map._dest)
     {
-      T *dest = map._dest;
+      dirty_clean_dest &dd = dirty_dest_raw();
+
+      T *dest = dirty_dest_reloc(dd,map._dest);
 
       //WARNING("%d",map._zzp_info._type);
       switch (map._zzp_info->_type)
@@ -169,13 +172,13 @@ void map_members(const data_map<T> &map,const T &src MAP_MEMBERS_PARAM)
 	  // case ZZP_INFO_FIXED_LIST: // part of fixed list
 	  break;
 	case ZZP_INFO_CALL_ARRAY_INDEX:
-	  (*map._zzp_info->_array._call)(map._zzp_info->_array._item,
+	  (*map._zzp_info->_array._call)(dirty_dest_reloc(dd,map._zzp_info->_array._item),
 					 map._zzp_info->_array._index);
 	  break;
 	case ZZP_INFO_CALL_ARRAY_MULTI_INDEX:
 	  {
 	    size_t offset =
-	      (*map._zzp_info->_array._call_multi)(map._zzp_info->_array._item,
+	      (*map._zzp_info->_array._call_multi)(dirty_dest_reloc(dd,map._zzp_info->_array._item),
 						   map._zzp_info->_array._index);
 	    dest = (T *) (((char *) dest) + offset);
 	    // printf ("%d - %d\n",zzp_info->_array._index,offset);
@@ -184,7 +187,7 @@ void map_members(const data_map<T> &map,const T &src MAP_MEMBERS_PARAM)
 	case ZZP_INFO_CALL_LIST_INDEX:
 	  {
 	    size_t offset =
-	      (*map._zzp_info->_list._call)(map._zzp_info->_list._item,
+	      (*map._zzp_info->_list._call)(dirty_dest_reloc(dd,map._zzp_info->_list._item),
 					    map._zzp_info->_list._index);
 	    dest = (T *) (((char *) dest) + offset);
 	    // printf ("%d - %d\n",zzp_info->_array._index,offset);
@@ -193,7 +196,7 @@ void map_members(const data_map<T> &map,const T &src MAP_MEMBERS_PARAM)
 	case ZZP_INFO_CALL_ARRAY_LIST_II_INDEX:
 	  {
 	    size_t offset =
-	      (*map._zzp_info->_array._call_multi)(map._zzp_info->_array._item,
+	      (*map._zzp_info->_array._call_multi)(dirty_dest_reloc(dd,map._zzp_info->_array._item),
 						   map._zzp_info->_array._index);
 	    dest = (T *) (((char *) dest) + offset);
 	    goto call_list_ii_index;
@@ -201,7 +204,7 @@ void map_members(const data_map<T> &map,const T &src MAP_MEMBERS_PARAM)
 	case ZZP_INFO_CALL_LIST_LIST_II_INDEX:
 	  {
 	    size_t offset =
-	      (*map._zzp_info->_list._call)(map._zzp_info->_list._item,
+	      (*map._zzp_info->_list._call)(dirty_dest_reloc(dd,map._zzp_info->_list._item),
 					    map._zzp_info->_list._index);
 	    dest = (T *) (((char *) dest) + offset);
 	    goto call_list_ii_index;
@@ -210,7 +213,7 @@ void map_members(const data_map<T> &map,const T &src MAP_MEMBERS_PARAM)
 	call_list_ii_index:
 	  {
 	    size_t offset =
-	      (*map._zzp_info->_list_ii._call_ii)(map._zzp_info->_list_ii._item);
+	      (*map._zzp_info->_list_ii._call_ii)(dirty_dest_reloc(dd,map._zzp_info->_list_ii._item));
 	    dest = (T *) (((char *) dest) + offset);
 	    // printf ("%d - %d\n",map._zzp_info->_array._index,offset);
 	    break;
@@ -219,8 +222,12 @@ void map_members(const data_map<T> &map,const T &src MAP_MEMBERS_PARAM)
 	  ERROR("Internal error in data mapping!");
 	  break;
 	}
+      dd._dirty->mark_zzp(map._zzp_info,dd._reloc);
       if (!map._toggle_i)
-	*dest = src;
+	{
+	  *dest = src;
+	  dd._dirty->mark(dest,sizeof (T));
+	}
       else
 	{
 	  // We are an toggle item.
@@ -240,6 +247,7 @@ void map_members(const data_map<T> &map,const T &src MAP_MEMBERS_PARAM)
 	      toggle_dest->_toggle_i = map._toggle_i;
 	      toggle_dest->_item = src;
 	    }
+	  dd._dirty->mark(toggle_dest,sizeof (*toggle_dest));
 	}
     }
   //char buf[256];
@@ -38,6 +38,8 @@
 
 #include "event_struct.hh"
 
+#include "subevent_match_cache.hh"
+
 #ifdef USER_EXTERNAL_UNPACK_STRUCT_FILE
 #include USER_EXTERNAL_UNPACK_STRUCT_FILE
 #endif
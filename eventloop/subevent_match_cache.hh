@@ -0,0 +1,91 @@
+/* This file is part of UCESB - a tool for data unpacking and processing.
+ *
+ * Copyright (C) 2016  GSI Helmholtzzentrum fuer Schwerionenforschung GmbH
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+ * MA  02110-1301  USA
+ */
+
+#ifndef __SUBEVENT_MATCH_CACHE_HH__
+#define __SUBEVENT_MATCH_CACHE_HH__
+
+#include "typedef.hh"
+
+/* Remembers which SUBEVENT declaration (match number) a certain
+ * subevent header matched.  Since the match only depends on the
+ * header, the linear test against all declarations then only has to
+ * be done the first time a kind of header is seen.
+ *
+ * The key is all header items that a match condition may look at,
+ * packed into 64 bits (SUBEVENT_MATCH_KEY).  Open addressing with a
+ * short probe sequence; if no free slot is found, the match is just
+ * not cached (and evaluated in full each time).
+ */
+
+#define SUBEVENT_MATCH_CACHE_BITS    9
+#define SUBEVENT_MATCH_CACHE_SIZE    (1 << SUBEVENT_MATCH_CACHE_BITS)
+#define SUBEVENT_MATCH_CACHE_PROBES  8
+
+struct subevent_match_cache_item
+{
+  uint64 _key;
+  sint32 _match_no; // -1: not (yet) known
+  sint32 _used;
+};
+
+class subevent_match_cache
+{
+public:
+  subevent_match_cache()
+  {
+    for (int i = 0; i < SUBEVENT_MATCH_CACHE_SIZE; i++)
+      {
+	_items[i]._key = 0;
+	_items[i]._match_no = -1;
+	_items[i]._used = 0;
+      }
+  }
+
+public:
+  subevent_match_cache_item _items[SUBEVENT_MATCH_CACHE_SIZE];
+
+public:
+  // Returns the slot for the key (claimed if new, with _match_no
+  // == -1), or NULL if the table is too crowded.
+  sint32 *find(uint64 key)
+  {
+    uint32 h = (uint32) ((key * 0x9e3779b97f4a7c15ULL) >>
+			 (64 - SUBEVENT_MATCH_CACHE_BITS));
+
+    for (int i = 0; i < SUBEVENT_MATCH_CACHE_PROBES; i++)
+      {
+	subevent_match_cache_item *item =
+	  &_items[(h + i) & (SUBEVENT_MATCH_CACHE_SIZE - 1)];
+
+	if (item->_key == key && item->_used)
+	  return &item->_match_no;
+
+	if (!item->_used)
+	  {
+	    item->_key = key;
+	    item->_used = 1;
+	    return &item->_match_no;
+	  }
+      }
+    return NULL;
+  }
+};
+
+#endif//__SUBEVENT_MATCH_CACHE_HH__
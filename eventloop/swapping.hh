@@ -29,6 +29,10 @@
 
 #include <sys/types.h>
 
+#if defined(__AVX2__) || defined(__SSSE3__)
+#include <immintrin.h>
+#endif
+
 #if BYTE_ORDER == BIG_ENDIAN
 # define HOST_ENDIAN_TYPE(x)  x##_big_endian
 #endif
@@ -54,4 +58,40 @@ inline void byteswap(T* ptr,size_t len)
     }
 }
 
+// Swap n 32-bit words from src to dest (which may be the same
+// location).  Meant for whole subevents, so uses vector shuffles when
+// the compiler is allowed to (e.g. -mssse3 or -march=native).
+
+inline void byteswap_32_copy(uint32 *dest,const uint32 *src,size_t n)
+{
+  size_t i = 0;
+
+#if defined(__AVX2__)
+  const __m256i shuffle256 =
+    _mm256_set_epi8(12,13,14,15, 8, 9,10,11, 4, 5, 6, 7, 0, 1, 2, 3,
+		    12,13,14,15, 8, 9,10,11, 4, 5, 6, 7, 0, 1, 2, 3);
+
+  for ( ; i + 8 <= n; i += 8)
+    {
+      __m256i v = _mm256_loadu_si256((const __m256i *) (src + i));
+      _mm256_storeu_si256((__m256i *) (dest + i),
+			  _mm256_shuffle_epi8(v,shuffle256));
+    }
+#endif
+#if defined(__SSSE3__)
+  const __m128i shuffle128 =
+    _mm_set_epi8(12,13,14,15, 8, 9,10,11, 4, 5, 6, 7, 0, 1, 2, 3);
+
+  for ( ; i + 4 <= n; i += 4)
+    {
+      __m128i v = _mm_loadu_si128((const __m128i *) (src + i));
+      _mm_storeu_si128((__m128i *) (dest + i),
+		       _mm_shuffle_epi8(v,shuffle128));
+    }
+#endif
+
+  for ( ; i < n; i++)
+    dest[i] = bswap_32(src[i]);
+}
+
 #endif//__SWAPPING_HH__
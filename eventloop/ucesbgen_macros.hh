@@ -23,6 +23,7 @@
 
 #include "error.hh"
 #include "optimise.hh"
+#include "match_profile.hh"
 
 /*
  *
@@ -86,15 +87,23 @@
   }                                                                \
 }
 
+// The CHECK_ macros only verify the data.  With --trusted-data they
+// are compiled out (is_trusted() is a constant of the data source).
+// Reading beyond the buffer and the CHECK_JUMP_ and MATCH_ macros,
+// which select what is unpacked, are never skipped.  Neither is
+// CHECK_MATCH_DECL, since __match() also moves past the substructure.
+
 #define CHECK_BITS_EQUAL(loc,value,constraint) {	      \
-  if (UNLIKELY((value) != (constraint))) {		      \
+  if (!__buffer.is_trusted() &&			      \
+      UNLIKELY((value) != (constraint))) {		      \
     ERROR_U_LOC(loc,"%s should be 0x%llx, is 0x%llx.",#value, \
 		(uint64) (constraint),(uint64) (value));      \
   }							      \
 }
 
 #define CHECK_UNNAMED_BITS_ZERO(loc,value,mask) {                            \
-  if (UNLIKELY(((value) & (mask)) != 0)) {                                   \
+  if (!__buffer.is_trusted() &&                                              \
+      UNLIKELY(((value) & (mask)) != 0)) {                                   \
     ERROR_U_LOC(loc,"Undefined parts of %s (mask 0x%llx) expected to be 0, " \
 		    "are 0x%llx (masked 0x%llx).",#value,		     \
 	      (uint64) (mask),(uint64) (value),(uint64) ((value) & (mask))); \
@@ -102,14 +111,16 @@
 }
 
 #define CHECK_BITS_RANGE(loc,value,min,max) {                               \
-  if (UNLIKELY((value) < (min) || (value) > (max))) {                       \
+  if (!__buffer.is_trusted() &&                                             \
+      UNLIKELY((value) < (min) || (value) > (max))) {                       \
     ERROR_U_LOC(loc,"%s should be within 0x%llx..0x%llx, is 0x%llx.",       \
 		    #value,(uint64) (min),(uint64) (max),(uint64) (value)); \
   }                                                                         \
 }
 
 #define CHECK_BITS_RANGE_MAX(loc,value,max) {                             \
-  if (UNLIKELY((value) > (max))) {                                        \
+  if (!__buffer.is_trusted() &&                                           \
+      UNLIKELY((value) > (max))) {                                        \
     ERROR_U_LOC(loc,"%s should be within 0x%llx..0x%llx, is 0x%llx.",     \
 		    #value,(uint64) (0),(uint64) (max),(uint64) (value)); \
   }                                                                       \
@@ -118,7 +129,8 @@
 #define CHECK_WORD_COUNT(loc,value,start,stop,offset,multiplier) { \
   size_t __check_distance =                                        \
     (size_t) (((char*) __mark_##stop) - ((char*) __mark_##start)) + (offset); \
-  if (UNLIKELY(((size_t) (value)) * (multiplier) != __check_distance)) { \
+  if (!__buffer.is_trusted() &&                                    \
+      UNLIKELY(((size_t) (value)) * (multiplier) != __check_distance)) { \
     ERROR_U_LOC(loc,"%s (= %d) times multiplier %d, is %d, "       \
                     "should be byte count from %s"                 \
                     " to %s + offset %d = %d.",                    \
@@ -298,7 +310,8 @@
 #endif
 
 #define UNPACK_CHECK_NO_REVISIT(loc,decltype,declname,visit_array,visit_index) { \
-  if (UNLIKELY(visit_array.get_set(visit_index))) {                              \
+  if (UNLIKELY(visit_array.get_set(visit_index)) &&                              \
+      !__buffer.is_trusted()) {                                                  \
     ERROR_U_LOC(loc,"Duplicate, substructure %s %s"                              \
                     " has already been visited.",#decltype,#declname);           \
   }                                                                              \
@@ -312,6 +325,13 @@
 #define VES10_1_control  VES10_1_ITEM(h_control)
 #define VES10_1_subcrate VES10_1_ITEM(h_subcrate)
 #define VES10_1_procid   VES10_1_ITEM(i_procid)
+
+#define SUBEVENT_MATCH_KEY			\
+  (((uint64) VES10_1_type)            |		\
+   ((uint64) VES10_1_subtype  << 16)  |		\
+   ((uint64) VES10_1_control  << 32)  |		\
+   ((uint64) VES10_1_subcrate << 40)  |		\
+   ((uint64) VES10_1_procid   << 48))
 #endif//USE_LMD_INPUT
 
 #ifdef USE_HLD_INPUT
@@ -319,6 +339,8 @@
 
 #define VES10_1_decode_type  VES10_1_ITEM(_deconde._type)
 #define VES10_1_id           VES10_1_ITEM(_id)
+
+#define SUBEVENT_MATCH_KEY   ((uint64) VES10_1_id)
 #endif//USE_HLD_INPUT
 
 #ifdef USE_MVLC_INPUT
@@ -326,6 +348,8 @@
 
 //#define VES10_1_module_type  VES10_1_ITEM(_module_type)
 #define VES10_1_id  VES10_1_ITEM(_id)
+
+#define SUBEVENT_MATCH_KEY  ((uint64) VES10_1_id)
 #endif//USE_MVLC_INPUT
 
 #ifdef USE_PAX_INPUT
@@ -343,8 +367,28 @@
 #define VES10_1_fp   VES10_1_ITEM(0x000fc000, 14)
 #define VES10_1_det  VES10_1_ITEM(0x00003f00,  8)
 #define VES10_1_mod  VES10_1_ITEM(0x000000ff,  0)
+
+#define SUBEVENT_MATCH_KEY  ((uint64) ((ridf_subevent_header *) __header)->_id)
 #endif//USE_RIDF_INPUT
 
+/* The match of a subevent header against the SUBEVENT declarations
+ * is remembered in __match_cache (see subevent_match_cache.hh).
+ * The code between LOOKUP and STORE is the full (linear) match.
+ */
+
+#ifdef SUBEVENT_MATCH_KEY
+#define SUBEVENT_MATCH_CACHE_LOOKUP(match)				\
+  sint32 *__match_cached = __match_cache.find(SUBEVENT_MATCH_KEY);	\
+  if (__match_cached && *__match_cached >= 0)				\
+    match = *__match_cached;						\
+  else
+#define SUBEVENT_MATCH_CACHE_STORE(match)				\
+  if (__match_cached) *__match_cached = match;
+#else
+#define SUBEVENT_MATCH_CACHE_LOOKUP(match)
+#define SUBEVENT_MATCH_CACHE_STORE(match)
+#endif
+
 #define UNPACK_SUBEVENT_CHECK_NO_REVISIT(loc,decltype,declname,visit_index) { \
   if (UNLIKELY(__visited.get_set(visit_index))) {                             \
     ERROR_U_LOC(loc,"Duplicate, subevent %s %s "                              \
@@ -24,6 +24,7 @@
 #include "watcher_event_info.hh"
 #include "control_include.hh"
 #include "multi_info.hh"
+#include "dirty_clean.hh"
 
 #ifdef INIT_USER_FUNCTION
 void INIT_USER_FUNCTION();
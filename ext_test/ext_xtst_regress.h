@@ -0,0 +1,4896 @@
+/********************************************************
+ *
+ * Structure for ext_data_fetch_event() filling.
+ *
+ * Do not edit - automatically generated.
+ */
+
+#ifndef __GUARD_ALL_EXT_TEST_EXT_XTST_REGRESS_H__
+#define __GUARD_ALL_EXT_TEST_EXT_XTST_REGRESS_H__
+
+#ifndef __CINT__
+# include <stdint.h>
+#else
+/* For CINT (old version trouble with stdint.h): */
+# ifndef uint32_t
+typedef unsigned int uint32_t;
+typedef          int  int32_t;
+# endif
+#endif
+#ifndef EXT_STRUCT_CTRL
+# define EXT_STRUCT_CTRL(x)
+#endif
+
+/********************************************************
+ *
+ * Plain structure (layout as ntuple/root file):
+ */
+
+typedef struct EXT_STR_xtst_regress_t
+{
+  /* INFO */
+  uint32_t TRIGGER /* [0,15] */;
+  uint32_t EVENTNO /* [-1,-1] */;
+  uint32_t STIDX /* [-1,-1] */;
+  uint32_t TSTAMPLO /* [-1,-1] */;
+  uint32_t TSTAMPHI /* [-1,-1] */;
+  uint32_t TSTAMPSRCID /* [-1,-1] */;
+  uint32_t MERGE_STATUS /* [-1,-1] */;
+  uint32_t MERGE_IDMASK /* [-1,-1] */;
+  /* UNPACK */
+  uint32_t regress1wr1srcid /* [0,65535] */;
+  uint32_t regress1wr1err /* [0,65535] */;
+  uint32_t regress1wr1t1 /* [0,65535] */;
+  uint32_t regress1wr1t2 /* [0,65535] */;
+  uint32_t regress1wr1t3 /* [0,65535] */;
+  uint32_t regress1wr1t4 /* [0,65535] */;
+  uint32_t regress1wr2srcid /* [0,65535] */;
+  uint32_t regress1wr2err /* [0,65535] */;
+  uint32_t regress1wr2t1 /* [0,65535] */;
+  uint32_t regress1wr2t2 /* [0,65535] */;
+  uint32_t regress1wr2t3 /* [0,65535] */;
+  uint32_t regress1wr2t4 /* [0,65535] */;
+  uint32_t regress1wr3srcid /* [0,65535] */;
+  uint32_t regress1wr3err /* [0,65535] */;
+  uint32_t regress1wr3t1 /* [0,65535] */;
+  uint32_t regress1wr3t2 /* [0,65535] */;
+  uint32_t regress1wr3t3 /* [0,65535] */;
+  uint32_t regress1wr3t4 /* [0,65535] */;
+  uint32_t regress1wr4srcid /* [0,65535] */;
+  uint32_t regress1wr4err /* [0,65535] */;
+  uint32_t regress1wr4t1 /* [0,65535] */;
+  uint32_t regress1wr4t2 /* [0,65535] */;
+  uint32_t regress1wr4t3 /* [0,65535] */;
+  uint32_t regress1wr4t4 /* [0,65535] */;
+  uint32_t regress1wr5srcid /* [0,65535] */;
+  uint32_t regress1wr5err /* [0,65535] */;
+  uint32_t regress1wr5t1 /* [0,65535] */;
+  uint32_t regress1wr5t2 /* [0,65535] */;
+  uint32_t regress1wr5t3 /* [0,65535] */;
+  uint32_t regress1wr5t4 /* [0,65535] */;
+  uint32_t regress1wr6srcid /* [0,65535] */;
+  uint32_t regress1wr6err /* [0,65535] */;
+  uint32_t regress1wr6t1 /* [0,65535] */;
+  uint32_t regress1wr6t2 /* [0,65535] */;
+  uint32_t regress1wr6t3 /* [0,65535] */;
+  uint32_t regress1wr6t4 /* [0,65535] */;
+  uint32_t regress1seed /* [-1,-1] */;
+  uint32_t regress1v775mod1n /* [0,32] */;
+  uint32_t regress1v775mod1nI[32 EXT_STRUCT_CTRL(regress1v775mod1n)] /* [1,32] */;
+  uint32_t regress1v775mod1data[32 EXT_STRUCT_CTRL(regress1v775mod1n)] /* [0,65535] */;
+  uint32_t regress1v775mod1eob /* [-1,-1] */;
+  uint32_t regress1v775mod2n /* [0,32] */;
+  uint32_t regress1v775mod2nI[32 EXT_STRUCT_CTRL(regress1v775mod2n)] /* [1,32] */;
+  uint32_t regress1v775mod2data[32 EXT_STRUCT_CTRL(regress1v775mod2n)] /* [0,65535] */;
+  uint32_t regress1v775mod2eob /* [-1,-1] */;
+  uint32_t regress1v1290mod1nM /* [1,32] */;
+  uint32_t regress1v1290mod1nMI[32 EXT_STRUCT_CTRL(regress1v1290mod1nM)] /* [1,32] */;
+  uint32_t regress1v1290mod1nME[32 EXT_STRUCT_CTRL(regress1v1290mod1nM)] /* [1,4096] */;
+  uint32_t regress1v1290mod1n /* [0,4096] */;
+  uint32_t regress1v1290mod1data[4096 EXT_STRUCT_CTRL(regress1v1290mod1n)] /* [0,16777215] */;
+  uint32_t regress1v1290mod1header /* [-1,-1] */;
+  uint32_t regress1v1290mod1err1error_flags /* [-1,-1] */;
+  uint32_t regress1v1290mod1err2error_flags /* [-1,-1] */;
+  uint32_t regress1v1290mod1err3error_flags /* [-1,-1] */;
+  uint32_t regress1v1290mod1err4error_flags /* [-1,-1] */;
+  uint32_t regress1v1290mod1trigger /* [-1,-1] */;
+  uint32_t regress1v1290mod1trailer /* [-1,-1] */;
+  uint32_t regress1v1290mod2nM /* [1,32] */;
+  uint32_t regress1v1290mod2nMI[32 EXT_STRUCT_CTRL(regress1v1290mod2nM)] /* [1,32] */;
+  uint32_t regress1v1290mod2nME[32 EXT_STRUCT_CTRL(regress1v1290mod2nM)] /* [1,4096] */;
+  uint32_t regress1v1290mod2n /* [0,4096] */;
+  uint32_t regress1v1290mod2data[4096 EXT_STRUCT_CTRL(regress1v1290mod2n)] /* [0,16777215] */;
+  uint32_t regress1v1290mod2header /* [-1,-1] */;
+  uint32_t regress1v1290mod2err1error_flags /* [-1,-1] */;
+  uint32_t regress1v1290mod2err2error_flags /* [-1,-1] */;
+  uint32_t regress1v1290mod2err3error_flags /* [-1,-1] */;
+  uint32_t regress1v1290mod2err4error_flags /* [-1,-1] */;
+  uint32_t regress1v1290mod2trigger /* [-1,-1] */;
+  uint32_t regress1v1290mod2trailer /* [-1,-1] */;
+  uint32_t regress1sticky_active_separator /* [-1,-1] */;
+  uint32_t regress1sticky_active_active /* [-1,-1] */;
+  uint32_t regress1sticky_active_mark /* [-1,-1] */;
+  uint32_t regress1sticky_active_corr /* [-1,-1] */;
+  /* RAW */
+  uint32_t STCORR /* [-1,-1] */;
+
+} EXT_STR_xtst_regress;
+
+/********************************************************
+ *
+ * Structure with multiple levels of arrays (partially)
+ * recovered (recommended):
+ */
+
+typedef struct EXT_STR_xtst_regress_onion_t
+{
+  /* INFO */
+  uint32_t TRIGGER;
+  uint32_t EVENTNO;
+  uint32_t STIDX;
+  uint32_t TSTAMPLO;
+  uint32_t TSTAMPHI;
+  uint32_t TSTAMPSRCID;
+  uint32_t MERGE_STATUS;
+  uint32_t MERGE_IDMASK;
+  /* UNPACK */
+  struct {
+    struct {
+      uint32_t srcid;
+      uint32_t err;
+      uint32_t t[4];
+    } wr[6];
+    uint32_t seed;
+    uint32_t v775mod1n;
+    uint32_t v775mod1nI[32 /* v775mod1n */];
+    uint32_t v775mod1data[32 /* v775mod1n */];
+    uint32_t v775mod1eob;
+    uint32_t v775mod2n;
+    uint32_t v775mod2nI[32 /* v775mod2n */];
+    uint32_t v775mod2data[32 /* v775mod2n */];
+    uint32_t v775mod2eob;
+    uint32_t v1290mod1nM;
+    uint32_t v1290mod1nMI[32 /* v1290mod1nM */];
+    uint32_t v1290mod1nME[32 /* v1290mod1nM */];
+    uint32_t v1290mod1n;
+    uint32_t v1290mod1data[4096 /* v1290mod1n */];
+    uint32_t v1290mod1header;
+    uint32_t v1290mod1err1error_flags;
+    uint32_t v1290mod1err2error_flags;
+    uint32_t v1290mod1err3error_flags;
+    uint32_t v1290mod1err4error_flags;
+    uint32_t v1290mod1trigger;
+    uint32_t v1290mod1trailer;
+    uint32_t v1290mod2nM;
+    uint32_t v1290mod2nMI[32 /* v1290mod2nM */];
+    uint32_t v1290mod2nME[32 /* v1290mod2nM */];
+    uint32_t v1290mod2n;
+    uint32_t v1290mod2data[4096 /* v1290mod2n */];
+    uint32_t v1290mod2header;
+    uint32_t v1290mod2err1error_flags;
+    uint32_t v1290mod2err2error_flags;
+    uint32_t v1290mod2err3error_flags;
+    uint32_t v1290mod2err4error_flags;
+    uint32_t v1290mod2trigger;
+    uint32_t v1290mod2trailer;
+    uint32_t sticky_active_separator;
+    uint32_t sticky_active_active;
+    uint32_t sticky_active_mark;
+    uint32_t sticky_active_corr;
+  } regress[1];
+  /* RAW */
+  uint32_t STCORR;
+
+} EXT_STR_xtst_regress_onion;
+
+/*******************************************************/
+
+#define EXT_STR_xtst_regress_ITEMS_INFO(ok,si,offset,struct_t,printerr) do { \
+  ok = 1; \
+  /* INFO */ \
+  EXT_STR_ITEM_INFO_LIM(ok,si,offset,struct_t,printerr,\
+                     TRIGGER,                         UINT32,\
+                    "TRIGGER",15); \
+  EXT_STR_ITEM_INFO    (ok,si,offset,struct_t,printerr,\
+                     EVENTNO,                         UINT32,\
+                    "EVENTNO"); \
+  EXT_STR_ITEM_INFO    (ok,si,offset,struct_t,printerr,\
+                     STIDX,                           UINT32,\
+                    "STIDX"); \
+  EXT_STR_ITEM_INFO    (ok,si,offset,struct_t,printerr,\
+                     TSTAMPLO,                        UINT32,\
+                    "TSTAMPLO"); \
+  EXT_STR_ITEM_INFO    (ok,si,offset,struct_t,printerr,\
+                     TSTAMPHI,                        UINT32,\
+                    "TSTAMPHI"); \
+  EXT_STR_ITEM_INFO    (ok,si,offset,struct_t,printerr,\
+                     TSTAMPSRCID,                     UINT32,\
+                    "TSTAMPSRCID"); \
+  EXT_STR_ITEM_INFO    (ok,si,offset,struct_t,printerr,\
+                     MERGE_STATUS,                    UINT32,\
+                    "MERGE_STATUS"); \
+  EXT_STR_ITEM_INFO    (ok,si,offset,struct_t,printerr,\
+                     MERGE_IDMASK,                    UINT32,\
+                    "MERGE_IDMASK"); \
+  /* UNPACK */ \
+  EXT_STR_ITEM_INFO_LIM(ok,si,offset,struct_t,printerr,\
+                     regress1wr1srcid,                UINT32,\
+                    "regress1wr1srcid",65535); \
+  EXT_STR_ITEM_INFO_LIM(ok,si,offset,struct_t,printerr,\
+                     regress1wr1err,                  UINT32,\
+                    "regress1wr1err",65535); \
+  EXT_STR_ITEM_INFO_LIM(ok,si,offset,struct_t,printerr,\
+                     regress1wr1t1,                   UINT32,\
+                    "regress1wr1t1",65535); \
+  EXT_STR_ITEM_INFO_LIM(ok,si,offset,struct_t,printerr,\
+                     regress1wr1t2,                   UINT32,\
+                    "regress1wr1t2",65535); \
+  EXT_STR_ITEM_INFO_LIM(ok,si,offset,struct_t,printerr,\
+                     regress1wr1t3,                   UINT32,\
+                    "regress1wr1t3",65535); \
+  EXT_STR_ITEM_INFO_LIM(ok,si,offset,struct_t,printerr,\
+                     regress1wr1t4,                   UINT32,\
+                    "regress1wr1t4",65535); \
+  EXT_STR_ITEM_INFO_LIM(ok,si,offset,struct_t,printerr,\
+                     regress1wr2srcid,                UINT32,\
+                    "regress1wr2srcid",65535); \
+  EXT_STR_ITEM_INFO_LIM(ok,si,offset,struct_t,printerr,\
+                     regress1wr2err,                  UINT32,\
+                    "regress1wr2err",65535); \
+  EXT_STR_ITEM_INFO_LIM(ok,si,offset,struct_t,printerr,\
+                     regress1wr2t1,                   UINT32,\
+                    "regress1wr2t1",65535); \
+  EXT_STR_ITEM_INFO_LIM(ok,si,offset,struct_t,printerr,\
+                     regress1wr2t2,                   UINT32,\
+                    "regress1wr2t2",65535); \
+  EXT_STR_ITEM_INFO_LIM(ok,si,offset,struct_t,printerr,\
+                     regress1wr2t3,                   UINT32,\
+                    "regress1wr2t3",65535); \
+  EXT_STR_ITEM_INFO_LIM(ok,si,offset,struct_t,printerr,\
+                     regress1wr2t4,                   UINT32,\
+                    "regress1wr2t4",65535); \
+  EXT_STR_ITEM_INFO_LIM(ok,si,offset,struct_t,printerr,\
+                     regress1wr3srcid,                UINT32,\
+                    "regress1wr3srcid",65535); \
+  EXT_STR_ITEM_INFO_LIM(ok,si,offset,struct_t,printerr,\
+                     regress1wr3err,                  UINT32,\
+                    "regress1wr3err",65535); \
+  EXT_STR_ITEM_INFO_LIM(ok,si,offset,struct_t,printerr,\
+                     regress1wr3t1,                   UINT32,\
+                    "regress1wr3t1",65535); \
+  EXT_STR_ITEM_INFO_LIM(ok,si,offset,struct_t,printerr,\
+                     regress1wr3t2,                   UINT32,\
+                    "regress1wr3t2",65535); \
+  EXT_STR_ITEM_INFO_LIM(ok,si,offset,struct_t,printerr,\
+                     regress1wr3t3,                   UINT32,\
+                    "regress1wr3t3",65535); \
+  EXT_STR_ITEM_INFO_LIM(ok,si,offset,struct_t,printerr,\
+                     regress1wr3t4,                   UINT32,\
+                    "regress1wr3t4",65535); \
+  EXT_STR_ITEM_INFO_LIM(ok,si,offset,struct_t,printerr,\
+                     regress1wr4srcid,                UINT32,\
+                    "regress1wr4srcid",65535); \
+  EXT_STR_ITEM_INFO_LIM(ok,si,offset,struct_t,printerr,\
+                     regress1wr4err,                  UINT32,\
+                    "regress1wr4err",65535); \
+  EXT_STR_ITEM_INFO_LIM(ok,si,offset,struct_t,printerr,\
+                     regress1wr4t1,                   UINT32,\
+                    "regress1wr4t1",65535); \
+  EXT_STR_ITEM_INFO_LIM(ok,si,offset,struct_t,printerr,\
+                     regress1wr4t2,                   UINT32,\
+                    "regress1wr4t2",65535); \
+  EXT_STR_ITEM_INFO_LIM(ok,si,offset,struct_t,printerr,\
+                     regress1wr4t3,                   UINT32,\
+                    "regress1wr4t3",65535); \
+  EXT_STR_ITEM_INFO_LIM(ok,si,offset,struct_t,printerr,\
+                     regress1wr4t4,                   UINT32,\
+                    "regress1wr4t4",65535); \
+  EXT_STR_ITEM_INFO_LIM(ok,si,offset,struct_t,printerr,\
+                     regress1wr5srcid,                UINT32,\
+                    "regress1wr5srcid",65535); \
+  EXT_STR_ITEM_INFO_LIM(ok,si,offset,struct_t,printerr,\
+                     regress1wr5err,                  UINT32,\
+                    "regress1wr5err",65535); \
+  EXT_STR_ITEM_INFO_LIM(ok,si,offset,struct_t,printerr,\
+                     regress1wr5t1,                   UINT32,\
+                    "regress1wr5t1",65535); \
+  EXT_STR_ITEM_INFO_LIM(ok,si,offset,struct_t,printerr,\
+                     regress1wr5t2,                   UINT32,\
+                    "regress1wr5t2",65535); \
+  EXT_STR_ITEM_INFO_LIM(ok,si,offset,struct_t,printerr,\
+                     regress1wr5t3,                   UINT32,\
+                    "regress1wr5t3",65535); \
+  EXT_STR_ITEM_INFO_LIM(ok,si,offset,struct_t,printerr,\
+                     regress1wr5t4,                   UINT32,\
+                    "regress1wr5t4",65535); \
+  EXT_STR_ITEM_INFO_LIM(ok,si,offset,struct_t,printerr,\
+                     regress1wr6srcid,                UINT32,\
+                    "regress1wr6srcid",65535); \
+  EXT_STR_ITEM_INFO_LIM(ok,si,offset,struct_t,printerr,\
+                     regress1wr6err,                  UINT32,\
+                    "regress1wr6err",65535); \
+  EXT_STR_ITEM_INFO_LIM(ok,si,offset,struct_t,printerr,\
+                     regress1wr6t1,                   UINT32,\
+                    "regress1wr6t1",65535); \
+  EXT_STR_ITEM_INFO_LIM(ok,si,offset,struct_t,printerr,\
+                     regress1wr6t2,                   UINT32,\
+                    "regress1wr6t2",65535); \
+  EXT_STR_ITEM_INFO_LIM(ok,si,offset,struct_t,printerr,\
+                     regress1wr6t3,                   UINT32,\
+                    "regress1wr6t3",65535); \
+  EXT_STR_ITEM_INFO_LIM(ok,si,offset,struct_t,printerr,\
+                     regress1wr6t4,                   UINT32,\
+                    "regress1wr6t4",65535); \
+  EXT_STR_ITEM_INFO    (ok,si,offset,struct_t,printerr,\
+                     regress1seed,                    UINT32,\
+                    "regress1seed"); \
+  EXT_STR_ITEM_INFO_LIM(ok,si,offset,struct_t,printerr,\
+                     regress1v775mod1n,               UINT32,\
+                    "regress1v775mod1n",32); \
+  EXT_STR_ITEM_INFO_ZZP(ok,si,offset,struct_t,printerr,\
+                     regress1v775mod1nI,              UINT32,\
+                    "regress1v775mod1nI",              "regress1v775mod1n"); \
+  EXT_STR_ITEM_INFO_ZZP(ok,si,offset,struct_t,printerr,\
+                     regress1v775mod1data,            UINT32,\
+                    "regress1v775mod1data",            "regress1v775mod1n"); \
+  EXT_STR_ITEM_INFO    (ok,si,offset,struct_t,printerr,\
+                     regress1v775mod1eob,             UINT32,\
+                    "regress1v775mod1eob"); \
+  EXT_STR_ITEM_INFO_LIM(ok,si,offset,struct_t,printerr,\
+                     regress1v775mod2n,               UINT32,\
+                    "regress1v775mod2n",32); \
+  EXT_STR_ITEM_INFO_ZZP(ok,si,offset,struct_t,printerr,\
+                     regress1v775mod2nI,              UINT32,\
+                    "regress1v775mod2nI",              "regress1v775mod2n"); \
+  EXT_STR_ITEM_INFO_ZZP(ok,si,offset,struct_t,printerr,\
+                     regress1v775mod2data,            UINT32,\
+                    "regress1v775mod2data",            "regress1v775mod2n"); \
+  EXT_STR_ITEM_INFO    (ok,si,offset,struct_t,printerr,\
+                     regress1v775mod2eob,             UINT32,\
+                    "regress1v775mod2eob"); \
+  EXT_STR_ITEM_INFO_LIM(ok,si,offset,struct_t,printerr,\
+                     regress1v1290mod1nM,             UINT32,\
+                    "regress1v1290mod1nM",32); \
+  EXT_STR_ITEM_INFO_ZZP(ok,si,offset,struct_t,printerr,\
+                     regress1v1290mod1nMI,            UINT32,\
+                    "regress1v1290mod1nMI",            "regress1v1290mod1nM"); \
+  EXT_STR_ITEM_INFO_ZZP(ok,si,offset,struct_t,printerr,\
+                     regress1v1290mod1nME,            UINT32,\
+                    "regress1v1290mod1nME",            "regress1v1290mod1nM"); \
+  EXT_STR_ITEM_INFO_LIM(ok,si,offset,struct_t,printerr,\
+                     regress1v1290mod1n,              UINT32,\
+                    "regress1v1290mod1n",4096); \
+  EXT_STR_ITEM_INFO_ZZP(ok,si,offset,struct_t,printerr,\
+                     regress1v1290mod1data,           UINT32,\
+                    "regress1v1290mod1data",           "regress1v1290mod1n"); \
+  EXT_STR_ITEM_INFO    (ok,si,offset,struct_t,printerr,\
+                     regress1v1290mod1header,         UINT32,\
+                    "regress1v1290mod1header"); \
+  EXT_STR_ITEM_INFO    (ok,si,offset,struct_t,printerr,\
+                     regress1v1290mod1err1error_flags,UINT32,\
+                    "regress1v1290mod1err1error_flags"); \
+  EXT_STR_ITEM_INFO    (ok,si,offset,struct_t,printerr,\
+                     regress1v1290mod1err2error_flags,UINT32,\
+                    "regress1v1290mod1err2error_flags"); \
+  EXT_STR_ITEM_INFO    (ok,si,offset,struct_t,printerr,\
+                     regress1v1290mod1err3error_flags,UINT32,\
+                    "regress1v1290mod1err3error_flags"); \
+  EXT_STR_ITEM_INFO    (ok,si,offset,struct_t,printerr,\
+                     regress1v1290mod1err4error_flags,UINT32,\
+                    "regress1v1290mod1err4error_flags"); \
+  EXT_STR_ITEM_INFO    (ok,si,offset,struct_t,printerr,\
+                     regress1v1290mod1trigger,        UINT32,\
+                    "regress1v1290mod1trigger"); \
+  EXT_STR_ITEM_INFO    (ok,si,offset,struct_t,printerr,\
+                     regress1v1290mod1trailer,        UINT32,\
+                    "regress1v1290mod1trailer"); \
+  EXT_STR_ITEM_INFO_LIM(ok,si,offset,struct_t,printerr,\
+                     regress1v1290mod2nM,             UINT32,\
+                    "regress1v1290mod2nM",32); \
+  EXT_STR_ITEM_INFO_ZZP(ok,si,offset,struct_t,printerr,\
+                     regress1v1290mod2nMI,            UINT32,\
+                    "regress1v1290mod2nMI",            "regress1v1290mod2nM"); \
+  EXT_STR_ITEM_INFO_ZZP(ok,si,offset,struct_t,printerr,\
+                     regress1v1290mod2nME,            UINT32,\
+                    "regress1v1290mod2nME",            "regress1v1290mod2nM"); \
+  EXT_STR_ITEM_INFO_LIM(ok,si,offset,struct_t,printerr,\
+                     regress1v1290mod2n,              UINT32,\
+                    "regress1v1290mod2n",4096); \
+  EXT_STR_ITEM_INFO_ZZP(ok,si,offset,struct_t,printerr,\
+                     regress1v1290mod2data,           UINT32,\
+                    "regress1v1290mod2data",           "regress1v1290mod2n"); \
+  EXT_STR_ITEM_INFO    (ok,si,offset,struct_t,printerr,\
+                     regress1v1290mod2header,         UINT32,\
+                    "regress1v1290mod2header"); \
+  EXT_STR_ITEM_INFO    (ok,si,offset,struct_t,printerr,\
+                     regress1v1290mod2err1error_flags,UINT32,\
+                    "regress1v1290mod2err1error_flags"); \
+  EXT_STR_ITEM_INFO    (ok,si,offset,struct_t,printerr,\
+                     regress1v1290mod2err2error_flags,UINT32,\
+                    "regress1v1290mod2err2error_flags"); \
+  EXT_STR_ITEM_INFO    (ok,si,offset,struct_t,printerr,\
+                     regress1v1290mod2err3error_flags,UINT32,\
+                    "regress1v1290mod2err3error_flags"); \
+  EXT_STR_ITEM_INFO    (ok,si,offset,struct_t,printerr,\
+                     regress1v1290mod2err4error_flags,UINT32,\
+                    "regress1v1290mod2err4error_flags"); \
+  EXT_STR_ITEM_INFO    (ok,si,offset,struct_t,printerr,\
+                     regress1v1290mod2trigger,        UINT32,\
+                    "regress1v1290mod2trigger"); \
+  EXT_STR_ITEM_INFO    (ok,si,offset,struct_t,printerr,\
+                     regress1v1290mod2trailer,        UINT32,\
+                    "regress1v1290mod2trailer"); \
+  EXT_STR_ITEM_INFO    (ok,si,offset,struct_t,printerr,\
+                     regress1sticky_active_separator, UINT32,\
+                    "regress1sticky_active_separator"); \
+  EXT_STR_ITEM_INFO    (ok,si,offset,struct_t,printerr,\
+                     regress1sticky_active_active,    UINT32,\
+                    "regress1sticky_active_active"); \
+  EXT_STR_ITEM_INFO    (ok,si,offset,struct_t,printerr,\
+                     regress1sticky_active_mark,      UINT32,\
+                    "regress1sticky_active_mark"); \
+  EXT_STR_ITEM_INFO    (ok,si,offset,struct_t,printerr,\
+                     regress1sticky_active_corr,      UINT32,\
+                    "regress1sticky_active_corr"); \
+  /* RAW */ \
+  EXT_STR_ITEM_INFO    (ok,si,offset,struct_t,printerr,\
+                     STCORR,                          UINT32,\
+                    "STCORR"); \
+  \
+} while (0);
+
+/********************************************************
+ *
+ * For internal use by the network data reader:
+ * (version checks, etc)
+ */
+
+typedef struct EXT_STR_xtst_regress_layout_t
+{
+  uint32_t _magic;
+  uint32_t _size_info;
+  uint32_t _size_struct;
+  uint32_t _size_struct_onion;
+  uint32_t _pack_list_items;
+
+  uint32_t _num_items;
+  struct {
+    uint32_t _offset;
+    uint32_t _size;
+    uint32_t _xor;
+    const char *_name;
+  } _items[1];
+  uint32_t _pack_list[17052];
+} EXT_STR_xtst_regress_layout;
+
+#define EXT_STR_xtst_regress_LAYOUT_INIT { \
+  0x57e65c97, \
+  sizeof(EXT_STR_xtst_regress_layout), \
+  sizeof(EXT_STR_xtst_regress), \
+  sizeof(EXT_STR_xtst_regress_onion), \
+  17052, \
+  1, \
+  { \
+    { 0, sizeof(EXT_STR_xtst_regress), 0x1ee769e7, "xtst_regress" }, \
+  }, \
+  { \
+   /*    0 */ 0x40a52000, 0x00000000, 0x40a52000, 0x00000004, \
+   /*    4 */ 0x40a52000, 0x00000008, 0x40a52100, 0x0000000c, \
+   /*    8 */ 0x40a52200, 0x00000010, 0x40a52400, 0x00000014, \
+   /*   12 */ 0x40a53000, 0x00000018, 0x40a56000, 0x0000001c, \
+   /*   16 */ 0x40a50000, 0x00000020, 0x40a50000, 0x00000024, \
+   /*   20 */ 0x40a50000, 0x00000028, 0x40a50000, 0x0000002c, \
+   /*   24 */ 0x40a50000, 0x00000030, 0x40a50000, 0x00000034, \
+   /*   28 */ 0x40a50000, 0x00000038, 0x40a50000, 0x0000003c, \
+   /*   32 */ 0x40a50000, 0x00000040, 0x40a50000, 0x00000044, \
+   /*   36 */ 0x40a50000, 0x00000048, 0x40a50000, 0x0000004c, \
+   /*   40 */ 0x40a50000, 0x00000050, 0x40a50000, 0x00000054, \
+   /*   44 */ 0x40a50000, 0x00000058, 0x40a50000, 0x0000005c, \
+   /*   48 */ 0x40a50000, 0x00000060, 0x40a50000, 0x00000064, \
+   /*   52 */ 0x40a50000, 0x00000068, 0x40a50000, 0x0000006c, \
+   /*   56 */ 0x40a50000, 0x00000070, 0x40a50000, 0x00000074, \
+   /*   60 */ 0x40a50000, 0x00000078, 0x40a50000, 0x0000007c, \
+   /*   64 */ 0x40a50000, 0x00000080, 0x40a50000, 0x00000084, \
+   /*   68 */ 0x40a50000, 0x00000088, 0x40a50000, 0x0000008c, \
+   /*   72 */ 0x40a50000, 0x00000090, 0x40a50000, 0x00000094, \
+   /*   76 */ 0x40a50000, 0x00000098, 0x40a50000, 0x0000009c, \
+   /*   80 */ 0x40a50000, 0x000000a0, 0x40a50000, 0x000000a4, \
+   /*   84 */ 0x40a50000, 0x000000a8, 0x40a50000, 0x000000ac, \
+   /*   88 */ 0x40a50000, 0x000000b0, 0x40a50000, 0x000001b8, \
+   /*   92 */ 0x40a50000, 0x000002c0, 0x40a50000, 0x000043cc, \
+   /*   96 */ 0x40a50000, 0x000043d0, 0x40a50000, 0x000043d4, \
+   /*  100 */ 0x40a50000, 0x000043d8, 0x40a50000, 0x000043dc, \
+   /*  104 */ 0x40a50000, 0x000043e0, 0x40a50000, 0x000043e4, \
+   /*  108 */ 0x40a50000, 0x000084f0, 0x40a50000, 0x000084f4, \
+   /*  112 */ 0x40a50000, 0x000084f8, 0x40a50000, 0x000084fc, \
+   /*  116 */ 0x40a50000, 0x00008500, 0x40a50000, 0x00008504, \
+   /*  120 */ 0x40a50000, 0x00008508, 0x40a50000, 0x0000850c, \
+   /*  124 */ 0x40a50000, 0x00008510, 0x40a50000, 0x00008514, \
+   /*  128 */ 0x40a50000, 0x00008518, 0x40a50000, 0x0000851c, \
+   /*  132 */ 0xe0a50000, 0x000000b4, 0x00000020, 0x00000002, \
+   /*  136 */ 0x48a50000, 0x000000b8, 0x40a50000, 0x00000138, \
+   /*  140 */ 0x48a50000, 0x000000bc, 0x40a50000, 0x0000013c, \
+   /*  144 */ 0x48a50000, 0x000000c0, 0x40a50000, 0x00000140, \
+   /*  148 */ 0x48a50000, 0x000000c4, 0x40a50000, 0x00000144, \
+   /*  152 */ 0x48a50000, 0x000000c8, 0x40a50000, 0x00000148, \
+   /*  156 */ 0x48a50000, 0x000000cc, 0x40a50000, 0x0000014c, \
+   /*  160 */ 0x48a50000, 0x000000d0, 0x40a50000, 0x00000150, \
+   /*  164 */ 0x48a50000, 0x000000d4, 0x40a50000, 0x00000154, \
+   /*  168 */ 0x48a50000, 0x000000d8, 0x40a50000, 0x00000158, \
+   /*  172 */ 0x48a50000, 0x000000dc, 0x40a50000, 0x0000015c, \
+   /*  176 */ 0x48a50000, 0x000000e0, 0x40a50000, 0x00000160, \
+   /*  180 */ 0x48a50000, 0x000000e4, 0x40a50000, 0x00000164, \
+   /*  184 */ 0x48a50000, 0x000000e8, 0x40a50000, 0x00000168, \
+   /*  188 */ 0x48a50000, 0x000000ec, 0x40a50000, 0x0000016c, \
+   /*  192 */ 0x48a50000, 0x000000f0, 0x40a50000, 0x00000170, \
+   /*  196 */ 0x48a50000, 0x000000f4, 0x40a50000, 0x00000174, \
+   /*  200 */ 0x48a50000, 0x000000f8, 0x40a50000, 0x00000178, \
+   /*  204 */ 0x48a50000, 0x000000fc, 0x40a50000, 0x0000017c, \
+   /*  208 */ 0x48a50000, 0x00000100, 0x40a50000, 0x00000180, \
+   /*  212 */ 0x48a50000, 0x00000104, 0x40a50000, 0x00000184, \
+   /*  216 */ 0x48a50000, 0x00000108, 0x40a50000, 0x00000188, \
+   /*  220 */ 0x48a50000, 0x0000010c, 0x40a50000, 0x0000018c, \
+   /*  224 */ 0x48a50000, 0x00000110, 0x40a50000, 0x00000190, \
+   /*  228 */ 0x48a50000, 0x00000114, 0x40a50000, 0x00000194, \
+   /*  232 */ 0x48a50000, 0x00000118, 0x40a50000, 0x00000198, \
+   /*  236 */ 0x48a50000, 0x0000011c, 0x40a50000, 0x0000019c, \
+   /*  240 */ 0x48a50000, 0x00000120, 0x40a50000, 0x000001a0, \
+   /*  244 */ 0x48a50000, 0x00000124, 0x40a50000, 0x000001a4, \
+   /*  248 */ 0x48a50000, 0x00000128, 0x40a50000, 0x000001a8, \
+   /*  252 */ 0x48a50000, 0x0000012c, 0x40a50000, 0x000001ac, \
+   /*  256 */ 0x48a50000, 0x00000130, 0x40a50000, 0x000001b0, \
+   /*  260 */ 0x48a50000, 0x00000134, 0x40a50000, 0x000001b4, \
+   /*  264 */ 0xe0a50000, 0x000001bc, 0x00000020, 0x00000002, \
+   /*  268 */ 0x48a50000, 0x000001c0, 0x40a50000, 0x00000240, \
+   /*  272 */ 0x48a50000, 0x000001c4, 0x40a50000, 0x00000244, \
+   /*  276 */ 0x48a50000, 0x000001c8, 0x40a50000, 0x00000248, \
+   /*  280 */ 0x48a50000, 0x000001cc, 0x40a50000, 0x0000024c, \
+   /*  284 */ 0x48a50000, 0x000001d0, 0x40a50000, 0x00000250, \
+   /*  288 */ 0x48a50000, 0x000001d4, 0x40a50000, 0x00000254, \
+   /*  292 */ 0x48a50000, 0x000001d8, 0x40a50000, 0x00000258, \
+   /*  296 */ 0x48a50000, 0x000001dc, 0x40a50000, 0x0000025c, \
+   /*  300 */ 0x48a50000, 0x000001e0, 0x40a50000, 0x00000260, \
+   /*  304 */ 0x48a50000, 0x000001e4, 0x40a50000, 0x00000264, \
+   /*  308 */ 0x48a50000, 0x000001e8, 0x40a50000, 0x00000268, \
+   /*  312 */ 0x48a50000, 0x000001ec, 0x40a50000, 0x0000026c, \
+   /*  316 */ 0x48a50000, 0x000001f0, 0x40a50000, 0x00000270, \
+   /*  320 */ 0x48a50000, 0x000001f4, 0x40a50000, 0x00000274, \
+   /*  324 */ 0x48a50000, 0x000001f8, 0x40a50000, 0x00000278, \
+   /*  328 */ 0x48a50000, 0x000001fc, 0x40a50000, 0x0000027c, \
+   /*  332 */ 0x48a50000, 0x00000200, 0x40a50000, 0x00000280, \
+   /*  336 */ 0x48a50000, 0x00000204, 0x40a50000, 0x00000284, \
+   /*  340 */ 0x48a50000, 0x00000208, 0x40a50000, 0x00000288, \
+   /*  344 */ 0x48a50000, 0x0000020c, 0x40a50000, 0x0000028c, \
+   /*  348 */ 0x48a50000, 0x00000210, 0x40a50000, 0x00000290, \
+   /*  352 */ 0x48a50000, 0x00000214, 0x40a50000, 0x00000294, \
+   /*  356 */ 0x48a50000, 0x00000218, 0x40a50000, 0x00000298, \
+   /*  360 */ 0x48a50000, 0x0000021c, 0x40a50000, 0x0000029c, \
+   /*  364 */ 0x48a50000, 0x00000220, 0x40a50000, 0x000002a0, \
+   /*  368 */ 0x48a50000, 0x00000224, 0x40a50000, 0x000002a4, \
+   /*  372 */ 0x48a50000, 0x00000228, 0x40a50000, 0x000002a8, \
+   /*  376 */ 0x48a50000, 0x0000022c, 0x40a50000, 0x000002ac, \
+   /*  380 */ 0x48a50000, 0x00000230, 0x40a50000, 0x000002b0, \
+   /*  384 */ 0x48a50000, 0x00000234, 0x40a50000, 0x000002b4, \
+   /*  388 */ 0x48a50000, 0x00000238, 0x40a50000, 0x000002b8, \
+   /*  392 */ 0x48a50000, 0x0000023c, 0x40a50000, 0x000002bc, \
+   /*  396 */ 0xd0a50000, 0x000002c4, 0x00000020, 0x00000002, \
+   /*  400 */ 0x48a50000, 0x000002c8, 0x44a50000, 0x00000348, \
+   /*  404 */ 0x48a50000, 0x000002cc, 0x44a50000, 0x0000034c, \
+   /*  408 */ 0x48a50000, 0x000002d0, 0x44a50000, 0x00000350, \
+   /*  412 */ 0x48a50000, 0x000002d4, 0x44a50000, 0x00000354, \
+   /*  416 */ 0x48a50000, 0x000002d8, 0x44a50000, 0x00000358, \
+   /*  420 */ 0x48a50000, 0x000002dc, 0x44a50000, 0x0000035c, \
+   /*  424 */ 0x48a50000, 0x000002e0, 0x44a50000, 0x00000360, \
+   /*  428 */ 0x48a50000, 0x000002e4, 0x44a50000, 0x00000364, \
+   /*  432 */ 0x48a50000, 0x000002e8, 0x44a50000, 0x00000368, \
+   /*  436 */ 0x48a50000, 0x000002ec, 0x44a50000, 0x0000036c, \
+   /*  440 */ 0x48a50000, 0x000002f0, 0x44a50000, 0x00000370, \
+   /*  444 */ 0x48a50000, 0x000002f4, 0x44a50000, 0x00000374, \
+   /*  448 */ 0x48a50000, 0x000002f8, 0x44a50000, 0x00000378, \
+   /*  452 */ 0x48a50000, 0x000002fc, 0x44a50000, 0x0000037c, \
+   /*  456 */ 0x48a50000, 0x00000300, 0x44a50000, 0x00000380, \
+   /*  460 */ 0x48a50000, 0x00000304, 0x44a50000, 0x00000384, \
+   /*  464 */ 0x48a50000, 0x00000308, 0x44a50000, 0x00000388, \
+   /*  468 */ 0x48a50000, 0x0000030c, 0x44a50000, 0x0000038c, \
+   /*  472 */ 0x48a50000, 0x00000310, 0x44a50000, 0x00000390, \
+   /*  476 */ 0x48a50000, 0x00000314, 0x44a50000, 0x00000394, \
+   /*  480 */ 0x48a50000, 0x00000318, 0x44a50000, 0x00000398, \
+   /*  484 */ 0x48a50000, 0x0000031c, 0x44a50000, 0x0000039c, \
+   /*  488 */ 0x48a50000, 0x00000320, 0x44a50000, 0x000003a0, \
+   /*  492 */ 0x48a50000, 0x00000324, 0x44a50000, 0x000003a4, \
+   /*  496 */ 0x48a50000, 0x00000328, 0x44a50000, 0x000003a8, \
+   /*  500 */ 0x48a50000, 0x0000032c, 0x44a50000, 0x000003ac, \
+   /*  504 */ 0x48a50000, 0x00000330, 0x44a50000, 0x000003b0, \
+   /*  508 */ 0x48a50000, 0x00000334, 0x44a50000, 0x000003b4, \
+   /*  512 */ 0x48a50000, 0x00000338, 0x44a50000, 0x000003b8, \
+   /*  516 */ 0x48a50000, 0x0000033c, 0x44a50000, 0x000003bc, \
+   /*  520 */ 0x48a50000, 0x00000340, 0x44a50000, 0x000003c0, \
+   /*  524 */ 0x48a50000, 0x00000344, 0x44a50000, 0x000003c4, \
+   /*  528 */ 0xc0a50000, 0x000003c8, 0x00001000, 0x00000001, \
+   /*  532 */ 0x40a50000, 0x000003cc, 0x40a50000, 0x000003d0, \
+   /*  536 */ 0x40a50000, 0x000003d4, 0x40a50000, 0x000003d8, \
+   /*  540 */ 0x40a50000, 0x000003dc, 0x40a50000, 0x000003e0, \
+   /*  544 */ 0x40a50000, 0x000003e4, 0x40a50000, 0x000003e8, \
+   /*  548 */ 0x40a50000, 0x000003ec, 0x40a50000, 0x000003f0, \
+   /*  552 */ 0x40a50000, 0x000003f4, 0x40a50000, 0x000003f8, \
+   /*  556 */ 0x40a50000, 0x000003fc, 0x40a50000, 0x00000400, \
+   /*  560 */ 0x40a50000, 0x00000404, 0x40a50000, 0x00000408, \
+   /*  564 */ 0x40a50000, 0x0000040c, 0x40a50000, 0x00000410, \
+   /*  568 */ 0x40a50000, 0x00000414, 0x40a50000, 0x00000418, \
+   /*  572 */ 0x40a50000, 0x0000041c, 0x40a50000, 0x00000420, \
+   /*  576 */ 0x40a50000, 0x00000424, 0x40a50000, 0x00000428, \
+   /*  580 */ 0x40a50000, 0x0000042c, 0x40a50000, 0x00000430, \
+   /*  584 */ 0x40a50000, 0x00000434, 0x40a50000, 0x00000438, \
+   /*  588 */ 0x40a50000, 0x0000043c, 0x40a50000, 0x00000440, \
+   /*  592 */ 0x40a50000, 0x00000444, 0x40a50000, 0x00000448, \
+   /*  596 */ 0x40a50000, 0x0000044c, 0x40a50000, 0x00000450, \
+   /*  600 */ 0x40a50000, 0x00000454, 0x40a50000, 0x00000458, \
+   /*  604 */ 0x40a50000, 0x0000045c, 0x40a50000, 0x00000460, \
+   /*  608 */ 0x40a50000, 0x00000464, 0x40a50000, 0x00000468, \
+   /*  612 */ 0x40a50000, 0x0000046c, 0x40a50000, 0x00000470, \
+   /*  616 */ 0x40a50000, 0x00000474, 0x40a50000, 0x00000478, \
+   /*  620 */ 0x40a50000, 0x0000047c, 0x40a50000, 0x00000480, \
+   /*  624 */ 0x40a50000, 0x00000484, 0x40a50000, 0x00000488, \
+   /*  628 */ 0x40a50000, 0x0000048c, 0x40a50000, 0x00000490, \
+   /*  632 */ 0x40a50000, 0x00000494, 0x40a50000, 0x00000498, \
+   /*  636 */ 0x40a50000, 0x0000049c, 0x40a50000, 0x000004a0, \
+   /*  640 */ 0x40a50000, 0x000004a4, 0x40a50000, 0x000004a8, \
+   /*  644 */ 0x40a50000, 0x000004ac, 0x40a50000, 0x000004b0, \
+   /*  648 */ 0x40a50000, 0x000004b4, 0x40a50000, 0x000004b8, \
+   /*  652 */ 0x40a50000, 0x000004bc, 0x40a50000, 0x000004c0, \
+   /*  656 */ 0x40a50000, 0x000004c4, 0x40a50000, 0x000004c8, \
+   /*  660 */ 0x40a50000, 0x000004cc, 0x40a50000, 0x000004d0, \
+   /*  664 */ 0x40a50000, 0x000004d4, 0x40a50000, 0x000004d8, \
+   /*  668 */ 0x40a50000, 0x000004dc, 0x40a50000, 0x000004e0, \
+   /*  672 */ 0x40a50000, 0x000004e4, 0x40a50000, 0x000004e8, \
+   /*  676 */ 0x40a50000, 0x000004ec, 0x40a50000, 0x000004f0, \
+   /*  680 */ 0x40a50000, 0x000004f4, 0x40a50000, 0x000004f8, \
+   /*  684 */ 0x40a50000, 0x000004fc, 0x40a50000, 0x00000500, \
+   /*  688 */ 0x40a50000, 0x00000504, 0x40a50000, 0x00000508, \
+   /*  692 */ 0x40a50000, 0x0000050c, 0x40a50000, 0x00000510, \
+   /*  696 */ 0x40a50000, 0x00000514, 0x40a50000, 0x00000518, \
+   /*  700 */ 0x40a50000, 0x0000051c, 0x40a50000, 0x00000520, \
+   /*  704 */ 0x40a50000, 0x00000524, 0x40a50000, 0x00000528, \
+   /*  708 */ 0x40a50000, 0x0000052c, 0x40a50000, 0x00000530, \
+   /*  712 */ 0x40a50000, 0x00000534, 0x40a50000, 0x00000538, \
+   /*  716 */ 0x40a50000, 0x0000053c, 0x40a50000, 0x00000540, \
+   /*  720 */ 0x40a50000, 0x00000544, 0x40a50000, 0x00000548, \
+   /*  724 */ 0x40a50000, 0x0000054c, 0x40a50000, 0x00000550, \
+   /*  728 */ 0x40a50000, 0x00000554, 0x40a50000, 0x00000558, \
+   /*  732 */ 0x40a50000, 0x0000055c, 0x40a50000, 0x00000560, \
+   /*  736 */ 0x40a50000, 0x00000564, 0x40a50000, 0x00000568, \
+   /*  740 */ 0x40a50000, 0x0000056c, 0x40a50000, 0x00000570, \
+   /*  744 */ 0x40a50000, 0x00000574, 0x40a50000, 0x00000578, \
+   /*  748 */ 0x40a50000, 0x0000057c, 0x40a50000, 0x00000580, \
+   /*  752 */ 0x40a50000, 0x00000584, 0x40a50000, 0x00000588, \
+   /*  756 */ 0x40a50000, 0x0000058c, 0x40a50000, 0x00000590, \
+   /*  760 */ 0x40a50000, 0x00000594, 0x40a50000, 0x00000598, \
+   /*  764 */ 0x40a50000, 0x0000059c, 0x40a50000, 0x000005a0, \
+   /*  768 */ 0x40a50000, 0x000005a4, 0x40a50000, 0x000005a8, \
+   /*  772 */ 0x40a50000, 0x000005ac, 0x40a50000, 0x000005b0, \
+   /*  776 */ 0x40a50000, 0x000005b4, 0x40a50000, 0x000005b8, \
+   /*  780 */ 0x40a50000, 0x000005bc, 0x40a50000, 0x000005c0, \
+   /*  784 */ 0x40a50000, 0x000005c4, 0x40a50000, 0x000005c8, \
+   /*  788 */ 0x40a50000, 0x000005cc, 0x40a50000, 0x000005d0, \
+   /*  792 */ 0x40a50000, 0x000005d4, 0x40a50000, 0x000005d8, \
+   /*  796 */ 0x40a50000, 0x000005dc, 0x40a50000, 0x000005e0, \
+   /*  800 */ 0x40a50000, 0x000005e4, 0x40a50000, 0x000005e8, \
+   /*  804 */ 0x40a50000, 0x000005ec, 0x40a50000, 0x000005f0, \
+   /*  808 */ 0x40a50000, 0x000005f4, 0x40a50000, 0x000005f8, \
+   /*  812 */ 0x40a50000, 0x000005fc, 0x40a50000, 0x00000600, \
+   /*  816 */ 0x40a50000, 0x00000604, 0x40a50000, 0x00000608, \
+   /*  820 */ 0x40a50000, 0x0000060c, 0x40a50000, 0x00000610, \
+   /*  824 */ 0x40a50000, 0x00000614, 0x40a50000, 0x00000618, \
+   /*  828 */ 0x40a50000, 0x0000061c, 0x40a50000, 0x00000620, \
+   /*  832 */ 0x40a50000, 0x00000624, 0x40a50000, 0x00000628, \
+   /*  836 */ 0x40a50000, 0x0000062c, 0x40a50000, 0x00000630, \
+   /*  840 */ 0x40a50000, 0x00000634, 0x40a50000, 0x00000638, \
+   /*  844 */ 0x40a50000, 0x0000063c, 0x40a50000, 0x00000640, \
+   /*  848 */ 0x40a50000, 0x00000644, 0x40a50000, 0x00000648, \
+   /*  852 */ 0x40a50000, 0x0000064c, 0x40a50000, 0x00000650, \
+   /*  856 */ 0x40a50000, 0x00000654, 0x40a50000, 0x00000658, \
+   /*  860 */ 0x40a50000, 0x0000065c, 0x40a50000, 0x00000660, \
+   /*  864 */ 0x40a50000, 0x00000664, 0x40a50000, 0x00000668, \
+   /*  868 */ 0x40a50000, 0x0000066c, 0x40a50000, 0x00000670, \
+   /*  872 */ 0x40a50000, 0x00000674, 0x40a50000, 0x00000678, \
+   /*  876 */ 0x40a50000, 0x0000067c, 0x40a50000, 0x00000680, \
+   /*  880 */ 0x40a50000, 0x00000684, 0x40a50000, 0x00000688, \
+   /*  884 */ 0x40a50000, 0x0000068c, 0x40a50000, 0x00000690, \
+   /*  888 */ 0x40a50000, 0x00000694, 0x40a50000, 0x00000698, \
+   /*  892 */ 0x40a50000, 0x0000069c, 0x40a50000, 0x000006a0, \
+   /*  896 */ 0x40a50000, 0x000006a4, 0x40a50000, 0x000006a8, \
+   /*  900 */ 0x40a50000, 0x000006ac, 0x40a50000, 0x000006b0, \
+   /*  904 */ 0x40a50000, 0x000006b4, 0x40a50000, 0x000006b8, \
+   /*  908 */ 0x40a50000, 0x000006bc, 0x40a50000, 0x000006c0, \
+   /*  912 */ 0x40a50000, 0x000006c4, 0x40a50000, 0x000006c8, \
+   /*  916 */ 0x40a50000, 0x000006cc, 0x40a50000, 0x000006d0, \
+   /*  920 */ 0x40a50000, 0x000006d4, 0x40a50000, 0x000006d8, \
+   /*  924 */ 0x40a50000, 0x000006dc, 0x40a50000, 0x000006e0, \
+   /*  928 */ 0x40a50000, 0x000006e4, 0x40a50000, 0x000006e8, \
+   /*  932 */ 0x40a50000, 0x000006ec, 0x40a50000, 0x000006f0, \
+   /*  936 */ 0x40a50000, 0x000006f4, 0x40a50000, 0x000006f8, \
+   /*  940 */ 0x40a50000, 0x000006fc, 0x40a50000, 0x00000700, \
+   /*  944 */ 0x40a50000, 0x00000704, 0x40a50000, 0x00000708, \
+   /*  948 */ 0x40a50000, 0x0000070c, 0x40a50000, 0x00000710, \
+   /*  952 */ 0x40a50000, 0x00000714, 0x40a50000, 0x00000718, \
+   /*  956 */ 0x40a50000, 0x0000071c, 0x40a50000, 0x00000720, \
+   /*  960 */ 0x40a50000, 0x00000724, 0x40a50000, 0x00000728, \
+   /*  964 */ 0x40a50000, 0x0000072c, 0x40a50000, 0x00000730, \
+   /*  968 */ 0x40a50000, 0x00000734, 0x40a50000, 0x00000738, \
+   /*  972 */ 0x40a50000, 0x0000073c, 0x40a50000, 0x00000740, \
+   /*  976 */ 0x40a50000, 0x00000744, 0x40a50000, 0x00000748, \
+   /*  980 */ 0x40a50000, 0x0000074c, 0x40a50000, 0x00000750, \
+   /*  984 */ 0x40a50000, 0x00000754, 0x40a50000, 0x00000758, \
+   /*  988 */ 0x40a50000, 0x0000075c, 0x40a50000, 0x00000760, \
+   /*  992 */ 0x40a50000, 0x00000764, 0x40a50000, 0x00000768, \
+   /*  996 */ 0x40a50000, 0x0000076c, 0x40a50000, 0x00000770, \
+   /* 1000 */ 0x40a50000, 0x00000774, 0x40a50000, 0x00000778, \
+   /* 1004 */ 0x40a50000, 0x0000077c, 0x40a50000, 0x00000780, \
+   /* 1008 */ 0x40a50000, 0x00000784, 0x40a50000, 0x00000788, \
+   /* 1012 */ 0x40a50000, 0x0000078c, 0x40a50000, 0x00000790, \
+   /* 1016 */ 0x40a50000, 0x00000794, 0x40a50000, 0x00000798, \
+   /* 1020 */ 0x40a50000, 0x0000079c, 0x40a50000, 0x000007a0, \
+   /* 1024 */ 0x40a50000, 0x000007a4, 0x40a50000, 0x000007a8, \
+   /* 1028 */ 0x40a50000, 0x000007ac, 0x40a50000, 0x000007b0, \
+   /* 1032 */ 0x40a50000, 0x000007b4, 0x40a50000, 0x000007b8, \
+   /* 1036 */ 0x40a50000, 0x000007bc, 0x40a50000, 0x000007c0, \
+   /* 1040 */ 0x40a50000, 0x000007c4, 0x40a50000, 0x000007c8, \
+   /* 1044 */ 0x40a50000, 0x000007cc, 0x40a50000, 0x000007d0, \
+   /* 1048 */ 0x40a50000, 0x000007d4, 0x40a50000, 0x000007d8, \
+   /* 1052 */ 0x40a50000, 0x000007dc, 0x40a50000, 0x000007e0, \
+   /* 1056 */ 0x40a50000, 0x000007e4, 0x40a50000, 0x000007e8, \
+   /* 1060 */ 0x40a50000, 0x000007ec, 0x40a50000, 0x000007f0, \
+   /* 1064 */ 0x40a50000, 0x000007f4, 0x40a50000, 0x000007f8, \
+   /* 1068 */ 0x40a50000, 0x000007fc, 0x40a50000, 0x00000800, \
+   /* 1072 */ 0x40a50000, 0x00000804, 0x40a50000, 0x00000808, \
+   /* 1076 */ 0x40a50000, 0x0000080c, 0x40a50000, 0x00000810, \
+   /* 1080 */ 0x40a50000, 0x00000814, 0x40a50000, 0x00000818, \
+   /* 1084 */ 0x40a50000, 0x0000081c, 0x40a50000, 0x00000820, \
+   /* 1088 */ 0x40a50000, 0x00000824, 0x40a50000, 0x00000828, \
+   /* 1092 */ 0x40a50000, 0x0000082c, 0x40a50000, 0x00000830, \
+   /* 1096 */ 0x40a50000, 0x00000834, 0x40a50000, 0x00000838, \
+   /* 1100 */ 0x40a50000, 0x0000083c, 0x40a50000, 0x00000840, \
+   /* 1104 */ 0x40a50000, 0x00000844, 0x40a50000, 0x00000848, \
+   /* 1108 */ 0x40a50000, 0x0000084c, 0x40a50000, 0x00000850, \
+   /* 1112 */ 0x40a50000, 0x00000854, 0x40a50000, 0x00000858, \
+   /* 1116 */ 0x40a50000, 0x0000085c, 0x40a50000, 0x00000860, \
+   /* 1120 */ 0x40a50000, 0x00000864, 0x40a50000, 0x00000868, \
+   /* 1124 */ 0x40a50000, 0x0000086c, 0x40a50000, 0x00000870, \
+   /* 1128 */ 0x40a50000, 0x00000874, 0x40a50000, 0x00000878, \
+   /* 1132 */ 0x40a50000, 0x0000087c, 0x40a50000, 0x00000880, \
+   /* 1136 */ 0x40a50000, 0x00000884, 0x40a50000, 0x00000888, \
+   /* 1140 */ 0x40a50000, 0x0000088c, 0x40a50000, 0x00000890, \
+   /* 1144 */ 0x40a50000, 0x00000894, 0x40a50000, 0x00000898, \
+   /* 1148 */ 0x40a50000, 0x0000089c, 0x40a50000, 0x000008a0, \
+   /* 1152 */ 0x40a50000, 0x000008a4, 0x40a50000, 0x000008a8, \
+   /* 1156 */ 0x40a50000, 0x000008ac, 0x40a50000, 0x000008b0, \
+   /* 1160 */ 0x40a50000, 0x000008b4, 0x40a50000, 0x000008b8, \
+   /* 1164 */ 0x40a50000, 0x000008bc, 0x40a50000, 0x000008c0, \
+   /* 1168 */ 0x40a50000, 0x000008c4, 0x40a50000, 0x000008c8, \
+   /* 1172 */ 0x40a50000, 0x000008cc, 0x40a50000, 0x000008d0, \
+   /* 1176 */ 0x40a50000, 0x000008d4, 0x40a50000, 0x000008d8, \
+   /* 1180 */ 0x40a50000, 0x000008dc, 0x40a50000, 0x000008e0, \
+   /* 1184 */ 0x40a50000, 0x000008e4, 0x40a50000, 0x000008e8, \
+   /* 1188 */ 0x40a50000, 0x000008ec, 0x40a50000, 0x000008f0, \
+   /* 1192 */ 0x40a50000, 0x000008f4, 0x40a50000, 0x000008f8, \
+   /* 1196 */ 0x40a50000, 0x000008fc, 0x40a50000, 0x00000900, \
+   /* 1200 */ 0x40a50000, 0x00000904, 0x40a50000, 0x00000908, \
+   /* 1204 */ 0x40a50000, 0x0000090c, 0x40a50000, 0x00000910, \
+   /* 1208 */ 0x40a50000, 0x00000914, 0x40a50000, 0x00000918, \
+   /* 1212 */ 0x40a50000, 0x0000091c, 0x40a50000, 0x00000920, \
+   /* 1216 */ 0x40a50000, 0x00000924, 0x40a50000, 0x00000928, \
+   /* 1220 */ 0x40a50000, 0x0000092c, 0x40a50000, 0x00000930, \
+   /* 1224 */ 0x40a50000, 0x00000934, 0x40a50000, 0x00000938, \
+   /* 1228 */ 0x40a50000, 0x0000093c, 0x40a50000, 0x00000940, \
+   /* 1232 */ 0x40a50000, 0x00000944, 0x40a50000, 0x00000948, \
+   /* 1236 */ 0x40a50000, 0x0000094c, 0x40a50000, 0x00000950, \
+   /* 1240 */ 0x40a50000, 0x00000954, 0x40a50000, 0x00000958, \
+   /* 1244 */ 0x40a50000, 0x0000095c, 0x40a50000, 0x00000960, \
+   /* 1248 */ 0x40a50000, 0x00000964, 0x40a50000, 0x00000968, \
+   /* 1252 */ 0x40a50000, 0x0000096c, 0x40a50000, 0x00000970, \
+   /* 1256 */ 0x40a50000, 0x00000974, 0x40a50000, 0x00000978, \
+   /* 1260 */ 0x40a50000, 0x0000097c, 0x40a50000, 0x00000980, \
+   /* 1264 */ 0x40a50000, 0x00000984, 0x40a50000, 0x00000988, \
+   /* 1268 */ 0x40a50000, 0x0000098c, 0x40a50000, 0x00000990, \
+   /* 1272 */ 0x40a50000, 0x00000994, 0x40a50000, 0x00000998, \
+   /* 1276 */ 0x40a50000, 0x0000099c, 0x40a50000, 0x000009a0, \
+   /* 1280 */ 0x40a50000, 0x000009a4, 0x40a50000, 0x000009a8, \
+   /* 1284 */ 0x40a50000, 0x000009ac, 0x40a50000, 0x000009b0, \
+   /* 1288 */ 0x40a50000, 0x000009b4, 0x40a50000, 0x000009b8, \
+   /* 1292 */ 0x40a50000, 0x000009bc, 0x40a50000, 0x000009c0, \
+   /* 1296 */ 0x40a50000, 0x000009c4, 0x40a50000, 0x000009c8, \
+   /* 1300 */ 0x40a50000, 0x000009cc, 0x40a50000, 0x000009d0, \
+   /* 1304 */ 0x40a50000, 0x000009d4, 0x40a50000, 0x000009d8, \
+   /* 1308 */ 0x40a50000, 0x000009dc, 0x40a50000, 0x000009e0, \
+   /* 1312 */ 0x40a50000, 0x000009e4, 0x40a50000, 0x000009e8, \
+   /* 1316 */ 0x40a50000, 0x000009ec, 0x40a50000, 0x000009f0, \
+   /* 1320 */ 0x40a50000, 0x000009f4, 0x40a50000, 0x000009f8, \
+   /* 1324 */ 0x40a50000, 0x000009fc, 0x40a50000, 0x00000a00, \
+   /* 1328 */ 0x40a50000, 0x00000a04, 0x40a50000, 0x00000a08, \
+   /* 1332 */ 0x40a50000, 0x00000a0c, 0x40a50000, 0x00000a10, \
+   /* 1336 */ 0x40a50000, 0x00000a14, 0x40a50000, 0x00000a18, \
+   /* 1340 */ 0x40a50000, 0x00000a1c, 0x40a50000, 0x00000a20, \
+   /* 1344 */ 0x40a50000, 0x00000a24, 0x40a50000, 0x00000a28, \
+   /* 1348 */ 0x40a50000, 0x00000a2c, 0x40a50000, 0x00000a30, \
+   /* 1352 */ 0x40a50000, 0x00000a34, 0x40a50000, 0x00000a38, \
+   /* 1356 */ 0x40a50000, 0x00000a3c, 0x40a50000, 0x00000a40, \
+   /* 1360 */ 0x40a50000, 0x00000a44, 0x40a50000, 0x00000a48, \
+   /* 1364 */ 0x40a50000, 0x00000a4c, 0x40a50000, 0x00000a50, \
+   /* 1368 */ 0x40a50000, 0x00000a54, 0x40a50000, 0x00000a58, \
+   /* 1372 */ 0x40a50000, 0x00000a5c, 0x40a50000, 0x00000a60, \
+   /* 1376 */ 0x40a50000, 0x00000a64, 0x40a50000, 0x00000a68, \
+   /* 1380 */ 0x40a50000, 0x00000a6c, 0x40a50000, 0x00000a70, \
+   /* 1384 */ 0x40a50000, 0x00000a74, 0x40a50000, 0x00000a78, \
+   /* 1388 */ 0x40a50000, 0x00000a7c, 0x40a50000, 0x00000a80, \
+   /* 1392 */ 0x40a50000, 0x00000a84, 0x40a50000, 0x00000a88, \
+   /* 1396 */ 0x40a50000, 0x00000a8c, 0x40a50000, 0x00000a90, \
+   /* 1400 */ 0x40a50000, 0x00000a94, 0x40a50000, 0x00000a98, \
+   /* 1404 */ 0x40a50000, 0x00000a9c, 0x40a50000, 0x00000aa0, \
+   /* 1408 */ 0x40a50000, 0x00000aa4, 0x40a50000, 0x00000aa8, \
+   /* 1412 */ 0x40a50000, 0x00000aac, 0x40a50000, 0x00000ab0, \
+   /* 1416 */ 0x40a50000, 0x00000ab4, 0x40a50000, 0x00000ab8, \
+   /* 1420 */ 0x40a50000, 0x00000abc, 0x40a50000, 0x00000ac0, \
+   /* 1424 */ 0x40a50000, 0x00000ac4, 0x40a50000, 0x00000ac8, \
+   /* 1428 */ 0x40a50000, 0x00000acc, 0x40a50000, 0x00000ad0, \
+   /* 1432 */ 0x40a50000, 0x00000ad4, 0x40a50000, 0x00000ad8, \
+   /* 1436 */ 0x40a50000, 0x00000adc, 0x40a50000, 0x00000ae0, \
+   /* 1440 */ 0x40a50000, 0x00000ae4, 0x40a50000, 0x00000ae8, \
+   /* 1444 */ 0x40a50000, 0x00000aec, 0x40a50000, 0x00000af0, \
+   /* 1448 */ 0x40a50000, 0x00000af4, 0x40a50000, 0x00000af8, \
+   /* 1452 */ 0x40a50000, 0x00000afc, 0x40a50000, 0x00000b00, \
+   /* 1456 */ 0x40a50000, 0x00000b04, 0x40a50000, 0x00000b08, \
+   /* 1460 */ 0x40a50000, 0x00000b0c, 0x40a50000, 0x00000b10, \
+   /* 1464 */ 0x40a50000, 0x00000b14, 0x40a50000, 0x00000b18, \
+   /* 1468 */ 0x40a50000, 0x00000b1c, 0x40a50000, 0x00000b20, \
+   /* 1472 */ 0x40a50000, 0x00000b24, 0x40a50000, 0x00000b28, \
+   /* 1476 */ 0x40a50000, 0x00000b2c, 0x40a50000, 0x00000b30, \
+   /* 1480 */ 0x40a50000, 0x00000b34, 0x40a50000, 0x00000b38, \
+   /* 1484 */ 0x40a50000, 0x00000b3c, 0x40a50000, 0x00000b40, \
+   /* 1488 */ 0x40a50000, 0x00000b44, 0x40a50000, 0x00000b48, \
+   /* 1492 */ 0x40a50000, 0x00000b4c, 0x40a50000, 0x00000b50, \
+   /* 1496 */ 0x40a50000, 0x00000b54, 0x40a50000, 0x00000b58, \
+   /* 1500 */ 0x40a50000, 0x00000b5c, 0x40a50000, 0x00000b60, \
+   /* 1504 */ 0x40a50000, 0x00000b64, 0x40a50000, 0x00000b68, \
+   /* 1508 */ 0x40a50000, 0x00000b6c, 0x40a50000, 0x00000b70, \
+   /* 1512 */ 0x40a50000, 0x00000b74, 0x40a50000, 0x00000b78, \
+   /* 1516 */ 0x40a50000, 0x00000b7c, 0x40a50000, 0x00000b80, \
+   /* 1520 */ 0x40a50000, 0x00000b84, 0x40a50000, 0x00000b88, \
+   /* 1524 */ 0x40a50000, 0x00000b8c, 0x40a50000, 0x00000b90, \
+   /* 1528 */ 0x40a50000, 0x00000b94, 0x40a50000, 0x00000b98, \
+   /* 1532 */ 0x40a50000, 0x00000b9c, 0x40a50000, 0x00000ba0, \
+   /* 1536 */ 0x40a50000, 0x00000ba4, 0x40a50000, 0x00000ba8, \
+   /* 1540 */ 0x40a50000, 0x00000bac, 0x40a50000, 0x00000bb0, \
+   /* 1544 */ 0x40a50000, 0x00000bb4, 0x40a50000, 0x00000bb8, \
+   /* 1548 */ 0x40a50000, 0x00000bbc, 0x40a50000, 0x00000bc0, \
+   /* 1552 */ 0x40a50000, 0x00000bc4, 0x40a50000, 0x00000bc8, \
+   /* 1556 */ 0x40a50000, 0x00000bcc, 0x40a50000, 0x00000bd0, \
+   /* 1560 */ 0x40a50000, 0x00000bd4, 0x40a50000, 0x00000bd8, \
+   /* 1564 */ 0x40a50000, 0x00000bdc, 0x40a50000, 0x00000be0, \
+   /* 1568 */ 0x40a50000, 0x00000be4, 0x40a50000, 0x00000be8, \
+   /* 1572 */ 0x40a50000, 0x00000bec, 0x40a50000, 0x00000bf0, \
+   /* 1576 */ 0x40a50000, 0x00000bf4, 0x40a50000, 0x00000bf8, \
+   /* 1580 */ 0x40a50000, 0x00000bfc, 0x40a50000, 0x00000c00, \
+   /* 1584 */ 0x40a50000, 0x00000c04, 0x40a50000, 0x00000c08, \
+   /* 1588 */ 0x40a50000, 0x00000c0c, 0x40a50000, 0x00000c10, \
+   /* 1592 */ 0x40a50000, 0x00000c14, 0x40a50000, 0x00000c18, \
+   /* 1596 */ 0x40a50000, 0x00000c1c, 0x40a50000, 0x00000c20, \
+   /* 1600 */ 0x40a50000, 0x00000c24, 0x40a50000, 0x00000c28, \
+   /* 1604 */ 0x40a50000, 0x00000c2c, 0x40a50000, 0x00000c30, \
+   /* 1608 */ 0x40a50000, 0x00000c34, 0x40a50000, 0x00000c38, \
+   /* 1612 */ 0x40a50000, 0x00000c3c, 0x40a50000, 0x00000c40, \
+   /* 1616 */ 0x40a50000, 0x00000c44, 0x40a50000, 0x00000c48, \
+   /* 1620 */ 0x40a50000, 0x00000c4c, 0x40a50000, 0x00000c50, \
+   /* 1624 */ 0x40a50000, 0x00000c54, 0x40a50000, 0x00000c58, \
+   /* 1628 */ 0x40a50000, 0x00000c5c, 0x40a50000, 0x00000c60, \
+   /* 1632 */ 0x40a50000, 0x00000c64, 0x40a50000, 0x00000c68, \
+   /* 1636 */ 0x40a50000, 0x00000c6c, 0x40a50000, 0x00000c70, \
+   /* 1640 */ 0x40a50000, 0x00000c74, 0x40a50000, 0x00000c78, \
+   /* 1644 */ 0x40a50000, 0x00000c7c, 0x40a50000, 0x00000c80, \
+   /* 1648 */ 0x40a50000, 0x00000c84, 0x40a50000, 0x00000c88, \
+   /* 1652 */ 0x40a50000, 0x00000c8c, 0x40a50000, 0x00000c90, \
+   /* 1656 */ 0x40a50000, 0x00000c94, 0x40a50000, 0x00000c98, \
+   /* 1660 */ 0x40a50000, 0x00000c9c, 0x40a50000, 0x00000ca0, \
+   /* 1664 */ 0x40a50000, 0x00000ca4, 0x40a50000, 0x00000ca8, \
+   /* 1668 */ 0x40a50000, 0x00000cac, 0x40a50000, 0x00000cb0, \
+   /* 1672 */ 0x40a50000, 0x00000cb4, 0x40a50000, 0x00000cb8, \
+   /* 1676 */ 0x40a50000, 0x00000cbc, 0x40a50000, 0x00000cc0, \
+   /* 1680 */ 0x40a50000, 0x00000cc4, 0x40a50000, 0x00000cc8, \
+   /* 1684 */ 0x40a50000, 0x00000ccc, 0x40a50000, 0x00000cd0, \
+   /* 1688 */ 0x40a50000, 0x00000cd4, 0x40a50000, 0x00000cd8, \
+   /* 1692 */ 0x40a50000, 0x00000cdc, 0x40a50000, 0x00000ce0, \
+   /* 1696 */ 0x40a50000, 0x00000ce4, 0x40a50000, 0x00000ce8, \
+   /* 1700 */ 0x40a50000, 0x00000cec, 0x40a50000, 0x00000cf0, \
+   /* 1704 */ 0x40a50000, 0x00000cf4, 0x40a50000, 0x00000cf8, \
+   /* 1708 */ 0x40a50000, 0x00000cfc, 0x40a50000, 0x00000d00, \
+   /* 1712 */ 0x40a50000, 0x00000d04, 0x40a50000, 0x00000d08, \
+   /* 1716 */ 0x40a50000, 0x00000d0c, 0x40a50000, 0x00000d10, \
+   /* 1720 */ 0x40a50000, 0x00000d14, 0x40a50000, 0x00000d18, \
+   /* 1724 */ 0x40a50000, 0x00000d1c, 0x40a50000, 0x00000d20, \
+   /* 1728 */ 0x40a50000, 0x00000d24, 0x40a50000, 0x00000d28, \
+   /* 1732 */ 0x40a50000, 0x00000d2c, 0x40a50000, 0x00000d30, \
+   /* 1736 */ 0x40a50000, 0x00000d34, 0x40a50000, 0x00000d38, \
+   /* 1740 */ 0x40a50000, 0x00000d3c, 0x40a50000, 0x00000d40, \
+   /* 1744 */ 0x40a50000, 0x00000d44, 0x40a50000, 0x00000d48, \
+   /* 1748 */ 0x40a50000, 0x00000d4c, 0x40a50000, 0x00000d50, \
+   /* 1752 */ 0x40a50000, 0x00000d54, 0x40a50000, 0x00000d58, \
+   /* 1756 */ 0x40a50000, 0x00000d5c, 0x40a50000, 0x00000d60, \
+   /* 1760 */ 0x40a50000, 0x00000d64, 0x40a50000, 0x00000d68, \
+   /* 1764 */ 0x40a50000, 0x00000d6c, 0x40a50000, 0x00000d70, \
+   /* 1768 */ 0x40a50000, 0x00000d74, 0x40a50000, 0x00000d78, \
+   /* 1772 */ 0x40a50000, 0x00000d7c, 0x40a50000, 0x00000d80, \
+   /* 1776 */ 0x40a50000, 0x00000d84, 0x40a50000, 0x00000d88, \
+   /* 1780 */ 0x40a50000, 0x00000d8c, 0x40a50000, 0x00000d90, \
+   /* 1784 */ 0x40a50000, 0x00000d94, 0x40a50000, 0x00000d98, \
+   /* 1788 */ 0x40a50000, 0x00000d9c, 0x40a50000, 0x00000da0, \
+   /* 1792 */ 0x40a50000, 0x00000da4, 0x40a50000, 0x00000da8, \
+   /* 1796 */ 0x40a50000, 0x00000dac, 0x40a50000, 0x00000db0, \
+   /* 1800 */ 0x40a50000, 0x00000db4, 0x40a50000, 0x00000db8, \
+   /* 1804 */ 0x40a50000, 0x00000dbc, 0x40a50000, 0x00000dc0, \
+   /* 1808 */ 0x40a50000, 0x00000dc4, 0x40a50000, 0x00000dc8, \
+   /* 1812 */ 0x40a50000, 0x00000dcc, 0x40a50000, 0x00000dd0, \
+   /* 1816 */ 0x40a50000, 0x00000dd4, 0x40a50000, 0x00000dd8, \
+   /* 1820 */ 0x40a50000, 0x00000ddc, 0x40a50000, 0x00000de0, \
+   /* 1824 */ 0x40a50000, 0x00000de4, 0x40a50000, 0x00000de8, \
+   /* 1828 */ 0x40a50000, 0x00000dec, 0x40a50000, 0x00000df0, \
+   /* 1832 */ 0x40a50000, 0x00000df4, 0x40a50000, 0x00000df8, \
+   /* 1836 */ 0x40a50000, 0x00000dfc, 0x40a50000, 0x00000e00, \
+   /* 1840 */ 0x40a50000, 0x00000e04, 0x40a50000, 0x00000e08, \
+   /* 1844 */ 0x40a50000, 0x00000e0c, 0x40a50000, 0x00000e10, \
+   /* 1848 */ 0x40a50000, 0x00000e14, 0x40a50000, 0x00000e18, \
+   /* 1852 */ 0x40a50000, 0x00000e1c, 0x40a50000, 0x00000e20, \
+   /* 1856 */ 0x40a50000, 0x00000e24, 0x40a50000, 0x00000e28, \
+   /* 1860 */ 0x40a50000, 0x00000e2c, 0x40a50000, 0x00000e30, \
+   /* 1864 */ 0x40a50000, 0x00000e34, 0x40a50000, 0x00000e38, \
+   /* 1868 */ 0x40a50000, 0x00000e3c, 0x40a50000, 0x00000e40, \
+   /* 1872 */ 0x40a50000, 0x00000e44, 0x40a50000, 0x00000e48, \
+   /* 1876 */ 0x40a50000, 0x00000e4c, 0x40a50000, 0x00000e50, \
+   /* 1880 */ 0x40a50000, 0x00000e54, 0x40a50000, 0x00000e58, \
+   /* 1884 */ 0x40a50000, 0x00000e5c, 0x40a50000, 0x00000e60, \
+   /* 1888 */ 0x40a50000, 0x00000e64, 0x40a50000, 0x00000e68, \
+   /* 1892 */ 0x40a50000, 0x00000e6c, 0x40a50000, 0x00000e70, \
+   /* 1896 */ 0x40a50000, 0x00000e74, 0x40a50000, 0x00000e78, \
+   /* 1900 */ 0x40a50000, 0x00000e7c, 0x40a50000, 0x00000e80, \
+   /* 1904 */ 0x40a50000, 0x00000e84, 0x40a50000, 0x00000e88, \
+   /* 1908 */ 0x40a50000, 0x00000e8c, 0x40a50000, 0x00000e90, \
+   /* 1912 */ 0x40a50000, 0x00000e94, 0x40a50000, 0x00000e98, \
+   /* 1916 */ 0x40a50000, 0x00000e9c, 0x40a50000, 0x00000ea0, \
+   /* 1920 */ 0x40a50000, 0x00000ea4, 0x40a50000, 0x00000ea8, \
+   /* 1924 */ 0x40a50000, 0x00000eac, 0x40a50000, 0x00000eb0, \
+   /* 1928 */ 0x40a50000, 0x00000eb4, 0x40a50000, 0x00000eb8, \
+   /* 1932 */ 0x40a50000, 0x00000ebc, 0x40a50000, 0x00000ec0, \
+   /* 1936 */ 0x40a50000, 0x00000ec4, 0x40a50000, 0x00000ec8, \
+   /* 1940 */ 0x40a50000, 0x00000ecc, 0x40a50000, 0x00000ed0, \
+   /* 1944 */ 0x40a50000, 0x00000ed4, 0x40a50000, 0x00000ed8, \
+   /* 1948 */ 0x40a50000, 0x00000edc, 0x40a50000, 0x00000ee0, \
+   /* 1952 */ 0x40a50000, 0x00000ee4, 0x40a50000, 0x00000ee8, \
+   /* 1956 */ 0x40a50000, 0x00000eec, 0x40a50000, 0x00000ef0, \
+   /* 1960 */ 0x40a50000, 0x00000ef4, 0x40a50000, 0x00000ef8, \
+   /* 1964 */ 0x40a50000, 0x00000efc, 0x40a50000, 0x00000f00, \
+   /* 1968 */ 0x40a50000, 0x00000f04, 0x40a50000, 0x00000f08, \
+   /* 1972 */ 0x40a50000, 0x00000f0c, 0x40a50000, 0x00000f10, \
+   /* 1976 */ 0x40a50000, 0x00000f14, 0x40a50000, 0x00000f18, \
+   /* 1980 */ 0x40a50000, 0x00000f1c, 0x40a50000, 0x00000f20, \
+   /* 1984 */ 0x40a50000, 0x00000f24, 0x40a50000, 0x00000f28, \
+   /* 1988 */ 0x40a50000, 0x00000f2c, 0x40a50000, 0x00000f30, \
+   /* 1992 */ 0x40a50000, 0x00000f34, 0x40a50000, 0x00000f38, \
+   /* 1996 */ 0x40a50000, 0x00000f3c, 0x40a50000, 0x00000f40, \
+   /* 2000 */ 0x40a50000, 0x00000f44, 0x40a50000, 0x00000f48, \
+   /* 2004 */ 0x40a50000, 0x00000f4c, 0x40a50000, 0x00000f50, \
+   /* 2008 */ 0x40a50000, 0x00000f54, 0x40a50000, 0x00000f58, \
+   /* 2012 */ 0x40a50000, 0x00000f5c, 0x40a50000, 0x00000f60, \
+   /* 2016 */ 0x40a50000, 0x00000f64, 0x40a50000, 0x00000f68, \
+   /* 2020 */ 0x40a50000, 0x00000f6c, 0x40a50000, 0x00000f70, \
+   /* 2024 */ 0x40a50000, 0x00000f74, 0x40a50000, 0x00000f78, \
+   /* 2028 */ 0x40a50000, 0x00000f7c, 0x40a50000, 0x00000f80, \
+   /* 2032 */ 0x40a50000, 0x00000f84, 0x40a50000, 0x00000f88, \
+   /* 2036 */ 0x40a50000, 0x00000f8c, 0x40a50000, 0x00000f90, \
+   /* 2040 */ 0x40a50000, 0x00000f94, 0x40a50000, 0x00000f98, \
+   /* 2044 */ 0x40a50000, 0x00000f9c, 0x40a50000, 0x00000fa0, \
+   /* 2048 */ 0x40a50000, 0x00000fa4, 0x40a50000, 0x00000fa8, \
+   /* 2052 */ 0x40a50000, 0x00000fac, 0x40a50000, 0x00000fb0, \
+   /* 2056 */ 0x40a50000, 0x00000fb4, 0x40a50000, 0x00000fb8, \
+   /* 2060 */ 0x40a50000, 0x00000fbc, 0x40a50000, 0x00000fc0, \
+   /* 2064 */ 0x40a50000, 0x00000fc4, 0x40a50000, 0x00000fc8, \
+   /* 2068 */ 0x40a50000, 0x00000fcc, 0x40a50000, 0x00000fd0, \
+   /* 2072 */ 0x40a50000, 0x00000fd4, 0x40a50000, 0x00000fd8, \
+   /* 2076 */ 0x40a50000, 0x00000fdc, 0x40a50000, 0x00000fe0, \
+   /* 2080 */ 0x40a50000, 0x00000fe4, 0x40a50000, 0x00000fe8, \
+   /* 2084 */ 0x40a50000, 0x00000fec, 0x40a50000, 0x00000ff0, \
+   /* 2088 */ 0x40a50000, 0x00000ff4, 0x40a50000, 0x00000ff8, \
+   /* 2092 */ 0x40a50000, 0x00000ffc, 0x40a50000, 0x00001000, \
+   /* 2096 */ 0x40a50000, 0x00001004, 0x40a50000, 0x00001008, \
+   /* 2100 */ 0x40a50000, 0x0000100c, 0x40a50000, 0x00001010, \
+   /* 2104 */ 0x40a50000, 0x00001014, 0x40a50000, 0x00001018, \
+   /* 2108 */ 0x40a50000, 0x0000101c, 0x40a50000, 0x00001020, \
+   /* 2112 */ 0x40a50000, 0x00001024, 0x40a50000, 0x00001028, \
+   /* 2116 */ 0x40a50000, 0x0000102c, 0x40a50000, 0x00001030, \
+   /* 2120 */ 0x40a50000, 0x00001034, 0x40a50000, 0x00001038, \
+   /* 2124 */ 0x40a50000, 0x0000103c, 0x40a50000, 0x00001040, \
+   /* 2128 */ 0x40a50000, 0x00001044, 0x40a50000, 0x00001048, \
+   /* 2132 */ 0x40a50000, 0x0000104c, 0x40a50000, 0x00001050, \
+   /* 2136 */ 0x40a50000, 0x00001054, 0x40a50000, 0x00001058, \
+   /* 2140 */ 0x40a50000, 0x0000105c, 0x40a50000, 0x00001060, \
+   /* 2144 */ 0x40a50000, 0x00001064, 0x40a50000, 0x00001068, \
+   /* 2148 */ 0x40a50000, 0x0000106c, 0x40a50000, 0x00001070, \
+   /* 2152 */ 0x40a50000, 0x00001074, 0x40a50000, 0x00001078, \
+   /* 2156 */ 0x40a50000, 0x0000107c, 0x40a50000, 0x00001080, \
+   /* 2160 */ 0x40a50000, 0x00001084, 0x40a50000, 0x00001088, \
+   /* 2164 */ 0x40a50000, 0x0000108c, 0x40a50000, 0x00001090, \
+   /* 2168 */ 0x40a50000, 0x00001094, 0x40a50000, 0x00001098, \
+   /* 2172 */ 0x40a50000, 0x0000109c, 0x40a50000, 0x000010a0, \
+   /* 2176 */ 0x40a50000, 0x000010a4, 0x40a50000, 0x000010a8, \
+   /* 2180 */ 0x40a50000, 0x000010ac, 0x40a50000, 0x000010b0, \
+   /* 2184 */ 0x40a50000, 0x000010b4, 0x40a50000, 0x000010b8, \
+   /* 2188 */ 0x40a50000, 0x000010bc, 0x40a50000, 0x000010c0, \
+   /* 2192 */ 0x40a50000, 0x000010c4, 0x40a50000, 0x000010c8, \
+   /* 2196 */ 0x40a50000, 0x000010cc, 0x40a50000, 0x000010d0, \
+   /* 2200 */ 0x40a50000, 0x000010d4, 0x40a50000, 0x000010d8, \
+   /* 2204 */ 0x40a50000, 0x000010dc, 0x40a50000, 0x000010e0, \
+   /* 2208 */ 0x40a50000, 0x000010e4, 0x40a50000, 0x000010e8, \
+   /* 2212 */ 0x40a50000, 0x000010ec, 0x40a50000, 0x000010f0, \
+   /* 2216 */ 0x40a50000, 0x000010f4, 0x40a50000, 0x000010f8, \
+   /* 2220 */ 0x40a50000, 0x000010fc, 0x40a50000, 0x00001100, \
+   /* 2224 */ 0x40a50000, 0x00001104, 0x40a50000, 0x00001108, \
+   /* 2228 */ 0x40a50000, 0x0000110c, 0x40a50000, 0x00001110, \
+   /* 2232 */ 0x40a50000, 0x00001114, 0x40a50000, 0x00001118, \
+   /* 2236 */ 0x40a50000, 0x0000111c, 0x40a50000, 0x00001120, \
+   /* 2240 */ 0x40a50000, 0x00001124, 0x40a50000, 0x00001128, \
+   /* 2244 */ 0x40a50000, 0x0000112c, 0x40a50000, 0x00001130, \
+   /* 2248 */ 0x40a50000, 0x00001134, 0x40a50000, 0x00001138, \
+   /* 2252 */ 0x40a50000, 0x0000113c, 0x40a50000, 0x00001140, \
+   /* 2256 */ 0x40a50000, 0x00001144, 0x40a50000, 0x00001148, \
+   /* 2260 */ 0x40a50000, 0x0000114c, 0x40a50000, 0x00001150, \
+   /* 2264 */ 0x40a50000, 0x00001154, 0x40a50000, 0x00001158, \
+   /* 2268 */ 0x40a50000, 0x0000115c, 0x40a50000, 0x00001160, \
+   /* 2272 */ 0x40a50000, 0x00001164, 0x40a50000, 0x00001168, \
+   /* 2276 */ 0x40a50000, 0x0000116c, 0x40a50000, 0x00001170, \
+   /* 2280 */ 0x40a50000, 0x00001174, 0x40a50000, 0x00001178, \
+   /* 2284 */ 0x40a50000, 0x0000117c, 0x40a50000, 0x00001180, \
+   /* 2288 */ 0x40a50000, 0x00001184, 0x40a50000, 0x00001188, \
+   /* 2292 */ 0x40a50000, 0x0000118c, 0x40a50000, 0x00001190, \
+   /* 2296 */ 0x40a50000, 0x00001194, 0x40a50000, 0x00001198, \
+   /* 2300 */ 0x40a50000, 0x0000119c, 0x40a50000, 0x000011a0, \
+   /* 2304 */ 0x40a50000, 0x000011a4, 0x40a50000, 0x000011a8, \
+   /* 2308 */ 0x40a50000, 0x000011ac, 0x40a50000, 0x000011b0, \
+   /* 2312 */ 0x40a50000, 0x000011b4, 0x40a50000, 0x000011b8, \
+   /* 2316 */ 0x40a50000, 0x000011bc, 0x40a50000, 0x000011c0, \
+   /* 2320 */ 0x40a50000, 0x000011c4, 0x40a50000, 0x000011c8, \
+   /* 2324 */ 0x40a50000, 0x000011cc, 0x40a50000, 0x000011d0, \
+   /* 2328 */ 0x40a50000, 0x000011d4, 0x40a50000, 0x000011d8, \
+   /* 2332 */ 0x40a50000, 0x000011dc, 0x40a50000, 0x000011e0, \
+   /* 2336 */ 0x40a50000, 0x000011e4, 0x40a50000, 0x000011e8, \
+   /* 2340 */ 0x40a50000, 0x000011ec, 0x40a50000, 0x000011f0, \
+   /* 2344 */ 0x40a50000, 0x000011f4, 0x40a50000, 0x000011f8, \
+   /* 2348 */ 0x40a50000, 0x000011fc, 0x40a50000, 0x00001200, \
+   /* 2352 */ 0x40a50000, 0x00001204, 0x40a50000, 0x00001208, \
+   /* 2356 */ 0x40a50000, 0x0000120c, 0x40a50000, 0x00001210, \
+   /* 2360 */ 0x40a50000, 0x00001214, 0x40a50000, 0x00001218, \
+   /* 2364 */ 0x40a50000, 0x0000121c, 0x40a50000, 0x00001220, \
+   /* 2368 */ 0x40a50000, 0x00001224, 0x40a50000, 0x00001228, \
+   /* 2372 */ 0x40a50000, 0x0000122c, 0x40a50000, 0x00001230, \
+   /* 2376 */ 0x40a50000, 0x00001234, 0x40a50000, 0x00001238, \
+   /* 2380 */ 0x40a50000, 0x0000123c, 0x40a50000, 0x00001240, \
+   /* 2384 */ 0x40a50000, 0x00001244, 0x40a50000, 0x00001248, \
+   /* 2388 */ 0x40a50000, 0x0000124c, 0x40a50000, 0x00001250, \
+   /* 2392 */ 0x40a50000, 0x00001254, 0x40a50000, 0x00001258, \
+   /* 2396 */ 0x40a50000, 0x0000125c, 0x40a50000, 0x00001260, \
+   /* 2400 */ 0x40a50000, 0x00001264, 0x40a50000, 0x00001268, \
+   /* 2404 */ 0x40a50000, 0x0000126c, 0x40a50000, 0x00001270, \
+   /* 2408 */ 0x40a50000, 0x00001274, 0x40a50000, 0x00001278, \
+   /* 2412 */ 0x40a50000, 0x0000127c, 0x40a50000, 0x00001280, \
+   /* 2416 */ 0x40a50000, 0x00001284, 0x40a50000, 0x00001288, \
+   /* 2420 */ 0x40a50000, 0x0000128c, 0x40a50000, 0x00001290, \
+   /* 2424 */ 0x40a50000, 0x00001294, 0x40a50000, 0x00001298, \
+   /* 2428 */ 0x40a50000, 0x0000129c, 0x40a50000, 0x000012a0, \
+   /* 2432 */ 0x40a50000, 0x000012a4, 0x40a50000, 0x000012a8, \
+   /* 2436 */ 0x40a50000, 0x000012ac, 0x40a50000, 0x000012b0, \
+   /* 2440 */ 0x40a50000, 0x000012b4, 0x40a50000, 0x000012b8, \
+   /* 2444 */ 0x40a50000, 0x000012bc, 0x40a50000, 0x000012c0, \
+   /* 2448 */ 0x40a50000, 0x000012c4, 0x40a50000, 0x000012c8, \
+   /* 2452 */ 0x40a50000, 0x000012cc, 0x40a50000, 0x000012d0, \
+   /* 2456 */ 0x40a50000, 0x000012d4, 0x40a50000, 0x000012d8, \
+   /* 2460 */ 0x40a50000, 0x000012dc, 0x40a50000, 0x000012e0, \
+   /* 2464 */ 0x40a50000, 0x000012e4, 0x40a50000, 0x000012e8, \
+   /* 2468 */ 0x40a50000, 0x000012ec, 0x40a50000, 0x000012f0, \
+   /* 2472 */ 0x40a50000, 0x000012f4, 0x40a50000, 0x000012f8, \
+   /* 2476 */ 0x40a50000, 0x000012fc, 0x40a50000, 0x00001300, \
+   /* 2480 */ 0x40a50000, 0x00001304, 0x40a50000, 0x00001308, \
+   /* 2484 */ 0x40a50000, 0x0000130c, 0x40a50000, 0x00001310, \
+   /* 2488 */ 0x40a50000, 0x00001314, 0x40a50000, 0x00001318, \
+   /* 2492 */ 0x40a50000, 0x0000131c, 0x40a50000, 0x00001320, \
+   /* 2496 */ 0x40a50000, 0x00001324, 0x40a50000, 0x00001328, \
+   /* 2500 */ 0x40a50000, 0x0000132c, 0x40a50000, 0x00001330, \
+   /* 2504 */ 0x40a50000, 0x00001334, 0x40a50000, 0x00001338, \
+   /* 2508 */ 0x40a50000, 0x0000133c, 0x40a50000, 0x00001340, \
+   /* 2512 */ 0x40a50000, 0x00001344, 0x40a50000, 0x00001348, \
+   /* 2516 */ 0x40a50000, 0x0000134c, 0x40a50000, 0x00001350, \
+   /* 2520 */ 0x40a50000, 0x00001354, 0x40a50000, 0x00001358, \
+   /* 2524 */ 0x40a50000, 0x0000135c, 0x40a50000, 0x00001360, \
+   /* 2528 */ 0x40a50000, 0x00001364, 0x40a50000, 0x00001368, \
+   /* 2532 */ 0x40a50000, 0x0000136c, 0x40a50000, 0x00001370, \
+   /* 2536 */ 0x40a50000, 0x00001374, 0x40a50000, 0x00001378, \
+   /* 2540 */ 0x40a50000, 0x0000137c, 0x40a50000, 0x00001380, \
+   /* 2544 */ 0x40a50000, 0x00001384, 0x40a50000, 0x00001388, \
+   /* 2548 */ 0x40a50000, 0x0000138c, 0x40a50000, 0x00001390, \
+   /* 2552 */ 0x40a50000, 0x00001394, 0x40a50000, 0x00001398, \
+   /* 2556 */ 0x40a50000, 0x0000139c, 0x40a50000, 0x000013a0, \
+   /* 2560 */ 0x40a50000, 0x000013a4, 0x40a50000, 0x000013a8, \
+   /* 2564 */ 0x40a50000, 0x000013ac, 0x40a50000, 0x000013b0, \
+   /* 2568 */ 0x40a50000, 0x000013b4, 0x40a50000, 0x000013b8, \
+   /* 2572 */ 0x40a50000, 0x000013bc, 0x40a50000, 0x000013c0, \
+   /* 2576 */ 0x40a50000, 0x000013c4, 0x40a50000, 0x000013c8, \
+   /* 2580 */ 0x40a50000, 0x000013cc, 0x40a50000, 0x000013d0, \
+   /* 2584 */ 0x40a50000, 0x000013d4, 0x40a50000, 0x000013d8, \
+   /* 2588 */ 0x40a50000, 0x000013dc, 0x40a50000, 0x000013e0, \
+   /* 2592 */ 0x40a50000, 0x000013e4, 0x40a50000, 0x000013e8, \
+   /* 2596 */ 0x40a50000, 0x000013ec, 0x40a50000, 0x000013f0, \
+   /* 2600 */ 0x40a50000, 0x000013f4, 0x40a50000, 0x000013f8, \
+   /* 2604 */ 0x40a50000, 0x000013fc, 0x40a50000, 0x00001400, \
+   /* 2608 */ 0x40a50000, 0x00001404, 0x40a50000, 0x00001408, \
+   /* 2612 */ 0x40a50000, 0x0000140c, 0x40a50000, 0x00001410, \
+   /* 2616 */ 0x40a50000, 0x00001414, 0x40a50000, 0x00001418, \
+   /* 2620 */ 0x40a50000, 0x0000141c, 0x40a50000, 0x00001420, \
+   /* 2624 */ 0x40a50000, 0x00001424, 0x40a50000, 0x00001428, \
+   /* 2628 */ 0x40a50000, 0x0000142c, 0x40a50000, 0x00001430, \
+   /* 2632 */ 0x40a50000, 0x00001434, 0x40a50000, 0x00001438, \
+   /* 2636 */ 0x40a50000, 0x0000143c, 0x40a50000, 0x00001440, \
+   /* 2640 */ 0x40a50000, 0x00001444, 0x40a50000, 0x00001448, \
+   /* 2644 */ 0x40a50000, 0x0000144c, 0x40a50000, 0x00001450, \
+   /* 2648 */ 0x40a50000, 0x00001454, 0x40a50000, 0x00001458, \
+   /* 2652 */ 0x40a50000, 0x0000145c, 0x40a50000, 0x00001460, \
+   /* 2656 */ 0x40a50000, 0x00001464, 0x40a50000, 0x00001468, \
+   /* 2660 */ 0x40a50000, 0x0000146c, 0x40a50000, 0x00001470, \
+   /* 2664 */ 0x40a50000, 0x00001474, 0x40a50000, 0x00001478, \
+   /* 2668 */ 0x40a50000, 0x0000147c, 0x40a50000, 0x00001480, \
+   /* 2672 */ 0x40a50000, 0x00001484, 0x40a50000, 0x00001488, \
+   /* 2676 */ 0x40a50000, 0x0000148c, 0x40a50000, 0x00001490, \
+   /* 2680 */ 0x40a50000, 0x00001494, 0x40a50000, 0x00001498, \
+   /* 2684 */ 0x40a50000, 0x0000149c, 0x40a50000, 0x000014a0, \
+   /* 2688 */ 0x40a50000, 0x000014a4, 0x40a50000, 0x000014a8, \
+   /* 2692 */ 0x40a50000, 0x000014ac, 0x40a50000, 0x000014b0, \
+   /* 2696 */ 0x40a50000, 0x000014b4, 0x40a50000, 0x000014b8, \
+   /* 2700 */ 0x40a50000, 0x000014bc, 0x40a50000, 0x000014c0, \
+   /* 2704 */ 0x40a50000, 0x000014c4, 0x40a50000, 0x000014c8, \
+   /* 2708 */ 0x40a50000, 0x000014cc, 0x40a50000, 0x000014d0, \
+   /* 2712 */ 0x40a50000, 0x000014d4, 0x40a50000, 0x000014d8, \
+   /* 2716 */ 0x40a50000, 0x000014dc, 0x40a50000, 0x000014e0, \
+   /* 2720 */ 0x40a50000, 0x000014e4, 0x40a50000, 0x000014e8, \
+   /* 2724 */ 0x40a50000, 0x000014ec, 0x40a50000, 0x000014f0, \
+   /* 2728 */ 0x40a50000, 0x000014f4, 0x40a50000, 0x000014f8, \
+   /* 2732 */ 0x40a50000, 0x000014fc, 0x40a50000, 0x00001500, \
+   /* 2736 */ 0x40a50000, 0x00001504, 0x40a50000, 0x00001508, \
+   /* 2740 */ 0x40a50000, 0x0000150c, 0x40a50000, 0x00001510, \
+   /* 2744 */ 0x40a50000, 0x00001514, 0x40a50000, 0x00001518, \
+   /* 2748 */ 0x40a50000, 0x0000151c, 0x40a50000, 0x00001520, \
+   /* 2752 */ 0x40a50000, 0x00001524, 0x40a50000, 0x00001528, \
+   /* 2756 */ 0x40a50000, 0x0000152c, 0x40a50000, 0x00001530, \
+   /* 2760 */ 0x40a50000, 0x00001534, 0x40a50000, 0x00001538, \
+   /* 2764 */ 0x40a50000, 0x0000153c, 0x40a50000, 0x00001540, \
+   /* 2768 */ 0x40a50000, 0x00001544, 0x40a50000, 0x00001548, \
+   /* 2772 */ 0x40a50000, 0x0000154c, 0x40a50000, 0x00001550, \
+   /* 2776 */ 0x40a50000, 0x00001554, 0x40a50000, 0x00001558, \
+   /* 2780 */ 0x40a50000, 0x0000155c, 0x40a50000, 0x00001560, \
+   /* 2784 */ 0x40a50000, 0x00001564, 0x40a50000, 0x00001568, \
+   /* 2788 */ 0x40a50000, 0x0000156c, 0x40a50000, 0x00001570, \
+   /* 2792 */ 0x40a50000, 0x00001574, 0x40a50000, 0x00001578, \
+   /* 2796 */ 0x40a50000, 0x0000157c, 0x40a50000, 0x00001580, \
+   /* 2800 */ 0x40a50000, 0x00001584, 0x40a50000, 0x00001588, \
+   /* 2804 */ 0x40a50000, 0x0000158c, 0x40a50000, 0x00001590, \
+   /* 2808 */ 0x40a50000, 0x00001594, 0x40a50000, 0x00001598, \
+   /* 2812 */ 0x40a50000, 0x0000159c, 0x40a50000, 0x000015a0, \
+   /* 2816 */ 0x40a50000, 0x000015a4, 0x40a50000, 0x000015a8, \
+   /* 2820 */ 0x40a50000, 0x000015ac, 0x40a50000, 0x000015b0, \
+   /* 2824 */ 0x40a50000, 0x000015b4, 0x40a50000, 0x000015b8, \
+   /* 2828 */ 0x40a50000, 0x000015bc, 0x40a50000, 0x000015c0, \
+   /* 2832 */ 0x40a50000, 0x000015c4, 0x40a50000, 0x000015c8, \
+   /* 2836 */ 0x40a50000, 0x000015cc, 0x40a50000, 0x000015d0, \
+   /* 2840 */ 0x40a50000, 0x000015d4, 0x40a50000, 0x000015d8, \
+   /* 2844 */ 0x40a50000, 0x000015dc, 0x40a50000, 0x000015e0, \
+   /* 2848 */ 0x40a50000, 0x000015e4, 0x40a50000, 0x000015e8, \
+   /* 2852 */ 0x40a50000, 0x000015ec, 0x40a50000, 0x000015f0, \
+   /* 2856 */ 0x40a50000, 0x000015f4, 0x40a50000, 0x000015f8, \
+   /* 2860 */ 0x40a50000, 0x000015fc, 0x40a50000, 0x00001600, \
+   /* 2864 */ 0x40a50000, 0x00001604, 0x40a50000, 0x00001608, \
+   /* 2868 */ 0x40a50000, 0x0000160c, 0x40a50000, 0x00001610, \
+   /* 2872 */ 0x40a50000, 0x00001614, 0x40a50000, 0x00001618, \
+   /* 2876 */ 0x40a50000, 0x0000161c, 0x40a50000, 0x00001620, \
+   /* 2880 */ 0x40a50000, 0x00001624, 0x40a50000, 0x00001628, \
+   /* 2884 */ 0x40a50000, 0x0000162c, 0x40a50000, 0x00001630, \
+   /* 2888 */ 0x40a50000, 0x00001634, 0x40a50000, 0x00001638, \
+   /* 2892 */ 0x40a50000, 0x0000163c, 0x40a50000, 0x00001640, \
+   /* 2896 */ 0x40a50000, 0x00001644, 0x40a50000, 0x00001648, \
+   /* 2900 */ 0x40a50000, 0x0000164c, 0x40a50000, 0x00001650, \
+   /* 2904 */ 0x40a50000, 0x00001654, 0x40a50000, 0x00001658, \
+   /* 2908 */ 0x40a50000, 0x0000165c, 0x40a50000, 0x00001660, \
+   /* 2912 */ 0x40a50000, 0x00001664, 0x40a50000, 0x00001668, \
+   /* 2916 */ 0x40a50000, 0x0000166c, 0x40a50000, 0x00001670, \
+   /* 2920 */ 0x40a50000, 0x00001674, 0x40a50000, 0x00001678, \
+   /* 2924 */ 0x40a50000, 0x0000167c, 0x40a50000, 0x00001680, \
+   /* 2928 */ 0x40a50000, 0x00001684, 0x40a50000, 0x00001688, \
+   /* 2932 */ 0x40a50000, 0x0000168c, 0x40a50000, 0x00001690, \
+   /* 2936 */ 0x40a50000, 0x00001694, 0x40a50000, 0x00001698, \
+   /* 2940 */ 0x40a50000, 0x0000169c, 0x40a50000, 0x000016a0, \
+   /* 2944 */ 0x40a50000, 0x000016a4, 0x40a50000, 0x000016a8, \
+   /* 2948 */ 0x40a50000, 0x000016ac, 0x40a50000, 0x000016b0, \
+   /* 2952 */ 0x40a50000, 0x000016b4, 0x40a50000, 0x000016b8, \
+   /* 2956 */ 0x40a50000, 0x000016bc, 0x40a50000, 0x000016c0, \
+   /* 2960 */ 0x40a50000, 0x000016c4, 0x40a50000, 0x000016c8, \
+   /* 2964 */ 0x40a50000, 0x000016cc, 0x40a50000, 0x000016d0, \
+   /* 2968 */ 0x40a50000, 0x000016d4, 0x40a50000, 0x000016d8, \
+   /* 2972 */ 0x40a50000, 0x000016dc, 0x40a50000, 0x000016e0, \
+   /* 2976 */ 0x40a50000, 0x000016e4, 0x40a50000, 0x000016e8, \
+   /* 2980 */ 0x40a50000, 0x000016ec, 0x40a50000, 0x000016f0, \
+   /* 2984 */ 0x40a50000, 0x000016f4, 0x40a50000, 0x000016f8, \
+   /* 2988 */ 0x40a50000, 0x000016fc, 0x40a50000, 0x00001700, \
+   /* 2992 */ 0x40a50000, 0x00001704, 0x40a50000, 0x00001708, \
+   /* 2996 */ 0x40a50000, 0x0000170c, 0x40a50000, 0x00001710, \
+   /* 3000 */ 0x40a50000, 0x00001714, 0x40a50000, 0x00001718, \
+   /* 3004 */ 0x40a50000, 0x0000171c, 0x40a50000, 0x00001720, \
+   /* 3008 */ 0x40a50000, 0x00001724, 0x40a50000, 0x00001728, \
+   /* 3012 */ 0x40a50000, 0x0000172c, 0x40a50000, 0x00001730, \
+   /* 3016 */ 0x40a50000, 0x00001734, 0x40a50000, 0x00001738, \
+   /* 3020 */ 0x40a50000, 0x0000173c, 0x40a50000, 0x00001740, \
+   /* 3024 */ 0x40a50000, 0x00001744, 0x40a50000, 0x00001748, \
+   /* 3028 */ 0x40a50000, 0x0000174c, 0x40a50000, 0x00001750, \
+   /* 3032 */ 0x40a50000, 0x00001754, 0x40a50000, 0x00001758, \
+   /* 3036 */ 0x40a50000, 0x0000175c, 0x40a50000, 0x00001760, \
+   /* 3040 */ 0x40a50000, 0x00001764, 0x40a50000, 0x00001768, \
+   /* 3044 */ 0x40a50000, 0x0000176c, 0x40a50000, 0x00001770, \
+   /* 3048 */ 0x40a50000, 0x00001774, 0x40a50000, 0x00001778, \
+   /* 3052 */ 0x40a50000, 0x0000177c, 0x40a50000, 0x00001780, \
+   /* 3056 */ 0x40a50000, 0x00001784, 0x40a50000, 0x00001788, \
+   /* 3060 */ 0x40a50000, 0x0000178c, 0x40a50000, 0x00001790, \
+   /* 3064 */ 0x40a50000, 0x00001794, 0x40a50000, 0x00001798, \
+   /* 3068 */ 0x40a50000, 0x0000179c, 0x40a50000, 0x000017a0, \
+   /* 3072 */ 0x40a50000, 0x000017a4, 0x40a50000, 0x000017a8, \
+   /* 3076 */ 0x40a50000, 0x000017ac, 0x40a50000, 0x000017b0, \
+   /* 3080 */ 0x40a50000, 0x000017b4, 0x40a50000, 0x000017b8, \
+   /* 3084 */ 0x40a50000, 0x000017bc, 0x40a50000, 0x000017c0, \
+   /* 3088 */ 0x40a50000, 0x000017c4, 0x40a50000, 0x000017c8, \
+   /* 3092 */ 0x40a50000, 0x000017cc, 0x40a50000, 0x000017d0, \
+   /* 3096 */ 0x40a50000, 0x000017d4, 0x40a50000, 0x000017d8, \
+   /* 3100 */ 0x40a50000, 0x000017dc, 0x40a50000, 0x000017e0, \
+   /* 3104 */ 0x40a50000, 0x000017e4, 0x40a50000, 0x000017e8, \
+   /* 3108 */ 0x40a50000, 0x000017ec, 0x40a50000, 0x000017f0, \
+   /* 3112 */ 0x40a50000, 0x000017f4, 0x40a50000, 0x000017f8, \
+   /* 3116 */ 0x40a50000, 0x000017fc, 0x40a50000, 0x00001800, \
+   /* 3120 */ 0x40a50000, 0x00001804, 0x40a50000, 0x00001808, \
+   /* 3124 */ 0x40a50000, 0x0000180c, 0x40a50000, 0x00001810, \
+   /* 3128 */ 0x40a50000, 0x00001814, 0x40a50000, 0x00001818, \
+   /* 3132 */ 0x40a50000, 0x0000181c, 0x40a50000, 0x00001820, \
+   /* 3136 */ 0x40a50000, 0x00001824, 0x40a50000, 0x00001828, \
+   /* 3140 */ 0x40a50000, 0x0000182c, 0x40a50000, 0x00001830, \
+   /* 3144 */ 0x40a50000, 0x00001834, 0x40a50000, 0x00001838, \
+   /* 3148 */ 0x40a50000, 0x0000183c, 0x40a50000, 0x00001840, \
+   /* 3152 */ 0x40a50000, 0x00001844, 0x40a50000, 0x00001848, \
+   /* 3156 */ 0x40a50000, 0x0000184c, 0x40a50000, 0x00001850, \
+   /* 3160 */ 0x40a50000, 0x00001854, 0x40a50000, 0x00001858, \
+   /* 3164 */ 0x40a50000, 0x0000185c, 0x40a50000, 0x00001860, \
+   /* 3168 */ 0x40a50000, 0x00001864, 0x40a50000, 0x00001868, \
+   /* 3172 */ 0x40a50000, 0x0000186c, 0x40a50000, 0x00001870, \
+   /* 3176 */ 0x40a50000, 0x00001874, 0x40a50000, 0x00001878, \
+   /* 3180 */ 0x40a50000, 0x0000187c, 0x40a50000, 0x00001880, \
+   /* 3184 */ 0x40a50000, 0x00001884, 0x40a50000, 0x00001888, \
+   /* 3188 */ 0x40a50000, 0x0000188c, 0x40a50000, 0x00001890, \
+   /* 3192 */ 0x40a50000, 0x00001894, 0x40a50000, 0x00001898, \
+   /* 3196 */ 0x40a50000, 0x0000189c, 0x40a50000, 0x000018a0, \
+   /* 3200 */ 0x40a50000, 0x000018a4, 0x40a50000, 0x000018a8, \
+   /* 3204 */ 0x40a50000, 0x000018ac, 0x40a50000, 0x000018b0, \
+   /* 3208 */ 0x40a50000, 0x000018b4, 0x40a50000, 0x000018b8, \
+   /* 3212 */ 0x40a50000, 0x000018bc, 0x40a50000, 0x000018c0, \
+   /* 3216 */ 0x40a50000, 0x000018c4, 0x40a50000, 0x000018c8, \
+   /* 3220 */ 0x40a50000, 0x000018cc, 0x40a50000, 0x000018d0, \
+   /* 3224 */ 0x40a50000, 0x000018d4, 0x40a50000, 0x000018d8, \
+   /* 3228 */ 0x40a50000, 0x000018dc, 0x40a50000, 0x000018e0, \
+   /* 3232 */ 0x40a50000, 0x000018e4, 0x40a50000, 0x000018e8, \
+   /* 3236 */ 0x40a50000, 0x000018ec, 0x40a50000, 0x000018f0, \
+   /* 3240 */ 0x40a50000, 0x000018f4, 0x40a50000, 0x000018f8, \
+   /* 3244 */ 0x40a50000, 0x000018fc, 0x40a50000, 0x00001900, \
+   /* 3248 */ 0x40a50000, 0x00001904, 0x40a50000, 0x00001908, \
+   /* 3252 */ 0x40a50000, 0x0000190c, 0x40a50000, 0x00001910, \
+   /* 3256 */ 0x40a50000, 0x00001914, 0x40a50000, 0x00001918, \
+   /* 3260 */ 0x40a50000, 0x0000191c, 0x40a50000, 0x00001920, \
+   /* 3264 */ 0x40a50000, 0x00001924, 0x40a50000, 0x00001928, \
+   /* 3268 */ 0x40a50000, 0x0000192c, 0x40a50000, 0x00001930, \
+   /* 3272 */ 0x40a50000, 0x00001934, 0x40a50000, 0x00001938, \
+   /* 3276 */ 0x40a50000, 0x0000193c, 0x40a50000, 0x00001940, \
+   /* 3280 */ 0x40a50000, 0x00001944, 0x40a50000, 0x00001948, \
+   /* 3284 */ 0x40a50000, 0x0000194c, 0x40a50000, 0x00001950, \
+   /* 3288 */ 0x40a50000, 0x00001954, 0x40a50000, 0x00001958, \
+   /* 3292 */ 0x40a50000, 0x0000195c, 0x40a50000, 0x00001960, \
+   /* 3296 */ 0x40a50000, 0x00001964, 0x40a50000, 0x00001968, \
+   /* 3300 */ 0x40a50000, 0x0000196c, 0x40a50000, 0x00001970, \
+   /* 3304 */ 0x40a50000, 0x00001974, 0x40a50000, 0x00001978, \
+   /* 3308 */ 0x40a50000, 0x0000197c, 0x40a50000, 0x00001980, \
+   /* 3312 */ 0x40a50000, 0x00001984, 0x40a50000, 0x00001988, \
+   /* 3316 */ 0x40a50000, 0x0000198c, 0x40a50000, 0x00001990, \
+   /* 3320 */ 0x40a50000, 0x00001994, 0x40a50000, 0x00001998, \
+   /* 3324 */ 0x40a50000, 0x0000199c, 0x40a50000, 0x000019a0, \
+   /* 3328 */ 0x40a50000, 0x000019a4, 0x40a50000, 0x000019a8, \
+   /* 3332 */ 0x40a50000, 0x000019ac, 0x40a50000, 0x000019b0, \
+   /* 3336 */ 0x40a50000, 0x000019b4, 0x40a50000, 0x000019b8, \
+   /* 3340 */ 0x40a50000, 0x000019bc, 0x40a50000, 0x000019c0, \
+   /* 3344 */ 0x40a50000, 0x000019c4, 0x40a50000, 0x000019c8, \
+   /* 3348 */ 0x40a50000, 0x000019cc, 0x40a50000, 0x000019d0, \
+   /* 3352 */ 0x40a50000, 0x000019d4, 0x40a50000, 0x000019d8, \
+   /* 3356 */ 0x40a50000, 0x000019dc, 0x40a50000, 0x000019e0, \
+   /* 3360 */ 0x40a50000, 0x000019e4, 0x40a50000, 0x000019e8, \
+   /* 3364 */ 0x40a50000, 0x000019ec, 0x40a50000, 0x000019f0, \
+   /* 3368 */ 0x40a50000, 0x000019f4, 0x40a50000, 0x000019f8, \
+   /* 3372 */ 0x40a50000, 0x000019fc, 0x40a50000, 0x00001a00, \
+   /* 3376 */ 0x40a50000, 0x00001a04, 0x40a50000, 0x00001a08, \
+   /* 3380 */ 0x40a50000, 0x00001a0c, 0x40a50000, 0x00001a10, \
+   /* 3384 */ 0x40a50000, 0x00001a14, 0x40a50000, 0x00001a18, \
+   /* 3388 */ 0x40a50000, 0x00001a1c, 0x40a50000, 0x00001a20, \
+   /* 3392 */ 0x40a50000, 0x00001a24, 0x40a50000, 0x00001a28, \
+   /* 3396 */ 0x40a50000, 0x00001a2c, 0x40a50000, 0x00001a30, \
+   /* 3400 */ 0x40a50000, 0x00001a34, 0x40a50000, 0x00001a38, \
+   /* 3404 */ 0x40a50000, 0x00001a3c, 0x40a50000, 0x00001a40, \
+   /* 3408 */ 0x40a50000, 0x00001a44, 0x40a50000, 0x00001a48, \
+   /* 3412 */ 0x40a50000, 0x00001a4c, 0x40a50000, 0x00001a50, \
+   /* 3416 */ 0x40a50000, 0x00001a54, 0x40a50000, 0x00001a58, \
+   /* 3420 */ 0x40a50000, 0x00001a5c, 0x40a50000, 0x00001a60, \
+   /* 3424 */ 0x40a50000, 0x00001a64, 0x40a50000, 0x00001a68, \
+   /* 3428 */ 0x40a50000, 0x00001a6c, 0x40a50000, 0x00001a70, \
+   /* 3432 */ 0x40a50000, 0x00001a74, 0x40a50000, 0x00001a78, \
+   /* 3436 */ 0x40a50000, 0x00001a7c, 0x40a50000, 0x00001a80, \
+   /* 3440 */ 0x40a50000, 0x00001a84, 0x40a50000, 0x00001a88, \
+   /* 3444 */ 0x40a50000, 0x00001a8c, 0x40a50000, 0x00001a90, \
+   /* 3448 */ 0x40a50000, 0x00001a94, 0x40a50000, 0x00001a98, \
+   /* 3452 */ 0x40a50000, 0x00001a9c, 0x40a50000, 0x00001aa0, \
+   /* 3456 */ 0x40a50000, 0x00001aa4, 0x40a50000, 0x00001aa8, \
+   /* 3460 */ 0x40a50000, 0x00001aac, 0x40a50000, 0x00001ab0, \
+   /* 3464 */ 0x40a50000, 0x00001ab4, 0x40a50000, 0x00001ab8, \
+   /* 3468 */ 0x40a50000, 0x00001abc, 0x40a50000, 0x00001ac0, \
+   /* 3472 */ 0x40a50000, 0x00001ac4, 0x40a50000, 0x00001ac8, \
+   /* 3476 */ 0x40a50000, 0x00001acc, 0x40a50000, 0x00001ad0, \
+   /* 3480 */ 0x40a50000, 0x00001ad4, 0x40a50000, 0x00001ad8, \
+   /* 3484 */ 0x40a50000, 0x00001adc, 0x40a50000, 0x00001ae0, \
+   /* 3488 */ 0x40a50000, 0x00001ae4, 0x40a50000, 0x00001ae8, \
+   /* 3492 */ 0x40a50000, 0x00001aec, 0x40a50000, 0x00001af0, \
+   /* 3496 */ 0x40a50000, 0x00001af4, 0x40a50000, 0x00001af8, \
+   /* 3500 */ 0x40a50000, 0x00001afc, 0x40a50000, 0x00001b00, \
+   /* 3504 */ 0x40a50000, 0x00001b04, 0x40a50000, 0x00001b08, \
+   /* 3508 */ 0x40a50000, 0x00001b0c, 0x40a50000, 0x00001b10, \
+   /* 3512 */ 0x40a50000, 0x00001b14, 0x40a50000, 0x00001b18, \
+   /* 3516 */ 0x40a50000, 0x00001b1c, 0x40a50000, 0x00001b20, \
+   /* 3520 */ 0x40a50000, 0x00001b24, 0x40a50000, 0x00001b28, \
+   /* 3524 */ 0x40a50000, 0x00001b2c, 0x40a50000, 0x00001b30, \
+   /* 3528 */ 0x40a50000, 0x00001b34, 0x40a50000, 0x00001b38, \
+   /* 3532 */ 0x40a50000, 0x00001b3c, 0x40a50000, 0x00001b40, \
+   /* 3536 */ 0x40a50000, 0x00001b44, 0x40a50000, 0x00001b48, \
+   /* 3540 */ 0x40a50000, 0x00001b4c, 0x40a50000, 0x00001b50, \
+   /* 3544 */ 0x40a50000, 0x00001b54, 0x40a50000, 0x00001b58, \
+   /* 3548 */ 0x40a50000, 0x00001b5c, 0x40a50000, 0x00001b60, \
+   /* 3552 */ 0x40a50000, 0x00001b64, 0x40a50000, 0x00001b68, \
+   /* 3556 */ 0x40a50000, 0x00001b6c, 0x40a50000, 0x00001b70, \
+   /* 3560 */ 0x40a50000, 0x00001b74, 0x40a50000, 0x00001b78, \
+   /* 3564 */ 0x40a50000, 0x00001b7c, 0x40a50000, 0x00001b80, \
+   /* 3568 */ 0x40a50000, 0x00001b84, 0x40a50000, 0x00001b88, \
+   /* 3572 */ 0x40a50000, 0x00001b8c, 0x40a50000, 0x00001b90, \
+   /* 3576 */ 0x40a50000, 0x00001b94, 0x40a50000, 0x00001b98, \
+   /* 3580 */ 0x40a50000, 0x00001b9c, 0x40a50000, 0x00001ba0, \
+   /* 3584 */ 0x40a50000, 0x00001ba4, 0x40a50000, 0x00001ba8, \
+   /* 3588 */ 0x40a50000, 0x00001bac, 0x40a50000, 0x00001bb0, \
+   /* 3592 */ 0x40a50000, 0x00001bb4, 0x40a50000, 0x00001bb8, \
+   /* 3596 */ 0x40a50000, 0x00001bbc, 0x40a50000, 0x00001bc0, \
+   /* 3600 */ 0x40a50000, 0x00001bc4, 0x40a50000, 0x00001bc8, \
+   /* 3604 */ 0x40a50000, 0x00001bcc, 0x40a50000, 0x00001bd0, \
+   /* 3608 */ 0x40a50000, 0x00001bd4, 0x40a50000, 0x00001bd8, \
+   /* 3612 */ 0x40a50000, 0x00001bdc, 0x40a50000, 0x00001be0, \
+   /* 3616 */ 0x40a50000, 0x00001be4, 0x40a50000, 0x00001be8, \
+   /* 3620 */ 0x40a50000, 0x00001bec, 0x40a50000, 0x00001bf0, \
+   /* 3624 */ 0x40a50000, 0x00001bf4, 0x40a50000, 0x00001bf8, \
+   /* 3628 */ 0x40a50000, 0x00001bfc, 0x40a50000, 0x00001c00, \
+   /* 3632 */ 0x40a50000, 0x00001c04, 0x40a50000, 0x00001c08, \
+   /* 3636 */ 0x40a50000, 0x00001c0c, 0x40a50000, 0x00001c10, \
+   /* 3640 */ 0x40a50000, 0x00001c14, 0x40a50000, 0x00001c18, \
+   /* 3644 */ 0x40a50000, 0x00001c1c, 0x40a50000, 0x00001c20, \
+   /* 3648 */ 0x40a50000, 0x00001c24, 0x40a50000, 0x00001c28, \
+   /* 3652 */ 0x40a50000, 0x00001c2c, 0x40a50000, 0x00001c30, \
+   /* 3656 */ 0x40a50000, 0x00001c34, 0x40a50000, 0x00001c38, \
+   /* 3660 */ 0x40a50000, 0x00001c3c, 0x40a50000, 0x00001c40, \
+   /* 3664 */ 0x40a50000, 0x00001c44, 0x40a50000, 0x00001c48, \
+   /* 3668 */ 0x40a50000, 0x00001c4c, 0x40a50000, 0x00001c50, \
+   /* 3672 */ 0x40a50000, 0x00001c54, 0x40a50000, 0x00001c58, \
+   /* 3676 */ 0x40a50000, 0x00001c5c, 0x40a50000, 0x00001c60, \
+   /* 3680 */ 0x40a50000, 0x00001c64, 0x40a50000, 0x00001c68, \
+   /* 3684 */ 0x40a50000, 0x00001c6c, 0x40a50000, 0x00001c70, \
+   /* 3688 */ 0x40a50000, 0x00001c74, 0x40a50000, 0x00001c78, \
+   /* 3692 */ 0x40a50000, 0x00001c7c, 0x40a50000, 0x00001c80, \
+   /* 3696 */ 0x40a50000, 0x00001c84, 0x40a50000, 0x00001c88, \
+   /* 3700 */ 0x40a50000, 0x00001c8c, 0x40a50000, 0x00001c90, \
+   /* 3704 */ 0x40a50000, 0x00001c94, 0x40a50000, 0x00001c98, \
+   /* 3708 */ 0x40a50000, 0x00001c9c, 0x40a50000, 0x00001ca0, \
+   /* 3712 */ 0x40a50000, 0x00001ca4, 0x40a50000, 0x00001ca8, \
+   /* 3716 */ 0x40a50000, 0x00001cac, 0x40a50000, 0x00001cb0, \
+   /* 3720 */ 0x40a50000, 0x00001cb4, 0x40a50000, 0x00001cb8, \
+   /* 3724 */ 0x40a50000, 0x00001cbc, 0x40a50000, 0x00001cc0, \
+   /* 3728 */ 0x40a50000, 0x00001cc4, 0x40a50000, 0x00001cc8, \
+   /* 3732 */ 0x40a50000, 0x00001ccc, 0x40a50000, 0x00001cd0, \
+   /* 3736 */ 0x40a50000, 0x00001cd4, 0x40a50000, 0x00001cd8, \
+   /* 3740 */ 0x40a50000, 0x00001cdc, 0x40a50000, 0x00001ce0, \
+   /* 3744 */ 0x40a50000, 0x00001ce4, 0x40a50000, 0x00001ce8, \
+   /* 3748 */ 0x40a50000, 0x00001cec, 0x40a50000, 0x00001cf0, \
+   /* 3752 */ 0x40a50000, 0x00001cf4, 0x40a50000, 0x00001cf8, \
+   /* 3756 */ 0x40a50000, 0x00001cfc, 0x40a50000, 0x00001d00, \
+   /* 3760 */ 0x40a50000, 0x00001d04, 0x40a50000, 0x00001d08, \
+   /* 3764 */ 0x40a50000, 0x00001d0c, 0x40a50000, 0x00001d10, \
+   /* 3768 */ 0x40a50000, 0x00001d14, 0x40a50000, 0x00001d18, \
+   /* 3772 */ 0x40a50000, 0x00001d1c, 0x40a50000, 0x00001d20, \
+   /* 3776 */ 0x40a50000, 0x00001d24, 0x40a50000, 0x00001d28, \
+   /* 3780 */ 0x40a50000, 0x00001d2c, 0x40a50000, 0x00001d30, \
+   /* 3784 */ 0x40a50000, 0x00001d34, 0x40a50000, 0x00001d38, \
+   /* 3788 */ 0x40a50000, 0x00001d3c, 0x40a50000, 0x00001d40, \
+   /* 3792 */ 0x40a50000, 0x00001d44, 0x40a50000, 0x00001d48, \
+   /* 3796 */ 0x40a50000, 0x00001d4c, 0x40a50000, 0x00001d50, \
+   /* 3800 */ 0x40a50000, 0x00001d54, 0x40a50000, 0x00001d58, \
+   /* 3804 */ 0x40a50000, 0x00001d5c, 0x40a50000, 0x00001d60, \
+   /* 3808 */ 0x40a50000, 0x00001d64, 0x40a50000, 0x00001d68, \
+   /* 3812 */ 0x40a50000, 0x00001d6c, 0x40a50000, 0x00001d70, \
+   /* 3816 */ 0x40a50000, 0x00001d74, 0x40a50000, 0x00001d78, \
+   /* 3820 */ 0x40a50000, 0x00001d7c, 0x40a50000, 0x00001d80, \
+   /* 3824 */ 0x40a50000, 0x00001d84, 0x40a50000, 0x00001d88, \
+   /* 3828 */ 0x40a50000, 0x00001d8c, 0x40a50000, 0x00001d90, \
+   /* 3832 */ 0x40a50000, 0x00001d94, 0x40a50000, 0x00001d98, \
+   /* 3836 */ 0x40a50000, 0x00001d9c, 0x40a50000, 0x00001da0, \
+   /* 3840 */ 0x40a50000, 0x00001da4, 0x40a50000, 0x00001da8, \
+   /* 3844 */ 0x40a50000, 0x00001dac, 0x40a50000, 0x00001db0, \
+   /* 3848 */ 0x40a50000, 0x00001db4, 0x40a50000, 0x00001db8, \
+   /* 3852 */ 0x40a50000, 0x00001dbc, 0x40a50000, 0x00001dc0, \
+   /* 3856 */ 0x40a50000, 0x00001dc4, 0x40a50000, 0x00001dc8, \
+   /* 3860 */ 0x40a50000, 0x00001dcc, 0x40a50000, 0x00001dd0, \
+   /* 3864 */ 0x40a50000, 0x00001dd4, 0x40a50000, 0x00001dd8, \
+   /* 3868 */ 0x40a50000, 0x00001ddc, 0x40a50000, 0x00001de0, \
+   /* 3872 */ 0x40a50000, 0x00001de4, 0x40a50000, 0x00001de8, \
+   /* 3876 */ 0x40a50000, 0x00001dec, 0x40a50000, 0x00001df0, \
+   /* 3880 */ 0x40a50000, 0x00001df4, 0x40a50000, 0x00001df8, \
+   /* 3884 */ 0x40a50000, 0x00001dfc, 0x40a50000, 0x00001e00, \
+   /* 3888 */ 0x40a50000, 0x00001e04, 0x40a50000, 0x00001e08, \
+   /* 3892 */ 0x40a50000, 0x00001e0c, 0x40a50000, 0x00001e10, \
+   /* 3896 */ 0x40a50000, 0x00001e14, 0x40a50000, 0x00001e18, \
+   /* 3900 */ 0x40a50000, 0x00001e1c, 0x40a50000, 0x00001e20, \
+   /* 3904 */ 0x40a50000, 0x00001e24, 0x40a50000, 0x00001e28, \
+   /* 3908 */ 0x40a50000, 0x00001e2c, 0x40a50000, 0x00001e30, \
+   /* 3912 */ 0x40a50000, 0x00001e34, 0x40a50000, 0x00001e38, \
+   /* 3916 */ 0x40a50000, 0x00001e3c, 0x40a50000, 0x00001e40, \
+   /* 3920 */ 0x40a50000, 0x00001e44, 0x40a50000, 0x00001e48, \
+   /* 3924 */ 0x40a50000, 0x00001e4c, 0x40a50000, 0x00001e50, \
+   /* 3928 */ 0x40a50000, 0x00001e54, 0x40a50000, 0x00001e58, \
+   /* 3932 */ 0x40a50000, 0x00001e5c, 0x40a50000, 0x00001e60, \
+   /* 3936 */ 0x40a50000, 0x00001e64, 0x40a50000, 0x00001e68, \
+   /* 3940 */ 0x40a50000, 0x00001e6c, 0x40a50000, 0x00001e70, \
+   /* 3944 */ 0x40a50000, 0x00001e74, 0x40a50000, 0x00001e78, \
+   /* 3948 */ 0x40a50000, 0x00001e7c, 0x40a50000, 0x00001e80, \
+   /* 3952 */ 0x40a50000, 0x00001e84, 0x40a50000, 0x00001e88, \
+   /* 3956 */ 0x40a50000, 0x00001e8c, 0x40a50000, 0x00001e90, \
+   /* 3960 */ 0x40a50000, 0x00001e94, 0x40a50000, 0x00001e98, \
+   /* 3964 */ 0x40a50000, 0x00001e9c, 0x40a50000, 0x00001ea0, \
+   /* 3968 */ 0x40a50000, 0x00001ea4, 0x40a50000, 0x00001ea8, \
+   /* 3972 */ 0x40a50000, 0x00001eac, 0x40a50000, 0x00001eb0, \
+   /* 3976 */ 0x40a50000, 0x00001eb4, 0x40a50000, 0x00001eb8, \
+   /* 3980 */ 0x40a50000, 0x00001ebc, 0x40a50000, 0x00001ec0, \
+   /* 3984 */ 0x40a50000, 0x00001ec4, 0x40a50000, 0x00001ec8, \
+   /* 3988 */ 0x40a50000, 0x00001ecc, 0x40a50000, 0x00001ed0, \
+   /* 3992 */ 0x40a50000, 0x00001ed4, 0x40a50000, 0x00001ed8, \
+   /* 3996 */ 0x40a50000, 0x00001edc, 0x40a50000, 0x00001ee0, \
+   /* 4000 */ 0x40a50000, 0x00001ee4, 0x40a50000, 0x00001ee8, \
+   /* 4004 */ 0x40a50000, 0x00001eec, 0x40a50000, 0x00001ef0, \
+   /* 4008 */ 0x40a50000, 0x00001ef4, 0x40a50000, 0x00001ef8, \
+   /* 4012 */ 0x40a50000, 0x00001efc, 0x40a50000, 0x00001f00, \
+   /* 4016 */ 0x40a50000, 0x00001f04, 0x40a50000, 0x00001f08, \
+   /* 4020 */ 0x40a50000, 0x00001f0c, 0x40a50000, 0x00001f10, \
+   /* 4024 */ 0x40a50000, 0x00001f14, 0x40a50000, 0x00001f18, \
+   /* 4028 */ 0x40a50000, 0x00001f1c, 0x40a50000, 0x00001f20, \
+   /* 4032 */ 0x40a50000, 0x00001f24, 0x40a50000, 0x00001f28, \
+   /* 4036 */ 0x40a50000, 0x00001f2c, 0x40a50000, 0x00001f30, \
+   /* 4040 */ 0x40a50000, 0x00001f34, 0x40a50000, 0x00001f38, \
+   /* 4044 */ 0x40a50000, 0x00001f3c, 0x40a50000, 0x00001f40, \
+   /* 4048 */ 0x40a50000, 0x00001f44, 0x40a50000, 0x00001f48, \
+   /* 4052 */ 0x40a50000, 0x00001f4c, 0x40a50000, 0x00001f50, \
+   /* 4056 */ 0x40a50000, 0x00001f54, 0x40a50000, 0x00001f58, \
+   /* 4060 */ 0x40a50000, 0x00001f5c, 0x40a50000, 0x00001f60, \
+   /* 4064 */ 0x40a50000, 0x00001f64, 0x40a50000, 0x00001f68, \
+   /* 4068 */ 0x40a50000, 0x00001f6c, 0x40a50000, 0x00001f70, \
+   /* 4072 */ 0x40a50000, 0x00001f74, 0x40a50000, 0x00001f78, \
+   /* 4076 */ 0x40a50000, 0x00001f7c, 0x40a50000, 0x00001f80, \
+   /* 4080 */ 0x40a50000, 0x00001f84, 0x40a50000, 0x00001f88, \
+   /* 4084 */ 0x40a50000, 0x00001f8c, 0x40a50000, 0x00001f90, \
+   /* 4088 */ 0x40a50000, 0x00001f94, 0x40a50000, 0x00001f98, \
+   /* 4092 */ 0x40a50000, 0x00001f9c, 0x40a50000, 0x00001fa0, \
+   /* 4096 */ 0x40a50000, 0x00001fa4, 0x40a50000, 0x00001fa8, \
+   /* 4100 */ 0x40a50000, 0x00001fac, 0x40a50000, 0x00001fb0, \
+   /* 4104 */ 0x40a50000, 0x00001fb4, 0x40a50000, 0x00001fb8, \
+   /* 4108 */ 0x40a50000, 0x00001fbc, 0x40a50000, 0x00001fc0, \
+   /* 4112 */ 0x40a50000, 0x00001fc4, 0x40a50000, 0x00001fc8, \
+   /* 4116 */ 0x40a50000, 0x00001fcc, 0x40a50000, 0x00001fd0, \
+   /* 4120 */ 0x40a50000, 0x00001fd4, 0x40a50000, 0x00001fd8, \
+   /* 4124 */ 0x40a50000, 0x00001fdc, 0x40a50000, 0x00001fe0, \
+   /* 4128 */ 0x40a50000, 0x00001fe4, 0x40a50000, 0x00001fe8, \
+   /* 4132 */ 0x40a50000, 0x00001fec, 0x40a50000, 0x00001ff0, \
+   /* 4136 */ 0x40a50000, 0x00001ff4, 0x40a50000, 0x00001ff8, \
+   /* 4140 */ 0x40a50000, 0x00001ffc, 0x40a50000, 0x00002000, \
+   /* 4144 */ 0x40a50000, 0x00002004, 0x40a50000, 0x00002008, \
+   /* 4148 */ 0x40a50000, 0x0000200c, 0x40a50000, 0x00002010, \
+   /* 4152 */ 0x40a50000, 0x00002014, 0x40a50000, 0x00002018, \
+   /* 4156 */ 0x40a50000, 0x0000201c, 0x40a50000, 0x00002020, \
+   /* 4160 */ 0x40a50000, 0x00002024, 0x40a50000, 0x00002028, \
+   /* 4164 */ 0x40a50000, 0x0000202c, 0x40a50000, 0x00002030, \
+   /* 4168 */ 0x40a50000, 0x00002034, 0x40a50000, 0x00002038, \
+   /* 4172 */ 0x40a50000, 0x0000203c, 0x40a50000, 0x00002040, \
+   /* 4176 */ 0x40a50000, 0x00002044, 0x40a50000, 0x00002048, \
+   /* 4180 */ 0x40a50000, 0x0000204c, 0x40a50000, 0x00002050, \
+   /* 4184 */ 0x40a50000, 0x00002054, 0x40a50000, 0x00002058, \
+   /* 4188 */ 0x40a50000, 0x0000205c, 0x40a50000, 0x00002060, \
+   /* 4192 */ 0x40a50000, 0x00002064, 0x40a50000, 0x00002068, \
+   /* 4196 */ 0x40a50000, 0x0000206c, 0x40a50000, 0x00002070, \
+   /* 4200 */ 0x40a50000, 0x00002074, 0x40a50000, 0x00002078, \
+   /* 4204 */ 0x40a50000, 0x0000207c, 0x40a50000, 0x00002080, \
+   /* 4208 */ 0x40a50000, 0x00002084, 0x40a50000, 0x00002088, \
+   /* 4212 */ 0x40a50000, 0x0000208c, 0x40a50000, 0x00002090, \
+   /* 4216 */ 0x40a50000, 0x00002094, 0x40a50000, 0x00002098, \
+   /* 4220 */ 0x40a50000, 0x0000209c, 0x40a50000, 0x000020a0, \
+   /* 4224 */ 0x40a50000, 0x000020a4, 0x40a50000, 0x000020a8, \
+   /* 4228 */ 0x40a50000, 0x000020ac, 0x40a50000, 0x000020b0, \
+   /* 4232 */ 0x40a50000, 0x000020b4, 0x40a50000, 0x000020b8, \
+   /* 4236 */ 0x40a50000, 0x000020bc, 0x40a50000, 0x000020c0, \
+   /* 4240 */ 0x40a50000, 0x000020c4, 0x40a50000, 0x000020c8, \
+   /* 4244 */ 0x40a50000, 0x000020cc, 0x40a50000, 0x000020d0, \
+   /* 4248 */ 0x40a50000, 0x000020d4, 0x40a50000, 0x000020d8, \
+   /* 4252 */ 0x40a50000, 0x000020dc, 0x40a50000, 0x000020e0, \
+   /* 4256 */ 0x40a50000, 0x000020e4, 0x40a50000, 0x000020e8, \
+   /* 4260 */ 0x40a50000, 0x000020ec, 0x40a50000, 0x000020f0, \
+   /* 4264 */ 0x40a50000, 0x000020f4, 0x40a50000, 0x000020f8, \
+   /* 4268 */ 0x40a50000, 0x000020fc, 0x40a50000, 0x00002100, \
+   /* 4272 */ 0x40a50000, 0x00002104, 0x40a50000, 0x00002108, \
+   /* 4276 */ 0x40a50000, 0x0000210c, 0x40a50000, 0x00002110, \
+   /* 4280 */ 0x40a50000, 0x00002114, 0x40a50000, 0x00002118, \
+   /* 4284 */ 0x40a50000, 0x0000211c, 0x40a50000, 0x00002120, \
+   /* 4288 */ 0x40a50000, 0x00002124, 0x40a50000, 0x00002128, \
+   /* 4292 */ 0x40a50000, 0x0000212c, 0x40a50000, 0x00002130, \
+   /* 4296 */ 0x40a50000, 0x00002134, 0x40a50000, 0x00002138, \
+   /* 4300 */ 0x40a50000, 0x0000213c, 0x40a50000, 0x00002140, \
+   /* 4304 */ 0x40a50000, 0x00002144, 0x40a50000, 0x00002148, \
+   /* 4308 */ 0x40a50000, 0x0000214c, 0x40a50000, 0x00002150, \
+   /* 4312 */ 0x40a50000, 0x00002154, 0x40a50000, 0x00002158, \
+   /* 4316 */ 0x40a50000, 0x0000215c, 0x40a50000, 0x00002160, \
+   /* 4320 */ 0x40a50000, 0x00002164, 0x40a50000, 0x00002168, \
+   /* 4324 */ 0x40a50000, 0x0000216c, 0x40a50000, 0x00002170, \
+   /* 4328 */ 0x40a50000, 0x00002174, 0x40a50000, 0x00002178, \
+   /* 4332 */ 0x40a50000, 0x0000217c, 0x40a50000, 0x00002180, \
+   /* 4336 */ 0x40a50000, 0x00002184, 0x40a50000, 0x00002188, \
+   /* 4340 */ 0x40a50000, 0x0000218c, 0x40a50000, 0x00002190, \
+   /* 4344 */ 0x40a50000, 0x00002194, 0x40a50000, 0x00002198, \
+   /* 4348 */ 0x40a50000, 0x0000219c, 0x40a50000, 0x000021a0, \
+   /* 4352 */ 0x40a50000, 0x000021a4, 0x40a50000, 0x000021a8, \
+   /* 4356 */ 0x40a50000, 0x000021ac, 0x40a50000, 0x000021b0, \
+   /* 4360 */ 0x40a50000, 0x000021b4, 0x40a50000, 0x000021b8, \
+   /* 4364 */ 0x40a50000, 0x000021bc, 0x40a50000, 0x000021c0, \
+   /* 4368 */ 0x40a50000, 0x000021c4, 0x40a50000, 0x000021c8, \
+   /* 4372 */ 0x40a50000, 0x000021cc, 0x40a50000, 0x000021d0, \
+   /* 4376 */ 0x40a50000, 0x000021d4, 0x40a50000, 0x000021d8, \
+   /* 4380 */ 0x40a50000, 0x000021dc, 0x40a50000, 0x000021e0, \
+   /* 4384 */ 0x40a50000, 0x000021e4, 0x40a50000, 0x000021e8, \
+   /* 4388 */ 0x40a50000, 0x000021ec, 0x40a50000, 0x000021f0, \
+   /* 4392 */ 0x40a50000, 0x000021f4, 0x40a50000, 0x000021f8, \
+   /* 4396 */ 0x40a50000, 0x000021fc, 0x40a50000, 0x00002200, \
+   /* 4400 */ 0x40a50000, 0x00002204, 0x40a50000, 0x00002208, \
+   /* 4404 */ 0x40a50000, 0x0000220c, 0x40a50000, 0x00002210, \
+   /* 4408 */ 0x40a50000, 0x00002214, 0x40a50000, 0x00002218, \
+   /* 4412 */ 0x40a50000, 0x0000221c, 0x40a50000, 0x00002220, \
+   /* 4416 */ 0x40a50000, 0x00002224, 0x40a50000, 0x00002228, \
+   /* 4420 */ 0x40a50000, 0x0000222c, 0x40a50000, 0x00002230, \
+   /* 4424 */ 0x40a50000, 0x00002234, 0x40a50000, 0x00002238, \
+   /* 4428 */ 0x40a50000, 0x0000223c, 0x40a50000, 0x00002240, \
+   /* 4432 */ 0x40a50000, 0x00002244, 0x40a50000, 0x00002248, \
+   /* 4436 */ 0x40a50000, 0x0000224c, 0x40a50000, 0x00002250, \
+   /* 4440 */ 0x40a50000, 0x00002254, 0x40a50000, 0x00002258, \
+   /* 4444 */ 0x40a50000, 0x0000225c, 0x40a50000, 0x00002260, \
+   /* 4448 */ 0x40a50000, 0x00002264, 0x40a50000, 0x00002268, \
+   /* 4452 */ 0x40a50000, 0x0000226c, 0x40a50000, 0x00002270, \
+   /* 4456 */ 0x40a50000, 0x00002274, 0x40a50000, 0x00002278, \
+   /* 4460 */ 0x40a50000, 0x0000227c, 0x40a50000, 0x00002280, \
+   /* 4464 */ 0x40a50000, 0x00002284, 0x40a50000, 0x00002288, \
+   /* 4468 */ 0x40a50000, 0x0000228c, 0x40a50000, 0x00002290, \
+   /* 4472 */ 0x40a50000, 0x00002294, 0x40a50000, 0x00002298, \
+   /* 4476 */ 0x40a50000, 0x0000229c, 0x40a50000, 0x000022a0, \
+   /* 4480 */ 0x40a50000, 0x000022a4, 0x40a50000, 0x000022a8, \
+   /* 4484 */ 0x40a50000, 0x000022ac, 0x40a50000, 0x000022b0, \
+   /* 4488 */ 0x40a50000, 0x000022b4, 0x40a50000, 0x000022b8, \
+   /* 4492 */ 0x40a50000, 0x000022bc, 0x40a50000, 0x000022c0, \
+   /* 4496 */ 0x40a50000, 0x000022c4, 0x40a50000, 0x000022c8, \
+   /* 4500 */ 0x40a50000, 0x000022cc, 0x40a50000, 0x000022d0, \
+   /* 4504 */ 0x40a50000, 0x000022d4, 0x40a50000, 0x000022d8, \
+   /* 4508 */ 0x40a50000, 0x000022dc, 0x40a50000, 0x000022e0, \
+   /* 4512 */ 0x40a50000, 0x000022e4, 0x40a50000, 0x000022e8, \
+   /* 4516 */ 0x40a50000, 0x000022ec, 0x40a50000, 0x000022f0, \
+   /* 4520 */ 0x40a50000, 0x000022f4, 0x40a50000, 0x000022f8, \
+   /* 4524 */ 0x40a50000, 0x000022fc, 0x40a50000, 0x00002300, \
+   /* 4528 */ 0x40a50000, 0x00002304, 0x40a50000, 0x00002308, \
+   /* 4532 */ 0x40a50000, 0x0000230c, 0x40a50000, 0x00002310, \
+   /* 4536 */ 0x40a50000, 0x00002314, 0x40a50000, 0x00002318, \
+   /* 4540 */ 0x40a50000, 0x0000231c, 0x40a50000, 0x00002320, \
+   /* 4544 */ 0x40a50000, 0x00002324, 0x40a50000, 0x00002328, \
+   /* 4548 */ 0x40a50000, 0x0000232c, 0x40a50000, 0x00002330, \
+   /* 4552 */ 0x40a50000, 0x00002334, 0x40a50000, 0x00002338, \
+   /* 4556 */ 0x40a50000, 0x0000233c, 0x40a50000, 0x00002340, \
+   /* 4560 */ 0x40a50000, 0x00002344, 0x40a50000, 0x00002348, \
+   /* 4564 */ 0x40a50000, 0x0000234c, 0x40a50000, 0x00002350, \
+   /* 4568 */ 0x40a50000, 0x00002354, 0x40a50000, 0x00002358, \
+   /* 4572 */ 0x40a50000, 0x0000235c, 0x40a50000, 0x00002360, \
+   /* 4576 */ 0x40a50000, 0x00002364, 0x40a50000, 0x00002368, \
+   /* 4580 */ 0x40a50000, 0x0000236c, 0x40a50000, 0x00002370, \
+   /* 4584 */ 0x40a50000, 0x00002374, 0x40a50000, 0x00002378, \
+   /* 4588 */ 0x40a50000, 0x0000237c, 0x40a50000, 0x00002380, \
+   /* 4592 */ 0x40a50000, 0x00002384, 0x40a50000, 0x00002388, \
+   /* 4596 */ 0x40a50000, 0x0000238c, 0x40a50000, 0x00002390, \
+   /* 4600 */ 0x40a50000, 0x00002394, 0x40a50000, 0x00002398, \
+   /* 4604 */ 0x40a50000, 0x0000239c, 0x40a50000, 0x000023a0, \
+   /* 4608 */ 0x40a50000, 0x000023a4, 0x40a50000, 0x000023a8, \
+   /* 4612 */ 0x40a50000, 0x000023ac, 0x40a50000, 0x000023b0, \
+   /* 4616 */ 0x40a50000, 0x000023b4, 0x40a50000, 0x000023b8, \
+   /* 4620 */ 0x40a50000, 0x000023bc, 0x40a50000, 0x000023c0, \
+   /* 4624 */ 0x40a50000, 0x000023c4, 0x40a50000, 0x000023c8, \
+   /* 4628 */ 0x40a50000, 0x000023cc, 0x40a50000, 0x000023d0, \
+   /* 4632 */ 0x40a50000, 0x000023d4, 0x40a50000, 0x000023d8, \
+   /* 4636 */ 0x40a50000, 0x000023dc, 0x40a50000, 0x000023e0, \
+   /* 4640 */ 0x40a50000, 0x000023e4, 0x40a50000, 0x000023e8, \
+   /* 4644 */ 0x40a50000, 0x000023ec, 0x40a50000, 0x000023f0, \
+   /* 4648 */ 0x40a50000, 0x000023f4, 0x40a50000, 0x000023f8, \
+   /* 4652 */ 0x40a50000, 0x000023fc, 0x40a50000, 0x00002400, \
+   /* 4656 */ 0x40a50000, 0x00002404, 0x40a50000, 0x00002408, \
+   /* 4660 */ 0x40a50000, 0x0000240c, 0x40a50000, 0x00002410, \
+   /* 4664 */ 0x40a50000, 0x00002414, 0x40a50000, 0x00002418, \
+   /* 4668 */ 0x40a50000, 0x0000241c, 0x40a50000, 0x00002420, \
+   /* 4672 */ 0x40a50000, 0x00002424, 0x40a50000, 0x00002428, \
+   /* 4676 */ 0x40a50000, 0x0000242c, 0x40a50000, 0x00002430, \
+   /* 4680 */ 0x40a50000, 0x00002434, 0x40a50000, 0x00002438, \
+   /* 4684 */ 0x40a50000, 0x0000243c, 0x40a50000, 0x00002440, \
+   /* 4688 */ 0x40a50000, 0x00002444, 0x40a50000, 0x00002448, \
+   /* 4692 */ 0x40a50000, 0x0000244c, 0x40a50000, 0x00002450, \
+   /* 4696 */ 0x40a50000, 0x00002454, 0x40a50000, 0x00002458, \
+   /* 4700 */ 0x40a50000, 0x0000245c, 0x40a50000, 0x00002460, \
+   /* 4704 */ 0x40a50000, 0x00002464, 0x40a50000, 0x00002468, \
+   /* 4708 */ 0x40a50000, 0x0000246c, 0x40a50000, 0x00002470, \
+   /* 4712 */ 0x40a50000, 0x00002474, 0x40a50000, 0x00002478, \
+   /* 4716 */ 0x40a50000, 0x0000247c, 0x40a50000, 0x00002480, \
+   /* 4720 */ 0x40a50000, 0x00002484, 0x40a50000, 0x00002488, \
+   /* 4724 */ 0x40a50000, 0x0000248c, 0x40a50000, 0x00002490, \
+   /* 4728 */ 0x40a50000, 0x00002494, 0x40a50000, 0x00002498, \
+   /* 4732 */ 0x40a50000, 0x0000249c, 0x40a50000, 0x000024a0, \
+   /* 4736 */ 0x40a50000, 0x000024a4, 0x40a50000, 0x000024a8, \
+   /* 4740 */ 0x40a50000, 0x000024ac, 0x40a50000, 0x000024b0, \
+   /* 4744 */ 0x40a50000, 0x000024b4, 0x40a50000, 0x000024b8, \
+   /* 4748 */ 0x40a50000, 0x000024bc, 0x40a50000, 0x000024c0, \
+   /* 4752 */ 0x40a50000, 0x000024c4, 0x40a50000, 0x000024c8, \
+   /* 4756 */ 0x40a50000, 0x000024cc, 0x40a50000, 0x000024d0, \
+   /* 4760 */ 0x40a50000, 0x000024d4, 0x40a50000, 0x000024d8, \
+   /* 4764 */ 0x40a50000, 0x000024dc, 0x40a50000, 0x000024e0, \
+   /* 4768 */ 0x40a50000, 0x000024e4, 0x40a50000, 0x000024e8, \
+   /* 4772 */ 0x40a50000, 0x000024ec, 0x40a50000, 0x000024f0, \
+   /* 4776 */ 0x40a50000, 0x000024f4, 0x40a50000, 0x000024f8, \
+   /* 4780 */ 0x40a50000, 0x000024fc, 0x40a50000, 0x00002500, \
+   /* 4784 */ 0x40a50000, 0x00002504, 0x40a50000, 0x00002508, \
+   /* 4788 */ 0x40a50000, 0x0000250c, 0x40a50000, 0x00002510, \
+   /* 4792 */ 0x40a50000, 0x00002514, 0x40a50000, 0x00002518, \
+   /* 4796 */ 0x40a50000, 0x0000251c, 0x40a50000, 0x00002520, \
+   /* 4800 */ 0x40a50000, 0x00002524, 0x40a50000, 0x00002528, \
+   /* 4804 */ 0x40a50000, 0x0000252c, 0x40a50000, 0x00002530, \
+   /* 4808 */ 0x40a50000, 0x00002534, 0x40a50000, 0x00002538, \
+   /* 4812 */ 0x40a50000, 0x0000253c, 0x40a50000, 0x00002540, \
+   /* 4816 */ 0x40a50000, 0x00002544, 0x40a50000, 0x00002548, \
+   /* 4820 */ 0x40a50000, 0x0000254c, 0x40a50000, 0x00002550, \
+   /* 4824 */ 0x40a50000, 0x00002554, 0x40a50000, 0x00002558, \
+   /* 4828 */ 0x40a50000, 0x0000255c, 0x40a50000, 0x00002560, \
+   /* 4832 */ 0x40a50000, 0x00002564, 0x40a50000, 0x00002568, \
+   /* 4836 */ 0x40a50000, 0x0000256c, 0x40a50000, 0x00002570, \
+   /* 4840 */ 0x40a50000, 0x00002574, 0x40a50000, 0x00002578, \
+   /* 4844 */ 0x40a50000, 0x0000257c, 0x40a50000, 0x00002580, \
+   /* 4848 */ 0x40a50000, 0x00002584, 0x40a50000, 0x00002588, \
+   /* 4852 */ 0x40a50000, 0x0000258c, 0x40a50000, 0x00002590, \
+   /* 4856 */ 0x40a50000, 0x00002594, 0x40a50000, 0x00002598, \
+   /* 4860 */ 0x40a50000, 0x0000259c, 0x40a50000, 0x000025a0, \
+   /* 4864 */ 0x40a50000, 0x000025a4, 0x40a50000, 0x000025a8, \
+   /* 4868 */ 0x40a50000, 0x000025ac, 0x40a50000, 0x000025b0, \
+   /* 4872 */ 0x40a50000, 0x000025b4, 0x40a50000, 0x000025b8, \
+   /* 4876 */ 0x40a50000, 0x000025bc, 0x40a50000, 0x000025c0, \
+   /* 4880 */ 0x40a50000, 0x000025c4, 0x40a50000, 0x000025c8, \
+   /* 4884 */ 0x40a50000, 0x000025cc, 0x40a50000, 0x000025d0, \
+   /* 4888 */ 0x40a50000, 0x000025d4, 0x40a50000, 0x000025d8, \
+   /* 4892 */ 0x40a50000, 0x000025dc, 0x40a50000, 0x000025e0, \
+   /* 4896 */ 0x40a50000, 0x000025e4, 0x40a50000, 0x000025e8, \
+   /* 4900 */ 0x40a50000, 0x000025ec, 0x40a50000, 0x000025f0, \
+   /* 4904 */ 0x40a50000, 0x000025f4, 0x40a50000, 0x000025f8, \
+   /* 4908 */ 0x40a50000, 0x000025fc, 0x40a50000, 0x00002600, \
+   /* 4912 */ 0x40a50000, 0x00002604, 0x40a50000, 0x00002608, \
+   /* 4916 */ 0x40a50000, 0x0000260c, 0x40a50000, 0x00002610, \
+   /* 4920 */ 0x40a50000, 0x00002614, 0x40a50000, 0x00002618, \
+   /* 4924 */ 0x40a50000, 0x0000261c, 0x40a50000, 0x00002620, \
+   /* 4928 */ 0x40a50000, 0x00002624, 0x40a50000, 0x00002628, \
+   /* 4932 */ 0x40a50000, 0x0000262c, 0x40a50000, 0x00002630, \
+   /* 4936 */ 0x40a50000, 0x00002634, 0x40a50000, 0x00002638, \
+   /* 4940 */ 0x40a50000, 0x0000263c, 0x40a50000, 0x00002640, \
+   /* 4944 */ 0x40a50000, 0x00002644, 0x40a50000, 0x00002648, \
+   /* 4948 */ 0x40a50000, 0x0000264c, 0x40a50000, 0x00002650, \
+   /* 4952 */ 0x40a50000, 0x00002654, 0x40a50000, 0x00002658, \
+   /* 4956 */ 0x40a50000, 0x0000265c, 0x40a50000, 0x00002660, \
+   /* 4960 */ 0x40a50000, 0x00002664, 0x40a50000, 0x00002668, \
+   /* 4964 */ 0x40a50000, 0x0000266c, 0x40a50000, 0x00002670, \
+   /* 4968 */ 0x40a50000, 0x00002674, 0x40a50000, 0x00002678, \
+   /* 4972 */ 0x40a50000, 0x0000267c, 0x40a50000, 0x00002680, \
+   /* 4976 */ 0x40a50000, 0x00002684, 0x40a50000, 0x00002688, \
+   /* 4980 */ 0x40a50000, 0x0000268c, 0x40a50000, 0x00002690, \
+   /* 4984 */ 0x40a50000, 0x00002694, 0x40a50000, 0x00002698, \
+   /* 4988 */ 0x40a50000, 0x0000269c, 0x40a50000, 0x000026a0, \
+   /* 4992 */ 0x40a50000, 0x000026a4, 0x40a50000, 0x000026a8, \
+   /* 4996 */ 0x40a50000, 0x000026ac, 0x40a50000, 0x000026b0, \
+   /* 5000 */ 0x40a50000, 0x000026b4, 0x40a50000, 0x000026b8, \
+   /* 5004 */ 0x40a50000, 0x000026bc, 0x40a50000, 0x000026c0, \
+   /* 5008 */ 0x40a50000, 0x000026c4, 0x40a50000, 0x000026c8, \
+   /* 5012 */ 0x40a50000, 0x000026cc, 0x40a50000, 0x000026d0, \
+   /* 5016 */ 0x40a50000, 0x000026d4, 0x40a50000, 0x000026d8, \
+   /* 5020 */ 0x40a50000, 0x000026dc, 0x40a50000, 0x000026e0, \
+   /* 5024 */ 0x40a50000, 0x000026e4, 0x40a50000, 0x000026e8, \
+   /* 5028 */ 0x40a50000, 0x000026ec, 0x40a50000, 0x000026f0, \
+   /* 5032 */ 0x40a50000, 0x000026f4, 0x40a50000, 0x000026f8, \
+   /* 5036 */ 0x40a50000, 0x000026fc, 0x40a50000, 0x00002700, \
+   /* 5040 */ 0x40a50000, 0x00002704, 0x40a50000, 0x00002708, \
+   /* 5044 */ 0x40a50000, 0x0000270c, 0x40a50000, 0x00002710, \
+   /* 5048 */ 0x40a50000, 0x00002714, 0x40a50000, 0x00002718, \
+   /* 5052 */ 0x40a50000, 0x0000271c, 0x40a50000, 0x00002720, \
+   /* 5056 */ 0x40a50000, 0x00002724, 0x40a50000, 0x00002728, \
+   /* 5060 */ 0x40a50000, 0x0000272c, 0x40a50000, 0x00002730, \
+   /* 5064 */ 0x40a50000, 0x00002734, 0x40a50000, 0x00002738, \
+   /* 5068 */ 0x40a50000, 0x0000273c, 0x40a50000, 0x00002740, \
+   /* 5072 */ 0x40a50000, 0x00002744, 0x40a50000, 0x00002748, \
+   /* 5076 */ 0x40a50000, 0x0000274c, 0x40a50000, 0x00002750, \
+   /* 5080 */ 0x40a50000, 0x00002754, 0x40a50000, 0x00002758, \
+   /* 5084 */ 0x40a50000, 0x0000275c, 0x40a50000, 0x00002760, \
+   /* 5088 */ 0x40a50000, 0x00002764, 0x40a50000, 0x00002768, \
+   /* 5092 */ 0x40a50000, 0x0000276c, 0x40a50000, 0x00002770, \
+   /* 5096 */ 0x40a50000, 0x00002774, 0x40a50000, 0x00002778, \
+   /* 5100 */ 0x40a50000, 0x0000277c, 0x40a50000, 0x00002780, \
+   /* 5104 */ 0x40a50000, 0x00002784, 0x40a50000, 0x00002788, \
+   /* 5108 */ 0x40a50000, 0x0000278c, 0x40a50000, 0x00002790, \
+   /* 5112 */ 0x40a50000, 0x00002794, 0x40a50000, 0x00002798, \
+   /* 5116 */ 0x40a50000, 0x0000279c, 0x40a50000, 0x000027a0, \
+   /* 5120 */ 0x40a50000, 0x000027a4, 0x40a50000, 0x000027a8, \
+   /* 5124 */ 0x40a50000, 0x000027ac, 0x40a50000, 0x000027b0, \
+   /* 5128 */ 0x40a50000, 0x000027b4, 0x40a50000, 0x000027b8, \
+   /* 5132 */ 0x40a50000, 0x000027bc, 0x40a50000, 0x000027c0, \
+   /* 5136 */ 0x40a50000, 0x000027c4, 0x40a50000, 0x000027c8, \
+   /* 5140 */ 0x40a50000, 0x000027cc, 0x40a50000, 0x000027d0, \
+   /* 5144 */ 0x40a50000, 0x000027d4, 0x40a50000, 0x000027d8, \
+   /* 5148 */ 0x40a50000, 0x000027dc, 0x40a50000, 0x000027e0, \
+   /* 5152 */ 0x40a50000, 0x000027e4, 0x40a50000, 0x000027e8, \
+   /* 5156 */ 0x40a50000, 0x000027ec, 0x40a50000, 0x000027f0, \
+   /* 5160 */ 0x40a50000, 0x000027f4, 0x40a50000, 0x000027f8, \
+   /* 5164 */ 0x40a50000, 0x000027fc, 0x40a50000, 0x00002800, \
+   /* 5168 */ 0x40a50000, 0x00002804, 0x40a50000, 0x00002808, \
+   /* 5172 */ 0x40a50000, 0x0000280c, 0x40a50000, 0x00002810, \
+   /* 5176 */ 0x40a50000, 0x00002814, 0x40a50000, 0x00002818, \
+   /* 5180 */ 0x40a50000, 0x0000281c, 0x40a50000, 0x00002820, \
+   /* 5184 */ 0x40a50000, 0x00002824, 0x40a50000, 0x00002828, \
+   /* 5188 */ 0x40a50000, 0x0000282c, 0x40a50000, 0x00002830, \
+   /* 5192 */ 0x40a50000, 0x00002834, 0x40a50000, 0x00002838, \
+   /* 5196 */ 0x40a50000, 0x0000283c, 0x40a50000, 0x00002840, \
+   /* 5200 */ 0x40a50000, 0x00002844, 0x40a50000, 0x00002848, \
+   /* 5204 */ 0x40a50000, 0x0000284c, 0x40a50000, 0x00002850, \
+   /* 5208 */ 0x40a50000, 0x00002854, 0x40a50000, 0x00002858, \
+   /* 5212 */ 0x40a50000, 0x0000285c, 0x40a50000, 0x00002860, \
+   /* 5216 */ 0x40a50000, 0x00002864, 0x40a50000, 0x00002868, \
+   /* 5220 */ 0x40a50000, 0x0000286c, 0x40a50000, 0x00002870, \
+   /* 5224 */ 0x40a50000, 0x00002874, 0x40a50000, 0x00002878, \
+   /* 5228 */ 0x40a50000, 0x0000287c, 0x40a50000, 0x00002880, \
+   /* 5232 */ 0x40a50000, 0x00002884, 0x40a50000, 0x00002888, \
+   /* 5236 */ 0x40a50000, 0x0000288c, 0x40a50000, 0x00002890, \
+   /* 5240 */ 0x40a50000, 0x00002894, 0x40a50000, 0x00002898, \
+   /* 5244 */ 0x40a50000, 0x0000289c, 0x40a50000, 0x000028a0, \
+   /* 5248 */ 0x40a50000, 0x000028a4, 0x40a50000, 0x000028a8, \
+   /* 5252 */ 0x40a50000, 0x000028ac, 0x40a50000, 0x000028b0, \
+   /* 5256 */ 0x40a50000, 0x000028b4, 0x40a50000, 0x000028b8, \
+   /* 5260 */ 0x40a50000, 0x000028bc, 0x40a50000, 0x000028c0, \
+   /* 5264 */ 0x40a50000, 0x000028c4, 0x40a50000, 0x000028c8, \
+   /* 5268 */ 0x40a50000, 0x000028cc, 0x40a50000, 0x000028d0, \
+   /* 5272 */ 0x40a50000, 0x000028d4, 0x40a50000, 0x000028d8, \
+   /* 5276 */ 0x40a50000, 0x000028dc, 0x40a50000, 0x000028e0, \
+   /* 5280 */ 0x40a50000, 0x000028e4, 0x40a50000, 0x000028e8, \
+   /* 5284 */ 0x40a50000, 0x000028ec, 0x40a50000, 0x000028f0, \
+   /* 5288 */ 0x40a50000, 0x000028f4, 0x40a50000, 0x000028f8, \
+   /* 5292 */ 0x40a50000, 0x000028fc, 0x40a50000, 0x00002900, \
+   /* 5296 */ 0x40a50000, 0x00002904, 0x40a50000, 0x00002908, \
+   /* 5300 */ 0x40a50000, 0x0000290c, 0x40a50000, 0x00002910, \
+   /* 5304 */ 0x40a50000, 0x00002914, 0x40a50000, 0x00002918, \
+   /* 5308 */ 0x40a50000, 0x0000291c, 0x40a50000, 0x00002920, \
+   /* 5312 */ 0x40a50000, 0x00002924, 0x40a50000, 0x00002928, \
+   /* 5316 */ 0x40a50000, 0x0000292c, 0x40a50000, 0x00002930, \
+   /* 5320 */ 0x40a50000, 0x00002934, 0x40a50000, 0x00002938, \
+   /* 5324 */ 0x40a50000, 0x0000293c, 0x40a50000, 0x00002940, \
+   /* 5328 */ 0x40a50000, 0x00002944, 0x40a50000, 0x00002948, \
+   /* 5332 */ 0x40a50000, 0x0000294c, 0x40a50000, 0x00002950, \
+   /* 5336 */ 0x40a50000, 0x00002954, 0x40a50000, 0x00002958, \
+   /* 5340 */ 0x40a50000, 0x0000295c, 0x40a50000, 0x00002960, \
+   /* 5344 */ 0x40a50000, 0x00002964, 0x40a50000, 0x00002968, \
+   /* 5348 */ 0x40a50000, 0x0000296c, 0x40a50000, 0x00002970, \
+   /* 5352 */ 0x40a50000, 0x00002974, 0x40a50000, 0x00002978, \
+   /* 5356 */ 0x40a50000, 0x0000297c, 0x40a50000, 0x00002980, \
+   /* 5360 */ 0x40a50000, 0x00002984, 0x40a50000, 0x00002988, \
+   /* 5364 */ 0x40a50000, 0x0000298c, 0x40a50000, 0x00002990, \
+   /* 5368 */ 0x40a50000, 0x00002994, 0x40a50000, 0x00002998, \
+   /* 5372 */ 0x40a50000, 0x0000299c, 0x40a50000, 0x000029a0, \
+   /* 5376 */ 0x40a50000, 0x000029a4, 0x40a50000, 0x000029a8, \
+   /* 5380 */ 0x40a50000, 0x000029ac, 0x40a50000, 0x000029b0, \
+   /* 5384 */ 0x40a50000, 0x000029b4, 0x40a50000, 0x000029b8, \
+   /* 5388 */ 0x40a50000, 0x000029bc, 0x40a50000, 0x000029c0, \
+   /* 5392 */ 0x40a50000, 0x000029c4, 0x40a50000, 0x000029c8, \
+   /* 5396 */ 0x40a50000, 0x000029cc, 0x40a50000, 0x000029d0, \
+   /* 5400 */ 0x40a50000, 0x000029d4, 0x40a50000, 0x000029d8, \
+   /* 5404 */ 0x40a50000, 0x000029dc, 0x40a50000, 0x000029e0, \
+   /* 5408 */ 0x40a50000, 0x000029e4, 0x40a50000, 0x000029e8, \
+   /* 5412 */ 0x40a50000, 0x000029ec, 0x40a50000, 0x000029f0, \
+   /* 5416 */ 0x40a50000, 0x000029f4, 0x40a50000, 0x000029f8, \
+   /* 5420 */ 0x40a50000, 0x000029fc, 0x40a50000, 0x00002a00, \
+   /* 5424 */ 0x40a50000, 0x00002a04, 0x40a50000, 0x00002a08, \
+   /* 5428 */ 0x40a50000, 0x00002a0c, 0x40a50000, 0x00002a10, \
+   /* 5432 */ 0x40a50000, 0x00002a14, 0x40a50000, 0x00002a18, \
+   /* 5436 */ 0x40a50000, 0x00002a1c, 0x40a50000, 0x00002a20, \
+   /* 5440 */ 0x40a50000, 0x00002a24, 0x40a50000, 0x00002a28, \
+   /* 5444 */ 0x40a50000, 0x00002a2c, 0x40a50000, 0x00002a30, \
+   /* 5448 */ 0x40a50000, 0x00002a34, 0x40a50000, 0x00002a38, \
+   /* 5452 */ 0x40a50000, 0x00002a3c, 0x40a50000, 0x00002a40, \
+   /* 5456 */ 0x40a50000, 0x00002a44, 0x40a50000, 0x00002a48, \
+   /* 5460 */ 0x40a50000, 0x00002a4c, 0x40a50000, 0x00002a50, \
+   /* 5464 */ 0x40a50000, 0x00002a54, 0x40a50000, 0x00002a58, \
+   /* 5468 */ 0x40a50000, 0x00002a5c, 0x40a50000, 0x00002a60, \
+   /* 5472 */ 0x40a50000, 0x00002a64, 0x40a50000, 0x00002a68, \
+   /* 5476 */ 0x40a50000, 0x00002a6c, 0x40a50000, 0x00002a70, \
+   /* 5480 */ 0x40a50000, 0x00002a74, 0x40a50000, 0x00002a78, \
+   /* 5484 */ 0x40a50000, 0x00002a7c, 0x40a50000, 0x00002a80, \
+   /* 5488 */ 0x40a50000, 0x00002a84, 0x40a50000, 0x00002a88, \
+   /* 5492 */ 0x40a50000, 0x00002a8c, 0x40a50000, 0x00002a90, \
+   /* 5496 */ 0x40a50000, 0x00002a94, 0x40a50000, 0x00002a98, \
+   /* 5500 */ 0x40a50000, 0x00002a9c, 0x40a50000, 0x00002aa0, \
+   /* 5504 */ 0x40a50000, 0x00002aa4, 0x40a50000, 0x00002aa8, \
+   /* 5508 */ 0x40a50000, 0x00002aac, 0x40a50000, 0x00002ab0, \
+   /* 5512 */ 0x40a50000, 0x00002ab4, 0x40a50000, 0x00002ab8, \
+   /* 5516 */ 0x40a50000, 0x00002abc, 0x40a50000, 0x00002ac0, \
+   /* 5520 */ 0x40a50000, 0x00002ac4, 0x40a50000, 0x00002ac8, \
+   /* 5524 */ 0x40a50000, 0x00002acc, 0x40a50000, 0x00002ad0, \
+   /* 5528 */ 0x40a50000, 0x00002ad4, 0x40a50000, 0x00002ad8, \
+   /* 5532 */ 0x40a50000, 0x00002adc, 0x40a50000, 0x00002ae0, \
+   /* 5536 */ 0x40a50000, 0x00002ae4, 0x40a50000, 0x00002ae8, \
+   /* 5540 */ 0x40a50000, 0x00002aec, 0x40a50000, 0x00002af0, \
+   /* 5544 */ 0x40a50000, 0x00002af4, 0x40a50000, 0x00002af8, \
+   /* 5548 */ 0x40a50000, 0x00002afc, 0x40a50000, 0x00002b00, \
+   /* 5552 */ 0x40a50000, 0x00002b04, 0x40a50000, 0x00002b08, \
+   /* 5556 */ 0x40a50000, 0x00002b0c, 0x40a50000, 0x00002b10, \
+   /* 5560 */ 0x40a50000, 0x00002b14, 0x40a50000, 0x00002b18, \
+   /* 5564 */ 0x40a50000, 0x00002b1c, 0x40a50000, 0x00002b20, \
+   /* 5568 */ 0x40a50000, 0x00002b24, 0x40a50000, 0x00002b28, \
+   /* 5572 */ 0x40a50000, 0x00002b2c, 0x40a50000, 0x00002b30, \
+   /* 5576 */ 0x40a50000, 0x00002b34, 0x40a50000, 0x00002b38, \
+   /* 5580 */ 0x40a50000, 0x00002b3c, 0x40a50000, 0x00002b40, \
+   /* 5584 */ 0x40a50000, 0x00002b44, 0x40a50000, 0x00002b48, \
+   /* 5588 */ 0x40a50000, 0x00002b4c, 0x40a50000, 0x00002b50, \
+   /* 5592 */ 0x40a50000, 0x00002b54, 0x40a50000, 0x00002b58, \
+   /* 5596 */ 0x40a50000, 0x00002b5c, 0x40a50000, 0x00002b60, \
+   /* 5600 */ 0x40a50000, 0x00002b64, 0x40a50000, 0x00002b68, \
+   /* 5604 */ 0x40a50000, 0x00002b6c, 0x40a50000, 0x00002b70, \
+   /* 5608 */ 0x40a50000, 0x00002b74, 0x40a50000, 0x00002b78, \
+   /* 5612 */ 0x40a50000, 0x00002b7c, 0x40a50000, 0x00002b80, \
+   /* 5616 */ 0x40a50000, 0x00002b84, 0x40a50000, 0x00002b88, \
+   /* 5620 */ 0x40a50000, 0x00002b8c, 0x40a50000, 0x00002b90, \
+   /* 5624 */ 0x40a50000, 0x00002b94, 0x40a50000, 0x00002b98, \
+   /* 5628 */ 0x40a50000, 0x00002b9c, 0x40a50000, 0x00002ba0, \
+   /* 5632 */ 0x40a50000, 0x00002ba4, 0x40a50000, 0x00002ba8, \
+   /* 5636 */ 0x40a50000, 0x00002bac, 0x40a50000, 0x00002bb0, \
+   /* 5640 */ 0x40a50000, 0x00002bb4, 0x40a50000, 0x00002bb8, \
+   /* 5644 */ 0x40a50000, 0x00002bbc, 0x40a50000, 0x00002bc0, \
+   /* 5648 */ 0x40a50000, 0x00002bc4, 0x40a50000, 0x00002bc8, \
+   /* 5652 */ 0x40a50000, 0x00002bcc, 0x40a50000, 0x00002bd0, \
+   /* 5656 */ 0x40a50000, 0x00002bd4, 0x40a50000, 0x00002bd8, \
+   /* 5660 */ 0x40a50000, 0x00002bdc, 0x40a50000, 0x00002be0, \
+   /* 5664 */ 0x40a50000, 0x00002be4, 0x40a50000, 0x00002be8, \
+   /* 5668 */ 0x40a50000, 0x00002bec, 0x40a50000, 0x00002bf0, \
+   /* 5672 */ 0x40a50000, 0x00002bf4, 0x40a50000, 0x00002bf8, \
+   /* 5676 */ 0x40a50000, 0x00002bfc, 0x40a50000, 0x00002c00, \
+   /* 5680 */ 0x40a50000, 0x00002c04, 0x40a50000, 0x00002c08, \
+   /* 5684 */ 0x40a50000, 0x00002c0c, 0x40a50000, 0x00002c10, \
+   /* 5688 */ 0x40a50000, 0x00002c14, 0x40a50000, 0x00002c18, \
+   /* 5692 */ 0x40a50000, 0x00002c1c, 0x40a50000, 0x00002c20, \
+   /* 5696 */ 0x40a50000, 0x00002c24, 0x40a50000, 0x00002c28, \
+   /* 5700 */ 0x40a50000, 0x00002c2c, 0x40a50000, 0x00002c30, \
+   /* 5704 */ 0x40a50000, 0x00002c34, 0x40a50000, 0x00002c38, \
+   /* 5708 */ 0x40a50000, 0x00002c3c, 0x40a50000, 0x00002c40, \
+   /* 5712 */ 0x40a50000, 0x00002c44, 0x40a50000, 0x00002c48, \
+   /* 5716 */ 0x40a50000, 0x00002c4c, 0x40a50000, 0x00002c50, \
+   /* 5720 */ 0x40a50000, 0x00002c54, 0x40a50000, 0x00002c58, \
+   /* 5724 */ 0x40a50000, 0x00002c5c, 0x40a50000, 0x00002c60, \
+   /* 5728 */ 0x40a50000, 0x00002c64, 0x40a50000, 0x00002c68, \
+   /* 5732 */ 0x40a50000, 0x00002c6c, 0x40a50000, 0x00002c70, \
+   /* 5736 */ 0x40a50000, 0x00002c74, 0x40a50000, 0x00002c78, \
+   /* 5740 */ 0x40a50000, 0x00002c7c, 0x40a50000, 0x00002c80, \
+   /* 5744 */ 0x40a50000, 0x00002c84, 0x40a50000, 0x00002c88, \
+   /* 5748 */ 0x40a50000, 0x00002c8c, 0x40a50000, 0x00002c90, \
+   /* 5752 */ 0x40a50000, 0x00002c94, 0x40a50000, 0x00002c98, \
+   /* 5756 */ 0x40a50000, 0x00002c9c, 0x40a50000, 0x00002ca0, \
+   /* 5760 */ 0x40a50000, 0x00002ca4, 0x40a50000, 0x00002ca8, \
+   /* 5764 */ 0x40a50000, 0x00002cac, 0x40a50000, 0x00002cb0, \
+   /* 5768 */ 0x40a50000, 0x00002cb4, 0x40a50000, 0x00002cb8, \
+   /* 5772 */ 0x40a50000, 0x00002cbc, 0x40a50000, 0x00002cc0, \
+   /* 5776 */ 0x40a50000, 0x00002cc4, 0x40a50000, 0x00002cc8, \
+   /* 5780 */ 0x40a50000, 0x00002ccc, 0x40a50000, 0x00002cd0, \
+   /* 5784 */ 0x40a50000, 0x00002cd4, 0x40a50000, 0x00002cd8, \
+   /* 5788 */ 0x40a50000, 0x00002cdc, 0x40a50000, 0x00002ce0, \
+   /* 5792 */ 0x40a50000, 0x00002ce4, 0x40a50000, 0x00002ce8, \
+   /* 5796 */ 0x40a50000, 0x00002cec, 0x40a50000, 0x00002cf0, \
+   /* 5800 */ 0x40a50000, 0x00002cf4, 0x40a50000, 0x00002cf8, \
+   /* 5804 */ 0x40a50000, 0x00002cfc, 0x40a50000, 0x00002d00, \
+   /* 5808 */ 0x40a50000, 0x00002d04, 0x40a50000, 0x00002d08, \
+   /* 5812 */ 0x40a50000, 0x00002d0c, 0x40a50000, 0x00002d10, \
+   /* 5816 */ 0x40a50000, 0x00002d14, 0x40a50000, 0x00002d18, \
+   /* 5820 */ 0x40a50000, 0x00002d1c, 0x40a50000, 0x00002d20, \
+   /* 5824 */ 0x40a50000, 0x00002d24, 0x40a50000, 0x00002d28, \
+   /* 5828 */ 0x40a50000, 0x00002d2c, 0x40a50000, 0x00002d30, \
+   /* 5832 */ 0x40a50000, 0x00002d34, 0x40a50000, 0x00002d38, \
+   /* 5836 */ 0x40a50000, 0x00002d3c, 0x40a50000, 0x00002d40, \
+   /* 5840 */ 0x40a50000, 0x00002d44, 0x40a50000, 0x00002d48, \
+   /* 5844 */ 0x40a50000, 0x00002d4c, 0x40a50000, 0x00002d50, \
+   /* 5848 */ 0x40a50000, 0x00002d54, 0x40a50000, 0x00002d58, \
+   /* 5852 */ 0x40a50000, 0x00002d5c, 0x40a50000, 0x00002d60, \
+   /* 5856 */ 0x40a50000, 0x00002d64, 0x40a50000, 0x00002d68, \
+   /* 5860 */ 0x40a50000, 0x00002d6c, 0x40a50000, 0x00002d70, \
+   /* 5864 */ 0x40a50000, 0x00002d74, 0x40a50000, 0x00002d78, \
+   /* 5868 */ 0x40a50000, 0x00002d7c, 0x40a50000, 0x00002d80, \
+   /* 5872 */ 0x40a50000, 0x00002d84, 0x40a50000, 0x00002d88, \
+   /* 5876 */ 0x40a50000, 0x00002d8c, 0x40a50000, 0x00002d90, \
+   /* 5880 */ 0x40a50000, 0x00002d94, 0x40a50000, 0x00002d98, \
+   /* 5884 */ 0x40a50000, 0x00002d9c, 0x40a50000, 0x00002da0, \
+   /* 5888 */ 0x40a50000, 0x00002da4, 0x40a50000, 0x00002da8, \
+   /* 5892 */ 0x40a50000, 0x00002dac, 0x40a50000, 0x00002db0, \
+   /* 5896 */ 0x40a50000, 0x00002db4, 0x40a50000, 0x00002db8, \
+   /* 5900 */ 0x40a50000, 0x00002dbc, 0x40a50000, 0x00002dc0, \
+   /* 5904 */ 0x40a50000, 0x00002dc4, 0x40a50000, 0x00002dc8, \
+   /* 5908 */ 0x40a50000, 0x00002dcc, 0x40a50000, 0x00002dd0, \
+   /* 5912 */ 0x40a50000, 0x00002dd4, 0x40a50000, 0x00002dd8, \
+   /* 5916 */ 0x40a50000, 0x00002ddc, 0x40a50000, 0x00002de0, \
+   /* 5920 */ 0x40a50000, 0x00002de4, 0x40a50000, 0x00002de8, \
+   /* 5924 */ 0x40a50000, 0x00002dec, 0x40a50000, 0x00002df0, \
+   /* 5928 */ 0x40a50000, 0x00002df4, 0x40a50000, 0x00002df8, \
+   /* 5932 */ 0x40a50000, 0x00002dfc, 0x40a50000, 0x00002e00, \
+   /* 5936 */ 0x40a50000, 0x00002e04, 0x40a50000, 0x00002e08, \
+   /* 5940 */ 0x40a50000, 0x00002e0c, 0x40a50000, 0x00002e10, \
+   /* 5944 */ 0x40a50000, 0x00002e14, 0x40a50000, 0x00002e18, \
+   /* 5948 */ 0x40a50000, 0x00002e1c, 0x40a50000, 0x00002e20, \
+   /* 5952 */ 0x40a50000, 0x00002e24, 0x40a50000, 0x00002e28, \
+   /* 5956 */ 0x40a50000, 0x00002e2c, 0x40a50000, 0x00002e30, \
+   /* 5960 */ 0x40a50000, 0x00002e34, 0x40a50000, 0x00002e38, \
+   /* 5964 */ 0x40a50000, 0x00002e3c, 0x40a50000, 0x00002e40, \
+   /* 5968 */ 0x40a50000, 0x00002e44, 0x40a50000, 0x00002e48, \
+   /* 5972 */ 0x40a50000, 0x00002e4c, 0x40a50000, 0x00002e50, \
+   /* 5976 */ 0x40a50000, 0x00002e54, 0x40a50000, 0x00002e58, \
+   /* 5980 */ 0x40a50000, 0x00002e5c, 0x40a50000, 0x00002e60, \
+   /* 5984 */ 0x40a50000, 0x00002e64, 0x40a50000, 0x00002e68, \
+   /* 5988 */ 0x40a50000, 0x00002e6c, 0x40a50000, 0x00002e70, \
+   /* 5992 */ 0x40a50000, 0x00002e74, 0x40a50000, 0x00002e78, \
+   /* 5996 */ 0x40a50000, 0x00002e7c, 0x40a50000, 0x00002e80, \
+   /* 6000 */ 0x40a50000, 0x00002e84, 0x40a50000, 0x00002e88, \
+   /* 6004 */ 0x40a50000, 0x00002e8c, 0x40a50000, 0x00002e90, \
+   /* 6008 */ 0x40a50000, 0x00002e94, 0x40a50000, 0x00002e98, \
+   /* 6012 */ 0x40a50000, 0x00002e9c, 0x40a50000, 0x00002ea0, \
+   /* 6016 */ 0x40a50000, 0x00002ea4, 0x40a50000, 0x00002ea8, \
+   /* 6020 */ 0x40a50000, 0x00002eac, 0x40a50000, 0x00002eb0, \
+   /* 6024 */ 0x40a50000, 0x00002eb4, 0x40a50000, 0x00002eb8, \
+   /* 6028 */ 0x40a50000, 0x00002ebc, 0x40a50000, 0x00002ec0, \
+   /* 6032 */ 0x40a50000, 0x00002ec4, 0x40a50000, 0x00002ec8, \
+   /* 6036 */ 0x40a50000, 0x00002ecc, 0x40a50000, 0x00002ed0, \
+   /* 6040 */ 0x40a50000, 0x00002ed4, 0x40a50000, 0x00002ed8, \
+   /* 6044 */ 0x40a50000, 0x00002edc, 0x40a50000, 0x00002ee0, \
+   /* 6048 */ 0x40a50000, 0x00002ee4, 0x40a50000, 0x00002ee8, \
+   /* 6052 */ 0x40a50000, 0x00002eec, 0x40a50000, 0x00002ef0, \
+   /* 6056 */ 0x40a50000, 0x00002ef4, 0x40a50000, 0x00002ef8, \
+   /* 6060 */ 0x40a50000, 0x00002efc, 0x40a50000, 0x00002f00, \
+   /* 6064 */ 0x40a50000, 0x00002f04, 0x40a50000, 0x00002f08, \
+   /* 6068 */ 0x40a50000, 0x00002f0c, 0x40a50000, 0x00002f10, \
+   /* 6072 */ 0x40a50000, 0x00002f14, 0x40a50000, 0x00002f18, \
+   /* 6076 */ 0x40a50000, 0x00002f1c, 0x40a50000, 0x00002f20, \
+   /* 6080 */ 0x40a50000, 0x00002f24, 0x40a50000, 0x00002f28, \
+   /* 6084 */ 0x40a50000, 0x00002f2c, 0x40a50000, 0x00002f30, \
+   /* 6088 */ 0x40a50000, 0x00002f34, 0x40a50000, 0x00002f38, \
+   /* 6092 */ 0x40a50000, 0x00002f3c, 0x40a50000, 0x00002f40, \
+   /* 6096 */ 0x40a50000, 0x00002f44, 0x40a50000, 0x00002f48, \
+   /* 6100 */ 0x40a50000, 0x00002f4c, 0x40a50000, 0x00002f50, \
+   /* 6104 */ 0x40a50000, 0x00002f54, 0x40a50000, 0x00002f58, \
+   /* 6108 */ 0x40a50000, 0x00002f5c, 0x40a50000, 0x00002f60, \
+   /* 6112 */ 0x40a50000, 0x00002f64, 0x40a50000, 0x00002f68, \
+   /* 6116 */ 0x40a50000, 0x00002f6c, 0x40a50000, 0x00002f70, \
+   /* 6120 */ 0x40a50000, 0x00002f74, 0x40a50000, 0x00002f78, \
+   /* 6124 */ 0x40a50000, 0x00002f7c, 0x40a50000, 0x00002f80, \
+   /* 6128 */ 0x40a50000, 0x00002f84, 0x40a50000, 0x00002f88, \
+   /* 6132 */ 0x40a50000, 0x00002f8c, 0x40a50000, 0x00002f90, \
+   /* 6136 */ 0x40a50000, 0x00002f94, 0x40a50000, 0x00002f98, \
+   /* 6140 */ 0x40a50000, 0x00002f9c, 0x40a50000, 0x00002fa0, \
+   /* 6144 */ 0x40a50000, 0x00002fa4, 0x40a50000, 0x00002fa8, \
+   /* 6148 */ 0x40a50000, 0x00002fac, 0x40a50000, 0x00002fb0, \
+   /* 6152 */ 0x40a50000, 0x00002fb4, 0x40a50000, 0x00002fb8, \
+   /* 6156 */ 0x40a50000, 0x00002fbc, 0x40a50000, 0x00002fc0, \
+   /* 6160 */ 0x40a50000, 0x00002fc4, 0x40a50000, 0x00002fc8, \
+   /* 6164 */ 0x40a50000, 0x00002fcc, 0x40a50000, 0x00002fd0, \
+   /* 6168 */ 0x40a50000, 0x00002fd4, 0x40a50000, 0x00002fd8, \
+   /* 6172 */ 0x40a50000, 0x00002fdc, 0x40a50000, 0x00002fe0, \
+   /* 6176 */ 0x40a50000, 0x00002fe4, 0x40a50000, 0x00002fe8, \
+   /* 6180 */ 0x40a50000, 0x00002fec, 0x40a50000, 0x00002ff0, \
+   /* 6184 */ 0x40a50000, 0x00002ff4, 0x40a50000, 0x00002ff8, \
+   /* 6188 */ 0x40a50000, 0x00002ffc, 0x40a50000, 0x00003000, \
+   /* 6192 */ 0x40a50000, 0x00003004, 0x40a50000, 0x00003008, \
+   /* 6196 */ 0x40a50000, 0x0000300c, 0x40a50000, 0x00003010, \
+   /* 6200 */ 0x40a50000, 0x00003014, 0x40a50000, 0x00003018, \
+   /* 6204 */ 0x40a50000, 0x0000301c, 0x40a50000, 0x00003020, \
+   /* 6208 */ 0x40a50000, 0x00003024, 0x40a50000, 0x00003028, \
+   /* 6212 */ 0x40a50000, 0x0000302c, 0x40a50000, 0x00003030, \
+   /* 6216 */ 0x40a50000, 0x00003034, 0x40a50000, 0x00003038, \
+   /* 6220 */ 0x40a50000, 0x0000303c, 0x40a50000, 0x00003040, \
+   /* 6224 */ 0x40a50000, 0x00003044, 0x40a50000, 0x00003048, \
+   /* 6228 */ 0x40a50000, 0x0000304c, 0x40a50000, 0x00003050, \
+   /* 6232 */ 0x40a50000, 0x00003054, 0x40a50000, 0x00003058, \
+   /* 6236 */ 0x40a50000, 0x0000305c, 0x40a50000, 0x00003060, \
+   /* 6240 */ 0x40a50000, 0x00003064, 0x40a50000, 0x00003068, \
+   /* 6244 */ 0x40a50000, 0x0000306c, 0x40a50000, 0x00003070, \
+   /* 6248 */ 0x40a50000, 0x00003074, 0x40a50000, 0x00003078, \
+   /* 6252 */ 0x40a50000, 0x0000307c, 0x40a50000, 0x00003080, \
+   /* 6256 */ 0x40a50000, 0x00003084, 0x40a50000, 0x00003088, \
+   /* 6260 */ 0x40a50000, 0x0000308c, 0x40a50000, 0x00003090, \
+   /* 6264 */ 0x40a50000, 0x00003094, 0x40a50000, 0x00003098, \
+   /* 6268 */ 0x40a50000, 0x0000309c, 0x40a50000, 0x000030a0, \
+   /* 6272 */ 0x40a50000, 0x000030a4, 0x40a50000, 0x000030a8, \
+   /* 6276 */ 0x40a50000, 0x000030ac, 0x40a50000, 0x000030b0, \
+   /* 6280 */ 0x40a50000, 0x000030b4, 0x40a50000, 0x000030b8, \
+   /* 6284 */ 0x40a50000, 0x000030bc, 0x40a50000, 0x000030c0, \
+   /* 6288 */ 0x40a50000, 0x000030c4, 0x40a50000, 0x000030c8, \
+   /* 6292 */ 0x40a50000, 0x000030cc, 0x40a50000, 0x000030d0, \
+   /* 6296 */ 0x40a50000, 0x000030d4, 0x40a50000, 0x000030d8, \
+   /* 6300 */ 0x40a50000, 0x000030dc, 0x40a50000, 0x000030e0, \
+   /* 6304 */ 0x40a50000, 0x000030e4, 0x40a50000, 0x000030e8, \
+   /* 6308 */ 0x40a50000, 0x000030ec, 0x40a50000, 0x000030f0, \
+   /* 6312 */ 0x40a50000, 0x000030f4, 0x40a50000, 0x000030f8, \
+   /* 6316 */ 0x40a50000, 0x000030fc, 0x40a50000, 0x00003100, \
+   /* 6320 */ 0x40a50000, 0x00003104, 0x40a50000, 0x00003108, \
+   /* 6324 */ 0x40a50000, 0x0000310c, 0x40a50000, 0x00003110, \
+   /* 6328 */ 0x40a50000, 0x00003114, 0x40a50000, 0x00003118, \
+   /* 6332 */ 0x40a50000, 0x0000311c, 0x40a50000, 0x00003120, \
+   /* 6336 */ 0x40a50000, 0x00003124, 0x40a50000, 0x00003128, \
+   /* 6340 */ 0x40a50000, 0x0000312c, 0x40a50000, 0x00003130, \
+   /* 6344 */ 0x40a50000, 0x00003134, 0x40a50000, 0x00003138, \
+   /* 6348 */ 0x40a50000, 0x0000313c, 0x40a50000, 0x00003140, \
+   /* 6352 */ 0x40a50000, 0x00003144, 0x40a50000, 0x00003148, \
+   /* 6356 */ 0x40a50000, 0x0000314c, 0x40a50000, 0x00003150, \
+   /* 6360 */ 0x40a50000, 0x00003154, 0x40a50000, 0x00003158, \
+   /* 6364 */ 0x40a50000, 0x0000315c, 0x40a50000, 0x00003160, \
+   /* 6368 */ 0x40a50000, 0x00003164, 0x40a50000, 0x00003168, \
+   /* 6372 */ 0x40a50000, 0x0000316c, 0x40a50000, 0x00003170, \
+   /* 6376 */ 0x40a50000, 0x00003174, 0x40a50000, 0x00003178, \
+   /* 6380 */ 0x40a50000, 0x0000317c, 0x40a50000, 0x00003180, \
+   /* 6384 */ 0x40a50000, 0x00003184, 0x40a50000, 0x00003188, \
+   /* 6388 */ 0x40a50000, 0x0000318c, 0x40a50000, 0x00003190, \
+   /* 6392 */ 0x40a50000, 0x00003194, 0x40a50000, 0x00003198, \
+   /* 6396 */ 0x40a50000, 0x0000319c, 0x40a50000, 0x000031a0, \
+   /* 6400 */ 0x40a50000, 0x000031a4, 0x40a50000, 0x000031a8, \
+   /* 6404 */ 0x40a50000, 0x000031ac, 0x40a50000, 0x000031b0, \
+   /* 6408 */ 0x40a50000, 0x000031b4, 0x40a50000, 0x000031b8, \
+   /* 6412 */ 0x40a50000, 0x000031bc, 0x40a50000, 0x000031c0, \
+   /* 6416 */ 0x40a50000, 0x000031c4, 0x40a50000, 0x000031c8, \
+   /* 6420 */ 0x40a50000, 0x000031cc, 0x40a50000, 0x000031d0, \
+   /* 6424 */ 0x40a50000, 0x000031d4, 0x40a50000, 0x000031d8, \
+   /* 6428 */ 0x40a50000, 0x000031dc, 0x40a50000, 0x000031e0, \
+   /* 6432 */ 0x40a50000, 0x000031e4, 0x40a50000, 0x000031e8, \
+   /* 6436 */ 0x40a50000, 0x000031ec, 0x40a50000, 0x000031f0, \
+   /* 6440 */ 0x40a50000, 0x000031f4, 0x40a50000, 0x000031f8, \
+   /* 6444 */ 0x40a50000, 0x000031fc, 0x40a50000, 0x00003200, \
+   /* 6448 */ 0x40a50000, 0x00003204, 0x40a50000, 0x00003208, \
+   /* 6452 */ 0x40a50000, 0x0000320c, 0x40a50000, 0x00003210, \
+   /* 6456 */ 0x40a50000, 0x00003214, 0x40a50000, 0x00003218, \
+   /* 6460 */ 0x40a50000, 0x0000321c, 0x40a50000, 0x00003220, \
+   /* 6464 */ 0x40a50000, 0x00003224, 0x40a50000, 0x00003228, \
+   /* 6468 */ 0x40a50000, 0x0000322c, 0x40a50000, 0x00003230, \
+   /* 6472 */ 0x40a50000, 0x00003234, 0x40a50000, 0x00003238, \
+   /* 6476 */ 0x40a50000, 0x0000323c, 0x40a50000, 0x00003240, \
+   /* 6480 */ 0x40a50000, 0x00003244, 0x40a50000, 0x00003248, \
+   /* 6484 */ 0x40a50000, 0x0000324c, 0x40a50000, 0x00003250, \
+   /* 6488 */ 0x40a50000, 0x00003254, 0x40a50000, 0x00003258, \
+   /* 6492 */ 0x40a50000, 0x0000325c, 0x40a50000, 0x00003260, \
+   /* 6496 */ 0x40a50000, 0x00003264, 0x40a50000, 0x00003268, \
+   /* 6500 */ 0x40a50000, 0x0000326c, 0x40a50000, 0x00003270, \
+   /* 6504 */ 0x40a50000, 0x00003274, 0x40a50000, 0x00003278, \
+   /* 6508 */ 0x40a50000, 0x0000327c, 0x40a50000, 0x00003280, \
+   /* 6512 */ 0x40a50000, 0x00003284, 0x40a50000, 0x00003288, \
+   /* 6516 */ 0x40a50000, 0x0000328c, 0x40a50000, 0x00003290, \
+   /* 6520 */ 0x40a50000, 0x00003294, 0x40a50000, 0x00003298, \
+   /* 6524 */ 0x40a50000, 0x0000329c, 0x40a50000, 0x000032a0, \
+   /* 6528 */ 0x40a50000, 0x000032a4, 0x40a50000, 0x000032a8, \
+   /* 6532 */ 0x40a50000, 0x000032ac, 0x40a50000, 0x000032b0, \
+   /* 6536 */ 0x40a50000, 0x000032b4, 0x40a50000, 0x000032b8, \
+   /* 6540 */ 0x40a50000, 0x000032bc, 0x40a50000, 0x000032c0, \
+   /* 6544 */ 0x40a50000, 0x000032c4, 0x40a50000, 0x000032c8, \
+   /* 6548 */ 0x40a50000, 0x000032cc, 0x40a50000, 0x000032d0, \
+   /* 6552 */ 0x40a50000, 0x000032d4, 0x40a50000, 0x000032d8, \
+   /* 6556 */ 0x40a50000, 0x000032dc, 0x40a50000, 0x000032e0, \
+   /* 6560 */ 0x40a50000, 0x000032e4, 0x40a50000, 0x000032e8, \
+   /* 6564 */ 0x40a50000, 0x000032ec, 0x40a50000, 0x000032f0, \
+   /* 6568 */ 0x40a50000, 0x000032f4, 0x40a50000, 0x000032f8, \
+   /* 6572 */ 0x40a50000, 0x000032fc, 0x40a50000, 0x00003300, \
+   /* 6576 */ 0x40a50000, 0x00003304, 0x40a50000, 0x00003308, \
+   /* 6580 */ 0x40a50000, 0x0000330c, 0x40a50000, 0x00003310, \
+   /* 6584 */ 0x40a50000, 0x00003314, 0x40a50000, 0x00003318, \
+   /* 6588 */ 0x40a50000, 0x0000331c, 0x40a50000, 0x00003320, \
+   /* 6592 */ 0x40a50000, 0x00003324, 0x40a50000, 0x00003328, \
+   /* 6596 */ 0x40a50000, 0x0000332c, 0x40a50000, 0x00003330, \
+   /* 6600 */ 0x40a50000, 0x00003334, 0x40a50000, 0x00003338, \
+   /* 6604 */ 0x40a50000, 0x0000333c, 0x40a50000, 0x00003340, \
+   /* 6608 */ 0x40a50000, 0x00003344, 0x40a50000, 0x00003348, \
+   /* 6612 */ 0x40a50000, 0x0000334c, 0x40a50000, 0x00003350, \
+   /* 6616 */ 0x40a50000, 0x00003354, 0x40a50000, 0x00003358, \
+   /* 6620 */ 0x40a50000, 0x0000335c, 0x40a50000, 0x00003360, \
+   /* 6624 */ 0x40a50000, 0x00003364, 0x40a50000, 0x00003368, \
+   /* 6628 */ 0x40a50000, 0x0000336c, 0x40a50000, 0x00003370, \
+   /* 6632 */ 0x40a50000, 0x00003374, 0x40a50000, 0x00003378, \
+   /* 6636 */ 0x40a50000, 0x0000337c, 0x40a50000, 0x00003380, \
+   /* 6640 */ 0x40a50000, 0x00003384, 0x40a50000, 0x00003388, \
+   /* 6644 */ 0x40a50000, 0x0000338c, 0x40a50000, 0x00003390, \
+   /* 6648 */ 0x40a50000, 0x00003394, 0x40a50000, 0x00003398, \
+   /* 6652 */ 0x40a50000, 0x0000339c, 0x40a50000, 0x000033a0, \
+   /* 6656 */ 0x40a50000, 0x000033a4, 0x40a50000, 0x000033a8, \
+   /* 6660 */ 0x40a50000, 0x000033ac, 0x40a50000, 0x000033b0, \
+   /* 6664 */ 0x40a50000, 0x000033b4, 0x40a50000, 0x000033b8, \
+   /* 6668 */ 0x40a50000, 0x000033bc, 0x40a50000, 0x000033c0, \
+   /* 6672 */ 0x40a50000, 0x000033c4, 0x40a50000, 0x000033c8, \
+   /* 6676 */ 0x40a50000, 0x000033cc, 0x40a50000, 0x000033d0, \
+   /* 6680 */ 0x40a50000, 0x000033d4, 0x40a50000, 0x000033d8, \
+   /* 6684 */ 0x40a50000, 0x000033dc, 0x40a50000, 0x000033e0, \
+   /* 6688 */ 0x40a50000, 0x000033e4, 0x40a50000, 0x000033e8, \
+   /* 6692 */ 0x40a50000, 0x000033ec, 0x40a50000, 0x000033f0, \
+   /* 6696 */ 0x40a50000, 0x000033f4, 0x40a50000, 0x000033f8, \
+   /* 6700 */ 0x40a50000, 0x000033fc, 0x40a50000, 0x00003400, \
+   /* 6704 */ 0x40a50000, 0x00003404, 0x40a50000, 0x00003408, \
+   /* 6708 */ 0x40a50000, 0x0000340c, 0x40a50000, 0x00003410, \
+   /* 6712 */ 0x40a50000, 0x00003414, 0x40a50000, 0x00003418, \
+   /* 6716 */ 0x40a50000, 0x0000341c, 0x40a50000, 0x00003420, \
+   /* 6720 */ 0x40a50000, 0x00003424, 0x40a50000, 0x00003428, \
+   /* 6724 */ 0x40a50000, 0x0000342c, 0x40a50000, 0x00003430, \
+   /* 6728 */ 0x40a50000, 0x00003434, 0x40a50000, 0x00003438, \
+   /* 6732 */ 0x40a50000, 0x0000343c, 0x40a50000, 0x00003440, \
+   /* 6736 */ 0x40a50000, 0x00003444, 0x40a50000, 0x00003448, \
+   /* 6740 */ 0x40a50000, 0x0000344c, 0x40a50000, 0x00003450, \
+   /* 6744 */ 0x40a50000, 0x00003454, 0x40a50000, 0x00003458, \
+   /* 6748 */ 0x40a50000, 0x0000345c, 0x40a50000, 0x00003460, \
+   /* 6752 */ 0x40a50000, 0x00003464, 0x40a50000, 0x00003468, \
+   /* 6756 */ 0x40a50000, 0x0000346c, 0x40a50000, 0x00003470, \
+   /* 6760 */ 0x40a50000, 0x00003474, 0x40a50000, 0x00003478, \
+   /* 6764 */ 0x40a50000, 0x0000347c, 0x40a50000, 0x00003480, \
+   /* 6768 */ 0x40a50000, 0x00003484, 0x40a50000, 0x00003488, \
+   /* 6772 */ 0x40a50000, 0x0000348c, 0x40a50000, 0x00003490, \
+   /* 6776 */ 0x40a50000, 0x00003494, 0x40a50000, 0x00003498, \
+   /* 6780 */ 0x40a50000, 0x0000349c, 0x40a50000, 0x000034a0, \
+   /* 6784 */ 0x40a50000, 0x000034a4, 0x40a50000, 0x000034a8, \
+   /* 6788 */ 0x40a50000, 0x000034ac, 0x40a50000, 0x000034b0, \
+   /* 6792 */ 0x40a50000, 0x000034b4, 0x40a50000, 0x000034b8, \
+   /* 6796 */ 0x40a50000, 0x000034bc, 0x40a50000, 0x000034c0, \
+   /* 6800 */ 0x40a50000, 0x000034c4, 0x40a50000, 0x000034c8, \
+   /* 6804 */ 0x40a50000, 0x000034cc, 0x40a50000, 0x000034d0, \
+   /* 6808 */ 0x40a50000, 0x000034d4, 0x40a50000, 0x000034d8, \
+   /* 6812 */ 0x40a50000, 0x000034dc, 0x40a50000, 0x000034e0, \
+   /* 6816 */ 0x40a50000, 0x000034e4, 0x40a50000, 0x000034e8, \
+   /* 6820 */ 0x40a50000, 0x000034ec, 0x40a50000, 0x000034f0, \
+   /* 6824 */ 0x40a50000, 0x000034f4, 0x40a50000, 0x000034f8, \
+   /* 6828 */ 0x40a50000, 0x000034fc, 0x40a50000, 0x00003500, \
+   /* 6832 */ 0x40a50000, 0x00003504, 0x40a50000, 0x00003508, \
+   /* 6836 */ 0x40a50000, 0x0000350c, 0x40a50000, 0x00003510, \
+   /* 6840 */ 0x40a50000, 0x00003514, 0x40a50000, 0x00003518, \
+   /* 6844 */ 0x40a50000, 0x0000351c, 0x40a50000, 0x00003520, \
+   /* 6848 */ 0x40a50000, 0x00003524, 0x40a50000, 0x00003528, \
+   /* 6852 */ 0x40a50000, 0x0000352c, 0x40a50000, 0x00003530, \
+   /* 6856 */ 0x40a50000, 0x00003534, 0x40a50000, 0x00003538, \
+   /* 6860 */ 0x40a50000, 0x0000353c, 0x40a50000, 0x00003540, \
+   /* 6864 */ 0x40a50000, 0x00003544, 0x40a50000, 0x00003548, \
+   /* 6868 */ 0x40a50000, 0x0000354c, 0x40a50000, 0x00003550, \
+   /* 6872 */ 0x40a50000, 0x00003554, 0x40a50000, 0x00003558, \
+   /* 6876 */ 0x40a50000, 0x0000355c, 0x40a50000, 0x00003560, \
+   /* 6880 */ 0x40a50000, 0x00003564, 0x40a50000, 0x00003568, \
+   /* 6884 */ 0x40a50000, 0x0000356c, 0x40a50000, 0x00003570, \
+   /* 6888 */ 0x40a50000, 0x00003574, 0x40a50000, 0x00003578, \
+   /* 6892 */ 0x40a50000, 0x0000357c, 0x40a50000, 0x00003580, \
+   /* 6896 */ 0x40a50000, 0x00003584, 0x40a50000, 0x00003588, \
+   /* 6900 */ 0x40a50000, 0x0000358c, 0x40a50000, 0x00003590, \
+   /* 6904 */ 0x40a50000, 0x00003594, 0x40a50000, 0x00003598, \
+   /* 6908 */ 0x40a50000, 0x0000359c, 0x40a50000, 0x000035a0, \
+   /* 6912 */ 0x40a50000, 0x000035a4, 0x40a50000, 0x000035a8, \
+   /* 6916 */ 0x40a50000, 0x000035ac, 0x40a50000, 0x000035b0, \
+   /* 6920 */ 0x40a50000, 0x000035b4, 0x40a50000, 0x000035b8, \
+   /* 6924 */ 0x40a50000, 0x000035bc, 0x40a50000, 0x000035c0, \
+   /* 6928 */ 0x40a50000, 0x000035c4, 0x40a50000, 0x000035c8, \
+   /* 6932 */ 0x40a50000, 0x000035cc, 0x40a50000, 0x000035d0, \
+   /* 6936 */ 0x40a50000, 0x000035d4, 0x40a50000, 0x000035d8, \
+   /* 6940 */ 0x40a50000, 0x000035dc, 0x40a50000, 0x000035e0, \
+   /* 6944 */ 0x40a50000, 0x000035e4, 0x40a50000, 0x000035e8, \
+   /* 6948 */ 0x40a50000, 0x000035ec, 0x40a50000, 0x000035f0, \
+   /* 6952 */ 0x40a50000, 0x000035f4, 0x40a50000, 0x000035f8, \
+   /* 6956 */ 0x40a50000, 0x000035fc, 0x40a50000, 0x00003600, \
+   /* 6960 */ 0x40a50000, 0x00003604, 0x40a50000, 0x00003608, \
+   /* 6964 */ 0x40a50000, 0x0000360c, 0x40a50000, 0x00003610, \
+   /* 6968 */ 0x40a50000, 0x00003614, 0x40a50000, 0x00003618, \
+   /* 6972 */ 0x40a50000, 0x0000361c, 0x40a50000, 0x00003620, \
+   /* 6976 */ 0x40a50000, 0x00003624, 0x40a50000, 0x00003628, \
+   /* 6980 */ 0x40a50000, 0x0000362c, 0x40a50000, 0x00003630, \
+   /* 6984 */ 0x40a50000, 0x00003634, 0x40a50000, 0x00003638, \
+   /* 6988 */ 0x40a50000, 0x0000363c, 0x40a50000, 0x00003640, \
+   /* 6992 */ 0x40a50000, 0x00003644, 0x40a50000, 0x00003648, \
+   /* 6996 */ 0x40a50000, 0x0000364c, 0x40a50000, 0x00003650, \
+   /* 7000 */ 0x40a50000, 0x00003654, 0x40a50000, 0x00003658, \
+   /* 7004 */ 0x40a50000, 0x0000365c, 0x40a50000, 0x00003660, \
+   /* 7008 */ 0x40a50000, 0x00003664, 0x40a50000, 0x00003668, \
+   /* 7012 */ 0x40a50000, 0x0000366c, 0x40a50000, 0x00003670, \
+   /* 7016 */ 0x40a50000, 0x00003674, 0x40a50000, 0x00003678, \
+   /* 7020 */ 0x40a50000, 0x0000367c, 0x40a50000, 0x00003680, \
+   /* 7024 */ 0x40a50000, 0x00003684, 0x40a50000, 0x00003688, \
+   /* 7028 */ 0x40a50000, 0x0000368c, 0x40a50000, 0x00003690, \
+   /* 7032 */ 0x40a50000, 0x00003694, 0x40a50000, 0x00003698, \
+   /* 7036 */ 0x40a50000, 0x0000369c, 0x40a50000, 0x000036a0, \
+   /* 7040 */ 0x40a50000, 0x000036a4, 0x40a50000, 0x000036a8, \
+   /* 7044 */ 0x40a50000, 0x000036ac, 0x40a50000, 0x000036b0, \
+   /* 7048 */ 0x40a50000, 0x000036b4, 0x40a50000, 0x000036b8, \
+   /* 7052 */ 0x40a50000, 0x000036bc, 0x40a50000, 0x000036c0, \
+   /* 7056 */ 0x40a50000, 0x000036c4, 0x40a50000, 0x000036c8, \
+   /* 7060 */ 0x40a50000, 0x000036cc, 0x40a50000, 0x000036d0, \
+   /* 7064 */ 0x40a50000, 0x000036d4, 0x40a50000, 0x000036d8, \
+   /* 7068 */ 0x40a50000, 0x000036dc, 0x40a50000, 0x000036e0, \
+   /* 7072 */ 0x40a50000, 0x000036e4, 0x40a50000, 0x000036e8, \
+   /* 7076 */ 0x40a50000, 0x000036ec, 0x40a50000, 0x000036f0, \
+   /* 7080 */ 0x40a50000, 0x000036f4, 0x40a50000, 0x000036f8, \
+   /* 7084 */ 0x40a50000, 0x000036fc, 0x40a50000, 0x00003700, \
+   /* 7088 */ 0x40a50000, 0x00003704, 0x40a50000, 0x00003708, \
+   /* 7092 */ 0x40a50000, 0x0000370c, 0x40a50000, 0x00003710, \
+   /* 7096 */ 0x40a50000, 0x00003714, 0x40a50000, 0x00003718, \
+   /* 7100 */ 0x40a50000, 0x0000371c, 0x40a50000, 0x00003720, \
+   /* 7104 */ 0x40a50000, 0x00003724, 0x40a50000, 0x00003728, \
+   /* 7108 */ 0x40a50000, 0x0000372c, 0x40a50000, 0x00003730, \
+   /* 7112 */ 0x40a50000, 0x00003734, 0x40a50000, 0x00003738, \
+   /* 7116 */ 0x40a50000, 0x0000373c, 0x40a50000, 0x00003740, \
+   /* 7120 */ 0x40a50000, 0x00003744, 0x40a50000, 0x00003748, \
+   /* 7124 */ 0x40a50000, 0x0000374c, 0x40a50000, 0x00003750, \
+   /* 7128 */ 0x40a50000, 0x00003754, 0x40a50000, 0x00003758, \
+   /* 7132 */ 0x40a50000, 0x0000375c, 0x40a50000, 0x00003760, \
+   /* 7136 */ 0x40a50000, 0x00003764, 0x40a50000, 0x00003768, \
+   /* 7140 */ 0x40a50000, 0x0000376c, 0x40a50000, 0x00003770, \
+   /* 7144 */ 0x40a50000, 0x00003774, 0x40a50000, 0x00003778, \
+   /* 7148 */ 0x40a50000, 0x0000377c, 0x40a50000, 0x00003780, \
+   /* 7152 */ 0x40a50000, 0x00003784, 0x40a50000, 0x00003788, \
+   /* 7156 */ 0x40a50000, 0x0000378c, 0x40a50000, 0x00003790, \
+   /* 7160 */ 0x40a50000, 0x00003794, 0x40a50000, 0x00003798, \
+   /* 7164 */ 0x40a50000, 0x0000379c, 0x40a50000, 0x000037a0, \
+   /* 7168 */ 0x40a50000, 0x000037a4, 0x40a50000, 0x000037a8, \
+   /* 7172 */ 0x40a50000, 0x000037ac, 0x40a50000, 0x000037b0, \
+   /* 7176 */ 0x40a50000, 0x000037b4, 0x40a50000, 0x000037b8, \
+   /* 7180 */ 0x40a50000, 0x000037bc, 0x40a50000, 0x000037c0, \
+   /* 7184 */ 0x40a50000, 0x000037c4, 0x40a50000, 0x000037c8, \
+   /* 7188 */ 0x40a50000, 0x000037cc, 0x40a50000, 0x000037d0, \
+   /* 7192 */ 0x40a50000, 0x000037d4, 0x40a50000, 0x000037d8, \
+   /* 7196 */ 0x40a50000, 0x000037dc, 0x40a50000, 0x000037e0, \
+   /* 7200 */ 0x40a50000, 0x000037e4, 0x40a50000, 0x000037e8, \
+   /* 7204 */ 0x40a50000, 0x000037ec, 0x40a50000, 0x000037f0, \
+   /* 7208 */ 0x40a50000, 0x000037f4, 0x40a50000, 0x000037f8, \
+   /* 7212 */ 0x40a50000, 0x000037fc, 0x40a50000, 0x00003800, \
+   /* 7216 */ 0x40a50000, 0x00003804, 0x40a50000, 0x00003808, \
+   /* 7220 */ 0x40a50000, 0x0000380c, 0x40a50000, 0x00003810, \
+   /* 7224 */ 0x40a50000, 0x00003814, 0x40a50000, 0x00003818, \
+   /* 7228 */ 0x40a50000, 0x0000381c, 0x40a50000, 0x00003820, \
+   /* 7232 */ 0x40a50000, 0x00003824, 0x40a50000, 0x00003828, \
+   /* 7236 */ 0x40a50000, 0x0000382c, 0x40a50000, 0x00003830, \
+   /* 7240 */ 0x40a50000, 0x00003834, 0x40a50000, 0x00003838, \
+   /* 7244 */ 0x40a50000, 0x0000383c, 0x40a50000, 0x00003840, \
+   /* 7248 */ 0x40a50000, 0x00003844, 0x40a50000, 0x00003848, \
+   /* 7252 */ 0x40a50000, 0x0000384c, 0x40a50000, 0x00003850, \
+   /* 7256 */ 0x40a50000, 0x00003854, 0x40a50000, 0x00003858, \
+   /* 7260 */ 0x40a50000, 0x0000385c, 0x40a50000, 0x00003860, \
+   /* 7264 */ 0x40a50000, 0x00003864, 0x40a50000, 0x00003868, \
+   /* 7268 */ 0x40a50000, 0x0000386c, 0x40a50000, 0x00003870, \
+   /* 7272 */ 0x40a50000, 0x00003874, 0x40a50000, 0x00003878, \
+   /* 7276 */ 0x40a50000, 0x0000387c, 0x40a50000, 0x00003880, \
+   /* 7280 */ 0x40a50000, 0x00003884, 0x40a50000, 0x00003888, \
+   /* 7284 */ 0x40a50000, 0x0000388c, 0x40a50000, 0x00003890, \
+   /* 7288 */ 0x40a50000, 0x00003894, 0x40a50000, 0x00003898, \
+   /* 7292 */ 0x40a50000, 0x0000389c, 0x40a50000, 0x000038a0, \
+   /* 7296 */ 0x40a50000, 0x000038a4, 0x40a50000, 0x000038a8, \
+   /* 7300 */ 0x40a50000, 0x000038ac, 0x40a50000, 0x000038b0, \
+   /* 7304 */ 0x40a50000, 0x000038b4, 0x40a50000, 0x000038b8, \
+   /* 7308 */ 0x40a50000, 0x000038bc, 0x40a50000, 0x000038c0, \
+   /* 7312 */ 0x40a50000, 0x000038c4, 0x40a50000, 0x000038c8, \
+   /* 7316 */ 0x40a50000, 0x000038cc, 0x40a50000, 0x000038d0, \
+   /* 7320 */ 0x40a50000, 0x000038d4, 0x40a50000, 0x000038d8, \
+   /* 7324 */ 0x40a50000, 0x000038dc, 0x40a50000, 0x000038e0, \
+   /* 7328 */ 0x40a50000, 0x000038e4, 0x40a50000, 0x000038e8, \
+   /* 7332 */ 0x40a50000, 0x000038ec, 0x40a50000, 0x000038f0, \
+   /* 7336 */ 0x40a50000, 0x000038f4, 0x40a50000, 0x000038f8, \
+   /* 7340 */ 0x40a50000, 0x000038fc, 0x40a50000, 0x00003900, \
+   /* 7344 */ 0x40a50000, 0x00003904, 0x40a50000, 0x00003908, \
+   /* 7348 */ 0x40a50000, 0x0000390c, 0x40a50000, 0x00003910, \
+   /* 7352 */ 0x40a50000, 0x00003914, 0x40a50000, 0x00003918, \
+   /* 7356 */ 0x40a50000, 0x0000391c, 0x40a50000, 0x00003920, \
+   /* 7360 */ 0x40a50000, 0x00003924, 0x40a50000, 0x00003928, \
+   /* 7364 */ 0x40a50000, 0x0000392c, 0x40a50000, 0x00003930, \
+   /* 7368 */ 0x40a50000, 0x00003934, 0x40a50000, 0x00003938, \
+   /* 7372 */ 0x40a50000, 0x0000393c, 0x40a50000, 0x00003940, \
+   /* 7376 */ 0x40a50000, 0x00003944, 0x40a50000, 0x00003948, \
+   /* 7380 */ 0x40a50000, 0x0000394c, 0x40a50000, 0x00003950, \
+   /* 7384 */ 0x40a50000, 0x00003954, 0x40a50000, 0x00003958, \
+   /* 7388 */ 0x40a50000, 0x0000395c, 0x40a50000, 0x00003960, \
+   /* 7392 */ 0x40a50000, 0x00003964, 0x40a50000, 0x00003968, \
+   /* 7396 */ 0x40a50000, 0x0000396c, 0x40a50000, 0x00003970, \
+   /* 7400 */ 0x40a50000, 0x00003974, 0x40a50000, 0x00003978, \
+   /* 7404 */ 0x40a50000, 0x0000397c, 0x40a50000, 0x00003980, \
+   /* 7408 */ 0x40a50000, 0x00003984, 0x40a50000, 0x00003988, \
+   /* 7412 */ 0x40a50000, 0x0000398c, 0x40a50000, 0x00003990, \
+   /* 7416 */ 0x40a50000, 0x00003994, 0x40a50000, 0x00003998, \
+   /* 7420 */ 0x40a50000, 0x0000399c, 0x40a50000, 0x000039a0, \
+   /* 7424 */ 0x40a50000, 0x000039a4, 0x40a50000, 0x000039a8, \
+   /* 7428 */ 0x40a50000, 0x000039ac, 0x40a50000, 0x000039b0, \
+   /* 7432 */ 0x40a50000, 0x000039b4, 0x40a50000, 0x000039b8, \
+   /* 7436 */ 0x40a50000, 0x000039bc, 0x40a50000, 0x000039c0, \
+   /* 7440 */ 0x40a50000, 0x000039c4, 0x40a50000, 0x000039c8, \
+   /* 7444 */ 0x40a50000, 0x000039cc, 0x40a50000, 0x000039d0, \
+   /* 7448 */ 0x40a50000, 0x000039d4, 0x40a50000, 0x000039d8, \
+   /* 7452 */ 0x40a50000, 0x000039dc, 0x40a50000, 0x000039e0, \
+   /* 7456 */ 0x40a50000, 0x000039e4, 0x40a50000, 0x000039e8, \
+   /* 7460 */ 0x40a50000, 0x000039ec, 0x40a50000, 0x000039f0, \
+   /* 7464 */ 0x40a50000, 0x000039f4, 0x40a50000, 0x000039f8, \
+   /* 7468 */ 0x40a50000, 0x000039fc, 0x40a50000, 0x00003a00, \
+   /* 7472 */ 0x40a50000, 0x00003a04, 0x40a50000, 0x00003a08, \
+   /* 7476 */ 0x40a50000, 0x00003a0c, 0x40a50000, 0x00003a10, \
+   /* 7480 */ 0x40a50000, 0x00003a14, 0x40a50000, 0x00003a18, \
+   /* 7484 */ 0x40a50000, 0x00003a1c, 0x40a50000, 0x00003a20, \
+   /* 7488 */ 0x40a50000, 0x00003a24, 0x40a50000, 0x00003a28, \
+   /* 7492 */ 0x40a50000, 0x00003a2c, 0x40a50000, 0x00003a30, \
+   /* 7496 */ 0x40a50000, 0x00003a34, 0x40a50000, 0x00003a38, \
+   /* 7500 */ 0x40a50000, 0x00003a3c, 0x40a50000, 0x00003a40, \
+   /* 7504 */ 0x40a50000, 0x00003a44, 0x40a50000, 0x00003a48, \
+   /* 7508 */ 0x40a50000, 0x00003a4c, 0x40a50000, 0x00003a50, \
+   /* 7512 */ 0x40a50000, 0x00003a54, 0x40a50000, 0x00003a58, \
+   /* 7516 */ 0x40a50000, 0x00003a5c, 0x40a50000, 0x00003a60, \
+   /* 7520 */ 0x40a50000, 0x00003a64, 0x40a50000, 0x00003a68, \
+   /* 7524 */ 0x40a50000, 0x00003a6c, 0x40a50000, 0x00003a70, \
+   /* 7528 */ 0x40a50000, 0x00003a74, 0x40a50000, 0x00003a78, \
+   /* 7532 */ 0x40a50000, 0x00003a7c, 0x40a50000, 0x00003a80, \
+   /* 7536 */ 0x40a50000, 0x00003a84, 0x40a50000, 0x00003a88, \
+   /* 7540 */ 0x40a50000, 0x00003a8c, 0x40a50000, 0x00003a90, \
+   /* 7544 */ 0x40a50000, 0x00003a94, 0x40a50000, 0x00003a98, \
+   /* 7548 */ 0x40a50000, 0x00003a9c, 0x40a50000, 0x00003aa0, \
+   /* 7552 */ 0x40a50000, 0x00003aa4, 0x40a50000, 0x00003aa8, \
+   /* 7556 */ 0x40a50000, 0x00003aac, 0x40a50000, 0x00003ab0, \
+   /* 7560 */ 0x40a50000, 0x00003ab4, 0x40a50000, 0x00003ab8, \
+   /* 7564 */ 0x40a50000, 0x00003abc, 0x40a50000, 0x00003ac0, \
+   /* 7568 */ 0x40a50000, 0x00003ac4, 0x40a50000, 0x00003ac8, \
+   /* 7572 */ 0x40a50000, 0x00003acc, 0x40a50000, 0x00003ad0, \
+   /* 7576 */ 0x40a50000, 0x00003ad4, 0x40a50000, 0x00003ad8, \
+   /* 7580 */ 0x40a50000, 0x00003adc, 0x40a50000, 0x00003ae0, \
+   /* 7584 */ 0x40a50000, 0x00003ae4, 0x40a50000, 0x00003ae8, \
+   /* 7588 */ 0x40a50000, 0x00003aec, 0x40a50000, 0x00003af0, \
+   /* 7592 */ 0x40a50000, 0x00003af4, 0x40a50000, 0x00003af8, \
+   /* 7596 */ 0x40a50000, 0x00003afc, 0x40a50000, 0x00003b00, \
+   /* 7600 */ 0x40a50000, 0x00003b04, 0x40a50000, 0x00003b08, \
+   /* 7604 */ 0x40a50000, 0x00003b0c, 0x40a50000, 0x00003b10, \
+   /* 7608 */ 0x40a50000, 0x00003b14, 0x40a50000, 0x00003b18, \
+   /* 7612 */ 0x40a50000, 0x00003b1c, 0x40a50000, 0x00003b20, \
+   /* 7616 */ 0x40a50000, 0x00003b24, 0x40a50000, 0x00003b28, \
+   /* 7620 */ 0x40a50000, 0x00003b2c, 0x40a50000, 0x00003b30, \
+   /* 7624 */ 0x40a50000, 0x00003b34, 0x40a50000, 0x00003b38, \
+   /* 7628 */ 0x40a50000, 0x00003b3c, 0x40a50000, 0x00003b40, \
+   /* 7632 */ 0x40a50000, 0x00003b44, 0x40a50000, 0x00003b48, \
+   /* 7636 */ 0x40a50000, 0x00003b4c, 0x40a50000, 0x00003b50, \
+   /* 7640 */ 0x40a50000, 0x00003b54, 0x40a50000, 0x00003b58, \
+   /* 7644 */ 0x40a50000, 0x00003b5c, 0x40a50000, 0x00003b60, \
+   /* 7648 */ 0x40a50000, 0x00003b64, 0x40a50000, 0x00003b68, \
+   /* 7652 */ 0x40a50000, 0x00003b6c, 0x40a50000, 0x00003b70, \
+   /* 7656 */ 0x40a50000, 0x00003b74, 0x40a50000, 0x00003b78, \
+   /* 7660 */ 0x40a50000, 0x00003b7c, 0x40a50000, 0x00003b80, \
+   /* 7664 */ 0x40a50000, 0x00003b84, 0x40a50000, 0x00003b88, \
+   /* 7668 */ 0x40a50000, 0x00003b8c, 0x40a50000, 0x00003b90, \
+   /* 7672 */ 0x40a50000, 0x00003b94, 0x40a50000, 0x00003b98, \
+   /* 7676 */ 0x40a50000, 0x00003b9c, 0x40a50000, 0x00003ba0, \
+   /* 7680 */ 0x40a50000, 0x00003ba4, 0x40a50000, 0x00003ba8, \
+   /* 7684 */ 0x40a50000, 0x00003bac, 0x40a50000, 0x00003bb0, \
+   /* 7688 */ 0x40a50000, 0x00003bb4, 0x40a50000, 0x00003bb8, \
+   /* 7692 */ 0x40a50000, 0x00003bbc, 0x40a50000, 0x00003bc0, \
+   /* 7696 */ 0x40a50000, 0x00003bc4, 0x40a50000, 0x00003bc8, \
+   /* 7700 */ 0x40a50000, 0x00003bcc, 0x40a50000, 0x00003bd0, \
+   /* 7704 */ 0x40a50000, 0x00003bd4, 0x40a50000, 0x00003bd8, \
+   /* 7708 */ 0x40a50000, 0x00003bdc, 0x40a50000, 0x00003be0, \
+   /* 7712 */ 0x40a50000, 0x00003be4, 0x40a50000, 0x00003be8, \
+   /* 7716 */ 0x40a50000, 0x00003bec, 0x40a50000, 0x00003bf0, \
+   /* 7720 */ 0x40a50000, 0x00003bf4, 0x40a50000, 0x00003bf8, \
+   /* 7724 */ 0x40a50000, 0x00003bfc, 0x40a50000, 0x00003c00, \
+   /* 7728 */ 0x40a50000, 0x00003c04, 0x40a50000, 0x00003c08, \
+   /* 7732 */ 0x40a50000, 0x00003c0c, 0x40a50000, 0x00003c10, \
+   /* 7736 */ 0x40a50000, 0x00003c14, 0x40a50000, 0x00003c18, \
+   /* 7740 */ 0x40a50000, 0x00003c1c, 0x40a50000, 0x00003c20, \
+   /* 7744 */ 0x40a50000, 0x00003c24, 0x40a50000, 0x00003c28, \
+   /* 7748 */ 0x40a50000, 0x00003c2c, 0x40a50000, 0x00003c30, \
+   /* 7752 */ 0x40a50000, 0x00003c34, 0x40a50000, 0x00003c38, \
+   /* 7756 */ 0x40a50000, 0x00003c3c, 0x40a50000, 0x00003c40, \
+   /* 7760 */ 0x40a50000, 0x00003c44, 0x40a50000, 0x00003c48, \
+   /* 7764 */ 0x40a50000, 0x00003c4c, 0x40a50000, 0x00003c50, \
+   /* 7768 */ 0x40a50000, 0x00003c54, 0x40a50000, 0x00003c58, \
+   /* 7772 */ 0x40a50000, 0x00003c5c, 0x40a50000, 0x00003c60, \
+   /* 7776 */ 0x40a50000, 0x00003c64, 0x40a50000, 0x00003c68, \
+   /* 7780 */ 0x40a50000, 0x00003c6c, 0x40a50000, 0x00003c70, \
+   /* 7784 */ 0x40a50000, 0x00003c74, 0x40a50000, 0x00003c78, \
+   /* 7788 */ 0x40a50000, 0x00003c7c, 0x40a50000, 0x00003c80, \
+   /* 7792 */ 0x40a50000, 0x00003c84, 0x40a50000, 0x00003c88, \
+   /* 7796 */ 0x40a50000, 0x00003c8c, 0x40a50000, 0x00003c90, \
+   /* 7800 */ 0x40a50000, 0x00003c94, 0x40a50000, 0x00003c98, \
+   /* 7804 */ 0x40a50000, 0x00003c9c, 0x40a50000, 0x00003ca0, \
+   /* 7808 */ 0x40a50000, 0x00003ca4, 0x40a50000, 0x00003ca8, \
+   /* 7812 */ 0x40a50000, 0x00003cac, 0x40a50000, 0x00003cb0, \
+   /* 7816 */ 0x40a50000, 0x00003cb4, 0x40a50000, 0x00003cb8, \
+   /* 7820 */ 0x40a50000, 0x00003cbc, 0x40a50000, 0x00003cc0, \
+   /* 7824 */ 0x40a50000, 0x00003cc4, 0x40a50000, 0x00003cc8, \
+   /* 7828 */ 0x40a50000, 0x00003ccc, 0x40a50000, 0x00003cd0, \
+   /* 7832 */ 0x40a50000, 0x00003cd4, 0x40a50000, 0x00003cd8, \
+   /* 7836 */ 0x40a50000, 0x00003cdc, 0x40a50000, 0x00003ce0, \
+   /* 7840 */ 0x40a50000, 0x00003ce4, 0x40a50000, 0x00003ce8, \
+   /* 7844 */ 0x40a50000, 0x00003cec, 0x40a50000, 0x00003cf0, \
+   /* 7848 */ 0x40a50000, 0x00003cf4, 0x40a50000, 0x00003cf8, \
+   /* 7852 */ 0x40a50000, 0x00003cfc, 0x40a50000, 0x00003d00, \
+   /* 7856 */ 0x40a50000, 0x00003d04, 0x40a50000, 0x00003d08, \
+   /* 7860 */ 0x40a50000, 0x00003d0c, 0x40a50000, 0x00003d10, \
+   /* 7864 */ 0x40a50000, 0x00003d14, 0x40a50000, 0x00003d18, \
+   /* 7868 */ 0x40a50000, 0x00003d1c, 0x40a50000, 0x00003d20, \
+   /* 7872 */ 0x40a50000, 0x00003d24, 0x40a50000, 0x00003d28, \
+   /* 7876 */ 0x40a50000, 0x00003d2c, 0x40a50000, 0x00003d30, \
+   /* 7880 */ 0x40a50000, 0x00003d34, 0x40a50000, 0x00003d38, \
+   /* 7884 */ 0x40a50000, 0x00003d3c, 0x40a50000, 0x00003d40, \
+   /* 7888 */ 0x40a50000, 0x00003d44, 0x40a50000, 0x00003d48, \
+   /* 7892 */ 0x40a50000, 0x00003d4c, 0x40a50000, 0x00003d50, \
+   /* 7896 */ 0x40a50000, 0x00003d54, 0x40a50000, 0x00003d58, \
+   /* 7900 */ 0x40a50000, 0x00003d5c, 0x40a50000, 0x00003d60, \
+   /* 7904 */ 0x40a50000, 0x00003d64, 0x40a50000, 0x00003d68, \
+   /* 7908 */ 0x40a50000, 0x00003d6c, 0x40a50000, 0x00003d70, \
+   /* 7912 */ 0x40a50000, 0x00003d74, 0x40a50000, 0x00003d78, \
+   /* 7916 */ 0x40a50000, 0x00003d7c, 0x40a50000, 0x00003d80, \
+   /* 7920 */ 0x40a50000, 0x00003d84, 0x40a50000, 0x00003d88, \
+   /* 7924 */ 0x40a50000, 0x00003d8c, 0x40a50000, 0x00003d90, \
+   /* 7928 */ 0x40a50000, 0x00003d94, 0x40a50000, 0x00003d98, \
+   /* 7932 */ 0x40a50000, 0x00003d9c, 0x40a50000, 0x00003da0, \
+   /* 7936 */ 0x40a50000, 0x00003da4, 0x40a50000, 0x00003da8, \
+   /* 7940 */ 0x40a50000, 0x00003dac, 0x40a50000, 0x00003db0, \
+   /* 7944 */ 0x40a50000, 0x00003db4, 0x40a50000, 0x00003db8, \
+   /* 7948 */ 0x40a50000, 0x00003dbc, 0x40a50000, 0x00003dc0, \
+   /* 7952 */ 0x40a50000, 0x00003dc4, 0x40a50000, 0x00003dc8, \
+   /* 7956 */ 0x40a50000, 0x00003dcc, 0x40a50000, 0x00003dd0, \
+   /* 7960 */ 0x40a50000, 0x00003dd4, 0x40a50000, 0x00003dd8, \
+   /* 7964 */ 0x40a50000, 0x00003ddc, 0x40a50000, 0x00003de0, \
+   /* 7968 */ 0x40a50000, 0x00003de4, 0x40a50000, 0x00003de8, \
+   /* 7972 */ 0x40a50000, 0x00003dec, 0x40a50000, 0x00003df0, \
+   /* 7976 */ 0x40a50000, 0x00003df4, 0x40a50000, 0x00003df8, \
+   /* 7980 */ 0x40a50000, 0x00003dfc, 0x40a50000, 0x00003e00, \
+   /* 7984 */ 0x40a50000, 0x00003e04, 0x40a50000, 0x00003e08, \
+   /* 7988 */ 0x40a50000, 0x00003e0c, 0x40a50000, 0x00003e10, \
+   /* 7992 */ 0x40a50000, 0x00003e14, 0x40a50000, 0x00003e18, \
+   /* 7996 */ 0x40a50000, 0x00003e1c, 0x40a50000, 0x00003e20, \
+   /* 8000 */ 0x40a50000, 0x00003e24, 0x40a50000, 0x00003e28, \
+   /* 8004 */ 0x40a50000, 0x00003e2c, 0x40a50000, 0x00003e30, \
+   /* 8008 */ 0x40a50000, 0x00003e34, 0x40a50000, 0x00003e38, \
+   /* 8012 */ 0x40a50000, 0x00003e3c, 0x40a50000, 0x00003e40, \
+   /* 8016 */ 0x40a50000, 0x00003e44, 0x40a50000, 0x00003e48, \
+   /* 8020 */ 0x40a50000, 0x00003e4c, 0x40a50000, 0x00003e50, \
+   /* 8024 */ 0x40a50000, 0x00003e54, 0x40a50000, 0x00003e58, \
+   /* 8028 */ 0x40a50000, 0x00003e5c, 0x40a50000, 0x00003e60, \
+   /* 8032 */ 0x40a50000, 0x00003e64, 0x40a50000, 0x00003e68, \
+   /* 8036 */ 0x40a50000, 0x00003e6c, 0x40a50000, 0x00003e70, \
+   /* 8040 */ 0x40a50000, 0x00003e74, 0x40a50000, 0x00003e78, \
+   /* 8044 */ 0x40a50000, 0x00003e7c, 0x40a50000, 0x00003e80, \
+   /* 8048 */ 0x40a50000, 0x00003e84, 0x40a50000, 0x00003e88, \
+   /* 8052 */ 0x40a50000, 0x00003e8c, 0x40a50000, 0x00003e90, \
+   /* 8056 */ 0x40a50000, 0x00003e94, 0x40a50000, 0x00003e98, \
+   /* 8060 */ 0x40a50000, 0x00003e9c, 0x40a50000, 0x00003ea0, \
+   /* 8064 */ 0x40a50000, 0x00003ea4, 0x40a50000, 0x00003ea8, \
+   /* 8068 */ 0x40a50000, 0x00003eac, 0x40a50000, 0x00003eb0, \
+   /* 8072 */ 0x40a50000, 0x00003eb4, 0x40a50000, 0x00003eb8, \
+   /* 8076 */ 0x40a50000, 0x00003ebc, 0x40a50000, 0x00003ec0, \
+   /* 8080 */ 0x40a50000, 0x00003ec4, 0x40a50000, 0x00003ec8, \
+   /* 8084 */ 0x40a50000, 0x00003ecc, 0x40a50000, 0x00003ed0, \
+   /* 8088 */ 0x40a50000, 0x00003ed4, 0x40a50000, 0x00003ed8, \
+   /* 8092 */ 0x40a50000, 0x00003edc, 0x40a50000, 0x00003ee0, \
+   /* 8096 */ 0x40a50000, 0x00003ee4, 0x40a50000, 0x00003ee8, \
+   /* 8100 */ 0x40a50000, 0x00003eec, 0x40a50000, 0x00003ef0, \
+   /* 8104 */ 0x40a50000, 0x00003ef4, 0x40a50000, 0x00003ef8, \
+   /* 8108 */ 0x40a50000, 0x00003efc, 0x40a50000, 0x00003f00, \
+   /* 8112 */ 0x40a50000, 0x00003f04, 0x40a50000, 0x00003f08, \
+   /* 8116 */ 0x40a50000, 0x00003f0c, 0x40a50000, 0x00003f10, \
+   /* 8120 */ 0x40a50000, 0x00003f14, 0x40a50000, 0x00003f18, \
+   /* 8124 */ 0x40a50000, 0x00003f1c, 0x40a50000, 0x00003f20, \
+   /* 8128 */ 0x40a50000, 0x00003f24, 0x40a50000, 0x00003f28, \
+   /* 8132 */ 0x40a50000, 0x00003f2c, 0x40a50000, 0x00003f30, \
+   /* 8136 */ 0x40a50000, 0x00003f34, 0x40a50000, 0x00003f38, \
+   /* 8140 */ 0x40a50000, 0x00003f3c, 0x40a50000, 0x00003f40, \
+   /* 8144 */ 0x40a50000, 0x00003f44, 0x40a50000, 0x00003f48, \
+   /* 8148 */ 0x40a50000, 0x00003f4c, 0x40a50000, 0x00003f50, \
+   /* 8152 */ 0x40a50000, 0x00003f54, 0x40a50000, 0x00003f58, \
+   /* 8156 */ 0x40a50000, 0x00003f5c, 0x40a50000, 0x00003f60, \
+   /* 8160 */ 0x40a50000, 0x00003f64, 0x40a50000, 0x00003f68, \
+   /* 8164 */ 0x40a50000, 0x00003f6c, 0x40a50000, 0x00003f70, \
+   /* 8168 */ 0x40a50000, 0x00003f74, 0x40a50000, 0x00003f78, \
+   /* 8172 */ 0x40a50000, 0x00003f7c, 0x40a50000, 0x00003f80, \
+   /* 8176 */ 0x40a50000, 0x00003f84, 0x40a50000, 0x00003f88, \
+   /* 8180 */ 0x40a50000, 0x00003f8c, 0x40a50000, 0x00003f90, \
+   /* 8184 */ 0x40a50000, 0x00003f94, 0x40a50000, 0x00003f98, \
+   /* 8188 */ 0x40a50000, 0x00003f9c, 0x40a50000, 0x00003fa0, \
+   /* 8192 */ 0x40a50000, 0x00003fa4, 0x40a50000, 0x00003fa8, \
+   /* 8196 */ 0x40a50000, 0x00003fac, 0x40a50000, 0x00003fb0, \
+   /* 8200 */ 0x40a50000, 0x00003fb4, 0x40a50000, 0x00003fb8, \
+   /* 8204 */ 0x40a50000, 0x00003fbc, 0x40a50000, 0x00003fc0, \
+   /* 8208 */ 0x40a50000, 0x00003fc4, 0x40a50000, 0x00003fc8, \
+   /* 8212 */ 0x40a50000, 0x00003fcc, 0x40a50000, 0x00003fd0, \
+   /* 8216 */ 0x40a50000, 0x00003fd4, 0x40a50000, 0x00003fd8, \
+   /* 8220 */ 0x40a50000, 0x00003fdc, 0x40a50000, 0x00003fe0, \
+   /* 8224 */ 0x40a50000, 0x00003fe4, 0x40a50000, 0x00003fe8, \
+   /* 8228 */ 0x40a50000, 0x00003fec, 0x40a50000, 0x00003ff0, \
+   /* 8232 */ 0x40a50000, 0x00003ff4, 0x40a50000, 0x00003ff8, \
+   /* 8236 */ 0x40a50000, 0x00003ffc, 0x40a50000, 0x00004000, \
+   /* 8240 */ 0x40a50000, 0x00004004, 0x40a50000, 0x00004008, \
+   /* 8244 */ 0x40a50000, 0x0000400c, 0x40a50000, 0x00004010, \
+   /* 8248 */ 0x40a50000, 0x00004014, 0x40a50000, 0x00004018, \
+   /* 8252 */ 0x40a50000, 0x0000401c, 0x40a50000, 0x00004020, \
+   /* 8256 */ 0x40a50000, 0x00004024, 0x40a50000, 0x00004028, \
+   /* 8260 */ 0x40a50000, 0x0000402c, 0x40a50000, 0x00004030, \
+   /* 8264 */ 0x40a50000, 0x00004034, 0x40a50000, 0x00004038, \
+   /* 8268 */ 0x40a50000, 0x0000403c, 0x40a50000, 0x00004040, \
+   /* 8272 */ 0x40a50000, 0x00004044, 0x40a50000, 0x00004048, \
+   /* 8276 */ 0x40a50000, 0x0000404c, 0x40a50000, 0x00004050, \
+   /* 8280 */ 0x40a50000, 0x00004054, 0x40a50000, 0x00004058, \
+   /* 8284 */ 0x40a50000, 0x0000405c, 0x40a50000, 0x00004060, \
+   /* 8288 */ 0x40a50000, 0x00004064, 0x40a50000, 0x00004068, \
+   /* 8292 */ 0x40a50000, 0x0000406c, 0x40a50000, 0x00004070, \
+   /* 8296 */ 0x40a50000, 0x00004074, 0x40a50000, 0x00004078, \
+   /* 8300 */ 0x40a50000, 0x0000407c, 0x40a50000, 0x00004080, \
+   /* 8304 */ 0x40a50000, 0x00004084, 0x40a50000, 0x00004088, \
+   /* 8308 */ 0x40a50000, 0x0000408c, 0x40a50000, 0x00004090, \
+   /* 8312 */ 0x40a50000, 0x00004094, 0x40a50000, 0x00004098, \
+   /* 8316 */ 0x40a50000, 0x0000409c, 0x40a50000, 0x000040a0, \
+   /* 8320 */ 0x40a50000, 0x000040a4, 0x40a50000, 0x000040a8, \
+   /* 8324 */ 0x40a50000, 0x000040ac, 0x40a50000, 0x000040b0, \
+   /* 8328 */ 0x40a50000, 0x000040b4, 0x40a50000, 0x000040b8, \
+   /* 8332 */ 0x40a50000, 0x000040bc, 0x40a50000, 0x000040c0, \
+   /* 8336 */ 0x40a50000, 0x000040c4, 0x40a50000, 0x000040c8, \
+   /* 8340 */ 0x40a50000, 0x000040cc, 0x40a50000, 0x000040d0, \
+   /* 8344 */ 0x40a50000, 0x000040d4, 0x40a50000, 0x000040d8, \
+   /* 8348 */ 0x40a50000, 0x000040dc, 0x40a50000, 0x000040e0, \
+   /* 8352 */ 0x40a50000, 0x000040e4, 0x40a50000, 0x000040e8, \
+   /* 8356 */ 0x40a50000, 0x000040ec, 0x40a50000, 0x000040f0, \
+   /* 8360 */ 0x40a50000, 0x000040f4, 0x40a50000, 0x000040f8, \
+   /* 8364 */ 0x40a50000, 0x000040fc, 0x40a50000, 0x00004100, \
+   /* 8368 */ 0x40a50000, 0x00004104, 0x40a50000, 0x00004108, \
+   /* 8372 */ 0x40a50000, 0x0000410c, 0x40a50000, 0x00004110, \
+   /* 8376 */ 0x40a50000, 0x00004114, 0x40a50000, 0x00004118, \
+   /* 8380 */ 0x40a50000, 0x0000411c, 0x40a50000, 0x00004120, \
+   /* 8384 */ 0x40a50000, 0x00004124, 0x40a50000, 0x00004128, \
+   /* 8388 */ 0x40a50000, 0x0000412c, 0x40a50000, 0x00004130, \
+   /* 8392 */ 0x40a50000, 0x00004134, 0x40a50000, 0x00004138, \
+   /* 8396 */ 0x40a50000, 0x0000413c, 0x40a50000, 0x00004140, \
+   /* 8400 */ 0x40a50000, 0x00004144, 0x40a50000, 0x00004148, \
+   /* 8404 */ 0x40a50000, 0x0000414c, 0x40a50000, 0x00004150, \
+   /* 8408 */ 0x40a50000, 0x00004154, 0x40a50000, 0x00004158, \
+   /* 8412 */ 0x40a50000, 0x0000415c, 0x40a50000, 0x00004160, \
+   /* 8416 */ 0x40a50000, 0x00004164, 0x40a50000, 0x00004168, \
+   /* 8420 */ 0x40a50000, 0x0000416c, 0x40a50000, 0x00004170, \
+   /* 8424 */ 0x40a50000, 0x00004174, 0x40a50000, 0x00004178, \
+   /* 8428 */ 0x40a50000, 0x0000417c, 0x40a50000, 0x00004180, \
+   /* 8432 */ 0x40a50000, 0x00004184, 0x40a50000, 0x00004188, \
+   /* 8436 */ 0x40a50000, 0x0000418c, 0x40a50000, 0x00004190, \
+   /* 8440 */ 0x40a50000, 0x00004194, 0x40a50000, 0x00004198, \
+   /* 8444 */ 0x40a50000, 0x0000419c, 0x40a50000, 0x000041a0, \
+   /* 8448 */ 0x40a50000, 0x000041a4, 0x40a50000, 0x000041a8, \
+   /* 8452 */ 0x40a50000, 0x000041ac, 0x40a50000, 0x000041b0, \
+   /* 8456 */ 0x40a50000, 0x000041b4, 0x40a50000, 0x000041b8, \
+   /* 8460 */ 0x40a50000, 0x000041bc, 0x40a50000, 0x000041c0, \
+   /* 8464 */ 0x40a50000, 0x000041c4, 0x40a50000, 0x000041c8, \
+   /* 8468 */ 0x40a50000, 0x000041cc, 0x40a50000, 0x000041d0, \
+   /* 8472 */ 0x40a50000, 0x000041d4, 0x40a50000, 0x000041d8, \
+   /* 8476 */ 0x40a50000, 0x000041dc, 0x40a50000, 0x000041e0, \
+   /* 8480 */ 0x40a50000, 0x000041e4, 0x40a50000, 0x000041e8, \
+   /* 8484 */ 0x40a50000, 0x000041ec, 0x40a50000, 0x000041f0, \
+   /* 8488 */ 0x40a50000, 0x000041f4, 0x40a50000, 0x000041f8, \
+   /* 8492 */ 0x40a50000, 0x000041fc, 0x40a50000, 0x00004200, \
+   /* 8496 */ 0x40a50000, 0x00004204, 0x40a50000, 0x00004208, \
+   /* 8500 */ 0x40a50000, 0x0000420c, 0x40a50000, 0x00004210, \
+   /* 8504 */ 0x40a50000, 0x00004214, 0x40a50000, 0x00004218, \
+   /* 8508 */ 0x40a50000, 0x0000421c, 0x40a50000, 0x00004220, \
+   /* 8512 */ 0x40a50000, 0x00004224, 0x40a50000, 0x00004228, \
+   /* 8516 */ 0x40a50000, 0x0000422c, 0x40a50000, 0x00004230, \
+   /* 8520 */ 0x40a50000, 0x00004234, 0x40a50000, 0x00004238, \
+   /* 8524 */ 0x40a50000, 0x0000423c, 0x40a50000, 0x00004240, \
+   /* 8528 */ 0x40a50000, 0x00004244, 0x40a50000, 0x00004248, \
+   /* 8532 */ 0x40a50000, 0x0000424c, 0x40a50000, 0x00004250, \
+   /* 8536 */ 0x40a50000, 0x00004254, 0x40a50000, 0x00004258, \
+   /* 8540 */ 0x40a50000, 0x0000425c, 0x40a50000, 0x00004260, \
+   /* 8544 */ 0x40a50000, 0x00004264, 0x40a50000, 0x00004268, \
+   /* 8548 */ 0x40a50000, 0x0000426c, 0x40a50000, 0x00004270, \
+   /* 8552 */ 0x40a50000, 0x00004274, 0x40a50000, 0x00004278, \
+   /* 8556 */ 0x40a50000, 0x0000427c, 0x40a50000, 0x00004280, \
+   /* 8560 */ 0x40a50000, 0x00004284, 0x40a50000, 0x00004288, \
+   /* 8564 */ 0x40a50000, 0x0000428c, 0x40a50000, 0x00004290, \
+   /* 8568 */ 0x40a50000, 0x00004294, 0x40a50000, 0x00004298, \
+   /* 8572 */ 0x40a50000, 0x0000429c, 0x40a50000, 0x000042a0, \
+   /* 8576 */ 0x40a50000, 0x000042a4, 0x40a50000, 0x000042a8, \
+   /* 8580 */ 0x40a50000, 0x000042ac, 0x40a50000, 0x000042b0, \
+   /* 8584 */ 0x40a50000, 0x000042b4, 0x40a50000, 0x000042b8, \
+   /* 8588 */ 0x40a50000, 0x000042bc, 0x40a50000, 0x000042c0, \
+   /* 8592 */ 0x40a50000, 0x000042c4, 0x40a50000, 0x000042c8, \
+   /* 8596 */ 0x40a50000, 0x000042cc, 0x40a50000, 0x000042d0, \
+   /* 8600 */ 0x40a50000, 0x000042d4, 0x40a50000, 0x000042d8, \
+   /* 8604 */ 0x40a50000, 0x000042dc, 0x40a50000, 0x000042e0, \
+   /* 8608 */ 0x40a50000, 0x000042e4, 0x40a50000, 0x000042e8, \
+   /* 8612 */ 0x40a50000, 0x000042ec, 0x40a50000, 0x000042f0, \
+   /* 8616 */ 0x40a50000, 0x000042f4, 0x40a50000, 0x000042f8, \
+   /* 8620 */ 0x40a50000, 0x000042fc, 0x40a50000, 0x00004300, \
+   /* 8624 */ 0x40a50000, 0x00004304, 0x40a50000, 0x00004308, \
+   /* 8628 */ 0x40a50000, 0x0000430c, 0x40a50000, 0x00004310, \
+   /* 8632 */ 0x40a50000, 0x00004314, 0x40a50000, 0x00004318, \
+   /* 8636 */ 0x40a50000, 0x0000431c, 0x40a50000, 0x00004320, \
+   /* 8640 */ 0x40a50000, 0x00004324, 0x40a50000, 0x00004328, \
+   /* 8644 */ 0x40a50000, 0x0000432c, 0x40a50000, 0x00004330, \
+   /* 8648 */ 0x40a50000, 0x00004334, 0x40a50000, 0x00004338, \
+   /* 8652 */ 0x40a50000, 0x0000433c, 0x40a50000, 0x00004340, \
+   /* 8656 */ 0x40a50000, 0x00004344, 0x40a50000, 0x00004348, \
+   /* 8660 */ 0x40a50000, 0x0000434c, 0x40a50000, 0x00004350, \
+   /* 8664 */ 0x40a50000, 0x00004354, 0x40a50000, 0x00004358, \
+   /* 8668 */ 0x40a50000, 0x0000435c, 0x40a50000, 0x00004360, \
+   /* 8672 */ 0x40a50000, 0x00004364, 0x40a50000, 0x00004368, \
+   /* 8676 */ 0x40a50000, 0x0000436c, 0x40a50000, 0x00004370, \
+   /* 8680 */ 0x40a50000, 0x00004374, 0x40a50000, 0x00004378, \
+   /* 8684 */ 0x40a50000, 0x0000437c, 0x40a50000, 0x00004380, \
+   /* 8688 */ 0x40a50000, 0x00004384, 0x40a50000, 0x00004388, \
+   /* 8692 */ 0x40a50000, 0x0000438c, 0x40a50000, 0x00004390, \
+   /* 8696 */ 0x40a50000, 0x00004394, 0x40a50000, 0x00004398, \
+   /* 8700 */ 0x40a50000, 0x0000439c, 0x40a50000, 0x000043a0, \
+   /* 8704 */ 0x40a50000, 0x000043a4, 0x40a50000, 0x000043a8, \
+   /* 8708 */ 0x40a50000, 0x000043ac, 0x40a50000, 0x000043b0, \
+   /* 8712 */ 0x40a50000, 0x000043b4, 0x40a50000, 0x000043b8, \
+   /* 8716 */ 0x40a50000, 0x000043bc, 0x40a50000, 0x000043c0, \
+   /* 8720 */ 0x40a50000, 0x000043c4, 0x40a50000, 0x000043c8, \
+   /* 8724 */ 0xd0a50000, 0x000043e8, 0x00000020, 0x00000002, \
+   /* 8728 */ 0x48a50000, 0x000043ec, 0x44a50000, 0x0000446c, \
+   /* 8732 */ 0x48a50000, 0x000043f0, 0x44a50000, 0x00004470, \
+   /* 8736 */ 0x48a50000, 0x000043f4, 0x44a50000, 0x00004474, \
+   /* 8740 */ 0x48a50000, 0x000043f8, 0x44a50000, 0x00004478, \
+   /* 8744 */ 0x48a50000, 0x000043fc, 0x44a50000, 0x0000447c, \
+   /* 8748 */ 0x48a50000, 0x00004400, 0x44a50000, 0x00004480, \
+   /* 8752 */ 0x48a50000, 0x00004404, 0x44a50000, 0x00004484, \
+   /* 8756 */ 0x48a50000, 0x00004408, 0x44a50000, 0x00004488, \
+   /* 8760 */ 0x48a50000, 0x0000440c, 0x44a50000, 0x0000448c, \
+   /* 8764 */ 0x48a50000, 0x00004410, 0x44a50000, 0x00004490, \
+   /* 8768 */ 0x48a50000, 0x00004414, 0x44a50000, 0x00004494, \
+   /* 8772 */ 0x48a50000, 0x00004418, 0x44a50000, 0x00004498, \
+   /* 8776 */ 0x48a50000, 0x0000441c, 0x44a50000, 0x0000449c, \
+   /* 8780 */ 0x48a50000, 0x00004420, 0x44a50000, 0x000044a0, \
+   /* 8784 */ 0x48a50000, 0x00004424, 0x44a50000, 0x000044a4, \
+   /* 8788 */ 0x48a50000, 0x00004428, 0x44a50000, 0x000044a8, \
+   /* 8792 */ 0x48a50000, 0x0000442c, 0x44a50000, 0x000044ac, \
+   /* 8796 */ 0x48a50000, 0x00004430, 0x44a50000, 0x000044b0, \
+   /* 8800 */ 0x48a50000, 0x00004434, 0x44a50000, 0x000044b4, \
+   /* 8804 */ 0x48a50000, 0x00004438, 0x44a50000, 0x000044b8, \
+   /* 8808 */ 0x48a50000, 0x0000443c, 0x44a50000, 0x000044bc, \
+   /* 8812 */ 0x48a50000, 0x00004440, 0x44a50000, 0x000044c0, \
+   /* 8816 */ 0x48a50000, 0x00004444, 0x44a50000, 0x000044c4, \
+   /* 8820 */ 0x48a50000, 0x00004448, 0x44a50000, 0x000044c8, \
+   /* 8824 */ 0x48a50000, 0x0000444c, 0x44a50000, 0x000044cc, \
+   /* 8828 */ 0x48a50000, 0x00004450, 0x44a50000, 0x000044d0, \
+   /* 8832 */ 0x48a50000, 0x00004454, 0x44a50000, 0x000044d4, \
+   /* 8836 */ 0x48a50000, 0x00004458, 0x44a50000, 0x000044d8, \
+   /* 8840 */ 0x48a50000, 0x0000445c, 0x44a50000, 0x000044dc, \
+   /* 8844 */ 0x48a50000, 0x00004460, 0x44a50000, 0x000044e0, \
+   /* 8848 */ 0x48a50000, 0x00004464, 0x44a50000, 0x000044e4, \
+   /* 8852 */ 0x48a50000, 0x00004468, 0x44a50000, 0x000044e8, \
+   /* 8856 */ 0xc0a50000, 0x000044ec, 0x00001000, 0x00000001, \
+   /* 8860 */ 0x40a50000, 0x000044f0, 0x40a50000, 0x000044f4, \
+   /* 8864 */ 0x40a50000, 0x000044f8, 0x40a50000, 0x000044fc, \
+   /* 8868 */ 0x40a50000, 0x00004500, 0x40a50000, 0x00004504, \
+   /* 8872 */ 0x40a50000, 0x00004508, 0x40a50000, 0x0000450c, \
+   /* 8876 */ 0x40a50000, 0x00004510, 0x40a50000, 0x00004514, \
+   /* 8880 */ 0x40a50000, 0x00004518, 0x40a50000, 0x0000451c, \
+   /* 8884 */ 0x40a50000, 0x00004520, 0x40a50000, 0x00004524, \
+   /* 8888 */ 0x40a50000, 0x00004528, 0x40a50000, 0x0000452c, \
+   /* 8892 */ 0x40a50000, 0x00004530, 0x40a50000, 0x00004534, \
+   /* 8896 */ 0x40a50000, 0x00004538, 0x40a50000, 0x0000453c, \
+   /* 8900 */ 0x40a50000, 0x00004540, 0x40a50000, 0x00004544, \
+   /* 8904 */ 0x40a50000, 0x00004548, 0x40a50000, 0x0000454c, \
+   /* 8908 */ 0x40a50000, 0x00004550, 0x40a50000, 0x00004554, \
+   /* 8912 */ 0x40a50000, 0x00004558, 0x40a50000, 0x0000455c, \
+   /* 8916 */ 0x40a50000, 0x00004560, 0x40a50000, 0x00004564, \
+   /* 8920 */ 0x40a50000, 0x00004568, 0x40a50000, 0x0000456c, \
+   /* 8924 */ 0x40a50000, 0x00004570, 0x40a50000, 0x00004574, \
+   /* 8928 */ 0x40a50000, 0x00004578, 0x40a50000, 0x0000457c, \
+   /* 8932 */ 0x40a50000, 0x00004580, 0x40a50000, 0x00004584, \
+   /* 8936 */ 0x40a50000, 0x00004588, 0x40a50000, 0x0000458c, \
+   /* 8940 */ 0x40a50000, 0x00004590, 0x40a50000, 0x00004594, \
+   /* 8944 */ 0x40a50000, 0x00004598, 0x40a50000, 0x0000459c, \
+   /* 8948 */ 0x40a50000, 0x000045a0, 0x40a50000, 0x000045a4, \
+   /* 8952 */ 0x40a50000, 0x000045a8, 0x40a50000, 0x000045ac, \
+   /* 8956 */ 0x40a50000, 0x000045b0, 0x40a50000, 0x000045b4, \
+   /* 8960 */ 0x40a50000, 0x000045b8, 0x40a50000, 0x000045bc, \
+   /* 8964 */ 0x40a50000, 0x000045c0, 0x40a50000, 0x000045c4, \
+   /* 8968 */ 0x40a50000, 0x000045c8, 0x40a50000, 0x000045cc, \
+   /* 8972 */ 0x40a50000, 0x000045d0, 0x40a50000, 0x000045d4, \
+   /* 8976 */ 0x40a50000, 0x000045d8, 0x40a50000, 0x000045dc, \
+   /* 8980 */ 0x40a50000, 0x000045e0, 0x40a50000, 0x000045e4, \
+   /* 8984 */ 0x40a50000, 0x000045e8, 0x40a50000, 0x000045ec, \
+   /* 8988 */ 0x40a50000, 0x000045f0, 0x40a50000, 0x000045f4, \
+   /* 8992 */ 0x40a50000, 0x000045f8, 0x40a50000, 0x000045fc, \
+   /* 8996 */ 0x40a50000, 0x00004600, 0x40a50000, 0x00004604, \
+   /* 9000 */ 0x40a50000, 0x00004608, 0x40a50000, 0x0000460c, \
+   /* 9004 */ 0x40a50000, 0x00004610, 0x40a50000, 0x00004614, \
+   /* 9008 */ 0x40a50000, 0x00004618, 0x40a50000, 0x0000461c, \
+   /* 9012 */ 0x40a50000, 0x00004620, 0x40a50000, 0x00004624, \
+   /* 9016 */ 0x40a50000, 0x00004628, 0x40a50000, 0x0000462c, \
+   /* 9020 */ 0x40a50000, 0x00004630, 0x40a50000, 0x00004634, \
+   /* 9024 */ 0x40a50000, 0x00004638, 0x40a50000, 0x0000463c, \
+   /* 9028 */ 0x40a50000, 0x00004640, 0x40a50000, 0x00004644, \
+   /* 9032 */ 0x40a50000, 0x00004648, 0x40a50000, 0x0000464c, \
+   /* 9036 */ 0x40a50000, 0x00004650, 0x40a50000, 0x00004654, \
+   /* 9040 */ 0x40a50000, 0x00004658, 0x40a50000, 0x0000465c, \
+   /* 9044 */ 0x40a50000, 0x00004660, 0x40a50000, 0x00004664, \
+   /* 9048 */ 0x40a50000, 0x00004668, 0x40a50000, 0x0000466c, \
+   /* 9052 */ 0x40a50000, 0x00004670, 0x40a50000, 0x00004674, \
+   /* 9056 */ 0x40a50000, 0x00004678, 0x40a50000, 0x0000467c, \
+   /* 9060 */ 0x40a50000, 0x00004680, 0x40a50000, 0x00004684, \
+   /* 9064 */ 0x40a50000, 0x00004688, 0x40a50000, 0x0000468c, \
+   /* 9068 */ 0x40a50000, 0x00004690, 0x40a50000, 0x00004694, \
+   /* 9072 */ 0x40a50000, 0x00004698, 0x40a50000, 0x0000469c, \
+   /* 9076 */ 0x40a50000, 0x000046a0, 0x40a50000, 0x000046a4, \
+   /* 9080 */ 0x40a50000, 0x000046a8, 0x40a50000, 0x000046ac, \
+   /* 9084 */ 0x40a50000, 0x000046b0, 0x40a50000, 0x000046b4, \
+   /* 9088 */ 0x40a50000, 0x000046b8, 0x40a50000, 0x000046bc, \
+   /* 9092 */ 0x40a50000, 0x000046c0, 0x40a50000, 0x000046c4, \
+   /* 9096 */ 0x40a50000, 0x000046c8, 0x40a50000, 0x000046cc, \
+   /* 9100 */ 0x40a50000, 0x000046d0, 0x40a50000, 0x000046d4, \
+   /* 9104 */ 0x40a50000, 0x000046d8, 0x40a50000, 0x000046dc, \
+   /* 9108 */ 0x40a50000, 0x000046e0, 0x40a50000, 0x000046e4, \
+   /* 9112 */ 0x40a50000, 0x000046e8, 0x40a50000, 0x000046ec, \
+   /* 9116 */ 0x40a50000, 0x000046f0, 0x40a50000, 0x000046f4, \
+   /* 9120 */ 0x40a50000, 0x000046f8, 0x40a50000, 0x000046fc, \
+   /* 9124 */ 0x40a50000, 0x00004700, 0x40a50000, 0x00004704, \
+   /* 9128 */ 0x40a50000, 0x00004708, 0x40a50000, 0x0000470c, \
+   /* 9132 */ 0x40a50000, 0x00004710, 0x40a50000, 0x00004714, \
+   /* 9136 */ 0x40a50000, 0x00004718, 0x40a50000, 0x0000471c, \
+   /* 9140 */ 0x40a50000, 0x00004720, 0x40a50000, 0x00004724, \
+   /* 9144 */ 0x40a50000, 0x00004728, 0x40a50000, 0x0000472c, \
+   /* 9148 */ 0x40a50000, 0x00004730, 0x40a50000, 0x00004734, \
+   /* 9152 */ 0x40a50000, 0x00004738, 0x40a50000, 0x0000473c, \
+   /* 9156 */ 0x40a50000, 0x00004740, 0x40a50000, 0x00004744, \
+   /* 9160 */ 0x40a50000, 0x00004748, 0x40a50000, 0x0000474c, \
+   /* 9164 */ 0x40a50000, 0x00004750, 0x40a50000, 0x00004754, \
+   /* 9168 */ 0x40a50000, 0x00004758, 0x40a50000, 0x0000475c, \
+   /* 9172 */ 0x40a50000, 0x00004760, 0x40a50000, 0x00004764, \
+   /* 9176 */ 0x40a50000, 0x00004768, 0x40a50000, 0x0000476c, \
+   /* 9180 */ 0x40a50000, 0x00004770, 0x40a50000, 0x00004774, \
+   /* 9184 */ 0x40a50000, 0x00004778, 0x40a50000, 0x0000477c, \
+   /* 9188 */ 0x40a50000, 0x00004780, 0x40a50000, 0x00004784, \
+   /* 9192 */ 0x40a50000, 0x00004788, 0x40a50000, 0x0000478c, \
+   /* 9196 */ 0x40a50000, 0x00004790, 0x40a50000, 0x00004794, \
+   /* 9200 */ 0x40a50000, 0x00004798, 0x40a50000, 0x0000479c, \
+   /* 9204 */ 0x40a50000, 0x000047a0, 0x40a50000, 0x000047a4, \
+   /* 9208 */ 0x40a50000, 0x000047a8, 0x40a50000, 0x000047ac, \
+   /* 9212 */ 0x40a50000, 0x000047b0, 0x40a50000, 0x000047b4, \
+   /* 9216 */ 0x40a50000, 0x000047b8, 0x40a50000, 0x000047bc, \
+   /* 9220 */ 0x40a50000, 0x000047c0, 0x40a50000, 0x000047c4, \
+   /* 9224 */ 0x40a50000, 0x000047c8, 0x40a50000, 0x000047cc, \
+   /* 9228 */ 0x40a50000, 0x000047d0, 0x40a50000, 0x000047d4, \
+   /* 9232 */ 0x40a50000, 0x000047d8, 0x40a50000, 0x000047dc, \
+   /* 9236 */ 0x40a50000, 0x000047e0, 0x40a50000, 0x000047e4, \
+   /* 9240 */ 0x40a50000, 0x000047e8, 0x40a50000, 0x000047ec, \
+   /* 9244 */ 0x40a50000, 0x000047f0, 0x40a50000, 0x000047f4, \
+   /* 9248 */ 0x40a50000, 0x000047f8, 0x40a50000, 0x000047fc, \
+   /* 9252 */ 0x40a50000, 0x00004800, 0x40a50000, 0x00004804, \
+   /* 9256 */ 0x40a50000, 0x00004808, 0x40a50000, 0x0000480c, \
+   /* 9260 */ 0x40a50000, 0x00004810, 0x40a50000, 0x00004814, \
+   /* 9264 */ 0x40a50000, 0x00004818, 0x40a50000, 0x0000481c, \
+   /* 9268 */ 0x40a50000, 0x00004820, 0x40a50000, 0x00004824, \
+   /* 9272 */ 0x40a50000, 0x00004828, 0x40a50000, 0x0000482c, \
+   /* 9276 */ 0x40a50000, 0x00004830, 0x40a50000, 0x00004834, \
+   /* 9280 */ 0x40a50000, 0x00004838, 0x40a50000, 0x0000483c, \
+   /* 9284 */ 0x40a50000, 0x00004840, 0x40a50000, 0x00004844, \
+   /* 9288 */ 0x40a50000, 0x00004848, 0x40a50000, 0x0000484c, \
+   /* 9292 */ 0x40a50000, 0x00004850, 0x40a50000, 0x00004854, \
+   /* 9296 */ 0x40a50000, 0x00004858, 0x40a50000, 0x0000485c, \
+   /* 9300 */ 0x40a50000, 0x00004860, 0x40a50000, 0x00004864, \
+   /* 9304 */ 0x40a50000, 0x00004868, 0x40a50000, 0x0000486c, \
+   /* 9308 */ 0x40a50000, 0x00004870, 0x40a50000, 0x00004874, \
+   /* 9312 */ 0x40a50000, 0x00004878, 0x40a50000, 0x0000487c, \
+   /* 9316 */ 0x40a50000, 0x00004880, 0x40a50000, 0x00004884, \
+   /* 9320 */ 0x40a50000, 0x00004888, 0x40a50000, 0x0000488c, \
+   /* 9324 */ 0x40a50000, 0x00004890, 0x40a50000, 0x00004894, \
+   /* 9328 */ 0x40a50000, 0x00004898, 0x40a50000, 0x0000489c, \
+   /* 9332 */ 0x40a50000, 0x000048a0, 0x40a50000, 0x000048a4, \
+   /* 9336 */ 0x40a50000, 0x000048a8, 0x40a50000, 0x000048ac, \
+   /* 9340 */ 0x40a50000, 0x000048b0, 0x40a50000, 0x000048b4, \
+   /* 9344 */ 0x40a50000, 0x000048b8, 0x40a50000, 0x000048bc, \
+   /* 9348 */ 0x40a50000, 0x000048c0, 0x40a50000, 0x000048c4, \
+   /* 9352 */ 0x40a50000, 0x000048c8, 0x40a50000, 0x000048cc, \
+   /* 9356 */ 0x40a50000, 0x000048d0, 0x40a50000, 0x000048d4, \
+   /* 9360 */ 0x40a50000, 0x000048d8, 0x40a50000, 0x000048dc, \
+   /* 9364 */ 0x40a50000, 0x000048e0, 0x40a50000, 0x000048e4, \
+   /* 9368 */ 0x40a50000, 0x000048e8, 0x40a50000, 0x000048ec, \
+   /* 9372 */ 0x40a50000, 0x000048f0, 0x40a50000, 0x000048f4, \
+   /* 9376 */ 0x40a50000, 0x000048f8, 0x40a50000, 0x000048fc, \
+   /* 9380 */ 0x40a50000, 0x00004900, 0x40a50000, 0x00004904, \
+   /* 9384 */ 0x40a50000, 0x00004908, 0x40a50000, 0x0000490c, \
+   /* 9388 */ 0x40a50000, 0x00004910, 0x40a50000, 0x00004914, \
+   /* 9392 */ 0x40a50000, 0x00004918, 0x40a50000, 0x0000491c, \
+   /* 9396 */ 0x40a50000, 0x00004920, 0x40a50000, 0x00004924, \
+   /* 9400 */ 0x40a50000, 0x00004928, 0x40a50000, 0x0000492c, \
+   /* 9404 */ 0x40a50000, 0x00004930, 0x40a50000, 0x00004934, \
+   /* 9408 */ 0x40a50000, 0x00004938, 0x40a50000, 0x0000493c, \
+   /* 9412 */ 0x40a50000, 0x00004940, 0x40a50000, 0x00004944, \
+   /* 9416 */ 0x40a50000, 0x00004948, 0x40a50000, 0x0000494c, \
+   /* 9420 */ 0x40a50000, 0x00004950, 0x40a50000, 0x00004954, \
+   /* 9424 */ 0x40a50000, 0x00004958, 0x40a50000, 0x0000495c, \
+   /* 9428 */ 0x40a50000, 0x00004960, 0x40a50000, 0x00004964, \
+   /* 9432 */ 0x40a50000, 0x00004968, 0x40a50000, 0x0000496c, \
+   /* 9436 */ 0x40a50000, 0x00004970, 0x40a50000, 0x00004974, \
+   /* 9440 */ 0x40a50000, 0x00004978, 0x40a50000, 0x0000497c, \
+   /* 9444 */ 0x40a50000, 0x00004980, 0x40a50000, 0x00004984, \
+   /* 9448 */ 0x40a50000, 0x00004988, 0x40a50000, 0x0000498c, \
+   /* 9452 */ 0x40a50000, 0x00004990, 0x40a50000, 0x00004994, \
+   /* 9456 */ 0x40a50000, 0x00004998, 0x40a50000, 0x0000499c, \
+   /* 9460 */ 0x40a50000, 0x000049a0, 0x40a50000, 0x000049a4, \
+   /* 9464 */ 0x40a50000, 0x000049a8, 0x40a50000, 0x000049ac, \
+   /* 9468 */ 0x40a50000, 0x000049b0, 0x40a50000, 0x000049b4, \
+   /* 9472 */ 0x40a50000, 0x000049b8, 0x40a50000, 0x000049bc, \
+   /* 9476 */ 0x40a50000, 0x000049c0, 0x40a50000, 0x000049c4, \
+   /* 9480 */ 0x40a50000, 0x000049c8, 0x40a50000, 0x000049cc, \
+   /* 9484 */ 0x40a50000, 0x000049d0, 0x40a50000, 0x000049d4, \
+   /* 9488 */ 0x40a50000, 0x000049d8, 0x40a50000, 0x000049dc, \
+   /* 9492 */ 0x40a50000, 0x000049e0, 0x40a50000, 0x000049e4, \
+   /* 9496 */ 0x40a50000, 0x000049e8, 0x40a50000, 0x000049ec, \
+   /* 9500 */ 0x40a50000, 0x000049f0, 0x40a50000, 0x000049f4, \
+   /* 9504 */ 0x40a50000, 0x000049f8, 0x40a50000, 0x000049fc, \
+   /* 9508 */ 0x40a50000, 0x00004a00, 0x40a50000, 0x00004a04, \
+   /* 9512 */ 0x40a50000, 0x00004a08, 0x40a50000, 0x00004a0c, \
+   /* 9516 */ 0x40a50000, 0x00004a10, 0x40a50000, 0x00004a14, \
+   /* 9520 */ 0x40a50000, 0x00004a18, 0x40a50000, 0x00004a1c, \
+   /* 9524 */ 0x40a50000, 0x00004a20, 0x40a50000, 0x00004a24, \
+   /* 9528 */ 0x40a50000, 0x00004a28, 0x40a50000, 0x00004a2c, \
+   /* 9532 */ 0x40a50000, 0x00004a30, 0x40a50000, 0x00004a34, \
+   /* 9536 */ 0x40a50000, 0x00004a38, 0x40a50000, 0x00004a3c, \
+   /* 9540 */ 0x40a50000, 0x00004a40, 0x40a50000, 0x00004a44, \
+   /* 9544 */ 0x40a50000, 0x00004a48, 0x40a50000, 0x00004a4c, \
+   /* 9548 */ 0x40a50000, 0x00004a50, 0x40a50000, 0x00004a54, \
+   /* 9552 */ 0x40a50000, 0x00004a58, 0x40a50000, 0x00004a5c, \
+   /* 9556 */ 0x40a50000, 0x00004a60, 0x40a50000, 0x00004a64, \
+   /* 9560 */ 0x40a50000, 0x00004a68, 0x40a50000, 0x00004a6c, \
+   /* 9564 */ 0x40a50000, 0x00004a70, 0x40a50000, 0x00004a74, \
+   /* 9568 */ 0x40a50000, 0x00004a78, 0x40a50000, 0x00004a7c, \
+   /* 9572 */ 0x40a50000, 0x00004a80, 0x40a50000, 0x00004a84, \
+   /* 9576 */ 0x40a50000, 0x00004a88, 0x40a50000, 0x00004a8c, \
+   /* 9580 */ 0x40a50000, 0x00004a90, 0x40a50000, 0x00004a94, \
+   /* 9584 */ 0x40a50000, 0x00004a98, 0x40a50000, 0x00004a9c, \
+   /* 9588 */ 0x40a50000, 0x00004aa0, 0x40a50000, 0x00004aa4, \
+   /* 9592 */ 0x40a50000, 0x00004aa8, 0x40a50000, 0x00004aac, \
+   /* 9596 */ 0x40a50000, 0x00004ab0, 0x40a50000, 0x00004ab4, \
+   /* 9600 */ 0x40a50000, 0x00004ab8, 0x40a50000, 0x00004abc, \
+   /* 9604 */ 0x40a50000, 0x00004ac0, 0x40a50000, 0x00004ac4, \
+   /* 9608 */ 0x40a50000, 0x00004ac8, 0x40a50000, 0x00004acc, \
+   /* 9612 */ 0x40a50000, 0x00004ad0, 0x40a50000, 0x00004ad4, \
+   /* 9616 */ 0x40a50000, 0x00004ad8, 0x40a50000, 0x00004adc, \
+   /* 9620 */ 0x40a50000, 0x00004ae0, 0x40a50000, 0x00004ae4, \
+   /* 9624 */ 0x40a50000, 0x00004ae8, 0x40a50000, 0x00004aec, \
+   /* 9628 */ 0x40a50000, 0x00004af0, 0x40a50000, 0x00004af4, \
+   /* 9632 */ 0x40a50000, 0x00004af8, 0x40a50000, 0x00004afc, \
+   /* 9636 */ 0x40a50000, 0x00004b00, 0x40a50000, 0x00004b04, \
+   /* 9640 */ 0x40a50000, 0x00004b08, 0x40a50000, 0x00004b0c, \
+   /* 9644 */ 0x40a50000, 0x00004b10, 0x40a50000, 0x00004b14, \
+   /* 9648 */ 0x40a50000, 0x00004b18, 0x40a50000, 0x00004b1c, \
+   /* 9652 */ 0x40a50000, 0x00004b20, 0x40a50000, 0x00004b24, \
+   /* 9656 */ 0x40a50000, 0x00004b28, 0x40a50000, 0x00004b2c, \
+   /* 9660 */ 0x40a50000, 0x00004b30, 0x40a50000, 0x00004b34, \
+   /* 9664 */ 0x40a50000, 0x00004b38, 0x40a50000, 0x00004b3c, \
+   /* 9668 */ 0x40a50000, 0x00004b40, 0x40a50000, 0x00004b44, \
+   /* 9672 */ 0x40a50000, 0x00004b48, 0x40a50000, 0x00004b4c, \
+   /* 9676 */ 0x40a50000, 0x00004b50, 0x40a50000, 0x00004b54, \
+   /* 9680 */ 0x40a50000, 0x00004b58, 0x40a50000, 0x00004b5c, \
+   /* 9684 */ 0x40a50000, 0x00004b60, 0x40a50000, 0x00004b64, \
+   /* 9688 */ 0x40a50000, 0x00004b68, 0x40a50000, 0x00004b6c, \
+   /* 9692 */ 0x40a50000, 0x00004b70, 0x40a50000, 0x00004b74, \
+   /* 9696 */ 0x40a50000, 0x00004b78, 0x40a50000, 0x00004b7c, \
+   /* 9700 */ 0x40a50000, 0x00004b80, 0x40a50000, 0x00004b84, \
+   /* 9704 */ 0x40a50000, 0x00004b88, 0x40a50000, 0x00004b8c, \
+   /* 9708 */ 0x40a50000, 0x00004b90, 0x40a50000, 0x00004b94, \
+   /* 9712 */ 0x40a50000, 0x00004b98, 0x40a50000, 0x00004b9c, \
+   /* 9716 */ 0x40a50000, 0x00004ba0, 0x40a50000, 0x00004ba4, \
+   /* 9720 */ 0x40a50000, 0x00004ba8, 0x40a50000, 0x00004bac, \
+   /* 9724 */ 0x40a50000, 0x00004bb0, 0x40a50000, 0x00004bb4, \
+   /* 9728 */ 0x40a50000, 0x00004bb8, 0x40a50000, 0x00004bbc, \
+   /* 9732 */ 0x40a50000, 0x00004bc0, 0x40a50000, 0x00004bc4, \
+   /* 9736 */ 0x40a50000, 0x00004bc8, 0x40a50000, 0x00004bcc, \
+   /* 9740 */ 0x40a50000, 0x00004bd0, 0x40a50000, 0x00004bd4, \
+   /* 9744 */ 0x40a50000, 0x00004bd8, 0x40a50000, 0x00004bdc, \
+   /* 9748 */ 0x40a50000, 0x00004be0, 0x40a50000, 0x00004be4, \
+   /* 9752 */ 0x40a50000, 0x00004be8, 0x40a50000, 0x00004bec, \
+   /* 9756 */ 0x40a50000, 0x00004bf0, 0x40a50000, 0x00004bf4, \
+   /* 9760 */ 0x40a50000, 0x00004bf8, 0x40a50000, 0x00004bfc, \
+   /* 9764 */ 0x40a50000, 0x00004c00, 0x40a50000, 0x00004c04, \
+   /* 9768 */ 0x40a50000, 0x00004c08, 0x40a50000, 0x00004c0c, \
+   /* 9772 */ 0x40a50000, 0x00004c10, 0x40a50000, 0x00004c14, \
+   /* 9776 */ 0x40a50000, 0x00004c18, 0x40a50000, 0x00004c1c, \
+   /* 9780 */ 0x40a50000, 0x00004c20, 0x40a50000, 0x00004c24, \
+   /* 9784 */ 0x40a50000, 0x00004c28, 0x40a50000, 0x00004c2c, \
+   /* 9788 */ 0x40a50000, 0x00004c30, 0x40a50000, 0x00004c34, \
+   /* 9792 */ 0x40a50000, 0x00004c38, 0x40a50000, 0x00004c3c, \
+   /* 9796 */ 0x40a50000, 0x00004c40, 0x40a50000, 0x00004c44, \
+   /* 9800 */ 0x40a50000, 0x00004c48, 0x40a50000, 0x00004c4c, \
+   /* 9804 */ 0x40a50000, 0x00004c50, 0x40a50000, 0x00004c54, \
+   /* 9808 */ 0x40a50000, 0x00004c58, 0x40a50000, 0x00004c5c, \
+   /* 9812 */ 0x40a50000, 0x00004c60, 0x40a50000, 0x00004c64, \
+   /* 9816 */ 0x40a50000, 0x00004c68, 0x40a50000, 0x00004c6c, \
+   /* 9820 */ 0x40a50000, 0x00004c70, 0x40a50000, 0x00004c74, \
+   /* 9824 */ 0x40a50000, 0x00004c78, 0x40a50000, 0x00004c7c, \
+   /* 9828 */ 0x40a50000, 0x00004c80, 0x40a50000, 0x00004c84, \
+   /* 9832 */ 0x40a50000, 0x00004c88, 0x40a50000, 0x00004c8c, \
+   /* 9836 */ 0x40a50000, 0x00004c90, 0x40a50000, 0x00004c94, \
+   /* 9840 */ 0x40a50000, 0x00004c98, 0x40a50000, 0x00004c9c, \
+   /* 9844 */ 0x40a50000, 0x00004ca0, 0x40a50000, 0x00004ca4, \
+   /* 9848 */ 0x40a50000, 0x00004ca8, 0x40a50000, 0x00004cac, \
+   /* 9852 */ 0x40a50000, 0x00004cb0, 0x40a50000, 0x00004cb4, \
+   /* 9856 */ 0x40a50000, 0x00004cb8, 0x40a50000, 0x00004cbc, \
+   /* 9860 */ 0x40a50000, 0x00004cc0, 0x40a50000, 0x00004cc4, \
+   /* 9864 */ 0x40a50000, 0x00004cc8, 0x40a50000, 0x00004ccc, \
+   /* 9868 */ 0x40a50000, 0x00004cd0, 0x40a50000, 0x00004cd4, \
+   /* 9872 */ 0x40a50000, 0x00004cd8, 0x40a50000, 0x00004cdc, \
+   /* 9876 */ 0x40a50000, 0x00004ce0, 0x40a50000, 0x00004ce4, \
+   /* 9880 */ 0x40a50000, 0x00004ce8, 0x40a50000, 0x00004cec, \
+   /* 9884 */ 0x40a50000, 0x00004cf0, 0x40a50000, 0x00004cf4, \
+   /* 9888 */ 0x40a50000, 0x00004cf8, 0x40a50000, 0x00004cfc, \
+   /* 9892 */ 0x40a50000, 0x00004d00, 0x40a50000, 0x00004d04, \
+   /* 9896 */ 0x40a50000, 0x00004d08, 0x40a50000, 0x00004d0c, \
+   /* 9900 */ 0x40a50000, 0x00004d10, 0x40a50000, 0x00004d14, \
+   /* 9904 */ 0x40a50000, 0x00004d18, 0x40a50000, 0x00004d1c, \
+   /* 9908 */ 0x40a50000, 0x00004d20, 0x40a50000, 0x00004d24, \
+   /* 9912 */ 0x40a50000, 0x00004d28, 0x40a50000, 0x00004d2c, \
+   /* 9916 */ 0x40a50000, 0x00004d30, 0x40a50000, 0x00004d34, \
+   /* 9920 */ 0x40a50000, 0x00004d38, 0x40a50000, 0x00004d3c, \
+   /* 9924 */ 0x40a50000, 0x00004d40, 0x40a50000, 0x00004d44, \
+   /* 9928 */ 0x40a50000, 0x00004d48, 0x40a50000, 0x00004d4c, \
+   /* 9932 */ 0x40a50000, 0x00004d50, 0x40a50000, 0x00004d54, \
+   /* 9936 */ 0x40a50000, 0x00004d58, 0x40a50000, 0x00004d5c, \
+   /* 9940 */ 0x40a50000, 0x00004d60, 0x40a50000, 0x00004d64, \
+   /* 9944 */ 0x40a50000, 0x00004d68, 0x40a50000, 0x00004d6c, \
+   /* 9948 */ 0x40a50000, 0x00004d70, 0x40a50000, 0x00004d74, \
+   /* 9952 */ 0x40a50000, 0x00004d78, 0x40a50000, 0x00004d7c, \
+   /* 9956 */ 0x40a50000, 0x00004d80, 0x40a50000, 0x00004d84, \
+   /* 9960 */ 0x40a50000, 0x00004d88, 0x40a50000, 0x00004d8c, \
+   /* 9964 */ 0x40a50000, 0x00004d90, 0x40a50000, 0x00004d94, \
+   /* 9968 */ 0x40a50000, 0x00004d98, 0x40a50000, 0x00004d9c, \
+   /* 9972 */ 0x40a50000, 0x00004da0, 0x40a50000, 0x00004da4, \
+   /* 9976 */ 0x40a50000, 0x00004da8, 0x40a50000, 0x00004dac, \
+   /* 9980 */ 0x40a50000, 0x00004db0, 0x40a50000, 0x00004db4, \
+   /* 9984 */ 0x40a50000, 0x00004db8, 0x40a50000, 0x00004dbc, \
+   /* 9988 */ 0x40a50000, 0x00004dc0, 0x40a50000, 0x00004dc4, \
+   /* 9992 */ 0x40a50000, 0x00004dc8, 0x40a50000, 0x00004dcc, \
+   /* 9996 */ 0x40a50000, 0x00004dd0, 0x40a50000, 0x00004dd4, \
+   /* 10000 */ 0x40a50000, 0x00004dd8, 0x40a50000, 0x00004ddc, \
+   /* 10004 */ 0x40a50000, 0x00004de0, 0x40a50000, 0x00004de4, \
+   /* 10008 */ 0x40a50000, 0x00004de8, 0x40a50000, 0x00004dec, \
+   /* 10012 */ 0x40a50000, 0x00004df0, 0x40a50000, 0x00004df4, \
+   /* 10016 */ 0x40a50000, 0x00004df8, 0x40a50000, 0x00004dfc, \
+   /* 10020 */ 0x40a50000, 0x00004e00, 0x40a50000, 0x00004e04, \
+   /* 10024 */ 0x40a50000, 0x00004e08, 0x40a50000, 0x00004e0c, \
+   /* 10028 */ 0x40a50000, 0x00004e10, 0x40a50000, 0x00004e14, \
+   /* 10032 */ 0x40a50000, 0x00004e18, 0x40a50000, 0x00004e1c, \
+   /* 10036 */ 0x40a50000, 0x00004e20, 0x40a50000, 0x00004e24, \
+   /* 10040 */ 0x40a50000, 0x00004e28, 0x40a50000, 0x00004e2c, \
+   /* 10044 */ 0x40a50000, 0x00004e30, 0x40a50000, 0x00004e34, \
+   /* 10048 */ 0x40a50000, 0x00004e38, 0x40a50000, 0x00004e3c, \
+   /* 10052 */ 0x40a50000, 0x00004e40, 0x40a50000, 0x00004e44, \
+   /* 10056 */ 0x40a50000, 0x00004e48, 0x40a50000, 0x00004e4c, \
+   /* 10060 */ 0x40a50000, 0x00004e50, 0x40a50000, 0x00004e54, \
+   /* 10064 */ 0x40a50000, 0x00004e58, 0x40a50000, 0x00004e5c, \
+   /* 10068 */ 0x40a50000, 0x00004e60, 0x40a50000, 0x00004e64, \
+   /* 10072 */ 0x40a50000, 0x00004e68, 0x40a50000, 0x00004e6c, \
+   /* 10076 */ 0x40a50000, 0x00004e70, 0x40a50000, 0x00004e74, \
+   /* 10080 */ 0x40a50000, 0x00004e78, 0x40a50000, 0x00004e7c, \
+   /* 10084 */ 0x40a50000, 0x00004e80, 0x40a50000, 0x00004e84, \
+   /* 10088 */ 0x40a50000, 0x00004e88, 0x40a50000, 0x00004e8c, \
+   /* 10092 */ 0x40a50000, 0x00004e90, 0x40a50000, 0x00004e94, \
+   /* 10096 */ 0x40a50000, 0x00004e98, 0x40a50000, 0x00004e9c, \
+   /* 10100 */ 0x40a50000, 0x00004ea0, 0x40a50000, 0x00004ea4, \
+   /* 10104 */ 0x40a50000, 0x00004ea8, 0x40a50000, 0x00004eac, \
+   /* 10108 */ 0x40a50000, 0x00004eb0, 0x40a50000, 0x00004eb4, \
+   /* 10112 */ 0x40a50000, 0x00004eb8, 0x40a50000, 0x00004ebc, \
+   /* 10116 */ 0x40a50000, 0x00004ec0, 0x40a50000, 0x00004ec4, \
+   /* 10120 */ 0x40a50000, 0x00004ec8, 0x40a50000, 0x00004ecc, \
+   /* 10124 */ 0x40a50000, 0x00004ed0, 0x40a50000, 0x00004ed4, \
+   /* 10128 */ 0x40a50000, 0x00004ed8, 0x40a50000, 0x00004edc, \
+   /* 10132 */ 0x40a50000, 0x00004ee0, 0x40a50000, 0x00004ee4, \
+   /* 10136 */ 0x40a50000, 0x00004ee8, 0x40a50000, 0x00004eec, \
+   /* 10140 */ 0x40a50000, 0x00004ef0, 0x40a50000, 0x00004ef4, \
+   /* 10144 */ 0x40a50000, 0x00004ef8, 0x40a50000, 0x00004efc, \
+   /* 10148 */ 0x40a50000, 0x00004f00, 0x40a50000, 0x00004f04, \
+   /* 10152 */ 0x40a50000, 0x00004f08, 0x40a50000, 0x00004f0c, \
+   /* 10156 */ 0x40a50000, 0x00004f10, 0x40a50000, 0x00004f14, \
+   /* 10160 */ 0x40a50000, 0x00004f18, 0x40a50000, 0x00004f1c, \
+   /* 10164 */ 0x40a50000, 0x00004f20, 0x40a50000, 0x00004f24, \
+   /* 10168 */ 0x40a50000, 0x00004f28, 0x40a50000, 0x00004f2c, \
+   /* 10172 */ 0x40a50000, 0x00004f30, 0x40a50000, 0x00004f34, \
+   /* 10176 */ 0x40a50000, 0x00004f38, 0x40a50000, 0x00004f3c, \
+   /* 10180 */ 0x40a50000, 0x00004f40, 0x40a50000, 0x00004f44, \
+   /* 10184 */ 0x40a50000, 0x00004f48, 0x40a50000, 0x00004f4c, \
+   /* 10188 */ 0x40a50000, 0x00004f50, 0x40a50000, 0x00004f54, \
+   /* 10192 */ 0x40a50000, 0x00004f58, 0x40a50000, 0x00004f5c, \
+   /* 10196 */ 0x40a50000, 0x00004f60, 0x40a50000, 0x00004f64, \
+   /* 10200 */ 0x40a50000, 0x00004f68, 0x40a50000, 0x00004f6c, \
+   /* 10204 */ 0x40a50000, 0x00004f70, 0x40a50000, 0x00004f74, \
+   /* 10208 */ 0x40a50000, 0x00004f78, 0x40a50000, 0x00004f7c, \
+   /* 10212 */ 0x40a50000, 0x00004f80, 0x40a50000, 0x00004f84, \
+   /* 10216 */ 0x40a50000, 0x00004f88, 0x40a50000, 0x00004f8c, \
+   /* 10220 */ 0x40a50000, 0x00004f90, 0x40a50000, 0x00004f94, \
+   /* 10224 */ 0x40a50000, 0x00004f98, 0x40a50000, 0x00004f9c, \
+   /* 10228 */ 0x40a50000, 0x00004fa0, 0x40a50000, 0x00004fa4, \
+   /* 10232 */ 0x40a50000, 0x00004fa8, 0x40a50000, 0x00004fac, \
+   /* 10236 */ 0x40a50000, 0x00004fb0, 0x40a50000, 0x00004fb4, \
+   /* 10240 */ 0x40a50000, 0x00004fb8, 0x40a50000, 0x00004fbc, \
+   /* 10244 */ 0x40a50000, 0x00004fc0, 0x40a50000, 0x00004fc4, \
+   /* 10248 */ 0x40a50000, 0x00004fc8, 0x40a50000, 0x00004fcc, \
+   /* 10252 */ 0x40a50000, 0x00004fd0, 0x40a50000, 0x00004fd4, \
+   /* 10256 */ 0x40a50000, 0x00004fd8, 0x40a50000, 0x00004fdc, \
+   /* 10260 */ 0x40a50000, 0x00004fe0, 0x40a50000, 0x00004fe4, \
+   /* 10264 */ 0x40a50000, 0x00004fe8, 0x40a50000, 0x00004fec, \
+   /* 10268 */ 0x40a50000, 0x00004ff0, 0x40a50000, 0x00004ff4, \
+   /* 10272 */ 0x40a50000, 0x00004ff8, 0x40a50000, 0x00004ffc, \
+   /* 10276 */ 0x40a50000, 0x00005000, 0x40a50000, 0x00005004, \
+   /* 10280 */ 0x40a50000, 0x00005008, 0x40a50000, 0x0000500c, \
+   /* 10284 */ 0x40a50000, 0x00005010, 0x40a50000, 0x00005014, \
+   /* 10288 */ 0x40a50000, 0x00005018, 0x40a50000, 0x0000501c, \
+   /* 10292 */ 0x40a50000, 0x00005020, 0x40a50000, 0x00005024, \
+   /* 10296 */ 0x40a50000, 0x00005028, 0x40a50000, 0x0000502c, \
+   /* 10300 */ 0x40a50000, 0x00005030, 0x40a50000, 0x00005034, \
+   /* 10304 */ 0x40a50000, 0x00005038, 0x40a50000, 0x0000503c, \
+   /* 10308 */ 0x40a50000, 0x00005040, 0x40a50000, 0x00005044, \
+   /* 10312 */ 0x40a50000, 0x00005048, 0x40a50000, 0x0000504c, \
+   /* 10316 */ 0x40a50000, 0x00005050, 0x40a50000, 0x00005054, \
+   /* 10320 */ 0x40a50000, 0x00005058, 0x40a50000, 0x0000505c, \
+   /* 10324 */ 0x40a50000, 0x00005060, 0x40a50000, 0x00005064, \
+   /* 10328 */ 0x40a50000, 0x00005068, 0x40a50000, 0x0000506c, \
+   /* 10332 */ 0x40a50000, 0x00005070, 0x40a50000, 0x00005074, \
+   /* 10336 */ 0x40a50000, 0x00005078, 0x40a50000, 0x0000507c, \
+   /* 10340 */ 0x40a50000, 0x00005080, 0x40a50000, 0x00005084, \
+   /* 10344 */ 0x40a50000, 0x00005088, 0x40a50000, 0x0000508c, \
+   /* 10348 */ 0x40a50000, 0x00005090, 0x40a50000, 0x00005094, \
+   /* 10352 */ 0x40a50000, 0x00005098, 0x40a50000, 0x0000509c, \
+   /* 10356 */ 0x40a50000, 0x000050a0, 0x40a50000, 0x000050a4, \
+   /* 10360 */ 0x40a50000, 0x000050a8, 0x40a50000, 0x000050ac, \
+   /* 10364 */ 0x40a50000, 0x000050b0, 0x40a50000, 0x000050b4, \
+   /* 10368 */ 0x40a50000, 0x000050b8, 0x40a50000, 0x000050bc, \
+   /* 10372 */ 0x40a50000, 0x000050c0, 0x40a50000, 0x000050c4, \
+   /* 10376 */ 0x40a50000, 0x000050c8, 0x40a50000, 0x000050cc, \
+   /* 10380 */ 0x40a50000, 0x000050d0, 0x40a50000, 0x000050d4, \
+   /* 10384 */ 0x40a50000, 0x000050d8, 0x40a50000, 0x000050dc, \
+   /* 10388 */ 0x40a50000, 0x000050e0, 0x40a50000, 0x000050e4, \
+   /* 10392 */ 0x40a50000, 0x000050e8, 0x40a50000, 0x000050ec, \
+   /* 10396 */ 0x40a50000, 0x000050f0, 0x40a50000, 0x000050f4, \
+   /* 10400 */ 0x40a50000, 0x000050f8, 0x40a50000, 0x000050fc, \
+   /* 10404 */ 0x40a50000, 0x00005100, 0x40a50000, 0x00005104, \
+   /* 10408 */ 0x40a50000, 0x00005108, 0x40a50000, 0x0000510c, \
+   /* 10412 */ 0x40a50000, 0x00005110, 0x40a50000, 0x00005114, \
+   /* 10416 */ 0x40a50000, 0x00005118, 0x40a50000, 0x0000511c, \
+   /* 10420 */ 0x40a50000, 0x00005120, 0x40a50000, 0x00005124, \
+   /* 10424 */ 0x40a50000, 0x00005128, 0x40a50000, 0x0000512c, \
+   /* 10428 */ 0x40a50000, 0x00005130, 0x40a50000, 0x00005134, \
+   /* 10432 */ 0x40a50000, 0x00005138, 0x40a50000, 0x0000513c, \
+   /* 10436 */ 0x40a50000, 0x00005140, 0x40a50000, 0x00005144, \
+   /* 10440 */ 0x40a50000, 0x00005148, 0x40a50000, 0x0000514c, \
+   /* 10444 */ 0x40a50000, 0x00005150, 0x40a50000, 0x00005154, \
+   /* 10448 */ 0x40a50000, 0x00005158, 0x40a50000, 0x0000515c, \
+   /* 10452 */ 0x40a50000, 0x00005160, 0x40a50000, 0x00005164, \
+   /* 10456 */ 0x40a50000, 0x00005168, 0x40a50000, 0x0000516c, \
+   /* 10460 */ 0x40a50000, 0x00005170, 0x40a50000, 0x00005174, \
+   /* 10464 */ 0x40a50000, 0x00005178, 0x40a50000, 0x0000517c, \
+   /* 10468 */ 0x40a50000, 0x00005180, 0x40a50000, 0x00005184, \
+   /* 10472 */ 0x40a50000, 0x00005188, 0x40a50000, 0x0000518c, \
+   /* 10476 */ 0x40a50000, 0x00005190, 0x40a50000, 0x00005194, \
+   /* 10480 */ 0x40a50000, 0x00005198, 0x40a50000, 0x0000519c, \
+   /* 10484 */ 0x40a50000, 0x000051a0, 0x40a50000, 0x000051a4, \
+   /* 10488 */ 0x40a50000, 0x000051a8, 0x40a50000, 0x000051ac, \
+   /* 10492 */ 0x40a50000, 0x000051b0, 0x40a50000, 0x000051b4, \
+   /* 10496 */ 0x40a50000, 0x000051b8, 0x40a50000, 0x000051bc, \
+   /* 10500 */ 0x40a50000, 0x000051c0, 0x40a50000, 0x000051c4, \
+   /* 10504 */ 0x40a50000, 0x000051c8, 0x40a50000, 0x000051cc, \
+   /* 10508 */ 0x40a50000, 0x000051d0, 0x40a50000, 0x000051d4, \
+   /* 10512 */ 0x40a50000, 0x000051d8, 0x40a50000, 0x000051dc, \
+   /* 10516 */ 0x40a50000, 0x000051e0, 0x40a50000, 0x000051e4, \
+   /* 10520 */ 0x40a50000, 0x000051e8, 0x40a50000, 0x000051ec, \
+   /* 10524 */ 0x40a50000, 0x000051f0, 0x40a50000, 0x000051f4, \
+   /* 10528 */ 0x40a50000, 0x000051f8, 0x40a50000, 0x000051fc, \
+   /* 10532 */ 0x40a50000, 0x00005200, 0x40a50000, 0x00005204, \
+   /* 10536 */ 0x40a50000, 0x00005208, 0x40a50000, 0x0000520c, \
+   /* 10540 */ 0x40a50000, 0x00005210, 0x40a50000, 0x00005214, \
+   /* 10544 */ 0x40a50000, 0x00005218, 0x40a50000, 0x0000521c, \
+   /* 10548 */ 0x40a50000, 0x00005220, 0x40a50000, 0x00005224, \
+   /* 10552 */ 0x40a50000, 0x00005228, 0x40a50000, 0x0000522c, \
+   /* 10556 */ 0x40a50000, 0x00005230, 0x40a50000, 0x00005234, \
+   /* 10560 */ 0x40a50000, 0x00005238, 0x40a50000, 0x0000523c, \
+   /* 10564 */ 0x40a50000, 0x00005240, 0x40a50000, 0x00005244, \
+   /* 10568 */ 0x40a50000, 0x00005248, 0x40a50000, 0x0000524c, \
+   /* 10572 */ 0x40a50000, 0x00005250, 0x40a50000, 0x00005254, \
+   /* 10576 */ 0x40a50000, 0x00005258, 0x40a50000, 0x0000525c, \
+   /* 10580 */ 0x40a50000, 0x00005260, 0x40a50000, 0x00005264, \
+   /* 10584 */ 0x40a50000, 0x00005268, 0x40a50000, 0x0000526c, \
+   /* 10588 */ 0x40a50000, 0x00005270, 0x40a50000, 0x00005274, \
+   /* 10592 */ 0x40a50000, 0x00005278, 0x40a50000, 0x0000527c, \
+   /* 10596 */ 0x40a50000, 0x00005280, 0x40a50000, 0x00005284, \
+   /* 10600 */ 0x40a50000, 0x00005288, 0x40a50000, 0x0000528c, \
+   /* 10604 */ 0x40a50000, 0x00005290, 0x40a50000, 0x00005294, \
+   /* 10608 */ 0x40a50000, 0x00005298, 0x40a50000, 0x0000529c, \
+   /* 10612 */ 0x40a50000, 0x000052a0, 0x40a50000, 0x000052a4, \
+   /* 10616 */ 0x40a50000, 0x000052a8, 0x40a50000, 0x000052ac, \
+   /* 10620 */ 0x40a50000, 0x000052b0, 0x40a50000, 0x000052b4, \
+   /* 10624 */ 0x40a50000, 0x000052b8, 0x40a50000, 0x000052bc, \
+   /* 10628 */ 0x40a50000, 0x000052c0, 0x40a50000, 0x000052c4, \
+   /* 10632 */ 0x40a50000, 0x000052c8, 0x40a50000, 0x000052cc, \
+   /* 10636 */ 0x40a50000, 0x000052d0, 0x40a50000, 0x000052d4, \
+   /* 10640 */ 0x40a50000, 0x000052d8, 0x40a50000, 0x000052dc, \
+   /* 10644 */ 0x40a50000, 0x000052e0, 0x40a50000, 0x000052e4, \
+   /* 10648 */ 0x40a50000, 0x000052e8, 0x40a50000, 0x000052ec, \
+   /* 10652 */ 0x40a50000, 0x000052f0, 0x40a50000, 0x000052f4, \
+   /* 10656 */ 0x40a50000, 0x000052f8, 0x40a50000, 0x000052fc, \
+   /* 10660 */ 0x40a50000, 0x00005300, 0x40a50000, 0x00005304, \
+   /* 10664 */ 0x40a50000, 0x00005308, 0x40a50000, 0x0000530c, \
+   /* 10668 */ 0x40a50000, 0x00005310, 0x40a50000, 0x00005314, \
+   /* 10672 */ 0x40a50000, 0x00005318, 0x40a50000, 0x0000531c, \
+   /* 10676 */ 0x40a50000, 0x00005320, 0x40a50000, 0x00005324, \
+   /* 10680 */ 0x40a50000, 0x00005328, 0x40a50000, 0x0000532c, \
+   /* 10684 */ 0x40a50000, 0x00005330, 0x40a50000, 0x00005334, \
+   /* 10688 */ 0x40a50000, 0x00005338, 0x40a50000, 0x0000533c, \
+   /* 10692 */ 0x40a50000, 0x00005340, 0x40a50000, 0x00005344, \
+   /* 10696 */ 0x40a50000, 0x00005348, 0x40a50000, 0x0000534c, \
+   /* 10700 */ 0x40a50000, 0x00005350, 0x40a50000, 0x00005354, \
+   /* 10704 */ 0x40a50000, 0x00005358, 0x40a50000, 0x0000535c, \
+   /* 10708 */ 0x40a50000, 0x00005360, 0x40a50000, 0x00005364, \
+   /* 10712 */ 0x40a50000, 0x00005368, 0x40a50000, 0x0000536c, \
+   /* 10716 */ 0x40a50000, 0x00005370, 0x40a50000, 0x00005374, \
+   /* 10720 */ 0x40a50000, 0x00005378, 0x40a50000, 0x0000537c, \
+   /* 10724 */ 0x40a50000, 0x00005380, 0x40a50000, 0x00005384, \
+   /* 10728 */ 0x40a50000, 0x00005388, 0x40a50000, 0x0000538c, \
+   /* 10732 */ 0x40a50000, 0x00005390, 0x40a50000, 0x00005394, \
+   /* 10736 */ 0x40a50000, 0x00005398, 0x40a50000, 0x0000539c, \
+   /* 10740 */ 0x40a50000, 0x000053a0, 0x40a50000, 0x000053a4, \
+   /* 10744 */ 0x40a50000, 0x000053a8, 0x40a50000, 0x000053ac, \
+   /* 10748 */ 0x40a50000, 0x000053b0, 0x40a50000, 0x000053b4, \
+   /* 10752 */ 0x40a50000, 0x000053b8, 0x40a50000, 0x000053bc, \
+   /* 10756 */ 0x40a50000, 0x000053c0, 0x40a50000, 0x000053c4, \
+   /* 10760 */ 0x40a50000, 0x000053c8, 0x40a50000, 0x000053cc, \
+   /* 10764 */ 0x40a50000, 0x000053d0, 0x40a50000, 0x000053d4, \
+   /* 10768 */ 0x40a50000, 0x000053d8, 0x40a50000, 0x000053dc, \
+   /* 10772 */ 0x40a50000, 0x000053e0, 0x40a50000, 0x000053e4, \
+   /* 10776 */ 0x40a50000, 0x000053e8, 0x40a50000, 0x000053ec, \
+   /* 10780 */ 0x40a50000, 0x000053f0, 0x40a50000, 0x000053f4, \
+   /* 10784 */ 0x40a50000, 0x000053f8, 0x40a50000, 0x000053fc, \
+   /* 10788 */ 0x40a50000, 0x00005400, 0x40a50000, 0x00005404, \
+   /* 10792 */ 0x40a50000, 0x00005408, 0x40a50000, 0x0000540c, \
+   /* 10796 */ 0x40a50000, 0x00005410, 0x40a50000, 0x00005414, \
+   /* 10800 */ 0x40a50000, 0x00005418, 0x40a50000, 0x0000541c, \
+   /* 10804 */ 0x40a50000, 0x00005420, 0x40a50000, 0x00005424, \
+   /* 10808 */ 0x40a50000, 0x00005428, 0x40a50000, 0x0000542c, \
+   /* 10812 */ 0x40a50000, 0x00005430, 0x40a50000, 0x00005434, \
+   /* 10816 */ 0x40a50000, 0x00005438, 0x40a50000, 0x0000543c, \
+   /* 10820 */ 0x40a50000, 0x00005440, 0x40a50000, 0x00005444, \
+   /* 10824 */ 0x40a50000, 0x00005448, 0x40a50000, 0x0000544c, \
+   /* 10828 */ 0x40a50000, 0x00005450, 0x40a50000, 0x00005454, \
+   /* 10832 */ 0x40a50000, 0x00005458, 0x40a50000, 0x0000545c, \
+   /* 10836 */ 0x40a50000, 0x00005460, 0x40a50000, 0x00005464, \
+   /* 10840 */ 0x40a50000, 0x00005468, 0x40a50000, 0x0000546c, \
+   /* 10844 */ 0x40a50000, 0x00005470, 0x40a50000, 0x00005474, \
+   /* 10848 */ 0x40a50000, 0x00005478, 0x40a50000, 0x0000547c, \
+   /* 10852 */ 0x40a50000, 0x00005480, 0x40a50000, 0x00005484, \
+   /* 10856 */ 0x40a50000, 0x00005488, 0x40a50000, 0x0000548c, \
+   /* 10860 */ 0x40a50000, 0x00005490, 0x40a50000, 0x00005494, \
+   /* 10864 */ 0x40a50000, 0x00005498, 0x40a50000, 0x0000549c, \
+   /* 10868 */ 0x40a50000, 0x000054a0, 0x40a50000, 0x000054a4, \
+   /* 10872 */ 0x40a50000, 0x000054a8, 0x40a50000, 0x000054ac, \
+   /* 10876 */ 0x40a50000, 0x000054b0, 0x40a50000, 0x000054b4, \
+   /* 10880 */ 0x40a50000, 0x000054b8, 0x40a50000, 0x000054bc, \
+   /* 10884 */ 0x40a50000, 0x000054c0, 0x40a50000, 0x000054c4, \
+   /* 10888 */ 0x40a50000, 0x000054c8, 0x40a50000, 0x000054cc, \
+   /* 10892 */ 0x40a50000, 0x000054d0, 0x40a50000, 0x000054d4, \
+   /* 10896 */ 0x40a50000, 0x000054d8, 0x40a50000, 0x000054dc, \
+   /* 10900 */ 0x40a50000, 0x000054e0, 0x40a50000, 0x000054e4, \
+   /* 10904 */ 0x40a50000, 0x000054e8, 0x40a50000, 0x000054ec, \
+   /* 10908 */ 0x40a50000, 0x000054f0, 0x40a50000, 0x000054f4, \
+   /* 10912 */ 0x40a50000, 0x000054f8, 0x40a50000, 0x000054fc, \
+   /* 10916 */ 0x40a50000, 0x00005500, 0x40a50000, 0x00005504, \
+   /* 10920 */ 0x40a50000, 0x00005508, 0x40a50000, 0x0000550c, \
+   /* 10924 */ 0x40a50000, 0x00005510, 0x40a50000, 0x00005514, \
+   /* 10928 */ 0x40a50000, 0x00005518, 0x40a50000, 0x0000551c, \
+   /* 10932 */ 0x40a50000, 0x00005520, 0x40a50000, 0x00005524, \
+   /* 10936 */ 0x40a50000, 0x00005528, 0x40a50000, 0x0000552c, \
+   /* 10940 */ 0x40a50000, 0x00005530, 0x40a50000, 0x00005534, \
+   /* 10944 */ 0x40a50000, 0x00005538, 0x40a50000, 0x0000553c, \
+   /* 10948 */ 0x40a50000, 0x00005540, 0x40a50000, 0x00005544, \
+   /* 10952 */ 0x40a50000, 0x00005548, 0x40a50000, 0x0000554c, \
+   /* 10956 */ 0x40a50000, 0x00005550, 0x40a50000, 0x00005554, \
+   /* 10960 */ 0x40a50000, 0x00005558, 0x40a50000, 0x0000555c, \
+   /* 10964 */ 0x40a50000, 0x00005560, 0x40a50000, 0x00005564, \
+   /* 10968 */ 0x40a50000, 0x00005568, 0x40a50000, 0x0000556c, \
+   /* 10972 */ 0x40a50000, 0x00005570, 0x40a50000, 0x00005574, \
+   /* 10976 */ 0x40a50000, 0x00005578, 0x40a50000, 0x0000557c, \
+   /* 10980 */ 0x40a50000, 0x00005580, 0x40a50000, 0x00005584, \
+   /* 10984 */ 0x40a50000, 0x00005588, 0x40a50000, 0x0000558c, \
+   /* 10988 */ 0x40a50000, 0x00005590, 0x40a50000, 0x00005594, \
+   /* 10992 */ 0x40a50000, 0x00005598, 0x40a50000, 0x0000559c, \
+   /* 10996 */ 0x40a50000, 0x000055a0, 0x40a50000, 0x000055a4, \
+   /* 11000 */ 0x40a50000, 0x000055a8, 0x40a50000, 0x000055ac, \
+   /* 11004 */ 0x40a50000, 0x000055b0, 0x40a50000, 0x000055b4, \
+   /* 11008 */ 0x40a50000, 0x000055b8, 0x40a50000, 0x000055bc, \
+   /* 11012 */ 0x40a50000, 0x000055c0, 0x40a50000, 0x000055c4, \
+   /* 11016 */ 0x40a50000, 0x000055c8, 0x40a50000, 0x000055cc, \
+   /* 11020 */ 0x40a50000, 0x000055d0, 0x40a50000, 0x000055d4, \
+   /* 11024 */ 0x40a50000, 0x000055d8, 0x40a50000, 0x000055dc, \
+   /* 11028 */ 0x40a50000, 0x000055e0, 0x40a50000, 0x000055e4, \
+   /* 11032 */ 0x40a50000, 0x000055e8, 0x40a50000, 0x000055ec, \
+   /* 11036 */ 0x40a50000, 0x000055f0, 0x40a50000, 0x000055f4, \
+   /* 11040 */ 0x40a50000, 0x000055f8, 0x40a50000, 0x000055fc, \
+   /* 11044 */ 0x40a50000, 0x00005600, 0x40a50000, 0x00005604, \
+   /* 11048 */ 0x40a50000, 0x00005608, 0x40a50000, 0x0000560c, \
+   /* 11052 */ 0x40a50000, 0x00005610, 0x40a50000, 0x00005614, \
+   /* 11056 */ 0x40a50000, 0x00005618, 0x40a50000, 0x0000561c, \
+   /* 11060 */ 0x40a50000, 0x00005620, 0x40a50000, 0x00005624, \
+   /* 11064 */ 0x40a50000, 0x00005628, 0x40a50000, 0x0000562c, \
+   /* 11068 */ 0x40a50000, 0x00005630, 0x40a50000, 0x00005634, \
+   /* 11072 */ 0x40a50000, 0x00005638, 0x40a50000, 0x0000563c, \
+   /* 11076 */ 0x40a50000, 0x00005640, 0x40a50000, 0x00005644, \
+   /* 11080 */ 0x40a50000, 0x00005648, 0x40a50000, 0x0000564c, \
+   /* 11084 */ 0x40a50000, 0x00005650, 0x40a50000, 0x00005654, \
+   /* 11088 */ 0x40a50000, 0x00005658, 0x40a50000, 0x0000565c, \
+   /* 11092 */ 0x40a50000, 0x00005660, 0x40a50000, 0x00005664, \
+   /* 11096 */ 0x40a50000, 0x00005668, 0x40a50000, 0x0000566c, \
+   /* 11100 */ 0x40a50000, 0x00005670, 0x40a50000, 0x00005674, \
+   /* 11104 */ 0x40a50000, 0x00005678, 0x40a50000, 0x0000567c, \
+   /* 11108 */ 0x40a50000, 0x00005680, 0x40a50000, 0x00005684, \
+   /* 11112 */ 0x40a50000, 0x00005688, 0x40a50000, 0x0000568c, \
+   /* 11116 */ 0x40a50000, 0x00005690, 0x40a50000, 0x00005694, \
+   /* 11120 */ 0x40a50000, 0x00005698, 0x40a50000, 0x0000569c, \
+   /* 11124 */ 0x40a50000, 0x000056a0, 0x40a50000, 0x000056a4, \
+   /* 11128 */ 0x40a50000, 0x000056a8, 0x40a50000, 0x000056ac, \
+   /* 11132 */ 0x40a50000, 0x000056b0, 0x40a50000, 0x000056b4, \
+   /* 11136 */ 0x40a50000, 0x000056b8, 0x40a50000, 0x000056bc, \
+   /* 11140 */ 0x40a50000, 0x000056c0, 0x40a50000, 0x000056c4, \
+   /* 11144 */ 0x40a50000, 0x000056c8, 0x40a50000, 0x000056cc, \
+   /* 11148 */ 0x40a50000, 0x000056d0, 0x40a50000, 0x000056d4, \
+   /* 11152 */ 0x40a50000, 0x000056d8, 0x40a50000, 0x000056dc, \
+   /* 11156 */ 0x40a50000, 0x000056e0, 0x40a50000, 0x000056e4, \
+   /* 11160 */ 0x40a50000, 0x000056e8, 0x40a50000, 0x000056ec, \
+   /* 11164 */ 0x40a50000, 0x000056f0, 0x40a50000, 0x000056f4, \
+   /* 11168 */ 0x40a50000, 0x000056f8, 0x40a50000, 0x000056fc, \
+   /* 11172 */ 0x40a50000, 0x00005700, 0x40a50000, 0x00005704, \
+   /* 11176 */ 0x40a50000, 0x00005708, 0x40a50000, 0x0000570c, \
+   /* 11180 */ 0x40a50000, 0x00005710, 0x40a50000, 0x00005714, \
+   /* 11184 */ 0x40a50000, 0x00005718, 0x40a50000, 0x0000571c, \
+   /* 11188 */ 0x40a50000, 0x00005720, 0x40a50000, 0x00005724, \
+   /* 11192 */ 0x40a50000, 0x00005728, 0x40a50000, 0x0000572c, \
+   /* 11196 */ 0x40a50000, 0x00005730, 0x40a50000, 0x00005734, \
+   /* 11200 */ 0x40a50000, 0x00005738, 0x40a50000, 0x0000573c, \
+   /* 11204 */ 0x40a50000, 0x00005740, 0x40a50000, 0x00005744, \
+   /* 11208 */ 0x40a50000, 0x00005748, 0x40a50000, 0x0000574c, \
+   /* 11212 */ 0x40a50000, 0x00005750, 0x40a50000, 0x00005754, \
+   /* 11216 */ 0x40a50000, 0x00005758, 0x40a50000, 0x0000575c, \
+   /* 11220 */ 0x40a50000, 0x00005760, 0x40a50000, 0x00005764, \
+   /* 11224 */ 0x40a50000, 0x00005768, 0x40a50000, 0x0000576c, \
+   /* 11228 */ 0x40a50000, 0x00005770, 0x40a50000, 0x00005774, \
+   /* 11232 */ 0x40a50000, 0x00005778, 0x40a50000, 0x0000577c, \
+   /* 11236 */ 0x40a50000, 0x00005780, 0x40a50000, 0x00005784, \
+   /* 11240 */ 0x40a50000, 0x00005788, 0x40a50000, 0x0000578c, \
+   /* 11244 */ 0x40a50000, 0x00005790, 0x40a50000, 0x00005794, \
+   /* 11248 */ 0x40a50000, 0x00005798, 0x40a50000, 0x0000579c, \
+   /* 11252 */ 0x40a50000, 0x000057a0, 0x40a50000, 0x000057a4, \
+   /* 11256 */ 0x40a50000, 0x000057a8, 0x40a50000, 0x000057ac, \
+   /* 11260 */ 0x40a50000, 0x000057b0, 0x40a50000, 0x000057b4, \
+   /* 11264 */ 0x40a50000, 0x000057b8, 0x40a50000, 0x000057bc, \
+   /* 11268 */ 0x40a50000, 0x000057c0, 0x40a50000, 0x000057c4, \
+   /* 11272 */ 0x40a50000, 0x000057c8, 0x40a50000, 0x000057cc, \
+   /* 11276 */ 0x40a50000, 0x000057d0, 0x40a50000, 0x000057d4, \
+   /* 11280 */ 0x40a50000, 0x000057d8, 0x40a50000, 0x000057dc, \
+   /* 11284 */ 0x40a50000, 0x000057e0, 0x40a50000, 0x000057e4, \
+   /* 11288 */ 0x40a50000, 0x000057e8, 0x40a50000, 0x000057ec, \
+   /* 11292 */ 0x40a50000, 0x000057f0, 0x40a50000, 0x000057f4, \
+   /* 11296 */ 0x40a50000, 0x000057f8, 0x40a50000, 0x000057fc, \
+   /* 11300 */ 0x40a50000, 0x00005800, 0x40a50000, 0x00005804, \
+   /* 11304 */ 0x40a50000, 0x00005808, 0x40a50000, 0x0000580c, \
+   /* 11308 */ 0x40a50000, 0x00005810, 0x40a50000, 0x00005814, \
+   /* 11312 */ 0x40a50000, 0x00005818, 0x40a50000, 0x0000581c, \
+   /* 11316 */ 0x40a50000, 0x00005820, 0x40a50000, 0x00005824, \
+   /* 11320 */ 0x40a50000, 0x00005828, 0x40a50000, 0x0000582c, \
+   /* 11324 */ 0x40a50000, 0x00005830, 0x40a50000, 0x00005834, \
+   /* 11328 */ 0x40a50000, 0x00005838, 0x40a50000, 0x0000583c, \
+   /* 11332 */ 0x40a50000, 0x00005840, 0x40a50000, 0x00005844, \
+   /* 11336 */ 0x40a50000, 0x00005848, 0x40a50000, 0x0000584c, \
+   /* 11340 */ 0x40a50000, 0x00005850, 0x40a50000, 0x00005854, \
+   /* 11344 */ 0x40a50000, 0x00005858, 0x40a50000, 0x0000585c, \
+   /* 11348 */ 0x40a50000, 0x00005860, 0x40a50000, 0x00005864, \
+   /* 11352 */ 0x40a50000, 0x00005868, 0x40a50000, 0x0000586c, \
+   /* 11356 */ 0x40a50000, 0x00005870, 0x40a50000, 0x00005874, \
+   /* 11360 */ 0x40a50000, 0x00005878, 0x40a50000, 0x0000587c, \
+   /* 11364 */ 0x40a50000, 0x00005880, 0x40a50000, 0x00005884, \
+   /* 11368 */ 0x40a50000, 0x00005888, 0x40a50000, 0x0000588c, \
+   /* 11372 */ 0x40a50000, 0x00005890, 0x40a50000, 0x00005894, \
+   /* 11376 */ 0x40a50000, 0x00005898, 0x40a50000, 0x0000589c, \
+   /* 11380 */ 0x40a50000, 0x000058a0, 0x40a50000, 0x000058a4, \
+   /* 11384 */ 0x40a50000, 0x000058a8, 0x40a50000, 0x000058ac, \
+   /* 11388 */ 0x40a50000, 0x000058b0, 0x40a50000, 0x000058b4, \
+   /* 11392 */ 0x40a50000, 0x000058b8, 0x40a50000, 0x000058bc, \
+   /* 11396 */ 0x40a50000, 0x000058c0, 0x40a50000, 0x000058c4, \
+   /* 11400 */ 0x40a50000, 0x000058c8, 0x40a50000, 0x000058cc, \
+   /* 11404 */ 0x40a50000, 0x000058d0, 0x40a50000, 0x000058d4, \
+   /* 11408 */ 0x40a50000, 0x000058d8, 0x40a50000, 0x000058dc, \
+   /* 11412 */ 0x40a50000, 0x000058e0, 0x40a50000, 0x000058e4, \
+   /* 11416 */ 0x40a50000, 0x000058e8, 0x40a50000, 0x000058ec, \
+   /* 11420 */ 0x40a50000, 0x000058f0, 0x40a50000, 0x000058f4, \
+   /* 11424 */ 0x40a50000, 0x000058f8, 0x40a50000, 0x000058fc, \
+   /* 11428 */ 0x40a50000, 0x00005900, 0x40a50000, 0x00005904, \
+   /* 11432 */ 0x40a50000, 0x00005908, 0x40a50000, 0x0000590c, \
+   /* 11436 */ 0x40a50000, 0x00005910, 0x40a50000, 0x00005914, \
+   /* 11440 */ 0x40a50000, 0x00005918, 0x40a50000, 0x0000591c, \
+   /* 11444 */ 0x40a50000, 0x00005920, 0x40a50000, 0x00005924, \
+   /* 11448 */ 0x40a50000, 0x00005928, 0x40a50000, 0x0000592c, \
+   /* 11452 */ 0x40a50000, 0x00005930, 0x40a50000, 0x00005934, \
+   /* 11456 */ 0x40a50000, 0x00005938, 0x40a50000, 0x0000593c, \
+   /* 11460 */ 0x40a50000, 0x00005940, 0x40a50000, 0x00005944, \
+   /* 11464 */ 0x40a50000, 0x00005948, 0x40a50000, 0x0000594c, \
+   /* 11468 */ 0x40a50000, 0x00005950, 0x40a50000, 0x00005954, \
+   /* 11472 */ 0x40a50000, 0x00005958, 0x40a50000, 0x0000595c, \
+   /* 11476 */ 0x40a50000, 0x00005960, 0x40a50000, 0x00005964, \
+   /* 11480 */ 0x40a50000, 0x00005968, 0x40a50000, 0x0000596c, \
+   /* 11484 */ 0x40a50000, 0x00005970, 0x40a50000, 0x00005974, \
+   /* 11488 */ 0x40a50000, 0x00005978, 0x40a50000, 0x0000597c, \
+   /* 11492 */ 0x40a50000, 0x00005980, 0x40a50000, 0x00005984, \
+   /* 11496 */ 0x40a50000, 0x00005988, 0x40a50000, 0x0000598c, \
+   /* 11500 */ 0x40a50000, 0x00005990, 0x40a50000, 0x00005994, \
+   /* 11504 */ 0x40a50000, 0x00005998, 0x40a50000, 0x0000599c, \
+   /* 11508 */ 0x40a50000, 0x000059a0, 0x40a50000, 0x000059a4, \
+   /* 11512 */ 0x40a50000, 0x000059a8, 0x40a50000, 0x000059ac, \
+   /* 11516 */ 0x40a50000, 0x000059b0, 0x40a50000, 0x000059b4, \
+   /* 11520 */ 0x40a50000, 0x000059b8, 0x40a50000, 0x000059bc, \
+   /* 11524 */ 0x40a50000, 0x000059c0, 0x40a50000, 0x000059c4, \
+   /* 11528 */ 0x40a50000, 0x000059c8, 0x40a50000, 0x000059cc, \
+   /* 11532 */ 0x40a50000, 0x000059d0, 0x40a50000, 0x000059d4, \
+   /* 11536 */ 0x40a50000, 0x000059d8, 0x40a50000, 0x000059dc, \
+   /* 11540 */ 0x40a50000, 0x000059e0, 0x40a50000, 0x000059e4, \
+   /* 11544 */ 0x40a50000, 0x000059e8, 0x40a50000, 0x000059ec, \
+   /* 11548 */ 0x40a50000, 0x000059f0, 0x40a50000, 0x000059f4, \
+   /* 11552 */ 0x40a50000, 0x000059f8, 0x40a50000, 0x000059fc, \
+   /* 11556 */ 0x40a50000, 0x00005a00, 0x40a50000, 0x00005a04, \
+   /* 11560 */ 0x40a50000, 0x00005a08, 0x40a50000, 0x00005a0c, \
+   /* 11564 */ 0x40a50000, 0x00005a10, 0x40a50000, 0x00005a14, \
+   /* 11568 */ 0x40a50000, 0x00005a18, 0x40a50000, 0x00005a1c, \
+   /* 11572 */ 0x40a50000, 0x00005a20, 0x40a50000, 0x00005a24, \
+   /* 11576 */ 0x40a50000, 0x00005a28, 0x40a50000, 0x00005a2c, \
+   /* 11580 */ 0x40a50000, 0x00005a30, 0x40a50000, 0x00005a34, \
+   /* 11584 */ 0x40a50000, 0x00005a38, 0x40a50000, 0x00005a3c, \
+   /* 11588 */ 0x40a50000, 0x00005a40, 0x40a50000, 0x00005a44, \
+   /* 11592 */ 0x40a50000, 0x00005a48, 0x40a50000, 0x00005a4c, \
+   /* 11596 */ 0x40a50000, 0x00005a50, 0x40a50000, 0x00005a54, \
+   /* 11600 */ 0x40a50000, 0x00005a58, 0x40a50000, 0x00005a5c, \
+   /* 11604 */ 0x40a50000, 0x00005a60, 0x40a50000, 0x00005a64, \
+   /* 11608 */ 0x40a50000, 0x00005a68, 0x40a50000, 0x00005a6c, \
+   /* 11612 */ 0x40a50000, 0x00005a70, 0x40a50000, 0x00005a74, \
+   /* 11616 */ 0x40a50000, 0x00005a78, 0x40a50000, 0x00005a7c, \
+   /* 11620 */ 0x40a50000, 0x00005a80, 0x40a50000, 0x00005a84, \
+   /* 11624 */ 0x40a50000, 0x00005a88, 0x40a50000, 0x00005a8c, \
+   /* 11628 */ 0x40a50000, 0x00005a90, 0x40a50000, 0x00005a94, \
+   /* 11632 */ 0x40a50000, 0x00005a98, 0x40a50000, 0x00005a9c, \
+   /* 11636 */ 0x40a50000, 0x00005aa0, 0x40a50000, 0x00005aa4, \
+   /* 11640 */ 0x40a50000, 0x00005aa8, 0x40a50000, 0x00005aac, \
+   /* 11644 */ 0x40a50000, 0x00005ab0, 0x40a50000, 0x00005ab4, \
+   /* 11648 */ 0x40a50000, 0x00005ab8, 0x40a50000, 0x00005abc, \
+   /* 11652 */ 0x40a50000, 0x00005ac0, 0x40a50000, 0x00005ac4, \
+   /* 11656 */ 0x40a50000, 0x00005ac8, 0x40a50000, 0x00005acc, \
+   /* 11660 */ 0x40a50000, 0x00005ad0, 0x40a50000, 0x00005ad4, \
+   /* 11664 */ 0x40a50000, 0x00005ad8, 0x40a50000, 0x00005adc, \
+   /* 11668 */ 0x40a50000, 0x00005ae0, 0x40a50000, 0x00005ae4, \
+   /* 11672 */ 0x40a50000, 0x00005ae8, 0x40a50000, 0x00005aec, \
+   /* 11676 */ 0x40a50000, 0x00005af0, 0x40a50000, 0x00005af4, \
+   /* 11680 */ 0x40a50000, 0x00005af8, 0x40a50000, 0x00005afc, \
+   /* 11684 */ 0x40a50000, 0x00005b00, 0x40a50000, 0x00005b04, \
+   /* 11688 */ 0x40a50000, 0x00005b08, 0x40a50000, 0x00005b0c, \
+   /* 11692 */ 0x40a50000, 0x00005b10, 0x40a50000, 0x00005b14, \
+   /* 11696 */ 0x40a50000, 0x00005b18, 0x40a50000, 0x00005b1c, \
+   /* 11700 */ 0x40a50000, 0x00005b20, 0x40a50000, 0x00005b24, \
+   /* 11704 */ 0x40a50000, 0x00005b28, 0x40a50000, 0x00005b2c, \
+   /* 11708 */ 0x40a50000, 0x00005b30, 0x40a50000, 0x00005b34, \
+   /* 11712 */ 0x40a50000, 0x00005b38, 0x40a50000, 0x00005b3c, \
+   /* 11716 */ 0x40a50000, 0x00005b40, 0x40a50000, 0x00005b44, \
+   /* 11720 */ 0x40a50000, 0x00005b48, 0x40a50000, 0x00005b4c, \
+   /* 11724 */ 0x40a50000, 0x00005b50, 0x40a50000, 0x00005b54, \
+   /* 11728 */ 0x40a50000, 0x00005b58, 0x40a50000, 0x00005b5c, \
+   /* 11732 */ 0x40a50000, 0x00005b60, 0x40a50000, 0x00005b64, \
+   /* 11736 */ 0x40a50000, 0x00005b68, 0x40a50000, 0x00005b6c, \
+   /* 11740 */ 0x40a50000, 0x00005b70, 0x40a50000, 0x00005b74, \
+   /* 11744 */ 0x40a50000, 0x00005b78, 0x40a50000, 0x00005b7c, \
+   /* 11748 */ 0x40a50000, 0x00005b80, 0x40a50000, 0x00005b84, \
+   /* 11752 */ 0x40a50000, 0x00005b88, 0x40a50000, 0x00005b8c, \
+   /* 11756 */ 0x40a50000, 0x00005b90, 0x40a50000, 0x00005b94, \
+   /* 11760 */ 0x40a50000, 0x00005b98, 0x40a50000, 0x00005b9c, \
+   /* 11764 */ 0x40a50000, 0x00005ba0, 0x40a50000, 0x00005ba4, \
+   /* 11768 */ 0x40a50000, 0x00005ba8, 0x40a50000, 0x00005bac, \
+   /* 11772 */ 0x40a50000, 0x00005bb0, 0x40a50000, 0x00005bb4, \
+   /* 11776 */ 0x40a50000, 0x00005bb8, 0x40a50000, 0x00005bbc, \
+   /* 11780 */ 0x40a50000, 0x00005bc0, 0x40a50000, 0x00005bc4, \
+   /* 11784 */ 0x40a50000, 0x00005bc8, 0x40a50000, 0x00005bcc, \
+   /* 11788 */ 0x40a50000, 0x00005bd0, 0x40a50000, 0x00005bd4, \
+   /* 11792 */ 0x40a50000, 0x00005bd8, 0x40a50000, 0x00005bdc, \
+   /* 11796 */ 0x40a50000, 0x00005be0, 0x40a50000, 0x00005be4, \
+   /* 11800 */ 0x40a50000, 0x00005be8, 0x40a50000, 0x00005bec, \
+   /* 11804 */ 0x40a50000, 0x00005bf0, 0x40a50000, 0x00005bf4, \
+   /* 11808 */ 0x40a50000, 0x00005bf8, 0x40a50000, 0x00005bfc, \
+   /* 11812 */ 0x40a50000, 0x00005c00, 0x40a50000, 0x00005c04, \
+   /* 11816 */ 0x40a50000, 0x00005c08, 0x40a50000, 0x00005c0c, \
+   /* 11820 */ 0x40a50000, 0x00005c10, 0x40a50000, 0x00005c14, \
+   /* 11824 */ 0x40a50000, 0x00005c18, 0x40a50000, 0x00005c1c, \
+   /* 11828 */ 0x40a50000, 0x00005c20, 0x40a50000, 0x00005c24, \
+   /* 11832 */ 0x40a50000, 0x00005c28, 0x40a50000, 0x00005c2c, \
+   /* 11836 */ 0x40a50000, 0x00005c30, 0x40a50000, 0x00005c34, \
+   /* 11840 */ 0x40a50000, 0x00005c38, 0x40a50000, 0x00005c3c, \
+   /* 11844 */ 0x40a50000, 0x00005c40, 0x40a50000, 0x00005c44, \
+   /* 11848 */ 0x40a50000, 0x00005c48, 0x40a50000, 0x00005c4c, \
+   /* 11852 */ 0x40a50000, 0x00005c50, 0x40a50000, 0x00005c54, \
+   /* 11856 */ 0x40a50000, 0x00005c58, 0x40a50000, 0x00005c5c, \
+   /* 11860 */ 0x40a50000, 0x00005c60, 0x40a50000, 0x00005c64, \
+   /* 11864 */ 0x40a50000, 0x00005c68, 0x40a50000, 0x00005c6c, \
+   /* 11868 */ 0x40a50000, 0x00005c70, 0x40a50000, 0x00005c74, \
+   /* 11872 */ 0x40a50000, 0x00005c78, 0x40a50000, 0x00005c7c, \
+   /* 11876 */ 0x40a50000, 0x00005c80, 0x40a50000, 0x00005c84, \
+   /* 11880 */ 0x40a50000, 0x00005c88, 0x40a50000, 0x00005c8c, \
+   /* 11884 */ 0x40a50000, 0x00005c90, 0x40a50000, 0x00005c94, \
+   /* 11888 */ 0x40a50000, 0x00005c98, 0x40a50000, 0x00005c9c, \
+   /* 11892 */ 0x40a50000, 0x00005ca0, 0x40a50000, 0x00005ca4, \
+   /* 11896 */ 0x40a50000, 0x00005ca8, 0x40a50000, 0x00005cac, \
+   /* 11900 */ 0x40a50000, 0x00005cb0, 0x40a50000, 0x00005cb4, \
+   /* 11904 */ 0x40a50000, 0x00005cb8, 0x40a50000, 0x00005cbc, \
+   /* 11908 */ 0x40a50000, 0x00005cc0, 0x40a50000, 0x00005cc4, \
+   /* 11912 */ 0x40a50000, 0x00005cc8, 0x40a50000, 0x00005ccc, \
+   /* 11916 */ 0x40a50000, 0x00005cd0, 0x40a50000, 0x00005cd4, \
+   /* 11920 */ 0x40a50000, 0x00005cd8, 0x40a50000, 0x00005cdc, \
+   /* 11924 */ 0x40a50000, 0x00005ce0, 0x40a50000, 0x00005ce4, \
+   /* 11928 */ 0x40a50000, 0x00005ce8, 0x40a50000, 0x00005cec, \
+   /* 11932 */ 0x40a50000, 0x00005cf0, 0x40a50000, 0x00005cf4, \
+   /* 11936 */ 0x40a50000, 0x00005cf8, 0x40a50000, 0x00005cfc, \
+   /* 11940 */ 0x40a50000, 0x00005d00, 0x40a50000, 0x00005d04, \
+   /* 11944 */ 0x40a50000, 0x00005d08, 0x40a50000, 0x00005d0c, \
+   /* 11948 */ 0x40a50000, 0x00005d10, 0x40a50000, 0x00005d14, \
+   /* 11952 */ 0x40a50000, 0x00005d18, 0x40a50000, 0x00005d1c, \
+   /* 11956 */ 0x40a50000, 0x00005d20, 0x40a50000, 0x00005d24, \
+   /* 11960 */ 0x40a50000, 0x00005d28, 0x40a50000, 0x00005d2c, \
+   /* 11964 */ 0x40a50000, 0x00005d30, 0x40a50000, 0x00005d34, \
+   /* 11968 */ 0x40a50000, 0x00005d38, 0x40a50000, 0x00005d3c, \
+   /* 11972 */ 0x40a50000, 0x00005d40, 0x40a50000, 0x00005d44, \
+   /* 11976 */ 0x40a50000, 0x00005d48, 0x40a50000, 0x00005d4c, \
+   /* 11980 */ 0x40a50000, 0x00005d50, 0x40a50000, 0x00005d54, \
+   /* 11984 */ 0x40a50000, 0x00005d58, 0x40a50000, 0x00005d5c, \
+   /* 11988 */ 0x40a50000, 0x00005d60, 0x40a50000, 0x00005d64, \
+   /* 11992 */ 0x40a50000, 0x00005d68, 0x40a50000, 0x00005d6c, \
+   /* 11996 */ 0x40a50000, 0x00005d70, 0x40a50000, 0x00005d74, \
+   /* 12000 */ 0x40a50000, 0x00005d78, 0x40a50000, 0x00005d7c, \
+   /* 12004 */ 0x40a50000, 0x00005d80, 0x40a50000, 0x00005d84, \
+   /* 12008 */ 0x40a50000, 0x00005d88, 0x40a50000, 0x00005d8c, \
+   /* 12012 */ 0x40a50000, 0x00005d90, 0x40a50000, 0x00005d94, \
+   /* 12016 */ 0x40a50000, 0x00005d98, 0x40a50000, 0x00005d9c, \
+   /* 12020 */ 0x40a50000, 0x00005da0, 0x40a50000, 0x00005da4, \
+   /* 12024 */ 0x40a50000, 0x00005da8, 0x40a50000, 0x00005dac, \
+   /* 12028 */ 0x40a50000, 0x00005db0, 0x40a50000, 0x00005db4, \
+   /* 12032 */ 0x40a50000, 0x00005db8, 0x40a50000, 0x00005dbc, \
+   /* 12036 */ 0x40a50000, 0x00005dc0, 0x40a50000, 0x00005dc4, \
+   /* 12040 */ 0x40a50000, 0x00005dc8, 0x40a50000, 0x00005dcc, \
+   /* 12044 */ 0x40a50000, 0x00005dd0, 0x40a50000, 0x00005dd4, \
+   /* 12048 */ 0x40a50000, 0x00005dd8, 0x40a50000, 0x00005ddc, \
+   /* 12052 */ 0x40a50000, 0x00005de0, 0x40a50000, 0x00005de4, \
+   /* 12056 */ 0x40a50000, 0x00005de8, 0x40a50000, 0x00005dec, \
+   /* 12060 */ 0x40a50000, 0x00005df0, 0x40a50000, 0x00005df4, \
+   /* 12064 */ 0x40a50000, 0x00005df8, 0x40a50000, 0x00005dfc, \
+   /* 12068 */ 0x40a50000, 0x00005e00, 0x40a50000, 0x00005e04, \
+   /* 12072 */ 0x40a50000, 0x00005e08, 0x40a50000, 0x00005e0c, \
+   /* 12076 */ 0x40a50000, 0x00005e10, 0x40a50000, 0x00005e14, \
+   /* 12080 */ 0x40a50000, 0x00005e18, 0x40a50000, 0x00005e1c, \
+   /* 12084 */ 0x40a50000, 0x00005e20, 0x40a50000, 0x00005e24, \
+   /* 12088 */ 0x40a50000, 0x00005e28, 0x40a50000, 0x00005e2c, \
+   /* 12092 */ 0x40a50000, 0x00005e30, 0x40a50000, 0x00005e34, \
+   /* 12096 */ 0x40a50000, 0x00005e38, 0x40a50000, 0x00005e3c, \
+   /* 12100 */ 0x40a50000, 0x00005e40, 0x40a50000, 0x00005e44, \
+   /* 12104 */ 0x40a50000, 0x00005e48, 0x40a50000, 0x00005e4c, \
+   /* 12108 */ 0x40a50000, 0x00005e50, 0x40a50000, 0x00005e54, \
+   /* 12112 */ 0x40a50000, 0x00005e58, 0x40a50000, 0x00005e5c, \
+   /* 12116 */ 0x40a50000, 0x00005e60, 0x40a50000, 0x00005e64, \
+   /* 12120 */ 0x40a50000, 0x00005e68, 0x40a50000, 0x00005e6c, \
+   /* 12124 */ 0x40a50000, 0x00005e70, 0x40a50000, 0x00005e74, \
+   /* 12128 */ 0x40a50000, 0x00005e78, 0x40a50000, 0x00005e7c, \
+   /* 12132 */ 0x40a50000, 0x00005e80, 0x40a50000, 0x00005e84, \
+   /* 12136 */ 0x40a50000, 0x00005e88, 0x40a50000, 0x00005e8c, \
+   /* 12140 */ 0x40a50000, 0x00005e90, 0x40a50000, 0x00005e94, \
+   /* 12144 */ 0x40a50000, 0x00005e98, 0x40a50000, 0x00005e9c, \
+   /* 12148 */ 0x40a50000, 0x00005ea0, 0x40a50000, 0x00005ea4, \
+   /* 12152 */ 0x40a50000, 0x00005ea8, 0x40a50000, 0x00005eac, \
+   /* 12156 */ 0x40a50000, 0x00005eb0, 0x40a50000, 0x00005eb4, \
+   /* 12160 */ 0x40a50000, 0x00005eb8, 0x40a50000, 0x00005ebc, \
+   /* 12164 */ 0x40a50000, 0x00005ec0, 0x40a50000, 0x00005ec4, \
+   /* 12168 */ 0x40a50000, 0x00005ec8, 0x40a50000, 0x00005ecc, \
+   /* 12172 */ 0x40a50000, 0x00005ed0, 0x40a50000, 0x00005ed4, \
+   /* 12176 */ 0x40a50000, 0x00005ed8, 0x40a50000, 0x00005edc, \
+   /* 12180 */ 0x40a50000, 0x00005ee0, 0x40a50000, 0x00005ee4, \
+   /* 12184 */ 0x40a50000, 0x00005ee8, 0x40a50000, 0x00005eec, \
+   /* 12188 */ 0x40a50000, 0x00005ef0, 0x40a50000, 0x00005ef4, \
+   /* 12192 */ 0x40a50000, 0x00005ef8, 0x40a50000, 0x00005efc, \
+   /* 12196 */ 0x40a50000, 0x00005f00, 0x40a50000, 0x00005f04, \
+   /* 12200 */ 0x40a50000, 0x00005f08, 0x40a50000, 0x00005f0c, \
+   /* 12204 */ 0x40a50000, 0x00005f10, 0x40a50000, 0x00005f14, \
+   /* 12208 */ 0x40a50000, 0x00005f18, 0x40a50000, 0x00005f1c, \
+   /* 12212 */ 0x40a50000, 0x00005f20, 0x40a50000, 0x00005f24, \
+   /* 12216 */ 0x40a50000, 0x00005f28, 0x40a50000, 0x00005f2c, \
+   /* 12220 */ 0x40a50000, 0x00005f30, 0x40a50000, 0x00005f34, \
+   /* 12224 */ 0x40a50000, 0x00005f38, 0x40a50000, 0x00005f3c, \
+   /* 12228 */ 0x40a50000, 0x00005f40, 0x40a50000, 0x00005f44, \
+   /* 12232 */ 0x40a50000, 0x00005f48, 0x40a50000, 0x00005f4c, \
+   /* 12236 */ 0x40a50000, 0x00005f50, 0x40a50000, 0x00005f54, \
+   /* 12240 */ 0x40a50000, 0x00005f58, 0x40a50000, 0x00005f5c, \
+   /* 12244 */ 0x40a50000, 0x00005f60, 0x40a50000, 0x00005f64, \
+   /* 12248 */ 0x40a50000, 0x00005f68, 0x40a50000, 0x00005f6c, \
+   /* 12252 */ 0x40a50000, 0x00005f70, 0x40a50000, 0x00005f74, \
+   /* 12256 */ 0x40a50000, 0x00005f78, 0x40a50000, 0x00005f7c, \
+   /* 12260 */ 0x40a50000, 0x00005f80, 0x40a50000, 0x00005f84, \
+   /* 12264 */ 0x40a50000, 0x00005f88, 0x40a50000, 0x00005f8c, \
+   /* 12268 */ 0x40a50000, 0x00005f90, 0x40a50000, 0x00005f94, \
+   /* 12272 */ 0x40a50000, 0x00005f98, 0x40a50000, 0x00005f9c, \
+   /* 12276 */ 0x40a50000, 0x00005fa0, 0x40a50000, 0x00005fa4, \
+   /* 12280 */ 0x40a50000, 0x00005fa8, 0x40a50000, 0x00005fac, \
+   /* 12284 */ 0x40a50000, 0x00005fb0, 0x40a50000, 0x00005fb4, \
+   /* 12288 */ 0x40a50000, 0x00005fb8, 0x40a50000, 0x00005fbc, \
+   /* 12292 */ 0x40a50000, 0x00005fc0, 0x40a50000, 0x00005fc4, \
+   /* 12296 */ 0x40a50000, 0x00005fc8, 0x40a50000, 0x00005fcc, \
+   /* 12300 */ 0x40a50000, 0x00005fd0, 0x40a50000, 0x00005fd4, \
+   /* 12304 */ 0x40a50000, 0x00005fd8, 0x40a50000, 0x00005fdc, \
+   /* 12308 */ 0x40a50000, 0x00005fe0, 0x40a50000, 0x00005fe4, \
+   /* 12312 */ 0x40a50000, 0x00005fe8, 0x40a50000, 0x00005fec, \
+   /* 12316 */ 0x40a50000, 0x00005ff0, 0x40a50000, 0x00005ff4, \
+   /* 12320 */ 0x40a50000, 0x00005ff8, 0x40a50000, 0x00005ffc, \
+   /* 12324 */ 0x40a50000, 0x00006000, 0x40a50000, 0x00006004, \
+   /* 12328 */ 0x40a50000, 0x00006008, 0x40a50000, 0x0000600c, \
+   /* 12332 */ 0x40a50000, 0x00006010, 0x40a50000, 0x00006014, \
+   /* 12336 */ 0x40a50000, 0x00006018, 0x40a50000, 0x0000601c, \
+   /* 12340 */ 0x40a50000, 0x00006020, 0x40a50000, 0x00006024, \
+   /* 12344 */ 0x40a50000, 0x00006028, 0x40a50000, 0x0000602c, \
+   /* 12348 */ 0x40a50000, 0x00006030, 0x40a50000, 0x00006034, \
+   /* 12352 */ 0x40a50000, 0x00006038, 0x40a50000, 0x0000603c, \
+   /* 12356 */ 0x40a50000, 0x00006040, 0x40a50000, 0x00006044, \
+   /* 12360 */ 0x40a50000, 0x00006048, 0x40a50000, 0x0000604c, \
+   /* 12364 */ 0x40a50000, 0x00006050, 0x40a50000, 0x00006054, \
+   /* 12368 */ 0x40a50000, 0x00006058, 0x40a50000, 0x0000605c, \
+   /* 12372 */ 0x40a50000, 0x00006060, 0x40a50000, 0x00006064, \
+   /* 12376 */ 0x40a50000, 0x00006068, 0x40a50000, 0x0000606c, \
+   /* 12380 */ 0x40a50000, 0x00006070, 0x40a50000, 0x00006074, \
+   /* 12384 */ 0x40a50000, 0x00006078, 0x40a50000, 0x0000607c, \
+   /* 12388 */ 0x40a50000, 0x00006080, 0x40a50000, 0x00006084, \
+   /* 12392 */ 0x40a50000, 0x00006088, 0x40a50000, 0x0000608c, \
+   /* 12396 */ 0x40a50000, 0x00006090, 0x40a50000, 0x00006094, \
+   /* 12400 */ 0x40a50000, 0x00006098, 0x40a50000, 0x0000609c, \
+   /* 12404 */ 0x40a50000, 0x000060a0, 0x40a50000, 0x000060a4, \
+   /* 12408 */ 0x40a50000, 0x000060a8, 0x40a50000, 0x000060ac, \
+   /* 12412 */ 0x40a50000, 0x000060b0, 0x40a50000, 0x000060b4, \
+   /* 12416 */ 0x40a50000, 0x000060b8, 0x40a50000, 0x000060bc, \
+   /* 12420 */ 0x40a50000, 0x000060c0, 0x40a50000, 0x000060c4, \
+   /* 12424 */ 0x40a50000, 0x000060c8, 0x40a50000, 0x000060cc, \
+   /* 12428 */ 0x40a50000, 0x000060d0, 0x40a50000, 0x000060d4, \
+   /* 12432 */ 0x40a50000, 0x000060d8, 0x40a50000, 0x000060dc, \
+   /* 12436 */ 0x40a50000, 0x000060e0, 0x40a50000, 0x000060e4, \
+   /* 12440 */ 0x40a50000, 0x000060e8, 0x40a50000, 0x000060ec, \
+   /* 12444 */ 0x40a50000, 0x000060f0, 0x40a50000, 0x000060f4, \
+   /* 12448 */ 0x40a50000, 0x000060f8, 0x40a50000, 0x000060fc, \
+   /* 12452 */ 0x40a50000, 0x00006100, 0x40a50000, 0x00006104, \
+   /* 12456 */ 0x40a50000, 0x00006108, 0x40a50000, 0x0000610c, \
+   /* 12460 */ 0x40a50000, 0x00006110, 0x40a50000, 0x00006114, \
+   /* 12464 */ 0x40a50000, 0x00006118, 0x40a50000, 0x0000611c, \
+   /* 12468 */ 0x40a50000, 0x00006120, 0x40a50000, 0x00006124, \
+   /* 12472 */ 0x40a50000, 0x00006128, 0x40a50000, 0x0000612c, \
+   /* 12476 */ 0x40a50000, 0x00006130, 0x40a50000, 0x00006134, \
+   /* 12480 */ 0x40a50000, 0x00006138, 0x40a50000, 0x0000613c, \
+   /* 12484 */ 0x40a50000, 0x00006140, 0x40a50000, 0x00006144, \
+   /* 12488 */ 0x40a50000, 0x00006148, 0x40a50000, 0x0000614c, \
+   /* 12492 */ 0x40a50000, 0x00006150, 0x40a50000, 0x00006154, \
+   /* 12496 */ 0x40a50000, 0x00006158, 0x40a50000, 0x0000615c, \
+   /* 12500 */ 0x40a50000, 0x00006160, 0x40a50000, 0x00006164, \
+   /* 12504 */ 0x40a50000, 0x00006168, 0x40a50000, 0x0000616c, \
+   /* 12508 */ 0x40a50000, 0x00006170, 0x40a50000, 0x00006174, \
+   /* 12512 */ 0x40a50000, 0x00006178, 0x40a50000, 0x0000617c, \
+   /* 12516 */ 0x40a50000, 0x00006180, 0x40a50000, 0x00006184, \
+   /* 12520 */ 0x40a50000, 0x00006188, 0x40a50000, 0x0000618c, \
+   /* 12524 */ 0x40a50000, 0x00006190, 0x40a50000, 0x00006194, \
+   /* 12528 */ 0x40a50000, 0x00006198, 0x40a50000, 0x0000619c, \
+   /* 12532 */ 0x40a50000, 0x000061a0, 0x40a50000, 0x000061a4, \
+   /* 12536 */ 0x40a50000, 0x000061a8, 0x40a50000, 0x000061ac, \
+   /* 12540 */ 0x40a50000, 0x000061b0, 0x40a50000, 0x000061b4, \
+   /* 12544 */ 0x40a50000, 0x000061b8, 0x40a50000, 0x000061bc, \
+   /* 12548 */ 0x40a50000, 0x000061c0, 0x40a50000, 0x000061c4, \
+   /* 12552 */ 0x40a50000, 0x000061c8, 0x40a50000, 0x000061cc, \
+   /* 12556 */ 0x40a50000, 0x000061d0, 0x40a50000, 0x000061d4, \
+   /* 12560 */ 0x40a50000, 0x000061d8, 0x40a50000, 0x000061dc, \
+   /* 12564 */ 0x40a50000, 0x000061e0, 0x40a50000, 0x000061e4, \
+   /* 12568 */ 0x40a50000, 0x000061e8, 0x40a50000, 0x000061ec, \
+   /* 12572 */ 0x40a50000, 0x000061f0, 0x40a50000, 0x000061f4, \
+   /* 12576 */ 0x40a50000, 0x000061f8, 0x40a50000, 0x000061fc, \
+   /* 12580 */ 0x40a50000, 0x00006200, 0x40a50000, 0x00006204, \
+   /* 12584 */ 0x40a50000, 0x00006208, 0x40a50000, 0x0000620c, \
+   /* 12588 */ 0x40a50000, 0x00006210, 0x40a50000, 0x00006214, \
+   /* 12592 */ 0x40a50000, 0x00006218, 0x40a50000, 0x0000621c, \
+   /* 12596 */ 0x40a50000, 0x00006220, 0x40a50000, 0x00006224, \
+   /* 12600 */ 0x40a50000, 0x00006228, 0x40a50000, 0x0000622c, \
+   /* 12604 */ 0x40a50000, 0x00006230, 0x40a50000, 0x00006234, \
+   /* 12608 */ 0x40a50000, 0x00006238, 0x40a50000, 0x0000623c, \
+   /* 12612 */ 0x40a50000, 0x00006240, 0x40a50000, 0x00006244, \
+   /* 12616 */ 0x40a50000, 0x00006248, 0x40a50000, 0x0000624c, \
+   /* 12620 */ 0x40a50000, 0x00006250, 0x40a50000, 0x00006254, \
+   /* 12624 */ 0x40a50000, 0x00006258, 0x40a50000, 0x0000625c, \
+   /* 12628 */ 0x40a50000, 0x00006260, 0x40a50000, 0x00006264, \
+   /* 12632 */ 0x40a50000, 0x00006268, 0x40a50000, 0x0000626c, \
+   /* 12636 */ 0x40a50000, 0x00006270, 0x40a50000, 0x00006274, \
+   /* 12640 */ 0x40a50000, 0x00006278, 0x40a50000, 0x0000627c, \
+   /* 12644 */ 0x40a50000, 0x00006280, 0x40a50000, 0x00006284, \
+   /* 12648 */ 0x40a50000, 0x00006288, 0x40a50000, 0x0000628c, \
+   /* 12652 */ 0x40a50000, 0x00006290, 0x40a50000, 0x00006294, \
+   /* 12656 */ 0x40a50000, 0x00006298, 0x40a50000, 0x0000629c, \
+   /* 12660 */ 0x40a50000, 0x000062a0, 0x40a50000, 0x000062a4, \
+   /* 12664 */ 0x40a50000, 0x000062a8, 0x40a50000, 0x000062ac, \
+   /* 12668 */ 0x40a50000, 0x000062b0, 0x40a50000, 0x000062b4, \
+   /* 12672 */ 0x40a50000, 0x000062b8, 0x40a50000, 0x000062bc, \
+   /* 12676 */ 0x40a50000, 0x000062c0, 0x40a50000, 0x000062c4, \
+   /* 12680 */ 0x40a50000, 0x000062c8, 0x40a50000, 0x000062cc, \
+   /* 12684 */ 0x40a50000, 0x000062d0, 0x40a50000, 0x000062d4, \
+   /* 12688 */ 0x40a50000, 0x000062d8, 0x40a50000, 0x000062dc, \
+   /* 12692 */ 0x40a50000, 0x000062e0, 0x40a50000, 0x000062e4, \
+   /* 12696 */ 0x40a50000, 0x000062e8, 0x40a50000, 0x000062ec, \
+   /* 12700 */ 0x40a50000, 0x000062f0, 0x40a50000, 0x000062f4, \
+   /* 12704 */ 0x40a50000, 0x000062f8, 0x40a50000, 0x000062fc, \
+   /* 12708 */ 0x40a50000, 0x00006300, 0x40a50000, 0x00006304, \
+   /* 12712 */ 0x40a50000, 0x00006308, 0x40a50000, 0x0000630c, \
+   /* 12716 */ 0x40a50000, 0x00006310, 0x40a50000, 0x00006314, \
+   /* 12720 */ 0x40a50000, 0x00006318, 0x40a50000, 0x0000631c, \
+   /* 12724 */ 0x40a50000, 0x00006320, 0x40a50000, 0x00006324, \
+   /* 12728 */ 0x40a50000, 0x00006328, 0x40a50000, 0x0000632c, \
+   /* 12732 */ 0x40a50000, 0x00006330, 0x40a50000, 0x00006334, \
+   /* 12736 */ 0x40a50000, 0x00006338, 0x40a50000, 0x0000633c, \
+   /* 12740 */ 0x40a50000, 0x00006340, 0x40a50000, 0x00006344, \
+   /* 12744 */ 0x40a50000, 0x00006348, 0x40a50000, 0x0000634c, \
+   /* 12748 */ 0x40a50000, 0x00006350, 0x40a50000, 0x00006354, \
+   /* 12752 */ 0x40a50000, 0x00006358, 0x40a50000, 0x0000635c, \
+   /* 12756 */ 0x40a50000, 0x00006360, 0x40a50000, 0x00006364, \
+   /* 12760 */ 0x40a50000, 0x00006368, 0x40a50000, 0x0000636c, \
+   /* 12764 */ 0x40a50000, 0x00006370, 0x40a50000, 0x00006374, \
+   /* 12768 */ 0x40a50000, 0x00006378, 0x40a50000, 0x0000637c, \
+   /* 12772 */ 0x40a50000, 0x00006380, 0x40a50000, 0x00006384, \
+   /* 12776 */ 0x40a50000, 0x00006388, 0x40a50000, 0x0000638c, \
+   /* 12780 */ 0x40a50000, 0x00006390, 0x40a50000, 0x00006394, \
+   /* 12784 */ 0x40a50000, 0x00006398, 0x40a50000, 0x0000639c, \
+   /* 12788 */ 0x40a50000, 0x000063a0, 0x40a50000, 0x000063a4, \
+   /* 12792 */ 0x40a50000, 0x000063a8, 0x40a50000, 0x000063ac, \
+   /* 12796 */ 0x40a50000, 0x000063b0, 0x40a50000, 0x000063b4, \
+   /* 12800 */ 0x40a50000, 0x000063b8, 0x40a50000, 0x000063bc, \
+   /* 12804 */ 0x40a50000, 0x000063c0, 0x40a50000, 0x000063c4, \
+   /* 12808 */ 0x40a50000, 0x000063c8, 0x40a50000, 0x000063cc, \
+   /* 12812 */ 0x40a50000, 0x000063d0, 0x40a50000, 0x000063d4, \
+   /* 12816 */ 0x40a50000, 0x000063d8, 0x40a50000, 0x000063dc, \
+   /* 12820 */ 0x40a50000, 0x000063e0, 0x40a50000, 0x000063e4, \
+   /* 12824 */ 0x40a50000, 0x000063e8, 0x40a50000, 0x000063ec, \
+   /* 12828 */ 0x40a50000, 0x000063f0, 0x40a50000, 0x000063f4, \
+   /* 12832 */ 0x40a50000, 0x000063f8, 0x40a50000, 0x000063fc, \
+   /* 12836 */ 0x40a50000, 0x00006400, 0x40a50000, 0x00006404, \
+   /* 12840 */ 0x40a50000, 0x00006408, 0x40a50000, 0x0000640c, \
+   /* 12844 */ 0x40a50000, 0x00006410, 0x40a50000, 0x00006414, \
+   /* 12848 */ 0x40a50000, 0x00006418, 0x40a50000, 0x0000641c, \
+   /* 12852 */ 0x40a50000, 0x00006420, 0x40a50000, 0x00006424, \
+   /* 12856 */ 0x40a50000, 0x00006428, 0x40a50000, 0x0000642c, \
+   /* 12860 */ 0x40a50000, 0x00006430, 0x40a50000, 0x00006434, \
+   /* 12864 */ 0x40a50000, 0x00006438, 0x40a50000, 0x0000643c, \
+   /* 12868 */ 0x40a50000, 0x00006440, 0x40a50000, 0x00006444, \
+   /* 12872 */ 0x40a50000, 0x00006448, 0x40a50000, 0x0000644c, \
+   /* 12876 */ 0x40a50000, 0x00006450, 0x40a50000, 0x00006454, \
+   /* 12880 */ 0x40a50000, 0x00006458, 0x40a50000, 0x0000645c, \
+   /* 12884 */ 0x40a50000, 0x00006460, 0x40a50000, 0x00006464, \
+   /* 12888 */ 0x40a50000, 0x00006468, 0x40a50000, 0x0000646c, \
+   /* 12892 */ 0x40a50000, 0x00006470, 0x40a50000, 0x00006474, \
+   /* 12896 */ 0x40a50000, 0x00006478, 0x40a50000, 0x0000647c, \
+   /* 12900 */ 0x40a50000, 0x00006480, 0x40a50000, 0x00006484, \
+   /* 12904 */ 0x40a50000, 0x00006488, 0x40a50000, 0x0000648c, \
+   /* 12908 */ 0x40a50000, 0x00006490, 0x40a50000, 0x00006494, \
+   /* 12912 */ 0x40a50000, 0x00006498, 0x40a50000, 0x0000649c, \
+   /* 12916 */ 0x40a50000, 0x000064a0, 0x40a50000, 0x000064a4, \
+   /* 12920 */ 0x40a50000, 0x000064a8, 0x40a50000, 0x000064ac, \
+   /* 12924 */ 0x40a50000, 0x000064b0, 0x40a50000, 0x000064b4, \
+   /* 12928 */ 0x40a50000, 0x000064b8, 0x40a50000, 0x000064bc, \
+   /* 12932 */ 0x40a50000, 0x000064c0, 0x40a50000, 0x000064c4, \
+   /* 12936 */ 0x40a50000, 0x000064c8, 0x40a50000, 0x000064cc, \
+   /* 12940 */ 0x40a50000, 0x000064d0, 0x40a50000, 0x000064d4, \
+   /* 12944 */ 0x40a50000, 0x000064d8, 0x40a50000, 0x000064dc, \
+   /* 12948 */ 0x40a50000, 0x000064e0, 0x40a50000, 0x000064e4, \
+   /* 12952 */ 0x40a50000, 0x000064e8, 0x40a50000, 0x000064ec, \
+   /* 12956 */ 0x40a50000, 0x000064f0, 0x40a50000, 0x000064f4, \
+   /* 12960 */ 0x40a50000, 0x000064f8, 0x40a50000, 0x000064fc, \
+   /* 12964 */ 0x40a50000, 0x00006500, 0x40a50000, 0x00006504, \
+   /* 12968 */ 0x40a50000, 0x00006508, 0x40a50000, 0x0000650c, \
+   /* 12972 */ 0x40a50000, 0x00006510, 0x40a50000, 0x00006514, \
+   /* 12976 */ 0x40a50000, 0x00006518, 0x40a50000, 0x0000651c, \
+   /* 12980 */ 0x40a50000, 0x00006520, 0x40a50000, 0x00006524, \
+   /* 12984 */ 0x40a50000, 0x00006528, 0x40a50000, 0x0000652c, \
+   /* 12988 */ 0x40a50000, 0x00006530, 0x40a50000, 0x00006534, \
+   /* 12992 */ 0x40a50000, 0x00006538, 0x40a50000, 0x0000653c, \
+   /* 12996 */ 0x40a50000, 0x00006540, 0x40a50000, 0x00006544, \
+   /* 13000 */ 0x40a50000, 0x00006548, 0x40a50000, 0x0000654c, \
+   /* 13004 */ 0x40a50000, 0x00006550, 0x40a50000, 0x00006554, \
+   /* 13008 */ 0x40a50000, 0x00006558, 0x40a50000, 0x0000655c, \
+   /* 13012 */ 0x40a50000, 0x00006560, 0x40a50000, 0x00006564, \
+   /* 13016 */ 0x40a50000, 0x00006568, 0x40a50000, 0x0000656c, \
+   /* 13020 */ 0x40a50000, 0x00006570, 0x40a50000, 0x00006574, \
+   /* 13024 */ 0x40a50000, 0x00006578, 0x40a50000, 0x0000657c, \
+   /* 13028 */ 0x40a50000, 0x00006580, 0x40a50000, 0x00006584, \
+   /* 13032 */ 0x40a50000, 0x00006588, 0x40a50000, 0x0000658c, \
+   /* 13036 */ 0x40a50000, 0x00006590, 0x40a50000, 0x00006594, \
+   /* 13040 */ 0x40a50000, 0x00006598, 0x40a50000, 0x0000659c, \
+   /* 13044 */ 0x40a50000, 0x000065a0, 0x40a50000, 0x000065a4, \
+   /* 13048 */ 0x40a50000, 0x000065a8, 0x40a50000, 0x000065ac, \
+   /* 13052 */ 0x40a50000, 0x000065b0, 0x40a50000, 0x000065b4, \
+   /* 13056 */ 0x40a50000, 0x000065b8, 0x40a50000, 0x000065bc, \
+   /* 13060 */ 0x40a50000, 0x000065c0, 0x40a50000, 0x000065c4, \
+   /* 13064 */ 0x40a50000, 0x000065c8, 0x40a50000, 0x000065cc, \
+   /* 13068 */ 0x40a50000, 0x000065d0, 0x40a50000, 0x000065d4, \
+   /* 13072 */ 0x40a50000, 0x000065d8, 0x40a50000, 0x000065dc, \
+   /* 13076 */ 0x40a50000, 0x000065e0, 0x40a50000, 0x000065e4, \
+   /* 13080 */ 0x40a50000, 0x000065e8, 0x40a50000, 0x000065ec, \
+   /* 13084 */ 0x40a50000, 0x000065f0, 0x40a50000, 0x000065f4, \
+   /* 13088 */ 0x40a50000, 0x000065f8, 0x40a50000, 0x000065fc, \
+   /* 13092 */ 0x40a50000, 0x00006600, 0x40a50000, 0x00006604, \
+   /* 13096 */ 0x40a50000, 0x00006608, 0x40a50000, 0x0000660c, \
+   /* 13100 */ 0x40a50000, 0x00006610, 0x40a50000, 0x00006614, \
+   /* 13104 */ 0x40a50000, 0x00006618, 0x40a50000, 0x0000661c, \
+   /* 13108 */ 0x40a50000, 0x00006620, 0x40a50000, 0x00006624, \
+   /* 13112 */ 0x40a50000, 0x00006628, 0x40a50000, 0x0000662c, \
+   /* 13116 */ 0x40a50000, 0x00006630, 0x40a50000, 0x00006634, \
+   /* 13120 */ 0x40a50000, 0x00006638, 0x40a50000, 0x0000663c, \
+   /* 13124 */ 0x40a50000, 0x00006640, 0x40a50000, 0x00006644, \
+   /* 13128 */ 0x40a50000, 0x00006648, 0x40a50000, 0x0000664c, \
+   /* 13132 */ 0x40a50000, 0x00006650, 0x40a50000, 0x00006654, \
+   /* 13136 */ 0x40a50000, 0x00006658, 0x40a50000, 0x0000665c, \
+   /* 13140 */ 0x40a50000, 0x00006660, 0x40a50000, 0x00006664, \
+   /* 13144 */ 0x40a50000, 0x00006668, 0x40a50000, 0x0000666c, \
+   /* 13148 */ 0x40a50000, 0x00006670, 0x40a50000, 0x00006674, \
+   /* 13152 */ 0x40a50000, 0x00006678, 0x40a50000, 0x0000667c, \
+   /* 13156 */ 0x40a50000, 0x00006680, 0x40a50000, 0x00006684, \
+   /* 13160 */ 0x40a50000, 0x00006688, 0x40a50000, 0x0000668c, \
+   /* 13164 */ 0x40a50000, 0x00006690, 0x40a50000, 0x00006694, \
+   /* 13168 */ 0x40a50000, 0x00006698, 0x40a50000, 0x0000669c, \
+   /* 13172 */ 0x40a50000, 0x000066a0, 0x40a50000, 0x000066a4, \
+   /* 13176 */ 0x40a50000, 0x000066a8, 0x40a50000, 0x000066ac, \
+   /* 13180 */ 0x40a50000, 0x000066b0, 0x40a50000, 0x000066b4, \
+   /* 13184 */ 0x40a50000, 0x000066b8, 0x40a50000, 0x000066bc, \
+   /* 13188 */ 0x40a50000, 0x000066c0, 0x40a50000, 0x000066c4, \
+   /* 13192 */ 0x40a50000, 0x000066c8, 0x40a50000, 0x000066cc, \
+   /* 13196 */ 0x40a50000, 0x000066d0, 0x40a50000, 0x000066d4, \
+   /* 13200 */ 0x40a50000, 0x000066d8, 0x40a50000, 0x000066dc, \
+   /* 13204 */ 0x40a50000, 0x000066e0, 0x40a50000, 0x000066e4, \
+   /* 13208 */ 0x40a50000, 0x000066e8, 0x40a50000, 0x000066ec, \
+   /* 13212 */ 0x40a50000, 0x000066f0, 0x40a50000, 0x000066f4, \
+   /* 13216 */ 0x40a50000, 0x000066f8, 0x40a50000, 0x000066fc, \
+   /* 13220 */ 0x40a50000, 0x00006700, 0x40a50000, 0x00006704, \
+   /* 13224 */ 0x40a50000, 0x00006708, 0x40a50000, 0x0000670c, \
+   /* 13228 */ 0x40a50000, 0x00006710, 0x40a50000, 0x00006714, \
+   /* 13232 */ 0x40a50000, 0x00006718, 0x40a50000, 0x0000671c, \
+   /* 13236 */ 0x40a50000, 0x00006720, 0x40a50000, 0x00006724, \
+   /* 13240 */ 0x40a50000, 0x00006728, 0x40a50000, 0x0000672c, \
+   /* 13244 */ 0x40a50000, 0x00006730, 0x40a50000, 0x00006734, \
+   /* 13248 */ 0x40a50000, 0x00006738, 0x40a50000, 0x0000673c, \
+   /* 13252 */ 0x40a50000, 0x00006740, 0x40a50000, 0x00006744, \
+   /* 13256 */ 0x40a50000, 0x00006748, 0x40a50000, 0x0000674c, \
+   /* 13260 */ 0x40a50000, 0x00006750, 0x40a50000, 0x00006754, \
+   /* 13264 */ 0x40a50000, 0x00006758, 0x40a50000, 0x0000675c, \
+   /* 13268 */ 0x40a50000, 0x00006760, 0x40a50000, 0x00006764, \
+   /* 13272 */ 0x40a50000, 0x00006768, 0x40a50000, 0x0000676c, \
+   /* 13276 */ 0x40a50000, 0x00006770, 0x40a50000, 0x00006774, \
+   /* 13280 */ 0x40a50000, 0x00006778, 0x40a50000, 0x0000677c, \
+   /* 13284 */ 0x40a50000, 0x00006780, 0x40a50000, 0x00006784, \
+   /* 13288 */ 0x40a50000, 0x00006788, 0x40a50000, 0x0000678c, \
+   /* 13292 */ 0x40a50000, 0x00006790, 0x40a50000, 0x00006794, \
+   /* 13296 */ 0x40a50000, 0x00006798, 0x40a50000, 0x0000679c, \
+   /* 13300 */ 0x40a50000, 0x000067a0, 0x40a50000, 0x000067a4, \
+   /* 13304 */ 0x40a50000, 0x000067a8, 0x40a50000, 0x000067ac, \
+   /* 13308 */ 0x40a50000, 0x000067b0, 0x40a50000, 0x000067b4, \
+   /* 13312 */ 0x40a50000, 0x000067b8, 0x40a50000, 0x000067bc, \
+   /* 13316 */ 0x40a50000, 0x000067c0, 0x40a50000, 0x000067c4, \
+   /* 13320 */ 0x40a50000, 0x000067c8, 0x40a50000, 0x000067cc, \
+   /* 13324 */ 0x40a50000, 0x000067d0, 0x40a50000, 0x000067d4, \
+   /* 13328 */ 0x40a50000, 0x000067d8, 0x40a50000, 0x000067dc, \
+   /* 13332 */ 0x40a50000, 0x000067e0, 0x40a50000, 0x000067e4, \
+   /* 13336 */ 0x40a50000, 0x000067e8, 0x40a50000, 0x000067ec, \
+   /* 13340 */ 0x40a50000, 0x000067f0, 0x40a50000, 0x000067f4, \
+   /* 13344 */ 0x40a50000, 0x000067f8, 0x40a50000, 0x000067fc, \
+   /* 13348 */ 0x40a50000, 0x00006800, 0x40a50000, 0x00006804, \
+   /* 13352 */ 0x40a50000, 0x00006808, 0x40a50000, 0x0000680c, \
+   /* 13356 */ 0x40a50000, 0x00006810, 0x40a50000, 0x00006814, \
+   /* 13360 */ 0x40a50000, 0x00006818, 0x40a50000, 0x0000681c, \
+   /* 13364 */ 0x40a50000, 0x00006820, 0x40a50000, 0x00006824, \
+   /* 13368 */ 0x40a50000, 0x00006828, 0x40a50000, 0x0000682c, \
+   /* 13372 */ 0x40a50000, 0x00006830, 0x40a50000, 0x00006834, \
+   /* 13376 */ 0x40a50000, 0x00006838, 0x40a50000, 0x0000683c, \
+   /* 13380 */ 0x40a50000, 0x00006840, 0x40a50000, 0x00006844, \
+   /* 13384 */ 0x40a50000, 0x00006848, 0x40a50000, 0x0000684c, \
+   /* 13388 */ 0x40a50000, 0x00006850, 0x40a50000, 0x00006854, \
+   /* 13392 */ 0x40a50000, 0x00006858, 0x40a50000, 0x0000685c, \
+   /* 13396 */ 0x40a50000, 0x00006860, 0x40a50000, 0x00006864, \
+   /* 13400 */ 0x40a50000, 0x00006868, 0x40a50000, 0x0000686c, \
+   /* 13404 */ 0x40a50000, 0x00006870, 0x40a50000, 0x00006874, \
+   /* 13408 */ 0x40a50000, 0x00006878, 0x40a50000, 0x0000687c, \
+   /* 13412 */ 0x40a50000, 0x00006880, 0x40a50000, 0x00006884, \
+   /* 13416 */ 0x40a50000, 0x00006888, 0x40a50000, 0x0000688c, \
+   /* 13420 */ 0x40a50000, 0x00006890, 0x40a50000, 0x00006894, \
+   /* 13424 */ 0x40a50000, 0x00006898, 0x40a50000, 0x0000689c, \
+   /* 13428 */ 0x40a50000, 0x000068a0, 0x40a50000, 0x000068a4, \
+   /* 13432 */ 0x40a50000, 0x000068a8, 0x40a50000, 0x000068ac, \
+   /* 13436 */ 0x40a50000, 0x000068b0, 0x40a50000, 0x000068b4, \
+   /* 13440 */ 0x40a50000, 0x000068b8, 0x40a50000, 0x000068bc, \
+   /* 13444 */ 0x40a50000, 0x000068c0, 0x40a50000, 0x000068c4, \
+   /* 13448 */ 0x40a50000, 0x000068c8, 0x40a50000, 0x000068cc, \
+   /* 13452 */ 0x40a50000, 0x000068d0, 0x40a50000, 0x000068d4, \
+   /* 13456 */ 0x40a50000, 0x000068d8, 0x40a50000, 0x000068dc, \
+   /* 13460 */ 0x40a50000, 0x000068e0, 0x40a50000, 0x000068e4, \
+   /* 13464 */ 0x40a50000, 0x000068e8, 0x40a50000, 0x000068ec, \
+   /* 13468 */ 0x40a50000, 0x000068f0, 0x40a50000, 0x000068f4, \
+   /* 13472 */ 0x40a50000, 0x000068f8, 0x40a50000, 0x000068fc, \
+   /* 13476 */ 0x40a50000, 0x00006900, 0x40a50000, 0x00006904, \
+   /* 13480 */ 0x40a50000, 0x00006908, 0x40a50000, 0x0000690c, \
+   /* 13484 */ 0x40a50000, 0x00006910, 0x40a50000, 0x00006914, \
+   /* 13488 */ 0x40a50000, 0x00006918, 0x40a50000, 0x0000691c, \
+   /* 13492 */ 0x40a50000, 0x00006920, 0x40a50000, 0x00006924, \
+   /* 13496 */ 0x40a50000, 0x00006928, 0x40a50000, 0x0000692c, \
+   /* 13500 */ 0x40a50000, 0x00006930, 0x40a50000, 0x00006934, \
+   /* 13504 */ 0x40a50000, 0x00006938, 0x40a50000, 0x0000693c, \
+   /* 13508 */ 0x40a50000, 0x00006940, 0x40a50000, 0x00006944, \
+   /* 13512 */ 0x40a50000, 0x00006948, 0x40a50000, 0x0000694c, \
+   /* 13516 */ 0x40a50000, 0x00006950, 0x40a50000, 0x00006954, \
+   /* 13520 */ 0x40a50000, 0x00006958, 0x40a50000, 0x0000695c, \
+   /* 13524 */ 0x40a50000, 0x00006960, 0x40a50000, 0x00006964, \
+   /* 13528 */ 0x40a50000, 0x00006968, 0x40a50000, 0x0000696c, \
+   /* 13532 */ 0x40a50000, 0x00006970, 0x40a50000, 0x00006974, \
+   /* 13536 */ 0x40a50000, 0x00006978, 0x40a50000, 0x0000697c, \
+   /* 13540 */ 0x40a50000, 0x00006980, 0x40a50000, 0x00006984, \
+   /* 13544 */ 0x40a50000, 0x00006988, 0x40a50000, 0x0000698c, \
+   /* 13548 */ 0x40a50000, 0x00006990, 0x40a50000, 0x00006994, \
+   /* 13552 */ 0x40a50000, 0x00006998, 0x40a50000, 0x0000699c, \
+   /* 13556 */ 0x40a50000, 0x000069a0, 0x40a50000, 0x000069a4, \
+   /* 13560 */ 0x40a50000, 0x000069a8, 0x40a50000, 0x000069ac, \
+   /* 13564 */ 0x40a50000, 0x000069b0, 0x40a50000, 0x000069b4, \
+   /* 13568 */ 0x40a50000, 0x000069b8, 0x40a50000, 0x000069bc, \
+   /* 13572 */ 0x40a50000, 0x000069c0, 0x40a50000, 0x000069c4, \
+   /* 13576 */ 0x40a50000, 0x000069c8, 0x40a50000, 0x000069cc, \
+   /* 13580 */ 0x40a50000, 0x000069d0, 0x40a50000, 0x000069d4, \
+   /* 13584 */ 0x40a50000, 0x000069d8, 0x40a50000, 0x000069dc, \
+   /* 13588 */ 0x40a50000, 0x000069e0, 0x40a50000, 0x000069e4, \
+   /* 13592 */ 0x40a50000, 0x000069e8, 0x40a50000, 0x000069ec, \
+   /* 13596 */ 0x40a50000, 0x000069f0, 0x40a50000, 0x000069f4, \
+   /* 13600 */ 0x40a50000, 0x000069f8, 0x40a50000, 0x000069fc, \
+   /* 13604 */ 0x40a50000, 0x00006a00, 0x40a50000, 0x00006a04, \
+   /* 13608 */ 0x40a50000, 0x00006a08, 0x40a50000, 0x00006a0c, \
+   /* 13612 */ 0x40a50000, 0x00006a10, 0x40a50000, 0x00006a14, \
+   /* 13616 */ 0x40a50000, 0x00006a18, 0x40a50000, 0x00006a1c, \
+   /* 13620 */ 0x40a50000, 0x00006a20, 0x40a50000, 0x00006a24, \
+   /* 13624 */ 0x40a50000, 0x00006a28, 0x40a50000, 0x00006a2c, \
+   /* 13628 */ 0x40a50000, 0x00006a30, 0x40a50000, 0x00006a34, \
+   /* 13632 */ 0x40a50000, 0x00006a38, 0x40a50000, 0x00006a3c, \
+   /* 13636 */ 0x40a50000, 0x00006a40, 0x40a50000, 0x00006a44, \
+   /* 13640 */ 0x40a50000, 0x00006a48, 0x40a50000, 0x00006a4c, \
+   /* 13644 */ 0x40a50000, 0x00006a50, 0x40a50000, 0x00006a54, \
+   /* 13648 */ 0x40a50000, 0x00006a58, 0x40a50000, 0x00006a5c, \
+   /* 13652 */ 0x40a50000, 0x00006a60, 0x40a50000, 0x00006a64, \
+   /* 13656 */ 0x40a50000, 0x00006a68, 0x40a50000, 0x00006a6c, \
+   /* 13660 */ 0x40a50000, 0x00006a70, 0x40a50000, 0x00006a74, \
+   /* 13664 */ 0x40a50000, 0x00006a78, 0x40a50000, 0x00006a7c, \
+   /* 13668 */ 0x40a50000, 0x00006a80, 0x40a50000, 0x00006a84, \
+   /* 13672 */ 0x40a50000, 0x00006a88, 0x40a50000, 0x00006a8c, \
+   /* 13676 */ 0x40a50000, 0x00006a90, 0x40a50000, 0x00006a94, \
+   /* 13680 */ 0x40a50000, 0x00006a98, 0x40a50000, 0x00006a9c, \
+   /* 13684 */ 0x40a50000, 0x00006aa0, 0x40a50000, 0x00006aa4, \
+   /* 13688 */ 0x40a50000, 0x00006aa8, 0x40a50000, 0x00006aac, \
+   /* 13692 */ 0x40a50000, 0x00006ab0, 0x40a50000, 0x00006ab4, \
+   /* 13696 */ 0x40a50000, 0x00006ab8, 0x40a50000, 0x00006abc, \
+   /* 13700 */ 0x40a50000, 0x00006ac0, 0x40a50000, 0x00006ac4, \
+   /* 13704 */ 0x40a50000, 0x00006ac8, 0x40a50000, 0x00006acc, \
+   /* 13708 */ 0x40a50000, 0x00006ad0, 0x40a50000, 0x00006ad4, \
+   /* 13712 */ 0x40a50000, 0x00006ad8, 0x40a50000, 0x00006adc, \
+   /* 13716 */ 0x40a50000, 0x00006ae0, 0x40a50000, 0x00006ae4, \
+   /* 13720 */ 0x40a50000, 0x00006ae8, 0x40a50000, 0x00006aec, \
+   /* 13724 */ 0x40a50000, 0x00006af0, 0x40a50000, 0x00006af4, \
+   /* 13728 */ 0x40a50000, 0x00006af8, 0x40a50000, 0x00006afc, \
+   /* 13732 */ 0x40a50000, 0x00006b00, 0x40a50000, 0x00006b04, \
+   /* 13736 */ 0x40a50000, 0x00006b08, 0x40a50000, 0x00006b0c, \
+   /* 13740 */ 0x40a50000, 0x00006b10, 0x40a50000, 0x00006b14, \
+   /* 13744 */ 0x40a50000, 0x00006b18, 0x40a50000, 0x00006b1c, \
+   /* 13748 */ 0x40a50000, 0x00006b20, 0x40a50000, 0x00006b24, \
+   /* 13752 */ 0x40a50000, 0x00006b28, 0x40a50000, 0x00006b2c, \
+   /* 13756 */ 0x40a50000, 0x00006b30, 0x40a50000, 0x00006b34, \
+   /* 13760 */ 0x40a50000, 0x00006b38, 0x40a50000, 0x00006b3c, \
+   /* 13764 */ 0x40a50000, 0x00006b40, 0x40a50000, 0x00006b44, \
+   /* 13768 */ 0x40a50000, 0x00006b48, 0x40a50000, 0x00006b4c, \
+   /* 13772 */ 0x40a50000, 0x00006b50, 0x40a50000, 0x00006b54, \
+   /* 13776 */ 0x40a50000, 0x00006b58, 0x40a50000, 0x00006b5c, \
+   /* 13780 */ 0x40a50000, 0x00006b60, 0x40a50000, 0x00006b64, \
+   /* 13784 */ 0x40a50000, 0x00006b68, 0x40a50000, 0x00006b6c, \
+   /* 13788 */ 0x40a50000, 0x00006b70, 0x40a50000, 0x00006b74, \
+   /* 13792 */ 0x40a50000, 0x00006b78, 0x40a50000, 0x00006b7c, \
+   /* 13796 */ 0x40a50000, 0x00006b80, 0x40a50000, 0x00006b84, \
+   /* 13800 */ 0x40a50000, 0x00006b88, 0x40a50000, 0x00006b8c, \
+   /* 13804 */ 0x40a50000, 0x00006b90, 0x40a50000, 0x00006b94, \
+   /* 13808 */ 0x40a50000, 0x00006b98, 0x40a50000, 0x00006b9c, \
+   /* 13812 */ 0x40a50000, 0x00006ba0, 0x40a50000, 0x00006ba4, \
+   /* 13816 */ 0x40a50000, 0x00006ba8, 0x40a50000, 0x00006bac, \
+   /* 13820 */ 0x40a50000, 0x00006bb0, 0x40a50000, 0x00006bb4, \
+   /* 13824 */ 0x40a50000, 0x00006bb8, 0x40a50000, 0x00006bbc, \
+   /* 13828 */ 0x40a50000, 0x00006bc0, 0x40a50000, 0x00006bc4, \
+   /* 13832 */ 0x40a50000, 0x00006bc8, 0x40a50000, 0x00006bcc, \
+   /* 13836 */ 0x40a50000, 0x00006bd0, 0x40a50000, 0x00006bd4, \
+   /* 13840 */ 0x40a50000, 0x00006bd8, 0x40a50000, 0x00006bdc, \
+   /* 13844 */ 0x40a50000, 0x00006be0, 0x40a50000, 0x00006be4, \
+   /* 13848 */ 0x40a50000, 0x00006be8, 0x40a50000, 0x00006bec, \
+   /* 13852 */ 0x40a50000, 0x00006bf0, 0x40a50000, 0x00006bf4, \
+   /* 13856 */ 0x40a50000, 0x00006bf8, 0x40a50000, 0x00006bfc, \
+   /* 13860 */ 0x40a50000, 0x00006c00, 0x40a50000, 0x00006c04, \
+   /* 13864 */ 0x40a50000, 0x00006c08, 0x40a50000, 0x00006c0c, \
+   /* 13868 */ 0x40a50000, 0x00006c10, 0x40a50000, 0x00006c14, \
+   /* 13872 */ 0x40a50000, 0x00006c18, 0x40a50000, 0x00006c1c, \
+   /* 13876 */ 0x40a50000, 0x00006c20, 0x40a50000, 0x00006c24, \
+   /* 13880 */ 0x40a50000, 0x00006c28, 0x40a50000, 0x00006c2c, \
+   /* 13884 */ 0x40a50000, 0x00006c30, 0x40a50000, 0x00006c34, \
+   /* 13888 */ 0x40a50000, 0x00006c38, 0x40a50000, 0x00006c3c, \
+   /* 13892 */ 0x40a50000, 0x00006c40, 0x40a50000, 0x00006c44, \
+   /* 13896 */ 0x40a50000, 0x00006c48, 0x40a50000, 0x00006c4c, \
+   /* 13900 */ 0x40a50000, 0x00006c50, 0x40a50000, 0x00006c54, \
+   /* 13904 */ 0x40a50000, 0x00006c58, 0x40a50000, 0x00006c5c, \
+   /* 13908 */ 0x40a50000, 0x00006c60, 0x40a50000, 0x00006c64, \
+   /* 13912 */ 0x40a50000, 0x00006c68, 0x40a50000, 0x00006c6c, \
+   /* 13916 */ 0x40a50000, 0x00006c70, 0x40a50000, 0x00006c74, \
+   /* 13920 */ 0x40a50000, 0x00006c78, 0x40a50000, 0x00006c7c, \
+   /* 13924 */ 0x40a50000, 0x00006c80, 0x40a50000, 0x00006c84, \
+   /* 13928 */ 0x40a50000, 0x00006c88, 0x40a50000, 0x00006c8c, \
+   /* 13932 */ 0x40a50000, 0x00006c90, 0x40a50000, 0x00006c94, \
+   /* 13936 */ 0x40a50000, 0x00006c98, 0x40a50000, 0x00006c9c, \
+   /* 13940 */ 0x40a50000, 0x00006ca0, 0x40a50000, 0x00006ca4, \
+   /* 13944 */ 0x40a50000, 0x00006ca8, 0x40a50000, 0x00006cac, \
+   /* 13948 */ 0x40a50000, 0x00006cb0, 0x40a50000, 0x00006cb4, \
+   /* 13952 */ 0x40a50000, 0x00006cb8, 0x40a50000, 0x00006cbc, \
+   /* 13956 */ 0x40a50000, 0x00006cc0, 0x40a50000, 0x00006cc4, \
+   /* 13960 */ 0x40a50000, 0x00006cc8, 0x40a50000, 0x00006ccc, \
+   /* 13964 */ 0x40a50000, 0x00006cd0, 0x40a50000, 0x00006cd4, \
+   /* 13968 */ 0x40a50000, 0x00006cd8, 0x40a50000, 0x00006cdc, \
+   /* 13972 */ 0x40a50000, 0x00006ce0, 0x40a50000, 0x00006ce4, \
+   /* 13976 */ 0x40a50000, 0x00006ce8, 0x40a50000, 0x00006cec, \
+   /* 13980 */ 0x40a50000, 0x00006cf0, 0x40a50000, 0x00006cf4, \
+   /* 13984 */ 0x40a50000, 0x00006cf8, 0x40a50000, 0x00006cfc, \
+   /* 13988 */ 0x40a50000, 0x00006d00, 0x40a50000, 0x00006d04, \
+   /* 13992 */ 0x40a50000, 0x00006d08, 0x40a50000, 0x00006d0c, \
+   /* 13996 */ 0x40a50000, 0x00006d10, 0x40a50000, 0x00006d14, \
+   /* 14000 */ 0x40a50000, 0x00006d18, 0x40a50000, 0x00006d1c, \
+   /* 14004 */ 0x40a50000, 0x00006d20, 0x40a50000, 0x00006d24, \
+   /* 14008 */ 0x40a50000, 0x00006d28, 0x40a50000, 0x00006d2c, \
+   /* 14012 */ 0x40a50000, 0x00006d30, 0x40a50000, 0x00006d34, \
+   /* 14016 */ 0x40a50000, 0x00006d38, 0x40a50000, 0x00006d3c, \
+   /* 14020 */ 0x40a50000, 0x00006d40, 0x40a50000, 0x00006d44, \
+   /* 14024 */ 0x40a50000, 0x00006d48, 0x40a50000, 0x00006d4c, \
+   /* 14028 */ 0x40a50000, 0x00006d50, 0x40a50000, 0x00006d54, \
+   /* 14032 */ 0x40a50000, 0x00006d58, 0x40a50000, 0x00006d5c, \
+   /* 14036 */ 0x40a50000, 0x00006d60, 0x40a50000, 0x00006d64, \
+   /* 14040 */ 0x40a50000, 0x00006d68, 0x40a50000, 0x00006d6c, \
+   /* 14044 */ 0x40a50000, 0x00006d70, 0x40a50000, 0x00006d74, \
+   /* 14048 */ 0x40a50000, 0x00006d78, 0x40a50000, 0x00006d7c, \
+   /* 14052 */ 0x40a50000, 0x00006d80, 0x40a50000, 0x00006d84, \
+   /* 14056 */ 0x40a50000, 0x00006d88, 0x40a50000, 0x00006d8c, \
+   /* 14060 */ 0x40a50000, 0x00006d90, 0x40a50000, 0x00006d94, \
+   /* 14064 */ 0x40a50000, 0x00006d98, 0x40a50000, 0x00006d9c, \
+   /* 14068 */ 0x40a50000, 0x00006da0, 0x40a50000, 0x00006da4, \
+   /* 14072 */ 0x40a50000, 0x00006da8, 0x40a50000, 0x00006dac, \
+   /* 14076 */ 0x40a50000, 0x00006db0, 0x40a50000, 0x00006db4, \
+   /* 14080 */ 0x40a50000, 0x00006db8, 0x40a50000, 0x00006dbc, \
+   /* 14084 */ 0x40a50000, 0x00006dc0, 0x40a50000, 0x00006dc4, \
+   /* 14088 */ 0x40a50000, 0x00006dc8, 0x40a50000, 0x00006dcc, \
+   /* 14092 */ 0x40a50000, 0x00006dd0, 0x40a50000, 0x00006dd4, \
+   /* 14096 */ 0x40a50000, 0x00006dd8, 0x40a50000, 0x00006ddc, \
+   /* 14100 */ 0x40a50000, 0x00006de0, 0x40a50000, 0x00006de4, \
+   /* 14104 */ 0x40a50000, 0x00006de8, 0x40a50000, 0x00006dec, \
+   /* 14108 */ 0x40a50000, 0x00006df0, 0x40a50000, 0x00006df4, \
+   /* 14112 */ 0x40a50000, 0x00006df8, 0x40a50000, 0x00006dfc, \
+   /* 14116 */ 0x40a50000, 0x00006e00, 0x40a50000, 0x00006e04, \
+   /* 14120 */ 0x40a50000, 0x00006e08, 0x40a50000, 0x00006e0c, \
+   /* 14124 */ 0x40a50000, 0x00006e10, 0x40a50000, 0x00006e14, \
+   /* 14128 */ 0x40a50000, 0x00006e18, 0x40a50000, 0x00006e1c, \
+   /* 14132 */ 0x40a50000, 0x00006e20, 0x40a50000, 0x00006e24, \
+   /* 14136 */ 0x40a50000, 0x00006e28, 0x40a50000, 0x00006e2c, \
+   /* 14140 */ 0x40a50000, 0x00006e30, 0x40a50000, 0x00006e34, \
+   /* 14144 */ 0x40a50000, 0x00006e38, 0x40a50000, 0x00006e3c, \
+   /* 14148 */ 0x40a50000, 0x00006e40, 0x40a50000, 0x00006e44, \
+   /* 14152 */ 0x40a50000, 0x00006e48, 0x40a50000, 0x00006e4c, \
+   /* 14156 */ 0x40a50000, 0x00006e50, 0x40a50000, 0x00006e54, \
+   /* 14160 */ 0x40a50000, 0x00006e58, 0x40a50000, 0x00006e5c, \
+   /* 14164 */ 0x40a50000, 0x00006e60, 0x40a50000, 0x00006e64, \
+   /* 14168 */ 0x40a50000, 0x00006e68, 0x40a50000, 0x00006e6c, \
+   /* 14172 */ 0x40a50000, 0x00006e70, 0x40a50000, 0x00006e74, \
+   /* 14176 */ 0x40a50000, 0x00006e78, 0x40a50000, 0x00006e7c, \
+   /* 14180 */ 0x40a50000, 0x00006e80, 0x40a50000, 0x00006e84, \
+   /* 14184 */ 0x40a50000, 0x00006e88, 0x40a50000, 0x00006e8c, \
+   /* 14188 */ 0x40a50000, 0x00006e90, 0x40a50000, 0x00006e94, \
+   /* 14192 */ 0x40a50000, 0x00006e98, 0x40a50000, 0x00006e9c, \
+   /* 14196 */ 0x40a50000, 0x00006ea0, 0x40a50000, 0x00006ea4, \
+   /* 14200 */ 0x40a50000, 0x00006ea8, 0x40a50000, 0x00006eac, \
+   /* 14204 */ 0x40a50000, 0x00006eb0, 0x40a50000, 0x00006eb4, \
+   /* 14208 */ 0x40a50000, 0x00006eb8, 0x40a50000, 0x00006ebc, \
+   /* 14212 */ 0x40a50000, 0x00006ec0, 0x40a50000, 0x00006ec4, \
+   /* 14216 */ 0x40a50000, 0x00006ec8, 0x40a50000, 0x00006ecc, \
+   /* 14220 */ 0x40a50000, 0x00006ed0, 0x40a50000, 0x00006ed4, \
+   /* 14224 */ 0x40a50000, 0x00006ed8, 0x40a50000, 0x00006edc, \
+   /* 14228 */ 0x40a50000, 0x00006ee0, 0x40a50000, 0x00006ee4, \
+   /* 14232 */ 0x40a50000, 0x00006ee8, 0x40a50000, 0x00006eec, \
+   /* 14236 */ 0x40a50000, 0x00006ef0, 0x40a50000, 0x00006ef4, \
+   /* 14240 */ 0x40a50000, 0x00006ef8, 0x40a50000, 0x00006efc, \
+   /* 14244 */ 0x40a50000, 0x00006f00, 0x40a50000, 0x00006f04, \
+   /* 14248 */ 0x40a50000, 0x00006f08, 0x40a50000, 0x00006f0c, \
+   /* 14252 */ 0x40a50000, 0x00006f10, 0x40a50000, 0x00006f14, \
+   /* 14256 */ 0x40a50000, 0x00006f18, 0x40a50000, 0x00006f1c, \
+   /* 14260 */ 0x40a50000, 0x00006f20, 0x40a50000, 0x00006f24, \
+   /* 14264 */ 0x40a50000, 0x00006f28, 0x40a50000, 0x00006f2c, \
+   /* 14268 */ 0x40a50000, 0x00006f30, 0x40a50000, 0x00006f34, \
+   /* 14272 */ 0x40a50000, 0x00006f38, 0x40a50000, 0x00006f3c, \
+   /* 14276 */ 0x40a50000, 0x00006f40, 0x40a50000, 0x00006f44, \
+   /* 14280 */ 0x40a50000, 0x00006f48, 0x40a50000, 0x00006f4c, \
+   /* 14284 */ 0x40a50000, 0x00006f50, 0x40a50000, 0x00006f54, \
+   /* 14288 */ 0x40a50000, 0x00006f58, 0x40a50000, 0x00006f5c, \
+   /* 14292 */ 0x40a50000, 0x00006f60, 0x40a50000, 0x00006f64, \
+   /* 14296 */ 0x40a50000, 0x00006f68, 0x40a50000, 0x00006f6c, \
+   /* 14300 */ 0x40a50000, 0x00006f70, 0x40a50000, 0x00006f74, \
+   /* 14304 */ 0x40a50000, 0x00006f78, 0x40a50000, 0x00006f7c, \
+   /* 14308 */ 0x40a50000, 0x00006f80, 0x40a50000, 0x00006f84, \
+   /* 14312 */ 0x40a50000, 0x00006f88, 0x40a50000, 0x00006f8c, \
+   /* 14316 */ 0x40a50000, 0x00006f90, 0x40a50000, 0x00006f94, \
+   /* 14320 */ 0x40a50000, 0x00006f98, 0x40a50000, 0x00006f9c, \
+   /* 14324 */ 0x40a50000, 0x00006fa0, 0x40a50000, 0x00006fa4, \
+   /* 14328 */ 0x40a50000, 0x00006fa8, 0x40a50000, 0x00006fac, \
+   /* 14332 */ 0x40a50000, 0x00006fb0, 0x40a50000, 0x00006fb4, \
+   /* 14336 */ 0x40a50000, 0x00006fb8, 0x40a50000, 0x00006fbc, \
+   /* 14340 */ 0x40a50000, 0x00006fc0, 0x40a50000, 0x00006fc4, \
+   /* 14344 */ 0x40a50000, 0x00006fc8, 0x40a50000, 0x00006fcc, \
+   /* 14348 */ 0x40a50000, 0x00006fd0, 0x40a50000, 0x00006fd4, \
+   /* 14352 */ 0x40a50000, 0x00006fd8, 0x40a50000, 0x00006fdc, \
+   /* 14356 */ 0x40a50000, 0x00006fe0, 0x40a50000, 0x00006fe4, \
+   /* 14360 */ 0x40a50000, 0x00006fe8, 0x40a50000, 0x00006fec, \
+   /* 14364 */ 0x40a50000, 0x00006ff0, 0x40a50000, 0x00006ff4, \
+   /* 14368 */ 0x40a50000, 0x00006ff8, 0x40a50000, 0x00006ffc, \
+   /* 14372 */ 0x40a50000, 0x00007000, 0x40a50000, 0x00007004, \
+   /* 14376 */ 0x40a50000, 0x00007008, 0x40a50000, 0x0000700c, \
+   /* 14380 */ 0x40a50000, 0x00007010, 0x40a50000, 0x00007014, \
+   /* 14384 */ 0x40a50000, 0x00007018, 0x40a50000, 0x0000701c, \
+   /* 14388 */ 0x40a50000, 0x00007020, 0x40a50000, 0x00007024, \
+   /* 14392 */ 0x40a50000, 0x00007028, 0x40a50000, 0x0000702c, \
+   /* 14396 */ 0x40a50000, 0x00007030, 0x40a50000, 0x00007034, \
+   /* 14400 */ 0x40a50000, 0x00007038, 0x40a50000, 0x0000703c, \
+   /* 14404 */ 0x40a50000, 0x00007040, 0x40a50000, 0x00007044, \
+   /* 14408 */ 0x40a50000, 0x00007048, 0x40a50000, 0x0000704c, \
+   /* 14412 */ 0x40a50000, 0x00007050, 0x40a50000, 0x00007054, \
+   /* 14416 */ 0x40a50000, 0x00007058, 0x40a50000, 0x0000705c, \
+   /* 14420 */ 0x40a50000, 0x00007060, 0x40a50000, 0x00007064, \
+   /* 14424 */ 0x40a50000, 0x00007068, 0x40a50000, 0x0000706c, \
+   /* 14428 */ 0x40a50000, 0x00007070, 0x40a50000, 0x00007074, \
+   /* 14432 */ 0x40a50000, 0x00007078, 0x40a50000, 0x0000707c, \
+   /* 14436 */ 0x40a50000, 0x00007080, 0x40a50000, 0x00007084, \
+   /* 14440 */ 0x40a50000, 0x00007088, 0x40a50000, 0x0000708c, \
+   /* 14444 */ 0x40a50000, 0x00007090, 0x40a50000, 0x00007094, \
+   /* 14448 */ 0x40a50000, 0x00007098, 0x40a50000, 0x0000709c, \
+   /* 14452 */ 0x40a50000, 0x000070a0, 0x40a50000, 0x000070a4, \
+   /* 14456 */ 0x40a50000, 0x000070a8, 0x40a50000, 0x000070ac, \
+   /* 14460 */ 0x40a50000, 0x000070b0, 0x40a50000, 0x000070b4, \
+   /* 14464 */ 0x40a50000, 0x000070b8, 0x40a50000, 0x000070bc, \
+   /* 14468 */ 0x40a50000, 0x000070c0, 0x40a50000, 0x000070c4, \
+   /* 14472 */ 0x40a50000, 0x000070c8, 0x40a50000, 0x000070cc, \
+   /* 14476 */ 0x40a50000, 0x000070d0, 0x40a50000, 0x000070d4, \
+   /* 14480 */ 0x40a50000, 0x000070d8, 0x40a50000, 0x000070dc, \
+   /* 14484 */ 0x40a50000, 0x000070e0, 0x40a50000, 0x000070e4, \
+   /* 14488 */ 0x40a50000, 0x000070e8, 0x40a50000, 0x000070ec, \
+   /* 14492 */ 0x40a50000, 0x000070f0, 0x40a50000, 0x000070f4, \
+   /* 14496 */ 0x40a50000, 0x000070f8, 0x40a50000, 0x000070fc, \
+   /* 14500 */ 0x40a50000, 0x00007100, 0x40a50000, 0x00007104, \
+   /* 14504 */ 0x40a50000, 0x00007108, 0x40a50000, 0x0000710c, \
+   /* 14508 */ 0x40a50000, 0x00007110, 0x40a50000, 0x00007114, \
+   /* 14512 */ 0x40a50000, 0x00007118, 0x40a50000, 0x0000711c, \
+   /* 14516 */ 0x40a50000, 0x00007120, 0x40a50000, 0x00007124, \
+   /* 14520 */ 0x40a50000, 0x00007128, 0x40a50000, 0x0000712c, \
+   /* 14524 */ 0x40a50000, 0x00007130, 0x40a50000, 0x00007134, \
+   /* 14528 */ 0x40a50000, 0x00007138, 0x40a50000, 0x0000713c, \
+   /* 14532 */ 0x40a50000, 0x00007140, 0x40a50000, 0x00007144, \
+   /* 14536 */ 0x40a50000, 0x00007148, 0x40a50000, 0x0000714c, \
+   /* 14540 */ 0x40a50000, 0x00007150, 0x40a50000, 0x00007154, \
+   /* 14544 */ 0x40a50000, 0x00007158, 0x40a50000, 0x0000715c, \
+   /* 14548 */ 0x40a50000, 0x00007160, 0x40a50000, 0x00007164, \
+   /* 14552 */ 0x40a50000, 0x00007168, 0x40a50000, 0x0000716c, \
+   /* 14556 */ 0x40a50000, 0x00007170, 0x40a50000, 0x00007174, \
+   /* 14560 */ 0x40a50000, 0x00007178, 0x40a50000, 0x0000717c, \
+   /* 14564 */ 0x40a50000, 0x00007180, 0x40a50000, 0x00007184, \
+   /* 14568 */ 0x40a50000, 0x00007188, 0x40a50000, 0x0000718c, \
+   /* 14572 */ 0x40a50000, 0x00007190, 0x40a50000, 0x00007194, \
+   /* 14576 */ 0x40a50000, 0x00007198, 0x40a50000, 0x0000719c, \
+   /* 14580 */ 0x40a50000, 0x000071a0, 0x40a50000, 0x000071a4, \
+   /* 14584 */ 0x40a50000, 0x000071a8, 0x40a50000, 0x000071ac, \
+   /* 14588 */ 0x40a50000, 0x000071b0, 0x40a50000, 0x000071b4, \
+   /* 14592 */ 0x40a50000, 0x000071b8, 0x40a50000, 0x000071bc, \
+   /* 14596 */ 0x40a50000, 0x000071c0, 0x40a50000, 0x000071c4, \
+   /* 14600 */ 0x40a50000, 0x000071c8, 0x40a50000, 0x000071cc, \
+   /* 14604 */ 0x40a50000, 0x000071d0, 0x40a50000, 0x000071d4, \
+   /* 14608 */ 0x40a50000, 0x000071d8, 0x40a50000, 0x000071dc, \
+   /* 14612 */ 0x40a50000, 0x000071e0, 0x40a50000, 0x000071e4, \
+   /* 14616 */ 0x40a50000, 0x000071e8, 0x40a50000, 0x000071ec, \
+   /* 14620 */ 0x40a50000, 0x000071f0, 0x40a50000, 0x000071f4, \
+   /* 14624 */ 0x40a50000, 0x000071f8, 0x40a50000, 0x000071fc, \
+   /* 14628 */ 0x40a50000, 0x00007200, 0x40a50000, 0x00007204, \
+   /* 14632 */ 0x40a50000, 0x00007208, 0x40a50000, 0x0000720c, \
+   /* 14636 */ 0x40a50000, 0x00007210, 0x40a50000, 0x00007214, \
+   /* 14640 */ 0x40a50000, 0x00007218, 0x40a50000, 0x0000721c, \
+   /* 14644 */ 0x40a50000, 0x00007220, 0x40a50000, 0x00007224, \
+   /* 14648 */ 0x40a50000, 0x00007228, 0x40a50000, 0x0000722c, \
+   /* 14652 */ 0x40a50000, 0x00007230, 0x40a50000, 0x00007234, \
+   /* 14656 */ 0x40a50000, 0x00007238, 0x40a50000, 0x0000723c, \
+   /* 14660 */ 0x40a50000, 0x00007240, 0x40a50000, 0x00007244, \
+   /* 14664 */ 0x40a50000, 0x00007248, 0x40a50000, 0x0000724c, \
+   /* 14668 */ 0x40a50000, 0x00007250, 0x40a50000, 0x00007254, \
+   /* 14672 */ 0x40a50000, 0x00007258, 0x40a50000, 0x0000725c, \
+   /* 14676 */ 0x40a50000, 0x00007260, 0x40a50000, 0x00007264, \
+   /* 14680 */ 0x40a50000, 0x00007268, 0x40a50000, 0x0000726c, \
+   /* 14684 */ 0x40a50000, 0x00007270, 0x40a50000, 0x00007274, \
+   /* 14688 */ 0x40a50000, 0x00007278, 0x40a50000, 0x0000727c, \
+   /* 14692 */ 0x40a50000, 0x00007280, 0x40a50000, 0x00007284, \
+   /* 14696 */ 0x40a50000, 0x00007288, 0x40a50000, 0x0000728c, \
+   /* 14700 */ 0x40a50000, 0x00007290, 0x40a50000, 0x00007294, \
+   /* 14704 */ 0x40a50000, 0x00007298, 0x40a50000, 0x0000729c, \
+   /* 14708 */ 0x40a50000, 0x000072a0, 0x40a50000, 0x000072a4, \
+   /* 14712 */ 0x40a50000, 0x000072a8, 0x40a50000, 0x000072ac, \
+   /* 14716 */ 0x40a50000, 0x000072b0, 0x40a50000, 0x000072b4, \
+   /* 14720 */ 0x40a50000, 0x000072b8, 0x40a50000, 0x000072bc, \
+   /* 14724 */ 0x40a50000, 0x000072c0, 0x40a50000, 0x000072c4, \
+   /* 14728 */ 0x40a50000, 0x000072c8, 0x40a50000, 0x000072cc, \
+   /* 14732 */ 0x40a50000, 0x000072d0, 0x40a50000, 0x000072d4, \
+   /* 14736 */ 0x40a50000, 0x000072d8, 0x40a50000, 0x000072dc, \
+   /* 14740 */ 0x40a50000, 0x000072e0, 0x40a50000, 0x000072e4, \
+   /* 14744 */ 0x40a50000, 0x000072e8, 0x40a50000, 0x000072ec, \
+   /* 14748 */ 0x40a50000, 0x000072f0, 0x40a50000, 0x000072f4, \
+   /* 14752 */ 0x40a50000, 0x000072f8, 0x40a50000, 0x000072fc, \
+   /* 14756 */ 0x40a50000, 0x00007300, 0x40a50000, 0x00007304, \
+   /* 14760 */ 0x40a50000, 0x00007308, 0x40a50000, 0x0000730c, \
+   /* 14764 */ 0x40a50000, 0x00007310, 0x40a50000, 0x00007314, \
+   /* 14768 */ 0x40a50000, 0x00007318, 0x40a50000, 0x0000731c, \
+   /* 14772 */ 0x40a50000, 0x00007320, 0x40a50000, 0x00007324, \
+   /* 14776 */ 0x40a50000, 0x00007328, 0x40a50000, 0x0000732c, \
+   /* 14780 */ 0x40a50000, 0x00007330, 0x40a50000, 0x00007334, \
+   /* 14784 */ 0x40a50000, 0x00007338, 0x40a50000, 0x0000733c, \
+   /* 14788 */ 0x40a50000, 0x00007340, 0x40a50000, 0x00007344, \
+   /* 14792 */ 0x40a50000, 0x00007348, 0x40a50000, 0x0000734c, \
+   /* 14796 */ 0x40a50000, 0x00007350, 0x40a50000, 0x00007354, \
+   /* 14800 */ 0x40a50000, 0x00007358, 0x40a50000, 0x0000735c, \
+   /* 14804 */ 0x40a50000, 0x00007360, 0x40a50000, 0x00007364, \
+   /* 14808 */ 0x40a50000, 0x00007368, 0x40a50000, 0x0000736c, \
+   /* 14812 */ 0x40a50000, 0x00007370, 0x40a50000, 0x00007374, \
+   /* 14816 */ 0x40a50000, 0x00007378, 0x40a50000, 0x0000737c, \
+   /* 14820 */ 0x40a50000, 0x00007380, 0x40a50000, 0x00007384, \
+   /* 14824 */ 0x40a50000, 0x00007388, 0x40a50000, 0x0000738c, \
+   /* 14828 */ 0x40a50000, 0x00007390, 0x40a50000, 0x00007394, \
+   /* 14832 */ 0x40a50000, 0x00007398, 0x40a50000, 0x0000739c, \
+   /* 14836 */ 0x40a50000, 0x000073a0, 0x40a50000, 0x000073a4, \
+   /* 14840 */ 0x40a50000, 0x000073a8, 0x40a50000, 0x000073ac, \
+   /* 14844 */ 0x40a50000, 0x000073b0, 0x40a50000, 0x000073b4, \
+   /* 14848 */ 0x40a50000, 0x000073b8, 0x40a50000, 0x000073bc, \
+   /* 14852 */ 0x40a50000, 0x000073c0, 0x40a50000, 0x000073c4, \
+   /* 14856 */ 0x40a50000, 0x000073c8, 0x40a50000, 0x000073cc, \
+   /* 14860 */ 0x40a50000, 0x000073d0, 0x40a50000, 0x000073d4, \
+   /* 14864 */ 0x40a50000, 0x000073d8, 0x40a50000, 0x000073dc, \
+   /* 14868 */ 0x40a50000, 0x000073e0, 0x40a50000, 0x000073e4, \
+   /* 14872 */ 0x40a50000, 0x000073e8, 0x40a50000, 0x000073ec, \
+   /* 14876 */ 0x40a50000, 0x000073f0, 0x40a50000, 0x000073f4, \
+   /* 14880 */ 0x40a50000, 0x000073f8, 0x40a50000, 0x000073fc, \
+   /* 14884 */ 0x40a50000, 0x00007400, 0x40a50000, 0x00007404, \
+   /* 14888 */ 0x40a50000, 0x00007408, 0x40a50000, 0x0000740c, \
+   /* 14892 */ 0x40a50000, 0x00007410, 0x40a50000, 0x00007414, \
+   /* 14896 */ 0x40a50000, 0x00007418, 0x40a50000, 0x0000741c, \
+   /* 14900 */ 0x40a50000, 0x00007420, 0x40a50000, 0x00007424, \
+   /* 14904 */ 0x40a50000, 0x00007428, 0x40a50000, 0x0000742c, \
+   /* 14908 */ 0x40a50000, 0x00007430, 0x40a50000, 0x00007434, \
+   /* 14912 */ 0x40a50000, 0x00007438, 0x40a50000, 0x0000743c, \
+   /* 14916 */ 0x40a50000, 0x00007440, 0x40a50000, 0x00007444, \
+   /* 14920 */ 0x40a50000, 0x00007448, 0x40a50000, 0x0000744c, \
+   /* 14924 */ 0x40a50000, 0x00007450, 0x40a50000, 0x00007454, \
+   /* 14928 */ 0x40a50000, 0x00007458, 0x40a50000, 0x0000745c, \
+   /* 14932 */ 0x40a50000, 0x00007460, 0x40a50000, 0x00007464, \
+   /* 14936 */ 0x40a50000, 0x00007468, 0x40a50000, 0x0000746c, \
+   /* 14940 */ 0x40a50000, 0x00007470, 0x40a50000, 0x00007474, \
+   /* 14944 */ 0x40a50000, 0x00007478, 0x40a50000, 0x0000747c, \
+   /* 14948 */ 0x40a50000, 0x00007480, 0x40a50000, 0x00007484, \
+   /* 14952 */ 0x40a50000, 0x00007488, 0x40a50000, 0x0000748c, \
+   /* 14956 */ 0x40a50000, 0x00007490, 0x40a50000, 0x00007494, \
+   /* 14960 */ 0x40a50000, 0x00007498, 0x40a50000, 0x0000749c, \
+   /* 14964 */ 0x40a50000, 0x000074a0, 0x40a50000, 0x000074a4, \
+   /* 14968 */ 0x40a50000, 0x000074a8, 0x40a50000, 0x000074ac, \
+   /* 14972 */ 0x40a50000, 0x000074b0, 0x40a50000, 0x000074b4, \
+   /* 14976 */ 0x40a50000, 0x000074b8, 0x40a50000, 0x000074bc, \
+   /* 14980 */ 0x40a50000, 0x000074c0, 0x40a50000, 0x000074c4, \
+   /* 14984 */ 0x40a50000, 0x000074c8, 0x40a50000, 0x000074cc, \
+   /* 14988 */ 0x40a50000, 0x000074d0, 0x40a50000, 0x000074d4, \
+   /* 14992 */ 0x40a50000, 0x000074d8, 0x40a50000, 0x000074dc, \
+   /* 14996 */ 0x40a50000, 0x000074e0, 0x40a50000, 0x000074e4, \
+   /* 15000 */ 0x40a50000, 0x000074e8, 0x40a50000, 0x000074ec, \
+   /* 15004 */ 0x40a50000, 0x000074f0, 0x40a50000, 0x000074f4, \
+   /* 15008 */ 0x40a50000, 0x000074f8, 0x40a50000, 0x000074fc, \
+   /* 15012 */ 0x40a50000, 0x00007500, 0x40a50000, 0x00007504, \
+   /* 15016 */ 0x40a50000, 0x00007508, 0x40a50000, 0x0000750c, \
+   /* 15020 */ 0x40a50000, 0x00007510, 0x40a50000, 0x00007514, \
+   /* 15024 */ 0x40a50000, 0x00007518, 0x40a50000, 0x0000751c, \
+   /* 15028 */ 0x40a50000, 0x00007520, 0x40a50000, 0x00007524, \
+   /* 15032 */ 0x40a50000, 0x00007528, 0x40a50000, 0x0000752c, \
+   /* 15036 */ 0x40a50000, 0x00007530, 0x40a50000, 0x00007534, \
+   /* 15040 */ 0x40a50000, 0x00007538, 0x40a50000, 0x0000753c, \
+   /* 15044 */ 0x40a50000, 0x00007540, 0x40a50000, 0x00007544, \
+   /* 15048 */ 0x40a50000, 0x00007548, 0x40a50000, 0x0000754c, \
+   /* 15052 */ 0x40a50000, 0x00007550, 0x40a50000, 0x00007554, \
+   /* 15056 */ 0x40a50000, 0x00007558, 0x40a50000, 0x0000755c, \
+   /* 15060 */ 0x40a50000, 0x00007560, 0x40a50000, 0x00007564, \
+   /* 15064 */ 0x40a50000, 0x00007568, 0x40a50000, 0x0000756c, \
+   /* 15068 */ 0x40a50000, 0x00007570, 0x40a50000, 0x00007574, \
+   /* 15072 */ 0x40a50000, 0x00007578, 0x40a50000, 0x0000757c, \
+   /* 15076 */ 0x40a50000, 0x00007580, 0x40a50000, 0x00007584, \
+   /* 15080 */ 0x40a50000, 0x00007588, 0x40a50000, 0x0000758c, \
+   /* 15084 */ 0x40a50000, 0x00007590, 0x40a50000, 0x00007594, \
+   /* 15088 */ 0x40a50000, 0x00007598, 0x40a50000, 0x0000759c, \
+   /* 15092 */ 0x40a50000, 0x000075a0, 0x40a50000, 0x000075a4, \
+   /* 15096 */ 0x40a50000, 0x000075a8, 0x40a50000, 0x000075ac, \
+   /* 15100 */ 0x40a50000, 0x000075b0, 0x40a50000, 0x000075b4, \
+   /* 15104 */ 0x40a50000, 0x000075b8, 0x40a50000, 0x000075bc, \
+   /* 15108 */ 0x40a50000, 0x000075c0, 0x40a50000, 0x000075c4, \
+   /* 15112 */ 0x40a50000, 0x000075c8, 0x40a50000, 0x000075cc, \
+   /* 15116 */ 0x40a50000, 0x000075d0, 0x40a50000, 0x000075d4, \
+   /* 15120 */ 0x40a50000, 0x000075d8, 0x40a50000, 0x000075dc, \
+   /* 15124 */ 0x40a50000, 0x000075e0, 0x40a50000, 0x000075e4, \
+   /* 15128 */ 0x40a50000, 0x000075e8, 0x40a50000, 0x000075ec, \
+   /* 15132 */ 0x40a50000, 0x000075f0, 0x40a50000, 0x000075f4, \
+   /* 15136 */ 0x40a50000, 0x000075f8, 0x40a50000, 0x000075fc, \
+   /* 15140 */ 0x40a50000, 0x00007600, 0x40a50000, 0x00007604, \
+   /* 15144 */ 0x40a50000, 0x00007608, 0x40a50000, 0x0000760c, \
+   /* 15148 */ 0x40a50000, 0x00007610, 0x40a50000, 0x00007614, \
+   /* 15152 */ 0x40a50000, 0x00007618, 0x40a50000, 0x0000761c, \
+   /* 15156 */ 0x40a50000, 0x00007620, 0x40a50000, 0x00007624, \
+   /* 15160 */ 0x40a50000, 0x00007628, 0x40a50000, 0x0000762c, \
+   /* 15164 */ 0x40a50000, 0x00007630, 0x40a50000, 0x00007634, \
+   /* 15168 */ 0x40a50000, 0x00007638, 0x40a50000, 0x0000763c, \
+   /* 15172 */ 0x40a50000, 0x00007640, 0x40a50000, 0x00007644, \
+   /* 15176 */ 0x40a50000, 0x00007648, 0x40a50000, 0x0000764c, \
+   /* 15180 */ 0x40a50000, 0x00007650, 0x40a50000, 0x00007654, \
+   /* 15184 */ 0x40a50000, 0x00007658, 0x40a50000, 0x0000765c, \
+   /* 15188 */ 0x40a50000, 0x00007660, 0x40a50000, 0x00007664, \
+   /* 15192 */ 0x40a50000, 0x00007668, 0x40a50000, 0x0000766c, \
+   /* 15196 */ 0x40a50000, 0x00007670, 0x40a50000, 0x00007674, \
+   /* 15200 */ 0x40a50000, 0x00007678, 0x40a50000, 0x0000767c, \
+   /* 15204 */ 0x40a50000, 0x00007680, 0x40a50000, 0x00007684, \
+   /* 15208 */ 0x40a50000, 0x00007688, 0x40a50000, 0x0000768c, \
+   /* 15212 */ 0x40a50000, 0x00007690, 0x40a50000, 0x00007694, \
+   /* 15216 */ 0x40a50000, 0x00007698, 0x40a50000, 0x0000769c, \
+   /* 15220 */ 0x40a50000, 0x000076a0, 0x40a50000, 0x000076a4, \
+   /* 15224 */ 0x40a50000, 0x000076a8, 0x40a50000, 0x000076ac, \
+   /* 15228 */ 0x40a50000, 0x000076b0, 0x40a50000, 0x000076b4, \
+   /* 15232 */ 0x40a50000, 0x000076b8, 0x40a50000, 0x000076bc, \
+   /* 15236 */ 0x40a50000, 0x000076c0, 0x40a50000, 0x000076c4, \
+   /* 15240 */ 0x40a50000, 0x000076c8, 0x40a50000, 0x000076cc, \
+   /* 15244 */ 0x40a50000, 0x000076d0, 0x40a50000, 0x000076d4, \
+   /* 15248 */ 0x40a50000, 0x000076d8, 0x40a50000, 0x000076dc, \
+   /* 15252 */ 0x40a50000, 0x000076e0, 0x40a50000, 0x000076e4, \
+   /* 15256 */ 0x40a50000, 0x000076e8, 0x40a50000, 0x000076ec, \
+   /* 15260 */ 0x40a50000, 0x000076f0, 0x40a50000, 0x000076f4, \
+   /* 15264 */ 0x40a50000, 0x000076f8, 0x40a50000, 0x000076fc, \
+   /* 15268 */ 0x40a50000, 0x00007700, 0x40a50000, 0x00007704, \
+   /* 15272 */ 0x40a50000, 0x00007708, 0x40a50000, 0x0000770c, \
+   /* 15276 */ 0x40a50000, 0x00007710, 0x40a50000, 0x00007714, \
+   /* 15280 */ 0x40a50000, 0x00007718, 0x40a50000, 0x0000771c, \
+   /* 15284 */ 0x40a50000, 0x00007720, 0x40a50000, 0x00007724, \
+   /* 15288 */ 0x40a50000, 0x00007728, 0x40a50000, 0x0000772c, \
+   /* 15292 */ 0x40a50000, 0x00007730, 0x40a50000, 0x00007734, \
+   /* 15296 */ 0x40a50000, 0x00007738, 0x40a50000, 0x0000773c, \
+   /* 15300 */ 0x40a50000, 0x00007740, 0x40a50000, 0x00007744, \
+   /* 15304 */ 0x40a50000, 0x00007748, 0x40a50000, 0x0000774c, \
+   /* 15308 */ 0x40a50000, 0x00007750, 0x40a50000, 0x00007754, \
+   /* 15312 */ 0x40a50000, 0x00007758, 0x40a50000, 0x0000775c, \
+   /* 15316 */ 0x40a50000, 0x00007760, 0x40a50000, 0x00007764, \
+   /* 15320 */ 0x40a50000, 0x00007768, 0x40a50000, 0x0000776c, \
+   /* 15324 */ 0x40a50000, 0x00007770, 0x40a50000, 0x00007774, \
+   /* 15328 */ 0x40a50000, 0x00007778, 0x40a50000, 0x0000777c, \
+   /* 15332 */ 0x40a50000, 0x00007780, 0x40a50000, 0x00007784, \
+   /* 15336 */ 0x40a50000, 0x00007788, 0x40a50000, 0x0000778c, \
+   /* 15340 */ 0x40a50000, 0x00007790, 0x40a50000, 0x00007794, \
+   /* 15344 */ 0x40a50000, 0x00007798, 0x40a50000, 0x0000779c, \
+   /* 15348 */ 0x40a50000, 0x000077a0, 0x40a50000, 0x000077a4, \
+   /* 15352 */ 0x40a50000, 0x000077a8, 0x40a50000, 0x000077ac, \
+   /* 15356 */ 0x40a50000, 0x000077b0, 0x40a50000, 0x000077b4, \
+   /* 15360 */ 0x40a50000, 0x000077b8, 0x40a50000, 0x000077bc, \
+   /* 15364 */ 0x40a50000, 0x000077c0, 0x40a50000, 0x000077c4, \
+   /* 15368 */ 0x40a50000, 0x000077c8, 0x40a50000, 0x000077cc, \
+   /* 15372 */ 0x40a50000, 0x000077d0, 0x40a50000, 0x000077d4, \
+   /* 15376 */ 0x40a50000, 0x000077d8, 0x40a50000, 0x000077dc, \
+   /* 15380 */ 0x40a50000, 0x000077e0, 0x40a50000, 0x000077e4, \
+   /* 15384 */ 0x40a50000, 0x000077e8, 0x40a50000, 0x000077ec, \
+   /* 15388 */ 0x40a50000, 0x000077f0, 0x40a50000, 0x000077f4, \
+   /* 15392 */ 0x40a50000, 0x000077f8, 0x40a50000, 0x000077fc, \
+   /* 15396 */ 0x40a50000, 0x00007800, 0x40a50000, 0x00007804, \
+   /* 15400 */ 0x40a50000, 0x00007808, 0x40a50000, 0x0000780c, \
+   /* 15404 */ 0x40a50000, 0x00007810, 0x40a50000, 0x00007814, \
+   /* 15408 */ 0x40a50000, 0x00007818, 0x40a50000, 0x0000781c, \
+   /* 15412 */ 0x40a50000, 0x00007820, 0x40a50000, 0x00007824, \
+   /* 15416 */ 0x40a50000, 0x00007828, 0x40a50000, 0x0000782c, \
+   /* 15420 */ 0x40a50000, 0x00007830, 0x40a50000, 0x00007834, \
+   /* 15424 */ 0x40a50000, 0x00007838, 0x40a50000, 0x0000783c, \
+   /* 15428 */ 0x40a50000, 0x00007840, 0x40a50000, 0x00007844, \
+   /* 15432 */ 0x40a50000, 0x00007848, 0x40a50000, 0x0000784c, \
+   /* 15436 */ 0x40a50000, 0x00007850, 0x40a50000, 0x00007854, \
+   /* 15440 */ 0x40a50000, 0x00007858, 0x40a50000, 0x0000785c, \
+   /* 15444 */ 0x40a50000, 0x00007860, 0x40a50000, 0x00007864, \
+   /* 15448 */ 0x40a50000, 0x00007868, 0x40a50000, 0x0000786c, \
+   /* 15452 */ 0x40a50000, 0x00007870, 0x40a50000, 0x00007874, \
+   /* 15456 */ 0x40a50000, 0x00007878, 0x40a50000, 0x0000787c, \
+   /* 15460 */ 0x40a50000, 0x00007880, 0x40a50000, 0x00007884, \
+   /* 15464 */ 0x40a50000, 0x00007888, 0x40a50000, 0x0000788c, \
+   /* 15468 */ 0x40a50000, 0x00007890, 0x40a50000, 0x00007894, \
+   /* 15472 */ 0x40a50000, 0x00007898, 0x40a50000, 0x0000789c, \
+   /* 15476 */ 0x40a50000, 0x000078a0, 0x40a50000, 0x000078a4, \
+   /* 15480 */ 0x40a50000, 0x000078a8, 0x40a50000, 0x000078ac, \
+   /* 15484 */ 0x40a50000, 0x000078b0, 0x40a50000, 0x000078b4, \
+   /* 15488 */ 0x40a50000, 0x000078b8, 0x40a50000, 0x000078bc, \
+   /* 15492 */ 0x40a50000, 0x000078c0, 0x40a50000, 0x000078c4, \
+   /* 15496 */ 0x40a50000, 0x000078c8, 0x40a50000, 0x000078cc, \
+   /* 15500 */ 0x40a50000, 0x000078d0, 0x40a50000, 0x000078d4, \
+   /* 15504 */ 0x40a50000, 0x000078d8, 0x40a50000, 0x000078dc, \
+   /* 15508 */ 0x40a50000, 0x000078e0, 0x40a50000, 0x000078e4, \
+   /* 15512 */ 0x40a50000, 0x000078e8, 0x40a50000, 0x000078ec, \
+   /* 15516 */ 0x40a50000, 0x000078f0, 0x40a50000, 0x000078f4, \
+   /* 15520 */ 0x40a50000, 0x000078f8, 0x40a50000, 0x000078fc, \
+   /* 15524 */ 0x40a50000, 0x00007900, 0x40a50000, 0x00007904, \
+   /* 15528 */ 0x40a50000, 0x00007908, 0x40a50000, 0x0000790c, \
+   /* 15532 */ 0x40a50000, 0x00007910, 0x40a50000, 0x00007914, \
+   /* 15536 */ 0x40a50000, 0x00007918, 0x40a50000, 0x0000791c, \
+   /* 15540 */ 0x40a50000, 0x00007920, 0x40a50000, 0x00007924, \
+   /* 15544 */ 0x40a50000, 0x00007928, 0x40a50000, 0x0000792c, \
+   /* 15548 */ 0x40a50000, 0x00007930, 0x40a50000, 0x00007934, \
+   /* 15552 */ 0x40a50000, 0x00007938, 0x40a50000, 0x0000793c, \
+   /* 15556 */ 0x40a50000, 0x00007940, 0x40a50000, 0x00007944, \
+   /* 15560 */ 0x40a50000, 0x00007948, 0x40a50000, 0x0000794c, \
+   /* 15564 */ 0x40a50000, 0x00007950, 0x40a50000, 0x00007954, \
+   /* 15568 */ 0x40a50000, 0x00007958, 0x40a50000, 0x0000795c, \
+   /* 15572 */ 0x40a50000, 0x00007960, 0x40a50000, 0x00007964, \
+   /* 15576 */ 0x40a50000, 0x00007968, 0x40a50000, 0x0000796c, \
+   /* 15580 */ 0x40a50000, 0x00007970, 0x40a50000, 0x00007974, \
+   /* 15584 */ 0x40a50000, 0x00007978, 0x40a50000, 0x0000797c, \
+   /* 15588 */ 0x40a50000, 0x00007980, 0x40a50000, 0x00007984, \
+   /* 15592 */ 0x40a50000, 0x00007988, 0x40a50000, 0x0000798c, \
+   /* 15596 */ 0x40a50000, 0x00007990, 0x40a50000, 0x00007994, \
+   /* 15600 */ 0x40a50000, 0x00007998, 0x40a50000, 0x0000799c, \
+   /* 15604 */ 0x40a50000, 0x000079a0, 0x40a50000, 0x000079a4, \
+   /* 15608 */ 0x40a50000, 0x000079a8, 0x40a50000, 0x000079ac, \
+   /* 15612 */ 0x40a50000, 0x000079b0, 0x40a50000, 0x000079b4, \
+   /* 15616 */ 0x40a50000, 0x000079b8, 0x40a50000, 0x000079bc, \
+   /* 15620 */ 0x40a50000, 0x000079c0, 0x40a50000, 0x000079c4, \
+   /* 15624 */ 0x40a50000, 0x000079c8, 0x40a50000, 0x000079cc, \
+   /* 15628 */ 0x40a50000, 0x000079d0, 0x40a50000, 0x000079d4, \
+   /* 15632 */ 0x40a50000, 0x000079d8, 0x40a50000, 0x000079dc, \
+   /* 15636 */ 0x40a50000, 0x000079e0, 0x40a50000, 0x000079e4, \
+   /* 15640 */ 0x40a50000, 0x000079e8, 0x40a50000, 0x000079ec, \
+   /* 15644 */ 0x40a50000, 0x000079f0, 0x40a50000, 0x000079f4, \
+   /* 15648 */ 0x40a50000, 0x000079f8, 0x40a50000, 0x000079fc, \
+   /* 15652 */ 0x40a50000, 0x00007a00, 0x40a50000, 0x00007a04, \
+   /* 15656 */ 0x40a50000, 0x00007a08, 0x40a50000, 0x00007a0c, \
+   /* 15660 */ 0x40a50000, 0x00007a10, 0x40a50000, 0x00007a14, \
+   /* 15664 */ 0x40a50000, 0x00007a18, 0x40a50000, 0x00007a1c, \
+   /* 15668 */ 0x40a50000, 0x00007a20, 0x40a50000, 0x00007a24, \
+   /* 15672 */ 0x40a50000, 0x00007a28, 0x40a50000, 0x00007a2c, \
+   /* 15676 */ 0x40a50000, 0x00007a30, 0x40a50000, 0x00007a34, \
+   /* 15680 */ 0x40a50000, 0x00007a38, 0x40a50000, 0x00007a3c, \
+   /* 15684 */ 0x40a50000, 0x00007a40, 0x40a50000, 0x00007a44, \
+   /* 15688 */ 0x40a50000, 0x00007a48, 0x40a50000, 0x00007a4c, \
+   /* 15692 */ 0x40a50000, 0x00007a50, 0x40a50000, 0x00007a54, \
+   /* 15696 */ 0x40a50000, 0x00007a58, 0x40a50000, 0x00007a5c, \
+   /* 15700 */ 0x40a50000, 0x00007a60, 0x40a50000, 0x00007a64, \
+   /* 15704 */ 0x40a50000, 0x00007a68, 0x40a50000, 0x00007a6c, \
+   /* 15708 */ 0x40a50000, 0x00007a70, 0x40a50000, 0x00007a74, \
+   /* 15712 */ 0x40a50000, 0x00007a78, 0x40a50000, 0x00007a7c, \
+   /* 15716 */ 0x40a50000, 0x00007a80, 0x40a50000, 0x00007a84, \
+   /* 15720 */ 0x40a50000, 0x00007a88, 0x40a50000, 0x00007a8c, \
+   /* 15724 */ 0x40a50000, 0x00007a90, 0x40a50000, 0x00007a94, \
+   /* 15728 */ 0x40a50000, 0x00007a98, 0x40a50000, 0x00007a9c, \
+   /* 15732 */ 0x40a50000, 0x00007aa0, 0x40a50000, 0x00007aa4, \
+   /* 15736 */ 0x40a50000, 0x00007aa8, 0x40a50000, 0x00007aac, \
+   /* 15740 */ 0x40a50000, 0x00007ab0, 0x40a50000, 0x00007ab4, \
+   /* 15744 */ 0x40a50000, 0x00007ab8, 0x40a50000, 0x00007abc, \
+   /* 15748 */ 0x40a50000, 0x00007ac0, 0x40a50000, 0x00007ac4, \
+   /* 15752 */ 0x40a50000, 0x00007ac8, 0x40a50000, 0x00007acc, \
+   /* 15756 */ 0x40a50000, 0x00007ad0, 0x40a50000, 0x00007ad4, \
+   /* 15760 */ 0x40a50000, 0x00007ad8, 0x40a50000, 0x00007adc, \
+   /* 15764 */ 0x40a50000, 0x00007ae0, 0x40a50000, 0x00007ae4, \
+   /* 15768 */ 0x40a50000, 0x00007ae8, 0x40a50000, 0x00007aec, \
+   /* 15772 */ 0x40a50000, 0x00007af0, 0x40a50000, 0x00007af4, \
+   /* 15776 */ 0x40a50000, 0x00007af8, 0x40a50000, 0x00007afc, \
+   /* 15780 */ 0x40a50000, 0x00007b00, 0x40a50000, 0x00007b04, \
+   /* 15784 */ 0x40a50000, 0x00007b08, 0x40a50000, 0x00007b0c, \
+   /* 15788 */ 0x40a50000, 0x00007b10, 0x40a50000, 0x00007b14, \
+   /* 15792 */ 0x40a50000, 0x00007b18, 0x40a50000, 0x00007b1c, \
+   /* 15796 */ 0x40a50000, 0x00007b20, 0x40a50000, 0x00007b24, \
+   /* 15800 */ 0x40a50000, 0x00007b28, 0x40a50000, 0x00007b2c, \
+   /* 15804 */ 0x40a50000, 0x00007b30, 0x40a50000, 0x00007b34, \
+   /* 15808 */ 0x40a50000, 0x00007b38, 0x40a50000, 0x00007b3c, \
+   /* 15812 */ 0x40a50000, 0x00007b40, 0x40a50000, 0x00007b44, \
+   /* 15816 */ 0x40a50000, 0x00007b48, 0x40a50000, 0x00007b4c, \
+   /* 15820 */ 0x40a50000, 0x00007b50, 0x40a50000, 0x00007b54, \
+   /* 15824 */ 0x40a50000, 0x00007b58, 0x40a50000, 0x00007b5c, \
+   /* 15828 */ 0x40a50000, 0x00007b60, 0x40a50000, 0x00007b64, \
+   /* 15832 */ 0x40a50000, 0x00007b68, 0x40a50000, 0x00007b6c, \
+   /* 15836 */ 0x40a50000, 0x00007b70, 0x40a50000, 0x00007b74, \
+   /* 15840 */ 0x40a50000, 0x00007b78, 0x40a50000, 0x00007b7c, \
+   /* 15844 */ 0x40a50000, 0x00007b80, 0x40a50000, 0x00007b84, \
+   /* 15848 */ 0x40a50000, 0x00007b88, 0x40a50000, 0x00007b8c, \
+   /* 15852 */ 0x40a50000, 0x00007b90, 0x40a50000, 0x00007b94, \
+   /* 15856 */ 0x40a50000, 0x00007b98, 0x40a50000, 0x00007b9c, \
+   /* 15860 */ 0x40a50000, 0x00007ba0, 0x40a50000, 0x00007ba4, \
+   /* 15864 */ 0x40a50000, 0x00007ba8, 0x40a50000, 0x00007bac, \
+   /* 15868 */ 0x40a50000, 0x00007bb0, 0x40a50000, 0x00007bb4, \
+   /* 15872 */ 0x40a50000, 0x00007bb8, 0x40a50000, 0x00007bbc, \
+   /* 15876 */ 0x40a50000, 0x00007bc0, 0x40a50000, 0x00007bc4, \
+   /* 15880 */ 0x40a50000, 0x00007bc8, 0x40a50000, 0x00007bcc, \
+   /* 15884 */ 0x40a50000, 0x00007bd0, 0x40a50000, 0x00007bd4, \
+   /* 15888 */ 0x40a50000, 0x00007bd8, 0x40a50000, 0x00007bdc, \
+   /* 15892 */ 0x40a50000, 0x00007be0, 0x40a50000, 0x00007be4, \
+   /* 15896 */ 0x40a50000, 0x00007be8, 0x40a50000, 0x00007bec, \
+   /* 15900 */ 0x40a50000, 0x00007bf0, 0x40a50000, 0x00007bf4, \
+   /* 15904 */ 0x40a50000, 0x00007bf8, 0x40a50000, 0x00007bfc, \
+   /* 15908 */ 0x40a50000, 0x00007c00, 0x40a50000, 0x00007c04, \
+   /* 15912 */ 0x40a50000, 0x00007c08, 0x40a50000, 0x00007c0c, \
+   /* 15916 */ 0x40a50000, 0x00007c10, 0x40a50000, 0x00007c14, \
+   /* 15920 */ 0x40a50000, 0x00007c18, 0x40a50000, 0x00007c1c, \
+   /* 15924 */ 0x40a50000, 0x00007c20, 0x40a50000, 0x00007c24, \
+   /* 15928 */ 0x40a50000, 0x00007c28, 0x40a50000, 0x00007c2c, \
+   /* 15932 */ 0x40a50000, 0x00007c30, 0x40a50000, 0x00007c34, \
+   /* 15936 */ 0x40a50000, 0x00007c38, 0x40a50000, 0x00007c3c, \
+   /* 15940 */ 0x40a50000, 0x00007c40, 0x40a50000, 0x00007c44, \
+   /* 15944 */ 0x40a50000, 0x00007c48, 0x40a50000, 0x00007c4c, \
+   /* 15948 */ 0x40a50000, 0x00007c50, 0x40a50000, 0x00007c54, \
+   /* 15952 */ 0x40a50000, 0x00007c58, 0x40a50000, 0x00007c5c, \
+   /* 15956 */ 0x40a50000, 0x00007c60, 0x40a50000, 0x00007c64, \
+   /* 15960 */ 0x40a50000, 0x00007c68, 0x40a50000, 0x00007c6c, \
+   /* 15964 */ 0x40a50000, 0x00007c70, 0x40a50000, 0x00007c74, \
+   /* 15968 */ 0x40a50000, 0x00007c78, 0x40a50000, 0x00007c7c, \
+   /* 15972 */ 0x40a50000, 0x00007c80, 0x40a50000, 0x00007c84, \
+   /* 15976 */ 0x40a50000, 0x00007c88, 0x40a50000, 0x00007c8c, \
+   /* 15980 */ 0x40a50000, 0x00007c90, 0x40a50000, 0x00007c94, \
+   /* 15984 */ 0x40a50000, 0x00007c98, 0x40a50000, 0x00007c9c, \
+   /* 15988 */ 0x40a50000, 0x00007ca0, 0x40a50000, 0x00007ca4, \
+   /* 15992 */ 0x40a50000, 0x00007ca8, 0x40a50000, 0x00007cac, \
+   /* 15996 */ 0x40a50000, 0x00007cb0, 0x40a50000, 0x00007cb4, \
+   /* 16000 */ 0x40a50000, 0x00007cb8, 0x40a50000, 0x00007cbc, \
+   /* 16004 */ 0x40a50000, 0x00007cc0, 0x40a50000, 0x00007cc4, \
+   /* 16008 */ 0x40a50000, 0x00007cc8, 0x40a50000, 0x00007ccc, \
+   /* 16012 */ 0x40a50000, 0x00007cd0, 0x40a50000, 0x00007cd4, \
+   /* 16016 */ 0x40a50000, 0x00007cd8, 0x40a50000, 0x00007cdc, \
+   /* 16020 */ 0x40a50000, 0x00007ce0, 0x40a50000, 0x00007ce4, \
+   /* 16024 */ 0x40a50000, 0x00007ce8, 0x40a50000, 0x00007cec, \
+   /* 16028 */ 0x40a50000, 0x00007cf0, 0x40a50000, 0x00007cf4, \
+   /* 16032 */ 0x40a50000, 0x00007cf8, 0x40a50000, 0x00007cfc, \
+   /* 16036 */ 0x40a50000, 0x00007d00, 0x40a50000, 0x00007d04, \
+   /* 16040 */ 0x40a50000, 0x00007d08, 0x40a50000, 0x00007d0c, \
+   /* 16044 */ 0x40a50000, 0x00007d10, 0x40a50000, 0x00007d14, \
+   /* 16048 */ 0x40a50000, 0x00007d18, 0x40a50000, 0x00007d1c, \
+   /* 16052 */ 0x40a50000, 0x00007d20, 0x40a50000, 0x00007d24, \
+   /* 16056 */ 0x40a50000, 0x00007d28, 0x40a50000, 0x00007d2c, \
+   /* 16060 */ 0x40a50000, 0x00007d30, 0x40a50000, 0x00007d34, \
+   /* 16064 */ 0x40a50000, 0x00007d38, 0x40a50000, 0x00007d3c, \
+   /* 16068 */ 0x40a50000, 0x00007d40, 0x40a50000, 0x00007d44, \
+   /* 16072 */ 0x40a50000, 0x00007d48, 0x40a50000, 0x00007d4c, \
+   /* 16076 */ 0x40a50000, 0x00007d50, 0x40a50000, 0x00007d54, \
+   /* 16080 */ 0x40a50000, 0x00007d58, 0x40a50000, 0x00007d5c, \
+   /* 16084 */ 0x40a50000, 0x00007d60, 0x40a50000, 0x00007d64, \
+   /* 16088 */ 0x40a50000, 0x00007d68, 0x40a50000, 0x00007d6c, \
+   /* 16092 */ 0x40a50000, 0x00007d70, 0x40a50000, 0x00007d74, \
+   /* 16096 */ 0x40a50000, 0x00007d78, 0x40a50000, 0x00007d7c, \
+   /* 16100 */ 0x40a50000, 0x00007d80, 0x40a50000, 0x00007d84, \
+   /* 16104 */ 0x40a50000, 0x00007d88, 0x40a50000, 0x00007d8c, \
+   /* 16108 */ 0x40a50000, 0x00007d90, 0x40a50000, 0x00007d94, \
+   /* 16112 */ 0x40a50000, 0x00007d98, 0x40a50000, 0x00007d9c, \
+   /* 16116 */ 0x40a50000, 0x00007da0, 0x40a50000, 0x00007da4, \
+   /* 16120 */ 0x40a50000, 0x00007da8, 0x40a50000, 0x00007dac, \
+   /* 16124 */ 0x40a50000, 0x00007db0, 0x40a50000, 0x00007db4, \
+   /* 16128 */ 0x40a50000, 0x00007db8, 0x40a50000, 0x00007dbc, \
+   /* 16132 */ 0x40a50000, 0x00007dc0, 0x40a50000, 0x00007dc4, \
+   /* 16136 */ 0x40a50000, 0x00007dc8, 0x40a50000, 0x00007dcc, \
+   /* 16140 */ 0x40a50000, 0x00007dd0, 0x40a50000, 0x00007dd4, \
+   /* 16144 */ 0x40a50000, 0x00007dd8, 0x40a50000, 0x00007ddc, \
+   /* 16148 */ 0x40a50000, 0x00007de0, 0x40a50000, 0x00007de4, \
+   /* 16152 */ 0x40a50000, 0x00007de8, 0x40a50000, 0x00007dec, \
+   /* 16156 */ 0x40a50000, 0x00007df0, 0x40a50000, 0x00007df4, \
+   /* 16160 */ 0x40a50000, 0x00007df8, 0x40a50000, 0x00007dfc, \
+   /* 16164 */ 0x40a50000, 0x00007e00, 0x40a50000, 0x00007e04, \
+   /* 16168 */ 0x40a50000, 0x00007e08, 0x40a50000, 0x00007e0c, \
+   /* 16172 */ 0x40a50000, 0x00007e10, 0x40a50000, 0x00007e14, \
+   /* 16176 */ 0x40a50000, 0x00007e18, 0x40a50000, 0x00007e1c, \
+   /* 16180 */ 0x40a50000, 0x00007e20, 0x40a50000, 0x00007e24, \
+   /* 16184 */ 0x40a50000, 0x00007e28, 0x40a50000, 0x00007e2c, \
+   /* 16188 */ 0x40a50000, 0x00007e30, 0x40a50000, 0x00007e34, \
+   /* 16192 */ 0x40a50000, 0x00007e38, 0x40a50000, 0x00007e3c, \
+   /* 16196 */ 0x40a50000, 0x00007e40, 0x40a50000, 0x00007e44, \
+   /* 16200 */ 0x40a50000, 0x00007e48, 0x40a50000, 0x00007e4c, \
+   /* 16204 */ 0x40a50000, 0x00007e50, 0x40a50000, 0x00007e54, \
+   /* 16208 */ 0x40a50000, 0x00007e58, 0x40a50000, 0x00007e5c, \
+   /* 16212 */ 0x40a50000, 0x00007e60, 0x40a50000, 0x00007e64, \
+   /* 16216 */ 0x40a50000, 0x00007e68, 0x40a50000, 0x00007e6c, \
+   /* 16220 */ 0x40a50000, 0x00007e70, 0x40a50000, 0x00007e74, \
+   /* 16224 */ 0x40a50000, 0x00007e78, 0x40a50000, 0x00007e7c, \
+   /* 16228 */ 0x40a50000, 0x00007e80, 0x40a50000, 0x00007e84, \
+   /* 16232 */ 0x40a50000, 0x00007e88, 0x40a50000, 0x00007e8c, \
+   /* 16236 */ 0x40a50000, 0x00007e90, 0x40a50000, 0x00007e94, \
+   /* 16240 */ 0x40a50000, 0x00007e98, 0x40a50000, 0x00007e9c, \
+   /* 16244 */ 0x40a50000, 0x00007ea0, 0x40a50000, 0x00007ea4, \
+   /* 16248 */ 0x40a50000, 0x00007ea8, 0x40a50000, 0x00007eac, \
+   /* 16252 */ 0x40a50000, 0x00007eb0, 0x40a50000, 0x00007eb4, \
+   /* 16256 */ 0x40a50000, 0x00007eb8, 0x40a50000, 0x00007ebc, \
+   /* 16260 */ 0x40a50000, 0x00007ec0, 0x40a50000, 0x00007ec4, \
+   /* 16264 */ 0x40a50000, 0x00007ec8, 0x40a50000, 0x00007ecc, \
+   /* 16268 */ 0x40a50000, 0x00007ed0, 0x40a50000, 0x00007ed4, \
+   /* 16272 */ 0x40a50000, 0x00007ed8, 0x40a50000, 0x00007edc, \
+   /* 16276 */ 0x40a50000, 0x00007ee0, 0x40a50000, 0x00007ee4, \
+   /* 16280 */ 0x40a50000, 0x00007ee8, 0x40a50000, 0x00007eec, \
+   /* 16284 */ 0x40a50000, 0x00007ef0, 0x40a50000, 0x00007ef4, \
+   /* 16288 */ 0x40a50000, 0x00007ef8, 0x40a50000, 0x00007efc, \
+   /* 16292 */ 0x40a50000, 0x00007f00, 0x40a50000, 0x00007f04, \
+   /* 16296 */ 0x40a50000, 0x00007f08, 0x40a50000, 0x00007f0c, \
+   /* 16300 */ 0x40a50000, 0x00007f10, 0x40a50000, 0x00007f14, \
+   /* 16304 */ 0x40a50000, 0x00007f18, 0x40a50000, 0x00007f1c, \
+   /* 16308 */ 0x40a50000, 0x00007f20, 0x40a50000, 0x00007f24, \
+   /* 16312 */ 0x40a50000, 0x00007f28, 0x40a50000, 0x00007f2c, \
+   /* 16316 */ 0x40a50000, 0x00007f30, 0x40a50000, 0x00007f34, \
+   /* 16320 */ 0x40a50000, 0x00007f38, 0x40a50000, 0x00007f3c, \
+   /* 16324 */ 0x40a50000, 0x00007f40, 0x40a50000, 0x00007f44, \
+   /* 16328 */ 0x40a50000, 0x00007f48, 0x40a50000, 0x00007f4c, \
+   /* 16332 */ 0x40a50000, 0x00007f50, 0x40a50000, 0x00007f54, \
+   /* 16336 */ 0x40a50000, 0x00007f58, 0x40a50000, 0x00007f5c, \
+   /* 16340 */ 0x40a50000, 0x00007f60, 0x40a50000, 0x00007f64, \
+   /* 16344 */ 0x40a50000, 0x00007f68, 0x40a50000, 0x00007f6c, \
+   /* 16348 */ 0x40a50000, 0x00007f70, 0x40a50000, 0x00007f74, \
+   /* 16352 */ 0x40a50000, 0x00007f78, 0x40a50000, 0x00007f7c, \
+   /* 16356 */ 0x40a50000, 0x00007f80, 0x40a50000, 0x00007f84, \
+   /* 16360 */ 0x40a50000, 0x00007f88, 0x40a50000, 0x00007f8c, \
+   /* 16364 */ 0x40a50000, 0x00007f90, 0x40a50000, 0x00007f94, \
+   /* 16368 */ 0x40a50000, 0x00007f98, 0x40a50000, 0x00007f9c, \
+   /* 16372 */ 0x40a50000, 0x00007fa0, 0x40a50000, 0x00007fa4, \
+   /* 16376 */ 0x40a50000, 0x00007fa8, 0x40a50000, 0x00007fac, \
+   /* 16380 */ 0x40a50000, 0x00007fb0, 0x40a50000, 0x00007fb4, \
+   /* 16384 */ 0x40a50000, 0x00007fb8, 0x40a50000, 0x00007fbc, \
+   /* 16388 */ 0x40a50000, 0x00007fc0, 0x40a50000, 0x00007fc4, \
+   /* 16392 */ 0x40a50000, 0x00007fc8, 0x40a50000, 0x00007fcc, \
+   /* 16396 */ 0x40a50000, 0x00007fd0, 0x40a50000, 0x00007fd4, \
+   /* 16400 */ 0x40a50000, 0x00007fd8, 0x40a50000, 0x00007fdc, \
+   /* 16404 */ 0x40a50000, 0x00007fe0, 0x40a50000, 0x00007fe4, \
+   /* 16408 */ 0x40a50000, 0x00007fe8, 0x40a50000, 0x00007fec, \
+   /* 16412 */ 0x40a50000, 0x00007ff0, 0x40a50000, 0x00007ff4, \
+   /* 16416 */ 0x40a50000, 0x00007ff8, 0x40a50000, 0x00007ffc, \
+   /* 16420 */ 0x40a50000, 0x00008000, 0x40a50000, 0x00008004, \
+   /* 16424 */ 0x40a50000, 0x00008008, 0x40a50000, 0x0000800c, \
+   /* 16428 */ 0x40a50000, 0x00008010, 0x40a50000, 0x00008014, \
+   /* 16432 */ 0x40a50000, 0x00008018, 0x40a50000, 0x0000801c, \
+   /* 16436 */ 0x40a50000, 0x00008020, 0x40a50000, 0x00008024, \
+   /* 16440 */ 0x40a50000, 0x00008028, 0x40a50000, 0x0000802c, \
+   /* 16444 */ 0x40a50000, 0x00008030, 0x40a50000, 0x00008034, \
+   /* 16448 */ 0x40a50000, 0x00008038, 0x40a50000, 0x0000803c, \
+   /* 16452 */ 0x40a50000, 0x00008040, 0x40a50000, 0x00008044, \
+   /* 16456 */ 0x40a50000, 0x00008048, 0x40a50000, 0x0000804c, \
+   /* 16460 */ 0x40a50000, 0x00008050, 0x40a50000, 0x00008054, \
+   /* 16464 */ 0x40a50000, 0x00008058, 0x40a50000, 0x0000805c, \
+   /* 16468 */ 0x40a50000, 0x00008060, 0x40a50000, 0x00008064, \
+   /* 16472 */ 0x40a50000, 0x00008068, 0x40a50000, 0x0000806c, \
+   /* 16476 */ 0x40a50000, 0x00008070, 0x40a50000, 0x00008074, \
+   /* 16480 */ 0x40a50000, 0x00008078, 0x40a50000, 0x0000807c, \
+   /* 16484 */ 0x40a50000, 0x00008080, 0x40a50000, 0x00008084, \
+   /* 16488 */ 0x40a50000, 0x00008088, 0x40a50000, 0x0000808c, \
+   /* 16492 */ 0x40a50000, 0x00008090, 0x40a50000, 0x00008094, \
+   /* 16496 */ 0x40a50000, 0x00008098, 0x40a50000, 0x0000809c, \
+   /* 16500 */ 0x40a50000, 0x000080a0, 0x40a50000, 0x000080a4, \
+   /* 16504 */ 0x40a50000, 0x000080a8, 0x40a50000, 0x000080ac, \
+   /* 16508 */ 0x40a50000, 0x000080b0, 0x40a50000, 0x000080b4, \
+   /* 16512 */ 0x40a50000, 0x000080b8, 0x40a50000, 0x000080bc, \
+   /* 16516 */ 0x40a50000, 0x000080c0, 0x40a50000, 0x000080c4, \
+   /* 16520 */ 0x40a50000, 0x000080c8, 0x40a50000, 0x000080cc, \
+   /* 16524 */ 0x40a50000, 0x000080d0, 0x40a50000, 0x000080d4, \
+   /* 16528 */ 0x40a50000, 0x000080d8, 0x40a50000, 0x000080dc, \
+   /* 16532 */ 0x40a50000, 0x000080e0, 0x40a50000, 0x000080e4, \
+   /* 16536 */ 0x40a50000, 0x000080e8, 0x40a50000, 0x000080ec, \
+   /* 16540 */ 0x40a50000, 0x000080f0, 0x40a50000, 0x000080f4, \
+   /* 16544 */ 0x40a50000, 0x000080f8, 0x40a50000, 0x000080fc, \
+   /* 16548 */ 0x40a50000, 0x00008100, 0x40a50000, 0x00008104, \
+   /* 16552 */ 0x40a50000, 0x00008108, 0x40a50000, 0x0000810c, \
+   /* 16556 */ 0x40a50000, 0x00008110, 0x40a50000, 0x00008114, \
+   /* 16560 */ 0x40a50000, 0x00008118, 0x40a50000, 0x0000811c, \
+   /* 16564 */ 0x40a50000, 0x00008120, 0x40a50000, 0x00008124, \
+   /* 16568 */ 0x40a50000, 0x00008128, 0x40a50000, 0x0000812c, \
+   /* 16572 */ 0x40a50000, 0x00008130, 0x40a50000, 0x00008134, \
+   /* 16576 */ 0x40a50000, 0x00008138, 0x40a50000, 0x0000813c, \
+   /* 16580 */ 0x40a50000, 0x00008140, 0x40a50000, 0x00008144, \
+   /* 16584 */ 0x40a50000, 0x00008148, 0x40a50000, 0x0000814c, \
+   /* 16588 */ 0x40a50000, 0x00008150, 0x40a50000, 0x00008154, \
+   /* 16592 */ 0x40a50000, 0x00008158, 0x40a50000, 0x0000815c, \
+   /* 16596 */ 0x40a50000, 0x00008160, 0x40a50000, 0x00008164, \
+   /* 16600 */ 0x40a50000, 0x00008168, 0x40a50000, 0x0000816c, \
+   /* 16604 */ 0x40a50000, 0x00008170, 0x40a50000, 0x00008174, \
+   /* 16608 */ 0x40a50000, 0x00008178, 0x40a50000, 0x0000817c, \
+   /* 16612 */ 0x40a50000, 0x00008180, 0x40a50000, 0x00008184, \
+   /* 16616 */ 0x40a50000, 0x00008188, 0x40a50000, 0x0000818c, \
+   /* 16620 */ 0x40a50000, 0x00008190, 0x40a50000, 0x00008194, \
+   /* 16624 */ 0x40a50000, 0x00008198, 0x40a50000, 0x0000819c, \
+   /* 16628 */ 0x40a50000, 0x000081a0, 0x40a50000, 0x000081a4, \
+   /* 16632 */ 0x40a50000, 0x000081a8, 0x40a50000, 0x000081ac, \
+   /* 16636 */ 0x40a50000, 0x000081b0, 0x40a50000, 0x000081b4, \
+   /* 16640 */ 0x40a50000, 0x000081b8, 0x40a50000, 0x000081bc, \
+   /* 16644 */ 0x40a50000, 0x000081c0, 0x40a50000, 0x000081c4, \
+   /* 16648 */ 0x40a50000, 0x000081c8, 0x40a50000, 0x000081cc, \
+   /* 16652 */ 0x40a50000, 0x000081d0, 0x40a50000, 0x000081d4, \
+   /* 16656 */ 0x40a50000, 0x000081d8, 0x40a50000, 0x000081dc, \
+   /* 16660 */ 0x40a50000, 0x000081e0, 0x40a50000, 0x000081e4, \
+   /* 16664 */ 0x40a50000, 0x000081e8, 0x40a50000, 0x000081ec, \
+   /* 16668 */ 0x40a50000, 0x000081f0, 0x40a50000, 0x000081f4, \
+   /* 16672 */ 0x40a50000, 0x000081f8, 0x40a50000, 0x000081fc, \
+   /* 16676 */ 0x40a50000, 0x00008200, 0x40a50000, 0x00008204, \
+   /* 16680 */ 0x40a50000, 0x00008208, 0x40a50000, 0x0000820c, \
+   /* 16684 */ 0x40a50000, 0x00008210, 0x40a50000, 0x00008214, \
+   /* 16688 */ 0x40a50000, 0x00008218, 0x40a50000, 0x0000821c, \
+   /* 16692 */ 0x40a50000, 0x00008220, 0x40a50000, 0x00008224, \
+   /* 16696 */ 0x40a50000, 0x00008228, 0x40a50000, 0x0000822c, \
+   /* 16700 */ 0x40a50000, 0x00008230, 0x40a50000, 0x00008234, \
+   /* 16704 */ 0x40a50000, 0x00008238, 0x40a50000, 0x0000823c, \
+   /* 16708 */ 0x40a50000, 0x00008240, 0x40a50000, 0x00008244, \
+   /* 16712 */ 0x40a50000, 0x00008248, 0x40a50000, 0x0000824c, \
+   /* 16716 */ 0x40a50000, 0x00008250, 0x40a50000, 0x00008254, \
+   /* 16720 */ 0x40a50000, 0x00008258, 0x40a50000, 0x0000825c, \
+   /* 16724 */ 0x40a50000, 0x00008260, 0x40a50000, 0x00008264, \
+   /* 16728 */ 0x40a50000, 0x00008268, 0x40a50000, 0x0000826c, \
+   /* 16732 */ 0x40a50000, 0x00008270, 0x40a50000, 0x00008274, \
+   /* 16736 */ 0x40a50000, 0x00008278, 0x40a50000, 0x0000827c, \
+   /* 16740 */ 0x40a50000, 0x00008280, 0x40a50000, 0x00008284, \
+   /* 16744 */ 0x40a50000, 0x00008288, 0x40a50000, 0x0000828c, \
+   /* 16748 */ 0x40a50000, 0x00008290, 0x40a50000, 0x00008294, \
+   /* 16752 */ 0x40a50000, 0x00008298, 0x40a50000, 0x0000829c, \
+   /* 16756 */ 0x40a50000, 0x000082a0, 0x40a50000, 0x000082a4, \
+   /* 16760 */ 0x40a50000, 0x000082a8, 0x40a50000, 0x000082ac, \
+   /* 16764 */ 0x40a50000, 0x000082b0, 0x40a50000, 0x000082b4, \
+   /* 16768 */ 0x40a50000, 0x000082b8, 0x40a50000, 0x000082bc, \
+   /* 16772 */ 0x40a50000, 0x000082c0, 0x40a50000, 0x000082c4, \
+   /* 16776 */ 0x40a50000, 0x000082c8, 0x40a50000, 0x000082cc, \
+   /* 16780 */ 0x40a50000, 0x000082d0, 0x40a50000, 0x000082d4, \
+   /* 16784 */ 0x40a50000, 0x000082d8, 0x40a50000, 0x000082dc, \
+   /* 16788 */ 0x40a50000, 0x000082e0, 0x40a50000, 0x000082e4, \
+   /* 16792 */ 0x40a50000, 0x000082e8, 0x40a50000, 0x000082ec, \
+   /* 16796 */ 0x40a50000, 0x000082f0, 0x40a50000, 0x000082f4, \
+   /* 16800 */ 0x40a50000, 0x000082f8, 0x40a50000, 0x000082fc, \
+   /* 16804 */ 0x40a50000, 0x00008300, 0x40a50000, 0x00008304, \
+   /* 16808 */ 0x40a50000, 0x00008308, 0x40a50000, 0x0000830c, \
+   /* 16812 */ 0x40a50000, 0x00008310, 0x40a50000, 0x00008314, \
+   /* 16816 */ 0x40a50000, 0x00008318, 0x40a50000, 0x0000831c, \
+   /* 16820 */ 0x40a50000, 0x00008320, 0x40a50000, 0x00008324, \
+   /* 16824 */ 0x40a50000, 0x00008328, 0x40a50000, 0x0000832c, \
+   /* 16828 */ 0x40a50000, 0x00008330, 0x40a50000, 0x00008334, \
+   /* 16832 */ 0x40a50000, 0x00008338, 0x40a50000, 0x0000833c, \
+   /* 16836 */ 0x40a50000, 0x00008340, 0x40a50000, 0x00008344, \
+   /* 16840 */ 0x40a50000, 0x00008348, 0x40a50000, 0x0000834c, \
+   /* 16844 */ 0x40a50000, 0x00008350, 0x40a50000, 0x00008354, \
+   /* 16848 */ 0x40a50000, 0x00008358, 0x40a50000, 0x0000835c, \
+   /* 16852 */ 0x40a50000, 0x00008360, 0x40a50000, 0x00008364, \
+   /* 16856 */ 0x40a50000, 0x00008368, 0x40a50000, 0x0000836c, \
+   /* 16860 */ 0x40a50000, 0x00008370, 0x40a50000, 0x00008374, \
+   /* 16864 */ 0x40a50000, 0x00008378, 0x40a50000, 0x0000837c, \
+   /* 16868 */ 0x40a50000, 0x00008380, 0x40a50000, 0x00008384, \
+   /* 16872 */ 0x40a50000, 0x00008388, 0x40a50000, 0x0000838c, \
+   /* 16876 */ 0x40a50000, 0x00008390, 0x40a50000, 0x00008394, \
+   /* 16880 */ 0x40a50000, 0x00008398, 0x40a50000, 0x0000839c, \
+   /* 16884 */ 0x40a50000, 0x000083a0, 0x40a50000, 0x000083a4, \
+   /* 16888 */ 0x40a50000, 0x000083a8, 0x40a50000, 0x000083ac, \
+   /* 16892 */ 0x40a50000, 0x000083b0, 0x40a50000, 0x000083b4, \
+   /* 16896 */ 0x40a50000, 0x000083b8, 0x40a50000, 0x000083bc, \
+   /* 16900 */ 0x40a50000, 0x000083c0, 0x40a50000, 0x000083c4, \
+   /* 16904 */ 0x40a50000, 0x000083c8, 0x40a50000, 0x000083cc, \
+   /* 16908 */ 0x40a50000, 0x000083d0, 0x40a50000, 0x000083d4, \
+   /* 16912 */ 0x40a50000, 0x000083d8, 0x40a50000, 0x000083dc, \
+   /* 16916 */ 0x40a50000, 0x000083e0, 0x40a50000, 0x000083e4, \
+   /* 16920 */ 0x40a50000, 0x000083e8, 0x40a50000, 0x000083ec, \
+   /* 16924 */ 0x40a50000, 0x000083f0, 0x40a50000, 0x000083f4, \
+   /* 16928 */ 0x40a50000, 0x000083f8, 0x40a50000, 0x000083fc, \
+   /* 16932 */ 0x40a50000, 0x00008400, 0x40a50000, 0x00008404, \
+   /* 16936 */ 0x40a50000, 0x00008408, 0x40a50000, 0x0000840c, \
+   /* 16940 */ 0x40a50000, 0x00008410, 0x40a50000, 0x00008414, \
+   /* 16944 */ 0x40a50000, 0x00008418, 0x40a50000, 0x0000841c, \
+   /* 16948 */ 0x40a50000, 0x00008420, 0x40a50000, 0x00008424, \
+   /* 16952 */ 0x40a50000, 0x00008428, 0x40a50000, 0x0000842c, \
+   /* 16956 */ 0x40a50000, 0x00008430, 0x40a50000, 0x00008434, \
+   /* 16960 */ 0x40a50000, 0x00008438, 0x40a50000, 0x0000843c, \
+   /* 16964 */ 0x40a50000, 0x00008440, 0x40a50000, 0x00008444, \
+   /* 16968 */ 0x40a50000, 0x00008448, 0x40a50000, 0x0000844c, \
+   /* 16972 */ 0x40a50000, 0x00008450, 0x40a50000, 0x00008454, \
+   /* 16976 */ 0x40a50000, 0x00008458, 0x40a50000, 0x0000845c, \
+   /* 16980 */ 0x40a50000, 0x00008460, 0x40a50000, 0x00008464, \
+   /* 16984 */ 0x40a50000, 0x00008468, 0x40a50000, 0x0000846c, \
+   /* 16988 */ 0x40a50000, 0x00008470, 0x40a50000, 0x00008474, \
+   /* 16992 */ 0x40a50000, 0x00008478, 0x40a50000, 0x0000847c, \
+   /* 16996 */ 0x40a50000, 0x00008480, 0x40a50000, 0x00008484, \
+   /* 17000 */ 0x40a50000, 0x00008488, 0x40a50000, 0x0000848c, \
+   /* 17004 */ 0x40a50000, 0x00008490, 0x40a50000, 0x00008494, \
+   /* 17008 */ 0x40a50000, 0x00008498, 0x40a50000, 0x0000849c, \
+   /* 17012 */ 0x40a50000, 0x000084a0, 0x40a50000, 0x000084a4, \
+   /* 17016 */ 0x40a50000, 0x000084a8, 0x40a50000, 0x000084ac, \
+   /* 17020 */ 0x40a50000, 0x000084b0, 0x40a50000, 0x000084b4, \
+   /* 17024 */ 0x40a50000, 0x000084b8, 0x40a50000, 0x000084bc, \
+   /* 17028 */ 0x40a50000, 0x000084c0, 0x40a50000, 0x000084c4, \
+   /* 17032 */ 0x40a50000, 0x000084c8, 0x40a50000, 0x000084cc, \
+   /* 17036 */ 0x40a50000, 0x000084d0, 0x40a50000, 0x000084d4, \
+   /* 17040 */ 0x40a50000, 0x000084d8, 0x40a50000, 0x000084dc, \
+   /* 17044 */ 0x40a50000, 0x000084e0, 0x40a50000, 0x000084e4, \
+   /* 17048 */ 0x40a50000, 0x000084e8, 0x40a50000, 0x000084ec, \
+  } \
+};
+
+/********************************************************
+ *
+ * Plain structure (layout as ntuple/root file):
+ */
+
+typedef struct EXT_STR_hsticky_t
+{
+  /* INFO */
+  uint32_t TRIGGER /* [0,15] */;
+  uint32_t EVENTNO /* [-1,-1] */;
+  uint32_t STIDX /* [-1,-1] */;
+  uint32_t TSTAMPLO /* [-1,-1] */;
+  uint32_t TSTAMPHI /* [-1,-1] */;
+  uint32_t TSTAMPSRCID /* [-1,-1] */;
+  uint32_t MERGE_STATUS /* [-1,-1] */;
+  uint32_t MERGE_IDMASK /* [-1,-1] */;
+  /* UNPACK */
+  uint32_t corr_base /* [-1,-1] */;
+  /* RAW */
+  uint32_t corrbase /* [-1,-1] */;
+  uint32_t zzp /* [0,5] */;
+  uint32_t zzpI[5 EXT_STRUCT_CTRL(zzp)] /* [1,5] */;
+  uint32_t zzpv[5 EXT_STRUCT_CTRL(zzp)] /* [-1,-1] */;
+
+} EXT_STR_hsticky;
+
+/********************************************************
+ *
+ * Structure with multiple levels of arrays (partially)
+ * recovered (recommended):
+ */
+
+typedef struct EXT_STR_hsticky_onion_t
+{
+  /* INFO */
+  uint32_t TRIGGER;
+  uint32_t EVENTNO;
+  uint32_t STIDX;
+  uint32_t TSTAMPLO;
+  uint32_t TSTAMPHI;
+  uint32_t TSTAMPSRCID;
+  uint32_t MERGE_STATUS;
+  uint32_t MERGE_IDMASK;
+  /* UNPACK */
+  uint32_t corr_base;
+  /* RAW */
+  uint32_t corrbase;
+  uint32_t zzp;
+  uint32_t zzpI[5 /* zzp */];
+  uint32_t zzpv[5 /* zzp */];
+
+} EXT_STR_hsticky_onion;
+
+/*******************************************************/
+
+#define EXT_STR_hsticky_ITEMS_INFO(ok,si,offset,struct_t,printerr) do { \
+  ok = 1; \
+  /* INFO */ \
+  EXT_STR_ITEM_INFO_LIM(ok,si,offset,struct_t,printerr,\
+                     TRIGGER,                         UINT32,\
+                    "TRIGGER",15); \
+  EXT_STR_ITEM_INFO    (ok,si,offset,struct_t,printerr,\
+                     EVENTNO,                         UINT32,\
+                    "EVENTNO"); \
+  EXT_STR_ITEM_INFO    (ok,si,offset,struct_t,printerr,\
+                     STIDX,                           UINT32,\
+                    "STIDX"); \
+  EXT_STR_ITEM_INFO    (ok,si,offset,struct_t,printerr,\
+                     TSTAMPLO,                        UINT32,\
+                    "TSTAMPLO"); \
+  EXT_STR_ITEM_INFO    (ok,si,offset,struct_t,printerr,\
+                     TSTAMPHI,                        UINT32,\
+                    "TSTAMPHI"); \
+  EXT_STR_ITEM_INFO    (ok,si,offset,struct_t,printerr,\
+                     TSTAMPSRCID,                     UINT32,\
+                    "TSTAMPSRCID"); \
+  EXT_STR_ITEM_INFO    (ok,si,offset,struct_t,printerr,\
+                     MERGE_STATUS,                    UINT32,\
+                    "MERGE_STATUS"); \
+  EXT_STR_ITEM_INFO    (ok,si,offset,struct_t,printerr,\
+                     MERGE_IDMASK,                    UINT32,\
+                    "MERGE_IDMASK"); \
+  /* UNPACK */ \
+  EXT_STR_ITEM_INFO    (ok,si,offset,struct_t,printerr,\
+                     corr_base,                       UINT32,\
+                    "corr_base"); \
+  /* RAW */ \
+  EXT_STR_ITEM_INFO    (ok,si,offset,struct_t,printerr,\
+                     corrbase,                        UINT32,\
+                    "corrbase"); \
+  EXT_STR_ITEM_INFO_LIM(ok,si,offset,struct_t,printerr,\
+                     zzp,                             UINT32,\
+                    "zzp",5); \
+  EXT_STR_ITEM_INFO_ZZP(ok,si,offset,struct_t,printerr,\
+                     zzpI,                            UINT32,\
+                    "zzpI",                            "zzp"); \
+  EXT_STR_ITEM_INFO_ZZP(ok,si,offset,struct_t,printerr,\
+                     zzpv,                            UINT32,\
+                    "zzpv",                            "zzp"); \
+  \
+} while (0);
+
+/********************************************************
+ *
+ * For internal use by the network data reader:
+ * (version checks, etc)
+ */
+
+typedef struct EXT_STR_hsticky_layout_t
+{
+  uint32_t _magic;
+  uint32_t _size_info;
+  uint32_t _size_struct;
+  uint32_t _size_struct_onion;
+  uint32_t _pack_list_items;
+
+  uint32_t _num_items;
+  struct {
+    uint32_t _offset;
+    uint32_t _size;
+    uint32_t _xor;
+    const char *_name;
+  } _items[1];
+  uint32_t _pack_list[44];
+} EXT_STR_hsticky_layout;
+
+#define EXT_STR_hsticky_LAYOUT_INIT { \
+  0x57e65c97, \
+  sizeof(EXT_STR_hsticky_layout), \
+  sizeof(EXT_STR_hsticky), \
+  sizeof(EXT_STR_hsticky_onion), \
+  44, \
+  1, \
+  { \
+    { 0, sizeof(EXT_STR_hsticky), 0xe3044bce, "hsticky" }, \
+  }, \
+  { \
+   /*    0 */ 0x40a52000, 0x00000000, 0x40a52000, 0x00000004, \
+   /*    4 */ 0x40a52000, 0x00000008, 0x40a52100, 0x0000000c, \
+   /*    8 */ 0x40a52200, 0x00000010, 0x40a52400, 0x00000014, \
+   /*   12 */ 0x40a53000, 0x00000018, 0x40a56000, 0x0000001c, \
+   /*   16 */ 0x40a50000, 0x00000020, 0x40a50000, 0x00000024, \
+   /*   20 */ 0xe0a50000, 0x00000028, 0x00000005, 0x00000002, \
+   /*   24 */ 0x48a50000, 0x0000002c, 0x40a50000, 0x00000040, \
+   /*   28 */ 0x48a50000, 0x00000030, 0x40a50000, 0x00000044, \
+   /*   32 */ 0x48a50000, 0x00000034, 0x40a50000, 0x00000048, \
+   /*   36 */ 0x48a50000, 0x00000038, 0x40a50000, 0x0000004c, \
+   /*   40 */ 0x48a50000, 0x0000003c, 0x40a50000, 0x00000050, \
+  } \
+};
+
+#endif/*__GUARD_ALL_EXT_TEST_EXT_XTST_REGRESS_H__*/
+
+/*******************************************************/
@@ -581,6 +581,10 @@ data_input_source::data_input_source()
 #ifdef USE_LMD_INPUT
 #include "lmd_input.hh"
 #include "lmd_input_tcp.hh"
+#ifdef USE_PTHREAD
+#include "lmd_input_tcp_multi.hh"
+#include "lmd_stream_shm.hh"
+#endif
 
 void data_input_source::connect(const char *name,int type
 #ifdef USE_PTHREAD
@@ -595,6 +599,56 @@ void data_input_source::connect(const char *name,int type
   assert(!_input._input); // want to get rid of the close below
   close();
 
+  // Options may follow the server name: HOST[:PORT][,reconnect[=SEC]]
+
+  char *host = strdup(name);
+  bool reconnect = false;
+  int reconnect_timeout = LMD_TCP_RECONNECT_TIMEOUT;
+
+  char *command = strchr(host,',');
+
+  if (command)
+    *(command++) = 0;
+
+  while (command && *command)
+    {
+      char *req_end = strchr(command,',');
+      char *next_cmd;
+
+      if (!req_end)
+	{
+	  req_end = command+strlen(command);
+	  next_cmd = req_end;
+	}
+      else
+	next_cmd = req_end + 1;
+
+      char *request = strndup(command,(size_t) (req_end-command));
+
+#define MATCH_C_PREFIX(prefix,post) (strncmp(request,prefix,strlen(prefix)) == 0 && *(post = request + strlen(prefix)) != '\0')
+#define MATCH_C_ARG(name) (strcmp(request,name) == 0)
+
+      const char *post;
+
+      if (MATCH_C_ARG("reconnect"))
+	reconnect = true;
+      else if (MATCH_C_PREFIX("reconnect=",post))
+	{
+	  reconnect = true;
+	  reconnect_timeout = atoi(post);
+	  if (reconnect_timeout <= 0)
+	    ERROR("Bad reconnect timeout: %s",post);
+	}
+      else
+	ERROR("Unrecognised option for network input: %s",request);
+
+#undef MATCH_C_ARG
+#undef MATCH_C_PREFIX
+
+      free(request);
+      command = next_cmd;
+    }
+
   // depending on the type of input, get ourselves the appropriate
   // input style
 
@@ -607,19 +661,34 @@ void data_input_source::connect(const char *name,int type
 
       break;
     case LMD_INPUT_TYPE_STREAM:
-      server = new lmd_input_tcp_stream();
+#ifdef USE_PTHREAD
+      if (_conf._stream_conns > 1)
+	server = new lmd_input_tcp_stream_multi(_conf._stream_conns);
+      else
+#endif
+	server = new lmd_input_tcp_stream();
 
       break;
     case LMD_INPUT_TYPE_TRANS:
       server = new lmd_input_tcp_transport();
 
       break;
+#ifdef USE_PTHREAD
+    case LMD_INPUT_TYPE_SHM:
+      server = new lmd_input_shm_stream();
+
+      break;
+#endif
     default:
       assert(false);
       return;
     }
 
-  size_t minsize = server->connect(name);
+  server->_rcvbuf = (int) _conf._tcp_rcvbuf;
+  server->_reconnect = reconnect;
+  server->_reconnect_timeout = reconnect_timeout;
+
+  size_t minsize = server->connect_retry(host);
 
   // ok, so we have some kind of connection.  (actually, this part may
   // have waited for some time to get initial info from the server.
@@ -650,7 +719,7 @@ void data_input_source::connect(const char *name,int type
   INFO(0,"Server data: %zd kiB chunks; prefetch buffer: %zd MiB.",
        minsize >> 10, prefetch_size >> 20);
 
-  tpb->init(server,prefetch_size
+  tpb->init(server,host,prefetch_size
 #ifdef USE_PTHREAD
 	   ,block_reader
 #endif
@@ -658,6 +727,8 @@ void data_input_source::connect(const char *name,int type
 
   tpb->set_filename(name);
 
+  free(host);
+
   _input._input = tpb;
   _input._cur   = 0;
 }
@@ -32,6 +32,7 @@
 #define USE_EBYE_INPUT_32
 
 #include "endian.hh"
+#include "byteswap_include.h"
 
 #include "lmd_event.hh"
 #include "ebye_event.hh"
@@ -87,6 +88,8 @@ void usage(char *cmdname)
   printf ("  --bad-stamp=N     Write bad stamps every so often.\n");
   printf ("  --caen-v775=N     Write CAEN V775 subevent.\n");
   printf ("  --caen-v1290=N    Write CAEN V1290 subevent.\n");
+  printf ("  --mesytec-mdpp16=N  Write Mesytec MDPP16 subevent.\n");
+  printf ("  --unaligned       MDPP16 modules not 32-bit aligned in every other event.\n");
   printf ("  --trloii-mtrig    Write TRLO II multi-trigger data.\n");
   printf ("  --max-multi=N     Max multi-events per event.\n");
   printf ("  --toggle          Toggle mode for module geom %% 3 == 1, 2.\n");
@@ -94,6 +97,7 @@ void usage(char *cmdname)
   printf ("  --crate=N         Mark all subevents with this crate number.\n");
   printf ("  --empty-buffers   No events.\n");
   printf ("  --rate=N          At most, output N events/s.\n");
+  printf ("  --swap            Write byte-swapped (32-bit) buffers (LMD only).\n");
 
   printf ("  --lmd             Write LMD format data.\n");
   printf ("  --ebye            Write EBYE format data.\n");
@@ -124,6 +128,8 @@ struct config
 
   int  _caen_v775;
   int  _caen_v1290;
+  int  _mesytec_mdpp16;
+  int  _unaligned;
 
   int  _trloii_mtrig;
   int  _max_multi;
@@ -140,6 +146,8 @@ struct config
 
   uint64 _max_rate;
 
+  int  _swap;
+
   uint _format;
 };
 
@@ -201,6 +209,12 @@ int main(int argc,char *argv[])
       else if (MATCH_PREFIX("--caen-v1290=",post)) {
 	_conf._caen_v1290 = atol(post);
       }
+      else if (MATCH_PREFIX("--mesytec-mdpp16=",post)) {
+	_conf._mesytec_mdpp16 = atol(post);
+      }
+      else if (MATCH_ARG("--unaligned")) {
+	_conf._unaligned = 1;
+      }
       else if (MATCH_ARG("--trloii-mtrig")) {
 	_conf._trloii_mtrig = 1;
       }
@@ -241,6 +255,9 @@ int main(int argc,char *argv[])
       else if (MATCH_ARG("--hld")) {
 	_conf._format = WRITE_FORMAT_HLD;
       }
+      else if (MATCH_ARG("--swap")) {
+	_conf._swap = 1;
+      }
       else {
 	fprintf (stderr,"Unrecognized or invalid option: %s\n",argv[i]);
 	exit(1);
@@ -255,6 +272,13 @@ int main(int argc,char *argv[])
       exit(1);
     }
 
+  if (_conf._unaligned && _conf._swap)
+    {
+      fprintf (stderr,
+	       "Cannot swap 32-bit words of unaligned data.\n");
+      exit(1);
+    }
+
   if (_conf._max_buffers == 0)
     _conf._max_buffers = (sint64) -1;
   if (_conf._max_events == 0)
@@ -475,6 +499,46 @@ char *create_wr_stamp(char *data_write,
   return (char *) data_write;
 }
 
+#define MDPP16_MAX_HITS  24
+
+// Unaligned when the subevent has an odd number of 16-bit words before.
+static char *put_uint32(char *data_write, uint32_t value)
+{
+  memcpy(data_write, &value, sizeof (value));
+  return data_write + sizeof (value);
+}
+
+char *create_mesytec_mdpp16_data(char *data_write, int geom,
+				 uint64_t *rstate)
+{
+  // Long runs of data words, such that also the bulk checking of
+  // 'several' items in the unpacker gets exercised.
+
+  uint32_t hits = (uint32_t) (rxs64s(rstate) % (MDPP16_MAX_HITS + 1));
+  uint32_t fill = (uint32_t) (rxs64s(rstate) & 1);
+
+  data_write = put_uint32(data_write,
+			  0x40000000 | (uint32_t) (geom << 16) |
+			  (hits + fill + 1));
+
+  for (uint32_t i = 0; i < hits; i++)
+    {
+      uint32_t r = (uint32_t) rxs64s(rstate);
+
+      data_write = put_uint32(data_write,
+			      0x10000000 | (r & 0x003fffff));
+    }
+
+  if (fill)
+    data_write = put_uint32(data_write, 0);
+
+  data_write = put_uint32(data_write,
+			  0xc0000000 |
+			  ((uint32_t) rxs64s(rstate) & 0x3fffffff));
+
+  return data_write;
+}
+
 void write_data_lmd()
 {
   uint64_t rstate_trig = 1;
@@ -489,6 +553,7 @@ void write_data_lmd()
   uint64_t rstate_sticky_base = 8;
   uint64_t rstate_sticky_corr = 9;
   uint64_t rstate_sticky_frac = 10;
+  uint64_t rstate_mdpp16 = 13;
 
   uint64_t wr_time = 0x00000003ffffc000ll; // 0000 0003 ffff c000
 
@@ -563,6 +628,12 @@ void write_data_lmd()
   // Add the subevent size to the event size
   min_event_total_size += min_subevent_total_size;
 
+  // Separate subevent, with alignment marker
+  if (_conf._mesytec_mdpp16)
+    min_event_total_size += sizeof(lmd_subevent_10_1_host) +
+      2 * sizeof(uint32_t) +
+      _conf._mesytec_mdpp16 * (3 + MDPP16_MAX_HITS) * sizeof(uint32_t);
+
   for (uint64 nb = 0, nev = 0; (nb < _conf._max_buffers &&
 				nev < _conf._max_events); nb++)
     {
@@ -1028,6 +1099,55 @@ void write_data_lmd()
 	      need_subevent_total_size = sizeof(lmd_subevent_10_1_host);
 	    }
 
+	  if (_conf._mesytec_mdpp16)
+	    {
+	      lmd_subevent_10_1_host *sev =
+		(lmd_subevent_10_1_host *) evp_end;
+
+	      sev->_header.i_type    = 0x0bd0;
+	      sev->_header.i_subtype = 0x0016;
+	      sev->h_control  = 0;
+	      sev->h_subcrate = _conf._crate;
+	      sev->i_procid   = 0;
+
+	      char *sevp_start = (char*) (sev + 1);
+	      char *sevp_write = sevp_start;
+
+	      // Every other event, the modules can be shifted by 16
+	      // bits.  The unpacker shall reject such data.  The random
+	      // state is used also when aligned, such that the module
+	      // data do not change.
+	      bool unaligned =
+		(rxs64s(&rstate_mdpp16) & 1) && _conf._unaligned;
+
+	      if (unaligned)
+		{
+		  uint16_t marker = 1;
+
+		  memcpy(sevp_write, &marker, sizeof (marker));
+		  sevp_write += sizeof (marker);
+		}
+	      else
+		sevp_write = put_uint32(sevp_write, 0);
+
+	      for (int geom = 1; geom <= _conf._mesytec_mdpp16 &&
+		     geom < 32; geom++)
+		sevp_write =
+		  create_mesytec_mdpp16_data(sevp_write, geom,
+					     &rstate_mdpp16);
+
+	      if (unaligned)
+		{
+		  memset(sevp_write, 0, sizeof (uint16_t)); // tail
+		  sevp_write += sizeof (uint16_t);
+		}
+
+	      sev->_header.l_dlen =
+		SUBEVENT_DLEN_FROM_DATA_LENGTH(sevp_write - sevp_start);
+
+	      evp_end = sevp_write;
+	    }
+
 	  ev->_header.l_dlen    =
 	    DLEN_FROM_EVENT_DATA_LENGTH(evp_end - (char *) &ev->_info);
 
@@ -1055,6 +1175,16 @@ void write_data_lmd()
       if (bufhe->l_dlen <= LMD_BUF_HEADER_MAX_IUSED_DLEN)
 	bufhe->i_used = bufhe->l_free[2];
 
+      // As if written on a machine of the other endianess.  (All our
+      // data are 32-bit words.)
+      if (_conf._swap)
+	{
+	  uint32_t *p = (uint32_t *) _buffer;
+
+	  for (uint i = 0; i < _conf._buffer_size / sizeof (uint32_t); i++)
+	    p[i] = bswap_32(p[i]);
+	}
+
       write_buffer();
 
       if (!timeslot_nev)
@@ -0,0 +1,191 @@
+/*********************************************************************
+ *
+ * This file is autogenerated by /root/repo/lu_common/make_acc_auto_def.sh
+ *
+ * Editing is useless.
+ *
+ *********************************************************************
+ *
+ * Input file:    /root/repo/acc_def/byteswap_include.h
+ * Basename:      BYTESWAP_INCLUDE
+ * Compiler:      g++
+ * Compiler args: -g -I. -I../common -O3 -DUCESB_SRC -I/root/repo/file_input -I/root/repo/file_input/lmd_struct -I/root/repo/eventloop -I/root/repo/acc_def -ansi -Wall -W -Wno-unused-function -Wno-unused-label -Wno-unused-parameter -Wwrite-strings -Werror -Wcast-qual
+ *
+ ********************************************************************/
+
+#ifndef __AUTO_DEF__BYTESWAP_INCLUDE_HH__
+#define __AUTO_DEF__BYTESWAP_INCLUDE_HH__
+
+/*
+ * Option: byteswap_h
+ * Option: endian_h
+ * Option: sys_endian_h
+ * Option: machine_endian_h
+ * Option: machine_endian_h
+ * Option: machine_endian_h
+ * Option: machine_bswap_h
+ * Option: sys_types_h
+ * Option: mybyteswap
+ */
+/*
+ * -DACC_DEF_BYTESWAP_INCLUDE_byteswap_h
+
+
+
+ * --> exit 0 (len 0)
+ */
+/*
+ * -DACC_DEF_BYTESWAP_INCLUDE_endian_h
+
+/root/repo/acc_def/byteswap_include.h:89:3: error: #error bswap_16 not defined
+   89 | # error bswap_16 not defined
+      |   ^~~~~
+/root/repo/acc_def/byteswap_include.h:92:3: error: #error bswap_32 not defined
+   92 | # error bswap_32 not defined
+      |   ^~~~~
+/root/repo/acc_def/byteswap_include.h: In function 'acc_test_func':
+/root/repo/acc_def/byteswap_include.h:96:10: error: implicit declaration of function 'bswap_16' [-Werror=implicit-function-declaration]
+   96 |   (void) bswap_16(1);
+      |          ^~~~~~~~
+/root/repo/acc_def/byteswap_include.h:97:10: error: implicit declaration of function 'bswap_32' [-Werror=implicit-function-declaration]
+   97 |   (void) bswap_32(1);
+      |          ^~~~~~~~
+cc1: all warnings being treated as errors
+
+ * --> exit 1 (len 757)
+ */
+/*
+ * -DACC_DEF_BYTESWAP_INCLUDE_sys_endian_h
+
+/root/repo/acc_def/byteswap_include.h:89:3: error: #error bswap_16 not defined
+   89 | # error bswap_16 not defined
+      |   ^~~~~
+/root/repo/acc_def/byteswap_include.h:92:3: error: #error bswap_32 not defined
+   92 | # error bswap_32 not defined
+      |   ^~~~~
+/root/repo/acc_def/byteswap_include.h: In function 'acc_test_func':
+/root/repo/acc_def/byteswap_include.h:96:10: error: implicit declaration of function 'bswap_16' [-Werror=implicit-function-declaration]
+   96 |   (void) bswap_16(1);
+      |          ^~~~~~~~
+/root/repo/acc_def/byteswap_include.h:97:10: error: implicit declaration of function 'bswap_32' [-Werror=implicit-function-declaration]
+   97 |   (void) bswap_32(1);
+      |          ^~~~~~~~
+cc1: all warnings being treated as errors
+
+ * --> exit 1 (len 757)
+ */
+/*
+ * -DACC_DEF_BYTESWAP_INCLUDE_machine_endian_h
+
+/root/repo/acc_def/byteswap_include.h:89:3: error: #error bswap_16 not defined
+   89 | # error bswap_16 not defined
+      |   ^~~~~
+/root/repo/acc_def/byteswap_include.h:92:3: error: #error bswap_32 not defined
+   92 | # error bswap_32 not defined
+      |   ^~~~~
+/root/repo/acc_def/byteswap_include.h: In function 'acc_test_func':
+/root/repo/acc_def/byteswap_include.h:96:10: error: implicit declaration of function 'bswap_16' [-Werror=implicit-function-declaration]
+   96 |   (void) bswap_16(1);
+      |          ^~~~~~~~
+/root/repo/acc_def/byteswap_include.h:97:10: error: implicit declaration of function 'bswap_32' [-Werror=implicit-function-declaration]
+   97 |   (void) bswap_32(1);
+      |          ^~~~~~~~
+cc1: all warnings being treated as errors
+
+ * --> exit 1 (len 757)
+ */
+/*
+ * -DACC_DEF_BYTESWAP_INCLUDE_machine_endian_h
+
+/root/repo/acc_def/byteswap_include.h:89:3: error: #error bswap_16 not defined
+   89 | # error bswap_16 not defined
+      |   ^~~~~
+/root/repo/acc_def/byteswap_include.h:92:3: error: #error bswap_32 not defined
+   92 | # error bswap_32 not defined
+      |   ^~~~~
+/root/repo/acc_def/byteswap_include.h: In function 'acc_test_func':
+/root/repo/acc_def/byteswap_include.h:96:10: error: implicit declaration of function 'bswap_16' [-Werror=implicit-function-declaration]
+   96 |   (void) bswap_16(1);
+      |          ^~~~~~~~
+/root/repo/acc_def/byteswap_include.h:97:10: error: implicit declaration of function 'bswap_32' [-Werror=implicit-function-declaration]
+   97 |   (void) bswap_32(1);
+      |          ^~~~~~~~
+cc1: all warnings being treated as errors
+
+ * --> exit 1 (len 757)
+ */
+/*
+ * -DACC_DEF_BYTESWAP_INCLUDE_machine_endian_h
+
+/root/repo/acc_def/byteswap_include.h:89:3: error: #error bswap_16 not defined
+   89 | # error bswap_16 not defined
+      |   ^~~~~
+/root/repo/acc_def/byteswap_include.h:92:3: error: #error bswap_32 not defined
+   92 | # error bswap_32 not defined
+      |   ^~~~~
+/root/repo/acc_def/byteswap_include.h: In function 'acc_test_func':
+/root/repo/acc_def/byteswap_include.h:96:10: error: implicit declaration of function 'bswap_16' [-Werror=implicit-function-declaration]
+   96 |   (void) bswap_16(1);
+      |          ^~~~~~~~
+/root/repo/acc_def/byteswap_include.h:97:10: error: implicit declaration of function 'bswap_32' [-Werror=implicit-function-declaration]
+   97 |   (void) bswap_32(1);
+      |          ^~~~~~~~
+cc1: all warnings being treated as errors
+
+ * --> exit 1 (len 757)
+ */
+/*
+ * -DACC_DEF_BYTESWAP_INCLUDE_machine_bswap_h
+
+/root/repo/acc_def/byteswap_include.h:89:3: error: #error bswap_16 not defined
+   89 | # error bswap_16 not defined
+      |   ^~~~~
+/root/repo/acc_def/byteswap_include.h:92:3: error: #error bswap_32 not defined
+   92 | # error bswap_32 not defined
+      |   ^~~~~
+/root/repo/acc_def/byteswap_include.h: In function 'acc_test_func':
+/root/repo/acc_def/byteswap_include.h:96:10: error: implicit declaration of function 'bswap_16' [-Werror=implicit-function-declaration]
+   96 |   (void) bswap_16(1);
+      |          ^~~~~~~~
+/root/repo/acc_def/byteswap_include.h:97:10: error: implicit declaration of function 'bswap_32' [-Werror=implicit-function-declaration]
+   97 |   (void) bswap_32(1);
+      |          ^~~~~~~~
+cc1: all warnings being treated as errors
+
+ * --> exit 1 (len 757)
+ */
+/*
+ * -DACC_DEF_BYTESWAP_INCLUDE_sys_types_h
+
+/root/repo/acc_def/byteswap_include.h:89:3: error: #error bswap_16 not defined
+   89 | # error bswap_16 not defined
+      |   ^~~~~
+/root/repo/acc_def/byteswap_include.h:92:3: error: #error bswap_32 not defined
+   92 | # error bswap_32 not defined
+      |   ^~~~~
+/root/repo/acc_def/byteswap_include.h: In function 'acc_test_func':
+/root/repo/acc_def/byteswap_include.h:96:10: error: implicit declaration of function 'bswap_16' [-Werror=implicit-function-declaration]
+   96 |   (void) bswap_16(1);
+      |          ^~~~~~~~
+/root/repo/acc_def/byteswap_include.h:97:10: error: implicit declaration of function 'bswap_32' [-Werror=implicit-function-declaration]
+   97 |   (void) bswap_32(1);
+      |          ^~~~~~~~
+cc1: all warnings being treated as errors
+
+ * --> exit 1 (len 757)
+ */
+/*
+ * -DACC_DEF_BYTESWAP_INCLUDE_mybyteswap
+
+
+
+ * --> exit 0 (len 0)
+ */
+
+/********************************************************************/
+
+#define ACC_DEF_BYTESWAP_INCLUDE_byteswap_h 1
+
+/********************************************************************/
+
+#endif/*__AUTO_DEF__BYTESWAP_INCLUDE_HH__*/
@@ -319,7 +319,7 @@ void hld_event::locate_subevents(hld_event_hint */*hints*/)
     _wt._defrag_buffer->allocate_reclaim(sizeof (hld_subevent) * MAX_SUBEVENTS);
 #else
   _subevents = (hld_subevent *)
-    _defrag_event.allocate(sizeof (hld_subevent) * MAX_SUBEVENTS);
+    _defrag_event_many.allocate(sizeof (hld_subevent) * MAX_SUBEVENTS);
 #endif
 
   _nsubevents = 0;
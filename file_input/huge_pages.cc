@@ -0,0 +1,249 @@
+/* This file is part of UCESB - a tool for data unpacking and processing.
+ *
+ * Copyright (C) 2016  GSI Helmholtzzentrum fuer Schwerionenforschung GmbH
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+ * MA  02110-1301  USA
+ */
+
+#include "huge_pages.hh"
+
+#include "error.hh"
+
+#include <string.h>
+#include <stdio.h>
+#include <errno.h>
+#include <sys/mman.h>
+#include <sys/time.h>
+#include <sys/resource.h>
+
+#ifdef USE_PTHREAD
+#include <pthread.h>
+#endif
+
+/* Large buffers that are accessed all over (the input ring buffers,
+ * the event structures of big setups) cause TLB misses and many page
+ * faults with 4 kB pages.
+ *
+ * With --huge-pages=thp, such buffers are mmap()ed aligned to (and
+ * rounded up to) the huge page size, and madvise(MADV_HUGEPAGE) tells
+ * the kernel to back them with transparent huge pages.  (Also with
+ * THP set to 'madvise' only.)  With --huge-pages=hugetlb, reserved
+ * huge pages (vm.nr_hugepages) are used with MAP_HUGETLB; if none can
+ * be had, we fall back to THP.
+ *
+ * Memory that is already allocated (the global event structures) can
+ * only be advised, which lets khugepaged collapse the aligned part.
+ */
+
+int  _huge_pages = HUGE_PAGES_OFF;
+bool _huge_pages_stat = false;
+
+// The allocations that are mmap()ed (few and large).  Buffers are
+// allocated and freed from several threads (e.g. the input readers),
+// so the list is protected.
+
+struct huge_pages_item
+{
+  void   *_ptr;
+  size_t  _size;
+
+  huge_pages_item *_next;
+};
+
+huge_pages_item *_huge_pages_items = NULL;
+
+#ifdef USE_PTHREAD
+static pthread_mutex_t _huge_pages_mutex = PTHREAD_MUTEX_INITIALIZER;
+#define HUGE_PAGES_LOCK   pthread_mutex_lock(&_huge_pages_mutex)
+#define HUGE_PAGES_UNLOCK pthread_mutex_unlock(&_huge_pages_mutex)
+#else
+#define HUGE_PAGES_LOCK   do { } while (0)
+#define HUGE_PAGES_UNLOCK do { } while (0)
+#endif
+
+void huge_pages_init(const char *opt)
+{
+  if (strcmp(opt,"off") == 0)
+    _huge_pages = HUGE_PAGES_OFF;
+  else if (strcmp(opt,"thp") == 0)
+    _huge_pages = HUGE_PAGES_THP;
+  else if (strcmp(opt,"hugetlb") == 0)
+    _huge_pages = HUGE_PAGES_HUGETLB;
+  else
+    ERROR("Bad huge pages mode: %s (use off, thp or hugetlb).",opt);
+
+  // Also with off, for comparison.
+  _huge_pages_stat = true;
+
+#ifndef MADV_HUGEPAGE
+  if (_huge_pages == HUGE_PAGES_THP)
+    WARNING("No transparent huge page support (MADV_HUGEPAGE) compiled in.");
+#endif
+#ifndef MAP_HUGETLB
+  if (_huge_pages == HUGE_PAGES_HUGETLB)
+    WARNING("No huge page support (MAP_HUGETLB) compiled in.");
+#endif
+}
+
+void huge_pages_advise(void *ptr,size_t size)
+{
+  if (_huge_pages == HUGE_PAGES_OFF)
+    return;
+
+#ifdef MADV_HUGEPAGE
+  uintptr_t start = ((uintptr_t) ptr + HUGE_PAGE_SIZE - 1) &
+    ~(uintptr_t) (HUGE_PAGE_SIZE - 1);
+  uintptr_t end = ((uintptr_t) ptr + size) &
+    ~(uintptr_t) (HUGE_PAGE_SIZE - 1);
+
+  if (end <= start)
+    return; // not even one huge page
+
+  // Failure (e.g. THP disabled) just leaves normal pages.
+  madvise((void *) start,end - start,MADV_HUGEPAGE);
+#else
+  (void) ptr;
+  (void) size;
+#endif
+}
+
+void *huge_pages_mmap(size_t size)
+{
+  void *ptr;
+
+#ifdef MAP_HUGETLB
+  // Input threads allocate too.  The fallback to THP is done under
+  // the lock, such that it happens (and is reported) once.  (Others
+  // only check for HUGE_PAGES_OFF, which does not change.)
+  HUGE_PAGES_LOCK;
+  if (_huge_pages == HUGE_PAGES_HUGETLB)
+    {
+      ptr = mmap(NULL,size,PROT_READ | PROT_WRITE,
+		 MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB,-1,0);
+
+      if (ptr != MAP_FAILED)
+	{
+	  HUGE_PAGES_UNLOCK;
+	  return ptr;
+	}
+
+      WARNING("Could not get %zd MB of (reserved) huge pages (%s), "
+	      "using transparent huge pages.",
+	      size >> 20,strerror(errno));
+      _huge_pages = HUGE_PAGES_THP;
+    }
+  HUGE_PAGES_UNLOCK;
+#endif
+
+  // Over-allocate, such that an aligned range can be cut out.
+
+  size_t map_size = size + HUGE_PAGE_SIZE;
+
+  char *map = (char *) mmap(NULL,map_size,PROT_READ | PROT_WRITE,
+			    MAP_PRIVATE | MAP_ANONYMOUS,-1,0);
+
+  if (map == MAP_FAILED)
+    return NULL;
+
+  char *start = (char *)
+    (((uintptr_t) map + HUGE_PAGE_SIZE - 1) &
+     ~(uintptr_t) (HUGE_PAGE_SIZE - 1));
+  size_t head = (size_t) (start - map);
+  size_t tail = map_size - head - size;
+
+  if (head)
+    munmap(map,head);
+  if (tail)
+    munmap(start + size,tail);
+
+  ptr = start;
+
+  huge_pages_advise(ptr,size);
+
+  return ptr;
+}
+
+void *huge_pages_alloc(size_t size)
+{
+  if (_huge_pages == HUGE_PAGES_OFF ||
+      size < HUGE_PAGE_SIZE)
+    return malloc(size);
+
+  size = (size + HUGE_PAGE_SIZE - 1) & ~(size_t) (HUGE_PAGE_SIZE - 1);
+
+  huge_pages_item *item =
+    (huge_pages_item *) malloc (sizeof (huge_pages_item));
+
+  if (!item)
+    return NULL;
+
+  item->_ptr = huge_pages_mmap(size);
+
+  if (!item->_ptr)
+    {
+      free(item);
+      return NULL;
+    }
+
+  item->_size = size;
+
+  HUGE_PAGES_LOCK;
+  item->_next = _huge_pages_items;
+  _huge_pages_items = item;
+  HUGE_PAGES_UNLOCK;
+
+  return item->_ptr;
+}
+
+void huge_pages_free(void *ptr)
+{
+  if (!ptr)
+    return;
+
+  huge_pages_item *item = NULL;
+
+  HUGE_PAGES_LOCK;
+  for (huge_pages_item **pitem = &_huge_pages_items; *pitem;
+       pitem = &(*pitem)->_next)
+    {
+      if ((*pitem)->_ptr == ptr)
+	{
+	  item = *pitem;
+	  *pitem = item->_next;
+	  break;
+	}
+    }
+  HUGE_PAGES_UNLOCK;
+
+  if (item)
+    {
+      munmap(item->_ptr,item->_size);
+      free(item);
+      return;
+    }
+
+  free(ptr);
+}
+
+uint64_t huge_pages_faults()
+{
+  struct rusage usage;
+
+  if (getrusage(RUSAGE_SELF,&usage) != 0)
+    return 0;
+
+  return (uint64_t) usage.ru_minflt + (uint64_t) usage.ru_majflt;
+}
@@ -0,0 +1,53 @@
+/* This file is part of UCESB - a tool for data unpacking and processing.
+ *
+ * Copyright (C) 2016  GSI Helmholtzzentrum fuer Schwerionenforschung GmbH
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+ * MA  02110-1301  USA
+ */
+
+#ifndef __HUGE_PAGES_HH__
+#define __HUGE_PAGES_HH__
+
+#include <stdlib.h>
+#include <stdint.h>
+
+// Backing of large buffers (input rings, event structures) with huge
+// pages (--huge-pages=thp|hugetlb).
+
+#define HUGE_PAGES_OFF      0
+#define HUGE_PAGES_THP      1  // transparent huge pages (madvise)
+#define HUGE_PAGES_HUGETLB  2  // reserved huge pages (MAP_HUGETLB)
+
+#define HUGE_PAGE_SIZE      0x00200000 // 2 MB
+
+extern int _huge_pages;
+extern bool _huge_pages_stat; // show page faults per GB of input
+
+void huge_pages_init(const char *opt);
+
+// Like malloc/free.  Large allocations are huge page backed (when
+// enabled).  Memory from huge_pages_alloc must be freed with
+// huge_pages_free (which also takes memory from malloc).
+void *huge_pages_alloc(size_t size);
+void  huge_pages_free(void *ptr);
+
+// Ask for huge pages for already allocated memory (the aligned part).
+void  huge_pages_advise(void *ptr,size_t size);
+
+// Page faults (minor and major) of the process so far.
+uint64_t huge_pages_faults();
+
+#endif/*__HUGE_PAGES_HH__*/
@@ -84,6 +84,9 @@ void zero_padding(s_filhe_extra_host &file_extra);
 #define LMD_DUMMY_BUFFER_MARK_SUBTYPE  0x28ae
 #define LMD_DUMMY_BUFFER_MARK_FREE_3   0x2faea5a9
 
+// Dummy buffer (l_free[1]) telling that the source was reconnected.
+#define LMD_DUMMY_BUFFER_MARK_RECONNECT  0x1c3f59e2
+
 ///////////////////////////////////////////////////////
 
 #endif// __LMD_EVENT_H__
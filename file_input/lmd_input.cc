@@ -87,12 +87,13 @@ FILE_INPUT_EVENT _file_event;
 
 lmd_source::lmd_source()
 {
+  _replay = false;
+
 #ifndef USE_THREADING
+  // The chunk list lives in the event arena, see get_event().
   size_t n = 4;
-  _file_event._chunks_ptr =
-    (buf_chunk *) malloc(n * sizeof (buf_chunk));
-  if (!_file_event._chunks_ptr)
-    ERROR("Memory allocation failure!");
+  _file_event._chunks_ptr = (buf_chunk *)
+    _file_event._defrag_event_many.allocate(n * sizeof (buf_chunk));
   _file_event._chunk_alloc = _file_event._chunks_ptr + n;
 #endif
 }
@@ -113,7 +114,11 @@ void lmd_source::new_file()
 
   _close_is_error = false;
 
+  _reconnect_gap = false;
+  _reconnect_in_fragment = false;
+
   _file_header_seen = false;
+  _replay_header_seen = false;
 }
 
 #define min(a,b) ((a)<(b)?(a):(b))
@@ -194,6 +199,18 @@ bool lmd_source::read_record(bool expect_fragment)
       // A dummy buffer (most likely internally produced in
       // lmd_input_tcp.cc).
 
+      if (_buffer_header.l_free[1] == LMD_DUMMY_BUFFER_MARK_RECONNECT)
+	{
+	  reconnected();
+
+	  // Whatever was expected from the old connection is gone.
+	  if (expect_fragment)
+	    {
+	      _reconnect_in_fragment = true;
+	      expect_fragment = false;
+	    }
+	}
+
       size_t buffer_size_dlen =
 	BUFFER_SIZE_FROM_DLEN((size_t) _buffer_header.l_dlen);
       size_t data_size = buffer_size_dlen - sizeof(_buffer_header);
@@ -758,8 +775,15 @@ lmd_event *lmd_source::get_event()
   dest->_chunks_ptr = (buf_chunk *) (dest + 1);
   dest->_chunk_alloc = dest->_chunks_ptr + n;
 #else
+  // As many chunks as the previous event ended up needing.
+  size_t n = (size_t) (_file_event._chunk_alloc - _file_event._chunks_ptr);
+
   _file_event.release();
   dest = &_file_event;
+
+  dest->_chunks_ptr = (buf_chunk *)
+    dest->_defrag_event_many.allocate(n * sizeof (buf_chunk));
+  dest->_chunk_alloc = dest->_chunks_ptr + n;
 #endif
   /*
   fprintf (stderr,"%16p %16p %16p %16p\n",
@@ -786,6 +810,10 @@ lmd_event *lmd_source::get_event()
 
   //printf ("** GETEVT: prev2 %zd\n",_prev_record_release_to2);
 
+  if (_replay)
+    return get_replay_event(dest);
+
+ get_next_event:
   for ( ; ; )
     {
       //printf ("get record?...\n");
@@ -898,6 +926,9 @@ lmd_event *lmd_source::get_event()
 	  //for (buf_chunk *p = dest->_chunks; p < dest->_chunk_end; p++)
 	  //  INFO(0,"got(1): chunk(%8p) (%8p,%d)",p,p->_ptr,p->_length);
 
+	  if (UNLIKELY(_reconnect_gap))
+	    report_reconnect_gap(dest);
+
 	  return dest;
 	}
 
@@ -951,11 +982,10 @@ lmd_event *lmd_source::get_event()
 							  dest->_chunks_ptr,
 							  dest->_chunk_end);
 #else
-	      _file_event._chunks_ptr =
-		(buf_chunk *) realloc(_file_event._chunks_ptr,
-				      n * sizeof (buf_chunk));
-	      if (!_file_event._chunks_ptr)
-		ERROR("Memory allocation failure!");
+	      dest->_chunks_ptr = (buf_chunk *)
+		dest->_defrag_event_many.allocate_copy(n * sizeof (buf_chunk),
+						       dest->_chunks_ptr,
+						       e * sizeof (buf_chunk));
 #endif
 	      dest->_chunk_alloc = dest->_chunks_ptr + n;
 	      dest->_chunk_end = dest->_chunks_ptr + e;
@@ -986,6 +1016,15 @@ lmd_event *lmd_source::get_event()
 		  "for fragmented event (missing %d).",
 		  (int) total_size);
 
+	  if (UNLIKELY(_reconnect_in_fragment))
+	    {
+	      // The rest of the event was lost with the old connection.
+	      _reconnect_in_fragment = false;
+	      WARNING("Fragmented event lost at reconnect.");
+	      dest->_status = 0;
+	      goto get_next_event;
+	    }
+
 	  if (_swapping != dest->_swapping)
 	    // bad boy (hot-swap event builder !?!)
 	    ERROR("Swapping changed within fragmented event.");
@@ -1043,6 +1082,9 @@ lmd_event *lmd_source::get_event()
       //for (buf_chunk *p = dest->_chunks; p < dest->_chunk_end; p++)
       //	INFO(0,"got(m): chunk(%8p) (%8p,%d)",p,p->_ptr,p->_length);
 
+      if (UNLIKELY(_reconnect_gap))
+	report_reconnect_gap(dest);
+
       return dest;
     }
 
@@ -1050,6 +1092,54 @@ lmd_event *lmd_source::get_event()
 }
 
 
+void lmd_source::reconnected()
+{
+  // The server may have been restarted, so buffer (and event)
+  // numbers start over.
+
+  // Several reconnects before any data: report from the last data.
+  if (!_reconnect_gap)
+    {
+      _reconnect_last_buffer_no = _last_buffer_no;
+#if !USE_THREADING
+      _reconnect_last_event_no = _file_event._header._info.l_count;
+#else
+      _reconnect_last_event_no = 0;
+#endif
+    }
+  _reconnect_gap = true;
+
+  _last_buffer_no = 0;
+}
+
+void lmd_source::report_reconnect_gap(const lmd_event *dest)
+{
+  _reconnect_gap = false;
+
+  // The event counter is only known from the 10/1 info, which is
+  // located at the beginning of the event data.
+
+  lmd_event_info_host info;
+
+  if (dest->_header._header.i_type    == LMD_EVENT_10_1_TYPE &&
+      dest->_header._header.i_subtype == LMD_EVENT_10_1_SUBTYPE &&
+      dest->_chunk_end > dest->_chunks_ptr &&
+      dest->_chunks_ptr[0]._length >= sizeof (info))
+    {
+      memcpy(&info,dest->_chunks_ptr[0]._ptr,sizeof (info));
+
+      if (dest->_swapping)
+	byteswap ((uint32*) &info,sizeof(info));
+
+      WARNING("Gap at reconnect: buffer %u -> %u, event %u -> %u.",
+	      _reconnect_last_buffer_no,_buffer_header.l_buf,
+	      _reconnect_last_event_no,info.l_count);
+    }
+  else
+    WARNING("Gap at reconnect: buffer %u -> %u.",
+	    _reconnect_last_buffer_no,_buffer_header.l_buf);
+}
+
 void lmd_source::print_buffer_header(const s_bufhe_host *header)
 {
   char time_buf[64];
@@ -1397,12 +1487,11 @@ void lmd_event::locate_subevents(lmd_event_hint *hints)
     _wt._defrag_buffer->
     allocate_reclaim(hints->_max_subevents * sizeof (lmd_subevent));
 #else
-  // With the single buffer always kept for this purpose, no reason
-  // to try to adjust.
+  // The arena is kept between events, no reason to try to adjust.
 
   _subevents = (lmd_subevent *)
-    _defrag_event.allocate((size_t) hints->_max_subevents *
-			   sizeof (lmd_subevent));
+    _defrag_event_many.allocate((size_t) hints->_max_subevents *
+				sizeof (lmd_subevent));
 #endif
 
   _nsubevents = 0;
@@ -1441,10 +1530,12 @@ void lmd_event::locate_subevents(lmd_event_hint *hints)
 				  _subevents,
 				  _nsubevents * sizeof (lmd_subevent));
 #else
-	  // despite the name, actually does reallocation
 	  _subevents = (lmd_subevent *)
-	    _defrag_event.allocate((size_t) hints->_max_subevents *
-				   sizeof (lmd_subevent));
+	    _defrag_event_many.
+	    allocate_copy((size_t) hints->_max_subevents *
+			  sizeof (lmd_subevent),
+			  _subevents,
+			  (size_t) _nsubevents * sizeof (lmd_subevent));
 #endif
 	}
 
@@ -36,6 +36,8 @@
 #define LMD_INPUT_TYPE_STREAM  (INPUT_TYPE_LAST+1)
 #define LMD_INPUT_TYPE_TRANS   (INPUT_TYPE_LAST+2)
 #define LMD_INPUT_TYPE_EVENT   (INPUT_TYPE_LAST+3)
+#define LMD_INPUT_TYPE_REPLAY  (INPUT_TYPE_LAST+4)
+#define LMD_INPUT_TYPE_SHM     (INPUT_TYPE_LAST+5)
 
 // After we have gotten all the records needed for an event (none yet
 // released), but before we have investigated the subevent headers, we
@@ -179,6 +181,16 @@ public:
   bool               _buffers_maybe_missing;
   bool               _close_is_error;
 
+  // Reading a replay file (see lmd_replay.hh).
+  bool               _replay;
+  bool               _replay_header_seen;
+
+  // Network source was reconnected (gap to be reported).
+  bool               _reconnect_gap;
+  bool               _reconnect_in_fragment;
+  uint32_t           _reconnect_last_buffer_no;
+  uint32_t           _reconnect_last_event_no;
+
   s_filhe_extra_host _file_header;
   bool               _file_header_seen;
 
@@ -194,6 +206,11 @@ public:
 
   lmd_event *get_event(/*pax_event *dest*/);
 
+protected:
+  lmd_event *get_replay_event(lmd_event *dest);
+
+public:
+
 #if USE_MERGING
   lmd_event _file_event;
 #endif
@@ -206,6 +223,10 @@ public:
   bool read_record(bool expect_fragment = false);
   bool skip_record();
 
+protected:
+  void reconnected();
+  void report_reconnect_gap(const lmd_event *dest);
+
 };
 
 #endif//USE_LMD_INPUT
@@ -304,6 +304,16 @@
 lmd_input_tcp::lmd_input_tcp()
 {
   _fd = -1;
+  _rcvbuf = 0;
+  _conn_no = -1;
+  _reconnect = false;
+  _reconnect_timeout = LMD_TCP_RECONNECT_TIMEOUT;
+
+  _stat_bytes = 0;
+  _stat_connected = 0;
+  _stat_wait = 0;
+  _stat_requests = 0;
+  _stat_latency = 0;
 }
 
 lmd_input_tcp::~lmd_input_tcp()
@@ -376,6 +386,9 @@ bool lmd_input_tcp::open_connection(const struct sockaddr_in *p_serv_addr,
   serv_addr = *p_serv_addr;
   serv_addr.sin_port = htons(port);
 
+  // In case a previous attempt left a socket.
+  close_connection();
+
   /* socket creation */
   _fd = socket(PF_INET,SOCK_STREAM,IPPROTO_TCP);
   if (_fd < 0) {
@@ -395,6 +408,27 @@ bool lmd_input_tcp::open_connection(const struct sockaddr_in *p_serv_addr,
       exit(1);
     }
 
+  // A larger receive buffer lets the TCP window grow such that a
+  // fast link can be filled.  Must be set before connecting.
+
+  if (_rcvbuf)
+    {
+      int rcvbuf = _rcvbuf;
+      socklen_t rcvbuf_len = sizeof(rcvbuf);
+
+      if (setsockopt(_fd,SOL_SOCKET,SO_RCVBUF,
+		     &rcvbuf,sizeof(rcvbuf)) != 0)
+	perror("setsockopt()");
+
+      // Linux reports twice the (possibly limited) value set.
+      if (getsockopt(_fd,SOL_SOCKET,SO_RCVBUF,
+		     &rcvbuf,&rcvbuf_len) == 0 &&
+	  rcvbuf < _rcvbuf)
+	WARNING("Socket receive buffer limited to %d bytes "
+		"(requested %d, see net.core.rmem_max).",
+		rcvbuf,_rcvbuf);
+    }
+
   INFO(0,"Connecting port: %d",port);
 
   rc = ::connect(_fd, (struct sockaddr *) &serv_addr, sizeof(serv_addr));
@@ -478,10 +512,66 @@ bool lmd_input_tcp::open_connection(const struct sockaddr_in *p_serv_addr,
     return false;
   }
  connect_success:;
+  _stat_connected = lmd_input_tcp_time();
   return true;
 }
 
 
+void lmd_input_tcp::disconnect()
+{
+  if (_fd != -1)
+    print_stats();
+
+  close_connection();
+}
+
+extern int _got_sigint;
+
+size_t lmd_input_tcp::connect_retry(const char *server)
+{
+  int wait = 1;
+  double t_start = lmd_input_tcp_time();
+
+  for ( ; ; )
+    {
+      try
+	{
+	  return connect(server);
+	}
+      catch (error &e)
+	{
+	  if (!_reconnect)
+	    throw;
+	}
+
+      disconnect();
+
+      double elapsed = lmd_input_tcp_time() - t_start;
+
+      if (elapsed + wait > _reconnect_timeout)
+	ERROR("Connection to %s failed, giving up after %.0f s.",
+	      server, elapsed);
+
+      WARNING("Connection to %s failed, retrying in %d s...",server,wait);
+
+      // Sleep in small steps, such that a termination request (SIGINT)
+      // is not stuck behind a long wait.  (sleep() also returns early
+      // on other signals, e.g. the progress alarm.)
+      double t_wake = lmd_input_tcp_time() + wait;
+
+      while (lmd_input_tcp_time() < t_wake)
+	{
+	  if (_got_sigint)
+	    ERROR("Termination requested, no further connection attempts.");
+	  sleep(1);
+	}
+
+      wait *= 2;
+      if (wait > LMD_TCP_RECONNECT_MAX_WAIT)
+	wait = LMD_TCP_RECONNECT_MAX_WAIT;
+    }
+}
+
 void lmd_input_tcp::close_connection()
 {
   if (_fd >= 0)
@@ -490,6 +580,11 @@ void lmd_input_tcp::close_connection()
 	ERROR("Failure closing connection.");
       _fd = -1;
     }
+
+  _stat_bytes = 0;
+  _stat_wait = 0;
+  _stat_requests = 0;
+  _stat_latency = 0;
 }
 
 
@@ -499,79 +594,97 @@ void lmd_input_tcp::do_read(void *buf,size_t count,int timeout)
   // If we are running threaded, then we'll wait indefinately for some
   // input... ?!?
 
+  // First try to read directly.  Only when no data is available do
+  // we wait (select).  With data streaming in, most reads then need
+  // no extra system call.
+
+  bool wait = false;
+
   while (count)
     {
-      // We must make sure that reading does not block...
+      if (wait)
+	{
+	  // We must make sure that reading does not block...
 
-      fd_set rfds;
-      FD_ZERO(&rfds);
+	  fd_set rfds;
+	  FD_ZERO(&rfds);
 
-      int nfds = 0;
+	  int nfds = 0;
 
-      if (_fd != -1)
-	{
-	  FD_SET(_fd,&rfds);
-	  nfds = max(nfds,_fd);
-	}
+	  if (_fd != -1)
+	    {
+	      FD_SET(_fd,&rfds);
+	      nfds = max(nfds,_fd);
+	    }
 
-      struct timeval timewait;
+	  struct timeval timewait;
 
-      timewait.tv_sec  = timeout;
-      timewait.tv_usec = 0;
+	  timewait.tv_sec  = timeout;
+	  timewait.tv_usec = 0;
 
-      int n = select(nfds+1,&rfds,NULL,NULL,timeout >= 0 ? &timewait : NULL);
+	  double t_wait = lmd_input_tcp_time();
 
-      if (n == -1)
-	{
-	  if (errno == EINTR)
+	  int n = select(nfds+1,&rfds,NULL,NULL,
+			 timeout >= 0 ? &timewait : NULL);
+
+	  _stat_wait += lmd_input_tcp_time() - t_wait;
+
+	  if (n == -1)
 	    {
-	      // Since we may not rely on the file descriptors, or the
-	      // timeout, act as if we were waked up, but do not read
-	      // the pipe.  We'll quickly got to sleep again.
-	      continue;
+	      if (errno == EINTR)
+		{
+		  // Since we may not rely on the file descriptors, or the
+		  // timeout, act as if we were waked up, but do not read
+		  // the pipe.  We'll quickly got to sleep again.
+		  continue;
+		}
+	      perror("select()");
+	      // This error is fatal, since it should not happen
+	      exit(1);
 	    }
-	  perror("select()");
-	  // This error is fatal, since it should not happen
-	  exit(1);
+
+	  if (n == 0)
+	    {
+	      ERROR("timeout during read");
+	    }
+
+	  if (!(_fd != -1 &&
+		FD_ISSET(_fd,&rfds)))
+	    continue;
 	}
 
+      // We can read
+
+      ssize_t n = read(_fd,buf,count);
+
       if (n == 0)
 	{
-	  ERROR("timeout during read");
+	  // Someone closed the writing end
+	  ERROR("Socket closed on other end.");
 	}
 
-      if (_fd != -1 &&
-	  FD_ISSET(_fd,&rfds))
+      if (n == -1)
 	{
-	  // We can read
-
-	  ssize_t n = read(_fd,buf,count);
-
-	  if (n == 0)
+	  // EAGAIN can happen if select fooled us (linux 'bug')
+	  if (errno == EINTR || errno == EAGAIN)
 	    {
-	      // Someone closed the writing end
-	      ERROR("Socket closed on other end.");
-	    }
-
-	  if (n == -1)
-	    {
-	      // EAGAIN can happen if select fooled us (linux 'bug')
-	      if (errno == EINTR || errno == EAGAIN)
-		n = 0;
-	      else
-		{
-		  perror("read()");
-		  exit(1);
-		}
+	      wait = (errno == EAGAIN);
+	      continue;
 	    }
+	  // The other end went away (e.g. server restart).
+	  if (errno == ECONNRESET || errno == ETIMEDOUT)
+	    ERROR("Connection lost: %s.",strerror(errno));
+	  perror("read()");
+	  exit(1);
+	}
 
-	  buf = ((char *) buf) + n;
-	  count -= (size_t) n;
+      buf = ((char *) buf) + n;
+      count -= (size_t) n;
 
-	  if (timeout >= 0)
-	    timeout = 100;
-	}
+      _stat_bytes += (uint64) n;
 
+      if (timeout >= 0)
+	timeout = 100;
     }
 }
 
@@ -641,6 +754,8 @@ void lmd_input_tcp::do_write(void *buf,size_t count,int timeout)
 	      // EAGAIN can happen if select fooled us (linux 'bug')
 	      if (errno == EINTR || errno == EAGAIN)
 		n = 0;
+	      else if (errno == EPIPE || errno == ECONNRESET)
+		ERROR("Connection lost: %s.",strerror(errno));
 	      else
 		{
 		  perror("read()");
@@ -694,6 +809,49 @@ void lmd_input_tcp::create_dummy_buffer(void *buf,size_t count,
   // printf ("dummy...\n");
 }
 
+void lmd_input_tcp::create_reconnect_buffer(void *buf)
+{
+  create_dummy_buffer(buf,sizeof (s_bufhe_host),0,true);
+
+  s_bufhe_host *bufhe = (s_bufhe_host *) buf;
+
+  bufhe->l_free[1] = LMD_DUMMY_BUFFER_MARK_RECONNECT;
+}
+
+double lmd_input_tcp_time()
+{
+  struct timeval t;
+
+  gettimeofday(&t,NULL);
+
+  return (double) t.tv_sec + 1.e-6 * (double) t.tv_usec;
+}
+
+void lmd_input_tcp::print_stats()
+{
+  if (!_stat_bytes)
+    return;
+
+  double elapsed = lmd_input_tcp_time() - _stat_connected;
+
+  char conn[32] = "";
+  char latency[64] = "";
+
+  if (_conn_no >= 0)
+    snprintf(conn,sizeof (conn)," %d",_conn_no);
+
+  if (_stat_requests)
+    snprintf(latency,sizeof (latency),", %.1f ms mean request latency",
+	     1.e3 * _stat_latency / (double) _stat_requests);
+
+  INFO(0,"Connection%s: %.1f MB in %.1f s (%.1f MB/s), "
+       "%.1f s waiting for data%s.",
+       conn,
+       (double) _stat_bytes * 1.e-6, elapsed,
+       elapsed > 0 ? (double) _stat_bytes * 1.e-6 / elapsed : 0.,
+       _stat_wait, latency);
+}
+
 
 
 
@@ -984,6 +1142,8 @@ size_t lmd_input_tcp_transport::connect(const char *server)
 
 void lmd_input_tcp_transport::close()
 {
+  print_stats();
+
   lmd_input_tcp_buffer::close_connection();
 }
 
@@ -1033,6 +1193,8 @@ lmd_input_tcp_stream::lmd_input_tcp_stream()
 
 size_t lmd_input_tcp_stream::connect(const char *server)
 {
+  _buffers_to_read = 0;
+
   return do_map_connect(server, -1, LMD_TCP_PORT_STREAM);
 }
 
@@ -1049,6 +1211,8 @@ void lmd_input_tcp_stream::close()
 
   // And close!
 
+  print_stats();
+
   lmd_input_tcp_buffer::close_connection();
 }
 
@@ -1061,6 +1225,8 @@ size_t lmd_input_tcp_stream::preferred_min_buffer_size()
 
 size_t lmd_input_tcp_stream::get_buffer(void *buf,size_t count)
 {
+  double t_request = 0;
+
   for ( ; ; )
     {
       // Every n'th buffer, before starting to read the buffer, we must
@@ -1076,6 +1242,9 @@ size_t lmd_input_tcp_stream::get_buffer(void *buf,size_t count)
 	  do_write(request,sizeof (request));
 
 	  _buffers_to_read += _info.bufs_per_stream;
+
+	  _stat_requests++;
+	  t_request = lmd_input_tcp_time();
 	}
 
       // We ought to read all the buffers of a stream at once, when we
@@ -1089,6 +1258,12 @@ size_t lmd_input_tcp_stream::get_buffer(void *buf,size_t count)
 
 	  size_t n = lmd_input_tcp_buffer::read_buffer(buf,count,&nbufs);
 
+	  if (t_request)
+	    {
+	      _stat_latency += lmd_input_tcp_time() - t_request;
+	      t_request = 0;
+	    }
+
 	  if (nbufs == -1)
 	    {
 	      WARNING("Got disconnect buffer from stream transport.");
@@ -1322,6 +1497,8 @@ size_t lmd_input_tcp_event::connect(const char *server)
 
 void lmd_input_tcp_event::close()
 {
+  print_stats();
+
   /*
   lmd_input_tcp_buffer::close_connection();
   */
@@ -33,6 +33,9 @@
 
 #define LMD_TCP_PORT_TRANS_MAP_ADD  1234
 
+#define LMD_TCP_RECONNECT_MAX_WAIT  30 // s
+#define LMD_TCP_RECONNECT_TIMEOUT  600 // s, default, give up after
+
 #define LMD_TCP_INFO_BUFSIZE_NODATA     -1
 #define LMD_TCP_INFO_BUFSIZE_MAXCLIENTS -2
 
@@ -182,6 +185,20 @@ public:
 public:
   int _fd;
 
+  int _rcvbuf;  // SO_RCVBUF to request, 0 for system default
+  int _conn_no; // for messages, -1 if only connection
+
+  bool _reconnect; // retry connecting (instead of failing)
+  int  _reconnect_timeout; // s, give up retrying after
+
+public:
+  // Statistics of the connection.
+  uint64 _stat_bytes;
+  double _stat_connected;  // time of connect
+  double _stat_wait;       // time spent waiting for data
+  uint64 _stat_requests;   // data requests (stream server)
+  double _stat_latency;    // total time from request to data
+
 protected:
   bool parse_connection(const char *server,
 			struct sockaddr_in *p_serv_addr,
@@ -198,6 +215,11 @@ public:
   virtual size_t connect(const char *server) = 0;
   virtual void close() = 0;
 
+  // Drop the connection without further protocol.
+  virtual void disconnect();
+
+  size_t connect_retry(const char *server);
+
   virtual size_t get_buffer(void *buf,size_t count) = 0;
 
   virtual size_t preferred_min_buffer_size() = 0;
@@ -205,8 +227,14 @@ public:
 public:
   void create_dummy_buffer(void *buf, size_t count,
 			   int buffer_no, bool mark_dummy);
+
+  void create_reconnect_buffer(void *buf);
+
+  void print_stats();
 };
 
+double lmd_input_tcp_time();
+
 
 class lmd_input_tcp_buffer :
   public lmd_input_tcp
@@ -0,0 +1,445 @@
+/* This file is part of UCESB - a tool for data unpacking and processing.
+ *
+ * Copyright (C) 2016  GSI Helmholtzzentrum fuer Schwerionenforschung GmbH
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+ * MA  02110-1301  USA
+ */
+
+#include "lmd_input_tcp_multi.hh"
+#include "lmd_event.hh"
+
+#include "error.hh"
+#include "set_thread_name.hh"
+
+#include <signal.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <assert.h>
+#include <math.h>
+
+lmd_input_tcp_stream_multi::lmd_input_tcp_stream_multi(int num_conns)
+{
+  _num_conns = num_conns;
+  _stream_size = 0;
+
+  _conns = (lmd_input_tcp_multi_conn *)
+    malloc (_num_conns * sizeof (_conns[0]));
+
+  if (!_conns)
+    ERROR("Memory allocation failure!");
+
+  memset(_conns,0,_num_conns * sizeof (_conns[0]));
+
+  _cur = NULL;
+
+  _have_next = false;
+  _next_buf_no = 0;
+
+  _out_of_order = 0;
+
+  _shutdown = false;
+
+  pthread_mutex_init(&_mutex,NULL);
+  pthread_cond_init(&_cond,NULL);
+}
+
+lmd_input_tcp_stream_multi::~lmd_input_tcp_stream_multi()
+{
+  close();
+
+  free(_conns);
+
+  pthread_cond_destroy(&_cond);
+  pthread_mutex_destroy(&_mutex);
+}
+
+size_t lmd_input_tcp_stream_multi::connect(const char *server)
+{
+  for (int i = 0; i < _num_conns; i++)
+    {
+      lmd_input_tcp_multi_conn *conn = &_conns[i];
+
+      conn->_multi = this;
+      conn->_stream = new lmd_input_tcp_stream();
+      conn->_stream->_rcvbuf = _rcvbuf;
+      conn->_stream->_conn_no = i;
+
+      size_t size = conn->_stream->connect(server);
+
+      if (!i)
+	_stream_size = size;
+      else if (size != _stream_size)
+	ERROR("Stream size differs between connections (%zd != %zd).",
+	      size, _stream_size);
+
+      for (int j = 0; j < LMD_INPUT_TCP_MULTI_SLOTS; j++)
+	if (!(conn->_slots[j]._data = (char *) malloc (_stream_size)))
+	  ERROR("Memory allocation failure!");
+    }
+
+  for (int i = 0; i < _num_conns; i++)
+    {
+      lmd_input_tcp_multi_conn *conn = &_conns[i];
+
+      if (pthread_create(&conn->_thread,NULL,
+			 lmd_input_tcp_stream_multi::reader_thread,conn) != 0)
+	{
+	  perror("pthread_create()");
+	  exit(1);
+	}
+      conn->_active = true;
+
+      set_thread_name(conn->_thread, "STRMCONN", 8);
+    }
+
+  INFO(0,"Receiving streams over %d connections.", _num_conns);
+
+  return _stream_size;
+}
+
+void lmd_input_tcp_stream_multi::close()
+{
+  // The reader threads are not cancelled, as they may be in the
+  // middle of a read or write, or hold the mutex.  They are told to
+  // end, and blocking reads are woken up by shutting down the
+  // receiving side of the sockets.  (The sending side is still
+  // needed to tell the server that we are done.)
+
+  pthread_mutex_lock(&_mutex);
+  _shutdown = true;
+  pthread_cond_broadcast(&_cond);
+  pthread_mutex_unlock(&_mutex);
+
+  for (int i = 0; i < _num_conns; i++)
+    {
+      lmd_input_tcp_multi_conn *conn = &_conns[i];
+
+      if (conn->_active &&
+	  conn->_stream && conn->_stream->_fd != -1)
+	shutdown(conn->_stream->_fd,SHUT_RD);
+    }
+
+  for (int i = 0; i < _num_conns; i++)
+    {
+      lmd_input_tcp_multi_conn *conn = &_conns[i];
+
+      if (conn->_active)
+	{
+	  if (pthread_join(conn->_thread,NULL) != 0)
+	    {
+	      perror("pthread_join()");
+	      exit(1);
+	    }
+	  conn->_active = false;
+	}
+    }
+
+  for (int i = 0; i < _num_conns; i++)
+    {
+      lmd_input_tcp_multi_conn *conn = &_conns[i];
+
+      if (conn->_stream)
+	{
+	  // Only tell servers that are still there that we are done.
+	  if (!conn->_ended && conn->_stream->_fd != -1)
+	    {
+	      try {
+		conn->_stream->close();
+	      } catch (error &e) {
+	      }
+	    }
+	  conn->_stream->disconnect();
+
+	  delete conn->_stream;
+	}
+
+      for (int j = 0; j < LMD_INPUT_TCP_MULTI_SLOTS; j++)
+	free(conn->_slots[j]._data);
+
+      // Such that we can be connected again.
+      memset(conn,0,sizeof (*conn));
+    }
+
+  _cur = NULL;
+  _have_next = false;
+  _shutdown = false;
+
+  if (_out_of_order)
+    INFO(0,"%llu streams delivered without their predecessor "
+	 "(dropped by server?).",
+	 (unsigned long long) _out_of_order);
+  _out_of_order = 0;
+}
+
+void lmd_input_tcp_stream_multi::disconnect()
+{
+  close();
+}
+
+size_t lmd_input_tcp_stream_multi::preferred_min_buffer_size()
+{
+  return _stream_size;
+}
+
+static size_t litm_buffer_size(const char *data,uint32 *buf_no)
+{
+  s_bufhe_host header;
+
+  memcpy(&header,data,sizeof (header));
+
+  // Marker already checked by lmd_input_tcp_buffer::read_buffer.
+  if (header.l_free[0] == 0x01000000)
+    byteswap_32(header);
+
+  *buf_no = (uint32) header.l_buf;
+
+  return BUFFER_SIZE_FROM_DLEN((size_t) header.l_dlen);
+}
+
+static void litm_unlock_mutex(void *mutex)
+{
+  pthread_mutex_unlock((pthread_mutex_t *) mutex);
+}
+
+void *lmd_input_tcp_stream_multi::reader_thread(void *us)
+{
+  lmd_input_tcp_multi_conn *conn = (lmd_input_tcp_multi_conn *) us;
+
+  return conn->_multi->reader(conn);
+}
+
+void *lmd_input_tcp_stream_multi::reader(lmd_input_tcp_multi_conn *conn)
+{
+  sigset_t sigmask;
+
+  sigemptyset(&sigmask);
+  sigaddset(&sigmask,SIGINT);
+
+  pthread_sigmask(SIG_BLOCK,&sigmask,NULL);
+
+  for ( ; ; )
+    {
+      lmd_input_tcp_multi_slot *slot =
+	&conn->_slots[conn->_fill % LMD_INPUT_TCP_MULTI_SLOTS];
+
+      pthread_mutex_lock(&_mutex);
+      while (slot->_state != LITM_SLOT_FREE && !_shutdown)
+	pthread_cond_wait(&_cond,&_mutex);
+      bool stop = _shutdown;
+      pthread_mutex_unlock(&_mutex);
+
+      if (stop)
+	break;
+
+      size_t n;
+      bool failed = false;
+
+      try
+	{
+	  n = conn->_stream->get_buffer(slot->_data,_stream_size);
+	}
+      catch (error &e)
+	{
+	  failed = true;
+	  n = 0;
+	}
+
+      // Find the buffer numbers of the stream.
+
+      size_t offset = 0;
+
+      while (offset < n)
+	{
+	  uint32 buf_no;
+
+	  size_t size = litm_buffer_size(slot->_data + offset,&buf_no);
+
+	  if (!size || size > n - offset)
+	    {
+	      // Would loop forever (or beyond the data).
+	      WARNING("Connection %d: bad buffer size (%zd) in stream, "
+		      "closing...",
+		      (int) (conn - _conns),size);
+	      n = 0;
+	      break;
+	    }
+
+	  if (!offset)
+	    slot->_buf_no = buf_no;
+	  slot->_last_buf_no = buf_no;
+
+	  offset += size;
+	}
+
+      pthread_mutex_lock(&_mutex);
+
+      if (_shutdown)
+	{
+	  // Not ended by the server, it is told by close().
+	  pthread_mutex_unlock(&_mutex);
+	  break;
+	}
+
+      if (n)
+	{
+	  slot->_size = n;
+	  slot->_offset = 0;
+	  slot->_received = lmd_input_tcp_time();
+	  slot->_state = LITM_SLOT_READY;
+	  conn->_fill++;
+	}
+      else
+	conn->_ended = true;
+
+      pthread_cond_broadcast(&_cond);
+      pthread_mutex_unlock(&_mutex);
+
+      if (failed)
+	WARNING("Closing connection %d...",
+		(int) (conn - _conns));
+
+      if (!n)
+	break;
+    }
+
+  return NULL;
+}
+
+lmd_input_tcp_multi_conn *lmd_input_tcp_stream_multi::next_stream()
+{
+  // Called with _mutex held.
+
+  for ( ; ; )
+    {
+      lmd_input_tcp_multi_conn *best = NULL;
+      lmd_input_tcp_multi_slot *best_slot = NULL;
+      bool all = true;
+
+      for (int i = 0; i < _num_conns; i++)
+	{
+	  lmd_input_tcp_multi_conn *conn = &_conns[i];
+	  lmd_input_tcp_multi_slot *slot =
+	    &conn->_slots[conn->_use % LMD_INPUT_TCP_MULTI_SLOTS];
+
+	  if (slot->_state == LITM_SLOT_READY)
+	    {
+	      if (!best ||
+		  (sint32) (slot->_buf_no - best_slot->_buf_no) < 0)
+		{
+		  best = conn;
+		  best_slot = slot;
+		}
+	    }
+	  else if (!conn->_ended)
+	    all = false;
+	}
+
+      if (!best)
+	{
+	  if (all)
+	    return NULL; // all connections are gone
+	  pthread_cond_wait(&_cond,&_mutex);
+	  continue;
+	}
+
+      // Since each connection delivers its streams in order, the
+      // lowest one is next when all connections have delivered.
+
+      if (all ||
+	  (_have_next && best_slot->_buf_no == _next_buf_no))
+	return best;
+
+      double hold_until = best_slot->_received + LMD_INPUT_TCP_MULTI_HOLD;
+
+      if (lmd_input_tcp_time() >= hold_until)
+	{
+	  _out_of_order++;
+	  return best;
+	}
+
+      struct timespec abstime;
+
+      abstime.tv_sec  = (time_t) hold_until;
+      abstime.tv_nsec =
+	(long) ((hold_until - floor(hold_until)) * 1.e9);
+
+      pthread_cond_timedwait(&_cond,&_mutex,&abstime);
+    }
+}
+
+size_t lmd_input_tcp_stream_multi::get_buffer(void *buf,size_t count)
+{
+  if (!_cur)
+    {
+      // The calling (pipe buffer) thread may be cancelled while
+      // waiting.
+      pthread_mutex_lock(&_mutex);
+      pthread_cleanup_push(litm_unlock_mutex,&_mutex);
+      _cur = next_stream();
+      pthread_cleanup_pop(1);
+
+      if (!_cur)
+	return 0;
+    }
+
+  lmd_input_tcp_multi_slot *slot =
+    &_cur->_slots[_cur->_use % LMD_INPUT_TCP_MULTI_SLOTS];
+
+  // Deliver as many whole buffers as fit.
+
+  size_t total = 0;
+
+  while (slot->_offset < slot->_size)
+    {
+      uint32 buf_no;
+
+      size_t size = litm_buffer_size(slot->_data + slot->_offset,&buf_no);
+
+      if (size > count - total)
+	{
+	  if (!total)
+	    {
+	      // Not even one buffer fits (end of linear space), eat
+	      // the space like lmd_input_tcp_buffer::read_buffer.
+	      create_dummy_buffer(buf,count,0,true);
+	      return count;
+	    }
+	  break;
+	}
+
+      memcpy(((char *) buf) + total,slot->_data + slot->_offset,size);
+
+      total += size;
+      slot->_offset += size;
+    }
+
+  if (slot->_offset >= slot->_size)
+    {
+      pthread_mutex_lock(&_mutex);
+
+      _have_next = true;
+      _next_buf_no = slot->_last_buf_no + 1;
+
+      slot->_state = LITM_SLOT_FREE;
+      _cur->_use++;
+      _cur = NULL;
+
+      pthread_cond_broadcast(&_cond);
+      pthread_mutex_unlock(&_mutex);
+    }
+
+  return total;
+}
@@ -0,0 +1,121 @@
+/* This file is part of UCESB - a tool for data unpacking and processing.
+ *
+ * Copyright (C) 2016  GSI Helmholtzzentrum fuer Schwerionenforschung GmbH
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+ * MA  02110-1301  USA
+ */
+
+#ifndef __LMD_INPUT_TCP_MULTI_HH__
+#define __LMD_INPUT_TCP_MULTI_HH__
+
+#include "lmd_input_tcp.hh"
+
+#include <pthread.h>
+
+// Reception from a stream server over several parallel connections.
+//
+// With a stream server that hands each stream to only one client
+// (ucesb --server=stream,sendonce), every connection gets a share of
+// the streams.  Each connection has a reader thread that receives
+// whole streams into its own slots.  The streams are then delivered
+// in order of their (first) buffer number.
+//
+// When the next stream in order has not been seen, a stream is held
+// back until all connections have delivered something (or a short
+// time has passed), since the server may have dropped streams.
+
+#define LMD_INPUT_TCP_MULTI_SLOTS    2     // per connection
+#define LMD_INPUT_TCP_MULTI_HOLD     1.0   // s, max wait for order
+
+#define LITM_SLOT_FREE   0
+#define LITM_SLOT_READY  1
+
+struct lmd_input_tcp_multi_slot
+{
+  char   *_data;
+  size_t  _size;      // filled
+  size_t  _offset;    // delivered
+
+  uint32  _buf_no;    // first buffer
+  uint32  _last_buf_no;
+  double  _received;
+
+  int     _state;
+};
+
+class lmd_input_tcp_stream_multi;
+
+struct lmd_input_tcp_multi_conn
+{
+  lmd_input_tcp_stream_multi *_multi;
+  lmd_input_tcp_stream       *_stream;
+
+  pthread_t _thread;
+  bool      _active;
+
+  lmd_input_tcp_multi_slot _slots[LMD_INPUT_TCP_MULTI_SLOTS];
+
+  // Protected by _multi->_mutex:
+
+  uint64    _fill;    // next slot to fill
+  uint64    _use;     // next slot to deliver
+  bool      _ended;
+};
+
+class lmd_input_tcp_stream_multi :
+  public lmd_input_tcp
+{
+public:
+  lmd_input_tcp_stream_multi(int num_conns);
+  virtual ~lmd_input_tcp_stream_multi();
+
+public:
+  int    _num_conns;
+  size_t _stream_size;
+
+  lmd_input_tcp_multi_conn *_conns;
+
+  // Stream currently being delivered (only used by consumer).
+  lmd_input_tcp_multi_conn *_cur;
+
+  bool   _have_next;
+  uint32 _next_buf_no;
+
+  uint64 _out_of_order;
+
+  bool   _shutdown; // reader threads shall end (protected by _mutex)
+
+  pthread_mutex_t _mutex;
+  pthread_cond_t  _cond;
+
+public:
+  virtual size_t connect(const char *server);
+  virtual void close();
+  virtual void disconnect();
+
+  virtual size_t get_buffer(void *buf,size_t count);
+
+  virtual size_t preferred_min_buffer_size();
+
+protected:
+  lmd_input_tcp_multi_conn *next_stream();
+
+public:
+  static void *reader_thread(void *us);
+  void *reader(lmd_input_tcp_multi_conn *conn);
+};
+
+#endif//__LMD_INPUT_TCP_MULTI_HH__
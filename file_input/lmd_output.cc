@@ -29,6 +29,8 @@
 
 #include "../common/strndup.hh"
 
+#include "ucesb_probe.hh"
+
 #include <unistd.h>
 #include <errno.h>
 #include <sys/types.h>
@@ -106,6 +108,11 @@ lmd_output_file::lmd_output_file()
   _has_file_header = false;
 
   _compression_level = 6;
+
+#ifdef USE_PTHREAD
+  _writer_queue = 0;
+  _writer_zthreads = 0;
+#endif
 }
 
 
@@ -140,6 +147,18 @@ void lmd_output_file::close_file()
     boom = true;
   }
 
+#ifdef USE_PTHREAD
+  if (_writer.active())
+    {
+      try {
+	_writer.finish();
+      } catch (error &e) {
+	boom = true;
+      }
+      _cur_buf_start = NULL; // Was owned by the writer.
+    }
+#endif
+
   try {
     // First wait for the compressor to finish (if there)
     _compressor.wait(false);
@@ -220,6 +239,12 @@ void lmd_out_file_usage()
   printf ("events=N            Event limit [k|M].\n");
   printf ("eventcut=N          Limit events / file [k|M].\n");
   printf ("clevel=N            Compression level 1-9. Default 6.\n");
+#ifdef USE_PTHREAD
+  printf ("queue=N             Write by separate thread, with N buffers in flight.\n");
+#ifdef USE_ZLIB
+  printf ("zthreads=N          Compress .gz output with N threads (built-in).\n");
+#endif
+#endif
   printf ("newnum              Avoid using existing file numbers.\n");
   printf ("wp                  Write protect file.\n");
 
@@ -292,6 +317,22 @@ lmd_output_file *parse_open_lmd_file(const char *command, bool allow_selections)
 	out_file->_event_cut = (uint32) parse_size_postfix(post,"kM","Eventcut",true);
       else if (MATCH_C_PREFIX("clevel=",post))
 	out_file->_compression_level = parse_compression_level(post);
+#ifdef USE_PTHREAD
+      else if (MATCH_C_PREFIX("queue=",post))
+	{
+	  out_file->_writer_queue = atoi(post);
+	  if (out_file->_writer_queue < 2)
+	    ERROR("Output queue must have at least 2 buffers.");
+	}
+#ifdef USE_ZLIB
+      else if (MATCH_C_PREFIX("zthreads=",post))
+	{
+	  out_file->_writer_zthreads = atoi(post);
+	  if (out_file->_writer_zthreads < 1)
+	    ERROR("Need at least 1 compression thread.");
+	}
+#endif
+#endif
       else if (MATCH_C_ARG("newnum"))
 	out_file->_avoid_used_number = true;
       else if (MATCH_C_ARG("wp"))
@@ -315,6 +356,14 @@ lmd_output_file *parse_open_lmd_file(const char *command, bool allow_selections)
 
   const char *filename = command;
 
+  if (out_file->_writer_zthreads)
+    {
+      size_t n = strlen(filename);
+
+      if (n <= 3 || strcmp(filename+n-3,".gz") != 0)
+	ERROR("zthreads= only applies to .gz output files: %s",filename);
+    }
+
   if (strcmp(filename,"-") == 0)
     out_file->open_stdout();
   else if (out_file->_limit_size != (uint64) -1 ||
@@ -394,6 +443,11 @@ void lmd_output_file::open_stdout()
   _fd_write = _fd_handle;
 
   _may_change_file = false; // To avoid closing of our one output.
+
+#ifdef USE_PTHREAD
+  if (_writer_queue)
+    _writer.start(_fd_write,_writer_queue,0,0);
+#endif
 }
 
 
@@ -439,6 +493,24 @@ void lmd_output_file::open_file(const char* filename)
   else if (n > 3 && strcmp(filename+n-3,".xz") == 0)
     argv = argv_xz;
 
+#ifdef USE_PTHREAD
+  if (argv == argv_gzip && _writer_zthreads)
+    {
+      // Each buffer becomes a gzip member of its own.
+      int queue = _writer_queue;
+
+      if (queue < 2 * _writer_zthreads + 2)
+	queue = 2 * _writer_zthreads + 2;
+
+      _fd_write = _fd_handle;
+      _writer.start(_fd_write,queue,_writer_zthreads,
+		    (int) _compression_level);
+      INFO(0,"Compressing output with %d threads (gzip %s)",
+	   _writer_zthreads,level);
+      return;
+    }
+#endif
+
   if (argv)
     {
       _compressor.fork(argv[0],argv,NULL,&_fd_write,_fd_handle,-1,-1,NULL,true);
@@ -446,6 +518,11 @@ void lmd_output_file::open_file(const char* filename)
     }
   else
     _fd_write = _fd_handle;
+
+#ifdef USE_PTHREAD
+  if (_writer_queue)
+    _writer.start(_fd_write,_writer_queue,0,0);
+#endif
 }
 
 
@@ -453,8 +530,13 @@ void lmd_output_file::open_file(const char* filename)
 void lmd_output_file::write_buffer(size_t count, bool has_sticky)
 {
   UNUSED(has_sticky);
-  
-  full_write(_fd_write,_cur_buf_start,count);
+
+#ifdef USE_PTHREAD
+  if (_writer.active())
+    _cur_buf_start = _writer.hand_over(_cur_buf_start,count);
+  else
+#endif
+    full_write(_fd_write,_cur_buf_start,count);
 
   add_size(count);
 
@@ -476,8 +558,13 @@ void lmd_output_file::get_buffer()
 
       assert (_cur_buf_length > sizeof (_buffer_header)); // or no space for buffer header
 
-      if (!(_cur_buf_start = (uchar*) malloc (_cur_buf_length)))
-	ERROR("Memory allocation failed!");
+#ifdef USE_PTHREAD
+      if (_writer.active())
+	_cur_buf_start = _writer.first_buffer(_cur_buf_length);
+      else
+#endif
+	if (!(_cur_buf_start = (uchar*) malloc (_cur_buf_length)))
+	  ERROR("Memory allocation failed!");
 
       //printf ("_file_buffer : %8p .. %8p\n",_file_buffer,_file_buffer+_file_buffer_size);
     }
@@ -582,6 +669,8 @@ void lmd_output_buffered::send_buffer(size_t lie_about_used_when_large_dlen)
     (_buffer_header.i_type    == LMD_BUF_HEADER_HAS_STICKY_TYPE &&
      _buffer_header.i_subtype == LMD_BUF_HEADER_HAS_STICKY_SUBTYPE);
 
+  UCESB_PROBE2(output_flush,_buffer_header.l_buf,count);
+
   if (!_write_native)
     byteswap_32(_buffer_header);
 
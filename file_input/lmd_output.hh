@@ -34,6 +34,10 @@
 
 #include "logfile.hh"
 
+#ifdef USE_PTHREAD
+#include "lmd_output_writer.hh"
+#endif
+
 struct buf_chunk_swap
 {
   const char *_ptr;      // could be void*, char* to allow arithmetics
@@ -240,6 +244,13 @@ public:
   // When compressing the output on the fly
   forked_child       _compressor;
   uint32             _compression_level;
+
+#ifdef USE_PTHREAD
+  // When writing (and compressing) in separate threads
+  lmd_output_writer  _writer;
+  int                _writer_queue;
+  int                _writer_zthreads;
+#endif
 };
 
 void lmd_out_common_options();
@@ -20,6 +20,7 @@
 
 #include "lmd_output_tcp.hh"
 #include "lmd_input_tcp.hh"
+#include "lmd_stream_shm.hh"
 #include "parse_util.hh"
 
 #include "optimise.hh"
@@ -70,6 +71,8 @@ lmd_output_state::lmd_output_state()
   _filled_streams_used = 0;
 
   _fill_stream = 0;
+
+  _shm = NULL;
 }
 
 lmd_output_state::~lmd_output_state()
@@ -78,23 +81,18 @@ lmd_output_state::~lmd_output_state()
 
   while (_free_streams_avail - _free_streams_used > 0)
     {
-      free (_free_streams[_free_streams_used % LMD_OUTPUT_FREE_STREAMS]->_bufs);
-      delete _free_streams[_free_streams_used % LMD_OUTPUT_FREE_STREAMS];
+      delete_stream(_free_streams[_free_streams_used % LMD_OUTPUT_FREE_STREAMS]);
       _free_streams_used++;
     }
 
   while (_filled_streams_avail - _filled_streams_used > 0)
     {
-      free (_filled_streams[_filled_streams_used % LMD_OUTPUT_FILLED_STREAMS]->_bufs);
-      delete _filled_streams[_filled_streams_used % LMD_OUTPUT_FILLED_STREAMS];
+      delete_stream(_filled_streams[_filled_streams_used % LMD_OUTPUT_FILLED_STREAMS]);
       _filled_streams_used++;
     }
 
   if (_fill_stream)
-    {
-      free (_fill_stream->_bufs);
-      delete _fill_stream;
-    }
+    delete_stream(_fill_stream);
 
   // Kill the streams that were active
 
@@ -104,9 +102,10 @@ lmd_output_state::~lmd_output_state()
     {
       lmd_output_stream *kill_stream = stream;
       stream = stream->_next;
-      free (kill_stream->_bufs);
-      delete kill_stream;
+      delete_stream(kill_stream);
     }
+
+  delete _shm;
 }
 
 #if 0 // unused, but should be
@@ -141,8 +140,7 @@ void lmd_output_state::add_free_stream(lmd_output_stream *stream)
 
       // DGBprintf ("add_free_stream: delete %2d\n",stream->_alloc_stream_no);
 
-      free (stream->_bufs);
-      delete stream;
+      delete_stream(stream);
       _num_streams--;
       return;
     }
@@ -164,7 +162,13 @@ bool lmd_output_state::create_free_stream()
     return false; // this may happen, as we free up a stream after the
                   // filler wants one
 
-  char *bufs = (char*) malloc(_stream_bufs * _buf_size);
+  char *bufs;
+  int shm_slot = -1;
+
+  if (_shm)
+    bufs = _shm->alloc_slot(&shm_slot);
+  else
+    bufs = (char*) malloc(_stream_bufs * _buf_size);
 
   if (!bufs)
     ERROR("Memory allocation failure, could not allocate stream buffers.");
@@ -175,6 +179,7 @@ bool lmd_output_state::create_free_stream()
     ERROR("Memory allocation failure, could not allocate stream control.");
 
   stream->_bufs = bufs;
+  stream->_shm_slot = shm_slot;
 
   _num_streams++;
 
@@ -189,6 +194,14 @@ bool lmd_output_state::create_free_stream()
   return true;
 }
 
+void lmd_output_state::delete_stream(lmd_output_stream *stream)
+{
+  if (stream->_shm_slot != -1)
+    _shm->free_slot(stream->_shm_slot);
+  else
+    free (stream->_bufs);
+  delete stream;
+}
 
 void lmd_output_state::unlink_stream(lmd_output_stream *stream)
 {
@@ -1192,6 +1205,10 @@ void *lmd_output_tcp::server()
 	  if (stream->_flags & LOS_FLAGS_HAS_STICKY_EVENT)
 	    _sticky_events_seen = true;
 
+	  // Local clients get it without further ado.
+	  if (_state._shm)
+	    _state._shm->publish(stream->_shm_slot,stream->_filled);
+
 	  // TODO!!! (above) Hmm, do we eever propagare half-filled
 	  // streams?  In that case, perhaps it gets ignored first,
 	  // and then get the first sticky events,.  But a client that
@@ -1223,10 +1240,11 @@ void *lmd_output_tcp::server()
 		}
 	    }
 
-	  if (_state._stream_last || stream->_clients)
+	  if (_state._stream_last || stream->_clients || _state._shm)
 	    {
 	      // if the stream was wanted, or there already is a list of
-	      // waiting streams, then insert it
+	      // waiting streams (or local clients may want it), then
+	      // insert it
 	      _state.add_client_stream(stream);
 	    }
 	  else
@@ -1557,6 +1575,9 @@ void lmd_output_tcp::close()
 	  (*client)->close();
 	  delete *client;
 	}
+
+      if (_state._shm)
+	_state._shm->close();
     }
 }
 
@@ -1759,6 +1780,9 @@ void lmd_output_tcp::get_buffer()
   // DGBprintf ("producer got free stream: %2d\n",
   // DGB	  _state._fill_stream->_alloc_stream_no);
 
+  if (_state._shm)
+    _state._shm->invalidate(_state._fill_stream->_shm_slot);
+
   _state._fill_stream->_flags = 0;
   _state._fill_stream->_filled = 0;
   _state._fill_stream->_max_fill =
@@ -1792,8 +1816,8 @@ bool lmd_output_tcp::flush_buffer()
   if (_flush_interval <= 0)
     return false; // no flushing requested
 
-  if (!_tell_fill_buffer && !_tell_fill_stream)
-    return false; // no client waiting
+  if (!_tell_fill_buffer && !_tell_fill_stream && !_state._shm)
+    return false; // no client waiting (local clients may always be)
 
   if (_state._filled_streams_avail -
       _state._filled_streams_used >= LMD_OUTPUT_FILLED_STREAMS)
@@ -1869,6 +1893,7 @@ void lmd_server_usage()
   printf ("forcemap            No data transmission on fixed port (avoid timeout on bind).\n");
   printf ("nopmap              Do not provide port mapping port.\n");
   printf ("dataport:PORT       Bind dataport at some [PORT,PORT+100].  Circumv. firewall.\n");
+  printf ("shm=NAME            Streams also in shared memory, for local shm://NAME.\n");
   printf ("\n");
 }
 
@@ -1888,6 +1913,7 @@ lmd_output_tcp *parse_open_lmd_server(const char *command)
   int data_port = -1; /* This default will bind to a random port by kernel. */
   bool forcemap = false;
   bool nopmap = false;
+  char *shm_name = NULL;
 
   uint64 max_size = LMD_OUTPUT_DEFAULT_MAX_BUF;
 
@@ -1959,6 +1985,8 @@ lmd_output_tcp *parse_open_lmd_server(const char *command)
 	}
       else if (MATCH_C_PREFIX("flush=",post))
 	out_tcp->_flush_interval = atoi(post);
+      else if (MATCH_C_PREFIX("shm=",post))
+	shm_name = strdup(post);
       else
 	ERROR("Unrecognised option for TCP server: %s",request);
 
@@ -1969,6 +1997,11 @@ lmd_output_tcp *parse_open_lmd_server(const char *command)
   if (nopmap && forcemap)
     ERROR("nopmap and forcemap options are mutually exclusive.");
 
+  // Streams are kept for shm= readers, which cannot be waited for.
+  // With hold, the producer would stall when all are filled.
+  if (out_tcp->_hold && shm_name)
+    ERROR("hold and shm= options are mutually exclusive.");
+
   out_tcp->_state._max_streams =
     (int) (max_size /
 	   (out_tcp->_state._buf_size * out_tcp->_state._stream_bufs));
@@ -1990,6 +2023,16 @@ lmd_output_tcp *parse_open_lmd_server(const char *command)
        out_tcp->_hold ? ", hold" : "",
        out_tcp->_flush_interval);
 
+  if (shm_name)
+    {
+      out_tcp->_state._shm = new lmd_stream_shm_server();
+      out_tcp->_state._shm->create(shm_name,
+				   out_tcp->_state._buf_size,
+				   out_tcp->_state._stream_bufs,
+				   out_tcp->_state._max_streams);
+      free(shm_name);
+    }
+
   if (stream_port != -1)
     out_tcp->create_server(LMD_OUTPUT_STREAM_SERVER,stream_port,
 			   data_port, data_port + 100,
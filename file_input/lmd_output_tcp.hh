@@ -35,6 +35,8 @@
 
 #include "thread_block.hh"
 
+class lmd_stream_shm_server;
+
 #define LMD_OUTPUT_DEFAULT_BUFFER_SIZE    0x8000
 #define LMD_OUTPUT_DEFAULT_BUF_PER_STREAM      8 // each chunk is 8x32k=256k
 
@@ -82,6 +84,7 @@ struct lmd_output_stream
 
   // lmd_output_buffer _buffers[LMD_OUTPUT_BUF_PER_STREAM];
   char  *_bufs;
+  int    _shm_slot; // in shared memory segment, or -1 (malloc)
 };
 
 struct lmd_output_state
@@ -167,6 +170,12 @@ struct lmd_output_state
   bool _sendonce;
   int  _dropold;
 
+  // Streams are allocated in shared memory and published to local
+  // clients (shm=NAME).  All streams are then kept in the list of
+  // client streams until needed again, to give the local clients as
+  // much history as possible.
+  lmd_stream_shm_server *_shm;
+
 public:
   uint32 _buf_size;
   uint32 _stream_bufs;
@@ -182,6 +191,7 @@ public:
   void unlink_stream(lmd_output_stream *stream);
 
   bool create_free_stream();
+  void delete_stream(lmd_output_stream *stream);
 
   void free_oldest_unused();
 
@@ -0,0 +1,409 @@
+/* This file is part of UCESB - a tool for data unpacking and processing.
+ *
+ * Copyright (C) 2016  GSI Helmholtzzentrum fuer Schwerionenforschung GmbH
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+ * MA  02110-1301  USA
+ */
+
+#include "lmd_output_writer.hh"
+
+#include "forked_child.hh"
+#include "error.hh"
+#include "set_thread_name.hh"
+#include "stage_profile.hh"
+
+#include <signal.h>
+#include <string.h>
+#include <assert.h>
+
+#ifdef USE_ZLIB
+#include <zlib.h>
+#endif
+
+lmd_output_writer::lmd_output_writer()
+{
+  _fd = -1;
+  _num_bufs = 0;
+  _num_zthreads = 0;
+  _zlevel = 6;
+  _length = 0;
+
+  _bufs = NULL;
+
+  _zthreads = NULL;
+  _zstarted = 0;
+}
+
+lmd_output_writer::~lmd_output_writer()
+{
+  assert(_fd == -1); // finish() must have been called
+}
+
+void lmd_output_writer::start(int fd,int queue,int zthreads,int zlevel)
+{
+  assert(_fd == -1);
+  assert(queue >= 2);
+
+  _num_bufs = queue;
+  _num_zthreads = zthreads;
+  _zlevel = zlevel;
+
+  _bufs = (lmd_output_writer_buf *)
+    malloc (_num_bufs * sizeof (_bufs[0]));
+
+  if (!_bufs)
+    ERROR("Memory allocation failure!");
+
+  memset(_bufs,0,_num_bufs * sizeof (_bufs[0]));
+
+  _fill = 0;
+  _compress = 0;
+  _write = 0;
+  _quit = false;
+  _failed = false;
+
+  _raw_bytes = 0;
+  _written_bytes = 0;
+
+  pthread_mutex_init(&_mutex,NULL);
+  pthread_cond_init(&_cond_producer,NULL);
+  pthread_cond_init(&_cond_consumer,NULL);
+
+  _fd = fd;
+
+  if (pthread_create(&_writer_thread,NULL,
+		     lmd_output_writer::writer_thread,this) != 0)
+    {
+      perror("pthread_create()");
+      exit(1);
+    }
+
+  set_thread_name(_writer_thread, "LMDWRITE", 8);
+
+  if (_num_zthreads)
+    {
+      _zthreads = (pthread_t *) malloc (_num_zthreads * sizeof (_zthreads[0]));
+
+      if (!_zthreads)
+	ERROR("Memory allocation failure!");
+
+      for (_zstarted = 0; _zstarted < _num_zthreads; _zstarted++)
+	{
+	  if (pthread_create(&_zthreads[_zstarted],NULL,
+			     lmd_output_writer::compress_thread,this) != 0)
+	    {
+	      perror("pthread_create()");
+	      exit(1);
+	    }
+
+	  set_thread_name(_zthreads[_zstarted], "LMDZIP", 6);
+	}
+    }
+}
+
+uint8 *lmd_output_writer::first_buffer(size_t length)
+{
+  assert(_fd != -1);
+
+  if (!_length)
+    {
+      _length = length;
+
+      for (int i = 0; i < _num_bufs; i++)
+	if (!(_bufs[i]._data = (uint8 *) malloc (_length)))
+	  ERROR("Memory allocation failure!");
+    }
+  assert (length == _length);
+
+  return _bufs[_fill % _num_bufs]._data;
+}
+
+uint8 *lmd_output_writer::hand_over(uint8 *data,size_t count)
+{
+  pthread_mutex_lock(&_mutex);
+
+  if (_failed)
+    {
+      pthread_mutex_unlock(&_mutex);
+      ERROR("Failure in LMD output writer thread.");
+    }
+
+  lmd_output_writer_buf *buf = &_bufs[_fill % _num_bufs];
+
+  assert(buf->_data == data);
+  assert(buf->_state == LMD_OUTPUT_WRITER_FREE);
+
+  buf->_count = count;
+  buf->_state = LMD_OUTPUT_WRITER_FILLED;
+  _fill++;
+
+  pthread_cond_broadcast(&_cond_consumer);
+
+  buf = &_bufs[_fill % _num_bufs];
+
+  while (buf->_state != LMD_OUTPUT_WRITER_FREE && !_failed)
+    pthread_cond_wait(&_cond_producer,&_mutex);
+
+  bool failed = _failed;
+
+  pthread_mutex_unlock(&_mutex);
+
+  if (failed)
+    ERROR("Failure in LMD output writer thread.");
+
+  return buf->_data;
+}
+
+void lmd_output_writer::finish()
+{
+  if (_fd == -1)
+    return;
+
+  pthread_mutex_lock(&_mutex);
+  _quit = true;
+  pthread_cond_broadcast(&_cond_consumer);
+  pthread_mutex_unlock(&_mutex);
+
+  if (pthread_join(_writer_thread,NULL) != 0)
+    {
+      perror("pthread_join()");
+      exit(1);
+    }
+
+  for (int i = 0; i < _zstarted; i++)
+    if (pthread_join(_zthreads[i],NULL) != 0)
+      {
+	perror("pthread_join()");
+	exit(1);
+      }
+  _zstarted = 0;
+
+  pthread_cond_destroy(&_cond_consumer);
+  pthread_cond_destroy(&_cond_producer);
+  pthread_mutex_destroy(&_mutex);
+
+  if (_num_zthreads && _raw_bytes)
+    INFO(0,"Compressed %llu bytes to %llu (%.1f %%) with %d threads.",
+	 (unsigned long long) _raw_bytes,
+	 (unsigned long long) _written_bytes,
+	 100. * (double) _written_bytes / (double) _raw_bytes,
+	 _num_zthreads);
+
+  for (int i = 0; i < _num_bufs; i++)
+    {
+      free(_bufs[i]._data);
+      free(_bufs[i]._zdata);
+    }
+  free(_bufs);
+  free(_zthreads);
+  _bufs = NULL;
+  _zthreads = NULL;
+  _length = 0;
+
+  _fd = -1;
+
+  if (_failed)
+    ERROR("Failure in LMD output writer thread.");
+}
+
+void *lmd_output_writer::writer_thread(void *us)
+{
+  return ((lmd_output_writer *) us)->writer();
+}
+
+void *lmd_output_writer::compress_thread(void *us)
+{
+  return ((lmd_output_writer *) us)->compressor();
+}
+
+void *lmd_output_writer::writer()
+{
+  sigset_t sigmask;
+
+  sigemptyset(&sigmask);
+  sigaddset(&sigmask,SIGINT);
+
+  pthread_sigmask(SIG_BLOCK,&sigmask,NULL);
+
+  stage_profile_thread *prof = stage_profile_register("LMDWRITE");
+
+  int ready_state = _num_zthreads ?
+    LMD_OUTPUT_WRITER_READY : LMD_OUTPUT_WRITER_FILLED;
+
+  pthread_mutex_lock(&_mutex);
+
+  for ( ; ; )
+    {
+      lmd_output_writer_buf *buf = &_bufs[_write % _num_bufs];
+
+      while (!(_write < _fill && buf->_state == ready_state) &&
+	     !(_quit && _write == _fill))
+	pthread_cond_wait(&_cond_consumer,&_mutex);
+
+      if (_write == _fill)
+	break;
+
+      bool failed = _failed;
+
+      pthread_mutex_unlock(&_mutex);
+
+      const uint8 *data  = buf->_data;
+      size_t       count = buf->_count;
+
+      if (_num_zthreads)
+	{
+	  data  = buf->_zdata;
+	  count = buf->_zcount;
+	}
+
+      // After a failure, buffers are only passed through, such that
+      // nobody waits forever.
+      if (!failed)
+	{
+	  STAGE_PROFILE_BEGIN(prof,t_write);
+
+	  try {
+	    full_write(_fd,data,count);
+	  } catch (error &e) {
+	    failed = true;
+	  }
+
+	  STAGE_PROFILE_END(prof,STAGE_PROFILE_WRITE,t_write);
+	}
+
+      pthread_mutex_lock(&_mutex);
+
+      if (failed)
+	_failed = true;
+
+      _raw_bytes += buf->_count;
+      _written_bytes += count;
+
+      buf->_state = LMD_OUTPUT_WRITER_FREE;
+      _write++;
+
+      pthread_cond_broadcast(&_cond_producer);
+    }
+
+  pthread_mutex_unlock(&_mutex);
+
+  return NULL;
+}
+
+void *lmd_output_writer::compressor()
+{
+  sigset_t sigmask;
+
+  sigemptyset(&sigmask);
+  sigaddset(&sigmask,SIGINT);
+
+  pthread_sigmask(SIG_BLOCK,&sigmask,NULL);
+
+  stage_profile_thread *prof = stage_profile_register("LMDZIP");
+
+  pthread_mutex_lock(&_mutex);
+
+  for ( ; ; )
+    {
+      while (!(_compress < _fill) && !_quit)
+	pthread_cond_wait(&_cond_consumer,&_mutex);
+
+      if (!(_compress < _fill))
+	break;
+
+      lmd_output_writer_buf *buf = &_bufs[_compress % _num_bufs];
+
+      assert(buf->_state == LMD_OUTPUT_WRITER_FILLED);
+
+      buf->_state = LMD_OUTPUT_WRITER_COMPRESSING;
+      _compress++;
+
+      pthread_mutex_unlock(&_mutex);
+
+      STAGE_PROFILE_BEGIN(prof,t_compress);
+
+      compress_buf(buf);
+
+      STAGE_PROFILE_END(prof,STAGE_PROFILE_COMPRESS,t_compress);
+
+      pthread_mutex_lock(&_mutex);
+
+      buf->_state = LMD_OUTPUT_WRITER_READY;
+
+      pthread_cond_broadcast(&_cond_consumer);
+    }
+
+  pthread_mutex_unlock(&_mutex);
+
+  return NULL;
+}
+
+void lmd_output_writer::compress_buf(lmd_output_writer_buf *buf)
+{
+  // Any failure leaves nothing to write, and is reported when the
+  // event loop next hands over a buffer.
+
+  buf->_zcount = 0;
+
+#ifdef USE_ZLIB
+  z_stream zs;
+
+  memset(&zs,0,sizeof (zs));
+
+  // windowBits + 16: write a gzip header and trailer.
+  if (deflateInit2(&zs,_zlevel,Z_DEFLATED,15 + 16,8,
+		   Z_DEFAULT_STRATEGY) != Z_OK)
+    goto failed;
+
+  {
+    size_t bound = deflateBound(&zs,(uLong) buf->_count);
+
+    if (bound > buf->_zalloc)
+      {
+	uint8 *zdata = (uint8 *) realloc (buf->_zdata,bound);
+
+	if (!zdata)
+	  {
+	    deflateEnd(&zs);
+	    goto failed;
+	  }
+	buf->_zdata = zdata;
+	buf->_zalloc = bound;
+      }
+
+    zs.next_in   = (Bytef *) buf->_data;
+    zs.avail_in  = (uInt) buf->_count;
+    zs.next_out  = (Bytef *) buf->_zdata;
+    zs.avail_out = (uInt) buf->_zalloc;
+
+    int ret = deflate(&zs,Z_FINISH);
+
+    buf->_zcount = buf->_zalloc - zs.avail_out;
+
+    deflateEnd(&zs);
+
+    if (ret != Z_STREAM_END)
+      goto failed;
+  }
+  return;
+
+ failed:
+#endif
+  pthread_mutex_lock(&_mutex);
+  _failed = true;
+  pthread_cond_broadcast(&_cond_producer);
+  pthread_mutex_unlock(&_mutex);
+}
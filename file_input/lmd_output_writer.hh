@@ -0,0 +1,113 @@
+/* This file is part of UCESB - a tool for data unpacking and processing.
+ *
+ * Copyright (C) 2016  GSI Helmholtzzentrum fuer Schwerionenforschung GmbH
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+ * MA  02110-1301  USA
+ */
+
+#ifndef __LMD_OUTPUT_WRITER_HH__
+#define __LMD_OUTPUT_WRITER_HH__
+
+#include "typedef.hh"
+
+#include <stdlib.h>
+#include <pthread.h>
+
+// Writing of filled LMD output buffers by a separate thread, such
+// that a slow disk does not stall the event loop.
+//
+// The buffers form a ring.  The event loop fills one buffer at a
+// time and hands it over.  With built-in compression (zlib), each
+// buffer is deflated into a separate gzip member by one of several
+// compression threads; concatenated members form a valid .gz file.
+// The writer thread writes the buffers in order.  Only when all
+// buffers are in flight does the event loop have to wait.
+
+#define LMD_OUTPUT_WRITER_FREE         0
+#define LMD_OUTPUT_WRITER_FILLED       1
+#define LMD_OUTPUT_WRITER_COMPRESSING  2
+#define LMD_OUTPUT_WRITER_READY        3
+
+struct lmd_output_writer_buf
+{
+  uint8  *_data;
+  size_t  _count;
+
+  uint8  *_zdata;    // compressed, gzip member
+  size_t  _zcount;
+  size_t  _zalloc;
+
+  int     _state;
+};
+
+class lmd_output_writer
+{
+public:
+  lmd_output_writer();
+  ~lmd_output_writer();
+
+public:
+  void start(int fd,int queue,int zthreads,int zlevel);
+
+  // Buffer to fill first, and handing over of a filled buffer
+  // (returns the next one to fill, waiting if none is free).
+  uint8 *first_buffer(size_t length);
+  uint8 *hand_over(uint8 *buf,size_t count);
+
+  // Wait until everything has been written, and stop threads.
+  void finish();
+
+  bool active() { return _fd != -1; }
+
+public:
+  int     _fd;
+  int     _num_bufs;
+  int     _num_zthreads;
+  int     _zlevel;
+  size_t  _length;
+
+  lmd_output_writer_buf *_bufs;
+
+  // Protected by _mutex:
+
+  uint64  _fill;        // buffer being filled
+  uint64  _compress;    // next buffer to compress
+  uint64  _write;       // next buffer to write
+  bool    _quit;
+  bool    _failed;
+
+  uint64  _raw_bytes;
+  uint64  _written_bytes;
+
+  pthread_mutex_t _mutex;
+  pthread_cond_t  _cond_producer;
+  pthread_cond_t  _cond_consumer;
+
+  pthread_t       _writer_thread;
+  pthread_t      *_zthreads;
+  int             _zstarted;
+
+public:
+  static void *writer_thread(void *us);
+  static void *compress_thread(void *us);
+  void *writer();
+  void *compressor();
+
+protected:
+  void compress_buf(lmd_output_writer_buf *buf);
+};
+
+#endif//__LMD_OUTPUT_WRITER_HH__
@@ -0,0 +1,343 @@
+/* This file is part of UCESB - a tool for data unpacking and processing.
+ *
+ * Copyright (C) 2016  GSI Helmholtzzentrum fuer Schwerionenforschung GmbH
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+ * MA  02110-1301  USA
+ */
+
+#include "lmd_replay.hh"
+
+#include "error.hh"
+#include "forked_child.hh"
+#include "endian.hh"
+
+#include "worker_thread.hh"
+#include "thread_buffer.hh"
+
+#include <unistd.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <string.h>
+#include <assert.h>
+
+#ifdef USE_LMD_INPUT
+
+#define LMD_REPLAY_WRITE_BUFFER_SIZE  0x100000
+
+lmd_replay_writer::lmd_replay_writer()
+{
+  _fd = -1;
+
+  _buffer = NULL;
+  _buffer_size = 0;
+  _buffer_used = 0;
+
+  _events = 0;
+  _bytes = 0;
+}
+
+lmd_replay_writer::~lmd_replay_writer()
+{
+  assert(_fd == -1); // close() must have been called
+  free(_buffer);
+}
+
+void lmd_replay_writer::open(const char *filename)
+{
+  assert(_fd == -1);
+
+  if ((_fd = ::open(filename,
+		    O_WRONLY | O_CREAT | O_TRUNC
+#ifdef O_LARGEFILE
+		    | O_LARGEFILE
+#endif
+		    ,
+		    S_IRUSR|S_IWUSR|S_IRGRP|S_IWGRP|S_IROTH|S_IWOTH)) == -1)
+    {
+      perror("open");
+      ERROR("Failed to open file '%s' for writing.",filename);
+    }
+  INFO(0,"Opened replay record file '%s'",filename);
+
+  _buffer_size = LMD_REPLAY_WRITE_BUFFER_SIZE;
+  _buffer = (char *) malloc (_buffer_size);
+
+  if (!_buffer)
+    ERROR("Memory allocation failure!");
+
+  lmd_replay_file_header header;
+
+  memset(&header,0,sizeof (header));
+
+  header._magic      = LMD_REPLAY_MAGIC;
+  header._version    = LMD_REPLAY_VERSION;
+  header._byte_order = LMD_REPLAY_BYTE_ORDER;
+
+  add(&header,sizeof (header));
+}
+
+void lmd_replay_writer::close()
+{
+  if (_fd == -1)
+    return;
+
+  flush();
+
+  if (::close(_fd) != 0)
+    {
+      perror("close");
+      _fd = -1;
+      ERROR("Failed to close replay record file.");
+    }
+  _fd = -1;
+
+  INFO(0,"Recorded %llu events (%llu bytes) for replay.",
+       (unsigned long long) _events,(unsigned long long) _bytes);
+}
+
+void lmd_replay_writer::add(const void *src,size_t length)
+{
+  if (length > _buffer_size - _buffer_used)
+    {
+      flush();
+
+      if (length >= _buffer_size)
+	{
+	  full_write(_fd,src,length);
+	  _bytes += length;
+	  return;
+	}
+    }
+
+  memcpy(_buffer + _buffer_used,src,length);
+  _buffer_used += length;
+}
+
+void lmd_replay_writer::flush()
+{
+  if (!_buffer_used)
+    return;
+
+  full_write(_fd,_buffer,_buffer_used);
+  _bytes += _buffer_used;
+  _buffer_used = 0;
+}
+
+void lmd_replay_writer::write_event(lmd_event *event)
+{
+  assert(event->_status & LMD_EVENT_LOCATE_SUBEVENTS_ATTEMPT);
+
+  // The record size is needed first.  Getting the data also
+  // defragments subevents that were spanning buffers.
+
+  size_t size = sizeof (lmd_replay_event_header);
+
+  for (int i = 0; i < event->_nsubevents; i++)
+    {
+      char *start, *end;
+
+      event->get_subevent_data_src(&event->_subevents[i],start,end);
+
+      size += sizeof (lmd_replay_subevent_header) +
+	LMD_REPLAY_ALIGN((size_t) (end - start));
+    }
+
+  if (size > 0x7fffffff)
+    ERROR("Event too large (%zd bytes) for replay record.",size);
+
+  lmd_replay_event_header header;
+
+  memset(&header,0,sizeof (header));
+
+  header._size       = (uint32) size;
+  header._nsubevents = (uint32) event->_nsubevents;
+  header._flags      = event->_swapping ? LMD_REPLAY_EVENT_SWAPPING : 0;
+  header._header     = event->_header;
+
+  add(&header,sizeof (header));
+
+  static const char padding[8] = { 0, 0, 0, 0, 0, 0, 0, 0 };
+
+  for (int i = 0; i < event->_nsubevents; i++)
+    {
+      lmd_subevent *subevent_info = &event->_subevents[i];
+      char *start, *end;
+
+      event->get_subevent_data_src(subevent_info,start,end);
+
+      lmd_replay_subevent_header subevent_header;
+
+      memset(&subevent_header,0,sizeof (subevent_header));
+
+      subevent_header._header      = subevent_info->_header;
+      subevent_header._data_length = (uint32) (end - start);
+
+      add(&subevent_header,sizeof (subevent_header));
+
+      size_t length = (size_t) (end - start);
+
+      if (length)
+	add(start,length);
+      add(padding,LMD_REPLAY_ALIGN(length) - length);
+    }
+
+  _events++;
+}
+
+/********************************************************************/
+
+static void *lmd_replay_allocate(lmd_event *dest,size_t size)
+{
+#ifdef USE_THREADING
+  UNUSED(dest);
+  return _wt._defrag_buffer->allocate_reclaim(size);
+#else
+  return dest->_defrag_event_many.allocate(size);
+#endif
+}
+
+lmd_event *lmd_source::get_replay_event(lmd_event *dest)
+{
+  if (!_replay_header_seen)
+    {
+      lmd_replay_file_header file_header;
+
+      if (!_input.read_range(&file_header,sizeof (file_header)))
+	ERROR("Replay file too short for file header.");
+
+      if (file_header._magic == bswap_32(LMD_REPLAY_MAGIC))
+	ERROR("Replay file recorded with other byte order, "
+	      "not supported.");
+      if (file_header._magic != LMD_REPLAY_MAGIC ||
+	  file_header._byte_order != LMD_REPLAY_BYTE_ORDER)
+	ERROR("Not a replay file (magic 0x%08x).",file_header._magic);
+      if (file_header._version != LMD_REPLAY_VERSION)
+	ERROR("Replay file version %d not supported (expect %d).",
+	      file_header._version,LMD_REPLAY_VERSION);
+
+      _replay_header_seen = true;
+    }
+
+  _prev_record_release_to = _input._cur;
+
+  lmd_replay_event_header header;
+
+  if (!_input.read_range(&header,sizeof (header)))
+    return NULL;
+
+  if (header._size < sizeof (header) ||
+      (header._size & 7))
+    ERROR("Replay record size (%d) broken.",header._size);
+
+  size_t size = header._size - sizeof (header);
+
+  if (size > _input._input->max_item_length())
+    ERROR("Replay record (%zd=0x%08zx) too large for input buffer.  "
+	  "Use at least --input-buffer=%zdMi.",
+	  size, size, (size * 3 + (1024*1024-1))/(1024*1024));
+
+  if (header._nsubevents > size / sizeof (lmd_replay_subevent_header))
+    ERROR("Replay record has too many subevents (%d) for size (%zd).",
+	  header._nsubevents,size);
+
+  char *data = NULL;
+
+  if (size)
+    {
+      buf_chunk chunks[2];
+
+      int n = _input.map_range(size,chunks);
+
+      if (!n)
+	ERROR("Replay record incomplete at end of file.");
+
+      if (n == 1)
+	data = chunks[0]._ptr;
+      else
+	{
+	  // Wrapped around the end of the input buffer.
+	  data = (char *) lmd_replay_allocate(dest,size);
+	  memcpy(data,chunks[0]._ptr,chunks[0]._length);
+	  memcpy(data + chunks[0]._length,chunks[1]._ptr,chunks[1]._length);
+	}
+    }
+
+  dest->_header   = header._header;
+  dest->_swapping = !!(header._flags & LMD_REPLAY_EVENT_SWAPPING);
+
+  // Info and subevents are known, the locating is skipped.
+
+  dest->_status |=
+    LMD_EVENT_GET_10_1_INFO_ATTEMPT |
+    LMD_EVENT_HAS_10_1_INFO |
+    LMD_EVENT_LOCATE_SUBEVENTS_ATTEMPT;
+
+  if (header._header._header.i_type    == LMD_EVENT_STICKY_TYPE &&
+      header._header._header.i_subtype == LMD_EVENT_STICKY_SUBTYPE)
+    dest->_status |= LMD_EVENT_IS_STICKY;
+
+  dest->_chunk_end  = dest->_chunks_ptr;
+  dest->_chunk_cur  = dest->_chunks_ptr;
+  dest->_offset_cur = 0;
+
+  dest->_subevents = (lmd_subevent *)
+    lmd_replay_allocate(dest,(header._nsubevents + 1) *
+			sizeof (lmd_subevent));
+  dest->_nsubevents = (int) header._nsubevents;
+
+  char *p   = data;
+  char *end = data + size;
+
+  for (int i = 0; i < dest->_nsubevents; i++)
+    {
+      lmd_replay_subevent_header subevent_header;
+
+      if ((size_t) (end - p) < sizeof (subevent_header))
+	ERROR("Replay subevent header beyond end of record.");
+
+      memcpy(&subevent_header,p,sizeof (subevent_header));
+      p += sizeof (subevent_header);
+
+      size_t data_length = subevent_header._data_length;
+
+      if (LMD_REPLAY_ALIGN(data_length) > (size_t) (end - p))
+	ERROR("Replay subevent data (%zd bytes) beyond end of record.",
+	      data_length);
+
+      lmd_subevent *subevent_info = &dest->_subevents[i];
+
+      subevent_info->_header = subevent_header._header;
+      // Never give away a NULL pointer, see locate_subevents().
+      subevent_info->_data   = data_length ? p : (char *) 16;
+      subevent_info->_frag   = NULL;
+      subevent_info->_offset = 0;
+
+      size_t dlen_length = (size_t)
+	SUBEVENT_DATA_LENGTH_FROM_DLEN(subevent_info->_header._header.l_dlen);
+
+      if (!dest->is_subevent_sticky_revoke(subevent_info) &&
+	  data_length != dlen_length)
+	ERROR("Replay subevent data length (%zd) does not match "
+	      "header (%zd).",data_length,dlen_length);
+
+      p += LMD_REPLAY_ALIGN(data_length);
+    }
+
+  return dest;
+}
+
+#endif//USE_LMD_INPUT
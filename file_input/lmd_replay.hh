@@ -0,0 +1,105 @@
+/* This file is part of UCESB - a tool for data unpacking and processing.
+ *
+ * Copyright (C) 2016  GSI Helmholtzzentrum fuer Schwerionenforschung GmbH
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+ * MA  02110-1301  USA
+ */
+
+#ifndef __LMD_REPLAY_HH__
+#define __LMD_REPLAY_HH__
+
+#include "lmd_input.hh"
+
+#ifdef USE_LMD_INPUT
+
+// Replay files (--record=FILE, read with replay://FILE).
+//
+// Events are stored with their subevents already located and
+// defragmented, such that reading them back needs no buffer
+// parsing.  Used to measure the unpacking alone, and to reproduce
+// (slow) events from production deterministically.
+//
+// All headers are in host byte order (of the recording machine),
+// the subevent payload is kept as it was in the original data.
+// Every record and payload is padded to 8 bytes.
+//
+// file:      lmd_replay_file_header, then events
+// event:     lmd_replay_event_header, then _nsubevents subevents
+// subevent:  lmd_replay_subevent_header, then _data_length bytes
+
+#define LMD_REPLAY_MAGIC       0x50524355 // "UCRP" (little endian)
+#define LMD_REPLAY_VERSION     1
+#define LMD_REPLAY_BYTE_ORDER  0x01020304
+
+#define LMD_REPLAY_ALIGN(size) (((size) + 7) & ~(size_t) 7)
+
+struct lmd_replay_file_header
+{
+  uint32 _magic;
+  uint32 _version;
+  uint32 _byte_order;
+  uint32 _reserved;
+};
+
+#define LMD_REPLAY_EVENT_SWAPPING  0x0001 // payload in foreign byte order
+
+struct lmd_replay_event_header
+{
+  uint32 _size;        // of the record, including this header
+  uint32 _nsubevents;
+  uint32 _flags;
+  uint32 _reserved;
+
+  lmd_event_10_1_host _header;
+};
+
+struct lmd_replay_subevent_header
+{
+  lmd_subevent_10_1_host _header;
+  uint32 _data_length;
+};
+
+class lmd_replay_writer
+{
+public:
+  lmd_replay_writer();
+  ~lmd_replay_writer();
+
+public:
+  void open(const char *filename);
+  void close();
+
+  // Subevents must have been located.
+  void write_event(lmd_event *event);
+
+protected:
+  void add(const void *src,size_t length);
+  void flush();
+
+protected:
+  int     _fd;
+
+  char   *_buffer;
+  size_t  _buffer_size;
+  size_t  _buffer_used;
+
+  uint64  _events;
+  uint64  _bytes;
+};
+
+#endif//USE_LMD_INPUT
+
+#endif//__LMD_REPLAY_HH__
@@ -9,33 +9,28 @@
  * need to keep track of them.  Since however the usual delivery is
  * incrementally, as they occur, this additional book-keeping is just
  * done to satisfy very spurious requests.  It should therefore be of
- * low cost (and preferably take the hit when the request comes.
+ * low cost, also when sticky events come often (e.g. calibration
+ * data each spill).
  *
- * We store the sticky events as they arrive in a plain data array.
- * New sticky events are added at the end.  In order to keep track of
- * the contents of the array, we keep an additional array with just
- * the meta-data, i.e. identifiers, lengths and offsets of the events
- * and subevents.  Thus it is easy to in that metadata remove (by
- * marking, not moving) entries as they are superceeded.  Further, to
- * easily find entries in the array, we also keep a hash-table of all
- * identifiers, with offsets to the last (i.e. active) entry.
+ * Each subevent id that has been seen gets a key (found by a hash
+ * table), which holds a copy of the data of the live subevent with
+ * that id.  When a subevent is replaced, the new data is copied into
+ * the same memory (only reallocated if it grows).  The key also has a
+ * generation number, which changes each time it gets new data.
  *
- * Thus insertation is cheap, the main cost is a single copy of the
- * data into the big array.  The meta-data update is constant time.
+ * The events are kept in a list, in order of insertion.  Each event
+ * has its header (and timestamp subevent), and entries (key and
+ * generation) for its subevents.  An entry is live as long as the
+ * key still has the same generation.  Each event counts its live
+ * subevents, and is freed as soon as it has none left.
  *
- * When we need to request the contents, it is also linear in size, as
- * it only has to traverse the meta-data array and copy out any active
- * items.
- * 
- * To avoid this store to eat infinite amounts of memory, we keep
- * track of the amount of discarded data.  When a reallocation is
- * necessary, it is first checked if there is more than half empty
- * data.  If that is the case, we compact the array instead of
- * allocating more memory.  This will of course take time proportional
- * to the array size, but as it at most happens when we reach the end
- * of the array, its occurance goes inversely proportional to the
- * array size, and thus overall scales with the copy cost.
+ * Thus insertion and replacement/revoke is constant time per
+ * subevent, the main cost is the copy of the data.  There is nothing
+ * to compact: the memory used is bounded by the number of subevent
+ * ids and the events that still have live subevents.
  *
+ * When we need to deliver the contents, it is linear in the number of
+ * live events, each being gathered directly from the key data.
  */
 
 #define DEBUG_LMD_STICKY_STORE        1
@@ -43,13 +38,12 @@
 
 lmd_sticky_store::lmd_sticky_store()
 {
-  _data = NULL;
-  _data_end = _data_alloc = 0; // bytes
-  _data_revoked = 0;
+  _first = _last = NULL;
 
-  _meta = NULL;
-  _meta_end = _meta_alloc = 0; // bytes
-  _meta_revoked = 0;
+  _generation = 0;
+
+  _scratch = NULL;
+  _scratch_alloc = 0; // bytes
 
   _hash = NULL;
   _hash_used = _hash_size = 0; // items
@@ -57,17 +51,28 @@ lmd_sticky_store::lmd_sticky_store()
 
 lmd_sticky_store::~lmd_sticky_store()
 {
-  free(_data);
-  free(_meta);
+  while (_first)
+    {
+      lmd_sticky_event *ev = _first;
+      _first = ev->_next;
+      free(ev);
+    }
+
+  for (size_t i = 0; i < _hash_size; i++)
+    if (_hash[i])
+      {
+	free(_hash[i]->_data);
+	free(_hash[i]);
+      }
+
   free(_hash);
+  free(_scratch);
 }
 
-uint32_t sticky_subevent_hash(const lmd_subevent_10_1_host *subevent_header)
+uint32_t sticky_subevent_hash(const uint32_t *id)
 {
-  const uint32_t *p = (const uint32_t *) subevent_header;
-
-  uint32_t d1 = p[1];
-  uint32_t d2 = p[2];
+  uint32_t d1 = id[0];
+  uint32_t d2 = id[1];
 
   uint32_t hash = d1;
 
@@ -84,73 +89,156 @@ uint32_t sticky_subevent_hash(const lmd_subevent_10_1_host *subevent_header)
   return hash;
 }
 
-bool sticky_subevent_same_id(const lmd_subevent_10_1_host *header_a,
-			     const lmd_subevent_10_1_host *header_b)
+void lmd_sticky_store::grow_hash()
 {
-  const uint32_t *p_a = (const uint32_t *) header_a;
-  const uint32_t *p_b = (const uint32_t *) header_b;
+  size_t sz = _hash_size * 2;
+
+  if (sz < 16)
+    sz = 16;
+
+  lmd_sticky_key **hash =
+    (lmd_sticky_key **) calloc (sz, sizeof (hash[0]));
+  if (!hash)
+    ERROR("Memory allocation failure.");
+
+  // Reinsert the keys.  (They are never removed.)
+
+  for (size_t i = 0; i < _hash_size; i++)
+    {
+      lmd_sticky_key *key = _hash[i];
+
+      if (!key)
+	continue;
+
+      size_t entry = sticky_subevent_hash(key->_id) & (sz - 1);
 
-  if (p_a[1] == p_b[1] &&
-      p_a[2] == p_b[2])
-    return true;
-  return false;
+      while (hash[entry])
+	entry = (entry + 1) & (sz - 1);
+
+      hash[entry] = key;
+    }
+
+  free(_hash);
+  _hash = hash;
+  _hash_size = sz;
 }
 
-void lmd_sticky_store::insert(const lmd_event_out *event,
-			      bool discard_revoke)
+lmd_sticky_key *lmd_sticky_store::find_key(const uint32_t *id, bool create)
 {
+  if (create &&
+      _hash_used + 1 > _hash_size / 2)
+    grow_hash();
+
+  if (!_hash_size)
+    return NULL;
+
+  size_t entry = sticky_subevent_hash(id) & (_hash_size - 1);
+
+  for ( ; _hash[entry]; entry = (entry + 1) & (_hash_size - 1))
+    {
+      lmd_sticky_key *key = _hash[entry];
+
+      if (key->_id[0] == id[0] &&
+	  key->_id[1] == id[1])
+	return key;
+    }
+
+  if (!create)
+    return NULL;
+
+  lmd_sticky_key *key = (lmd_sticky_key *) malloc (sizeof (lmd_sticky_key));
+  if (!key)
+    ERROR("Memory allocation failure.");
+
+  key->_id[0] = id[0];
+  key->_id[1] = id[1];
+  key->_event = NULL;
+  key->_gen = 0;
+  key->_data = NULL;
+  key->_length = 0;
+  key->_alloc = 0;
+
+  _hash[entry] = key;
+  _hash_used++;
+
 #if DEBUG_LMD_STICKY_STORE
-  verify_meta();
+# if DEBUG_LMD_STICKY_STORE_PRINT
+  fprintf(stderr, "Inserted key at hash %zd.\n", entry);
+# endif
 #endif
 
-  // How much additional does this event contribute (worst case,
-  // i.e. without considering any stuff that it revokes)
+  return key;
+}
+
+void lmd_sticky_store::free_event(lmd_sticky_event *ev)
+{
+  if (ev->_prev)
+    ev->_prev->_next = ev->_next;
+  else
+    _first = ev->_next;
+  if (ev->_next)
+    ev->_next->_prev = ev->_prev;
+  else
+    _last = ev->_prev;
+
+  free(ev);
+}
+
+// The live data of the key (if any) is no longer wanted.  Its event
+// is freed when nothing is left, unless it is the one being inserted.
+
+void lmd_sticky_store::revoke(lmd_sticky_key *key, lmd_sticky_event *keep)
+{
+  lmd_sticky_event *ev = key->_event;
+
+  if (!ev)
+    return;
+
+  key->_event = NULL;
+  key->_gen = 0; // no entry has this generation
+
+  ev->_live_sub--;
 
+  if (!ev->_live_sub && ev != keep)
+    free_event(ev);
+}
+
+void lmd_sticky_store::insert(const lmd_event_out *event,
+			      bool discard_revoke)
+{
   // The event that we get to handle comes via lmd_event_out, which
   // means it is broken down into chunks, and subevents headers etc
   // not are clearly marked any long.  (It may even be malformed, if
   // the user has copied badly...)
 
-  // The easiest approach is that we copy the entire data (which we
-  // anyhow would do) into the data buffer, and then from there sort
-  // out the subevents again.
+  // The easiest approach is that we copy the entire data into a
+  // scratch buffer, and then from there sort out the subevents again.
 
   size_t ev_data_len = event->get_length();
   size_t ev_len = ev_data_len + sizeof(lmd_event_header_host);
 
-  if (_data_end + ev_len > _data_alloc)
+  if (ev_len > _scratch_alloc)
     {
-      // Is compactification due?
-
-      if (_data_revoked > _data_end / 2)
-	compact_data();
-
-      // Problem may still not be solved...
-
-      size_t sz = _data_alloc;
+      size_t sz = _scratch_alloc;
 
       if (sz < 1024)
 	sz = 1024;
 
-      while (_data_end + ev_len > sz)
+      while (ev_len > sz)
 	sz *= 2;
 
-      if (sz > _data_alloc)
-	{
-	  _data = (char *) realloc (_data, sz);
-	  if (!_data)
-	    ERROR("Memory allocation failure.");
-	  
-	  _data_alloc = sz;
-	}
-    } 
+      free(_scratch);
+      _scratch = (char *) malloc (sz);
+      if (!_scratch)
+	ERROR("Memory allocation failure.");
+
+      _scratch_alloc = sz;
+    }
 
-  // Now that we have the needed data array secured, copy the event
+  // Now that we have the needed scratch array secured, copy the event
+
+  char *raw_ev = _scratch;
 
-  size_t ev_data_off = _data_end;
-  _data_end += ev_len;
-  char *raw_ev = _data + ev_data_off;
-  
   event->write(raw_ev);
 
 #if DEBUG_LMD_STICKY_STORE
@@ -246,87 +334,25 @@ void lmd_sticky_store::insert(const lmd_event_out *event,
       sev_data_off = sev_next_off;
     }
   
-  // Reallocations?
-
-  size_t meta_add =
-    sizeof (lmd_sticky_meta_event) +
-    num_sev * sizeof (lmd_sticky_meta_subevent);
-  size_t hash_add = num_sev;
-
-  bool recalc_hash = false;
-
-  if (_meta_end + meta_add > _meta_alloc)
-    {
-      // Is compactification due?
-
-      if (_meta_revoked > _meta_end / 2)
-	{
-	  compact_meta();
-	  // Since the offsets change, we just recalculate the hash table
-	  recalc_hash = true;
-	}
-
-      // Problem may still not be solved...
-
-      size_t sz = _meta_alloc;
-
-      if (sz < 256)
-	sz = 256;
-
-      while (_meta_end + meta_add > sz)
-	sz *= 2;
-
-      if (sz > _meta_alloc || sz < _meta_alloc / 2)
-	{
-	  _meta = (char *) realloc (_meta, sz);
-	  if (!_meta)
-	    ERROR("Memory allocation failure.");
-	  
-	  _meta_alloc = sz;
-	}
-    }
-
-  if (_hash_used + hash_add > _hash_size / 2)
-    {
-      size_t sz = _hash_size;
-
-      if (sz < 16)
-	sz = 16;
-
-      while (_hash_used + hash_add > sz / 2)
-	sz *= 2;
-
-      if (sz > _hash_size ||
-	  sz < _hash_size / 4) // if needs have decreased dramatically...
-	{
-	  _hash = (lmd_sticky_hash_subevent *)
-	    realloc (_hash, sz * sizeof (_hash[0]));
-	  if (!_hash)
-	    ERROR("Memory allocation failure.");
-	  
-	  _hash_size = sz;
+  // Allocate the event.  The header data is placed after the
+  // subevent entries.
 
-	  // We simply repopulate the hash table
-	  recalc_hash = true;
-	}
-    }
+  lmd_sticky_event *ev = (lmd_sticky_event *)
+    malloc (sizeof (lmd_sticky_event) +
+	    num_sev * sizeof (lmd_sticky_entry) +
+	    ev_raw_data_len);
+  if (!ev)
+    ERROR("Memory allocation failure.");
 
-  if (recalc_hash)
-    populate_hash();
+  ev->_next = NULL;
+  ev->_prev = NULL;
+  ev->_num_sub  = 0;
+  ev->_live_sub = 0;
+  ev->_header = (char *) (ev->_entries + num_sev);
+  ev->_header_length = ev_raw_data_len;
 
-  // Ok, so now we also have space to store the meta-data about this event...
+  memcpy(ev->_header, raw_ev, ev_raw_data_len);
 
-  size_t dest_ev_offset = _meta_end;
-  
-  lmd_sticky_meta_event *ev =
-    (lmd_sticky_meta_event *) (_meta + _meta_end);
-  _meta_end += sizeof (lmd_sticky_meta_event);
-
-  ev->_data_offset = ev_data_off;
-  ev->_data_length = ev_raw_data_len;
-  ev->_num_sub  = num_sev;
-  ev->_live_sub = num_sev;
-  
   for (size_t sev_data_off = ev_raw_data_len; sev_data_off != ev_len; )
     {
       lmd_subevent_10_1_host *sev_header =
@@ -338,431 +364,148 @@ void lmd_sticky_store::insert(const lmd_event_out *event,
       else
 	sev_payload_size =
 	  SUBEVENT_DATA_LENGTH_FROM_DLEN((size_t) sev_header->_header.l_dlen);
-      size_t sev_next_off =
-	sev_data_off + (sizeof (lmd_subevent_10_1_host) +
-			sev_payload_size);
+      size_t sev_length =
+	sizeof (lmd_subevent_10_1_host) + sev_payload_size;
 
 # if DEBUG_LMD_STICKY_STORE_PRINT
       fprintf(stderr, "Consider sev (l_dlen=%d).\n",
 	      sev_header->_header.l_dlen);
 # endif
 
-	  size_t dest_sev_offset = _meta_end;
+      // Type/subtype and procid/crate/control identify the subevent.
+      const uint32_t *id = ((const uint32_t *) sev_header) + 1;
 
-      if (!discard_revoke ||
-	  sev_header->_header.l_dlen != LMD_SUBEVENT_STICKY_DLEN_REVOKE)
-	{      
-	  // Insert the subevent metadata
+      sev_data_off += sev_length;
 
-	  lmd_sticky_meta_subevent *sev =
-	    (lmd_sticky_meta_subevent *) (_meta + _meta_end);
-	  _meta_end += sizeof (lmd_sticky_meta_subevent);
+      // Note: We cannot remove revoke events.  Since our purpose is
+      // to be used for replays, also the revoke events are
+      // important!  For file replay, we do not want the revoke
+      // events however.
 
-	  sev->_ev_offset = dest_ev_offset;
-	  sev->_data_offset = ev_data_off + sev_data_off;
-	  sev->_data_length = (sizeof (lmd_subevent_10_1_host) +
-			       sev_payload_size);
-	}
-      else
+      if (discard_revoke &&
+	  sev_header->_header.l_dlen == LMD_SUBEVENT_STICKY_DLEN_REVOKE)
 	{
-	  ev->_num_sub--;
-	  ev->_live_sub--;
-	}
-
-      // And into the hash table Perhaps it is known before?  Note: We
-      // cannot remove revoke events.  Since our purpose is to be used
-      // for replays, also the revoke events are important!
+	  lmd_sticky_key *key = find_key(id, false);
 
-      // For file replay, we do not want the revoke events however.
+	  if (key)
+	    revoke(key, ev);
+	  continue;
+	}
 
-      uint32_t hash = sticky_subevent_hash(sev_header);
+      lmd_sticky_key *key = find_key(id, true);
 
-      size_t entry = hash & (_hash_size - 1);
+      // Forget the previous data of this id.
+      revoke(key, ev);
 
-      for ( ; _hash[entry]._sub_offset;
-	    entry = (entry + 1) & (_hash_size - 1))
+      if (sev_length > key->_alloc)
 	{
-	  if (_hash[entry]._sub_offset == -1)
-	    continue; // discarded
-
-	  // Investigate if this is the same id as ours
+	  free(key->_data);
+	  key->_data = (char *) malloc (sev_length);
+	  if (!key->_data)
+	    ERROR("Memory allocation failure.");
 
-	  lmd_sticky_meta_subevent *check_sev =
-	    (lmd_sticky_meta_subevent *) (_meta + _hash[entry]._sub_offset);
+	  key->_alloc = sev_length;
+	}
 
-	  if (check_sev->_data_offset == -1)
-	    continue; // discarded
+      memcpy(key->_data, sev_header, sev_length);
+      key->_length = sev_length;
+      key->_event = ev;
+      key->_gen = ++_generation;
 
-	  char *check_raw = _data + check_sev->_data_offset;
+      lmd_sticky_entry *entry = &ev->_entries[ev->_num_sub++];
 
-	  lmd_subevent_10_1_host *check_sev_header =
-	    (lmd_subevent_10_1_host *) check_raw;	  
+      entry->_key = key;
+      entry->_gen = key->_gen;
 
-	  if (sticky_subevent_same_id(sev_header,
-				      check_sev_header))
-	    {
-	      // Remove the subevent from the event it belongs to.
-	      // Actual removal happens later.  Just decrease the
-	      // number of live subevents.
-
-	      check_sev->_data_offset = -1;
-
-	      lmd_sticky_meta_event *check_ev =
-		(lmd_sticky_meta_event *) (_meta + check_sev->_ev_offset);
-
-	      // When data (or meta) gets compacted, this subevent
-	      // will not be retained
-	      _data_revoked += check_sev->_data_length;
-	      _meta_revoked += sizeof (lmd_sticky_meta_subevent);
-	      check_ev->_live_sub--;
-	      if (check_ev->_live_sub == 0)
-		{
-		  // Upon compacting, this event will not be retained.
-		  _data_revoked += check_ev->_data_length;
-		  _meta_revoked += sizeof (lmd_sticky_meta_event);
-		}
-	      // May be moved into earlier discardred slot, so kill this one.
-	      _hash[entry]._sub_offset = -1;
-	      goto hash_found;
-	    }
-	}
-      _hash_used++;
-    hash_found:
-      if (!discard_revoke ||
-	  sev_header->_header.l_dlen != LMD_SUBEVENT_STICKY_DLEN_REVOKE)
-	{
-	  // Since we may have discarded slots, do the search again
-	  entry = hash & (_hash_size - 1);
-	  while (_hash[entry]._sub_offset &&
-		 _hash[entry]._sub_offset != -1)
-	    {
-	      entry = (entry + 1) & (_hash_size - 1);
-	    }
-	  // We have found either an empty slot, or we will overwrite
-	  // the previous.
-	  _hash[entry]._sub_offset = dest_sev_offset;
-#if DEBUG_LMD_STICKY_STORE
-# if DEBUG_LMD_STICKY_STORE_PRINT
-	  fprintf(stderr, "Inserted sev at hash %zd.\n", entry);
-# endif
-#endif
-	}
-      sev_data_off = sev_next_off;
+      ev->_live_sub++;
     }
 
-#if DEBUG_LMD_STICKY_STORE
-  verify_meta();
-#endif
-}
-
-void lmd_sticky_store::compact_data()
-{
-#if DEBUG_LMD_STICKY_STORE
-  verify_meta();
-# if DEBUG_LMD_STICKY_STORE_PRINT
-  fprintf(stderr,"Compact data!\n");
-# endif
-#endif
-  // Go trough the meta-data, and move all event data up ahead.
-
-  size_t dest_offset = 0;
-  size_t iter_ev_offset;
-
-  for (iter_ev_offset = 0; iter_ev_offset < _meta_end; )
+  if (!ev->_live_sub)
     {
-      lmd_sticky_meta_event *ev =
-	(lmd_sticky_meta_event *) (_meta + iter_ev_offset);
-      iter_ev_offset +=
-	sizeof (lmd_sticky_meta_event) +
-	ev->_num_sub * sizeof (lmd_sticky_meta_subevent);
-
-      if (!ev->_live_sub)
-	{
-	  // There are no live subevents left in this event.
-	  // Forget about its data.
-	  continue;
-	}
-
-      char *src_ptr = _data + ev->_data_offset;
-      char *dest_ptr = _data + (ev->_data_offset = dest_offset);
-      dest_offset += ev->_data_length;
-
-      // Move (if needed) the event to its new position
-      assert (dest_ptr <= src_ptr);
-      memmove(dest_ptr, src_ptr, ev->_data_length);
-
-      // Get pointer to the subevents
-      lmd_sticky_meta_subevent *sev =
-	(lmd_sticky_meta_subevent *) (ev + 1);
-
-      for (uint32_t i = 0; i < ev->_num_sub; i++, sev++)
-	{
-	  if (sev->_data_offset == -1)
-	    continue;
-
-	  char *src_ptr = _data + sev->_data_offset;
-	  char *dest_ptr = _data + (sev->_data_offset = dest_offset);
-	  dest_offset += sev->_data_length;
-
-	  // Move (if needed) to its new position
-	  assert (dest_ptr <= src_ptr);
-	  memmove(dest_ptr, src_ptr, sev->_data_length);
-	}
+      // Nothing to deliver from this event (only revokes, or the
+      // same id several times).
+      free(ev);
     }
-  assert(iter_ev_offset == _meta_end);
-  // New end of meta-data:
-  _data_end = dest_offset;
-  _data_revoked = 0;
-
-#if DEBUG_LMD_STICKY_STORE
-  verify_meta();
-#endif
-}
-
-void lmd_sticky_store::compact_meta()
-{
-#if DEBUG_LMD_STICKY_STORE
-  verify_meta();
-# if DEBUG_LMD_STICKY_STORE_PRINT
-  fprintf(stderr,"Compact meta!\n");
-# endif
-#endif
-  // Go trough the meta-data, and squeeze out all subevents that have
-  // vanished.
-
-  size_t dest_offset = 0;
-  size_t iter_ev_offset;
-
-  for (iter_ev_offset = 0; iter_ev_offset < _meta_end; )
+  else
     {
-      lmd_sticky_meta_event *ev =
-	(lmd_sticky_meta_event *) (_meta + iter_ev_offset);
-      iter_ev_offset +=
-	sizeof (lmd_sticky_meta_event) +
-	ev->_num_sub * sizeof (lmd_sticky_meta_subevent);
-
-      if (!ev->_live_sub)
-	{
-	  // There are no live subevents left in this event.
-	  // Completely forget about it.
-	  continue;
-	}
-
-      // Get pointer to the subevents (source)
-      lmd_sticky_meta_subevent *sev =
-	(lmd_sticky_meta_subevent *) (ev + 1);
-
-      size_t dest_ev_offset = dest_offset;
-      lmd_sticky_meta_event *dev =
-	(lmd_sticky_meta_event *) (_meta + dest_offset);
-      dest_offset += sizeof (lmd_sticky_meta_event);
-
-      // Move (if needed) the event to its new position
-      assert (dev <= ev);
-      memmove(dev, ev, sizeof (lmd_sticky_meta_event));
-      ev = dev;
-
-      for (uint32_t i = 0; i < ev->_num_sub; i++, sev++)
-	{
-	  if (sev->_data_offset == -1)
-	    continue;
-
-	  // Subevent is still live.  Calculate its new position.
-	  lmd_sticky_meta_subevent *dsev =
-	    (lmd_sticky_meta_subevent *) (_meta + dest_offset);
-	  dest_offset += sizeof (lmd_sticky_meta_subevent);
-
-	  // Move (if needed) to its new position
-	  assert (dsev <= sev);
-	  memmove(dsev, sev, sizeof (lmd_sticky_meta_event));
-	  // Update the pointer to its event.
-	  dsev->_ev_offset = dest_ev_offset;
-	}
-      ev->_num_sub = ev->_live_sub;
+      ev->_prev = _last;
+      if (_last)
+	_last->_next = ev;
+      else
+	_first = ev;
+      _last = ev;
     }
-  assert(iter_ev_offset == _meta_end);
-  // New end of meta-data:
-  _meta_end = dest_offset;
-  _meta_revoked = 0;
+
 #if DEBUG_LMD_STICKY_STORE
-  verify_meta();
+  verify();
 #endif
 }
 
-void lmd_sticky_store::populate_hash()
-{
 #if DEBUG_LMD_STICKY_STORE
-# if DEBUG_LMD_STICKY_STORE_PRINT
-  fprintf(stderr,"Populating hash!\n");
-# endif
-#endif
+void lmd_sticky_store::verify()
+{
+  // This function is used to check the integrity of the
+  // data structures
 
-  // Initialize all items empty
+  size_t live_keys = 0;
 
-  _hash_used = 0;
   for (size_t i = 0; i < _hash_size; i++)
-    _hash[i]._sub_offset = 0;
-  
-  // Go trough the meta-data, and reconstruct the hash table
-  size_t iter_ev_offset;
-
-  for (iter_ev_offset = 0; iter_ev_offset < _meta_end; )
     {
-      lmd_sticky_meta_event *ev =
-	(lmd_sticky_meta_event *) (_meta + iter_ev_offset);
-      iter_ev_offset +=
-	sizeof (lmd_sticky_meta_event) +
-	ev->_num_sub * sizeof (lmd_sticky_meta_subevent);
+      lmd_sticky_key *key = _hash[i];
 
-      if (!ev->_live_sub)
+      if (!key)
 	continue;
 
-      // Get pointer to the subevents
-      lmd_sticky_meta_subevent *sev =
-	(lmd_sticky_meta_subevent *) (ev + 1);
-
-      for (uint32_t i = 0; i < ev->_num_sub; i++, sev++)
-	{
-	  if (sev->_data_offset == -1)
-	    continue;
-
-	  // Subevent is live, insert into hash table
-	  // insert_hash((char *) sev - _meta);
-	  insert_hash(sev);
-	}
-    }
-  assert(iter_ev_offset == _meta_end);
-#if DEBUG_LMD_STICKY_STORE
-  verify_meta();
-#endif
-}
-
-void lmd_sticky_store::insert_hash(lmd_sticky_meta_subevent *sev)
-{
-#if DEBUG_LMD_STICKY_STORE
-# if DEBUG_LMD_STICKY_STORE_PRINT
-  fprintf(stderr,"Insert hash!\n");
-# endif
-#endif
-
-  // can never be 0, as an event always is before the subevent
-  ssize_t offset_sev = (char *) sev - _meta;
-
-  char *sev_raw = _data + sev->_data_offset;
-
-  lmd_subevent_10_1_host *subevent_header =
-    (lmd_subevent_10_1_host *) sev_raw;
-
-  uint32_t hash = sticky_subevent_hash(subevent_header);
-
-  size_t entry = hash & (_hash_size - 1);
-
-  while (_hash[entry]._sub_offset &&
-	 _hash[entry]._sub_offset != -1) // we can insert at discarded position
-    {
-      entry = (entry + 1) & (_hash_size - 1);
+      assert(key->_length <= key->_alloc);
+      assert(!key->_event == !key->_gen);
+      if (key->_event)
+	live_keys++;
     }
-  _hash[entry]._sub_offset = offset_sev;
-  _hash_used++;
-}
 
-#if DEBUG_LMD_STICKY_STORE
-void lmd_sticky_store::verify_meta()
-{
-  // This function is used to check the integrity of the meta-data
-  // structures
+  size_t live_entries = 0;
 
-  size_t iter_ev_offset;
-
-# if DEBUG_LMD_STICKY_STORE_PRINT
-  fprintf (stderr,"--- DATA: [%05zx/%05zx] r:%05zx ---\n",
-	   _data_end, _data_alloc, _data_revoked);
-  fprintf (stderr,"--- META: [%05zx/%05zx] r:%05zx ---\n",
-	   _meta_end, _meta_alloc, _meta_revoked);
-# endif
-  for (iter_ev_offset = 0; iter_ev_offset < _meta_end; )
+  for (lmd_sticky_event *ev = _first; ev; ev = ev->_next)
     {
-      assert (iter_ev_offset + sizeof (lmd_sticky_meta_event) <= _meta_end);
-
-      size_t this_ev_offset = iter_ev_offset;
-      lmd_sticky_meta_event *ev =
-	(lmd_sticky_meta_event *) (_meta + iter_ev_offset);
 # if DEBUG_LMD_STICKY_STORE_PRINT
       fprintf (stderr,
-	       "@%04zx  EV   d@=%05zx:%02zx  live:%d/%d\n",
-	       iter_ev_offset,
-	       ev->_data_offset, ev->_data_length,
+	       "EV   h:%02zx  live:%d/%d\n",
+	       ev->_header_length,
 	       ev->_live_sub, ev->_num_sub);
 # endif
-      iter_ev_offset +=
-	sizeof (lmd_sticky_meta_event) +
-	ev->_num_sub * sizeof (lmd_sticky_meta_subevent);
-      assert(iter_ev_offset <= _meta_end);
-
-      assert(!ev->_live_sub ||
-	     ev->_data_offset + ev->_data_length <= _data_end);
+      assert(ev->_prev ? ev->_prev->_next == ev : _first == ev);
+      assert(ev->_next ? ev->_next->_prev == ev : _last == ev);
+      assert(ev->_live_sub);
 
       uint32_t live_sub = 0;
-      
-      // Get pointer to the subevents
-      lmd_sticky_meta_subevent *sev =
-	(lmd_sticky_meta_subevent *) (ev + 1);
 
-      for (uint32_t i = 0; i < ev->_num_sub; i++, sev++)
+      for (uint32_t i = 0; i < ev->_num_sub; i++)
 	{
-	  assert((char *) (sev+1) <= _meta + _meta_end);
-	  
-# if DEBUG_LMD_STICKY_STORE_PRINT
-	  fprintf (stderr,
-		   " @%04zx  SEV d@=%05zx:%02zx  (EV@%04zx)\n",
-		   ((char *) sev) - _meta,
-		   sev->_data_offset, sev->_data_length,
-		   sev->_ev_offset);
-# endif
-	  
-	  if (sev->_data_offset == -1)
+	  lmd_sticky_entry *entry = &ev->_entries[i];
+
+	  if (entry->_gen != entry->_key->_gen)
 	    continue;
 
+	  assert(entry->_key->_event == ev);
 	  live_sub++;
-
-	  assert(sev->_ev_offset == this_ev_offset);
-	  assert(sev->_data_offset > 0);
-	  assert(sev->_data_offset + sev->_data_length <= _data_end);
 	}
       assert(live_sub == ev->_live_sub);
+      live_entries += live_sub;
     }
-  assert(iter_ev_offset == _meta_end);
-  
-# if DEBUG_LMD_STICKY_STORE_PRINT
-  fprintf (stderr,"--- HASH: [%zx/%zx] ---\n",
-	   _hash_used,_hash_size);
-  for (size_t i = 0; i < _hash_size; i++)
-    {
-      if (_hash[i]._sub_offset &&
-	  _hash[i]._sub_offset != -1)
-	{
-	  fprintf (stderr,
-		   " [%04zx] SEV@%04zx\n",
-		   i,
-		   _hash[i]._sub_offset);	  
-	}
-    }
-  fprintf (stderr,"-------------\n");
-# endif
+  assert(live_entries == live_keys);
 }
 #endif
 
 void lmd_sticky_store::write_events(lmd_output_buffered *dest)
 {
 #if DEBUG_LMD_STICKY_STORE
-  verify_meta();
+  verify();
 # if DEBUG_LMD_STICKY_STORE_PRINT
   fprintf(stderr,"Write events!\n");
 # endif
 #endif
 
-  // Go trough the meta-data, and prepare all non-empty events
-  // for writing, and send the write call.
+  // Go trough the events, and gather the live subevents for writing,
+  // and send the write call.
 
   // TODO: when writing for a file, we should not eject sticky
   // 'revoke' events.  The file is new, and does not need any
@@ -770,27 +513,13 @@ void lmd_sticky_store::write_events(lmd_output_buffered *dest)
 
   lmd_event_out event;
 
-  size_t iter_ev_offset;
-
-  for (iter_ev_offset = 0; iter_ev_offset < _meta_end; )
+  for (lmd_sticky_event *ev = _first; ev; ev = ev->_next)
     {
-      lmd_sticky_meta_event *ev =
-	(lmd_sticky_meta_event *) (_meta + iter_ev_offset);
-      iter_ev_offset +=
-	sizeof (lmd_sticky_meta_event) +
-	ev->_num_sub * sizeof (lmd_sticky_meta_subevent);
-
-      if (!ev->_live_sub)
-	{
-	  // There are no live subevents left in this event.
-	  continue;
-	}
-
       event.clear();
 
-      const char *src_ptr = _data + ev->_data_offset;
+      const char *src_ptr = ev->_header;
       const lmd_event_10_1_host *header_ptr =
-	(lmd_event_10_1_host *) src_ptr;
+	(const lmd_event_10_1_host *) src_ptr;
 
       // The first part of the header
       event._header = header_ptr->_header;
@@ -799,32 +528,25 @@ void lmd_sticky_store::write_events(lmd_output_buffered *dest)
       // Which is handled as a chunk
       event.add_chunk(&event._info, sizeof (event._info), false/*native*/);
 
-      assert(ev->_data_length >= sizeof (lmd_event_10_1_host));
+      assert(ev->_header_length >= sizeof (lmd_event_10_1_host));
       const char *more_ptr = src_ptr + sizeof (lmd_event_10_1_host);
-      size_t more_length = ev->_data_length - sizeof (lmd_event_10_1_host);
-      // Any additional data
+      size_t more_length = ev->_header_length - sizeof (lmd_event_10_1_host);
+      // Any additional data (timestamp subevent)
       if (more_length)
 	event.add_chunk(more_ptr, more_length, false/*native*/);
-      /*
-      printf ("%zd = %zd - %zd\n",
-	      more_length,ev->_data_length,sizeof (lmd_event_10_1_host));
-      */
-      // Get pointer to the subevents
-      lmd_sticky_meta_subevent *sev =
-	(lmd_sticky_meta_subevent *) (ev + 1);
-
-      for (uint32_t i = 0; i < ev->_num_sub; i++, sev++)
+
+      for (uint32_t i = 0; i < ev->_num_sub; i++)
 	{
-	  if (sev->_data_offset == -1)
-	    continue;
+	  lmd_sticky_entry *entry = &ev->_entries[i];
 
-	  const char *src_ptr = _data + sev->_data_offset;
+	  if (entry->_gen != entry->_key->_gen)
+	    continue; // replaced or revoked
 
-	  event.add_chunk(src_ptr, sev->_data_length, false/*native*/);
+	  event.add_chunk(entry->_key->_data, entry->_key->_length,
+			  false/*native*/);
 	}
 
       // event.dump_debug();
       dest->write_event(&event, true);
     }
-  assert(iter_ev_offset == _meta_end);
 }
@@ -6,24 +6,46 @@
 #include <stdint.h>
 #include <sys/types.h>
 
-struct lmd_sticky_meta_event
+struct lmd_sticky_event;
+
+// One for each subevent id seen.  Holds the data of the live subevent
+// with that id.  The memory is reused when the subevent is replaced.
+
+struct lmd_sticky_key
 {
-  size_t _data_offset;
-  size_t _data_length; // may include timestamp subevent
-  uint32_t _num_sub;   // number of subevent metadata entries
-  uint32_t _live_sub;  // decreased as subevents are revoked
+  uint32_t _id[2];       // identifying words of subevent header
+
+  lmd_sticky_event *_event; // event the data belongs to, NULL if none
+  uint64_t _gen;         // generation of the data
+
+  char    *_data;        // subevent header and payload
+  size_t   _length;
+  size_t   _alloc;
 };
 
-struct lmd_sticky_meta_subevent
+// An entry is live as long as the key has not got newer data.
+
+struct lmd_sticky_entry
 {
-  size_t  _ev_offset;
-  ssize_t _data_offset; // -1 for data not live any longer
-  size_t  _data_length;
+  lmd_sticky_key *_key;
+  uint64_t        _gen;
 };
 
-struct lmd_sticky_hash_subevent
+// A stored event, as long as some of its subevents are live.
+
+struct lmd_sticky_event
 {
-  ssize_t _sub_offset; // -1 for revoked
+  lmd_sticky_event *_next;
+  lmd_sticky_event *_prev;
+
+  uint32_t _num_sub;     // number of subevent entries
+  uint32_t _live_sub;    // decreased as subevents are replaced/revoked
+
+  char    *_header;      // event header (and timestamp subevent)
+  size_t   _header_length;
+
+  // Followed by the entries, and then the header data.
+  lmd_sticky_entry _entries[];
 };
 
 class lmd_event_out;
@@ -36,22 +58,18 @@ public:
   ~lmd_sticky_store();
 
 protected:
-  char   *_data;
-  size_t  _data_end;
-  size_t  _data_alloc;
+  // Events in order of insertion.
+  lmd_sticky_event *_first;
+  lmd_sticky_event *_last;
 
-  size_t  _data_revoked;
+  uint64_t _generation;
 
 protected:
-  char   *_meta;
-  size_t  _meta_end;
-  size_t  _meta_alloc;
-
-  size_t  _meta_revoked;
+  char   *_scratch;      // for unpacking the inserted event
+  size_t  _scratch_alloc;
 
 protected:
-  
-  lmd_sticky_hash_subevent *_hash;
+  lmd_sticky_key **_hash;
   size_t  _hash_used;
   size_t  _hash_size;
 
@@ -62,13 +80,13 @@ public:
   void write_events(lmd_output_buffered *dest);
 
 protected:
-  void compact_data();
-  void compact_meta();
-  void populate_hash();
+  lmd_sticky_key *find_key(const uint32_t *id, bool create);
+  void grow_hash();
 
-  void insert_hash(lmd_sticky_meta_subevent *sev);
+  void revoke(lmd_sticky_key *key, lmd_sticky_event *keep);
+  void free_event(lmd_sticky_event *ev);
 
-  void verify_meta();
+  void verify();
 
 };
 
@@ -0,0 +1,553 @@
+/* This file is part of UCESB - a tool for data unpacking and processing.
+ *
+ * Copyright (C) 2016  GSI Helmholtzzentrum fuer Schwerionenforschung GmbH
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+ * MA  02110-1301  USA
+ */
+
+#include "lmd_stream_shm.hh"
+#include "lmd_event.hh"
+
+#include "optimise.hh"
+#include "error.hh"
+
+#include <unistd.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <sys/mman.h>
+#include <fcntl.h>
+#include <signal.h>
+#include <errno.h>
+#include <string.h>
+#include <stdio.h>
+#include <assert.h>
+
+#define LSS_ALIGN(size,align) (((size) + (align) - 1) & ~((size_t) (align) - 1))
+
+static char *lss_shm_name(const char *name)
+{
+  // shm_open() wants the name to start with a slash.
+
+  size_t len = strlen(name);
+  char *shm_name = (char *) malloc (len + 2);
+
+  if (!shm_name)
+    ERROR("Memory allocation failure!");
+
+  shm_name[0] = '/';
+  strcpy(shm_name + (name[0] == '/' ? 0 : 1),name);
+
+  return shm_name;
+}
+
+lmd_stream_shm_server::lmd_stream_shm_server()
+{
+  _name = NULL;
+
+  _ptr = NULL;
+  _len = 0;
+
+  _ctrl  = NULL;
+  _ring  = NULL;
+  _slots = NULL;
+  _data  = NULL;
+
+  _free_slots = NULL;
+  _num_free = 0;
+}
+
+lmd_stream_shm_server::~lmd_stream_shm_server()
+{
+  close();
+
+  if (_ptr)
+    munmap(_ptr,_len);
+
+  free(_free_slots);
+  free(_name);
+}
+
+// Is the existing segment @shm_name in use by a running server?
+
+static bool lss_segment_in_use(const char *shm_name)
+{
+  int fd = shm_open(shm_name,O_RDONLY,0);
+
+  if (fd == -1)
+    return false; // gone meanwhile
+
+  bool in_use = false;
+  struct stat st;
+
+  if (fstat(fd,&st) == 0 &&
+      (size_t) st.st_size >= sizeof (lmd_stream_shm_control))
+    {
+      void *ptr = mmap(NULL,sizeof (lmd_stream_shm_control),
+		       PROT_READ,MAP_SHARED,fd,0);
+
+      if (ptr != MAP_FAILED)
+	{
+	  const lmd_stream_shm_control *ctrl =
+	    (const lmd_stream_shm_control *) ptr;
+
+	  if (ctrl->_magic == LMD_STREAM_SHM_MAGIC &&
+	      !ctrl->_closed &&
+	      (kill((pid_t) ctrl->_pid,0) == 0 || errno == EPERM))
+	    in_use = true;
+	  munmap(ptr,sizeof (lmd_stream_shm_control));
+	}
+    }
+
+  ::close(fd);
+
+  return in_use;
+}
+
+void lmd_stream_shm_server::create(const char *name,
+				   uint32 buf_size,uint32 stream_bufs,
+				   int num_slots)
+{
+  assert(!_ptr);
+
+  _name = lss_shm_name(name);
+
+  int fd = shm_open(_name,O_RDWR | O_CREAT | O_EXCL,
+		    S_IRUSR | S_IWUSR | S_IRGRP | S_IROTH);
+
+  if (fd == -1 && errno == EEXIST)
+    {
+      // A segment left behind by a server that died is removed.
+      // Clients still attached to it keep their (orphaned) mapping.
+      // One of a running server is not taken over.
+
+      if (lss_segment_in_use(_name))
+	ERROR("Shared memory segment '%s' is in use by a running server.",
+	      _name);
+
+      WARNING("Removing stale shared memory segment '%s'.",_name);
+
+      shm_unlink(_name);
+
+      fd = shm_open(_name,O_RDWR | O_CREAT | O_EXCL,
+		    S_IRUSR | S_IWUSR | S_IRGRP | S_IROTH);
+    }
+
+  if (fd == -1)
+    {
+      perror("shm_open");
+      ERROR("Failed to create shared memory segment '%s'.",_name);
+    }
+
+  size_t ring_offset  = LSS_ALIGN(sizeof (lmd_stream_shm_control),64);
+  size_t slots_offset = ring_offset +
+    LSS_ALIGN(num_slots * sizeof (uint32),64);
+  size_t data_offset  = LSS_ALIGN(slots_offset +
+				  num_slots * sizeof (lmd_stream_shm_slot),
+				  4096);
+  size_t slot_size    = LSS_ALIGN((size_t) buf_size * stream_bufs,4096);
+
+  _len = data_offset + num_slots * slot_size;
+
+  if (ftruncate(fd,(off_t) _len) == -1)
+    {
+      perror("ftruncate");
+      ERROR("Failed to set size (%zd) of shared memory segment.",_len);
+    }
+
+  _ptr = (char *) mmap(NULL,_len,PROT_READ | PROT_WRITE,MAP_SHARED,fd,0);
+
+  if (_ptr == MAP_FAILED)
+    {
+      _ptr = NULL;
+      perror("mmap");
+      ERROR("Failed to map shared memory segment.");
+    }
+
+  ::close(fd);
+
+  _ctrl  = (lmd_stream_shm_control *) _ptr;
+  _ring  = (volatile uint32 *) (_ptr + ring_offset);
+  _slots = (lmd_stream_shm_slot *) (_ptr + slots_offset);
+  _data  = _ptr + data_offset;
+
+  memset(_ptr,0,data_offset);
+
+  _ctrl->_version      = LMD_STREAM_SHM_VERSION;
+  _ctrl->_buf_size     = buf_size;
+  _ctrl->_stream_bufs  = stream_bufs;
+  _ctrl->_num_slots    = (uint32) num_slots;
+  _ctrl->_pid          = (uint32) getpid();
+  _ctrl->_ring_offset  = ring_offset;
+  _ctrl->_slots_offset = slots_offset;
+  _ctrl->_data_offset  = data_offset;
+  _ctrl->_slot_size    = slot_size;
+  MFENCE;
+  // Last, such that clients do not see a half-initialised segment.
+  _ctrl->_magic        = LMD_STREAM_SHM_MAGIC;
+
+  _free_slots = (int *) malloc (num_slots * sizeof (int));
+
+  if (!_free_slots)
+    ERROR("Memory allocation failure!");
+
+  for (int i = 0; i < num_slots; i++)
+    _free_slots[i] = num_slots - 1 - i;
+  _num_free = num_slots;
+
+  INFO(0,"Streams in shared memory '%s' (%zd MiB).",_name,_len >> 20);
+}
+
+void lmd_stream_shm_server::close()
+{
+  if (!_ctrl || _ctrl->_closed)
+    return;
+
+  // The mapping is kept until the streams are released.
+
+  MFENCE;
+  _ctrl->_closed = 1;
+
+  shm_unlink(_name);
+}
+
+char *lmd_stream_shm_server::alloc_slot(int *slot)
+{
+  if (!_num_free)
+    return NULL;
+
+  *slot = _free_slots[--_num_free];
+
+  return _data + (size_t) *slot * _ctrl->_slot_size;
+}
+
+void lmd_stream_shm_server::free_slot(int slot)
+{
+  assert(slot >= 0 && slot < (int) _ctrl->_num_slots);
+  assert(_num_free < (int) _ctrl->_num_slots);
+
+  // The data stays valid for clients until the slot is refilled.
+  _free_slots[_num_free++] = slot;
+}
+
+void lmd_stream_shm_server::invalidate(int slot)
+{
+  _slots[slot]._seq = 0;
+  MFENCE; // before the data is overwritten
+}
+
+void lmd_stream_shm_server::publish(int slot,size_t filled)
+{
+  uint64 seq = _ctrl->_published;
+
+  _slots[slot]._filled = filled;
+  MFENCE;
+  _slots[slot]._seq = seq + 1;
+  _ring[seq % _ctrl->_num_slots] = (uint32) slot;
+  MFENCE;
+  _ctrl->_published = seq + 1;
+}
+
+/////////////////////////////////////////////////////////////////////
+
+lmd_input_shm_stream::lmd_input_shm_stream()
+{
+  _ptr = NULL;
+  _len = 0;
+
+  _ctrl  = NULL;
+  _ring  = NULL;
+  _slots = NULL;
+  _data  = NULL;
+
+  _stream_size = 0;
+
+  _next = 0;
+  _lost = 0;
+
+  _stage = NULL;
+  _stage_size = 0;
+  _stage_offset = 0;
+}
+
+lmd_input_shm_stream::~lmd_input_shm_stream()
+{
+  disconnect();
+  free(_stage);
+}
+
+size_t lmd_input_shm_stream::connect(const char *name)
+{
+  assert(!_ptr);
+
+  char *shm_name = lss_shm_name(name);
+
+  int fd = shm_open(shm_name,O_RDONLY,0);
+
+  if (fd == -1)
+    {
+      perror("shm_open");
+      ERROR("Cannot open shared memory segment '%s'.",shm_name);
+    }
+
+  free(shm_name);
+
+  struct stat st;
+
+  if (fstat(fd,&st) != 0)
+    {
+      perror("fstat");
+      ::close(fd);
+      ERROR("Cannot get size of shared memory segment.");
+    }
+
+  _len = (size_t) st.st_size;
+
+  if (_len < sizeof (lmd_stream_shm_control))
+    {
+      ::close(fd);
+      ERROR("Shared memory segment too small (%zd).",_len);
+    }
+
+  _ptr = (char *) mmap(NULL,_len,PROT_READ,MAP_SHARED,fd,0);
+
+  ::close(fd);
+
+  if (_ptr == MAP_FAILED)
+    {
+      _ptr = NULL;
+      perror("mmap");
+      ERROR("Failed to map shared memory segment.");
+    }
+
+  _ctrl = (const lmd_stream_shm_control *) _ptr;
+
+  if (_ctrl->_magic != LMD_STREAM_SHM_MAGIC)
+    ERROR("Shared memory segment has bad magic (0x%08x).",_ctrl->_magic);
+  MFENCE;
+  if (_ctrl->_version != LMD_STREAM_SHM_VERSION)
+    ERROR("Shared memory segment version %d not supported (expect %d).",
+	  _ctrl->_version,LMD_STREAM_SHM_VERSION);
+
+  _stream_size = (size_t) _ctrl->_buf_size * _ctrl->_stream_bufs;
+
+  if (!_ctrl->_num_slots ||
+      _stream_size > _ctrl->_slot_size ||
+      _ctrl->_data_offset + _ctrl->_num_slots * _ctrl->_slot_size > _len)
+    ERROR("Shared memory segment layout broken.");
+
+  _ring  = (const volatile uint32 *) (_ptr + _ctrl->_ring_offset);
+  _slots = (const lmd_stream_shm_slot *) (_ptr + _ctrl->_slots_offset);
+  _data  = _ptr + _ctrl->_data_offset;
+
+  // Like the stream server, start with the newest stream.
+
+  uint64 published = _ctrl->_published;
+
+  _next = published ? published - 1 : 0;
+  _lost = 0;
+
+  free(_stage);
+  _stage = (char *) malloc (_stream_size);
+
+  if (!_stage)
+    ERROR("Memory allocation failure!");
+
+  _stage_size = 0;
+  _stage_offset = 0;
+
+  _stat_connected = lmd_input_tcp_time();
+
+  INFO(0,"Mapped shared memory streams of server (pid %d), "
+       "%d streams of %d*%d kiB.",
+       _ctrl->_pid,_ctrl->_num_slots,
+       _ctrl->_stream_bufs,_ctrl->_buf_size >> 10);
+
+  return _stream_size;
+}
+
+void lmd_input_shm_stream::close()
+{
+  print_stats();
+
+  if (_lost)
+    INFO(0,"%llu streams overwritten before they were read.",
+	 (unsigned long long) _lost);
+
+  disconnect();
+}
+
+void lmd_input_shm_stream::disconnect()
+{
+  if (_ptr)
+    munmap(_ptr,_len);
+
+  _ptr = NULL;
+  _len = 0;
+
+  _ctrl  = NULL;
+  _ring  = NULL;
+  _slots = NULL;
+  _data  = NULL;
+
+  _stage_size = 0;
+  _stage_offset = 0;
+
+  close_connection();
+}
+
+size_t lmd_input_shm_stream::preferred_min_buffer_size()
+{
+  return _stream_size;
+}
+
+bool lmd_input_shm_stream::copy_stream(void *buf,size_t *filled)
+{
+  uint32 slot = _ring[_next % _ctrl->_num_slots];
+  MFENCE;
+
+  if (slot < _ctrl->_num_slots)
+    {
+      const lmd_stream_shm_slot *s = &_slots[slot];
+
+      uint64 seq = s->_seq;
+      MFENCE;
+      size_t size = (size_t) s->_filled;
+
+      if (seq == _next + 1 &&
+	  size >= sizeof (s_bufhe_host) && size <= _stream_size)
+	{
+	  memcpy(buf,_data + (size_t) slot * _ctrl->_slot_size,size);
+	  MFENCE;
+
+	  // Unchanged, so the producer did not start to refill it.
+	  if (s->_seq == seq)
+	    {
+	      _next++;
+	      *filled = size;
+	      return true;
+	    }
+	}
+    }
+
+  // Slot has been reused.
+  _next++;
+  _lost++;
+  return false;
+}
+
+size_t lmd_input_shm_stream::deliver_staged(void *buf,size_t count)
+{
+  // Deliver as many whole buffers as fit.
+
+  size_t total = 0;
+
+  while (_stage_offset < _stage_size)
+    {
+      s_bufhe_host header;
+
+      memcpy(&header,_stage + _stage_offset,sizeof (header));
+
+      if (header.l_free[0] == 0x01000000)
+	byteswap_32(header);
+
+      size_t size = BUFFER_SIZE_FROM_DLEN((size_t) header.l_dlen);
+
+      if (size < sizeof (header) ||
+	  size > _stage_size - _stage_offset)
+	ERROR("Buffer size (%zd) in shared memory stream broken.",size);
+
+      if (size > count - total)
+	{
+	  if (!total)
+	    {
+	      // Not even one buffer fits (end of linear space), eat
+	      // the space like lmd_input_tcp_buffer::read_buffer.
+	      create_dummy_buffer(buf,count,0,true);
+	      return count;
+	    }
+	  break;
+	}
+
+      memcpy(((char *) buf) + total,_stage + _stage_offset,size);
+
+      total += size;
+      _stage_offset += size;
+    }
+
+  return total;
+}
+
+size_t lmd_input_shm_stream::get_buffer(void *buf,size_t count)
+{
+  for ( ; ; )
+    {
+      if (_stage_offset < _stage_size)
+	return deliver_staged(buf,count);
+
+      uint64 published = _ctrl->_published;
+      MFENCE;
+
+      if (_next >= published)
+	{
+	  if (_ctrl->_closed)
+	    return 0;
+
+	  if (kill((pid_t) _ctrl->_pid,0) == -1 && errno == ESRCH)
+	    {
+	      WARNING("Stream server (pid %d) is gone.",_ctrl->_pid);
+	      return 0;
+	    }
+
+	  double t_wait = lmd_input_tcp_time();
+	  usleep(LMD_STREAM_SHM_POLL_US);
+	  _stat_wait += lmd_input_tcp_time() - t_wait;
+	  continue;
+	}
+
+      if (published - _next > _ctrl->_num_slots)
+	{
+	  // Lapped, older streams are gone for sure.
+	  _lost += published - _ctrl->_num_slots - _next;
+	  _next  = published - _ctrl->_num_slots;
+	}
+
+      // Usually the whole stream fits, then it is copied directly.
+
+      bool direct = (_stream_size <= count);
+      char *dest = direct ? (char *) buf : _stage;
+      size_t filled;
+
+      if (!copy_stream(dest,&filled))
+	continue;
+
+      s_bufhe_host *header = (s_bufhe_host *) dest;
+
+      // The marker is -1, so no byte swapping needed.
+      if (((sint32) header->l_evt) < 0)
+	{
+	  WARNING("Got close buffer from shared memory stream.");
+	  return 0;
+	}
+
+      _stat_bytes += filled;
+
+      if (direct)
+	return filled;
+
+      _stage_size = filled;
+      _stage_offset = 0;
+    }
+}
@@ -0,0 +1,161 @@
+/* This file is part of UCESB - a tool for data unpacking and processing.
+ *
+ * Copyright (C) 2016  GSI Helmholtzzentrum fuer Schwerionenforschung GmbH
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+ * MA  02110-1301  USA
+ */
+
+#ifndef __LMD_STREAM_SHM_HH__
+#define __LMD_STREAM_SHM_HH__
+
+#include "lmd_input_tcp.hh"
+
+#include "typedef.hh"
+
+#include <stdlib.h>
+
+// Stream server streams in shared memory (--server=...,shm=NAME,
+// read with shm://NAME).
+//
+// The stream pool of the server is allocated in a POSIX shared
+// memory segment.  Local clients map it read-only and follow the
+// streams as they are published, without any involvement of the
+// server, which thus does not copy or send anything for them.
+// TCP clients are served from the same streams as before.
+//
+// Each published stream gets a number.  The slot holding it is
+// recorded in a ring, and the slot itself carries the number + 1
+// while it is valid.  The producer sets it to 0 before refilling
+// the slot.  A client copies the data and then checks that the
+// number did not change (seqlock), otherwise the stream is lost.
+//
+// segment:  lmd_stream_shm_control, ring[_num_slots] (uint32),
+//           lmd_stream_shm_slot[_num_slots], data at _data_offset.
+
+#define LMD_STREAM_SHM_MAGIC    0x4d534355 // "UCSM" (little endian)
+#define LMD_STREAM_SHM_VERSION  1
+
+#define LMD_STREAM_SHM_POLL_US  1000 // client sleep when no new stream
+
+struct lmd_stream_shm_control
+{
+  uint32 _magic;
+  uint32 _version;
+  uint32 _buf_size;
+  uint32 _stream_bufs;
+  uint32 _num_slots;
+  uint32 _pid;          // of the server
+
+  uint64 _ring_offset;
+  uint64 _slots_offset;
+  uint64 _data_offset;
+  uint64 _slot_size;
+
+  volatile uint64 _published; // number of streams published
+  volatile uint32 _closed;    // server is done, no more streams
+  uint32 _dummy;
+};
+
+struct lmd_stream_shm_slot
+{
+  volatile uint64 _seq;     // publish number + 1, 0 while (re)filled
+  volatile uint64 _filled;  // bytes
+};
+
+// Used by the server (lmd_output_tcp).  Slots are handed out and
+// taken back by the server thread only.
+
+class lmd_stream_shm_server
+{
+public:
+  lmd_stream_shm_server();
+  ~lmd_stream_shm_server();
+
+public:
+  void create(const char *name,
+	      uint32 buf_size,uint32 stream_bufs,int num_slots);
+  void close();
+
+public:
+  char *alloc_slot(int *slot);
+  void  free_slot(int slot);
+
+  // By the producer, before the slot is filled again.
+  void invalidate(int slot);
+  // By the server thread, when the stream has been filled.
+  void publish(int slot,size_t filled);
+
+protected:
+  char   *_name;
+
+  char   *_ptr;
+  size_t  _len;
+
+  lmd_stream_shm_control *_ctrl;
+  volatile uint32        *_ring;
+  lmd_stream_shm_slot    *_slots;
+  char                   *_data;
+
+  int    *_free_slots;
+  int     _num_free;
+};
+
+// Client (input shm://NAME).
+
+class lmd_input_shm_stream :
+  public lmd_input_tcp
+{
+public:
+  lmd_input_shm_stream();
+  virtual ~lmd_input_shm_stream();
+
+public:
+  virtual size_t connect(const char *name);
+  virtual void close();
+
+  virtual void disconnect();
+
+  virtual size_t get_buffer(void *buf,size_t count);
+
+  virtual size_t preferred_min_buffer_size();
+
+protected:
+  bool copy_stream(void *buf,size_t *filled);
+
+  size_t deliver_staged(void *buf,size_t count);
+
+protected:
+  char   *_ptr;
+  size_t  _len;
+
+  const lmd_stream_shm_control *_ctrl;
+  const volatile uint32        *_ring;
+  const lmd_stream_shm_slot    *_slots;
+  const char                   *_data;
+
+  size_t  _stream_size;
+
+  uint64  _next;  // publish number of next stream to deliver
+
+  uint64  _lost;  // streams overwritten before we got them
+
+  // Stream that did not fit the destination at once.
+  char   *_stage;
+  size_t  _stage_size;
+  size_t  _stage_offset;
+};
+
+#endif//__LMD_STREAM_SHM_HH__
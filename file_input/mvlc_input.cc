@@ -343,8 +343,8 @@ void mvlc_event::locate_subevents(mvlc_event_hint * /*hints*/) {
   _subevents = (mvlc_subevent *)_wt._defrag_buffer->allocate_reclaim(
       sizeof(mvlc_subevent) * MAX_SUBEVENTS);
 #else
-  _subevents = (mvlc_subevent *)_defrag_event.allocate(sizeof(mvlc_subevent) *
-                                                       MAX_SUBEVENTS);
+  _subevents = (mvlc_subevent *)_defrag_event_many.allocate(
+      sizeof(mvlc_subevent) * MAX_SUBEVENTS);
 #endif
 
   _nsubevents = 0;
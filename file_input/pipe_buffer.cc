@@ -21,6 +21,7 @@
 #include "pipe_buffer.hh"
 #include "error.hh"
 #include "set_thread_name.hh"
+#include "huge_pages.hh"
 
 #include <fcntl.h>
 #include <unistd.h>
@@ -446,6 +447,16 @@ int pipe_buffer_base::map_range(off_t start,off_t end,buf_chunk chunks[2])
   return 2;
 }
 
+// All input (from any buffer) that has been consumed.  Only counted
+// for the page fault statistics (_huge_pages_stat).
+uint64_t _input_bytes_released = 0;
+
+uint64_t input_bytes_released()
+{
+  // Atomic read also of the 64-bit value on 32-bit machines.
+  return __sync_fetch_and_add(&_input_bytes_released,(uint64_t) 0);
+}
+
 void pipe_buffer_base::release_to(off_t end)
 {
   // We're done with all data up to the @end location
@@ -453,6 +464,10 @@ void pipe_buffer_base::release_to(off_t end)
   // This means that we can move the read pointer forward, and if
   // necessary, also release the thread doing the reading
 
+  if (UNLIKELY(_huge_pages_stat))
+    __sync_fetch_and_add(&_input_bytes_released,
+			 (uint64_t) ((size_t) end - _done));
+
   _done = (size_t) end;
 
   // Now, if the reader has requested a signal to be sent, we'll do
@@ -505,10 +520,10 @@ void pipe_buffer_base::init(unsigned char *push_magic,size_t push_magic_len,
 #endif
 			    )
 {
-  // Hmm, we should really try to make sure we get a page-aligned
-  // buffer!
+  // With --huge-pages, the buffer is page-aligned and huge page
+  // backed.
 
-  _buffer = (char *) malloc(bufsize);
+  _buffer = (char *) huge_pages_alloc(bufsize);
 
   if (!_buffer)
     ERROR("Memory allocation failure.");
@@ -550,7 +565,8 @@ void pipe_buffer_base::realloc(size_t bufsize)
 
   assert (_avail == 0 && _done == 0);
 
-  _buffer = (char *) ::realloc(_buffer, bufsize);
+  huge_pages_free(_buffer);
+  _buffer = (char *) huge_pages_alloc(bufsize);
 
   if (!_buffer)
     ERROR("Memory allocation failure.");
@@ -644,7 +660,7 @@ pipe_buffer_base::pipe_buffer_base()
 
 pipe_buffer_base::~pipe_buffer_base()
 {
-  free(_buffer);
+  huge_pages_free(_buffer);
   _buffer = NULL;
 }
 
@@ -39,6 +39,12 @@ struct pbf_reclaim
 };
 #endif
 
+// Total amount of input consumed (released), for statistics.
+// Updated atomically (by several input threads).
+extern uint64_t _input_bytes_released;
+
+uint64_t input_bytes_released();
+
 class pipe_buffer_base
   : public input_buffer
 {
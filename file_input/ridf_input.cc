@@ -214,7 +214,7 @@ void ridf_event::locate_subevents(ridf_event_hint *hints)
   _subevents = (ridf_subevent *)_wt._defrag_buffer->allocate_reclaim(
       hints->_max_subevents * sizeof (ridf_subevent));
 #else
-  _subevents = (ridf_subevent *)_defrag_event.allocate(
+  _subevents = (ridf_subevent *)_defrag_event_many.allocate(
       hints->_max_subevents * sizeof (ridf_subevent));
 #endif
 
@@ -234,8 +234,10 @@ void ridf_event::locate_subevents(ridf_event_hint *hints)
           _subevents,
           _nsubevents * sizeof (ridf_subevent));
 #else
-      _subevents = (ridf_subevent *)_defrag_event.allocate(
-          hints->_max_subevents * sizeof (ridf_subevent));
+      _subevents = (ridf_subevent *)_defrag_event_many.allocate_copy(
+          hints->_max_subevents * sizeof (ridf_subevent),
+          _subevents,
+          _nsubevents * sizeof (ridf_subevent));
 #endif
     }
 
@@ -21,12 +21,70 @@
 #include "tcp_pipe_buffer.hh"
 
 #include "lmd_input_tcp.hh"
+#include "lmd_event.hh"
 
 #include <signal.h>
+#include <string.h>
 
 tcp_pipe_buffer::tcp_pipe_buffer()
 {
   _server = NULL;
+  _server_name = NULL;
+}
+
+size_t tcp_pipe_buffer::get_server_buffer(void *buf,size_t count)
+{
+  size_t n;
+
+  try
+    {
+      n = _server->get_buffer(buf,count);
+    }
+  catch (error &e)
+    {
+      if (!_server->_reconnect)
+	WARNING("Closing this input...");
+      n = 0;
+    }
+
+  if (n || !_server->_reconnect)
+    return n;
+
+  // Get a new connection, and let the reader (lmd_source) know that
+  // the buffer numbering starts over.
+
+  _server->disconnect();
+
+  WARNING("Lost connection to %s, reconnecting...",_server_name);
+
+  double t_lost = lmd_input_tcp_time();
+
+  size_t minsize;
+
+  try
+    {
+      minsize = _server->connect_retry(_server_name);
+    }
+  catch (error &e)
+    {
+      WARNING("Closing this input...");
+      return 0;
+    }
+
+  if (minsize > _size)
+    {
+      WARNING("Server chunks (%zd kiB) now larger than "
+	      "prefetch buffer (%zd MiB), giving up.",
+	      minsize >> 10, _size >> 20);
+      return 0;
+    }
+
+  INFO(0,"Reconnected to %s after %.1f s.",
+       _server_name, lmd_input_tcp_time() - t_lost);
+
+  _server->create_reconnect_buffer(buf);
+
+  return sizeof (s_bufhe_host);
 }
 
 
@@ -92,17 +150,7 @@ void *tcp_pipe_buffer::reader()
       printf ("_done: %08x  _avail: %08x  (space: %08x  segment: %08x)\n",
 	      _done,_avail,space,segment);
       */
-      size_t n;
-
-      try
-	{
-	  n = _server->get_buffer(_buffer + offset,segment);
-	}
-      catch (error &e)
-	{
-	  WARNING("Closing this input...");
-	  n = 0;
-	}
+      size_t n = get_server_buffer(_buffer + offset,segment);
 
       //printf ("got:%08x\n",n);
 
@@ -185,17 +233,7 @@ int tcp_pipe_buffer::read_now(off_t end)
       // header noting this, that eats the space up to the end,
       // then we'll have to be called again later
 
-      size_t n;
-
-      try
-	{
-	  n = _server->get_buffer(_buffer + offset,segment);
-	}
-      catch (error &e)
-	{
-	  WARNING("Closing this input...");
-	  n = 0;
-	}
+      size_t n = get_server_buffer(_buffer + offset,segment);
 
       if (n == 0)
 	{
@@ -216,13 +254,15 @@ int tcp_pipe_buffer::read_now(off_t end)
 
 
 
-void tcp_pipe_buffer::init(lmd_input_tcp *server,size_t bufsize
+void tcp_pipe_buffer::init(lmd_input_tcp *server,const char *server_name,
+			   size_t bufsize
 #ifdef USE_PTHREAD
 			   ,thread_block *block_reader
 #endif
 			   )
 {
   _server = server;
+  _server_name = strdup(server_name);
 
   pipe_buffer_base::init(NULL,0,bufsize
 #ifdef USE_PTHREAD
@@ -241,5 +281,8 @@ void tcp_pipe_buffer::close()
       delete _server;
       _server = NULL;
     }
+
+  free(_server_name);
+  _server_name = NULL;
 }
 
@@ -34,6 +34,10 @@ public:
 
 public:
   lmd_input_tcp *_server;
+  char          *_server_name;
+
+protected:
+  size_t get_server_buffer(void *buf,size_t count);
 
 #ifdef USE_PTHREAD
 public:
@@ -44,7 +48,8 @@ public:
 #endif
 
 public:
-  void init(lmd_input_tcp *server,size_t bufsize
+  void init(lmd_input_tcp *server,const char *server_name,
+	    size_t bufsize
 #ifdef USE_PTHREAD
 	    ,thread_block *block_reader
 #endif
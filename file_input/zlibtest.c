@@ -0,0 +1,8 @@
+#include <zlib.h>
+
+int main()
+{
+  z_stream zs;
+  deflateInit2(&zs,6,Z_DEFLATED,15 + 16,8,Z_DEFAULT_STRATEGY);
+  return 0;
+}
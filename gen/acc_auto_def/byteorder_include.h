@@ -0,0 +1,100 @@
+/*********************************************************************
+ *
+ * This file is autogenerated by /root/repo/lu_common/make_acc_auto_def.sh
+ *
+ * Editing is useless.
+ *
+ *********************************************************************
+ *
+ * Input file:    /root/repo/acc_def/byteorder_include.h
+ * Basename:      BYTEORDER_INCLUDE
+ * Compiler:      g++
+ * Compiler args: 
+ *
+ ********************************************************************/
+
+#ifndef __AUTO_DEF__BYTEORDER_INCLUDE_HH__
+#define __AUTO_DEF__BYTEORDER_INCLUDE_HH__
+
+/*
+ * Option: byteorder_h
+ * Option: bsd_bsd_byteorder_h
+ * Option: endian_h
+ * Option: sys_endian_h
+ * Option: machine_endian_h
+ * Option: machine_byte_order_h
+ * Option: sys_types_h_stdint_h
+ */
+/*
+ * -DACC_DEF_BYTEORDER_INCLUDE_byteorder_h
+
+/root/repo/acc_def/byteorder_include.h:29:11: fatal error: byteorder.h: No such file or directory
+   29 | # include "byteorder.h"
+      |           ^~~~~~~~~~~~~
+compilation terminated.
+
+ * --> exit 1 (len 185)
+ */
+/*
+ * -DACC_DEF_BYTEORDER_INCLUDE_bsd_bsd_byteorder_h
+
+/root/repo/acc_def/byteorder_include.h:32:11: fatal error: bsd/bsd_byteorder.h: No such file or directory
+   32 | # include "bsd/bsd_byteorder.h"
+      |           ^~~~~~~~~~~~~~~~~~~~~
+compilation terminated.
+
+ * --> exit 1 (len 209)
+ */
+/*
+ * -DACC_DEF_BYTEORDER_INCLUDE_endian_h
+
+
+
+ * --> exit 0 (len 0)
+ */
+/*
+ * -DACC_DEF_BYTEORDER_INCLUDE_sys_endian_h
+
+/root/repo/acc_def/byteorder_include.h:38:11: fatal error: sys/endian.h: No such file or directory
+   38 | # include "sys/endian.h"
+      |           ^~~~~~~~~~~~~~
+compilation terminated.
+
+ * --> exit 1 (len 188)
+ */
+/*
+ * -DACC_DEF_BYTEORDER_INCLUDE_machine_endian_h
+
+/root/repo/acc_def/byteorder_include.h:41:11: fatal error: machine/endian.h: No such file or directory
+   41 | # include "machine/endian.h"
+      |           ^~~~~~~~~~~~~~~~~~
+compilation terminated.
+
+ * --> exit 1 (len 200)
+ */
+/*
+ * -DACC_DEF_BYTEORDER_INCLUDE_machine_byte_order_h
+
+/root/repo/acc_def/byteorder_include.h:68:3: error: #error BYTE_ORDER not defined
+   68 | # error BYTE_ORDER not defined
+      |   ^~~~~
+
+ * --> exit 1 (len 136)
+ */
+/*
+ * -DACC_DEF_BYTEORDER_INCLUDE_sys_types_h_stdint_h
+
+/root/repo/acc_def/byteorder_include.h:68:3: error: #error BYTE_ORDER not defined
+   68 | # error BYTE_ORDER not defined
+      |   ^~~~~
+
+ * --> exit 1 (len 136)
+ */
+
+/********************************************************************/
+
+#define ACC_DEF_BYTEORDER_INCLUDE_endian_h 1
+
+/********************************************************************/
+
+#endif/*__AUTO_DEF__BYTEORDER_INCLUDE_HH__*/
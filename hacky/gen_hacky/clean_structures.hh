@@ -0,0 +1,475 @@
+class CAMAC_LECROY_4434
+{
+  raw_array_zero_suppress<DATA24,DATA24,32> data;
+template<typename __data_src_t>
+  void __unpack(__data_src_t &__buffer,uint32 channels);
+template<typename __data_src_t>
+  static bool __match(__data_src_t &__buffer,uint32 channels);
+  STRUCT_FCNS_DECL(CAMAC_LECROY_4434);
+};
+class CAMAC_PHILLIPS_7164
+{
+  raw_array_zero_suppress<DATA12,DATA12,16> data;
+template<typename __data_src_t>
+  void __unpack(__data_src_t &__buffer,uint32 channels,uint32 mark_channel_no);
+template<typename __data_src_t>
+  static bool __match(__data_src_t &__buffer,uint32 channels,uint32 mark_channel_no);
+  STRUCT_FCNS_DECL(CAMAC_PHILLIPS_7164);
+};
+class CAMAC_SILENA_4418
+{
+  raw_array_zero_suppress<DATA12_OVERFLOW,DATA12_OVERFLOW,8> data;
+template<typename __data_src_t>
+  void __unpack(__data_src_t &__buffer,uint32 channels,uint32 mark_channel_no);
+template<typename __data_src_t>
+  static bool __match(__data_src_t &__buffer,uint32 channels,uint32 mark_channel_no);
+  STRUCT_FCNS_DECL(CAMAC_SILENA_4418);
+};
+class FASTBUS_LECROY_1875
+{
+  raw_array_zero_suppress<DATA12_RANGE,DATA12_RANGE,64> data;
+template<typename __data_src_t>
+  void __unpack(__data_src_t &__buffer,uint32 geom,uint32 channels);
+template<typename __data_src_t>
+  static bool __match(__data_src_t &__buffer,uint32 geom,uint32 channels);
+  STRUCT_FCNS_DECL(FASTBUS_LECROY_1875);
+};
+class FASTBUS_LECROY_1885
+{
+  raw_array_zero_suppress<DATA12_RANGE,DATA12_RANGE,96> data;
+template<typename __data_src_t>
+  void __unpack(__data_src_t &__buffer,uint32 geom,uint32 channels);
+template<typename __data_src_t>
+  static bool __match(__data_src_t &__buffer,uint32 geom,uint32 channels);
+  STRUCT_FCNS_DECL(FASTBUS_LECROY_1885);
+};
+class VME_CAEN_V1190_SUBTDC
+{
+  union
+  {
+    struct
+    {
+      uint32 bunch_id : 12;
+      uint32 event_id : 12;
+      uint32 tdc : 2;
+      uint32 dummy_26 : 1;
+      uint32 unnamed_27_31 : 5;
+    };
+    uint32 u32;
+  } header;
+  union
+  {
+    struct
+    {
+      uint32 flags : 15;
+      uint32 dummy_15_23 : 9;
+      uint32 tdc : 2;
+      uint32 dummy_26 : 1;
+      uint32 unnamed_27_31 : 5;
+    };
+    uint32 u32;
+  } error_flags;
+  union
+  {
+    struct
+    {
+      uint32 word_count : 12;
+      uint32 event_id : 12;
+      uint32 tdc : 2;
+      uint32 dummy_26 : 1;
+      uint32 unnamed_27_31 : 5;
+    };
+    uint32 u32;
+  } trailer;
+template<typename __data_src_t>
+  void __unpack(__data_src_t &__buffer,uint32 tdc,uint32 event_id,raw_array_multi_zero_suppress<DATA24,DATA24,32,128> &data);
+template<typename __data_src_t>
+  static bool __match(__data_src_t &__buffer,uint32 tdc,uint32 event_id);
+  STRUCT_FCNS_DECL(VME_CAEN_V1190_SUBTDC);
+};
+class VME_CAEN_V1190
+{
+  raw_array_multi_zero_suppress<DATA24,DATA24,32,128> data;
+  union
+  {
+    struct
+    {
+      uint32 geom : 5;
+      uint32 event_number : 22;
+      uint32 unnamed_27_31 : 5;
+    };
+    uint32 u32;
+  } header;
+  SINGLE(VME_CAEN_V1190_SUBTDC,tdc[4]);
+  union
+  {
+    struct
+    {
+      uint32 time_tag : 27;
+      uint32 unnamed_27_31 : 5;
+    };
+    uint32 u32;
+  } trigger;
+  union
+  {
+    struct
+    {
+      uint32 geom : 5;
+      uint32 word_count : 15;
+      uint32 dummy_20_23 : 4;
+      uint32 tdc_error : 1;
+      uint32 buffer_overflow : 1;
+      uint32 trigger_lost : 1;
+      uint32 unnamed_27_31 : 5;
+    };
+    uint32 u32;
+  } trailer;
+template<typename __data_src_t>
+  void __unpack(__data_src_t &__buffer,uint32 geom);
+template<typename __data_src_t>
+  static bool __match(__data_src_t &__buffer,uint32 geom);
+  STRUCT_FCNS_DECL(VME_CAEN_V1190);
+};
+class VME_CAEN_V1190_SHORT_SUBTDC
+{
+template<typename __data_src_t>
+  void __unpack(__data_src_t &__buffer,uint32 tdc,uint32 event_id,raw_array_multi_zero_suppress<DATA24,DATA24,32,128> &data);
+template<typename __data_src_t>
+  static bool __match(__data_src_t &__buffer,uint32 tdc,uint32 event_id);
+  STRUCT_FCNS_DECL(VME_CAEN_V1190_SHORT_SUBTDC);
+};
+class VME_CAEN_V1190_SHORT_SUBTDC_ERROR
+{
+  union
+  {
+    struct
+    {
+      uint32 flags : 15;
+      uint32 dummy_15_23 : 9;
+      uint32 tdc : 2;
+      uint32 dummy_26 : 1;
+      uint32 unnamed_27_31 : 5;
+    };
+    uint32 u32;
+  } error_flags;
+template<typename __data_src_t>
+  void __unpack(__data_src_t &__buffer,uint32 tdc);
+template<typename __data_src_t>
+  static bool __match(__data_src_t &__buffer,uint32 tdc);
+  STRUCT_FCNS_DECL(VME_CAEN_V1190_SHORT_SUBTDC_ERROR);
+};
+class VME_CAEN_V1190_SHORT
+{
+  raw_array_multi_zero_suppress<DATA24,DATA24,32,128> data;
+  union
+  {
+    struct
+    {
+      uint32 geom : 5;
+      uint32 event_number : 22;
+      uint32 unnamed_27_31 : 5;
+    };
+    uint32 u32;
+  } header;
+  SINGLE(VME_CAEN_V1190_SHORT_SUBTDC,tdc[4]);
+  SINGLE(VME_CAEN_V1190_SHORT_SUBTDC_ERROR,err[4]);
+  union
+  {
+    struct
+    {
+      uint32 time_tag : 27;
+      uint32 unnamed_27_31 : 5;
+    };
+    uint32 u32;
+  } trigger;
+  union
+  {
+    struct
+    {
+      uint32 geom : 5;
+      uint32 word_count : 15;
+      uint32 dummy_20_23 : 4;
+      uint32 tdc_error : 1;
+      uint32 buffer_overflow : 1;
+      uint32 trigger_lost : 1;
+      uint32 unnamed_27_31 : 5;
+    };
+    uint32 u32;
+  } trailer;
+template<typename __data_src_t>
+  void __unpack(__data_src_t &__buffer,uint32 geom);
+template<typename __data_src_t>
+  static bool __match(__data_src_t &__buffer,uint32 geom);
+  STRUCT_FCNS_DECL(VME_CAEN_V1190_SHORT);
+};
+class VME_CAEN_V1290_SUBTDC
+{
+  union
+  {
+    struct
+    {
+      uint32 bunch_id : 12;
+      uint32 event_id : 12;
+      uint32 tdc : 2;
+      uint32 dummy_26 : 1;
+      uint32 unnamed_27_31 : 5;
+    };
+    uint32 u32;
+  } header;
+  union
+  {
+    struct
+    {
+      uint32 flags : 15;
+      uint32 dummy_15_23 : 9;
+      uint32 tdc : 2;
+      uint32 dummy_26 : 1;
+      uint32 unnamed_27_31 : 5;
+    };
+    uint32 u32;
+  } error_flags;
+  union
+  {
+    struct
+    {
+      uint32 word_count : 12;
+      uint32 event_id : 12;
+      uint32 tdc : 2;
+      uint32 dummy_26 : 1;
+      uint32 unnamed_27_31 : 5;
+    };
+    uint32 u32;
+  } trailer;
+template<typename __data_src_t>
+  void __unpack(__data_src_t &__buffer,uint32 tdc,uint32 event_id,raw_array_multi_zero_suppress<DATA24,DATA24,32,128> &data);
+template<typename __data_src_t>
+  static bool __match(__data_src_t &__buffer,uint32 tdc,uint32 event_id);
+  STRUCT_FCNS_DECL(VME_CAEN_V1290_SUBTDC);
+};
+class VME_CAEN_V1290
+{
+  raw_array_multi_zero_suppress<DATA24,DATA24,32,128> data;
+  union
+  {
+    struct
+    {
+      uint32 geom : 5;
+      uint32 event_number : 22;
+      uint32 unnamed_27_31 : 5;
+    };
+    uint32 u32;
+  } header;
+  SINGLE(VME_CAEN_V1290_SUBTDC,tdc[4]);
+  union
+  {
+    struct
+    {
+      uint32 time_tag : 27;
+      uint32 unnamed_27_31 : 5;
+    };
+    uint32 u32;
+  } trigger;
+  union
+  {
+    struct
+    {
+      uint32 geom : 5;
+      uint32 word_count : 15;
+      uint32 dummy_20_23 : 4;
+      uint32 tdc_error : 1;
+      uint32 buffer_overflow : 1;
+      uint32 trigger_lost : 1;
+      uint32 unnamed_27_31 : 5;
+    };
+    uint32 u32;
+  } trailer;
+template<typename __data_src_t>
+  void __unpack(__data_src_t &__buffer,uint32 geom);
+template<typename __data_src_t>
+  static bool __match(__data_src_t &__buffer,uint32 geom);
+  STRUCT_FCNS_DECL(VME_CAEN_V1290);
+};
+class VME_CAEN_V1290_SHORT_SUBTDC
+{
+template<typename __data_src_t>
+  void __unpack(__data_src_t &__buffer,uint32 tdc,uint32 event_id,raw_array_multi_zero_suppress<DATA24,DATA24,32,128> &data);
+template<typename __data_src_t>
+  static bool __match(__data_src_t &__buffer,uint32 tdc,uint32 event_id);
+  STRUCT_FCNS_DECL(VME_CAEN_V1290_SHORT_SUBTDC);
+};
+class VME_CAEN_V1290_SHORT_SUBTDC_ERROR
+{
+  union
+  {
+    struct
+    {
+      uint32 flags : 15;
+      uint32 dummy_15_23 : 9;
+      uint32 tdc : 2;
+      uint32 dummy_26 : 1;
+      uint32 unnamed_27_31 : 5;
+    };
+    uint32 u32;
+  } error_flags;
+template<typename __data_src_t>
+  void __unpack(__data_src_t &__buffer,uint32 tdc);
+template<typename __data_src_t>
+  static bool __match(__data_src_t &__buffer,uint32 tdc);
+  STRUCT_FCNS_DECL(VME_CAEN_V1290_SHORT_SUBTDC_ERROR);
+};
+class VME_CAEN_V1290_SHORT
+{
+  raw_array_multi_zero_suppress<DATA24,DATA24,32,128> data;
+  union
+  {
+    struct
+    {
+      uint32 geom : 5;
+      uint32 event_number : 22;
+      uint32 unnamed_27_31 : 5;
+    };
+    uint32 u32;
+  } header;
+  SINGLE(VME_CAEN_V1290_SHORT_SUBTDC,tdc[4]);
+  SINGLE(VME_CAEN_V1290_SHORT_SUBTDC_ERROR,err[4]);
+  union
+  {
+    struct
+    {
+      uint32 time_tag : 27;
+      uint32 unnamed_27_31 : 5;
+    };
+    uint32 u32;
+  } trigger;
+  union
+  {
+    struct
+    {
+      uint32 geom : 5;
+      uint32 word_count : 15;
+      uint32 dummy_20_23 : 4;
+      uint32 tdc_error : 1;
+      uint32 buffer_overflow : 1;
+      uint32 trigger_lost : 1;
+      uint32 unnamed_27_31 : 5;
+    };
+    uint32 u32;
+  } trailer;
+template<typename __data_src_t>
+  void __unpack(__data_src_t &__buffer,uint32 geom);
+template<typename __data_src_t>
+  static bool __match(__data_src_t &__buffer,uint32 geom);
+  STRUCT_FCNS_DECL(VME_CAEN_V1290_SHORT);
+};
+class VME_CAEN_V775
+{
+  raw_array_zero_suppress<DATA12_OVERFLOW,DATA12_OVERFLOW,32> data;
+  union
+  {
+    struct
+    {
+      uint32 event_number : 24;
+      uint32 unnamed_24_26 : 3;
+      uint32 geom : 5;
+    };
+    uint32 u32;
+  } eob;
+template<typename __data_src_t>
+  void __unpack(__data_src_t &__buffer,uint32 geom,uint32 crate);
+template<typename __data_src_t>
+  static bool __match(__data_src_t &__buffer,uint32 geom,uint32 crate);
+  STRUCT_FCNS_DECL(VME_CAEN_V775);
+};
+class VME_CAEN_V830
+{
+  raw_array_zero_suppress<DATA32,DATA32,32> data;
+  union
+  {
+    struct
+    {
+      uint32 event_number : 16;
+      uint32 ts : 2;
+      uint32 count : 6;
+      uint32 dummy_24_25 : 2;
+      uint32 unnamed_26_26 : 1;
+      uint32 geom : 5;
+    };
+    uint32 u32;
+  } header;
+template<typename __data_src_t>
+  void __unpack(__data_src_t &__buffer,uint32 geom);
+template<typename __data_src_t>
+  static bool __match(__data_src_t &__buffer,uint32 geom);
+  STRUCT_FCNS_DECL(VME_CAEN_V830);
+};
+class VME_MESYTEC_MADC32
+{
+  raw_array_zero_suppress<DATA14_OVERFLOW,DATA14_OVERFLOW,32> data;
+  union
+  {
+    struct
+    {
+      uint32 counter : 30;
+      uint32 unnamed_30_31 : 2;
+    };
+    uint32 u32;
+  } end_of_event;
+template<typename __data_src_t>
+  void __unpack(__data_src_t &__buffer,uint32 geom);
+template<typename __data_src_t>
+  static bool __match(__data_src_t &__buffer,uint32 geom);
+  STRUCT_FCNS_DECL(VME_MESYTEC_MADC32);
+};
+class VME_MESYTEC_MDPP16
+{
+  raw_array_multi_zero_suppress<DATA16_OVERFLOW,DATA16_OVERFLOW,16,20> adc;
+  raw_array_multi_zero_suppress<DATA16_OVERFLOW,DATA16_OVERFLOW,16,20> tdc;
+  raw_array_multi_zero_suppress<DATA16_OVERFLOW,DATA16_OVERFLOW,16,20> trig_tdc;
+  raw_array_multi_zero_suppress<DATA16_OVERFLOW,DATA16_OVERFLOW,16,20> adc_short;
+  union
+  {
+    struct
+    {
+      uint32 counter : 30;
+      uint32 unnamed_30_31 : 2;
+    };
+    uint32 u32;
+  } end_of_event;
+template<typename __data_src_t>
+  void __unpack(__data_src_t &__buffer,uint32 geom);
+template<typename __data_src_t>
+  static bool __match(__data_src_t &__buffer,uint32 geom);
+  STRUCT_FCNS_DECL(VME_MESYTEC_MDPP16);
+};
+class CROS3_SUBEVENT
+ : public unpack_subevent_base
+{
+  SINGLE(EXTERNAL_DATA16,data16);
+template<typename __data_src_t>
+  void __unpack(__data_src_t &__buffer);
+template<typename __data_src_t>
+  static bool __match(__data_src_t &__buffer);
+  STRUCT_FCNS_DECL(CROS3_SUBEVENT);
+};
+class unpack_event : public unpack_event_base
+{
+SINGLE(CROS3_SUBEVENT,cros3);
+  bitsone<1> __visited;
+  void __clear_visited() { __visited.clear(); }
+  subevent_match_cache __match_cache;
+  bool ignore_unknown_subevent() { return false; }
+template<typename __data_src_t>
+  int __unpack_subevent(subevent_header *__header,__data_src_t &__buffer);
+  int __revoke_subevent(subevent_header *__header);
+  STRUCT_FCNS_DECL(unpack_event);
+};
+class unpack_sticky_event : public unpack_sticky_event_base
+{
+  void __clear_visited() { }
+  subevent_match_cache __match_cache;
+  bool ignore_unknown_subevent() { return false; }
+template<typename __data_src_t>
+  int __unpack_subevent(subevent_header *__header,__data_src_t &__buffer);
+  int __revoke_subevent(subevent_header *__header);
+  STRUCT_FCNS_DECL(unpack_sticky_event);
+};
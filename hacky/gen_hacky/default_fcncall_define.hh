@@ -0,0 +1,62 @@
+/***********************************************************************
+ *
+ * Default define for fcncall,
+ *
+ * Do not edit - automatically generated.
+ */
+
+#ifndef               FCNCALL_CALL_CTRL_WRAP
+#define __DEFAULT_DEF_FCNCALL_CALL_CTRL_WRAP
+#define               FCNCALL_CALL_CTRL_WRAP(ctrl,call) call
+#endif
+
+#ifndef               FCNCALL_CALL_CTRL_WRAP_ARRAY
+#define __DEFAULT_DEF_FCNCALL_CALL_CTRL_WRAP_ARRAY
+#define               FCNCALL_CALL_CTRL_WRAP_ARRAY(ctrl_name,ctrl_non_last_index,ctrl_last_index,call) call
+#endif
+
+#ifndef               FCNCALL_INIT
+#define __DEFAULT_DEF_FCNCALL_INIT
+#define               FCNCALL_INIT ((void)0)
+#endif
+
+#ifndef               FCNCALL_RET
+#define __DEFAULT_DEF_FCNCALL_RET
+#define               FCNCALL_RET ((void)0)
+#endif
+
+#ifndef               FCNCALL_RET_TYPE
+#define __DEFAULT_DEF_FCNCALL_RET_TYPE
+#define               FCNCALL_RET_TYPE void
+#endif
+
+#ifndef               FCNCALL_SUBINDEX
+#define __DEFAULT_DEF_FCNCALL_SUBINDEX
+#define               FCNCALL_SUBINDEX(index) ((void)0)
+#endif
+
+#ifndef               FCNCALL_SUBINDEX_END
+#define __DEFAULT_DEF_FCNCALL_SUBINDEX_END
+#define               FCNCALL_SUBINDEX_END(index) ((void)0)
+#endif
+
+#ifndef               FCNCALL_SUBNAME
+#define __DEFAULT_DEF_FCNCALL_SUBNAME
+#define               FCNCALL_SUBNAME(name) ((void)0)
+#endif
+
+#ifndef               FCNCALL_SUBNAME_END
+#define __DEFAULT_DEF_FCNCALL_SUBNAME_END
+#define               FCNCALL_SUBNAME_END ((void)0)
+#endif
+
+#ifndef               FCNCALL_TEMPLATE
+#define __DEFAULT_DEF_FCNCALL_TEMPLATE
+#define               FCNCALL_TEMPLATE 
+#endif
+
+#ifndef               FCNCALL_UNIT
+#define __DEFAULT_DEF_FCNCALL_UNIT
+#define               FCNCALL_UNIT(unit) ((void)0)
+#endif
+
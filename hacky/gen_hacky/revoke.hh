@@ -0,0 +1,52 @@
+/** BEGIN_REVOKE *******************************************************
+ *
+ * Event revoker for EVENT.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// EVENT
+int unpack_event::__revoke_subevent(subevent_header *__header)
+  // cros3 = CROS3_SUBEVENT(type=10,subtype=1,control=9);
+{
+  int __match_no = 0;
+  SUBEVENT_MATCH_CACHE_LOOKUP(__match_no)
+  {
+    MATCH_SUBEVENT_DECL(733,__match_no,1,((VES10_1_type==10)&&(VES10_1_subtype==1)&&(VES10_1_control==9)),cros3);
+    SUBEVENT_MATCH_CACHE_STORE(__match_no);
+  }
+  if (!__match_no) return 0;
+  switch (__match_no)
+  {
+    case 1:
+      UNPACK_SUBEVENT_CHECK_NO_REVISIT(733,CROS3_SUBEVENT,cros3,0);
+      REVOKE_SUBEVENT_DECL(733,0,CROS3_SUBEVENT,cros3);
+      break;
+  }
+  return 0;
+}
+
+/** END_REVOKE ********************************************************/
+/** BEGIN_REVOKE *******************************************************
+ *
+ * Event revoker for EVENT.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// STICKY_EVENT
+int unpack_sticky_event::__revoke_subevent(subevent_header *__header)
+{
+  int __match_no = 0;
+  SUBEVENT_MATCH_CACHE_LOOKUP(__match_no)
+  {
+    SUBEVENT_MATCH_CACHE_STORE(__match_no);
+  }
+  if (!__match_no) return 0;
+  switch (__match_no)
+  {
+  }
+  return 0;
+}
+
+/** END_REVOKE ********************************************************/
@@ -0,0 +1,1724 @@
+/** BEGIN_FUNCTION_CALL_PER_MEMBER *************************************
+ *
+ * Recursive function calls per member.
+ *
+ * Do not edit - automatically generated.
+ */
+
+#include "gen/default_fcncall_define.hh"
+
+#ifndef USER_DEF_CAMAC_LECROY_4434
+FCNCALL_TEMPLATE
+FCNCALL_RET_TYPE FCNCALL_CLASS_NAME(CAMAC_LECROY_4434)::FCNCALL_NAME(CAMAC_LECROY_4434)
+{
+  FCNCALL_INIT;
+  // raw_array_zero_suppress<DATA24,DATA24,32> data;
+  {
+  FCNCALL_SUBNAME("data");
+  { FCNCALL_CALL_CTRL_WRAP(data,data.FCNCALL_CALL(data)); }
+  FCNCALL_SUBNAME_END;
+  }
+  FCNCALL_RET;
+}
+#endif//USER_DEF_CAMAC_LECROY_4434
+
+#ifndef USER_DEF_CAMAC_PHILLIPS_7164
+FCNCALL_TEMPLATE
+FCNCALL_RET_TYPE FCNCALL_CLASS_NAME(CAMAC_PHILLIPS_7164)::FCNCALL_NAME(CAMAC_PHILLIPS_7164)
+{
+  FCNCALL_INIT;
+  // raw_array_zero_suppress<DATA12,DATA12,16> data;
+  {
+  FCNCALL_SUBNAME("data");
+  { FCNCALL_CALL_CTRL_WRAP(data,data.FCNCALL_CALL(data)); }
+  FCNCALL_SUBNAME_END;
+  }
+  FCNCALL_RET;
+}
+#endif//USER_DEF_CAMAC_PHILLIPS_7164
+
+#ifndef USER_DEF_CAMAC_SILENA_4418
+FCNCALL_TEMPLATE
+FCNCALL_RET_TYPE FCNCALL_CLASS_NAME(CAMAC_SILENA_4418)::FCNCALL_NAME(CAMAC_SILENA_4418)
+{
+  FCNCALL_INIT;
+  // raw_array_zero_suppress<DATA12_OVERFLOW,DATA12_OVERFLOW,8> data;
+  {
+  FCNCALL_SUBNAME("data");
+  { FCNCALL_CALL_CTRL_WRAP(data,data.FCNCALL_CALL(data)); }
+  FCNCALL_SUBNAME_END;
+  }
+  FCNCALL_RET;
+}
+#endif//USER_DEF_CAMAC_SILENA_4418
+
+#ifndef USER_DEF_FASTBUS_LECROY_1875
+FCNCALL_TEMPLATE
+FCNCALL_RET_TYPE FCNCALL_CLASS_NAME(FASTBUS_LECROY_1875)::FCNCALL_NAME(FASTBUS_LECROY_1875)
+{
+  FCNCALL_INIT;
+  // raw_array_zero_suppress<DATA12_RANGE,DATA12_RANGE,64> data;
+  {
+  FCNCALL_SUBNAME("data");
+  { FCNCALL_CALL_CTRL_WRAP(data,data.FCNCALL_CALL(data)); }
+  FCNCALL_SUBNAME_END;
+  }
+  FCNCALL_RET;
+}
+#endif//USER_DEF_FASTBUS_LECROY_1875
+
+#ifndef USER_DEF_FASTBUS_LECROY_1885
+FCNCALL_TEMPLATE
+FCNCALL_RET_TYPE FCNCALL_CLASS_NAME(FASTBUS_LECROY_1885)::FCNCALL_NAME(FASTBUS_LECROY_1885)
+{
+  FCNCALL_INIT;
+  // raw_array_zero_suppress<DATA12_RANGE,DATA12_RANGE,96> data;
+  {
+  FCNCALL_SUBNAME("data");
+  { FCNCALL_CALL_CTRL_WRAP(data,data.FCNCALL_CALL(data)); }
+  FCNCALL_SUBNAME_END;
+  }
+  FCNCALL_RET;
+}
+#endif//USER_DEF_FASTBUS_LECROY_1885
+
+#ifndef USER_DEF_VME_CAEN_V1190_SUBTDC
+FCNCALL_TEMPLATE
+FCNCALL_RET_TYPE FCNCALL_CLASS_NAME(VME_CAEN_V1190_SUBTDC)::FCNCALL_NAME(VME_CAEN_V1190_SUBTDC)
+{
+  FCNCALL_INIT;
+  // union 
+  // {
+    // struct 
+    // {
+      // uint32 bunch_id : 12;
+      // uint32 event_id : 12;
+      // uint32 tdc : 2;
+      // uint32 dummy_26 : 1;
+      // uint32 unnamed_27_31 : 5;
+    // } ;
+    // uint32 u32;
+  // } header;
+  {
+  FCNCALL_SUBNAME("header");
+#if !STRUCT_ONLY_LAST_UNION_MEMBER
+  // struct 
+  // {
+    // uint32 bunch_id : 12;
+    // uint32 event_id : 12;
+    // uint32 tdc : 2;
+    // uint32 dummy_26 : 1;
+    // uint32 unnamed_27_31 : 5;
+  // } ;
+  // uint32 bunch_id : 12;
+  {
+  FCNCALL_SUBNAME("bunch_id");
+  { FCNCALL_CALL_CTRL_WRAP(header.bunch_id,FCNCALL_CALL_TYPE/*_BITFIELD*/(uint32,header.bunch_id)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // uint32 event_id : 12;
+  {
+  FCNCALL_SUBNAME("event_id");
+  { FCNCALL_CALL_CTRL_WRAP(header.event_id,FCNCALL_CALL_TYPE/*_BITFIELD*/(uint32,header.event_id)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // uint32 tdc : 2;
+  {
+  FCNCALL_SUBNAME("tdc");
+  { FCNCALL_CALL_CTRL_WRAP(header.tdc,FCNCALL_CALL_TYPE/*_BITFIELD*/(uint32,header.tdc)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // uint32 dummy_26 : 1;
+  {
+  FCNCALL_SUBNAME("dummy_26");
+  { FCNCALL_CALL_CTRL_WRAP(header.dummy_26,FCNCALL_CALL_TYPE/*_BITFIELD*/(uint32,header.dummy_26)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // uint32 unnamed_27_31 : 5;
+  {
+  FCNCALL_SUBNAME("unnamed_27_31");
+  { FCNCALL_CALL_CTRL_WRAP(header.unnamed_27_31,FCNCALL_CALL_TYPE/*_BITFIELD*/(uint32,header.unnamed_27_31)); }
+  FCNCALL_SUBNAME_END;
+  }
+#endif// !STRUCT_ONLY_LAST_UNION_MEMBER
+  // uint32 u32;
+  {
+  FCNCALL_SUBNAME("u32");
+  { FCNCALL_CALL_CTRL_WRAP(header.u32,FCNCALL_CALL_TYPE(uint32,header.u32)); }
+  FCNCALL_SUBNAME_END;
+  }
+  FCNCALL_SUBNAME_END;
+  }
+  // union 
+  // {
+    // struct 
+    // {
+      // uint32 flags : 15;
+      // uint32 dummy_15_23 : 9;
+      // uint32 tdc : 2;
+      // uint32 dummy_26 : 1;
+      // uint32 unnamed_27_31 : 5;
+    // } ;
+    // uint32 u32;
+  // } error_flags;
+  {
+  FCNCALL_SUBNAME("error_flags");
+#if !STRUCT_ONLY_LAST_UNION_MEMBER
+  // struct 
+  // {
+    // uint32 flags : 15;
+    // uint32 dummy_15_23 : 9;
+    // uint32 tdc : 2;
+    // uint32 dummy_26 : 1;
+    // uint32 unnamed_27_31 : 5;
+  // } ;
+  // uint32 flags : 15;
+  {
+  FCNCALL_SUBNAME("flags");
+  { FCNCALL_CALL_CTRL_WRAP(error_flags.flags,FCNCALL_CALL_TYPE/*_BITFIELD*/(uint32,error_flags.flags)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // uint32 dummy_15_23 : 9;
+  {
+  FCNCALL_SUBNAME("dummy_15_23");
+  { FCNCALL_CALL_CTRL_WRAP(error_flags.dummy_15_23,FCNCALL_CALL_TYPE/*_BITFIELD*/(uint32,error_flags.dummy_15_23)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // uint32 tdc : 2;
+  {
+  FCNCALL_SUBNAME("tdc");
+  { FCNCALL_CALL_CTRL_WRAP(error_flags.tdc,FCNCALL_CALL_TYPE/*_BITFIELD*/(uint32,error_flags.tdc)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // uint32 dummy_26 : 1;
+  {
+  FCNCALL_SUBNAME("dummy_26");
+  { FCNCALL_CALL_CTRL_WRAP(error_flags.dummy_26,FCNCALL_CALL_TYPE/*_BITFIELD*/(uint32,error_flags.dummy_26)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // uint32 unnamed_27_31 : 5;
+  {
+  FCNCALL_SUBNAME("unnamed_27_31");
+  { FCNCALL_CALL_CTRL_WRAP(error_flags.unnamed_27_31,FCNCALL_CALL_TYPE/*_BITFIELD*/(uint32,error_flags.unnamed_27_31)); }
+  FCNCALL_SUBNAME_END;
+  }
+#endif// !STRUCT_ONLY_LAST_UNION_MEMBER
+  // uint32 u32;
+  {
+  FCNCALL_SUBNAME("u32");
+  { FCNCALL_CALL_CTRL_WRAP(error_flags.u32,FCNCALL_CALL_TYPE(uint32,error_flags.u32)); }
+  FCNCALL_SUBNAME_END;
+  }
+  FCNCALL_SUBNAME_END;
+  }
+  // union 
+  // {
+    // struct 
+    // {
+      // uint32 word_count : 12;
+      // uint32 event_id : 12;
+      // uint32 tdc : 2;
+      // uint32 dummy_26 : 1;
+      // uint32 unnamed_27_31 : 5;
+    // } ;
+    // uint32 u32;
+  // } trailer;
+  {
+  FCNCALL_SUBNAME("trailer");
+#if !STRUCT_ONLY_LAST_UNION_MEMBER
+  // struct 
+  // {
+    // uint32 word_count : 12;
+    // uint32 event_id : 12;
+    // uint32 tdc : 2;
+    // uint32 dummy_26 : 1;
+    // uint32 unnamed_27_31 : 5;
+  // } ;
+  // uint32 word_count : 12;
+  {
+  FCNCALL_SUBNAME("word_count");
+  { FCNCALL_CALL_CTRL_WRAP(trailer.word_count,FCNCALL_CALL_TYPE/*_BITFIELD*/(uint32,trailer.word_count)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // uint32 event_id : 12;
+  {
+  FCNCALL_SUBNAME("event_id");
+  { FCNCALL_CALL_CTRL_WRAP(trailer.event_id,FCNCALL_CALL_TYPE/*_BITFIELD*/(uint32,trailer.event_id)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // uint32 tdc : 2;
+  {
+  FCNCALL_SUBNAME("tdc");
+  { FCNCALL_CALL_CTRL_WRAP(trailer.tdc,FCNCALL_CALL_TYPE/*_BITFIELD*/(uint32,trailer.tdc)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // uint32 dummy_26 : 1;
+  {
+  FCNCALL_SUBNAME("dummy_26");
+  { FCNCALL_CALL_CTRL_WRAP(trailer.dummy_26,FCNCALL_CALL_TYPE/*_BITFIELD*/(uint32,trailer.dummy_26)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // uint32 unnamed_27_31 : 5;
+  {
+  FCNCALL_SUBNAME("unnamed_27_31");
+  { FCNCALL_CALL_CTRL_WRAP(trailer.unnamed_27_31,FCNCALL_CALL_TYPE/*_BITFIELD*/(uint32,trailer.unnamed_27_31)); }
+  FCNCALL_SUBNAME_END;
+  }
+#endif// !STRUCT_ONLY_LAST_UNION_MEMBER
+  // uint32 u32;
+  {
+  FCNCALL_SUBNAME("u32");
+  { FCNCALL_CALL_CTRL_WRAP(trailer.u32,FCNCALL_CALL_TYPE(uint32,trailer.u32)); }
+  FCNCALL_SUBNAME_END;
+  }
+  FCNCALL_SUBNAME_END;
+  }
+  FCNCALL_RET;
+}
+#endif//USER_DEF_VME_CAEN_V1190_SUBTDC
+
+#ifndef USER_DEF_VME_CAEN_V1190
+FCNCALL_TEMPLATE
+FCNCALL_RET_TYPE FCNCALL_CLASS_NAME(VME_CAEN_V1190)::FCNCALL_NAME(VME_CAEN_V1190)
+{
+  FCNCALL_INIT;
+  // raw_array_multi_zero_suppress<DATA24,DATA24,32,128> data;
+  {
+  FCNCALL_SUBNAME("data");
+  { FCNCALL_CALL_CTRL_WRAP(data,data.FCNCALL_CALL(data)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // union 
+  // {
+    // struct 
+    // {
+      // uint32 geom : 5;
+      // uint32 event_number : 22;
+      // uint32 unnamed_27_31 : 5;
+    // } ;
+    // uint32 u32;
+  // } header;
+  {
+  FCNCALL_SUBNAME("header");
+#if !STRUCT_ONLY_LAST_UNION_MEMBER
+  // struct 
+  // {
+    // uint32 geom : 5;
+    // uint32 event_number : 22;
+    // uint32 unnamed_27_31 : 5;
+  // } ;
+  // uint32 geom : 5;
+  {
+  FCNCALL_SUBNAME("geom");
+  { FCNCALL_CALL_CTRL_WRAP(header.geom,FCNCALL_CALL_TYPE/*_BITFIELD*/(uint32,header.geom)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // uint32 event_number : 22;
+  {
+  FCNCALL_SUBNAME("event_number");
+  { FCNCALL_CALL_CTRL_WRAP(header.event_number,FCNCALL_CALL_TYPE/*_BITFIELD*/(uint32,header.event_number)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // uint32 unnamed_27_31 : 5;
+  {
+  FCNCALL_SUBNAME("unnamed_27_31");
+  { FCNCALL_CALL_CTRL_WRAP(header.unnamed_27_31,FCNCALL_CALL_TYPE/*_BITFIELD*/(uint32,header.unnamed_27_31)); }
+  FCNCALL_SUBNAME_END;
+  }
+#endif// !STRUCT_ONLY_LAST_UNION_MEMBER
+  // uint32 u32;
+  {
+  FCNCALL_SUBNAME("u32");
+  { FCNCALL_CALL_CTRL_WRAP(header.u32,FCNCALL_CALL_TYPE(uint32,header.u32)); }
+  FCNCALL_SUBNAME_END;
+  }
+  FCNCALL_SUBNAME_END;
+  }
+  // VME_CAEN_V1190_SUBTDC tdc[4];
+  {
+  FCNCALL_SUBNAME("tdc");
+  FCNCALL_FOR(__i0,4)
+  {
+    FCNCALL_SUBINDEX(__i0);
+    { FCNCALL_CALL_CTRL_WRAP_ARRAY(tdc__i0,,__i0,tdc[__i0].FCNCALL_CALL(tdc[__i0])); }
+    FCNCALL_SUBINDEX_END(__i0);
+  }
+  FCNCALL_SUBNAME_END;
+  }
+  // union 
+  // {
+    // struct 
+    // {
+      // uint32 time_tag : 27;
+      // uint32 unnamed_27_31 : 5;
+    // } ;
+    // uint32 u32;
+  // } trigger;
+  {
+  FCNCALL_SUBNAME("trigger");
+#if !STRUCT_ONLY_LAST_UNION_MEMBER
+  // struct 
+  // {
+    // uint32 time_tag : 27;
+    // uint32 unnamed_27_31 : 5;
+  // } ;
+  // uint32 time_tag : 27;
+  {
+  FCNCALL_SUBNAME("time_tag");
+  { FCNCALL_CALL_CTRL_WRAP(trigger.time_tag,FCNCALL_CALL_TYPE/*_BITFIELD*/(uint32,trigger.time_tag)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // uint32 unnamed_27_31 : 5;
+  {
+  FCNCALL_SUBNAME("unnamed_27_31");
+  { FCNCALL_CALL_CTRL_WRAP(trigger.unnamed_27_31,FCNCALL_CALL_TYPE/*_BITFIELD*/(uint32,trigger.unnamed_27_31)); }
+  FCNCALL_SUBNAME_END;
+  }
+#endif// !STRUCT_ONLY_LAST_UNION_MEMBER
+  // uint32 u32;
+  {
+  FCNCALL_SUBNAME("u32");
+  { FCNCALL_CALL_CTRL_WRAP(trigger.u32,FCNCALL_CALL_TYPE(uint32,trigger.u32)); }
+  FCNCALL_SUBNAME_END;
+  }
+  FCNCALL_SUBNAME_END;
+  }
+  // union 
+  // {
+    // struct 
+    // {
+      // uint32 geom : 5;
+      // uint32 word_count : 15;
+      // uint32 dummy_20_23 : 4;
+      // uint32 tdc_error : 1;
+      // uint32 buffer_overflow : 1;
+      // uint32 trigger_lost : 1;
+      // uint32 unnamed_27_31 : 5;
+    // } ;
+    // uint32 u32;
+  // } trailer;
+  {
+  FCNCALL_SUBNAME("trailer");
+#if !STRUCT_ONLY_LAST_UNION_MEMBER
+  // struct 
+  // {
+    // uint32 geom : 5;
+    // uint32 word_count : 15;
+    // uint32 dummy_20_23 : 4;
+    // uint32 tdc_error : 1;
+    // uint32 buffer_overflow : 1;
+    // uint32 trigger_lost : 1;
+    // uint32 unnamed_27_31 : 5;
+  // } ;
+  // uint32 geom : 5;
+  {
+  FCNCALL_SUBNAME("geom");
+  { FCNCALL_CALL_CTRL_WRAP(trailer.geom,FCNCALL_CALL_TYPE/*_BITFIELD*/(uint32,trailer.geom)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // uint32 word_count : 15;
+  {
+  FCNCALL_SUBNAME("word_count");
+  { FCNCALL_CALL_CTRL_WRAP(trailer.word_count,FCNCALL_CALL_TYPE/*_BITFIELD*/(uint32,trailer.word_count)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // uint32 dummy_20_23 : 4;
+  {
+  FCNCALL_SUBNAME("dummy_20_23");
+  { FCNCALL_CALL_CTRL_WRAP(trailer.dummy_20_23,FCNCALL_CALL_TYPE/*_BITFIELD*/(uint32,trailer.dummy_20_23)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // uint32 tdc_error : 1;
+  {
+  FCNCALL_SUBNAME("tdc_error");
+  { FCNCALL_CALL_CTRL_WRAP(trailer.tdc_error,FCNCALL_CALL_TYPE/*_BITFIELD*/(uint32,trailer.tdc_error)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // uint32 buffer_overflow : 1;
+  {
+  FCNCALL_SUBNAME("buffer_overflow");
+  { FCNCALL_CALL_CTRL_WRAP(trailer.buffer_overflow,FCNCALL_CALL_TYPE/*_BITFIELD*/(uint32,trailer.buffer_overflow)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // uint32 trigger_lost : 1;
+  {
+  FCNCALL_SUBNAME("trigger_lost");
+  { FCNCALL_CALL_CTRL_WRAP(trailer.trigger_lost,FCNCALL_CALL_TYPE/*_BITFIELD*/(uint32,trailer.trigger_lost)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // uint32 unnamed_27_31 : 5;
+  {
+  FCNCALL_SUBNAME("unnamed_27_31");
+  { FCNCALL_CALL_CTRL_WRAP(trailer.unnamed_27_31,FCNCALL_CALL_TYPE/*_BITFIELD*/(uint32,trailer.unnamed_27_31)); }
+  FCNCALL_SUBNAME_END;
+  }
+#endif// !STRUCT_ONLY_LAST_UNION_MEMBER
+  // uint32 u32;
+  {
+  FCNCALL_SUBNAME("u32");
+  { FCNCALL_CALL_CTRL_WRAP(trailer.u32,FCNCALL_CALL_TYPE(uint32,trailer.u32)); }
+  FCNCALL_SUBNAME_END;
+  }
+  FCNCALL_SUBNAME_END;
+  }
+  FCNCALL_RET;
+}
+#endif//USER_DEF_VME_CAEN_V1190
+
+#ifndef USER_DEF_VME_CAEN_V1190_SHORT_SUBTDC
+FCNCALL_TEMPLATE
+FCNCALL_RET_TYPE FCNCALL_CLASS_NAME(VME_CAEN_V1190_SHORT_SUBTDC)::FCNCALL_NAME(VME_CAEN_V1190_SHORT_SUBTDC)
+{
+  FCNCALL_INIT;
+  FCNCALL_RET;
+}
+#endif//USER_DEF_VME_CAEN_V1190_SHORT_SUBTDC
+
+#ifndef USER_DEF_VME_CAEN_V1190_SHORT_SUBTDC_ERROR
+FCNCALL_TEMPLATE
+FCNCALL_RET_TYPE FCNCALL_CLASS_NAME(VME_CAEN_V1190_SHORT_SUBTDC_ERROR)::FCNCALL_NAME(VME_CAEN_V1190_SHORT_SUBTDC_ERROR)
+{
+  FCNCALL_INIT;
+  // union 
+  // {
+    // struct 
+    // {
+      // uint32 flags : 15;
+      // uint32 dummy_15_23 : 9;
+      // uint32 tdc : 2;
+      // uint32 dummy_26 : 1;
+      // uint32 unnamed_27_31 : 5;
+    // } ;
+    // uint32 u32;
+  // } error_flags;
+  {
+  FCNCALL_SUBNAME("error_flags");
+#if !STRUCT_ONLY_LAST_UNION_MEMBER
+  // struct 
+  // {
+    // uint32 flags : 15;
+    // uint32 dummy_15_23 : 9;
+    // uint32 tdc : 2;
+    // uint32 dummy_26 : 1;
+    // uint32 unnamed_27_31 : 5;
+  // } ;
+  // uint32 flags : 15;
+  {
+  FCNCALL_SUBNAME("flags");
+  { FCNCALL_CALL_CTRL_WRAP(error_flags.flags,FCNCALL_CALL_TYPE/*_BITFIELD*/(uint32,error_flags.flags)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // uint32 dummy_15_23 : 9;
+  {
+  FCNCALL_SUBNAME("dummy_15_23");
+  { FCNCALL_CALL_CTRL_WRAP(error_flags.dummy_15_23,FCNCALL_CALL_TYPE/*_BITFIELD*/(uint32,error_flags.dummy_15_23)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // uint32 tdc : 2;
+  {
+  FCNCALL_SUBNAME("tdc");
+  { FCNCALL_CALL_CTRL_WRAP(error_flags.tdc,FCNCALL_CALL_TYPE/*_BITFIELD*/(uint32,error_flags.tdc)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // uint32 dummy_26 : 1;
+  {
+  FCNCALL_SUBNAME("dummy_26");
+  { FCNCALL_CALL_CTRL_WRAP(error_flags.dummy_26,FCNCALL_CALL_TYPE/*_BITFIELD*/(uint32,error_flags.dummy_26)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // uint32 unnamed_27_31 : 5;
+  {
+  FCNCALL_SUBNAME("unnamed_27_31");
+  { FCNCALL_CALL_CTRL_WRAP(error_flags.unnamed_27_31,FCNCALL_CALL_TYPE/*_BITFIELD*/(uint32,error_flags.unnamed_27_31)); }
+  FCNCALL_SUBNAME_END;
+  }
+#endif// !STRUCT_ONLY_LAST_UNION_MEMBER
+  // uint32 u32;
+  {
+  FCNCALL_SUBNAME("u32");
+  { FCNCALL_CALL_CTRL_WRAP(error_flags.u32,FCNCALL_CALL_TYPE(uint32,error_flags.u32)); }
+  FCNCALL_SUBNAME_END;
+  }
+  FCNCALL_SUBNAME_END;
+  }
+  FCNCALL_RET;
+}
+#endif//USER_DEF_VME_CAEN_V1190_SHORT_SUBTDC_ERROR
+
+#ifndef USER_DEF_VME_CAEN_V1190_SHORT
+FCNCALL_TEMPLATE
+FCNCALL_RET_TYPE FCNCALL_CLASS_NAME(VME_CAEN_V1190_SHORT)::FCNCALL_NAME(VME_CAEN_V1190_SHORT)
+{
+  FCNCALL_INIT;
+  // raw_array_multi_zero_suppress<DATA24,DATA24,32,128> data;
+  {
+  FCNCALL_SUBNAME("data");
+  { FCNCALL_CALL_CTRL_WRAP(data,data.FCNCALL_CALL(data)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // union 
+  // {
+    // struct 
+    // {
+      // uint32 geom : 5;
+      // uint32 event_number : 22;
+      // uint32 unnamed_27_31 : 5;
+    // } ;
+    // uint32 u32;
+  // } header;
+  {
+  FCNCALL_SUBNAME("header");
+#if !STRUCT_ONLY_LAST_UNION_MEMBER
+  // struct 
+  // {
+    // uint32 geom : 5;
+    // uint32 event_number : 22;
+    // uint32 unnamed_27_31 : 5;
+  // } ;
+  // uint32 geom : 5;
+  {
+  FCNCALL_SUBNAME("geom");
+  { FCNCALL_CALL_CTRL_WRAP(header.geom,FCNCALL_CALL_TYPE/*_BITFIELD*/(uint32,header.geom)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // uint32 event_number : 22;
+  {
+  FCNCALL_SUBNAME("event_number");
+  { FCNCALL_CALL_CTRL_WRAP(header.event_number,FCNCALL_CALL_TYPE/*_BITFIELD*/(uint32,header.event_number)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // uint32 unnamed_27_31 : 5;
+  {
+  FCNCALL_SUBNAME("unnamed_27_31");
+  { FCNCALL_CALL_CTRL_WRAP(header.unnamed_27_31,FCNCALL_CALL_TYPE/*_BITFIELD*/(uint32,header.unnamed_27_31)); }
+  FCNCALL_SUBNAME_END;
+  }
+#endif// !STRUCT_ONLY_LAST_UNION_MEMBER
+  // uint32 u32;
+  {
+  FCNCALL_SUBNAME("u32");
+  { FCNCALL_CALL_CTRL_WRAP(header.u32,FCNCALL_CALL_TYPE(uint32,header.u32)); }
+  FCNCALL_SUBNAME_END;
+  }
+  FCNCALL_SUBNAME_END;
+  }
+  // VME_CAEN_V1190_SHORT_SUBTDC tdc[4];
+  {
+  FCNCALL_SUBNAME("tdc");
+  FCNCALL_FOR(__i0,4)
+  {
+    FCNCALL_SUBINDEX(__i0);
+    { FCNCALL_CALL_CTRL_WRAP_ARRAY(tdc__i0,,__i0,tdc[__i0].FCNCALL_CALL(tdc[__i0])); }
+    FCNCALL_SUBINDEX_END(__i0);
+  }
+  FCNCALL_SUBNAME_END;
+  }
+  // VME_CAEN_V1190_SHORT_SUBTDC_ERROR err[4];
+  {
+  FCNCALL_SUBNAME("err");
+  FCNCALL_FOR(__i0,4)
+  {
+    FCNCALL_SUBINDEX(__i0);
+    { FCNCALL_CALL_CTRL_WRAP_ARRAY(err__i0,,__i0,err[__i0].FCNCALL_CALL(err[__i0])); }
+    FCNCALL_SUBINDEX_END(__i0);
+  }
+  FCNCALL_SUBNAME_END;
+  }
+  // union 
+  // {
+    // struct 
+    // {
+      // uint32 time_tag : 27;
+      // uint32 unnamed_27_31 : 5;
+    // } ;
+    // uint32 u32;
+  // } trigger;
+  {
+  FCNCALL_SUBNAME("trigger");
+#if !STRUCT_ONLY_LAST_UNION_MEMBER
+  // struct 
+  // {
+    // uint32 time_tag : 27;
+    // uint32 unnamed_27_31 : 5;
+  // } ;
+  // uint32 time_tag : 27;
+  {
+  FCNCALL_SUBNAME("time_tag");
+  { FCNCALL_CALL_CTRL_WRAP(trigger.time_tag,FCNCALL_CALL_TYPE/*_BITFIELD*/(uint32,trigger.time_tag)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // uint32 unnamed_27_31 : 5;
+  {
+  FCNCALL_SUBNAME("unnamed_27_31");
+  { FCNCALL_CALL_CTRL_WRAP(trigger.unnamed_27_31,FCNCALL_CALL_TYPE/*_BITFIELD*/(uint32,trigger.unnamed_27_31)); }
+  FCNCALL_SUBNAME_END;
+  }
+#endif// !STRUCT_ONLY_LAST_UNION_MEMBER
+  // uint32 u32;
+  {
+  FCNCALL_SUBNAME("u32");
+  { FCNCALL_CALL_CTRL_WRAP(trigger.u32,FCNCALL_CALL_TYPE(uint32,trigger.u32)); }
+  FCNCALL_SUBNAME_END;
+  }
+  FCNCALL_SUBNAME_END;
+  }
+  // union 
+  // {
+    // struct 
+    // {
+      // uint32 geom : 5;
+      // uint32 word_count : 15;
+      // uint32 dummy_20_23 : 4;
+      // uint32 tdc_error : 1;
+      // uint32 buffer_overflow : 1;
+      // uint32 trigger_lost : 1;
+      // uint32 unnamed_27_31 : 5;
+    // } ;
+    // uint32 u32;
+  // } trailer;
+  {
+  FCNCALL_SUBNAME("trailer");
+#if !STRUCT_ONLY_LAST_UNION_MEMBER
+  // struct 
+  // {
+    // uint32 geom : 5;
+    // uint32 word_count : 15;
+    // uint32 dummy_20_23 : 4;
+    // uint32 tdc_error : 1;
+    // uint32 buffer_overflow : 1;
+    // uint32 trigger_lost : 1;
+    // uint32 unnamed_27_31 : 5;
+  // } ;
+  // uint32 geom : 5;
+  {
+  FCNCALL_SUBNAME("geom");
+  { FCNCALL_CALL_CTRL_WRAP(trailer.geom,FCNCALL_CALL_TYPE/*_BITFIELD*/(uint32,trailer.geom)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // uint32 word_count : 15;
+  {
+  FCNCALL_SUBNAME("word_count");
+  { FCNCALL_CALL_CTRL_WRAP(trailer.word_count,FCNCALL_CALL_TYPE/*_BITFIELD*/(uint32,trailer.word_count)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // uint32 dummy_20_23 : 4;
+  {
+  FCNCALL_SUBNAME("dummy_20_23");
+  { FCNCALL_CALL_CTRL_WRAP(trailer.dummy_20_23,FCNCALL_CALL_TYPE/*_BITFIELD*/(uint32,trailer.dummy_20_23)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // uint32 tdc_error : 1;
+  {
+  FCNCALL_SUBNAME("tdc_error");
+  { FCNCALL_CALL_CTRL_WRAP(trailer.tdc_error,FCNCALL_CALL_TYPE/*_BITFIELD*/(uint32,trailer.tdc_error)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // uint32 buffer_overflow : 1;
+  {
+  FCNCALL_SUBNAME("buffer_overflow");
+  { FCNCALL_CALL_CTRL_WRAP(trailer.buffer_overflow,FCNCALL_CALL_TYPE/*_BITFIELD*/(uint32,trailer.buffer_overflow)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // uint32 trigger_lost : 1;
+  {
+  FCNCALL_SUBNAME("trigger_lost");
+  { FCNCALL_CALL_CTRL_WRAP(trailer.trigger_lost,FCNCALL_CALL_TYPE/*_BITFIELD*/(uint32,trailer.trigger_lost)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // uint32 unnamed_27_31 : 5;
+  {
+  FCNCALL_SUBNAME("unnamed_27_31");
+  { FCNCALL_CALL_CTRL_WRAP(trailer.unnamed_27_31,FCNCALL_CALL_TYPE/*_BITFIELD*/(uint32,trailer.unnamed_27_31)); }
+  FCNCALL_SUBNAME_END;
+  }
+#endif// !STRUCT_ONLY_LAST_UNION_MEMBER
+  // uint32 u32;
+  {
+  FCNCALL_SUBNAME("u32");
+  { FCNCALL_CALL_CTRL_WRAP(trailer.u32,FCNCALL_CALL_TYPE(uint32,trailer.u32)); }
+  FCNCALL_SUBNAME_END;
+  }
+  FCNCALL_SUBNAME_END;
+  }
+  FCNCALL_RET;
+}
+#endif//USER_DEF_VME_CAEN_V1190_SHORT
+
+#ifndef USER_DEF_VME_CAEN_V1290_SUBTDC
+FCNCALL_TEMPLATE
+FCNCALL_RET_TYPE FCNCALL_CLASS_NAME(VME_CAEN_V1290_SUBTDC)::FCNCALL_NAME(VME_CAEN_V1290_SUBTDC)
+{
+  FCNCALL_INIT;
+  // union 
+  // {
+    // struct 
+    // {
+      // uint32 bunch_id : 12;
+      // uint32 event_id : 12;
+      // uint32 tdc : 2;
+      // uint32 dummy_26 : 1;
+      // uint32 unnamed_27_31 : 5;
+    // } ;
+    // uint32 u32;
+  // } header;
+  {
+  FCNCALL_SUBNAME("header");
+#if !STRUCT_ONLY_LAST_UNION_MEMBER
+  // struct 
+  // {
+    // uint32 bunch_id : 12;
+    // uint32 event_id : 12;
+    // uint32 tdc : 2;
+    // uint32 dummy_26 : 1;
+    // uint32 unnamed_27_31 : 5;
+  // } ;
+  // uint32 bunch_id : 12;
+  {
+  FCNCALL_SUBNAME("bunch_id");
+  { FCNCALL_CALL_CTRL_WRAP(header.bunch_id,FCNCALL_CALL_TYPE/*_BITFIELD*/(uint32,header.bunch_id)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // uint32 event_id : 12;
+  {
+  FCNCALL_SUBNAME("event_id");
+  { FCNCALL_CALL_CTRL_WRAP(header.event_id,FCNCALL_CALL_TYPE/*_BITFIELD*/(uint32,header.event_id)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // uint32 tdc : 2;
+  {
+  FCNCALL_SUBNAME("tdc");
+  { FCNCALL_CALL_CTRL_WRAP(header.tdc,FCNCALL_CALL_TYPE/*_BITFIELD*/(uint32,header.tdc)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // uint32 dummy_26 : 1;
+  {
+  FCNCALL_SUBNAME("dummy_26");
+  { FCNCALL_CALL_CTRL_WRAP(header.dummy_26,FCNCALL_CALL_TYPE/*_BITFIELD*/(uint32,header.dummy_26)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // uint32 unnamed_27_31 : 5;
+  {
+  FCNCALL_SUBNAME("unnamed_27_31");
+  { FCNCALL_CALL_CTRL_WRAP(header.unnamed_27_31,FCNCALL_CALL_TYPE/*_BITFIELD*/(uint32,header.unnamed_27_31)); }
+  FCNCALL_SUBNAME_END;
+  }
+#endif// !STRUCT_ONLY_LAST_UNION_MEMBER
+  // uint32 u32;
+  {
+  FCNCALL_SUBNAME("u32");
+  { FCNCALL_CALL_CTRL_WRAP(header.u32,FCNCALL_CALL_TYPE(uint32,header.u32)); }
+  FCNCALL_SUBNAME_END;
+  }
+  FCNCALL_SUBNAME_END;
+  }
+  // union 
+  // {
+    // struct 
+    // {
+      // uint32 flags : 15;
+      // uint32 dummy_15_23 : 9;
+      // uint32 tdc : 2;
+      // uint32 dummy_26 : 1;
+      // uint32 unnamed_27_31 : 5;
+    // } ;
+    // uint32 u32;
+  // } error_flags;
+  {
+  FCNCALL_SUBNAME("error_flags");
+#if !STRUCT_ONLY_LAST_UNION_MEMBER
+  // struct 
+  // {
+    // uint32 flags : 15;
+    // uint32 dummy_15_23 : 9;
+    // uint32 tdc : 2;
+    // uint32 dummy_26 : 1;
+    // uint32 unnamed_27_31 : 5;
+  // } ;
+  // uint32 flags : 15;
+  {
+  FCNCALL_SUBNAME("flags");
+  { FCNCALL_CALL_CTRL_WRAP(error_flags.flags,FCNCALL_CALL_TYPE/*_BITFIELD*/(uint32,error_flags.flags)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // uint32 dummy_15_23 : 9;
+  {
+  FCNCALL_SUBNAME("dummy_15_23");
+  { FCNCALL_CALL_CTRL_WRAP(error_flags.dummy_15_23,FCNCALL_CALL_TYPE/*_BITFIELD*/(uint32,error_flags.dummy_15_23)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // uint32 tdc : 2;
+  {
+  FCNCALL_SUBNAME("tdc");
+  { FCNCALL_CALL_CTRL_WRAP(error_flags.tdc,FCNCALL_CALL_TYPE/*_BITFIELD*/(uint32,error_flags.tdc)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // uint32 dummy_26 : 1;
+  {
+  FCNCALL_SUBNAME("dummy_26");
+  { FCNCALL_CALL_CTRL_WRAP(error_flags.dummy_26,FCNCALL_CALL_TYPE/*_BITFIELD*/(uint32,error_flags.dummy_26)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // uint32 unnamed_27_31 : 5;
+  {
+  FCNCALL_SUBNAME("unnamed_27_31");
+  { FCNCALL_CALL_CTRL_WRAP(error_flags.unnamed_27_31,FCNCALL_CALL_TYPE/*_BITFIELD*/(uint32,error_flags.unnamed_27_31)); }
+  FCNCALL_SUBNAME_END;
+  }
+#endif// !STRUCT_ONLY_LAST_UNION_MEMBER
+  // uint32 u32;
+  {
+  FCNCALL_SUBNAME("u32");
+  { FCNCALL_CALL_CTRL_WRAP(error_flags.u32,FCNCALL_CALL_TYPE(uint32,error_flags.u32)); }
+  FCNCALL_SUBNAME_END;
+  }
+  FCNCALL_SUBNAME_END;
+  }
+  // union 
+  // {
+    // struct 
+    // {
+      // uint32 word_count : 12;
+      // uint32 event_id : 12;
+      // uint32 tdc : 2;
+      // uint32 dummy_26 : 1;
+      // uint32 unnamed_27_31 : 5;
+    // } ;
+    // uint32 u32;
+  // } trailer;
+  {
+  FCNCALL_SUBNAME("trailer");
+#if !STRUCT_ONLY_LAST_UNION_MEMBER
+  // struct 
+  // {
+    // uint32 word_count : 12;
+    // uint32 event_id : 12;
+    // uint32 tdc : 2;
+    // uint32 dummy_26 : 1;
+    // uint32 unnamed_27_31 : 5;
+  // } ;
+  // uint32 word_count : 12;
+  {
+  FCNCALL_SUBNAME("word_count");
+  { FCNCALL_CALL_CTRL_WRAP(trailer.word_count,FCNCALL_CALL_TYPE/*_BITFIELD*/(uint32,trailer.word_count)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // uint32 event_id : 12;
+  {
+  FCNCALL_SUBNAME("event_id");
+  { FCNCALL_CALL_CTRL_WRAP(trailer.event_id,FCNCALL_CALL_TYPE/*_BITFIELD*/(uint32,trailer.event_id)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // uint32 tdc : 2;
+  {
+  FCNCALL_SUBNAME("tdc");
+  { FCNCALL_CALL_CTRL_WRAP(trailer.tdc,FCNCALL_CALL_TYPE/*_BITFIELD*/(uint32,trailer.tdc)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // uint32 dummy_26 : 1;
+  {
+  FCNCALL_SUBNAME("dummy_26");
+  { FCNCALL_CALL_CTRL_WRAP(trailer.dummy_26,FCNCALL_CALL_TYPE/*_BITFIELD*/(uint32,trailer.dummy_26)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // uint32 unnamed_27_31 : 5;
+  {
+  FCNCALL_SUBNAME("unnamed_27_31");
+  { FCNCALL_CALL_CTRL_WRAP(trailer.unnamed_27_31,FCNCALL_CALL_TYPE/*_BITFIELD*/(uint32,trailer.unnamed_27_31)); }
+  FCNCALL_SUBNAME_END;
+  }
+#endif// !STRUCT_ONLY_LAST_UNION_MEMBER
+  // uint32 u32;
+  {
+  FCNCALL_SUBNAME("u32");
+  { FCNCALL_CALL_CTRL_WRAP(trailer.u32,FCNCALL_CALL_TYPE(uint32,trailer.u32)); }
+  FCNCALL_SUBNAME_END;
+  }
+  FCNCALL_SUBNAME_END;
+  }
+  FCNCALL_RET;
+}
+#endif//USER_DEF_VME_CAEN_V1290_SUBTDC
+
+#ifndef USER_DEF_VME_CAEN_V1290
+FCNCALL_TEMPLATE
+FCNCALL_RET_TYPE FCNCALL_CLASS_NAME(VME_CAEN_V1290)::FCNCALL_NAME(VME_CAEN_V1290)
+{
+  FCNCALL_INIT;
+  // raw_array_multi_zero_suppress<DATA24,DATA24,32,128> data;
+  {
+  FCNCALL_SUBNAME("data");
+  { FCNCALL_CALL_CTRL_WRAP(data,data.FCNCALL_CALL(data)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // union 
+  // {
+    // struct 
+    // {
+      // uint32 geom : 5;
+      // uint32 event_number : 22;
+      // uint32 unnamed_27_31 : 5;
+    // } ;
+    // uint32 u32;
+  // } header;
+  {
+  FCNCALL_SUBNAME("header");
+#if !STRUCT_ONLY_LAST_UNION_MEMBER
+  // struct 
+  // {
+    // uint32 geom : 5;
+    // uint32 event_number : 22;
+    // uint32 unnamed_27_31 : 5;
+  // } ;
+  // uint32 geom : 5;
+  {
+  FCNCALL_SUBNAME("geom");
+  { FCNCALL_CALL_CTRL_WRAP(header.geom,FCNCALL_CALL_TYPE/*_BITFIELD*/(uint32,header.geom)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // uint32 event_number : 22;
+  {
+  FCNCALL_SUBNAME("event_number");
+  { FCNCALL_CALL_CTRL_WRAP(header.event_number,FCNCALL_CALL_TYPE/*_BITFIELD*/(uint32,header.event_number)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // uint32 unnamed_27_31 : 5;
+  {
+  FCNCALL_SUBNAME("unnamed_27_31");
+  { FCNCALL_CALL_CTRL_WRAP(header.unnamed_27_31,FCNCALL_CALL_TYPE/*_BITFIELD*/(uint32,header.unnamed_27_31)); }
+  FCNCALL_SUBNAME_END;
+  }
+#endif// !STRUCT_ONLY_LAST_UNION_MEMBER
+  // uint32 u32;
+  {
+  FCNCALL_SUBNAME("u32");
+  { FCNCALL_CALL_CTRL_WRAP(header.u32,FCNCALL_CALL_TYPE(uint32,header.u32)); }
+  FCNCALL_SUBNAME_END;
+  }
+  FCNCALL_SUBNAME_END;
+  }
+  // VME_CAEN_V1290_SUBTDC tdc[4];
+  {
+  FCNCALL_SUBNAME("tdc");
+  FCNCALL_FOR(__i0,4)
+  {
+    FCNCALL_SUBINDEX(__i0);
+    { FCNCALL_CALL_CTRL_WRAP_ARRAY(tdc__i0,,__i0,tdc[__i0].FCNCALL_CALL(tdc[__i0])); }
+    FCNCALL_SUBINDEX_END(__i0);
+  }
+  FCNCALL_SUBNAME_END;
+  }
+  // union 
+  // {
+    // struct 
+    // {
+      // uint32 time_tag : 27;
+      // uint32 unnamed_27_31 : 5;
+    // } ;
+    // uint32 u32;
+  // } trigger;
+  {
+  FCNCALL_SUBNAME("trigger");
+#if !STRUCT_ONLY_LAST_UNION_MEMBER
+  // struct 
+  // {
+    // uint32 time_tag : 27;
+    // uint32 unnamed_27_31 : 5;
+  // } ;
+  // uint32 time_tag : 27;
+  {
+  FCNCALL_SUBNAME("time_tag");
+  { FCNCALL_CALL_CTRL_WRAP(trigger.time_tag,FCNCALL_CALL_TYPE/*_BITFIELD*/(uint32,trigger.time_tag)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // uint32 unnamed_27_31 : 5;
+  {
+  FCNCALL_SUBNAME("unnamed_27_31");
+  { FCNCALL_CALL_CTRL_WRAP(trigger.unnamed_27_31,FCNCALL_CALL_TYPE/*_BITFIELD*/(uint32,trigger.unnamed_27_31)); }
+  FCNCALL_SUBNAME_END;
+  }
+#endif// !STRUCT_ONLY_LAST_UNION_MEMBER
+  // uint32 u32;
+  {
+  FCNCALL_SUBNAME("u32");
+  { FCNCALL_CALL_CTRL_WRAP(trigger.u32,FCNCALL_CALL_TYPE(uint32,trigger.u32)); }
+  FCNCALL_SUBNAME_END;
+  }
+  FCNCALL_SUBNAME_END;
+  }
+  // union 
+  // {
+    // struct 
+    // {
+      // uint32 geom : 5;
+      // uint32 word_count : 15;
+      // uint32 dummy_20_23 : 4;
+      // uint32 tdc_error : 1;
+      // uint32 buffer_overflow : 1;
+      // uint32 trigger_lost : 1;
+      // uint32 unnamed_27_31 : 5;
+    // } ;
+    // uint32 u32;
+  // } trailer;
+  {
+  FCNCALL_SUBNAME("trailer");
+#if !STRUCT_ONLY_LAST_UNION_MEMBER
+  // struct 
+  // {
+    // uint32 geom : 5;
+    // uint32 word_count : 15;
+    // uint32 dummy_20_23 : 4;
+    // uint32 tdc_error : 1;
+    // uint32 buffer_overflow : 1;
+    // uint32 trigger_lost : 1;
+    // uint32 unnamed_27_31 : 5;
+  // } ;
+  // uint32 geom : 5;
+  {
+  FCNCALL_SUBNAME("geom");
+  { FCNCALL_CALL_CTRL_WRAP(trailer.geom,FCNCALL_CALL_TYPE/*_BITFIELD*/(uint32,trailer.geom)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // uint32 word_count : 15;
+  {
+  FCNCALL_SUBNAME("word_count");
+  { FCNCALL_CALL_CTRL_WRAP(trailer.word_count,FCNCALL_CALL_TYPE/*_BITFIELD*/(uint32,trailer.word_count)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // uint32 dummy_20_23 : 4;
+  {
+  FCNCALL_SUBNAME("dummy_20_23");
+  { FCNCALL_CALL_CTRL_WRAP(trailer.dummy_20_23,FCNCALL_CALL_TYPE/*_BITFIELD*/(uint32,trailer.dummy_20_23)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // uint32 tdc_error : 1;
+  {
+  FCNCALL_SUBNAME("tdc_error");
+  { FCNCALL_CALL_CTRL_WRAP(trailer.tdc_error,FCNCALL_CALL_TYPE/*_BITFIELD*/(uint32,trailer.tdc_error)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // uint32 buffer_overflow : 1;
+  {
+  FCNCALL_SUBNAME("buffer_overflow");
+  { FCNCALL_CALL_CTRL_WRAP(trailer.buffer_overflow,FCNCALL_CALL_TYPE/*_BITFIELD*/(uint32,trailer.buffer_overflow)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // uint32 trigger_lost : 1;
+  {
+  FCNCALL_SUBNAME("trigger_lost");
+  { FCNCALL_CALL_CTRL_WRAP(trailer.trigger_lost,FCNCALL_CALL_TYPE/*_BITFIELD*/(uint32,trailer.trigger_lost)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // uint32 unnamed_27_31 : 5;
+  {
+  FCNCALL_SUBNAME("unnamed_27_31");
+  { FCNCALL_CALL_CTRL_WRAP(trailer.unnamed_27_31,FCNCALL_CALL_TYPE/*_BITFIELD*/(uint32,trailer.unnamed_27_31)); }
+  FCNCALL_SUBNAME_END;
+  }
+#endif// !STRUCT_ONLY_LAST_UNION_MEMBER
+  // uint32 u32;
+  {
+  FCNCALL_SUBNAME("u32");
+  { FCNCALL_CALL_CTRL_WRAP(trailer.u32,FCNCALL_CALL_TYPE(uint32,trailer.u32)); }
+  FCNCALL_SUBNAME_END;
+  }
+  FCNCALL_SUBNAME_END;
+  }
+  FCNCALL_RET;
+}
+#endif//USER_DEF_VME_CAEN_V1290
+
+#ifndef USER_DEF_VME_CAEN_V1290_SHORT_SUBTDC
+FCNCALL_TEMPLATE
+FCNCALL_RET_TYPE FCNCALL_CLASS_NAME(VME_CAEN_V1290_SHORT_SUBTDC)::FCNCALL_NAME(VME_CAEN_V1290_SHORT_SUBTDC)
+{
+  FCNCALL_INIT;
+  FCNCALL_RET;
+}
+#endif//USER_DEF_VME_CAEN_V1290_SHORT_SUBTDC
+
+#ifndef USER_DEF_VME_CAEN_V1290_SHORT_SUBTDC_ERROR
+FCNCALL_TEMPLATE
+FCNCALL_RET_TYPE FCNCALL_CLASS_NAME(VME_CAEN_V1290_SHORT_SUBTDC_ERROR)::FCNCALL_NAME(VME_CAEN_V1290_SHORT_SUBTDC_ERROR)
+{
+  FCNCALL_INIT;
+  // union 
+  // {
+    // struct 
+    // {
+      // uint32 flags : 15;
+      // uint32 dummy_15_23 : 9;
+      // uint32 tdc : 2;
+      // uint32 dummy_26 : 1;
+      // uint32 unnamed_27_31 : 5;
+    // } ;
+    // uint32 u32;
+  // } error_flags;
+  {
+  FCNCALL_SUBNAME("error_flags");
+#if !STRUCT_ONLY_LAST_UNION_MEMBER
+  // struct 
+  // {
+    // uint32 flags : 15;
+    // uint32 dummy_15_23 : 9;
+    // uint32 tdc : 2;
+    // uint32 dummy_26 : 1;
+    // uint32 unnamed_27_31 : 5;
+  // } ;
+  // uint32 flags : 15;
+  {
+  FCNCALL_SUBNAME("flags");
+  { FCNCALL_CALL_CTRL_WRAP(error_flags.flags,FCNCALL_CALL_TYPE/*_BITFIELD*/(uint32,error_flags.flags)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // uint32 dummy_15_23 : 9;
+  {
+  FCNCALL_SUBNAME("dummy_15_23");
+  { FCNCALL_CALL_CTRL_WRAP(error_flags.dummy_15_23,FCNCALL_CALL_TYPE/*_BITFIELD*/(uint32,error_flags.dummy_15_23)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // uint32 tdc : 2;
+  {
+  FCNCALL_SUBNAME("tdc");
+  { FCNCALL_CALL_CTRL_WRAP(error_flags.tdc,FCNCALL_CALL_TYPE/*_BITFIELD*/(uint32,error_flags.tdc)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // uint32 dummy_26 : 1;
+  {
+  FCNCALL_SUBNAME("dummy_26");
+  { FCNCALL_CALL_CTRL_WRAP(error_flags.dummy_26,FCNCALL_CALL_TYPE/*_BITFIELD*/(uint32,error_flags.dummy_26)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // uint32 unnamed_27_31 : 5;
+  {
+  FCNCALL_SUBNAME("unnamed_27_31");
+  { FCNCALL_CALL_CTRL_WRAP(error_flags.unnamed_27_31,FCNCALL_CALL_TYPE/*_BITFIELD*/(uint32,error_flags.unnamed_27_31)); }
+  FCNCALL_SUBNAME_END;
+  }
+#endif// !STRUCT_ONLY_LAST_UNION_MEMBER
+  // uint32 u32;
+  {
+  FCNCALL_SUBNAME("u32");
+  { FCNCALL_CALL_CTRL_WRAP(error_flags.u32,FCNCALL_CALL_TYPE(uint32,error_flags.u32)); }
+  FCNCALL_SUBNAME_END;
+  }
+  FCNCALL_SUBNAME_END;
+  }
+  FCNCALL_RET;
+}
+#endif//USER_DEF_VME_CAEN_V1290_SHORT_SUBTDC_ERROR
+
+#ifndef USER_DEF_VME_CAEN_V1290_SHORT
+FCNCALL_TEMPLATE
+FCNCALL_RET_TYPE FCNCALL_CLASS_NAME(VME_CAEN_V1290_SHORT)::FCNCALL_NAME(VME_CAEN_V1290_SHORT)
+{
+  FCNCALL_INIT;
+  // raw_array_multi_zero_suppress<DATA24,DATA24,32,128> data;
+  {
+  FCNCALL_SUBNAME("data");
+  { FCNCALL_CALL_CTRL_WRAP(data,data.FCNCALL_CALL(data)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // union 
+  // {
+    // struct 
+    // {
+      // uint32 geom : 5;
+      // uint32 event_number : 22;
+      // uint32 unnamed_27_31 : 5;
+    // } ;
+    // uint32 u32;
+  // } header;
+  {
+  FCNCALL_SUBNAME("header");
+#if !STRUCT_ONLY_LAST_UNION_MEMBER
+  // struct 
+  // {
+    // uint32 geom : 5;
+    // uint32 event_number : 22;
+    // uint32 unnamed_27_31 : 5;
+  // } ;
+  // uint32 geom : 5;
+  {
+  FCNCALL_SUBNAME("geom");
+  { FCNCALL_CALL_CTRL_WRAP(header.geom,FCNCALL_CALL_TYPE/*_BITFIELD*/(uint32,header.geom)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // uint32 event_number : 22;
+  {
+  FCNCALL_SUBNAME("event_number");
+  { FCNCALL_CALL_CTRL_WRAP(header.event_number,FCNCALL_CALL_TYPE/*_BITFIELD*/(uint32,header.event_number)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // uint32 unnamed_27_31 : 5;
+  {
+  FCNCALL_SUBNAME("unnamed_27_31");
+  { FCNCALL_CALL_CTRL_WRAP(header.unnamed_27_31,FCNCALL_CALL_TYPE/*_BITFIELD*/(uint32,header.unnamed_27_31)); }
+  FCNCALL_SUBNAME_END;
+  }
+#endif// !STRUCT_ONLY_LAST_UNION_MEMBER
+  // uint32 u32;
+  {
+  FCNCALL_SUBNAME("u32");
+  { FCNCALL_CALL_CTRL_WRAP(header.u32,FCNCALL_CALL_TYPE(uint32,header.u32)); }
+  FCNCALL_SUBNAME_END;
+  }
+  FCNCALL_SUBNAME_END;
+  }
+  // VME_CAEN_V1290_SHORT_SUBTDC tdc[4];
+  {
+  FCNCALL_SUBNAME("tdc");
+  FCNCALL_FOR(__i0,4)
+  {
+    FCNCALL_SUBINDEX(__i0);
+    { FCNCALL_CALL_CTRL_WRAP_ARRAY(tdc__i0,,__i0,tdc[__i0].FCNCALL_CALL(tdc[__i0])); }
+    FCNCALL_SUBINDEX_END(__i0);
+  }
+  FCNCALL_SUBNAME_END;
+  }
+  // VME_CAEN_V1290_SHORT_SUBTDC_ERROR err[4];
+  {
+  FCNCALL_SUBNAME("err");
+  FCNCALL_FOR(__i0,4)
+  {
+    FCNCALL_SUBINDEX(__i0);
+    { FCNCALL_CALL_CTRL_WRAP_ARRAY(err__i0,,__i0,err[__i0].FCNCALL_CALL(err[__i0])); }
+    FCNCALL_SUBINDEX_END(__i0);
+  }
+  FCNCALL_SUBNAME_END;
+  }
+  // union 
+  // {
+    // struct 
+    // {
+      // uint32 time_tag : 27;
+      // uint32 unnamed_27_31 : 5;
+    // } ;
+    // uint32 u32;
+  // } trigger;
+  {
+  FCNCALL_SUBNAME("trigger");
+#if !STRUCT_ONLY_LAST_UNION_MEMBER
+  // struct 
+  // {
+    // uint32 time_tag : 27;
+    // uint32 unnamed_27_31 : 5;
+  // } ;
+  // uint32 time_tag : 27;
+  {
+  FCNCALL_SUBNAME("time_tag");
+  { FCNCALL_CALL_CTRL_WRAP(trigger.time_tag,FCNCALL_CALL_TYPE/*_BITFIELD*/(uint32,trigger.time_tag)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // uint32 unnamed_27_31 : 5;
+  {
+  FCNCALL_SUBNAME("unnamed_27_31");
+  { FCNCALL_CALL_CTRL_WRAP(trigger.unnamed_27_31,FCNCALL_CALL_TYPE/*_BITFIELD*/(uint32,trigger.unnamed_27_31)); }
+  FCNCALL_SUBNAME_END;
+  }
+#endif// !STRUCT_ONLY_LAST_UNION_MEMBER
+  // uint32 u32;
+  {
+  FCNCALL_SUBNAME("u32");
+  { FCNCALL_CALL_CTRL_WRAP(trigger.u32,FCNCALL_CALL_TYPE(uint32,trigger.u32)); }
+  FCNCALL_SUBNAME_END;
+  }
+  FCNCALL_SUBNAME_END;
+  }
+  // union 
+  // {
+    // struct 
+    // {
+      // uint32 geom : 5;
+      // uint32 word_count : 15;
+      // uint32 dummy_20_23 : 4;
+      // uint32 tdc_error : 1;
+      // uint32 buffer_overflow : 1;
+      // uint32 trigger_lost : 1;
+      // uint32 unnamed_27_31 : 5;
+    // } ;
+    // uint32 u32;
+  // } trailer;
+  {
+  FCNCALL_SUBNAME("trailer");
+#if !STRUCT_ONLY_LAST_UNION_MEMBER
+  // struct 
+  // {
+    // uint32 geom : 5;
+    // uint32 word_count : 15;
+    // uint32 dummy_20_23 : 4;
+    // uint32 tdc_error : 1;
+    // uint32 buffer_overflow : 1;
+    // uint32 trigger_lost : 1;
+    // uint32 unnamed_27_31 : 5;
+  // } ;
+  // uint32 geom : 5;
+  {
+  FCNCALL_SUBNAME("geom");
+  { FCNCALL_CALL_CTRL_WRAP(trailer.geom,FCNCALL_CALL_TYPE/*_BITFIELD*/(uint32,trailer.geom)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // uint32 word_count : 15;
+  {
+  FCNCALL_SUBNAME("word_count");
+  { FCNCALL_CALL_CTRL_WRAP(trailer.word_count,FCNCALL_CALL_TYPE/*_BITFIELD*/(uint32,trailer.word_count)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // uint32 dummy_20_23 : 4;
+  {
+  FCNCALL_SUBNAME("dummy_20_23");
+  { FCNCALL_CALL_CTRL_WRAP(trailer.dummy_20_23,FCNCALL_CALL_TYPE/*_BITFIELD*/(uint32,trailer.dummy_20_23)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // uint32 tdc_error : 1;
+  {
+  FCNCALL_SUBNAME("tdc_error");
+  { FCNCALL_CALL_CTRL_WRAP(trailer.tdc_error,FCNCALL_CALL_TYPE/*_BITFIELD*/(uint32,trailer.tdc_error)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // uint32 buffer_overflow : 1;
+  {
+  FCNCALL_SUBNAME("buffer_overflow");
+  { FCNCALL_CALL_CTRL_WRAP(trailer.buffer_overflow,FCNCALL_CALL_TYPE/*_BITFIELD*/(uint32,trailer.buffer_overflow)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // uint32 trigger_lost : 1;
+  {
+  FCNCALL_SUBNAME("trigger_lost");
+  { FCNCALL_CALL_CTRL_WRAP(trailer.trigger_lost,FCNCALL_CALL_TYPE/*_BITFIELD*/(uint32,trailer.trigger_lost)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // uint32 unnamed_27_31 : 5;
+  {
+  FCNCALL_SUBNAME("unnamed_27_31");
+  { FCNCALL_CALL_CTRL_WRAP(trailer.unnamed_27_31,FCNCALL_CALL_TYPE/*_BITFIELD*/(uint32,trailer.unnamed_27_31)); }
+  FCNCALL_SUBNAME_END;
+  }
+#endif// !STRUCT_ONLY_LAST_UNION_MEMBER
+  // uint32 u32;
+  {
+  FCNCALL_SUBNAME("u32");
+  { FCNCALL_CALL_CTRL_WRAP(trailer.u32,FCNCALL_CALL_TYPE(uint32,trailer.u32)); }
+  FCNCALL_SUBNAME_END;
+  }
+  FCNCALL_SUBNAME_END;
+  }
+  FCNCALL_RET;
+}
+#endif//USER_DEF_VME_CAEN_V1290_SHORT
+
+#ifndef USER_DEF_VME_CAEN_V775
+FCNCALL_TEMPLATE
+FCNCALL_RET_TYPE FCNCALL_CLASS_NAME(VME_CAEN_V775)::FCNCALL_NAME(VME_CAEN_V775)
+{
+  FCNCALL_INIT;
+  // raw_array_zero_suppress<DATA12_OVERFLOW,DATA12_OVERFLOW,32> data;
+  {
+  FCNCALL_SUBNAME("data");
+  { FCNCALL_CALL_CTRL_WRAP(data,data.FCNCALL_CALL(data)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // union 
+  // {
+    // struct 
+    // {
+      // uint32 event_number : 24;
+      // uint32 unnamed_24_26 : 3;
+      // uint32 geom : 5;
+    // } ;
+    // uint32 u32;
+  // } eob;
+  {
+  FCNCALL_SUBNAME("eob");
+#if !STRUCT_ONLY_LAST_UNION_MEMBER
+  // struct 
+  // {
+    // uint32 event_number : 24;
+    // uint32 unnamed_24_26 : 3;
+    // uint32 geom : 5;
+  // } ;
+  // uint32 event_number : 24;
+  {
+  FCNCALL_SUBNAME("event_number");
+  { FCNCALL_CALL_CTRL_WRAP(eob.event_number,FCNCALL_CALL_TYPE/*_BITFIELD*/(uint32,eob.event_number)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // uint32 unnamed_24_26 : 3;
+  {
+  FCNCALL_SUBNAME("unnamed_24_26");
+  { FCNCALL_CALL_CTRL_WRAP(eob.unnamed_24_26,FCNCALL_CALL_TYPE/*_BITFIELD*/(uint32,eob.unnamed_24_26)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // uint32 geom : 5;
+  {
+  FCNCALL_SUBNAME("geom");
+  { FCNCALL_CALL_CTRL_WRAP(eob.geom,FCNCALL_CALL_TYPE/*_BITFIELD*/(uint32,eob.geom)); }
+  FCNCALL_SUBNAME_END;
+  }
+#endif// !STRUCT_ONLY_LAST_UNION_MEMBER
+  // uint32 u32;
+  {
+  FCNCALL_SUBNAME("u32");
+  { FCNCALL_CALL_CTRL_WRAP(eob.u32,FCNCALL_CALL_TYPE(uint32,eob.u32)); }
+  FCNCALL_SUBNAME_END;
+  }
+  FCNCALL_SUBNAME_END;
+  }
+  FCNCALL_RET;
+}
+#endif//USER_DEF_VME_CAEN_V775
+
+#ifndef USER_DEF_VME_CAEN_V830
+FCNCALL_TEMPLATE
+FCNCALL_RET_TYPE FCNCALL_CLASS_NAME(VME_CAEN_V830)::FCNCALL_NAME(VME_CAEN_V830)
+{
+  FCNCALL_INIT;
+  // raw_array_zero_suppress<DATA32,DATA32,32> data;
+  {
+  FCNCALL_SUBNAME("data");
+  { FCNCALL_CALL_CTRL_WRAP(data,data.FCNCALL_CALL(data)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // union 
+  // {
+    // struct 
+    // {
+      // uint32 event_number : 16;
+      // uint32 ts : 2;
+      // uint32 count : 6;
+      // uint32 dummy_24_25 : 2;
+      // uint32 unnamed_26_26 : 1;
+      // uint32 geom : 5;
+    // } ;
+    // uint32 u32;
+  // } header;
+  {
+  FCNCALL_SUBNAME("header");
+#if !STRUCT_ONLY_LAST_UNION_MEMBER
+  // struct 
+  // {
+    // uint32 event_number : 16;
+    // uint32 ts : 2;
+    // uint32 count : 6;
+    // uint32 dummy_24_25 : 2;
+    // uint32 unnamed_26_26 : 1;
+    // uint32 geom : 5;
+  // } ;
+  // uint32 event_number : 16;
+  {
+  FCNCALL_SUBNAME("event_number");
+  { FCNCALL_CALL_CTRL_WRAP(header.event_number,FCNCALL_CALL_TYPE/*_BITFIELD*/(uint32,header.event_number)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // uint32 ts : 2;
+  {
+  FCNCALL_SUBNAME("ts");
+  { FCNCALL_CALL_CTRL_WRAP(header.ts,FCNCALL_CALL_TYPE/*_BITFIELD*/(uint32,header.ts)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // uint32 count : 6;
+  {
+  FCNCALL_SUBNAME("count");
+  { FCNCALL_CALL_CTRL_WRAP(header.count,FCNCALL_CALL_TYPE/*_BITFIELD*/(uint32,header.count)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // uint32 dummy_24_25 : 2;
+  {
+  FCNCALL_SUBNAME("dummy_24_25");
+  { FCNCALL_CALL_CTRL_WRAP(header.dummy_24_25,FCNCALL_CALL_TYPE/*_BITFIELD*/(uint32,header.dummy_24_25)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // uint32 unnamed_26_26 : 1;
+  {
+  FCNCALL_SUBNAME("unnamed_26_26");
+  { FCNCALL_CALL_CTRL_WRAP(header.unnamed_26_26,FCNCALL_CALL_TYPE/*_BITFIELD*/(uint32,header.unnamed_26_26)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // uint32 geom : 5;
+  {
+  FCNCALL_SUBNAME("geom");
+  { FCNCALL_CALL_CTRL_WRAP(header.geom,FCNCALL_CALL_TYPE/*_BITFIELD*/(uint32,header.geom)); }
+  FCNCALL_SUBNAME_END;
+  }
+#endif// !STRUCT_ONLY_LAST_UNION_MEMBER
+  // uint32 u32;
+  {
+  FCNCALL_SUBNAME("u32");
+  { FCNCALL_CALL_CTRL_WRAP(header.u32,FCNCALL_CALL_TYPE(uint32,header.u32)); }
+  FCNCALL_SUBNAME_END;
+  }
+  FCNCALL_SUBNAME_END;
+  }
+  FCNCALL_RET;
+}
+#endif//USER_DEF_VME_CAEN_V830
+
+#ifndef USER_DEF_VME_MESYTEC_MADC32
+FCNCALL_TEMPLATE
+FCNCALL_RET_TYPE FCNCALL_CLASS_NAME(VME_MESYTEC_MADC32)::FCNCALL_NAME(VME_MESYTEC_MADC32)
+{
+  FCNCALL_INIT;
+  // raw_array_zero_suppress<DATA14_OVERFLOW,DATA14_OVERFLOW,32> data;
+  {
+  FCNCALL_SUBNAME("data");
+  { FCNCALL_CALL_CTRL_WRAP(data,data.FCNCALL_CALL(data)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // union 
+  // {
+    // struct 
+    // {
+      // uint32 counter : 30;
+      // uint32 unnamed_30_31 : 2;
+    // } ;
+    // uint32 u32;
+  // } end_of_event;
+  {
+  FCNCALL_SUBNAME("end_of_event");
+#if !STRUCT_ONLY_LAST_UNION_MEMBER
+  // struct 
+  // {
+    // uint32 counter : 30;
+    // uint32 unnamed_30_31 : 2;
+  // } ;
+  // uint32 counter : 30;
+  {
+  FCNCALL_SUBNAME("counter");
+  { FCNCALL_CALL_CTRL_WRAP(end_of_event.counter,FCNCALL_CALL_TYPE/*_BITFIELD*/(uint32,end_of_event.counter)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // uint32 unnamed_30_31 : 2;
+  {
+  FCNCALL_SUBNAME("unnamed_30_31");
+  { FCNCALL_CALL_CTRL_WRAP(end_of_event.unnamed_30_31,FCNCALL_CALL_TYPE/*_BITFIELD*/(uint32,end_of_event.unnamed_30_31)); }
+  FCNCALL_SUBNAME_END;
+  }
+#endif// !STRUCT_ONLY_LAST_UNION_MEMBER
+  // uint32 u32;
+  {
+  FCNCALL_SUBNAME("u32");
+  { FCNCALL_CALL_CTRL_WRAP(end_of_event.u32,FCNCALL_CALL_TYPE(uint32,end_of_event.u32)); }
+  FCNCALL_SUBNAME_END;
+  }
+  FCNCALL_SUBNAME_END;
+  }
+  FCNCALL_RET;
+}
+#endif//USER_DEF_VME_MESYTEC_MADC32
+
+#ifndef USER_DEF_VME_MESYTEC_MDPP16
+FCNCALL_TEMPLATE
+FCNCALL_RET_TYPE FCNCALL_CLASS_NAME(VME_MESYTEC_MDPP16)::FCNCALL_NAME(VME_MESYTEC_MDPP16)
+{
+  FCNCALL_INIT;
+  // raw_array_multi_zero_suppress<DATA16_OVERFLOW,DATA16_OVERFLOW,16,20> adc;
+  {
+  FCNCALL_SUBNAME("adc");
+  { FCNCALL_CALL_CTRL_WRAP(adc,adc.FCNCALL_CALL(adc)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // raw_array_multi_zero_suppress<DATA16_OVERFLOW,DATA16_OVERFLOW,16,20> tdc;
+  {
+  FCNCALL_SUBNAME("tdc");
+  { FCNCALL_CALL_CTRL_WRAP(tdc,tdc.FCNCALL_CALL(tdc)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // raw_array_multi_zero_suppress<DATA16_OVERFLOW,DATA16_OVERFLOW,16,20> trig_tdc;
+  {
+  FCNCALL_SUBNAME("trig_tdc");
+  { FCNCALL_CALL_CTRL_WRAP(trig_tdc,trig_tdc.FCNCALL_CALL(trig_tdc)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // raw_array_multi_zero_suppress<DATA16_OVERFLOW,DATA16_OVERFLOW,16,20> adc_short;
+  {
+  FCNCALL_SUBNAME("adc_short");
+  { FCNCALL_CALL_CTRL_WRAP(adc_short,adc_short.FCNCALL_CALL(adc_short)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // union 
+  // {
+    // struct 
+    // {
+      // uint32 counter : 30;
+      // uint32 unnamed_30_31 : 2;
+    // } ;
+    // uint32 u32;
+  // } end_of_event;
+  {
+  FCNCALL_SUBNAME("end_of_event");
+#if !STRUCT_ONLY_LAST_UNION_MEMBER
+  // struct 
+  // {
+    // uint32 counter : 30;
+    // uint32 unnamed_30_31 : 2;
+  // } ;
+  // uint32 counter : 30;
+  {
+  FCNCALL_SUBNAME("counter");
+  { FCNCALL_CALL_CTRL_WRAP(end_of_event.counter,FCNCALL_CALL_TYPE/*_BITFIELD*/(uint32,end_of_event.counter)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // uint32 unnamed_30_31 : 2;
+  {
+  FCNCALL_SUBNAME("unnamed_30_31");
+  { FCNCALL_CALL_CTRL_WRAP(end_of_event.unnamed_30_31,FCNCALL_CALL_TYPE/*_BITFIELD*/(uint32,end_of_event.unnamed_30_31)); }
+  FCNCALL_SUBNAME_END;
+  }
+#endif// !STRUCT_ONLY_LAST_UNION_MEMBER
+  // uint32 u32;
+  {
+  FCNCALL_SUBNAME("u32");
+  { FCNCALL_CALL_CTRL_WRAP(end_of_event.u32,FCNCALL_CALL_TYPE(uint32,end_of_event.u32)); }
+  FCNCALL_SUBNAME_END;
+  }
+  FCNCALL_SUBNAME_END;
+  }
+  FCNCALL_RET;
+}
+#endif//USER_DEF_VME_MESYTEC_MDPP16
+
+#ifndef USER_DEF_CROS3_SUBEVENT
+FCNCALL_TEMPLATE
+FCNCALL_RET_TYPE FCNCALL_CLASS_NAME(CROS3_SUBEVENT)::FCNCALL_NAME(CROS3_SUBEVENT)
+{
+  FCNCALL_INIT;
+  FCNCALL_CALL_CTRL_WRAP(unpack_subevent_base,FCNCALL_CLASS_NAME(unpack_subevent_base)::FCNCALL_CALL_BASE());
+  // EXTERNAL_DATA16 data16;
+  {
+  FCNCALL_SUBNAME("data16");
+  { FCNCALL_CALL_CTRL_WRAP(data16,data16.FCNCALL_CALL(data16)); }
+  FCNCALL_SUBNAME_END;
+  }
+  FCNCALL_RET;
+}
+#endif//USER_DEF_CROS3_SUBEVENT
+
+#ifndef USER_DEF_unpack_event
+FCNCALL_TEMPLATE
+FCNCALL_RET_TYPE FCNCALL_CLASS_NAME(unpack_event)::FCNCALL_NAME(unpack_event)
+{
+  FCNCALL_INIT;
+  FCNCALL_CALL_CTRL_WRAP(unpack_event_base,FCNCALL_CLASS_NAME(unpack_event_base)::FCNCALL_CALL_BASE());
+  // CROS3_SUBEVENT cros3;
+  {
+  FCNCALL_SUBNAME("cros3");
+  { FCNCALL_CALL_CTRL_WRAP(cros3,cros3.FCNCALL_CALL(cros3)); }
+  FCNCALL_SUBNAME_END;
+  }
+  FCNCALL_RET;
+}
+#endif//USER_DEF_unpack_event
+
+#ifndef USER_DEF_unpack_sticky_event
+FCNCALL_TEMPLATE
+FCNCALL_RET_TYPE FCNCALL_CLASS_NAME(unpack_sticky_event)::FCNCALL_NAME(unpack_sticky_event)
+{
+  FCNCALL_INIT;
+  FCNCALL_CALL_CTRL_WRAP(unpack_sticky_event_base,FCNCALL_CLASS_NAME(unpack_sticky_event_base)::FCNCALL_CALL_BASE());
+  FCNCALL_RET;
+}
+#endif//USER_DEF_unpack_sticky_event
+
+#include "gen/default_fcncall_undef.hh"
+
+
+/** END_FUNCTION_CALL_PER_MEMBER **************************************/
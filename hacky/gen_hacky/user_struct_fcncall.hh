@@ -0,0 +1,69 @@
+/** BEGIN_FUNCTION_CALL_PER_MEMBER *************************************
+ *
+ * Recursive function calls per member.
+ *
+ * Do not edit - automatically generated.
+ */
+
+#include "gen/default_fcncall_define.hh"
+
+#ifndef USER_DEF_CROS3_wire_hit
+FCNCALL_TEMPLATE
+FCNCALL_RET_TYPE FCNCALL_CLASS_NAME(CROS3_wire_hit)::FCNCALL_NAME(CROS3_wire_hit)
+{
+  FCNCALL_INIT;
+  // uint16 wire;
+  {
+  FCNCALL_SUBNAME("wire");
+  { FCNCALL_CALL_CTRL_WRAP(wire,FCNCALL_CALL_TYPE(uint16,wire)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // uint16 start;
+  {
+  FCNCALL_SUBNAME("start");
+  { FCNCALL_CALL_CTRL_WRAP(start,FCNCALL_CALL_TYPE(uint16,start)); }
+  FCNCALL_SUBNAME_END;
+  }
+  FCNCALL_RET;
+}
+#endif//USER_DEF_CROS3_wire_hit
+
+#ifndef USER_DEF_CROS3_hits
+FCNCALL_TEMPLATE
+FCNCALL_RET_TYPE FCNCALL_CLASS_NAME(CROS3_hits)::FCNCALL_NAME(CROS3_hits)
+{
+  FCNCALL_INIT;
+  // raw_list_zero_suppress<CROS3_wire_hit,CROS3_wire_hit,1024> hits;
+  {
+  FCNCALL_SUBNAME("hits");
+  { FCNCALL_CALL_CTRL_WRAP(hits,hits.FCNCALL_CALL(hits)); }
+  FCNCALL_SUBNAME_END;
+  }
+  FCNCALL_RET;
+}
+#endif//USER_DEF_CROS3_hits
+
+#ifndef USER_DEF_hacky_user_struct
+FCNCALL_TEMPLATE
+FCNCALL_RET_TYPE FCNCALL_CLASS_NAME(hacky_user_struct)::FCNCALL_NAME(hacky_user_struct)
+{
+  FCNCALL_INIT;
+  // CROS3_hits ccb[2];
+  {
+  FCNCALL_SUBNAME("ccb");
+  FCNCALL_FOR(__i0,2)
+  {
+    FCNCALL_SUBINDEX(__i0);
+    { FCNCALL_CALL_CTRL_WRAP_ARRAY(ccb__i0,,__i0,ccb[__i0].FCNCALL_CALL(ccb[__i0])); }
+    FCNCALL_SUBINDEX_END(__i0);
+  }
+  FCNCALL_SUBNAME_END;
+  }
+  FCNCALL_RET;
+}
+#endif//USER_DEF_hacky_user_struct
+
+#include "gen/default_fcncall_undef.hh"
+
+
+/** END_FUNCTION_CALL_PER_MEMBER **************************************/
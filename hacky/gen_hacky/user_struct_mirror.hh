@@ -0,0 +1,49 @@
+/** BEGIN_MIRROR_STRUCT ************************************************
+ *
+ * Mirror (1 to 1) structure.
+ *
+ * Do not edit - automatically generated.
+ */
+
+#include "gen/default_mirror_define.hh"
+
+#ifndef USER_DEF_CROS3_wire_hit
+STRUCT_MIRROR_TEMPLATE
+struct STRUCT_MIRROR_STRUCT(CROS3_wire_hit)
+{
+public:
+  STRUCT_MIRROR_ITEM_CTRL(wire);
+  STRUCT_MIRROR_TYPE(uint16) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(wire);
+  STRUCT_MIRROR_ITEM_CTRL(start);
+  STRUCT_MIRROR_TYPE(uint16) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(start);
+  STRUCT_MIRROR_FCNS_DECL(CROS3_wire_hit);
+};
+#endif//USER_DEF_CROS3_wire_hit
+
+#ifndef USER_DEF_CROS3_hits
+STRUCT_MIRROR_TEMPLATE
+struct STRUCT_MIRROR_STRUCT(CROS3_hits)
+{
+public:
+  STRUCT_MIRROR_ITEM_CTRL(hits);
+  STRUCT_MIRROR_TYPE(raw_list_zero_suppress) < STRUCT_MIRROR_TYPE_TEMPLATE STRUCT_MIRROR_TEMPLATE_ARG(CROS3_wire_hit),STRUCT_MIRROR_TEMPLATE_ARG(CROS3_wire_hit),1024> STRUCT_MIRROR_NAME(hits);
+  STRUCT_MIRROR_FCNS_DECL(CROS3_hits);
+};
+#endif//USER_DEF_CROS3_hits
+
+#ifndef USER_DEF_hacky_user_struct
+STRUCT_MIRROR_TEMPLATE
+struct STRUCT_MIRROR_STRUCT(hacky_user_struct)
+{
+public:
+  STRUCT_MIRROR_ITEM_CTRL(ccb);
+  STRUCT_MIRROR_ITEM_CTRL_ARRAY(ccb__i0,,2);
+  STRUCT_MIRROR_TYPE(CROS3_hits) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(ccb[2]);
+  STRUCT_MIRROR_FCNS_DECL(hacky_user_struct);
+};
+#endif//USER_DEF_hacky_user_struct
+
+#include "gen/default_mirror_undef.hh"
+
+
+/** END_MIRROR_STRUCT *************************************************/
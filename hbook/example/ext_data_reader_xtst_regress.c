@@ -77,12 +77,19 @@ int main(int argc,char *argv[])
   int hevent_id = -1;
   int hsticky_id = -1;
 
+  uint32_t subset_prescale = 0;
+
   if (argc < 2)
     {
-      fprintf (stderr,"No server name given, usage: %s SERVER\n",argv[0]);
+      fprintf (stderr,"No server name given, "
+	       "usage: %s SERVER [--subset=PRESCALE]\n",argv[0]);
       exit(1);
     }
 
+  /* Ask the server for only the mapped members, every N-th event. */
+  if (argc > 2 && strncmp(argv[2],"--subset=",9) == 0)
+    subset_prescale = (uint32_t) atoi(argv[2] + 9);
+
   struct_info = ext_data_struct_info_alloc();
   if (struct_info == NULL)
     {
@@ -122,6 +129,10 @@ int main(int argc,char *argv[])
   if (client == NULL)
     exit(1);
 
+  if (subset_prescale &&
+      !ext_data_request_subset_stderr(client, subset_prescale, 0))
+    exit(1);
+
   if (!ext_data_setup_stderr(client,
 #if 0 /* Do it by the structure info, so we can handle differing input. */
 			     &event_layout,sizeof(event_layout),
@@ -159,6 +170,11 @@ int main(int argc,char *argv[])
       /* exit(1); */
     }
   
+  /* All sticky events are needed. */
+  if (subset_prescale &&
+      !ext_data_request_subset_stderr(client, 1, 0))
+    exit(1);
+
   if (!ext_data_setup_stderr(client,
 			     NULL, 0,
 			     sticky_struct_info, &struct_map_success,
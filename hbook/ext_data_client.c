@@ -175,6 +175,11 @@ struct ext_data_client
   int _state;
 
   int _fetched_event;
+
+  /* Subset to ask the server for (ext_data_request_subset()). */
+  int      _subset;
+  uint32_t _subset_prescale;
+  uint32_t _subset_trigger_mask;
 };
 
 /* Layout of the structure information generated.
@@ -1112,6 +1117,10 @@ struct ext_data_client *ext_data_create_client(size_t buf_alloc)
 
   client->_fetched_event = 0;
 
+  client->_subset = 0;
+  client->_subset_prescale = 1;
+  client->_subset_trigger_mask = 0;
+
   if (buf_alloc)
     {
       /* Get us a buffer for reading. */
@@ -1159,18 +1168,14 @@ ext_data_alloc_client_struct(struct ext_data_client *client)
   return clistr;
 }
 
-static int ext_data_send_magic(struct ext_data_client *client)
+static int ext_data_send_all(struct ext_data_client *client,
+			     const void *buf,size_t size)
 {
   size_t sent;
-  uint32_t magic = htonl(~EXTERNAL_WRITER_MAGIC);
-
-  /* Send a 32-bit magic, to distinguish us from a possible http
-   * client.
-   */
 
   sent = 0;
 
-  while (sent < sizeof(magic))
+  while (sent < size)
     {
       fd_set writefds;
       int nfd;
@@ -1201,9 +1206,9 @@ static int ext_data_send_magic(struct ext_data_client *client)
 	  return 0;
 	}
 
-      left = sizeof(magic) - sent;
+      left = size - sent;
 
-      n = write(client->_fd,((char*) &magic)+sent,left);
+      n = write(client->_fd,((const char*) buf)+sent,left);
 
       if (n == -1)
 	{
@@ -1223,6 +1228,18 @@ static int ext_data_send_magic(struct ext_data_client *client)
   return 1;
 }
 
+static int ext_data_send_magic(struct ext_data_client *client,
+			       uint32_t policy)
+{
+  uint32_t magic = htonl(~(EXTERNAL_WRITER_MAGIC ^ policy));
+
+  /* Send a 32-bit magic, to distinguish us from a possible http
+   * client.  The data server also takes the policy from it.
+   */
+
+  return ext_data_send_all(client,&magic,sizeof(magic));
+}
+
 
 struct ext_data_client *ext_data_connect(const char *server)
 {
@@ -1245,15 +1262,42 @@ struct ext_data_client *ext_data_connect(const char *server)
       int rc;
       struct sockaddr_in serv_addr;
       struct hostent *h;
-      char *hostname, *colon;
+      char *hostname, *colon, *slash;
       unsigned short port = (unsigned short) EXTERNAL_WRITER_DEFAULT_PORT;
+      uint32_t policy = EXTERNAL_WRITER_NET_POLICY_DEFAULT;
       struct external_writer_portmap_msg portmap_msg;
       size_t got;
 
+      hostname = strdup(server);
+
+      if (!hostname)
+	goto errno_return_NULL;
+
+      /* A slash at the end tells what the server shall do if we
+       * cannot keep up.
+       */
+      slash = strchr(hostname,'/');
+
+      if (slash)
+	{
+	  if (strcmp(slash+1,"drop") == 0)
+	    policy = EXTERNAL_WRITER_NET_POLICY_DROP;
+	  else if (strcmp(slash+1,"block") == 0)
+	    policy = EXTERNAL_WRITER_NET_POLICY_BLOCK;
+	  else if (strcmp(slash+1,"downsample") == 0)
+	    policy = EXTERNAL_WRITER_NET_POLICY_DOWNSAMPLE;
+	  else
+	    {
+	      free(hostname);
+	      errno = EINVAL;
+	      goto errno_return_NULL;
+	    }
+	  *slash = 0; // cut the policy
+	}
+
       /* If there is a colon in the hostname, interpret what follows
        * as a port number, overriding the default port.
        */
-      hostname = strdup(server);
       colon = strchr(hostname,':');
 
       if (colon)
@@ -1299,7 +1343,7 @@ struct ext_data_client *ext_data_connect(const char *server)
        * client.
        */
 
-      if (!ext_data_send_magic(client))
+      if (!ext_data_send_magic(client,EXTERNAL_WRITER_NET_POLICY_DEFAULT))
 	goto errno_return_NULL;
 
       /* We've connected to the port server, get the address.  We
@@ -1401,7 +1445,7 @@ struct ext_data_client *ext_data_connect(const char *server)
        * client.
        */
 
-      if (!ext_data_send_magic(client))
+      if (!ext_data_send_magic(client,policy))
 	goto errno_return_NULL;
 
       client->_state = EXT_DATA_STATE_OPEN;
@@ -1533,7 +1577,8 @@ static int ext_data_setup_messages(struct ext_data_client *client)
 
 	    magic = ntohl(p[0]);
 
-	    if (magic != EXTERNAL_WRITER_MAGIC)
+	    if (magic != EXTERNAL_WRITER_MAGIC &&
+		magic != EXTERNAL_WRITER_MAGIC_BLOCKPACK)
 	      {
 		client->_last_error =
 		  "Bad open message magic during setup.";
@@ -2005,6 +2050,191 @@ static int ext_data_setup_messages(struct ext_data_client *client)
   return 0;
 }
 
+int ext_data_request_subset(struct ext_data_client *client,
+			    uint32_t prescale,uint32_t trigger_mask)
+{
+  int i;
+
+  if (!client)
+    {
+      /* client->_last_error = "Client context NULL."; */
+      errno = EFAULT;
+      return -1;
+    }
+
+  if (client->_fd_close == -1)
+    {
+      client->_last_error = "Subset can only be requested from a server.";
+      errno = ENOTSOCK;
+      return -1;
+    }
+
+  /* Structures already set up would not be sent any longer, as the
+   * server only sends structures asked for.
+   */
+
+  if (!client->_subset)
+    for (i = 0; i < client->_num_structures; i++)
+      if (client->_structures[i]._dest_struct_size)
+	{
+	  client->_last_error =
+	    "Subset requested after structure setup.";
+	  errno = EBUSY;
+	  return -1;
+	}
+
+  client->_subset = 1;
+  client->_subset_prescale = prescale ? prescale : 1;
+  client->_subset_trigger_mask = trigger_mask;
+
+  return 0;
+}
+
+static int ext_data_compare_range(const void *a,const void *b)
+{
+  const uint32_t *range_a = (const uint32_t *) a;
+  const uint32_t *range_b = (const uint32_t *) b;
+
+  if (range_a[0] < range_b[0])
+    return -1;
+  return range_a[0] > range_b[0];
+}
+
+/* This function is for internal use.  It tells the server which
+ * (source) items we use of a structure, as given by the map list.
+ * Without map list, we use all.
+ */
+
+static int ext_data_send_select(struct ext_data_client *client,
+				struct ext_data_client_struct *clistr,
+				uint32_t struct_index)
+{
+  struct external_writer_buf_header *header;
+  uint32_t *msg, *ranges, *p, *o;
+  uint32_t max_ranges = 0;
+  uint32_t num_ranges = 0;
+  uint32_t length;
+  uint32_t i;
+  int ret;
+
+  /* Every map list entry is one range, and one per array item. */
+
+  for (o = clistr->_map_list; o < clistr->_map_list_end; )
+    {
+      uint32_t loop = *(o++) & MAP_LIST_MARK_LOOP;
+      o++; /* dest */
+
+      max_ranges++;
+
+      if (loop)
+	{
+	  o++; /* max_loops */
+	  max_ranges += *o;
+	  o += 1 + 2 * *o;
+	}
+    }
+
+  length = (uint32_t) (sizeof (struct external_writer_buf_header) +
+		       (4 + 2 * max_ranges) * sizeof(uint32_t));
+
+  if (length > EXTERNAL_WRITER_NET_SELECT_MAX_LENGTH)
+    {
+      client->_last_error = "Too many items for subset request.";
+      errno = E2BIG;
+      return -1;
+    }
+
+  msg = (uint32_t *) malloc (length);
+
+  if (!msg)
+    {
+      client->_last_error = "Memory allocation failure (subset request).";
+      errno = ENOMEM;
+      return -1;
+    }
+
+  ranges = msg + 2 + 4;
+  p = ranges;
+
+  for (o = clistr->_map_list; o < clistr->_map_list_end; )
+    {
+      uint32_t offset_src_mark = *(o++);
+      uint32_t offset_src = offset_src_mark & MAP_LIST_SRC_OFFSET_MASK;
+      uint32_t loop = offset_src_mark & MAP_LIST_MARK_LOOP;
+      o++; /* dest */
+
+      *(p++) = offset_src;
+      *(p++) = offset_src + (uint32_t) sizeof (uint32_t);
+
+      if (loop)
+	{
+	  uint32_t max_loops = *(o++);
+	  uint32_t loop_size = *(o++);
+
+	  for (i = loop_size; i; i--)
+	    {
+	      offset_src = *(o++) & MAP_LIST_SRC_OFFSET_MASK;
+	      o++; /* dest */
+
+	      if (!max_loops)
+		continue;
+
+	      *(p++) = offset_src;
+	      *(p++) = offset_src + max_loops * (uint32_t) sizeof (uint32_t);
+	    }
+	}
+    }
+
+  /* Sort, and join ranges that touch or overlap. */
+
+  qsort(ranges, (size_t) (p - ranges) / 2, 2 * sizeof (uint32_t),
+	ext_data_compare_range);
+
+  for (o = ranges; o < p; o += 2)
+    {
+      if (num_ranges &&
+	  o[0] <= ranges[2 * num_ranges - 1])
+	{
+	  if (o[1] > ranges[2 * num_ranges - 1])
+	    ranges[2 * num_ranges - 1] = o[1];
+	  continue;
+	}
+      ranges[2 * num_ranges    ] = o[0];
+      ranges[2 * num_ranges + 1] = o[1];
+      num_ranges++;
+    }
+
+  length = (uint32_t) (sizeof (struct external_writer_buf_header) +
+		       (4 + 2 * num_ranges) * sizeof(uint32_t));
+
+  for (i = 0; i < 2 * num_ranges; i++)
+    ranges[i] = htonl(ranges[i]);
+
+  header = (struct external_writer_buf_header *) msg;
+
+  header->_request = htonl(EXTERNAL_WRITER_BUF_NET_SELECT |
+			   EXTERNAL_WRITER_REQUEST_HI_MAGIC);
+  header->_length = htonl(length);
+
+  msg[2] = htonl(struct_index);
+  msg[3] = htonl(client->_subset_prescale);
+  msg[4] = htonl(client->_subset_trigger_mask);
+  msg[5] = htonl(clistr->_map_list ?
+		 num_ranges : EXTERNAL_WRITER_NET_SELECT_ALL);
+
+  ret = ext_data_send_all(client, msg, length);
+
+  free(msg);
+
+  if (!ret)
+    {
+      client->_last_error = "Failure sending subset request.";
+      return -1;
+    }
+
+  return 0;
+}
+
 int ext_data_setup(struct ext_data_client *client,
 		   const void *struct_layout_info,size_t size_info,
 		   struct ext_data_structure_info *struct_info,
@@ -2500,6 +2730,11 @@ int ext_data_setup(struct ext_data_client *client,
 	}
     }
 
+  if (client->_subset &&
+      ext_data_send_select(client, clistr,
+			   (uint32_t) (clistr - client->_structures)) == -1)
+    return -1;
+
   /* It's ok to read data. */
   client->_state = EXT_DATA_STATE_SETUP_READ;
 
@@ -2586,6 +2821,185 @@ int ext_data_write_bitpacked_event(char *dest,size_t dest_size,
   return 0;
 }
 
+/* Block packed events (EXTERNAL_WRITER_COMPACT_BLOCKPACKED).
+ *
+ * Carries the same information as the bitpacked format: for each
+ * item the offset step (in 32-bit words, from the end of the previous
+ * item) and the value.  The byte lengths are however kept in a
+ * separate control stream, such that one control byte gives the
+ * lengths of four numbers, which then can be extracted from the data
+ * stream with one shuffle, without branches.
+ *
+ * [items]    number of items, 32 bits little endian
+ * [control]  (items+1)/2 bytes, 2 bits per number, low bits first:
+ *            step0, value0, step1, value1
+ *            0: number is 0 (no data), 1: 1 byte, 2: 2 bytes, 3: 4 bytes
+ * [data]     the numbers, little endian
+ */
+
+#define EXT_DATA_BP_LEN(c)     ((c) == 3 ? 4 : (c))
+#define EXT_DATA_BP_CODE(b,j)  (((b) >> (2*(j))) & 3)
+
+#define EXT_DATA_BP_CTRL_LEN(b)			\
+  (EXT_DATA_BP_LEN(EXT_DATA_BP_CODE(b,0)) +	\
+   EXT_DATA_BP_LEN(EXT_DATA_BP_CODE(b,1)) +	\
+   EXT_DATA_BP_LEN(EXT_DATA_BP_CODE(b,2)) +	\
+   EXT_DATA_BP_LEN(EXT_DATA_BP_CODE(b,3)))
+
+#if defined(__SSSE3__)
+#include <tmmintrin.h>
+
+/* Tables for all control bytes, c0 being the lowest two bits. */
+
+#define EXT_DATA_BP_C0(X,c1,c2,c3)					\
+  X(0,c1,c2,c3), X(1,c1,c2,c3), X(2,c1,c2,c3), X(3,c1,c2,c3)
+#define EXT_DATA_BP_C1(X,c2,c3)						\
+  EXT_DATA_BP_C0(X,0,c2,c3), EXT_DATA_BP_C0(X,1,c2,c3),		\
+  EXT_DATA_BP_C0(X,2,c2,c3), EXT_DATA_BP_C0(X,3,c2,c3)
+#define EXT_DATA_BP_C2(X,c3)						\
+  EXT_DATA_BP_C1(X,0,c3), EXT_DATA_BP_C1(X,1,c3),			\
+  EXT_DATA_BP_C1(X,2,c3), EXT_DATA_BP_C1(X,3,c3)
+#define EXT_DATA_BP_ALL(X)						\
+  EXT_DATA_BP_C2(X,0), EXT_DATA_BP_C2(X,1),				\
+  EXT_DATA_BP_C2(X,2), EXT_DATA_BP_C2(X,3)
+
+/* Source byte k of a number with code c starting at data offset o. */
+#define EXT_DATA_BP_SHUF_BYTE(o,c,k)			\
+  ((k) < EXT_DATA_BP_LEN(c) ? (o) + (k) : 0x80)
+#define EXT_DATA_BP_SHUF_NUM(o,c)					\
+  EXT_DATA_BP_SHUF_BYTE(o,c,0), EXT_DATA_BP_SHUF_BYTE(o,c,1),		\
+  EXT_DATA_BP_SHUF_BYTE(o,c,2), EXT_DATA_BP_SHUF_BYTE(o,c,3)
+#define EXT_DATA_BP_SHUF(c0,c1,c2,c3)					\
+  { EXT_DATA_BP_SHUF_NUM(0,c0),						\
+    EXT_DATA_BP_SHUF_NUM(EXT_DATA_BP_LEN(c0),c1),			\
+    EXT_DATA_BP_SHUF_NUM(EXT_DATA_BP_LEN(c0)+EXT_DATA_BP_LEN(c1),c2),	\
+    EXT_DATA_BP_SHUF_NUM(EXT_DATA_BP_LEN(c0)+EXT_DATA_BP_LEN(c1)+	\
+			 EXT_DATA_BP_LEN(c2),c3) }
+#define EXT_DATA_BP_LENGTH(c0,c1,c2,c3)				\
+  (EXT_DATA_BP_LEN(c0) + EXT_DATA_BP_LEN(c1) +			\
+   EXT_DATA_BP_LEN(c2) + EXT_DATA_BP_LEN(c3))
+
+static const uint8_t _ext_data_bp_shuffle[256][16] =
+  { EXT_DATA_BP_ALL(EXT_DATA_BP_SHUF) };
+static const uint8_t _ext_data_bp_length[256] =
+  { EXT_DATA_BP_ALL(EXT_DATA_BP_LENGTH) };
+#endif
+
+static uint32_t ext_data_bp_get(const uint8_t *src,int code)
+{
+  switch (code)
+    {
+    case 0:
+      return 0;
+    case 1:
+      return src[0];
+    case 2:
+      return (uint32_t) src[0] | ((uint32_t) src[1] << 8);
+    default:
+      return (uint32_t) src[0] | ((uint32_t) src[1] << 8) |
+	((uint32_t) src[2] << 16) | ((uint32_t) src[3] << 24);
+    }
+}
+
+/* Decode the four numbers of one control byte.  Returns the data
+ * pointer after them, or NULL if the data is too short.
+ */
+
+static const uint8_t *ext_data_bp_decode4(uint32_t num[4],uint8_t ctrl,
+					  const uint8_t *data,
+					  const uint8_t *end_data)
+{
+  int j;
+
+#if defined(__SSSE3__)
+  /* The shuffle loads 16 bytes, only use it away from the end. */
+  if (end_data - data >= 16)
+    {
+      __m128i in   = _mm_loadu_si128((const __m128i *) data);
+      __m128i shuf =
+	_mm_loadu_si128((const __m128i *) _ext_data_bp_shuffle[ctrl]);
+
+      _mm_storeu_si128((__m128i *) num,_mm_shuffle_epi8(in,shuf));
+
+      return data + _ext_data_bp_length[ctrl];
+    }
+#endif
+
+  if (end_data - data < EXT_DATA_BP_CTRL_LEN(ctrl)) // unlikely
+    return NULL;
+
+  for (j = 0; j < 4; j++)
+    {
+      int code = EXT_DATA_BP_CODE(ctrl,j);
+
+      num[j] = ext_data_bp_get(data,code);
+      data += EXT_DATA_BP_LEN(code);
+    }
+
+  return data;
+}
+
+/* This function is for internal use.  It is shared with the
+ * struct_writer.  Returns 0 on success.
+ */
+
+int ext_data_write_blockpacked_event(char *dest,size_t dest_size,
+				     uint8_t *src,uint8_t *end_src)
+{
+  size_t offset = 0;
+  uint32_t items;
+  uint32_t i;
+  const uint8_t *ctrl;
+  const uint8_t *data;
+
+  if (end_src - src < (ssize_t) sizeof(uint32_t)) // unlikely
+    return -1;
+
+  items = ext_data_bp_get(src,3);
+
+  ctrl = src + sizeof(uint32_t);
+
+  if ((size_t) (end_src - ctrl) < ((size_t) items + 1) / 2) // unlikely
+    return -2;
+
+  data = ctrl + ((size_t) items + 1) / 2;
+
+  for (i = 0; i < items; i += 2)
+    {
+      uint32_t num[4];
+      int j;
+
+      data = ext_data_bp_decode4(num,ctrl[i/2],data,end_src);
+
+      if (!data) // unlikely
+	return -3;
+
+      /* For an odd number of items, the last pair is unused (and 0). */
+      for (j = 0; j < 4 && i + (uint32_t) j/2 < items; j += 2)
+	{
+	  if (num[j] >= dest_size) // unlikely
+	    return -4;
+
+	  offset += ((size_t) num[j]) << 2;
+
+	  if (offset + sizeof(uint32_t) > dest_size) // unlikely
+	    return -4;
+
+	  *((uint32_t *) (dest + offset)) = num[j+1];
+
+	  offset += sizeof(uint32_t);
+	}
+    }
+
+  if (data != end_src) // unlikely
+    return -5;
+
+  if (offset != dest_size) // unlikely
+    return -6;
+
+  return 0;
+}
+
 /* This function is for internal use.  It is similar to the code in
  * the struct_writer.  Returns 0 on success.
  */
@@ -2954,14 +3368,15 @@ int ext_data_fetch_event(struct ext_data_client *client,
 			       EXTERNAL_WRITER_COMPACT_NONPACKED);
 
     if (compact_marker != EXTERNAL_WRITER_COMPACT_PACKED &&
-	compact_marker != EXTERNAL_WRITER_COMPACT_NONPACKED)
+	compact_marker != EXTERNAL_WRITER_COMPACT_NONPACKED &&
+	compact_marker != EXTERNAL_WRITER_COMPACT_BLOCKPACKED)
       {
 	client->_last_error = "Compact marker invalid.";
 	errno = EBADMSG;
 	return -1;
       }
 
-    if (compact_marker & EXTERNAL_WRITER_COMPACT_NONPACKED)
+    if (compact_marker == EXTERNAL_WRITER_COMPACT_NONPACKED)
       {
 	int ret;
 	
@@ -3015,9 +3430,14 @@ int ext_data_fetch_event(struct ext_data_client *client,
 
 	start = (uint8_t *) p;
 
-	ret = ext_data_write_bitpacked_event(unpack_buf,
-					     unpack_size,
-					     start,start + real_len);
+	if (compact_marker == EXTERNAL_WRITER_COMPACT_BLOCKPACKED)
+	  ret = ext_data_write_blockpacked_event(unpack_buf,
+						 unpack_size,
+						 start,start + real_len);
+	else
+	  ret = ext_data_write_bitpacked_event(unpack_buf,
+					       unpack_size,
+					       start,start + real_len);
 
 	if (ret)
 	  {
@@ -3601,6 +4021,22 @@ struct ext_data_client *ext_data_connect_stderr(const char *server)
   return client;
 }
 
+int ext_data_request_subset_stderr(struct ext_data_client *client,
+				   uint32_t prescale,uint32_t trigger_mask)
+{
+  int ret = ext_data_request_subset(client,prescale,trigger_mask);
+
+  if (ret == -1)
+    {
+      perror("ext_data_request_subset");
+      fprintf (stderr,"Failed to request data subset: %s\n",
+	       client ? client->_last_error : "");
+      return 0;
+    }
+
+  return 1;
+}
+
 int ext_data_setup_stderr(struct ext_data_client *client,
 			  const void *struct_layout_info,
 			  size_t size_info,
@@ -289,6 +289,10 @@ ext_data_struct_info_print_map_success(struct ext_data_structure_info *
  * @server          Either a HOSTNAME or a HOSTNAME:PORT.
  *                  Alternatively "-" may be specified to use stdin
  *                  (STDIN_FILENO).
+ *                  May be followed by /drop, /block or /downsample
+ *                  to choose what the server does when the client
+ *                  cannot keep up.  Default is given by the server
+ *                  (struct_writer --net-policy), usually drop.
  *
  * Return value:
  *
@@ -300,6 +304,7 @@ ext_data_struct_info_print_map_success(struct ext_data_structure_info *
  * EPROTO           Protocol error, version mismatch?
  * ENOMEM           Failure to allocate memory.
  * ETIMEDOUT        Timeout while trying to get data port number.
+ * EINVAL           Unknown policy after slash.
  *
  * EHOSTDOWN        Hostname not found (not really correct).
  */
@@ -341,6 +346,39 @@ struct ext_data_client *ext_data_open_out();
 
 /*************************************************************************/
 
+/* Ask the server (struct_writer --server) to only send a subset of
+ * the data.  Applies to the structures set up by following calls to
+ * ext_data_setup(), which send the request.  Only the members that
+ * are mapped by @struct_info are then sent, and no events of
+ * structures that are not set up.  Members not sent keep their
+ * values from previous events, as usual.
+ *
+ * Must be called before the first ext_data_setup().  May be called
+ * again before setting up further structures, e.g. with @prescale 1
+ * for a sticky structure.
+ *
+ * @client          Connection context structure.
+ * @prescale        Only send every @prescale-th event.  0 or 1: all.
+ * @trigger_mask    Only send events where bit n is set for trigger n
+ *                  (member TRIGGER).  0: all.
+ *
+ * Servers that do not know about the request send all data.
+ *
+ * Return value:
+ *
+ *  0  success.
+ * -1  failure.  See errno.
+ *
+ * ENOTSOCK         Not connected to a server (ext_data_connect()).
+ * EBUSY            A structure has already been set up.
+ * EFAULT           @client is NULL.
+ */
+
+int ext_data_request_subset(struct ext_data_client *client,
+			    uint32_t prescale,uint32_t trigger_mask);
+
+/*************************************************************************/
+
 /* Consume the header messages and verify that the structure to
  * be filled is correct - alternatively map as many members as is
  * possible.
@@ -382,6 +420,7 @@ struct ext_data_client *ext_data_open_out();
  * EPROTO           Protocol error, version mismatch?
  * EBADMSG          Internal protocol fault.  Bug?
  * ENOMEM           Failure to allocate memory.
+ * E2BIG            Too many items for ext_data_request_subset().
  * EFAULT           @client is NULL.
  *                  @struct_layout_info and @struct_info is NULL.
  */
@@ -704,6 +743,7 @@ const char *ext_data_last_error(struct ext_data_client *client);
  * ext_data_struct_info_free           1 or 0 (failure)
  *
  * ext_data_connect_stderr        pointer or NULL
+ * ext_data_request_subset_stderr 1 or 0
  * ext_data_setup_stderr          1 or 0
  * ext_data_nonblocking_fd_stderr fd or -1
  * ext_data_fetch_event_stderr    1 or 0 (got event, or end of data)
@@ -728,6 +768,9 @@ struct ext_data_client *ext_data_connect_stderr(const char *server);
 
 struct ext_data_client *ext_data_open_out_stderr();
 
+int ext_data_request_subset_stderr(struct ext_data_client *client,
+				   uint32_t prescale,uint32_t trigger_mask);
+
 int ext_data_setup_stderr(struct ext_data_client *client,
 			  const void *struct_layout_info,size_t size_info,
 			  struct ext_data_structure_info *struct_info,
@@ -78,6 +78,12 @@ int ext_data_clnt::nonblocking_fd()
   return ext_data_nonblocking_fd((ext_data_client *) _client);
 }
 
+int ext_data_clnt::request_subset(uint32_t prescale,uint32_t trigger_mask)
+{
+  return ext_data_request_subset((ext_data_client *) _client,
+				 prescale,trigger_mask);
+}
+
 int ext_data_clnt::setup(const void *struct_layout_info,
 			 size_t size_info,
 			 ext_data_struct_info *struct_info,
@@ -153,6 +159,13 @@ int ext_data_clnt_stderr::nonblocking_fd()
   return ext_data_nonblocking_fd_stderr((ext_data_client *) _client);
 }
 
+int ext_data_clnt_stderr::request_subset(uint32_t prescale,
+					 uint32_t trigger_mask)
+{
+  return ext_data_request_subset_stderr((ext_data_client *) _client,
+					prescale,trigger_mask);
+}
+
 int ext_data_clnt_stderr::setup(const void *struct_layout_info,
 				size_t size_info,
 				ext_data_struct_info *struct_info,
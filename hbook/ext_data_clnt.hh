@@ -43,6 +43,8 @@ public:
   bool connect(int fd);
   int nonblocking_fd();
 
+  int request_subset(uint32_t prescale,uint32_t trigger_mask = 0);
+
   /* NOTE: default arguments for name_id and struct_id will be removed.
    * Only here to simplify transition.  Also fetch_event.
    */
@@ -65,6 +65,7 @@
 
 #define EXTERNAL_WRITER_COMPACT_PACKED    0x80000000
 #define EXTERNAL_WRITER_COMPACT_NONPACKED 0x40000000
+#define EXTERNAL_WRITER_COMPACT_BLOCKPACKED 0xc0000000 // both bits
 
 /* ARRAY_IND1 is LOOP with indices of items in first member of each entry */
 /* ARRAY_MIND is a first LOOP with index and end-number of items as
@@ -97,6 +98,37 @@
 
 #define EXTERNAL_WRITER_MAGIC (0x57e65c73u +36) // change with protocol version
 
+/* Sent instead in the open message by servers that send block packed
+ * events (struct_writer --blockpack).  Clients that do not know that
+ * format thus refuse the data already during setup.
+ */
+#define EXTERNAL_WRITER_MAGIC_BLOCKPACK (EXTERNAL_WRITER_MAGIC ^ 0x0b10c000u)
+
+/* How the struct server treats a client that cannot keep up.  A
+ * client asks for a policy by sending ~(EXTERNAL_WRITER_MAGIC ^
+ * policy) as the magic of its data connection.  (Plain ~MAGIC, as
+ * sent by older clients, gives the server default.)
+ */
+#define EXTERNAL_WRITER_NET_POLICY_DEFAULT     0 // server choice
+#define EXTERNAL_WRITER_NET_POLICY_DROP        1 // skip oldest data
+#define EXTERNAL_WRITER_NET_POLICY_BLOCK       2 // stall the server
+#define EXTERNAL_WRITER_NET_POLICY_DOWNSAMPLE  3 // every other chunk
+#define EXTERNAL_WRITER_NET_POLICY_MASK        0x0000000fu
+
+/* After the magic, a client may ask the struct server to only send a
+ * subset of the events and members of a structure (see
+ * ext_data_request_subset()).  One message per structure, with an
+ * external_writer_buf_header, followed by (network order):
+ *
+ * struct_index, prescale, trigger_mask, num_ranges, and then
+ * num_ranges pairs of [start,end) byte offsets (sorted, 4-byte
+ * aligned, not overlapping).  num_ranges == NET_SELECT_ALL gives all
+ * members.  Structures not asked for are then no longer sent.
+ */
+#define EXTERNAL_WRITER_BUF_NET_SELECT    0x20
+#define EXTERNAL_WRITER_NET_SELECT_ALL    0xffffffffu
+#define EXTERNAL_WRITER_NET_SELECT_MAX_LENGTH  0x00100000 // 1 MB
+
 #define EXTERNAL_WRITER_REQUEST_HI_MASK   0xffff0000u
 #define EXTERNAL_WRITER_REQUEST_LO_MASK   0x0000ffffu
 #define EXTERNAL_WRITER_REQUEST_HI_MAGIC  0x76c30000u
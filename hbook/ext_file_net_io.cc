@@ -35,16 +35,28 @@
 #include <netdb.h>
 #include <sys/socket.h>
 #include <sys/time.h>
+#include <sys/uio.h>
+#ifdef HAVE_EPOLL
+#include <sys/epoll.h>
+#endif
 
 #include "ext_file_error.hh"
 
+#ifdef BUILD_LAND02
+#include "../../lu_common/ucesb_probe.hh"
+#else
+#include "../lu_common/ucesb_probe.hh"
+#endif
+
 extern const char *_argv0;
 extern int _got_sigio;
 
 /* Very simple network communication.
  *
  * The server several connections, and handle them with a select()
- * statement.  (As usual.)
+ * statement.  (As usual.)  With epoll (Linux), the descriptors are
+ * instead registered once, and only changes of interest (a client
+ * running out of data to write, or getting new) touch the kernel.
  *
  * When reading data, which can only be done by one source at a time,
  * also the source may be included in the select statement, making the
@@ -77,10 +89,28 @@ extern int _got_sigio;
  * anything else.
  *
  * This is all quite similar to the file_input/lmd_output_tcp.cc
- * server handling, except that we do the buffering on direct items,
- * which certainly is less efficient.  This can actually be somewhat
- * fixed by merging items at the end into larger chunks (as long as
- * there are no readers.
+ * server handling, except that we do the buffering on direct items.
+ * Items are appended to the last chunk as long as it has room, and
+ * a client is fed several consecutive chunks with one writev().
+ *
+ * What happens to a client that cannot keep up is its policy (asked
+ * for by the client with its magic, or the server default):
+ *
+ * drop:        As described above, reclaimed chunks are skipped.
+ * block:       Chunks not yet sent to the client are not reclaimed.
+ *              When the buffer is full, the server waits for the
+ *              client, stalling the data source.
+ * downsample:  When lagging more than a quarter of the buffer,
+ *              every other chunk is skipped, such that the client
+ *              sees a thinned out stream instead of gaps.
+ *
+ * After the magic, a client may ask for only a subset of the data
+ * (NET_SELECT messages, one per structure).  Clients asking for the
+ * same are served by a common stream, with its own list of event
+ * chunks.  The events are encoded for each stream by the writer.
+ * Init chunks are common to all.  A client that changes stream
+ * continues at the last chunk of the new stream, after finishing its
+ * current chunk.
  */
 
 struct send_item_chunk
@@ -91,6 +121,11 @@ struct send_item_chunk
   size_t _alloc;
   size_t _length;    // of data
   int    _consumers; // active consumers (cannot reclaim if > 0)
+  int    _blockers;  // consumers with block policy (stop reclaim)
+  int    _init;      // in _init_chunks
+  uint64_t _start;   // of data, in committed bytes (to measure lag)
+
+  struct send_item_chunk *_list; // head of the list we are in
 
   char   _data[];
 };
@@ -102,6 +137,24 @@ send_item_chunk _event_chunks = { &_event_chunks, &_event_chunks, 0, 0 };
 
 #define MAX_BUFFER_MEMORY 0x01000000 // 16 MB
 
+struct ext_net_stream
+{
+  struct ext_net_stream *_next;
+  struct ext_net_stream *_prev;
+
+  send_item_chunk *_chunks;    // list head, event data for the stream
+
+  int              _clients;
+
+  // What is wanted, per structure (_prescale 0: nothing)
+
+  uint32_t         _num_select;
+  ext_net_select  *_select;
+};
+
+ext_net_stream _ext_net_streams =
+  { &_ext_net_streams, &_ext_net_streams, NULL, 0, 0, NULL };
+
 struct send_client
 {
   struct send_client *_next;
@@ -115,10 +168,33 @@ struct send_client
 
   send_item_chunk* _chunk;
   size_t           _offset;
+
+  // Magic from the client (with the policy request)
+
+  uint32_t         _magic;
+  size_t           _magic_got;
+
+  int              _policy;
+  int              _skip_next; // toggle for downsample
+
+  uint32_t         _events;    // current interest (epoll)
+
+  // Subset request being received (after the magic)
+
+  external_writer_buf_header _req_header;
+  uint32_t        *_req_msg;
+  size_t           _req_got;
+
+  // What the client asked for, and the stream serving it (NULL: all)
+
+  uint32_t         _num_select;
+  ext_net_select  *_select;
+  ext_net_stream  *_stream;
 };
 
 send_client _ext_net_clients =
-  { &_ext_net_clients, &_ext_net_clients, -1, NULL, 0 };
+  { &_ext_net_clients, &_ext_net_clients, -1, NULL, 0, 0, 0, 0, 0, 0,
+    { 0, 0 }, NULL, 0, 0, NULL, NULL };
 
 struct portmap_client
 {
@@ -132,10 +208,12 @@ struct portmap_client
   // Where we're writing
 
   size_t           _offset;
+
+  uint32_t         _events;    // current interest (epoll)
 };
 
 portmap_client _ext_net_portmaps =
-  { &_ext_net_portmaps, &_ext_net_portmaps, -1, 0 };
+  { &_ext_net_portmaps, &_ext_net_portmaps, -1, 0, 0 };
 
 void check_list_integrity()
 {
@@ -160,6 +238,8 @@ void check_list_integrity()
       if (iter->_chunk)
 	{
 	  assert(iter->_chunk->_consumers);
+	  assert(iter->_policy != EXTERNAL_WRITER_NET_POLICY_BLOCK ||
+		 iter->_chunk->_blockers);
 	  assert(iter->_offset <= iter->_chunk->_length);
 	}
       assert(iter->_next->_prev == iter);
@@ -180,17 +260,273 @@ void check_list_integrity()
 
 #define CHECK_LIST_INTEGRITY // check_list_integrity()
 
-int _delayed_got_sigio = 0;
+// What the multiplexer should wait for, per socket.
 
-char *ext_net_io_reserve_chunk(size_t length,bool init_chunk,
-			       send_item_chunk **chunk)
+#define EXT_NET_IO_WANT_READ   0x01
+#define EXT_NET_IO_WANT_WRITE  0x02
+
+#ifdef HAVE_EPOLL
+int _ext_net_epoll_fd = -1;
+
+// What an epoll event is about is given by the low bits of the
+// (malloc aligned) pointer.
+
+#define EXT_NET_EPOLL_CALLER     0
+#define EXT_NET_EPOLL_SERVER     1
+#define EXT_NET_EPOLL_DATA_SERV  2
+#define EXT_NET_EPOLL_CLIENT     3
+#define EXT_NET_EPOLL_PORTMAP    4
+#define EXT_NET_EPOLL_KIND_MASK  7
+
+bool ext_net_io_epoll_ctl(int op,int fd,uint32_t want,void *ptr,int kind,
+			  bool may_fail = false)
 {
-  send_item_chunk *chunk_list;
+  struct epoll_event ev;
+
+  // Also used without server, to wait for the input pipe.
 
-  if (init_chunk)
-    chunk_list = &_init_chunks;
+  if (_ext_net_epoll_fd == -1)
+    {
+      _ext_net_epoll_fd = ::epoll_create(16); // size is only a hint
+
+      if (_ext_net_epoll_fd == -1)
+	{
+	  perror("epoll_create()");
+	  ERR_MSG("Failure creating I/O multiplexer.");
+	}
+    }
+
+  memset(&ev,0,sizeof(ev));
+  if (want & EXT_NET_IO_WANT_READ)
+    ev.events |= EPOLLIN;
+  if (want & EXT_NET_IO_WANT_WRITE)
+    ev.events |= EPOLLOUT;
+  ev.data.u64 = ((uint64_t) (size_t) ptr) | (uint64_t) kind;
+
+  if (::epoll_ctl(_ext_net_epoll_fd,op,fd,&ev) != 0)
+    {
+      if (may_fail && errno == EPERM)
+	return false;
+      perror("epoll_ctl()");
+      ERR_MSG("Failure updating I/O multiplexer (fd %d).",fd);
+    }
+  return true;
+}
+#endif
+
+void ext_net_io_client_interest(send_client *client)
+{
+  // The magic and subset requests are read as soon as they come.
+  // Readable is also how we see the client close (at shutdown).
+  uint32_t want = EXT_NET_IO_WANT_READ;
+
+  if (client->_chunk)
+    want |= EXT_NET_IO_WANT_WRITE;
+
+  if (want == client->_events)
+    return;
+
+#ifdef HAVE_EPOLL
+  ext_net_io_epoll_ctl(EPOLL_CTL_MOD,client->_fd,want,
+		       client,EXT_NET_EPOLL_CLIENT);
+#endif
+  client->_events = want;
+}
+
+void ext_net_io_portmap_interest(portmap_client *portmap)
+{
+  uint32_t want;
+
+  if (portmap->_offset < sizeof(external_writer_portmap_msg))
+    want = EXT_NET_IO_WANT_WRITE;
   else
-    chunk_list = &_event_chunks;
+    want = EXT_NET_IO_WANT_READ; // wait for the client to close
+
+  if (want == portmap->_events)
+    return;
+
+#ifdef HAVE_EPOLL
+  ext_net_io_epoll_ctl(EPOLL_CTL_MOD,portmap->_fd,want,
+		       portmap,EXT_NET_EPOLL_PORTMAP);
+#endif
+  portmap->_events = want;
+}
+
+// Move the client to another chunk (or none).  The chunk it uses
+// cannot be reclaimed, and if it blocks, neither can later ones.
+
+void ext_net_io_client_set_chunk(send_client *client,
+				 send_item_chunk *chunk)
+{
+  if (client->_chunk)
+    {
+      client->_chunk->_consumers--;
+      if (client->_policy == EXTERNAL_WRITER_NET_POLICY_BLOCK)
+	client->_chunk->_blockers--;
+    }
+
+  client->_chunk = chunk;
+
+  if (chunk)
+    {
+      chunk->_consumers++;
+      if (client->_policy == EXTERNAL_WRITER_NET_POLICY_BLOCK)
+	chunk->_blockers++;
+    }
+}
+
+const char *_ext_net_policy_names[] =
+  { "default", "drop", "block", "downsample" };
+
+void ext_net_io_client_policy(send_client *client,int policy)
+{
+  if (policy == EXTERNAL_WRITER_NET_POLICY_DEFAULT)
+    policy = _config._net_policy;
+  if (policy == EXTERNAL_WRITER_NET_POLICY_DEFAULT)
+    policy = EXTERNAL_WRITER_NET_POLICY_DROP;
+
+  // Blocking is accounted per chunk, so let go of the current.
+
+  send_item_chunk *chunk = client->_chunk;
+
+  ext_net_io_client_set_chunk(client,NULL);
+  client->_policy = policy;
+  ext_net_io_client_set_chunk(client,chunk);
+}
+
+// The event chunks the client is served from.
+
+send_item_chunk *ext_net_io_client_list(send_client *client)
+{
+  if (client->_stream)
+    return client->_stream->_chunks;
+  return &_event_chunks;
+}
+
+// The chunk to send after chunk.  NULL if there is none (yet).
+// The downsample toggle is taken from and updated in *skip_next, the
+// client is not changed (it only moves on in ext_net_io_client_write).
+
+send_item_chunk *ext_net_io_next_chunk(send_client *client,
+				       send_item_chunk *chunk,
+				       int *skip_next)
+{
+  send_item_chunk *list = ext_net_io_client_list(client);
+  send_item_chunk *next = chunk->_next;
+
+  if (next == &_init_chunks)
+    next = list->_next;
+  else if (!chunk->_init && chunk->_list != list)
+    {
+      // The client changed stream.  Continue with the newest data.
+      next = list->_prev;
+    }
+
+  if (next == list)
+    return NULL;
+
+  // The last chunk is never skipped, it may be the end of data.
+
+  if (client->_policy == EXTERNAL_WRITER_NET_POLICY_DOWNSAMPLE &&
+      !next->_init &&
+      next->_next != list)
+    {
+      uint64_t lag = _net_stat._committed_size - next->_start;
+
+      if (lag > MAX_BUFFER_MEMORY / 4)
+	{
+	  *skip_next ^= 1;
+	  if (*skip_next)
+	    next = next->_next;
+	}
+      else
+	*skip_next = 0;
+    }
+
+  return next;
+}
+
+int _delayed_got_sigio = 0;
+
+size_t ext_net_io_buffer_memory()
+{
+  size_t total = _init_chunks._length + _event_chunks._length;
+
+  for (ext_net_stream *stream = _ext_net_streams._next;
+       stream != &_ext_net_streams; stream = stream->_next)
+    total += stream->_chunks->_length;
+
+  return total;
+}
+
+// The oldest chunk of a list that can be freed.  The last chunk is
+// left alone, as it may still be filled (and be used as source by
+// the writer).  A client with block policy has not got the chunk
+// where it blocks, nor any later chunk yet.
+
+send_item_chunk *ext_net_io_reclaim_candidate(send_item_chunk *chunk_list,
+					      bool *blocked)
+{
+  for (send_item_chunk *iter = chunk_list->_next;
+       iter != chunk_list && iter->_next != chunk_list;
+       iter = iter->_next)
+    {
+      if (iter->_blockers)
+	{
+	  *blocked = true;
+	  return NULL;
+	}
+      if (!iter->_consumers)
+	return iter;
+    }
+  return NULL;
+}
+
+// Free unused chunks while we have too much memory allocated.  The
+// oldest data of all lists goes first, such that the streams do not
+// starve each other.  Returns false if clients with block policy
+// stopped the reclaim.
+
+bool ext_net_io_reclaim(size_t alloc_size,send_item_chunk **chunk)
+{
+  while (ext_net_io_buffer_memory() + alloc_size > MAX_BUFFER_MEMORY)
+    {
+      bool blocked = false;
+      send_item_chunk *try_free =
+	ext_net_io_reclaim_candidate(&_event_chunks,&blocked);
+
+      for (ext_net_stream *stream = _ext_net_streams._next;
+	   stream != &_ext_net_streams; stream = stream->_next)
+	{
+	  send_item_chunk *cand =
+	    ext_net_io_reclaim_candidate(stream->_chunks,&blocked);
+
+	  if (cand && (!try_free || cand->_start < try_free->_start))
+	    try_free = cand;
+	}
+
+      if (!try_free)
+	return !blocked;
+
+      try_free->_prev->_next = try_free->_next;
+      try_free->_next->_prev = try_free->_prev;
+      try_free->_list->_length -=
+	(sizeof(send_item_chunk) + try_free->_alloc);
+
+      if (!*chunk &&
+	  try_free->_alloc + sizeof(send_item_chunk) >= alloc_size)
+	*chunk = try_free; // steal this chunk!
+      else
+	free (try_free);
+    }
+  return true;
+}
+
+char *ext_net_io_reserve_list_chunk(size_t length,
+				    send_item_chunk *chunk_list,
+				    send_item_chunk **chunk)
+{
+  bool init_chunk = (chunk_list == &_init_chunks);
 
   // See if there is room left in the last chunk of the appropriate
   // list
@@ -214,31 +550,22 @@ char *ext_net_io_reserve_chunk(size_t length,bool init_chunk,
 
   *chunk = NULL; // no memory allocated / stolen so far
 
-  // Do we have too much memory allocated?  Then go through the chunk
-  // list and free items.
-  send_item_chunk *iter = _event_chunks._next;
-
-  while (_init_chunks._length + _event_chunks._length +
-	 alloc_size > MAX_BUFFER_MEMORY &&
-	 iter != &_event_chunks)
+  for ( ; ; )
     {
-      send_item_chunk *try_free = iter;
+      // Do we have too much memory allocated?  Then go through the
+      // chunk lists and free items.
+      bool blocked = !ext_net_io_reclaim(alloc_size,chunk);
 
-      iter = iter->_next;
+      if (!blocked || *chunk)
+	break;
 
-      if (!try_free->_consumers)
-	{
-	  try_free->_prev->_next = try_free->_next;
-	  try_free->_next->_prev = try_free->_prev;
-	  _event_chunks._length -=
-	    (sizeof(send_item_chunk) + try_free->_length);
-
-	  if (!*chunk &&
-	      try_free->_alloc + sizeof(send_item_chunk) >= alloc_size)
-	    *chunk = try_free; // steal this chunk!
-	  else
-	    free (try_free);
-	}
+      // Nothing could be reclaimed.  Serve the clients until the
+      // blocking one has taken some data.  We are then not reading
+      // any further input either, which stalls the source.
+
+      _net_stat._stalls++;
+
+      ext_net_io_select_clients(-1,-1,false,false);
     }
 
   if (!*chunk)
@@ -247,13 +574,17 @@ char *ext_net_io_reserve_chunk(size_t length,bool init_chunk,
 
       *chunk = (send_item_chunk *) malloc(alloc_size);
 
-      if (!chunk)
+      if (!*chunk)
 	ERR_MSG("Failure allocating memory for chunk.");
     }
 
   (*chunk)->_alloc = alloc_size - sizeof(send_item_chunk);
   (*chunk)->_length = 0;
   (*chunk)->_consumers = 0;
+  (*chunk)->_blockers = 0;
+  (*chunk)->_init = init_chunk;
+  (*chunk)->_start = _net_stat._committed_size;
+  (*chunk)->_list = chunk_list;
 
   assert (!(length & 3));
 
@@ -281,7 +612,22 @@ char *ext_net_io_reserve_chunk(size_t length,bool init_chunk,
   return (*chunk)->_data;
 }
 
-ext_file_net_stat _net_stat = { 0, 0, 0 };
+char *ext_net_io_reserve_chunk(size_t length,bool init_chunk,
+			       send_item_chunk **chunk)
+{
+  return ext_net_io_reserve_list_chunk(length,
+				       init_chunk ?
+				       &_init_chunks : &_event_chunks,
+				       chunk);
+}
+
+char *ext_net_io_reserve_stream_chunk(size_t length,ext_net_stream *stream,
+				      send_item_chunk **chunk)
+{
+  return ext_net_io_reserve_list_chunk(length,stream->_chunks,chunk);
+}
+
+ext_file_net_stat _net_stat = { 0, 0, 0, 0 };
 
 void ext_net_io_commit_chunk(size_t length,send_item_chunk *chunk)
 {
@@ -303,11 +649,12 @@ void ext_net_io_commit_chunk(size_t length,send_item_chunk *chunk)
   for (client = _ext_net_clients._next; client != &_ext_net_clients;
        client = client->_next)
     {
-      if (client->_chunk == NULL)
+      if (client->_chunk == NULL &&
+	  (chunk->_init || chunk->_list == ext_net_io_client_list(client)))
 	{
-	  client->_chunk  = chunk;
+	  ext_net_io_client_set_chunk(client,chunk);
 	  client->_offset = prev_length;
-	  chunk->_consumers++;
+	  ext_net_io_client_interest(client);
 
 	  // We may need to notify the big event handling loop that
 	  // some client now (possibly) could do some I/O for us.
@@ -432,6 +779,15 @@ void ext_net_io_server_bind(int port)
 
   // Both sockets successfully connected
 
+#ifdef HAVE_EPOLL
+  ext_net_io_epoll_ctl(EPOLL_CTL_ADD,_ext_net_server_fd,
+		       EXT_NET_IO_WANT_READ,
+		       NULL,EXT_NET_EPOLL_SERVER);
+  ext_net_io_epoll_ctl(EPOLL_CTL_ADD,_ext_net_data_serv_fd,
+		       EXT_NET_IO_WANT_READ,
+		       NULL,EXT_NET_EPOLL_DATA_SERV);
+#endif
+
   MSG("Started server on port %d (data port %d).",
       port,ntohs(serv_addr.sin_port));
 
@@ -492,6 +848,12 @@ void ext_net_io_server_accept()
 
   portmap->_fd = client_fd;
   portmap->_offset = 0;
+  portmap->_events = EXT_NET_IO_WANT_WRITE;
+
+#ifdef HAVE_EPOLL
+  ext_net_io_epoll_ctl(EPOLL_CTL_ADD,portmap->_fd,portmap->_events,
+		       portmap,EXT_NET_EPOLL_PORTMAP);
+#endif
 
   // Add it to the list of clients
 
@@ -560,11 +922,32 @@ void ext_net_io_data_serv_accept()
   client->_fd = client_fd;
   // client->_cli_addr = cli_addr;
 
-  client->_chunk = _init_chunks._next;
+  assert(_init_chunks._next != &_init_chunks); // or there is no init data
+
+  // Until the magic arrives, the server default applies.
+
+  client->_chunk = NULL;
+  client->_magic = 0;
+  client->_magic_got = 0;
+  client->_skip_next = 0;
+  client->_policy = EXTERNAL_WRITER_NET_POLICY_DEFAULT;
+  ext_net_io_client_policy(client,EXTERNAL_WRITER_NET_POLICY_DEFAULT);
+
+  client->_req_msg = NULL;
+  client->_req_got = 0;
+  client->_num_select = 0;
+  client->_select = NULL;
+  client->_stream = NULL;
+
+  ext_net_io_client_set_chunk(client,_init_chunks._next);
   client->_offset = 0;
-  client->_chunk->_consumers++;
 
-  assert(client->_chunk != &_init_chunks); // or there is no init data
+  client->_events = EXT_NET_IO_WANT_READ | EXT_NET_IO_WANT_WRITE;
+
+#ifdef HAVE_EPOLL
+  ext_net_io_epoll_ctl(EPOLL_CTL_ADD,client->_fd,client->_events,
+		       client,EXT_NET_EPOLL_CLIENT);
+#endif
 
   // Add it to the list of clients
 
@@ -592,6 +975,9 @@ void ext_net_io_data_serv_accept()
 
 
 
+// At most this many chunks are handed to one writev().
+#define EXT_NET_IO_MAX_IOV 16
+
 bool ext_net_io_client_write(send_client *client)
 {
   bool again = false;
@@ -599,9 +985,32 @@ bool ext_net_io_client_write(send_client *client)
  do_write:
   assert (client->_chunk);
 
-  size_t left = client->_chunk->_length - client->_offset;
+  // Gather consecutive chunks, such that many small items need only
+  // one system call.
+
+  struct iovec     iov[EXT_NET_IO_MAX_IOV];
+  send_item_chunk *chunks[EXT_NET_IO_MAX_IOV];
+  int              skips[EXT_NET_IO_MAX_IOV]; // toggle when at chunk
+  int niov = 0;
+  size_t left = 0;
 
-  ssize_t n = write(client->_fd,client->_chunk->_data+client->_offset,left);
+  int skip_next = client->_skip_next;
+
+  for (send_item_chunk *chunk = client->_chunk;
+       chunk && niov < EXT_NET_IO_MAX_IOV;
+       chunk = ext_net_io_next_chunk(client,chunk,&skip_next))
+    {
+      size_t offset = niov ? 0 : client->_offset;
+
+      iov[niov].iov_base = chunk->_data + offset;
+      iov[niov].iov_len  = chunk->_length - offset;
+      chunks[niov] = chunk;
+      skips[niov] = skip_next;
+      left += iov[niov].iov_len;
+      niov++;
+    }
+
+  ssize_t n = writev(client->_fd,iov,niov);
 
   if (n == -1)
     {
@@ -612,7 +1021,7 @@ bool ext_net_io_client_write(send_client *client)
       if (errno == EPIPE) {
 	MSG("Client has disconnected, pipe closed.");
       } else {
-	perror("write");
+	perror("writev");
 	MSG("Error while writing data to client.");
       }
       return false;
@@ -620,31 +1029,41 @@ bool ext_net_io_client_write(send_client *client)
 
   // Write was successful
 
-  _net_stat._sent_size += n;
-
-  client->_offset += n;
+  UCESB_PROBE3(client_write,client->_fd,n,left - n);
 
-  if (client->_offset < client->_chunk->_length)
-    return true;
-
-  // Done with this chunk, find the next one
+  _net_stat._sent_size += n;
 
-  client->_chunk->_consumers--;
-  client->_chunk = client->_chunk->_next;
+  // Move past the chunks that were completely written.
 
-  if (client->_chunk == &_init_chunks)
-    client->_chunk = _event_chunks._next;
+  size_t done = (size_t) n;
 
-  if (client->_chunk == &_event_chunks)
+  for (int i = 0; i < niov; i++)
     {
-      client->_chunk = NULL; // no more data available currently
-      client->_offset = 0; // for use when doing shutdown (consume magic)
+      if (done < iov[i].iov_len)
+	{
+	  if (i)
+	    {
+	      ext_net_io_client_set_chunk(client,chunks[i]);
+	      client->_skip_next = skips[i];
+	      client->_offset = 0;
+	    }
+	  client->_offset += done;
+	  return true;
+	}
+      done -= iov[i].iov_len;
     }
 
+  // Done with all chunks, find the next one
+
+  skip_next = skips[niov-1];
+  ext_net_io_client_set_chunk(client,
+			      ext_net_io_next_chunk(client,chunks[niov-1],
+						    &skip_next));
+  client->_skip_next = skip_next;
+  client->_offset = 0;
+
   if (client->_chunk)
     {
-      client->_chunk->_consumers++;
-      client->_offset = 0;
       // Try to write once more, from this new buffer.  (otherwise,
       // would have to simulate with _got_sigio to avoid getting stuck
       // in main process loop).  However, if we try once more, then the
@@ -654,11 +1073,402 @@ bool ext_net_io_client_write(send_client *client)
       goto do_write;
     }
 
+  // No more data available currently.  (_offset = 0 is used
+  // when new data is committed.)
+
   CHECK_LIST_INTEGRITY;
 
   return true;
 }
 
+void ext_net_io_client_magic(send_client *client)
+{
+  // The magic (if it is one) tells the policy the client wants.
+
+  uint32_t magic = ~ntohl(client->_magic);
+  uint32_t policy = EXTERNAL_WRITER_NET_POLICY_DEFAULT;
+
+  if (((magic ^ EXTERNAL_WRITER_MAGIC) &
+       ~EXTERNAL_WRITER_NET_POLICY_MASK) == 0)
+    policy = (magic ^ EXTERNAL_WRITER_MAGIC);
+
+  if (policy > EXTERNAL_WRITER_NET_POLICY_DOWNSAMPLE)
+    policy = EXTERNAL_WRITER_NET_POLICY_DEFAULT;
+
+  if (policy != EXTERNAL_WRITER_NET_POLICY_DEFAULT)
+    {
+      ext_net_io_client_policy(client,(int) policy);
+      MSG("Client asked for %s policy.",_ext_net_policy_names[policy]);
+    }
+}
+
+bool ext_net_io_select_equal(const ext_net_select *a,
+			     const ext_net_select *b)
+{
+  return (a->_prescale   == b->_prescale &&
+	  a->_trig_mask  == b->_trig_mask &&
+	  a->_num_ranges == b->_num_ranges &&
+	  (a->_num_ranges == EXTERNAL_WRITER_NET_SELECT_ALL ||
+	   !a->_num_ranges ||
+	   memcmp(a->_ranges,b->_ranges,
+		  2 * (size_t) a->_num_ranges * sizeof(uint32_t)) == 0));
+}
+
+void ext_net_io_select_copy(ext_net_select *dest,const ext_net_select *src)
+{
+  *dest = *src;
+  dest->_ranges = NULL;
+  dest->_count = 0;
+
+  if (src->_num_ranges == EXTERNAL_WRITER_NET_SELECT_ALL ||
+      !src->_num_ranges)
+    return;
+
+  size_t size = 2 * (size_t) src->_num_ranges * sizeof(uint32_t);
+
+  dest->_ranges = (uint32_t *) malloc(size);
+
+  if (!dest->_ranges)
+    ERR_MSG("Failure allocating memory for subset ranges.");
+
+  memcpy(dest->_ranges,src->_ranges,size);
+}
+
+void ext_net_io_select_free(uint32_t num_select,ext_net_select *select)
+{
+  for (uint32_t i = 0; i < num_select; i++)
+    free(select[i]._ranges);
+  free(select);
+}
+
+// Find the stream serving what the client asked for, or create it.
+
+ext_net_stream *ext_net_io_find_stream(send_client *client)
+{
+  ext_net_stream *stream;
+
+  for (stream = _ext_net_streams._next; stream != &_ext_net_streams;
+       stream = stream->_next)
+    {
+      if (stream->_num_select != client->_num_select)
+	continue;
+
+      uint32_t i;
+
+      for (i = 0; i < client->_num_select; i++)
+	if (!ext_net_io_select_equal(&stream->_select[i],
+				     &client->_select[i]))
+	  break;
+
+      if (i == client->_num_select)
+	return stream;
+    }
+
+  stream = (ext_net_stream *) malloc(sizeof(ext_net_stream));
+
+  if (!stream)
+    ERR_MSG("Failure allocating memory for stream.");
+
+  stream->_chunks = (send_item_chunk *) malloc(sizeof(send_item_chunk));
+  stream->_select = (ext_net_select *)
+    malloc(client->_num_select * sizeof(ext_net_select));
+
+  if (!stream->_chunks || !stream->_select)
+    ERR_MSG("Failure allocating memory for stream.");
+
+  memset(stream->_chunks,0,sizeof(send_item_chunk));
+  stream->_chunks->_next = stream->_chunks;
+  stream->_chunks->_prev = stream->_chunks;
+
+  stream->_clients = 0;
+
+  stream->_num_select = client->_num_select;
+  for (uint32_t i = 0; i < client->_num_select; i++)
+    ext_net_io_select_copy(&stream->_select[i],&client->_select[i]);
+
+  stream->_next = &_ext_net_streams;
+  stream->_prev =  _ext_net_streams._prev;
+
+  _ext_net_streams._prev->_next = stream;
+  _ext_net_streams._prev = stream;
+
+  return stream;
+}
+
+// Streams are only freed when the writer asks for the next one, such
+// that it cannot lose the one it is working on.
+
+bool ext_net_io_stream_unused(ext_net_stream *stream)
+{
+  if (stream->_clients)
+    return false;
+
+  // A client that changed stream may still be sending a chunk.
+
+  for (send_item_chunk *chunk = stream->_chunks->_next;
+       chunk != stream->_chunks; chunk = chunk->_next)
+    if (chunk->_consumers)
+      return false;
+
+  return true;
+}
+
+void ext_net_io_stream_free(ext_net_stream *stream)
+{
+  send_item_chunk *chunk = stream->_chunks->_next;
+
+  while (chunk != stream->_chunks)
+    {
+      send_item_chunk *next = chunk->_next;
+      free(chunk);
+      chunk = next;
+    }
+  free(stream->_chunks);
+
+  ext_net_io_select_free(stream->_num_select,stream->_select);
+
+  stream->_prev->_next = stream->_next;
+  stream->_next->_prev = stream->_prev;
+
+  free(stream);
+}
+
+ext_net_stream *ext_net_io_next_stream(ext_net_stream *stream)
+{
+  ext_net_stream *next = stream ? stream->_next : _ext_net_streams._next;
+
+  while (next != &_ext_net_streams &&
+	 ext_net_io_stream_unused(next))
+    {
+      ext_net_stream *unused = next;
+      next = next->_next;
+      ext_net_io_stream_free(unused);
+    }
+
+  if (next == &_ext_net_streams)
+    return NULL;
+  return next;
+}
+
+ext_net_select *ext_net_io_stream_select(ext_net_stream *stream,
+					 uint32_t struct_index)
+{
+  if (struct_index >= stream->_num_select ||
+      !stream->_select[struct_index]._prescale)
+    return NULL;
+
+  return &stream->_select[struct_index];
+}
+
+void ext_net_io_copy_to_streams(const void *msg,size_t length)
+{
+  for (ext_net_stream *stream = ext_net_io_next_stream(NULL);
+       stream; stream = ext_net_io_next_stream(stream))
+    {
+      send_item_chunk *chunk;
+
+      char *net_io_chunk =
+	ext_net_io_reserve_stream_chunk(length,stream,&chunk);
+
+      memcpy(net_io_chunk,msg,length);
+
+      ext_net_io_commit_chunk(length,chunk);
+    }
+}
+
+void ext_net_io_client_set_stream(send_client *client,
+				  ext_net_stream *stream)
+{
+  if (client->_stream)
+    client->_stream->_clients--;
+
+  client->_stream = stream;
+
+  if (stream)
+    stream->_clients++;
+
+  // If waiting for data, wait in the new stream.
+
+  if (!client->_chunk)
+    {
+      send_item_chunk *list = ext_net_io_client_list(client);
+
+      if (list->_prev != list)
+	{
+	  ext_net_io_client_set_chunk(client,list->_prev);
+	  client->_offset = 0;
+	}
+    }
+}
+
+// A subset request has been received.  Returns false if malformed.
+
+bool ext_net_io_client_select(send_client *client)
+{
+  uint32_t length = ntohl(client->_req_header._length);
+  uint32_t words =
+    (uint32_t) ((length - sizeof(client->_req_header)) / sizeof(uint32_t));
+  uint32_t *p = client->_req_msg;
+
+  uint32_t struct_index = ntohl(p[0]);
+  uint32_t prescale     = ntohl(p[1]);
+  uint32_t trig_mask    = ntohl(p[2]);
+  uint32_t num_ranges   = ntohl(p[3]);
+
+  // Compare in size_t, such that a huge num_ranges cannot wrap.
+  if (words < 4 ||
+      struct_index >= 0x10000 ||
+      (num_ranges == EXTERNAL_WRITER_NET_SELECT_ALL ?
+       words != 4 :
+       (num_ranges > (words - 4) / 2 ||
+	(size_t) words != 4 + 2 * (size_t) num_ranges)))
+    {
+      MSG("Client sent malformed subset request.");
+      return false;
+    }
+
+  uint32_t num_words = 0;
+  uint32_t prev_end = 0;
+
+  if (num_ranges != EXTERNAL_WRITER_NET_SELECT_ALL)
+    for (uint32_t i = 0; i < 2 * num_ranges; i += 2)
+      {
+	uint32_t start = ntohl(p[4 + i]);
+	uint32_t end   = ntohl(p[4 + i + 1]);
+
+	if ((start | end) & 3 ||
+	    start >= end ||
+	    start < prev_end)
+	  {
+	    MSG("Client sent malformed subset request ranges.");
+	    return false;
+	  }
+
+	p[4 + i]     = start;
+	p[4 + i + 1] = end;
+	num_words += (end - start) / (uint32_t) sizeof(uint32_t);
+	prev_end = end;
+      }
+
+  if (struct_index >= client->_num_select)
+    {
+      ext_net_select *select = (ext_net_select *)
+	realloc(client->_select,(struct_index + 1) * sizeof(ext_net_select));
+
+      if (!select)
+	ERR_MSG("Failure allocating memory for client subset.");
+
+      // Structures not (yet) asked for are not sent.
+      memset(select + client->_num_select,0,
+	     (struct_index + 1 - client->_num_select) *
+	     sizeof(ext_net_select));
+
+      client->_select = select;
+      client->_num_select = struct_index + 1;
+    }
+
+  ext_net_select request;
+
+  request._prescale   = prescale ? prescale : 1;
+  request._trig_mask  = trig_mask;
+  request._num_ranges = num_ranges;
+  request._ranges     = p + 4;
+  request._num_words  = num_words;
+  request._count      = 0;
+
+  free(client->_select[struct_index]._ranges);
+  ext_net_io_select_copy(&client->_select[struct_index],&request);
+
+  ext_net_io_client_set_stream(client,ext_net_io_find_stream(client));
+
+  if (num_ranges == EXTERNAL_WRITER_NET_SELECT_ALL)
+    MSG("Client asked for structure %d subset, "
+	"prescale %d, trigger mask 0x%x, all members.",
+	struct_index,request._prescale,trig_mask);
+  else
+    MSG("Client asked for structure %d subset, "
+	"prescale %d, trigger mask 0x%x, %d words.",
+	struct_index,request._prescale,trig_mask,num_words);
+
+  return true;
+}
+
+bool ext_net_io_client_read(send_client *client)
+{
+  ssize_t n;
+
+  // It may be the magic coming from the client.  If so, consume
+  // that.  After it, subset requests may come.  Anything else, or
+  // end-of-file, and we close.
+
+  if (client->_magic_got < sizeof(client->_magic))
+    n = read(client->_fd,((char*) &client->_magic)+client->_magic_got,
+	     sizeof(client->_magic) - client->_magic_got);
+  else if (client->_req_got < sizeof(client->_req_header))
+    n = read(client->_fd,((char*) &client->_req_header)+client->_req_got,
+	     sizeof(client->_req_header) - client->_req_got);
+  else
+    n = read(client->_fd,
+	     ((char*) client->_req_msg) +
+	     (client->_req_got - sizeof(client->_req_header)),
+	     ntohl(client->_req_header._length) - client->_req_got);
+
+  // Do not care too much about errors, as we will just close
+  // anyhow.
+
+  if (n == -1 && (errno == EINTR || errno == EAGAIN))
+    return true;
+
+  if (n <= 0)
+    return false;
+
+  if (client->_magic_got < sizeof(client->_magic))
+    {
+      client->_magic_got += n;
+
+      if (client->_magic_got == sizeof(client->_magic))
+	ext_net_io_client_magic(client);
+      return true;
+    }
+
+  client->_req_got += n;
+
+  if (client->_req_got == sizeof(client->_req_header))
+    {
+      uint32_t request = ntohl(client->_req_header._request);
+      uint32_t length  = ntohl(client->_req_header._length);
+
+      if (request != (EXTERNAL_WRITER_BUF_NET_SELECT |
+		      EXTERNAL_WRITER_REQUEST_HI_MAGIC) ||
+	  length < sizeof(client->_req_header) + 4 * sizeof(uint32_t) ||
+	  length > EXTERNAL_WRITER_NET_SELECT_MAX_LENGTH ||
+	  (length & 3))
+	{
+	  MSG("Client sent unknown request (0x%08x, %d bytes).",
+	      request,length);
+	  return false;
+	}
+
+      client->_req_msg =
+	(uint32_t *) malloc(length - sizeof(client->_req_header));
+
+      if (!client->_req_msg)
+	ERR_MSG("Failure allocating memory for client request.");
+      return true;
+    }
+
+  if (client->_req_got < ntohl(client->_req_header._length))
+    return true;
+
+  bool ok = ext_net_io_client_select(client);
+
+  free(client->_req_msg);
+  client->_req_msg = NULL;
+  client->_req_got = 0;
+
+  return ok;
+}
+
 bool ext_net_io_portmap_write(portmap_client *portmap)
 {
   size_t left = sizeof(_portmap_msg) - portmap->_offset;
@@ -685,24 +1495,261 @@ bool ext_net_io_portmap_write(portmap_client *portmap)
   return true;
 }
 
+bool ext_net_io_portmap_read(portmap_client *portmap)
+{
+  uint32_t dummy;
+  ssize_t n;
 
-bool ext_net_io_select_clients(int read_fd,int write_fd,
-			       bool shutdown,bool zero_timeout)
+  // We have sent our info.  Continue until file handle is ready
+  // for reading.  Such that the client does the shutdown, and the
+  // client thus gets the timeout, and we don't.
+
+  // It may be the magic coming from the client.  If so, consume
+  // that.
+
+  n = read(portmap->_fd,&dummy,sizeof(dummy));
+
+  // Do not care too much about errors, as we will just close
+  // anyhow.  Only if there was data to consume, we do not close.
+
+  if (n == -1 && errno == EINTR)
+    return true;
+
+  if (n > 0)
+    {
+      // Make sure we cannot get stuck here by the client
+      // sending copious amounts of data at us.
+
+      portmap->_offset += n;
+
+      if (portmap->_offset <= sizeof(_portmap_msg) + sizeof(uint32_t))
+	return true;
+    }
+
+  return false;
+}
+
+// Handle a client that is ready for I/O.  Returns false if it has
+// exited (at least got EPIPE), and shall be closed.
+
+bool ext_net_io_client_io(send_client *client,
+			  bool can_read,bool can_write)
 {
-  fd_set readfds;
-  fd_set writefds;
-  int nfd = -1;
+  if (can_write && client->_chunk &&
+      !ext_net_io_client_write(client))
+    return false;
 
-  FD_ZERO(&readfds);
-  FD_ZERO(&writefds);
+  if (can_read &&
+      !ext_net_io_client_read(client))
+    return false;
+
+  return true;
+}
+
+bool ext_net_io_portmap_io(portmap_client *portmap,
+			   bool can_read,bool can_write)
+{
+  if (portmap->_offset < sizeof(_portmap_msg))
+    {
+      if (can_write &&
+	  !ext_net_io_portmap_write(portmap))
+	return false;
+    }
+  else if (can_read &&
+	   !ext_net_io_portmap_read(portmap))
+    return false;
+
+  return true;
+}
+
+void ext_net_io_client_close(send_client *client)
+{
+#ifdef HAVE_EPOLL
+  ext_net_io_epoll_ctl(EPOLL_CTL_DEL,client->_fd,0,NULL,0);
+#endif
+
+  while (close(client->_fd) != 0)
+    {
+      if (errno == EINTR)
+	continue;
+
+      perror("close");
+      ERR_MSG("Failure closing client socket.");
+      break;
+    }
+  ext_net_io_client_set_stream(client,NULL);
+  ext_net_io_client_set_chunk(client,NULL);
+
+  free(client->_req_msg);
+  ext_net_io_select_free(client->_num_select,client->_select);
+
+  client->_prev->_next = client->_next;
+  client->_next->_prev = client->_prev;
+
+  free(client);
+
+  _net_stat._cur_clients--;
 
   CHECK_LIST_INTEGRITY;
+}
+
+void ext_net_io_portmap_close(portmap_client *portmap)
+{
+#ifdef HAVE_EPOLL
+  ext_net_io_epoll_ctl(EPOLL_CTL_DEL,portmap->_fd,0,NULL,0);
+#endif
+
+  while (close(portmap->_fd) != 0)
+    {
+      if (errno == EINTR)
+	continue;
+
+      perror("close");
+      ERR_MSG("Failure closing port request socket.");
+      break;
+    }
+  portmap->_prev->_next = portmap->_next;
+  portmap->_next->_prev = portmap->_prev;
+
+  free(portmap);
+
+  CHECK_LIST_INTEGRITY;
+}
+
+#ifdef HAVE_EPOLL
+// The descriptor our caller waits for, as registered with epoll.
+int      _ext_net_epoll_caller_fd = -1;
+uint32_t _ext_net_epoll_caller_want = 0;
+// Regular files cannot be registered, but (like for select) are
+// always ready.
+bool     _ext_net_epoll_caller_file = false;
+
+void ext_net_io_epoll_caller(int fd,uint32_t want)
+{
+  if (fd == _ext_net_epoll_caller_fd &&
+      want == _ext_net_epoll_caller_want)
+    return;
+
+  if (fd == _ext_net_epoll_caller_fd && !_ext_net_epoll_caller_file)
+    ext_net_io_epoll_ctl(EPOLL_CTL_MOD,fd,want,NULL,EXT_NET_EPOLL_CALLER);
+  else
+    {
+      if (_ext_net_epoll_caller_fd != -1 && !_ext_net_epoll_caller_file)
+	ext_net_io_epoll_ctl(EPOLL_CTL_DEL,_ext_net_epoll_caller_fd,
+			     0,NULL,0);
+      _ext_net_epoll_caller_file = false;
+      if (fd != -1)
+	_ext_net_epoll_caller_file =
+	  !ext_net_io_epoll_ctl(EPOLL_CTL_ADD,fd,want,
+				NULL,EXT_NET_EPOLL_CALLER,true);
+    }
+
+  _ext_net_epoll_caller_fd   = fd;
+  _ext_net_epoll_caller_want = want;
+}
+
+#define EXT_NET_IO_MAX_EVENTS 64
+#endif
+
+bool ext_net_io_select_clients(int read_fd,int write_fd,
+			       bool shutdown,bool zero_timeout)
+{
+  CHECK_LIST_INTEGRITY;
 
   // Our caller (incoming events) may need to wait too
 
   assert (read_fd == -1 || write_fd == -1); // or our return value
   // cannot be used to determine which is ready for I/O
 
+  send_client *client;
+  portmap_client *portmap;
+
+  // If we have nothing more to write to a client at shutdown, then
+  // it should as last message have gotten a shut down request.  That
+  // ought to make the client quit, after which, reading from it gives
+  // end-of-file.  If it does not quit, we'll time out.
+
+#ifdef HAVE_EPOLL
+  // The caller's descriptor stays registered between calls.  It
+  // is only removed before waiting without it, as a ready but not
+  // asked for descriptor would make us return immediately.
+
+  if (read_fd != -1)
+    ext_net_io_epoll_caller(read_fd,EXT_NET_IO_WANT_READ);
+  else if (write_fd != -1)
+    ext_net_io_epoll_caller(write_fd,EXT_NET_IO_WANT_WRITE);
+  else if (!zero_timeout)
+    ext_net_io_epoll_caller(-1,0);
+
+  bool caller_ready =
+    _ext_net_epoll_caller_file && (read_fd != -1 || write_fd != -1);
+
+  struct epoll_event events[EXT_NET_IO_MAX_EVENTS];
+
+  int ret = epoll_wait(_ext_net_epoll_fd,events,EXT_NET_IO_MAX_EVENTS,
+		       zero_timeout || caller_ready ? 0 :
+		       (shutdown ? 2000 : -1));
+
+  if (ret == -1)
+    {
+      if (errno == EINTR)
+	return false; // try again
+      perror("epoll_wait");
+      ERR_MSG("Unexpected error in I/O multiplexer.");
+    }
+
+  if (ret == 0) // can only happen on timeout (i.e. if shutdown)
+    return true;
+
+  for (int i = 0; i < ret; i++)
+    {
+      uint64_t tag = events[i].data.u64;
+      void *ptr = (void *) (size_t) (tag & ~(uint64_t) EXT_NET_EPOLL_KIND_MASK);
+
+      // Errors and hang-ups are found by the read or write.
+      bool can_read  =
+	!!(events[i].events & (EPOLLIN  | EPOLLERR | EPOLLHUP));
+      bool can_write =
+	!!(events[i].events & (EPOLLOUT | EPOLLERR | EPOLLHUP));
+
+      switch (tag & EXT_NET_EPOLL_KIND_MASK)
+	{
+	case EXT_NET_EPOLL_CALLER:
+	  if (read_fd != -1 || write_fd != -1)
+	    caller_ready = true;
+	  break;
+	case EXT_NET_EPOLL_SERVER:
+	  ext_net_io_server_accept();
+	  break;
+	case EXT_NET_EPOLL_DATA_SERV:
+	  ext_net_io_data_serv_accept();
+	  break;
+	case EXT_NET_EPOLL_CLIENT:
+	  client = (send_client *) ptr;
+	  if (!ext_net_io_client_io(client,can_read,can_write))
+	    ext_net_io_client_close(client);
+	  else
+	    ext_net_io_client_interest(client);
+	  break;
+	case EXT_NET_EPOLL_PORTMAP:
+	  portmap = (portmap_client *) ptr;
+	  if (!ext_net_io_portmap_io(portmap,can_read,can_write))
+	    ext_net_io_portmap_close(portmap);
+	  else
+	    ext_net_io_portmap_interest(portmap);
+	  break;
+	}
+    }
+
+  return caller_ready;
+#else
+  fd_set readfds;
+  fd_set writefds;
+  int nfd = -1;
+
+  FD_ZERO(&readfds);
+  FD_ZERO(&writefds);
+
   if (read_fd != -1)
     {
       FD_SET(read_fd,&readfds);
@@ -716,52 +1763,26 @@ bool ext_net_io_select_clients(int read_fd,int write_fd,
 	nfd = write_fd;
     }
 
-  send_client *client;
-
   for (client = _ext_net_clients._next; client != &_ext_net_clients;
        client = client->_next)
     {
-      if (client->_chunk) // it would like to write
-	{
-	  FD_SET(client->_fd,&writefds);
-	  if (client->_fd > nfd)
-	    nfd = client->_fd;
-	}
-      else if (shutdown)
-	{
-	  // If we have nothing more to write to this client, then it
-	  // should as last message have gotten a shut down request.
-	  // That ought to make the client quit, after which, reading
-	  // from it should go into possible mode (a file handle is
-	  // readable on EOF).  If it does not quit, we'll time out.
-	  // And if it actually writes something, we'll close it then
-	  // anyhow.
-
-	  FD_SET(client->_fd,&readfds);
-	  if (client->_fd > nfd)
-	    nfd = client->_fd;
-	}
+      if (client->_events & EXT_NET_IO_WANT_WRITE)
+	FD_SET(client->_fd,&writefds);
+      if (client->_events & EXT_NET_IO_WANT_READ)
+	FD_SET(client->_fd,&readfds);
+      if (client->_events && client->_fd > nfd)
+	nfd = client->_fd;
     }
 
-  portmap_client *portmap;
-
   for (portmap = _ext_net_portmaps._next; portmap != &_ext_net_portmaps;
        portmap = portmap->_next)
     {
-      if (portmap->_offset < sizeof(_portmap_msg)) // it would like to write
-	{
-	  FD_SET(portmap->_fd,&writefds);
-	  if (portmap->_fd > nfd)
-	    nfd = portmap->_fd;
-	}
-      else
-	{
-	  // See above (for data client)
-
-	  FD_SET(portmap->_fd,&readfds);
-	  if (portmap->_fd > nfd)
-	    nfd = portmap->_fd;
-	}
+      if (portmap->_events & EXT_NET_IO_WANT_WRITE)
+	FD_SET(portmap->_fd,&writefds);
+      if (portmap->_events & EXT_NET_IO_WANT_READ)
+	FD_SET(portmap->_fd,&readfds);
+      if (portmap->_fd > nfd)
+	nfd = portmap->_fd;
     }
 
   if (_ext_net_server_fd != -1)
@@ -806,74 +1827,12 @@ bool ext_net_io_select_clients(int read_fd,int write_fd,
       client = iter;
       iter = iter->_next;
 
-      if (client->_chunk)
-	{
-	  // If nothing to do, or if write successful, continue
-
-	  if (!FD_ISSET(client->_fd,&writefds) ||
-	      ext_net_io_client_write(client))
-	    continue;
-	}
-      else if (!shutdown)
-	continue; // nothing to do
+      if (!ext_net_io_client_io(client,
+				FD_ISSET(client->_fd,&readfds),
+				FD_ISSET(client->_fd,&writefds)))
+	ext_net_io_client_close(client);
       else
-	{
-	  uint32_t dummy;
-	  ssize_t n;
-
-	  // We are in shutdown mode.  Continue until file handle is
-	  // ready for reading.
-
-	  if (!FD_ISSET(client->_fd,&readfds))
-	    continue;
-
-	  // It may be the magic coming from the client.  If so,
-	  // consume that.
-
-	  n = read(client->_fd,&dummy,sizeof(dummy));
-
-	  // Do not care too much about errors, as we will just close
-	  // anyhow.  Only if there was data to consume, we do not
-	  // close.
-
-	  if (n == -1 && errno == EINTR)
-	    continue;
-
-	  if (n > 0)
-	    {
-	      // Make sure we cannot get stuck here by the client
-	      // sending copious amounts of data at us.
-
-	      client->_offset += n;
-
-	      if (client->_offset <= sizeof(uint32_t))
-		continue;
-	    }
-	}
-
-      // Client has exited, at least got EPIPE
-      // close and remove it
-
-      while (close(client->_fd) != 0)
-	{
-	  if (errno == EINTR)
-	    continue;
-
-	  perror("close");
-	  ERR_MSG("Failure closing client socket.");
-	  break;
-	}
-      if (client->_chunk)
-	client->_chunk->_consumers--;
-
-      client->_prev->_next = client->_next;
-      client->_next->_prev = client->_prev;
-
-      free(client);
-
-      _net_stat._cur_clients--;
-
-      CHECK_LIST_INTEGRITY;
+	ext_net_io_client_interest(client);
     }
 
   portmap_client *iterp;
@@ -883,69 +1842,12 @@ bool ext_net_io_select_clients(int read_fd,int write_fd,
       portmap = iterp;
       iterp = iterp->_next;
 
-      if (portmap->_offset < sizeof(_portmap_msg))
-	{
-	  // If nothing to do, or if write successful, continue
-
-	  if (!FD_ISSET(portmap->_fd,&writefds) ||
-	      ext_net_io_portmap_write(portmap))
-	    continue;
-	}
+      if (!ext_net_io_portmap_io(portmap,
+				 FD_ISSET(portmap->_fd,&readfds),
+				 FD_ISSET(portmap->_fd,&writefds)))
+	ext_net_io_portmap_close(portmap);
       else
-	{
-	  uint32_t dummy;
-	  ssize_t n;
-
-	  // We have sent our info.  Continue until file handle is
-	  // ready for reading.  Such that the client does the
-	  // shutdown, and the client thus gets the timeout, and we
-	  // don't.
-
-	  if (!FD_ISSET(portmap->_fd,&readfds))
-	    continue;
-
-	  // It may be the magic coming from the client.  If so,
-	  // consume that.
-
-	  n = read(portmap->_fd,&dummy,sizeof(dummy));
-
-	  // Do not care too much about errors, as we will just close
-	  // anyhow.  Only if there was data to consume, we do not
-	  // close.
-
-	  if (n == -1 && errno == EINTR)
-	    continue;
-
-	  if (n > 0)
-	    {
-	      // Make sure we cannot get stuck here by the client
-	      // sending copious amounts of data at us.
-
-	      portmap->_offset += n;
-
-	      if (portmap->_offset <= sizeof(_portmap_msg) + sizeof(uint32_t))
-		continue;
-	    }
-	}
-
-      // Client has exited, or at least got EPIPE -
-      // close and remove it
-
-      while (close(portmap->_fd) != 0)
-	{
-	  if (errno == EINTR)
-	    continue;
-
-	  perror("close");
-	  ERR_MSG("Failure closing port request socket.");
-	  break;
-	}
-      portmap->_prev->_next = portmap->_next;
-      portmap->_next->_prev = portmap->_prev;
-
-      free(portmap);
-
-      CHECK_LIST_INTEGRITY;
+	ext_net_io_portmap_interest(portmap);
     }
 
   // Accept new clients
@@ -967,6 +1869,7 @@ bool ext_net_io_select_clients(int read_fd,int write_fd,
   if (write_fd != -1)
     return FD_ISSET(write_fd,&writefds);
   return false;
+#endif
 }
 
 void ext_net_io_server_close()
@@ -232,6 +232,11 @@ struct stage_array
 
   int       _rewrite_max_bytes_per_item;
 
+  uint32_t *_blockpack_pairs; // (step,value) pairs, with --blockpack
+
+  uint32_t  _trigger_offset;  // of TRIGGER, for client subsets
+  uint32_t *_subset_items;    // (offset,value) pairs, for client subsets
+
   uint32_t *_masks[BUCKET_SORT_LEVELS];
   int       _num_masks[BUCKET_SORT_LEVELS];
 
@@ -872,6 +877,9 @@ void close_output()
       (double) _net_stat._sent_size / 1000000000. :
       (double) _net_stat._sent_size / 1000000.,
       _net_stat._sent_size > 2000000000 ? 'G' : 'M');
+  if (_net_stat._stalls)
+    MSG("Waited %d times for clients with block policy.",
+	_net_stat._stalls);
 #endif
   _g._num_events = 0;
 }
@@ -926,6 +934,39 @@ void request_alloc_array(void *msg,uint32_t *left)
   if (!s->_stage_array._ptr)
     ERR_MSG("Failure allocating offset/value array with size %d.",size*2);
 
+  s->_stage_array._blockpack_pairs = NULL;
+
+  s->_stage_array._trigger_offset = (uint32_t) -1;
+
+  s->_stage_array._subset_items = NULL;
+
+  if (_config._port != 0)
+    {
+      // Items of the full event, when encoding for client subsets.
+      size_t pairs = size / sizeof(uint32_t);
+
+      s->_stage_array._subset_items =
+	(uint32_t*) malloc(pairs * 2 * sizeof(uint32_t));
+
+      if (!s->_stage_array._subset_items)
+	ERR_MSG("Failure allocating subset array with size %zd.",
+		pairs * 2 * sizeof(uint32_t));
+    }
+
+  if (_config._blockpack)
+    {
+      // At most one item per word, and the encoder handles the
+      // pairs in groups of two.
+      size_t pairs = (size / sizeof(uint32_t)) + 2;
+
+      s->_stage_array._blockpack_pairs =
+	(uint32_t*) malloc(pairs * 2 * sizeof(uint32_t));
+
+      if (!s->_stage_array._blockpack_pairs)
+	ERR_MSG("Failure allocating blockpack array with size %zd.",
+		pairs * 2 * sizeof(uint32_t));
+    }
+
   // How many items do we have to mask?
   size_t masks = (size + 3) & ~3;
 
@@ -1542,6 +1583,10 @@ void request_create_branch(void *msg,uint32_t *left)
     }
   else
     item._ctrl_offset   = (uint32_t) -1;
+
+  if (strcmp(item._var_name,"TRIGGER") == 0 &&
+      item._var_array_len == (uint32_t) -1)
+    s->_stage_array._trigger_offset = offset;
 #endif
 
   do_create_branch(s, offset,item);
@@ -2753,6 +2798,472 @@ public:
 
 };
 
+#if STRUCT_WRITER
+// Write items (step,value) pairs in the block packed format, see
+// ext_data_write_blockpacked_event().  Numbers are stored as whole
+// words, the data pointer is only advanced by their length, so up to
+// 4 bytes after the end are overwritten.  The pair after the last
+// (odd) item must be writable, it is zeroed.
+
+uint8_t *blockpack_encode(uint8_t *dest,uint32_t *pairs,uint32_t items)
+{
+  uint8_t *ctrl = dest + sizeof(uint32_t);
+  uint8_t *data = ctrl + (items + 1) / 2;
+
+  dest[0] = (uint8_t) items;
+  dest[1] = (uint8_t) (items >> 8);
+  dest[2] = (uint8_t) (items >> 16);
+  dest[3] = (uint8_t) (items >> 24);
+
+  if (items & 1)
+    {
+      pairs[2 * items]     = 0;
+      pairs[2 * items + 1] = 0;
+    }
+
+  uint32_t *end = pairs + 2 * items;
+
+  for (uint32_t *p = pairs; p < end; p += 4)
+    {
+      uint8_t c = 0;
+
+      for (int j = 0; j < 4; j++)
+	{
+	  uint32_t v = p[j];
+	  int code = (v > 0xffff) ? 3 : (v > 0xff) ? 2 : (v != 0);
+
+	  data[0] = (uint8_t) v;
+	  data[1] = (uint8_t) (v >> 8);
+	  data[2] = (uint8_t) (v >> 16);
+	  data[3] = (uint8_t) (v >> 24);
+	  data += EXT_DATA_BP_LEN(code);
+
+	  c |= (uint8_t) (code << (2 * j));
+	}
+
+      *(ctrl++) = c;
+    }
+
+  return data;
+}
+
+// Encode one item in the compacted format (see request_ntuple_fill()).
+// The offset step is in units of 4 bytes.
+
+inline uint8_t *compact_item(uint8_t *dest,
+			     uint32_t store_offset,uint32_t value)
+{
+  if (value == 0)
+    {
+      while (store_offset > 0x0f)
+	{
+	  *(dest++) = 0x80 | (store_offset & 0x7f);
+	  store_offset >>= 7;
+	}
+      *(dest++) = (3 << 5) | (1 << 4) | store_offset;
+    }
+  else if (value == 0x7fc00000) // NAN
+    {
+      while (store_offset > 0x0f)
+	{
+	  *(dest++) = 0x80 | (store_offset & 0x7f);
+	  store_offset >>= 7;
+	}
+      *(dest++) = (3 << 5) | store_offset;
+    }
+  else if (!(value & ~0x0000001f)) // 5 bits
+    {
+      while (store_offset)
+	{
+	  *(dest++) = 0x80 | (store_offset & 0x7f);
+	  store_offset >>= 7;
+	}
+      *(dest++) = (0 << 5) | value;
+    }
+  else if (!(value & ~0x00001fff)) // 13 bits
+    {
+      while (store_offset)
+	{
+	  *(dest++) = 0x80 | (store_offset & 0x7f);
+	  store_offset >>= 7;
+	}
+      *(dest++) = (1 << 5) | (uint8_t) (value >> 8);
+      *(dest++) = (uint8_t) value;
+    }
+  else
+    {
+      while (store_offset > 0x01f)
+	{
+	  *(dest++) = 0x80 | (store_offset & 0x7f);
+	  store_offset >>= 7;
+	}
+      *(dest++) = (2 << 5) | store_offset;
+      *(dest++) = (uint8_t) (value >> 24);
+      *(dest++) = (uint8_t) (value >> 16);
+      *(dest++) = (uint8_t) (value >> 8);
+      *(dest++) = (uint8_t) value;
+    }
+  return dest;
+}
+
+// Header and items before the compacted data of a fill message.
+// Returns where the marker goes.
+
+uint32_t *compact_fill_prefix(global_struct *s,
+			      external_writer_buf_header *header,
+			      const uint32_t *raw_sort_u32,
+			      uint32_t struct_index,uint32_t ntuple_index,
+			      const uint32_t *raw_ptr,uint32_t raw_words)
+{
+  header->_request = htonl(EXTERNAL_WRITER_BUF_NTUPLE_FILL |
+			   EXTERNAL_WRITER_REQUEST_HI_MAGIC);
+  header->_length = (uint32_t) -1;
+
+  // sizeof (external_writer_buf_header)
+
+  uint32_t *sort_u32_dest = (uint32_t*) (header + 1);
+  for (uint32_t i = 0; i < _g._sort_u32_words; i++)
+    sort_u32_dest[i] = raw_sort_u32[i];
+
+  uint32_t *struct_index_dest =
+    sort_u32_dest + _g._sort_u32_words;
+
+  *struct_index_dest = htonl(struct_index);
+
+  uint32_t *ntuple_index_dest = struct_index_dest + 1;
+
+  *ntuple_index_dest = htonl(ntuple_index);
+
+  uint32_t *raw_dest = ntuple_index_dest + 1;
+
+  if (s->_max_raw_words)
+    {
+      *(raw_dest++) = htonl(raw_words);
+      memcpy(raw_dest, raw_ptr,
+	     sizeof(uint32_t) * raw_words);
+
+      raw_dest += raw_words;
+    }
+
+  return raw_dest;
+}
+
+// Complete the compacted data of a fill message, with items up to
+// cur_offset written (or as (step,value) pairs with --blockpack).
+// Returns the message length.
+
+uint32_t compact_fill_finish(global_struct *s,
+			     external_writer_buf_header *header,
+			     uint32_t *mark_dest,uint8_t *dest,
+			     uint32_t *pair,uint32_t cur_offset)
+{
+  // If we did not exactly reach the end, add a dummy entry
+  // that writes a zero to the last item.  This only happens
+  // if we employ zero suppression, so it's anyhow not to be
+  // used.  We do this such that the unpacking can verify that
+  // at least all the offsets worked out together.
+
+  if (cur_offset != s->_stage_array._length)
+    {
+      uint32_t offset = s->_stage_array._length - sizeof(uint32_t);
+      uint32_t store_offset = offset - cur_offset;
+
+      assert(!(store_offset & 3));
+      store_offset >>= 2;
+
+      if (_config._blockpack)
+	{
+	  *(pair++) = store_offset;
+	  *(pair++) = 0;
+	}
+      else
+	dest = compact_item(dest,store_offset,0);
+    }
+
+  uint32_t compact_marker = EXTERNAL_WRITER_COMPACT_PACKED;
+
+  if (_config._blockpack)
+    {
+      dest = blockpack_encode(dest,s->_stage_array._blockpack_pairs,
+			      (uint32_t) ((pair - s->_stage_array.
+					   _blockpack_pairs) / 2));
+      compact_marker = EXTERNAL_WRITER_COMPACT_BLOCKPACKED;
+    }
+
+  uint32_t compact_len = ((char *) dest - (char *) (mark_dest + 1));
+
+  *mark_dest = htonl(compact_marker | compact_len);
+
+  // Pad with zeros (to make comparisons work)
+
+  memset(dest,0,(-((char *) dest - (char *) header)) & 3);
+
+  return ((((char *) dest - (char *) header) + 3) & ~3);
+}
+
+// Offsets and values of the items in the compacted data of a fill
+// message, as (offset,value) pairs in pairs.  The formats are those
+// decoded by ext_data_write_bitpacked_event() and
+// ext_data_write_blockpacked_event().  Returns the number of items,
+// or -1 if the data is malformed.
+
+ssize_t compact_fill_items(uint32_t *pairs,size_t max_items,
+			   uint32_t compact_marker,
+			   const uint8_t *src,const uint8_t *end_src)
+{
+  size_t n = 0;
+  uint32_t offset = 0;
+
+  if (compact_marker == EXTERNAL_WRITER_COMPACT_BLOCKPACKED)
+    {
+      if (end_src - src < (ssize_t) sizeof(uint32_t))
+	return -1;
+
+      uint32_t items = ext_data_bp_get(src,3);
+
+      const uint8_t *ctrl = src + sizeof(uint32_t);
+
+      if (items > max_items ||
+	  (size_t) (end_src - ctrl) < ((size_t) items + 1) / 2)
+	return -1;
+
+      const uint8_t *data = ctrl + ((size_t) items + 1) / 2;
+
+      for (uint32_t i = 0; i < items; i += 2)
+	{
+	  uint32_t num[4];
+
+	  data = ext_data_bp_decode4(num,ctrl[i/2],data,end_src);
+
+	  if (!data)
+	    return -1;
+
+	  for (int j = 0; j < 4 && i + (uint32_t) j/2 < items; j += 2)
+	    {
+	      offset += num[j] << 2;
+
+	      pairs[2 * n    ] = offset;
+	      pairs[2 * n + 1] = num[j+1];
+	      n++;
+
+	      offset += (uint32_t) sizeof(uint32_t);
+	    }
+	}
+
+      return (ssize_t) n;
+    }
+
+  while (src < end_src)
+    {
+      int shift_offset = 2;
+      uint32_t value = 0;
+      uint8_t v;
+
+      if (n >= max_items)
+	return -1;
+
+      v = *(src++);
+
+      while (v & 0x80)
+	{
+	  offset += ((uint32_t) (v & 0x7f)) << shift_offset;
+	  shift_offset += 7;
+	  if (src >= end_src)
+	    return -1;
+	  v = *(src++);
+	}
+
+      switch (v >> 5)
+	{
+	case 0:
+	  value = (uint32_t) (v & 0x1f);
+	  break;
+	case 1:
+	  if (src >= end_src)
+	    return -1;
+	  value = (((uint32_t) (v & 0x1f)) << 8) | *(src++);
+	  break;
+	case 2:
+	  offset += ((uint32_t) (v & 0x1f)) << shift_offset;
+	  if (src + 3 >= end_src)
+	    return -1;
+	  value  = ((uint32_t) *(src++)) << 24;
+	  value |= ((uint32_t) *(src++)) << 16;
+	  value |= ((uint32_t) *(src++)) << 8;
+	  value |=  (uint32_t) *(src++);
+	  break;
+	case 3:
+	  offset += ((uint32_t) (v & 0x0f)) << shift_offset;
+	  value = (uint32_t) 0x7fc00000 << (v & 0x10);
+	  break;
+	}
+
+      pairs[2 * n    ] = offset;
+      pairs[2 * n + 1] = value;
+      n++;
+
+      offset += (uint32_t) sizeof(uint32_t);
+    }
+
+  return (ssize_t) n;
+}
+
+// Encode the event for the clients that asked for a subset of the
+// data (ext_data_request_subset()).  Only the items of the full
+// message that lie within the requested ranges are sent.  A fill
+// message carries all items that are valid for the event (not the
+// changes since the previous one), so clients that do not get every
+// event (prescale, trigger mask) still get complete events.
+// The full message is used as is for streams that want all members.
+
+void compact_fill_streams(global_struct *s,
+			  external_writer_buf_header *full,
+			  uint32_t full_length,
+			  const uint32_t *raw_sort_u32,
+			  uint32_t struct_index,uint32_t ntuple_index,
+			  const uint32_t *raw_ptr,uint32_t raw_words)
+{
+  // The items of the full message, decoded when first needed.
+  ssize_t num_items = -1;
+
+  for (ext_net_stream *stream = ext_net_io_next_stream(NULL);
+       stream; stream = ext_net_io_next_stream(stream))
+    {
+      ext_net_select *select = ext_net_io_stream_select(stream,struct_index);
+
+      if (!select)
+	continue;
+
+      if (select->_trig_mask &&
+	  s->_stage_array._trigger_offset != (uint32_t) -1)
+	{
+	  uint32_t trigger =
+	    *((uint32_t *) (s->_stage_array._ptr +
+			    s->_stage_array._trigger_offset));
+
+	  if (trigger >= 32 ||
+	      !(select->_trig_mask & (1u << trigger)))
+	    continue;
+	}
+
+      if ((select->_count++) % select->_prescale)
+	continue;
+
+      send_item_chunk *chunk;
+
+      if (num_items == -1 &&
+	  select->_num_ranges != EXTERNAL_WRITER_NET_SELECT_ALL)
+	{
+	  const uint32_t *mark =
+	    ((const uint32_t *) (full + 1)) + _g._sort_u32_words + 2 +
+	    (s->_max_raw_words ? 1 + raw_words : 0);
+	  uint32_t marker = ntohl(*mark);
+	  uint32_t compact_marker =
+	    marker & (EXTERNAL_WRITER_COMPACT_PACKED |
+		      EXTERNAL_WRITER_COMPACT_NONPACKED);
+	  const uint8_t *src = (const uint8_t *) (mark + 1);
+
+	  // The full message is always compacted when serving.
+	  if (compact_marker == EXTERNAL_WRITER_COMPACT_NONPACKED)
+	    ERR_MSG("Cannot make subset of non-compacted event.");
+
+	  num_items =
+	    compact_fill_items(s->_stage_array._subset_items,
+			       s->_stage_array._length / sizeof(uint32_t),
+			       compact_marker,
+			       src,src + (marker & 0x3fffffff));
+
+	  if (num_items < 0)
+	    ERR_MSG("Compacted event malformed, cannot make subset.");
+	}
+
+      if (select->_num_ranges == EXTERNAL_WRITER_NET_SELECT_ALL)
+	{
+	  char *net_io_chunk =
+	    ext_net_io_reserve_stream_chunk(full_length,stream,&chunk);
+
+	  memcpy(net_io_chunk,full,full_length);
+
+	  ext_net_io_commit_chunk(full_length,chunk);
+	  continue;
+	}
+
+      size_t items = select->_num_words;
+
+      if (items > (size_t) num_items)
+	items = (size_t) num_items;
+
+      // As for the full event, also the end item.
+
+      size_t max_length =
+	s->_stage_array._rewrite_max_bytes_per_item * (items + 1);
+
+      if (_config._blockpack)
+	max_length = sizeof(uint32_t) + 9 * (items + 1) + sizeof(uint32_t);
+
+      max_length = (max_length + 3) & ~3; // 4-byte alignment
+      max_length += sizeof (external_writer_buf_header);
+      max_length +=
+	(_g._sort_u32_words +
+	 (s->_max_raw_words ? 1 + raw_words : 0) +
+	 3) * // 3: struct_index + ntuple_index + mark_dest
+	sizeof (uint32_t);
+
+      external_writer_buf_header *header = (external_writer_buf_header *)
+	ext_net_io_reserve_stream_chunk(max_length,stream,&chunk);
+
+      uint32_t *mark_dest =
+	compact_fill_prefix(s,header,raw_sort_u32,struct_index,ntuple_index,
+			    raw_ptr,raw_words);
+      uint8_t *dest = (uint8_t *) (mark_dest + 1);
+
+      uint32_t cur_offset = 0;
+
+      uint32_t *pair = s->_stage_array._blockpack_pairs;
+
+      // Both the items and the ranges are sorted.
+
+      const uint32_t *item     = s->_stage_array._subset_items;
+      const uint32_t *item_end = item + 2 * num_items;
+
+      for (uint32_t i = 0; i < select->_num_ranges; i++)
+	{
+	  uint32_t start = select->_ranges[2 * i];
+	  uint32_t end   = select->_ranges[2 * i + 1];
+
+	  while (item < item_end && item[0] < start)
+	    item += 2;
+
+	  for ( ; item < item_end && item[0] < end; item += 2)
+	    {
+	      uint32_t offset = item[0];
+	      uint32_t value  = item[1];
+
+	      uint32_t store_offset = (offset - cur_offset) >> 2;
+
+	      cur_offset = offset + sizeof(uint32_t);
+
+	      if (_config._blockpack)
+		{
+		  *(pair++) = store_offset;
+		  *(pair++) = value;
+		}
+	      else
+		dest = compact_item(dest,store_offset,value);
+	    }
+	}
+
+      uint32_t length =
+	compact_fill_finish(s,header,mark_dest,dest,pair,cur_offset);
+
+      assert(length <= max_length);
+      header->_length = htonl(length);
+
+      ext_net_io_commit_chunk(length,chunk);
+    }
+}
+#endif
+
 
 // Number of rounds needed for a radix sort:
 //
@@ -3011,7 +3522,8 @@ void request_ntuple_fill(ext_write_config_comm *comm,
 				      EXTERNAL_WRITER_COMPACT_NONPACKED);
 
   if (compact_marker != EXTERNAL_WRITER_COMPACT_PACKED &&
-      compact_marker != EXTERNAL_WRITER_COMPACT_NONPACKED)
+      compact_marker != EXTERNAL_WRITER_COMPACT_NONPACKED &&
+      compact_marker != EXTERNAL_WRITER_COMPACT_BLOCKPACKED)
     {
 	ERR_MSG("Compact marker invalid (0x%08x) .", compact_marker);
     }
@@ -3025,7 +3537,7 @@ void request_ntuple_fill(ext_write_config_comm *comm,
       (marker & EXTERNAL_WRITER_COMPACT_PACKED))
     ERR_MSG("Cannot merge (time_stitch) from compacted array.");
 
-  if (!(marker & EXTERNAL_WRITER_COMPACT_PACKED))
+  if (compact_marker == EXTERNAL_WRITER_COMPACT_NONPACKED)
     {
       // Non-compacted array.
 
@@ -3363,6 +3875,16 @@ void request_ntuple_fill(ext_write_config_comm *comm,
       size_t max_length = s->_stage_array._rewrite_max_bytes_per_item *
 	((ppp - s->_stage_array._offset_value)/* / 2*/);
 
+      if (_config._blockpack)
+	{
+	  // Item count, at most 8 data bytes and half a control byte
+	  // per item (also the end item), and 4 bytes since the
+	  // encoder stores whole words.
+	  max_length = sizeof(uint32_t) +
+	    9 * ((ppp - s->_stage_array._offset_value) + 1) +
+	    sizeof(uint32_t);
+	}
+
       max_length = (max_length + 3) & ~3; // 4-byte alignment
       max_length += sizeof (external_writer_buf_header);
       max_length +=
@@ -3376,41 +3898,15 @@ void request_ntuple_fill(ext_write_config_comm *comm,
 
       header = (external_writer_buf_header *) net_io_chunk;
 
-      header->_request = htonl(EXTERNAL_WRITER_BUF_NTUPLE_FILL |
-			       EXTERNAL_WRITER_REQUEST_HI_MAGIC);
-      header->_length = (uint32_t) -1;
-
-      // sizeof (external_writer_buf_header)
-
-      uint32_t *sort_u32_dest = (uint32_t*) (header + 1);
-      for (uint32_t i = 0; i < _g._sort_u32_words; i++)
-	sort_u32_dest[i] = raw_sort_u32[i];
-
-      uint32_t *struct_index_dest =
-	sort_u32_dest + _g._sort_u32_words;
-
-      *struct_index_dest = htonl(struct_index);
-
-      uint32_t *ntuple_index_dest = struct_index_dest + 1;
-
-      *ntuple_index_dest = htonl(ntuple_index);
-
-      uint32_t *raw_dest = ntuple_index_dest + 1;
-
-      if (s->_max_raw_words)
-	{
-	  *(raw_dest++) = htonl(raw_words);
-	  memcpy(raw_dest, raw_ptr,
-		 sizeof(uint32_t) * raw_words);
-
-	  raw_dest += raw_words;
-	}
-
-      uint32_t *mark_dest = raw_dest;
+      uint32_t *mark_dest =
+	compact_fill_prefix(s,header,raw_sort_u32,struct_index,ntuple_index,
+			    raw_ptr,raw_words);
       uint8_t *dest = (uint8_t *) (mark_dest + 1);
 
       uint32_t cur_offset = 0;
 
+      uint32_t *pair = s->_stage_array._blockpack_pairs;
+
       for (int i = 0; i < s->_stage_array._num_masks[0]; i++)
 	{
 	  // fprintf (stderr,"[0:%d]",i);
@@ -3483,57 +3979,16 @@ void request_ntuple_fill(ext_write_config_comm *comm,
 			     */
 		      cur_offset = offset + sizeof(uint32_t);
 
-		      if (value == 0)
-			{
-			  while (store_offset > 0x0f)
-			    {
-			      *(dest++) = 0x80 | (store_offset & 0x7f);
-			      store_offset >>= 7;
-			    }
-			  *(dest++) = (3 << 5) | (1 << 4) | store_offset;
-			}
-		      else if (value == 0x7fc00000) // NAN
-			{
-			  while (store_offset > 0x0f)
-			    {
-			      *(dest++) = 0x80 | (store_offset & 0x7f);
-			      store_offset >>= 7;
-			    }
-			  *(dest++) = (3 << 5) | store_offset;
-			}
-		      else if (!(value & ~0x0000001f)) // 5 bits
+		      if (_config._blockpack)
 			{
-			  while (store_offset)
-			    {
-			      *(dest++) = 0x80 | (store_offset & 0x7f);
-			      store_offset >>= 7;
-			    }
-			  *(dest++) = (0 << 5) | value;
-			}
-		      else if (!(value & ~0x00001fff)) // 13 bits
-			{
-			  while (store_offset)
-			    {
-			      *(dest++) = 0x80 | (store_offset & 0x7f);
-			      store_offset >>= 7;
-			    }
-			  *(dest++) = (1 << 5) | (uint8_t) (value >> 8);
-			  *(dest++) = (uint8_t) value;
-			}
-		      else
-			{
-			  while (store_offset > 0x01f)
-			    {
-			      *(dest++) = 0x80 | (store_offset & 0x7f);
-			      store_offset >>= 7;
-			    }
-			  *(dest++) = (2 << 5) | store_offset;
-			  *(dest++) = (uint8_t) (value >> 24);
-			  *(dest++) = (uint8_t) (value >> 16);
-			  *(dest++) = (uint8_t) (value >> 8);
-			  *(dest++) = (uint8_t) value;
+			  // Encoded as a block after all items are known.
+			  *(pair++) = store_offset;
+			  *(pair++) = value;
+			  continue;
 			}
 
+		      dest = compact_item(dest,store_offset,value);
+
 		      // fprintf (stderr," %d",dest-odest);
 
 		      // End encoding this value
@@ -3549,38 +4004,8 @@ void request_ntuple_fill(ext_write_config_comm *comm,
 
       //getrusage(RUSAGE_SELF,&use4);
 
-      // If we did not exactly reach the end, add a dummy entry
-      // that writes a zero to the last item.  This only happens
-      // if we employ zero suppression, so it's anyhow not to be
-      // used.  We do this such that the unpacking can verify that
-      // at least all the offsets worked out together.
-
-      if (cur_offset != s->_stage_array._length)
-	{
-	  uint32_t offset = s->_stage_array._length - sizeof(uint32_t);
-	  uint32_t store_offset = offset - cur_offset;
-
-	  assert(!(store_offset & 3));
-	  store_offset >>= 2;
-
-	  while (store_offset > 0x0f)
-	    {
-	      *(dest++) = 0x80 | (store_offset & 0x7f);
-	      store_offset >>= 7;
-	    }
-	  *(dest++) = (3 << 5) | (1 << 4) | store_offset;
-	}
-
-      uint32_t compact_len = ((char *) dest - (char *) (mark_dest + 1));
-
-      *mark_dest = htonl(EXTERNAL_WRITER_COMPACT_PACKED | compact_len);
-
-      // Pad with zeros (to make comparisons work)
-
-      memset(dest,0,(-((char *) dest - (char *) header)) & 3);
-
       uint32_t new_length =
-	((((char *) dest - (char *) header) + 3) & ~3);
+	compact_fill_finish(s,header,mark_dest,dest,pair,cur_offset);
       /*
       MSG("rewrite: %d items (%d bpi), %d / nl: %d ml: %d",
 	  (ppp - _stage_array._offset_value) / 2,
@@ -3662,10 +4087,18 @@ void request_ntuple_fill(ext_write_config_comm *comm,
       // Also for struct_writer we unpack, just to check that the data
       // is correct
 
-      int ret = ext_data_write_bitpacked_event((char *) s->_stage_array._ptr,
+      int ret;
+
+      if (compact_marker == EXTERNAL_WRITER_COMPACT_BLOCKPACKED)
+	ret = ext_data_write_blockpacked_event((char *) s->_stage_array._ptr,
 					       s->_stage_array._length,
 					       (uint8_t *) msg,
 					       (uint8_t *) msg + real_len);
+      else
+	ret = ext_data_write_bitpacked_event((char *) s->_stage_array._ptr,
+					     s->_stage_array._length,
+					     (uint8_t *) msg,
+					     (uint8_t *) msg + real_len);
 
       if (ret != 0)
 	ERR_MSG("Compacted event failed to unpack (ret=%d).",ret);
@@ -3815,6 +4248,12 @@ void request_ntuple_fill(ext_write_config_comm *comm,
     full_write(STDOUT_FILENO,header,length);
 
   ext_net_io_commit_chunk(length,chunk);
+
+  // The chunk is not reclaimed while it is the last one, so the
+  // message can still be used as source.
+  compact_fill_streams(s,header,length,
+		       raw_sort_u32,struct_index,ntuple_index,
+		       raw_ptr,raw_words);
 #endif
 
  statistics:
@@ -4232,6 +4671,8 @@ void send_abort()
 
   ext_net_io_commit_chunk(sizeof(header),chunk);
 
+  ext_net_io_copy_to_streams(&header,sizeof(header));
+
   if (_config._stdout)
     full_write(STDOUT_FILENO,&header,sizeof(header));
 #endif
@@ -4381,10 +4822,25 @@ bool handle_request(ext_write_config_comm *comm,
 
       memcpy(net_io_chunk,header,length);
 
+      if (request == EXTERNAL_WRITER_BUF_OPEN_FILE &&
+	  _config._blockpack &&
+	  (_config._port != 0 || _config._bitpack))
+	{
+	  // Events will be block packed, such that older clients
+	  // must refuse the data.
+	  uint32_t *magic_dest =
+	    (uint32_t *) (net_io_chunk + sizeof (external_writer_buf_header));
+
+	  *magic_dest = htonl(EXTERNAL_WRITER_MAGIC_BLOCKPACK);
+	}
+
       if (_config._stdout)
-	full_write(STDOUT_FILENO,header,length);
+	full_write(STDOUT_FILENO,net_io_chunk,length);
 
       ext_net_io_commit_chunk(length,chunk);
+
+      if (request > EXTERNAL_WRITER_BUF_NTUPLE_FILL)
+	ext_net_io_copy_to_streams(header,length);
     }
 #endif
 
@@ -5157,6 +5613,8 @@ void usage(char *cmdname)
   printf ("  --stdout           Write data to stdout.\n");
   printf ("  --dump[=FORMAT]    Make text dump of data.  (FORMAT: normal, wide, [compact_]json)\n");
   printf ("  --bitpack          Bitpack STRUCT data even if not using network server.\n");
+  printf ("  --blockpack        Bitpack in block format (faster decoding, newer clients).\n");
+  printf ("  --net-policy=POL   Default for slow clients: drop (oldest), block, downsample.\n");
 #endif
   printf ("  --time-stitch=N    Combine events with timestamps with difference <= N.\n");
   printf ("  --colour=yes|no    Force colour and markup on or off.\n");
@@ -5319,6 +5777,19 @@ int main(int argc,char *argv[])
       else if (MATCH_ARG("--bitpack")) {
 	_config._bitpack = 1;
       }
+      else if (MATCH_ARG("--blockpack")) {
+	_config._blockpack = 1;
+      }
+      else if (MATCH_PREFIX("--net-policy=",post)) {
+	if (strcmp(post,"drop") == 0)
+	  _config._net_policy = EXTERNAL_WRITER_NET_POLICY_DROP;
+	else if (strcmp(post,"block") == 0)
+	  _config._net_policy = EXTERNAL_WRITER_NET_POLICY_BLOCK;
+	else if (strcmp(post,"downsample") == 0)
+	  _config._net_policy = EXTERNAL_WRITER_NET_POLICY_DOWNSAMPLE;
+	else
+	  ERR_MSG("Bad option '%s' for --net-policy=",post);
+      }
       else if (MATCH_ARG("--dump")) {
 	_config._dump = EXT_WRITER_DUMP_FORMAT_NORMAL;
       }
@@ -107,6 +107,8 @@ struct ext_write_config
   int         _port;
   int         _stdout;
   int         _bitpack;
+  int         _blockpack;
+  int         _net_policy;
 
 #define EXT_WRITER_DUMP_FORMAT_NORMAL        1
 #define EXT_WRITER_DUMP_FORMAT_NORMAL_WIDE   2
@@ -142,6 +144,7 @@ struct ext_file_net_stat
   uint64_t _committed_size;
   uint64_t _sent_size;
   uint32_t _cur_clients;
+  uint32_t _stalls;    // waits for clients with block policy
 };
 
 extern ext_file_net_stat _net_stat;
@@ -158,6 +161,35 @@ char *ext_net_io_reserve_chunk(size_t length,bool init_chunk,
 
 void ext_net_io_commit_chunk(size_t length,send_item_chunk *chunk);
 
+// Clients that asked for a subset of the data (NET_SELECT) share a
+// stream per distinct request, with its own event chunks.
+
+struct ext_net_select
+{
+  uint32_t  _prescale;
+  uint32_t  _trig_mask;
+  uint32_t  _num_ranges; // EXTERNAL_WRITER_NET_SELECT_ALL: all members
+  uint32_t *_ranges;     // [start,end) byte offset pairs
+  uint32_t  _num_words;  // in the ranges
+
+  uint32_t  _count;      // events seen after trigger selection
+};
+
+struct ext_net_stream;
+
+// Iterate over the streams (start with NULL).
+ext_net_stream *ext_net_io_next_stream(ext_net_stream *stream);
+
+// What the stream wants of a structure.  NULL if nothing.
+ext_net_select *ext_net_io_stream_select(ext_net_stream *stream,
+					 uint32_t struct_index);
+
+char *ext_net_io_reserve_stream_chunk(size_t length,ext_net_stream *stream,
+				      send_item_chunk **chunk);
+
+// For (non-fill) event messages, that every stream shall have.
+void ext_net_io_copy_to_streams(const void *msg,size_t length);
+
 void ext_net_io_server_close();
 
 /* ****************************************************************** */
@@ -334,6 +334,18 @@ void external_writer::init_x(unsigned int type,unsigned int opt,
 	}
     }
 
+  if (opt & NTUPLE_OPT_WRITER_BLOCKPACK)
+    {
+      if (type & (NTUPLE_TYPE_STRUCT | NTUPLE_TYPE_STRUCT_HH))
+	{
+	  argv[argc++] = strdup("--blockpack");
+	}
+      else
+	{
+	  ERROR("Blockpack only makes sense with struct writer.");
+	}
+    }
+
   if (ts_merge_window)
     {
       snprintf (tmp,sizeof(tmp),
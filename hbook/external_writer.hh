@@ -56,6 +56,8 @@
 #define NTUPLE_OPT_EXT_GDB         0x040000
 #define NTUPLE_OPT_EXT_VALGRIND    0x080000
 
+#define NTUPLE_OPT_WRITER_BLOCKPACK 0x100000
+
 class ext_writer_buf
 {
 public:
@@ -0,0 +1,82 @@
+/** BEGIN_ACCOUNT_IDS **************************************************
+ *
+ * Structure and identifier for raw data items.
+ *
+ * Do not edit - automatically generated.
+ */
+
+account_id _account_ids[] =
+{ 
+  { 0, "CAMAC_LECROY_4434", "ch_data" },
+  { 1, "CAMAC_LECROY_4434", "ch_data" },
+  { 2, "CAMAC_PHILLIPS_7164", "ch_data" },
+  { 3, "CAMAC_PHILLIPS_7164", "ch_data" },
+  { 4, "CAMAC_PHILLIPS_7164", "ch_data" },
+  { 5, "CAMAC_PHILLIPS_7164", "ch_data" },
+  { 6, "CAMAC_SILENA_4418", "ch_data" },
+  { 7, "CAMAC_SILENA_4418", "ch_data" },
+  { 8, "CAMAC_SILENA_4418", "ch_data" },
+  { 9, "CAMAC_SILENA_4418", "ch_data" },
+  { 10, "FASTBUS_LECROY_1875", "ch_data" },
+  { 11, "FASTBUS_LECROY_1875", "ch_data" },
+  { 12, "FASTBUS_LECROY_1885", "ch_data" },
+  { 13, "FASTBUS_LECROY_1885", "ch_data" },
+  { 14, "VME_CAEN_V1190_SUBTDC", "header" },
+  { 15, "VME_CAEN_V1190_SUBTDC", "ch_data" },
+  { 16, "VME_CAEN_V1190_SUBTDC", "error_flags" },
+  { 17, "VME_CAEN_V1190_SUBTDC", "trailer" },
+  { 18, "VME_CAEN_V1190_SUBTDC", "header" },
+  { 19, "VME_CAEN_V1190", "header" },
+  { 20, "VME_CAEN_V1190", "trigger" },
+  { 21, "VME_CAEN_V1190", "trailer" },
+  { 22, "VME_CAEN_V1190", "header" },
+  { 23, "VME_CAEN_V1190_SHORT_SUBTDC", "ch_data" },
+  { 24, "VME_CAEN_V1190_SHORT_SUBTDC", "ch_data" },
+  { 25, "VME_CAEN_V1190_SHORT_SUBTDC_ERROR", "error_flags" },
+  { 26, "VME_CAEN_V1190_SHORT_SUBTDC_ERROR", "error_flags" },
+  { 27, "VME_CAEN_V1190_SHORT", "header" },
+  { 28, "VME_CAEN_V1190_SHORT", "trigger" },
+  { 29, "VME_CAEN_V1190_SHORT", "trailer" },
+  { 30, "VME_CAEN_V1190_SHORT", "header" },
+  { 31, "VME_CAEN_V1290_SUBTDC", "header" },
+  { 32, "VME_CAEN_V1290_SUBTDC", "ch_data" },
+  { 33, "VME_CAEN_V1290_SUBTDC", "error_flags" },
+  { 34, "VME_CAEN_V1290_SUBTDC", "trailer" },
+  { 35, "VME_CAEN_V1290_SUBTDC", "header" },
+  { 36, "VME_CAEN_V1290", "header" },
+  { 37, "VME_CAEN_V1290", "trigger" },
+  { 38, "VME_CAEN_V1290", "trailer" },
+  { 39, "VME_CAEN_V1290", "header" },
+  { 40, "VME_CAEN_V1290_SHORT_SUBTDC", "ch_data" },
+  { 41, "VME_CAEN_V1290_SHORT_SUBTDC", "ch_data" },
+  { 42, "VME_CAEN_V1290_SHORT_SUBTDC_ERROR", "error_flags" },
+  { 43, "VME_CAEN_V1290_SHORT_SUBTDC_ERROR", "error_flags" },
+  { 44, "VME_CAEN_V1290_SHORT", "header" },
+  { 45, "VME_CAEN_V1290_SHORT", "trigger" },
+  { 46, "VME_CAEN_V1290_SHORT", "trailer" },
+  { 47, "VME_CAEN_V1290_SHORT", "header" },
+  { 48, "VME_CAEN_V775", "header" },
+  { 49, "VME_CAEN_V775", "ch_data" },
+  { 50, "VME_CAEN_V775", "eob" },
+  { 51, "VME_CAEN_V775", "header" },
+  { 52, "VME_CAEN_V830", "header" },
+  { 53, "VME_CAEN_V830", "ch_data" },
+  { 54, "VME_CAEN_V830", "header" },
+  { 55, "VME_MESYTEC_MADC32", "header" },
+  { 56, "VME_MESYTEC_MADC32", "ch_data" },
+  { 57, "VME_MESYTEC_MADC32", "filler" },
+  { 58, "VME_MESYTEC_MADC32", "end_of_event" },
+  { 59, "VME_MESYTEC_MADC32", "header" },
+  { 60, "VME_MESYTEC_MDPP16", "header" },
+  { 61, "VME_MESYTEC_MDPP16", "ch_data" },
+  { 62, "VME_MESYTEC_MDPP16", "fill_word" },
+  { 63, "VME_MESYTEC_MDPP16", "end_of_event" },
+  { 64, "VME_MESYTEC_MDPP16", "header" },
+  { 65, "IS446_VME", "dummy_header" },
+  { 66, "IS446_VME", "dummy_footer" },
+  { 67, "IS446_VME", "garbage_footer" },
+};
+
+#define NUM_ACCOUNT_IDS  68
+
+/** END_ACCOUNT_IDS ***************************************************/
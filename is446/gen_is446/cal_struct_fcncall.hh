@@ -0,0 +1,197 @@
+/** BEGIN_FUNCTION_CALL_PER_MEMBER *************************************
+ *
+ * Recursive function calls per member.
+ *
+ * Do not edit - automatically generated.
+ */
+
+#include "gen/default_fcncall_define.hh"
+
+#ifndef USER_DEF_cal_event_BACK
+FCNCALL_TEMPLATE
+FCNCALL_RET_TYPE FCNCALL_CLASS_NAME(cal_event_BACK)::FCNCALL_NAME(cal_event_BACK)
+{
+  FCNCALL_INIT;
+  // float E;
+  {
+  FCNCALL_SUBNAME("E");
+  { FCNCALL_CALL_CTRL_WRAP(E,FCNCALL_CALL_TYPE(float,E)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // float T;
+  {
+  FCNCALL_SUBNAME("T");
+  { FCNCALL_CALL_CTRL_WRAP(T,FCNCALL_CALL_TYPE(float,T)); }
+  FCNCALL_SUBNAME_END;
+  }
+  FCNCALL_RET;
+}
+#endif//USER_DEF_cal_event_BACK
+
+#ifndef USER_DEF_cal_event_MON
+FCNCALL_TEMPLATE
+FCNCALL_RET_TYPE FCNCALL_CLASS_NAME(cal_event_MON)::FCNCALL_NAME(cal_event_MON)
+{
+  FCNCALL_INIT;
+  // float E;
+  {
+  FCNCALL_SUBNAME("E");
+  { FCNCALL_CALL_CTRL_WRAP(E,FCNCALL_CALL_TYPE(float,E)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // float T;
+  {
+  FCNCALL_SUBNAME("T");
+  { FCNCALL_CALL_CTRL_WRAP(T,FCNCALL_CALL_TYPE(float,T)); }
+  FCNCALL_SUBNAME_END;
+  }
+  FCNCALL_RET;
+}
+#endif//USER_DEF_cal_event_MON
+
+#ifndef USER_DEF_cal_event_D_F
+FCNCALL_TEMPLATE
+FCNCALL_RET_TYPE FCNCALL_CLASS_NAME(cal_event_D_F)::FCNCALL_NAME(cal_event_D_F)
+{
+  FCNCALL_INIT;
+  // float E;
+  {
+  FCNCALL_SUBNAME("E");
+  { FCNCALL_CALL_CTRL_WRAP(E,FCNCALL_CALL_TYPE(float,E)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // float T;
+  {
+  FCNCALL_SUBNAME("T");
+  { FCNCALL_CALL_CTRL_WRAP(T,FCNCALL_CALL_TYPE(float,T)); }
+  FCNCALL_SUBNAME_END;
+  }
+  FCNCALL_RET;
+}
+#endif//USER_DEF_cal_event_D_F
+
+#ifndef USER_DEF_cal_event_D_B
+FCNCALL_TEMPLATE
+FCNCALL_RET_TYPE FCNCALL_CLASS_NAME(cal_event_D_B)::FCNCALL_NAME(cal_event_D_B)
+{
+  FCNCALL_INIT;
+  // float E;
+  {
+  FCNCALL_SUBNAME("E");
+  { FCNCALL_CALL_CTRL_WRAP(E,FCNCALL_CALL_TYPE(float,E)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // float T;
+  {
+  FCNCALL_SUBNAME("T");
+  { FCNCALL_CALL_CTRL_WRAP(T,FCNCALL_CALL_TYPE(float,T)); }
+  FCNCALL_SUBNAME_END;
+  }
+  FCNCALL_RET;
+}
+#endif//USER_DEF_cal_event_D_B
+
+#ifndef USER_DEF_cal_event_D
+FCNCALL_TEMPLATE
+FCNCALL_RET_TYPE FCNCALL_CLASS_NAME(cal_event_D)::FCNCALL_NAME(cal_event_D)
+{
+  FCNCALL_INIT;
+  // raw_list_zero_suppress<cal_event_D_F,cal_event_D_F,32> F;
+  {
+  FCNCALL_SUBNAME("F");
+  { FCNCALL_CALL_CTRL_WRAP(F,F.FCNCALL_CALL(F)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // raw_list_zero_suppress<cal_event_D_B,cal_event_D_B,32> B;
+  {
+  FCNCALL_SUBNAME("B");
+  { FCNCALL_CALL_CTRL_WRAP(B,B.FCNCALL_CALL(B)); }
+  FCNCALL_SUBNAME_END;
+  }
+  FCNCALL_RET;
+}
+#endif//USER_DEF_cal_event_D
+
+#ifndef USER_DEF_cal_event
+FCNCALL_TEMPLATE
+FCNCALL_RET_TYPE FCNCALL_CLASS_NAME(cal_event)::FCNCALL_NAME(cal_event)
+{
+  FCNCALL_INIT;
+  FCNCALL_CALL_CTRL_WRAP(cal_event_base,FCNCALL_CLASS_NAME(cal_event_base)::FCNCALL_CALL_BASE());
+  // float TEBIS;
+  {
+  FCNCALL_SUBNAME("TEBIS");
+  { FCNCALL_CALL_CTRL_WRAP(TEBIS,FCNCALL_CALL_TYPE(float,TEBIS)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // float TSHORT;
+  {
+  FCNCALL_SUBNAME("TSHORT");
+  { FCNCALL_CALL_CTRL_WRAP(TSHORT,FCNCALL_CALL_TYPE(float,TSHORT)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // float OLDTEBIS;
+  {
+  FCNCALL_SUBNAME("OLDTEBIS");
+  { FCNCALL_CALL_CTRL_WRAP(OLDTEBIS,FCNCALL_CALL_TYPE(float,OLDTEBIS)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // float OLDTSHORT;
+  {
+  FCNCALL_SUBNAME("OLDTSHORT");
+  { FCNCALL_CALL_CTRL_WRAP(OLDTSHORT,FCNCALL_CALL_TYPE(float,OLDTSHORT)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // float EBIS;
+  {
+  FCNCALL_SUBNAME("EBIS");
+  { FCNCALL_CALL_CTRL_WRAP(EBIS,FCNCALL_CALL_TYPE(float,EBIS)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // float NACCEPT;
+  {
+  FCNCALL_SUBNAME("NACCEPT");
+  { FCNCALL_CALL_CTRL_WRAP(NACCEPT,FCNCALL_CALL_TYPE(float,NACCEPT)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // cal_event_BACK BACK[2];
+  {
+  FCNCALL_SUBNAME("BACK");
+  FCNCALL_FOR(__i0,2)
+  {
+    FCNCALL_SUBINDEX(__i0);
+    { FCNCALL_CALL_CTRL_WRAP_ARRAY(BACK__i0,,__i0,BACK[__i0].FCNCALL_CALL(BACK[__i0])); }
+    FCNCALL_SUBINDEX_END(__i0);
+  }
+  FCNCALL_SUBNAME_END;
+  }
+  // cal_event_MON MON[2];
+  {
+  FCNCALL_SUBNAME("MON");
+  FCNCALL_FOR(__i0,2)
+  {
+    FCNCALL_SUBINDEX(__i0);
+    { FCNCALL_CALL_CTRL_WRAP_ARRAY(MON__i0,,__i0,MON[__i0].FCNCALL_CALL(MON[__i0])); }
+    FCNCALL_SUBINDEX_END(__i0);
+  }
+  FCNCALL_SUBNAME_END;
+  }
+  // cal_event_D D[3];
+  {
+  FCNCALL_SUBNAME("D");
+  FCNCALL_FOR(__i0,3)
+  {
+    FCNCALL_SUBINDEX(__i0);
+    { FCNCALL_CALL_CTRL_WRAP_ARRAY(D__i0,,__i0,D[__i0].FCNCALL_CALL(D[__i0])); }
+    FCNCALL_SUBINDEX_END(__i0);
+  }
+  FCNCALL_SUBNAME_END;
+  }
+  FCNCALL_RET;
+}
+#endif//USER_DEF_cal_event
+
+#include "gen/default_fcncall_undef.hh"
+
+
+/** END_FUNCTION_CALL_PER_MEMBER **************************************/
@@ -0,0 +1,109 @@
+/** BEGIN_MIRROR_STRUCT ************************************************
+ *
+ * Mirror (1 to 1) structure.
+ *
+ * Do not edit - automatically generated.
+ */
+
+#include "gen/default_mirror_define.hh"
+
+#ifndef USER_DEF_cal_event_BACK
+STRUCT_MIRROR_TEMPLATE
+class STRUCT_MIRROR_STRUCT(cal_event_BACK)
+{
+public:
+  STRUCT_MIRROR_ITEM_CTRL(E);
+  STRUCT_MIRROR_TYPE(float) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(E);
+  STRUCT_MIRROR_ITEM_CTRL(T);
+  STRUCT_MIRROR_TYPE(float) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(T);
+  STRUCT_MIRROR_FCNS_DECL(cal_event_BACK);
+};
+#endif//USER_DEF_cal_event_BACK
+
+#ifndef USER_DEF_cal_event_MON
+STRUCT_MIRROR_TEMPLATE
+class STRUCT_MIRROR_STRUCT(cal_event_MON)
+{
+public:
+  STRUCT_MIRROR_ITEM_CTRL(E);
+  STRUCT_MIRROR_TYPE(float) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(E);
+  STRUCT_MIRROR_ITEM_CTRL(T);
+  STRUCT_MIRROR_TYPE(float) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(T);
+  STRUCT_MIRROR_FCNS_DECL(cal_event_MON);
+};
+#endif//USER_DEF_cal_event_MON
+
+#ifndef USER_DEF_cal_event_D_F
+STRUCT_MIRROR_TEMPLATE
+class STRUCT_MIRROR_STRUCT(cal_event_D_F)
+{
+public:
+  STRUCT_MIRROR_ITEM_CTRL(E);
+  STRUCT_MIRROR_TYPE(float) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(E);
+  STRUCT_MIRROR_ITEM_CTRL(T);
+  STRUCT_MIRROR_TYPE(float) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(T);
+  STRUCT_MIRROR_FCNS_DECL(cal_event_D_F);
+};
+#endif//USER_DEF_cal_event_D_F
+
+#ifndef USER_DEF_cal_event_D_B
+STRUCT_MIRROR_TEMPLATE
+class STRUCT_MIRROR_STRUCT(cal_event_D_B)
+{
+public:
+  STRUCT_MIRROR_ITEM_CTRL(E);
+  STRUCT_MIRROR_TYPE(float) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(E);
+  STRUCT_MIRROR_ITEM_CTRL(T);
+  STRUCT_MIRROR_TYPE(float) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(T);
+  STRUCT_MIRROR_FCNS_DECL(cal_event_D_B);
+};
+#endif//USER_DEF_cal_event_D_B
+
+#ifndef USER_DEF_cal_event_D
+STRUCT_MIRROR_TEMPLATE
+class STRUCT_MIRROR_STRUCT(cal_event_D)
+{
+public:
+  STRUCT_MIRROR_ITEM_CTRL(F);
+  STRUCT_MIRROR_TYPE(raw_list_zero_suppress) < STRUCT_MIRROR_TYPE_TEMPLATE STRUCT_MIRROR_TEMPLATE_ARG(cal_event_D_F),STRUCT_MIRROR_TEMPLATE_ARG(cal_event_D_F),32> STRUCT_MIRROR_NAME(F);
+  STRUCT_MIRROR_ITEM_CTRL(B);
+  STRUCT_MIRROR_TYPE(raw_list_zero_suppress) < STRUCT_MIRROR_TYPE_TEMPLATE STRUCT_MIRROR_TEMPLATE_ARG(cal_event_D_B),STRUCT_MIRROR_TEMPLATE_ARG(cal_event_D_B),32> STRUCT_MIRROR_NAME(B);
+  STRUCT_MIRROR_FCNS_DECL(cal_event_D);
+};
+#endif//USER_DEF_cal_event_D
+
+#ifndef USER_DEF_cal_event
+STRUCT_MIRROR_TEMPLATE
+class STRUCT_MIRROR_STRUCT(cal_event) : public STRUCT_MIRROR_BASE(cal_event_base)
+{
+public:
+  STRUCT_MIRROR_ITEM_CTRL_BASE(cal_event_base);
+  STRUCT_MIRROR_ITEM_CTRL(TEBIS);
+  STRUCT_MIRROR_TYPE(float) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(TEBIS);
+  STRUCT_MIRROR_ITEM_CTRL(TSHORT);
+  STRUCT_MIRROR_TYPE(float) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(TSHORT);
+  STRUCT_MIRROR_ITEM_CTRL(OLDTEBIS);
+  STRUCT_MIRROR_TYPE(float) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(OLDTEBIS);
+  STRUCT_MIRROR_ITEM_CTRL(OLDTSHORT);
+  STRUCT_MIRROR_TYPE(float) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(OLDTSHORT);
+  STRUCT_MIRROR_ITEM_CTRL(EBIS);
+  STRUCT_MIRROR_TYPE(float) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(EBIS);
+  STRUCT_MIRROR_ITEM_CTRL(NACCEPT);
+  STRUCT_MIRROR_TYPE(float) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(NACCEPT);
+  STRUCT_MIRROR_ITEM_CTRL(BACK);
+  STRUCT_MIRROR_ITEM_CTRL_ARRAY(BACK__i0,,2);
+  STRUCT_MIRROR_TYPE(cal_event_BACK) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(BACK[2]);
+  STRUCT_MIRROR_ITEM_CTRL(MON);
+  STRUCT_MIRROR_ITEM_CTRL_ARRAY(MON__i0,,2);
+  STRUCT_MIRROR_TYPE(cal_event_MON) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(MON[2]);
+  STRUCT_MIRROR_ITEM_CTRL(D);
+  STRUCT_MIRROR_ITEM_CTRL_ARRAY(D__i0,,3);
+  STRUCT_MIRROR_TYPE(cal_event_D) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(D[3]);
+  STRUCT_MIRROR_FCNS_DECL(cal_event);
+};
+#endif//USER_DEF_cal_event
+
+#include "gen/default_mirror_undef.hh"
+
+
+/** END_MIRROR_STRUCT *************************************************/
@@ -0,0 +1,134 @@
+/** BEGIN_EVENT_CAL_STRUCTURE ******************************************
+ *
+ * Event data structure.
+ *
+ * Do not edit - automatically generated.
+ */
+
+//DUMPY: 2 0
+class cal_event_BACK
+{
+public:
+  float E;
+  float T;
+
+public:
+#ifndef __PSDC__
+  STRUCT_FCNS_DECL(cal_event_BACK);
+#endif//!__PSDC__
+} ;
+
+//DUMPY: 2 0
+class cal_event_MON
+{
+public:
+  float E;
+  float T;
+
+public:
+#ifndef __PSDC__
+  STRUCT_FCNS_DECL(cal_event_MON);
+#endif//!__PSDC__
+} ;
+
+//DUMPY: 32 1
+class cal_event_D_F
+{
+public:
+  float E;
+  float T;
+
+public:
+#ifndef __PSDC__
+  STRUCT_FCNS_DECL(cal_event_D_F);
+#endif//!__PSDC__
+} ;
+
+//DUMPY: 32 1
+class cal_event_D_B
+{
+public:
+  float E;
+  float T;
+
+public:
+#ifndef __PSDC__
+  STRUCT_FCNS_DECL(cal_event_D_B);
+#endif//!__PSDC__
+} ;
+
+//DUMPY: 3 0
+class cal_event_D
+{
+public:
+//DUMPY: 32 1
+  raw_list_zero_suppress<cal_event_D_F,cal_event_D_F,32>
+  /* {
+  public:
+    float E;
+    float T;
+  } */ F;
+//DUMPY: 32 1
+  raw_list_zero_suppress<cal_event_D_B,cal_event_D_B,32>
+  /* {
+  public:
+    float E;
+    float T;
+  } */ B;
+
+public:
+#ifndef __PSDC__
+  STRUCT_FCNS_DECL(cal_event_D);
+#endif//!__PSDC__
+} ;
+
+class cal_event : public cal_event_base
+{
+public:
+  float TEBIS;
+  float TSHORT;
+  float OLDTEBIS;
+  float OLDTSHORT;
+  float EBIS;
+  float NACCEPT;
+//DUMPY: 2 0
+  cal_event_BACK
+  /* {
+  public:
+    float E;
+    float T;
+  } */ BACK[2];
+//DUMPY: 2 0
+  cal_event_MON
+  /* {
+  public:
+    float E;
+    float T;
+  } */ MON[2];
+//DUMPY: 3 0
+  cal_event_D
+  /* {
+  public:
+//DUMPY: 32 1
+    raw_list_zero_suppress<cal_event_D_F,cal_event_D_F,32>
+    {
+    public:
+      float E;
+      float T;
+    } F;
+//DUMPY: 32 1
+    raw_list_zero_suppress<cal_event_D_B,cal_event_D_B,32>
+    {
+    public:
+      float E;
+      float T;
+    } B;
+  } */ D[3];
+
+public:
+#ifndef __PSDC__
+  STRUCT_FCNS_DECL(cal_event);
+#endif//!__PSDC__
+} ;
+
+/** END_EVENT_CAL_STRUCTURE *******************************************/
@@ -0,0 +1,48 @@
+class cal_event_BACK
+{
+  float E;
+  float T;
+  STRUCT_FCNS_DECL(cal_event_BACK);
+} ;
+class cal_event_MON
+{
+  float E;
+  float T;
+  STRUCT_FCNS_DECL(cal_event_MON);
+} ;
+class cal_event_D_F
+{
+  float E;
+  float T;
+  STRUCT_FCNS_DECL(cal_event_D_F);
+} ;
+class cal_event_D_B
+{
+  float E;
+  float T;
+  STRUCT_FCNS_DECL(cal_event_D_B);
+} ;
+class cal_event_D
+{
+  raw_list_zero_suppress<cal_event_D_F,cal_event_D_F,32>
+       F;
+  raw_list_zero_suppress<cal_event_D_B,cal_event_D_B,32>
+       B;
+  STRUCT_FCNS_DECL(cal_event_D);
+} ;
+class cal_event : public cal_event_base
+{
+  float TEBIS;
+  float TSHORT;
+  float OLDTEBIS;
+  float OLDTSHORT;
+  float EBIS;
+  float NACCEPT;
+  cal_event_BACK
+       BACK[2];
+  cal_event_MON
+       MON[2];
+  cal_event_D
+       D[3];
+  STRUCT_FCNS_DECL(cal_event);
+} ;
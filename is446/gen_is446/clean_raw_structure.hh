@@ -0,0 +1,54 @@
+class raw_event_BACK
+{
+  DATA12 E;
+  DATA12 T;
+  STRUCT_FCNS_DECL(raw_event_BACK);
+} ;
+class raw_event_MON
+{
+  DATA12 E;
+  DATA12 T;
+  STRUCT_FCNS_DECL(raw_event_MON);
+} ;
+class raw_event_D_F
+{
+  DATA12 E;
+  DATA12 T;
+  STRUCT_FCNS_DECL(raw_event_D_F);
+} ;
+class raw_event_D_B
+{
+  DATA12 E;
+  DATA12 T;
+  STRUCT_FCNS_DECL(raw_event_D_B);
+} ;
+class raw_event_D
+{
+  raw_array_zero_suppress<raw_event_D_F,raw_event_D_F,32>
+       F;
+  raw_array_zero_suppress<raw_event_D_B,raw_event_D_B,32>
+       B;
+  STRUCT_FCNS_DECL(raw_event_D);
+} ;
+class raw_event : public raw_event_base
+{
+  DATA32 TEBIS;
+  DATA32 TSHORT;
+  DATA32 OLDTEBIS;
+  DATA32 OLDTSHORT;
+  DATA32 EBIS;
+  DATA32 NACCEPT;
+  raw_event_BACK
+       BACK[2];
+  raw_event_MON
+       MON[2];
+  raw_event_D
+       D[3];
+  DATA32 TLAST;
+  DATA32 TLONG;
+  STRUCT_FCNS_DECL(raw_event);
+} ;
+class raw_sticky : public raw_sticky_base
+{
+  STRUCT_FCNS_DECL(raw_sticky);
+} ;
@@ -0,0 +1,357 @@
+/** BEGIN_EVENT_DATA_MAPPING *******************************************
+ *
+ * Event data mapping.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// The order in this file does not matter.
+// This information parsed once and not treated eventwise,
+// it is used to initialize a structure.
+
+SIGNAL_MAPPING(DATA12,BACK_1_E,vme.adc[6].data[0],BACK[0].E);
+SIGNAL_MAPPING(DATA12,BACK_1_T,vme.tdc[4].data[0],BACK[0].T);
+SIGNAL_MAPPING(DATA12,BACK_2_E,vme.adc[6].data[1],BACK[1].E);
+SIGNAL_MAPPING(DATA12,BACK_2_T,vme.tdc[4].data[1],BACK[1].T);
+SIGNAL_MAPPING(DATA12,D1B10E,vme.adc[1].data[9],D[0].B[9].E);/*,ZERO_SUPPRESS_ITEM(D[0].B,9)*/
+SIGNAL_MAPPING(DATA12,D1B10T,vme.tdc[1].data[9],D[0].B[9].T);/*,ZERO_SUPPRESS_ITEM(D[0].B,9)*/
+SIGNAL_MAPPING(DATA12,D1B11E,vme.adc[1].data[10],D[0].B[10].E);/*,ZERO_SUPPRESS_ITEM(D[0].B,10)*/
+SIGNAL_MAPPING(DATA12,D1B11T,vme.tdc[1].data[10],D[0].B[10].T);/*,ZERO_SUPPRESS_ITEM(D[0].B,10)*/
+SIGNAL_MAPPING(DATA12,D1B12E,vme.adc[1].data[11],D[0].B[11].E);/*,ZERO_SUPPRESS_ITEM(D[0].B,11)*/
+SIGNAL_MAPPING(DATA12,D1B12T,vme.tdc[1].data[11],D[0].B[11].T);/*,ZERO_SUPPRESS_ITEM(D[0].B,11)*/
+SIGNAL_MAPPING(DATA12,D1B13E,vme.adc[1].data[12],D[0].B[12].E);/*,ZERO_SUPPRESS_ITEM(D[0].B,12)*/
+SIGNAL_MAPPING(DATA12,D1B13T,vme.tdc[1].data[12],D[0].B[12].T);/*,ZERO_SUPPRESS_ITEM(D[0].B,12)*/
+SIGNAL_MAPPING(DATA12,D1B14E,vme.adc[1].data[13],D[0].B[13].E);/*,ZERO_SUPPRESS_ITEM(D[0].B,13)*/
+SIGNAL_MAPPING(DATA12,D1B14T,vme.tdc[1].data[13],D[0].B[13].T);/*,ZERO_SUPPRESS_ITEM(D[0].B,13)*/
+SIGNAL_MAPPING(DATA12,D1B15E,vme.adc[1].data[14],D[0].B[14].E);/*,ZERO_SUPPRESS_ITEM(D[0].B,14)*/
+SIGNAL_MAPPING(DATA12,D1B15T,vme.tdc[1].data[14],D[0].B[14].T);/*,ZERO_SUPPRESS_ITEM(D[0].B,14)*/
+SIGNAL_MAPPING(DATA12,D1B16E,vme.adc[1].data[15],D[0].B[15].E);/*,ZERO_SUPPRESS_ITEM(D[0].B,15)*/
+SIGNAL_MAPPING(DATA12,D1B16T,vme.tdc[1].data[15],D[0].B[15].T);/*,ZERO_SUPPRESS_ITEM(D[0].B,15)*/
+SIGNAL_MAPPING(DATA12,D1B17E,vme.adc[1].data[16],D[0].B[16].E);/*,ZERO_SUPPRESS_ITEM(D[0].B,16)*/
+SIGNAL_MAPPING(DATA12,D1B17T,vme.tdc[1].data[16],D[0].B[16].T);/*,ZERO_SUPPRESS_ITEM(D[0].B,16)*/
+SIGNAL_MAPPING(DATA12,D1B18E,vme.adc[1].data[17],D[0].B[17].E);/*,ZERO_SUPPRESS_ITEM(D[0].B,17)*/
+SIGNAL_MAPPING(DATA12,D1B18T,vme.tdc[1].data[17],D[0].B[17].T);/*,ZERO_SUPPRESS_ITEM(D[0].B,17)*/
+SIGNAL_MAPPING(DATA12,D1B19E,vme.adc[1].data[18],D[0].B[18].E);/*,ZERO_SUPPRESS_ITEM(D[0].B,18)*/
+SIGNAL_MAPPING(DATA12,D1B19T,vme.tdc[1].data[18],D[0].B[18].T);/*,ZERO_SUPPRESS_ITEM(D[0].B,18)*/
+SIGNAL_MAPPING(DATA12,D1B1E,vme.adc[1].data[0],D[0].B[0].E);/*,ZERO_SUPPRESS_ITEM(D[0].B,0)*/
+SIGNAL_MAPPING(DATA12,D1B1T,vme.tdc[1].data[0],D[0].B[0].T);/*,ZERO_SUPPRESS_ITEM(D[0].B,0)*/
+SIGNAL_MAPPING(DATA12,D1B20E,vme.adc[1].data[19],D[0].B[19].E);/*,ZERO_SUPPRESS_ITEM(D[0].B,19)*/
+SIGNAL_MAPPING(DATA12,D1B20T,vme.tdc[1].data[19],D[0].B[19].T);/*,ZERO_SUPPRESS_ITEM(D[0].B,19)*/
+SIGNAL_MAPPING(DATA12,D1B21E,vme.adc[1].data[20],D[0].B[20].E);/*,ZERO_SUPPRESS_ITEM(D[0].B,20)*/
+SIGNAL_MAPPING(DATA12,D1B21T,vme.tdc[1].data[20],D[0].B[20].T);/*,ZERO_SUPPRESS_ITEM(D[0].B,20)*/
+SIGNAL_MAPPING(DATA12,D1B22E,vme.adc[1].data[21],D[0].B[21].E);/*,ZERO_SUPPRESS_ITEM(D[0].B,21)*/
+SIGNAL_MAPPING(DATA12,D1B22T,vme.tdc[1].data[21],D[0].B[21].T);/*,ZERO_SUPPRESS_ITEM(D[0].B,21)*/
+SIGNAL_MAPPING(DATA12,D1B23E,vme.adc[1].data[22],D[0].B[22].E);/*,ZERO_SUPPRESS_ITEM(D[0].B,22)*/
+SIGNAL_MAPPING(DATA12,D1B23T,vme.tdc[1].data[22],D[0].B[22].T);/*,ZERO_SUPPRESS_ITEM(D[0].B,22)*/
+SIGNAL_MAPPING(DATA12,D1B24E,vme.adc[1].data[23],D[0].B[23].E);/*,ZERO_SUPPRESS_ITEM(D[0].B,23)*/
+SIGNAL_MAPPING(DATA12,D1B24T,vme.tdc[1].data[23],D[0].B[23].T);/*,ZERO_SUPPRESS_ITEM(D[0].B,23)*/
+SIGNAL_MAPPING(DATA12,D1B25E,vme.adc[1].data[24],D[0].B[24].E);/*,ZERO_SUPPRESS_ITEM(D[0].B,24)*/
+SIGNAL_MAPPING(DATA12,D1B25T,vme.tdc[1].data[24],D[0].B[24].T);/*,ZERO_SUPPRESS_ITEM(D[0].B,24)*/
+SIGNAL_MAPPING(DATA12,D1B26E,vme.adc[1].data[25],D[0].B[25].E);/*,ZERO_SUPPRESS_ITEM(D[0].B,25)*/
+SIGNAL_MAPPING(DATA12,D1B26T,vme.tdc[1].data[25],D[0].B[25].T);/*,ZERO_SUPPRESS_ITEM(D[0].B,25)*/
+SIGNAL_MAPPING(DATA12,D1B27E,vme.adc[1].data[26],D[0].B[26].E);/*,ZERO_SUPPRESS_ITEM(D[0].B,26)*/
+SIGNAL_MAPPING(DATA12,D1B27T,vme.tdc[1].data[26],D[0].B[26].T);/*,ZERO_SUPPRESS_ITEM(D[0].B,26)*/
+SIGNAL_MAPPING(DATA12,D1B28E,vme.adc[1].data[27],D[0].B[27].E);/*,ZERO_SUPPRESS_ITEM(D[0].B,27)*/
+SIGNAL_MAPPING(DATA12,D1B28T,vme.tdc[1].data[27],D[0].B[27].T);/*,ZERO_SUPPRESS_ITEM(D[0].B,27)*/
+SIGNAL_MAPPING(DATA12,D1B29E,vme.adc[1].data[28],D[0].B[28].E);/*,ZERO_SUPPRESS_ITEM(D[0].B,28)*/
+SIGNAL_MAPPING(DATA12,D1B29T,vme.tdc[1].data[28],D[0].B[28].T);/*,ZERO_SUPPRESS_ITEM(D[0].B,28)*/
+SIGNAL_MAPPING(DATA12,D1B2E,vme.adc[1].data[1],D[0].B[1].E);/*,ZERO_SUPPRESS_ITEM(D[0].B,1)*/
+SIGNAL_MAPPING(DATA12,D1B2T,vme.tdc[1].data[1],D[0].B[1].T);/*,ZERO_SUPPRESS_ITEM(D[0].B,1)*/
+SIGNAL_MAPPING(DATA12,D1B30E,vme.adc[1].data[29],D[0].B[29].E);/*,ZERO_SUPPRESS_ITEM(D[0].B,29)*/
+SIGNAL_MAPPING(DATA12,D1B30T,vme.tdc[1].data[29],D[0].B[29].T);/*,ZERO_SUPPRESS_ITEM(D[0].B,29)*/
+SIGNAL_MAPPING(DATA12,D1B31E,vme.adc[1].data[30],D[0].B[30].E);/*,ZERO_SUPPRESS_ITEM(D[0].B,30)*/
+SIGNAL_MAPPING(DATA12,D1B31T,vme.tdc[1].data[30],D[0].B[30].T);/*,ZERO_SUPPRESS_ITEM(D[0].B,30)*/
+SIGNAL_MAPPING(DATA12,D1B32E,vme.adc[1].data[31],D[0].B[31].E);/*,ZERO_SUPPRESS_ITEM(D[0].B,31)*/
+SIGNAL_MAPPING(DATA12,D1B32T,vme.tdc[1].data[31],D[0].B[31].T);/*,ZERO_SUPPRESS_ITEM(D[0].B,31)*/
+SIGNAL_MAPPING(DATA12,D1B3E,vme.adc[1].data[2],D[0].B[2].E);/*,ZERO_SUPPRESS_ITEM(D[0].B,2)*/
+SIGNAL_MAPPING(DATA12,D1B3T,vme.tdc[1].data[2],D[0].B[2].T);/*,ZERO_SUPPRESS_ITEM(D[0].B,2)*/
+SIGNAL_MAPPING(DATA12,D1B4E,vme.adc[1].data[3],D[0].B[3].E);/*,ZERO_SUPPRESS_ITEM(D[0].B,3)*/
+SIGNAL_MAPPING(DATA12,D1B4T,vme.tdc[1].data[3],D[0].B[3].T);/*,ZERO_SUPPRESS_ITEM(D[0].B,3)*/
+SIGNAL_MAPPING(DATA12,D1B5E,vme.adc[1].data[4],D[0].B[4].E);/*,ZERO_SUPPRESS_ITEM(D[0].B,4)*/
+SIGNAL_MAPPING(DATA12,D1B5T,vme.tdc[1].data[4],D[0].B[4].T);/*,ZERO_SUPPRESS_ITEM(D[0].B,4)*/
+SIGNAL_MAPPING(DATA12,D1B6E,vme.adc[1].data[5],D[0].B[5].E);/*,ZERO_SUPPRESS_ITEM(D[0].B,5)*/
+SIGNAL_MAPPING(DATA12,D1B6T,vme.tdc[1].data[5],D[0].B[5].T);/*,ZERO_SUPPRESS_ITEM(D[0].B,5)*/
+SIGNAL_MAPPING(DATA12,D1B7E,vme.adc[1].data[6],D[0].B[6].E);/*,ZERO_SUPPRESS_ITEM(D[0].B,6)*/
+SIGNAL_MAPPING(DATA12,D1B7T,vme.tdc[1].data[6],D[0].B[6].T);/*,ZERO_SUPPRESS_ITEM(D[0].B,6)*/
+SIGNAL_MAPPING(DATA12,D1B8E,vme.adc[1].data[7],D[0].B[7].E);/*,ZERO_SUPPRESS_ITEM(D[0].B,7)*/
+SIGNAL_MAPPING(DATA12,D1B8T,vme.tdc[1].data[7],D[0].B[7].T);/*,ZERO_SUPPRESS_ITEM(D[0].B,7)*/
+SIGNAL_MAPPING(DATA12,D1B9E,vme.adc[1].data[8],D[0].B[8].E);/*,ZERO_SUPPRESS_ITEM(D[0].B,8)*/
+SIGNAL_MAPPING(DATA12,D1B9T,vme.tdc[1].data[8],D[0].B[8].T);/*,ZERO_SUPPRESS_ITEM(D[0].B,8)*/
+SIGNAL_MAPPING(DATA12,D1F10E,vme.adc[0].data[9],D[0].F[9].E);/*,ZERO_SUPPRESS_ITEM(D[0].F,9)*/
+SIGNAL_MAPPING(DATA12,D1F10T,vme.tdc[0].data[9],D[0].F[9].T);/*,ZERO_SUPPRESS_ITEM(D[0].F,9)*/
+SIGNAL_MAPPING(DATA12,D1F11E,vme.adc[0].data[10],D[0].F[10].E);/*,ZERO_SUPPRESS_ITEM(D[0].F,10)*/
+SIGNAL_MAPPING(DATA12,D1F11T,vme.tdc[0].data[10],D[0].F[10].T);/*,ZERO_SUPPRESS_ITEM(D[0].F,10)*/
+SIGNAL_MAPPING(DATA12,D1F12E,vme.adc[0].data[11],D[0].F[11].E);/*,ZERO_SUPPRESS_ITEM(D[0].F,11)*/
+SIGNAL_MAPPING(DATA12,D1F12T,vme.tdc[0].data[11],D[0].F[11].T);/*,ZERO_SUPPRESS_ITEM(D[0].F,11)*/
+SIGNAL_MAPPING(DATA12,D1F13E,vme.adc[0].data[12],D[0].F[12].E);/*,ZERO_SUPPRESS_ITEM(D[0].F,12)*/
+SIGNAL_MAPPING(DATA12,D1F13T,vme.tdc[0].data[12],D[0].F[12].T);/*,ZERO_SUPPRESS_ITEM(D[0].F,12)*/
+SIGNAL_MAPPING(DATA12,D1F14E,vme.adc[0].data[13],D[0].F[13].E);/*,ZERO_SUPPRESS_ITEM(D[0].F,13)*/
+SIGNAL_MAPPING(DATA12,D1F14T,vme.tdc[0].data[13],D[0].F[13].T);/*,ZERO_SUPPRESS_ITEM(D[0].F,13)*/
+SIGNAL_MAPPING(DATA12,D1F15E,vme.adc[0].data[14],D[0].F[14].E);/*,ZERO_SUPPRESS_ITEM(D[0].F,14)*/
+SIGNAL_MAPPING(DATA12,D1F15T,vme.tdc[0].data[14],D[0].F[14].T);/*,ZERO_SUPPRESS_ITEM(D[0].F,14)*/
+SIGNAL_MAPPING(DATA12,D1F16E,vme.adc[0].data[15],D[0].F[15].E);/*,ZERO_SUPPRESS_ITEM(D[0].F,15)*/
+SIGNAL_MAPPING(DATA12,D1F16T,vme.tdc[0].data[15],D[0].F[15].T);/*,ZERO_SUPPRESS_ITEM(D[0].F,15)*/
+SIGNAL_MAPPING(DATA12,D1F17E,vme.adc[0].data[16],D[0].F[16].E);/*,ZERO_SUPPRESS_ITEM(D[0].F,16)*/
+SIGNAL_MAPPING(DATA12,D1F17T,vme.tdc[0].data[16],D[0].F[16].T);/*,ZERO_SUPPRESS_ITEM(D[0].F,16)*/
+SIGNAL_MAPPING(DATA12,D1F18E,vme.adc[0].data[17],D[0].F[17].E);/*,ZERO_SUPPRESS_ITEM(D[0].F,17)*/
+SIGNAL_MAPPING(DATA12,D1F18T,vme.tdc[0].data[17],D[0].F[17].T);/*,ZERO_SUPPRESS_ITEM(D[0].F,17)*/
+SIGNAL_MAPPING(DATA12,D1F19E,vme.adc[0].data[18],D[0].F[18].E);/*,ZERO_SUPPRESS_ITEM(D[0].F,18)*/
+SIGNAL_MAPPING(DATA12,D1F19T,vme.tdc[0].data[18],D[0].F[18].T);/*,ZERO_SUPPRESS_ITEM(D[0].F,18)*/
+SIGNAL_MAPPING(DATA12,D1F1E,vme.adc[0].data[0],D[0].F[0].E);/*,ZERO_SUPPRESS_ITEM(D[0].F,0)*/
+SIGNAL_MAPPING(DATA12,D1F1T,vme.tdc[0].data[0],D[0].F[0].T);/*,ZERO_SUPPRESS_ITEM(D[0].F,0)*/
+SIGNAL_MAPPING(DATA12,D1F20E,vme.adc[0].data[19],D[0].F[19].E);/*,ZERO_SUPPRESS_ITEM(D[0].F,19)*/
+SIGNAL_MAPPING(DATA12,D1F20T,vme.tdc[0].data[19],D[0].F[19].T);/*,ZERO_SUPPRESS_ITEM(D[0].F,19)*/
+SIGNAL_MAPPING(DATA12,D1F21E,vme.adc[0].data[20],D[0].F[20].E);/*,ZERO_SUPPRESS_ITEM(D[0].F,20)*/
+SIGNAL_MAPPING(DATA12,D1F21T,vme.tdc[0].data[20],D[0].F[20].T);/*,ZERO_SUPPRESS_ITEM(D[0].F,20)*/
+SIGNAL_MAPPING(DATA12,D1F22E,vme.adc[0].data[21],D[0].F[21].E);/*,ZERO_SUPPRESS_ITEM(D[0].F,21)*/
+SIGNAL_MAPPING(DATA12,D1F22T,vme.tdc[0].data[21],D[0].F[21].T);/*,ZERO_SUPPRESS_ITEM(D[0].F,21)*/
+SIGNAL_MAPPING(DATA12,D1F23E,vme.adc[0].data[22],D[0].F[22].E);/*,ZERO_SUPPRESS_ITEM(D[0].F,22)*/
+SIGNAL_MAPPING(DATA12,D1F23T,vme.tdc[0].data[22],D[0].F[22].T);/*,ZERO_SUPPRESS_ITEM(D[0].F,22)*/
+SIGNAL_MAPPING(DATA12,D1F24E,vme.adc[0].data[23],D[0].F[23].E);/*,ZERO_SUPPRESS_ITEM(D[0].F,23)*/
+SIGNAL_MAPPING(DATA12,D1F24T,vme.tdc[0].data[23],D[0].F[23].T);/*,ZERO_SUPPRESS_ITEM(D[0].F,23)*/
+SIGNAL_MAPPING(DATA12,D1F25E,vme.adc[0].data[24],D[0].F[24].E);/*,ZERO_SUPPRESS_ITEM(D[0].F,24)*/
+SIGNAL_MAPPING(DATA12,D1F25T,vme.tdc[0].data[24],D[0].F[24].T);/*,ZERO_SUPPRESS_ITEM(D[0].F,24)*/
+SIGNAL_MAPPING(DATA12,D1F26E,vme.adc[0].data[25],D[0].F[25].E);/*,ZERO_SUPPRESS_ITEM(D[0].F,25)*/
+SIGNAL_MAPPING(DATA12,D1F26T,vme.tdc[0].data[25],D[0].F[25].T);/*,ZERO_SUPPRESS_ITEM(D[0].F,25)*/
+SIGNAL_MAPPING(DATA12,D1F27E,vme.adc[0].data[26],D[0].F[26].E);/*,ZERO_SUPPRESS_ITEM(D[0].F,26)*/
+SIGNAL_MAPPING(DATA12,D1F27T,vme.tdc[0].data[26],D[0].F[26].T);/*,ZERO_SUPPRESS_ITEM(D[0].F,26)*/
+SIGNAL_MAPPING(DATA12,D1F28E,vme.adc[0].data[27],D[0].F[27].E);/*,ZERO_SUPPRESS_ITEM(D[0].F,27)*/
+SIGNAL_MAPPING(DATA12,D1F28T,vme.tdc[0].data[27],D[0].F[27].T);/*,ZERO_SUPPRESS_ITEM(D[0].F,27)*/
+SIGNAL_MAPPING(DATA12,D1F29E,vme.adc[0].data[28],D[0].F[28].E);/*,ZERO_SUPPRESS_ITEM(D[0].F,28)*/
+SIGNAL_MAPPING(DATA12,D1F29T,vme.tdc[0].data[28],D[0].F[28].T);/*,ZERO_SUPPRESS_ITEM(D[0].F,28)*/
+SIGNAL_MAPPING(DATA12,D1F2E,vme.adc[0].data[1],D[0].F[1].E);/*,ZERO_SUPPRESS_ITEM(D[0].F,1)*/
+SIGNAL_MAPPING(DATA12,D1F2T,vme.tdc[0].data[1],D[0].F[1].T);/*,ZERO_SUPPRESS_ITEM(D[0].F,1)*/
+SIGNAL_MAPPING(DATA12,D1F30E,vme.adc[0].data[29],D[0].F[29].E);/*,ZERO_SUPPRESS_ITEM(D[0].F,29)*/
+SIGNAL_MAPPING(DATA12,D1F30T,vme.tdc[0].data[29],D[0].F[29].T);/*,ZERO_SUPPRESS_ITEM(D[0].F,29)*/
+SIGNAL_MAPPING(DATA12,D1F31E,vme.adc[0].data[30],D[0].F[30].E);/*,ZERO_SUPPRESS_ITEM(D[0].F,30)*/
+SIGNAL_MAPPING(DATA12,D1F31T,vme.tdc[0].data[30],D[0].F[30].T);/*,ZERO_SUPPRESS_ITEM(D[0].F,30)*/
+SIGNAL_MAPPING(DATA12,D1F32E,vme.adc[0].data[31],D[0].F[31].E);/*,ZERO_SUPPRESS_ITEM(D[0].F,31)*/
+SIGNAL_MAPPING(DATA12,D1F32T,vme.tdc[0].data[31],D[0].F[31].T);/*,ZERO_SUPPRESS_ITEM(D[0].F,31)*/
+SIGNAL_MAPPING(DATA12,D1F3E,vme.adc[0].data[2],D[0].F[2].E);/*,ZERO_SUPPRESS_ITEM(D[0].F,2)*/
+SIGNAL_MAPPING(DATA12,D1F3T,vme.tdc[0].data[2],D[0].F[2].T);/*,ZERO_SUPPRESS_ITEM(D[0].F,2)*/
+SIGNAL_MAPPING(DATA12,D1F4E,vme.adc[0].data[3],D[0].F[3].E);/*,ZERO_SUPPRESS_ITEM(D[0].F,3)*/
+SIGNAL_MAPPING(DATA12,D1F4T,vme.tdc[0].data[3],D[0].F[3].T);/*,ZERO_SUPPRESS_ITEM(D[0].F,3)*/
+SIGNAL_MAPPING(DATA12,D1F5E,vme.adc[0].data[4],D[0].F[4].E);/*,ZERO_SUPPRESS_ITEM(D[0].F,4)*/
+SIGNAL_MAPPING(DATA12,D1F5T,vme.tdc[0].data[4],D[0].F[4].T);/*,ZERO_SUPPRESS_ITEM(D[0].F,4)*/
+SIGNAL_MAPPING(DATA12,D1F6E,vme.adc[0].data[5],D[0].F[5].E);/*,ZERO_SUPPRESS_ITEM(D[0].F,5)*/
+SIGNAL_MAPPING(DATA12,D1F6T,vme.tdc[0].data[5],D[0].F[5].T);/*,ZERO_SUPPRESS_ITEM(D[0].F,5)*/
+SIGNAL_MAPPING(DATA12,D1F7E,vme.adc[0].data[6],D[0].F[6].E);/*,ZERO_SUPPRESS_ITEM(D[0].F,6)*/
+SIGNAL_MAPPING(DATA12,D1F7T,vme.tdc[0].data[6],D[0].F[6].T);/*,ZERO_SUPPRESS_ITEM(D[0].F,6)*/
+SIGNAL_MAPPING(DATA12,D1F8E,vme.adc[0].data[7],D[0].F[7].E);/*,ZERO_SUPPRESS_ITEM(D[0].F,7)*/
+SIGNAL_MAPPING(DATA12,D1F8T,vme.tdc[0].data[7],D[0].F[7].T);/*,ZERO_SUPPRESS_ITEM(D[0].F,7)*/
+SIGNAL_MAPPING(DATA12,D1F9E,vme.adc[0].data[8],D[0].F[8].E);/*,ZERO_SUPPRESS_ITEM(D[0].F,8)*/
+SIGNAL_MAPPING(DATA12,D1F9T,vme.tdc[0].data[8],D[0].F[8].T);/*,ZERO_SUPPRESS_ITEM(D[0].F,8)*/
+SIGNAL_MAPPING(DATA12,D2B10E,vme.adc[3].data[9],D[1].B[9].E);/*,ZERO_SUPPRESS_ITEM(D[1].B,9)*/
+SIGNAL_MAPPING(DATA12,D2B11E,vme.adc[3].data[10],D[1].B[10].E);/*,ZERO_SUPPRESS_ITEM(D[1].B,10)*/
+SIGNAL_MAPPING(DATA12,D2B12E,vme.adc[3].data[11],D[1].B[11].E);/*,ZERO_SUPPRESS_ITEM(D[1].B,11)*/
+SIGNAL_MAPPING(DATA12,D2B13E,vme.adc[3].data[12],D[1].B[12].E);/*,ZERO_SUPPRESS_ITEM(D[1].B,12)*/
+SIGNAL_MAPPING(DATA12,D2B14E,vme.adc[3].data[13],D[1].B[13].E);/*,ZERO_SUPPRESS_ITEM(D[1].B,13)*/
+SIGNAL_MAPPING(DATA12,D2B15E,vme.adc[3].data[14],D[1].B[14].E);/*,ZERO_SUPPRESS_ITEM(D[1].B,14)*/
+SIGNAL_MAPPING(DATA12,D2B16E,vme.adc[3].data[15],D[1].B[15].E);/*,ZERO_SUPPRESS_ITEM(D[1].B,15)*/
+SIGNAL_MAPPING(DATA12,D2B17E,vme.adc[3].data[16],D[1].B[16].E);/*,ZERO_SUPPRESS_ITEM(D[1].B,16)*/
+SIGNAL_MAPPING(DATA12,D2B18E,vme.adc[3].data[17],D[1].B[17].E);/*,ZERO_SUPPRESS_ITEM(D[1].B,17)*/
+SIGNAL_MAPPING(DATA12,D2B19E,vme.adc[3].data[18],D[1].B[18].E);/*,ZERO_SUPPRESS_ITEM(D[1].B,18)*/
+SIGNAL_MAPPING(DATA12,D2B1E,vme.adc[3].data[0],D[1].B[0].E);/*,ZERO_SUPPRESS_ITEM(D[1].B,0)*/
+SIGNAL_MAPPING(DATA12,D2B20E,vme.adc[3].data[19],D[1].B[19].E);/*,ZERO_SUPPRESS_ITEM(D[1].B,19)*/
+SIGNAL_MAPPING(DATA12,D2B21E,vme.adc[3].data[20],D[1].B[20].E);/*,ZERO_SUPPRESS_ITEM(D[1].B,20)*/
+SIGNAL_MAPPING(DATA12,D2B22E,vme.adc[3].data[21],D[1].B[21].E);/*,ZERO_SUPPRESS_ITEM(D[1].B,21)*/
+SIGNAL_MAPPING(DATA12,D2B23E,vme.adc[3].data[22],D[1].B[22].E);/*,ZERO_SUPPRESS_ITEM(D[1].B,22)*/
+SIGNAL_MAPPING(DATA12,D2B24E,vme.adc[3].data[23],D[1].B[23].E);/*,ZERO_SUPPRESS_ITEM(D[1].B,23)*/
+SIGNAL_MAPPING(DATA12,D2B25E,vme.adc[3].data[24],D[1].B[24].E);/*,ZERO_SUPPRESS_ITEM(D[1].B,24)*/
+SIGNAL_MAPPING(DATA12,D2B26E,vme.adc[3].data[25],D[1].B[25].E);/*,ZERO_SUPPRESS_ITEM(D[1].B,25)*/
+SIGNAL_MAPPING(DATA12,D2B27E,vme.adc[3].data[26],D[1].B[26].E);/*,ZERO_SUPPRESS_ITEM(D[1].B,26)*/
+SIGNAL_MAPPING(DATA12,D2B28E,vme.adc[3].data[27],D[1].B[27].E);/*,ZERO_SUPPRESS_ITEM(D[1].B,27)*/
+SIGNAL_MAPPING(DATA12,D2B29E,vme.adc[3].data[28],D[1].B[28].E);/*,ZERO_SUPPRESS_ITEM(D[1].B,28)*/
+SIGNAL_MAPPING(DATA12,D2B2E,vme.adc[3].data[1],D[1].B[1].E);/*,ZERO_SUPPRESS_ITEM(D[1].B,1)*/
+SIGNAL_MAPPING(DATA12,D2B30E,vme.adc[3].data[29],D[1].B[29].E);/*,ZERO_SUPPRESS_ITEM(D[1].B,29)*/
+SIGNAL_MAPPING(DATA12,D2B31E,vme.adc[3].data[30],D[1].B[30].E);/*,ZERO_SUPPRESS_ITEM(D[1].B,30)*/
+SIGNAL_MAPPING(DATA12,D2B32E,vme.adc[3].data[31],D[1].B[31].E);/*,ZERO_SUPPRESS_ITEM(D[1].B,31)*/
+SIGNAL_MAPPING(DATA12,D2B3E,vme.adc[3].data[2],D[1].B[2].E);/*,ZERO_SUPPRESS_ITEM(D[1].B,2)*/
+SIGNAL_MAPPING(DATA12,D2B4E,vme.adc[3].data[3],D[1].B[3].E);/*,ZERO_SUPPRESS_ITEM(D[1].B,3)*/
+SIGNAL_MAPPING(DATA12,D2B5E,vme.adc[3].data[4],D[1].B[4].E);/*,ZERO_SUPPRESS_ITEM(D[1].B,4)*/
+SIGNAL_MAPPING(DATA12,D2B6E,vme.adc[3].data[5],D[1].B[5].E);/*,ZERO_SUPPRESS_ITEM(D[1].B,5)*/
+SIGNAL_MAPPING(DATA12,D2B7E,vme.adc[3].data[6],D[1].B[6].E);/*,ZERO_SUPPRESS_ITEM(D[1].B,6)*/
+SIGNAL_MAPPING(DATA12,D2B8E,vme.adc[3].data[7],D[1].B[7].E);/*,ZERO_SUPPRESS_ITEM(D[1].B,7)*/
+SIGNAL_MAPPING(DATA12,D2B9E,vme.adc[3].data[8],D[1].B[8].E);/*,ZERO_SUPPRESS_ITEM(D[1].B,8)*/
+SIGNAL_MAPPING(DATA12,D2F10E,vme.adc[2].data[9],D[1].F[9].E);/*,ZERO_SUPPRESS_ITEM(D[1].F,9)*/
+SIGNAL_MAPPING(DATA12,D2F10T,vme.tdc[2].data[9],D[1].F[9].T);/*,ZERO_SUPPRESS_ITEM(D[1].F,9)*/
+SIGNAL_MAPPING(DATA12,D2F11E,vme.adc[2].data[10],D[1].F[10].E);/*,ZERO_SUPPRESS_ITEM(D[1].F,10)*/
+SIGNAL_MAPPING(DATA12,D2F11T,vme.tdc[2].data[10],D[1].F[10].T);/*,ZERO_SUPPRESS_ITEM(D[1].F,10)*/
+SIGNAL_MAPPING(DATA12,D2F12E,vme.adc[2].data[11],D[1].F[11].E);/*,ZERO_SUPPRESS_ITEM(D[1].F,11)*/
+SIGNAL_MAPPING(DATA12,D2F12T,vme.tdc[2].data[11],D[1].F[11].T);/*,ZERO_SUPPRESS_ITEM(D[1].F,11)*/
+SIGNAL_MAPPING(DATA12,D2F13E,vme.adc[2].data[12],D[1].F[12].E);/*,ZERO_SUPPRESS_ITEM(D[1].F,12)*/
+SIGNAL_MAPPING(DATA12,D2F13T,vme.tdc[2].data[12],D[1].F[12].T);/*,ZERO_SUPPRESS_ITEM(D[1].F,12)*/
+SIGNAL_MAPPING(DATA12,D2F14E,vme.adc[2].data[13],D[1].F[13].E);/*,ZERO_SUPPRESS_ITEM(D[1].F,13)*/
+SIGNAL_MAPPING(DATA12,D2F14T,vme.tdc[2].data[13],D[1].F[13].T);/*,ZERO_SUPPRESS_ITEM(D[1].F,13)*/
+SIGNAL_MAPPING(DATA12,D2F15E,vme.adc[2].data[14],D[1].F[14].E);/*,ZERO_SUPPRESS_ITEM(D[1].F,14)*/
+SIGNAL_MAPPING(DATA12,D2F15T,vme.tdc[2].data[14],D[1].F[14].T);/*,ZERO_SUPPRESS_ITEM(D[1].F,14)*/
+SIGNAL_MAPPING(DATA12,D2F16E,vme.adc[2].data[15],D[1].F[15].E);/*,ZERO_SUPPRESS_ITEM(D[1].F,15)*/
+SIGNAL_MAPPING(DATA12,D2F16T,vme.tdc[2].data[15],D[1].F[15].T);/*,ZERO_SUPPRESS_ITEM(D[1].F,15)*/
+SIGNAL_MAPPING(DATA12,D2F17E,vme.adc[2].data[16],D[1].F[16].E);/*,ZERO_SUPPRESS_ITEM(D[1].F,16)*/
+SIGNAL_MAPPING(DATA12,D2F17T,vme.tdc[2].data[16],D[1].F[16].T);/*,ZERO_SUPPRESS_ITEM(D[1].F,16)*/
+SIGNAL_MAPPING(DATA12,D2F18E,vme.adc[2].data[17],D[1].F[17].E);/*,ZERO_SUPPRESS_ITEM(D[1].F,17)*/
+SIGNAL_MAPPING(DATA12,D2F18T,vme.tdc[2].data[17],D[1].F[17].T);/*,ZERO_SUPPRESS_ITEM(D[1].F,17)*/
+SIGNAL_MAPPING(DATA12,D2F19E,vme.adc[2].data[18],D[1].F[18].E);/*,ZERO_SUPPRESS_ITEM(D[1].F,18)*/
+SIGNAL_MAPPING(DATA12,D2F19T,vme.tdc[2].data[18],D[1].F[18].T);/*,ZERO_SUPPRESS_ITEM(D[1].F,18)*/
+SIGNAL_MAPPING(DATA12,D2F1E,vme.adc[2].data[0],D[1].F[0].E);/*,ZERO_SUPPRESS_ITEM(D[1].F,0)*/
+SIGNAL_MAPPING(DATA12,D2F1T,vme.tdc[2].data[0],D[1].F[0].T);/*,ZERO_SUPPRESS_ITEM(D[1].F,0)*/
+SIGNAL_MAPPING(DATA12,D2F20E,vme.adc[2].data[19],D[1].F[19].E);/*,ZERO_SUPPRESS_ITEM(D[1].F,19)*/
+SIGNAL_MAPPING(DATA12,D2F20T,vme.tdc[2].data[19],D[1].F[19].T);/*,ZERO_SUPPRESS_ITEM(D[1].F,19)*/
+SIGNAL_MAPPING(DATA12,D2F21E,vme.adc[2].data[20],D[1].F[20].E);/*,ZERO_SUPPRESS_ITEM(D[1].F,20)*/
+SIGNAL_MAPPING(DATA12,D2F21T,vme.tdc[2].data[20],D[1].F[20].T);/*,ZERO_SUPPRESS_ITEM(D[1].F,20)*/
+SIGNAL_MAPPING(DATA12,D2F22E,vme.adc[2].data[21],D[1].F[21].E);/*,ZERO_SUPPRESS_ITEM(D[1].F,21)*/
+SIGNAL_MAPPING(DATA12,D2F22T,vme.tdc[2].data[21],D[1].F[21].T);/*,ZERO_SUPPRESS_ITEM(D[1].F,21)*/
+SIGNAL_MAPPING(DATA12,D2F23E,vme.adc[2].data[22],D[1].F[22].E);/*,ZERO_SUPPRESS_ITEM(D[1].F,22)*/
+SIGNAL_MAPPING(DATA12,D2F23T,vme.tdc[2].data[22],D[1].F[22].T);/*,ZERO_SUPPRESS_ITEM(D[1].F,22)*/
+SIGNAL_MAPPING(DATA12,D2F24E,vme.adc[2].data[23],D[1].F[23].E);/*,ZERO_SUPPRESS_ITEM(D[1].F,23)*/
+SIGNAL_MAPPING(DATA12,D2F24T,vme.tdc[2].data[23],D[1].F[23].T);/*,ZERO_SUPPRESS_ITEM(D[1].F,23)*/
+SIGNAL_MAPPING(DATA12,D2F25E,vme.adc[2].data[24],D[1].F[24].E);/*,ZERO_SUPPRESS_ITEM(D[1].F,24)*/
+SIGNAL_MAPPING(DATA12,D2F25T,vme.tdc[2].data[24],D[1].F[24].T);/*,ZERO_SUPPRESS_ITEM(D[1].F,24)*/
+SIGNAL_MAPPING(DATA12,D2F26E,vme.adc[2].data[25],D[1].F[25].E);/*,ZERO_SUPPRESS_ITEM(D[1].F,25)*/
+SIGNAL_MAPPING(DATA12,D2F26T,vme.tdc[2].data[25],D[1].F[25].T);/*,ZERO_SUPPRESS_ITEM(D[1].F,25)*/
+SIGNAL_MAPPING(DATA12,D2F27E,vme.adc[2].data[26],D[1].F[26].E);/*,ZERO_SUPPRESS_ITEM(D[1].F,26)*/
+SIGNAL_MAPPING(DATA12,D2F27T,vme.tdc[2].data[26],D[1].F[26].T);/*,ZERO_SUPPRESS_ITEM(D[1].F,26)*/
+SIGNAL_MAPPING(DATA12,D2F28E,vme.adc[2].data[27],D[1].F[27].E);/*,ZERO_SUPPRESS_ITEM(D[1].F,27)*/
+SIGNAL_MAPPING(DATA12,D2F28T,vme.tdc[2].data[27],D[1].F[27].T);/*,ZERO_SUPPRESS_ITEM(D[1].F,27)*/
+SIGNAL_MAPPING(DATA12,D2F29E,vme.adc[2].data[28],D[1].F[28].E);/*,ZERO_SUPPRESS_ITEM(D[1].F,28)*/
+SIGNAL_MAPPING(DATA12,D2F29T,vme.tdc[2].data[28],D[1].F[28].T);/*,ZERO_SUPPRESS_ITEM(D[1].F,28)*/
+SIGNAL_MAPPING(DATA12,D2F2E,vme.adc[2].data[1],D[1].F[1].E);/*,ZERO_SUPPRESS_ITEM(D[1].F,1)*/
+SIGNAL_MAPPING(DATA12,D2F2T,vme.tdc[2].data[1],D[1].F[1].T);/*,ZERO_SUPPRESS_ITEM(D[1].F,1)*/
+SIGNAL_MAPPING(DATA12,D2F30E,vme.adc[2].data[29],D[1].F[29].E);/*,ZERO_SUPPRESS_ITEM(D[1].F,29)*/
+SIGNAL_MAPPING(DATA12,D2F30T,vme.tdc[2].data[29],D[1].F[29].T);/*,ZERO_SUPPRESS_ITEM(D[1].F,29)*/
+SIGNAL_MAPPING(DATA12,D2F31E,vme.adc[2].data[30],D[1].F[30].E);/*,ZERO_SUPPRESS_ITEM(D[1].F,30)*/
+SIGNAL_MAPPING(DATA12,D2F31T,vme.tdc[2].data[30],D[1].F[30].T);/*,ZERO_SUPPRESS_ITEM(D[1].F,30)*/
+SIGNAL_MAPPING(DATA12,D2F32E,vme.adc[2].data[31],D[1].F[31].E);/*,ZERO_SUPPRESS_ITEM(D[1].F,31)*/
+SIGNAL_MAPPING(DATA12,D2F32T,vme.tdc[2].data[31],D[1].F[31].T);/*,ZERO_SUPPRESS_ITEM(D[1].F,31)*/
+SIGNAL_MAPPING(DATA12,D2F3E,vme.adc[2].data[2],D[1].F[2].E);/*,ZERO_SUPPRESS_ITEM(D[1].F,2)*/
+SIGNAL_MAPPING(DATA12,D2F3T,vme.tdc[2].data[2],D[1].F[2].T);/*,ZERO_SUPPRESS_ITEM(D[1].F,2)*/
+SIGNAL_MAPPING(DATA12,D2F4E,vme.adc[2].data[3],D[1].F[3].E);/*,ZERO_SUPPRESS_ITEM(D[1].F,3)*/
+SIGNAL_MAPPING(DATA12,D2F4T,vme.tdc[2].data[3],D[1].F[3].T);/*,ZERO_SUPPRESS_ITEM(D[1].F,3)*/
+SIGNAL_MAPPING(DATA12,D2F5E,vme.adc[2].data[4],D[1].F[4].E);/*,ZERO_SUPPRESS_ITEM(D[1].F,4)*/
+SIGNAL_MAPPING(DATA12,D2F5T,vme.tdc[2].data[4],D[1].F[4].T);/*,ZERO_SUPPRESS_ITEM(D[1].F,4)*/
+SIGNAL_MAPPING(DATA12,D2F6E,vme.adc[2].data[5],D[1].F[5].E);/*,ZERO_SUPPRESS_ITEM(D[1].F,5)*/
+SIGNAL_MAPPING(DATA12,D2F6T,vme.tdc[2].data[5],D[1].F[5].T);/*,ZERO_SUPPRESS_ITEM(D[1].F,5)*/
+SIGNAL_MAPPING(DATA12,D2F7E,vme.adc[2].data[6],D[1].F[6].E);/*,ZERO_SUPPRESS_ITEM(D[1].F,6)*/
+SIGNAL_MAPPING(DATA12,D2F7T,vme.tdc[2].data[6],D[1].F[6].T);/*,ZERO_SUPPRESS_ITEM(D[1].F,6)*/
+SIGNAL_MAPPING(DATA12,D2F8E,vme.adc[2].data[7],D[1].F[7].E);/*,ZERO_SUPPRESS_ITEM(D[1].F,7)*/
+SIGNAL_MAPPING(DATA12,D2F8T,vme.tdc[2].data[7],D[1].F[7].T);/*,ZERO_SUPPRESS_ITEM(D[1].F,7)*/
+SIGNAL_MAPPING(DATA12,D2F9E,vme.adc[2].data[8],D[1].F[8].E);/*,ZERO_SUPPRESS_ITEM(D[1].F,8)*/
+SIGNAL_MAPPING(DATA12,D2F9T,vme.tdc[2].data[8],D[1].F[8].T);/*,ZERO_SUPPRESS_ITEM(D[1].F,8)*/
+SIGNAL_MAPPING(DATA12,D3B10E,vme.adc[5].data[9],D[2].B[9].E);/*,ZERO_SUPPRESS_ITEM(D[2].B,9)*/
+SIGNAL_MAPPING(DATA12,D3B11E,vme.adc[5].data[10],D[2].B[10].E);/*,ZERO_SUPPRESS_ITEM(D[2].B,10)*/
+SIGNAL_MAPPING(DATA12,D3B12E,vme.adc[5].data[11],D[2].B[11].E);/*,ZERO_SUPPRESS_ITEM(D[2].B,11)*/
+SIGNAL_MAPPING(DATA12,D3B13E,vme.adc[5].data[12],D[2].B[12].E);/*,ZERO_SUPPRESS_ITEM(D[2].B,12)*/
+SIGNAL_MAPPING(DATA12,D3B14E,vme.adc[5].data[13],D[2].B[13].E);/*,ZERO_SUPPRESS_ITEM(D[2].B,13)*/
+SIGNAL_MAPPING(DATA12,D3B15E,vme.adc[5].data[14],D[2].B[14].E);/*,ZERO_SUPPRESS_ITEM(D[2].B,14)*/
+SIGNAL_MAPPING(DATA12,D3B16E,vme.adc[5].data[15],D[2].B[15].E);/*,ZERO_SUPPRESS_ITEM(D[2].B,15)*/
+SIGNAL_MAPPING(DATA12,D3B17E,vme.adc[5].data[16],D[2].B[16].E);/*,ZERO_SUPPRESS_ITEM(D[2].B,16)*/
+SIGNAL_MAPPING(DATA12,D3B18E,vme.adc[5].data[17],D[2].B[17].E);/*,ZERO_SUPPRESS_ITEM(D[2].B,17)*/
+SIGNAL_MAPPING(DATA12,D3B19E,vme.adc[5].data[18],D[2].B[18].E);/*,ZERO_SUPPRESS_ITEM(D[2].B,18)*/
+SIGNAL_MAPPING(DATA12,D3B1E,vme.adc[5].data[0],D[2].B[0].E);/*,ZERO_SUPPRESS_ITEM(D[2].B,0)*/
+SIGNAL_MAPPING(DATA12,D3B20E,vme.adc[5].data[19],D[2].B[19].E);/*,ZERO_SUPPRESS_ITEM(D[2].B,19)*/
+SIGNAL_MAPPING(DATA12,D3B21E,vme.adc[5].data[20],D[2].B[20].E);/*,ZERO_SUPPRESS_ITEM(D[2].B,20)*/
+SIGNAL_MAPPING(DATA12,D3B22E,vme.adc[5].data[21],D[2].B[21].E);/*,ZERO_SUPPRESS_ITEM(D[2].B,21)*/
+SIGNAL_MAPPING(DATA12,D3B23E,vme.adc[5].data[22],D[2].B[22].E);/*,ZERO_SUPPRESS_ITEM(D[2].B,22)*/
+SIGNAL_MAPPING(DATA12,D3B24E,vme.adc[5].data[23],D[2].B[23].E);/*,ZERO_SUPPRESS_ITEM(D[2].B,23)*/
+SIGNAL_MAPPING(DATA12,D3B25E,vme.adc[5].data[24],D[2].B[24].E);/*,ZERO_SUPPRESS_ITEM(D[2].B,24)*/
+SIGNAL_MAPPING(DATA12,D3B26E,vme.adc[5].data[25],D[2].B[25].E);/*,ZERO_SUPPRESS_ITEM(D[2].B,25)*/
+SIGNAL_MAPPING(DATA12,D3B27E,vme.adc[5].data[26],D[2].B[26].E);/*,ZERO_SUPPRESS_ITEM(D[2].B,26)*/
+SIGNAL_MAPPING(DATA12,D3B28E,vme.adc[5].data[27],D[2].B[27].E);/*,ZERO_SUPPRESS_ITEM(D[2].B,27)*/
+SIGNAL_MAPPING(DATA12,D3B29E,vme.adc[5].data[28],D[2].B[28].E);/*,ZERO_SUPPRESS_ITEM(D[2].B,28)*/
+SIGNAL_MAPPING(DATA12,D3B2E,vme.adc[5].data[1],D[2].B[1].E);/*,ZERO_SUPPRESS_ITEM(D[2].B,1)*/
+SIGNAL_MAPPING(DATA12,D3B30E,vme.adc[5].data[29],D[2].B[29].E);/*,ZERO_SUPPRESS_ITEM(D[2].B,29)*/
+SIGNAL_MAPPING(DATA12,D3B31E,vme.adc[5].data[30],D[2].B[30].E);/*,ZERO_SUPPRESS_ITEM(D[2].B,30)*/
+SIGNAL_MAPPING(DATA12,D3B32E,vme.adc[5].data[31],D[2].B[31].E);/*,ZERO_SUPPRESS_ITEM(D[2].B,31)*/
+SIGNAL_MAPPING(DATA12,D3B3E,vme.adc[5].data[2],D[2].B[2].E);/*,ZERO_SUPPRESS_ITEM(D[2].B,2)*/
+SIGNAL_MAPPING(DATA12,D3B4E,vme.adc[5].data[3],D[2].B[3].E);/*,ZERO_SUPPRESS_ITEM(D[2].B,3)*/
+SIGNAL_MAPPING(DATA12,D3B5E,vme.adc[5].data[4],D[2].B[4].E);/*,ZERO_SUPPRESS_ITEM(D[2].B,4)*/
+SIGNAL_MAPPING(DATA12,D3B6E,vme.adc[5].data[5],D[2].B[5].E);/*,ZERO_SUPPRESS_ITEM(D[2].B,5)*/
+SIGNAL_MAPPING(DATA12,D3B7E,vme.adc[5].data[6],D[2].B[6].E);/*,ZERO_SUPPRESS_ITEM(D[2].B,6)*/
+SIGNAL_MAPPING(DATA12,D3B8E,vme.adc[5].data[7],D[2].B[7].E);/*,ZERO_SUPPRESS_ITEM(D[2].B,7)*/
+SIGNAL_MAPPING(DATA12,D3B9E,vme.adc[5].data[8],D[2].B[8].E);/*,ZERO_SUPPRESS_ITEM(D[2].B,8)*/
+SIGNAL_MAPPING(DATA12,D3F10E,vme.adc[4].data[9],D[2].F[9].E);/*,ZERO_SUPPRESS_ITEM(D[2].F,9)*/
+SIGNAL_MAPPING(DATA12,D3F10T,vme.tdc[3].data[9],D[2].F[9].T);/*,ZERO_SUPPRESS_ITEM(D[2].F,9)*/
+SIGNAL_MAPPING(DATA12,D3F11E,vme.adc[4].data[10],D[2].F[10].E);/*,ZERO_SUPPRESS_ITEM(D[2].F,10)*/
+SIGNAL_MAPPING(DATA12,D3F11T,vme.tdc[3].data[10],D[2].F[10].T);/*,ZERO_SUPPRESS_ITEM(D[2].F,10)*/
+SIGNAL_MAPPING(DATA12,D3F12E,vme.adc[4].data[11],D[2].F[11].E);/*,ZERO_SUPPRESS_ITEM(D[2].F,11)*/
+SIGNAL_MAPPING(DATA12,D3F12T,vme.tdc[3].data[11],D[2].F[11].T);/*,ZERO_SUPPRESS_ITEM(D[2].F,11)*/
+SIGNAL_MAPPING(DATA12,D3F13E,vme.adc[4].data[12],D[2].F[12].E);/*,ZERO_SUPPRESS_ITEM(D[2].F,12)*/
+SIGNAL_MAPPING(DATA12,D3F13T,vme.tdc[3].data[12],D[2].F[12].T);/*,ZERO_SUPPRESS_ITEM(D[2].F,12)*/
+SIGNAL_MAPPING(DATA12,D3F14E,vme.adc[4].data[13],D[2].F[13].E);/*,ZERO_SUPPRESS_ITEM(D[2].F,13)*/
+SIGNAL_MAPPING(DATA12,D3F14T,vme.tdc[3].data[13],D[2].F[13].T);/*,ZERO_SUPPRESS_ITEM(D[2].F,13)*/
+SIGNAL_MAPPING(DATA12,D3F15E,vme.adc[4].data[14],D[2].F[14].E);/*,ZERO_SUPPRESS_ITEM(D[2].F,14)*/
+SIGNAL_MAPPING(DATA12,D3F15T,vme.tdc[3].data[14],D[2].F[14].T);/*,ZERO_SUPPRESS_ITEM(D[2].F,14)*/
+SIGNAL_MAPPING(DATA12,D3F16E,vme.adc[4].data[15],D[2].F[15].E);/*,ZERO_SUPPRESS_ITEM(D[2].F,15)*/
+SIGNAL_MAPPING(DATA12,D3F16T,vme.tdc[3].data[15],D[2].F[15].T);/*,ZERO_SUPPRESS_ITEM(D[2].F,15)*/
+SIGNAL_MAPPING(DATA12,D3F17E,vme.adc[4].data[16],D[2].F[16].E);/*,ZERO_SUPPRESS_ITEM(D[2].F,16)*/
+SIGNAL_MAPPING(DATA12,D3F17T,vme.tdc[3].data[16],D[2].F[16].T);/*,ZERO_SUPPRESS_ITEM(D[2].F,16)*/
+SIGNAL_MAPPING(DATA12,D3F18E,vme.adc[4].data[17],D[2].F[17].E);/*,ZERO_SUPPRESS_ITEM(D[2].F,17)*/
+SIGNAL_MAPPING(DATA12,D3F18T,vme.tdc[3].data[17],D[2].F[17].T);/*,ZERO_SUPPRESS_ITEM(D[2].F,17)*/
+SIGNAL_MAPPING(DATA12,D3F19E,vme.adc[4].data[18],D[2].F[18].E);/*,ZERO_SUPPRESS_ITEM(D[2].F,18)*/
+SIGNAL_MAPPING(DATA12,D3F19T,vme.tdc[3].data[18],D[2].F[18].T);/*,ZERO_SUPPRESS_ITEM(D[2].F,18)*/
+SIGNAL_MAPPING(DATA12,D3F1E,vme.adc[4].data[0],D[2].F[0].E);/*,ZERO_SUPPRESS_ITEM(D[2].F,0)*/
+SIGNAL_MAPPING(DATA12,D3F1T,vme.tdc[3].data[0],D[2].F[0].T);/*,ZERO_SUPPRESS_ITEM(D[2].F,0)*/
+SIGNAL_MAPPING(DATA12,D3F20E,vme.adc[4].data[19],D[2].F[19].E);/*,ZERO_SUPPRESS_ITEM(D[2].F,19)*/
+SIGNAL_MAPPING(DATA12,D3F20T,vme.tdc[3].data[19],D[2].F[19].T);/*,ZERO_SUPPRESS_ITEM(D[2].F,19)*/
+SIGNAL_MAPPING(DATA12,D3F21E,vme.adc[4].data[20],D[2].F[20].E);/*,ZERO_SUPPRESS_ITEM(D[2].F,20)*/
+SIGNAL_MAPPING(DATA12,D3F21T,vme.tdc[3].data[20],D[2].F[20].T);/*,ZERO_SUPPRESS_ITEM(D[2].F,20)*/
+SIGNAL_MAPPING(DATA12,D3F22E,vme.adc[4].data[21],D[2].F[21].E);/*,ZERO_SUPPRESS_ITEM(D[2].F,21)*/
+SIGNAL_MAPPING(DATA12,D3F22T,vme.tdc[3].data[21],D[2].F[21].T);/*,ZERO_SUPPRESS_ITEM(D[2].F,21)*/
+SIGNAL_MAPPING(DATA12,D3F23E,vme.adc[4].data[22],D[2].F[22].E);/*,ZERO_SUPPRESS_ITEM(D[2].F,22)*/
+SIGNAL_MAPPING(DATA12,D3F23T,vme.tdc[3].data[22],D[2].F[22].T);/*,ZERO_SUPPRESS_ITEM(D[2].F,22)*/
+SIGNAL_MAPPING(DATA12,D3F24E,vme.adc[4].data[23],D[2].F[23].E);/*,ZERO_SUPPRESS_ITEM(D[2].F,23)*/
+SIGNAL_MAPPING(DATA12,D3F24T,vme.tdc[3].data[23],D[2].F[23].T);/*,ZERO_SUPPRESS_ITEM(D[2].F,23)*/
+SIGNAL_MAPPING(DATA12,D3F25E,vme.adc[4].data[24],D[2].F[24].E);/*,ZERO_SUPPRESS_ITEM(D[2].F,24)*/
+SIGNAL_MAPPING(DATA12,D3F25T,vme.tdc[3].data[24],D[2].F[24].T);/*,ZERO_SUPPRESS_ITEM(D[2].F,24)*/
+SIGNAL_MAPPING(DATA12,D3F26E,vme.adc[4].data[25],D[2].F[25].E);/*,ZERO_SUPPRESS_ITEM(D[2].F,25)*/
+SIGNAL_MAPPING(DATA12,D3F26T,vme.tdc[3].data[25],D[2].F[25].T);/*,ZERO_SUPPRESS_ITEM(D[2].F,25)*/
+SIGNAL_MAPPING(DATA12,D3F27E,vme.adc[4].data[26],D[2].F[26].E);/*,ZERO_SUPPRESS_ITEM(D[2].F,26)*/
+SIGNAL_MAPPING(DATA12,D3F27T,vme.tdc[3].data[26],D[2].F[26].T);/*,ZERO_SUPPRESS_ITEM(D[2].F,26)*/
+SIGNAL_MAPPING(DATA12,D3F28E,vme.adc[4].data[27],D[2].F[27].E);/*,ZERO_SUPPRESS_ITEM(D[2].F,27)*/
+SIGNAL_MAPPING(DATA12,D3F28T,vme.tdc[3].data[27],D[2].F[27].T);/*,ZERO_SUPPRESS_ITEM(D[2].F,27)*/
+SIGNAL_MAPPING(DATA12,D3F29E,vme.adc[4].data[28],D[2].F[28].E);/*,ZERO_SUPPRESS_ITEM(D[2].F,28)*/
+SIGNAL_MAPPING(DATA12,D3F29T,vme.tdc[3].data[28],D[2].F[28].T);/*,ZERO_SUPPRESS_ITEM(D[2].F,28)*/
+SIGNAL_MAPPING(DATA12,D3F2E,vme.adc[4].data[1],D[2].F[1].E);/*,ZERO_SUPPRESS_ITEM(D[2].F,1)*/
+SIGNAL_MAPPING(DATA12,D3F2T,vme.tdc[3].data[1],D[2].F[1].T);/*,ZERO_SUPPRESS_ITEM(D[2].F,1)*/
+SIGNAL_MAPPING(DATA12,D3F30E,vme.adc[4].data[29],D[2].F[29].E);/*,ZERO_SUPPRESS_ITEM(D[2].F,29)*/
+SIGNAL_MAPPING(DATA12,D3F30T,vme.tdc[3].data[29],D[2].F[29].T);/*,ZERO_SUPPRESS_ITEM(D[2].F,29)*/
+SIGNAL_MAPPING(DATA12,D3F31E,vme.adc[4].data[30],D[2].F[30].E);/*,ZERO_SUPPRESS_ITEM(D[2].F,30)*/
+SIGNAL_MAPPING(DATA12,D3F31T,vme.tdc[3].data[30],D[2].F[30].T);/*,ZERO_SUPPRESS_ITEM(D[2].F,30)*/
+SIGNAL_MAPPING(DATA12,D3F32E,vme.adc[4].data[31],D[2].F[31].E);/*,ZERO_SUPPRESS_ITEM(D[2].F,31)*/
+SIGNAL_MAPPING(DATA12,D3F32T,vme.tdc[3].data[31],D[2].F[31].T);/*,ZERO_SUPPRESS_ITEM(D[2].F,31)*/
+SIGNAL_MAPPING(DATA12,D3F3E,vme.adc[4].data[2],D[2].F[2].E);/*,ZERO_SUPPRESS_ITEM(D[2].F,2)*/
+SIGNAL_MAPPING(DATA12,D3F3T,vme.tdc[3].data[2],D[2].F[2].T);/*,ZERO_SUPPRESS_ITEM(D[2].F,2)*/
+SIGNAL_MAPPING(DATA12,D3F4E,vme.adc[4].data[3],D[2].F[3].E);/*,ZERO_SUPPRESS_ITEM(D[2].F,3)*/
+SIGNAL_MAPPING(DATA12,D3F4T,vme.tdc[3].data[3],D[2].F[3].T);/*,ZERO_SUPPRESS_ITEM(D[2].F,3)*/
+SIGNAL_MAPPING(DATA12,D3F5E,vme.adc[4].data[4],D[2].F[4].E);/*,ZERO_SUPPRESS_ITEM(D[2].F,4)*/
+SIGNAL_MAPPING(DATA12,D3F5T,vme.tdc[3].data[4],D[2].F[4].T);/*,ZERO_SUPPRESS_ITEM(D[2].F,4)*/
+SIGNAL_MAPPING(DATA12,D3F6E,vme.adc[4].data[5],D[2].F[5].E);/*,ZERO_SUPPRESS_ITEM(D[2].F,5)*/
+SIGNAL_MAPPING(DATA12,D3F6T,vme.tdc[3].data[5],D[2].F[5].T);/*,ZERO_SUPPRESS_ITEM(D[2].F,5)*/
+SIGNAL_MAPPING(DATA12,D3F7E,vme.adc[4].data[6],D[2].F[6].E);/*,ZERO_SUPPRESS_ITEM(D[2].F,6)*/
+SIGNAL_MAPPING(DATA12,D3F7T,vme.tdc[3].data[6],D[2].F[6].T);/*,ZERO_SUPPRESS_ITEM(D[2].F,6)*/
+SIGNAL_MAPPING(DATA12,D3F8E,vme.adc[4].data[7],D[2].F[7].E);/*,ZERO_SUPPRESS_ITEM(D[2].F,7)*/
+SIGNAL_MAPPING(DATA12,D3F8T,vme.tdc[3].data[7],D[2].F[7].T);/*,ZERO_SUPPRESS_ITEM(D[2].F,7)*/
+SIGNAL_MAPPING(DATA12,D3F9E,vme.adc[4].data[8],D[2].F[8].E);/*,ZERO_SUPPRESS_ITEM(D[2].F,8)*/
+SIGNAL_MAPPING(DATA12,D3F9T,vme.tdc[3].data[8],D[2].F[8].T);/*,ZERO_SUPPRESS_ITEM(D[2].F,8)*/
+SIGNAL_MAPPING(DATA32,EBIS,vme.scaler[0].data[1],EBIS);
+SIGNAL_MAPPING(DATA12,MON_1_E,vme.adc[6].data[2],MON[0].E);
+SIGNAL_MAPPING(DATA12,MON_1_T,vme.tdc[4].data[4],MON[0].T);
+SIGNAL_MAPPING(DATA12,MON_2_E,vme.adc[6].data[3],MON[1].E);
+SIGNAL_MAPPING(DATA12,MON_2_T,vme.tdc[4].data[5],MON[1].T);
+SIGNAL_MAPPING(DATA32,NACCEPT,vme.scaler[0].data[2],NACCEPT);
+SIGNAL_MAPPING(DATA32,OLDTSHORT,vme.scaler[0].data[0],OLDTSHORT);
+
+/** END_EVENT_DATA_MAPPING ********************************************/
+/** BEGIN_EVENT_DATA_MAPPING *******************************************
+ *
+ * Event data mapping.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// The order in this file does not matter.
+// This information parsed once and not treated eventwise,
+// it is used to initialize a structure.
+
+
+/** END_EVENT_DATA_MAPPING ********************************************/
@@ -0,0 +1,906 @@
+/** BEGIN_PACKER *******************************************************
+ *
+ * Event packer for CAMAC_LECROY_4434.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// CAMAC_LECROY_4434(channels)
+template<typename __data_dest_t>
+void PACKER_CAMAC_LECROY_4434::__packer(__data_dest_t &__buffer,uint32 channels)
+{
+  // MEMBER(DATA24 data[32] ZERO_SUPPRESS);
+  // list(0<=index<channels)
+
+  {
+    // UINT32 ch_data NOENCODE
+    // {
+      //  0_23: value;
+      // 24_31: 0;
+      // ENCODE(data[index],(value=value));
+    // }
+  }
+}
+FORCE_IMPL_DATA_SRC_FCN_ARG(void,CAMAC_LECROY_4434::__packer,uint32 channels);
+
+/** END_PACKER ********************************************************/
+/** BEGIN_PACKER *******************************************************
+ *
+ * Event packer for CAMAC_PHILLIPS_7164.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// CAMAC_PHILLIPS_7164(channels,mark_channel_no)
+template<typename __data_dest_t>
+void PACKER_CAMAC_PHILLIPS_7164::__packer(__data_dest_t &__buffer,uint32 channels
+                                                                 ,uint32 mark_channel_no)
+{
+  // MEMBER(DATA12 data[16] ZERO_SUPPRESS);
+  // list(0<=index<channels)
+
+  {
+    // if(mark_channel_no)
+
+    // else
+
+    if (mark_channel_no)
+    {
+      // UINT16 ch_data NOENCODE
+      // {
+        //  0_11: value;
+        // 12_15: channel = CHECK(index);
+        // ENCODE(data[index],(value=value));
+      // }
+    }
+
+    else
+    {
+      // UINT16 ch_data NOENCODE
+      // {
+        //  0_11: value;
+        // ENCODE(data[index],(value=value));
+      // }
+    }
+  }
+}
+FORCE_IMPL_DATA_SRC_FCN_ARG(void,CAMAC_PHILLIPS_7164::__packer,uint32 channels
+                                                              ,uint32 mark_channel_no);
+
+/** END_PACKER ********************************************************/
+/** BEGIN_PACKER *******************************************************
+ *
+ * Event packer for CAMAC_SILENA_4418.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// CAMAC_SILENA_4418(channels,mark_channel_no)
+template<typename __data_dest_t>
+void PACKER_CAMAC_SILENA_4418::__packer(__data_dest_t &__buffer,uint32 channels
+                                                               ,uint32 mark_channel_no)
+{
+  // MEMBER(DATA12_OVERFLOW data[8] ZERO_SUPPRESS);
+  // list(0<=index<channels)
+
+  {
+    // if(mark_channel_no)
+
+    // else
+
+    if (mark_channel_no)
+    {
+      // UINT16 ch_data NOENCODE
+      // {
+        //  0_11: value;
+        // 12_14: channel = CHECK(index);
+        //    15: overflow;
+        // ENCODE(data[index],(value=value,overflow=overflow));
+      // }
+    }
+
+    else
+    {
+      // UINT16 ch_data NOENCODE
+      // {
+        //  0_11: value;
+        //    15: overflow;
+        // ENCODE(data[index],(value=value,overflow=overflow));
+      // }
+    }
+  }
+}
+FORCE_IMPL_DATA_SRC_FCN_ARG(void,CAMAC_SILENA_4418::__packer,uint32 channels
+                                                            ,uint32 mark_channel_no);
+
+/** END_PACKER ********************************************************/
+/** BEGIN_PACKER *******************************************************
+ *
+ * Event packer for FASTBUS_LECROY_1875.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// FASTBUS_LECROY_1875(geom,channels)
+template<typename __data_dest_t>
+void PACKER_FASTBUS_LECROY_1875::__packer(__data_dest_t &__buffer,uint32 geom
+                                                                 ,uint32 channels)
+{
+  // MEMBER(DATA12_RANGE data[64] ZERO_SUPPRESS);
+  // UINT32 ch_data NOENCODE
+  // {
+    //  0_11: value;
+    // 16_21: channel = RANGE(0,(channels - 1));
+    //    23: range;
+    // 24_26: n = CHECK(0);
+    // 27_31: geom = MATCH(geom);
+    // ENCODE(data[channel],(value=value,range=range));
+  // }
+}
+FORCE_IMPL_DATA_SRC_FCN_ARG(void,FASTBUS_LECROY_1875::__packer,uint32 geom
+                                                              ,uint32 channels);
+
+/** END_PACKER ********************************************************/
+/** BEGIN_PACKER *******************************************************
+ *
+ * Event packer for FASTBUS_LECROY_1885.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// FASTBUS_LECROY_1885(geom,channels)
+template<typename __data_dest_t>
+void PACKER_FASTBUS_LECROY_1885::__packer(__data_dest_t &__buffer,uint32 geom
+                                                                 ,uint32 channels)
+{
+  // MEMBER(DATA12_RANGE data[96] ZERO_SUPPRESS);
+  // UINT32 ch_data NOENCODE
+  // {
+    //  0_11: value;
+    // 16_22: channel = RANGE(0,(channels - 1));
+    //    23: range;
+    // 24_26: n = CHECK(0);
+    // 27_31: geom = MATCH(geom);
+    // ENCODE(data[channel],(value=value,range=range));
+  // }
+}
+FORCE_IMPL_DATA_SRC_FCN_ARG(void,FASTBUS_LECROY_1885::__packer,uint32 geom
+                                                              ,uint32 channels);
+
+/** END_PACKER ********************************************************/
+/** BEGIN_PACKER *******************************************************
+ *
+ * Event packer for VME_CAEN_V1190_SUBTDC.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// VME_CAEN_V1190_SUBTDC(tdc,event_id,data)
+template<typename __data_dest_t>
+void PACKER_VME_CAEN_V1190_SUBTDC::__packer(__data_dest_t &__buffer,uint32 tdc
+                                                                   ,uint32 event_id
+                                                                   ,raw_array_multi_zero_suppress<DATA24,DATA24,32,128> &data)
+{
+  // MEMBER(DATA24 data[32] ZERO_SUPPRESS_MULTI(128));
+  // MARK_COUNT(tdc_start);
+  void *__mark_tdc_start = __buffer._offset;
+  // UINT32 header
+  // {
+    //  0_11: bunch_id;
+    // 12_23: event_id = CHECK(event_id);
+    // 24_25: tdc = MATCH(tdc);
+    // 27_31: 1;
+  // }
+  // several UINT32 ch_data NOENCODE
+  // {
+    //  0_18: value;
+    // 19_23: channel_low;
+    // 24_25: tdc = CHECK(tdc);
+    //    26: trailing;
+    // 27_31: 0;
+    // ENCODE(data[((tdc << 5) | channel_low)],(value=value));
+  // }
+  // optional UINT32 error_flags
+  // {
+    //  0_14: flags;
+    // 24_25: tdc = CHECK(tdc);
+    // 27_31: 4;
+  // }
+  // MARK_COUNT(tdc_end);
+  void *__mark_tdc_end = __buffer._offset;
+  // UINT32 trailer
+  // {
+    //  0_11: word_count = CHECK_COUNT(tdc_start,tdc_end,4,4);
+    // 12_23: event_id = CHECK(header.event_id);
+    // 24_25: tdc = CHECK(tdc);
+    // 27_31: 3;
+  // }
+}
+FORCE_IMPL_DATA_SRC_FCN_ARG(void,VME_CAEN_V1190_SUBTDC::__packer,uint32 tdc
+                                                                ,uint32 event_id);
+
+/** END_PACKER ********************************************************/
+/** BEGIN_PACKER *******************************************************
+ *
+ * Event packer for VME_CAEN_V1190.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// VME_CAEN_V1190(geom)
+template<typename __data_dest_t>
+void PACKER_VME_CAEN_V1190::__packer(__data_dest_t &__buffer,uint32 geom)
+{
+  // MEMBER(DATA24 data[32] ZERO_SUPPRESS_MULTI(128));
+  // MARK_COUNT(v1190_start);
+  void *__mark_v1190_start = __buffer._offset;
+  // UINT32 header
+  // {
+    //  0_04: geom = MATCH(geom);
+    //  5_26: event_number;
+    // 27_31: 8;
+  // }
+  // select several
+
+    // tdc[0] = VME_CAEN_V1190_SUBTDC(tdc=0,event_id=(header.event_number & 0xfff),
+                                   // data=data);
+    // tdc[1] = VME_CAEN_V1190_SUBTDC(tdc=1,event_id=(header.event_number & 0xfff),
+                                   // data=data);
+    // tdc[2] = VME_CAEN_V1190_SUBTDC(tdc=2,event_id=(header.event_number & 0xfff),
+                                   // data=data);
+    // tdc[3] = VME_CAEN_V1190_SUBTDC(tdc=3,event_id=(header.event_number & 0xfff),
+                                   // data=data);
+  {
+    PACK_DECL(488,VME_CAEN_V1190_SUBTDC,tdc[0],/*tdc*/0,/*event_id*/(header.event_number & 0xfff),/*data*/data);
+    PACK_DECL(489,VME_CAEN_V1190_SUBTDC,tdc[1],/*tdc*/1,/*event_id*/(header.event_number & 0xfff),/*data*/data);
+    PACK_DECL(490,VME_CAEN_V1190_SUBTDC,tdc[2],/*tdc*/2,/*event_id*/(header.event_number & 0xfff),/*data*/data);
+    PACK_DECL(491,VME_CAEN_V1190_SUBTDC,tdc[3],/*tdc*/3,/*event_id*/(header.event_number & 0xfff),/*data*/data);
+  }
+  // UINT32 trigger
+  // {
+    //  0_26: time_tag;
+    // 27_31: 17;
+  // }
+  // MARK_COUNT(v1190_end);
+  void *__mark_v1190_end = __buffer._offset;
+  // UINT32 trailer
+  // {
+    //  0_04: geom = CHECK(geom);
+    //  5_19: word_count = CHECK_COUNT(v1190_start,v1190_end,4,4);
+    //    24: tdc_error;
+    //    25: buffer_overflow;
+    //    26: trigger_lost;
+    // 27_31: 16;
+  // }
+}
+FORCE_IMPL_DATA_SRC_FCN_ARG(void,VME_CAEN_V1190::__packer,uint32 geom);
+
+/** END_PACKER ********************************************************/
+/** BEGIN_PACKER *******************************************************
+ *
+ * Event packer for VME_CAEN_V1190_SHORT_SUBTDC.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// VME_CAEN_V1190_SHORT_SUBTDC(tdc,event_id,data)
+template<typename __data_dest_t>
+void PACKER_VME_CAEN_V1190_SHORT_SUBTDC::__packer(__data_dest_t &__buffer,uint32 tdc
+                                                                         ,uint32 event_id
+                                                                         ,raw_array_multi_zero_suppress<DATA24,DATA24,32,128> &data)
+{
+  // MEMBER(DATA24 data[32] ZERO_SUPPRESS_MULTI(128));
+  // UINT32 ch_data NOENCODE
+  // {
+    //  0_18: value;
+    // 19_23: channel_low;
+    // 24_25: tdc = CHECK(tdc);
+    //    26: trailing;
+    // 27_31: 0;
+    // ENCODE(data[((tdc << 5) | channel_low)],(value=value));
+  // }
+}
+FORCE_IMPL_DATA_SRC_FCN_ARG(void,VME_CAEN_V1190_SHORT_SUBTDC::__packer,uint32 tdc
+                                                                      ,uint32 event_id);
+
+/** END_PACKER ********************************************************/
+/** BEGIN_PACKER *******************************************************
+ *
+ * Event packer for VME_CAEN_V1190_SHORT_SUBTDC_ERROR.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// VME_CAEN_V1190_SHORT_SUBTDC_ERROR(tdc)
+template<typename __data_dest_t>
+void PACKER_VME_CAEN_V1190_SHORT_SUBTDC_ERROR::__packer(__data_dest_t &__buffer,uint32 tdc)
+{
+  // UINT32 error_flags
+  // {
+    //  0_14: flags;
+    // 24_25: tdc = CHECK(tdc);
+    // 27_31: 4;
+  // }
+}
+FORCE_IMPL_DATA_SRC_FCN_ARG(void,VME_CAEN_V1190_SHORT_SUBTDC_ERROR::__packer,uint32 tdc);
+
+/** END_PACKER ********************************************************/
+/** BEGIN_PACKER *******************************************************
+ *
+ * Event packer for VME_CAEN_V1190_SHORT.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// VME_CAEN_V1190_SHORT(geom)
+template<typename __data_dest_t>
+void PACKER_VME_CAEN_V1190_SHORT::__packer(__data_dest_t &__buffer,uint32 geom)
+{
+  // MEMBER(DATA24 data[32] ZERO_SUPPRESS_MULTI(128));
+  // MARK_COUNT(v1190_start);
+  void *__mark_v1190_start = __buffer._offset;
+  // UINT32 header
+  // {
+    //  0_04: geom = MATCH(geom);
+    //  5_26: event_number;
+    // 27_31: 8;
+  // }
+  // select several
+
+    // tdc[0] = VME_CAEN_V1190_SHORT_SUBTDC(tdc=0,event_id=(header.event_number & 0xfff),
+                                         // data=data);
+    // tdc[1] = VME_CAEN_V1190_SHORT_SUBTDC(tdc=1,event_id=(header.event_number & 0xfff),
+                                         // data=data);
+    // tdc[2] = VME_CAEN_V1190_SHORT_SUBTDC(tdc=2,event_id=(header.event_number & 0xfff),
+                                         // data=data);
+    // tdc[3] = VME_CAEN_V1190_SHORT_SUBTDC(tdc=3,event_id=(header.event_number & 0xfff),
+                                         // data=data);
+    // norevisit err[0] = VME_CAEN_V1190_SHORT_SUBTDC_ERROR(tdc=0);
+    // norevisit err[1] = VME_CAEN_V1190_SHORT_SUBTDC_ERROR(tdc=1);
+    // norevisit err[2] = VME_CAEN_V1190_SHORT_SUBTDC_ERROR(tdc=2);
+    // norevisit err[3] = VME_CAEN_V1190_SHORT_SUBTDC_ERROR(tdc=3);
+  {
+    PACK_DECL(577,VME_CAEN_V1190_SHORT_SUBTDC,tdc[0],/*tdc*/0,/*event_id*/(header.event_number & 0xfff),/*data*/data);
+    PACK_DECL(578,VME_CAEN_V1190_SHORT_SUBTDC,tdc[1],/*tdc*/1,/*event_id*/(header.event_number & 0xfff),/*data*/data);
+    PACK_DECL(579,VME_CAEN_V1190_SHORT_SUBTDC,tdc[2],/*tdc*/2,/*event_id*/(header.event_number & 0xfff),/*data*/data);
+    PACK_DECL(580,VME_CAEN_V1190_SHORT_SUBTDC,tdc[3],/*tdc*/3,/*event_id*/(header.event_number & 0xfff),/*data*/data);
+    PACK_DECL(582,VME_CAEN_V1190_SHORT_SUBTDC_ERROR,err[0],/*tdc*/0);
+    PACK_DECL(583,VME_CAEN_V1190_SHORT_SUBTDC_ERROR,err[1],/*tdc*/1);
+    PACK_DECL(584,VME_CAEN_V1190_SHORT_SUBTDC_ERROR,err[2],/*tdc*/2);
+    PACK_DECL(585,VME_CAEN_V1190_SHORT_SUBTDC_ERROR,err[3],/*tdc*/3);
+  }
+  // UINT32 trigger
+  // {
+    //  0_26: time_tag;
+    // 27_31: 17;
+  // }
+  // MARK_COUNT(v1190_end);
+  void *__mark_v1190_end = __buffer._offset;
+  // UINT32 trailer
+  // {
+    //  0_04: geom = CHECK(geom);
+    //  5_19: word_count = CHECK_COUNT(v1190_start,v1190_end,4,4);
+    //    24: tdc_error;
+    //    25: buffer_overflow;
+    //    26: trigger_lost;
+    // 27_31: 16;
+  // }
+}
+FORCE_IMPL_DATA_SRC_FCN_ARG(void,VME_CAEN_V1190_SHORT::__packer,uint32 geom);
+
+/** END_PACKER ********************************************************/
+/** BEGIN_PACKER *******************************************************
+ *
+ * Event packer for VME_CAEN_V1290_SUBTDC.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// VME_CAEN_V1290_SUBTDC(tdc,event_id,data)
+template<typename __data_dest_t>
+void PACKER_VME_CAEN_V1290_SUBTDC::__packer(__data_dest_t &__buffer,uint32 tdc
+                                                                   ,uint32 event_id
+                                                                   ,raw_array_multi_zero_suppress<DATA24,DATA24,32,128> &data)
+{
+  // MEMBER(DATA24 data[32] ZERO_SUPPRESS_MULTI(128));
+  // MARK_COUNT(tdc_start);
+  void *__mark_tdc_start = __buffer._offset;
+  // UINT32 header
+  // {
+    //  0_11: bunch_id;
+    // 12_23: event_id = CHECK(event_id);
+    // 24_25: tdc = MATCH(tdc);
+    // 27_31: 1;
+  // }
+  // several UINT32 ch_data NOENCODE
+  // {
+    //  0_20: value;
+    // 21_23: channel_low;
+    // 24_25: tdc = CHECK(tdc);
+    //    26: trailing;
+    // 27_31: 0;
+    // ENCODE(data[((tdc << 3) | channel_low)],(value=value));
+  // }
+  // optional UINT32 error_flags
+  // {
+    //  0_14: flags;
+    // 24_25: tdc = CHECK(tdc);
+    // 27_31: 4;
+  // }
+  // MARK_COUNT(tdc_end);
+  void *__mark_tdc_end = __buffer._offset;
+  // UINT32 trailer
+  // {
+    //  0_11: word_count = CHECK_COUNT(tdc_start,tdc_end,4,4);
+    // 12_23: event_id = CHECK(header.event_id);
+    // 24_25: tdc = CHECK(tdc);
+    // 27_31: 3;
+  // }
+}
+FORCE_IMPL_DATA_SRC_FCN_ARG(void,VME_CAEN_V1290_SUBTDC::__packer,uint32 tdc
+                                                                ,uint32 event_id);
+
+/** END_PACKER ********************************************************/
+/** BEGIN_PACKER *******************************************************
+ *
+ * Event packer for VME_CAEN_V1290.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// VME_CAEN_V1290(geom)
+template<typename __data_dest_t>
+void PACKER_VME_CAEN_V1290::__packer(__data_dest_t &__buffer,uint32 geom)
+{
+  // MEMBER(DATA24 data[32] ZERO_SUPPRESS_MULTI(128));
+  // MARK_COUNT(v1190_start);
+  void *__mark_v1190_start = __buffer._offset;
+  // UINT32 header
+  // {
+    //  0_04: geom = MATCH(geom);
+    //  5_26: event_number;
+    // 27_31: 8;
+  // }
+  // select several
+
+    // tdc[0] = VME_CAEN_V1290_SUBTDC(tdc=0,event_id=(header.event_number & 0xfff),
+                                   // data=data);
+    // tdc[1] = VME_CAEN_V1290_SUBTDC(tdc=1,event_id=(header.event_number & 0xfff),
+                                   // data=data);
+    // tdc[2] = VME_CAEN_V1290_SUBTDC(tdc=2,event_id=(header.event_number & 0xfff),
+                                   // data=data);
+    // tdc[3] = VME_CAEN_V1290_SUBTDC(tdc=3,event_id=(header.event_number & 0xfff),
+                                   // data=data);
+  {
+    PACK_DECL(283,VME_CAEN_V1290_SUBTDC,tdc[0],/*tdc*/0,/*event_id*/(header.event_number & 0xfff),/*data*/data);
+    PACK_DECL(284,VME_CAEN_V1290_SUBTDC,tdc[1],/*tdc*/1,/*event_id*/(header.event_number & 0xfff),/*data*/data);
+    PACK_DECL(285,VME_CAEN_V1290_SUBTDC,tdc[2],/*tdc*/2,/*event_id*/(header.event_number & 0xfff),/*data*/data);
+    PACK_DECL(286,VME_CAEN_V1290_SUBTDC,tdc[3],/*tdc*/3,/*event_id*/(header.event_number & 0xfff),/*data*/data);
+  }
+  // UINT32 trigger
+  // {
+    //  0_26: time_tag;
+    // 27_31: 17;
+  // }
+  // MARK_COUNT(v1190_end);
+  void *__mark_v1190_end = __buffer._offset;
+  // UINT32 trailer
+  // {
+    //  0_04: geom = CHECK(geom);
+    //  5_19: word_count = CHECK_COUNT(v1190_start,v1190_end,4,4);
+    //    24: tdc_error;
+    //    25: buffer_overflow;
+    //    26: trigger_lost;
+    // 27_31: 16;
+  // }
+}
+FORCE_IMPL_DATA_SRC_FCN_ARG(void,VME_CAEN_V1290::__packer,uint32 geom);
+
+/** END_PACKER ********************************************************/
+/** BEGIN_PACKER *******************************************************
+ *
+ * Event packer for VME_CAEN_V1290_SHORT_SUBTDC.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// VME_CAEN_V1290_SHORT_SUBTDC(tdc,event_id,data)
+template<typename __data_dest_t>
+void PACKER_VME_CAEN_V1290_SHORT_SUBTDC::__packer(__data_dest_t &__buffer,uint32 tdc
+                                                                         ,uint32 event_id
+                                                                         ,raw_array_multi_zero_suppress<DATA24,DATA24,32,128> &data)
+{
+  // MEMBER(DATA24 data[32] ZERO_SUPPRESS_MULTI(128));
+  // UINT32 ch_data NOENCODE
+  // {
+    //  0_20: value;
+    // 21_23: channel_low;
+    // 24_25: tdc = CHECK(tdc);
+    //    26: trailing;
+    // 27_31: 0;
+    // ENCODE(data[((tdc << 3) | channel_low)],(value=value));
+  // }
+}
+FORCE_IMPL_DATA_SRC_FCN_ARG(void,VME_CAEN_V1290_SHORT_SUBTDC::__packer,uint32 tdc
+                                                                      ,uint32 event_id);
+
+/** END_PACKER ********************************************************/
+/** BEGIN_PACKER *******************************************************
+ *
+ * Event packer for VME_CAEN_V1290_SHORT_SUBTDC_ERROR.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// VME_CAEN_V1290_SHORT_SUBTDC_ERROR(tdc)
+template<typename __data_dest_t>
+void PACKER_VME_CAEN_V1290_SHORT_SUBTDC_ERROR::__packer(__data_dest_t &__buffer,uint32 tdc)
+{
+  // UINT32 error_flags
+  // {
+    //  0_14: flags;
+    // 24_25: tdc = CHECK(tdc);
+    // 27_31: 4;
+  // }
+}
+FORCE_IMPL_DATA_SRC_FCN_ARG(void,VME_CAEN_V1290_SHORT_SUBTDC_ERROR::__packer,uint32 tdc);
+
+/** END_PACKER ********************************************************/
+/** BEGIN_PACKER *******************************************************
+ *
+ * Event packer for VME_CAEN_V1290_SHORT.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// VME_CAEN_V1290_SHORT(geom)
+template<typename __data_dest_t>
+void PACKER_VME_CAEN_V1290_SHORT::__packer(__data_dest_t &__buffer,uint32 geom)
+{
+  // MEMBER(DATA24 data[32] ZERO_SUPPRESS_MULTI(128));
+  // MARK_COUNT(v1190_start);
+  void *__mark_v1190_start = __buffer._offset;
+  // UINT32 header
+  // {
+    //  0_04: geom = MATCH(geom);
+    //  5_26: event_number;
+    // 27_31: 8;
+  // }
+  // select several
+
+    // tdc[0] = VME_CAEN_V1290_SHORT_SUBTDC(tdc=0,event_id=(header.event_number & 0xfff),
+                                         // data=data);
+    // tdc[1] = VME_CAEN_V1290_SHORT_SUBTDC(tdc=1,event_id=(header.event_number & 0xfff),
+                                         // data=data);
+    // tdc[2] = VME_CAEN_V1290_SHORT_SUBTDC(tdc=2,event_id=(header.event_number & 0xfff),
+                                         // data=data);
+    // tdc[3] = VME_CAEN_V1290_SHORT_SUBTDC(tdc=3,event_id=(header.event_number & 0xfff),
+                                         // data=data);
+    // norevisit err[0] = VME_CAEN_V1290_SHORT_SUBTDC_ERROR(tdc=0);
+    // norevisit err[1] = VME_CAEN_V1290_SHORT_SUBTDC_ERROR(tdc=1);
+    // norevisit err[2] = VME_CAEN_V1290_SHORT_SUBTDC_ERROR(tdc=2);
+    // norevisit err[3] = VME_CAEN_V1290_SHORT_SUBTDC_ERROR(tdc=3);
+  {
+    PACK_DECL(372,VME_CAEN_V1290_SHORT_SUBTDC,tdc[0],/*tdc*/0,/*event_id*/(header.event_number & 0xfff),/*data*/data);
+    PACK_DECL(373,VME_CAEN_V1290_SHORT_SUBTDC,tdc[1],/*tdc*/1,/*event_id*/(header.event_number & 0xfff),/*data*/data);
+    PACK_DECL(374,VME_CAEN_V1290_SHORT_SUBTDC,tdc[2],/*tdc*/2,/*event_id*/(header.event_number & 0xfff),/*data*/data);
+    PACK_DECL(375,VME_CAEN_V1290_SHORT_SUBTDC,tdc[3],/*tdc*/3,/*event_id*/(header.event_number & 0xfff),/*data*/data);
+    PACK_DECL(377,VME_CAEN_V1290_SHORT_SUBTDC_ERROR,err[0],/*tdc*/0);
+    PACK_DECL(378,VME_CAEN_V1290_SHORT_SUBTDC_ERROR,err[1],/*tdc*/1);
+    PACK_DECL(379,VME_CAEN_V1290_SHORT_SUBTDC_ERROR,err[2],/*tdc*/2);
+    PACK_DECL(380,VME_CAEN_V1290_SHORT_SUBTDC_ERROR,err[3],/*tdc*/3);
+  }
+  // UINT32 trigger
+  // {
+    //  0_26: time_tag;
+    // 27_31: 17;
+  // }
+  // MARK_COUNT(v1190_end);
+  void *__mark_v1190_end = __buffer._offset;
+  // UINT32 trailer
+  // {
+    //  0_04: geom = CHECK(geom);
+    //  5_19: word_count = CHECK_COUNT(v1190_start,v1190_end,4,4);
+    //    24: tdc_error;
+    //    25: buffer_overflow;
+    //    26: trigger_lost;
+    // 27_31: 16;
+  // }
+}
+FORCE_IMPL_DATA_SRC_FCN_ARG(void,VME_CAEN_V1290_SHORT::__packer,uint32 geom);
+
+/** END_PACKER ********************************************************/
+/** BEGIN_PACKER *******************************************************
+ *
+ * Event packer for VME_CAEN_V775.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// VME_CAEN_V775(geom,crate)
+template<typename __data_dest_t>
+void PACKER_VME_CAEN_V775::__packer(__data_dest_t &__buffer,uint32 geom,uint32 crate)
+{
+  // MEMBER(DATA12_OVERFLOW data[32] ZERO_SUPPRESS);
+  // UINT32 header NOENCODE
+  // {
+    //  8_13: count;
+    // 16_23: crate = MATCH(crate);
+    // 24_26: 2;
+    // 27_31: geom = MATCH(geom);
+  // }
+  // list(0<=index<header.count)
+
+  {
+    // UINT32 ch_data NOENCODE
+    // {
+      //  0_11: value;
+      //    12: overflow;
+      //    13: underflow;
+      //    14: valid;
+      // 16_20: channel;
+      // 24_26: 0;
+      // 27_31: geom = CHECK(geom);
+      // ENCODE(data[channel],(value=value,overflow=overflow));
+    // }
+  }
+  // UINT32 eob
+  // {
+    //  0_23: event_number;
+    // 24_26: 4;
+    // 27_31: geom = CHECK(geom);
+  // }
+}
+FORCE_IMPL_DATA_SRC_FCN_ARG(void,VME_CAEN_V775::__packer,uint32 geom,uint32 crate);
+
+/** END_PACKER ********************************************************/
+/** BEGIN_PACKER *******************************************************
+ *
+ * Event packer for VME_CAEN_V830.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// VME_CAEN_V830(geom)
+template<typename __data_dest_t>
+void PACKER_VME_CAEN_V830::__packer(__data_dest_t &__buffer,uint32 geom)
+{
+  // MEMBER(DATA32 data[32] ZERO_SUPPRESS);
+  // UINT32 header
+  // {
+    //  0_15: event_number;
+    // 16_17: ts;
+    // 18_23: count;
+    // 24_25: undefined;
+    //    26: 1;
+    // 27_31: geom = MATCH(geom);
+  // }
+  // list(0<=index<header.count)
+
+  {
+    // UINT32 ch_data NOENCODE
+    // {
+      //  0_25: value;
+      //    26: 0;
+      // 27_31: channel;
+      // ENCODE(data[channel],(value=value));
+    // }
+  }
+}
+FORCE_IMPL_DATA_SRC_FCN_ARG(void,VME_CAEN_V830::__packer,uint32 geom);
+
+/** END_PACKER ********************************************************/
+/** BEGIN_PACKER *******************************************************
+ *
+ * Event packer for VME_MESYTEC_MADC32.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// VME_MESYTEC_MADC32(geom)
+template<typename __data_dest_t>
+void PACKER_VME_MESYTEC_MADC32::__packer(__data_dest_t &__buffer,uint32 geom)
+{
+  // MEMBER(DATA14_OVERFLOW data[32] ZERO_SUPPRESS);
+  // MARK_COUNT(start);
+  void *__mark_start = __buffer._offset;
+  // UINT32 header NOENCODE
+  // {
+    //  0_11: word_number;
+    // 12_14: adc_resol;
+    //    15: out_form;
+    // 16_23: geom = MATCH(geom);
+    // 24_29: 0;
+    // 30_31: 1;
+  // }
+  // several UINT32 ch_data NOENCODE
+  // {
+    //  0_12: value;
+    //    14: outofrange;
+    // 16_20: channel;
+    // 21_29: 32;
+    // 30_31: 0;
+    // ENCODE(data[channel],(value=value,overflow=outofrange));
+  // }
+  // optional UINT32 filler NOENCODE
+  // {
+    //  0_31: 0;
+  // }
+  // UINT32 end_of_event
+  // {
+    //  0_29: counter;
+    // 30_31: 3;
+  // }
+  // MARK_COUNT(end);
+  void *__mark_end = __buffer._offset;
+  // CHECK_COUNT(header.word_number,start,end,( - 4),4)
+}
+FORCE_IMPL_DATA_SRC_FCN_ARG(void,VME_MESYTEC_MADC32::__packer,uint32 geom);
+
+/** END_PACKER ********************************************************/
+/** BEGIN_PACKER *******************************************************
+ *
+ * Event packer for VME_MESYTEC_MDPP16.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// VME_MESYTEC_MDPP16(geom)
+template<typename __data_dest_t>
+void PACKER_VME_MESYTEC_MDPP16::__packer(__data_dest_t &__buffer,uint32 geom)
+{
+  // MEMBER(DATA16_OVERFLOW adc[16] ZERO_SUPPRESS_MULTI(20));
+  // MEMBER(DATA16_OVERFLOW tdc[16] ZERO_SUPPRESS_MULTI(20));
+  // MEMBER(DATA16_OVERFLOW trig_tdc[16] ZERO_SUPPRESS_MULTI(20));
+  // MEMBER(DATA16_OVERFLOW adc_short[16] ZERO_SUPPRESS_MULTI(20));
+  // MARK_COUNT(start);
+  void *__mark_start = __buffer._offset;
+  // UINT32 header NOENCODE
+  // {
+    //  0_09: word_number;
+    // 10_12: adc_res;
+    // 13_15: tdc_res;
+    // 16_23: geom = MATCH(geom);
+    // 24_29: 0;
+    // 30_31: 1;
+  // }
+  // several UINT32 ch_data NOENCODE
+  // {
+    //  0_15: value;
+    // 16_19: channel;
+    // 20_21: ch_kind;
+    //    22: overflow;
+    //    23: pileup;
+    // 24_27: 0;
+    // 28_31: 1;
+    // if((ch_kind == 0))
+    // {
+      // ENCODE(adc[channel],(value=value,overflow=overflow,pileup=pileup));
+    // }
+    // if((ch_kind == 1))
+    // {
+      // ENCODE(tdc[channel],(value=value,overflow=overflow,pileup=pileup));
+    // }
+    // if((ch_kind == 2))
+    // {
+      // ENCODE(trig_tdc[channel],(value=value,overflow=overflow,pileup=pileup));
+    // }
+    // if((ch_kind == 3))
+    // {
+      // ENCODE(adc_short[channel],(value=value,overflow=overflow,pileup=pileup));
+    // }
+  // }
+  // several UINT32 fill_word NOENCODE
+  // {
+    //  0_31: 0;
+  // }
+  // UINT32 end_of_event
+  // {
+    //  0_29: counter;
+    // 30_31: 3;
+  // }
+  // MARK_COUNT(end);
+  void *__mark_end = __buffer._offset;
+  // CHECK_COUNT(header.word_number,start,end,( - 4),4)
+}
+FORCE_IMPL_DATA_SRC_FCN_ARG(void,VME_MESYTEC_MDPP16::__packer,uint32 geom);
+
+/** END_PACKER ********************************************************/
+/** BEGIN_PACKER *******************************************************
+ *
+ * Event packer for IS446_VME.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// SUBEVENT(IS446_VME)
+template<typename __data_dest_t>
+void PACKER_IS446_VME::__packer(__data_dest_t &__buffer)
+{
+  // UINT32 dummy_header NOENCODE
+  // {
+    //  0_31: 0xfefefefe;
+  // }
+  // select several
+
+    // norevisit scaler[0] = VME_CAEN_V830(geom=31);
+    // norevisit adc[0] = VME_CAEN_V775(geom=31,crate=1);
+    // norevisit adc[1] = VME_CAEN_V775(geom=31,crate=2);
+    // norevisit adc[2] = VME_CAEN_V775(geom=31,crate=3);
+    // norevisit adc[3] = VME_CAEN_V775(geom=31,crate=4);
+    // norevisit adc[4] = VME_CAEN_V775(geom=31,crate=5);
+    // norevisit adc[5] = VME_CAEN_V775(geom=31,crate=6);
+    // norevisit adc[6] = VME_CAEN_V775(geom=31,crate=7);
+    // norevisit tdc[0] = VME_CAEN_V775(geom=31,crate=8);
+    // norevisit tdc[1] = VME_CAEN_V775(geom=31,crate=9);
+    // norevisit tdc[2] = VME_CAEN_V775(geom=31,crate=10);
+    // norevisit tdc[3] = VME_CAEN_V775(geom=31,crate=11);
+    // norevisit tdc[4] = VME_CAEN_V775(geom=31,crate=12);
+  {
+    PACK_DECL(729,VME_CAEN_V830,scaler[0],/*geom*/31);
+    PACK_DECL(731,VME_CAEN_V775,adc[0],/*geom*/31,/*crate*/1);
+    PACK_DECL(732,VME_CAEN_V775,adc[1],/*geom*/31,/*crate*/2);
+    PACK_DECL(733,VME_CAEN_V775,adc[2],/*geom*/31,/*crate*/3);
+    PACK_DECL(734,VME_CAEN_V775,adc[3],/*geom*/31,/*crate*/4);
+    PACK_DECL(735,VME_CAEN_V775,adc[4],/*geom*/31,/*crate*/5);
+    PACK_DECL(736,VME_CAEN_V775,adc[5],/*geom*/31,/*crate*/6);
+    PACK_DECL(737,VME_CAEN_V775,adc[6],/*geom*/31,/*crate*/7);
+    PACK_DECL(739,VME_CAEN_V775,tdc[0],/*geom*/31,/*crate*/8);
+    PACK_DECL(740,VME_CAEN_V775,tdc[1],/*geom*/31,/*crate*/9);
+    PACK_DECL(741,VME_CAEN_V775,tdc[2],/*geom*/31,/*crate*/10);
+    PACK_DECL(742,VME_CAEN_V775,tdc[3],/*geom*/31,/*crate*/11);
+    PACK_DECL(743,VME_CAEN_V775,tdc[4],/*geom*/31,/*crate*/12);
+  }
+  // UINT32 dummy_footer NOENCODE
+  // {
+    //  0_31: 0xefefefef;
+  // }
+  // UINT32 garbage_footer NOENCODE
+  // {
+    //  0_31: garbage;
+  // }
+}
+FORCE_IMPL_DATA_SRC_FCN(void,IS446_VME::__packer);
+
+/** END_PACKER ********************************************************/
+/** BEGIN_PACKER *******************************************************
+ *
+ * Event packer for IS446_VME2.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// SUBEVENT(IS446_VME2)
+template<typename __data_dest_t>
+void PACKER_IS446_VME2::__packer(__data_dest_t &__buffer)
+{
+}
+FORCE_IMPL_DATA_SRC_FCN(void,IS446_VME2::__packer);
+
+/** END_PACKER ********************************************************/
+/** BEGIN_PACKER *******************************************************
+ *
+ * Event packer for EVENT.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// EVENT
+  // vme = IS446_VME(type=10,subtype=1,subcrate=0);
+  // vme2 = IS446_VME2(type=10,subtype=1,subcrate=1);
+{
+}
+
+/** END_PACKER ********************************************************/
+/** BEGIN_PACKER *******************************************************
+ *
+ * Event packer for EVENT.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// STICKY_EVENT
+{
+}
+
+/** END_PACKER ********************************************************/
@@ -0,0 +1,219 @@
+/** BEGIN_FUNCTION_CALL_PER_MEMBER *************************************
+ *
+ * Recursive function calls per member.
+ *
+ * Do not edit - automatically generated.
+ */
+
+#include "gen/default_fcncall_define.hh"
+
+#ifndef USER_DEF_raw_event_BACK
+FCNCALL_TEMPLATE
+FCNCALL_RET_TYPE FCNCALL_CLASS_NAME(raw_event_BACK)::FCNCALL_NAME(raw_event_BACK)
+{
+  FCNCALL_INIT;
+  // DATA12 E;
+  {
+  FCNCALL_SUBNAME("E");
+  { FCNCALL_CALL_CTRL_WRAP(E,E.FCNCALL_CALL(E)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // DATA12 T;
+  {
+  FCNCALL_SUBNAME("T");
+  { FCNCALL_CALL_CTRL_WRAP(T,T.FCNCALL_CALL(T)); }
+  FCNCALL_SUBNAME_END;
+  }
+  FCNCALL_RET;
+}
+#endif//USER_DEF_raw_event_BACK
+
+#ifndef USER_DEF_raw_event_MON
+FCNCALL_TEMPLATE
+FCNCALL_RET_TYPE FCNCALL_CLASS_NAME(raw_event_MON)::FCNCALL_NAME(raw_event_MON)
+{
+  FCNCALL_INIT;
+  // DATA12 E;
+  {
+  FCNCALL_SUBNAME("E");
+  { FCNCALL_CALL_CTRL_WRAP(E,E.FCNCALL_CALL(E)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // DATA12 T;
+  {
+  FCNCALL_SUBNAME("T");
+  { FCNCALL_CALL_CTRL_WRAP(T,T.FCNCALL_CALL(T)); }
+  FCNCALL_SUBNAME_END;
+  }
+  FCNCALL_RET;
+}
+#endif//USER_DEF_raw_event_MON
+
+#ifndef USER_DEF_raw_event_D_F
+FCNCALL_TEMPLATE
+FCNCALL_RET_TYPE FCNCALL_CLASS_NAME(raw_event_D_F)::FCNCALL_NAME(raw_event_D_F)
+{
+  FCNCALL_INIT;
+  // DATA12 E;
+  {
+  FCNCALL_SUBNAME("E");
+  { FCNCALL_CALL_CTRL_WRAP(E,E.FCNCALL_CALL(E)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // DATA12 T;
+  {
+  FCNCALL_SUBNAME("T");
+  { FCNCALL_CALL_CTRL_WRAP(T,T.FCNCALL_CALL(T)); }
+  FCNCALL_SUBNAME_END;
+  }
+  FCNCALL_RET;
+}
+#endif//USER_DEF_raw_event_D_F
+
+#ifndef USER_DEF_raw_event_D_B
+FCNCALL_TEMPLATE
+FCNCALL_RET_TYPE FCNCALL_CLASS_NAME(raw_event_D_B)::FCNCALL_NAME(raw_event_D_B)
+{
+  FCNCALL_INIT;
+  // DATA12 E;
+  {
+  FCNCALL_SUBNAME("E");
+  { FCNCALL_CALL_CTRL_WRAP(E,E.FCNCALL_CALL(E)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // DATA12 T;
+  {
+  FCNCALL_SUBNAME("T");
+  { FCNCALL_CALL_CTRL_WRAP(T,T.FCNCALL_CALL(T)); }
+  FCNCALL_SUBNAME_END;
+  }
+  FCNCALL_RET;
+}
+#endif//USER_DEF_raw_event_D_B
+
+#ifndef USER_DEF_raw_event_D
+FCNCALL_TEMPLATE
+FCNCALL_RET_TYPE FCNCALL_CLASS_NAME(raw_event_D)::FCNCALL_NAME(raw_event_D)
+{
+  FCNCALL_INIT;
+  // raw_array_zero_suppress<raw_event_D_F,raw_event_D_F,32> F;
+  {
+  FCNCALL_SUBNAME("F");
+  { FCNCALL_CALL_CTRL_WRAP(F,F.FCNCALL_CALL(F)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // raw_array_zero_suppress<raw_event_D_B,raw_event_D_B,32> B;
+  {
+  FCNCALL_SUBNAME("B");
+  { FCNCALL_CALL_CTRL_WRAP(B,B.FCNCALL_CALL(B)); }
+  FCNCALL_SUBNAME_END;
+  }
+  FCNCALL_RET;
+}
+#endif//USER_DEF_raw_event_D
+
+#ifndef USER_DEF_raw_event
+FCNCALL_TEMPLATE
+FCNCALL_RET_TYPE FCNCALL_CLASS_NAME(raw_event)::FCNCALL_NAME(raw_event)
+{
+  FCNCALL_INIT;
+  FCNCALL_CALL_CTRL_WRAP(raw_event_base,FCNCALL_CLASS_NAME(raw_event_base)::FCNCALL_CALL_BASE());
+  // DATA32 TEBIS;
+  {
+  FCNCALL_SUBNAME("TEBIS");
+  { FCNCALL_CALL_CTRL_WRAP(TEBIS,TEBIS.FCNCALL_CALL(TEBIS)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // DATA32 TSHORT;
+  {
+  FCNCALL_SUBNAME("TSHORT");
+  { FCNCALL_CALL_CTRL_WRAP(TSHORT,TSHORT.FCNCALL_CALL(TSHORT)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // DATA32 OLDTEBIS;
+  {
+  FCNCALL_SUBNAME("OLDTEBIS");
+  { FCNCALL_CALL_CTRL_WRAP(OLDTEBIS,OLDTEBIS.FCNCALL_CALL(OLDTEBIS)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // DATA32 OLDTSHORT;
+  {
+  FCNCALL_SUBNAME("OLDTSHORT");
+  { FCNCALL_CALL_CTRL_WRAP(OLDTSHORT,OLDTSHORT.FCNCALL_CALL(OLDTSHORT)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // DATA32 EBIS;
+  {
+  FCNCALL_SUBNAME("EBIS");
+  { FCNCALL_CALL_CTRL_WRAP(EBIS,EBIS.FCNCALL_CALL(EBIS)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // DATA32 NACCEPT;
+  {
+  FCNCALL_SUBNAME("NACCEPT");
+  { FCNCALL_CALL_CTRL_WRAP(NACCEPT,NACCEPT.FCNCALL_CALL(NACCEPT)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // raw_event_BACK BACK[2];
+  {
+  FCNCALL_SUBNAME("BACK");
+  FCNCALL_FOR(__i0,2)
+  {
+    FCNCALL_SUBINDEX(__i0);
+    { FCNCALL_CALL_CTRL_WRAP_ARRAY(BACK__i0,,__i0,BACK[__i0].FCNCALL_CALL(BACK[__i0])); }
+    FCNCALL_SUBINDEX_END(__i0);
+  }
+  FCNCALL_SUBNAME_END;
+  }
+  // raw_event_MON MON[2];
+  {
+  FCNCALL_SUBNAME("MON");
+  FCNCALL_FOR(__i0,2)
+  {
+    FCNCALL_SUBINDEX(__i0);
+    { FCNCALL_CALL_CTRL_WRAP_ARRAY(MON__i0,,__i0,MON[__i0].FCNCALL_CALL(MON[__i0])); }
+    FCNCALL_SUBINDEX_END(__i0);
+  }
+  FCNCALL_SUBNAME_END;
+  }
+  // raw_event_D D[3];
+  {
+  FCNCALL_SUBNAME("D");
+  FCNCALL_FOR(__i0,3)
+  {
+    FCNCALL_SUBINDEX(__i0);
+    { FCNCALL_CALL_CTRL_WRAP_ARRAY(D__i0,,__i0,D[__i0].FCNCALL_CALL(D[__i0])); }
+    FCNCALL_SUBINDEX_END(__i0);
+  }
+  FCNCALL_SUBNAME_END;
+  }
+  // DATA32 TLAST;
+  {
+  FCNCALL_SUBNAME("TLAST");
+  { FCNCALL_CALL_CTRL_WRAP(TLAST,TLAST.FCNCALL_CALL(TLAST)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // DATA32 TLONG;
+  {
+  FCNCALL_SUBNAME("TLONG");
+  { FCNCALL_CALL_CTRL_WRAP(TLONG,TLONG.FCNCALL_CALL(TLONG)); }
+  FCNCALL_SUBNAME_END;
+  }
+  FCNCALL_RET;
+}
+#endif//USER_DEF_raw_event
+
+#ifndef USER_DEF_raw_sticky
+FCNCALL_TEMPLATE
+FCNCALL_RET_TYPE FCNCALL_CLASS_NAME(raw_sticky)::FCNCALL_NAME(raw_sticky)
+{
+  FCNCALL_INIT;
+  FCNCALL_CALL_CTRL_WRAP(raw_sticky_base,FCNCALL_CLASS_NAME(raw_sticky_base)::FCNCALL_CALL_BASE());
+  FCNCALL_RET;
+}
+#endif//USER_DEF_raw_sticky
+
+#include "gen/default_fcncall_undef.hh"
+
+
+/** END_FUNCTION_CALL_PER_MEMBER **************************************/
@@ -0,0 +1,154 @@
+/** BEGIN_EVENT_RAW_STRUCTURE ******************************************
+ *
+ * Event data structure.
+ *
+ * Do not edit - automatically generated.
+ */
+
+//DUMPY: 2 0
+class raw_event_BACK
+{
+public:
+  DATA12 E;
+  DATA12 T;
+
+public:
+#ifndef __PSDC__
+  STRUCT_FCNS_DECL(raw_event_BACK);
+#endif//!__PSDC__
+} ;
+
+//DUMPY: 2 0
+class raw_event_MON
+{
+public:
+  DATA12 E;
+  DATA12 T;
+
+public:
+#ifndef __PSDC__
+  STRUCT_FCNS_DECL(raw_event_MON);
+#endif//!__PSDC__
+} ;
+
+//DUMPY: 32 1
+class raw_event_D_F
+{
+public:
+  DATA12 E;
+  DATA12 T;
+
+public:
+#ifndef __PSDC__
+  STRUCT_FCNS_DECL(raw_event_D_F);
+#endif//!__PSDC__
+} ;
+
+//DUMPY: 32 1
+class raw_event_D_B
+{
+public:
+  DATA12 E;
+  DATA12 T;
+
+public:
+#ifndef __PSDC__
+  STRUCT_FCNS_DECL(raw_event_D_B);
+#endif//!__PSDC__
+} ;
+
+//DUMPY: 3 0
+class raw_event_D
+{
+public:
+//DUMPY: 32 1
+  raw_array_zero_suppress<raw_event_D_F,raw_event_D_F,32>
+  /* {
+  public:
+    DATA12 E;
+    DATA12 T;
+  } */ F;
+//DUMPY: 32 1
+  raw_array_zero_suppress<raw_event_D_B,raw_event_D_B,32>
+  /* {
+  public:
+    DATA12 E;
+    DATA12 T;
+  } */ B;
+
+public:
+#ifndef __PSDC__
+  STRUCT_FCNS_DECL(raw_event_D);
+#endif//!__PSDC__
+} ;
+
+class raw_event : public raw_event_base
+{
+public:
+  DATA32 TEBIS;
+  DATA32 TSHORT;
+  DATA32 OLDTEBIS;
+  DATA32 OLDTSHORT;
+  DATA32 EBIS;
+  DATA32 NACCEPT;
+//DUMPY: 2 0
+  raw_event_BACK
+  /* {
+  public:
+    DATA12 E;
+    DATA12 T;
+  } */ BACK[2];
+//DUMPY: 2 0
+  raw_event_MON
+  /* {
+  public:
+    DATA12 E;
+    DATA12 T;
+  } */ MON[2];
+//DUMPY: 3 0
+  raw_event_D
+  /* {
+  public:
+//DUMPY: 32 1
+    raw_array_zero_suppress<raw_event_D_F,raw_event_D_F,32>
+    {
+    public:
+      DATA12 E;
+      DATA12 T;
+    } F;
+//DUMPY: 32 1
+    raw_array_zero_suppress<raw_event_D_B,raw_event_D_B,32>
+    {
+    public:
+      DATA12 E;
+      DATA12 T;
+    } B;
+  } */ D[3];
+  DATA32 TLAST;
+  DATA32 TLONG;
+
+public:
+#ifndef __PSDC__
+  STRUCT_FCNS_DECL(raw_event);
+#endif//!__PSDC__
+} ;
+
+/** END_EVENT_RAW_STRUCTURE *******************************************/
+/** BEGIN_EVENT_RAW_STRUCTURE ******************************************
+ *
+ * Event data structure.
+ *
+ * Do not edit - automatically generated.
+ */
+
+class raw_sticky : public raw_sticky_base
+{
+public:
+
+public:
+#ifndef __PSDC__
+  STRUCT_FCNS_DECL(raw_sticky);
+#endif//!__PSDC__
+} ;
+
+/** END_EVENT_RAW_STRUCTURE *******************************************/
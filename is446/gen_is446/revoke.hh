@@ -0,0 +1,58 @@
+/** BEGIN_REVOKE *******************************************************
+ *
+ * Event revoker for EVENT.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// EVENT
+int unpack_event::__revoke_subevent(subevent_header *__header)
+  // vme = IS446_VME(type=10,subtype=1,subcrate=0);
+  // vme2 = IS446_VME2(type=10,subtype=1,subcrate=1);
+{
+  int __match_no = 0;
+  SUBEVENT_MATCH_CACHE_LOOKUP(__match_no)
+  {
+    MATCH_SUBEVENT_DECL(769,__match_no,1,((VES10_1_type==10)&&(VES10_1_subtype==1)&&(VES10_1_subcrate==0)),vme);
+    MATCH_SUBEVENT_DECL(770,__match_no,2,((VES10_1_type==10)&&(VES10_1_subtype==1)&&(VES10_1_subcrate==1)),vme2);
+    SUBEVENT_MATCH_CACHE_STORE(__match_no);
+  }
+  if (!__match_no) return 0;
+  switch (__match_no)
+  {
+    case 1:
+      UNPACK_SUBEVENT_CHECK_NO_REVISIT(769,IS446_VME,vme,0);
+      REVOKE_SUBEVENT_DECL(769,0,IS446_VME,vme);
+      break;
+    case 2:
+      UNPACK_SUBEVENT_CHECK_NO_REVISIT(770,IS446_VME2,vme2,1);
+      REVOKE_SUBEVENT_DECL(770,0,IS446_VME2,vme2);
+      break;
+  }
+  return 0;
+}
+
+/** END_REVOKE ********************************************************/
+/** BEGIN_REVOKE *******************************************************
+ *
+ * Event revoker for EVENT.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// STICKY_EVENT
+int unpack_sticky_event::__revoke_subevent(subevent_header *__header)
+{
+  int __match_no = 0;
+  SUBEVENT_MATCH_CACHE_LOOKUP(__match_no)
+  {
+    SUBEVENT_MATCH_CACHE_STORE(__match_no);
+  }
+  if (!__match_no) return 0;
+  switch (__match_no)
+  {
+  }
+  return 0;
+}
+
+/** END_REVOKE ********************************************************/
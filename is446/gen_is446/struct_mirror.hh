@@ -0,0 +1,897 @@
+/** BEGIN_MIRROR_STRUCT ************************************************
+ *
+ * Mirror (1 to 1) structure.
+ *
+ * Do not edit - automatically generated.
+ */
+
+#include "gen/default_mirror_define.hh"
+
+#ifndef USER_DEF_CAMAC_LECROY_4434
+STRUCT_MIRROR_TEMPLATE
+class STRUCT_MIRROR_STRUCT(CAMAC_LECROY_4434)
+{
+public:
+  STRUCT_MIRROR_ITEM_CTRL(data);
+  STRUCT_MIRROR_TYPE(raw_array_zero_suppress) < STRUCT_MIRROR_TYPE_TEMPLATE STRUCT_MIRROR_TEMPLATE_ARG(DATA24),STRUCT_MIRROR_TEMPLATE_ARG(DATA24),32> STRUCT_MIRROR_NAME(data);
+  STRUCT_MIRROR_FCNS_DECL(CAMAC_LECROY_4434);
+};
+#endif//USER_DEF_CAMAC_LECROY_4434
+
+#ifndef USER_DEF_CAMAC_PHILLIPS_7164
+STRUCT_MIRROR_TEMPLATE
+class STRUCT_MIRROR_STRUCT(CAMAC_PHILLIPS_7164)
+{
+public:
+  STRUCT_MIRROR_ITEM_CTRL(data);
+  STRUCT_MIRROR_TYPE(raw_array_zero_suppress) < STRUCT_MIRROR_TYPE_TEMPLATE STRUCT_MIRROR_TEMPLATE_ARG(DATA12),STRUCT_MIRROR_TEMPLATE_ARG(DATA12),16> STRUCT_MIRROR_NAME(data);
+  STRUCT_MIRROR_FCNS_DECL(CAMAC_PHILLIPS_7164);
+};
+#endif//USER_DEF_CAMAC_PHILLIPS_7164
+
+#ifndef USER_DEF_CAMAC_SILENA_4418
+STRUCT_MIRROR_TEMPLATE
+class STRUCT_MIRROR_STRUCT(CAMAC_SILENA_4418)
+{
+public:
+  STRUCT_MIRROR_ITEM_CTRL(data);
+  STRUCT_MIRROR_TYPE(raw_array_zero_suppress) < STRUCT_MIRROR_TYPE_TEMPLATE STRUCT_MIRROR_TEMPLATE_ARG(DATA12_OVERFLOW),STRUCT_MIRROR_TEMPLATE_ARG(DATA12_OVERFLOW),8> STRUCT_MIRROR_NAME(data);
+  STRUCT_MIRROR_FCNS_DECL(CAMAC_SILENA_4418);
+};
+#endif//USER_DEF_CAMAC_SILENA_4418
+
+#ifndef USER_DEF_FASTBUS_LECROY_1875
+STRUCT_MIRROR_TEMPLATE
+class STRUCT_MIRROR_STRUCT(FASTBUS_LECROY_1875)
+{
+public:
+  STRUCT_MIRROR_ITEM_CTRL(data);
+  STRUCT_MIRROR_TYPE(raw_array_zero_suppress) < STRUCT_MIRROR_TYPE_TEMPLATE STRUCT_MIRROR_TEMPLATE_ARG(DATA12_RANGE),STRUCT_MIRROR_TEMPLATE_ARG(DATA12_RANGE),64> STRUCT_MIRROR_NAME(data);
+  STRUCT_MIRROR_FCNS_DECL(FASTBUS_LECROY_1875);
+};
+#endif//USER_DEF_FASTBUS_LECROY_1875
+
+#ifndef USER_DEF_FASTBUS_LECROY_1885
+STRUCT_MIRROR_TEMPLATE
+class STRUCT_MIRROR_STRUCT(FASTBUS_LECROY_1885)
+{
+public:
+  STRUCT_MIRROR_ITEM_CTRL(data);
+  STRUCT_MIRROR_TYPE(raw_array_zero_suppress) < STRUCT_MIRROR_TYPE_TEMPLATE STRUCT_MIRROR_TEMPLATE_ARG(DATA12_RANGE),STRUCT_MIRROR_TEMPLATE_ARG(DATA12_RANGE),96> STRUCT_MIRROR_NAME(data);
+  STRUCT_MIRROR_FCNS_DECL(FASTBUS_LECROY_1885);
+};
+#endif//USER_DEF_FASTBUS_LECROY_1885
+
+#ifndef USER_DEF_VME_CAEN_V1190_SUBTDC
+STRUCT_MIRROR_TEMPLATE
+class STRUCT_MIRROR_STRUCT(VME_CAEN_V1190_SUBTDC)
+{
+public:
+#if STRUCT_ONLY_LAST_UNION_MEMBER
+  struct 
+#else
+  union 
+#endif
+
+  {
+  public:
+#if !STRUCT_ONLY_LAST_UNION_MEMBER
+    struct 
+    {
+    public:
+      STRUCT_MIRROR_ITEM_CTRL(bunch_id);
+      STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(bunch_id);
+      STRUCT_MIRROR_ITEM_CTRL(event_id);
+      STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(event_id);
+      STRUCT_MIRROR_ITEM_CTRL(tdc);
+      STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(tdc);
+      STRUCT_MIRROR_ITEM_CTRL(dummy_26);
+      STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(dummy_26);
+      STRUCT_MIRROR_ITEM_CTRL(unnamed_27_31);
+      STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(unnamed_27_31);
+    };
+#endif// !STRUCT_ONLY_LAST_UNION_MEMBER
+    STRUCT_MIRROR_ITEM_CTRL(u32);
+    STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(u32);
+  } STRUCT_MIRROR_NAME(header);
+#if STRUCT_ONLY_LAST_UNION_MEMBER
+  struct 
+#else
+  union 
+#endif
+
+  {
+  public:
+#if !STRUCT_ONLY_LAST_UNION_MEMBER
+    struct 
+    {
+    public:
+      STRUCT_MIRROR_ITEM_CTRL(flags);
+      STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(flags);
+      STRUCT_MIRROR_ITEM_CTRL(dummy_15_23);
+      STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(dummy_15_23);
+      STRUCT_MIRROR_ITEM_CTRL(tdc);
+      STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(tdc);
+      STRUCT_MIRROR_ITEM_CTRL(dummy_26);
+      STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(dummy_26);
+      STRUCT_MIRROR_ITEM_CTRL(unnamed_27_31);
+      STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(unnamed_27_31);
+    };
+#endif// !STRUCT_ONLY_LAST_UNION_MEMBER
+    STRUCT_MIRROR_ITEM_CTRL(u32);
+    STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(u32);
+  } STRUCT_MIRROR_NAME(error_flags);
+#if STRUCT_ONLY_LAST_UNION_MEMBER
+  struct 
+#else
+  union 
+#endif
+
+  {
+  public:
+#if !STRUCT_ONLY_LAST_UNION_MEMBER
+    struct 
+    {
+    public:
+      STRUCT_MIRROR_ITEM_CTRL(word_count);
+      STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(word_count);
+      STRUCT_MIRROR_ITEM_CTRL(event_id);
+      STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(event_id);
+      STRUCT_MIRROR_ITEM_CTRL(tdc);
+      STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(tdc);
+      STRUCT_MIRROR_ITEM_CTRL(dummy_26);
+      STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(dummy_26);
+      STRUCT_MIRROR_ITEM_CTRL(unnamed_27_31);
+      STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(unnamed_27_31);
+    };
+#endif// !STRUCT_ONLY_LAST_UNION_MEMBER
+    STRUCT_MIRROR_ITEM_CTRL(u32);
+    STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(u32);
+  } STRUCT_MIRROR_NAME(trailer);
+  STRUCT_MIRROR_FCNS_DECL(VME_CAEN_V1190_SUBTDC);
+};
+#endif//USER_DEF_VME_CAEN_V1190_SUBTDC
+
+#ifndef USER_DEF_VME_CAEN_V1190
+STRUCT_MIRROR_TEMPLATE
+class STRUCT_MIRROR_STRUCT(VME_CAEN_V1190)
+{
+public:
+  STRUCT_MIRROR_ITEM_CTRL(data);
+  STRUCT_MIRROR_TYPE(raw_array_multi_zero_suppress) < STRUCT_MIRROR_TYPE_TEMPLATE STRUCT_MIRROR_TEMPLATE_ARG(DATA24),STRUCT_MIRROR_TEMPLATE_ARG(DATA24),32,128> STRUCT_MIRROR_NAME(data);
+#if STRUCT_ONLY_LAST_UNION_MEMBER
+  struct 
+#else
+  union 
+#endif
+
+  {
+  public:
+#if !STRUCT_ONLY_LAST_UNION_MEMBER
+    struct 
+    {
+    public:
+      STRUCT_MIRROR_ITEM_CTRL(geom);
+      STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(geom);
+      STRUCT_MIRROR_ITEM_CTRL(event_number);
+      STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(event_number);
+      STRUCT_MIRROR_ITEM_CTRL(unnamed_27_31);
+      STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(unnamed_27_31);
+    };
+#endif// !STRUCT_ONLY_LAST_UNION_MEMBER
+    STRUCT_MIRROR_ITEM_CTRL(u32);
+    STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(u32);
+  } STRUCT_MIRROR_NAME(header);
+  STRUCT_MIRROR_ITEM_CTRL(tdc);
+  STRUCT_MIRROR_ITEM_CTRL_ARRAY(tdc__i0,,4);
+  STRUCT_MIRROR_TYPE(VME_CAEN_V1190_SUBTDC) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(tdc[4]);
+#if STRUCT_ONLY_LAST_UNION_MEMBER
+  struct 
+#else
+  union 
+#endif
+
+  {
+  public:
+#if !STRUCT_ONLY_LAST_UNION_MEMBER
+    struct 
+    {
+    public:
+      STRUCT_MIRROR_ITEM_CTRL(time_tag);
+      STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(time_tag);
+      STRUCT_MIRROR_ITEM_CTRL(unnamed_27_31);
+      STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(unnamed_27_31);
+    };
+#endif// !STRUCT_ONLY_LAST_UNION_MEMBER
+    STRUCT_MIRROR_ITEM_CTRL(u32);
+    STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(u32);
+  } STRUCT_MIRROR_NAME(trigger);
+#if STRUCT_ONLY_LAST_UNION_MEMBER
+  struct 
+#else
+  union 
+#endif
+
+  {
+  public:
+#if !STRUCT_ONLY_LAST_UNION_MEMBER
+    struct 
+    {
+    public:
+      STRUCT_MIRROR_ITEM_CTRL(geom);
+      STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(geom);
+      STRUCT_MIRROR_ITEM_CTRL(word_count);
+      STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(word_count);
+      STRUCT_MIRROR_ITEM_CTRL(dummy_20_23);
+      STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(dummy_20_23);
+      STRUCT_MIRROR_ITEM_CTRL(tdc_error);
+      STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(tdc_error);
+      STRUCT_MIRROR_ITEM_CTRL(buffer_overflow);
+      STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(buffer_overflow);
+      STRUCT_MIRROR_ITEM_CTRL(trigger_lost);
+      STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(trigger_lost);
+      STRUCT_MIRROR_ITEM_CTRL(unnamed_27_31);
+      STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(unnamed_27_31);
+    };
+#endif// !STRUCT_ONLY_LAST_UNION_MEMBER
+    STRUCT_MIRROR_ITEM_CTRL(u32);
+    STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(u32);
+  } STRUCT_MIRROR_NAME(trailer);
+  STRUCT_MIRROR_FCNS_DECL(VME_CAEN_V1190);
+};
+#endif//USER_DEF_VME_CAEN_V1190
+
+#ifndef USER_DEF_VME_CAEN_V1190_SHORT_SUBTDC
+STRUCT_MIRROR_TEMPLATE
+class STRUCT_MIRROR_STRUCT(VME_CAEN_V1190_SHORT_SUBTDC)
+{
+public:
+  STRUCT_MIRROR_FCNS_DECL(VME_CAEN_V1190_SHORT_SUBTDC);
+};
+#endif//USER_DEF_VME_CAEN_V1190_SHORT_SUBTDC
+
+#ifndef USER_DEF_VME_CAEN_V1190_SHORT_SUBTDC_ERROR
+STRUCT_MIRROR_TEMPLATE
+class STRUCT_MIRROR_STRUCT(VME_CAEN_V1190_SHORT_SUBTDC_ERROR)
+{
+public:
+#if STRUCT_ONLY_LAST_UNION_MEMBER
+  struct 
+#else
+  union 
+#endif
+
+  {
+  public:
+#if !STRUCT_ONLY_LAST_UNION_MEMBER
+    struct 
+    {
+    public:
+      STRUCT_MIRROR_ITEM_CTRL(flags);
+      STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(flags);
+      STRUCT_MIRROR_ITEM_CTRL(dummy_15_23);
+      STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(dummy_15_23);
+      STRUCT_MIRROR_ITEM_CTRL(tdc);
+      STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(tdc);
+      STRUCT_MIRROR_ITEM_CTRL(dummy_26);
+      STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(dummy_26);
+      STRUCT_MIRROR_ITEM_CTRL(unnamed_27_31);
+      STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(unnamed_27_31);
+    };
+#endif// !STRUCT_ONLY_LAST_UNION_MEMBER
+    STRUCT_MIRROR_ITEM_CTRL(u32);
+    STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(u32);
+  } STRUCT_MIRROR_NAME(error_flags);
+  STRUCT_MIRROR_FCNS_DECL(VME_CAEN_V1190_SHORT_SUBTDC_ERROR);
+};
+#endif//USER_DEF_VME_CAEN_V1190_SHORT_SUBTDC_ERROR
+
+#ifndef USER_DEF_VME_CAEN_V1190_SHORT
+STRUCT_MIRROR_TEMPLATE
+class STRUCT_MIRROR_STRUCT(VME_CAEN_V1190_SHORT)
+{
+public:
+  STRUCT_MIRROR_ITEM_CTRL(data);
+  STRUCT_MIRROR_TYPE(raw_array_multi_zero_suppress) < STRUCT_MIRROR_TYPE_TEMPLATE STRUCT_MIRROR_TEMPLATE_ARG(DATA24),STRUCT_MIRROR_TEMPLATE_ARG(DATA24),32,128> STRUCT_MIRROR_NAME(data);
+#if STRUCT_ONLY_LAST_UNION_MEMBER
+  struct 
+#else
+  union 
+#endif
+
+  {
+  public:
+#if !STRUCT_ONLY_LAST_UNION_MEMBER
+    struct 
+    {
+    public:
+      STRUCT_MIRROR_ITEM_CTRL(geom);
+      STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(geom);
+      STRUCT_MIRROR_ITEM_CTRL(event_number);
+      STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(event_number);
+      STRUCT_MIRROR_ITEM_CTRL(unnamed_27_31);
+      STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(unnamed_27_31);
+    };
+#endif// !STRUCT_ONLY_LAST_UNION_MEMBER
+    STRUCT_MIRROR_ITEM_CTRL(u32);
+    STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(u32);
+  } STRUCT_MIRROR_NAME(header);
+  STRUCT_MIRROR_ITEM_CTRL(tdc);
+  STRUCT_MIRROR_ITEM_CTRL_ARRAY(tdc__i0,,4);
+  STRUCT_MIRROR_TYPE(VME_CAEN_V1190_SHORT_SUBTDC) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(tdc[4]);
+  STRUCT_MIRROR_ITEM_CTRL(err);
+  STRUCT_MIRROR_ITEM_CTRL_ARRAY(err__i0,,4);
+  STRUCT_MIRROR_TYPE(VME_CAEN_V1190_SHORT_SUBTDC_ERROR) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(err[4]);
+#if STRUCT_ONLY_LAST_UNION_MEMBER
+  struct 
+#else
+  union 
+#endif
+
+  {
+  public:
+#if !STRUCT_ONLY_LAST_UNION_MEMBER
+    struct 
+    {
+    public:
+      STRUCT_MIRROR_ITEM_CTRL(time_tag);
+      STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(time_tag);
+      STRUCT_MIRROR_ITEM_CTRL(unnamed_27_31);
+      STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(unnamed_27_31);
+    };
+#endif// !STRUCT_ONLY_LAST_UNION_MEMBER
+    STRUCT_MIRROR_ITEM_CTRL(u32);
+    STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(u32);
+  } STRUCT_MIRROR_NAME(trigger);
+#if STRUCT_ONLY_LAST_UNION_MEMBER
+  struct 
+#else
+  union 
+#endif
+
+  {
+  public:
+#if !STRUCT_ONLY_LAST_UNION_MEMBER
+    struct 
+    {
+    public:
+      STRUCT_MIRROR_ITEM_CTRL(geom);
+      STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(geom);
+      STRUCT_MIRROR_ITEM_CTRL(word_count);
+      STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(word_count);
+      STRUCT_MIRROR_ITEM_CTRL(dummy_20_23);
+      STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(dummy_20_23);
+      STRUCT_MIRROR_ITEM_CTRL(tdc_error);
+      STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(tdc_error);
+      STRUCT_MIRROR_ITEM_CTRL(buffer_overflow);
+      STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(buffer_overflow);
+      STRUCT_MIRROR_ITEM_CTRL(trigger_lost);
+      STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(trigger_lost);
+      STRUCT_MIRROR_ITEM_CTRL(unnamed_27_31);
+      STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(unnamed_27_31);
+    };
+#endif// !STRUCT_ONLY_LAST_UNION_MEMBER
+    STRUCT_MIRROR_ITEM_CTRL(u32);
+    STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(u32);
+  } STRUCT_MIRROR_NAME(trailer);
+  STRUCT_MIRROR_FCNS_DECL(VME_CAEN_V1190_SHORT);
+};
+#endif//USER_DEF_VME_CAEN_V1190_SHORT
+
+#ifndef USER_DEF_VME_CAEN_V1290_SUBTDC
+STRUCT_MIRROR_TEMPLATE
+class STRUCT_MIRROR_STRUCT(VME_CAEN_V1290_SUBTDC)
+{
+public:
+#if STRUCT_ONLY_LAST_UNION_MEMBER
+  struct 
+#else
+  union 
+#endif
+
+  {
+  public:
+#if !STRUCT_ONLY_LAST_UNION_MEMBER
+    struct 
+    {
+    public:
+      STRUCT_MIRROR_ITEM_CTRL(bunch_id);
+      STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(bunch_id);
+      STRUCT_MIRROR_ITEM_CTRL(event_id);
+      STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(event_id);
+      STRUCT_MIRROR_ITEM_CTRL(tdc);
+      STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(tdc);
+      STRUCT_MIRROR_ITEM_CTRL(dummy_26);
+      STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(dummy_26);
+      STRUCT_MIRROR_ITEM_CTRL(unnamed_27_31);
+      STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(unnamed_27_31);
+    };
+#endif// !STRUCT_ONLY_LAST_UNION_MEMBER
+    STRUCT_MIRROR_ITEM_CTRL(u32);
+    STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(u32);
+  } STRUCT_MIRROR_NAME(header);
+#if STRUCT_ONLY_LAST_UNION_MEMBER
+  struct 
+#else
+  union 
+#endif
+
+  {
+  public:
+#if !STRUCT_ONLY_LAST_UNION_MEMBER
+    struct 
+    {
+    public:
+      STRUCT_MIRROR_ITEM_CTRL(flags);
+      STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(flags);
+      STRUCT_MIRROR_ITEM_CTRL(dummy_15_23);
+      STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(dummy_15_23);
+      STRUCT_MIRROR_ITEM_CTRL(tdc);
+      STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(tdc);
+      STRUCT_MIRROR_ITEM_CTRL(dummy_26);
+      STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(dummy_26);
+      STRUCT_MIRROR_ITEM_CTRL(unnamed_27_31);
+      STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(unnamed_27_31);
+    };
+#endif// !STRUCT_ONLY_LAST_UNION_MEMBER
+    STRUCT_MIRROR_ITEM_CTRL(u32);
+    STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(u32);
+  } STRUCT_MIRROR_NAME(error_flags);
+#if STRUCT_ONLY_LAST_UNION_MEMBER
+  struct 
+#else
+  union 
+#endif
+
+  {
+  public:
+#if !STRUCT_ONLY_LAST_UNION_MEMBER
+    struct 
+    {
+    public:
+      STRUCT_MIRROR_ITEM_CTRL(word_count);
+      STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(word_count);
+      STRUCT_MIRROR_ITEM_CTRL(event_id);
+      STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(event_id);
+      STRUCT_MIRROR_ITEM_CTRL(tdc);
+      STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(tdc);
+      STRUCT_MIRROR_ITEM_CTRL(dummy_26);
+      STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(dummy_26);
+      STRUCT_MIRROR_ITEM_CTRL(unnamed_27_31);
+      STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(unnamed_27_31);
+    };
+#endif// !STRUCT_ONLY_LAST_UNION_MEMBER
+    STRUCT_MIRROR_ITEM_CTRL(u32);
+    STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(u32);
+  } STRUCT_MIRROR_NAME(trailer);
+  STRUCT_MIRROR_FCNS_DECL(VME_CAEN_V1290_SUBTDC);
+};
+#endif//USER_DEF_VME_CAEN_V1290_SUBTDC
+
+#ifndef USER_DEF_VME_CAEN_V1290
+STRUCT_MIRROR_TEMPLATE
+class STRUCT_MIRROR_STRUCT(VME_CAEN_V1290)
+{
+public:
+  STRUCT_MIRROR_ITEM_CTRL(data);
+  STRUCT_MIRROR_TYPE(raw_array_multi_zero_suppress) < STRUCT_MIRROR_TYPE_TEMPLATE STRUCT_MIRROR_TEMPLATE_ARG(DATA24),STRUCT_MIRROR_TEMPLATE_ARG(DATA24),32,128> STRUCT_MIRROR_NAME(data);
+#if STRUCT_ONLY_LAST_UNION_MEMBER
+  struct 
+#else
+  union 
+#endif
+
+  {
+  public:
+#if !STRUCT_ONLY_LAST_UNION_MEMBER
+    struct 
+    {
+    public:
+      STRUCT_MIRROR_ITEM_CTRL(geom);
+      STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(geom);
+      STRUCT_MIRROR_ITEM_CTRL(event_number);
+      STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(event_number);
+      STRUCT_MIRROR_ITEM_CTRL(unnamed_27_31);
+      STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(unnamed_27_31);
+    };
+#endif// !STRUCT_ONLY_LAST_UNION_MEMBER
+    STRUCT_MIRROR_ITEM_CTRL(u32);
+    STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(u32);
+  } STRUCT_MIRROR_NAME(header);
+  STRUCT_MIRROR_ITEM_CTRL(tdc);
+  STRUCT_MIRROR_ITEM_CTRL_ARRAY(tdc__i0,,4);
+  STRUCT_MIRROR_TYPE(VME_CAEN_V1290_SUBTDC) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(tdc[4]);
+#if STRUCT_ONLY_LAST_UNION_MEMBER
+  struct 
+#else
+  union 
+#endif
+
+  {
+  public:
+#if !STRUCT_ONLY_LAST_UNION_MEMBER
+    struct 
+    {
+    public:
+      STRUCT_MIRROR_ITEM_CTRL(time_tag);
+      STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(time_tag);
+      STRUCT_MIRROR_ITEM_CTRL(unnamed_27_31);
+      STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(unnamed_27_31);
+    };
+#endif// !STRUCT_ONLY_LAST_UNION_MEMBER
+    STRUCT_MIRROR_ITEM_CTRL(u32);
+    STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(u32);
+  } STRUCT_MIRROR_NAME(trigger);
+#if STRUCT_ONLY_LAST_UNION_MEMBER
+  struct 
+#else
+  union 
+#endif
+
+  {
+  public:
+#if !STRUCT_ONLY_LAST_UNION_MEMBER
+    struct 
+    {
+    public:
+      STRUCT_MIRROR_ITEM_CTRL(geom);
+      STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(geom);
+      STRUCT_MIRROR_ITEM_CTRL(word_count);
+      STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(word_count);
+      STRUCT_MIRROR_ITEM_CTRL(dummy_20_23);
+      STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(dummy_20_23);
+      STRUCT_MIRROR_ITEM_CTRL(tdc_error);
+      STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(tdc_error);
+      STRUCT_MIRROR_ITEM_CTRL(buffer_overflow);
+      STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(buffer_overflow);
+      STRUCT_MIRROR_ITEM_CTRL(trigger_lost);
+      STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(trigger_lost);
+      STRUCT_MIRROR_ITEM_CTRL(unnamed_27_31);
+      STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(unnamed_27_31);
+    };
+#endif// !STRUCT_ONLY_LAST_UNION_MEMBER
+    STRUCT_MIRROR_ITEM_CTRL(u32);
+    STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(u32);
+  } STRUCT_MIRROR_NAME(trailer);
+  STRUCT_MIRROR_FCNS_DECL(VME_CAEN_V1290);
+};
+#endif//USER_DEF_VME_CAEN_V1290
+
+#ifndef USER_DEF_VME_CAEN_V1290_SHORT_SUBTDC
+STRUCT_MIRROR_TEMPLATE
+class STRUCT_MIRROR_STRUCT(VME_CAEN_V1290_SHORT_SUBTDC)
+{
+public:
+  STRUCT_MIRROR_FCNS_DECL(VME_CAEN_V1290_SHORT_SUBTDC);
+};
+#endif//USER_DEF_VME_CAEN_V1290_SHORT_SUBTDC
+
+#ifndef USER_DEF_VME_CAEN_V1290_SHORT_SUBTDC_ERROR
+STRUCT_MIRROR_TEMPLATE
+class STRUCT_MIRROR_STRUCT(VME_CAEN_V1290_SHORT_SUBTDC_ERROR)
+{
+public:
+#if STRUCT_ONLY_LAST_UNION_MEMBER
+  struct 
+#else
+  union 
+#endif
+
+  {
+  public:
+#if !STRUCT_ONLY_LAST_UNION_MEMBER
+    struct 
+    {
+    public:
+      STRUCT_MIRROR_ITEM_CTRL(flags);
+      STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(flags);
+      STRUCT_MIRROR_ITEM_CTRL(dummy_15_23);
+      STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(dummy_15_23);
+      STRUCT_MIRROR_ITEM_CTRL(tdc);
+      STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(tdc);
+      STRUCT_MIRROR_ITEM_CTRL(dummy_26);
+      STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(dummy_26);
+      STRUCT_MIRROR_ITEM_CTRL(unnamed_27_31);
+      STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(unnamed_27_31);
+    };
+#endif// !STRUCT_ONLY_LAST_UNION_MEMBER
+    STRUCT_MIRROR_ITEM_CTRL(u32);
+    STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(u32);
+  } STRUCT_MIRROR_NAME(error_flags);
+  STRUCT_MIRROR_FCNS_DECL(VME_CAEN_V1290_SHORT_SUBTDC_ERROR);
+};
+#endif//USER_DEF_VME_CAEN_V1290_SHORT_SUBTDC_ERROR
+
+#ifndef USER_DEF_VME_CAEN_V1290_SHORT
+STRUCT_MIRROR_TEMPLATE
+class STRUCT_MIRROR_STRUCT(VME_CAEN_V1290_SHORT)
+{
+public:
+  STRUCT_MIRROR_ITEM_CTRL(data);
+  STRUCT_MIRROR_TYPE(raw_array_multi_zero_suppress) < STRUCT_MIRROR_TYPE_TEMPLATE STRUCT_MIRROR_TEMPLATE_ARG(DATA24),STRUCT_MIRROR_TEMPLATE_ARG(DATA24),32,128> STRUCT_MIRROR_NAME(data);
+#if STRUCT_ONLY_LAST_UNION_MEMBER
+  struct 
+#else
+  union 
+#endif
+
+  {
+  public:
+#if !STRUCT_ONLY_LAST_UNION_MEMBER
+    struct 
+    {
+    public:
+      STRUCT_MIRROR_ITEM_CTRL(geom);
+      STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(geom);
+      STRUCT_MIRROR_ITEM_CTRL(event_number);
+      STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(event_number);
+      STRUCT_MIRROR_ITEM_CTRL(unnamed_27_31);
+      STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(unnamed_27_31);
+    };
+#endif// !STRUCT_ONLY_LAST_UNION_MEMBER
+    STRUCT_MIRROR_ITEM_CTRL(u32);
+    STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(u32);
+  } STRUCT_MIRROR_NAME(header);
+  STRUCT_MIRROR_ITEM_CTRL(tdc);
+  STRUCT_MIRROR_ITEM_CTRL_ARRAY(tdc__i0,,4);
+  STRUCT_MIRROR_TYPE(VME_CAEN_V1290_SHORT_SUBTDC) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(tdc[4]);
+  STRUCT_MIRROR_ITEM_CTRL(err);
+  STRUCT_MIRROR_ITEM_CTRL_ARRAY(err__i0,,4);
+  STRUCT_MIRROR_TYPE(VME_CAEN_V1290_SHORT_SUBTDC_ERROR) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(err[4]);
+#if STRUCT_ONLY_LAST_UNION_MEMBER
+  struct 
+#else
+  union 
+#endif
+
+  {
+  public:
+#if !STRUCT_ONLY_LAST_UNION_MEMBER
+    struct 
+    {
+    public:
+      STRUCT_MIRROR_ITEM_CTRL(time_tag);
+      STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(time_tag);
+      STRUCT_MIRROR_ITEM_CTRL(unnamed_27_31);
+      STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(unnamed_27_31);
+    };
+#endif// !STRUCT_ONLY_LAST_UNION_MEMBER
+    STRUCT_MIRROR_ITEM_CTRL(u32);
+    STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(u32);
+  } STRUCT_MIRROR_NAME(trigger);
+#if STRUCT_ONLY_LAST_UNION_MEMBER
+  struct 
+#else
+  union 
+#endif
+
+  {
+  public:
+#if !STRUCT_ONLY_LAST_UNION_MEMBER
+    struct 
+    {
+    public:
+      STRUCT_MIRROR_ITEM_CTRL(geom);
+      STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(geom);
+      STRUCT_MIRROR_ITEM_CTRL(word_count);
+      STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(word_count);
+      STRUCT_MIRROR_ITEM_CTRL(dummy_20_23);
+      STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(dummy_20_23);
+      STRUCT_MIRROR_ITEM_CTRL(tdc_error);
+      STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(tdc_error);
+      STRUCT_MIRROR_ITEM_CTRL(buffer_overflow);
+      STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(buffer_overflow);
+      STRUCT_MIRROR_ITEM_CTRL(trigger_lost);
+      STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(trigger_lost);
+      STRUCT_MIRROR_ITEM_CTRL(unnamed_27_31);
+      STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(unnamed_27_31);
+    };
+#endif// !STRUCT_ONLY_LAST_UNION_MEMBER
+    STRUCT_MIRROR_ITEM_CTRL(u32);
+    STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(u32);
+  } STRUCT_MIRROR_NAME(trailer);
+  STRUCT_MIRROR_FCNS_DECL(VME_CAEN_V1290_SHORT);
+};
+#endif//USER_DEF_VME_CAEN_V1290_SHORT
+
+#ifndef USER_DEF_VME_CAEN_V775
+STRUCT_MIRROR_TEMPLATE
+class STRUCT_MIRROR_STRUCT(VME_CAEN_V775)
+{
+public:
+  STRUCT_MIRROR_ITEM_CTRL(data);
+  STRUCT_MIRROR_TYPE(raw_array_zero_suppress) < STRUCT_MIRROR_TYPE_TEMPLATE STRUCT_MIRROR_TEMPLATE_ARG(DATA12_OVERFLOW),STRUCT_MIRROR_TEMPLATE_ARG(DATA12_OVERFLOW),32> STRUCT_MIRROR_NAME(data);
+#if STRUCT_ONLY_LAST_UNION_MEMBER
+  struct 
+#else
+  union 
+#endif
+
+  {
+  public:
+#if !STRUCT_ONLY_LAST_UNION_MEMBER
+    struct 
+    {
+    public:
+      STRUCT_MIRROR_ITEM_CTRL(event_number);
+      STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(event_number);
+      STRUCT_MIRROR_ITEM_CTRL(unnamed_24_26);
+      STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(unnamed_24_26);
+      STRUCT_MIRROR_ITEM_CTRL(geom);
+      STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(geom);
+    };
+#endif// !STRUCT_ONLY_LAST_UNION_MEMBER
+    STRUCT_MIRROR_ITEM_CTRL(u32);
+    STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(u32);
+  } STRUCT_MIRROR_NAME(eob);
+  STRUCT_MIRROR_FCNS_DECL(VME_CAEN_V775);
+};
+#endif//USER_DEF_VME_CAEN_V775
+
+#ifndef USER_DEF_VME_CAEN_V830
+STRUCT_MIRROR_TEMPLATE
+class STRUCT_MIRROR_STRUCT(VME_CAEN_V830)
+{
+public:
+  STRUCT_MIRROR_ITEM_CTRL(data);
+  STRUCT_MIRROR_TYPE(raw_array_zero_suppress) < STRUCT_MIRROR_TYPE_TEMPLATE STRUCT_MIRROR_TEMPLATE_ARG(DATA32),STRUCT_MIRROR_TEMPLATE_ARG(DATA32),32> STRUCT_MIRROR_NAME(data);
+#if STRUCT_ONLY_LAST_UNION_MEMBER
+  struct 
+#else
+  union 
+#endif
+
+  {
+  public:
+#if !STRUCT_ONLY_LAST_UNION_MEMBER
+    struct 
+    {
+    public:
+      STRUCT_MIRROR_ITEM_CTRL(event_number);
+      STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(event_number);
+      STRUCT_MIRROR_ITEM_CTRL(ts);
+      STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(ts);
+      STRUCT_MIRROR_ITEM_CTRL(count);
+      STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(count);
+      STRUCT_MIRROR_ITEM_CTRL(undefined);
+      STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(undefined);
+      STRUCT_MIRROR_ITEM_CTRL(unnamed_26_26);
+      STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(unnamed_26_26);
+      STRUCT_MIRROR_ITEM_CTRL(geom);
+      STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(geom);
+    };
+#endif// !STRUCT_ONLY_LAST_UNION_MEMBER
+    STRUCT_MIRROR_ITEM_CTRL(u32);
+    STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(u32);
+  } STRUCT_MIRROR_NAME(header);
+  STRUCT_MIRROR_FCNS_DECL(VME_CAEN_V830);
+};
+#endif//USER_DEF_VME_CAEN_V830
+
+#ifndef USER_DEF_VME_MESYTEC_MADC32
+STRUCT_MIRROR_TEMPLATE
+class STRUCT_MIRROR_STRUCT(VME_MESYTEC_MADC32)
+{
+public:
+  STRUCT_MIRROR_ITEM_CTRL(data);
+  STRUCT_MIRROR_TYPE(raw_array_zero_suppress) < STRUCT_MIRROR_TYPE_TEMPLATE STRUCT_MIRROR_TEMPLATE_ARG(DATA14_OVERFLOW),STRUCT_MIRROR_TEMPLATE_ARG(DATA14_OVERFLOW),32> STRUCT_MIRROR_NAME(data);
+#if STRUCT_ONLY_LAST_UNION_MEMBER
+  struct 
+#else
+  union 
+#endif
+
+  {
+  public:
+#if !STRUCT_ONLY_LAST_UNION_MEMBER
+    struct 
+    {
+    public:
+      STRUCT_MIRROR_ITEM_CTRL(counter);
+      STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(counter);
+      STRUCT_MIRROR_ITEM_CTRL(unnamed_30_31);
+      STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(unnamed_30_31);
+    };
+#endif// !STRUCT_ONLY_LAST_UNION_MEMBER
+    STRUCT_MIRROR_ITEM_CTRL(u32);
+    STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(u32);
+  } STRUCT_MIRROR_NAME(end_of_event);
+  STRUCT_MIRROR_FCNS_DECL(VME_MESYTEC_MADC32);
+};
+#endif//USER_DEF_VME_MESYTEC_MADC32
+
+#ifndef USER_DEF_VME_MESYTEC_MDPP16
+STRUCT_MIRROR_TEMPLATE
+class STRUCT_MIRROR_STRUCT(VME_MESYTEC_MDPP16)
+{
+public:
+  STRUCT_MIRROR_ITEM_CTRL(adc);
+  STRUCT_MIRROR_TYPE(raw_array_multi_zero_suppress) < STRUCT_MIRROR_TYPE_TEMPLATE STRUCT_MIRROR_TEMPLATE_ARG(DATA16_OVERFLOW),STRUCT_MIRROR_TEMPLATE_ARG(DATA16_OVERFLOW),16,20> STRUCT_MIRROR_NAME(adc);
+  STRUCT_MIRROR_ITEM_CTRL(tdc);
+  STRUCT_MIRROR_TYPE(raw_array_multi_zero_suppress) < STRUCT_MIRROR_TYPE_TEMPLATE STRUCT_MIRROR_TEMPLATE_ARG(DATA16_OVERFLOW),STRUCT_MIRROR_TEMPLATE_ARG(DATA16_OVERFLOW),16,20> STRUCT_MIRROR_NAME(tdc);
+  STRUCT_MIRROR_ITEM_CTRL(trig_tdc);
+  STRUCT_MIRROR_TYPE(raw_array_multi_zero_suppress) < STRUCT_MIRROR_TYPE_TEMPLATE STRUCT_MIRROR_TEMPLATE_ARG(DATA16_OVERFLOW),STRUCT_MIRROR_TEMPLATE_ARG(DATA16_OVERFLOW),16,20> STRUCT_MIRROR_NAME(trig_tdc);
+  STRUCT_MIRROR_ITEM_CTRL(adc_short);
+  STRUCT_MIRROR_TYPE(raw_array_multi_zero_suppress) < STRUCT_MIRROR_TYPE_TEMPLATE STRUCT_MIRROR_TEMPLATE_ARG(DATA16_OVERFLOW),STRUCT_MIRROR_TEMPLATE_ARG(DATA16_OVERFLOW),16,20> STRUCT_MIRROR_NAME(adc_short);
+#if STRUCT_ONLY_LAST_UNION_MEMBER
+  struct 
+#else
+  union 
+#endif
+
+  {
+  public:
+#if !STRUCT_ONLY_LAST_UNION_MEMBER
+    struct 
+    {
+    public:
+      STRUCT_MIRROR_ITEM_CTRL(counter);
+      STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(counter);
+      STRUCT_MIRROR_ITEM_CTRL(unnamed_30_31);
+      STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(unnamed_30_31);
+    };
+#endif// !STRUCT_ONLY_LAST_UNION_MEMBER
+    STRUCT_MIRROR_ITEM_CTRL(u32);
+    STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(u32);
+  } STRUCT_MIRROR_NAME(end_of_event);
+  STRUCT_MIRROR_FCNS_DECL(VME_MESYTEC_MDPP16);
+};
+#endif//USER_DEF_VME_MESYTEC_MDPP16
+
+#ifndef USER_DEF_IS446_VME
+STRUCT_MIRROR_TEMPLATE
+class STRUCT_MIRROR_STRUCT(IS446_VME) : public STRUCT_MIRROR_BASE(unpack_subevent_base)
+{
+public:
+  STRUCT_MIRROR_ITEM_CTRL_BASE(unpack_subevent_base);
+  STRUCT_MIRROR_ITEM_CTRL(scaler);
+  STRUCT_MIRROR_ITEM_CTRL_ARRAY(scaler__i0,,1);
+  STRUCT_MIRROR_TYPE(VME_CAEN_V830) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(scaler[1]);
+  STRUCT_MIRROR_ITEM_CTRL(adc);
+  STRUCT_MIRROR_ITEM_CTRL_ARRAY(adc__i0,,7);
+  STRUCT_MIRROR_TYPE(VME_CAEN_V775) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(adc[7]);
+  STRUCT_MIRROR_ITEM_CTRL(tdc);
+  STRUCT_MIRROR_ITEM_CTRL_ARRAY(tdc__i0,,5);
+  STRUCT_MIRROR_TYPE(VME_CAEN_V775) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(tdc[5]);
+  STRUCT_MIRROR_FCNS_DECL(IS446_VME);
+};
+#endif//USER_DEF_IS446_VME
+
+#ifndef USER_DEF_IS446_VME2
+STRUCT_MIRROR_TEMPLATE
+class STRUCT_MIRROR_STRUCT(IS446_VME2) : public STRUCT_MIRROR_BASE(unpack_subevent_base)
+{
+public:
+  STRUCT_MIRROR_ITEM_CTRL_BASE(unpack_subevent_base);
+  STRUCT_MIRROR_FCNS_DECL(IS446_VME2);
+};
+#endif//USER_DEF_IS446_VME2
+
+#ifndef USER_DEF_unpack_event
+STRUCT_MIRROR_TEMPLATE
+class STRUCT_MIRROR_STRUCT(unpack_event) : public STRUCT_MIRROR_BASE(unpack_event_base)
+{
+public:
+  STRUCT_MIRROR_ITEM_CTRL_BASE(unpack_event_base);
+  STRUCT_MIRROR_ITEM_CTRL(vme);
+  STRUCT_MIRROR_TYPE(IS446_VME) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(vme);
+  STRUCT_MIRROR_ITEM_CTRL(vme2);
+  STRUCT_MIRROR_TYPE(IS446_VME2) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(vme2);
+  STRUCT_MIRROR_FCNS_DECL(unpack_event);
+};
+#endif//USER_DEF_unpack_event
+
+#ifndef USER_DEF_unpack_sticky_event
+STRUCT_MIRROR_TEMPLATE
+class STRUCT_MIRROR_STRUCT(unpack_sticky_event) : public STRUCT_MIRROR_BASE(unpack_sticky_event_base)
+{
+public:
+  STRUCT_MIRROR_ITEM_CTRL_BASE(unpack_sticky_event_base);
+  STRUCT_MIRROR_FCNS_DECL(unpack_sticky_event);
+};
+#endif//USER_DEF_unpack_sticky_event
+
+#include "gen/default_mirror_undef.hh"
+
+
+/** END_MIRROR_STRUCT *************************************************/
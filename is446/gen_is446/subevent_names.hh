@@ -0,0 +1,20 @@
+/** BEGIN_SUBEVENT_NAMES ***********************************************
+ *
+ * Mappings of names for [incl|excl] name lookup.
+ *
+ * Do not edit - automatically generated.
+ */
+
+{ "vme", "type=10:subtype=1:subcrate=0" },
+{ "vme2", "type=10:subtype=1:subcrate=1" },
+
+/** END_SUBEVENT_NAMES ************************************************/
+/** BEGIN_SUBEVENT_NAMES ***********************************************
+ *
+ * Mappings of names for [incl|excl] name lookup.
+ *
+ * Do not edit - automatically generated.
+ */
+
+
+/** END_SUBEVENT_NAMES ************************************************/
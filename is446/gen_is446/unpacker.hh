@@ -0,0 +1,2187 @@
+/** BEGIN_UNPACKER *****************************************************
+ *
+ * Event unpacker for CAMAC_LECROY_4434.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// CAMAC_LECROY_4434(channels)
+template<typename __data_src_t>
+void CAMAC_LECROY_4434::__unpack(__data_src_t &__buffer,uint32 channels)
+{
+  // MEMBER(DATA24 data[32] ZERO_SUPPRESS);
+  // list(0<=index<channels)
+
+  for (uint32 index = 0; index < (uint32) (channels); ++index)
+  {
+    // UINT32 ch_data NOENCODE
+    // {
+      //  0_23: value;
+      // 24_31: 0;
+      // ENCODE(data[index],(value=value));
+    // }
+    union
+    {
+      struct
+      {
+#if __BYTE_ORDER == __LITTLE_ENDIAN
+        uint32 value : 24; // 0..23
+        uint32 unnamed_24_31 : 8; // 24..31
+#endif
+#if __BYTE_ORDER == __BIG_ENDIAN
+        uint32 unnamed_24_31 : 8; // 24..31
+        uint32 value : 24; // 0..23
+#endif
+      };
+      uint32  u32;
+    } ch_data;
+    READ_FROM_BUFFER_FULL(24,uint32 ,ch_data,ch_data.u32,0);
+    CHECK_BITS_EQUAL(21,ch_data.unnamed_24_31,0);
+    {
+      typedef __typeof__(*(&(data))) __array_t;
+      typedef typename __array_t::item_t __item_t;
+      __item_t &__item = data.insert_index(23,index);
+      __item.value = ch_data.value;
+    }
+  }
+}
+FORCE_IMPL_DATA_SRC_FCN_ARG(void,CAMAC_LECROY_4434::__unpack,uint32 channels);
+
+/** END_UNPACKER ******************************************************/
+/** BEGIN_UNPACKER *****************************************************
+ *
+ * Event unpacker for CAMAC_PHILLIPS_7164.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// CAMAC_PHILLIPS_7164(channels,mark_channel_no)
+template<typename __data_src_t>
+void CAMAC_PHILLIPS_7164::__unpack(__data_src_t &__buffer,uint32 channels
+                                                         ,uint32 mark_channel_no)
+{
+  // MEMBER(DATA12 data[16] ZERO_SUPPRESS);
+  // list(0<=index<channels)
+
+  for (uint32 index = 0; index < (uint32) (channels); ++index)
+  {
+    // if(mark_channel_no)
+
+    // else
+
+    if (mark_channel_no)
+    {
+      // UINT16 ch_data NOENCODE
+      // {
+        //  0_11: value;
+        // 12_15: channel = CHECK(index);
+        // ENCODE(data[index],(value=value));
+      // }
+      union
+      {
+        struct
+        {
+#if __BYTE_ORDER == __LITTLE_ENDIAN
+          uint16 value : 12; // 0..11
+          uint16 channel : 4; // 12..15
+#endif
+#if __BYTE_ORDER == __BIG_ENDIAN
+          uint16 channel : 4; // 12..15
+          uint16 value : 12; // 0..11
+#endif
+        };
+        uint16  u16;
+      } ch_data;
+      READ_FROM_BUFFER_FULL(72,uint16 ,ch_data,ch_data.u16,2);
+      CHECK_BITS_EQUAL(69,ch_data.channel,index);
+      {
+        typedef __typeof__(*(&(data))) __array_t;
+        typedef typename __array_t::item_t __item_t;
+        __item_t &__item = data.insert_index(71,index);
+        __item.value = ch_data.value;
+      }
+    }
+
+    else
+    {
+      // UINT16 ch_data NOENCODE
+      // {
+        //  0_11: value;
+        // ENCODE(data[index],(value=value));
+      // }
+      union
+      {
+        struct
+        {
+#if __BYTE_ORDER == __LITTLE_ENDIAN
+          uint16 value : 12; // 0..11
+          uint16 dummy_12_15 : 4;
+#endif
+#if __BYTE_ORDER == __BIG_ENDIAN
+          uint16 dummy_12_15 : 4;
+          uint16 value : 12; // 0..11
+#endif
+        };
+        uint16  u16;
+      } ch_data;
+      READ_FROM_BUFFER_FULL(79,uint16 ,ch_data,ch_data.u16,3);
+      CHECK_UNNAMED_BITS_ZERO(79,ch_data.u16,0xf000);
+      {
+        typedef __typeof__(*(&(data))) __array_t;
+        typedef typename __array_t::item_t __item_t;
+        __item_t &__item = data.insert_index(78,index);
+        __item.value = ch_data.value;
+      }
+    }
+  }
+}
+FORCE_IMPL_DATA_SRC_FCN_ARG(void,CAMAC_PHILLIPS_7164::__unpack,uint32 channels
+                                                              ,uint32 mark_channel_no);
+
+/** END_UNPACKER ******************************************************/
+/** BEGIN_UNPACKER *****************************************************
+ *
+ * Event unpacker for CAMAC_SILENA_4418.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// CAMAC_SILENA_4418(channels,mark_channel_no)
+template<typename __data_src_t>
+void CAMAC_SILENA_4418::__unpack(__data_src_t &__buffer,uint32 channels,uint32 mark_channel_no)
+{
+  // MEMBER(DATA12_OVERFLOW data[8] ZERO_SUPPRESS);
+  // list(0<=index<channels)
+
+  for (uint32 index = 0; index < (uint32) (channels); ++index)
+  {
+    // if(mark_channel_no)
+
+    // else
+
+    if (mark_channel_no)
+    {
+      // UINT16 ch_data NOENCODE
+      // {
+        //  0_11: value;
+        // 12_14: channel = CHECK(index);
+        //    15: overflow;
+        // ENCODE(data[index],(value=value,overflow=overflow));
+      // }
+      union
+      {
+        struct
+        {
+#if __BYTE_ORDER == __LITTLE_ENDIAN
+          uint16 value : 12; // 0..11
+          uint16 channel : 3; // 12..14
+          uint16 overflow : 1; // 15
+#endif
+#if __BYTE_ORDER == __BIG_ENDIAN
+          uint16 overflow : 1; // 15
+          uint16 channel : 3; // 12..14
+          uint16 value : 12; // 0..11
+#endif
+        };
+        uint16  u16;
+      } ch_data;
+      READ_FROM_BUFFER_FULL(44,uint16 ,ch_data,ch_data.u16,6);
+      CHECK_BITS_EQUAL(40,ch_data.channel,index);
+      {
+        typedef __typeof__(*(&(data))) __array_t;
+        typedef typename __array_t::item_t __item_t;
+        __item_t &__item = data.insert_index(43,index);
+        __item.value = ch_data.value;
+        __item.overflow = ch_data.overflow;
+      }
+    }
+
+    else
+    {
+      // UINT16 ch_data NOENCODE
+      // {
+        //  0_11: value;
+        //    15: overflow;
+        // ENCODE(data[index],(value=value,overflow=overflow));
+      // }
+      union
+      {
+        struct
+        {
+#if __BYTE_ORDER == __LITTLE_ENDIAN
+          uint16 value : 12; // 0..11
+          uint16 dummy_12_14 : 3;
+          uint16 overflow : 1; // 15
+#endif
+#if __BYTE_ORDER == __BIG_ENDIAN
+          uint16 overflow : 1; // 15
+          uint16 dummy_12_14 : 3;
+          uint16 value : 12; // 0..11
+#endif
+        };
+        uint16  u16;
+      } ch_data;
+      READ_FROM_BUFFER_FULL(52,uint16 ,ch_data,ch_data.u16,7);
+      CHECK_UNNAMED_BITS_ZERO(52,ch_data.u16,0x7000);
+      {
+        typedef __typeof__(*(&(data))) __array_t;
+        typedef typename __array_t::item_t __item_t;
+        __item_t &__item = data.insert_index(51,index);
+        __item.value = ch_data.value;
+        __item.overflow = ch_data.overflow;
+      }
+    }
+  }
+}
+FORCE_IMPL_DATA_SRC_FCN_ARG(void,CAMAC_SILENA_4418::__unpack,uint32 channels
+                                                            ,uint32 mark_channel_no);
+
+/** END_UNPACKER ******************************************************/
+/** BEGIN_UNPACKER *****************************************************
+ *
+ * Event unpacker for FASTBUS_LECROY_1875.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// FASTBUS_LECROY_1875(geom,channels)
+template<typename __data_src_t>
+void FASTBUS_LECROY_1875::__unpack(__data_src_t &__buffer,uint32 geom,uint32 channels)
+{
+  // MEMBER(DATA12_RANGE data[64] ZERO_SUPPRESS);
+  // UINT32 ch_data NOENCODE
+  // {
+    //  0_11: value;
+    // 16_21: channel = RANGE(0,(channels - 1));
+    //    23: range;
+    // 24_26: n = CHECK(0);
+    // 27_31: geom = MATCH(geom);
+    // ENCODE(data[channel],(value=value,range=range));
+  // }
+  union
+  {
+    struct
+    {
+#if __BYTE_ORDER == __LITTLE_ENDIAN
+      uint32 value : 12; // 0..11
+      uint32 dummy_12_15 : 4;
+      uint32 channel : 6; // 16..21
+      uint32 dummy_22 : 1;
+      uint32 range : 1; // 23
+      uint32 n : 3; // 24..26
+      uint32 geom : 5; // 27..31
+#endif
+#if __BYTE_ORDER == __BIG_ENDIAN
+      uint32 geom : 5; // 27..31
+      uint32 n : 3; // 24..26
+      uint32 range : 1; // 23
+      uint32 dummy_22 : 1;
+      uint32 channel : 6; // 16..21
+      uint32 dummy_12_15 : 4;
+      uint32 value : 12; // 0..11
+#endif
+    };
+    uint32  u32;
+  } ch_data;
+  READ_FROM_BUFFER_FULL(102,uint32 ,ch_data,ch_data.u32,10);
+  CHECK_BITS_RANGE_MAX(95,ch_data.channel,(channels - 1));
+  CHECK_BITS_EQUAL(98,ch_data.n,0);
+  CHECK_BITS_EQUAL(99,ch_data.geom,geom);
+  CHECK_UNNAMED_BITS_ZERO(102,ch_data.u32,0x0040f000);
+  {
+    typedef __typeof__(*(&(data))) __array_t;
+    typedef typename __array_t::item_t __item_t;
+    __item_t &__item = data.insert_index(101,ch_data.channel);
+    __item.value = ch_data.value;
+    __item.range = ch_data.range;
+  }
+}
+FORCE_IMPL_DATA_SRC_FCN_ARG(void,FASTBUS_LECROY_1875::__unpack,uint32 geom
+                                                              ,uint32 channels);
+
+/** END_UNPACKER ******************************************************/
+/** BEGIN_UNPACKER *****************************************************
+ *
+ * Event unpacker for FASTBUS_LECROY_1885.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// FASTBUS_LECROY_1885(geom,channels)
+template<typename __data_src_t>
+void FASTBUS_LECROY_1885::__unpack(__data_src_t &__buffer,uint32 geom,uint32 channels)
+{
+  // MEMBER(DATA12_RANGE data[96] ZERO_SUPPRESS);
+  // UINT32 ch_data NOENCODE
+  // {
+    //  0_11: value;
+    // 16_22: channel = RANGE(0,(channels - 1));
+    //    23: range;
+    // 24_26: n = CHECK(0);
+    // 27_31: geom = MATCH(geom);
+    // ENCODE(data[channel],(value=value,range=range));
+  // }
+  union
+  {
+    struct
+    {
+#if __BYTE_ORDER == __LITTLE_ENDIAN
+      uint32 value : 12; // 0..11
+      uint32 dummy_12_15 : 4;
+      uint32 channel : 7; // 16..22
+      uint32 range : 1; // 23
+      uint32 n : 3; // 24..26
+      uint32 geom : 5; // 27..31
+#endif
+#if __BYTE_ORDER == __BIG_ENDIAN
+      uint32 geom : 5; // 27..31
+      uint32 n : 3; // 24..26
+      uint32 range : 1; // 23
+      uint32 channel : 7; // 16..22
+      uint32 dummy_12_15 : 4;
+      uint32 value : 12; // 0..11
+#endif
+    };
+    uint32  u32;
+  } ch_data;
+  READ_FROM_BUFFER_FULL(119,uint32 ,ch_data,ch_data.u32,12);
+  CHECK_BITS_RANGE_MAX(113,ch_data.channel,(channels - 1));
+  CHECK_BITS_EQUAL(115,ch_data.n,0);
+  CHECK_BITS_EQUAL(116,ch_data.geom,geom);
+  CHECK_UNNAMED_BITS_ZERO(119,ch_data.u32,0x0000f000);
+  {
+    typedef __typeof__(*(&(data))) __array_t;
+    typedef typename __array_t::item_t __item_t;
+    __item_t &__item = data.insert_index(118,ch_data.channel);
+    __item.value = ch_data.value;
+    __item.range = ch_data.range;
+  }
+}
+FORCE_IMPL_DATA_SRC_FCN_ARG(void,FASTBUS_LECROY_1885::__unpack,uint32 geom
+                                                              ,uint32 channels);
+
+/** END_UNPACKER ******************************************************/
+/** BEGIN_UNPACKER *****************************************************
+ *
+ * Event unpacker for VME_CAEN_V1190_SUBTDC.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// VME_CAEN_V1190_SUBTDC(tdc,event_id,data)
+template<typename __data_src_t>
+void VME_CAEN_V1190_SUBTDC::__unpack(__data_src_t &__buffer,uint32 tdc,uint32 event_id
+                                                           ,raw_array_multi_zero_suppress<DATA24,DATA24,32,128> &data)
+{
+  // MEMBER(DATA24 data[32] ZERO_SUPPRESS_MULTI(128));
+  // MARK_COUNT(tdc_start);
+  void *__mark_tdc_start = __buffer._data;
+  // UINT32 header
+  // {
+    //  0_11: bunch_id;
+    // 12_23: event_id = CHECK(event_id);
+    // 24_25: tdc = MATCH(tdc);
+    // 27_31: 1;
+  // }
+  READ_FROM_BUFFER_FULL(423,uint32 ,header,header.u32,14);
+  CHECK_BITS_EQUAL(419,header.event_id,event_id);
+  CHECK_BITS_EQUAL(421,header.tdc,tdc);
+  CHECK_BITS_EQUAL(422,header.unnamed_27_31,1);
+  CHECK_UNNAMED_BITS_ZERO(423,header.u32,0x04000000);
+  // several UINT32 ch_data NOENCODE
+  // {
+    //  0_18: value;
+    // 19_23: channel_low;
+    // 24_25: tdc = CHECK(tdc);
+    //    26: trailing;
+    // 27_31: 0;
+    // ENCODE(data[((tdc << 5) | channel_low)],(value=value));
+  // }
+  for ( ; ; ) {
+  union
+  {
+    struct
+    {
+#if __BYTE_ORDER == __LITTLE_ENDIAN
+      uint32 value : 19; // 0..18
+      uint32 channel_low : 5; // 19..23
+      uint32 tdc : 2; // 24..25
+      uint32 trailing : 1; // 26
+      uint32 unnamed_27_31 : 5; // 27..31
+#endif
+#if __BYTE_ORDER == __BIG_ENDIAN
+      uint32 unnamed_27_31 : 5; // 27..31
+      uint32 trailing : 1; // 26
+      uint32 tdc : 2; // 24..25
+      uint32 channel_low : 5; // 19..23
+      uint32 value : 19; // 0..18
+#endif
+    };
+    uint32  u32;
+  } ch_data;
+  if (__buffer.empty()) goto data_done_0;
+  PEEK_FROM_BUFFER_FULL(450,uint32 ,ch_data,ch_data.u32,15);
+  CHECK_JUMP_BITS_EQUAL(435,ch_data.tdc,tdc,data_done_0);
+  CHECK_JUMP_BITS_EQUAL(440,ch_data.unnamed_27_31,0,data_done_0);
+  __buffer.advance(sizeof(ch_data.u32));
+  {
+    typedef __typeof__(*(&(data))) __array_t;
+    typedef typename __array_t::item_t __item_t;
+    __item_t &__item = data.insert_index(448,((ch_data.tdc << 5) | ch_data.channel_low));
+    __item.value = ch_data.value;
+  }
+  }
+  data_done_0:;
+  // optional UINT32 error_flags
+  // {
+    //  0_14: flags;
+    // 24_25: tdc = CHECK(tdc);
+    // 27_31: 4;
+  // }
+  union
+  {
+    struct
+    {
+#if __BYTE_ORDER == __LITTLE_ENDIAN
+      uint32 flags : 15; // 0..14
+      uint32 dummy_15_23 : 9;
+      uint32 tdc : 2; // 24..25
+      uint32 dummy_26 : 1;
+      uint32 unnamed_27_31 : 5; // 27..31
+#endif
+#if __BYTE_ORDER == __BIG_ENDIAN
+      uint32 unnamed_27_31 : 5; // 27..31
+      uint32 dummy_26 : 1;
+      uint32 tdc : 2; // 24..25
+      uint32 dummy_15_23 : 9;
+      uint32 flags : 15; // 0..14
+#endif
+    };
+    uint32  u32;
+  } __error_flags;
+  if (__buffer.empty()) goto data_done_1;
+  PEEK_FROM_BUFFER_FULL(458,uint32 ,error_flags,__error_flags.u32,16);
+  CHECK_JUMP_BITS_EQUAL(456,__error_flags.tdc,tdc,data_done_1);
+  CHECK_JUMP_BITS_EQUAL(457,__error_flags.unnamed_27_31,4,data_done_1);
+  CHECK_JUMP_UNNAMED_BITS_ZERO(458,__error_flags.u32,0x04ff8000,data_done_1);
+  error_flags.u32 = __error_flags.u32;
+  __buffer.advance(sizeof(__error_flags.u32));
+  data_done_1:;
+  // MARK_COUNT(tdc_end);
+  void *__mark_tdc_end = __buffer._data;
+  // UINT32 trailer
+  // {
+    //  0_11: word_count = CHECK_COUNT(tdc_start,tdc_end,4,4);
+    // 12_23: event_id = CHECK(header.event_id);
+    // 24_25: tdc = CHECK(tdc);
+    // 27_31: 3;
+  // }
+  READ_FROM_BUFFER_FULL(469,uint32 ,trailer,trailer.u32,17);
+  CHECK_WORD_COUNT(464,trailer.word_count,tdc_start,tdc_end,4,4);
+  CHECK_BITS_EQUAL(465,trailer.event_id,header.event_id);
+  CHECK_BITS_EQUAL(467,trailer.tdc,tdc);
+  CHECK_BITS_EQUAL(468,trailer.unnamed_27_31,3);
+  CHECK_UNNAMED_BITS_ZERO(469,trailer.u32,0x04000000);
+}
+FORCE_IMPL_DATA_SRC_FCN_ARG(void,VME_CAEN_V1190_SUBTDC::__unpack,uint32 tdc
+                                                                ,uint32 event_id
+                                                                ,raw_array_multi_zero_suppress<DATA24,DATA24,32,128> &data);
+
+/** END_UNPACKER ******************************************************/
+/** BEGIN_UNPACKER *****************************************************
+ *
+ * Event unpacker for VME_CAEN_V1190.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// VME_CAEN_V1190(geom)
+template<typename __data_src_t>
+void VME_CAEN_V1190::__unpack(__data_src_t &__buffer,uint32 geom)
+{
+  // MEMBER(DATA24 data[32] ZERO_SUPPRESS_MULTI(128));
+  // MARK_COUNT(v1190_start);
+  void *__mark_v1190_start = __buffer._data;
+  // UINT32 header
+  // {
+    //  0_04: geom = MATCH(geom);
+    //  5_26: event_number;
+    // 27_31: 8;
+  // }
+  READ_FROM_BUFFER_FULL(484,uint32 ,header,header.u32,19);
+  CHECK_BITS_EQUAL(481,header.geom,geom);
+  CHECK_BITS_EQUAL(483,header.unnamed_27_31,8);
+  // select several
+
+    // tdc[0] = VME_CAEN_V1190_SUBTDC(tdc=0,event_id=(header.event_number & 0xfff),
+                                   // data=data);
+    // tdc[1] = VME_CAEN_V1190_SUBTDC(tdc=1,event_id=(header.event_number & 0xfff),
+                                   // data=data);
+    // tdc[2] = VME_CAEN_V1190_SUBTDC(tdc=2,event_id=(header.event_number & 0xfff),
+                                   // data=data);
+    // tdc[3] = VME_CAEN_V1190_SUBTDC(tdc=3,event_id=(header.event_number & 0xfff),
+                                   // data=data);
+  for ( ; ; )
+  {
+    if (__buffer.empty()) break;
+    int __match_no = 0;
+    // optimized match 1: VME_CAEN_V1190_SUBTDC tdc[0]: (s32) => (0xff000000,0x08000000)
+    // optimized match 2: VME_CAEN_V1190_SUBTDC tdc[1]: (s32) => (0xff000000,0x09000000)
+    // optimized match 3: VME_CAEN_V1190_SUBTDC tdc[2]: (s32) => (0xff000000,0x0a000000)
+    // optimized match 4: VME_CAEN_V1190_SUBTDC tdc[3]: (s32) => (0xff000000,0x0b000000)
+    {
+    uint32 __match_peek;
+    PEEK_FROM_BUFFER(492,uint32,__match_peek);
+    // differ = 03000000 : 24 25
+    uint32 __match_index = 0 | /* 24,25 */ ((__match_peek >> 24) & 0x00000003);
+    static const sint8 __match_index_array[4] = { 1, 2, 3, 4, };
+    __match_no = __match_index_array[__match_index];
+    // last_subevent_item = 0
+    }
+    if (!__match_no) break;
+    switch (__match_no)
+    {
+      case 1:
+        CHECK_SPURIOUS_MATCH_DECL(488,spurious_match_abort_loop_0,VME_CAEN_V1190_SUBTDC,/*tdc*/0,/*event_id*/(header.event_number & 0xfff)/*,data:member*/);
+        MATCH_PROFILE_COUNT(488,tdc[0]);
+        UNPACK_DECL(488,VME_CAEN_V1190_SUBTDC,tdc[0],/*tdc*/0,/*event_id*/(header.event_number & 0xfff),/*data*/data);
+        break;
+      case 2:
+        CHECK_SPURIOUS_MATCH_DECL(489,spurious_match_abort_loop_0,VME_CAEN_V1190_SUBTDC,/*tdc*/1,/*event_id*/(header.event_number & 0xfff)/*,data:member*/);
+        MATCH_PROFILE_COUNT(489,tdc[1]);
+        UNPACK_DECL(489,VME_CAEN_V1190_SUBTDC,tdc[1],/*tdc*/1,/*event_id*/(header.event_number & 0xfff),/*data*/data);
+        break;
+      case 3:
+        CHECK_SPURIOUS_MATCH_DECL(490,spurious_match_abort_loop_0,VME_CAEN_V1190_SUBTDC,/*tdc*/2,/*event_id*/(header.event_number & 0xfff)/*,data:member*/);
+        MATCH_PROFILE_COUNT(490,tdc[2]);
+        UNPACK_DECL(490,VME_CAEN_V1190_SUBTDC,tdc[2],/*tdc*/2,/*event_id*/(header.event_number & 0xfff),/*data*/data);
+        break;
+      case 4:
+        CHECK_SPURIOUS_MATCH_DECL(491,spurious_match_abort_loop_0,VME_CAEN_V1190_SUBTDC,/*tdc*/3,/*event_id*/(header.event_number & 0xfff)/*,data:member*/);
+        MATCH_PROFILE_COUNT(491,tdc[3]);
+        UNPACK_DECL(491,VME_CAEN_V1190_SUBTDC,tdc[3],/*tdc*/3,/*event_id*/(header.event_number & 0xfff),/*data*/data);
+        break;
+    }
+  }
+  spurious_match_abort_loop_0:;
+  // UINT32 trigger
+  // {
+    //  0_26: time_tag;
+    // 27_31: 17;
+  // }
+  READ_FROM_BUFFER_FULL(498,uint32 ,trigger,trigger.u32,20);
+  CHECK_BITS_EQUAL(497,trigger.unnamed_27_31,17);
+  // MARK_COUNT(v1190_end);
+  void *__mark_v1190_end = __buffer._data;
+  // UINT32 trailer
+  // {
+    //  0_04: geom = CHECK(geom);
+    //  5_19: word_count = CHECK_COUNT(v1190_start,v1190_end,4,4);
+    //    24: tdc_error;
+    //    25: buffer_overflow;
+    //    26: trigger_lost;
+    // 27_31: 16;
+  // }
+  READ_FROM_BUFFER_FULL(510,uint32 ,trailer,trailer.u32,21);
+  CHECK_BITS_EQUAL(504,trailer.geom,geom);
+  CHECK_WORD_COUNT(505,trailer.word_count,v1190_start,v1190_end,4,4);
+  CHECK_BITS_EQUAL(509,trailer.unnamed_27_31,16);
+  CHECK_UNNAMED_BITS_ZERO(510,trailer.u32,0x00f00000);
+}
+FORCE_IMPL_DATA_SRC_FCN_ARG(void,VME_CAEN_V1190::__unpack,uint32 geom);
+
+/** END_UNPACKER ******************************************************/
+/** BEGIN_UNPACKER *****************************************************
+ *
+ * Event unpacker for VME_CAEN_V1190_SHORT_SUBTDC.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// VME_CAEN_V1190_SHORT_SUBTDC(tdc,event_id,data)
+template<typename __data_src_t>
+void VME_CAEN_V1190_SHORT_SUBTDC::__unpack(__data_src_t &__buffer,uint32 tdc
+                                                                 ,uint32 event_id
+                                                                 ,raw_array_multi_zero_suppress<DATA24,DATA24,32,128> &data)
+{
+  // MEMBER(DATA24 data[32] ZERO_SUPPRESS_MULTI(128));
+  // UINT32 ch_data NOENCODE
+  // {
+    //  0_18: value;
+    // 19_23: channel_low;
+    // 24_25: tdc = CHECK(tdc);
+    //    26: trailing;
+    // 27_31: 0;
+    // ENCODE(data[((tdc << 5) | channel_low)],(value=value));
+  // }
+  union
+  {
+    struct
+    {
+#if __BYTE_ORDER == __LITTLE_ENDIAN
+      uint32 value : 19; // 0..18
+      uint32 channel_low : 5; // 19..23
+      uint32 tdc : 2; // 24..25
+      uint32 trailing : 1; // 26
+      uint32 unnamed_27_31 : 5; // 27..31
+#endif
+#if __BYTE_ORDER == __BIG_ENDIAN
+      uint32 unnamed_27_31 : 5; // 27..31
+      uint32 trailing : 1; // 26
+      uint32 tdc : 2; // 24..25
+      uint32 channel_low : 5; // 19..23
+      uint32 value : 19; // 0..18
+#endif
+    };
+    uint32  u32;
+  } ch_data;
+  READ_FROM_BUFFER_FULL(547,uint32 ,ch_data,ch_data.u32,23);
+  CHECK_BITS_EQUAL(532,ch_data.tdc,tdc);
+  CHECK_BITS_EQUAL(537,ch_data.unnamed_27_31,0);
+  {
+    typedef __typeof__(*(&(data))) __array_t;
+    typedef typename __array_t::item_t __item_t;
+    __item_t &__item = data.insert_index(545,((ch_data.tdc << 5) | ch_data.channel_low));
+    __item.value = ch_data.value;
+  }
+}
+FORCE_IMPL_DATA_SRC_FCN_ARG(void,VME_CAEN_V1190_SHORT_SUBTDC::__unpack,uint32 tdc
+                                                                      ,uint32 event_id
+                                                                      ,raw_array_multi_zero_suppress<DATA24,DATA24,32,128> &data);
+
+/** END_UNPACKER ******************************************************/
+/** BEGIN_UNPACKER *****************************************************
+ *
+ * Event unpacker for VME_CAEN_V1190_SHORT_SUBTDC_ERROR.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// VME_CAEN_V1190_SHORT_SUBTDC_ERROR(tdc)
+template<typename __data_src_t>
+void VME_CAEN_V1190_SHORT_SUBTDC_ERROR::__unpack(__data_src_t &__buffer,uint32 tdc)
+{
+  // UINT32 error_flags
+  // {
+    //  0_14: flags;
+    // 24_25: tdc = CHECK(tdc);
+    // 27_31: 4;
+  // }
+  READ_FROM_BUFFER_FULL(558,uint32 ,error_flags,error_flags.u32,25);
+  CHECK_BITS_EQUAL(556,error_flags.tdc,tdc);
+  CHECK_BITS_EQUAL(557,error_flags.unnamed_27_31,4);
+  CHECK_UNNAMED_BITS_ZERO(558,error_flags.u32,0x04ff8000);
+}
+FORCE_IMPL_DATA_SRC_FCN_ARG(void,VME_CAEN_V1190_SHORT_SUBTDC_ERROR::__unpack,uint32 tdc);
+
+/** END_UNPACKER ******************************************************/
+/** BEGIN_UNPACKER *****************************************************
+ *
+ * Event unpacker for VME_CAEN_V1190_SHORT.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// VME_CAEN_V1190_SHORT(geom)
+template<typename __data_src_t>
+void VME_CAEN_V1190_SHORT::__unpack(__data_src_t &__buffer,uint32 geom)
+{
+  // MEMBER(DATA24 data[32] ZERO_SUPPRESS_MULTI(128));
+  // MARK_COUNT(v1190_start);
+  void *__mark_v1190_start = __buffer._data;
+  // UINT32 header
+  // {
+    //  0_04: geom = MATCH(geom);
+    //  5_26: event_number;
+    // 27_31: 8;
+  // }
+  READ_FROM_BUFFER_FULL(573,uint32 ,header,header.u32,27);
+  CHECK_BITS_EQUAL(570,header.geom,geom);
+  CHECK_BITS_EQUAL(572,header.unnamed_27_31,8);
+  // select several
+
+    // tdc[0] = VME_CAEN_V1190_SHORT_SUBTDC(tdc=0,event_id=(header.event_number & 0xfff),
+                                         // data=data);
+    // tdc[1] = VME_CAEN_V1190_SHORT_SUBTDC(tdc=1,event_id=(header.event_number & 0xfff),
+                                         // data=data);
+    // tdc[2] = VME_CAEN_V1190_SHORT_SUBTDC(tdc=2,event_id=(header.event_number & 0xfff),
+                                         // data=data);
+    // tdc[3] = VME_CAEN_V1190_SHORT_SUBTDC(tdc=3,event_id=(header.event_number & 0xfff),
+                                         // data=data);
+    // norevisit err[0] = VME_CAEN_V1190_SHORT_SUBTDC_ERROR(tdc=0);
+    // norevisit err[1] = VME_CAEN_V1190_SHORT_SUBTDC_ERROR(tdc=1);
+    // norevisit err[2] = VME_CAEN_V1190_SHORT_SUBTDC_ERROR(tdc=2);
+    // norevisit err[3] = VME_CAEN_V1190_SHORT_SUBTDC_ERROR(tdc=3);
+  bitsone<4> __visited1;
+  __visited1.clear();
+  for ( ; ; )
+  {
+    if (__buffer.empty()) break;
+    int __match_no = 0;
+    // optimized match 1: VME_CAEN_V1190_SHORT_SUBTDC tdc[0]: (s32) => (0xfb000000,0x00000000)
+    // optimized match 2: VME_CAEN_V1190_SHORT_SUBTDC tdc[1]: (s32) => (0xfb000000,0x01000000)
+    // optimized match 3: VME_CAEN_V1190_SHORT_SUBTDC tdc[2]: (s32) => (0xfb000000,0x02000000)
+    // optimized match 4: VME_CAEN_V1190_SHORT_SUBTDC tdc[3]: (s32) => (0xfb000000,0x03000000)
+    // optimized match 5: VME_CAEN_V1190_SHORT_SUBTDC_ERROR err[0]: (s32) => (0xffff8000,0x20000000)
+    // optimized match 6: VME_CAEN_V1190_SHORT_SUBTDC_ERROR err[1]: (s32) => (0xffff8000,0x21000000)
+    // optimized match 7: VME_CAEN_V1190_SHORT_SUBTDC_ERROR err[2]: (s32) => (0xffff8000,0x22000000)
+    // optimized match 8: VME_CAEN_V1190_SHORT_SUBTDC_ERROR err[3]: (s32) => (0xffff8000,0x23000000)
+    {
+    uint32 __match_peek;
+    PEEK_FROM_BUFFER(586,uint32,__match_peek);
+    // differ = 23000000 : 24 25 29
+    uint32 __match_index = 0 | /* 24,25 */ ((__match_peek >> 24) & 0x00000003) | /* 29,29 */ ((__match_peek >> 27) & 0x00000004);
+    static const sint8 __match_index_array[8] = { 1, 2, 3, 4, 5, 6, 7, 8, };
+    __match_no = __match_index_array[__match_index];
+    // last_subevent_item = 0
+    }
+    if (!__match_no) break;
+    switch (__match_no)
+    {
+      case 1:
+        CHECK_SPURIOUS_MATCH_DECL(577,spurious_match_abort_loop_1,VME_CAEN_V1190_SHORT_SUBTDC,/*tdc*/0,/*event_id*/(header.event_number & 0xfff)/*,data:member*/);
+        MATCH_PROFILE_COUNT(577,tdc[0]);
+        UNPACK_DECL(577,VME_CAEN_V1190_SHORT_SUBTDC,tdc[0],/*tdc*/0,/*event_id*/(header.event_number & 0xfff),/*data*/data);
+        break;
+      case 2:
+        CHECK_SPURIOUS_MATCH_DECL(578,spurious_match_abort_loop_1,VME_CAEN_V1190_SHORT_SUBTDC,/*tdc*/1,/*event_id*/(header.event_number & 0xfff)/*,data:member*/);
+        MATCH_PROFILE_COUNT(578,tdc[1]);
+        UNPACK_DECL(578,VME_CAEN_V1190_SHORT_SUBTDC,tdc[1],/*tdc*/1,/*event_id*/(header.event_number & 0xfff),/*data*/data);
+        break;
+      case 3:
+        CHECK_SPURIOUS_MATCH_DECL(579,spurious_match_abort_loop_1,VME_CAEN_V1190_SHORT_SUBTDC,/*tdc*/2,/*event_id*/(header.event_number & 0xfff)/*,data:member*/);
+        MATCH_PROFILE_COUNT(579,tdc[2]);
+        UNPACK_DECL(579,VME_CAEN_V1190_SHORT_SUBTDC,tdc[2],/*tdc*/2,/*event_id*/(header.event_number & 0xfff),/*data*/data);
+        break;
+      case 4:
+        CHECK_SPURIOUS_MATCH_DECL(580,spurious_match_abort_loop_1,VME_CAEN_V1190_SHORT_SUBTDC,/*tdc*/3,/*event_id*/(header.event_number & 0xfff)/*,data:member*/);
+        MATCH_PROFILE_COUNT(580,tdc[3]);
+        UNPACK_DECL(580,VME_CAEN_V1190_SHORT_SUBTDC,tdc[3],/*tdc*/3,/*event_id*/(header.event_number & 0xfff),/*data*/data);
+        break;
+      case 5:
+        CHECK_SPURIOUS_MATCH_DECL(582,spurious_match_abort_loop_1,VME_CAEN_V1190_SHORT_SUBTDC_ERROR,/*tdc*/0);
+        UNPACK_CHECK_NO_REVISIT(582,VME_CAEN_V1190_SHORT_SUBTDC_ERROR,err[0],__visited1,0);
+        MATCH_PROFILE_COUNT(582,err[0]);
+        UNPACK_DECL(582,VME_CAEN_V1190_SHORT_SUBTDC_ERROR,err[0],/*tdc*/0);
+        break;
+      case 6:
+        CHECK_SPURIOUS_MATCH_DECL(583,spurious_match_abort_loop_1,VME_CAEN_V1190_SHORT_SUBTDC_ERROR,/*tdc*/1);
+        UNPACK_CHECK_NO_REVISIT(583,VME_CAEN_V1190_SHORT_SUBTDC_ERROR,err[1],__visited1,1);
+        MATCH_PROFILE_COUNT(583,err[1]);
+        UNPACK_DECL(583,VME_CAEN_V1190_SHORT_SUBTDC_ERROR,err[1],/*tdc*/1);
+        break;
+      case 7:
+        CHECK_SPURIOUS_MATCH_DECL(584,spurious_match_abort_loop_1,VME_CAEN_V1190_SHORT_SUBTDC_ERROR,/*tdc*/2);
+        UNPACK_CHECK_NO_REVISIT(584,VME_CAEN_V1190_SHORT_SUBTDC_ERROR,err[2],__visited1,2);
+        MATCH_PROFILE_COUNT(584,err[2]);
+        UNPACK_DECL(584,VME_CAEN_V1190_SHORT_SUBTDC_ERROR,err[2],/*tdc*/2);
+        break;
+      case 8:
+        CHECK_SPURIOUS_MATCH_DECL(585,spurious_match_abort_loop_1,VME_CAEN_V1190_SHORT_SUBTDC_ERROR,/*tdc*/3);
+        UNPACK_CHECK_NO_REVISIT(585,VME_CAEN_V1190_SHORT_SUBTDC_ERROR,err[3],__visited1,3);
+        MATCH_PROFILE_COUNT(585,err[3]);
+        UNPACK_DECL(585,VME_CAEN_V1190_SHORT_SUBTDC_ERROR,err[3],/*tdc*/3);
+        break;
+    }
+  }
+  spurious_match_abort_loop_1:;
+  // UINT32 trigger
+  // {
+    //  0_26: time_tag;
+    // 27_31: 17;
+  // }
+  READ_FROM_BUFFER_FULL(592,uint32 ,trigger,trigger.u32,28);
+  CHECK_BITS_EQUAL(591,trigger.unnamed_27_31,17);
+  // MARK_COUNT(v1190_end);
+  void *__mark_v1190_end = __buffer._data;
+  // UINT32 trailer
+  // {
+    //  0_04: geom = CHECK(geom);
+    //  5_19: word_count = CHECK_COUNT(v1190_start,v1190_end,4,4);
+    //    24: tdc_error;
+    //    25: buffer_overflow;
+    //    26: trigger_lost;
+    // 27_31: 16;
+  // }
+  READ_FROM_BUFFER_FULL(604,uint32 ,trailer,trailer.u32,29);
+  CHECK_BITS_EQUAL(598,trailer.geom,geom);
+  CHECK_WORD_COUNT(599,trailer.word_count,v1190_start,v1190_end,4,4);
+  CHECK_BITS_EQUAL(603,trailer.unnamed_27_31,16);
+  CHECK_UNNAMED_BITS_ZERO(604,trailer.u32,0x00f00000);
+}
+FORCE_IMPL_DATA_SRC_FCN_ARG(void,VME_CAEN_V1190_SHORT::__unpack,uint32 geom);
+
+/** END_UNPACKER ******************************************************/
+/** BEGIN_UNPACKER *****************************************************
+ *
+ * Event unpacker for VME_CAEN_V1290_SUBTDC.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// VME_CAEN_V1290_SUBTDC(tdc,event_id,data)
+template<typename __data_src_t>
+void VME_CAEN_V1290_SUBTDC::__unpack(__data_src_t &__buffer,uint32 tdc,uint32 event_id
+                                                           ,raw_array_multi_zero_suppress<DATA24,DATA24,32,128> &data)
+{
+  // MEMBER(DATA24 data[32] ZERO_SUPPRESS_MULTI(128));
+  // MARK_COUNT(tdc_start);
+  void *__mark_tdc_start = __buffer._data;
+  // UINT32 header
+  // {
+    //  0_11: bunch_id;
+    // 12_23: event_id = CHECK(event_id);
+    // 24_25: tdc = MATCH(tdc);
+    // 27_31: 1;
+  // }
+  READ_FROM_BUFFER_FULL(218,uint32 ,header,header.u32,31);
+  CHECK_BITS_EQUAL(214,header.event_id,event_id);
+  CHECK_BITS_EQUAL(216,header.tdc,tdc);
+  CHECK_BITS_EQUAL(217,header.unnamed_27_31,1);
+  CHECK_UNNAMED_BITS_ZERO(218,header.u32,0x04000000);
+  // several UINT32 ch_data NOENCODE
+  // {
+    //  0_20: value;
+    // 21_23: channel_low;
+    // 24_25: tdc = CHECK(tdc);
+    //    26: trailing;
+    // 27_31: 0;
+    // ENCODE(data[((tdc << 3) | channel_low)],(value=value));
+  // }
+  for ( ; ; ) {
+  union
+  {
+    struct
+    {
+#if __BYTE_ORDER == __LITTLE_ENDIAN
+      uint32 value : 21; // 0..20
+      uint32 channel_low : 3; // 21..23
+      uint32 tdc : 2; // 24..25
+      uint32 trailing : 1; // 26
+      uint32 unnamed_27_31 : 5; // 27..31
+#endif
+#if __BYTE_ORDER == __BIG_ENDIAN
+      uint32 unnamed_27_31 : 5; // 27..31
+      uint32 trailing : 1; // 26
+      uint32 tdc : 2; // 24..25
+      uint32 channel_low : 3; // 21..23
+      uint32 value : 21; // 0..20
+#endif
+    };
+    uint32  u32;
+  } ch_data;
+  if (__buffer.empty()) goto data_done_2;
+  PEEK_FROM_BUFFER_FULL(245,uint32 ,ch_data,ch_data.u32,32);
+  CHECK_JUMP_BITS_EQUAL(225,ch_data.tdc,tdc,data_done_2);
+  CHECK_JUMP_BITS_EQUAL(235,ch_data.unnamed_27_31,0,data_done_2);
+  __buffer.advance(sizeof(ch_data.u32));
+  {
+    typedef __typeof__(*(&(data))) __array_t;
+    typedef typename __array_t::item_t __item_t;
+    __item_t &__item = data.insert_index(239,((ch_data.tdc << 3) | ch_data.channel_low));
+    __item.value = ch_data.value;
+  }
+  }
+  data_done_2:;
+  // optional UINT32 error_flags
+  // {
+    //  0_14: flags;
+    // 24_25: tdc = CHECK(tdc);
+    // 27_31: 4;
+  // }
+  union
+  {
+    struct
+    {
+#if __BYTE_ORDER == __LITTLE_ENDIAN
+      uint32 flags : 15; // 0..14
+      uint32 dummy_15_23 : 9;
+      uint32 tdc : 2; // 24..25
+      uint32 dummy_26 : 1;
+      uint32 unnamed_27_31 : 5; // 27..31
+#endif
+#if __BYTE_ORDER == __BIG_ENDIAN
+      uint32 unnamed_27_31 : 5; // 27..31
+      uint32 dummy_26 : 1;
+      uint32 tdc : 2; // 24..25
+      uint32 dummy_15_23 : 9;
+      uint32 flags : 15; // 0..14
+#endif
+    };
+    uint32  u32;
+  } __error_flags;
+  if (__buffer.empty()) goto data_done_3;
+  PEEK_FROM_BUFFER_FULL(253,uint32 ,error_flags,__error_flags.u32,33);
+  CHECK_JUMP_BITS_EQUAL(251,__error_flags.tdc,tdc,data_done_3);
+  CHECK_JUMP_BITS_EQUAL(252,__error_flags.unnamed_27_31,4,data_done_3);
+  CHECK_JUMP_UNNAMED_BITS_ZERO(253,__error_flags.u32,0x04ff8000,data_done_3);
+  error_flags.u32 = __error_flags.u32;
+  __buffer.advance(sizeof(__error_flags.u32));
+  data_done_3:;
+  // MARK_COUNT(tdc_end);
+  void *__mark_tdc_end = __buffer._data;
+  // UINT32 trailer
+  // {
+    //  0_11: word_count = CHECK_COUNT(tdc_start,tdc_end,4,4);
+    // 12_23: event_id = CHECK(header.event_id);
+    // 24_25: tdc = CHECK(tdc);
+    // 27_31: 3;
+  // }
+  READ_FROM_BUFFER_FULL(264,uint32 ,trailer,trailer.u32,34);
+  CHECK_WORD_COUNT(259,trailer.word_count,tdc_start,tdc_end,4,4);
+  CHECK_BITS_EQUAL(260,trailer.event_id,header.event_id);
+  CHECK_BITS_EQUAL(262,trailer.tdc,tdc);
+  CHECK_BITS_EQUAL(263,trailer.unnamed_27_31,3);
+  CHECK_UNNAMED_BITS_ZERO(264,trailer.u32,0x04000000);
+}
+FORCE_IMPL_DATA_SRC_FCN_ARG(void,VME_CAEN_V1290_SUBTDC::__unpack,uint32 tdc
+                                                                ,uint32 event_id
+                                                                ,raw_array_multi_zero_suppress<DATA24,DATA24,32,128> &data);
+
+/** END_UNPACKER ******************************************************/
+/** BEGIN_UNPACKER *****************************************************
+ *
+ * Event unpacker for VME_CAEN_V1290.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// VME_CAEN_V1290(geom)
+template<typename __data_src_t>
+void VME_CAEN_V1290::__unpack(__data_src_t &__buffer,uint32 geom)
+{
+  // MEMBER(DATA24 data[32] ZERO_SUPPRESS_MULTI(128));
+  // MARK_COUNT(v1190_start);
+  void *__mark_v1190_start = __buffer._data;
+  // UINT32 header
+  // {
+    //  0_04: geom = MATCH(geom);
+    //  5_26: event_number;
+    // 27_31: 8;
+  // }
+  READ_FROM_BUFFER_FULL(279,uint32 ,header,header.u32,36);
+  CHECK_BITS_EQUAL(276,header.geom,geom);
+  CHECK_BITS_EQUAL(278,header.unnamed_27_31,8);
+  // select several
+
+    // tdc[0] = VME_CAEN_V1290_SUBTDC(tdc=0,event_id=(header.event_number & 0xfff),
+                                   // data=data);
+    // tdc[1] = VME_CAEN_V1290_SUBTDC(tdc=1,event_id=(header.event_number & 0xfff),
+                                   // data=data);
+    // tdc[2] = VME_CAEN_V1290_SUBTDC(tdc=2,event_id=(header.event_number & 0xfff),
+                                   // data=data);
+    // tdc[3] = VME_CAEN_V1290_SUBTDC(tdc=3,event_id=(header.event_number & 0xfff),
+                                   // data=data);
+  for ( ; ; )
+  {
+    if (__buffer.empty()) break;
+    int __match_no = 0;
+    // optimized match 1: VME_CAEN_V1290_SUBTDC tdc[0]: (s32) => (0xff000000,0x08000000)
+    // optimized match 2: VME_CAEN_V1290_SUBTDC tdc[1]: (s32) => (0xff000000,0x09000000)
+    // optimized match 3: VME_CAEN_V1290_SUBTDC tdc[2]: (s32) => (0xff000000,0x0a000000)
+    // optimized match 4: VME_CAEN_V1290_SUBTDC tdc[3]: (s32) => (0xff000000,0x0b000000)
+    {
+    uint32 __match_peek;
+    PEEK_FROM_BUFFER(287,uint32,__match_peek);
+    // differ = 03000000 : 24 25
+    uint32 __match_index = 0 | /* 24,25 */ ((__match_peek >> 24) & 0x00000003);
+    static const sint8 __match_index_array[4] = { 1, 2, 3, 4, };
+    __match_no = __match_index_array[__match_index];
+    // last_subevent_item = 0
+    }
+    if (!__match_no) break;
+    switch (__match_no)
+    {
+      case 1:
+        CHECK_SPURIOUS_MATCH_DECL(283,spurious_match_abort_loop_2,VME_CAEN_V1290_SUBTDC,/*tdc*/0,/*event_id*/(header.event_number & 0xfff)/*,data:member*/);
+        MATCH_PROFILE_COUNT(283,tdc[0]);
+        UNPACK_DECL(283,VME_CAEN_V1290_SUBTDC,tdc[0],/*tdc*/0,/*event_id*/(header.event_number & 0xfff),/*data*/data);
+        break;
+      case 2:
+        CHECK_SPURIOUS_MATCH_DECL(284,spurious_match_abort_loop_2,VME_CAEN_V1290_SUBTDC,/*tdc*/1,/*event_id*/(header.event_number & 0xfff)/*,data:member*/);
+        MATCH_PROFILE_COUNT(284,tdc[1]);
+        UNPACK_DECL(284,VME_CAEN_V1290_SUBTDC,tdc[1],/*tdc*/1,/*event_id*/(header.event_number & 0xfff),/*data*/data);
+        break;
+      case 3:
+        CHECK_SPURIOUS_MATCH_DECL(285,spurious_match_abort_loop_2,VME_CAEN_V1290_SUBTDC,/*tdc*/2,/*event_id*/(header.event_number & 0xfff)/*,data:member*/);
+        MATCH_PROFILE_COUNT(285,tdc[2]);
+        UNPACK_DECL(285,VME_CAEN_V1290_SUBTDC,tdc[2],/*tdc*/2,/*event_id*/(header.event_number & 0xfff),/*data*/data);
+        break;
+      case 4:
+        CHECK_SPURIOUS_MATCH_DECL(286,spurious_match_abort_loop_2,VME_CAEN_V1290_SUBTDC,/*tdc*/3,/*event_id*/(header.event_number & 0xfff)/*,data:member*/);
+        MATCH_PROFILE_COUNT(286,tdc[3]);
+        UNPACK_DECL(286,VME_CAEN_V1290_SUBTDC,tdc[3],/*tdc*/3,/*event_id*/(header.event_number & 0xfff),/*data*/data);
+        break;
+    }
+  }
+  spurious_match_abort_loop_2:;
+  // UINT32 trigger
+  // {
+    //  0_26: time_tag;
+    // 27_31: 17;
+  // }
+  READ_FROM_BUFFER_FULL(293,uint32 ,trigger,trigger.u32,37);
+  CHECK_BITS_EQUAL(292,trigger.unnamed_27_31,17);
+  // MARK_COUNT(v1190_end);
+  void *__mark_v1190_end = __buffer._data;
+  // UINT32 trailer
+  // {
+    //  0_04: geom = CHECK(geom);
+    //  5_19: word_count = CHECK_COUNT(v1190_start,v1190_end,4,4);
+    //    24: tdc_error;
+    //    25: buffer_overflow;
+    //    26: trigger_lost;
+    // 27_31: 16;
+  // }
+  READ_FROM_BUFFER_FULL(305,uint32 ,trailer,trailer.u32,38);
+  CHECK_BITS_EQUAL(299,trailer.geom,geom);
+  CHECK_WORD_COUNT(300,trailer.word_count,v1190_start,v1190_end,4,4);
+  CHECK_BITS_EQUAL(304,trailer.unnamed_27_31,16);
+  CHECK_UNNAMED_BITS_ZERO(305,trailer.u32,0x00f00000);
+}
+FORCE_IMPL_DATA_SRC_FCN_ARG(void,VME_CAEN_V1290::__unpack,uint32 geom);
+
+/** END_UNPACKER ******************************************************/
+/** BEGIN_UNPACKER *****************************************************
+ *
+ * Event unpacker for VME_CAEN_V1290_SHORT_SUBTDC.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// VME_CAEN_V1290_SHORT_SUBTDC(tdc,event_id,data)
+template<typename __data_src_t>
+void VME_CAEN_V1290_SHORT_SUBTDC::__unpack(__data_src_t &__buffer,uint32 tdc
+                                                                 ,uint32 event_id
+                                                                 ,raw_array_multi_zero_suppress<DATA24,DATA24,32,128> &data)
+{
+  // MEMBER(DATA24 data[32] ZERO_SUPPRESS_MULTI(128));
+  // UINT32 ch_data NOENCODE
+  // {
+    //  0_20: value;
+    // 21_23: channel_low;
+    // 24_25: tdc = CHECK(tdc);
+    //    26: trailing;
+    // 27_31: 0;
+    // ENCODE(data[((tdc << 3) | channel_low)],(value=value));
+  // }
+  union
+  {
+    struct
+    {
+#if __BYTE_ORDER == __LITTLE_ENDIAN
+      uint32 value : 21; // 0..20
+      uint32 channel_low : 3; // 21..23
+      uint32 tdc : 2; // 24..25
+      uint32 trailing : 1; // 26
+      uint32 unnamed_27_31 : 5; // 27..31
+#endif
+#if __BYTE_ORDER == __BIG_ENDIAN
+      uint32 unnamed_27_31 : 5; // 27..31
+      uint32 trailing : 1; // 26
+      uint32 tdc : 2; // 24..25
+      uint32 channel_low : 3; // 21..23
+      uint32 value : 21; // 0..20
+#endif
+    };
+    uint32  u32;
+  } ch_data;
+  READ_FROM_BUFFER_FULL(342,uint32 ,ch_data,ch_data.u32,40);
+  CHECK_BITS_EQUAL(322,ch_data.tdc,tdc);
+  CHECK_BITS_EQUAL(332,ch_data.unnamed_27_31,0);
+  {
+    typedef __typeof__(*(&(data))) __array_t;
+    typedef typename __array_t::item_t __item_t;
+    __item_t &__item = data.insert_index(336,((ch_data.tdc << 3) | ch_data.channel_low));
+    __item.value = ch_data.value;
+  }
+}
+FORCE_IMPL_DATA_SRC_FCN_ARG(void,VME_CAEN_V1290_SHORT_SUBTDC::__unpack,uint32 tdc
+                                                                      ,uint32 event_id
+                                                                      ,raw_array_multi_zero_suppress<DATA24,DATA24,32,128> &data);
+
+/** END_UNPACKER ******************************************************/
+/** BEGIN_UNPACKER *****************************************************
+ *
+ * Event unpacker for VME_CAEN_V1290_SHORT_SUBTDC_ERROR.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// VME_CAEN_V1290_SHORT_SUBTDC_ERROR(tdc)
+template<typename __data_src_t>
+void VME_CAEN_V1290_SHORT_SUBTDC_ERROR::__unpack(__data_src_t &__buffer,uint32 tdc)
+{
+  // UINT32 error_flags
+  // {
+    //  0_14: flags;
+    // 24_25: tdc = CHECK(tdc);
+    // 27_31: 4;
+  // }
+  READ_FROM_BUFFER_FULL(353,uint32 ,error_flags,error_flags.u32,42);
+  CHECK_BITS_EQUAL(351,error_flags.tdc,tdc);
+  CHECK_BITS_EQUAL(352,error_flags.unnamed_27_31,4);
+  CHECK_UNNAMED_BITS_ZERO(353,error_flags.u32,0x04ff8000);
+}
+FORCE_IMPL_DATA_SRC_FCN_ARG(void,VME_CAEN_V1290_SHORT_SUBTDC_ERROR::__unpack,uint32 tdc);
+
+/** END_UNPACKER ******************************************************/
+/** BEGIN_UNPACKER *****************************************************
+ *
+ * Event unpacker for VME_CAEN_V1290_SHORT.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// VME_CAEN_V1290_SHORT(geom)
+template<typename __data_src_t>
+void VME_CAEN_V1290_SHORT::__unpack(__data_src_t &__buffer,uint32 geom)
+{
+  // MEMBER(DATA24 data[32] ZERO_SUPPRESS_MULTI(128));
+  // MARK_COUNT(v1190_start);
+  void *__mark_v1190_start = __buffer._data;
+  // UINT32 header
+  // {
+    //  0_04: geom = MATCH(geom);
+    //  5_26: event_number;
+    // 27_31: 8;
+  // }
+  READ_FROM_BUFFER_FULL(368,uint32 ,header,header.u32,44);
+  CHECK_BITS_EQUAL(365,header.geom,geom);
+  CHECK_BITS_EQUAL(367,header.unnamed_27_31,8);
+  // select several
+
+    // tdc[0] = VME_CAEN_V1290_SHORT_SUBTDC(tdc=0,event_id=(header.event_number & 0xfff),
+                                         // data=data);
+    // tdc[1] = VME_CAEN_V1290_SHORT_SUBTDC(tdc=1,event_id=(header.event_number & 0xfff),
+                                         // data=data);
+    // tdc[2] = VME_CAEN_V1290_SHORT_SUBTDC(tdc=2,event_id=(header.event_number & 0xfff),
+                                         // data=data);
+    // tdc[3] = VME_CAEN_V1290_SHORT_SUBTDC(tdc=3,event_id=(header.event_number & 0xfff),
+                                         // data=data);
+    // norevisit err[0] = VME_CAEN_V1290_SHORT_SUBTDC_ERROR(tdc=0);
+    // norevisit err[1] = VME_CAEN_V1290_SHORT_SUBTDC_ERROR(tdc=1);
+    // norevisit err[2] = VME_CAEN_V1290_SHORT_SUBTDC_ERROR(tdc=2);
+    // norevisit err[3] = VME_CAEN_V1290_SHORT_SUBTDC_ERROR(tdc=3);
+  bitsone<4> __visited2;
+  __visited2.clear();
+  for ( ; ; )
+  {
+    if (__buffer.empty()) break;
+    int __match_no = 0;
+    // optimized match 1: VME_CAEN_V1290_SHORT_SUBTDC tdc[0]: (s32) => (0xfb000000,0x00000000)
+    // optimized match 2: VME_CAEN_V1290_SHORT_SUBTDC tdc[1]: (s32) => (0xfb000000,0x01000000)
+    // optimized match 3: VME_CAEN_V1290_SHORT_SUBTDC tdc[2]: (s32) => (0xfb000000,0x02000000)
+    // optimized match 4: VME_CAEN_V1290_SHORT_SUBTDC tdc[3]: (s32) => (0xfb000000,0x03000000)
+    // optimized match 5: VME_CAEN_V1290_SHORT_SUBTDC_ERROR err[0]: (s32) => (0xffff8000,0x20000000)
+    // optimized match 6: VME_CAEN_V1290_SHORT_SUBTDC_ERROR err[1]: (s32) => (0xffff8000,0x21000000)
+    // optimized match 7: VME_CAEN_V1290_SHORT_SUBTDC_ERROR err[2]: (s32) => (0xffff8000,0x22000000)
+    // optimized match 8: VME_CAEN_V1290_SHORT_SUBTDC_ERROR err[3]: (s32) => (0xffff8000,0x23000000)
+    {
+    uint32 __match_peek;
+    PEEK_FROM_BUFFER(381,uint32,__match_peek);
+    // differ = 23000000 : 24 25 29
+    uint32 __match_index = 0 | /* 24,25 */ ((__match_peek >> 24) & 0x00000003) | /* 29,29 */ ((__match_peek >> 27) & 0x00000004);
+    static const sint8 __match_index_array[8] = { 1, 2, 3, 4, 5, 6, 7, 8, };
+    __match_no = __match_index_array[__match_index];
+    // last_subevent_item = 0
+    }
+    if (!__match_no) break;
+    switch (__match_no)
+    {
+      case 1:
+        CHECK_SPURIOUS_MATCH_DECL(372,spurious_match_abort_loop_3,VME_CAEN_V1290_SHORT_SUBTDC,/*tdc*/0,/*event_id*/(header.event_number & 0xfff)/*,data:member*/);
+        MATCH_PROFILE_COUNT(372,tdc[0]);
+        UNPACK_DECL(372,VME_CAEN_V1290_SHORT_SUBTDC,tdc[0],/*tdc*/0,/*event_id*/(header.event_number & 0xfff),/*data*/data);
+        break;
+      case 2:
+        CHECK_SPURIOUS_MATCH_DECL(373,spurious_match_abort_loop_3,VME_CAEN_V1290_SHORT_SUBTDC,/*tdc*/1,/*event_id*/(header.event_number & 0xfff)/*,data:member*/);
+        MATCH_PROFILE_COUNT(373,tdc[1]);
+        UNPACK_DECL(373,VME_CAEN_V1290_SHORT_SUBTDC,tdc[1],/*tdc*/1,/*event_id*/(header.event_number & 0xfff),/*data*/data);
+        break;
+      case 3:
+        CHECK_SPURIOUS_MATCH_DECL(374,spurious_match_abort_loop_3,VME_CAEN_V1290_SHORT_SUBTDC,/*tdc*/2,/*event_id*/(header.event_number & 0xfff)/*,data:member*/);
+        MATCH_PROFILE_COUNT(374,tdc[2]);
+        UNPACK_DECL(374,VME_CAEN_V1290_SHORT_SUBTDC,tdc[2],/*tdc*/2,/*event_id*/(header.event_number & 0xfff),/*data*/data);
+        break;
+      case 4:
+        CHECK_SPURIOUS_MATCH_DECL(375,spurious_match_abort_loop_3,VME_CAEN_V1290_SHORT_SUBTDC,/*tdc*/3,/*event_id*/(header.event_number & 0xfff)/*,data:member*/);
+        MATCH_PROFILE_COUNT(375,tdc[3]);
+        UNPACK_DECL(375,VME_CAEN_V1290_SHORT_SUBTDC,tdc[3],/*tdc*/3,/*event_id*/(header.event_number & 0xfff),/*data*/data);
+        break;
+      case 5:
+        CHECK_SPURIOUS_MATCH_DECL(377,spurious_match_abort_loop_3,VME_CAEN_V1290_SHORT_SUBTDC_ERROR,/*tdc*/0);
+        UNPACK_CHECK_NO_REVISIT(377,VME_CAEN_V1290_SHORT_SUBTDC_ERROR,err[0],__visited2,0);
+        MATCH_PROFILE_COUNT(377,err[0]);
+        UNPACK_DECL(377,VME_CAEN_V1290_SHORT_SUBTDC_ERROR,err[0],/*tdc*/0);
+        break;
+      case 6:
+        CHECK_SPURIOUS_MATCH_DECL(378,spurious_match_abort_loop_3,VME_CAEN_V1290_SHORT_SUBTDC_ERROR,/*tdc*/1);
+        UNPACK_CHECK_NO_REVISIT(378,VME_CAEN_V1290_SHORT_SUBTDC_ERROR,err[1],__visited2,1);
+        MATCH_PROFILE_COUNT(378,err[1]);
+        UNPACK_DECL(378,VME_CAEN_V1290_SHORT_SUBTDC_ERROR,err[1],/*tdc*/1);
+        break;
+      case 7:
+        CHECK_SPURIOUS_MATCH_DECL(379,spurious_match_abort_loop_3,VME_CAEN_V1290_SHORT_SUBTDC_ERROR,/*tdc*/2);
+        UNPACK_CHECK_NO_REVISIT(379,VME_CAEN_V1290_SHORT_SUBTDC_ERROR,err[2],__visited2,2);
+        MATCH_PROFILE_COUNT(379,err[2]);
+        UNPACK_DECL(379,VME_CAEN_V1290_SHORT_SUBTDC_ERROR,err[2],/*tdc*/2);
+        break;
+      case 8:
+        CHECK_SPURIOUS_MATCH_DECL(380,spurious_match_abort_loop_3,VME_CAEN_V1290_SHORT_SUBTDC_ERROR,/*tdc*/3);
+        UNPACK_CHECK_NO_REVISIT(380,VME_CAEN_V1290_SHORT_SUBTDC_ERROR,err[3],__visited2,3);
+        MATCH_PROFILE_COUNT(380,err[3]);
+        UNPACK_DECL(380,VME_CAEN_V1290_SHORT_SUBTDC_ERROR,err[3],/*tdc*/3);
+        break;
+    }
+  }
+  spurious_match_abort_loop_3:;
+  // UINT32 trigger
+  // {
+    //  0_26: time_tag;
+    // 27_31: 17;
+  // }
+  READ_FROM_BUFFER_FULL(387,uint32 ,trigger,trigger.u32,45);
+  CHECK_BITS_EQUAL(386,trigger.unnamed_27_31,17);
+  // MARK_COUNT(v1190_end);
+  void *__mark_v1190_end = __buffer._data;
+  // UINT32 trailer
+  // {
+    //  0_04: geom = CHECK(geom);
+    //  5_19: word_count = CHECK_COUNT(v1190_start,v1190_end,4,4);
+    //    24: tdc_error;
+    //    25: buffer_overflow;
+    //    26: trigger_lost;
+    // 27_31: 16;
+  // }
+  READ_FROM_BUFFER_FULL(399,uint32 ,trailer,trailer.u32,46);
+  CHECK_BITS_EQUAL(393,trailer.geom,geom);
+  CHECK_WORD_COUNT(394,trailer.word_count,v1190_start,v1190_end,4,4);
+  CHECK_BITS_EQUAL(398,trailer.unnamed_27_31,16);
+  CHECK_UNNAMED_BITS_ZERO(399,trailer.u32,0x00f00000);
+}
+FORCE_IMPL_DATA_SRC_FCN_ARG(void,VME_CAEN_V1290_SHORT::__unpack,uint32 geom);
+
+/** END_UNPACKER ******************************************************/
+/** BEGIN_UNPACKER *****************************************************
+ *
+ * Event unpacker for VME_CAEN_V775.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// VME_CAEN_V775(geom,crate)
+template<typename __data_src_t>
+void VME_CAEN_V775::__unpack(__data_src_t &__buffer,uint32 geom,uint32 crate)
+{
+  // MEMBER(DATA12_OVERFLOW data[32] ZERO_SUPPRESS);
+  // UINT32 header NOENCODE
+  // {
+    //  8_13: count;
+    // 16_23: crate = MATCH(crate);
+    // 24_26: 2;
+    // 27_31: geom = MATCH(geom);
+  // }
+  union
+  {
+    struct
+    {
+#if __BYTE_ORDER == __LITTLE_ENDIAN
+      uint32 dummy_0_7 : 8;
+      uint32 count : 6; // 8..13
+      uint32 dummy_14_15 : 2;
+      uint32 crate : 8; // 16..23
+      uint32 unnamed_24_26 : 3; // 24..26
+      uint32 geom : 5; // 27..31
+#endif
+#if __BYTE_ORDER == __BIG_ENDIAN
+      uint32 geom : 5; // 27..31
+      uint32 unnamed_24_26 : 3; // 24..26
+      uint32 crate : 8; // 16..23
+      uint32 dummy_14_15 : 2;
+      uint32 count : 6; // 8..13
+      uint32 dummy_0_7 : 8;
+#endif
+    };
+    uint32  u32;
+  } header;
+  READ_FROM_BUFFER_FULL(137,uint32 ,header,header.u32,48);
+  CHECK_BITS_EQUAL(134,header.crate,crate);
+  CHECK_BITS_EQUAL(135,header.unnamed_24_26,2);
+  CHECK_BITS_EQUAL(136,header.geom,geom);
+  CHECK_UNNAMED_BITS_ZERO(137,header.u32,0x0000c0ff);
+  // list(0<=index<header.count)
+
+  for (uint32 index = 0; index < (uint32) (header.count); ++index)
+  {
+    // UINT32 ch_data NOENCODE
+    // {
+      //  0_11: value;
+      //    12: overflow;
+      //    13: underflow;
+      //    14: valid;
+      // 16_20: channel;
+      // 24_26: 0;
+      // 27_31: geom = CHECK(geom);
+      // ENCODE(data[channel],(value=value,overflow=overflow));
+    // }
+    union
+    {
+      struct
+      {
+#if __BYTE_ORDER == __LITTLE_ENDIAN
+        uint32 value : 12; // 0..11
+        uint32 overflow : 1; // 12
+        uint32 underflow : 1; // 13
+        uint32 valid : 1; // 14
+        uint32 dummy_15 : 1;
+        uint32 channel : 5; // 16..20
+        uint32 dummy_21_23 : 3;
+        uint32 unnamed_24_26 : 3; // 24..26
+        uint32 geom : 5; // 27..31
+#endif
+#if __BYTE_ORDER == __BIG_ENDIAN
+        uint32 geom : 5; // 27..31
+        uint32 unnamed_24_26 : 3; // 24..26
+        uint32 dummy_21_23 : 3;
+        uint32 channel : 5; // 16..20
+        uint32 dummy_15 : 1;
+        uint32 valid : 1; // 14
+        uint32 underflow : 1; // 13
+        uint32 overflow : 1; // 12
+        uint32 value : 12; // 0..11
+#endif
+      };
+      uint32  u32;
+    } ch_data;
+    READ_FROM_BUFFER_FULL(157,uint32 ,ch_data,ch_data.u32,49);
+    CHECK_BITS_EQUAL(153,ch_data.unnamed_24_26,0);
+    CHECK_BITS_EQUAL(154,ch_data.geom,geom);
+    CHECK_UNNAMED_BITS_ZERO(157,ch_data.u32,0x00e08000);
+    {
+      typedef __typeof__(*(&(data))) __array_t;
+      typedef typename __array_t::item_t __item_t;
+      __item_t &__item = data.insert_index(156,ch_data.channel);
+      __item.value = ch_data.value;
+      __item.overflow = ch_data.overflow;
+    }
+  }
+  // UINT32 eob
+  // {
+    //  0_23: event_number;
+    // 24_26: 4;
+    // 27_31: geom = CHECK(geom);
+  // }
+  READ_FROM_BUFFER_FULL(166,uint32 ,eob,eob.u32,50);
+  CHECK_BITS_EQUAL(163,eob.unnamed_24_26,4);
+  CHECK_BITS_EQUAL(164,eob.geom,geom);
+}
+FORCE_IMPL_DATA_SRC_FCN_ARG(void,VME_CAEN_V775::__unpack,uint32 geom,uint32 crate);
+
+/** END_UNPACKER ******************************************************/
+/** BEGIN_UNPACKER *****************************************************
+ *
+ * Event unpacker for VME_CAEN_V830.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// VME_CAEN_V830(geom)
+template<typename __data_src_t>
+void VME_CAEN_V830::__unpack(__data_src_t &__buffer,uint32 geom)
+{
+  // MEMBER(DATA32 data[32] ZERO_SUPPRESS);
+  // UINT32 header
+  // {
+    //  0_15: event_number;
+    // 16_17: ts;
+    // 18_23: count;
+    // 24_25: undefined;
+    //    26: 1;
+    // 27_31: geom = MATCH(geom);
+  // }
+  READ_FROM_BUFFER_FULL(185,uint32 ,header,header.u32,52);
+  CHECK_BITS_EQUAL(183,header.unnamed_26_26,1);
+  CHECK_BITS_EQUAL(184,header.geom,geom);
+  // list(0<=index<header.count)
+
+  for (uint32 index = 0; index < (uint32) (header.count); ++index)
+  {
+    // UINT32 ch_data NOENCODE
+    // {
+      //  0_25: value;
+      //    26: 0;
+      // 27_31: channel;
+      // ENCODE(data[channel],(value=value));
+    // }
+    union
+    {
+      struct
+      {
+#if __BYTE_ORDER == __LITTLE_ENDIAN
+        uint32 value : 26; // 0..25
+        uint32 unnamed_26_26 : 1; // 26
+        uint32 channel : 5; // 27..31
+#endif
+#if __BYTE_ORDER == __BIG_ENDIAN
+        uint32 channel : 5; // 27..31
+        uint32 unnamed_26_26 : 1; // 26
+        uint32 value : 26; // 0..25
+#endif
+      };
+      uint32  u32;
+    } ch_data;
+    READ_FROM_BUFFER_FULL(196,uint32 ,ch_data,ch_data.u32,53);
+    CHECK_BITS_EQUAL(192,ch_data.unnamed_26_26,0);
+    {
+      typedef __typeof__(*(&(data))) __array_t;
+      typedef typename __array_t::item_t __item_t;
+      __item_t &__item = data.insert_index(195,ch_data.channel);
+      __item.value = ch_data.value;
+    }
+  }
+}
+FORCE_IMPL_DATA_SRC_FCN_ARG(void,VME_CAEN_V830::__unpack,uint32 geom);
+
+/** END_UNPACKER ******************************************************/
+/** BEGIN_UNPACKER *****************************************************
+ *
+ * Event unpacker for VME_MESYTEC_MADC32.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// VME_MESYTEC_MADC32(geom)
+template<typename __data_src_t>
+void VME_MESYTEC_MADC32::__unpack(__data_src_t &__buffer,uint32 geom)
+{
+  // MEMBER(DATA14_OVERFLOW data[32] ZERO_SUPPRESS);
+  // MARK_COUNT(start);
+  void *__mark_start = __buffer._data;
+  // UINT32 header NOENCODE
+  // {
+    //  0_11: word_number;
+    // 12_14: adc_resol;
+    //    15: out_form;
+    // 16_23: geom = MATCH(geom);
+    // 24_29: 0;
+    // 30_31: 1;
+  // }
+  union
+  {
+    struct
+    {
+#if __BYTE_ORDER == __LITTLE_ENDIAN
+      uint32 word_number : 12; // 0..11
+      uint32 adc_resol : 3; // 12..14
+      uint32 out_form : 1; // 15
+      uint32 geom : 8; // 16..23
+      uint32 unnamed_24_29 : 6; // 24..29
+      uint32 unnamed_30_31 : 2; // 30..31
+#endif
+#if __BYTE_ORDER == __BIG_ENDIAN
+      uint32 unnamed_30_31 : 2; // 30..31
+      uint32 unnamed_24_29 : 6; // 24..29
+      uint32 geom : 8; // 16..23
+      uint32 out_form : 1; // 15
+      uint32 adc_resol : 3; // 12..14
+      uint32 word_number : 12; // 0..11
+#endif
+    };
+    uint32  u32;
+  } header;
+  READ_FROM_BUFFER_FULL(624,uint32 ,header,header.u32,55);
+  CHECK_BITS_EQUAL(621,header.geom,geom);
+  CHECK_BITS_EQUAL(622,header.unnamed_24_29,0);
+  CHECK_BITS_EQUAL(623,header.unnamed_30_31,1);
+  // several UINT32 ch_data NOENCODE
+  // {
+    //  0_12: value;
+    //    14: outofrange;
+    // 16_20: channel;
+    // 21_29: 32;
+    // 30_31: 0;
+    // ENCODE(data[channel],(value=value,overflow=outofrange));
+  // }
+  {
+    size_t __run = __buffer.run_uint32(0xffe0a000,0x04000000);
+    for ( ; __run; __run--) {
+    union
+    {
+      struct
+      {
+#if __BYTE_ORDER == __LITTLE_ENDIAN
+        uint32 value : 13; // 0..12
+        uint32 dummy_13 : 1;
+        uint32 outofrange : 1; // 14
+        uint32 dummy_15 : 1;
+        uint32 channel : 5; // 16..20
+        uint32 unnamed_21_29 : 9; // 21..29
+        uint32 unnamed_30_31 : 2; // 30..31
+#endif
+#if __BYTE_ORDER == __BIG_ENDIAN
+        uint32 unnamed_30_31 : 2; // 30..31
+        uint32 unnamed_21_29 : 9; // 21..29
+        uint32 channel : 5; // 16..20
+        uint32 dummy_15 : 1;
+        uint32 outofrange : 1; // 14
+        uint32 dummy_13 : 1;
+        uint32 value : 13; // 0..12
+#endif
+      };
+      uint32  u32;
+    } ch_data;
+    PEEK_FROM_BUFFER_FULL(635,uint32 ,ch_data,ch_data.u32,56);
+    __buffer.advance(sizeof(ch_data.u32));
+    {
+      typedef __typeof__(*(&(data))) __array_t;
+      typedef typename __array_t::item_t __item_t;
+      __item_t &__item = data.insert_index(634,ch_data.channel);
+      __item.value = ch_data.value;
+      __item.overflow = ch_data.outofrange;
+    }
+    }
+  }
+  for ( ; ; ) {
+  union
+  {
+    struct
+    {
+#if __BYTE_ORDER == __LITTLE_ENDIAN
+      uint32 value : 13; // 0..12
+      uint32 dummy_13 : 1;
+      uint32 outofrange : 1; // 14
+      uint32 dummy_15 : 1;
+      uint32 channel : 5; // 16..20
+      uint32 unnamed_21_29 : 9; // 21..29
+      uint32 unnamed_30_31 : 2; // 30..31
+#endif
+#if __BYTE_ORDER == __BIG_ENDIAN
+      uint32 unnamed_30_31 : 2; // 30..31
+      uint32 unnamed_21_29 : 9; // 21..29
+      uint32 channel : 5; // 16..20
+      uint32 dummy_15 : 1;
+      uint32 outofrange : 1; // 14
+      uint32 dummy_13 : 1;
+      uint32 value : 13; // 0..12
+#endif
+    };
+    uint32  u32;
+  } ch_data;
+  if (__buffer.empty()) goto data_done_4;
+  PEEK_FROM_BUFFER_FULL(635,uint32 ,ch_data,ch_data.u32,56);
+  CHECK_JUMP_BITS_EQUAL(631,ch_data.unnamed_21_29,32,data_done_4);
+  CHECK_JUMP_BITS_EQUAL(632,ch_data.unnamed_30_31,0,data_done_4);
+  CHECK_JUMP_UNNAMED_BITS_ZERO(635,ch_data.u32,0x0000a000,data_done_4);
+  __buffer.advance(sizeof(ch_data.u32));
+  {
+    typedef __typeof__(*(&(data))) __array_t;
+    typedef typename __array_t::item_t __item_t;
+    __item_t &__item = data.insert_index(634,ch_data.channel);
+    __item.value = ch_data.value;
+    __item.overflow = ch_data.outofrange;
+  }
+  }
+  data_done_4:;
+  // optional UINT32 filler NOENCODE
+  // {
+    //  0_31: 0;
+  // }
+  union
+  {
+    struct
+    {
+#if __BYTE_ORDER == __LITTLE_ENDIAN
+      uint32 unnamed_0_31 : 32; // 0..31
+#endif
+#if __BYTE_ORDER == __BIG_ENDIAN
+      uint32 unnamed_0_31 : 32; // 0..31
+#endif
+    };
+    uint32  u32;
+  } filler;
+  if (__buffer.empty()) goto data_done_5;
+  PEEK_FROM_BUFFER_FULL(641,uint32 ,filler,filler.u32,57);
+  CHECK_JUMP_BITS_EQUAL(640,filler.unnamed_0_31,0,data_done_5);
+  __buffer.advance(sizeof(filler.u32));
+  data_done_5:;
+  // UINT32 end_of_event
+  // {
+    //  0_29: counter;
+    // 30_31: 3;
+  // }
+  READ_FROM_BUFFER_FULL(647,uint32 ,end_of_event,end_of_event.u32,58);
+  CHECK_BITS_EQUAL(646,end_of_event.unnamed_30_31,3);
+  // MARK_COUNT(end);
+  void *__mark_end = __buffer._data;
+  // CHECK_COUNT(header.word_number,start,end,( - 4),4)
+  CHECK_WORD_COUNT(650,header.word_number,start,end,( - 4),4);
+}
+FORCE_IMPL_DATA_SRC_FCN_ARG(void,VME_MESYTEC_MADC32::__unpack,uint32 geom);
+
+/** END_UNPACKER ******************************************************/
+/** BEGIN_UNPACKER *****************************************************
+ *
+ * Event unpacker for VME_MESYTEC_MDPP16.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// VME_MESYTEC_MDPP16(geom)
+template<typename __data_src_t>
+void VME_MESYTEC_MDPP16::__unpack(__data_src_t &__buffer,uint32 geom)
+{
+  // MEMBER(DATA16_OVERFLOW adc[16] ZERO_SUPPRESS_MULTI(20));
+  // MEMBER(DATA16_OVERFLOW tdc[16] ZERO_SUPPRESS_MULTI(20));
+  // MEMBER(DATA16_OVERFLOW trig_tdc[16] ZERO_SUPPRESS_MULTI(20));
+  // MEMBER(DATA16_OVERFLOW adc_short[16] ZERO_SUPPRESS_MULTI(20));
+  // MARK_COUNT(start);
+  void *__mark_start = __buffer._data;
+  // UINT32 header NOENCODE
+  // {
+    //  0_09: word_number;
+    // 10_12: adc_res;
+    // 13_15: tdc_res;
+    // 16_23: geom = MATCH(geom);
+    // 24_29: 0;
+    // 30_31: 1;
+  // }
+  union
+  {
+    struct
+    {
+#if __BYTE_ORDER == __LITTLE_ENDIAN
+      uint32 word_number : 10; // 0..9
+      uint32 adc_res : 3; // 10..12
+      uint32 tdc_res : 3; // 13..15
+      uint32 geom : 8; // 16..23
+      uint32 unnamed_24_29 : 6; // 24..29
+      uint32 unnamed_30_31 : 2; // 30..31
+#endif
+#if __BYTE_ORDER == __BIG_ENDIAN
+      uint32 unnamed_30_31 : 2; // 30..31
+      uint32 unnamed_24_29 : 6; // 24..29
+      uint32 geom : 8; // 16..23
+      uint32 tdc_res : 3; // 13..15
+      uint32 adc_res : 3; // 10..12
+      uint32 word_number : 10; // 0..9
+#endif
+    };
+    uint32  u32;
+  } header;
+  READ_FROM_BUFFER_FULL(671,uint32 ,header,header.u32,60);
+  CHECK_BITS_EQUAL(668,header.geom,geom);
+  CHECK_BITS_EQUAL(669,header.unnamed_24_29,0);
+  CHECK_BITS_EQUAL(670,header.unnamed_30_31,1);
+  // several UINT32 ch_data NOENCODE
+  // {
+    //  0_15: value;
+    // 16_19: channel;
+    // 20_21: ch_kind;
+    //    22: overflow;
+    //    23: pileup;
+    // 24_27: 0;
+    // 28_31: 1;
+    // if((ch_kind == 0))
+    // {
+      // ENCODE(adc[channel],(value=value,overflow=overflow,pileup=pileup));
+    // }
+    // if((ch_kind == 1))
+    // {
+      // ENCODE(tdc[channel],(value=value,overflow=overflow,pileup=pileup));
+    // }
+    // if((ch_kind == 2))
+    // {
+      // ENCODE(trig_tdc[channel],(value=value,overflow=overflow,pileup=pileup));
+    // }
+    // if((ch_kind == 3))
+    // {
+      // ENCODE(adc_short[channel],(value=value,overflow=overflow,pileup=pileup));
+    // }
+  // }
+  {
+    size_t __run = __buffer.run_uint32(0xff000000,0x10000000);
+    for ( ; __run; __run--) {
+    union
+    {
+      struct
+      {
+#if __BYTE_ORDER == __LITTLE_ENDIAN
+        uint32 value : 16; // 0..15
+        uint32 channel : 4; // 16..19
+        uint32 ch_kind : 2; // 20..21
+        uint32 overflow : 1; // 22
+        uint32 pileup : 1; // 23
+        uint32 unnamed_24_27 : 4; // 24..27
+        uint32 unnamed_28_31 : 4; // 28..31
+#endif
+#if __BYTE_ORDER == __BIG_ENDIAN
+        uint32 unnamed_28_31 : 4; // 28..31
+        uint32 unnamed_24_27 : 4; // 24..27
+        uint32 pileup : 1; // 23
+        uint32 overflow : 1; // 22
+        uint32 ch_kind : 2; // 20..21
+        uint32 channel : 4; // 16..19
+        uint32 value : 16; // 0..15
+#endif
+      };
+      uint32  u32;
+    } ch_data;
+    PEEK_FROM_BUFFER_FULL(699,uint32 ,ch_data,ch_data.u32,61);
+    __buffer.advance(sizeof(ch_data.u32));
+    {
+      if ((ch_data.ch_kind == 0))
+      {
+        typedef __typeof__(*(&(adc))) __array_t;
+        typedef typename __array_t::item_t __item_t;
+        __item_t &__item = adc.insert_index(685,ch_data.channel);
+        __item.value = ch_data.value;
+        __item.overflow = ch_data.overflow;
+        __item.pileup = ch_data.pileup;
+      }
+      if ((ch_data.ch_kind == 1))
+      {
+        typedef __typeof__(*(&(tdc))) __array_t;
+        typedef typename __array_t::item_t __item_t;
+        __item_t &__item = tdc.insert_index(689,ch_data.channel);
+        __item.value = ch_data.value;
+        __item.overflow = ch_data.overflow;
+        __item.pileup = ch_data.pileup;
+      }
+      if ((ch_data.ch_kind == 2))
+      {
+        typedef __typeof__(*(&(trig_tdc))) __array_t;
+        typedef typename __array_t::item_t __item_t;
+        __item_t &__item = trig_tdc.insert_index(693,ch_data.channel);
+        __item.value = ch_data.value;
+        __item.overflow = ch_data.overflow;
+        __item.pileup = ch_data.pileup;
+      }
+      if ((ch_data.ch_kind == 3))
+      {
+        typedef __typeof__(*(&(adc_short))) __array_t;
+        typedef typename __array_t::item_t __item_t;
+        __item_t &__item = adc_short.insert_index(697,ch_data.channel);
+        __item.value = ch_data.value;
+        __item.overflow = ch_data.overflow;
+        __item.pileup = ch_data.pileup;
+      }
+    }
+    }
+  }
+  for ( ; ; ) {
+  union
+  {
+    struct
+    {
+#if __BYTE_ORDER == __LITTLE_ENDIAN
+      uint32 value : 16; // 0..15
+      uint32 channel : 4; // 16..19
+      uint32 ch_kind : 2; // 20..21
+      uint32 overflow : 1; // 22
+      uint32 pileup : 1; // 23
+      uint32 unnamed_24_27 : 4; // 24..27
+      uint32 unnamed_28_31 : 4; // 28..31
+#endif
+#if __BYTE_ORDER == __BIG_ENDIAN
+      uint32 unnamed_28_31 : 4; // 28..31
+      uint32 unnamed_24_27 : 4; // 24..27
+      uint32 pileup : 1; // 23
+      uint32 overflow : 1; // 22
+      uint32 ch_kind : 2; // 20..21
+      uint32 channel : 4; // 16..19
+      uint32 value : 16; // 0..15
+#endif
+    };
+    uint32  u32;
+  } ch_data;
+  if (__buffer.empty()) goto data_done_6;
+  PEEK_FROM_BUFFER_FULL(699,uint32 ,ch_data,ch_data.u32,61);
+  CHECK_JUMP_BITS_EQUAL(680,ch_data.unnamed_24_27,0,data_done_6);
+  CHECK_JUMP_BITS_EQUAL(681,ch_data.unnamed_28_31,1,data_done_6);
+  __buffer.advance(sizeof(ch_data.u32));
+  {
+    if ((ch_data.ch_kind == 0))
+    {
+      typedef __typeof__(*(&(adc))) __array_t;
+      typedef typename __array_t::item_t __item_t;
+      __item_t &__item = adc.insert_index(685,ch_data.channel);
+      __item.value = ch_data.value;
+      __item.overflow = ch_data.overflow;
+      __item.pileup = ch_data.pileup;
+    }
+    if ((ch_data.ch_kind == 1))
+    {
+      typedef __typeof__(*(&(tdc))) __array_t;
+      typedef typename __array_t::item_t __item_t;
+      __item_t &__item = tdc.insert_index(689,ch_data.channel);
+      __item.value = ch_data.value;
+      __item.overflow = ch_data.overflow;
+      __item.pileup = ch_data.pileup;
+    }
+    if ((ch_data.ch_kind == 2))
+    {
+      typedef __typeof__(*(&(trig_tdc))) __array_t;
+      typedef typename __array_t::item_t __item_t;
+      __item_t &__item = trig_tdc.insert_index(693,ch_data.channel);
+      __item.value = ch_data.value;
+      __item.overflow = ch_data.overflow;
+      __item.pileup = ch_data.pileup;
+    }
+    if ((ch_data.ch_kind == 3))
+    {
+      typedef __typeof__(*(&(adc_short))) __array_t;
+      typedef typename __array_t::item_t __item_t;
+      __item_t &__item = adc_short.insert_index(697,ch_data.channel);
+      __item.value = ch_data.value;
+      __item.overflow = ch_data.overflow;
+      __item.pileup = ch_data.pileup;
+    }
+  }
+  }
+  data_done_6:;
+  // several UINT32 fill_word NOENCODE
+  // {
+    //  0_31: 0;
+  // }
+  {
+    size_t __run = __buffer.run_uint32(0xffffffff,0x00000000);
+    for ( ; __run; __run--) {
+    union
+    {
+      struct
+      {
+#if __BYTE_ORDER == __LITTLE_ENDIAN
+        uint32 unnamed_0_31 : 32; // 0..31
+#endif
+#if __BYTE_ORDER == __BIG_ENDIAN
+        uint32 unnamed_0_31 : 32; // 0..31
+#endif
+      };
+      uint32  u32;
+    } fill_word;
+    PEEK_FROM_BUFFER_FULL(704,uint32 ,fill_word,fill_word.u32,62);
+    __buffer.advance(sizeof(fill_word.u32));
+    }
+  }
+  for ( ; ; ) {
+  union
+  {
+    struct
+    {
+#if __BYTE_ORDER == __LITTLE_ENDIAN
+      uint32 unnamed_0_31 : 32; // 0..31
+#endif
+#if __BYTE_ORDER == __BIG_ENDIAN
+      uint32 unnamed_0_31 : 32; // 0..31
+#endif
+    };
+    uint32  u32;
+  } fill_word;
+  if (__buffer.empty()) goto data_done_7;
+  PEEK_FROM_BUFFER_FULL(704,uint32 ,fill_word,fill_word.u32,62);
+  CHECK_JUMP_BITS_EQUAL(703,fill_word.unnamed_0_31,0,data_done_7);
+  __buffer.advance(sizeof(fill_word.u32));
+  }
+  data_done_7:;
+  // UINT32 end_of_event
+  // {
+    //  0_29: counter;
+    // 30_31: 3;
+  // }
+  READ_FROM_BUFFER_FULL(710,uint32 ,end_of_event,end_of_event.u32,63);
+  CHECK_BITS_EQUAL(709,end_of_event.unnamed_30_31,3);
+  // MARK_COUNT(end);
+  void *__mark_end = __buffer._data;
+  // CHECK_COUNT(header.word_number,start,end,( - 4),4)
+  CHECK_WORD_COUNT(713,header.word_number,start,end,( - 4),4);
+}
+FORCE_IMPL_DATA_SRC_FCN_ARG(void,VME_MESYTEC_MDPP16::__unpack,uint32 geom);
+
+/** END_UNPACKER ******************************************************/
+/** BEGIN_UNPACKER *****************************************************
+ *
+ * Event unpacker for IS446_VME.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// SUBEVENT(IS446_VME)
+template<typename __data_src_t>
+void IS446_VME::__unpack(__data_src_t &__buffer)
+{
+  // UINT32 dummy_header NOENCODE
+  // {
+    //  0_31: 0xfefefefe;
+  // }
+  union
+  {
+    struct
+    {
+#if __BYTE_ORDER == __LITTLE_ENDIAN
+      uint32 unnamed_0_31 : 32; // 0..31
+#endif
+#if __BYTE_ORDER == __BIG_ENDIAN
+      uint32 unnamed_0_31 : 32; // 0..31
+#endif
+    };
+    uint32  u32;
+  } dummy_header;
+  READ_FROM_BUFFER_FULL(725,uint32 ,dummy_header,dummy_header.u32,65);
+  CHECK_BITS_EQUAL(724,dummy_header.unnamed_0_31,0xfefefefe);
+  // select several
+
+    // norevisit scaler[0] = VME_CAEN_V830(geom=31);
+    // norevisit adc[0] = VME_CAEN_V775(geom=31,crate=1);
+    // norevisit adc[1] = VME_CAEN_V775(geom=31,crate=2);
+    // norevisit adc[2] = VME_CAEN_V775(geom=31,crate=3);
+    // norevisit adc[3] = VME_CAEN_V775(geom=31,crate=4);
+    // norevisit adc[4] = VME_CAEN_V775(geom=31,crate=5);
+    // norevisit adc[5] = VME_CAEN_V775(geom=31,crate=6);
+    // norevisit adc[6] = VME_CAEN_V775(geom=31,crate=7);
+    // norevisit tdc[0] = VME_CAEN_V775(geom=31,crate=8);
+    // norevisit tdc[1] = VME_CAEN_V775(geom=31,crate=9);
+    // norevisit tdc[2] = VME_CAEN_V775(geom=31,crate=10);
+    // norevisit tdc[3] = VME_CAEN_V775(geom=31,crate=11);
+    // norevisit tdc[4] = VME_CAEN_V775(geom=31,crate=12);
+  bitsone<13> __visited3;
+  __visited3.clear();
+  for ( ; ; )
+  {
+    if (__buffer.empty()) break;
+    int __match_no = 0;
+    // optimized match 1: VME_CAEN_V830 scaler[0]: (s32) => (0xfc000000,0xfc000000)
+    // optimized match 2: VME_CAEN_V775 adc[0]: (s32) => (0xffffc0ff,0xfa010000)
+    // optimized match 3: VME_CAEN_V775 adc[1]: (s32) => (0xffffc0ff,0xfa020000)
+    // optimized match 4: VME_CAEN_V775 adc[2]: (s32) => (0xffffc0ff,0xfa030000)
+    // optimized match 5: VME_CAEN_V775 adc[3]: (s32) => (0xffffc0ff,0xfa040000)
+    // optimized match 6: VME_CAEN_V775 adc[4]: (s32) => (0xffffc0ff,0xfa050000)
+    // optimized match 7: VME_CAEN_V775 adc[5]: (s32) => (0xffffc0ff,0xfa060000)
+    // optimized match 8: VME_CAEN_V775 adc[6]: (s32) => (0xffffc0ff,0xfa070000)
+    // optimized match 9: VME_CAEN_V775 tdc[0]: (s32) => (0xffffc0ff,0xfa080000)
+    // optimized match 10: VME_CAEN_V775 tdc[1]: (s32) => (0xffffc0ff,0xfa090000)
+    // optimized match 11: VME_CAEN_V775 tdc[2]: (s32) => (0xffffc0ff,0xfa0a0000)
+    // optimized match 12: VME_CAEN_V775 tdc[3]: (s32) => (0xffffc0ff,0xfa0b0000)
+    // optimized match 13: VME_CAEN_V775 tdc[4]: (s32) => (0xffffc0ff,0xfa0c0000)
+    {
+    uint32 __match_peek;
+    PEEK_FROM_BUFFER(744,uint32,__match_peek);
+    // differ = 060f0000 : 16 17 18 19 25 26
+    uint32 __match_index = 0 | /* 16,19 */ ((__match_peek >> 16) & 0x0000000f) | /* 25,26 */ ((__match_peek >> 21) & 0x00000030);
+    static const sint8 __match_index_array[64] = { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, };
+    __match_no = __match_index_array[__match_index];
+    // last_subevent_item = 0
+    }
+    if (!__match_no) break;
+    switch (__match_no)
+    {
+      case 1:
+        CHECK_SPURIOUS_MATCH_DECL(729,spurious_match_abort_loop_4,VME_CAEN_V830,/*geom*/31);
+        UNPACK_CHECK_NO_REVISIT(729,VME_CAEN_V830,scaler[0],__visited3,0);
+        MATCH_PROFILE_COUNT(729,scaler[0]);
+        UNPACK_DECL(729,VME_CAEN_V830,scaler[0],/*geom*/31);
+        break;
+      case 2:
+        CHECK_SPURIOUS_MATCH_DECL(731,spurious_match_abort_loop_4,VME_CAEN_V775,/*geom*/31,/*crate*/1);
+        UNPACK_CHECK_NO_REVISIT(731,VME_CAEN_V775,adc[0],__visited3,1);
+        MATCH_PROFILE_COUNT(731,adc[0]);
+        UNPACK_DECL(731,VME_CAEN_V775,adc[0],/*geom*/31,/*crate*/1);
+        break;
+      case 3:
+        CHECK_SPURIOUS_MATCH_DECL(732,spurious_match_abort_loop_4,VME_CAEN_V775,/*geom*/31,/*crate*/2);
+        UNPACK_CHECK_NO_REVISIT(732,VME_CAEN_V775,adc[1],__visited3,2);
+        MATCH_PROFILE_COUNT(732,adc[1]);
+        UNPACK_DECL(732,VME_CAEN_V775,adc[1],/*geom*/31,/*crate*/2);
+        break;
+      case 4:
+        CHECK_SPURIOUS_MATCH_DECL(733,spurious_match_abort_loop_4,VME_CAEN_V775,/*geom*/31,/*crate*/3);
+        UNPACK_CHECK_NO_REVISIT(733,VME_CAEN_V775,adc[2],__visited3,3);
+        MATCH_PROFILE_COUNT(733,adc[2]);
+        UNPACK_DECL(733,VME_CAEN_V775,adc[2],/*geom*/31,/*crate*/3);
+        break;
+      case 5:
+        CHECK_SPURIOUS_MATCH_DECL(734,spurious_match_abort_loop_4,VME_CAEN_V775,/*geom*/31,/*crate*/4);
+        UNPACK_CHECK_NO_REVISIT(734,VME_CAEN_V775,adc[3],__visited3,4);
+        MATCH_PROFILE_COUNT(734,adc[3]);
+        UNPACK_DECL(734,VME_CAEN_V775,adc[3],/*geom*/31,/*crate*/4);
+        break;
+      case 6:
+        CHECK_SPURIOUS_MATCH_DECL(735,spurious_match_abort_loop_4,VME_CAEN_V775,/*geom*/31,/*crate*/5);
+        UNPACK_CHECK_NO_REVISIT(735,VME_CAEN_V775,adc[4],__visited3,5);
+        MATCH_PROFILE_COUNT(735,adc[4]);
+        UNPACK_DECL(735,VME_CAEN_V775,adc[4],/*geom*/31,/*crate*/5);
+        break;
+      case 7:
+        CHECK_SPURIOUS_MATCH_DECL(736,spurious_match_abort_loop_4,VME_CAEN_V775,/*geom*/31,/*crate*/6);
+        UNPACK_CHECK_NO_REVISIT(736,VME_CAEN_V775,adc[5],__visited3,6);
+        MATCH_PROFILE_COUNT(736,adc[5]);
+        UNPACK_DECL(736,VME_CAEN_V775,adc[5],/*geom*/31,/*crate*/6);
+        break;
+      case 8:
+        CHECK_SPURIOUS_MATCH_DECL(737,spurious_match_abort_loop_4,VME_CAEN_V775,/*geom*/31,/*crate*/7);
+        UNPACK_CHECK_NO_REVISIT(737,VME_CAEN_V775,adc[6],__visited3,7);
+        MATCH_PROFILE_COUNT(737,adc[6]);
+        UNPACK_DECL(737,VME_CAEN_V775,adc[6],/*geom*/31,/*crate*/7);
+        break;
+      case 9:
+        CHECK_SPURIOUS_MATCH_DECL(739,spurious_match_abort_loop_4,VME_CAEN_V775,/*geom*/31,/*crate*/8);
+        UNPACK_CHECK_NO_REVISIT(739,VME_CAEN_V775,tdc[0],__visited3,8);
+        MATCH_PROFILE_COUNT(739,tdc[0]);
+        UNPACK_DECL(739,VME_CAEN_V775,tdc[0],/*geom*/31,/*crate*/8);
+        break;
+      case 10:
+        CHECK_SPURIOUS_MATCH_DECL(740,spurious_match_abort_loop_4,VME_CAEN_V775,/*geom*/31,/*crate*/9);
+        UNPACK_CHECK_NO_REVISIT(740,VME_CAEN_V775,tdc[1],__visited3,9);
+        MATCH_PROFILE_COUNT(740,tdc[1]);
+        UNPACK_DECL(740,VME_CAEN_V775,tdc[1],/*geom*/31,/*crate*/9);
+        break;
+      case 11:
+        CHECK_SPURIOUS_MATCH_DECL(741,spurious_match_abort_loop_4,VME_CAEN_V775,/*geom*/31,/*crate*/10);
+        UNPACK_CHECK_NO_REVISIT(741,VME_CAEN_V775,tdc[2],__visited3,10);
+        MATCH_PROFILE_COUNT(741,tdc[2]);
+        UNPACK_DECL(741,VME_CAEN_V775,tdc[2],/*geom*/31,/*crate*/10);
+        break;
+      case 12:
+        CHECK_SPURIOUS_MATCH_DECL(742,spurious_match_abort_loop_4,VME_CAEN_V775,/*geom*/31,/*crate*/11);
+        UNPACK_CHECK_NO_REVISIT(742,VME_CAEN_V775,tdc[3],__visited3,11);
+        MATCH_PROFILE_COUNT(742,tdc[3]);
+        UNPACK_DECL(742,VME_CAEN_V775,tdc[3],/*geom*/31,/*crate*/11);
+        break;
+      case 13:
+        CHECK_SPURIOUS_MATCH_DECL(743,spurious_match_abort_loop_4,VME_CAEN_V775,/*geom*/31,/*crate*/12);
+        UNPACK_CHECK_NO_REVISIT(743,VME_CAEN_V775,tdc[4],__visited3,12);
+        MATCH_PROFILE_COUNT(743,tdc[4]);
+        UNPACK_DECL(743,VME_CAEN_V775,tdc[4],/*geom*/31,/*crate*/12);
+        break;
+    }
+  }
+  spurious_match_abort_loop_4:;
+  // UINT32 dummy_footer NOENCODE
+  // {
+    //  0_31: 0xefefefef;
+  // }
+  union
+  {
+    struct
+    {
+#if __BYTE_ORDER == __LITTLE_ENDIAN
+      uint32 unnamed_0_31 : 32; // 0..31
+#endif
+#if __BYTE_ORDER == __BIG_ENDIAN
+      uint32 unnamed_0_31 : 32; // 0..31
+#endif
+    };
+    uint32  u32;
+  } dummy_footer;
+  READ_FROM_BUFFER_FULL(749,uint32 ,dummy_footer,dummy_footer.u32,66);
+  CHECK_BITS_EQUAL(748,dummy_footer.unnamed_0_31,0xefefefef);
+  // UINT32 garbage_footer NOENCODE
+  // {
+    //  0_31: garbage;
+  // }
+  union
+  {
+    struct
+    {
+#if __BYTE_ORDER == __LITTLE_ENDIAN
+      uint32 garbage : 32; // 0..31
+#endif
+#if __BYTE_ORDER == __BIG_ENDIAN
+      uint32 garbage : 32; // 0..31
+#endif
+    };
+    uint32  u32;
+  } garbage_footer;
+  READ_FROM_BUFFER_FULL(758,uint32 ,garbage_footer,garbage_footer.u32,67);
+}
+FORCE_IMPL_DATA_SRC_FCN(void,IS446_VME::__unpack);
+
+/** END_UNPACKER ******************************************************/
+/** BEGIN_UNPACKER *****************************************************
+ *
+ * Event unpacker for IS446_VME2.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// SUBEVENT(IS446_VME2)
+template<typename __data_src_t>
+void IS446_VME2::__unpack(__data_src_t &__buffer)
+{
+}
+FORCE_IMPL_DATA_SRC_FCN(void,IS446_VME2::__unpack);
+
+/** END_UNPACKER ******************************************************/
+/** BEGIN_UNPACKER *****************************************************
+ *
+ * Event unpacker for EVENT.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// EVENT
+template<typename __data_src_t>
+int unpack_event::__unpack_subevent(subevent_header *__header,__data_src_t &__buffer)
+  // vme = IS446_VME(type=10,subtype=1,subcrate=0);
+  // vme2 = IS446_VME2(type=10,subtype=1,subcrate=1);
+{
+  int __match_no = 0;
+  SUBEVENT_MATCH_CACHE_LOOKUP(__match_no)
+  {
+    MATCH_SUBEVENT_DECL(769,__match_no,1,((VES10_1_type==10)&&(VES10_1_subtype==1)&&(VES10_1_subcrate==0)),vme);
+    MATCH_SUBEVENT_DECL(770,__match_no,2,((VES10_1_type==10)&&(VES10_1_subtype==1)&&(VES10_1_subcrate==1)),vme2);
+    SUBEVENT_MATCH_CACHE_STORE(__match_no);
+  }
+  if (!__match_no) return 0;
+  switch (__match_no)
+  {
+    case 1:
+      UNPACK_SUBEVENT_CHECK_NO_REVISIT(769,IS446_VME,vme,0);
+      UNPACK_SUBEVENT_DECL(769,0,IS446_VME,vme);
+      break;
+    case 2:
+      UNPACK_SUBEVENT_CHECK_NO_REVISIT(770,IS446_VME2,vme2,1);
+      UNPACK_SUBEVENT_DECL(770,0,IS446_VME2,vme2);
+      break;
+  }
+  return 0;
+}
+FORCE_IMPL_DATA_SRC_FCN_HDR(int,unpack_event::__unpack_subevent);
+
+/** END_UNPACKER ******************************************************/
+/** BEGIN_UNPACKER *****************************************************
+ *
+ * Event unpacker for EVENT.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// STICKY_EVENT
+template<typename __data_src_t>
+int unpack_sticky_event::__unpack_subevent(subevent_header *__header,__data_src_t &__buffer)
+{
+  int __match_no = 0;
+  SUBEVENT_MATCH_CACHE_LOOKUP(__match_no)
+  {
+    SUBEVENT_MATCH_CACHE_STORE(__match_no);
+  }
+  if (!__match_no) return 0;
+  switch (__match_no)
+  {
+  }
+  return 0;
+}
+FORCE_IMPL_DATA_SRC_FCN_HDR(int,unpack_sticky_event::__unpack_subevent);
+
+/** END_UNPACKER ******************************************************/
+/** BEGIN_UNPACKER_DEFINES *********************************************
+ *
+ * Control
+ *
+ * Do not edit - automatically generated.
+ */
+
+#define STICKY_EVENT_IS_NONTRIVIAL  0
+
+
+/** END_UNPACKER_DEFINES **********************************************/
@@ -0,0 +1,81 @@
+/** BEGIN_FUNCTION_CALL_PER_MEMBER *************************************
+ *
+ * Recursive function calls per member.
+ *
+ * Do not edit - automatically generated.
+ */
+
+#include "gen/default_fcncall_define.hh"
+
+#ifndef USER_DEF_hit_event_DSSSD_one
+FCNCALL_TEMPLATE
+FCNCALL_RET_TYPE FCNCALL_CLASS_NAME(hit_event_DSSSD_one)::FCNCALL_NAME(hit_event_DSSSD_one)
+{
+  FCNCALL_INIT;
+  // float T;
+  {
+  FCNCALL_SUBNAME("T");
+  { FCNCALL_CALL_CTRL_WRAP(T,FCNCALL_CALL_TYPE(float,T)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // float E;
+  {
+  FCNCALL_SUBNAME("E");
+  { FCNCALL_CALL_CTRL_WRAP(E,FCNCALL_CALL_TYPE(float,E)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // float X;
+  {
+  FCNCALL_SUBNAME("X");
+  { FCNCALL_CALL_CTRL_WRAP(X,FCNCALL_CALL_TYPE(float,X)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // float Y;
+  {
+  FCNCALL_SUBNAME("Y");
+  { FCNCALL_CALL_CTRL_WRAP(Y,FCNCALL_CALL_TYPE(float,Y)); }
+  FCNCALL_SUBNAME_END;
+  }
+  FCNCALL_RET;
+}
+#endif//USER_DEF_hit_event_DSSSD_one
+
+#ifndef USER_DEF_hit_event_DSSSD
+FCNCALL_TEMPLATE
+FCNCALL_RET_TYPE FCNCALL_CLASS_NAME(hit_event_DSSSD)::FCNCALL_NAME(hit_event_DSSSD)
+{
+  FCNCALL_INIT;
+  // raw_list_zero_suppress<hit_event_DSSSD_one,hit_event_DSSSD_one,32> hits;
+  {
+  FCNCALL_SUBNAME("hits");
+  { FCNCALL_CALL_CTRL_WRAP(hits,hits.FCNCALL_CALL(hits)); }
+  FCNCALL_SUBNAME_END;
+  }
+  FCNCALL_RET;
+}
+#endif//USER_DEF_hit_event_DSSSD
+
+#ifndef USER_DEF_hit_event_is446
+FCNCALL_TEMPLATE
+FCNCALL_RET_TYPE FCNCALL_CLASS_NAME(hit_event_is446)::FCNCALL_NAME(hit_event_is446)
+{
+  FCNCALL_INIT;
+  // hit_event_DSSSD DSSSD[3];
+  {
+  FCNCALL_SUBNAME("DSSSD");
+  FCNCALL_FOR(__i0,3)
+  {
+    FCNCALL_SUBINDEX(__i0);
+    { FCNCALL_CALL_CTRL_WRAP_ARRAY(DSSSD__i0,,__i0,DSSSD[__i0].FCNCALL_CALL(DSSSD[__i0])); }
+    FCNCALL_SUBINDEX_END(__i0);
+  }
+  FCNCALL_SUBNAME_END;
+  }
+  FCNCALL_RET;
+}
+#endif//USER_DEF_hit_event_is446
+
+#include "gen/default_fcncall_undef.hh"
+
+
+/** END_FUNCTION_CALL_PER_MEMBER **************************************/
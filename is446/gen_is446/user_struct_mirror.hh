@@ -0,0 +1,53 @@
+/** BEGIN_MIRROR_STRUCT ************************************************
+ *
+ * Mirror (1 to 1) structure.
+ *
+ * Do not edit - automatically generated.
+ */
+
+#include "gen/default_mirror_define.hh"
+
+#ifndef USER_DEF_hit_event_DSSSD_one
+STRUCT_MIRROR_TEMPLATE
+struct STRUCT_MIRROR_STRUCT(hit_event_DSSSD_one)
+{
+public:
+  STRUCT_MIRROR_ITEM_CTRL(T);
+  STRUCT_MIRROR_TYPE(float) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(T);
+  STRUCT_MIRROR_ITEM_CTRL(E);
+  STRUCT_MIRROR_TYPE(float) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(E);
+  STRUCT_MIRROR_ITEM_CTRL(X);
+  STRUCT_MIRROR_TYPE(float) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(X);
+  STRUCT_MIRROR_ITEM_CTRL(Y);
+  STRUCT_MIRROR_TYPE(float) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(Y);
+  STRUCT_MIRROR_FCNS_DECL(hit_event_DSSSD_one);
+};
+#endif//USER_DEF_hit_event_DSSSD_one
+
+#ifndef USER_DEF_hit_event_DSSSD
+STRUCT_MIRROR_TEMPLATE
+struct STRUCT_MIRROR_STRUCT(hit_event_DSSSD)
+{
+public:
+  STRUCT_MIRROR_ITEM_CTRL(hits);
+  STRUCT_MIRROR_TYPE(raw_list_zero_suppress) < STRUCT_MIRROR_TYPE_TEMPLATE STRUCT_MIRROR_TEMPLATE_ARG(hit_event_DSSSD_one),STRUCT_MIRROR_TEMPLATE_ARG(hit_event_DSSSD_one),32> STRUCT_MIRROR_NAME(hits);
+  STRUCT_MIRROR_FCNS_DECL(hit_event_DSSSD);
+};
+#endif//USER_DEF_hit_event_DSSSD
+
+#ifndef USER_DEF_hit_event_is446
+STRUCT_MIRROR_TEMPLATE
+struct STRUCT_MIRROR_STRUCT(hit_event_is446)
+{
+public:
+  STRUCT_MIRROR_ITEM_CTRL(DSSSD);
+  STRUCT_MIRROR_ITEM_CTRL_ARRAY(DSSSD__i0,,3);
+  STRUCT_MIRROR_TYPE(hit_event_DSSSD) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(DSSSD[3]);
+  STRUCT_MIRROR_FCNS_DECL(hit_event_is446);
+};
+#endif//USER_DEF_hit_event_is446
+
+#include "gen/default_mirror_undef.hh"
+
+
+/** END_MIRROR_STRUCT *************************************************/
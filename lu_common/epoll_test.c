@@ -0,0 +1,12 @@
+#include <sys/epoll.h>
+
+int main()
+{
+  struct epoll_event ev;
+  int fd = epoll_create(1);
+
+  ev.events = EPOLLIN;
+  ev.data.u64 = 0;
+
+  return epoll_ctl(fd,EPOLL_CTL_ADD,0,&ev);
+}
@@ -0,0 +1,10 @@
+#include <sys/sdt.h>
+
+int main()
+{
+  int a = 1;
+
+  DTRACE_PROBE1(ucesb,test,a);
+
+  return 0;
+}
@@ -0,0 +1,54 @@
+/* This file is part of UCESB - a tool for data unpacking and processing.
+ *
+ * Copyright (C) 2016  GSI Helmholtzzentrum fuer Schwerionenforschung GmbH
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+ * MA  02110-1301  USA
+ */
+
+#ifndef __UCESB_PROBE_HH__
+#define __UCESB_PROBE_HH__
+
+// Static tracepoints (USDT, provider 'ucesb'), for attaching e.g.
+// perf or bpftrace to a running process:
+//
+//   bpftrace -e 'usdt:./unpacker:ucesb:unpack_end { @[arg1] = count(); }'
+//
+// A probe is a single nop in the code until someone attaches to it.
+// When <sys/sdt.h> is not available, the probes are not compiled in.
+//
+// Probes:
+//
+//   event_read      (events read so far)
+//   event_dispatch  (events read so far, queue)          [threaded]
+//   unpack_start    (events read so far, 0 in worker threads)
+//   unpack_end      (event number, trigger)
+//   event_retire    (event number, events processed)
+//   output_flush    (buffer number, bytes)
+//   client_write    (fd, bytes written, bytes left)      [struct server]
+
+#ifdef HAVE_SYS_SDT_H
+#include <sys/sdt.h>
+
+#define UCESB_PROBE1(name,a1)          DTRACE_PROBE1(ucesb,name,a1)
+#define UCESB_PROBE2(name,a1,a2)       DTRACE_PROBE2(ucesb,name,a1,a2)
+#define UCESB_PROBE3(name,a1,a2,a3)    DTRACE_PROBE3(ucesb,name,a1,a2,a3)
+#else
+#define UCESB_PROBE1(name,a1)          do { } while (0)
+#define UCESB_PROBE2(name,a1,a2)       do { } while (0)
+#define UCESB_PROBE3(name,a1,a2,a3)    do { } while (0)
+#endif
+
+#endif//__UCESB_PROBE_HH__
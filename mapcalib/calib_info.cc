@@ -35,3 +35,15 @@ int calib_param_type(const char *type)
 
   return 0;
 }
+
+int calib_valid_kind(const char *kind)
+{
+  if (strcmp(kind,"EVENT") == 0)
+    return CALIB_VALID_KIND_EVENT;
+  if (strcmp(kind,"FILE") == 0)
+    return CALIB_VALID_KIND_FILE;
+  if (strcmp(kind,"WR") == 0)
+    return CALIB_VALID_KIND_WR;
+
+  return 0;
+}
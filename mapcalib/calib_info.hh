@@ -26,6 +26,8 @@
 
 #include <vector>
 
+#include <stdint.h>
+
 struct double_unit
 {
 public:
@@ -89,6 +91,45 @@ public:
 
 };
 
+#define CALIB_VALID_KIND_EVENT        0x01
+#define CALIB_VALID_KIND_FILE         0x02
+#define CALIB_VALID_KIND_WR           0x04
+
+/* A group of calibration parameters that only apply for events with
+ * a key (event number, input file number, WR time stamp) within
+ * [_from,_to] (inclusive).  Outside, the unconditional values are used.
+ */
+
+struct calib_valid_block
+  : public def_node
+{
+public:
+  virtual ~calib_valid_block() { }
+
+public:
+  calib_valid_block(const file_line &loc,
+		    int kind,uint64_t from,uint64_t to,
+		    def_node_list *items)
+  {
+    _loc   = loc;
+    _kind  = kind;
+    _from  = from;
+    _to    = to;
+    _items = items;
+  }
+
+public:
+  int            _kind;
+  uint64_t       _from;
+  uint64_t       _to;
+  def_node_list *_items;
+
+public:
+  file_line _loc;
+};
+
 int calib_param_type(const char *type);
 
+int calib_valid_kind(const char *kind);
+
 #endif//__CALIB_INFO_HH__
@@ -0,0 +1,399 @@
+/* This file is part of UCESB - a tool for data unpacking and processing.
+ *
+ * Copyright (C) 2016  GSI Helmholtzzentrum fuer Schwerionenforschung GmbH
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+ * MA  02110-1301  USA
+ */
+
+#include "calib_valid.hh"
+#include "mc_def.hh"
+
+#include "error.hh"
+
+#include <algorithm>
+#include <vector>
+
+#define CALIB_VALID_NUM_KINDS  3
+
+struct calib_valid_calib_item
+{
+  calib_valid_slots  _slots;
+  raw_to_tcal_base  *_default[2];
+};
+
+struct calib_valid_user_item
+{
+  void   *_addr;
+  int     _type;
+  double  _value;
+  double  _default;
+};
+
+struct calib_valid_interval
+{
+  const calib_valid_block *_block;
+
+  std::vector<calib_valid_calib_item> _calib;
+  std::vector<calib_valid_user_item>  _user;
+};
+
+typedef std::vector<size_t> calib_valid_active;
+
+/* All interval boundaries of one kind of key, sorted.  They split
+ * the key range into segments; segment i is [_bounds[i-1],_bounds[i]).
+ * For each segment, the (file order) list of active intervals is
+ * prepared during setup.  The current segment is remembered, such
+ * that (mostly) monotonic keys cost one or two compares per event.
+ */
+
+struct calib_valid_index
+{
+  std::vector<uint64_t>           _bounds;
+  std::vector<calib_valid_active> _active; // _bounds.size()+1 segments
+  size_t                          _cur;
+
+public:
+  bool select(uint64_t key);
+};
+
+bool calib_valid_index::select(uint64_t key)
+{
+  size_t n = _bounds.size();
+  size_t seg = _cur;
+
+  if ((seg == 0 || _bounds[seg-1] <= key) &&
+      (seg == n || key < _bounds[seg]))
+    return false;
+
+  if (seg < n && _bounds[seg] <= key &&
+      (seg + 1 == n || key < _bounds[seg + 1]))
+    seg++; // Stepped into the next segment.
+  else
+    seg = (size_t) (std::upper_bound(_bounds.begin(),_bounds.end(),key) -
+		    _bounds.begin());
+
+  _cur = seg;
+  return true;
+}
+
+int _calib_valid_kinds = 0;
+
+static std::vector<calib_valid_interval> _cv_intervals;
+static calib_valid_index  _cv_index[CALIB_VALID_NUM_KINDS];
+static calib_valid_active _cv_applied;
+static bool               _cv_need_select = true;
+static uint32             _cv_file_no = 0;
+
+static const char *calib_valid_kind_name(int kind)
+{
+  switch (kind)
+    {
+    case CALIB_VALID_KIND_EVENT: return "EVENT";
+    case CALIB_VALID_KIND_FILE:  return "FILE";
+    case CALIB_VALID_KIND_WR:    return "WR";
+    }
+  return "?";
+}
+
+static void setup_calib_valid_item(calib_valid_interval &interval,
+				   def_node *info)
+{
+  calib_param *calib_item =
+    dynamic_cast<calib_param *>(info);
+
+  if (calib_item)
+    {
+      assert(calib_item->_src->_set_dest);
+      assert(calib_item->_src->_addr);
+      assert(calib_item->_dest->_addr);
+
+      calib_valid_calib_item item;
+
+      if (!calib_item->_src->_set_dest(calib_item,&item._slots,
+				       calib_item->_toggle_i))
+	ERROR_LOC(calib_item->_loc,"Calib mapping failed for source item.");
+
+      interval._calib.push_back(item);
+      return;
+    }
+
+  user_calib_param *user_calib_item =
+    dynamic_cast<user_calib_param *>(info);
+
+  if (user_calib_item)
+    {
+      assert (user_calib_item->_dest->_addr);
+
+      if (user_calib_item->_param->size() != 1)
+	ERROR_LOC(user_calib_item->_loc,"Wrong number of parameters.");
+
+      double factor;
+
+      verify_units_match(user_calib_item->_dest->_unit,
+			 user_calib_item->_param[0][0]._unit,
+			 user_calib_item->_loc,"param",factor);
+
+      if (user_calib_item->_dest->_type != ENUM_TYPE_FLOAT &&
+	  user_calib_item->_dest->_type != ENUM_TYPE_DOUBLE)
+	ERROR_LOC(user_calib_item->_loc,
+		  "Unhandled type of calibration parameter destination "
+		  "(%d).",
+		  user_calib_item->_dest->_type);
+
+      calib_valid_user_item item;
+
+      item._addr  = (void *) user_calib_item->_dest->_addr;
+      item._type  = user_calib_item->_dest->_type;
+      item._value = user_calib_item->_param[0][0]._value * factor;
+
+      interval._user.push_back(item);
+      return;
+    }
+
+  calib_valid_block *block_item =
+    dynamic_cast<calib_valid_block *>(info);
+
+  if (block_item)
+    ERROR_LOC(block_item->_loc,"CALIB_VALID blocks cannot be nested.");
+
+  map_info *map_item =
+    dynamic_cast<map_info *>(info);
+
+  if (map_item)
+    ERROR_LOC(map_item->_loc,
+	      "Signal mappings cannot have a validity interval.");
+}
+
+void setup_calib_valid(def_node_list *blocks)
+{
+  if (blocks->empty())
+    return;
+
+#if USE_THREADING
+  // The calibration map is shared by all worker threads.
+  ERROR_LOC(dynamic_cast<calib_valid_block *>(blocks->front())->_loc,
+	    "CALIB_VALID intervals not supported with threading.");
+#endif
+
+  _cv_intervals.resize(blocks->size());
+
+  for (size_t i = 0; i < blocks->size(); i++)
+    {
+      calib_valid_block *block =
+	dynamic_cast<calib_valid_block *>((*blocks)[i]);
+      calib_valid_interval &interval = _cv_intervals[i];
+
+      assert(block);
+
+      interval._block = block;
+
+      def_node_list::iterator iter;
+
+      for (iter = block->_items->begin();
+	   iter != block->_items->end(); ++iter)
+	if (*iter)
+	  setup_calib_valid_item(interval,*iter);
+
+      _calib_valid_kinds |= block->_kind;
+    }
+
+  // All unconditional parameters have been applied, so what is
+  // installed now is what we return to outside of the intervals.
+
+  for (size_t i = 0; i < _cv_intervals.size(); i++)
+    {
+      calib_valid_interval &interval = _cv_intervals[i];
+
+      for (size_t j = 0; j < interval._calib.size(); j++)
+	{
+	  calib_valid_calib_item &item = interval._calib[j];
+
+	  item._default[0] = *item._slots._slot[0];
+	  item._default[1] = *item._slots._slot[1];
+	}
+
+      for (size_t j = 0; j < interval._user.size(); j++)
+	{
+	  calib_valid_user_item &item = interval._user[j];
+
+	  if (item._type == ENUM_TYPE_FLOAT)
+	    item._default = *((float *) item._addr);
+	  else
+	    item._default = *((double *) item._addr);
+	}
+    }
+
+  for (int k = 0; k < CALIB_VALID_NUM_KINDS; k++)
+    {
+      int kind = 1 << k;
+      calib_valid_index &index = _cv_index[k];
+
+      for (size_t i = 0; i < _cv_intervals.size(); i++)
+	{
+	  const calib_valid_block *block = _cv_intervals[i]._block;
+
+	  if (block->_kind != kind)
+	    continue;
+
+	  index._bounds.push_back(block->_from);
+	  if (block->_to != (uint64_t) -1)
+	    index._bounds.push_back(block->_to + 1);
+	}
+
+      std::sort(index._bounds.begin(),index._bounds.end());
+      index._bounds.erase(std::unique(index._bounds.begin(),
+				      index._bounds.end()),
+			  index._bounds.end());
+
+      size_t n = index._bounds.size();
+
+      index._active.resize(n + 1);
+      index._cur = 0;
+
+      for (size_t i = 0; i < _cv_intervals.size(); i++)
+	{
+	  const calib_valid_block *block = _cv_intervals[i]._block;
+
+	  if (block->_kind != kind)
+	    continue;
+
+	  size_t seg_begin = (size_t)
+	    (std::lower_bound(index._bounds.begin(),index._bounds.end(),
+			      block->_from) - index._bounds.begin()) + 1;
+	  size_t seg_end = n + 1;
+
+	  if (block->_to != (uint64_t) -1)
+	    seg_end = (size_t)
+	      (std::lower_bound(index._bounds.begin(),index._bounds.end(),
+				block->_to + 1) - index._bounds.begin()) + 1;
+
+	  for (size_t seg = seg_begin; seg < seg_end; seg++)
+	    index._active[seg].push_back(i);
+	}
+    }
+
+  INFO("%d calibration validity intervals.",(int) _cv_intervals.size());
+}
+
+void calib_valid_new_file()
+{
+  _cv_file_no++;
+}
+
+static void calib_valid_restore(const calib_valid_interval &interval)
+{
+  for (size_t j = 0; j < interval._calib.size(); j++)
+    {
+      const calib_valid_calib_item &item = interval._calib[j];
+
+      *item._slots._slot[0] = item._default[0];
+      *item._slots._slot[1] = item._default[1];
+    }
+
+  for (size_t j = 0; j < interval._user.size(); j++)
+    {
+      const calib_valid_user_item &item = interval._user[j];
+
+      if (item._type == ENUM_TYPE_FLOAT)
+	*((float *) item._addr) = (float) item._default;
+      else
+	*((double *) item._addr) = item._default;
+    }
+}
+
+static void calib_valid_apply(const calib_valid_interval &interval)
+{
+  for (size_t j = 0; j < interval._calib.size(); j++)
+    {
+      const calib_valid_calib_item &item = interval._calib[j];
+
+      *item._slots._slot[0] = item._slots._r2c;
+      *item._slots._slot[1] = item._slots._r2c;
+    }
+
+  for (size_t j = 0; j < interval._user.size(); j++)
+    {
+      const calib_valid_user_item &item = interval._user[j];
+
+      if (item._type == ENUM_TYPE_FLOAT)
+	*((float *) item._addr) = (float) item._value;
+      else
+	*((double *) item._addr) = item._value;
+    }
+}
+
+void calib_valid_select(uint32 event_no,const uint64_t *wr_timestamp)
+{
+  uint64_t key[CALIB_VALID_NUM_KINDS] =
+    { event_no, _cv_file_no, wr_timestamp ? *wr_timestamp : 0 };
+  int kinds = _calib_valid_kinds;
+
+  // Without a time stamp, stay with the segment of the last one.
+  if (!wr_timestamp)
+    kinds &= ~CALIB_VALID_KIND_WR;
+
+  bool changed = _cv_need_select;
+
+  for (int k = 0; k < CALIB_VALID_NUM_KINDS; k++)
+    if (kinds & (1 << k))
+      changed |= _cv_index[k].select(key[k]);
+
+  if (!changed)
+    return;
+
+  _cv_need_select = false;
+
+  calib_valid_active active;
+
+  for (int k = 0; k < CALIB_VALID_NUM_KINDS; k++)
+    if (_calib_valid_kinds & (1 << k))
+      {
+	const calib_valid_index &index = _cv_index[k];
+	const calib_valid_active &seg_active = index._active[index._cur];
+
+	active.insert(active.end(),seg_active.begin(),seg_active.end());
+      }
+
+  // Later intervals (in file order) take precedence when overlapping.
+  std::sort(active.begin(),active.end());
+
+  if (active == _cv_applied)
+    return;
+
+  for (size_t i = _cv_applied.size(); i; i--)
+    calib_valid_restore(_cv_intervals[_cv_applied[i-1]]);
+
+  for (size_t i = 0; i < active.size(); i++)
+    calib_valid_apply(_cv_intervals[active[i]]);
+
+  _cv_applied.swap(active);
+}
+
+void show_calib_valid()
+{
+  for (size_t i = 0; i < _cv_intervals.size(); i++)
+    {
+      const calib_valid_interval &interval = _cv_intervals[i];
+      const calib_valid_block *block = interval._block;
+
+      printf ("CALIB_VALID(%s,%llu,%llu) : %d calib, %d user params\n",
+	      calib_valid_kind_name(block->_kind),
+	      (unsigned long long) block->_from,
+	      (unsigned long long) block->_to,
+	      (int) interval._calib.size(),
+	      (int) interval._user.size());
+    }
+}
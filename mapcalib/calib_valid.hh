@@ -0,0 +1,61 @@
+/* This file is part of UCESB - a tool for data unpacking and processing.
+ *
+ * Copyright (C) 2016  GSI Helmholtzzentrum fuer Schwerionenforschung GmbH
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+ * MA  02110-1301  USA
+ */
+
+#ifndef __CALIB_VALID_HH__
+#define __CALIB_VALID_HH__
+
+#include "calib_info.hh"
+
+#include <stdint.h>
+
+class raw_to_tcal_base;
+
+/* Filled in by set_raw_to_tcal() when it is handed a non-NULL
+ * second argument.  The conversion object is then not installed,
+ * but the slot(s) it belongs in are reported back, such that it can
+ * be swapped in and out when its validity interval is entered/left.
+ */
+
+struct calib_valid_slots
+{
+public:
+  raw_to_tcal_base **_slot[2];
+  raw_to_tcal_base  *_r2c;
+};
+
+/* Keys that the validity intervals are selected by.  Mask of
+ * CALIB_VALID_KIND_xxx with the kinds that are used by any interval.
+ */
+
+extern int _calib_valid_kinds;
+
+void setup_calib_valid(def_node_list *blocks);
+
+void calib_valid_new_file();
+
+/* Called once per (non-sticky) event, before the calibration is
+ * applied.  Only does real work when an interval boundary is
+ * crossed.  wr_timestamp is NULL for events without one.
+ */
+void calib_valid_select(uint32 event_no,const uint64_t *wr_timestamp);
+
+void show_calib_valid();
+
+#endif//__CALIB_VALID_HH__
@@ -19,6 +19,7 @@
  */
 
 #include "mc_def.hh"
+#include "calib_valid.hh"
 #include "config.hh"
 
 #include "file_line.hh"
@@ -231,10 +232,20 @@ void process_map_calib_info()
 {
   def_node_list::iterator i;
 
+  def_node_list valid_blocks;
+
   for (i = all_mc_defs->begin(); i != all_mc_defs->end(); ++i)
     {
       def_node *info = *i;
 
+      // Applied after all unconditional parameters, which they
+      // temporarily replace.
+      if (dynamic_cast<calib_valid_block *>(info))
+	{
+	  valid_blocks.push_back(info);
+	  continue;
+	}
+
       calib_param *calib_item =
 	dynamic_cast<calib_param *>(info);
 
@@ -264,6 +275,8 @@ void process_map_calib_info()
 	}
 
     }
+
+  setup_calib_valid(&valid_blocks);
 }
 
 extern int yylineno;
@@ -82,6 +82,7 @@ struct md_ident_fl
 
   double  fValue;              /* double value */
   int     iValue;              /* integer value */
+  uint64_t u64Value;           /* long integer value */
   const char *strValue;        /* string */
 
   // We generate internally:
@@ -92,6 +93,7 @@ struct md_ident_fl
   map_info       *map;
   calib_param    *calib;
   user_calib_param    *user_calib;
+  calib_valid_block   *calib_valid;
 
   sig_part            *var_part;
   sig_part_ptr_vector *var_vect;
@@ -105,6 +107,7 @@ struct md_ident_fl
 /* Things we get from the lexer */
 
 %token <iValue>    INTEGER
+%token <u64Value>  INTEGER64
 %token <fValue>    DOUBLE
 %token <strValue>  STRING
 %token <strValue>  IDENTIFIER
@@ -114,6 +117,7 @@ struct md_ident_fl
 %token CALIB_PARAM
 %token CALIB_PARAM_C
 %token TOGGLE
+%token CALIB_VALID
 %token UINT32
 %token UINT16
 %token UINT8
@@ -134,6 +138,10 @@ struct md_ident_fl
 %type <map>        signal_mapping
 %type <calib>      calib_param
 %type <user_calib> user_calib_param
+%type <calib_valid> calib_valid
+
+%type <u64Value>   valid_bound
+%type <u64Value>   valid_end
 
 %type <iValue>     data_type
 %type <iValue>     calib_type
@@ -184,6 +192,7 @@ stmt:
         | signal_mapping                           { $$ = $1; }
         | calib_param                              { $$ = $1; }
         | user_calib_param                         { $$ = $1; }
+        | calib_valid                              { $$ = $1; }
 /*        | '{' stmt_list '}'                        { $$ = node_list_pack($2); }*/
 /*        | hardware_definition                      { append_hardware($1); $$ = NULL; } */
 /*        | module_definition                        { $$ = $1; } */
@@ -324,6 +333,37 @@ user_calib_param:
           }
         ;
 
+/* Parameters only valid for a range of events/files/time stamps:
+ * CALIB_VALID(EVENT, 1000, 1999) { CALIB_PARAM(...); ... }
+ * An end of '*' leaves the interval open.
+ */
+
+calib_valid:
+	  CALIB_VALID '(' IDENTIFIER ',' valid_bound ',' valid_end ')' '{' stmt_list '}'
+          {
+	    int kind = calib_valid_kind($3);
+	    if (!kind) {
+	      yyerror("Unknown validity kind (EVENT, FILE or WR).");
+	      YYERROR;
+	    }
+	    if ($7 < $5) {
+	      yyerror("Validity interval end before start.");
+	      YYERROR;
+	    }
+	    $$ = new calib_valid_block(CURR_FILE_LINE,kind,$5,$7,$10);
+          }
+        ;
+
+valid_bound:
+	  INTEGER                 { $$ = (uint32_t) $1; /* 0xffffffff */ }
+        | INTEGER64               { $$ = $1; }
+        ;
+
+valid_end:
+	  valid_bound             { $$ = $1; }
+        | '*'                     { $$ = (uint64_t) -1; }
+        ;
+
 //SIGNAL_MAPPING(DATA12,SCI1_1_E,vme.adc[0].data[0],SCI[0][0].E);
 //SIGNAL_MAPPING(DATA12,SCI1_1_T,vme.tdc[0].data[0],SCI[0][0].T);
 
@@ -424,6 +464,7 @@ value_unit:
 value:
           DOUBLE                  { $$ = $1; }
         | INTEGER                 { $$ = $1; }
+        | INTEGER64               { $$ = (double) $1; }
         | '-' value %prec UMINUS  { $$ = -$2; }
         | '+' value %prec UMINUS  { $$ = $2; }
         | value '+' value         { $$ = $1 + $3; }
@@ -0,0 +1,44 @@
+/*********************************************************************
+ *
+ * This file is autogenerated by /root/repo/lu_common/make_acc_auto_def.sh
+ *
+ * Editing is useless.
+ *
+ *********************************************************************
+ *
+ * Input file:    /root/repo/acc_def/has_pthread_getname_np.h
+ * Basename:      HAS_PTHREAD_GETNAME_NP
+ * Compiler:      g++
+ * Compiler args: -I. -DUNPACKERNAME=mvlc -DUNPACKER_IS_mvlc -I/root/repo/file_input -I/root/repo/file_input/lmd_struct -I/root/repo/threading -I/root/repo/lu_common -I/root/repo/acc_def -ansi -Wall -W -Wno-unused-function -Wno-unused-label -Wno-unused-parameter -Wwrite-strings -Wconversion -g -D_LARGEFILE_SOURCE -D_FILE_OFFSET_BITS=64 -D__STDC_LIMIT_MACROS -DHAVE_TEE -Igen_mvlc -DGENDIR="gen_mvlc" -DUSE_EXT_WRITER= -DUSING_EXT_WRITER= -DEXT_WRITER_PREFIX="/root/repo/hbook/" -I/root/repo/hbook -DUSE_CURSES=1 -I/root/repo/watcher -D_DEFAULT_SOURCE -D_XOPEN_SOURCE=600 -DCONTROL_INCLUDE -DHAVE_THREAD_LOCAL_STORAGE -pthread -DUSE_PTHREAD=1 -DHAVE_PTHREAD -DUSE_MVLC_INPUT=1 -I/root/repo/mapcalib
+ *
+ ********************************************************************/
+
+#ifndef __AUTO_DEF__HAS_PTHREAD_GETNAME_NP_HH__
+#define __AUTO_DEF__HAS_PTHREAD_GETNAME_NP_HH__
+
+/*
+ * Option: pthread_h
+ * Option: notavail
+ */
+/*
+ * -DACC_DEF_HAS_PTHREAD_GETNAME_NP_pthread_h
+
+
+
+ * --> exit 0 (len 0)
+ */
+/*
+ * -DACC_DEF_HAS_PTHREAD_GETNAME_NP_notavail
+
+
+
+ * --> exit 0 (len 0)
+ */
+
+/********************************************************************/
+
+#define ACC_DEF_HAS_PTHREAD_GETNAME_NP_pthread_h 1
+
+/********************************************************************/
+
+#endif/*__AUTO_DEF__HAS_PTHREAD_GETNAME_NP_HH__*/
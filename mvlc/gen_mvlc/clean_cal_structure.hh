@@ -0,0 +1,4 @@
+class cal_event : public cal_event_base
+{
+  STRUCT_FCNS_DECL(cal_event);
+} ;
@@ -0,0 +1,22 @@
+/** BEGIN_LOCATIONS ****************************************************
+ *
+ * File and line locations from the parsed specification files.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// It's left to the compiler to only store one copy of each
+// unique string.
+
+location spec_locations[] =
+{ 
+  { 2, 0, "mvlc.spec" },
+  { 3, 0, "<built-in>" },
+  { 4, 0, "<command-line>" },
+  { 5, 1, "/usr/include/stdc-predef.h" },
+  { 6, 0, "<command-line>" },
+  { 7, 1, "mvlc.spec" },
+  { 8, 25, "mvlc.spec" },
+};
+
+/** END_LOCATIONS *****************************************************/
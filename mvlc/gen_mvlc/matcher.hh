@@ -0,0 +1,11 @@
+/** BEGIN_MATCHER ******************************************************
+ *
+ * Event matcher for EV_EVENT.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// SUBEVENT(EV_EVENT)
+// No __match function for subevents.
+
+/** END_MATCHER *******************************************************/
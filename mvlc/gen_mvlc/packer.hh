@@ -0,0 +1,40 @@
+/** BEGIN_PACKER *******************************************************
+ *
+ * Event packer for EV_EVENT.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// SUBEVENT(EV_EVENT)
+template<typename __data_dest_t>
+void PACKER_EV_EVENT::__packer(__data_dest_t &__buffer)
+{
+}
+FORCE_IMPL_DATA_SRC_FCN(void,EV_EVENT::__packer);
+
+/** END_PACKER ********************************************************/
+/** BEGIN_PACKER *******************************************************
+ *
+ * Event packer for EVENT.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// EVENT
+  // ignore_unknown_subevent;
+{
+}
+
+/** END_PACKER ********************************************************/
+/** BEGIN_PACKER *******************************************************
+ *
+ * Event packer for EVENT.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// STICKY_EVENT
+{
+}
+
+/** END_PACKER ********************************************************/
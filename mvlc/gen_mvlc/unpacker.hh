@@ -0,0 +1,88 @@
+/** BEGIN_UNPACKER *****************************************************
+ *
+ * Event unpacker for EV_EVENT.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// SUBEVENT(EV_EVENT)
+template<typename __data_src_t>
+void EV_EVENT::__unpack(__data_src_t &__buffer)
+{
+}
+FORCE_IMPL_DATA_SRC_FCN(void,EV_EVENT::__unpack);
+
+/** END_UNPACKER ******************************************************/
+/** BEGIN_UNPACKER *****************************************************
+ *
+ * Event unpacker for EVENT.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// EVENT
+template<typename __data_src_t>
+int unpack_event::__unpack_subevent(subevent_header *__header,__data_src_t &__buffer)
+  // ignore_unknown_subevent;
+{
+  int __match_no = 0;
+  SUBEVENT_MATCH_CACHE_LOOKUP(__match_no)
+  {
+    SUBEVENT_MATCH_CACHE_STORE(__match_no);
+  }
+  if (!__match_no) return 0;
+  switch (__match_no)
+  {
+  }
+  return 0;
+}
+FORCE_IMPL_DATA_SRC_FCN_HDR(int,unpack_event::__unpack_subevent);
+
+/** END_UNPACKER ******************************************************/
+/** BEGIN_UNPACKER *****************************************************
+ *
+ * Event unpacker for EVENT.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// STICKY_EVENT
+template<typename __data_src_t>
+int unpack_sticky_event::__unpack_subevent(subevent_header *__header,__data_src_t &__buffer)
+{
+  int __match_no = 0;
+  SUBEVENT_MATCH_CACHE_LOOKUP(__match_no)
+  {
+    SUBEVENT_MATCH_CACHE_STORE(__match_no);
+  }
+  if (!__match_no) return 0;
+  switch (__match_no)
+  {
+  }
+  return 0;
+}
+FORCE_IMPL_DATA_SRC_FCN_HDR(int,unpack_sticky_event::__unpack_subevent);
+
+/** END_UNPACKER ******************************************************/
+/** BEGIN_UNPACKER_DEFINES *********************************************
+ *
+ * Control
+ *
+ * Do not edit - automatically generated.
+ */
+
+#define STICKY_EVENT_IS_NONTRIVIAL  0
+
+
+/** END_UNPACKER_DEFINES **********************************************/
+/** BEGIN_UNPACKER_DEFINES *********************************************
+ *
+ * Data item sizes
+ *
+ * Do not edit - automatically generated.
+ */
+
+#define UNPACK_HAS_DATA64  0
+
+
+/** END_UNPACKER_DEFINES **********************************************/
@@ -0,0 +1,261 @@
+/* Generated by minilex (local flex substitute). */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <regex.h>
+#include <string>
+#define YY_NULL 0
+int yylineno = 1;
+char *yytext = NULL;
+size_t yyleng = 0;
+FILE *yyin = NULL, *yyout = NULL;
+int yywrap(void);
+#define ECHO do { if (fwrite( yytext, yyleng, 1, stdout )) {} } while (0)
+#line 1 "prologue"
+#include <stdio.h>
+#include <stdlib.h>
+#include <errno.h>
+#include <string.h>
+#include "c_struct.hh"
+#include "file_line.hh"
+#include "node.hh"
+#include "str_set.hh"
+
+struct md_ident_fl;
+
+#include "generated/st_parser.hh"
+#include "file_line.hh"
+
+void yyerror(const char *);
+
+ssize_t lexer_read(char* buf,size_t max_size);
+
+#define LINENO_MAP_HAS_NEXT 1
+#define INF_NAN_ATOF        1
+
+#define YY_INPUT(buf,result,max_size) \
+{ \
+  result = lexer_read(buf,max_size); \
+  if (!result) result = YY_NULL; \
+}
+
+#ifndef YY_INPUT
+#define YY_INPUT(buf,result,max_size) result = read(0,buf,max_size)
+#endif
+static std::string *yy_all = NULL;
+static size_t yy_pos = 0;
+static regex_t yy_re[20];
+static const char *yy_re_src[20] = {
+  "[0-9]+",
+  "0x[0-9a-fA-F]+",
+  "0b[01]+",
+  "[Nn][Aa][Nn]",
+  "[Ii][Nn][Ff]",
+  "[0-9]+\\.[0-9]*([eE][+-]?[0-9]+)?",
+  "\\.[0-9]+([eE][+-]?[0-9]+)?",
+  "struct",
+  "union",
+  "class",
+  "public",
+  "__MULTI__",
+  "UNIT",
+  "TOGGLE",
+  "[_a-zA-Z][_a-zA-Z0-9]*",
+  "[]+*/;(){},:|[<>=.-]",
+  "\"[^\"\n]*\"",
+  "[ \t\n]+",
+  ".",
+  "# [0-9]+ \".+\"[ 0-9]*\n",
+};
+int yylex(void)
+{
+  if (!yy_all) {
+    yy_all = new std::string;
+    char buf[8192];
+    for (;;) { ssize_t result; YY_INPUT(buf,result,sizeof(buf)); if (result <= 0) break; yy_all->append(buf,(size_t) result); }
+    for (int i = 0; i < 20; i++) { std::string p = std::string("^(") + yy_re_src[i] + ")"; if (regcomp(&yy_re[i], p.c_str(), REG_EXTENDED | REG_NEWLINE)) { fprintf(stderr, "minilex: bad regex %s\n", p.c_str()); exit(1); } }
+  }
+  for (;;) {
+    if (yy_pos >= yy_all->size()) return 0;
+    int best = -1; size_t bestlen = 0;
+    std::string win = yy_all->substr(yy_pos, 4096);
+    for (int i = 0; i < 20; i++) {
+      regmatch_t m;
+      if (regexec(&yy_re[i], win.c_str(), 1, &m, 0) == 0 && m.rm_so == 0) {
+        size_t l = (size_t) m.rm_eo;
+        if (l > bestlen) { best = i; bestlen = l; }
+      }
+    }
+    if (best < 0) { best = 19; bestlen = 1; }
+    free(yytext);
+    yytext = strndup(yy_all->c_str() + yy_pos, bestlen);
+    yyleng = bestlen;
+    yy_pos += bestlen;
+    for (size_t i = 0; i < yyleng; i++) if (yytext[i] == '\n') yylineno++;
+    switch (best) {
+    case 0:
+      {
+                yylval.iValue = atoi(yytext);
+                return INTEGER;
+            }
+      break;
+    case 1:
+      {
+                yylval.iValue = strtoul(yytext+2,NULL,16);
+                return INTEGER;
+            }
+      break;
+    case 2:
+      {
+                yylval.iValue = strtoul(yytext+2,NULL,2);
+                return INTEGER;
+            }
+      break;
+    case 3:
+      {
+#if INF_NAN_ATOF
+		yylval.fValue = atof(yytext);
+#else
+		yylval.fValue = NAN ;
+#endif
+		return DOUBLE;
+            }
+      break;
+    case 4:
+      {
+#if INF_NAN_ATOF
+		yylval.fValue = atof(yytext);
+#else
+		yylval.fValue = INFINITY ;
+#endif
+		return DOUBLE;
+            }
+      break;
+    case 5:
+      {
+		yylval.fValue = atof(yytext);
+                return DOUBLE;
+            }
+      break;
+    case 6:
+      {
+		yylval.fValue = atof(yytext);
+                return DOUBLE;
+            }
+      break;
+    case 7:
+      { return STRUCT; }
+      break;
+    case 8:
+      { return UNION; }
+      break;
+    case 9:
+      { return CLASS; }
+      break;
+    case 10:
+      { return PUBLIC; }
+      break;
+    case 11:
+      { return MULTI; }
+      break;
+    case 12:
+      { return UNIT; }
+      break;
+    case 13:
+      { return TOGGLE; }
+      break;
+    case 14:
+      {
+                yylval.strValue = find_str_identifiers(yytext);
+                return IDENTIFIER;
+            }
+      break;
+    case 15:
+      {
+                return *yytext;
+            }
+      break;
+    case 16:
+      { /* Cannot handle \" inside strings. */
+                yylval.strValue = find_str_strings(yytext+1,strlen(yytext)-2);
+                return STRING;
+            }
+      break;
+    case 17:
+      ;       /* ignore whitespace */
+      break;
+    case 18:
+      {
+	      char str[64];
+	      sprintf (str,"Unknown character: '%s'.",yytext);
+	      yyerror(str);
+            }
+      break;
+    case 19:
+      {  /* Information about the source location. */
+              char file[1024] = "\0";
+	      int line = 0;
+	      char *endptr;
+	      char *endfile;
+
+	      /*yylloc.last_line++;*/
+
+	      line = (int)(strtol(yytext+2,&endptr,10));
+
+	      endfile = strchr(endptr+2,'\"');
+	      if (endfile)
+		strncpy(file,endptr+2,(size_t) (endfile-(endptr+2)));
+	      else
+		strcpy(file,"UNKNOWN");
+
+	      // fprintf(stderr,"Now at %s:%d (%d)\n",file,line,yylineno);
+
+	      lineno_map *map = new lineno_map;
+
+	      map->_internal = yylineno;
+	      map->_line = line;
+	      map->_file = strdup(file);
+	      map->_prev = _last_lineno_map;
+#if LINENO_MAP_HAS_NEXT
+	      map->_next = NULL;
+
+	      if (!_first_lineno_map)
+		_first_lineno_map = map;
+	      else
+		_last_lineno_map->_next = map;
+#endif
+	      _last_lineno_map = map;
+#if SHOW_FILE_LINENO
+	      // INFO(0,"Now at %s:%d",file,line);
+#endif
+	    }
+      break;
+    }
+  }
+}
+
+int yywrap(void) {
+    return 1;
+}
+
+int lexer_read_fd = -1;
+
+ssize_t lexer_read(char* buf,size_t max_size)
+{
+  ssize_t n;
+
+  for ( ; ; )
+    {
+      n = read(lexer_read_fd,buf,max_size);
+
+      if (n == -1)
+	{
+	  if (errno == EINTR)
+	    continue;
+	  fprintf(stderr,"Failure reading from lexer pipe\n");
+	}
+      return n;
+    }
+}
+
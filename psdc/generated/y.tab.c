@@ -0,0 +1,1703 @@
+/* A Bison parser, made by GNU Bison 3.8.2.  */
+
+/* Bison implementation for Yacc-like parsers in C
+
+   Copyright (C) 1984, 1989-1990, 2000-2015, 2018-2021 Free Software Foundation,
+   Inc.
+
+   This program is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <https://www.gnu.org/licenses/>.  */
+
+/* As a special exception, you may create a larger work that contains
+   part or all of the Bison parser skeleton and distribute that work
+   under terms of your choice, so long as that work isn't itself a
+   parser generator using the skeleton or a modified version thereof
+   as a parser skeleton.  Alternatively, if you modify or redistribute
+   the parser skeleton itself, you may (at your option) remove this
+   special exception, which will cause the skeleton and the resulting
+   Bison output files to be licensed under the GNU General Public
+   License without this special exception.
+
+   This special exception was added by the Free Software Foundation in
+   version 2.2 of Bison.  */
+
+/* C LALR(1) parser skeleton written by Richard Stallman, by
+   simplifying the original so-called "semantic" parser.  */
+
+/* DO NOT RELY ON FEATURES THAT ARE NOT DOCUMENTED in the manual,
+   especially those whose name start with YY_ or yy_.  They are
+   private implementation details that can be changed or removed.  */
+
+/* All symbols defined below should begin with yy or YY, to avoid
+   infringing on user name space.  This should be done even for local
+   variables, as they might otherwise be expanded by user macros.
+   There are some unavoidable exceptions within include files to
+   define necessary library symbols; they are noted "INFRINGES ON
+   USER NAME SPACE" below.  */
+
+/* Identify Bison output, and Bison version.  */
+#define YYBISON 30802
+
+/* Bison version string.  */
+#define YYBISON_VERSION "3.8.2"
+
+/* Skeleton name.  */
+#define YYSKELETON_NAME "yacc.c"
+
+/* Pure parsers.  */
+#define YYPURE 0
+
+/* Push parsers.  */
+#define YYPUSH 0
+
+/* Pull parsers.  */
+#define YYPULL 1
+
+
+
+
+/* First part of user prologue.  */
+#line 32 "st_parser.y"
+
+#define YYERROR_VERBOSE
+
+#define YYTYPE_INT16 int
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdarg.h>
+
+#include "c_struct.hh"
+#include "file_line.hh"
+#include "parse_error.hh"
+#include "node.hh"
+
+int yylex(void);
+
+int yyparse(void);
+
+void yyerror(const char *s);
+
+extern int yylineno;
+
+void print_lineno(FILE* fid,int internal);
+
+struct md_ident_fl
+{
+ public:
+  md_ident_fl(const char *id,const file_line &loc)
+  {
+    _id   = id;
+    _loc = loc;
+  }
+
+ public:
+  const char *_id;
+  file_line   _loc;
+};
+
+#define CURR_FILE_LINE file_line(yylineno)
+
+
+#line 113 "generated/y.tab.c"
+
+# ifndef YY_CAST
+#  ifdef __cplusplus
+#   define YY_CAST(Type, Val) static_cast<Type> (Val)
+#   define YY_REINTERPRET_CAST(Type, Val) reinterpret_cast<Type> (Val)
+#  else
+#   define YY_CAST(Type, Val) ((Type) (Val))
+#   define YY_REINTERPRET_CAST(Type, Val) ((Type) (Val))
+#  endif
+# endif
+# ifndef YY_NULLPTR
+#  if defined __cplusplus
+#   if 201103L <= __cplusplus
+#    define YY_NULLPTR nullptr
+#   else
+#    define YY_NULLPTR 0
+#   endif
+#  else
+#   define YY_NULLPTR ((void*)0)
+#  endif
+# endif
+
+#include "y.tab.h"
+/* Symbol kind.  */
+enum yysymbol_kind_t
+{
+  YYSYMBOL_YYEMPTY = -2,
+  YYSYMBOL_YYEOF = 0,                      /* "end of file"  */
+  YYSYMBOL_YYerror = 1,                    /* error  */
+  YYSYMBOL_YYUNDEF = 2,                    /* "invalid token"  */
+  YYSYMBOL_INTEGER = 3,                    /* INTEGER  */
+  YYSYMBOL_DOUBLE = 4,                     /* DOUBLE  */
+  YYSYMBOL_STRING = 5,                     /* STRING  */
+  YYSYMBOL_IDENTIFIER = 6,                 /* IDENTIFIER  */
+  YYSYMBOL_STRUCT = 7,                     /* STRUCT  */
+  YYSYMBOL_UNION = 8,                      /* UNION  */
+  YYSYMBOL_CLASS = 9,                      /* CLASS  */
+  YYSYMBOL_PUBLIC = 10,                    /* PUBLIC  */
+  YYSYMBOL_MULTI = 11,                     /* MULTI  */
+  YYSYMBOL_UNIT = 12,                      /* UNIT  */
+  YYSYMBOL_TOGGLE = 13,                    /* TOGGLE  */
+  YYSYMBOL_14_ = 14,                       /* ';'  */
+  YYSYMBOL_15_ = 15,                       /* '{'  */
+  YYSYMBOL_16_ = 16,                       /* '}'  */
+  YYSYMBOL_17_ = 17,                       /* ':'  */
+  YYSYMBOL_18_ = 18,                       /* ','  */
+  YYSYMBOL_19_ = 19,                       /* '('  */
+  YYSYMBOL_20_ = 20,                       /* ')'  */
+  YYSYMBOL_21_ = 21,                       /* '<'  */
+  YYSYMBOL_22_ = 22,                       /* '>'  */
+  YYSYMBOL_23_ = 23,                       /* '['  */
+  YYSYMBOL_24_ = 24,                       /* ']'  */
+  YYSYMBOL_YYACCEPT = 25,                  /* $accept  */
+  YYSYMBOL_program = 26,                   /* program  */
+  YYSYMBOL_stmt_list = 27,                 /* stmt_list  */
+  YYSYMBOL_stmt = 28,                      /* stmt  */
+  YYSYMBOL_struct_definition = 29,         /* struct_definition  */
+  YYSYMBOL_struct_or_class = 30,           /* struct_or_class  */
+  YYSYMBOL_ident_null = 31,                /* ident_null  */
+  YYSYMBOL_base_class_list = 32,           /* base_class_list  */
+  YYSYMBOL_base_class = 33,                /* base_class  */
+  YYSYMBOL_struct_item_list_null = 34,     /* struct_item_list_null  */
+  YYSYMBOL_struct_item_list = 35,          /* struct_item_list  */
+  YYSYMBOL_struct_item = 36,               /* struct_item  */
+  YYSYMBOL_struct_member = 37,             /* struct_member  */
+  YYSYMBOL_unit = 38,                      /* unit  */
+  YYSYMBOL_typename_null = 39,             /* typename_null  */
+  YYSYMBOL_typename = 40,                  /* typename  */
+  YYSYMBOL_item_toggle_typename = 41,      /* item_toggle_typename  */
+  YYSYMBOL_item_typename = 42,             /* item_typename  */
+  YYSYMBOL_argument_list = 43,             /* argument_list  */
+  YYSYMBOL_argument = 44,                  /* argument  */
+  YYSYMBOL_array_spec_list_null = 45,      /* array_spec_list_null  */
+  YYSYMBOL_array_spec_list = 46,           /* array_spec_list  */
+  YYSYMBOL_array_spec = 47                 /* array_spec  */
+};
+typedef enum yysymbol_kind_t yysymbol_kind_t;
+
+
+
+
+#ifdef short
+# undef short
+#endif
+
+/* On compilers that do not define __PTRDIFF_MAX__ etc., make sure
+   <limits.h> and (if available) <stdint.h> are included
+   so that the code can choose integer types of a good width.  */
+
+#ifndef __PTRDIFF_MAX__
+# include <limits.h> /* INFRINGES ON USER NAME SPACE */
+# if defined __STDC_VERSION__ && 199901 <= __STDC_VERSION__
+#  include <stdint.h> /* INFRINGES ON USER NAME SPACE */
+#  define YY_STDINT_H
+# endif
+#endif
+
+/* Narrow types that promote to a signed type and that can represent a
+   signed or unsigned integer of at least N bits.  In tables they can
+   save space and decrease cache pressure.  Promoting to a signed type
+   helps avoid bugs in integer arithmetic.  */
+
+#ifdef __INT_LEAST8_MAX__
+typedef __INT_LEAST8_TYPE__ yytype_int8;
+#elif defined YY_STDINT_H
+typedef int_least8_t yytype_int8;
+#else
+typedef signed char yytype_int8;
+#endif
+
+#ifdef __INT_LEAST16_MAX__
+typedef __INT_LEAST16_TYPE__ yytype_int16;
+#elif defined YY_STDINT_H
+typedef int_least16_t yytype_int16;
+#else
+typedef short yytype_int16;
+#endif
+
+/* Work around bug in HP-UX 11.23, which defines these macros
+   incorrectly for preprocessor constants.  This workaround can likely
+   be removed in 2023, as HPE has promised support for HP-UX 11.23
+   (aka HP-UX 11i v2) only through the end of 2022; see Table 2 of
+   <https://h20195.www2.hpe.com/V2/getpdf.aspx/4AA4-7673ENW.pdf>.  */
+#ifdef __hpux
+# undef UINT_LEAST8_MAX
+# undef UINT_LEAST16_MAX
+# define UINT_LEAST8_MAX 255
+# define UINT_LEAST16_MAX 65535
+#endif
+
+#if defined __UINT_LEAST8_MAX__ && __UINT_LEAST8_MAX__ <= __INT_MAX__
+typedef __UINT_LEAST8_TYPE__ yytype_uint8;
+#elif (!defined __UINT_LEAST8_MAX__ && defined YY_STDINT_H \
+       && UINT_LEAST8_MAX <= INT_MAX)
+typedef uint_least8_t yytype_uint8;
+#elif !defined __UINT_LEAST8_MAX__ && UCHAR_MAX <= INT_MAX
+typedef unsigned char yytype_uint8;
+#else
+typedef short yytype_uint8;
+#endif
+
+#if defined __UINT_LEAST16_MAX__ && __UINT_LEAST16_MAX__ <= __INT_MAX__
+typedef __UINT_LEAST16_TYPE__ yytype_uint16;
+#elif (!defined __UINT_LEAST16_MAX__ && defined YY_STDINT_H \
+       && UINT_LEAST16_MAX <= INT_MAX)
+typedef uint_least16_t yytype_uint16;
+#elif !defined __UINT_LEAST16_MAX__ && USHRT_MAX <= INT_MAX
+typedef unsigned short yytype_uint16;
+#else
+typedef int yytype_uint16;
+#endif
+
+#ifndef YYPTRDIFF_T
+# if defined __PTRDIFF_TYPE__ && defined __PTRDIFF_MAX__
+#  define YYPTRDIFF_T __PTRDIFF_TYPE__
+#  define YYPTRDIFF_MAXIMUM __PTRDIFF_MAX__
+# elif defined PTRDIFF_MAX
+#  ifndef ptrdiff_t
+#   include <stddef.h> /* INFRINGES ON USER NAME SPACE */
+#  endif
+#  define YYPTRDIFF_T ptrdiff_t
+#  define YYPTRDIFF_MAXIMUM PTRDIFF_MAX
+# else
+#  define YYPTRDIFF_T long
+#  define YYPTRDIFF_MAXIMUM LONG_MAX
+# endif
+#endif
+
+#ifndef YYSIZE_T
+# ifdef __SIZE_TYPE__
+#  define YYSIZE_T __SIZE_TYPE__
+# elif defined size_t
+#  define YYSIZE_T size_t
+# elif defined __STDC_VERSION__ && 199901 <= __STDC_VERSION__
+#  include <stddef.h> /* INFRINGES ON USER NAME SPACE */
+#  define YYSIZE_T size_t
+# else
+#  define YYSIZE_T unsigned
+# endif
+#endif
+
+#define YYSIZE_MAXIMUM                                  \
+  YY_CAST (YYPTRDIFF_T,                                 \
+           (YYPTRDIFF_MAXIMUM < YY_CAST (YYSIZE_T, -1)  \
+            ? YYPTRDIFF_MAXIMUM                         \
+            : YY_CAST (YYSIZE_T, -1)))
+
+#define YYSIZEOF(X) YY_CAST (YYPTRDIFF_T, sizeof (X))
+
+
+/* Stored state numbers (used for stacks). */
+typedef yytype_int8 yy_state_t;
+
+/* State numbers in computations.  */
+typedef int yy_state_fast_t;
+
+#ifndef YY_
+# if defined YYENABLE_NLS && YYENABLE_NLS
+#  if ENABLE_NLS
+#   include <libintl.h> /* INFRINGES ON USER NAME SPACE */
+#   define YY_(Msgid) dgettext ("bison-runtime", Msgid)
+#  endif
+# endif
+# ifndef YY_
+#  define YY_(Msgid) Msgid
+# endif
+#endif
+
+
+#ifndef YY_ATTRIBUTE_PURE
+# if defined __GNUC__ && 2 < __GNUC__ + (96 <= __GNUC_MINOR__)
+#  define YY_ATTRIBUTE_PURE __attribute__ ((__pure__))
+# else
+#  define YY_ATTRIBUTE_PURE
+# endif
+#endif
+
+#ifndef YY_ATTRIBUTE_UNUSED
+# if defined __GNUC__ && 2 < __GNUC__ + (7 <= __GNUC_MINOR__)
+#  define YY_ATTRIBUTE_UNUSED __attribute__ ((__unused__))
+# else
+#  define YY_ATTRIBUTE_UNUSED
+# endif
+#endif
+
+/* Suppress unused-variable warnings by "using" E.  */
+#if ! defined lint || defined __GNUC__
+# define YY_USE(E) ((void) (E))
+#else
+# define YY_USE(E) /* empty */
+#endif
+
+/* Suppress an incorrect diagnostic about yylval being uninitialized.  */
+#if defined __GNUC__ && ! defined __ICC && 406 <= __GNUC__ * 100 + __GNUC_MINOR__
+# if __GNUC__ * 100 + __GNUC_MINOR__ < 407
+#  define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                           \
+    _Pragma ("GCC diagnostic push")                                     \
+    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")
+# else
+#  define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                           \
+    _Pragma ("GCC diagnostic push")                                     \
+    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")              \
+    _Pragma ("GCC diagnostic ignored \"-Wmaybe-uninitialized\"")
+# endif
+# define YY_IGNORE_MAYBE_UNINITIALIZED_END      \
+    _Pragma ("GCC diagnostic pop")
+#else
+# define YY_INITIAL_VALUE(Value) Value
+#endif
+#ifndef YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+# define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+# define YY_IGNORE_MAYBE_UNINITIALIZED_END
+#endif
+#ifndef YY_INITIAL_VALUE
+# define YY_INITIAL_VALUE(Value) /* Nothing. */
+#endif
+
+#if defined __cplusplus && defined __GNUC__ && ! defined __ICC && 6 <= __GNUC__
+# define YY_IGNORE_USELESS_CAST_BEGIN                          \
+    _Pragma ("GCC diagnostic push")                            \
+    _Pragma ("GCC diagnostic ignored \"-Wuseless-cast\"")
+# define YY_IGNORE_USELESS_CAST_END            \
+    _Pragma ("GCC diagnostic pop")
+#endif
+#ifndef YY_IGNORE_USELESS_CAST_BEGIN
+# define YY_IGNORE_USELESS_CAST_BEGIN
+# define YY_IGNORE_USELESS_CAST_END
+#endif
+
+
+#define YY_ASSERT(E) ((void) (0 && (E)))
+
+#if !defined yyoverflow
+
+/* The parser invokes alloca or malloc; define the necessary symbols.  */
+
+# ifdef YYSTACK_USE_ALLOCA
+#  if YYSTACK_USE_ALLOCA
+#   ifdef __GNUC__
+#    define YYSTACK_ALLOC __builtin_alloca
+#   elif defined __BUILTIN_VA_ARG_INCR
+#    include <alloca.h> /* INFRINGES ON USER NAME SPACE */
+#   elif defined _AIX
+#    define YYSTACK_ALLOC __alloca
+#   elif defined _MSC_VER
+#    include <malloc.h> /* INFRINGES ON USER NAME SPACE */
+#    define alloca _alloca
+#   else
+#    define YYSTACK_ALLOC alloca
+#    if ! defined _ALLOCA_H && ! defined EXIT_SUCCESS
+#     include <stdlib.h> /* INFRINGES ON USER NAME SPACE */
+      /* Use EXIT_SUCCESS as a witness for stdlib.h.  */
+#     ifndef EXIT_SUCCESS
+#      define EXIT_SUCCESS 0
+#     endif
+#    endif
+#   endif
+#  endif
+# endif
+
+# ifdef YYSTACK_ALLOC
+   /* Pacify GCC's 'empty if-body' warning.  */
+#  define YYSTACK_FREE(Ptr) do { /* empty */; } while (0)
+#  ifndef YYSTACK_ALLOC_MAXIMUM
+    /* The OS might guarantee only one guard page at the bottom of the stack,
+       and a page size can be as small as 4096 bytes.  So we cannot safely
+       invoke alloca (N) if N exceeds 4096.  Use a slightly smaller number
+       to allow for a few compiler-allocated temporary stack slots.  */
+#   define YYSTACK_ALLOC_MAXIMUM 4032 /* reasonable circa 2006 */
+#  endif
+# else
+#  define YYSTACK_ALLOC YYMALLOC
+#  define YYSTACK_FREE YYFREE
+#  ifndef YYSTACK_ALLOC_MAXIMUM
+#   define YYSTACK_ALLOC_MAXIMUM YYSIZE_MAXIMUM
+#  endif
+#  if (defined __cplusplus && ! defined EXIT_SUCCESS \
+       && ! ((defined YYMALLOC || defined malloc) \
+             && (defined YYFREE || defined free)))
+#   include <stdlib.h> /* INFRINGES ON USER NAME SPACE */
+#   ifndef EXIT_SUCCESS
+#    define EXIT_SUCCESS 0
+#   endif
+#  endif
+#  ifndef YYMALLOC
+#   define YYMALLOC malloc
+#   if ! defined malloc && ! defined EXIT_SUCCESS
+void *malloc (YYSIZE_T); /* INFRINGES ON USER NAME SPACE */
+#   endif
+#  endif
+#  ifndef YYFREE
+#   define YYFREE free
+#   if ! defined free && ! defined EXIT_SUCCESS
+void free (void *); /* INFRINGES ON USER NAME SPACE */
+#   endif
+#  endif
+# endif
+#endif /* !defined yyoverflow */
+
+#if (! defined yyoverflow \
+     && (! defined __cplusplus \
+         || (defined YYSTYPE_IS_TRIVIAL && YYSTYPE_IS_TRIVIAL)))
+
+/* A type that is properly aligned for any stack member.  */
+union yyalloc
+{
+  yy_state_t yyss_alloc;
+  YYSTYPE yyvs_alloc;
+};
+
+/* The size of the maximum gap between one aligned stack and the next.  */
+# define YYSTACK_GAP_MAXIMUM (YYSIZEOF (union yyalloc) - 1)
+
+/* The size of an array large to enough to hold all stacks, each with
+   N elements.  */
+# define YYSTACK_BYTES(N) \
+     ((N) * (YYSIZEOF (yy_state_t) + YYSIZEOF (YYSTYPE)) \
+      + YYSTACK_GAP_MAXIMUM)
+
+# define YYCOPY_NEEDED 1
+
+/* Relocate STACK from its old location to the new one.  The
+   local variables YYSIZE and YYSTACKSIZE give the old and new number of
+   elements in the stack, and YYPTR gives the new location of the
+   stack.  Advance YYPTR to a properly aligned location for the next
+   stack.  */
+# define YYSTACK_RELOCATE(Stack_alloc, Stack)                           \
+    do                                                                  \
+      {                                                                 \
+        YYPTRDIFF_T yynewbytes;                                         \
+        YYCOPY (&yyptr->Stack_alloc, Stack, yysize);                    \
+        Stack = &yyptr->Stack_alloc;                                    \
+        yynewbytes = yystacksize * YYSIZEOF (*Stack) + YYSTACK_GAP_MAXIMUM; \
+        yyptr += yynewbytes / YYSIZEOF (*yyptr);                        \
+      }                                                                 \
+    while (0)
+
+#endif
+
+#if defined YYCOPY_NEEDED && YYCOPY_NEEDED
+/* Copy COUNT objects from SRC to DST.  The source and destination do
+   not overlap.  */
+# ifndef YYCOPY
+#  if defined __GNUC__ && 1 < __GNUC__
+#   define YYCOPY(Dst, Src, Count) \
+      __builtin_memcpy (Dst, Src, YY_CAST (YYSIZE_T, (Count)) * sizeof (*(Src)))
+#  else
+#   define YYCOPY(Dst, Src, Count)              \
+      do                                        \
+        {                                       \
+          YYPTRDIFF_T yyi;                      \
+          for (yyi = 0; yyi < (Count); yyi++)   \
+            (Dst)[yyi] = (Src)[yyi];            \
+        }                                       \
+      while (0)
+#  endif
+# endif
+#endif /* !YYCOPY_NEEDED */
+
+/* YYFINAL -- State number of the termination state.  */
+#define YYFINAL  10
+/* YYLAST -- Last index in YYTABLE.  */
+#define YYLAST   96
+
+/* YYNTOKENS -- Number of terminals.  */
+#define YYNTOKENS  25
+/* YYNNTS -- Number of nonterminals.  */
+#define YYNNTS  23
+/* YYNRULES -- Number of rules.  */
+#define YYNRULES  50
+/* YYNSTATES -- Number of states.  */
+#define YYNSTATES  91
+
+/* YYMAXUTOK -- Last valid token kind.  */
+#define YYMAXUTOK   268
+
+
+/* YYTRANSLATE(TOKEN-NUM) -- Symbol number corresponding to TOKEN-NUM
+   as returned by yylex, with out-of-bounds checking.  */
+#define YYTRANSLATE(YYX)                                \
+  (0 <= (YYX) && (YYX) <= YYMAXUTOK                     \
+   ? YY_CAST (yysymbol_kind_t, yytranslate[YYX])        \
+   : YYSYMBOL_YYUNDEF)
+
+/* YYTRANSLATE[TOKEN-NUM] -- Symbol number corresponding to TOKEN-NUM
+   as returned by yylex.  */
+static const yytype_int8 yytranslate[] =
+{
+       0,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+      19,    20,     2,     2,    18,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,    17,    14,
+      21,     2,    22,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,    23,     2,    24,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,    15,     2,    16,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     1,     2,     3,     4,
+       5,     6,     7,     8,     9,    10,    11,    12,    13
+};
+
+#if YYDEBUG
+/* YYRLINE[YYN] -- Source line where rule number YYN was defined.  */
+static const yytype_int16 yyrline[] =
+{
+       0,   174,   174,   175,   179,   180,   185,   186,   196,   197,
+     206,   207,   208,   212,   213,   217,   218,   222,   226,   227,
+     231,   232,   236,   237,   238,   239,   240,   241,   242,   243,
+     244,   248,   249,   253,   257,   258,   262,   266,   267,   271,
+     272,   276,   277,   281,   282,   283,   287,   288,   292,   293,
+     297
+};
+#endif
+
+/** Accessing symbol of state STATE.  */
+#define YY_ACCESSING_SYMBOL(State) YY_CAST (yysymbol_kind_t, yystos[State])
+
+#if YYDEBUG || 0
+/* The user-facing name of the symbol whose (internal) number is
+   YYSYMBOL.  No bounds checking.  */
+static const char *yysymbol_name (yysymbol_kind_t yysymbol) YY_ATTRIBUTE_UNUSED;
+
+/* YYTNAME[SYMBOL-NUM] -- String name of the symbol SYMBOL-NUM.
+   First, the terminals, then, starting at YYNTOKENS, nonterminals.  */
+static const char *const yytname[] =
+{
+  "\"end of file\"", "error", "\"invalid token\"", "INTEGER", "DOUBLE",
+  "STRING", "IDENTIFIER", "STRUCT", "UNION", "CLASS", "PUBLIC", "MULTI",
+  "UNIT", "TOGGLE", "';'", "'{'", "'}'", "':'", "','", "'('", "')'", "'<'",
+  "'>'", "'['", "']'", "$accept", "program", "stmt_list", "stmt",
+  "struct_definition", "struct_or_class", "ident_null", "base_class_list",
+  "base_class", "struct_item_list_null", "struct_item_list", "struct_item",
+  "struct_member", "unit", "typename_null", "typename",
+  "item_toggle_typename", "item_typename", "argument_list", "argument",
+  "array_spec_list_null", "array_spec_list", "array_spec", YY_NULLPTR
+};
+
+static const char *
+yysymbol_name (yysymbol_kind_t yysymbol)
+{
+  return yytname[yysymbol];
+}
+#endif
+
+#define YYPACT_NINF (-58)
+
+#define yypact_value_is_default(Yyn) \
+  ((Yyn) == YYPACT_NINF)
+
+#define YYTABLE_NINF (-1)
+
+#define yytable_value_is_error(Yyn) \
+  0
+
+/* YYPACT[STATE-NUM] -- Index in YYTABLE of the portion describing
+   STATE-NUM.  */
+static const yytype_int8 yypact[] =
+{
+      24,   -58,   -58,   -58,   -58,    10,    24,   -58,   -58,     5,
+     -58,   -58,   -58,    -3,    19,    11,    31,    21,    26,     2,
+      25,   -58,   -58,    29,    11,   -58,   -10,    40,   -58,    41,
+       8,   -58,     3,   -58,    42,    43,    44,   -58,    32,   -58,
+      49,    50,    23,    -9,   -58,   -58,   -58,    11,    31,   -58,
+      33,    35,    17,   -58,   -58,    37,   -58,    33,    53,    45,
+      36,   -58,    52,   -58,    47,   -58,    46,   -58,   -58,    33,
+      57,     3,   -58,   -58,    51,    48,   -58,   -58,    55,   -58,
+      44,    54,   -58,   -58,   -58,   -58,    33,    33,    56,   -58,
+     -58
+};
+
+/* YYDEFACT[STATE-NUM] -- Default reduction number in state STATE-NUM.
+   Performed when YYTABLE does not specify something else to do.  Zero
+   means the default is an error.  */
+static const yytype_int8 yydefact[] =
+{
+       3,    10,    11,    12,     6,     0,     2,     4,     7,    34,
+       1,     5,    36,     0,    35,    18,     0,    39,     0,     0,
+       0,    23,    24,     0,    19,    20,     0,     0,    37,     0,
+       0,    15,     0,    22,     0,     0,    13,    21,     0,    25,
+       0,     0,     0,     0,    48,    31,    17,    18,     0,    45,
+      46,     0,     0,    41,    32,     0,    14,    46,     0,     0,
+       0,    26,     0,    27,     0,    49,     0,    16,    43,    47,
+       0,     0,    40,    38,     0,     0,    29,    50,     0,    28,
+      13,     0,    42,     8,    33,    30,    46,    46,     0,    44,
+       9
+};
+
+/* YYPGOTO[NTERM-NUM].  */
+static const yytype_int8 yypgoto[] =
+{
+     -58,   -58,   -58,    58,    28,   -58,   -14,   -58,    27,    20,
+     -58,    59,   -58,    30,   -58,   -58,    60,    61,   -58,     0,
+     -57,    62,   -42
+};
+
+/* YYDEFGOTO[NTERM-NUM].  */
+static const yytype_int8 yydefgoto[] =
+{
+       0,     5,     6,     7,    22,     9,    57,    30,    31,    23,
+      24,    25,    26,    42,    13,    14,    27,    28,    52,    53,
+      68,    69,    44
+};
+
+/* YYTABLE[YYPACT[STATE-NUM]] -- What to do in state STATE-NUM.  If
+   positive, shift that token.  If negative, reduce the rule whose
+   number is the opposite.  If YYTABLE_NINF, syntax error.  */
+static const yytype_int8 yytable[] =
+{
+      74,    65,    38,    38,    39,    63,    49,    40,    17,    50,
+      10,    12,    15,    41,    41,    20,    51,    17,     1,     2,
+       3,    18,    19,    47,    20,    21,    48,    65,     8,    88,
+      89,     1,     2,     3,     8,    71,    16,    61,     4,    72,
+      62,    29,    32,    33,    35,    36,    45,    46,    54,    17,
+      56,    58,    59,    60,    70,    78,    41,    73,    75,    76,
+      77,    79,    80,    81,    11,    83,    86,    66,    84,    85,
+      90,    82,     0,    64,    87,    67,     0,     0,     0,    34,
+       0,     0,     0,    37,     0,     0,     0,     0,    43,     0,
+       0,     0,     0,     0,     0,     0,    55
+};
+
+static const yytype_int8 yycheck[] =
+{
+      57,    43,    12,    12,    14,    14,     3,    17,     6,     6,
+       0,     6,    15,    23,    23,    13,    13,     6,     7,     8,
+       9,    10,    11,    15,    13,    14,    18,    69,     0,    86,
+      87,     7,     8,     9,     6,    18,    17,    14,    14,    22,
+      17,    10,    21,    17,    19,    16,     6,     6,     6,     6,
+       6,    19,     3,     3,    19,     3,    23,    20,     5,    14,
+      24,    14,    16,     6,     6,    14,    80,    47,    20,    14,
+      14,    71,    -1,    43,    20,    48,    -1,    -1,    -1,    19,
+      -1,    -1,    -1,    24,    -1,    -1,    -1,    -1,    26,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    35
+};
+
+/* YYSTOS[STATE-NUM] -- The symbol kind of the accessing symbol of
+   state STATE-NUM.  */
+static const yytype_int8 yystos[] =
+{
+       0,     7,     8,     9,    14,    26,    27,    28,    29,    30,
+       0,    28,     6,    39,    40,    15,    17,     6,    10,    11,
+      13,    14,    29,    34,    35,    36,    37,    41,    42,    10,
+      32,    33,    21,    17,    41,    19,    16,    36,    12,    14,
+      17,    23,    38,    46,    47,     6,     6,    15,    18,     3,
+       6,    13,    43,    44,     6,    42,     6,    31,    19,     3,
+       3,    14,    17,    14,    38,    47,    34,    33,    45,    46,
+      19,    18,    22,    20,    45,     5,    14,    24,     3,    14,
+      16,     6,    44,    14,    20,    14,    31,    20,    45,    45,
+      14
+};
+
+/* YYR1[RULE-NUM] -- Symbol kind of the left-hand side of rule RULE-NUM.  */
+static const yytype_int8 yyr1[] =
+{
+       0,    25,    26,    26,    27,    27,    28,    28,    29,    29,
+      30,    30,    30,    31,    31,    32,    32,    33,    34,    34,
+      35,    35,    36,    36,    36,    36,    36,    36,    36,    36,
+      36,    37,    37,    38,    39,    39,    40,    41,    41,    42,
+      42,    43,    43,    44,    44,    44,    45,    45,    46,    46,
+      47
+};
+
+/* YYR2[RULE-NUM] -- Number of symbols on the right-hand side of rule RULE-NUM.  */
+static const yytype_int8 yyr2[] =
+{
+       0,     2,     1,     0,     1,     2,     1,     1,     8,    10,
+       1,     1,     1,     0,     1,     1,     3,     2,     0,     1,
+       1,     2,     2,     1,     1,     2,     3,     3,     4,     4,
+       5,     2,     3,     4,     0,     1,     1,     1,     4,     1,
+       4,     1,     3,     2,     5,     1,     0,     1,     1,     2,
+       3
+};
+
+
+enum { YYENOMEM = -2 };
+
+#define yyerrok         (yyerrstatus = 0)
+#define yyclearin       (yychar = YYEMPTY)
+
+#define YYACCEPT        goto yyacceptlab
+#define YYABORT         goto yyabortlab
+#define YYERROR         goto yyerrorlab
+#define YYNOMEM         goto yyexhaustedlab
+
+
+#define YYRECOVERING()  (!!yyerrstatus)
+
+#define YYBACKUP(Token, Value)                                    \
+  do                                                              \
+    if (yychar == YYEMPTY)                                        \
+      {                                                           \
+        yychar = (Token);                                         \
+        yylval = (Value);                                         \
+        YYPOPSTACK (yylen);                                       \
+        yystate = *yyssp;                                         \
+        goto yybackup;                                            \
+      }                                                           \
+    else                                                          \
+      {                                                           \
+        yyerror (YY_("syntax error: cannot back up")); \
+        YYERROR;                                                  \
+      }                                                           \
+  while (0)
+
+/* Backward compatibility with an undocumented macro.
+   Use YYerror or YYUNDEF. */
+#define YYERRCODE YYUNDEF
+
+
+/* Enable debugging if requested.  */
+#if YYDEBUG
+
+# ifndef YYFPRINTF
+#  include <stdio.h> /* INFRINGES ON USER NAME SPACE */
+#  define YYFPRINTF fprintf
+# endif
+
+# define YYDPRINTF(Args)                        \
+do {                                            \
+  if (yydebug)                                  \
+    YYFPRINTF Args;                             \
+} while (0)
+
+
+
+
+# define YY_SYMBOL_PRINT(Title, Kind, Value, Location)                    \
+do {                                                                      \
+  if (yydebug)                                                            \
+    {                                                                     \
+      YYFPRINTF (stderr, "%s ", Title);                                   \
+      yy_symbol_print (stderr,                                            \
+                  Kind, Value); \
+      YYFPRINTF (stderr, "\n");                                           \
+    }                                                                     \
+} while (0)
+
+
+/*-----------------------------------.
+| Print this symbol's value on YYO.  |
+`-----------------------------------*/
+
+static void
+yy_symbol_value_print (FILE *yyo,
+                       yysymbol_kind_t yykind, YYSTYPE const * const yyvaluep)
+{
+  FILE *yyoutput = yyo;
+  YY_USE (yyoutput);
+  if (!yyvaluep)
+    return;
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  YY_USE (yykind);
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
+}
+
+
+/*---------------------------.
+| Print this symbol on YYO.  |
+`---------------------------*/
+
+static void
+yy_symbol_print (FILE *yyo,
+                 yysymbol_kind_t yykind, YYSTYPE const * const yyvaluep)
+{
+  YYFPRINTF (yyo, "%s %s (",
+             yykind < YYNTOKENS ? "token" : "nterm", yysymbol_name (yykind));
+
+  yy_symbol_value_print (yyo, yykind, yyvaluep);
+  YYFPRINTF (yyo, ")");
+}
+
+/*------------------------------------------------------------------.
+| yy_stack_print -- Print the state stack from its BOTTOM up to its |
+| TOP (included).                                                   |
+`------------------------------------------------------------------*/
+
+static void
+yy_stack_print (yy_state_t *yybottom, yy_state_t *yytop)
+{
+  YYFPRINTF (stderr, "Stack now");
+  for (; yybottom <= yytop; yybottom++)
+    {
+      int yybot = *yybottom;
+      YYFPRINTF (stderr, " %d", yybot);
+    }
+  YYFPRINTF (stderr, "\n");
+}
+
+# define YY_STACK_PRINT(Bottom, Top)                            \
+do {                                                            \
+  if (yydebug)                                                  \
+    yy_stack_print ((Bottom), (Top));                           \
+} while (0)
+
+
+/*------------------------------------------------.
+| Report that the YYRULE is going to be reduced.  |
+`------------------------------------------------*/
+
+static void
+yy_reduce_print (yy_state_t *yyssp, YYSTYPE *yyvsp,
+                 int yyrule)
+{
+  int yylno = yyrline[yyrule];
+  int yynrhs = yyr2[yyrule];
+  int yyi;
+  YYFPRINTF (stderr, "Reducing stack by rule %d (line %d):\n",
+             yyrule - 1, yylno);
+  /* The symbols being reduced.  */
+  for (yyi = 0; yyi < yynrhs; yyi++)
+    {
+      YYFPRINTF (stderr, "   $%d = ", yyi + 1);
+      yy_symbol_print (stderr,
+                       YY_ACCESSING_SYMBOL (+yyssp[yyi + 1 - yynrhs]),
+                       &yyvsp[(yyi + 1) - (yynrhs)]);
+      YYFPRINTF (stderr, "\n");
+    }
+}
+
+# define YY_REDUCE_PRINT(Rule)          \
+do {                                    \
+  if (yydebug)                          \
+    yy_reduce_print (yyssp, yyvsp, Rule); \
+} while (0)
+
+/* Nonzero means print parse trace.  It is left uninitialized so that
+   multiple parsers can coexist.  */
+int yydebug;
+#else /* !YYDEBUG */
+# define YYDPRINTF(Args) ((void) 0)
+# define YY_SYMBOL_PRINT(Title, Kind, Value, Location)
+# define YY_STACK_PRINT(Bottom, Top)
+# define YY_REDUCE_PRINT(Rule)
+#endif /* !YYDEBUG */
+
+
+/* YYINITDEPTH -- initial size of the parser's stacks.  */
+#ifndef YYINITDEPTH
+# define YYINITDEPTH 200
+#endif
+
+/* YYMAXDEPTH -- maximum size the stacks can grow to (effective only
+   if the built-in stack extension method is used).
+
+   Do not make this value too large; the results are undefined if
+   YYSTACK_ALLOC_MAXIMUM < YYSTACK_BYTES (YYMAXDEPTH)
+   evaluated with infinite-precision integer arithmetic.  */
+
+#ifndef YYMAXDEPTH
+# define YYMAXDEPTH 10000
+#endif
+
+
+
+
+
+
+/*-----------------------------------------------.
+| Release the memory associated to this symbol.  |
+`-----------------------------------------------*/
+
+static void
+yydestruct (const char *yymsg,
+            yysymbol_kind_t yykind, YYSTYPE *yyvaluep)
+{
+  YY_USE (yyvaluep);
+  if (!yymsg)
+    yymsg = "Deleting";
+  YY_SYMBOL_PRINT (yymsg, yykind, yyvaluep, yylocationp);
+
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  YY_USE (yykind);
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
+}
+
+
+/* Lookahead token kind.  */
+int yychar;
+
+/* The semantic value of the lookahead symbol.  */
+YYSTYPE yylval;
+/* Number of syntax errors so far.  */
+int yynerrs;
+
+
+
+
+/*----------.
+| yyparse.  |
+`----------*/
+
+int
+yyparse (void)
+{
+    yy_state_fast_t yystate = 0;
+    /* Number of tokens to shift before error messages enabled.  */
+    int yyerrstatus = 0;
+
+    /* Refer to the stacks through separate pointers, to allow yyoverflow
+       to reallocate them elsewhere.  */
+
+    /* Their size.  */
+    YYPTRDIFF_T yystacksize = YYINITDEPTH;
+
+    /* The state stack: array, bottom, top.  */
+    yy_state_t yyssa[YYINITDEPTH];
+    yy_state_t *yyss = yyssa;
+    yy_state_t *yyssp = yyss;
+
+    /* The semantic value stack: array, bottom, top.  */
+    YYSTYPE yyvsa[YYINITDEPTH];
+    YYSTYPE *yyvs = yyvsa;
+    YYSTYPE *yyvsp = yyvs;
+
+  int yyn;
+  /* The return value of yyparse.  */
+  int yyresult;
+  /* Lookahead symbol kind.  */
+  yysymbol_kind_t yytoken = YYSYMBOL_YYEMPTY;
+  /* The variables used to return semantic value and location from the
+     action routines.  */
+  YYSTYPE yyval;
+
+
+
+#define YYPOPSTACK(N)   (yyvsp -= (N), yyssp -= (N))
+
+  /* The number of symbols on the RHS of the reduced rule.
+     Keep to zero when no symbol should be popped.  */
+  int yylen = 0;
+
+  YYDPRINTF ((stderr, "Starting parse\n"));
+
+  yychar = YYEMPTY; /* Cause a token to be read.  */
+
+  goto yysetstate;
+
+
+/*------------------------------------------------------------.
+| yynewstate -- push a new state, which is found in yystate.  |
+`------------------------------------------------------------*/
+yynewstate:
+  /* In all cases, when you get here, the value and location stacks
+     have just been pushed.  So pushing a state here evens the stacks.  */
+  yyssp++;
+
+
+/*--------------------------------------------------------------------.
+| yysetstate -- set current state (the top of the stack) to yystate.  |
+`--------------------------------------------------------------------*/
+yysetstate:
+  YYDPRINTF ((stderr, "Entering state %d\n", yystate));
+  YY_ASSERT (0 <= yystate && yystate < YYNSTATES);
+  YY_IGNORE_USELESS_CAST_BEGIN
+  *yyssp = YY_CAST (yy_state_t, yystate);
+  YY_IGNORE_USELESS_CAST_END
+  YY_STACK_PRINT (yyss, yyssp);
+
+  if (yyss + yystacksize - 1 <= yyssp)
+#if !defined yyoverflow && !defined YYSTACK_RELOCATE
+    YYNOMEM;
+#else
+    {
+      /* Get the current used size of the three stacks, in elements.  */
+      YYPTRDIFF_T yysize = yyssp - yyss + 1;
+
+# if defined yyoverflow
+      {
+        /* Give user a chance to reallocate the stack.  Use copies of
+           these so that the &'s don't force the real ones into
+           memory.  */
+        yy_state_t *yyss1 = yyss;
+        YYSTYPE *yyvs1 = yyvs;
+
+        /* Each stack pointer address is followed by the size of the
+           data in use in that stack, in bytes.  This used to be a
+           conditional around just the two extra args, but that might
+           be undefined if yyoverflow is a macro.  */
+        yyoverflow (YY_("memory exhausted"),
+                    &yyss1, yysize * YYSIZEOF (*yyssp),
+                    &yyvs1, yysize * YYSIZEOF (*yyvsp),
+                    &yystacksize);
+        yyss = yyss1;
+        yyvs = yyvs1;
+      }
+# else /* defined YYSTACK_RELOCATE */
+      /* Extend the stack our own way.  */
+      if (YYMAXDEPTH <= yystacksize)
+        YYNOMEM;
+      yystacksize *= 2;
+      if (YYMAXDEPTH < yystacksize)
+        yystacksize = YYMAXDEPTH;
+
+      {
+        yy_state_t *yyss1 = yyss;
+        union yyalloc *yyptr =
+          YY_CAST (union yyalloc *,
+                   YYSTACK_ALLOC (YY_CAST (YYSIZE_T, YYSTACK_BYTES (yystacksize))));
+        if (! yyptr)
+          YYNOMEM;
+        YYSTACK_RELOCATE (yyss_alloc, yyss);
+        YYSTACK_RELOCATE (yyvs_alloc, yyvs);
+#  undef YYSTACK_RELOCATE
+        if (yyss1 != yyssa)
+          YYSTACK_FREE (yyss1);
+      }
+# endif
+
+      yyssp = yyss + yysize - 1;
+      yyvsp = yyvs + yysize - 1;
+
+      YY_IGNORE_USELESS_CAST_BEGIN
+      YYDPRINTF ((stderr, "Stack size increased to %ld\n",
+                  YY_CAST (long, yystacksize)));
+      YY_IGNORE_USELESS_CAST_END
+
+      if (yyss + yystacksize - 1 <= yyssp)
+        YYABORT;
+    }
+#endif /* !defined yyoverflow && !defined YYSTACK_RELOCATE */
+
+
+  if (yystate == YYFINAL)
+    YYACCEPT;
+
+  goto yybackup;
+
+
+/*-----------.
+| yybackup.  |
+`-----------*/
+yybackup:
+  /* Do appropriate processing given the current state.  Read a
+     lookahead token if we need one and don't already have one.  */
+
+  /* First try to decide what to do without reference to lookahead token.  */
+  yyn = yypact[yystate];
+  if (yypact_value_is_default (yyn))
+    goto yydefault;
+
+  /* Not known => get a lookahead token if don't already have one.  */
+
+  /* YYCHAR is either empty, or end-of-input, or a valid lookahead.  */
+  if (yychar == YYEMPTY)
+    {
+      YYDPRINTF ((stderr, "Reading a token\n"));
+      yychar = yylex ();
+    }
+
+  if (yychar <= YYEOF)
+    {
+      yychar = YYEOF;
+      yytoken = YYSYMBOL_YYEOF;
+      YYDPRINTF ((stderr, "Now at end of input.\n"));
+    }
+  else if (yychar == YYerror)
+    {
+      /* The scanner already issued an error message, process directly
+         to error recovery.  But do not keep the error token as
+         lookahead, it is too special and may lead us to an endless
+         loop in error recovery. */
+      yychar = YYUNDEF;
+      yytoken = YYSYMBOL_YYerror;
+      goto yyerrlab1;
+    }
+  else
+    {
+      yytoken = YYTRANSLATE (yychar);
+      YY_SYMBOL_PRINT ("Next token is", yytoken, &yylval, &yylloc);
+    }
+
+  /* If the proper action on seeing token YYTOKEN is to reduce or to
+     detect an error, take that action.  */
+  yyn += yytoken;
+  if (yyn < 0 || YYLAST < yyn || yycheck[yyn] != yytoken)
+    goto yydefault;
+  yyn = yytable[yyn];
+  if (yyn <= 0)
+    {
+      if (yytable_value_is_error (yyn))
+        goto yyerrlab;
+      yyn = -yyn;
+      goto yyreduce;
+    }
+
+  /* Count tokens shifted since error; after three, turn off error
+     status.  */
+  if (yyerrstatus)
+    yyerrstatus--;
+
+  /* Shift the lookahead token.  */
+  YY_SYMBOL_PRINT ("Shifting", yytoken, &yylval, &yylloc);
+  yystate = yyn;
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  *++yyvsp = yylval;
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
+
+  /* Discard the shifted token.  */
+  yychar = YYEMPTY;
+  goto yynewstate;
+
+
+/*-----------------------------------------------------------.
+| yydefault -- do the default action for the current state.  |
+`-----------------------------------------------------------*/
+yydefault:
+  yyn = yydefact[yystate];
+  if (yyn == 0)
+    goto yyerrlab;
+  goto yyreduce;
+
+
+/*-----------------------------.
+| yyreduce -- do a reduction.  |
+`-----------------------------*/
+yyreduce:
+  /* yyn is the number of a rule to reduce with.  */
+  yylen = yyr2[yyn];
+
+  /* If YYLEN is nonzero, implement the default value of the action:
+     '$$ = $1'.
+
+     Otherwise, the following line sets YYVAL to garbage.
+     This behavior is undocumented and Bison
+     users should not rely upon it.  Assigning to YYVAL
+     unconditionally makes the parser a bit smaller, and it avoids a
+     GCC warning that YYVAL may be used uninitialized.  */
+  yyval = yyvsp[1-yylen];
+
+
+  YY_REDUCE_PRINT (yyn);
+  switch (yyn)
+    {
+  case 2: /* program: stmt_list  */
+#line 174 "st_parser.y"
+                                { append_list(&all_definitions,(yyvsp[0].nodes)); }
+#line 1205 "generated/y.tab.c"
+    break;
+
+  case 4: /* stmt_list: stmt  */
+#line 179 "st_parser.y"
+                                { (yyval.nodes) = create_list((yyvsp[0].node)); }
+#line 1211 "generated/y.tab.c"
+    break;
+
+  case 5: /* stmt_list: stmt_list stmt  */
+#line 180 "st_parser.y"
+                                { (yyval.nodes) = append_list((yyvsp[-1].nodes),(yyvsp[0].node)); }
+#line 1217 "generated/y.tab.c"
+    break;
+
+  case 6: /* stmt: ';'  */
+#line 185 "st_parser.y"
+                                                   { (yyval.node) = NULL; }
+#line 1223 "generated/y.tab.c"
+    break;
+
+  case 7: /* stmt: struct_definition  */
+#line 186 "st_parser.y"
+                                                   { (yyval.node) = (yyvsp[0].str_def); }
+#line 1229 "generated/y.tab.c"
+    break;
+
+  case 8: /* struct_definition: struct_or_class typename_null '{' struct_item_list_null '}' ident_null array_spec_list_null ';'  */
+#line 196 "st_parser.y"
+                                                                                                          { (yyval.str_def) = new c_struct_def(CURR_FILE_LINE,(yyvsp[-7].iValue),(yyvsp[-6].item_type),NULL,(yyvsp[-4].str_item_list),(yyvsp[-2].strValue),(yyvsp[-1].array_list)); }
+#line 1235 "generated/y.tab.c"
+    break;
+
+  case 9: /* struct_definition: struct_or_class typename ':' base_class_list '{' struct_item_list_null '}' ident_null array_spec_list_null ';'  */
+#line 197 "st_parser.y"
+                                                                                                                         { (yyval.str_def) = new c_struct_def(CURR_FILE_LINE,(yyvsp[-9].iValue),(yyvsp[-8].item_type),(yyvsp[-6].base_list),(yyvsp[-4].str_item_list),(yyvsp[-2].strValue),(yyvsp[-1].array_list)); }
+#line 1241 "generated/y.tab.c"
+    break;
+
+  case 10: /* struct_or_class: STRUCT  */
+#line 206 "st_parser.y"
+                       { (yyval.iValue) = C_STR_STRUCT; }
+#line 1247 "generated/y.tab.c"
+    break;
+
+  case 11: /* struct_or_class: UNION  */
+#line 207 "st_parser.y"
+                       { (yyval.iValue) = C_STR_UNION; }
+#line 1253 "generated/y.tab.c"
+    break;
+
+  case 12: /* struct_or_class: CLASS  */
+#line 208 "st_parser.y"
+                       { (yyval.iValue) = C_STR_CLASS; }
+#line 1259 "generated/y.tab.c"
+    break;
+
+  case 13: /* ident_null: %empty  */
+#line 212 "st_parser.y"
+                       { (yyval.strValue) = NULL; }
+#line 1265 "generated/y.tab.c"
+    break;
+
+  case 14: /* ident_null: IDENTIFIER  */
+#line 213 "st_parser.y"
+                       { (yyval.strValue) = (yyvsp[0].strValue); }
+#line 1271 "generated/y.tab.c"
+    break;
+
+  case 15: /* base_class_list: base_class  */
+#line 217 "st_parser.y"
+                                         { (yyval.base_list) = create_list((yyvsp[0].strValue)); }
+#line 1277 "generated/y.tab.c"
+    break;
+
+  case 16: /* base_class_list: base_class_list ',' base_class  */
+#line 218 "st_parser.y"
+                                         { (yyval.base_list) = append_list((yyvsp[-2].base_list),(yyvsp[0].strValue)); }
+#line 1283 "generated/y.tab.c"
+    break;
+
+  case 17: /* base_class: PUBLIC IDENTIFIER  */
+#line 222 "st_parser.y"
+                               { (yyval.strValue) = (yyvsp[0].strValue); }
+#line 1289 "generated/y.tab.c"
+    break;
+
+  case 18: /* struct_item_list_null: %empty  */
+#line 226 "st_parser.y"
+                           { null_list(&(yyval.str_item_list)); }
+#line 1295 "generated/y.tab.c"
+    break;
+
+  case 19: /* struct_item_list_null: struct_item_list  */
+#line 227 "st_parser.y"
+                           { (yyval.str_item_list) = (yyvsp[0].str_item_list); }
+#line 1301 "generated/y.tab.c"
+    break;
+
+  case 20: /* struct_item_list: struct_item  */
+#line 231 "st_parser.y"
+                                       { (yyval.str_item_list) = create_list((yyvsp[0].str_item)); }
+#line 1307 "generated/y.tab.c"
+    break;
+
+  case 21: /* struct_item_list: struct_item_list struct_item  */
+#line 232 "st_parser.y"
+                                       { (yyval.str_item_list) = append_list((yyvsp[-1].str_item_list),(yyvsp[0].str_item)); }
+#line 1313 "generated/y.tab.c"
+    break;
+
+  case 22: /* struct_item: PUBLIC ':'  */
+#line 236 "st_parser.y"
+                                       { (yyval.str_item) = NULL; /* silenty ignore */ }
+#line 1319 "generated/y.tab.c"
+    break;
+
+  case 23: /* struct_item: ';'  */
+#line 237 "st_parser.y"
+                                       { (yyval.str_item) = NULL; /* silenty ignore */ }
+#line 1325 "generated/y.tab.c"
+    break;
+
+  case 24: /* struct_item: struct_definition  */
+#line 238 "st_parser.y"
+                                       { (yyval.str_item) = (yyvsp[0].str_def); }
+#line 1331 "generated/y.tab.c"
+    break;
+
+  case 25: /* struct_item: struct_member ';'  */
+#line 239 "st_parser.y"
+                                       { (yyval.str_item) = (yyvsp[-1].str_item); }
+#line 1337 "generated/y.tab.c"
+    break;
+
+  case 26: /* struct_item: struct_member unit ';'  */
+#line 240 "st_parser.y"
+                                       { (yyval.str_item) = (yyvsp[-2].str_item); (yyvsp[-2].str_item)->set_unit((yyvsp[-1].strValue)); }
+#line 1343 "generated/y.tab.c"
+    break;
+
+  case 27: /* struct_item: struct_member array_spec_list ';'  */
+#line 241 "st_parser.y"
+                                            { (yyval.str_item) = (yyvsp[-2].str_item); (yyvsp[-2].str_item)->set_array_ind((yyvsp[-1].array_list)); }
+#line 1349 "generated/y.tab.c"
+    break;
+
+  case 28: /* struct_item: struct_member array_spec_list unit ';'  */
+#line 242 "st_parser.y"
+                                                 { (yyval.str_item) = (yyvsp[-3].str_item); (yyvsp[-3].str_item)->set_array_ind((yyvsp[-2].array_list)); (yyvsp[-3].str_item)->set_unit((yyvsp[-1].strValue)); }
+#line 1355 "generated/y.tab.c"
+    break;
+
+  case 29: /* struct_item: struct_member ':' INTEGER ';'  */
+#line 243 "st_parser.y"
+                                        { (yyvsp[-3].str_item)->set_bitfield((yyvsp[-1].iValue)); (yyval.str_item) = (yyvsp[-3].str_item); }
+#line 1361 "generated/y.tab.c"
+    break;
+
+  case 30: /* struct_item: struct_member unit ':' INTEGER ';'  */
+#line 244 "st_parser.y"
+                                             { (yyvsp[-4].str_item)->set_bitfield((yyvsp[-1].iValue)); (yyvsp[-4].str_item)->set_unit((yyvsp[-3].strValue)); (yyval.str_item) = (yyvsp[-4].str_item); }
+#line 1367 "generated/y.tab.c"
+    break;
+
+  case 31: /* struct_member: item_toggle_typename IDENTIFIER  */
+#line 248 "st_parser.y"
+                                                 { (yyval.str_item) = new c_struct_member(CURR_FILE_LINE,(yyvsp[-1].item_type),(yyvsp[0].strValue),NULL,0,0); }
+#line 1373 "generated/y.tab.c"
+    break;
+
+  case 32: /* struct_member: MULTI item_toggle_typename IDENTIFIER  */
+#line 249 "st_parser.y"
+                                                 { (yyval.str_item) = new c_struct_member(CURR_FILE_LINE,(yyvsp[-1].item_type),(yyvsp[0].strValue),NULL,0,1); }
+#line 1379 "generated/y.tab.c"
+    break;
+
+  case 33: /* unit: UNIT '(' STRING ')'  */
+#line 253 "st_parser.y"
+                              { insert_prefix_units_exp(CURR_FILE_LINE,(yyvsp[-1].strValue)); (yyval.strValue) = (yyvsp[-1].strValue); }
+#line 1385 "generated/y.tab.c"
+    break;
+
+  case 34: /* typename_null: %empty  */
+#line 257 "st_parser.y"
+                   { (yyval.item_type) = NULL; }
+#line 1391 "generated/y.tab.c"
+    break;
+
+  case 35: /* typename_null: typename  */
+#line 258 "st_parser.y"
+                   { (yyval.item_type) = (yyvsp[0].item_type); }
+#line 1397 "generated/y.tab.c"
+    break;
+
+  case 36: /* typename: IDENTIFIER  */
+#line 262 "st_parser.y"
+                       { (yyval.item_type) = new c_typename(CURR_FILE_LINE,(yyvsp[0].strValue)); }
+#line 1403 "generated/y.tab.c"
+    break;
+
+  case 37: /* item_toggle_typename: item_typename  */
+#line 266 "st_parser.y"
+                                       { (yyval.item_type) = (yyvsp[0].item_type); }
+#line 1409 "generated/y.tab.c"
+    break;
+
+  case 38: /* item_toggle_typename: TOGGLE '(' item_typename ')'  */
+#line 267 "st_parser.y"
+                                       { (yyvsp[-1].item_type)->set_toggle(); (yyval.item_type) = (yyvsp[-1].item_type); }
+#line 1415 "generated/y.tab.c"
+    break;
+
+  case 39: /* item_typename: IDENTIFIER  */
+#line 271 "st_parser.y"
+                                       { (yyval.item_type) = new c_typename(CURR_FILE_LINE,(yyvsp[0].strValue)); }
+#line 1421 "generated/y.tab.c"
+    break;
+
+  case 40: /* item_typename: IDENTIFIER '<' argument_list '>'  */
+#line 272 "st_parser.y"
+                                            { (yyval.item_type) = new c_typename_template(CURR_FILE_LINE,(yyvsp[-3].strValue),(yyvsp[-1].arg_list)); }
+#line 1427 "generated/y.tab.c"
+    break;
+
+  case 41: /* argument_list: argument  */
+#line 276 "st_parser.y"
+                                       { (yyval.arg_list) = create_list((yyvsp[0].arg)); }
+#line 1433 "generated/y.tab.c"
+    break;
+
+  case 42: /* argument_list: argument_list ',' argument  */
+#line 277 "st_parser.y"
+                                       { (yyval.arg_list) = append_list((yyvsp[-2].arg_list),(yyvsp[0].arg)); }
+#line 1439 "generated/y.tab.c"
+    break;
+
+  case 43: /* argument: IDENTIFIER array_spec_list_null  */
+#line 281 "st_parser.y"
+                                          { (yyval.arg) = new c_arg_named(CURR_FILE_LINE,(yyvsp[-1].strValue),(yyvsp[0].array_list),false); }
+#line 1445 "generated/y.tab.c"
+    break;
+
+  case 44: /* argument: TOGGLE '(' IDENTIFIER ')' array_spec_list_null  */
+#line 282 "st_parser.y"
+                                                         { (yyval.arg) = new c_arg_named(CURR_FILE_LINE,(yyvsp[-2].strValue),(yyvsp[0].array_list),true); }
+#line 1451 "generated/y.tab.c"
+    break;
+
+  case 45: /* argument: INTEGER  */
+#line 283 "st_parser.y"
+                                          { (yyval.arg) = new c_arg_const(CURR_FILE_LINE,(yyvsp[0].iValue)); }
+#line 1457 "generated/y.tab.c"
+    break;
+
+  case 46: /* array_spec_list_null: %empty  */
+#line 287 "st_parser.y"
+                                       { (yyval.array_list) = NULL; }
+#line 1463 "generated/y.tab.c"
+    break;
+
+  case 47: /* array_spec_list_null: array_spec_list  */
+#line 288 "st_parser.y"
+                                       { (yyval.array_list) = (yyvsp[0].array_list); }
+#line 1469 "generated/y.tab.c"
+    break;
+
+  case 48: /* array_spec_list: array_spec  */
+#line 292 "st_parser.y"
+                                       { (yyval.array_list) = new c_array_ind; (yyval.array_list)->push_back((yyvsp[0].iValue)); }
+#line 1475 "generated/y.tab.c"
+    break;
+
+  case 49: /* array_spec_list: array_spec_list array_spec  */
+#line 293 "st_parser.y"
+                                       { (yyvsp[-1].array_list)->push_back((yyvsp[0].iValue)); (yyval.array_list) = (yyvsp[-1].array_list); }
+#line 1481 "generated/y.tab.c"
+    break;
+
+  case 50: /* array_spec: '[' INTEGER ']'  */
+#line 297 "st_parser.y"
+                                       { (yyval.iValue) = (yyvsp[-1].iValue); }
+#line 1487 "generated/y.tab.c"
+    break;
+
+
+#line 1491 "generated/y.tab.c"
+
+      default: break;
+    }
+  /* User semantic actions sometimes alter yychar, and that requires
+     that yytoken be updated with the new translation.  We take the
+     approach of translating immediately before every use of yytoken.
+     One alternative is translating here after every semantic action,
+     but that translation would be missed if the semantic action invokes
+     YYABORT, YYACCEPT, or YYERROR immediately after altering yychar or
+     if it invokes YYBACKUP.  In the case of YYABORT or YYACCEPT, an
+     incorrect destructor might then be invoked immediately.  In the
+     case of YYERROR or YYBACKUP, subsequent parser actions might lead
+     to an incorrect destructor call or verbose syntax error message
+     before the lookahead is translated.  */
+  YY_SYMBOL_PRINT ("-> $$ =", YY_CAST (yysymbol_kind_t, yyr1[yyn]), &yyval, &yyloc);
+
+  YYPOPSTACK (yylen);
+  yylen = 0;
+
+  *++yyvsp = yyval;
+
+  /* Now 'shift' the result of the reduction.  Determine what state
+     that goes to, based on the state we popped back to and the rule
+     number reduced by.  */
+  {
+    const int yylhs = yyr1[yyn] - YYNTOKENS;
+    const int yyi = yypgoto[yylhs] + *yyssp;
+    yystate = (0 <= yyi && yyi <= YYLAST && yycheck[yyi] == *yyssp
+               ? yytable[yyi]
+               : yydefgoto[yylhs]);
+  }
+
+  goto yynewstate;
+
+
+/*--------------------------------------.
+| yyerrlab -- here on detecting error.  |
+`--------------------------------------*/
+yyerrlab:
+  /* Make sure we have latest lookahead translation.  See comments at
+     user semantic actions for why this is necessary.  */
+  yytoken = yychar == YYEMPTY ? YYSYMBOL_YYEMPTY : YYTRANSLATE (yychar);
+  /* If not already recovering from an error, report this error.  */
+  if (!yyerrstatus)
+    {
+      ++yynerrs;
+      yyerror (YY_("syntax error"));
+    }
+
+  if (yyerrstatus == 3)
+    {
+      /* If just tried and failed to reuse lookahead token after an
+         error, discard it.  */
+
+      if (yychar <= YYEOF)
+        {
+          /* Return failure if at end of input.  */
+          if (yychar == YYEOF)
+            YYABORT;
+        }
+      else
+        {
+          yydestruct ("Error: discarding",
+                      yytoken, &yylval);
+          yychar = YYEMPTY;
+        }
+    }
+
+  /* Else will try to reuse lookahead token after shifting the error
+     token.  */
+  goto yyerrlab1;
+
+
+/*---------------------------------------------------.
+| yyerrorlab -- error raised explicitly by YYERROR.  |
+`---------------------------------------------------*/
+yyerrorlab:
+  /* Pacify compilers when the user code never invokes YYERROR and the
+     label yyerrorlab therefore never appears in user code.  */
+  if (0)
+    YYERROR;
+  ++yynerrs;
+
+  /* Do not reclaim the symbols of the rule whose action triggered
+     this YYERROR.  */
+  YYPOPSTACK (yylen);
+  yylen = 0;
+  YY_STACK_PRINT (yyss, yyssp);
+  yystate = *yyssp;
+  goto yyerrlab1;
+
+
+/*-------------------------------------------------------------.
+| yyerrlab1 -- common code for both syntax error and YYERROR.  |
+`-------------------------------------------------------------*/
+yyerrlab1:
+  yyerrstatus = 3;      /* Each real token shifted decrements this.  */
+
+  /* Pop stack until we find a state that shifts the error token.  */
+  for (;;)
+    {
+      yyn = yypact[yystate];
+      if (!yypact_value_is_default (yyn))
+        {
+          yyn += YYSYMBOL_YYerror;
+          if (0 <= yyn && yyn <= YYLAST && yycheck[yyn] == YYSYMBOL_YYerror)
+            {
+              yyn = yytable[yyn];
+              if (0 < yyn)
+                break;
+            }
+        }
+
+      /* Pop the current state because it cannot handle the error token.  */
+      if (yyssp == yyss)
+        YYABORT;
+
+
+      yydestruct ("Error: popping",
+                  YY_ACCESSING_SYMBOL (yystate), yyvsp);
+      YYPOPSTACK (1);
+      yystate = *yyssp;
+      YY_STACK_PRINT (yyss, yyssp);
+    }
+
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  *++yyvsp = yylval;
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
+
+
+  /* Shift the error token.  */
+  YY_SYMBOL_PRINT ("Shifting", YY_ACCESSING_SYMBOL (yyn), yyvsp, yylsp);
+
+  yystate = yyn;
+  goto yynewstate;
+
+
+/*-------------------------------------.
+| yyacceptlab -- YYACCEPT comes here.  |
+`-------------------------------------*/
+yyacceptlab:
+  yyresult = 0;
+  goto yyreturnlab;
+
+
+/*-----------------------------------.
+| yyabortlab -- YYABORT comes here.  |
+`-----------------------------------*/
+yyabortlab:
+  yyresult = 1;
+  goto yyreturnlab;
+
+
+/*-----------------------------------------------------------.
+| yyexhaustedlab -- YYNOMEM (memory exhaustion) comes here.  |
+`-----------------------------------------------------------*/
+yyexhaustedlab:
+  yyerror (YY_("memory exhausted"));
+  yyresult = 2;
+  goto yyreturnlab;
+
+
+/*----------------------------------------------------------.
+| yyreturnlab -- parsing is finished, clean up and return.  |
+`----------------------------------------------------------*/
+yyreturnlab:
+  if (yychar != YYEMPTY)
+    {
+      /* Make sure we have latest lookahead translation.  See comments at
+         user semantic actions for why this is necessary.  */
+      yytoken = YYTRANSLATE (yychar);
+      yydestruct ("Cleanup: discarding lookahead",
+                  yytoken, &yylval);
+    }
+  /* Do not reclaim the symbols of the rule whose action triggered
+     this YYABORT or YYACCEPT.  */
+  YYPOPSTACK (yylen);
+  YY_STACK_PRINT (yyss, yyssp);
+  while (yyssp != yyss)
+    {
+      yydestruct ("Cleanup: popping",
+                  YY_ACCESSING_SYMBOL (+*yyssp), yyvsp);
+      YYPOPSTACK (1);
+    }
+#ifndef yyoverflow
+  if (yyss != yyssa)
+    YYSTACK_FREE (yyss);
+#endif
+
+  return yyresult;
+}
+
+#line 347 "st_parser.y"
+
+
+void yyerror(const char *s) {
+  print_lineno(stderr,yylineno);
+  fprintf(stderr," %s\n", s);
+/*
+  Current.first_line   = Rhs[1].first_line;
+  Current.first_column = Rhs[1].first_column;
+  Current.last_line    = Rhs[N].last_line;
+  Current.last_column  = Rhs[N].last_column;
+*/
+}
+
+bool parse_definitions()
+{
+  // yylloc.first_line = yylloc.last_line = 1;
+  // yylloc.first_column = yylloc.last_column = 0;
+
+  return yyparse() == 0;
+}
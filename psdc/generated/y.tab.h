@@ -0,0 +1,137 @@
+/* A Bison parser, made by GNU Bison 3.8.2.  */
+
+/* Bison interface for Yacc-like parsers in C
+
+   Copyright (C) 1984, 1989-1990, 2000-2015, 2018-2021 Free Software Foundation,
+   Inc.
+
+   This program is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <https://www.gnu.org/licenses/>.  */
+
+/* As a special exception, you may create a larger work that contains
+   part or all of the Bison parser skeleton and distribute that work
+   under terms of your choice, so long as that work isn't itself a
+   parser generator using the skeleton or a modified version thereof
+   as a parser skeleton.  Alternatively, if you modify or redistribute
+   the parser skeleton itself, you may (at your option) remove this
+   special exception, which will cause the skeleton and the resulting
+   Bison output files to be licensed under the GNU General Public
+   License without this special exception.
+
+   This special exception was added by the Free Software Foundation in
+   version 2.2 of Bison.  */
+
+/* DO NOT RELY ON FEATURES THAT ARE NOT DOCUMENTED in the manual,
+   especially those whose name start with YY_ or yy_.  They are
+   private implementation details that can be changed or removed.  */
+
+#ifndef YY_YY_GENERATED_Y_TAB_H_INCLUDED
+# define YY_YY_GENERATED_Y_TAB_H_INCLUDED
+/* Debug traces.  */
+#ifndef YYDEBUG
+# define YYDEBUG 0
+#endif
+#if YYDEBUG
+extern int yydebug;
+#endif
+
+/* Token kinds.  */
+#ifndef YYTOKENTYPE
+# define YYTOKENTYPE
+  enum yytokentype
+  {
+    YYEMPTY = -2,
+    YYEOF = 0,                     /* "end of file"  */
+    YYerror = 256,                 /* error  */
+    YYUNDEF = 257,                 /* "invalid token"  */
+    INTEGER = 258,                 /* INTEGER  */
+    DOUBLE = 259,                  /* DOUBLE  */
+    STRING = 260,                  /* STRING  */
+    IDENTIFIER = 261,              /* IDENTIFIER  */
+    STRUCT = 262,                  /* STRUCT  */
+    UNION = 263,                   /* UNION  */
+    CLASS = 264,                   /* CLASS  */
+    PUBLIC = 265,                  /* PUBLIC  */
+    MULTI = 266,                   /* MULTI  */
+    UNIT = 267,                    /* UNIT  */
+    TOGGLE = 268                   /* TOGGLE  */
+  };
+  typedef enum yytokentype yytoken_kind_t;
+#endif
+/* Token kinds.  */
+#define YYEMPTY -2
+#define YYEOF 0
+#define YYerror 256
+#define YYUNDEF 257
+#define INTEGER 258
+#define DOUBLE 259
+#define STRING 260
+#define IDENTIFIER 261
+#define STRUCT 262
+#define UNION 263
+#define CLASS 264
+#define PUBLIC 265
+#define MULTI 266
+#define UNIT 267
+#define TOGGLE 268
+
+/* Value type.  */
+#if ! defined YYSTYPE && ! defined YYSTYPE_IS_DECLARED
+union YYSTYPE
+{
+#line 74 "st_parser.y"
+
+  // What we get from the lexer:
+
+  double  fValue;              /* double value */
+  int     iValue;              /* integer value */
+  const char *strValue;        /* string */
+
+  // We generate internally:
+
+  def_node       *node;
+  def_node_list  *nodes;
+
+  c_struct_def   *str_def;
+  c_struct_item_list  *str_item_list;
+  c_struct_item  *str_item;
+
+  c_typename     *item_type;
+
+  c_array_ind    *array_list;
+
+  c_arg_list     *arg_list;
+  c_arg          *arg;
+
+  //c_bitfield_item_list *bitfield_list;
+  //c_bitfield_item *bitfield;
+
+  c_base_class_list *base_list;
+
+
+#line 123 "generated/y.tab.h"
+
+};
+typedef union YYSTYPE YYSTYPE;
+# define YYSTYPE_IS_TRIVIAL 1
+# define YYSTYPE_IS_DECLARED 1
+#endif
+
+
+extern YYSTYPE yylval;
+
+
+int yyparse (void);
+
+
+#endif /* !YY_YY_GENERATED_Y_TAB_H_INCLUDED  */
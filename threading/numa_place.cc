@@ -0,0 +1,257 @@
+/* This file is part of UCESB - a tool for data unpacking and processing.
+ *
+ * Copyright (C) 2016  GSI Helmholtzzentrum fuer Schwerionenforschung GmbH
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+ * MA  02110-1301  USA
+ */
+
+#include "has_sched_setaffinity.h"
+
+#include "numa_place.hh"
+
+#include "error.hh"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <dirent.h>
+
+#if HAS_SCHED_SETAFFINITY
+#include <sched.h>
+#endif
+
+#include <vector>
+#include <algorithm>
+
+/* With --numa, the process is confined to the CPUs of one NUMA node
+ * before the input is opened.  The input reader, scan, multi-event
+ * worker and retire (main) threads then all run on that node, since
+ * threads inherit the affinity of their creator.
+ *
+ * Linux by default allocates memory on the node of the thread that
+ * first touches it.  Thus the input buffers, the event structures and
+ * the worker slots also end up on the node, and events are processed
+ * on the socket whose memory holds their input.
+ *
+ * auto uses the node we are started on, if there is more than one.
+ * Several instances (e.g. one per socket) are placed with --numa=0,
+ * --numa=1, etc.
+ */
+
+#define NUMA_SYSFS_NODE_DIR "/sys/devices/system/node"
+
+#if HAS_SCHED_SETAFFINITY
+
+struct numa_node_cpus
+{
+  int       _node;
+  cpu_set_t _cpus;  // that we may use
+  int       _count;
+
+  bool operator<(const numa_node_cpus &rhs) const
+  {
+    return _node < rhs._node;
+  }
+};
+
+typedef std::vector<numa_node_cpus> numa_node_cpus_vect;
+
+// Parse a list like 0-7,16-23 (as in sysfs cpulist).
+
+bool numa_parse_cpulist(const char *list,cpu_set_t *cpus)
+{
+  const char *p = list;
+
+  CPU_ZERO(cpus);
+
+  while (*p && *p != '\n')
+    {
+      char *end;
+      long first, last;
+
+      first = strtol(p,&end,10);
+      if (end == p)
+	return false;
+      p = end;
+      last = first;
+
+      if (*p == '-')
+	{
+	  p++;
+	  last = strtol(p,&end,10);
+	  if (end == p)
+	    return false;
+	  p = end;
+	}
+
+      if (first < 0 || last < first)
+	return false;
+
+      for (long cpu = first; cpu <= last && cpu < CPU_SETSIZE; cpu++)
+	CPU_SET((int) cpu,cpus);
+
+      if (*p == ',')
+	p++;
+    }
+  return true;
+}
+
+void numa_read_nodes(numa_node_cpus_vect &nodes,const cpu_set_t *allowed)
+{
+  DIR *dir = opendir(NUMA_SYSFS_NODE_DIR);
+
+  if (!dir)
+    return;
+
+  struct dirent *ent;
+
+  while ((ent = readdir(dir)) != NULL)
+    {
+      int node;
+      char dummy;
+
+      if (sscanf(ent->d_name,"node%d%c",&node,&dummy) != 1)
+	continue;
+
+      char filename[256];
+
+      snprintf(filename,sizeof(filename),
+	       NUMA_SYSFS_NODE_DIR "/node%d/cpulist",node);
+
+      FILE *fid = fopen(filename,"r");
+
+      if (!fid)
+	continue;
+
+      char line[4096];
+      bool got = (fgets(line,sizeof(line),fid) != NULL);
+
+      fclose(fid);
+
+      numa_node_cpus info;
+
+      if (!got ||
+	  !numa_parse_cpulist(line,&info._cpus))
+	{
+	  WARNING("Could not parse CPU list of NUMA node %d.",node);
+	  continue;
+	}
+
+      CPU_AND(&info._cpus,&info._cpus,allowed);
+
+      info._node  = node;
+      info._count = CPU_COUNT(&info._cpus);
+
+      nodes.push_back(info);
+    }
+
+  closedir(dir);
+
+  std::sort(nodes.begin(),nodes.end());
+}
+
+#endif//HAS_SCHED_SETAFFINITY
+
+void numa_place_init(const char *opt,int threads)
+{
+  int node = -1;
+
+  if (strcmp(opt,"auto") != 0)
+    {
+      char *end;
+
+      node = (int) strtol(opt,&end,10);
+      if (end == opt || *end || node < 0)
+	ERROR("Bad NUMA node: %s.",opt);
+    }
+
+#if HAS_SCHED_SETAFFINITY
+  cpu_set_t allowed;
+
+  if (sched_getaffinity(0,sizeof(allowed),&allowed) != 0)
+    {
+      perror("sched_getaffinity");
+      ERROR("Failed to get CPU affinity.");
+    }
+
+  numa_node_cpus_vect nodes;
+
+  numa_read_nodes(nodes,&allowed);
+
+  const numa_node_cpus *use = NULL;
+  int with_cpus = 0;
+
+  for (numa_node_cpus_vect::iterator iter = nodes.begin();
+       iter != nodes.end(); ++iter)
+    {
+      if (iter->_count)
+	with_cpus++;
+      if (iter->_node == node)
+	use = &(*iter);
+    }
+
+  if (node == -1)
+    {
+      if (with_cpus < 2)
+	{
+	  INFO(0,"NUMA: %d node(s) with CPUs to run on, no placement.",
+	       with_cpus);
+	  return;
+	}
+
+      // The node we are running on now.
+
+      int cpu = sched_getcpu();
+
+      for (numa_node_cpus_vect::iterator iter = nodes.begin();
+	   iter != nodes.end(); ++iter)
+	if (cpu >= 0 && CPU_ISSET(cpu,&iter->_cpus))
+	  use = &(*iter);
+
+      if (!use)
+	for (numa_node_cpus_vect::iterator iter = nodes.begin();
+	     iter != nodes.end(); ++iter)
+	  if (iter->_count)
+	    {
+	      use = &(*iter);
+	      break;
+	    }
+    }
+  else
+    {
+      if (!use)
+	ERROR("NUMA node %d not found (%s).",node,NUMA_SYSFS_NODE_DIR);
+      if (!use->_count)
+	ERROR("NUMA node %d has no CPUs that we may run on.",node);
+    }
+
+  if (sched_setaffinity(0,sizeof(use->_cpus),&use->_cpus) != 0)
+    {
+      perror("sched_setaffinity");
+      ERROR("Failed to set CPU affinity for NUMA node %d.",use->_node);
+    }
+
+  INFO(0,"NUMA: running on node %d (%d CPUs).",use->_node,use->_count);
+
+  // Main (unpack and retire) thread + workers.
+  if (threads + 1 > use->_count)
+    WARNING("NUMA node %d has %d CPUs, for %d threads.",
+	    use->_node,use->_count,threads + 1);
+#else
+  (void) threads;
+  WARNING("CPU affinity not supported, --numa=%s ignored.",opt);
+#endif
+}
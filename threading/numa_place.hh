@@ -0,0 +1,31 @@
+/* This file is part of UCESB - a tool for data unpacking and processing.
+ *
+ * Copyright (C) 2016  GSI Helmholtzzentrum fuer Schwerionenforschung GmbH
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+ * MA  02110-1301  USA
+ */
+
+#ifndef __NUMA_PLACE_HH__
+#define __NUMA_PLACE_HH__
+
+// Confine the process to the CPUs of one NUMA node (--numa=auto|NODE).
+// Must be called before the input is opened and threads are started,
+// as those inherit the placement.  threads is the number of worker
+// threads that will be started (for a warning if the node is small).
+
+void numa_place_init(const char *opt,int threads);
+
+#endif/*__NUMA_PLACE_HH__*/
@@ -40,6 +40,8 @@
 #endif
 
 #include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
 
 #ifdef USE_THREADING
 
@@ -372,6 +374,19 @@ struct kbm_buf
   kbm_buf *_next;
 };
 
+// Per-event arena.  Everything allocated for an event (subevent
+// arrays, chunk lists, defragmentation buffers) is carved out of it,
+// and given back all at once by release() when the event is retired.
+// Once large enough, no malloc() is done any longer.
+
+struct kbm_stats
+{
+  uint64_t _allocs;     // allocate() calls
+  uint64_t _mallocs;    // of which (or release()) had to get memory
+  uint64_t _releases;   // events retired
+  size_t   _max_used;   // most used by any event
+};
+
 class keep_buffer_many
 {
 public:
@@ -379,6 +394,8 @@ public:
   {
     // Allocate a dummy buffer, such that _cur is non-NULL
 
+    memset(&_stats,0,sizeof(_stats));
+
     _first = new_buf(NULL,0);
 
     _remain = 0;
@@ -394,6 +411,8 @@ public:
   kbm_buf *_first;
   size_t   _allocated;
 
+  kbm_stats _stats;
+
 protected:
   kbm_buf *new_buf(kbm_buf *next,size_t alloc)
   {
@@ -404,6 +423,8 @@ protected:
     newbuf->_next = next;
     newbuf->_size = alloc;
 
+    _stats._mallocs++;
+
     return newbuf;
   }
 
@@ -415,6 +436,10 @@ public:
     // future allocations go the fast path, i.e. space is available in
     // the current buffer
 
+    _stats._releases++;
+    if (_allocated - _remain > _stats._max_used)
+      _stats._max_used = _allocated - _remain;
+
     if (UNLIKELY(_first->_next != NULL))
       {
 	// there are multiple buffers.  Release them all and get a new one
@@ -442,6 +467,11 @@ public:
 public:
   void *allocate(size_t size)
   {
+    // Keep all items aligned (for subevent and chunk arrays).
+    size = (size + 7) & ~(size_t) 7;
+
+    _stats._allocs++;
+
     // Do we fit in current last buffer?
 
     if (UNLIKELY(size > _remain))
@@ -469,6 +499,16 @@ public:
 
     return p;
   }
+
+  // To grow an array: the old copy stays until release().
+  void *allocate_copy(size_t size,const void *src,size_t src_size)
+  {
+    void *p = allocate(size);
+
+    memcpy(p,src,src_size);
+
+    return p;
+  }
 };
 
 #endif//!USE_THREADING
@@ -0,0 +1,434 @@
+/* Generated by minilex (local flex substitute). */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <regex.h>
+#include <string>
+#define YY_NULL 0
+int yylineno = 1;
+char *yytext = NULL;
+size_t yyleng = 0;
+FILE *yyin = NULL, *yyout = NULL;
+int yywrap(void);
+#define ECHO do { if (fwrite( yytext, yyleng, 1, stdout )) {} } while (0)
+#line 1 "prologue"
+#include <stdio.h>
+#include <stdlib.h>
+#include <errno.h>
+#include <string.h>
+#include "definitions.hh"
+#include "str_set.hh"
+
+struct md_ident_fl;
+
+#include "generated/parser.hh"
+#include "file_line.hh"
+
+void yyerror(const char *);
+
+ssize_t lexer_read(char* buf,size_t max_size);
+
+#define LINENO_MAP_HAS_NEXT 1
+#define INF_NAN_ATOF        1
+
+#define YY_INPUT(buf,result,max_size) \
+{ \
+  result = lexer_read(buf,max_size); \
+  if (!result) result = YY_NULL; \
+}
+
+#ifndef YY_INPUT
+#define YY_INPUT(buf,result,max_size) result = read(0,buf,max_size)
+#endif
+static std::string *yy_all = NULL;
+static size_t yy_pos = 0;
+static regex_t yy_re[62];
+static const char *yy_re_src[62] = {
+  "[0-9]+",
+  "0x[0-9a-fA-F]+",
+  "0b[01]+",
+  "[Nn][Aa][Nn]",
+  "[Ii][Nn][Ff]",
+  "[0-9]+\\.[0-9]*([eE][+-]?[0-9]+)?",
+  "\\.[0-9]+([eE][+-]?[0-9]+)?",
+  "[0-9]+_[0-9]+",
+  "EVENT",
+  "STICKY_EVENT",
+  "SUBEVENT",
+  "SIGNAL",
+  "STICKY",
+  "TOGGLE",
+  "UINT64",
+  "UINT32",
+  "UINT16",
+  "UINT8",
+  "if",
+  "else",
+  "list",
+  "several",
+  "optional",
+  "select",
+  "multi",
+  "external",
+  "norevisit",
+  "revisit",
+  "ignore_unknown_subevent",
+  "static_cast",
+  "MATCH",
+  "CHECK",
+  "RANGE",
+  "ENCODE",
+  "NOENCODE",
+  "EXTERNAL",
+  "MEMBER",
+  "ZERO_SUPPRESS",
+  "ZERO_SUPPRESS_LIST",
+  "ZERO_SUPPRESS_MULTI",
+  "NO_INDEX_LIST",
+  "APPEND_LIST",
+  "FIRST_EVENT",
+  "LAST_EVENT",
+  "MARK",
+  "MARK_COUNT",
+  "CHECK_COUNT",
+  "MATCH_END",
+  "[_a-zA-Z][_a-zA-Z0-9]*",
+  "\\|\\|",
+  "&&",
+  "<<",
+  ">>",
+  "<=",
+  ">=",
+  "==",
+  "!=",
+  "[]+*/;(){},:|[&<>=.!%-]",
+  "\"[^\"\n]*\"",
+  "[ \t\n]+",
+  ".",
+  "# [0-9]+ \".+\"[ 0-9]*\n",
+};
+int yylex(void)
+{
+  if (!yy_all) {
+    yy_all = new std::string;
+    char buf[8192];
+    for (;;) { ssize_t result; YY_INPUT(buf,result,sizeof(buf)); if (result <= 0) break; yy_all->append(buf,(size_t) result); }
+    for (int i = 0; i < 62; i++) { std::string p = std::string("^(") + yy_re_src[i] + ")"; if (regcomp(&yy_re[i], p.c_str(), REG_EXTENDED | REG_NEWLINE)) { fprintf(stderr, "minilex: bad regex %s\n", p.c_str()); exit(1); } }
+  }
+  for (;;) {
+    if (yy_pos >= yy_all->size()) return 0;
+    int best = -1; size_t bestlen = 0;
+    std::string win = yy_all->substr(yy_pos, 4096);
+    for (int i = 0; i < 62; i++) {
+      regmatch_t m;
+      if (regexec(&yy_re[i], win.c_str(), 1, &m, 0) == 0 && m.rm_so == 0) {
+        size_t l = (size_t) m.rm_eo;
+        if (l > bestlen) { best = i; bestlen = l; }
+      }
+    }
+    if (best < 0) { best = 61; bestlen = 1; }
+    free(yytext);
+    yytext = strndup(yy_all->c_str() + yy_pos, bestlen);
+    yyleng = bestlen;
+    yy_pos += bestlen;
+    for (size_t i = 0; i < yyleng; i++) if (yytext[i] == '\n') yylineno++;
+    switch (best) {
+    case 0:
+      {
+                yylval.iValue = atoi(yytext);
+                return INTEGER;
+            }
+      break;
+    case 1:
+      {
+                yylval.iValue = strtoul(yytext+2,NULL,16);
+                return INTEGER;
+            }
+      break;
+    case 2:
+      {
+                yylval.iValue = strtoul(yytext+2,NULL,2);
+                return INTEGER;
+            }
+      break;
+    case 3:
+      {
+#if INF_NAN_ATOF
+		yylval.fValue = atof(yytext);
+#else
+		yylval.fValue = NAN ;
+#endif
+		return DOUBLE;
+            }
+      break;
+    case 4:
+      {
+#if INF_NAN_ATOF
+		yylval.fValue = atof(yytext);
+#else
+		yylval.fValue = INFINITY ;
+#endif
+		return DOUBLE;
+            }
+      break;
+    case 5:
+      {
+		yylval.fValue = atof(yytext);
+                return DOUBLE;
+            }
+      break;
+    case 6:
+      {
+		yylval.fValue = atof(yytext);
+                return DOUBLE;
+            }
+      break;
+    case 7:
+      {
+                char *end;
+                yylval.iRange._min = strtol(yytext,&end,10);
+		if (*end != '_') yyerror("Internal error: INTEGER_RANGE.");
+                yylval.iRange._max = atoi(end+1);
+		if (yylval.iRange._min > yylval.iRange._max) yyerror("Inversed range.");
+                return INTEGER_RANGE;
+            }
+      break;
+    case 8:
+      { return EVENT; }
+      break;
+    case 9:
+      { return STICKY_EVENT; }
+      break;
+    case 10:
+      { return SUBEVENT; }
+      break;
+    case 11:
+      { return SIGNAL; }
+      break;
+    case 12:
+      { return STICKY; }
+      break;
+    case 13:
+      { return TOGGLE; }
+      break;
+    case 14:
+      { return UINT64; }
+      break;
+    case 15:
+      { return UINT32; }
+      break;
+    case 16:
+      { return UINT16; }
+      break;
+    case 17:
+      { return UINT8; }
+      break;
+    case 18:
+      { return T_IF; }
+      break;
+    case 19:
+      { return T_ELSE; }
+      break;
+    case 20:
+      { return T_LIST; }
+      break;
+    case 21:
+      { return T_SEVERAL; }
+      break;
+    case 22:
+      { return T_OPTIONAL; }
+      break;
+    case 23:
+      { return T_SELECT; }
+      break;
+    case 24:
+      { return T_MULTI; }
+      break;
+    case 25:
+      { return T_EXTERNAL; }
+      break;
+    case 26:
+      { return T_NOREVISIT; }
+      break;
+    case 27:
+      { return T_REVISIT; }
+      break;
+    case 28:
+      { return T_IGNORE_UNKNOWN_SUBEVENT; }
+      break;
+    case 29:
+      { return T_STATIC_CAST; }
+      break;
+    case 30:
+      { return MATCH; }
+      break;
+    case 31:
+      { return CHECK; }
+      break;
+    case 32:
+      { return RANGE; }
+      break;
+    case 33:
+      { return ENCODE; }
+      break;
+    case 34:
+      { return NOENCODE; }
+      break;
+    case 35:
+      { return EXTERNAL; }
+      break;
+    case 36:
+      { return MEMBER; }
+      break;
+    case 37:
+      { return ZERO_SUPPRESS; }
+      break;
+    case 38:
+      { return ZERO_SUPPRESS_LIST; }
+      break;
+    case 39:
+      { return ZERO_SUPPRESS_MULTI; }
+      break;
+    case 40:
+      { return NO_INDEX_LIST; }
+      break;
+    case 41:
+      { return APPEND_LIST; }
+      break;
+    case 42:
+      { return FIRST_EVENT; }
+      break;
+    case 43:
+      { return LAST_EVENT; }
+      break;
+    case 44:
+      { return MARK; }
+      break;
+    case 45:
+      { return MARK_COUNT; }
+      break;
+    case 46:
+      { return CHECK_COUNT; }
+      break;
+    case 47:
+      { return MATCH_END; }
+      break;
+    case 48:
+      {
+                yylval.strValue = find_str_identifiers(yytext);
+                return IDENTIFIER;
+            }
+      break;
+    case 49:
+      { return T_LOR; }
+      break;
+    case 50:
+      { return T_LAND; }
+      break;
+    case 51:
+      { return T_SHL; }
+      break;
+    case 52:
+      { return T_SHR; }
+      break;
+    case 53:
+      { return T_LE; }
+      break;
+    case 54:
+      { return T_GE; }
+      break;
+    case 55:
+      { return T_EQ; }
+      break;
+    case 56:
+      { return T_NEQ; }
+      break;
+    case 57:
+      {
+                return *yytext;
+            }
+      break;
+    case 58:
+      { /* Cannot handle \" inside strings. */
+                yylval.strValue = find_str_strings(yytext+1,strlen(yytext)-2);
+                return STRING;
+            }
+      break;
+    case 59:
+      ;       /* ignore whitespace */
+      break;
+    case 60:
+      {
+	      char str[64];
+	      sprintf (str,"Unknown character: '%s'.",yytext);
+	      yyerror(str);
+            }
+      break;
+    case 61:
+      {  /* Information about the source location. */
+              char file[1024] = "\0";
+	      int line = 0;
+	      char *endptr;
+	      char *endfile;
+
+	      /*yylloc.last_line++;*/
+
+	      line = (int)(strtol(yytext+2,&endptr,10));
+
+	      endfile = strchr(endptr+2,'\"');
+	      if (endfile)
+		strncpy(file,endptr+2,(size_t) (endfile-(endptr+2)));
+	      else
+		strcpy(file,"UNKNOWN");
+
+	      // fprintf(stderr,"Now at %s:%d (%d)\n",file,line,yylineno);
+
+	      lineno_map *map = new lineno_map;
+
+	      map->_internal = yylineno;
+	      map->_line = line;
+	      map->_file = strdup(file);
+	      map->_prev = _last_lineno_map;
+#if LINENO_MAP_HAS_NEXT
+	      map->_next = NULL;
+
+	      if (!_first_lineno_map)
+		_first_lineno_map = map;
+	      else
+		_last_lineno_map->_next = map;
+#endif
+	      _last_lineno_map = map;
+#if SHOW_FILE_LINENO
+	      // INFO(0,"Now at %s:%d",file,line);
+#endif
+	    }
+      break;
+    }
+  }
+}
+
+int yywrap(void) {
+    return 1;
+}
+
+int lexer_read_fd = -1;
+
+ssize_t lexer_read(char* buf,size_t max_size)
+{
+  ssize_t n;
+
+  for ( ; ; )
+    {
+      n = read(lexer_read_fd,buf,max_size);
+
+      if (n == -1)
+	{
+	  if (errno == EINTR)
+	    continue;
+	  fprintf(stderr,"Failure reading from lexer pipe\n");
+	}
+      return n;
+    }
+}
+
@@ -0,0 +1,3006 @@
+/* A Bison parser, made by GNU Bison 3.8.2.  */
+
+/* Bison implementation for Yacc-like parsers in C
+
+   Copyright (C) 1984, 1989-1990, 2000-2015, 2018-2021 Free Software Foundation,
+   Inc.
+
+   This program is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <https://www.gnu.org/licenses/>.  */
+
+/* As a special exception, you may create a larger work that contains
+   part or all of the Bison parser skeleton and distribute that work
+   under terms of your choice, so long as that work isn't itself a
+   parser generator using the skeleton or a modified version thereof
+   as a parser skeleton.  Alternatively, if you modify or redistribute
+   the parser skeleton itself, you may (at your option) remove this
+   special exception, which will cause the skeleton and the resulting
+   Bison output files to be licensed under the GNU General Public
+   License without this special exception.
+
+   This special exception was added by the Free Software Foundation in
+   version 2.2 of Bison.  */
+
+/* C LALR(1) parser skeleton written by Richard Stallman, by
+   simplifying the original so-called "semantic" parser.  */
+
+/* DO NOT RELY ON FEATURES THAT ARE NOT DOCUMENTED in the manual,
+   especially those whose name start with YY_ or yy_.  They are
+   private implementation details that can be changed or removed.  */
+
+/* All symbols defined below should begin with yy or YY, to avoid
+   infringing on user name space.  This should be done even for local
+   variables, as they might otherwise be expanded by user macros.
+   There are some unavoidable exceptions within include files to
+   define necessary library symbols; they are noted "INFRINGES ON
+   USER NAME SPACE" below.  */
+
+/* Identify Bison output, and Bison version.  */
+#define YYBISON 30802
+
+/* Bison version string.  */
+#define YYBISON_VERSION "3.8.2"
+
+/* Skeleton name.  */
+#define YYSKELETON_NAME "yacc.c"
+
+/* Pure parsers.  */
+#define YYPURE 0
+
+/* Push parsers.  */
+#define YYPUSH 0
+
+/* Pull parsers.  */
+#define YYPULL 1
+
+
+
+
+/* First part of user prologue.  */
+#line 32 "parser.y"
+
+#define YYERROR_VERBOSE
+
+#define YYTYPE_INT16 int
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdarg.h>
+
+#include "definitions.hh"
+#include "parse_error.hh"
+
+int yylex(void);
+
+int yyparse(void);
+
+void yyerror(const char *s);
+
+extern int yylineno;
+
+void print_lineno(FILE* fid,int internal);
+
+struct md_ident_fl
+{
+ public:
+  md_ident_fl(const char *id,const file_line &loc)
+  {
+    _id   = id;
+    _loc = loc;
+  }
+
+ public:
+  const char *_id;
+  file_line   _loc;
+};
+
+#define CURR_FILE_LINE file_line(yylineno)
+
+int _signal_spec_order_index = 0;
+
+#define CURR_SIGNAL_COUNT (_signal_spec_order_index++)
+
+#define CHECK_INDEX(index,max) { \
+  { if ((index) <  0)     ERROR_LOC(CURR_FILE_LINE,"Variable index may not be negative (%d).\n",(index)); } \
+  { if ((index) >= (max)) ERROR_LOC(CURR_FILE_LINE,"Cowardly refusing variable index (%d) >= %d.\n",(index),(max)); } \
+}
+
+#define CHECK_ARRAY_SIZE(index,max) { \
+  { if ((index) <= 0)     ERROR_LOC(CURR_FILE_LINE,"Array size may not be negative (%d).\n",(index)); } \
+  { if ((index) > (max)) ERROR_LOC(CURR_FILE_LINE,"Cowardly refusing array size (%d) > %d.\n",(index),(max)); } \
+}
+
+
+#line 125 "generated/y.tab.c"
+
+# ifndef YY_CAST
+#  ifdef __cplusplus
+#   define YY_CAST(Type, Val) static_cast<Type> (Val)
+#   define YY_REINTERPRET_CAST(Type, Val) reinterpret_cast<Type> (Val)
+#  else
+#   define YY_CAST(Type, Val) ((Type) (Val))
+#   define YY_REINTERPRET_CAST(Type, Val) ((Type) (Val))
+#  endif
+# endif
+# ifndef YY_NULLPTR
+#  if defined __cplusplus
+#   if 201103L <= __cplusplus
+#    define YY_NULLPTR nullptr
+#   else
+#    define YY_NULLPTR 0
+#   endif
+#  else
+#   define YY_NULLPTR ((void*)0)
+#  endif
+# endif
+
+#include "y.tab.h"
+/* Symbol kind.  */
+enum yysymbol_kind_t
+{
+  YYSYMBOL_YYEMPTY = -2,
+  YYSYMBOL_YYEOF = 0,                      /* "end of file"  */
+  YYSYMBOL_YYerror = 1,                    /* error  */
+  YYSYMBOL_YYUNDEF = 2,                    /* "invalid token"  */
+  YYSYMBOL_INTEGER = 3,                    /* INTEGER  */
+  YYSYMBOL_INTEGER_RANGE = 4,              /* INTEGER_RANGE  */
+  YYSYMBOL_DOUBLE = 5,                     /* DOUBLE  */
+  YYSYMBOL_STRING = 6,                     /* STRING  */
+  YYSYMBOL_IDENTIFIER = 7,                 /* IDENTIFIER  */
+  YYSYMBOL_EVENT = 8,                      /* EVENT  */
+  YYSYMBOL_STICKY_EVENT = 9,               /* STICKY_EVENT  */
+  YYSYMBOL_SUBEVENT = 10,                  /* SUBEVENT  */
+  YYSYMBOL_SIGNAL = 11,                    /* SIGNAL  */
+  YYSYMBOL_STICKY = 12,                    /* STICKY  */
+  YYSYMBOL_TOGGLE = 13,                    /* TOGGLE  */
+  YYSYMBOL_UINT64 = 14,                    /* UINT64  */
+  YYSYMBOL_UINT32 = 15,                    /* UINT32  */
+  YYSYMBOL_UINT16 = 16,                    /* UINT16  */
+  YYSYMBOL_UINT8 = 17,                     /* UINT8  */
+  YYSYMBOL_T_IF = 18,                      /* T_IF  */
+  YYSYMBOL_T_ELSE = 19,                    /* T_ELSE  */
+  YYSYMBOL_T_LIST = 20,                    /* T_LIST  */
+  YYSYMBOL_T_SEVERAL = 21,                 /* T_SEVERAL  */
+  YYSYMBOL_T_OPTIONAL = 22,                /* T_OPTIONAL  */
+  YYSYMBOL_T_SELECT = 23,                  /* T_SELECT  */
+  YYSYMBOL_T_MULTI = 24,                   /* T_MULTI  */
+  YYSYMBOL_T_EXTERNAL = 25,                /* T_EXTERNAL  */
+  YYSYMBOL_T_NOREVISIT = 26,               /* T_NOREVISIT  */
+  YYSYMBOL_T_REVISIT = 27,                 /* T_REVISIT  */
+  YYSYMBOL_T_IGNORE_UNKNOWN_SUBEVENT = 28, /* T_IGNORE_UNKNOWN_SUBEVENT  */
+  YYSYMBOL_T_STATIC_CAST = 29,             /* T_STATIC_CAST  */
+  YYSYMBOL_T_LOR = 30,                     /* T_LOR  */
+  YYSYMBOL_T_LAND = 31,                    /* T_LAND  */
+  YYSYMBOL_T_SHL = 32,                     /* T_SHL  */
+  YYSYMBOL_T_SHR = 33,                     /* T_SHR  */
+  YYSYMBOL_T_LE = 34,                      /* T_LE  */
+  YYSYMBOL_T_GE = 35,                      /* T_GE  */
+  YYSYMBOL_T_EQ = 36,                      /* T_EQ  */
+  YYSYMBOL_T_NEQ = 37,                     /* T_NEQ  */
+  YYSYMBOL_MATCH = 38,                     /* MATCH  */
+  YYSYMBOL_CHECK = 39,                     /* CHECK  */
+  YYSYMBOL_RANGE = 40,                     /* RANGE  */
+  YYSYMBOL_ENCODE = 41,                    /* ENCODE  */
+  YYSYMBOL_NOENCODE = 42,                  /* NOENCODE  */
+  YYSYMBOL_EXTERNAL = 43,                  /* EXTERNAL  */
+  YYSYMBOL_MEMBER = 44,                    /* MEMBER  */
+  YYSYMBOL_ZERO_SUPPRESS = 45,             /* ZERO_SUPPRESS  */
+  YYSYMBOL_ZERO_SUPPRESS_LIST = 46,        /* ZERO_SUPPRESS_LIST  */
+  YYSYMBOL_ZERO_SUPPRESS_MULTI = 47,       /* ZERO_SUPPRESS_MULTI  */
+  YYSYMBOL_NO_INDEX_LIST = 48,             /* NO_INDEX_LIST  */
+  YYSYMBOL_APPEND_LIST = 49,               /* APPEND_LIST  */
+  YYSYMBOL_FIRST_EVENT = 50,               /* FIRST_EVENT  */
+  YYSYMBOL_LAST_EVENT = 51,                /* LAST_EVENT  */
+  YYSYMBOL_MARK = 52,                      /* MARK  */
+  YYSYMBOL_MARK_COUNT = 53,                /* MARK_COUNT  */
+  YYSYMBOL_CHECK_COUNT = 54,               /* CHECK_COUNT  */
+  YYSYMBOL_MATCH_END = 55,                 /* MATCH_END  */
+  YYSYMBOL_56_ = 56,                       /* '|'  */
+  YYSYMBOL_57_ = 57,                       /* '^'  */
+  YYSYMBOL_58_ = 58,                       /* '&'  */
+  YYSYMBOL_59_ = 59,                       /* '<'  */
+  YYSYMBOL_60_ = 60,                       /* '>'  */
+  YYSYMBOL_61_ = 61,                       /* '+'  */
+  YYSYMBOL_62_ = 62,                       /* '-'  */
+  YYSYMBOL_63_ = 63,                       /* '*'  */
+  YYSYMBOL_64_ = 64,                       /* '/'  */
+  YYSYMBOL_65_ = 65,                       /* '%'  */
+  YYSYMBOL_ULNOT = 66,                     /* ULNOT  */
+  YYSYMBOL_UMINUS = 67,                    /* UMINUS  */
+  YYSYMBOL_68_ = 68,                       /* ';'  */
+  YYSYMBOL_69_ = 69,                       /* '{'  */
+  YYSYMBOL_70_ = 70,                       /* '}'  */
+  YYSYMBOL_71_ = 71,                       /* '('  */
+  YYSYMBOL_72_ = 72,                       /* ')'  */
+  YYSYMBOL_73_ = 73,                       /* ','  */
+  YYSYMBOL_74_ = 74,                       /* '='  */
+  YYSYMBOL_75_ = 75,                       /* '.'  */
+  YYSYMBOL_76_ = 76,                       /* '['  */
+  YYSYMBOL_77_ = 77,                       /* ']'  */
+  YYSYMBOL_78_ = 78,                       /* '~'  */
+  YYSYMBOL_79_ = 79,                       /* '!'  */
+  YYSYMBOL_80_ = 80,                       /* ':'  */
+  YYSYMBOL_YYACCEPT = 81,                  /* $accept  */
+  YYSYMBOL_program = 82,                   /* program  */
+  YYSYMBOL_stmt_list = 83,                 /* stmt_list  */
+  YYSYMBOL_stmt = 84,                      /* stmt  */
+  YYSYMBOL_event_definition = 85,          /* event_definition  */
+  YYSYMBOL_event_definition_body = 86,     /* event_definition_body  */
+  YYSYMBOL_structure_definition = 87,      /* structure_definition  */
+  YYSYMBOL_structure_header = 88,          /* structure_header  */
+  YYSYMBOL_structure_body_null = 89,       /* structure_body_null  */
+  YYSYMBOL_structure_body = 90,            /* structure_body  */
+  YYSYMBOL_structure_item = 91,            /* structure_item  */
+  YYSYMBOL_member_item = 92,               /* member_item  */
+  YYSYMBOL_mark_count_item = 93,           /* mark_count_item  */
+  YYSYMBOL_check_count_item = 94,          /* check_count_item  */
+  YYSYMBOL_event_declared_item_list = 95,  /* event_declared_item_list  */
+  YYSYMBOL_event_declared_item = 96,       /* event_declared_item  */
+  YYSYMBOL_declared_item_list_null = 97,   /* declared_item_list_null  */
+  YYSYMBOL_declared_item_list = 98,        /* declared_item_list  */
+  YYSYMBOL_declared_item = 99,             /* declared_item  */
+  YYSYMBOL_declared_item_multi_ext = 100,  /* declared_item_multi_ext  */
+  YYSYMBOL_declared_item_multi_ext_list = 101, /* declared_item_multi_ext_list  */
+  YYSYMBOL_declared_item_multi_ext_item = 102, /* declared_item_multi_ext_item  */
+  YYSYMBOL_list_item = 103,                /* list_item  */
+  YYSYMBOL_select_item = 104,              /* select_item  */
+  YYSYMBOL_select_flag = 105,              /* select_flag  */
+  YYSYMBOL_conditional_item = 106,         /* conditional_item  */
+  YYSYMBOL_conditional_else_item = 107,    /* conditional_else_item  */
+  YYSYMBOL_var_or_const_or_external = 108, /* var_or_const_or_external  */
+  YYSYMBOL_var_or_const = 109,             /* var_or_const  */
+  YYSYMBOL_var_named = 110,                /* var_named  */
+  YYSYMBOL_var_named_single_indexed = 111, /* var_named_single_indexed  */
+  YYSYMBOL_var_named_single = 112,         /* var_named_single  */
+  YYSYMBOL_var_expr = 113,                 /* var_expr  */
+  YYSYMBOL_var_eval_int_const = 114,       /* var_eval_int_const  */
+  YYSYMBOL_param_list_null = 115,          /* param_list_null  */
+  YYSYMBOL_param_list = 116,               /* param_list  */
+  YYSYMBOL_param_item = 117,               /* param_item  */
+  YYSYMBOL_arg_list_null = 118,            /* arg_list_null  */
+  YYSYMBOL_arg_list = 119,                 /* arg_list  */
+  YYSYMBOL_arg_item = 120,                 /* arg_item  */
+  YYSYMBOL_data_item = 121,                /* data_item  */
+  YYSYMBOL_data_item_flag = 122,           /* data_item_flag  */
+  YYSYMBOL_noencode = 123,                 /* noencode  */
+  YYSYMBOL_zero_suppress = 124,            /* zero_suppress  */
+  YYSYMBOL_encode_item_list = 125,         /* encode_item_list  */
+  YYSYMBOL_cond_or_encode_item = 126,      /* cond_or_encode_item  */
+  YYSYMBOL_encode_item = 127,              /* encode_item  */
+  YYSYMBOL_encode_flags = 128,             /* encode_flags  */
+  YYSYMBOL_cond_encode_item = 129,         /* cond_encode_item  */
+  YYSYMBOL_cond_encode_else_item = 130,    /* cond_encode_else_item  */
+  YYSYMBOL_data_item_size = 131,           /* data_item_size  */
+  YYSYMBOL_data_item_bits_list = 132,      /* data_item_bits_list  */
+  YYSYMBOL_data_item_bits = 133,           /* data_item_bits  */
+  YYSYMBOL_bits_range = 134,               /* bits_range  */
+  YYSYMBOL_bits_condition = 135,           /* bits_condition  */
+  YYSYMBOL_signal_or_sticky = 136,         /* signal_or_sticky  */
+  YYSYMBOL_signal = 137,                   /* signal  */
+  YYSYMBOL_signal_ident_var = 138,         /* signal_ident_var  */
+  YYSYMBOL_signal_ident_null = 139,        /* signal_ident_null  */
+  YYSYMBOL_signal_types = 140,             /* signal_types  */
+  YYSYMBOL_signal_type = 141,              /* signal_type  */
+  YYSYMBOL_signal_type_unit = 142,         /* signal_type_unit  */
+  YYSYMBOL_signal_tags = 143,              /* signal_tags  */
+  YYSYMBOL_signal_tag_list = 144,          /* signal_tag_list  */
+  YYSYMBOL_signal_tag = 145,               /* signal_tag  */
+  YYSYMBOL_signal_info = 146               /* signal_info  */
+};
+typedef enum yysymbol_kind_t yysymbol_kind_t;
+
+
+
+
+#ifdef short
+# undef short
+#endif
+
+/* On compilers that do not define __PTRDIFF_MAX__ etc., make sure
+   <limits.h> and (if available) <stdint.h> are included
+   so that the code can choose integer types of a good width.  */
+
+#ifndef __PTRDIFF_MAX__
+# include <limits.h> /* INFRINGES ON USER NAME SPACE */
+# if defined __STDC_VERSION__ && 199901 <= __STDC_VERSION__
+#  include <stdint.h> /* INFRINGES ON USER NAME SPACE */
+#  define YY_STDINT_H
+# endif
+#endif
+
+/* Narrow types that promote to a signed type and that can represent a
+   signed or unsigned integer of at least N bits.  In tables they can
+   save space and decrease cache pressure.  Promoting to a signed type
+   helps avoid bugs in integer arithmetic.  */
+
+#ifdef __INT_LEAST8_MAX__
+typedef __INT_LEAST8_TYPE__ yytype_int8;
+#elif defined YY_STDINT_H
+typedef int_least8_t yytype_int8;
+#else
+typedef signed char yytype_int8;
+#endif
+
+#ifdef __INT_LEAST16_MAX__
+typedef __INT_LEAST16_TYPE__ yytype_int16;
+#elif defined YY_STDINT_H
+typedef int_least16_t yytype_int16;
+#else
+typedef short yytype_int16;
+#endif
+
+/* Work around bug in HP-UX 11.23, which defines these macros
+   incorrectly for preprocessor constants.  This workaround can likely
+   be removed in 2023, as HPE has promised support for HP-UX 11.23
+   (aka HP-UX 11i v2) only through the end of 2022; see Table 2 of
+   <https://h20195.www2.hpe.com/V2/getpdf.aspx/4AA4-7673ENW.pdf>.  */
+#ifdef __hpux
+# undef UINT_LEAST8_MAX
+# undef UINT_LEAST16_MAX
+# define UINT_LEAST8_MAX 255
+# define UINT_LEAST16_MAX 65535
+#endif
+
+#if defined __UINT_LEAST8_MAX__ && __UINT_LEAST8_MAX__ <= __INT_MAX__
+typedef __UINT_LEAST8_TYPE__ yytype_uint8;
+#elif (!defined __UINT_LEAST8_MAX__ && defined YY_STDINT_H \
+       && UINT_LEAST8_MAX <= INT_MAX)
+typedef uint_least8_t yytype_uint8;
+#elif !defined __UINT_LEAST8_MAX__ && UCHAR_MAX <= INT_MAX
+typedef unsigned char yytype_uint8;
+#else
+typedef short yytype_uint8;
+#endif
+
+#if defined __UINT_LEAST16_MAX__ && __UINT_LEAST16_MAX__ <= __INT_MAX__
+typedef __UINT_LEAST16_TYPE__ yytype_uint16;
+#elif (!defined __UINT_LEAST16_MAX__ && defined YY_STDINT_H \
+       && UINT_LEAST16_MAX <= INT_MAX)
+typedef uint_least16_t yytype_uint16;
+#elif !defined __UINT_LEAST16_MAX__ && USHRT_MAX <= INT_MAX
+typedef unsigned short yytype_uint16;
+#else
+typedef int yytype_uint16;
+#endif
+
+#ifndef YYPTRDIFF_T
+# if defined __PTRDIFF_TYPE__ && defined __PTRDIFF_MAX__
+#  define YYPTRDIFF_T __PTRDIFF_TYPE__
+#  define YYPTRDIFF_MAXIMUM __PTRDIFF_MAX__
+# elif defined PTRDIFF_MAX
+#  ifndef ptrdiff_t
+#   include <stddef.h> /* INFRINGES ON USER NAME SPACE */
+#  endif
+#  define YYPTRDIFF_T ptrdiff_t
+#  define YYPTRDIFF_MAXIMUM PTRDIFF_MAX
+# else
+#  define YYPTRDIFF_T long
+#  define YYPTRDIFF_MAXIMUM LONG_MAX
+# endif
+#endif
+
+#ifndef YYSIZE_T
+# ifdef __SIZE_TYPE__
+#  define YYSIZE_T __SIZE_TYPE__
+# elif defined size_t
+#  define YYSIZE_T size_t
+# elif defined __STDC_VERSION__ && 199901 <= __STDC_VERSION__
+#  include <stddef.h> /* INFRINGES ON USER NAME SPACE */
+#  define YYSIZE_T size_t
+# else
+#  define YYSIZE_T unsigned
+# endif
+#endif
+
+#define YYSIZE_MAXIMUM                                  \
+  YY_CAST (YYPTRDIFF_T,                                 \
+           (YYPTRDIFF_MAXIMUM < YY_CAST (YYSIZE_T, -1)  \
+            ? YYPTRDIFF_MAXIMUM                         \
+            : YY_CAST (YYSIZE_T, -1)))
+
+#define YYSIZEOF(X) YY_CAST (YYPTRDIFF_T, sizeof (X))
+
+
+/* Stored state numbers (used for stacks). */
+typedef yytype_int16 yy_state_t;
+
+/* State numbers in computations.  */
+typedef int yy_state_fast_t;
+
+#ifndef YY_
+# if defined YYENABLE_NLS && YYENABLE_NLS
+#  if ENABLE_NLS
+#   include <libintl.h> /* INFRINGES ON USER NAME SPACE */
+#   define YY_(Msgid) dgettext ("bison-runtime", Msgid)
+#  endif
+# endif
+# ifndef YY_
+#  define YY_(Msgid) Msgid
+# endif
+#endif
+
+
+#ifndef YY_ATTRIBUTE_PURE
+# if defined __GNUC__ && 2 < __GNUC__ + (96 <= __GNUC_MINOR__)
+#  define YY_ATTRIBUTE_PURE __attribute__ ((__pure__))
+# else
+#  define YY_ATTRIBUTE_PURE
+# endif
+#endif
+
+#ifndef YY_ATTRIBUTE_UNUSED
+# if defined __GNUC__ && 2 < __GNUC__ + (7 <= __GNUC_MINOR__)
+#  define YY_ATTRIBUTE_UNUSED __attribute__ ((__unused__))
+# else
+#  define YY_ATTRIBUTE_UNUSED
+# endif
+#endif
+
+/* Suppress unused-variable warnings by "using" E.  */
+#if ! defined lint || defined __GNUC__
+# define YY_USE(E) ((void) (E))
+#else
+# define YY_USE(E) /* empty */
+#endif
+
+/* Suppress an incorrect diagnostic about yylval being uninitialized.  */
+#if defined __GNUC__ && ! defined __ICC && 406 <= __GNUC__ * 100 + __GNUC_MINOR__
+# if __GNUC__ * 100 + __GNUC_MINOR__ < 407
+#  define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                           \
+    _Pragma ("GCC diagnostic push")                                     \
+    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")
+# else
+#  define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                           \
+    _Pragma ("GCC diagnostic push")                                     \
+    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")              \
+    _Pragma ("GCC diagnostic ignored \"-Wmaybe-uninitialized\"")
+# endif
+# define YY_IGNORE_MAYBE_UNINITIALIZED_END      \
+    _Pragma ("GCC diagnostic pop")
+#else
+# define YY_INITIAL_VALUE(Value) Value
+#endif
+#ifndef YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+# define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+# define YY_IGNORE_MAYBE_UNINITIALIZED_END
+#endif
+#ifndef YY_INITIAL_VALUE
+# define YY_INITIAL_VALUE(Value) /* Nothing. */
+#endif
+
+#if defined __cplusplus && defined __GNUC__ && ! defined __ICC && 6 <= __GNUC__
+# define YY_IGNORE_USELESS_CAST_BEGIN                          \
+    _Pragma ("GCC diagnostic push")                            \
+    _Pragma ("GCC diagnostic ignored \"-Wuseless-cast\"")
+# define YY_IGNORE_USELESS_CAST_END            \
+    _Pragma ("GCC diagnostic pop")
+#endif
+#ifndef YY_IGNORE_USELESS_CAST_BEGIN
+# define YY_IGNORE_USELESS_CAST_BEGIN
+# define YY_IGNORE_USELESS_CAST_END
+#endif
+
+
+#define YY_ASSERT(E) ((void) (0 && (E)))
+
+#if !defined yyoverflow
+
+/* The parser invokes alloca or malloc; define the necessary symbols.  */
+
+# ifdef YYSTACK_USE_ALLOCA
+#  if YYSTACK_USE_ALLOCA
+#   ifdef __GNUC__
+#    define YYSTACK_ALLOC __builtin_alloca
+#   elif defined __BUILTIN_VA_ARG_INCR
+#    include <alloca.h> /* INFRINGES ON USER NAME SPACE */
+#   elif defined _AIX
+#    define YYSTACK_ALLOC __alloca
+#   elif defined _MSC_VER
+#    include <malloc.h> /* INFRINGES ON USER NAME SPACE */
+#    define alloca _alloca
+#   else
+#    define YYSTACK_ALLOC alloca
+#    if ! defined _ALLOCA_H && ! defined EXIT_SUCCESS
+#     include <stdlib.h> /* INFRINGES ON USER NAME SPACE */
+      /* Use EXIT_SUCCESS as a witness for stdlib.h.  */
+#     ifndef EXIT_SUCCESS
+#      define EXIT_SUCCESS 0
+#     endif
+#    endif
+#   endif
+#  endif
+# endif
+
+# ifdef YYSTACK_ALLOC
+   /* Pacify GCC's 'empty if-body' warning.  */
+#  define YYSTACK_FREE(Ptr) do { /* empty */; } while (0)
+#  ifndef YYSTACK_ALLOC_MAXIMUM
+    /* The OS might guarantee only one guard page at the bottom of the stack,
+       and a page size can be as small as 4096 bytes.  So we cannot safely
+       invoke alloca (N) if N exceeds 4096.  Use a slightly smaller number
+       to allow for a few compiler-allocated temporary stack slots.  */
+#   define YYSTACK_ALLOC_MAXIMUM 4032 /* reasonable circa 2006 */
+#  endif
+# else
+#  define YYSTACK_ALLOC YYMALLOC
+#  define YYSTACK_FREE YYFREE
+#  ifndef YYSTACK_ALLOC_MAXIMUM
+#   define YYSTACK_ALLOC_MAXIMUM YYSIZE_MAXIMUM
+#  endif
+#  if (defined __cplusplus && ! defined EXIT_SUCCESS \
+       && ! ((defined YYMALLOC || defined malloc) \
+             && (defined YYFREE || defined free)))
+#   include <stdlib.h> /* INFRINGES ON USER NAME SPACE */
+#   ifndef EXIT_SUCCESS
+#    define EXIT_SUCCESS 0
+#   endif
+#  endif
+#  ifndef YYMALLOC
+#   define YYMALLOC malloc
+#   if ! defined malloc && ! defined EXIT_SUCCESS
+void *malloc (YYSIZE_T); /* INFRINGES ON USER NAME SPACE */
+#   endif
+#  endif
+#  ifndef YYFREE
+#   define YYFREE free
+#   if ! defined free && ! defined EXIT_SUCCESS
+void free (void *); /* INFRINGES ON USER NAME SPACE */
+#   endif
+#  endif
+# endif
+#endif /* !defined yyoverflow */
+
+#if (! defined yyoverflow \
+     && (! defined __cplusplus \
+         || (defined YYSTYPE_IS_TRIVIAL && YYSTYPE_IS_TRIVIAL)))
+
+/* A type that is properly aligned for any stack member.  */
+union yyalloc
+{
+  yy_state_t yyss_alloc;
+  YYSTYPE yyvs_alloc;
+};
+
+/* The size of the maximum gap between one aligned stack and the next.  */
+# define YYSTACK_GAP_MAXIMUM (YYSIZEOF (union yyalloc) - 1)
+
+/* The size of an array large to enough to hold all stacks, each with
+   N elements.  */
+# define YYSTACK_BYTES(N) \
+     ((N) * (YYSIZEOF (yy_state_t) + YYSIZEOF (YYSTYPE)) \
+      + YYSTACK_GAP_MAXIMUM)
+
+# define YYCOPY_NEEDED 1
+
+/* Relocate STACK from its old location to the new one.  The
+   local variables YYSIZE and YYSTACKSIZE give the old and new number of
+   elements in the stack, and YYPTR gives the new location of the
+   stack.  Advance YYPTR to a properly aligned location for the next
+   stack.  */
+# define YYSTACK_RELOCATE(Stack_alloc, Stack)                           \
+    do                                                                  \
+      {                                                                 \
+        YYPTRDIFF_T yynewbytes;                                         \
+        YYCOPY (&yyptr->Stack_alloc, Stack, yysize);                    \
+        Stack = &yyptr->Stack_alloc;                                    \
+        yynewbytes = yystacksize * YYSIZEOF (*Stack) + YYSTACK_GAP_MAXIMUM; \
+        yyptr += yynewbytes / YYSIZEOF (*yyptr);                        \
+      }                                                                 \
+    while (0)
+
+#endif
+
+#if defined YYCOPY_NEEDED && YYCOPY_NEEDED
+/* Copy COUNT objects from SRC to DST.  The source and destination do
+   not overlap.  */
+# ifndef YYCOPY
+#  if defined __GNUC__ && 1 < __GNUC__
+#   define YYCOPY(Dst, Src, Count) \
+      __builtin_memcpy (Dst, Src, YY_CAST (YYSIZE_T, (Count)) * sizeof (*(Src)))
+#  else
+#   define YYCOPY(Dst, Src, Count)              \
+      do                                        \
+        {                                       \
+          YYPTRDIFF_T yyi;                      \
+          for (yyi = 0; yyi < (Count); yyi++)   \
+            (Dst)[yyi] = (Src)[yyi];            \
+        }                                       \
+      while (0)
+#  endif
+# endif
+#endif /* !YYCOPY_NEEDED */
+
+/* YYFINAL -- State number of the termination state.  */
+#define YYFINAL  24
+/* YYLAST -- Last index in YYTABLE.  */
+#define YYLAST   1081
+
+/* YYNTOKENS -- Number of terminals.  */
+#define YYNTOKENS  81
+/* YYNNTS -- Number of nonterminals.  */
+#define YYNNTS  66
+/* YYNRULES -- Number of rules.  */
+#define YYNRULES  178
+/* YYNSTATES -- Number of states.  */
+#define YYNSTATES  398
+
+/* YYMAXUTOK -- Last valid token kind.  */
+#define YYMAXUTOK   312
+
+
+/* YYTRANSLATE(TOKEN-NUM) -- Symbol number corresponding to TOKEN-NUM
+   as returned by yylex, with out-of-bounds checking.  */
+#define YYTRANSLATE(YYX)                                \
+  (0 <= (YYX) && (YYX) <= YYMAXUTOK                     \
+   ? YY_CAST (yysymbol_kind_t, yytranslate[YYX])        \
+   : YYSYMBOL_YYUNDEF)
+
+/* YYTRANSLATE[TOKEN-NUM] -- Symbol number corresponding to TOKEN-NUM
+   as returned by yylex.  */
+static const yytype_int8 yytranslate[] =
+{
+       0,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,    79,     2,     2,     2,    65,    58,     2,
+      71,    72,    63,    61,    73,    62,    75,    64,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,    80,    68,
+      59,    74,    60,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,    76,     2,    77,    57,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,    69,    56,    70,    78,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     1,     2,     3,     4,
+       5,     6,     7,     8,     9,    10,    11,    12,    13,    14,
+      15,    16,    17,    18,    19,    20,    21,    22,    23,    24,
+      25,    26,    27,    28,    29,    30,    31,    32,    33,    34,
+      35,    36,    37,    38,    39,    40,    41,    42,    43,    44,
+      45,    46,    47,    48,    49,    50,    51,    52,    53,    54,
+      55,    66,    67
+};
+
+#if YYDEBUG
+/* YYRLINE[YYN] -- Source line where rule number YYN was defined.  */
+static const yytype_int16 yyrline[] =
+{
+       0,   332,   332,   333,   337,   338,   343,   344,   345,   346,
+     347,   356,   357,   361,   365,   366,   370,   371,   375,   376,
+     380,   381,   385,   386,   387,   388,   390,   391,   392,   393,
+     394,   395,   396,   400,   404,   405,   409,   413,   414,   418,
+     419,   423,   424,   428,   429,   433,   437,   438,   442,   443,
+     447,   448,   449,   450,   454,   458,   463,   464,   465,   474,
+     478,   479,   480,   486,   487,   491,   492,   496,   497,   498,
+     502,   503,   504,   508,   509,   512,   519,   520,   521,   522,
+     523,   524,   525,   526,   527,   528,   529,   530,   531,   532,
+     533,   534,   535,   536,   537,   538,   539,   540,   541,   542,
+     543,   547,   560,   561,   565,   566,   570,   571,   577,   578,
+     582,   583,   587,   596,   597,   598,   602,   603,   604,   608,
+     609,   613,   614,   615,   616,   617,   621,   622,   626,   627,
+     631,   635,   636,   640,   644,   645,   646,   650,   651,   652,
+     653,   657,   658,   662,   663,   664,   665,   666,   670,   671,
+     675,   676,   677,   678,   684,   685,   689,   696,   705,   713,
+     726,   736,   743,   750,   752,   757,   758,   762,   763,   768,
+     772,   773,   777,   778,   779,   789,   794,   799,   806
+};
+#endif
+
+/** Accessing symbol of state STATE.  */
+#define YY_ACCESSING_SYMBOL(State) YY_CAST (yysymbol_kind_t, yystos[State])
+
+#if YYDEBUG || 0
+/* The user-facing name of the symbol whose (internal) number is
+   YYSYMBOL.  No bounds checking.  */
+static const char *yysymbol_name (yysymbol_kind_t yysymbol) YY_ATTRIBUTE_UNUSED;
+
+/* YYTNAME[SYMBOL-NUM] -- String name of the symbol SYMBOL-NUM.
+   First, the terminals, then, starting at YYNTOKENS, nonterminals.  */
+static const char *const yytname[] =
+{
+  "\"end of file\"", "error", "\"invalid token\"", "INTEGER",
+  "INTEGER_RANGE", "DOUBLE", "STRING", "IDENTIFIER", "EVENT",
+  "STICKY_EVENT", "SUBEVENT", "SIGNAL", "STICKY", "TOGGLE", "UINT64",
+  "UINT32", "UINT16", "UINT8", "T_IF", "T_ELSE", "T_LIST", "T_SEVERAL",
+  "T_OPTIONAL", "T_SELECT", "T_MULTI", "T_EXTERNAL", "T_NOREVISIT",
+  "T_REVISIT", "T_IGNORE_UNKNOWN_SUBEVENT", "T_STATIC_CAST", "T_LOR",
+  "T_LAND", "T_SHL", "T_SHR", "T_LE", "T_GE", "T_EQ", "T_NEQ", "MATCH",
+  "CHECK", "RANGE", "ENCODE", "NOENCODE", "EXTERNAL", "MEMBER",
+  "ZERO_SUPPRESS", "ZERO_SUPPRESS_LIST", "ZERO_SUPPRESS_MULTI",
+  "NO_INDEX_LIST", "APPEND_LIST", "FIRST_EVENT", "LAST_EVENT", "MARK",
+  "MARK_COUNT", "CHECK_COUNT", "MATCH_END", "'|'", "'^'", "'&'", "'<'",
+  "'>'", "'+'", "'-'", "'*'", "'/'", "'%'", "ULNOT", "UMINUS", "';'",
+  "'{'", "'}'", "'('", "')'", "','", "'='", "'.'", "'['", "']'", "'~'",
+  "'!'", "':'", "$accept", "program", "stmt_list", "stmt",
+  "event_definition", "event_definition_body", "structure_definition",
+  "structure_header", "structure_body_null", "structure_body",
+  "structure_item", "member_item", "mark_count_item", "check_count_item",
+  "event_declared_item_list", "event_declared_item",
+  "declared_item_list_null", "declared_item_list", "declared_item",
+  "declared_item_multi_ext", "declared_item_multi_ext_list",
+  "declared_item_multi_ext_item", "list_item", "select_item",
+  "select_flag", "conditional_item", "conditional_else_item",
+  "var_or_const_or_external", "var_or_const", "var_named",
+  "var_named_single_indexed", "var_named_single", "var_expr",
+  "var_eval_int_const", "param_list_null", "param_list", "param_item",
+  "arg_list_null", "arg_list", "arg_item", "data_item", "data_item_flag",
+  "noencode", "zero_suppress", "encode_item_list", "cond_or_encode_item",
+  "encode_item", "encode_flags", "cond_encode_item",
+  "cond_encode_else_item", "data_item_size", "data_item_bits_list",
+  "data_item_bits", "bits_range", "bits_condition", "signal_or_sticky",
+  "signal", "signal_ident_var", "signal_ident_null", "signal_types",
+  "signal_type", "signal_type_unit", "signal_tags", "signal_tag_list",
+  "signal_tag", "signal_info", YY_NULLPTR
+};
+
+static const char *
+yysymbol_name (yysymbol_kind_t yysymbol)
+{
+  return yytname[yysymbol];
+}
+#endif
+
+#define YYPACT_NINF (-362)
+
+#define yypact_value_is_default(Yyn) \
+  ((Yyn) == YYPACT_NINF)
+
+#define YYTABLE_NINF (-47)
+
+#define yytable_value_is_error(Yyn) \
+  0
+
+/* YYPACT[STATE-NUM] -- Index in YYTABLE of the portion describing
+   STATE-NUM.  */
+static const yytype_int16 yypact[] =
+{
+     140,    -4,     6,     6,     8,  -362,  -362,    48,  -362,   107,
+     140,  -362,  -362,  -362,    51,    59,    92,    98,   139,   218,
+    -362,  -362,   172,   112,  -362,  -362,   208,   203,  -362,  -362,
+     108,   119,   124,  -362,  -362,  -362,  -362,  -362,   130,   111,
+    -362,  -362,   177,   147,  -362,   127,  -362,   132,   134,  -362,
+    -362,    24,   135,   138,   152,   153,   154,   133,  -362,   195,
+     283,  -362,  -362,  -362,  -362,  -362,  -362,  -362,  -362,  -362,
+     197,  -362,   174,   261,   187,   200,   -31,  -362,  -362,   199,
+     201,   266,   -26,  -362,   114,  -362,   139,  -362,  -362,  -362,
+     204,   205,  -362,  -362,   114,    71,  -362,  -362,   206,   270,
+     274,   275,   276,   114,  -362,  -362,  -362,  -362,  -362,  -362,
+    -362,   277,   278,  -362,   279,   114,   114,   281,    45,   117,
+     216,   219,    13,  -362,  -362,   -10,   232,   286,   114,   114,
+     114,   114,   114,  -362,  -362,  -362,  -362,   957,  -362,  -362,
+     114,   287,   657,   262,   137,   221,   253,   177,   239,   240,
+     533,   271,  -362,   242,   243,   244,   245,   216,    16,  -362,
+     246,   248,   312,  -362,  -362,   249,   278,    45,  -362,   278,
+     114,   315,  -362,  -362,  -362,   674,  -362,  -362,   114,   114,
+     114,   114,   114,   114,   114,   114,   114,   114,   114,   114,
+     114,   114,   114,   114,   114,   114,   252,   254,   257,   278,
+     260,   137,  -362,   114,  -362,   250,   191,   263,   264,   326,
+    -362,    46,  -362,   269,   272,  -362,   267,   117,  -362,  -362,
+    -362,   282,   284,  -362,   273,   294,  -362,   449,   967,   194,
+     194,   157,   157,  1016,  1016,  1001,  1009,   602,   157,   157,
+      77,    77,  -362,  -362,  -362,   258,   350,   435,   299,  -362,
+    -362,   461,   288,  -362,  -362,   289,  -362,   291,  -362,  -362,
+     295,  -362,    78,   354,   357,    16,   297,   117,  -362,    52,
+     296,   114,   298,   306,   314,  -362,   321,   114,   316,   350,
+     114,   302,   364,   308,   310,    10,  -362,     5,   322,   323,
+     324,  -362,   325,   278,   114,   328,   114,   330,   350,   374,
+     717,   114,    96,   327,  -362,   329,  -362,  -362,   335,  -362,
+      -2,  -362,  -362,  -362,  -362,   333,     9,   114,  -362,  -362,
+    -362,  -362,  -362,   734,  -362,   957,  -362,  -362,     2,  -362,
+     338,   497,   336,  -362,   114,   114,  -362,  -362,  -362,  -362,
+     116,   337,  -362,   435,  -362,   435,  -362,   342,   551,   777,
+     345,   355,   360,   361,   362,   365,   366,   359,   397,  -362,
+     114,   356,   114,   114,   114,   421,  -362,  -362,  -362,  -362,
+    -362,   794,     7,   837,   854,   595,   363,  -362,     0,  -362,
+    -362,   114,   428,   418,   897,   367,   -19,  -362,  -362,   114,
+       7,  -362,   613,     3,   114,  -362,   914,  -362
+};
+
+/* YYDEFACT[STATE-NUM] -- Default reduction number in state STATE-NUM.
+   Performed when YYTABLE does not specify something else to do.  Zero
+   means the default is an error.  */
+static const yytype_uint8 yydefact[] =
+{
+       3,     0,     0,     0,     0,   154,   155,     0,     6,     0,
+       2,     4,     7,     8,     0,     0,     0,     0,   102,    46,
+      11,    12,     0,     0,     1,     5,   116,     0,     9,    10,
+     106,     0,   103,   104,    50,    51,    53,    52,     0,    46,
+      37,    40,     0,    47,    48,     0,    15,     0,     0,   118,
+     117,    56,     0,     0,     0,     0,     0,     0,    22,     0,
+     116,    20,    28,    29,    30,    27,    24,    25,    26,    23,
+       0,    31,     0,     0,     0,     0,     0,   172,   173,     0,
+       0,     0,     0,   170,     0,    17,     0,    39,    13,    38,
+      73,     0,    49,    16,     0,     0,    57,    58,     0,     0,
+       0,     0,     0,     0,    32,    14,    21,   137,   138,   139,
+     140,     0,   162,   174,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,   169,    66,    73,     0,     0,     0,     0,
+       0,     0,     0,    76,    63,    65,    67,   101,   107,   105,
+       0,     0,     0,     0,    41,    70,   131,     0,     0,     0,
+       0,   119,   161,     0,     0,     0,     0,   165,     0,   166,
+       0,     0,   167,   163,   165,     0,     0,     0,   171,     0,
+       0,     0,    64,    78,    77,     0,    79,    80,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,    42,    43,     0,   132,     0,   121,     0,     0,     0,
+     120,     0,   175,     0,     0,   176,     0,     0,   156,   168,
+     160,     0,     0,    68,     0,     0,    81,    82,    83,    93,
+      92,    96,    97,    98,    99,    90,    91,    89,    94,    95,
+      84,    85,    86,    87,    88,    74,   108,   116,     0,    55,
+      44,     0,     0,   122,   123,     0,   125,     0,    34,    35,
+       0,   113,     0,     0,     0,     0,     0,     0,   158,    74,
+       0,     0,     0,     0,   109,   110,   116,     0,    71,     0,
+       0,     0,     0,     0,     0,     0,   141,     0,     0,     0,
+       0,   157,     0,     0,     0,     0,     0,     0,     0,    62,
+       0,     0,     0,     0,    33,     0,   148,   149,     0,   114,
+       0,   126,   128,   129,   142,     0,     0,     0,   178,   177,
+     164,   159,    69,     0,    75,   112,    45,   111,     0,    59,
+       0,     0,     0,   124,     0,     0,   115,   127,   144,   143,
+       0,     0,   100,   116,    61,   116,    72,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,   116,   116,   130,
+       0,     0,     0,     0,     0,     0,   146,   147,   145,    60,
+      54,     0,     0,     0,     0,     0,     0,    36,     0,   151,
+     150,     0,     0,   136,     0,     0,     0,   133,   152,     0,
+       0,   135,     0,     0,     0,   134,     0,   153
+};
+
+/* YYPGOTO[NTERM-NUM].  */
+static const yytype_int16 yypgoto[] =
+{
+    -362,  -362,  -362,   429,  -362,   440,  -362,   437,  -362,  -237,
+     -59,  -362,  -362,  -362,  -362,   406,  -362,  -362,   -15,  -362,
+    -362,   403,  -362,  -362,  -362,   120,  -362,  -362,   352,   -97,
+    -362,   -35,   -94,  -113,  -362,  -362,   368,  -362,   184,   166,
+    -362,  -362,  -362,  -362,  -361,  -267,  -268,  -362,  -362,  -362,
+     396,  -362,   183,  -362,  -362,  -362,  -362,   -62,  -362,  -114,
+    -362,  -152,  -362,  -362,   347,  -362
+};
+
+/* YYDEFGOTO[NTERM-NUM].  */
+static const yytype_int16 yydefgoto[] =
+{
+       0,     9,    10,    11,    12,    20,    13,    14,    59,    60,
+      61,    62,    63,    64,    39,    40,   200,   201,    65,    42,
+      43,    44,    66,    67,    98,    68,   329,   133,   134,   135,
+     146,   136,   137,   138,    31,    32,    33,   273,   274,   275,
+      69,    70,   211,   257,   310,   311,    71,   205,   313,   387,
+     159,   285,   286,   287,   355,    15,    16,    79,    80,   161,
+     162,   163,    81,    82,    83,    17
+};
+
+/* YYTABLE[YYPACT[STATE-NUM]] -- What to do in state STATE-NUM.  If
+   positive, shift that token.  If negative, reduce the rule whose
+   number is the opposite.  If YYTABLE_NINF, syntax error.  */
+static const yytype_int16 yytable[] =
+{
+     142,   106,   154,   155,    41,   165,   216,    91,   315,   150,
+     276,   378,   316,   283,   284,   152,   308,   312,   308,   121,
+      47,   308,    52,   164,    41,   308,    73,   196,   308,   393,
+     107,   108,   109,   110,   173,   174,   175,   176,   177,    52,
+     116,    52,   312,   337,    52,    96,    97,   122,    52,   117,
+     390,    52,   157,   222,   123,     1,   160,   224,     4,   107,
+     108,   109,   110,    77,    78,   169,   170,    18,   336,   152,
+     383,   343,   223,   395,   124,    19,   317,   339,   125,    22,
+     309,   283,   284,   340,   227,   228,   229,   230,   231,   232,
+     233,   234,   235,   236,   237,   238,   239,   240,   241,   242,
+     243,   244,   248,   266,   312,   221,   357,    24,   358,   251,
+     312,   337,   206,   290,   261,   262,   158,   124,   391,   124,
+      26,   125,   312,   125,   164,   312,   337,   293,   271,   202,
+      27,   107,   108,   109,   110,    34,    35,    36,    37,    38,
+     193,   194,   195,   126,   -46,   126,    30,     1,     2,     3,
+       4,     5,     6,   292,   350,   351,   352,   127,   295,   127,
+      28,    34,    35,    36,    37,     7,    29,   303,   332,   298,
+     353,    34,    35,    36,    37,   128,   129,   128,   129,    45,
+      46,    88,    84,   300,    90,   130,   250,   130,   158,   180,
+     181,    85,   131,   132,   131,   132,   322,    86,    87,    93,
+     323,   104,   325,    94,   341,    95,    99,   331,     8,   100,
+      72,   107,   108,   109,   110,   -46,    73,   106,   191,   192,
+     193,   194,   195,   101,   102,   103,    47,   354,    48,    49,
+      50,    51,    34,    35,    36,    37,   253,   254,   255,   256,
+     348,   349,    34,    35,    36,    37,    38,   112,    74,    52,
+      75,    76,    53,    77,    78,   191,   192,   193,   194,   195,
+      54,    55,    56,    57,   113,   105,   371,   114,   373,   374,
+     375,   115,   118,   120,   119,   144,    58,   145,   -18,   141,
+     140,   147,   148,   149,   151,   125,   153,   384,   156,   166,
+     -46,   171,   167,   172,   197,   392,   199,   203,   106,   106,
+     396,    47,   204,    48,    49,    50,    51,    34,    35,    36,
+      37,   207,   208,   210,   212,   213,   214,   215,   219,   217,
+     218,   220,   225,   252,    52,   246,   247,    53,   -46,   245,
+     249,   258,   259,   260,   271,    54,    55,    56,    57,    47,
+     265,    48,    49,    50,    51,    34,    35,    36,    37,   263,
+     269,    58,   264,   -19,   270,   267,   268,   272,   277,   279,
+     280,   288,    52,   281,   289,    53,   -46,   294,   282,   291,
+     304,   305,   296,    54,    55,    56,    57,    47,   297,    48,
+      49,    50,    51,    34,    35,    36,    37,   298,   306,    58,
+     307,   299,   301,   328,   318,   319,   320,   321,   326,   333,
+      52,   338,   334,    53,   -46,   324,   335,   345,   347,   356,
+     359,    54,    55,    56,    57,    47,   362,    48,    49,    50,
+      51,    34,    35,    36,    37,   372,   363,    58,   376,   369,
+     366,   364,   365,   367,   368,   385,   382,   386,    52,    25,
+     389,    53,   -46,    21,    23,    89,    92,   143,   344,    54,
+      55,    56,    57,    47,   139,    48,    49,    50,    51,    34,
+      35,    36,    37,   302,   327,    58,   111,   370,   314,   168,
+       0,     0,     0,     0,     0,     0,    52,     0,     0,    53,
+     179,   180,   181,   182,   183,   184,   185,    54,    55,    56,
+      57,   178,   179,   180,   181,   182,   183,   184,   185,     0,
+       0,     0,     0,    58,     0,   186,   187,   188,   189,   190,
+     191,   192,   193,   194,   195,     0,     0,   186,   187,   188,
+     189,   190,   191,   192,   193,   194,   195,   178,   179,   180,
+     181,   182,   183,   184,   185,     0,     0,     0,   278,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,   186,   187,   188,   189,   190,   191,   192,
+     193,   194,   195,   178,   179,   180,   181,   182,   183,   184,
+     185,     0,     0,     0,   346,     0,     0,     0,     0,     0,
+       0,   178,   179,   180,   181,   182,   183,   184,   185,   186,
+     187,   188,   189,   190,   191,   192,   193,   194,   195,     0,
+       0,     0,     0,     0,     0,     0,   209,   186,   187,   188,
+     189,   190,   191,   192,   193,   194,   195,     0,     0,     0,
+       0,     0,     0,     0,   360,   178,   179,   180,   181,   182,
+     183,   184,   185,     0,   180,   181,   182,   183,   184,   185,
+       0,     0,     0,   178,   179,   180,   181,   182,   183,   184,
+     185,   186,   187,   188,   189,   190,   191,   192,   193,   194,
+     195,   189,   190,   191,   192,   193,   194,   195,   381,   186,
+     187,   188,   189,   190,   191,   192,   193,   194,   195,     0,
+       0,     0,     0,     0,     0,     0,   394,   178,   179,   180,
+     181,   182,   183,   184,   185,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,   178,   179,   180,   181,   182,   183,
+     184,   185,     0,   186,   187,   188,   189,   190,   191,   192,
+     193,   194,   195,     0,     0,     0,     0,     0,     0,   198,
+     186,   187,   188,   189,   190,   191,   192,   193,   194,   195,
+       0,     0,     0,     0,     0,     0,   226,   178,   179,   180,
+     181,   182,   183,   184,   185,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,   178,   179,   180,   181,   182,   183,
+     184,   185,     0,   186,   187,   188,   189,   190,   191,   192,
+     193,   194,   195,     0,     0,     0,     0,     0,     0,   330,
+     186,   187,   188,   189,   190,   191,   192,   193,   194,   195,
+       0,     0,     0,     0,     0,     0,   342,   178,   179,   180,
+     181,   182,   183,   184,   185,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,   178,   179,   180,   181,   182,   183,
+     184,   185,     0,   186,   187,   188,   189,   190,   191,   192,
+     193,   194,   195,     0,     0,     0,     0,     0,     0,   361,
+     186,   187,   188,   189,   190,   191,   192,   193,   194,   195,
+       0,     0,     0,     0,     0,     0,   377,   178,   179,   180,
+     181,   182,   183,   184,   185,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,   178,   179,   180,   181,   182,   183,
+     184,   185,     0,   186,   187,   188,   189,   190,   191,   192,
+     193,   194,   195,     0,     0,     0,     0,     0,     0,   379,
+     186,   187,   188,   189,   190,   191,   192,   193,   194,   195,
+       0,     0,     0,     0,     0,     0,   380,   178,   179,   180,
+     181,   182,   183,   184,   185,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,   178,   179,   180,   181,   182,   183,
+     184,   185,     0,   186,   187,   188,   189,   190,   191,   192,
+     193,   194,   195,     0,     0,     0,     0,     0,     0,   388,
+     186,   187,   188,   189,   190,   191,   192,   193,   194,   195,
+       0,     0,     0,     0,     0,     0,   397,   178,   179,   180,
+     181,   182,   183,   184,   185,     0,     0,     0,     0,   180,
+     181,   182,   183,   184,   185,     0,     0,     0,     0,     0,
+       0,     0,     0,   186,   187,   188,   189,   190,   191,   192,
+     193,   194,   195,   186,   187,   188,   189,   190,   191,   192,
+     193,   194,   195,   180,   181,   182,   183,   184,   185,     0,
+       0,   180,   181,   182,   183,   184,   185,     0,   180,   181,
+     182,   183,     0,     0,     0,     0,     0,     0,   187,   188,
+     189,   190,   191,   192,   193,   194,   195,   188,   189,   190,
+     191,   192,   193,   194,   195,   189,   190,   191,   192,   193,
+     194,   195
+};
+
+static const yytype_int16 yycheck[] =
+{
+      94,    60,   115,   116,    19,   119,   158,    42,     3,   103,
+     247,   372,     7,     3,     4,   112,    18,   285,    18,    81,
+      18,    18,    41,     7,    39,    18,    13,   140,    18,   390,
+      14,    15,    16,    17,   128,   129,   130,   131,   132,    41,
+      71,    41,   310,   310,    41,    21,    22,    73,    41,    80,
+      69,    41,     7,   167,    80,     7,   118,   170,    10,    14,
+      15,    16,    17,    50,    51,    75,    76,    71,    70,   166,
+      70,    69,   169,    70,     3,    69,    71,    68,     7,    71,
+      70,     3,     4,    74,   178,   179,   180,   181,   182,   183,
+     184,   185,   186,   187,   188,   189,   190,   191,   192,   193,
+     194,   195,   199,   217,   372,   167,   343,     0,   345,   203,
+     378,   378,   147,   265,    68,    69,    71,     3,   386,     3,
+      69,     7,   390,     7,     7,   393,   393,    75,    76,   144,
+      71,    14,    15,    16,    17,    24,    25,    26,    27,    28,
+      63,    64,    65,    29,     7,    29,     7,     7,     8,     9,
+      10,    11,    12,   267,    38,    39,    40,    43,   271,    43,
+      68,    24,    25,    26,    27,    25,    68,   280,    72,    73,
+      54,    24,    25,    26,    27,    61,    62,    61,    62,     7,
+      68,    70,    74,   277,     7,    71,   201,    71,    71,    32,
+      33,    72,    78,    79,    78,    79,   293,    73,    68,    72,
+     294,    68,   296,    71,   317,    71,    71,   301,    68,    71,
+       7,    14,    15,    16,    17,     7,    13,   276,    61,    62,
+      63,    64,    65,    71,    71,    71,    18,   340,    20,    21,
+      22,    23,    24,    25,    26,    27,    45,    46,    47,    48,
+     334,   335,    24,    25,    26,    27,    28,    73,    45,    41,
+      47,    48,    44,    50,    51,    61,    62,    63,    64,    65,
+      52,    53,    54,    55,     3,    70,   360,    80,   362,   363,
+     364,    71,    73,     7,    73,    69,    68,     7,    70,    74,
+      76,     7,     7,     7,     7,     7,     7,   381,     7,    73,
+       7,    59,    73,     7,     7,   389,    34,    76,   357,   358,
+     394,    18,    49,    20,    21,    22,    23,    24,    25,    26,
+      27,    72,    72,    42,    72,    72,    72,    72,     6,    73,
+      72,    72,     7,    73,    41,    71,    69,    44,     7,    77,
+      70,    68,    68,     7,    76,    52,    53,    54,    55,    18,
+      73,    20,    21,    22,    23,    24,    25,    26,    27,    80,
+      77,    68,    80,    70,    60,    73,    72,     7,    59,    71,
+      71,     7,    41,    72,     7,    44,     7,    71,    73,    72,
+      68,     7,    74,    52,    53,    54,    55,    18,    72,    20,
+      21,    22,    23,    24,    25,    26,    27,    73,    80,    68,
+      80,    70,    76,    19,    72,    72,    72,    72,    68,    72,
+      41,    68,    73,    44,     7,    77,    71,    69,    72,    72,
+      68,    52,    53,    54,    55,    18,    71,    20,    21,    22,
+      23,    24,    25,    26,    27,    69,    71,    68,     7,    70,
+      68,    71,    71,    68,    68,     7,    73,    19,    41,    10,
+      73,    44,     7,     3,     7,    39,    43,    95,   328,    52,
+      53,    54,    55,    18,    86,    20,    21,    22,    23,    24,
+      25,    26,    27,   279,   298,    68,    70,    70,   285,   122,
+      -1,    -1,    -1,    -1,    -1,    -1,    41,    -1,    -1,    44,
+      31,    32,    33,    34,    35,    36,    37,    52,    53,    54,
+      55,    30,    31,    32,    33,    34,    35,    36,    37,    -1,
+      -1,    -1,    -1,    68,    -1,    56,    57,    58,    59,    60,
+      61,    62,    63,    64,    65,    -1,    -1,    56,    57,    58,
+      59,    60,    61,    62,    63,    64,    65,    30,    31,    32,
+      33,    34,    35,    36,    37,    -1,    -1,    -1,    77,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    56,    57,    58,    59,    60,    61,    62,
+      63,    64,    65,    30,    31,    32,    33,    34,    35,    36,
+      37,    -1,    -1,    -1,    77,    -1,    -1,    -1,    -1,    -1,
+      -1,    30,    31,    32,    33,    34,    35,    36,    37,    56,
+      57,    58,    59,    60,    61,    62,    63,    64,    65,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    73,    56,    57,    58,
+      59,    60,    61,    62,    63,    64,    65,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    73,    30,    31,    32,    33,    34,
+      35,    36,    37,    -1,    32,    33,    34,    35,    36,    37,
+      -1,    -1,    -1,    30,    31,    32,    33,    34,    35,    36,
+      37,    56,    57,    58,    59,    60,    61,    62,    63,    64,
+      65,    59,    60,    61,    62,    63,    64,    65,    73,    56,
+      57,    58,    59,    60,    61,    62,    63,    64,    65,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    73,    30,    31,    32,
+      33,    34,    35,    36,    37,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    30,    31,    32,    33,    34,    35,
+      36,    37,    -1,    56,    57,    58,    59,    60,    61,    62,
+      63,    64,    65,    -1,    -1,    -1,    -1,    -1,    -1,    72,
+      56,    57,    58,    59,    60,    61,    62,    63,    64,    65,
+      -1,    -1,    -1,    -1,    -1,    -1,    72,    30,    31,    32,
+      33,    34,    35,    36,    37,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    30,    31,    32,    33,    34,    35,
+      36,    37,    -1,    56,    57,    58,    59,    60,    61,    62,
+      63,    64,    65,    -1,    -1,    -1,    -1,    -1,    -1,    72,
+      56,    57,    58,    59,    60,    61,    62,    63,    64,    65,
+      -1,    -1,    -1,    -1,    -1,    -1,    72,    30,    31,    32,
+      33,    34,    35,    36,    37,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    30,    31,    32,    33,    34,    35,
+      36,    37,    -1,    56,    57,    58,    59,    60,    61,    62,
+      63,    64,    65,    -1,    -1,    -1,    -1,    -1,    -1,    72,
+      56,    57,    58,    59,    60,    61,    62,    63,    64,    65,
+      -1,    -1,    -1,    -1,    -1,    -1,    72,    30,    31,    32,
+      33,    34,    35,    36,    37,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    30,    31,    32,    33,    34,    35,
+      36,    37,    -1,    56,    57,    58,    59,    60,    61,    62,
+      63,    64,    65,    -1,    -1,    -1,    -1,    -1,    -1,    72,
+      56,    57,    58,    59,    60,    61,    62,    63,    64,    65,
+      -1,    -1,    -1,    -1,    -1,    -1,    72,    30,    31,    32,
+      33,    34,    35,    36,    37,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    30,    31,    32,    33,    34,    35,
+      36,    37,    -1,    56,    57,    58,    59,    60,    61,    62,
+      63,    64,    65,    -1,    -1,    -1,    -1,    -1,    -1,    72,
+      56,    57,    58,    59,    60,    61,    62,    63,    64,    65,
+      -1,    -1,    -1,    -1,    -1,    -1,    72,    30,    31,    32,
+      33,    34,    35,    36,    37,    -1,    -1,    -1,    -1,    32,
+      33,    34,    35,    36,    37,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    56,    57,    58,    59,    60,    61,    62,
+      63,    64,    65,    56,    57,    58,    59,    60,    61,    62,
+      63,    64,    65,    32,    33,    34,    35,    36,    37,    -1,
+      -1,    32,    33,    34,    35,    36,    37,    -1,    32,    33,
+      34,    35,    -1,    -1,    -1,    -1,    -1,    -1,    57,    58,
+      59,    60,    61,    62,    63,    64,    65,    58,    59,    60,
+      61,    62,    63,    64,    65,    59,    60,    61,    62,    63,
+      64,    65
+};
+
+/* YYSTOS[STATE-NUM] -- The symbol kind of the accessing symbol of
+   state STATE-NUM.  */
+static const yytype_uint8 yystos[] =
+{
+       0,     7,     8,     9,    10,    11,    12,    25,    68,    82,
+      83,    84,    85,    87,    88,   136,   137,   146,    71,    69,
+      86,    86,    71,    88,     0,    84,    69,    71,    68,    68,
+       7,   115,   116,   117,    24,    25,    26,    27,    28,    95,
+      96,    99,   100,   101,   102,     7,    68,    18,    20,    21,
+      22,    23,    41,    44,    52,    53,    54,    55,    68,    89,
+      90,    91,    92,    93,    94,    99,   103,   104,   106,   121,
+     122,   127,     7,    13,    45,    47,    48,    50,    51,   138,
+     139,   143,   144,   145,    74,    72,    73,    68,    70,    96,
+       7,   112,   102,    72,    71,    71,    21,    22,   105,    71,
+      71,    71,    71,    71,    68,    70,    91,    14,    15,    16,
+      17,   131,    73,     3,    80,    71,    71,    80,    73,    73,
+       7,   138,    73,    80,     3,     7,    29,    43,    61,    62,
+      71,    78,    79,   108,   109,   110,   112,   113,   114,   117,
+      76,    74,   113,   109,    69,     7,   111,     7,     7,     7,
+     113,     7,   110,     7,   114,   114,     7,     7,    71,   131,
+     138,   140,   141,   142,     7,   140,    73,    73,   145,    75,
+      76,    59,     7,   113,   113,   113,   113,   113,    30,    31,
+      32,    33,    34,    35,    36,    37,    56,    57,    58,    59,
+      60,    61,    62,    63,    64,    65,   114,     7,    72,    34,
+      97,    98,    99,    76,    49,   128,   112,    72,    72,    73,
+      42,   123,    72,    72,    72,    72,   142,    73,    72,     6,
+      72,   138,   140,   110,   114,     7,    72,   113,   113,   113,
+     113,   113,   113,   113,   113,   113,   113,   113,   113,   113,
+     113,   113,   113,   113,   113,    77,    71,    69,   110,    70,
+      99,   113,    73,    45,    46,    47,    48,   124,    68,    68,
+       7,    68,    69,    80,    80,    73,   140,    73,    72,    77,
+      60,    76,     7,   118,   119,   120,    90,    59,    77,    71,
+      71,    72,    73,     3,     4,   132,   133,   134,     7,     7,
+     142,    72,   140,    75,    71,   114,    74,    72,    73,    70,
+     113,    76,   119,   114,    68,     7,    80,    80,    18,    70,
+     125,   126,   127,   129,   133,     3,     7,    71,    72,    72,
+      72,    72,   110,   113,    77,   113,    68,   120,    19,   107,
+      72,   113,    72,    72,    73,    71,    70,   126,    68,    68,
+      74,   114,    72,    69,   106,    69,    77,    72,   113,   113,
+      38,    39,    40,    54,   114,   135,    72,    90,    90,    68,
+      73,    72,    71,    71,    71,    71,    68,    68,    68,    70,
+      70,   113,    69,   113,   113,   113,     7,    72,   125,    72,
+      72,    73,    73,    70,   113,     7,    19,   130,    72,    73,
+      69,   127,   113,   125,    73,    70,   113,    72
+};
+
+/* YYR1[RULE-NUM] -- Symbol kind of the left-hand side of rule RULE-NUM.  */
+static const yytype_uint8 yyr1[] =
+{
+       0,    81,    82,    82,    83,    83,    84,    84,    84,    84,
+      84,    85,    85,    86,    87,    87,    88,    88,    89,    89,
+      90,    90,    91,    91,    91,    91,    91,    91,    91,    91,
+      91,    91,    91,    92,    93,    93,    94,    95,    95,    96,
+      96,    97,    97,    98,    98,    99,   100,   100,   101,   101,
+     102,   102,   102,   102,   103,   104,   105,   105,   105,   106,
+     107,   107,   107,   108,   108,   109,   109,   110,   110,   110,
+     111,   111,   111,   112,   112,   112,   113,   113,   113,   113,
+     113,   113,   113,   113,   113,   113,   113,   113,   113,   113,
+     113,   113,   113,   113,   113,   113,   113,   113,   113,   113,
+     113,   114,   115,   115,   116,   116,   117,   117,   118,   118,
+     119,   119,   120,   121,   121,   121,   122,   122,   122,   123,
+     123,   124,   124,   124,   124,   124,   125,   125,   126,   126,
+     127,   128,   128,   129,   130,   130,   130,   131,   131,   131,
+     131,   132,   132,   133,   133,   133,   133,   133,   134,   134,
+     135,   135,   135,   135,   136,   136,   137,   137,   137,   137,
+     137,   138,   139,   140,   140,   141,   141,   142,   142,   143,
+     144,   144,   145,   145,   145,   146,   146,   146,   146
+};
+
+/* YYR2[RULE-NUM] -- Number of symbols on the right-hand side of rule RULE-NUM.  */
+static const yytype_int8 yyr2[] =
+{
+       0,     2,     1,     0,     1,     2,     1,     1,     1,     2,
+       2,     2,     2,     3,     4,     3,     4,     4,     0,     1,
+       1,     2,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     2,     7,     5,     5,    12,     1,     2,     2,
+       1,     0,     1,     1,     2,     8,     0,     1,     1,     2,
+       1,     1,     1,     1,    11,     5,     0,     1,     1,     8,
+       4,     2,     0,     1,     2,     1,     1,     1,     3,     6,
+       1,     4,     7,     1,     4,     7,     1,     2,     2,     2,
+       2,     3,     3,     3,     3,     3,     3,     3,     3,     3,
+       3,     3,     3,     3,     3,     3,     3,     3,     3,     3,
+       7,     1,     0,     1,     1,     3,     1,     3,     0,     1,
+       1,     3,     3,     5,     7,     8,     0,     1,     1,     0,
+       1,     0,     1,     1,     4,     1,     1,     2,     1,     1,
+      10,     0,     1,     8,     4,     2,     0,     1,     1,     1,
+       1,     1,     2,     3,     3,     5,     5,     5,     2,     2,
+       4,     4,     6,    10,     1,     1,     6,     8,     7,     9,
+       6,     3,     2,     1,     5,     1,     1,     1,     2,     2,
+       1,     3,     1,     1,     2,     6,     6,     9,     9
+};
+
+
+enum { YYENOMEM = -2 };
+
+#define yyerrok         (yyerrstatus = 0)
+#define yyclearin       (yychar = YYEMPTY)
+
+#define YYACCEPT        goto yyacceptlab
+#define YYABORT         goto yyabortlab
+#define YYERROR         goto yyerrorlab
+#define YYNOMEM         goto yyexhaustedlab
+
+
+#define YYRECOVERING()  (!!yyerrstatus)
+
+#define YYBACKUP(Token, Value)                                    \
+  do                                                              \
+    if (yychar == YYEMPTY)                                        \
+      {                                                           \
+        yychar = (Token);                                         \
+        yylval = (Value);                                         \
+        YYPOPSTACK (yylen);                                       \
+        yystate = *yyssp;                                         \
+        goto yybackup;                                            \
+      }                                                           \
+    else                                                          \
+      {                                                           \
+        yyerror (YY_("syntax error: cannot back up")); \
+        YYERROR;                                                  \
+      }                                                           \
+  while (0)
+
+/* Backward compatibility with an undocumented macro.
+   Use YYerror or YYUNDEF. */
+#define YYERRCODE YYUNDEF
+
+
+/* Enable debugging if requested.  */
+#if YYDEBUG
+
+# ifndef YYFPRINTF
+#  include <stdio.h> /* INFRINGES ON USER NAME SPACE */
+#  define YYFPRINTF fprintf
+# endif
+
+# define YYDPRINTF(Args)                        \
+do {                                            \
+  if (yydebug)                                  \
+    YYFPRINTF Args;                             \
+} while (0)
+
+
+
+
+# define YY_SYMBOL_PRINT(Title, Kind, Value, Location)                    \
+do {                                                                      \
+  if (yydebug)                                                            \
+    {                                                                     \
+      YYFPRINTF (stderr, "%s ", Title);                                   \
+      yy_symbol_print (stderr,                                            \
+                  Kind, Value); \
+      YYFPRINTF (stderr, "\n");                                           \
+    }                                                                     \
+} while (0)
+
+
+/*-----------------------------------.
+| Print this symbol's value on YYO.  |
+`-----------------------------------*/
+
+static void
+yy_symbol_value_print (FILE *yyo,
+                       yysymbol_kind_t yykind, YYSTYPE const * const yyvaluep)
+{
+  FILE *yyoutput = yyo;
+  YY_USE (yyoutput);
+  if (!yyvaluep)
+    return;
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  YY_USE (yykind);
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
+}
+
+
+/*---------------------------.
+| Print this symbol on YYO.  |
+`---------------------------*/
+
+static void
+yy_symbol_print (FILE *yyo,
+                 yysymbol_kind_t yykind, YYSTYPE const * const yyvaluep)
+{
+  YYFPRINTF (yyo, "%s %s (",
+             yykind < YYNTOKENS ? "token" : "nterm", yysymbol_name (yykind));
+
+  yy_symbol_value_print (yyo, yykind, yyvaluep);
+  YYFPRINTF (yyo, ")");
+}
+
+/*------------------------------------------------------------------.
+| yy_stack_print -- Print the state stack from its BOTTOM up to its |
+| TOP (included).                                                   |
+`------------------------------------------------------------------*/
+
+static void
+yy_stack_print (yy_state_t *yybottom, yy_state_t *yytop)
+{
+  YYFPRINTF (stderr, "Stack now");
+  for (; yybottom <= yytop; yybottom++)
+    {
+      int yybot = *yybottom;
+      YYFPRINTF (stderr, " %d", yybot);
+    }
+  YYFPRINTF (stderr, "\n");
+}
+
+# define YY_STACK_PRINT(Bottom, Top)                            \
+do {                                                            \
+  if (yydebug)                                                  \
+    yy_stack_print ((Bottom), (Top));                           \
+} while (0)
+
+
+/*------------------------------------------------.
+| Report that the YYRULE is going to be reduced.  |
+`------------------------------------------------*/
+
+static void
+yy_reduce_print (yy_state_t *yyssp, YYSTYPE *yyvsp,
+                 int yyrule)
+{
+  int yylno = yyrline[yyrule];
+  int yynrhs = yyr2[yyrule];
+  int yyi;
+  YYFPRINTF (stderr, "Reducing stack by rule %d (line %d):\n",
+             yyrule - 1, yylno);
+  /* The symbols being reduced.  */
+  for (yyi = 0; yyi < yynrhs; yyi++)
+    {
+      YYFPRINTF (stderr, "   $%d = ", yyi + 1);
+      yy_symbol_print (stderr,
+                       YY_ACCESSING_SYMBOL (+yyssp[yyi + 1 - yynrhs]),
+                       &yyvsp[(yyi + 1) - (yynrhs)]);
+      YYFPRINTF (stderr, "\n");
+    }
+}
+
+# define YY_REDUCE_PRINT(Rule)          \
+do {                                    \
+  if (yydebug)                          \
+    yy_reduce_print (yyssp, yyvsp, Rule); \
+} while (0)
+
+/* Nonzero means print parse trace.  It is left uninitialized so that
+   multiple parsers can coexist.  */
+int yydebug;
+#else /* !YYDEBUG */
+# define YYDPRINTF(Args) ((void) 0)
+# define YY_SYMBOL_PRINT(Title, Kind, Value, Location)
+# define YY_STACK_PRINT(Bottom, Top)
+# define YY_REDUCE_PRINT(Rule)
+#endif /* !YYDEBUG */
+
+
+/* YYINITDEPTH -- initial size of the parser's stacks.  */
+#ifndef YYINITDEPTH
+# define YYINITDEPTH 200
+#endif
+
+/* YYMAXDEPTH -- maximum size the stacks can grow to (effective only
+   if the built-in stack extension method is used).
+
+   Do not make this value too large; the results are undefined if
+   YYSTACK_ALLOC_MAXIMUM < YYSTACK_BYTES (YYMAXDEPTH)
+   evaluated with infinite-precision integer arithmetic.  */
+
+#ifndef YYMAXDEPTH
+# define YYMAXDEPTH 10000
+#endif
+
+
+
+
+
+
+/*-----------------------------------------------.
+| Release the memory associated to this symbol.  |
+`-----------------------------------------------*/
+
+static void
+yydestruct (const char *yymsg,
+            yysymbol_kind_t yykind, YYSTYPE *yyvaluep)
+{
+  YY_USE (yyvaluep);
+  if (!yymsg)
+    yymsg = "Deleting";
+  YY_SYMBOL_PRINT (yymsg, yykind, yyvaluep, yylocationp);
+
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  YY_USE (yykind);
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
+}
+
+
+/* Lookahead token kind.  */
+int yychar;
+
+/* The semantic value of the lookahead symbol.  */
+YYSTYPE yylval;
+/* Number of syntax errors so far.  */
+int yynerrs;
+
+
+
+
+/*----------.
+| yyparse.  |
+`----------*/
+
+int
+yyparse (void)
+{
+    yy_state_fast_t yystate = 0;
+    /* Number of tokens to shift before error messages enabled.  */
+    int yyerrstatus = 0;
+
+    /* Refer to the stacks through separate pointers, to allow yyoverflow
+       to reallocate them elsewhere.  */
+
+    /* Their size.  */
+    YYPTRDIFF_T yystacksize = YYINITDEPTH;
+
+    /* The state stack: array, bottom, top.  */
+    yy_state_t yyssa[YYINITDEPTH];
+    yy_state_t *yyss = yyssa;
+    yy_state_t *yyssp = yyss;
+
+    /* The semantic value stack: array, bottom, top.  */
+    YYSTYPE yyvsa[YYINITDEPTH];
+    YYSTYPE *yyvs = yyvsa;
+    YYSTYPE *yyvsp = yyvs;
+
+  int yyn;
+  /* The return value of yyparse.  */
+  int yyresult;
+  /* Lookahead symbol kind.  */
+  yysymbol_kind_t yytoken = YYSYMBOL_YYEMPTY;
+  /* The variables used to return semantic value and location from the
+     action routines.  */
+  YYSTYPE yyval;
+
+
+
+#define YYPOPSTACK(N)   (yyvsp -= (N), yyssp -= (N))
+
+  /* The number of symbols on the RHS of the reduced rule.
+     Keep to zero when no symbol should be popped.  */
+  int yylen = 0;
+
+  YYDPRINTF ((stderr, "Starting parse\n"));
+
+  yychar = YYEMPTY; /* Cause a token to be read.  */
+
+  goto yysetstate;
+
+
+/*------------------------------------------------------------.
+| yynewstate -- push a new state, which is found in yystate.  |
+`------------------------------------------------------------*/
+yynewstate:
+  /* In all cases, when you get here, the value and location stacks
+     have just been pushed.  So pushing a state here evens the stacks.  */
+  yyssp++;
+
+
+/*--------------------------------------------------------------------.
+| yysetstate -- set current state (the top of the stack) to yystate.  |
+`--------------------------------------------------------------------*/
+yysetstate:
+  YYDPRINTF ((stderr, "Entering state %d\n", yystate));
+  YY_ASSERT (0 <= yystate && yystate < YYNSTATES);
+  YY_IGNORE_USELESS_CAST_BEGIN
+  *yyssp = YY_CAST (yy_state_t, yystate);
+  YY_IGNORE_USELESS_CAST_END
+  YY_STACK_PRINT (yyss, yyssp);
+
+  if (yyss + yystacksize - 1 <= yyssp)
+#if !defined yyoverflow && !defined YYSTACK_RELOCATE
+    YYNOMEM;
+#else
+    {
+      /* Get the current used size of the three stacks, in elements.  */
+      YYPTRDIFF_T yysize = yyssp - yyss + 1;
+
+# if defined yyoverflow
+      {
+        /* Give user a chance to reallocate the stack.  Use copies of
+           these so that the &'s don't force the real ones into
+           memory.  */
+        yy_state_t *yyss1 = yyss;
+        YYSTYPE *yyvs1 = yyvs;
+
+        /* Each stack pointer address is followed by the size of the
+           data in use in that stack, in bytes.  This used to be a
+           conditional around just the two extra args, but that might
+           be undefined if yyoverflow is a macro.  */
+        yyoverflow (YY_("memory exhausted"),
+                    &yyss1, yysize * YYSIZEOF (*yyssp),
+                    &yyvs1, yysize * YYSIZEOF (*yyvsp),
+                    &yystacksize);
+        yyss = yyss1;
+        yyvs = yyvs1;
+      }
+# else /* defined YYSTACK_RELOCATE */
+      /* Extend the stack our own way.  */
+      if (YYMAXDEPTH <= yystacksize)
+        YYNOMEM;
+      yystacksize *= 2;
+      if (YYMAXDEPTH < yystacksize)
+        yystacksize = YYMAXDEPTH;
+
+      {
+        yy_state_t *yyss1 = yyss;
+        union yyalloc *yyptr =
+          YY_CAST (union yyalloc *,
+                   YYSTACK_ALLOC (YY_CAST (YYSIZE_T, YYSTACK_BYTES (yystacksize))));
+        if (! yyptr)
+          YYNOMEM;
+        YYSTACK_RELOCATE (yyss_alloc, yyss);
+        YYSTACK_RELOCATE (yyvs_alloc, yyvs);
+#  undef YYSTACK_RELOCATE
+        if (yyss1 != yyssa)
+          YYSTACK_FREE (yyss1);
+      }
+# endif
+
+      yyssp = yyss + yysize - 1;
+      yyvsp = yyvs + yysize - 1;
+
+      YY_IGNORE_USELESS_CAST_BEGIN
+      YYDPRINTF ((stderr, "Stack size increased to %ld\n",
+                  YY_CAST (long, yystacksize)));
+      YY_IGNORE_USELESS_CAST_END
+
+      if (yyss + yystacksize - 1 <= yyssp)
+        YYABORT;
+    }
+#endif /* !defined yyoverflow && !defined YYSTACK_RELOCATE */
+
+
+  if (yystate == YYFINAL)
+    YYACCEPT;
+
+  goto yybackup;
+
+
+/*-----------.
+| yybackup.  |
+`-----------*/
+yybackup:
+  /* Do appropriate processing given the current state.  Read a
+     lookahead token if we need one and don't already have one.  */
+
+  /* First try to decide what to do without reference to lookahead token.  */
+  yyn = yypact[yystate];
+  if (yypact_value_is_default (yyn))
+    goto yydefault;
+
+  /* Not known => get a lookahead token if don't already have one.  */
+
+  /* YYCHAR is either empty, or end-of-input, or a valid lookahead.  */
+  if (yychar == YYEMPTY)
+    {
+      YYDPRINTF ((stderr, "Reading a token\n"));
+      yychar = yylex ();
+    }
+
+  if (yychar <= YYEOF)
+    {
+      yychar = YYEOF;
+      yytoken = YYSYMBOL_YYEOF;
+      YYDPRINTF ((stderr, "Now at end of input.\n"));
+    }
+  else if (yychar == YYerror)
+    {
+      /* The scanner already issued an error message, process directly
+         to error recovery.  But do not keep the error token as
+         lookahead, it is too special and may lead us to an endless
+         loop in error recovery. */
+      yychar = YYUNDEF;
+      yytoken = YYSYMBOL_YYerror;
+      goto yyerrlab1;
+    }
+  else
+    {
+      yytoken = YYTRANSLATE (yychar);
+      YY_SYMBOL_PRINT ("Next token is", yytoken, &yylval, &yylloc);
+    }
+
+  /* If the proper action on seeing token YYTOKEN is to reduce or to
+     detect an error, take that action.  */
+  yyn += yytoken;
+  if (yyn < 0 || YYLAST < yyn || yycheck[yyn] != yytoken)
+    goto yydefault;
+  yyn = yytable[yyn];
+  if (yyn <= 0)
+    {
+      if (yytable_value_is_error (yyn))
+        goto yyerrlab;
+      yyn = -yyn;
+      goto yyreduce;
+    }
+
+  /* Count tokens shifted since error; after three, turn off error
+     status.  */
+  if (yyerrstatus)
+    yyerrstatus--;
+
+  /* Shift the lookahead token.  */
+  YY_SYMBOL_PRINT ("Shifting", yytoken, &yylval, &yylloc);
+  yystate = yyn;
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  *++yyvsp = yylval;
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
+
+  /* Discard the shifted token.  */
+  yychar = YYEMPTY;
+  goto yynewstate;
+
+
+/*-----------------------------------------------------------.
+| yydefault -- do the default action for the current state.  |
+`-----------------------------------------------------------*/
+yydefault:
+  yyn = yydefact[yystate];
+  if (yyn == 0)
+    goto yyerrlab;
+  goto yyreduce;
+
+
+/*-----------------------------.
+| yyreduce -- do a reduction.  |
+`-----------------------------*/
+yyreduce:
+  /* yyn is the number of a rule to reduce with.  */
+  yylen = yyr2[yyn];
+
+  /* If YYLEN is nonzero, implement the default value of the action:
+     '$$ = $1'.
+
+     Otherwise, the following line sets YYVAL to garbage.
+     This behavior is undocumented and Bison
+     users should not rely upon it.  Assigning to YYVAL
+     unconditionally makes the parser a bit smaller, and it avoids a
+     GCC warning that YYVAL may be used uninitialized.  */
+  yyval = yyvsp[1-yylen];
+
+
+  YY_REDUCE_PRINT (yyn);
+  switch (yyn)
+    {
+  case 2: /* program: stmt_list  */
+#line 332 "parser.y"
+                                { append_list(&all_definitions,(yyvsp[0].nodes)); }
+#line 1677 "generated/y.tab.c"
+    break;
+
+  case 4: /* stmt_list: stmt  */
+#line 337 "parser.y"
+                                { (yyval.nodes) = create_list((yyvsp[0].node)); }
+#line 1683 "generated/y.tab.c"
+    break;
+
+  case 5: /* stmt_list: stmt_list stmt  */
+#line 338 "parser.y"
+                                { (yyval.nodes) = append_list((yyvsp[-1].nodes),(yyvsp[0].node)); }
+#line 1689 "generated/y.tab.c"
+    break;
+
+  case 6: /* stmt: ';'  */
+#line 343 "parser.y"
+                                                   { (yyval.node) = NULL; }
+#line 1695 "generated/y.tab.c"
+    break;
+
+  case 7: /* stmt: event_definition  */
+#line 344 "parser.y"
+                                                   { (yyval.node) = (yyvsp[0].ev_def); }
+#line 1701 "generated/y.tab.c"
+    break;
+
+  case 8: /* stmt: structure_definition  */
+#line 345 "parser.y"
+                                                   { (yyval.node) = (yyvsp[0].str_def); }
+#line 1707 "generated/y.tab.c"
+    break;
+
+  case 9: /* stmt: signal ';'  */
+#line 346 "parser.y"
+                                                   { (yyval.node) = (yyvsp[-1].sig); }
+#line 1713 "generated/y.tab.c"
+    break;
+
+  case 10: /* stmt: signal_info ';'  */
+#line 347 "parser.y"
+                                                   { (yyval.node) = (yyvsp[-1].sig_info); }
+#line 1719 "generated/y.tab.c"
+    break;
+
+  case 11: /* event_definition: EVENT event_definition_body  */
+#line 356 "parser.y"
+                                      { (yyval.ev_def) = (yyvsp[0].ev_def); }
+#line 1725 "generated/y.tab.c"
+    break;
+
+  case 12: /* event_definition: STICKY_EVENT event_definition_body  */
+#line 357 "parser.y"
+                                             { (yyvsp[0].ev_def)->_opts |= EVENT_OPTS_STICKY; (yyval.ev_def) = (yyvsp[0].ev_def); }
+#line 1731 "generated/y.tab.c"
+    break;
+
+  case 13: /* event_definition_body: '{' event_declared_item_list '}'  */
+#line 361 "parser.y"
+                                           { event_definition *event = new event_definition(CURR_FILE_LINE,(yyvsp[-1].str_decl_list)); check_valid_opts((yyvsp[-1].str_decl_list),STRUCT_DECL_OPTS_REVISIT | EVENT_OPTS_IGNORE_UNKNOWN_SUBEVENT); (yyval.ev_def) = event; }
+#line 1737 "generated/y.tab.c"
+    break;
+
+  case 14: /* structure_definition: structure_header '{' structure_body_null '}'  */
+#line 365 "parser.y"
+                                                       { (yyval.str_def) = new struct_definition(CURR_FILE_LINE,(yyvsp[-3].str_header),(yyvsp[-1].str_body)); }
+#line 1743 "generated/y.tab.c"
+    break;
+
+  case 15: /* structure_definition: T_EXTERNAL structure_header ';'  */
+#line 366 "parser.y"
+                                          { (yyval.str_def) = new struct_definition(CURR_FILE_LINE,(yyvsp[-1].str_header),NULL,STRUCT_DEF_OPTS_EXTERNAL); }
+#line 1749 "generated/y.tab.c"
+    break;
+
+  case 16: /* structure_header: SUBEVENT '(' IDENTIFIER ')'  */
+#line 370 "parser.y"
+                                                 { (yyval.str_header) = new struct_header_subevent((yyvsp[-1].strValue),new std::vector<param*>); }
+#line 1755 "generated/y.tab.c"
+    break;
+
+  case 17: /* structure_header: IDENTIFIER '(' param_list_null ')'  */
+#line 371 "parser.y"
+                                                 { (yyval.str_header) = new struct_header_named((yyvsp[-3].strValue),(yyvsp[-1].par_list)); }
+#line 1761 "generated/y.tab.c"
+    break;
+
+  case 18: /* structure_body_null: %empty  */
+#line 375 "parser.y"
+                         { null_list(&(yyval.str_body)); }
+#line 1767 "generated/y.tab.c"
+    break;
+
+  case 19: /* structure_body_null: structure_body  */
+#line 376 "parser.y"
+                         { (yyval.str_body) = (yyvsp[0].str_body); }
+#line 1773 "generated/y.tab.c"
+    break;
+
+  case 20: /* structure_body: structure_item  */
+#line 380 "parser.y"
+                                        { (yyval.str_body) = create_list((yyvsp[0].str_item)); }
+#line 1779 "generated/y.tab.c"
+    break;
+
+  case 21: /* structure_body: structure_body structure_item  */
+#line 381 "parser.y"
+                                        { (yyval.str_body) = append_list((yyvsp[-1].str_body),(yyvsp[0].str_item)); }
+#line 1785 "generated/y.tab.c"
+    break;
+
+  case 22: /* structure_item: ';'  */
+#line 385 "parser.y"
+                    { (yyval.str_item) = NULL; }
+#line 1791 "generated/y.tab.c"
+    break;
+
+  case 23: /* structure_item: data_item  */
+#line 386 "parser.y"
+                    { (yyval.str_item) = (yyvsp[0].str_item); }
+#line 1797 "generated/y.tab.c"
+    break;
+
+  case 24: /* structure_item: list_item  */
+#line 387 "parser.y"
+                    { (yyval.str_item) = (yyvsp[0].str_list); }
+#line 1803 "generated/y.tab.c"
+    break;
+
+  case 25: /* structure_item: select_item  */
+#line 388 "parser.y"
+                      { (yyval.str_item) = (yyvsp[0].str_select); }
+#line 1809 "generated/y.tab.c"
+    break;
+
+  case 26: /* structure_item: conditional_item  */
+#line 390 "parser.y"
+                           { (yyval.str_item) = (yyvsp[0].str_cond); }
+#line 1815 "generated/y.tab.c"
+    break;
+
+  case 27: /* structure_item: declared_item  */
+#line 391 "parser.y"
+                        { (yyval.str_item) = (yyvsp[0].str_decl); (yyvsp[0].str_decl)->check_valid_opts(STRUCT_DECL_OPTS_MULTI | STRUCT_DECL_OPTS_EXTERNAL); }
+#line 1821 "generated/y.tab.c"
+    break;
+
+  case 28: /* structure_item: member_item  */
+#line 392 "parser.y"
+                      { (yyval.str_item) = (yyvsp[0].str_member); }
+#line 1827 "generated/y.tab.c"
+    break;
+
+  case 29: /* structure_item: mark_count_item  */
+#line 393 "parser.y"
+                          { (yyval.str_item) = (yyvsp[0].str_mark); }
+#line 1833 "generated/y.tab.c"
+    break;
+
+  case 30: /* structure_item: check_count_item  */
+#line 394 "parser.y"
+                           { (yyval.str_item) = (yyvsp[0].str_check); }
+#line 1839 "generated/y.tab.c"
+    break;
+
+  case 31: /* structure_item: encode_item  */
+#line 395 "parser.y"
+                      { struct_encode *encode = new struct_encode(CURR_FILE_LINE,(yyvsp[0].encode)); (yyval.str_item) = encode; }
+#line 1845 "generated/y.tab.c"
+    break;
+
+  case 32: /* structure_item: MATCH_END ';'  */
+#line 396 "parser.y"
+                        { struct_match_end *end = new struct_match_end(CURR_FILE_LINE); (yyval.str_item) = end; }
+#line 1851 "generated/y.tab.c"
+    break;
+
+  case 33: /* member_item: MEMBER '(' IDENTIFIER var_named_single zero_suppress ')' ';'  */
+#line 400 "parser.y"
+                                                                       { struct_member *member = new struct_member(CURR_FILE_LINE,(yyvsp[-4].strValue),(yyvsp[-3].var_n),(yyvsp[-2].sm_flag)); delete (yyvsp[-2].sm_flag); (yyval.str_member) = member; }
+#line 1857 "generated/y.tab.c"
+    break;
+
+  case 34: /* mark_count_item: MARK '(' IDENTIFIER ')' ';'  */
+#line 404 "parser.y"
+                                      { struct_mark *mark = new struct_mark(CURR_FILE_LINE,(yyvsp[-2].strValue),STRUCT_MARK_FLAGS_GLOBAL); (yyval.str_mark) = mark; }
+#line 1863 "generated/y.tab.c"
+    break;
+
+  case 35: /* mark_count_item: MARK_COUNT '(' IDENTIFIER ')' ';'  */
+#line 405 "parser.y"
+                                            { struct_mark *mark = new struct_mark(CURR_FILE_LINE,(yyvsp[-2].strValue),0); (yyval.str_mark) = mark; }
+#line 1869 "generated/y.tab.c"
+    break;
+
+  case 36: /* check_count_item: CHECK_COUNT '(' var_expr ',' IDENTIFIER ',' IDENTIFIER ',' var_expr ',' var_expr ')'  */
+#line 409 "parser.y"
+                                                                                               { struct_check_count *check = new struct_check_count(CURR_FILE_LINE,(yyvsp[-9].var),(yyvsp[-7].strValue),(yyvsp[-5].strValue),(yyvsp[-3].var),(yyvsp[-1].var)); (yyval.str_check) = check; }
+#line 1875 "generated/y.tab.c"
+    break;
+
+  case 37: /* event_declared_item_list: event_declared_item  */
+#line 413 "parser.y"
+                                           { (yyval.str_decl_list) = create_list((yyvsp[0].str_decl)); }
+#line 1881 "generated/y.tab.c"
+    break;
+
+  case 38: /* event_declared_item_list: event_declared_item_list event_declared_item  */
+#line 414 "parser.y"
+                                                       { (yyval.str_decl_list) = append_list((yyvsp[-1].str_decl_list),(yyvsp[0].str_decl)); }
+#line 1887 "generated/y.tab.c"
+    break;
+
+  case 39: /* event_declared_item: T_IGNORE_UNKNOWN_SUBEVENT ';'  */
+#line 418 "parser.y"
+                                           { struct_decl *decl = new struct_decl(CURR_FILE_LINE,NULL,NULL,NULL,EVENT_OPTS_IGNORE_UNKNOWN_SUBEVENT); (yyval.str_decl) = decl; }
+#line 1893 "generated/y.tab.c"
+    break;
+
+  case 40: /* event_declared_item: declared_item  */
+#line 419 "parser.y"
+                                           { (yyval.str_decl) = (yyvsp[0].str_decl); }
+#line 1899 "generated/y.tab.c"
+    break;
+
+  case 41: /* declared_item_list_null: %empty  */
+#line 423 "parser.y"
+                             { null_list(&(yyval.str_decl_list)); }
+#line 1905 "generated/y.tab.c"
+    break;
+
+  case 42: /* declared_item_list_null: declared_item_list  */
+#line 424 "parser.y"
+                             { (yyval.str_decl_list) = (yyvsp[0].str_decl_list); }
+#line 1911 "generated/y.tab.c"
+    break;
+
+  case 43: /* declared_item_list: declared_item  */
+#line 428 "parser.y"
+                                           { (yyval.str_decl_list) = create_list((yyvsp[0].str_decl)); }
+#line 1917 "generated/y.tab.c"
+    break;
+
+  case 44: /* declared_item_list: declared_item_list declared_item  */
+#line 429 "parser.y"
+                                           { (yyval.str_decl_list) = append_list((yyvsp[-1].str_decl_list),(yyvsp[0].str_decl)); }
+#line 1923 "generated/y.tab.c"
+    break;
+
+  case 45: /* declared_item: declared_item_multi_ext var_named_single '=' IDENTIFIER '(' arg_list_null ')' ';'  */
+#line 433 "parser.y"
+                                                                                            { struct_decl *decl = new struct_decl(CURR_FILE_LINE,(yyvsp[-6].var_n),(yyvsp[-4].strValue),(yyvsp[-2].arg_list),(yyvsp[-7].iValue)); (yyval.str_decl) = decl; }
+#line 1929 "generated/y.tab.c"
+    break;
+
+  case 46: /* declared_item_multi_ext: %empty  */
+#line 437 "parser.y"
+                                       { (yyval.iValue) = 0; }
+#line 1935 "generated/y.tab.c"
+    break;
+
+  case 47: /* declared_item_multi_ext: declared_item_multi_ext_list  */
+#line 438 "parser.y"
+                                       { (yyval.iValue) = (yyvsp[0].iValue); }
+#line 1941 "generated/y.tab.c"
+    break;
+
+  case 48: /* declared_item_multi_ext_list: declared_item_multi_ext_item  */
+#line 442 "parser.y"
+                                                                    { (yyval.iValue) = (yyvsp[0].iValue); }
+#line 1947 "generated/y.tab.c"
+    break;
+
+  case 49: /* declared_item_multi_ext_list: declared_item_multi_ext_list declared_item_multi_ext_item  */
+#line 443 "parser.y"
+                                                                    { (yyval.iValue) = (yyvsp[-1].iValue) | (yyvsp[0].iValue); }
+#line 1953 "generated/y.tab.c"
+    break;
+
+  case 50: /* declared_item_multi_ext_item: T_MULTI  */
+#line 447 "parser.y"
+                      { (yyval.iValue) = STRUCT_DECL_OPTS_MULTI; }
+#line 1959 "generated/y.tab.c"
+    break;
+
+  case 51: /* declared_item_multi_ext_item: T_EXTERNAL  */
+#line 448 "parser.y"
+                      { (yyval.iValue) = STRUCT_DECL_OPTS_EXTERNAL; }
+#line 1965 "generated/y.tab.c"
+    break;
+
+  case 52: /* declared_item_multi_ext_item: T_REVISIT  */
+#line 449 "parser.y"
+                      { (yyval.iValue) = STRUCT_DECL_OPTS_REVISIT; }
+#line 1971 "generated/y.tab.c"
+    break;
+
+  case 53: /* declared_item_multi_ext_item: T_NOREVISIT  */
+#line 450 "parser.y"
+                      { (yyval.iValue) = STRUCT_DECL_OPTS_NO_REVISIT; }
+#line 1977 "generated/y.tab.c"
+    break;
+
+  case 54: /* list_item: T_LIST '(' var_or_const T_LE var_named '<' var_expr ')' '{' structure_body '}'  */
+#line 454 "parser.y"
+                                                                                         { struct_list *list = new struct_list(CURR_FILE_LINE,(yyvsp[-6].var_n),(yyvsp[-8].var),(yyvsp[-4].var),(yyvsp[-1].str_body)); (yyval.str_list) = list; }
+#line 1983 "generated/y.tab.c"
+    break;
+
+  case 55: /* select_item: T_SELECT select_flag '{' declared_item_list_null '}'  */
+#line 458 "parser.y"
+                                                               { struct_select *select = new struct_select(CURR_FILE_LINE,(yyvsp[-1].str_decl_list),(yyvsp[-3].iValue)); check_valid_opts((yyvsp[-1].str_decl_list),STRUCT_DECL_OPTS_MULTI | STRUCT_DECL_OPTS_EXTERNAL | STRUCT_DECL_OPTS_NO_REVISIT); (yyval.str_select) = select; }
+#line 1989 "generated/y.tab.c"
+    break;
+
+  case 56: /* select_flag: %empty  */
+#line 463 "parser.y"
+                      { (yyval.iValue) = 0; }
+#line 1995 "generated/y.tab.c"
+    break;
+
+  case 57: /* select_flag: T_SEVERAL  */
+#line 464 "parser.y"
+                      { (yyval.iValue) = SS_FLAGS_SEVERAL; }
+#line 2001 "generated/y.tab.c"
+    break;
+
+  case 58: /* select_flag: T_OPTIONAL  */
+#line 465 "parser.y"
+                      { (yyval.iValue) = SS_FLAGS_OPTIONAL; }
+#line 2007 "generated/y.tab.c"
+    break;
+
+  case 59: /* conditional_item: T_IF '(' var_expr ')' '{' structure_body '}' conditional_else_item  */
+#line 474 "parser.y"
+                                                                             { struct_cond *cond = new struct_cond(CURR_FILE_LINE,(yyvsp[-5].var),(yyvsp[-2].str_body),(yyvsp[0].str_body)); (yyval.str_cond) = cond; }
+#line 2013 "generated/y.tab.c"
+    break;
+
+  case 60: /* conditional_else_item: T_ELSE '{' structure_body '}'  */
+#line 478 "parser.y"
+                                         { (yyval.str_body) = (yyvsp[-1].str_body); }
+#line 2019 "generated/y.tab.c"
+    break;
+
+  case 61: /* conditional_else_item: T_ELSE conditional_item  */
+#line 479 "parser.y"
+                                         { (yyval.str_body) = create_list((struct_item*) (yyvsp[0].str_cond)); }
+#line 2025 "generated/y.tab.c"
+    break;
+
+  case 62: /* conditional_else_item: %empty  */
+#line 480 "parser.y"
+                                         { (yyval.str_body) = NULL; }
+#line 2031 "generated/y.tab.c"
+    break;
+
+  case 63: /* var_or_const_or_external: var_or_const  */
+#line 486 "parser.y"
+                                         { (yyval.var) = (yyvsp[0].var); }
+#line 2037 "generated/y.tab.c"
+    break;
+
+  case 64: /* var_or_const_or_external: EXTERNAL IDENTIFIER  */
+#line 487 "parser.y"
+                              { variable* var = new var_external(CURR_FILE_LINE,(yyvsp[0].strValue)); (yyval.var) = var; }
+#line 2043 "generated/y.tab.c"
+    break;
+
+  case 65: /* var_or_const: var_named  */
+#line 491 "parser.y"
+                               { (yyval.var) = (yyvsp[0].var_n); }
+#line 2049 "generated/y.tab.c"
+    break;
+
+  case 66: /* var_or_const: INTEGER  */
+#line 492 "parser.y"
+                               { variable* var = new var_const(CURR_FILE_LINE,(yyvsp[0].iValue)); (yyval.var) = var; }
+#line 2055 "generated/y.tab.c"
+    break;
+
+  case 67: /* var_named: var_named_single  */
+#line 496 "parser.y"
+                                   { (yyval.var_n) = (yyvsp[0].var_n); }
+#line 2061 "generated/y.tab.c"
+    break;
+
+  case 68: /* var_named: IDENTIFIER '.' var_named  */
+#line 497 "parser.y"
+                                   { var_name* var = new var_sub(CURR_FILE_LINE,(yyvsp[-2].strValue),(yyvsp[0].var_n)); (yyval.var_n) = var; }
+#line 2067 "generated/y.tab.c"
+    break;
+
+  case 69: /* var_named: IDENTIFIER '[' var_eval_int_const ']' '.' var_named  */
+#line 498 "parser.y"
+                                                              { CHECK_INDEX((yyvsp[-3].iValue),0x1000000); var_name* var = new var_sub(CURR_FILE_LINE,(yyvsp[-5].strValue),(yyvsp[0].var_n),(yyvsp[-3].iValue)); (yyval.var_n) = var; }
+#line 2073 "generated/y.tab.c"
+    break;
+
+  case 70: /* var_named_single_indexed: IDENTIFIER  */
+#line 502 "parser.y"
+                                   { var_name* var = new var_name(CURR_FILE_LINE,(yyvsp[0].strValue)); (yyval.var_n) = var; }
+#line 2079 "generated/y.tab.c"
+    break;
+
+  case 71: /* var_named_single_indexed: IDENTIFIER '[' var_expr ']'  */
+#line 503 "parser.y"
+                                        { var_indexed* var = new var_indexed(CURR_FILE_LINE,(yyvsp[-3].strValue),(yyvsp[-1].var)); (yyval.var_n) = var; }
+#line 2085 "generated/y.tab.c"
+    break;
+
+  case 72: /* var_named_single_indexed: IDENTIFIER '[' var_expr ']' '[' var_expr ']'  */
+#line 504 "parser.y"
+                                                         { var_indexed* var = new var_indexed(CURR_FILE_LINE,(yyvsp[-6].strValue),(yyvsp[-1].var),(yyvsp[-4].var)); (yyval.var_n) = var; }
+#line 2091 "generated/y.tab.c"
+    break;
+
+  case 73: /* var_named_single: IDENTIFIER  */
+#line 508 "parser.y"
+                                   { var_name* var = new var_name(CURR_FILE_LINE,(yyvsp[0].strValue)); (yyval.var_n) = var; }
+#line 2097 "generated/y.tab.c"
+    break;
+
+  case 74: /* var_named_single: IDENTIFIER '[' var_eval_int_const ']'  */
+#line 509 "parser.y"
+                                                { CHECK_INDEX((yyvsp[-1].iValue),0x1000000);
+                                       var_index* var = new var_index(CURR_FILE_LINE,(yyvsp[-3].strValue),(yyvsp[-1].iValue)); (yyval.var_n) = var;
+                                     }
+#line 2105 "generated/y.tab.c"
+    break;
+
+  case 75: /* var_named_single: IDENTIFIER '[' var_eval_int_const ']' '[' var_eval_int_const ']'  */
+#line 512 "parser.y"
+                                                                           { CHECK_INDEX((yyvsp[-1].iValue),0x1000000);
+	                               CHECK_INDEX((yyvsp[-4].iValue),0x1000);
+                                       var_index* var = new var_index(CURR_FILE_LINE,(yyvsp[-6].strValue),(yyvsp[-1].iValue),(yyvsp[-4].iValue)); (yyval.var_n) = var;
+                                     }
+#line 2114 "generated/y.tab.c"
+    break;
+
+  case 76: /* var_expr: var_or_const_or_external  */
+#line 519 "parser.y"
+                                     { (yyval.var) = (yyvsp[0].var); }
+#line 2120 "generated/y.tab.c"
+    break;
+
+  case 77: /* var_expr: '-' var_expr  */
+#line 520 "parser.y"
+                                     { var_expr* var = new var_expr(CURR_FILE_LINE,NULL,(yyvsp[0].var),VAR_OP_NEG); (yyval.var) = var; }
+#line 2126 "generated/y.tab.c"
+    break;
+
+  case 78: /* var_expr: '+' var_expr  */
+#line 521 "parser.y"
+                                     { (yyval.var) = (yyvsp[0].var); }
+#line 2132 "generated/y.tab.c"
+    break;
+
+  case 79: /* var_expr: '~' var_expr  */
+#line 522 "parser.y"
+                                    { var_expr* var = new var_expr(CURR_FILE_LINE,NULL,(yyvsp[0].var),VAR_OP_NOT); (yyval.var) = var; }
+#line 2138 "generated/y.tab.c"
+    break;
+
+  case 80: /* var_expr: '!' var_expr  */
+#line 523 "parser.y"
+                                    { var_expr* var = new var_expr(CURR_FILE_LINE,NULL,(yyvsp[0].var),VAR_OP_LNOT); (yyval.var) = var; }
+#line 2144 "generated/y.tab.c"
+    break;
+
+  case 81: /* var_expr: '(' var_expr ')'  */
+#line 524 "parser.y"
+                           { (yyval.var) = (yyvsp[-1].var); }
+#line 2150 "generated/y.tab.c"
+    break;
+
+  case 82: /* var_expr: var_expr T_LOR var_expr  */
+#line 525 "parser.y"
+                                   { var_expr* var = new var_expr(CURR_FILE_LINE,(yyvsp[-2].var),(yyvsp[0].var),VAR_OP_LOR ); (yyval.var) = var; }
+#line 2156 "generated/y.tab.c"
+    break;
+
+  case 83: /* var_expr: var_expr T_LAND var_expr  */
+#line 526 "parser.y"
+                                   { var_expr* var = new var_expr(CURR_FILE_LINE,(yyvsp[-2].var),(yyvsp[0].var),VAR_OP_LAND); (yyval.var) = var; }
+#line 2162 "generated/y.tab.c"
+    break;
+
+  case 84: /* var_expr: var_expr '+' var_expr  */
+#line 527 "parser.y"
+                                  { var_expr* var = new var_expr(CURR_FILE_LINE,(yyvsp[-2].var),(yyvsp[0].var),VAR_OP_ADD); (yyval.var) = var; }
+#line 2168 "generated/y.tab.c"
+    break;
+
+  case 85: /* var_expr: var_expr '-' var_expr  */
+#line 528 "parser.y"
+                                  { var_expr* var = new var_expr(CURR_FILE_LINE,(yyvsp[-2].var),(yyvsp[0].var),VAR_OP_SUB); (yyval.var) = var; }
+#line 2174 "generated/y.tab.c"
+    break;
+
+  case 86: /* var_expr: var_expr '*' var_expr  */
+#line 529 "parser.y"
+                                  { var_expr* var = new var_expr(CURR_FILE_LINE,(yyvsp[-2].var),(yyvsp[0].var),VAR_OP_MUL); (yyval.var) = var; }
+#line 2180 "generated/y.tab.c"
+    break;
+
+  case 87: /* var_expr: var_expr '/' var_expr  */
+#line 530 "parser.y"
+                                  { var_expr* var = new var_expr(CURR_FILE_LINE,(yyvsp[-2].var),(yyvsp[0].var),VAR_OP_DIV); (yyval.var) = var; }
+#line 2186 "generated/y.tab.c"
+    break;
+
+  case 88: /* var_expr: var_expr '%' var_expr  */
+#line 531 "parser.y"
+                                  { var_expr* var = new var_expr(CURR_FILE_LINE,(yyvsp[-2].var),(yyvsp[0].var),VAR_OP_REM); (yyval.var) = var; }
+#line 2192 "generated/y.tab.c"
+    break;
+
+  case 89: /* var_expr: var_expr '&' var_expr  */
+#line 532 "parser.y"
+                                  { var_expr* var = new var_expr(CURR_FILE_LINE,(yyvsp[-2].var),(yyvsp[0].var),VAR_OP_AND); (yyval.var) = var; }
+#line 2198 "generated/y.tab.c"
+    break;
+
+  case 90: /* var_expr: var_expr '|' var_expr  */
+#line 533 "parser.y"
+                                  { var_expr* var = new var_expr(CURR_FILE_LINE,(yyvsp[-2].var),(yyvsp[0].var),VAR_OP_OR ); (yyval.var) = var; }
+#line 2204 "generated/y.tab.c"
+    break;
+
+  case 91: /* var_expr: var_expr '^' var_expr  */
+#line 534 "parser.y"
+                                  { var_expr* var = new var_expr(CURR_FILE_LINE,(yyvsp[-2].var),(yyvsp[0].var),VAR_OP_XOR); (yyval.var) = var; }
+#line 2210 "generated/y.tab.c"
+    break;
+
+  case 92: /* var_expr: var_expr T_SHR var_expr  */
+#line 535 "parser.y"
+                                  { var_expr* var = new var_expr(CURR_FILE_LINE,(yyvsp[-2].var),(yyvsp[0].var),VAR_OP_SHR); (yyval.var) = var; }
+#line 2216 "generated/y.tab.c"
+    break;
+
+  case 93: /* var_expr: var_expr T_SHL var_expr  */
+#line 536 "parser.y"
+                                  { var_expr* var = new var_expr(CURR_FILE_LINE,(yyvsp[-2].var),(yyvsp[0].var),VAR_OP_SHL); (yyval.var) = var; }
+#line 2222 "generated/y.tab.c"
+    break;
+
+  case 94: /* var_expr: var_expr '<' var_expr  */
+#line 537 "parser.y"
+                                { var_expr* var = new var_expr(CURR_FILE_LINE,(yyvsp[-2].var),(yyvsp[0].var),VAR_OP_LS); (yyval.var) = var; }
+#line 2228 "generated/y.tab.c"
+    break;
+
+  case 95: /* var_expr: var_expr '>' var_expr  */
+#line 538 "parser.y"
+                                { var_expr* var = new var_expr(CURR_FILE_LINE,(yyvsp[-2].var),(yyvsp[0].var),VAR_OP_GR); (yyval.var) = var; }
+#line 2234 "generated/y.tab.c"
+    break;
+
+  case 96: /* var_expr: var_expr T_LE var_expr  */
+#line 539 "parser.y"
+                                 { var_expr* var = new var_expr(CURR_FILE_LINE,(yyvsp[-2].var),(yyvsp[0].var),VAR_OP_LE); (yyval.var) = var; }
+#line 2240 "generated/y.tab.c"
+    break;
+
+  case 97: /* var_expr: var_expr T_GE var_expr  */
+#line 540 "parser.y"
+                                 { var_expr* var = new var_expr(CURR_FILE_LINE,(yyvsp[-2].var),(yyvsp[0].var),VAR_OP_GE); (yyval.var) = var; }
+#line 2246 "generated/y.tab.c"
+    break;
+
+  case 98: /* var_expr: var_expr T_EQ var_expr  */
+#line 541 "parser.y"
+                                 { var_expr* var = new var_expr(CURR_FILE_LINE,(yyvsp[-2].var),(yyvsp[0].var),VAR_OP_EQ); (yyval.var) = var; }
+#line 2252 "generated/y.tab.c"
+    break;
+
+  case 99: /* var_expr: var_expr T_NEQ var_expr  */
+#line 542 "parser.y"
+                                  { var_expr* var = new var_expr(CURR_FILE_LINE,(yyvsp[-2].var),(yyvsp[0].var),VAR_OP_NEQ); (yyval.var) = var; }
+#line 2258 "generated/y.tab.c"
+    break;
+
+  case 100: /* var_expr: T_STATIC_CAST '<' IDENTIFIER '>' '(' var_expr ')'  */
+#line 543 "parser.y"
+                                                            { var_cast* var = new var_cast(CURR_FILE_LINE,(yyvsp[-4].strValue),(yyvsp[-1].var)); (yyval.var) = var; }
+#line 2264 "generated/y.tab.c"
+    break;
+
+  case 101: /* var_eval_int_const: var_expr  */
+#line 547 "parser.y"
+                   { uint32 result;
+	    if (!(yyvsp[0].var)->eval(NULL, &result)) {
+	      ERROR_LOC((yyvsp[0].var)->_loc, "Expression does not evaluate to an integer constant.");
+	    }
+	    (yyval.iValue) = result;
+	  }
+#line 2275 "generated/y.tab.c"
+    break;
+
+  case 102: /* param_list_null: %empty  */
+#line 560 "parser.y"
+                         { null_list(&(yyval.par_list)); }
+#line 2281 "generated/y.tab.c"
+    break;
+
+  case 103: /* param_list_null: param_list  */
+#line 561 "parser.y"
+                         { (yyval.par_list) = (yyvsp[0].par_list); }
+#line 2287 "generated/y.tab.c"
+    break;
+
+  case 104: /* param_list: param_item  */
+#line 565 "parser.y"
+                                    { (yyval.par_list) = create_list((yyvsp[0].par_item)); }
+#line 2293 "generated/y.tab.c"
+    break;
+
+  case 105: /* param_list: param_list ',' param_item  */
+#line 566 "parser.y"
+                                    { (yyval.par_list) = append_list((yyvsp[-2].par_list),(yyvsp[0].par_item)); }
+#line 2299 "generated/y.tab.c"
+    break;
+
+  case 106: /* param_item: IDENTIFIER  */
+#line 570 "parser.y"
+                                  { param* par = new param((yyvsp[0].strValue)); (yyval.par_item) = par; }
+#line 2305 "generated/y.tab.c"
+    break;
+
+  case 107: /* param_item: IDENTIFIER '=' var_eval_int_const  */
+#line 571 "parser.y"
+                                             { param* par = new param((yyvsp[-2].strValue),new const32((yyvsp[0].iValue))); (yyval.par_item) = par; }
+#line 2311 "generated/y.tab.c"
+    break;
+
+  case 108: /* arg_list_null: %empty  */
+#line 577 "parser.y"
+                         { null_list(&(yyval.arg_list)); }
+#line 2317 "generated/y.tab.c"
+    break;
+
+  case 109: /* arg_list_null: arg_list  */
+#line 578 "parser.y"
+                         { (yyval.arg_list) = (yyvsp[0].arg_list); }
+#line 2323 "generated/y.tab.c"
+    break;
+
+  case 110: /* arg_list: arg_item  */
+#line 582 "parser.y"
+                                      { (yyval.arg_list) = create_list((yyvsp[0].arg_item)); }
+#line 2329 "generated/y.tab.c"
+    break;
+
+  case 111: /* arg_list: arg_list ',' arg_item  */
+#line 583 "parser.y"
+                                      { (yyval.arg_list) = append_list((yyvsp[-2].arg_list),(yyvsp[0].arg_item)); }
+#line 2335 "generated/y.tab.c"
+    break;
+
+  case 112: /* arg_item: IDENTIFIER '=' var_expr  */
+#line 587 "parser.y"
+                                  { argument* arg = new argument((yyvsp[-2].strValue),(yyvsp[0].var)); (yyval.arg_item) = arg; }
+#line 2341 "generated/y.tab.c"
+    break;
+
+  case 113: /* data_item: data_item_flag data_item_size IDENTIFIER noencode ';'  */
+#line 596 "parser.y"
+                                                                                        { struct_data *item = new struct_data(CURR_FILE_LINE,(yyvsp[-3].iValue),(yyvsp[-2].strValue),(yyvsp[-1].iValue) | (yyvsp[-4].iValue),NULL,NULL); (yyval.str_item) = item; }
+#line 2347 "generated/y.tab.c"
+    break;
+
+  case 114: /* data_item: data_item_flag data_item_size IDENTIFIER noencode '{' data_item_bits_list '}'  */
+#line 597 "parser.y"
+                                                                                        { struct_data *item = new struct_data(CURR_FILE_LINE,(yyvsp[-5].iValue),(yyvsp[-4].strValue),(yyvsp[-3].iValue) | (yyvsp[-6].iValue),(yyvsp[-1].bits_list),NULL); (yyval.str_item) = item; }
+#line 2353 "generated/y.tab.c"
+    break;
+
+  case 115: /* data_item: data_item_flag data_item_size IDENTIFIER noencode '{' data_item_bits_list encode_item_list '}'  */
+#line 598 "parser.y"
+                                                                                                         { struct_data *item = new struct_data(CURR_FILE_LINE,(yyvsp[-6].iValue),(yyvsp[-5].strValue),(yyvsp[-4].iValue) | (yyvsp[-7].iValue),(yyvsp[-2].bits_list),(yyvsp[-1].encode_list)); (yyval.str_item) = item; }
+#line 2359 "generated/y.tab.c"
+    break;
+
+  case 116: /* data_item_flag: %empty  */
+#line 602 "parser.y"
+                     { (yyval.iValue) = 0; }
+#line 2365 "generated/y.tab.c"
+    break;
+
+  case 117: /* data_item_flag: T_OPTIONAL  */
+#line 603 "parser.y"
+                     { (yyval.iValue) = SD_FLAGS_OPTIONAL; }
+#line 2371 "generated/y.tab.c"
+    break;
+
+  case 118: /* data_item_flag: T_SEVERAL  */
+#line 604 "parser.y"
+                     { (yyval.iValue) = SD_FLAGS_SEVERAL; }
+#line 2377 "generated/y.tab.c"
+    break;
+
+  case 119: /* noencode: %empty  */
+#line 608 "parser.y"
+                   { (yyval.iValue) = 0; }
+#line 2383 "generated/y.tab.c"
+    break;
+
+  case 120: /* noencode: NOENCODE  */
+#line 609 "parser.y"
+                   { (yyval.iValue) = SD_FLAGS_NOENCODE; }
+#line 2389 "generated/y.tab.c"
+    break;
+
+  case 121: /* zero_suppress: %empty  */
+#line 613 "parser.y"
+                        { (yyval.sm_flag) = new sm_flags(0); }
+#line 2395 "generated/y.tab.c"
+    break;
+
+  case 122: /* zero_suppress: ZERO_SUPPRESS  */
+#line 614 "parser.y"
+                        { (yyval.sm_flag) = new sm_flags(SM_FLAGS_ZERO_SUPPRESS); }
+#line 2401 "generated/y.tab.c"
+    break;
+
+  case 123: /* zero_suppress: ZERO_SUPPRESS_LIST  */
+#line 615 "parser.y"
+                             { (yyval.sm_flag) = new sm_flags(SM_FLAGS_ZERO_SUPPRESS_LIST); }
+#line 2407 "generated/y.tab.c"
+    break;
+
+  case 124: /* zero_suppress: ZERO_SUPPRESS_MULTI '(' var_eval_int_const ')'  */
+#line 616 "parser.y"
+                                                         { CHECK_ARRAY_SIZE((yyvsp[-1].iValue),0x10000); (yyval.sm_flag) = new sm_flags(SM_FLAGS_ZERO_SUPPRESS_MULTI,(yyvsp[-1].iValue)); }
+#line 2413 "generated/y.tab.c"
+    break;
+
+  case 125: /* zero_suppress: NO_INDEX_LIST  */
+#line 617 "parser.y"
+                        { (yyval.sm_flag) = new sm_flags(SM_FLAGS_NO_INDEX_LIST); }
+#line 2419 "generated/y.tab.c"
+    break;
+
+  case 126: /* encode_item_list: cond_or_encode_item  */
+#line 621 "parser.y"
+                                               { (yyval.encode_list) = create_list((encode_spec_base*) (yyvsp[0].encode_base)); }
+#line 2425 "generated/y.tab.c"
+    break;
+
+  case 127: /* encode_item_list: encode_item_list cond_or_encode_item  */
+#line 622 "parser.y"
+                                               { (yyval.encode_list) = append_list((yyvsp[-1].encode_list),(yyvsp[0].encode_base)); }
+#line 2431 "generated/y.tab.c"
+    break;
+
+  case 128: /* cond_or_encode_item: encode_item  */
+#line 626 "parser.y"
+                           { (yyval.encode_base) = (yyvsp[0].encode); }
+#line 2437 "generated/y.tab.c"
+    break;
+
+  case 129: /* cond_or_encode_item: cond_encode_item  */
+#line 627 "parser.y"
+                           { (yyval.encode_base) = (yyvsp[0].encode_base); }
+#line 2443 "generated/y.tab.c"
+    break;
+
+  case 130: /* encode_item: ENCODE '(' var_named_single_indexed encode_flags ',' '(' arg_list ')' ')' ';'  */
+#line 631 "parser.y"
+                                                                                        { encode_spec *encode = new encode_spec(CURR_FILE_LINE,(yyvsp[-7].var_n),(yyvsp[-3].arg_list),(yyvsp[-6].iValue)); (yyval.encode) = encode; }
+#line 2449 "generated/y.tab.c"
+    break;
+
+  case 131: /* encode_flags: %empty  */
+#line 635 "parser.y"
+                      { (yyval.iValue) = 0; }
+#line 2455 "generated/y.tab.c"
+    break;
+
+  case 132: /* encode_flags: APPEND_LIST  */
+#line 636 "parser.y"
+                      { (yyval.iValue) = ES_APPEND_LIST; }
+#line 2461 "generated/y.tab.c"
+    break;
+
+  case 133: /* cond_encode_item: T_IF '(' var_expr ')' '{' encode_item_list '}' cond_encode_else_item  */
+#line 640 "parser.y"
+                                                                               { encode_cond *cond = new encode_cond(CURR_FILE_LINE,(yyvsp[-5].var),(yyvsp[-2].encode_list),(yyvsp[0].encode_list)); (yyval.encode_base) = cond; }
+#line 2467 "generated/y.tab.c"
+    break;
+
+  case 134: /* cond_encode_else_item: T_ELSE '{' encode_item_list '}'  */
+#line 644 "parser.y"
+                                           { (yyval.encode_list) = (yyvsp[-1].encode_list); }
+#line 2473 "generated/y.tab.c"
+    break;
+
+  case 135: /* cond_encode_else_item: T_ELSE encode_item  */
+#line 645 "parser.y"
+                                         { (yyval.encode_list) = create_list((encode_spec_base*) (yyvsp[0].encode)); }
+#line 2479 "generated/y.tab.c"
+    break;
+
+  case 136: /* cond_encode_else_item: %empty  */
+#line 646 "parser.y"
+                                         { (yyval.encode_list) = NULL; }
+#line 2485 "generated/y.tab.c"
+    break;
+
+  case 137: /* data_item_size: UINT64  */
+#line 650 "parser.y"
+                 { (yyval.iValue) = 64; }
+#line 2491 "generated/y.tab.c"
+    break;
+
+  case 138: /* data_item_size: UINT32  */
+#line 651 "parser.y"
+                 { (yyval.iValue) = 32; }
+#line 2497 "generated/y.tab.c"
+    break;
+
+  case 139: /* data_item_size: UINT16  */
+#line 652 "parser.y"
+                 { (yyval.iValue) = 16; }
+#line 2503 "generated/y.tab.c"
+    break;
+
+  case 140: /* data_item_size: UINT8  */
+#line 653 "parser.y"
+                 { (yyval.iValue) = 8;  }
+#line 2509 "generated/y.tab.c"
+    break;
+
+  case 141: /* data_item_bits_list: data_item_bits  */
+#line 657 "parser.y"
+                                             { (yyval.bits_list) = create_set((yyvsp[0].bits_item)); }
+#line 2515 "generated/y.tab.c"
+    break;
+
+  case 142: /* data_item_bits_list: data_item_bits_list data_item_bits  */
+#line 658 "parser.y"
+                                             { if (!insert_set(&(yyval.bits_list),(yyvsp[-1].bits_list),(yyvsp[0].bits_item)) ) ERROR_LOC(CURR_FILE_LINE,"Bits are overlapping.\n"); }
+#line 2521 "generated/y.tab.c"
+    break;
+
+  case 143: /* data_item_bits: bits_range IDENTIFIER ';'  */
+#line 662 "parser.y"
+                                    { bits_spec *bits = new bits_spec((yyvsp[-2].iRange),(yyvsp[-1].strValue),NULL); (yyval.bits_item) = bits; }
+#line 2527 "generated/y.tab.c"
+    break;
+
+  case 144: /* data_item_bits: bits_range INTEGER ';'  */
+#line 663 "parser.y"
+                                    { bits_spec *bits = new bits_spec((yyvsp[-2].iRange),NULL,new bits_cond_check(CURR_FILE_LINE,new var_const(CURR_FILE_LINE,(yyvsp[-1].iValue)))); (yyval.bits_item) = bits; }
+#line 2533 "generated/y.tab.c"
+    break;
+
+  case 145: /* data_item_bits: bits_range '(' var_eval_int_const ')' ';'  */
+#line 664 "parser.y"
+                                                       { bits_spec *bits = new bits_spec((yyvsp[-4].iRange),NULL,new bits_cond_check(CURR_FILE_LINE,new var_const(CURR_FILE_LINE,(yyvsp[-2].iValue)))); (yyval.bits_item) = bits; }
+#line 2539 "generated/y.tab.c"
+    break;
+
+  case 146: /* data_item_bits: bits_range IDENTIFIER '=' var_eval_int_const ';'  */
+#line 665 "parser.y"
+                                                           { bits_spec *bits = new bits_spec((yyvsp[-4].iRange),(yyvsp[-3].strValue),new bits_cond_check(CURR_FILE_LINE,new var_const(CURR_FILE_LINE,(yyvsp[-1].iValue)))); (yyval.bits_item) = bits; }
+#line 2545 "generated/y.tab.c"
+    break;
+
+  case 147: /* data_item_bits: bits_range IDENTIFIER '=' bits_condition ';'  */
+#line 666 "parser.y"
+                                                       { bits_spec *bits = new bits_spec((yyvsp[-4].iRange),(yyvsp[-3].strValue),(yyvsp[-1].bits_cond)); (yyval.bits_item) = bits; }
+#line 2551 "generated/y.tab.c"
+    break;
+
+  case 148: /* bits_range: INTEGER ':'  */
+#line 670 "parser.y"
+                                { (yyval.iRange)._min = (yyvsp[-1].iValue); (yyval.iRange)._max = (yyvsp[-1].iValue); }
+#line 2557 "generated/y.tab.c"
+    break;
+
+  case 149: /* bits_range: INTEGER_RANGE ':'  */
+#line 671 "parser.y"
+                                { (yyval.iRange) = (yyvsp[-1].iRange); }
+#line 2563 "generated/y.tab.c"
+    break;
+
+  case 150: /* bits_condition: CHECK '(' var_expr ')'  */
+#line 675 "parser.y"
+                                         { bits_condition *cond = new bits_cond_check(CURR_FILE_LINE,(yyvsp[-1].var)); (yyval.bits_cond) = cond; }
+#line 2569 "generated/y.tab.c"
+    break;
+
+  case 151: /* bits_condition: MATCH '(' var_expr ')'  */
+#line 676 "parser.y"
+                                         { bits_condition *cond = new bits_cond_match(CURR_FILE_LINE,(yyvsp[-1].var)); (yyval.bits_cond) = cond; }
+#line 2575 "generated/y.tab.c"
+    break;
+
+  case 152: /* bits_condition: RANGE '(' var_expr ',' var_expr ')'  */
+#line 677 "parser.y"
+                                              { bits_condition *cond = new bits_cond_range(CURR_FILE_LINE,(yyvsp[-3].var),(yyvsp[-1].var)); (yyval.bits_cond) = cond; }
+#line 2581 "generated/y.tab.c"
+    break;
+
+  case 153: /* bits_condition: CHECK_COUNT '(' IDENTIFIER ',' IDENTIFIER ',' var_expr ',' var_expr ')'  */
+#line 678 "parser.y"
+                                                                                  { bits_condition *cond = new bits_cond_check_count(CURR_FILE_LINE,(yyvsp[-7].strValue),(yyvsp[-5].strValue),(yyvsp[-3].var),(yyvsp[-1].var)); (yyval.bits_cond) = cond; }
+#line 2587 "generated/y.tab.c"
+    break;
+
+  case 154: /* signal_or_sticky: SIGNAL  */
+#line 684 "parser.y"
+                 { (yyval.iValue) = 0; }
+#line 2593 "generated/y.tab.c"
+    break;
+
+  case 155: /* signal_or_sticky: STICKY  */
+#line 685 "parser.y"
+                 { (yyval.iValue) = EVENT_OPTS_STICKY; }
+#line 2599 "generated/y.tab.c"
+    break;
+
+  case 156: /* signal: signal_or_sticky '(' signal_ident_var ',' signal_types ')'  */
+#line 690 "parser.y"
+            { signal_spec* signal =
+		new signal_spec(CURR_FILE_LINE,CURR_SIGNAL_COUNT,
+				(yyvsp[-5].iValue),
+				(yyvsp[-3].sig_id_var)->_name,(yyvsp[-3].sig_id_var)->_ident,(yyvsp[-1].sig_types),0);
+	      delete (yyvsp[-3].sig_id_var); (yyval.sig) = signal;
+	    }
+#line 2610 "generated/y.tab.c"
+    break;
+
+  case 157: /* signal: signal_or_sticky '(' signal_ident_var ',' signal_ident_var ',' signal_types ')'  */
+#line 698 "parser.y"
+            { signal_spec* signal =
+		new signal_spec_range(CURR_FILE_LINE,CURR_SIGNAL_COUNT,
+				      (yyvsp[-7].iValue),
+				      (yyvsp[-5].sig_id_var)->_name,(yyvsp[-5].sig_id_var)->_ident,
+				      (yyvsp[-3].sig_id_var)->_name,(yyvsp[-3].sig_id_var)->_ident,(yyvsp[-1].sig_types),0);
+	      delete (yyvsp[-5].sig_id_var); delete (yyvsp[-3].sig_id_var); (yyval.sig) = signal;
+	    }
+#line 2622 "generated/y.tab.c"
+    break;
+
+  case 158: /* signal: signal_or_sticky '(' signal_tags signal_ident_var ',' signal_types ')'  */
+#line 707 "parser.y"
+            { signal_spec* signal =
+		new signal_spec(CURR_FILE_LINE,CURR_SIGNAL_COUNT,
+				(yyvsp[-6].iValue),
+				(yyvsp[-3].sig_id_var)->_name,(yyvsp[-3].sig_id_var)->_ident,(yyvsp[-1].sig_types),(yyvsp[-4].iValue));
+	      delete (yyvsp[-3].sig_id_var); (yyval.sig) = signal;
+	    }
+#line 2633 "generated/y.tab.c"
+    break;
+
+  case 159: /* signal: signal_or_sticky '(' signal_tags signal_ident_var ',' signal_ident_var ',' signal_types ')'  */
+#line 716 "parser.y"
+            { signal_spec* signal =
+		new signal_spec_range(CURR_FILE_LINE,CURR_SIGNAL_COUNT,
+				      (yyvsp[-8].iValue),
+				      (yyvsp[-5].sig_id_var)->_name,(yyvsp[-5].sig_id_var)->_ident,
+				      (yyvsp[-3].sig_id_var)->_name,(yyvsp[-3].sig_id_var)->_ident,(yyvsp[-1].sig_types),(yyvsp[-6].iValue));
+	      delete (yyvsp[-5].sig_id_var); delete (yyvsp[-3].sig_id_var); (yyval.sig) = signal;
+	    }
+#line 2645 "generated/y.tab.c"
+    break;
+
+  case 160: /* signal: signal_or_sticky '(' signal_ident_null ',' signal_types ')'  */
+#line 727 "parser.y"
+            { signal_spec* signal =
+		new signal_spec(CURR_FILE_LINE,CURR_SIGNAL_COUNT,
+				(yyvsp[-5].iValue),
+				(yyvsp[-3].sig_id_var)->_name,(yyvsp[-3].sig_id_var)->_ident,(yyvsp[-1].sig_types),0);
+	      delete (yyvsp[-3].sig_id_var); (yyval.sig) = signal;
+	    }
+#line 2656 "generated/y.tab.c"
+    break;
+
+  case 161: /* signal_ident_var: IDENTIFIER ',' var_named  */
+#line 737 "parser.y"
+            { signal_spec_ident_var* idvar =
+		new signal_spec_ident_var((yyvsp[-2].strValue),(yyvsp[0].var_n)); (yyval.sig_id_var) = idvar;
+	    }
+#line 2664 "generated/y.tab.c"
+    break;
+
+  case 162: /* signal_ident_null: IDENTIFIER ','  */
+#line 744 "parser.y"
+            { signal_spec_ident_var* idvar =
+		new signal_spec_ident_var((yyvsp[-1].strValue),NULL); (yyval.sig_id_var) = idvar;
+	    }
+#line 2672 "generated/y.tab.c"
+    break;
+
+  case 163: /* signal_types: signal_type_unit  */
+#line 751 "parser.y"
+            { (yyval.sig_types) = new signal_spec_types((yyvsp[0].sig_type_unit)); }
+#line 2678 "generated/y.tab.c"
+    break;
+
+  case 164: /* signal_types: '(' signal_type_unit ',' signal_type_unit ')'  */
+#line 753 "parser.y"
+            { (yyval.sig_types) = new signal_spec_types((yyvsp[-3].sig_type_unit),(yyvsp[-1].sig_type_unit)); }
+#line 2684 "generated/y.tab.c"
+    break;
+
+  case 165: /* signal_type: IDENTIFIER  */
+#line 757 "parser.y"
+                             { (yyval.strValue) = (yyvsp[0].strValue); }
+#line 2690 "generated/y.tab.c"
+    break;
+
+  case 166: /* signal_type: data_item_size  */
+#line 758 "parser.y"
+                             { (yyval.strValue) = data_item_size_to_signal_type((yyvsp[0].iValue)); }
+#line 2696 "generated/y.tab.c"
+    break;
+
+  case 167: /* signal_type_unit: signal_type  */
+#line 762 "parser.y"
+                              { (yyval.sig_type_unit) = new signal_spec_type_unit((yyvsp[0].strValue)); }
+#line 2702 "generated/y.tab.c"
+    break;
+
+  case 168: /* signal_type_unit: signal_type STRING  */
+#line 763 "parser.y"
+                              { insert_prefix_units_exp(CURR_FILE_LINE,(yyvsp[0].strValue));
+	                        (yyval.sig_type_unit) = new signal_spec_type_unit((yyvsp[-1].strValue),(yyvsp[0].strValue)); }
+#line 2709 "generated/y.tab.c"
+    break;
+
+  case 169: /* signal_tags: signal_tag_list ':'  */
+#line 768 "parser.y"
+                              { (yyval.iValue) = (yyvsp[-1].iValue); }
+#line 2715 "generated/y.tab.c"
+    break;
+
+  case 170: /* signal_tag_list: signal_tag  */
+#line 772 "parser.y"
+                                         { (yyval.iValue) = (yyvsp[0].iValue); }
+#line 2721 "generated/y.tab.c"
+    break;
+
+  case 171: /* signal_tag_list: signal_tag_list ',' signal_tag  */
+#line 773 "parser.y"
+                                         { (yyval.iValue) = (yyvsp[-2].iValue) | (yyvsp[0].iValue); }
+#line 2727 "generated/y.tab.c"
+    break;
+
+  case 172: /* signal_tag: FIRST_EVENT  */
+#line 777 "parser.y"
+                         { (yyval.iValue) = SIGNAL_TAG_FIRST_EVENT; }
+#line 2733 "generated/y.tab.c"
+    break;
+
+  case 173: /* signal_tag: LAST_EVENT  */
+#line 778 "parser.y"
+                         { (yyval.iValue) = SIGNAL_TAG_LAST_EVENT; }
+#line 2739 "generated/y.tab.c"
+    break;
+
+  case 174: /* signal_tag: TOGGLE INTEGER  */
+#line 779 "parser.y"
+                         { 
+	    if ((yyvsp[0].iValue) == 1)      { (yyval.iValue) = SIGNAL_TAG_TOGGLE_1; }
+	    else if ((yyvsp[0].iValue) == 2) { (yyval.iValue) = SIGNAL_TAG_TOGGLE_2; }
+	    else {	    
+	      ERROR_LOC(CURR_FILE_LINE, "Toggle # must be 1 or 2.");
+	    }
+	  }
+#line 2751 "generated/y.tab.c"
+    break;
+
+  case 175: /* signal_info: signal_or_sticky '(' ZERO_SUPPRESS ':' IDENTIFIER ')'  */
+#line 790 "parser.y"
+            { signal_info* signal =
+		new signal_info(CURR_FILE_LINE,CURR_SIGNAL_COUNT,(yyvsp[-5].iValue),
+				(yyvsp[-1].strValue),SIGNAL_INFO_ZERO_SUPPRESS); (yyval.sig_info) = signal;
+	    }
+#line 2760 "generated/y.tab.c"
+    break;
+
+  case 176: /* signal_info: signal_or_sticky '(' NO_INDEX_LIST ':' IDENTIFIER ')'  */
+#line 795 "parser.y"
+            { signal_info* signal =
+		new signal_info(CURR_FILE_LINE,CURR_SIGNAL_COUNT,(yyvsp[-5].iValue),
+				(yyvsp[-1].strValue),SIGNAL_INFO_NO_INDEX_LIST); (yyval.sig_info) = signal;
+	    }
+#line 2769 "generated/y.tab.c"
+    break;
+
+  case 177: /* signal_info: signal_or_sticky '(' NO_INDEX_LIST '(' var_eval_int_const ')' ':' IDENTIFIER ')'  */
+#line 801 "parser.y"
+            { signal_info* signal =
+		new signal_info(CURR_FILE_LINE,CURR_SIGNAL_COUNT,(yyvsp[-8].iValue),
+				add_index_to_identifier((yyvsp[-1].strValue),(yyvsp[-4].iValue)),
+				SIGNAL_INFO_NO_INDEX_LIST); (yyval.sig_info) = signal;
+	    }
+#line 2779 "generated/y.tab.c"
+    break;
+
+  case 178: /* signal_info: signal_or_sticky '(' ZERO_SUPPRESS_MULTI '(' var_eval_int_const ')' ':' IDENTIFIER ')'  */
+#line 808 "parser.y"
+            { CHECK_ARRAY_SIZE((yyvsp[-4].iValue),0x10000);
+	      signal_info* signal =
+		new signal_info(CURR_FILE_LINE,CURR_SIGNAL_COUNT,(yyvsp[-8].iValue),
+				(yyvsp[-1].strValue),SIGNAL_INFO_ZERO_SUPPRESS_MULTI,(yyvsp[-4].iValue));
+	      (yyval.sig_info) = signal;
+	    }
+#line 2790 "generated/y.tab.c"
+    break;
+
+
+#line 2794 "generated/y.tab.c"
+
+      default: break;
+    }
+  /* User semantic actions sometimes alter yychar, and that requires
+     that yytoken be updated with the new translation.  We take the
+     approach of translating immediately before every use of yytoken.
+     One alternative is translating here after every semantic action,
+     but that translation would be missed if the semantic action invokes
+     YYABORT, YYACCEPT, or YYERROR immediately after altering yychar or
+     if it invokes YYBACKUP.  In the case of YYABORT or YYACCEPT, an
+     incorrect destructor might then be invoked immediately.  In the
+     case of YYERROR or YYBACKUP, subsequent parser actions might lead
+     to an incorrect destructor call or verbose syntax error message
+     before the lookahead is translated.  */
+  YY_SYMBOL_PRINT ("-> $$ =", YY_CAST (yysymbol_kind_t, yyr1[yyn]), &yyval, &yyloc);
+
+  YYPOPSTACK (yylen);
+  yylen = 0;
+
+  *++yyvsp = yyval;
+
+  /* Now 'shift' the result of the reduction.  Determine what state
+     that goes to, based on the state we popped back to and the rule
+     number reduced by.  */
+  {
+    const int yylhs = yyr1[yyn] - YYNTOKENS;
+    const int yyi = yypgoto[yylhs] + *yyssp;
+    yystate = (0 <= yyi && yyi <= YYLAST && yycheck[yyi] == *yyssp
+               ? yytable[yyi]
+               : yydefgoto[yylhs]);
+  }
+
+  goto yynewstate;
+
+
+/*--------------------------------------.
+| yyerrlab -- here on detecting error.  |
+`--------------------------------------*/
+yyerrlab:
+  /* Make sure we have latest lookahead translation.  See comments at
+     user semantic actions for why this is necessary.  */
+  yytoken = yychar == YYEMPTY ? YYSYMBOL_YYEMPTY : YYTRANSLATE (yychar);
+  /* If not already recovering from an error, report this error.  */
+  if (!yyerrstatus)
+    {
+      ++yynerrs;
+      yyerror (YY_("syntax error"));
+    }
+
+  if (yyerrstatus == 3)
+    {
+      /* If just tried and failed to reuse lookahead token after an
+         error, discard it.  */
+
+      if (yychar <= YYEOF)
+        {
+          /* Return failure if at end of input.  */
+          if (yychar == YYEOF)
+            YYABORT;
+        }
+      else
+        {
+          yydestruct ("Error: discarding",
+                      yytoken, &yylval);
+          yychar = YYEMPTY;
+        }
+    }
+
+  /* Else will try to reuse lookahead token after shifting the error
+     token.  */
+  goto yyerrlab1;
+
+
+/*---------------------------------------------------.
+| yyerrorlab -- error raised explicitly by YYERROR.  |
+`---------------------------------------------------*/
+yyerrorlab:
+  /* Pacify compilers when the user code never invokes YYERROR and the
+     label yyerrorlab therefore never appears in user code.  */
+  if (0)
+    YYERROR;
+  ++yynerrs;
+
+  /* Do not reclaim the symbols of the rule whose action triggered
+     this YYERROR.  */
+  YYPOPSTACK (yylen);
+  yylen = 0;
+  YY_STACK_PRINT (yyss, yyssp);
+  yystate = *yyssp;
+  goto yyerrlab1;
+
+
+/*-------------------------------------------------------------.
+| yyerrlab1 -- common code for both syntax error and YYERROR.  |
+`-------------------------------------------------------------*/
+yyerrlab1:
+  yyerrstatus = 3;      /* Each real token shifted decrements this.  */
+
+  /* Pop stack until we find a state that shifts the error token.  */
+  for (;;)
+    {
+      yyn = yypact[yystate];
+      if (!yypact_value_is_default (yyn))
+        {
+          yyn += YYSYMBOL_YYerror;
+          if (0 <= yyn && yyn <= YYLAST && yycheck[yyn] == YYSYMBOL_YYerror)
+            {
+              yyn = yytable[yyn];
+              if (0 < yyn)
+                break;
+            }
+        }
+
+      /* Pop the current state because it cannot handle the error token.  */
+      if (yyssp == yyss)
+        YYABORT;
+
+
+      yydestruct ("Error: popping",
+                  YY_ACCESSING_SYMBOL (yystate), yyvsp);
+      YYPOPSTACK (1);
+      yystate = *yyssp;
+      YY_STACK_PRINT (yyss, yyssp);
+    }
+
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  *++yyvsp = yylval;
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
+
+
+  /* Shift the error token.  */
+  YY_SYMBOL_PRINT ("Shifting", YY_ACCESSING_SYMBOL (yyn), yyvsp, yylsp);
+
+  yystate = yyn;
+  goto yynewstate;
+
+
+/*-------------------------------------.
+| yyacceptlab -- YYACCEPT comes here.  |
+`-------------------------------------*/
+yyacceptlab:
+  yyresult = 0;
+  goto yyreturnlab;
+
+
+/*-----------------------------------.
+| yyabortlab -- YYABORT comes here.  |
+`-----------------------------------*/
+yyabortlab:
+  yyresult = 1;
+  goto yyreturnlab;
+
+
+/*-----------------------------------------------------------.
+| yyexhaustedlab -- YYNOMEM (memory exhaustion) comes here.  |
+`-----------------------------------------------------------*/
+yyexhaustedlab:
+  yyerror (YY_("memory exhausted"));
+  yyresult = 2;
+  goto yyreturnlab;
+
+
+/*----------------------------------------------------------.
+| yyreturnlab -- parsing is finished, clean up and return.  |
+`----------------------------------------------------------*/
+yyreturnlab:
+  if (yychar != YYEMPTY)
+    {
+      /* Make sure we have latest lookahead translation.  See comments at
+         user semantic actions for why this is necessary.  */
+      yytoken = YYTRANSLATE (yychar);
+      yydestruct ("Cleanup: discarding lookahead",
+                  yytoken, &yylval);
+    }
+  /* Do not reclaim the symbols of the rule whose action triggered
+     this YYABORT or YYACCEPT.  */
+  YYPOPSTACK (yylen);
+  YY_STACK_PRINT (yyss, yyssp);
+  while (yyssp != yyss)
+    {
+      yydestruct ("Cleanup: popping",
+                  YY_ACCESSING_SYMBOL (+*yyssp), yyvsp);
+      YYPOPSTACK (1);
+    }
+#ifndef yyoverflow
+  if (yyss != yyssa)
+    YYSTACK_FREE (yyss);
+#endif
+
+  return yyresult;
+}
+
+#line 855 "parser.y"
+
+
+void yyerror(const char *s) {
+  print_lineno(stderr,yylineno);
+  fprintf(stderr," %s\n", s);
+/*
+  Current.first_line   = Rhs[1].first_line;
+  Current.first_column = Rhs[1].first_column;
+  Current.last_line    = Rhs[N].last_line;
+  Current.last_column  = Rhs[N].last_column;
+*/
+}
+
+bool parse_definitions()
+{
+  // yylloc.first_line = yylloc.last_line = 1;
+  // yylloc.first_column = yylloc.last_column = 0;
+
+  return yyparse() == 0;
+}
@@ -0,0 +1,255 @@
+/* A Bison parser, made by GNU Bison 3.8.2.  */
+
+/* Bison interface for Yacc-like parsers in C
+
+   Copyright (C) 1984, 1989-1990, 2000-2015, 2018-2021 Free Software Foundation,
+   Inc.
+
+   This program is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <https://www.gnu.org/licenses/>.  */
+
+/* As a special exception, you may create a larger work that contains
+   part or all of the Bison parser skeleton and distribute that work
+   under terms of your choice, so long as that work isn't itself a
+   parser generator using the skeleton or a modified version thereof
+   as a parser skeleton.  Alternatively, if you modify or redistribute
+   the parser skeleton itself, you may (at your option) remove this
+   special exception, which will cause the skeleton and the resulting
+   Bison output files to be licensed under the GNU General Public
+   License without this special exception.
+
+   This special exception was added by the Free Software Foundation in
+   version 2.2 of Bison.  */
+
+/* DO NOT RELY ON FEATURES THAT ARE NOT DOCUMENTED in the manual,
+   especially those whose name start with YY_ or yy_.  They are
+   private implementation details that can be changed or removed.  */
+
+#ifndef YY_YY_GENERATED_Y_TAB_H_INCLUDED
+# define YY_YY_GENERATED_Y_TAB_H_INCLUDED
+/* Debug traces.  */
+#ifndef YYDEBUG
+# define YYDEBUG 0
+#endif
+#if YYDEBUG
+extern int yydebug;
+#endif
+
+/* Token kinds.  */
+#ifndef YYTOKENTYPE
+# define YYTOKENTYPE
+  enum yytokentype
+  {
+    YYEMPTY = -2,
+    YYEOF = 0,                     /* "end of file"  */
+    YYerror = 256,                 /* error  */
+    YYUNDEF = 257,                 /* "invalid token"  */
+    INTEGER = 258,                 /* INTEGER  */
+    INTEGER_RANGE = 259,           /* INTEGER_RANGE  */
+    DOUBLE = 260,                  /* DOUBLE  */
+    STRING = 261,                  /* STRING  */
+    IDENTIFIER = 262,              /* IDENTIFIER  */
+    EVENT = 263,                   /* EVENT  */
+    STICKY_EVENT = 264,            /* STICKY_EVENT  */
+    SUBEVENT = 265,                /* SUBEVENT  */
+    SIGNAL = 266,                  /* SIGNAL  */
+    STICKY = 267,                  /* STICKY  */
+    TOGGLE = 268,                  /* TOGGLE  */
+    UINT64 = 269,                  /* UINT64  */
+    UINT32 = 270,                  /* UINT32  */
+    UINT16 = 271,                  /* UINT16  */
+    UINT8 = 272,                   /* UINT8  */
+    T_IF = 273,                    /* T_IF  */
+    T_ELSE = 274,                  /* T_ELSE  */
+    T_LIST = 275,                  /* T_LIST  */
+    T_SEVERAL = 276,               /* T_SEVERAL  */
+    T_OPTIONAL = 277,              /* T_OPTIONAL  */
+    T_SELECT = 278,                /* T_SELECT  */
+    T_MULTI = 279,                 /* T_MULTI  */
+    T_EXTERNAL = 280,              /* T_EXTERNAL  */
+    T_NOREVISIT = 281,             /* T_NOREVISIT  */
+    T_REVISIT = 282,               /* T_REVISIT  */
+    T_IGNORE_UNKNOWN_SUBEVENT = 283, /* T_IGNORE_UNKNOWN_SUBEVENT  */
+    T_STATIC_CAST = 284,           /* T_STATIC_CAST  */
+    T_LOR = 285,                   /* T_LOR  */
+    T_LAND = 286,                  /* T_LAND  */
+    T_SHL = 287,                   /* T_SHL  */
+    T_SHR = 288,                   /* T_SHR  */
+    T_LE = 289,                    /* T_LE  */
+    T_GE = 290,                    /* T_GE  */
+    T_EQ = 291,                    /* T_EQ  */
+    T_NEQ = 292,                   /* T_NEQ  */
+    MATCH = 293,                   /* MATCH  */
+    CHECK = 294,                   /* CHECK  */
+    RANGE = 295,                   /* RANGE  */
+    ENCODE = 296,                  /* ENCODE  */
+    NOENCODE = 297,                /* NOENCODE  */
+    EXTERNAL = 298,                /* EXTERNAL  */
+    MEMBER = 299,                  /* MEMBER  */
+    ZERO_SUPPRESS = 300,           /* ZERO_SUPPRESS  */
+    ZERO_SUPPRESS_LIST = 301,      /* ZERO_SUPPRESS_LIST  */
+    ZERO_SUPPRESS_MULTI = 302,     /* ZERO_SUPPRESS_MULTI  */
+    NO_INDEX_LIST = 303,           /* NO_INDEX_LIST  */
+    APPEND_LIST = 304,             /* APPEND_LIST  */
+    FIRST_EVENT = 305,             /* FIRST_EVENT  */
+    LAST_EVENT = 306,              /* LAST_EVENT  */
+    MARK = 307,                    /* MARK  */
+    MARK_COUNT = 308,              /* MARK_COUNT  */
+    CHECK_COUNT = 309,             /* CHECK_COUNT  */
+    MATCH_END = 310,               /* MATCH_END  */
+    ULNOT = 311,                   /* ULNOT  */
+    UMINUS = 312                   /* UMINUS  */
+  };
+  typedef enum yytokentype yytoken_kind_t;
+#endif
+/* Token kinds.  */
+#define YYEMPTY -2
+#define YYEOF 0
+#define YYerror 256
+#define YYUNDEF 257
+#define INTEGER 258
+#define INTEGER_RANGE 259
+#define DOUBLE 260
+#define STRING 261
+#define IDENTIFIER 262
+#define EVENT 263
+#define STICKY_EVENT 264
+#define SUBEVENT 265
+#define SIGNAL 266
+#define STICKY 267
+#define TOGGLE 268
+#define UINT64 269
+#define UINT32 270
+#define UINT16 271
+#define UINT8 272
+#define T_IF 273
+#define T_ELSE 274
+#define T_LIST 275
+#define T_SEVERAL 276
+#define T_OPTIONAL 277
+#define T_SELECT 278
+#define T_MULTI 279
+#define T_EXTERNAL 280
+#define T_NOREVISIT 281
+#define T_REVISIT 282
+#define T_IGNORE_UNKNOWN_SUBEVENT 283
+#define T_STATIC_CAST 284
+#define T_LOR 285
+#define T_LAND 286
+#define T_SHL 287
+#define T_SHR 288
+#define T_LE 289
+#define T_GE 290
+#define T_EQ 291
+#define T_NEQ 292
+#define MATCH 293
+#define CHECK 294
+#define RANGE 295
+#define ENCODE 296
+#define NOENCODE 297
+#define EXTERNAL 298
+#define MEMBER 299
+#define ZERO_SUPPRESS 300
+#define ZERO_SUPPRESS_LIST 301
+#define ZERO_SUPPRESS_MULTI 302
+#define NO_INDEX_LIST 303
+#define APPEND_LIST 304
+#define FIRST_EVENT 305
+#define LAST_EVENT 306
+#define MARK 307
+#define MARK_COUNT 308
+#define CHECK_COUNT 309
+#define MATCH_END 310
+#define ULNOT 311
+#define UMINUS 312
+
+/* Value type.  */
+#if ! defined YYSTYPE && ! defined YYSTYPE_IS_DECLARED
+union YYSTYPE
+{
+#line 86 "parser.y"
+
+  // What we get from the lexer:
+
+  double  fValue;              /* double value */
+  int     iValue;              /* integer value */
+  const char *strValue;        /* string */
+
+  int_range iRange;
+
+  // We generate internally:
+
+  def_node       *node;
+  def_node_list  *nodes;
+
+  struct_cond    *str_cond;
+  //struct_several *str_several;
+  struct_select  *str_select;
+  struct_member  *str_member;
+  struct_mark    *str_mark;
+  struct_check_count *str_check;
+  struct_decl    *str_decl;
+  struct_decl_list *str_decl_list;
+  struct_list    *str_list;
+
+  struct_item    *str_item;
+
+  struct_item_list *str_body;
+  struct_header    *str_header;
+
+  struct_definition *str_def;
+  event_definition *ev_def;
+
+  variable       *var;
+  var_name       *var_n;
+
+  sm_flags       *sm_flag;
+
+  bits_spec_list *bits_list;
+  bits_spec      *bits_item;
+
+  encode_spec_base *encode_base;
+  encode_spec      *encode;
+  encode_spec_list *encode_list;
+
+  param_list *par_list;
+  param      *par_item;
+  argument_list   *arg_list;
+  argument        *arg_item;
+
+  bits_condition  *bits_cond;
+
+  signal_spec     *sig;
+  signal_info     *sig_info;
+
+  signal_spec_ident_var *sig_id_var;
+  signal_spec_types *sig_types;
+  signal_spec_type_unit *sig_type_unit;
+
+
+#line 241 "generated/y.tab.h"
+
+};
+typedef union YYSTYPE YYSTYPE;
+# define YYSTYPE_IS_TRIVIAL 1
+# define YYSTYPE_IS_DECLARED 1
+#endif
+
+
+extern YYSTYPE yylval;
+
+
+int yyparse (void);
+
+
+#endif /* !YY_YY_GENERATED_Y_TAB_H_INCLUDED  */
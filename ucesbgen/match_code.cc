@@ -24,6 +24,177 @@
 
 #include <assert.h>
 #include <limits.h>
+#include <string.h>
+
+#include <string>
+#include <algorithm>
+
+// Match profile, written by the unpacker with --match-profile=FILE.
+// Lines are 'file:line name count', with the location of the
+// candidate declaration in the specification.
+
+typedef std::map<std::string,uint64> match_profile_map;
+
+static match_profile_map *_match_profile = NULL;
+
+static std::string match_profile_key(const char *loc,const char *name)
+{
+  return std::string(loc) + " " + name;
+}
+
+void read_match_profile(const char *filename)
+{
+  FILE *fid = fopen(filename,"r");
+
+  if (!fid)
+    {
+      perror("fopen");
+      ERROR("Failed to open match profile %s.",filename);
+    }
+
+  if (!_match_profile)
+    _match_profile = new match_profile_map;
+
+  char line[1024];
+  int lineno = 0;
+
+  while (fgets(line,sizeof (line),fid))
+    {
+      lineno++;
+
+      if (line[0] == '#' || line[0] == '\n')
+	continue;
+
+      char loc[512];
+      char name[256];
+      unsigned long long count;
+
+      if (sscanf(line,"%511s %255s %llu",loc,name,&count) != 3)
+	ERROR("%s:%d: Malformed match profile line.",filename,lineno);
+
+      (*_match_profile)[match_profile_key(loc,name)] += count;
+    }
+
+  fclose(fid);
+}
+
+bool have_match_profile()
+{
+  return _match_profile != NULL;
+}
+
+uint64 match_profile_count(const struct_decl *decl)
+{
+  if (!_match_profile)
+    return 0;
+
+  char loc[512];
+
+  format_lineno(loc,sizeof (loc),decl->_loc._internal);
+
+  dumper_dest_memory dd;
+  dumper d(&dd);
+
+  decl->_name->dump(d);
+  dd.write("",1);
+
+  match_profile_map::iterator iter =
+    _match_profile->find(match_profile_key(loc,dd.get_string()));
+
+  if (iter == _match_profile->end())
+    return 0;
+
+  return iter->second;
+}
+
+void struct_unpack_code::gen_match_profile_count(const struct_decl *decl,
+						 dumper &d)
+{
+  d.text_fmt("MATCH_PROFILE_COUNT(%d,",decl->_loc._internal);
+  decl->_name->dump(d);
+  d.text(");\n");
+}
+
+static bool match_order_compare(const match_order_item &lhs,
+				const match_order_item &rhs)
+{
+  return lhs._count > rhs._count;
+}
+
+void struct_unpack_code::match_order(const struct_decl_list *items,
+				     std::vector<match_order_item> &order,
+				     bool use_profile)
+{
+  // Without a profile, the candidates are tried in order of
+  // declaration, and all of them are tried.
+
+  struct_decl_list::const_iterator i;
+  int index = 1;
+
+  for (i = items->begin(); i != items->end(); ++i, ++index)
+    {
+      match_order_item item;
+
+      item._decl  = *i;
+      item._index = index;
+      item._count = use_profile ? match_profile_count(*i) : 0;
+      item._exclusive = false;
+
+      order.push_back(item);
+    }
+
+  if (!_match_profile || !use_profile)
+    return;
+
+  // All candidates must still be tried, to report double matches.
+  // Except when a candidate matched that cannot match together with
+  // any other, i.e. they differ in some fixed bit of the first data
+  // word.
+
+  std::vector<match_info> infos(order.size());
+  std::vector<bool> has_bits(order.size());
+
+  dumper_dest_memory dd;
+  dumper d(&dd); // comments from get_match_bits not wanted
+
+  for (size_t j = 0; j < order.size(); j++)
+    {
+      const struct_decl *decl = order[j]._decl;
+
+      has_bits[j] = false;
+
+      if (decl->is_event_opt())
+	continue;
+
+      infos[j]._size = 0;
+      has_bits[j] = get_match_bits(decl,d,infos[j]);
+    }
+
+  for (size_t j = 0; j < order.size(); j++)
+    {
+      if (!has_bits[j])
+	continue;
+
+      size_t k;
+
+      for (k = 0; k < order.size(); k++)
+	{
+	  if (k == j ||
+	      order[k]._decl->is_event_opt())
+	    continue;
+
+	  if (!has_bits[k] ||
+	      infos[k]._size != infos[j]._size ||
+	      !((infos[j]._mask  & infos[k]._mask) &
+		(infos[j]._value ^ infos[k]._value)))
+	    break;
+	}
+
+      order[j]._exclusive = (k == order.size());
+    }
+
+  std::stable_sort(order.begin(),order.end(),match_order_compare);
+}
 
 bool struct_unpack_code::get_match_bits(const struct_item* item,dumper &d,const arguments *args,
 					match_info &bits)
@@ -223,6 +394,7 @@ void struct_unpack_code::gen_match_decl_quick(const std::vector<match_info> &inf
 
       if (abort_spurious_label)
 	gen_check_spurios_match(info._decl,d,abort_spurious_label);
+      gen_match_profile_count(info._decl,d);
       gen_unpack_decl(info._decl,"UNPACK_DECL",d,true);
 
       d.text_fmt("continue;\n");
@@ -356,8 +528,32 @@ void struct_unpack_code::gen_match_decl_quick(const std::vector<match_info> &inf
 	}
 
 
+      // With a match profile, the most frequent candidates come
+      // first.  A candidate that is distinguishable from all others
+      // ends the search when it matches.
+
+      std::vector<match_order_item> order;
+
       for (unsigned int i = 0; i < infos.size(); i++)
 	{
+	  match_order_item item;
+
+	  item._decl  = infos[i]._decl;
+	  item._index = (int) i; // into infos
+	  item._count = match_profile_count(infos[i]._decl);
+	  item._exclusive = have_match_profile() && !ambigous[i];
+
+	  order.push_back(item);
+	}
+
+      std::stable_sort(order.begin(),order.end(),match_order_compare);
+
+      static int match_quick_found_label_counter = 0;
+      bool match_quick_found_label = false;
+
+      for (unsigned int k = 0; k < order.size(); k++)
+	{
+	  unsigned int i = (unsigned int) order[k]._index;
 	  const match_info &info = infos[i];
 	  const struct_decl *decl = info._decl;
 
@@ -378,7 +574,17 @@ void struct_unpack_code::gen_match_decl_quick(const std::vector<match_info> &inf
 	      dump_param_args(decl->_loc,named_header->_params,decl->_args,d,false);
 	    }
 	  d.text(");\n");
+	  if (order[k]._exclusive && k + 1 < order.size())
+	    {
+	      // Only our own match ends the search.
+	      d.text_fmt("if (__match_no == %d) goto match_quick_found_%d;\n",
+			 info._index,match_quick_found_label_counter);
+	      match_quick_found_label = true;
+	    }
 	}
+      if (match_quick_found_label)
+	d.text_fmt("match_quick_found_%d:;\n",
+		   match_quick_found_label_counter++);
     }
 }
 
@@ -282,7 +282,7 @@ void struct_decl::check_valid_opts(int valid_opts)
     }
 }
 
-int struct_decl::is_event_opt()
+int struct_decl::is_event_opt() const
 {
   return _opts & EVENT_OPTS_IGNORE_UNKNOWN_SUBEVENT;
 }
@@ -130,7 +130,7 @@ public:
 public:
   void check_valid_opts(int valid_opts);
 
-  int is_event_opt();
+  int is_event_opt() const;
 
 public:
   virtual void dump(dumper &d,bool recursive = true) const;
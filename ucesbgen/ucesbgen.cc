@@ -20,10 +20,12 @@
 
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 
 #include "definitions.hh"
 #include "parse_error.hh"
 #include "account.hh"
+#include "unpack_code.hh"
 
 #include "signal_errors.hh"
 
@@ -34,16 +36,25 @@ bool parse_definitions();
 void usage()
 {
   printf ("ucesbgen\n"
-	  "usage ucesbgen\n");
-  printf ("    ");
+	  "usage ucesbgen [options] < spec > code\n");
+  printf ("    --match-profile=FILE  Select candidate match counts "
+	  "(from ucesb --match-profile).\n");
 }
 
-int main(int /*argc*/,char *argv[])
+int main(int argc,char *argv[])
 {
   lexer_read_fd = 0; // read from stdin
 
   setup_segfault_coredump(argv[0]);
 
+  for (int i = 1; i < argc; i++)
+    {
+      if (strncmp(argv[i],"--match-profile=",16) == 0)
+	read_match_profile(argv[i] + 16);
+      else
+	ERROR("%s: Unknown option: %s",argv[0],argv[i]);
+    }
+
   if (!parse_definitions())
     ERROR("%s: Aborting!\n",argv[0]);
 
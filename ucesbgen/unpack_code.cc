@@ -203,6 +203,10 @@ void generate_unpack_code(struct_definition *structure)
   print_footer("PACKER");
 }
 
+// Set when any 64-bit data item is unpacked.  (--bulk-swap cannot
+// order the 32-bit halves of such items.)
+bool _unpack_has_data64 = false;
+
 void generate_unpack_code(event_definition *event)
 {
   if (event->_code)
@@ -275,6 +279,19 @@ void generate_unpack_code(event_definition *event)
     }
 }
 
+// Must come after all structures and events have been generated.
+
+void generate_unpack_defines()
+{
+  dumper_dest_file d_dest(stdout);
+  dumper d(&d_dest);
+
+  print_header("UNPACKER_DEFINES","Data item sizes");
+  d.text_fmt("#define UNPACK_HAS_DATA64  %d\n\n",
+	     _unpack_has_data64);
+  print_footer("UNPACKER_DEFINES");
+}
+
 #define COMMENT_DUMP_ORIG(d,i) { dumper __cd(d,0,true); i->dump(__cd,false); }
 
 void struct_unpack_code::gen(const struct_definition *str,
@@ -738,6 +755,175 @@ void struct_unpack_code::gen(const struct_encode *encode,dumper &d,uint32 type)
   gen(encode->_encode,d,type,NULL);
 }
 
+static void gen_bits_union(dumper &d,const struct_data *data,
+			   const char *data_type,const char *full_name,
+			   const char *prefix)
+{
+  d.text("union\n");
+  d.text("{\n");
+  dumper sd(d,2);
+  // Now dump the bitfields
+  sd.text("struct\n");
+  sd.text("{\n");
+  dumper ssd(sd,2);
+  // We need to eject the bitfield in two directions, for little and
+  // big endian machines...
+
+#define BITFIELD_DUMMY(d,data_type,first,last) { \
+  (d).text(data_type);    \
+  if ((first) == (last))  \
+    (d).text_fmt("dummy_%d : 1;\n",(first)); \
+  else                                       \
+    (d).text_fmt("dummy_%d_%d : %d;\n",(first),(last),(last)-(first)+1); \
+}
+#define BITFIELD_NAMED(d,data_type,b) { \
+  (d).text(data_type);     \
+  if ((b)->_name)          \
+    (d).text((b)->_name);  \
+  else                     \
+    (d).text_fmt("unnamed_%d_%d",(b)->_min,(b)->_max); \
+  if ((b)->_min == (b)->_max)                          \
+    (d).text_fmt(" : 1; // %d\n",(b)->_min);           \
+  else                                                 \
+    (d).text_fmt(" : %d; // %d..%d\n",(b)->_max - (b)->_min + 1,(b)->_min,(b)->_max); \
+}
+
+  {
+    ssd.col0_text("#if __BYTE_ORDER == __LITTLE_ENDIAN\n");
+    bits_spec_list::const_iterator i;
+    int next_bit = 0;
+    for (i = data->_bits->begin(); i != data->_bits->end(); ++i)
+      {
+	bits_spec *b = *i;
+	if (b->_min > next_bit)
+	  BITFIELD_DUMMY(ssd,data_type,next_bit,b->_min-1);
+
+	BITFIELD_NAMED(ssd,data_type,b);
+	next_bit = b->_max+1;
+      }
+    if (data->_size > next_bit)
+      BITFIELD_DUMMY(ssd,data_type,next_bit,data->_size-1);
+    ssd.col0_text("#endif\n");
+  }
+  {
+    ssd.col0_text("#if __BYTE_ORDER == __BIG_ENDIAN\n");
+    bits_spec_list::const_reverse_iterator ri;
+    int last_bit = data->_size-1;
+    for (ri = data->_bits->rbegin(); ri != data->_bits->rend(); ++ri)
+      {
+	bits_spec *b = *ri;
+	if (b->_max < last_bit)
+	  BITFIELD_DUMMY(ssd,data_type,b->_max+1,last_bit);
+
+	BITFIELD_NAMED(ssd,data_type,b);
+	last_bit = b->_min-1;
+      }
+    if (last_bit > 0)
+      BITFIELD_DUMMY(ssd,data_type,0,last_bit);
+    ssd.col0_text("#endif\n");
+  }
+  sd.text("};\n"); // unnamed structure (gcc extension)
+  // The dump the full value
+  sd.text_fmt("%s %s;\n",data_type,full_name);
+  d.text_fmt("} %s%s;",prefix,data->_ident);
+}
+
+// For several items where all checked bits are constants, get the
+// mask and value of the fixed bits.  The run of matching items can
+// then be found in bulk before unpacking (__data_src::run_uint32).
+
+static bool several_bulk_bits(const struct_data *data,
+			      uint32 *mask,uint32 *value)
+{
+  if (data->_size != 32 || !data->_bits)
+    return false;
+
+  uint32 unnamed_bits = 0xffffffff;
+  uint32 fixed_mask = 0;
+  uint32 fixed_value = 0;
+
+  bits_spec_list::const_iterator i;
+
+  for (i = data->_bits->begin(); i != data->_bits->end(); ++i)
+    {
+      bits_spec *b = *i;
+
+      int width = b->_max - b->_min + 1;
+      uint32 field = (width == 32 ? 0xffffffff :
+		      ((((uint32) 1) << width) - 1) << b->_min);
+
+      unnamed_bits &= ~field;
+
+      if (!b->_cond)
+	continue;
+
+      // Ranges, parameters (MATCH) and counts are left to the
+      // item-by-item checks.
+
+      const bits_cond_check *check =
+	dynamic_cast<const bits_cond_check *>(b->_cond);
+      uint32 val;
+
+      if (!check ||
+	  !check->_check->eval(NULL,&val))
+	return false;
+
+      if (width < 32 && (val >> width))
+	return false; // can never match
+
+      fixed_mask  |= field;
+      fixed_value |= val << b->_min;
+    }
+
+  *mask  = fixed_mask | unnamed_bits;
+  *value = fixed_value;
+
+  return *mask != 0;
+}
+
+void struct_unpack_code::gen_several_bulk(const struct_data *data,
+					  dumper &d,uint32 type,
+					  const char *data_type,
+					  const char *full_name,
+					  int account_id,
+					  uint32 mask,uint32 value)
+{
+  // The items of the run need no checks.  The loop that follows
+  // handles the rest (i.e. ends at the first non-matching item)
+  // exactly as without the bulk check.
+
+  d.text("{\n");
+  dumper sd(d,2);
+  sd.text_fmt("size_t __run = __buffer.run_uint32(0x%08x,0x%08x);\n",
+	      mask,value);
+  sd.text("for ( ; __run; __run--) {\n");
+  gen_bits_union(sd,data,data_type,full_name,"");
+  sd.nl();
+  sd.text_fmt("PEEK_FROM_BUFFER_FULL(%d,%s,%s,%s.%s,%d);\n",
+	      data->_loc._internal,
+	      data_type,data->_ident,data->_ident,full_name,
+	      account_id);
+  sd.text_fmt("__buffer.advance(sizeof(%s.%s));\n",
+	      data->_ident,full_name);
+
+  if (data->_encode)
+    {
+      char name_prefix_str[512];
+
+      sprintf(name_prefix_str,"%s.",data->_ident);
+
+      prefix_ident name_prefix;
+
+      name_prefix._list = data->_bits;
+      name_prefix._prefix = name_prefix_str;
+
+      gen(data->_encode,sd,type,&name_prefix);
+    }
+
+  sd.text("}\n");
+  d.text("}\n");
+}
+
 void struct_unpack_code::gen(const struct_header *header,
 			     const struct_data *data,dumper &d,uint32 type,
 			     match_end_info *mei)
@@ -751,7 +937,8 @@ void struct_unpack_code::gen(const struct_header *header,
 
   switch (data->_size)
     {
-    case 64: data_type = "uint64 "; full_name = "u64"; break;
+    case 64: data_type = "uint64 "; full_name = "u64";
+      _unpack_has_data64 = true; break;
     case 32: data_type = "uint32 "; full_name = "u32"; break;
     case 16: data_type = "uint16 "; full_name = "u16"; break;
     case 8:  data_type = "uint8  "; full_name = "u8"; break;
@@ -785,6 +972,18 @@ void struct_unpack_code::gen(const struct_header *header,
       // prefix = "__"; // TODO: remove comment, implement variable tracker
     }
 
+  int bulk_account_id = -1;
+  uint32 bulk_mask, bulk_value;
+
+  if ((type & UCT_UNPACK) &&
+      (data->_flags & SD_FLAGS_SEVERAL) &&
+      several_bulk_bits(data,&bulk_mask,&bulk_value))
+    {
+      bulk_account_id = new_account_item(header->_name, data->_ident);
+      gen_several_bulk(data,d,type,data_type,full_name,
+		       bulk_account_id,bulk_mask,bulk_value);
+    }
+
   if ((type & UCT_UNPACK) &&
       (data->_flags & SD_FLAGS_SEVERAL))
     d.text("for ( ; ; ) {\n");
@@ -869,73 +1068,7 @@ void struct_unpack_code::gen(const struct_header *header,
 
   if (do_declare)
     {
-      d.text("union\n");
-      d.text("{\n");
-      dumper sd(d,2);
-      // Now dump the bitfields
-      sd.text("struct\n");
-      sd.text("{\n");
-      dumper ssd(sd,2);
-      // We need to eject the bitfield in two directions, for little and
-      // big endian machines...
-
-#define BITFIELD_DUMMY(d,data_type,first,last) { \
-  (d).text(data_type);    \
-  if ((first) == (last))  \
-    (d).text_fmt("dummy_%d : 1;\n",(first)); \
-  else                                       \
-    (d).text_fmt("dummy_%d_%d : %d;\n",(first),(last),(last)-(first)+1); \
-}
-#define BITFIELD_NAMED(d,data_type,b) { \
-  (d).text(data_type);     \
-  if ((b)->_name)          \
-    (d).text((b)->_name);  \
-  else                     \
-    (d).text_fmt("unnamed_%d_%d",(b)->_min,(b)->_max); \
-  if ((b)->_min == (b)->_max)                          \
-    (d).text_fmt(" : 1; // %d\n",(b)->_min);           \
-  else                                                 \
-    (d).text_fmt(" : %d; // %d..%d\n",(b)->_max - (b)->_min + 1,(b)->_min,(b)->_max); \
-}
-
-      {
-	ssd.col0_text("#if __BYTE_ORDER == __LITTLE_ENDIAN\n");
-	bits_spec_list::const_iterator i;
-	int next_bit = 0;
-	for (i = data->_bits->begin(); i != data->_bits->end(); ++i)
-	  {
-	    bits_spec *b = *i;
-	    if (b->_min > next_bit)
-	      BITFIELD_DUMMY(ssd,data_type,next_bit,b->_min-1);
-
-	    BITFIELD_NAMED(ssd,data_type,b);
-	    next_bit = b->_max+1;
-	  }
-	if (data->_size > next_bit)
-	  BITFIELD_DUMMY(ssd,data_type,next_bit,data->_size-1);
-	ssd.col0_text("#endif\n");
-      }
-      {
-	ssd.col0_text("#if __BYTE_ORDER == __BIG_ENDIAN\n");
-	bits_spec_list::const_reverse_iterator ri;
-	int last_bit = data->_size-1;
-	for (ri = data->_bits->rbegin(); ri != data->_bits->rend(); ++ri)
-	  {
-	    bits_spec *b = *ri;
-	    if (b->_max < last_bit)
-	      BITFIELD_DUMMY(ssd,data_type,b->_max+1,last_bit);
-
-	    BITFIELD_NAMED(ssd,data_type,b);
-	    last_bit = b->_min-1;
-	  }
-	if (last_bit > 0)
-	  BITFIELD_DUMMY(ssd,data_type,0,last_bit);
-	ssd.col0_text("#endif\n");
-      }
-      sd.text("};\n"); // unnamed structure (gcc extension)
-      // The dump the full value
-      sd.text_fmt("%s %s;\n",data_type,full_name);
-      d.text_fmt("} %s%s;",prefix,data->_ident);
+      gen_bits_union(d,data,data_type,full_name,prefix);
       if (!(type & UCT_HEADER))
 	d.nl();
     }
@@ -961,7 +1094,7 @@ void struct_unpack_code::gen(const struct_header *header,
 
       // First we need to get the data from the buffer
 
-      int account_id =
+      int account_id = bulk_account_id != -1 ? bulk_account_id :
 	new_account_item(header->_name, data->_ident);
 
       d.text_fmt("%s%s_FROM_BUFFER_FULL(%d,%s,%s,%s%s.%s,%d);\n",
@@ -1326,6 +1459,7 @@ void struct_unpack_code::gen_match(const file_line &loc,
 	  if (items->size())
 	    d.text(" __visited.clear();");
 	  d.text(" }\n");
+	  d.text("  subevent_match_cache __match_cache;\n");
 	  d.text_fmt("  bool ignore_unknown_subevent() { return %s; }\n",
 		 event_opts & EVENT_OPTS_IGNORE_UNKNOWN_SUBEVENT ? "true" : "false");	  d.col0_text("#endif//!__PSDC__\n");
   	}
@@ -1430,11 +1564,27 @@ void struct_unpack_code::gen_match(const file_line &loc,
 
       if (normal_match)
       {
-	struct_decl_list::const_iterator i;
-	int index = 1;
-	for (i = items->begin(); i != items->end(); ++i, ++index)
+	// The subevent match only depends on the header, so is cached.
+	if (subevent)
 	  {
-	    struct_decl *decl = *i;
+	    sd.text("SUBEVENT_MATCH_CACHE_LOOKUP(__match_no)\n");
+	    sd.text("{\n");
+	  }
+	dumper msd(sd,subevent ? 2 : 0);
+
+	// With a match profile, the most frequent candidates come first.
+
+	std::vector<match_order_item> order;
+
+	match_order(items,order,!subevent);
+
+	static int match_found_label_counter = 0;
+	bool match_found_label = false;
+
+	for (size_t k = 0; k < order.size(); k++)
+	  {
+	    const struct_decl *decl = order[k]._decl;
+	    int index = order[k]._index;
 
 	    if (decl->is_event_opt())
 	      continue;
@@ -1443,25 +1593,44 @@ void struct_unpack_code::gen_match(const file_line &loc,
 
 	    if (subevent)
 	      {
-		sd.text_fmt("MATCH_SUBEVENT_DECL(%d,__match_no,%d,(",
-			    decl->_loc._internal,index);
-		dump_match_args(decl->_loc,subevent_cond_params,decl->_args,sd);
-		sd.text("),");
-		decl->_name->dump(sd);
-		// dump_param_args(decl->_loc,named_header->_params,decl->_args,sd);
-		sd.text(");\n");
+		msd.text_fmt("MATCH_SUBEVENT_DECL(%d,__match_no,%d,(",
+			     decl->_loc._internal,index);
+		dump_match_args(decl->_loc,subevent_cond_params,decl->_args,msd);
+		msd.text("),");
+		decl->_name->dump(msd);
+		// dump_param_args(decl->_loc,named_header->_params,decl->_args,msd);
+		msd.text(");\n");
 	      }
 	    else
 	      {
-		sd.text_fmt("MATCH_DECL(%d,__match_no,%d,",
-			    decl->_loc._internal,index);
-		sd.text(decl->_ident);
-		sd.text(",");
-		decl->_name->dump(sd);
-		dump_param_args(decl->_loc,named_header->_params,decl->_args,sd,false);
-		sd.text(");\n");
+		if (have_match_profile())
+		  msd.text_fmt("// match profile: %llu%s\n",
+			       (unsigned long long) order[k]._count,
+			       order[k]._exclusive ? " (exclusive)" : "");
+		msd.text_fmt("MATCH_DECL(%d,__match_no,%d,",
+			     decl->_loc._internal,index);
+		msd.text(decl->_ident);
+		msd.text(",");
+		decl->_name->dump(msd);
+		dump_param_args(decl->_loc,named_header->_params,decl->_args,msd,false);
+		msd.text(");\n");
+		if (order[k]._exclusive && k + 1 < order.size())
+		  {
+		    // Only our own match ends the search, else a
+		    // double match would go unnoticed.
+		    msd.text_fmt("if (__match_no == %d) goto match_found_%d;\n",
+				 index,match_found_label_counter);
+		    match_found_label = true;
+		  }
 	      }
 	  }
+	if (match_found_label)
+	  msd.text_fmt("match_found_%d:;\n",match_found_label_counter++);
+	if (subevent)
+	  {
+	    msd.text("SUBEVENT_MATCH_CACHE_STORE(__match_no);\n");
+	    sd.text("}\n");
+	  }
       }
       {
 	// If we are running with several, then we may at any time run out of matches...
@@ -1546,6 +1715,8 @@ void struct_unpack_code::gen_match(const file_line &loc,
 				      check_visit_counter,index_check_visit++);
 		      }
 
+		    if (type & UCT_UNPACK)
+		      gen_match_profile_count(decl,sssd);
 		    gen_unpack_decl(decl,"UNPACK_DECL",sssd,true);
 		  }
 		sssd.text("break;\n");
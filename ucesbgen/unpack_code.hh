@@ -71,6 +71,15 @@ struct match_info
   int         _index; // TODO: to go
 };
 
+struct match_order_item
+{
+  const struct_decl *_decl;
+  int         _index;
+
+  uint64      _count;     // from match profile
+  bool        _exclusive; // no other candidate can match when this does
+};
+
 struct match_end_info
 {
   bool        _has_explicit_end;
@@ -116,6 +125,9 @@ public:
   void gen(const struct_header *header,
 	   const struct_data   *data,   dumper &d,uint32 type,
 	   match_end_info *mei);
+  void gen_several_bulk(const struct_data *data,dumper &d,uint32 type,
+			const char *data_type,const char *full_name,
+			int account_id,uint32 mask,uint32 value);
   void gen(indexed_decl_map &indexed_decl,
 	   const struct_decl   *decl,   dumper &d,uint32 type,
 	   match_end_info *mei);
@@ -143,6 +155,10 @@ public:
 		 bool sticky,
 		 int flags);
 
+  void match_order(const struct_decl_list *items,
+		   std::vector<match_order_item> &order,
+		   bool use_profile);
+
   bool gen_optimized_match(const file_line &loc,
 			   const struct_decl_list *items,
 			   dumper &d,
@@ -184,6 +200,7 @@ protected:
 		       dumper &d,bool dump_member_args);
   void gen_check_spurios_match(const struct_decl *decl,dumper &d,
 			       const char *abort_spurious_label);
+  void gen_match_profile_count(const struct_decl *decl,dumper &d);
 
 };
 
@@ -191,7 +208,12 @@ const struct_header_named *find_decl(const struct_decl* decl,bool subevent);
 
 void generate_unpack_code(struct_definition *structure);
 void generate_unpack_code(event_definition *event);
+void generate_unpack_defines();
 
 void gen_subevent_names(const event_definition *evt,dumper &d);
 
+void read_match_profile(const char *filename);
+bool have_match_profile();
+uint64 match_profile_count(const struct_decl *decl);
+
 #endif//__UNPACK_CODE_HH__
@@ -0,0 +1,22 @@
+/* Calibration validity intervals, for the xtst_regress_calib_valid
+ * regression test.  Short and long decimal and hex bounds, with
+ * leading zeros, and an open end.
+ */
+
+CALIB_PARAM(PIN2_E,SLOPE_OFFSET,1.0,0.0);
+
+CALIB_VALID(EVENT, 0000000003, 0x00000004) {
+  CALIB_PARAM(PIN2_E,SLOPE_OFFSET,0.0,1000.0);
+}
+
+CALIB_VALID(EVENT, 6, *) {
+  CALIB_PARAM(PIN2_E,SLOPE_OFFSET,0.0,2000.0);
+}
+
+CALIB_VALID(EVENT, 7, 7) {
+  CALIB_PARAM(PIN2_E,SLOPE_OFFSET,0.0,3000.0);
+}
+
+CALIB_VALID(WR, 17179853453, 0x3fffFCB38) {
+  CALIB_PARAM(PIN2_E,SLOPE_OFFSET,0.0,4000.0);
+}
@@ -16,3 +16,23 @@ CALIB_PARAM(N10_16_1_T,SLOPE_OFFSET,50. ps/ch,0.5 s*kg/kg);
 CALIB_PARAM(N10_16_2_T,OFFSET_SLOPE,0.5 ch, 1.e-8 s/ch);
 
 #endif
+
+#ifdef UNPACKER_IS_xtst_toggle
+
+// Not randomized, such that the values do not depend on the order
+// of processing.
+
+CALIB_PARAM(MOD2_1_T,CUT_BELOW_OE,0);
+CALIB_PARAM(MOD2_2_T,CUT_BELOW_OE,500);
+CALIB_PARAM(MOD2_3_T,CUT_BELOW_OE,1000);
+CALIB_PARAM(MOD2_4_T,CUT_BELOW_OE,1500);
+CALIB_PARAM(MOD2_5_T,CUT_BELOW_OE,2000);
+CALIB_PARAM(MOD2_6_T,CUT_BELOW_OE,2500);
+CALIB_PARAM(MOD2_7_T,CUT_BELOW_OE,3000);
+CALIB_PARAM(MOD2_8_T,CUT_BELOW_OE,3500);
+CALIB_PARAM(MOD2_17_T,CUT_BELOW_OE,0);
+CALIB_PARAM(MOD2_18_T,CUT_BELOW_OE,1000);
+CALIB_PARAM(MOD2_19_T,CUT_BELOW_OE,2000);
+CALIB_PARAM(MOD2_20_T,CUT_BELOW_OE,3000);
+
+#endif
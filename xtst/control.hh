@@ -31,6 +31,8 @@
 
 #define RAW_EVENT_USER_FUNCTION       raw_user_function
 
+#define USER_FUNCTIONS_MARK_DIRTY     1
+
 #define USING_TSTAMP 1
 
 #endif//UNPACKER_IS_xtst
@@ -0,0 +1,129 @@
+/** BEGIN_ACCOUNT_IDS **************************************************
+ *
+ * Structure and identifier for raw data items.
+ *
+ * Do not edit - automatically generated.
+ */
+
+account_id _account_ids[] =
+{ 
+  { 0, "CAMAC_LECROY_4434", "ch_data" },
+  { 1, "CAMAC_LECROY_4434", "ch_data" },
+  { 2, "CAMAC_PHILLIPS_7164", "ch_data" },
+  { 3, "CAMAC_PHILLIPS_7164", "ch_data" },
+  { 4, "CAMAC_PHILLIPS_7164", "ch_data" },
+  { 5, "CAMAC_PHILLIPS_7164", "ch_data" },
+  { 6, "CAMAC_SILENA_4418", "ch_data" },
+  { 7, "CAMAC_SILENA_4418", "ch_data" },
+  { 8, "CAMAC_SILENA_4418", "ch_data" },
+  { 9, "CAMAC_SILENA_4418", "ch_data" },
+  { 10, "FASTBUS_LECROY_1875", "ch_data" },
+  { 11, "FASTBUS_LECROY_1875", "ch_data" },
+  { 12, "FASTBUS_LECROY_1885", "ch_data" },
+  { 13, "FASTBUS_LECROY_1885", "ch_data" },
+  { 14, "ITEM64", "a" },
+  { 15, "ITEM64", "b" },
+  { 16, "ITEM64", "c" },
+  { 17, "ITEM64", "a" },
+  { 18, "ITEMQ", "w1" },
+  { 19, "ITEMQ", "w2" },
+  { 20, "ITEMQ", "w1" },
+  { 21, "ITEM_ME2", "padding" },
+  { 22, "ITEM_ME2", "header" },
+  { 23, "ITEM_ME2", "data" },
+  { 24, "ITEM_ME2", "padding" },
+  { 25, "ITEM_ME2", "header" },
+  { 26, "MADC32", "header" },
+  { 27, "MADC32", "madc32_data0" },
+  { 28, "MADC32", "madc32_data1" },
+  { 29, "MADC32", "madc32_data3" },
+  { 30, "MADC32", "trailer" },
+  { 31, "MADC32", "header" },
+  { 32, "SINGLE_DATA_MODULE", "data" },
+  { 33, "SINGLE_DATA_MODULE", "data" },
+  { 34, "STICKY_ACTIVE", "separator" },
+  { 35, "STICKY_ACTIVE", "active" },
+  { 36, "STICKY_ACTIVE", "mark" },
+  { 37, "STICKY_ACTIVE", "corr" },
+  { 38, "STICKY_ACTIVE", "separator" },
+  { 39, "VME_CAEN_V1190_SUBTDC", "header" },
+  { 40, "VME_CAEN_V1190_SUBTDC", "ch_data" },
+  { 41, "VME_CAEN_V1190_SUBTDC", "error_flags" },
+  { 42, "VME_CAEN_V1190_SUBTDC", "trailer" },
+  { 43, "VME_CAEN_V1190_SUBTDC", "header" },
+  { 44, "VME_CAEN_V1190", "header" },
+  { 45, "VME_CAEN_V1190", "trigger" },
+  { 46, "VME_CAEN_V1190", "trailer" },
+  { 47, "VME_CAEN_V1190", "header" },
+  { 48, "VME_CAEN_V1190_SHORT_SUBTDC", "ch_data" },
+  { 49, "VME_CAEN_V1190_SHORT_SUBTDC", "ch_data" },
+  { 50, "VME_CAEN_V1190_SHORT_SUBTDC_ERROR", "error_flags" },
+  { 51, "VME_CAEN_V1190_SHORT_SUBTDC_ERROR", "error_flags" },
+  { 52, "VME_CAEN_V1190_SHORT", "header" },
+  { 53, "VME_CAEN_V1190_SHORT", "trigger" },
+  { 54, "VME_CAEN_V1190_SHORT", "trailer" },
+  { 55, "VME_CAEN_V1190_SHORT", "header" },
+  { 56, "VME_CAEN_V1290_SUBTDC", "header" },
+  { 57, "VME_CAEN_V1290_SUBTDC", "ch_data" },
+  { 58, "VME_CAEN_V1290_SUBTDC", "error_flags" },
+  { 59, "VME_CAEN_V1290_SUBTDC", "trailer" },
+  { 60, "VME_CAEN_V1290_SUBTDC", "header" },
+  { 61, "VME_CAEN_V1290", "header" },
+  { 62, "VME_CAEN_V1290", "trigger" },
+  { 63, "VME_CAEN_V1290", "trailer" },
+  { 64, "VME_CAEN_V1290", "header" },
+  { 65, "VME_CAEN_V1290_SHORT_SUBTDC", "ch_data" },
+  { 66, "VME_CAEN_V1290_SHORT_SUBTDC", "ch_data" },
+  { 67, "VME_CAEN_V1290_SHORT_SUBTDC_ERROR", "error_flags" },
+  { 68, "VME_CAEN_V1290_SHORT_SUBTDC_ERROR", "error_flags" },
+  { 69, "VME_CAEN_V1290_SHORT", "header" },
+  { 70, "VME_CAEN_V1290_SHORT", "trigger" },
+  { 71, "VME_CAEN_V1290_SHORT", "trailer" },
+  { 72, "VME_CAEN_V1290_SHORT", "header" },
+  { 73, "VME_CAEN_V775", "header" },
+  { 74, "VME_CAEN_V775", "ch_data" },
+  { 75, "VME_CAEN_V775", "eob" },
+  { 76, "VME_CAEN_V775", "header" },
+  { 77, "VME_CAEN_V830", "header" },
+  { 78, "VME_CAEN_V830", "ch_data" },
+  { 79, "VME_CAEN_V830", "header" },
+  { 80, "VME_MESYTEC_MADC32", "header" },
+  { 81, "VME_MESYTEC_MADC32", "ch_data" },
+  { 82, "VME_MESYTEC_MADC32", "filler" },
+  { 83, "VME_MESYTEC_MADC32", "end_of_event" },
+  { 84, "VME_MESYTEC_MADC32", "header" },
+  { 85, "VME_MESYTEC_MDPP16", "header" },
+  { 86, "VME_MESYTEC_MDPP16", "ch_data" },
+  { 87, "VME_MESYTEC_MDPP16", "fill_word" },
+  { 88, "VME_MESYTEC_MDPP16", "end_of_event" },
+  { 89, "VME_MESYTEC_MDPP16", "header" },
+  { 90, "WR_STAMP", "header" },
+  { 91, "WR_STAMP", "data0" },
+  { 92, "WR_STAMP", "data1" },
+  { 93, "WR_STAMP", "data2" },
+  { 94, "WR_STAMP", "data3" },
+  { 95, "WR_STAMP", "header" },
+  { 96, "XTST_STD_VME", "failure" },
+  { 97, "XTST_STD_VME", "time_stamp" },
+  { 98, "XTST_STD_VME", "multi_events" },
+  { 99, "XTST_STD_VME", "multi_scaler_counter0" },
+  { 100, "XTST_STD_VME", "multi_adctdc_counter0" },
+  { 101, "XTST_STD_VME", "failure" },
+  { 102, "BITS64", "data32_1" },
+  { 103, "BITS64", "data32_2" },
+  { 104, "BITS64", "data64_1" },
+  { 105, "XTST_MDPP16", "align" },
+  { 106, "XTST_MDPP16", "pad" },
+  { 107, "XTST_PLAIN", "u" },
+  { 108, "XTST_PLAIN", "s" },
+  { 109, "XTST_PLAIN", "c" },
+  { 110, "XTST_REGRESS", "separator1" },
+  { 111, "XTST_REGRESS", "seed" },
+  { 112, "XTST_REGRESS", "separator2" },
+  { 113, "XTST_REGRESSEXTRA", "junk" },
+  { 114, "XTST_STICKY_CORR", "base" },
+};
+
+#define NUM_ACCOUNT_IDS  115
+
+/** END_ACCOUNT_IDS ***************************************************/
@@ -0,0 +1,187 @@
+/** BEGIN_FUNCTION_CALL_PER_MEMBER *************************************
+ *
+ * Recursive function calls per member.
+ *
+ * Do not edit - automatically generated.
+ */
+
+#include "gen/default_fcncall_define.hh"
+
+#ifndef USER_DEF_cal_event_POS
+FCNCALL_TEMPLATE
+FCNCALL_RET_TYPE FCNCALL_CLASS_NAME(cal_event_POS)::FCNCALL_NAME(cal_event_POS)
+{
+  FCNCALL_INIT;
+  // float E;
+  {
+  FCNCALL_SUBNAME("E");
+  { FCNCALL_CALL_CTRL_WRAP(E,FCNCALL_CALL_TYPE(float,E)); }
+  FCNCALL_SUBNAME_END;
+  }
+  FCNCALL_RET;
+}
+#endif//USER_DEF_cal_event_POS
+
+#ifndef USER_DEF_cal_event_PIN
+FCNCALL_TEMPLATE
+FCNCALL_RET_TYPE FCNCALL_CLASS_NAME(cal_event_PIN)::FCNCALL_NAME(cal_event_PIN)
+{
+  FCNCALL_INIT;
+  // float E;
+  {
+  FCNCALL_SUBNAME("E");
+  { FCNCALL_CALL_CTRL_WRAP(E,FCNCALL_CALL_TYPE(float,E)); }
+  FCNCALL_SUBNAME_END;
+  }
+  FCNCALL_RET;
+}
+#endif//USER_DEF_cal_event_PIN
+
+#ifndef USER_DEF_cal_event_N
+FCNCALL_TEMPLATE
+FCNCALL_RET_TYPE FCNCALL_CLASS_NAME(cal_event_N)::FCNCALL_NAME(cal_event_N)
+{
+  FCNCALL_INIT;
+  // float T UNIT("#ns");
+  {
+  FCNCALL_SUBNAME("T");
+  FCNCALL_UNIT("#ns");
+  { FCNCALL_CALL_CTRL_WRAP(T,FCNCALL_CALL_TYPE(float,T)); }
+  FCNCALL_SUBNAME_END;
+  }
+  FCNCALL_RET;
+}
+#endif//USER_DEF_cal_event_N
+
+#ifndef USER_DEF_cal_event_TGL
+FCNCALL_TEMPLATE
+FCNCALL_RET_TYPE FCNCALL_CLASS_NAME(cal_event_TGL)::FCNCALL_NAME(cal_event_TGL)
+{
+  FCNCALL_INIT;
+  // raw_list_zero_suppress<float,float,3> F;
+  {
+  FCNCALL_SUBNAME("F");
+  { FCNCALL_CALL_CTRL_WRAP(F,F.FCNCALL_CALL(F)); }
+  FCNCALL_SUBNAME_END;
+  }
+  FCNCALL_RET;
+}
+#endif//USER_DEF_cal_event_TGL
+
+#ifndef USER_DEF_cal_event_ZZP
+FCNCALL_TEMPLATE
+FCNCALL_RET_TYPE FCNCALL_CLASS_NAME(cal_event_ZZP)::FCNCALL_NAME(cal_event_ZZP)
+{
+  FCNCALL_INIT;
+  // raw_list_zero_suppress<float,float,10> F;
+  {
+  FCNCALL_SUBNAME("F");
+  { FCNCALL_CALL_CTRL_WRAP(F,F.FCNCALL_CALL(F)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // raw_list_zero_suppress<double,double,10> D;
+  {
+  FCNCALL_SUBNAME("D");
+  { FCNCALL_CALL_CTRL_WRAP(D,D.FCNCALL_CALL(D)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // raw_list_zero_suppress<uint32,uint32,10> U;
+  {
+  FCNCALL_SUBNAME("U");
+  { FCNCALL_CALL_CTRL_WRAP(U,U.FCNCALL_CALL(U)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // raw_list_zero_suppress<uint64,uint64,10> L;
+  {
+  FCNCALL_SUBNAME("L");
+  { FCNCALL_CALL_CTRL_WRAP(L,L.FCNCALL_CALL(L)); }
+  FCNCALL_SUBNAME_END;
+  }
+  FCNCALL_RET;
+}
+#endif//USER_DEF_cal_event_ZZP
+
+#ifndef USER_DEF_cal_event
+FCNCALL_TEMPLATE
+FCNCALL_RET_TYPE FCNCALL_CLASS_NAME(cal_event)::FCNCALL_NAME(cal_event)
+{
+  FCNCALL_INIT;
+  FCNCALL_CALL_CTRL_WRAP(cal_event_base,FCNCALL_CLASS_NAME(cal_event_base)::FCNCALL_CALL_BASE());
+  // cal_event_POS POS[2][4];
+  {
+  FCNCALL_SUBNAME("POS");
+  FCNCALL_FOR(__i0,2)
+  {
+    FCNCALL_SUBINDEX(__i0);
+    FCNCALL_FOR(__i1,4)
+    {
+      FCNCALL_SUBINDEX(__i1);
+      { FCNCALL_CALL_CTRL_WRAP_ARRAY(POS__i0__i1,[__i0],__i1,POS[__i0][__i1].FCNCALL_CALL(POS[__i0][__i1])); }
+      FCNCALL_SUBINDEX_END(__i1);
+    }
+    FCNCALL_SUBINDEX_END(__i0);
+  }
+  FCNCALL_SUBNAME_END;
+  }
+  // cal_event_PIN PIN[2];
+  {
+  FCNCALL_SUBNAME("PIN");
+  FCNCALL_FOR(__i0,2)
+  {
+    FCNCALL_SUBINDEX(__i0);
+    { FCNCALL_CALL_CTRL_WRAP_ARRAY(PIN__i0,,__i0,PIN[__i0].FCNCALL_CALL(PIN[__i0])); }
+    FCNCALL_SUBINDEX_END(__i0);
+  }
+  FCNCALL_SUBNAME_END;
+  }
+  // raw_list_zero_suppress_1<cal_event_N,cal_event_N[2],20,2> N[10];
+  {
+  FCNCALL_SUBNAME("N");
+  FCNCALL_FOR(__i0,10)
+  {
+    FCNCALL_SUBINDEX(__i0);
+    { FCNCALL_CALL_CTRL_WRAP_ARRAY(N__i0,,__i0,N[__i0].FCNCALL_CALL(N[__i0])); }
+    FCNCALL_SUBINDEX_END(__i0);
+  }
+  FCNCALL_SUBNAME_END;
+  }
+  // cal_event_TGL TGL[1][1];
+  {
+  FCNCALL_SUBNAME("TGL");
+  FCNCALL_FOR(__i0,1)
+  {
+    FCNCALL_SUBINDEX(__i0);
+    FCNCALL_FOR(__i1,1)
+    {
+      FCNCALL_SUBINDEX(__i1);
+      { FCNCALL_CALL_CTRL_WRAP_ARRAY(TGL__i0__i1,[__i0],__i1,TGL[__i0][__i1].FCNCALL_CALL(TGL[__i0][__i1])); }
+      FCNCALL_SUBINDEX_END(__i1);
+    }
+    FCNCALL_SUBINDEX_END(__i0);
+  }
+  FCNCALL_SUBNAME_END;
+  }
+  // cal_event_ZZP ZZP[1][1];
+  {
+  FCNCALL_SUBNAME("ZZP");
+  FCNCALL_FOR(__i0,1)
+  {
+    FCNCALL_SUBINDEX(__i0);
+    FCNCALL_FOR(__i1,1)
+    {
+      FCNCALL_SUBINDEX(__i1);
+      { FCNCALL_CALL_CTRL_WRAP_ARRAY(ZZP__i0__i1,[__i0],__i1,ZZP[__i0][__i1].FCNCALL_CALL(ZZP[__i0][__i1])); }
+      FCNCALL_SUBINDEX_END(__i1);
+    }
+    FCNCALL_SUBINDEX_END(__i0);
+  }
+  FCNCALL_SUBNAME_END;
+  }
+  FCNCALL_RET;
+}
+#endif//USER_DEF_cal_event
+
+#include "gen/default_fcncall_undef.hh"
+
+
+/** END_FUNCTION_CALL_PER_MEMBER **************************************/
@@ -0,0 +1,102 @@
+/** BEGIN_MIRROR_STRUCT ************************************************
+ *
+ * Mirror (1 to 1) structure.
+ *
+ * Do not edit - automatically generated.
+ */
+
+#include "gen/default_mirror_define.hh"
+
+#ifndef USER_DEF_cal_event_POS
+STRUCT_MIRROR_TEMPLATE
+class STRUCT_MIRROR_STRUCT(cal_event_POS)
+{
+public:
+  STRUCT_MIRROR_ITEM_CTRL(E);
+  STRUCT_MIRROR_TYPE(float) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(E);
+  STRUCT_MIRROR_FCNS_DECL(cal_event_POS);
+};
+#endif//USER_DEF_cal_event_POS
+
+#ifndef USER_DEF_cal_event_PIN
+STRUCT_MIRROR_TEMPLATE
+class STRUCT_MIRROR_STRUCT(cal_event_PIN)
+{
+public:
+  STRUCT_MIRROR_ITEM_CTRL(E);
+  STRUCT_MIRROR_TYPE(float) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(E);
+  STRUCT_MIRROR_FCNS_DECL(cal_event_PIN);
+};
+#endif//USER_DEF_cal_event_PIN
+
+#ifndef USER_DEF_cal_event_N
+STRUCT_MIRROR_TEMPLATE
+class STRUCT_MIRROR_STRUCT(cal_event_N)
+{
+public:
+  STRUCT_MIRROR_ITEM_CTRL(T);
+  STRUCT_MIRROR_TYPE(float) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(T);
+  STRUCT_MIRROR_FCNS_DECL(cal_event_N);
+};
+#endif//USER_DEF_cal_event_N
+
+#ifndef USER_DEF_cal_event_TGL
+STRUCT_MIRROR_TEMPLATE
+class STRUCT_MIRROR_STRUCT(cal_event_TGL)
+{
+public:
+  STRUCT_MIRROR_ITEM_CTRL(F);
+  STRUCT_MIRROR_TYPE(raw_list_zero_suppress) < STRUCT_MIRROR_TYPE_TEMPLATE STRUCT_MIRROR_TEMPLATE_ARG(float),STRUCT_MIRROR_TEMPLATE_ARG(float),3> STRUCT_MIRROR_NAME(F);
+  STRUCT_MIRROR_FCNS_DECL(cal_event_TGL);
+};
+#endif//USER_DEF_cal_event_TGL
+
+#ifndef USER_DEF_cal_event_ZZP
+STRUCT_MIRROR_TEMPLATE
+class STRUCT_MIRROR_STRUCT(cal_event_ZZP)
+{
+public:
+  STRUCT_MIRROR_ITEM_CTRL(F);
+  STRUCT_MIRROR_TYPE(raw_list_zero_suppress) < STRUCT_MIRROR_TYPE_TEMPLATE STRUCT_MIRROR_TEMPLATE_ARG(float),STRUCT_MIRROR_TEMPLATE_ARG(float),10> STRUCT_MIRROR_NAME(F);
+  STRUCT_MIRROR_ITEM_CTRL(D);
+  STRUCT_MIRROR_TYPE(raw_list_zero_suppress) < STRUCT_MIRROR_TYPE_TEMPLATE STRUCT_MIRROR_TEMPLATE_ARG(double),STRUCT_MIRROR_TEMPLATE_ARG(double),10> STRUCT_MIRROR_NAME(D);
+  STRUCT_MIRROR_ITEM_CTRL(U);
+  STRUCT_MIRROR_TYPE(raw_list_zero_suppress) < STRUCT_MIRROR_TYPE_TEMPLATE STRUCT_MIRROR_TEMPLATE_ARG(uint32),STRUCT_MIRROR_TEMPLATE_ARG(uint32),10> STRUCT_MIRROR_NAME(U);
+  STRUCT_MIRROR_ITEM_CTRL(L);
+  STRUCT_MIRROR_TYPE(raw_list_zero_suppress) < STRUCT_MIRROR_TYPE_TEMPLATE STRUCT_MIRROR_TEMPLATE_ARG(uint64),STRUCT_MIRROR_TEMPLATE_ARG(uint64),10> STRUCT_MIRROR_NAME(L);
+  STRUCT_MIRROR_FCNS_DECL(cal_event_ZZP);
+};
+#endif//USER_DEF_cal_event_ZZP
+
+#ifndef USER_DEF_cal_event
+STRUCT_MIRROR_TEMPLATE
+class STRUCT_MIRROR_STRUCT(cal_event) : public STRUCT_MIRROR_BASE(cal_event_base)
+{
+public:
+  STRUCT_MIRROR_ITEM_CTRL_BASE(cal_event_base);
+  STRUCT_MIRROR_ITEM_CTRL(POS);
+  STRUCT_MIRROR_ITEM_CTRL_ARRAY(POS__i0,,2);
+  STRUCT_MIRROR_ITEM_CTRL_ARRAY(POS__i0__i1,[2],4);
+  STRUCT_MIRROR_TYPE(cal_event_POS) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(POS[2][4]);
+  STRUCT_MIRROR_ITEM_CTRL(PIN);
+  STRUCT_MIRROR_ITEM_CTRL_ARRAY(PIN__i0,,2);
+  STRUCT_MIRROR_TYPE(cal_event_PIN) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(PIN[2]);
+  STRUCT_MIRROR_ITEM_CTRL(N);
+  STRUCT_MIRROR_ITEM_CTRL_ARRAY(N__i0,,10);
+  STRUCT_MIRROR_TYPE(raw_list_zero_suppress_1) < STRUCT_MIRROR_TYPE_TEMPLATE STRUCT_MIRROR_TEMPLATE_ARG(cal_event_N),STRUCT_MIRROR_TEMPLATE_ARG_N(cal_event_N,[2]),20,2> STRUCT_MIRROR_NAME(N[10]);
+  STRUCT_MIRROR_ITEM_CTRL(TGL);
+  STRUCT_MIRROR_ITEM_CTRL_ARRAY(TGL__i0,,1);
+  STRUCT_MIRROR_ITEM_CTRL_ARRAY(TGL__i0__i1,[1],1);
+  STRUCT_MIRROR_TYPE(cal_event_TGL) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(TGL[1][1]);
+  STRUCT_MIRROR_ITEM_CTRL(ZZP);
+  STRUCT_MIRROR_ITEM_CTRL_ARRAY(ZZP__i0,,1);
+  STRUCT_MIRROR_ITEM_CTRL_ARRAY(ZZP__i0__i1,[1],1);
+  STRUCT_MIRROR_TYPE(cal_event_ZZP) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(ZZP[1][1]);
+  STRUCT_MIRROR_FCNS_DECL(cal_event);
+};
+#endif//USER_DEF_cal_event
+
+#include "gen/default_mirror_undef.hh"
+
+
+/** END_MIRROR_STRUCT *************************************************/
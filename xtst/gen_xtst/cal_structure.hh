@@ -0,0 +1,134 @@
+/** BEGIN_EVENT_CAL_STRUCTURE ******************************************
+ *
+ * Event data structure.
+ *
+ * Do not edit - automatically generated.
+ */
+
+//DUMPY: 2 0
+//DUMPY: 4 0
+class cal_event_POS
+{
+public:
+  float E;
+
+public:
+#ifndef __PSDC__
+  STRUCT_FCNS_DECL(cal_event_POS);
+#endif//!__PSDC__
+} ;
+
+//DUMPY: 2 0
+class cal_event_PIN
+{
+public:
+  float E;
+
+public:
+#ifndef __PSDC__
+  STRUCT_FCNS_DECL(cal_event_PIN);
+#endif//!__PSDC__
+} ;
+
+//DUMPY: 10 0
+//DUMPY: 20 1
+//DUMPY: 2 0
+class cal_event_N
+{
+public:
+  float T UNIT("#ns");
+
+public:
+#ifndef __PSDC__
+  STRUCT_FCNS_DECL(cal_event_N);
+#endif//!__PSDC__
+} ;
+
+//DUMPY: 1 0
+//DUMPY: 1 0
+class cal_event_TGL
+{
+public:
+//DUMPY: 3 1
+  raw_list_zero_suppress<float,float,3> F;
+
+public:
+#ifndef __PSDC__
+  STRUCT_FCNS_DECL(cal_event_TGL);
+#endif//!__PSDC__
+} ;
+
+//DUMPY: 1 0
+//DUMPY: 1 0
+class cal_event_ZZP
+{
+public:
+//DUMPY: 10 1
+  raw_list_zero_suppress<float,float,10> F;
+//DUMPY: 10 1
+  raw_list_zero_suppress<double,double,10> D;
+//DUMPY: 10 1
+  raw_list_zero_suppress<uint32,uint32,10> U;
+//DUMPY: 10 1
+  raw_list_zero_suppress<uint64,uint64,10> L;
+
+public:
+#ifndef __PSDC__
+  STRUCT_FCNS_DECL(cal_event_ZZP);
+#endif//!__PSDC__
+} ;
+
+class cal_event : public cal_event_base
+{
+public:
+//DUMPY: 2 0
+//DUMPY: 4 0
+  cal_event_POS
+  /* {
+  public:
+    float E;
+  } */ POS[2][4];
+//DUMPY: 2 0
+  cal_event_PIN
+  /* {
+  public:
+    float E;
+  } */ PIN[2];
+//DUMPY: 10 0
+//DUMPY: 20 1
+//DUMPY: 2 0
+  raw_list_zero_suppress_1<cal_event_N,cal_event_N[2],20,2>
+  /* {
+  public:
+    float T UNIT("#ns");
+  } */ N[10];
+//DUMPY: 1 0
+//DUMPY: 1 0
+  cal_event_TGL
+  /* {
+  public:
+//DUMPY: 3 1
+    raw_list_zero_suppress<float,float,3> F;
+  } */ TGL[1][1];
+//DUMPY: 1 0
+//DUMPY: 1 0
+  cal_event_ZZP
+  /* {
+  public:
+//DUMPY: 10 1
+    raw_list_zero_suppress<float,float,10> F;
+//DUMPY: 10 1
+    raw_list_zero_suppress<double,double,10> D;
+//DUMPY: 10 1
+    raw_list_zero_suppress<uint32,uint32,10> U;
+//DUMPY: 10 1
+    raw_list_zero_suppress<uint64,uint64,10> L;
+  } */ ZZP[1][1];
+
+public:
+#ifndef __PSDC__
+  STRUCT_FCNS_DECL(cal_event);
+#endif//!__PSDC__
+} ;
+
+/** END_EVENT_CAL_STRUCTURE *******************************************/
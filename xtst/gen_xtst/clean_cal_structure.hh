@@ -0,0 +1,42 @@
+class cal_event_POS
+{
+  float E;
+  STRUCT_FCNS_DECL(cal_event_POS);
+} ;
+class cal_event_PIN
+{
+  float E;
+  STRUCT_FCNS_DECL(cal_event_PIN);
+} ;
+class cal_event_N
+{
+  float T UNIT("#ns");
+  STRUCT_FCNS_DECL(cal_event_N);
+} ;
+class cal_event_TGL
+{
+  raw_list_zero_suppress<float,float,3> F;
+  STRUCT_FCNS_DECL(cal_event_TGL);
+} ;
+class cal_event_ZZP
+{
+  raw_list_zero_suppress<float,float,10> F;
+  raw_list_zero_suppress<double,double,10> D;
+  raw_list_zero_suppress<uint32,uint32,10> U;
+  raw_list_zero_suppress<uint64,uint64,10> L;
+  STRUCT_FCNS_DECL(cal_event_ZZP);
+} ;
+class cal_event : public cal_event_base
+{
+  cal_event_POS
+       POS[2][4];
+  cal_event_PIN
+       PIN[2];
+  raw_list_zero_suppress_1<cal_event_N,cal_event_N[2],20,2>
+       N[10];
+  cal_event_TGL
+       TGL[1][1];
+  cal_event_ZZP
+       ZZP[1][1];
+  STRUCT_FCNS_DECL(cal_event);
+} ;
@@ -0,0 +1,117 @@
+class raw_event_POS
+{
+  TOGGLE(DATA12) T;
+  TOGGLE(DATA12) E;
+  STRUCT_FCNS_DECL(raw_event_POS);
+} ;
+class raw_event_PIN
+{
+  DATA12 E;
+  STRUCT_FCNS_DECL(raw_event_PIN);
+} ;
+class raw_event_GFI_U
+{
+  DATA12 E;
+  STRUCT_FCNS_DECL(raw_event_GFI_U);
+} ;
+class raw_event_GFI_PM
+{
+  DATA12 T;
+  DATA12 E;
+  STRUCT_FCNS_DECL(raw_event_GFI_PM);
+} ;
+class raw_event_GFI_V
+{
+  DATA12 E;
+  STRUCT_FCNS_DECL(raw_event_GFI_V);
+} ;
+class raw_event_GFI
+{
+  raw_event_GFI_U
+       U[18];
+  raw_event_GFI_PM
+       PM;
+  raw_event_GFI_V
+       V[16];
+  STRUCT_FCNS_DECL(raw_event_GFI);
+} ;
+class raw_event_N
+{
+  DATA12 T UNIT("ch");
+  DATA12 E;
+  STRUCT_FCNS_DECL(raw_event_N);
+} ;
+class raw_event_SST
+{
+  DATA12 X[640];
+  DATA12 Y[384];
+  STRUCT_FCNS_DECL(raw_event_SST);
+} ;
+class raw_event_TGL
+{
+  raw_array_zero_suppress<DATA12,DATA12,3> E;
+  raw_array_zero_suppress<TOGGLE(DATA12),TOGGLE(DATA12),3> T;
+  raw_array_zero_suppress<TOGGLE(DATA12),TOGGLE(DATA12),3> F;
+  STRUCT_FCNS_DECL(raw_event_TGL);
+} ;
+class raw_event_MAPB
+{
+  DATA12 e;
+  STRUCT_FCNS_DECL(raw_event_MAPB);
+} ;
+class raw_event_MAPC
+{
+  DATA12 e;
+  STRUCT_FCNS_DECL(raw_event_MAPC);
+} ;
+class raw_event_plain
+{
+  uint32 u;
+  uint16 s;
+  uint8 c;
+  STRUCT_FCNS_DECL(raw_event_plain);
+} ;
+class raw_event_ZZP
+{
+  raw_array_zero_suppress<DATA12,DATA12,10> E;
+  raw_array_zero_suppress<DATA12,DATA12,10> F;
+  raw_array_zero_suppress<DATA12,DATA12,10> D;
+  raw_array_zero_suppress<DATA12,DATA12,10> U;
+  raw_array_zero_suppress<DATA12,DATA12,10> L;
+  STRUCT_FCNS_DECL(raw_event_ZZP);
+} ;
+class raw_event : public raw_event_base
+{
+  raw_event_POS
+       POS[3][4];
+  raw_event_PIN
+       PIN[2];
+  raw_event_GFI
+       GFI[1];
+  raw_array_zero_suppress_1<raw_event_N,raw_event_N[2],20,2>
+       N[10];
+  raw_event_SST
+       SST[1];
+  raw_event_TGL
+       TGL[1][1];
+  DATA12 MAPA[1][3];
+  raw_event_MAPB
+       MAPB[1][3];
+  raw_event_MAPC
+       MAPC[3][1];
+  DATA12 MAPD[1][4];
+  uint32 MAPS[1];
+  raw_event_plain
+       plain;
+  raw_event_ZZP
+       ZZP[1][1];
+  uint64 ITEMsixtyfour;
+  uint32 STCORR;
+  STRUCT_FCNS_DECL(raw_event);
+} ;
+class raw_sticky : public raw_sticky_base
+{
+  uint32 corrbase;
+  raw_array_zero_suppress<uint32,uint32,5> zzp;
+  STRUCT_FCNS_DECL(raw_sticky);
+} ;
@@ -0,0 +1,1023 @@
+class CAMAC_LECROY_4434
+{
+  raw_array_zero_suppress<DATA24,DATA24,32> data;
+template<typename __data_src_t>
+  void __unpack(__data_src_t &__buffer,uint32 channels);
+template<typename __data_src_t>
+  static bool __match(__data_src_t &__buffer,uint32 channels);
+  STRUCT_FCNS_DECL(CAMAC_LECROY_4434);
+};
+class CAMAC_PHILLIPS_7164
+{
+  raw_array_zero_suppress<DATA12,DATA12,16> data;
+template<typename __data_src_t>
+  void __unpack(__data_src_t &__buffer,uint32 channels,uint32 mark_channel_no);
+template<typename __data_src_t>
+  static bool __match(__data_src_t &__buffer,uint32 channels,uint32 mark_channel_no);
+  STRUCT_FCNS_DECL(CAMAC_PHILLIPS_7164);
+};
+class CAMAC_SILENA_4418
+{
+  raw_array_zero_suppress<DATA12_OVERFLOW,DATA12_OVERFLOW,8> data;
+template<typename __data_src_t>
+  void __unpack(__data_src_t &__buffer,uint32 channels,uint32 mark_channel_no);
+template<typename __data_src_t>
+  static bool __match(__data_src_t &__buffer,uint32 channels,uint32 mark_channel_no);
+  STRUCT_FCNS_DECL(CAMAC_SILENA_4418);
+};
+class FASTBUS_LECROY_1875
+{
+  raw_array_zero_suppress<DATA12_RANGE,DATA12_RANGE,64> data;
+template<typename __data_src_t>
+  void __unpack(__data_src_t &__buffer,uint32 geom,uint32 channels);
+template<typename __data_src_t>
+  static bool __match(__data_src_t &__buffer,uint32 geom,uint32 channels);
+  STRUCT_FCNS_DECL(FASTBUS_LECROY_1875);
+};
+class FASTBUS_LECROY_1885
+{
+  raw_array_zero_suppress<DATA12_RANGE,DATA12_RANGE,96> data;
+template<typename __data_src_t>
+  void __unpack(__data_src_t &__buffer,uint32 geom,uint32 channels);
+template<typename __data_src_t>
+  static bool __match(__data_src_t &__buffer,uint32 geom,uint32 channels);
+  STRUCT_FCNS_DECL(FASTBUS_LECROY_1885);
+};
+class ITEM64
+{
+  DATA64 member64;
+  union
+  {
+    struct
+    {
+      uint64 unnamed_0_1 : 2;
+      uint64 dummy_2_4 : 3;
+      uint64 num : 3;
+      uint64 dummy_8_63 : 56;
+    };
+    uint64 u64;
+  } a;
+  union
+  {
+    struct
+    {
+      uint64 unnamed_0_1 : 2;
+      uint64 dummy_2 : 1;
+      uint64 v : 5;
+      uint64 dummy_8_19 : 12;
+      uint64 unnamed_20_63 : 44;
+    };
+    uint64 u64;
+  } b;
+  union
+  {
+    struct
+    {
+      uint32 unnamed_0_1 : 2;
+      uint32 dummy_2 : 1;
+      uint32 v : 5;
+      uint32 dummy_8_19 : 12;
+      uint32 unnamed_20_31 : 12;
+    };
+    uint32 u32;
+  } c;
+template<typename __data_src_t>
+  void __unpack(__data_src_t &__buffer,uint32 num);
+template<typename __data_src_t>
+  static bool __match(__data_src_t &__buffer,uint32 num);
+  STRUCT_FCNS_DECL(ITEM64);
+};
+class ITEMQ
+{
+  DATA32 chan;
+  union
+  {
+    struct
+    {
+      uint64 dummy_0_20 : 21;
+      uint64 c21 : 1;
+      uint64 dummy_22_63 : 42;
+    };
+    uint64 u64;
+  } w1;
+  union
+  {
+    struct
+    {
+      uint64 dummy_0_21 : 22;
+      uint64 c22 : 1;
+      uint64 dummy_23_63 : 41;
+    };
+    uint64 u64;
+  } w2;
+template<typename __data_src_t>
+  void __unpack(__data_src_t &__buffer,uint32 num);
+template<typename __data_src_t>
+  static bool __match(__data_src_t &__buffer,uint32 num);
+  STRUCT_FCNS_DECL(ITEMQ);
+};
+class ITEM_ME2
+{
+  raw_array_zero_suppress<DATA16,DATA16,32> data;
+template<typename __data_src_t>
+  void __unpack(__data_src_t &__buffer,uint32 geom);
+template<typename __data_src_t>
+  static bool __match(__data_src_t &__buffer,uint32 geom);
+  STRUCT_FCNS_DECL(ITEM_ME2);
+};
+class MADC32
+{
+  union
+  {
+    struct
+    {
+      uint32 word_counts : 12;
+      uint32 resolution : 3;
+      uint32 unused1 : 1;
+      uint32 id : 8;
+      uint32 unnamed_24_29 : 6;
+      uint32 unnamed_30_31 : 2;
+    };
+    uint32 u32;
+  } header;
+    union
+    {
+      struct
+      {
+        uint32 adc_value : 11;
+        uint32 unnamed_11_13 : 3;
+        uint32 unused : 1;
+        uint32 unnamed_15_15 : 1;
+        uint32 channel : 5;
+        uint32 unnamed_21_29 : 9;
+        uint32 unnamed_30_31 : 2;
+      };
+      uint32 u32;
+    } madc32_data0;
+      union
+      {
+        struct
+        {
+          uint32 adc_value : 12;
+          uint32 unnamed_12_13 : 2;
+          uint32 unused : 1;
+          uint32 unnamed_15_15 : 1;
+          uint32 channel : 5;
+          uint32 unnamed_21_29 : 9;
+          uint32 unnamed_30_31 : 2;
+        };
+        uint32 u32;
+      } madc32_data1;
+        union
+        {
+          struct
+          {
+            uint32 adc_value : 13;
+            uint32 unnamed_13_13 : 1;
+            uint32 unused : 1;
+            uint32 unnamed_15_15 : 1;
+            uint32 channel : 5;
+            uint32 unnamed_21_29 : 9;
+            uint32 unnamed_30_31 : 2;
+          };
+          uint32 u32;
+        } madc32_data3;
+  union
+  {
+    struct
+    {
+      uint32 evt_counter : 30;
+      uint32 unnamed_30_31 : 2;
+    };
+    uint32 u32;
+  } trailer;
+template<typename __data_src_t>
+  void __unpack(__data_src_t &__buffer,uint32 res,uint32 geo,uint32 channels);
+template<typename __data_src_t>
+  static bool __match(__data_src_t &__buffer,uint32 res,uint32 geo,uint32 channels);
+  STRUCT_FCNS_DECL(MADC32);
+};
+class SINGLE_DATA_MODULE
+{
+  uint32 data;
+template<typename __data_src_t>
+  void __unpack(__data_src_t &__buffer);
+template<typename __data_src_t>
+  static bool __match(__data_src_t &__buffer);
+  STRUCT_FCNS_DECL(SINGLE_DATA_MODULE);
+};
+class STICKY_ACTIVE
+{
+  union
+  {
+    struct
+    {
+      uint32 unnamed_0_31 : 32;
+    };
+    uint32 u32;
+  } separator;
+  uint32 active;
+  uint32 mark;
+  uint32 corr;
+template<typename __data_src_t>
+  void __unpack(__data_src_t &__buffer);
+template<typename __data_src_t>
+  static bool __match(__data_src_t &__buffer);
+  STRUCT_FCNS_DECL(STICKY_ACTIVE);
+};
+class VME_CAEN_V1190_SUBTDC
+{
+  union
+  {
+    struct
+    {
+      uint32 bunch_id : 12;
+      uint32 event_id : 12;
+      uint32 tdc : 2;
+      uint32 dummy_26 : 1;
+      uint32 unnamed_27_31 : 5;
+    };
+    uint32 u32;
+  } header;
+  union
+  {
+    struct
+    {
+      uint32 flags : 15;
+      uint32 dummy_15_23 : 9;
+      uint32 tdc : 2;
+      uint32 dummy_26 : 1;
+      uint32 unnamed_27_31 : 5;
+    };
+    uint32 u32;
+  } error_flags;
+  union
+  {
+    struct
+    {
+      uint32 word_count : 12;
+      uint32 event_id : 12;
+      uint32 tdc : 2;
+      uint32 dummy_26 : 1;
+      uint32 unnamed_27_31 : 5;
+    };
+    uint32 u32;
+  } trailer;
+template<typename __data_src_t>
+  void __unpack(__data_src_t &__buffer,uint32 tdc,uint32 event_id,raw_array_multi_zero_suppress<DATA24,DATA24,32,128> &data);
+template<typename __data_src_t>
+  static bool __match(__data_src_t &__buffer,uint32 tdc,uint32 event_id);
+  STRUCT_FCNS_DECL(VME_CAEN_V1190_SUBTDC);
+};
+class VME_CAEN_V1190
+{
+  raw_array_multi_zero_suppress<DATA24,DATA24,32,128> data;
+  union
+  {
+    struct
+    {
+      uint32 geom : 5;
+      uint32 event_number : 22;
+      uint32 unnamed_27_31 : 5;
+    };
+    uint32 u32;
+  } header;
+  SINGLE(VME_CAEN_V1190_SUBTDC,tdc[4]);
+  union
+  {
+    struct
+    {
+      uint32 time_tag : 27;
+      uint32 unnamed_27_31 : 5;
+    };
+    uint32 u32;
+  } trigger;
+  union
+  {
+    struct
+    {
+      uint32 geom : 5;
+      uint32 word_count : 15;
+      uint32 dummy_20_23 : 4;
+      uint32 tdc_error : 1;
+      uint32 buffer_overflow : 1;
+      uint32 trigger_lost : 1;
+      uint32 unnamed_27_31 : 5;
+    };
+    uint32 u32;
+  } trailer;
+template<typename __data_src_t>
+  void __unpack(__data_src_t &__buffer,uint32 geom);
+template<typename __data_src_t>
+  static bool __match(__data_src_t &__buffer,uint32 geom);
+  STRUCT_FCNS_DECL(VME_CAEN_V1190);
+};
+class VME_CAEN_V1190_SHORT_SUBTDC
+{
+template<typename __data_src_t>
+  void __unpack(__data_src_t &__buffer,uint32 tdc,uint32 event_id,raw_array_multi_zero_suppress<DATA24,DATA24,32,128> &data);
+template<typename __data_src_t>
+  static bool __match(__data_src_t &__buffer,uint32 tdc,uint32 event_id);
+  STRUCT_FCNS_DECL(VME_CAEN_V1190_SHORT_SUBTDC);
+};
+class VME_CAEN_V1190_SHORT_SUBTDC_ERROR
+{
+  union
+  {
+    struct
+    {
+      uint32 flags : 15;
+      uint32 dummy_15_23 : 9;
+      uint32 tdc : 2;
+      uint32 dummy_26 : 1;
+      uint32 unnamed_27_31 : 5;
+    };
+    uint32 u32;
+  } error_flags;
+template<typename __data_src_t>
+  void __unpack(__data_src_t &__buffer,uint32 tdc);
+template<typename __data_src_t>
+  static bool __match(__data_src_t &__buffer,uint32 tdc);
+  STRUCT_FCNS_DECL(VME_CAEN_V1190_SHORT_SUBTDC_ERROR);
+};
+class VME_CAEN_V1190_SHORT
+{
+  raw_array_multi_zero_suppress<DATA24,DATA24,32,128> data;
+  union
+  {
+    struct
+    {
+      uint32 geom : 5;
+      uint32 event_number : 22;
+      uint32 unnamed_27_31 : 5;
+    };
+    uint32 u32;
+  } header;
+  SINGLE(VME_CAEN_V1190_SHORT_SUBTDC,tdc[4]);
+  SINGLE(VME_CAEN_V1190_SHORT_SUBTDC_ERROR,err[4]);
+  union
+  {
+    struct
+    {
+      uint32 time_tag : 27;
+      uint32 unnamed_27_31 : 5;
+    };
+    uint32 u32;
+  } trigger;
+  union
+  {
+    struct
+    {
+      uint32 geom : 5;
+      uint32 word_count : 15;
+      uint32 dummy_20_23 : 4;
+      uint32 tdc_error : 1;
+      uint32 buffer_overflow : 1;
+      uint32 trigger_lost : 1;
+      uint32 unnamed_27_31 : 5;
+    };
+    uint32 u32;
+  } trailer;
+template<typename __data_src_t>
+  void __unpack(__data_src_t &__buffer,uint32 geom);
+template<typename __data_src_t>
+  static bool __match(__data_src_t &__buffer,uint32 geom);
+  STRUCT_FCNS_DECL(VME_CAEN_V1190_SHORT);
+};
+class VME_CAEN_V1290_SUBTDC
+{
+  union
+  {
+    struct
+    {
+      uint32 bunch_id : 12;
+      uint32 event_id : 12;
+      uint32 tdc : 2;
+      uint32 dummy_26 : 1;
+      uint32 unnamed_27_31 : 5;
+    };
+    uint32 u32;
+  } header;
+  union
+  {
+    struct
+    {
+      uint32 flags : 15;
+      uint32 dummy_15_23 : 9;
+      uint32 tdc : 2;
+      uint32 dummy_26 : 1;
+      uint32 unnamed_27_31 : 5;
+    };
+    uint32 u32;
+  } error_flags;
+  union
+  {
+    struct
+    {
+      uint32 word_count : 12;
+      uint32 event_id : 12;
+      uint32 tdc : 2;
+      uint32 dummy_26 : 1;
+      uint32 unnamed_27_31 : 5;
+    };
+    uint32 u32;
+  } trailer;
+template<typename __data_src_t>
+  void __unpack(__data_src_t &__buffer,uint32 tdc,uint32 event_id,raw_array_multi_zero_suppress<DATA24,DATA24,32,128> &data);
+template<typename __data_src_t>
+  static bool __match(__data_src_t &__buffer,uint32 tdc,uint32 event_id);
+  STRUCT_FCNS_DECL(VME_CAEN_V1290_SUBTDC);
+};
+class VME_CAEN_V1290
+{
+  raw_array_multi_zero_suppress<DATA24,DATA24,32,128> data;
+  union
+  {
+    struct
+    {
+      uint32 geom : 5;
+      uint32 event_number : 22;
+      uint32 unnamed_27_31 : 5;
+    };
+    uint32 u32;
+  } header;
+  SINGLE(VME_CAEN_V1290_SUBTDC,tdc[4]);
+  union
+  {
+    struct
+    {
+      uint32 time_tag : 27;
+      uint32 unnamed_27_31 : 5;
+    };
+    uint32 u32;
+  } trigger;
+  union
+  {
+    struct
+    {
+      uint32 geom : 5;
+      uint32 word_count : 15;
+      uint32 dummy_20_23 : 4;
+      uint32 tdc_error : 1;
+      uint32 buffer_overflow : 1;
+      uint32 trigger_lost : 1;
+      uint32 unnamed_27_31 : 5;
+    };
+    uint32 u32;
+  } trailer;
+template<typename __data_src_t>
+  void __unpack(__data_src_t &__buffer,uint32 geom);
+template<typename __data_src_t>
+  static bool __match(__data_src_t &__buffer,uint32 geom);
+  STRUCT_FCNS_DECL(VME_CAEN_V1290);
+};
+class VME_CAEN_V1290_SHORT_SUBTDC
+{
+template<typename __data_src_t>
+  void __unpack(__data_src_t &__buffer,uint32 tdc,uint32 event_id,raw_array_multi_zero_suppress<DATA24,DATA24,32,128> &data);
+template<typename __data_src_t>
+  static bool __match(__data_src_t &__buffer,uint32 tdc,uint32 event_id);
+  STRUCT_FCNS_DECL(VME_CAEN_V1290_SHORT_SUBTDC);
+};
+class VME_CAEN_V1290_SHORT_SUBTDC_ERROR
+{
+  union
+  {
+    struct
+    {
+      uint32 flags : 15;
+      uint32 dummy_15_23 : 9;
+      uint32 tdc : 2;
+      uint32 dummy_26 : 1;
+      uint32 unnamed_27_31 : 5;
+    };
+    uint32 u32;
+  } error_flags;
+template<typename __data_src_t>
+  void __unpack(__data_src_t &__buffer,uint32 tdc);
+template<typename __data_src_t>
+  static bool __match(__data_src_t &__buffer,uint32 tdc);
+  STRUCT_FCNS_DECL(VME_CAEN_V1290_SHORT_SUBTDC_ERROR);
+};
+class VME_CAEN_V1290_SHORT
+{
+  raw_array_multi_zero_suppress<DATA24,DATA24,32,128> data;
+  union
+  {
+    struct
+    {
+      uint32 geom : 5;
+      uint32 event_number : 22;
+      uint32 unnamed_27_31 : 5;
+    };
+    uint32 u32;
+  } header;
+  SINGLE(VME_CAEN_V1290_SHORT_SUBTDC,tdc[4]);
+  SINGLE(VME_CAEN_V1290_SHORT_SUBTDC_ERROR,err[4]);
+  union
+  {
+    struct
+    {
+      uint32 time_tag : 27;
+      uint32 unnamed_27_31 : 5;
+    };
+    uint32 u32;
+  } trigger;
+  union
+  {
+    struct
+    {
+      uint32 geom : 5;
+      uint32 word_count : 15;
+      uint32 dummy_20_23 : 4;
+      uint32 tdc_error : 1;
+      uint32 buffer_overflow : 1;
+      uint32 trigger_lost : 1;
+      uint32 unnamed_27_31 : 5;
+    };
+    uint32 u32;
+  } trailer;
+template<typename __data_src_t>
+  void __unpack(__data_src_t &__buffer,uint32 geom);
+template<typename __data_src_t>
+  static bool __match(__data_src_t &__buffer,uint32 geom);
+  STRUCT_FCNS_DECL(VME_CAEN_V1290_SHORT);
+};
+class VME_CAEN_V775
+{
+  raw_array_zero_suppress<DATA12_OVERFLOW,DATA12_OVERFLOW,32> data;
+  union
+  {
+    struct
+    {
+      uint32 event_number : 24;
+      uint32 unnamed_24_26 : 3;
+      uint32 geom : 5;
+    };
+    uint32 u32;
+  } eob;
+template<typename __data_src_t>
+  void __unpack(__data_src_t &__buffer,uint32 geom,uint32 crate);
+template<typename __data_src_t>
+  static bool __match(__data_src_t &__buffer,uint32 geom,uint32 crate);
+  STRUCT_FCNS_DECL(VME_CAEN_V775);
+};
+class VME_CAEN_V830
+{
+  raw_array_zero_suppress<DATA32,DATA32,32> data;
+  union
+  {
+    struct
+    {
+      uint32 event_number : 16;
+      uint32 ts : 2;
+      uint32 count : 6;
+      uint32 dummy_24_25 : 2;
+      uint32 unnamed_26_26 : 1;
+      uint32 geom : 5;
+    };
+    uint32 u32;
+  } header;
+template<typename __data_src_t>
+  void __unpack(__data_src_t &__buffer,uint32 geom);
+template<typename __data_src_t>
+  static bool __match(__data_src_t &__buffer,uint32 geom);
+  STRUCT_FCNS_DECL(VME_CAEN_V830);
+};
+class VME_MESYTEC_MADC32
+{
+  raw_array_zero_suppress<DATA14_OVERFLOW,DATA14_OVERFLOW,32> data;
+  union
+  {
+    struct
+    {
+      uint32 counter : 30;
+      uint32 unnamed_30_31 : 2;
+    };
+    uint32 u32;
+  } end_of_event;
+template<typename __data_src_t>
+  void __unpack(__data_src_t &__buffer,uint32 geom);
+template<typename __data_src_t>
+  static bool __match(__data_src_t &__buffer,uint32 geom);
+  STRUCT_FCNS_DECL(VME_MESYTEC_MADC32);
+};
+class VME_MESYTEC_MDPP16
+{
+  raw_array_multi_zero_suppress<DATA16_OVERFLOW,DATA16_OVERFLOW,16,20> adc;
+  raw_array_multi_zero_suppress<DATA16_OVERFLOW,DATA16_OVERFLOW,16,20> tdc;
+  raw_array_multi_zero_suppress<DATA16_OVERFLOW,DATA16_OVERFLOW,16,20> trig_tdc;
+  raw_array_multi_zero_suppress<DATA16_OVERFLOW,DATA16_OVERFLOW,16,20> adc_short;
+  union
+  {
+    struct
+    {
+      uint32 counter : 30;
+      uint32 unnamed_30_31 : 2;
+    };
+    uint32 u32;
+  } end_of_event;
+template<typename __data_src_t>
+  void __unpack(__data_src_t &__buffer,uint32 geom);
+template<typename __data_src_t>
+  static bool __match(__data_src_t &__buffer,uint32 geom);
+  STRUCT_FCNS_DECL(VME_MESYTEC_MDPP16);
+};
+class WR_STAMP
+{
+  DATA16 srcid;
+  DATA16 err;
+  DATA16 t1;
+  DATA16 t2;
+  DATA16 t3;
+  DATA16 t4;
+template<typename __data_src_t>
+  void __unpack(__data_src_t &__buffer,uint32 id);
+template<typename __data_src_t>
+  static bool __match(__data_src_t &__buffer,uint32 id);
+  STRUCT_FCNS_DECL(WR_STAMP);
+};
+class XTST_STD_VME
+{
+  union
+  {
+    struct
+    {
+      uint32 fail_general : 1;
+      uint32 fail_data_corrupt : 1;
+      uint32 fail_data_missing : 1;
+      uint32 fail_data_too_much : 1;
+      uint32 fail_event_counter_mismatch : 1;
+      uint32 fail_readout_error_driver : 1;
+      uint32 fail_unexpected_trigger : 1;
+      uint32 dummy_7_26 : 20;
+      uint32 has_no_zero_suppression : 1;
+      uint32 has_multi_adctdc_counter0 : 1;
+      uint32 has_multi_scaler_counter0 : 1;
+      uint32 has_multi_event : 1;
+      uint32 has_time_stamp : 1;
+    };
+    uint32 u32;
+  } failure;
+    uint32 time_stamp;
+    uint32 multi_events;
+    uint32 multi_scaler_counter0;
+    uint32 multi_adctdc_counter0;
+template<typename __data_src_t>
+  void __unpack(__data_src_t &__buffer);
+template<typename __data_src_t>
+  static bool __match(__data_src_t &__buffer);
+  STRUCT_FCNS_DECL(XTST_STD_VME);
+};
+class XTST_SUBEVENT_MEMBER_DATA12
+{
+  DATA12 mDATA12;
+  raw_array<DATA12,DATA12,8> mDATA12_array;
+  raw_array_zero_suppress<DATA12,DATA12,8> mDATA12_array_zzp;
+  raw_list_zero_suppress<DATA12,DATA12,8> mDATA12_array_zzpii;
+  raw_array_multi_zero_suppress<DATA12,DATA12,8,4> mDATA12_array_zzpml;
+  raw_array<DATA12,DATA12,8> mDATA12_array2[2];
+  raw_array_zero_suppress<DATA12,DATA12,8> mDATA12_array2_zzp[2];
+  raw_list_zero_suppress<DATA12,DATA12,8> mDATA12_array2_zzpii[2];
+  raw_array_multi_zero_suppress<DATA12,DATA12,8,4> mDATA12_array2_zzpml[2];
+template<typename __data_src_t>
+  void __unpack(__data_src_t &__buffer);
+template<typename __data_src_t>
+  static bool __match(__data_src_t &__buffer);
+  STRUCT_FCNS_DECL(XTST_SUBEVENT_MEMBER_DATA12);
+};
+class XTST_SUBEVENT_MEMBER_DATA12_OVERFLOW
+{
+  DATA12_OVERFLOW mDATA12_OVERFLOW;
+  raw_array<DATA12_OVERFLOW,DATA12_OVERFLOW,8> mDATA12_OVERFLOW_array;
+  raw_array_zero_suppress<DATA12_OVERFLOW,DATA12_OVERFLOW,8> mDATA12_OVERFLOW_array_zzp;
+  raw_list_zero_suppress<DATA12_OVERFLOW,DATA12_OVERFLOW,8> mDATA12_OVERFLOW_array_zzpii;
+  raw_array_multi_zero_suppress<DATA12_OVERFLOW,DATA12_OVERFLOW,8,4> mDATA12_OVERFLOW_array_zzpml;
+  raw_array<DATA12_OVERFLOW,DATA12_OVERFLOW,8> mDATA12_OVERFLOW_array2[2];
+  raw_array_zero_suppress<DATA12_OVERFLOW,DATA12_OVERFLOW,8> mDATA12_OVERFLOW_array2_zzp[2];
+  raw_list_zero_suppress<DATA12_OVERFLOW,DATA12_OVERFLOW,8> mDATA12_OVERFLOW_array2_zzpii[2];
+  raw_array_multi_zero_suppress<DATA12_OVERFLOW,DATA12_OVERFLOW,8,4> mDATA12_OVERFLOW_array2_zzpml[2];
+template<typename __data_src_t>
+  void __unpack(__data_src_t &__buffer);
+template<typename __data_src_t>
+  static bool __match(__data_src_t &__buffer);
+  STRUCT_FCNS_DECL(XTST_SUBEVENT_MEMBER_DATA12_OVERFLOW);
+};
+class XTST_SUBEVENT_MEMBER_DATA12_RANGE
+{
+  DATA12_RANGE mDATA12_RANGE;
+  raw_array<DATA12_RANGE,DATA12_RANGE,8> mDATA12_RANGE_array;
+  raw_array_zero_suppress<DATA12_RANGE,DATA12_RANGE,8> mDATA12_RANGE_array_zzp;
+  raw_list_zero_suppress<DATA12_RANGE,DATA12_RANGE,8> mDATA12_RANGE_array_zzpii;
+  raw_array_multi_zero_suppress<DATA12_RANGE,DATA12_RANGE,8,4> mDATA12_RANGE_array_zzpml;
+  raw_array<DATA12_RANGE,DATA12_RANGE,8> mDATA12_RANGE_array2[2];
+  raw_array_zero_suppress<DATA12_RANGE,DATA12_RANGE,8> mDATA12_RANGE_array2_zzp[2];
+  raw_list_zero_suppress<DATA12_RANGE,DATA12_RANGE,8> mDATA12_RANGE_array2_zzpii[2];
+  raw_array_multi_zero_suppress<DATA12_RANGE,DATA12_RANGE,8,4> mDATA12_RANGE_array2_zzpml[2];
+template<typename __data_src_t>
+  void __unpack(__data_src_t &__buffer);
+template<typename __data_src_t>
+  static bool __match(__data_src_t &__buffer);
+  STRUCT_FCNS_DECL(XTST_SUBEVENT_MEMBER_DATA12_RANGE);
+};
+class XTST_SUBEVENT_MEMBER_DATA16
+{
+  DATA16 mDATA16;
+  raw_array<DATA16,DATA16,8> mDATA16_array;
+  raw_array_zero_suppress<DATA16,DATA16,8> mDATA16_array_zzp;
+  raw_list_zero_suppress<DATA16,DATA16,8> mDATA16_array_zzpii;
+  raw_array_multi_zero_suppress<DATA16,DATA16,8,4> mDATA16_array_zzpml;
+  raw_array<DATA16,DATA16,8> mDATA16_array2[2];
+  raw_array_zero_suppress<DATA16,DATA16,8> mDATA16_array2_zzp[2];
+  raw_list_zero_suppress<DATA16,DATA16,8> mDATA16_array2_zzpii[2];
+  raw_array_multi_zero_suppress<DATA16,DATA16,8,4> mDATA16_array2_zzpml[2];
+template<typename __data_src_t>
+  void __unpack(__data_src_t &__buffer);
+template<typename __data_src_t>
+  static bool __match(__data_src_t &__buffer);
+  STRUCT_FCNS_DECL(XTST_SUBEVENT_MEMBER_DATA16);
+};
+class XTST_SUBEVENT_MEMBER_DATA16_OVERFLOW
+{
+  DATA16_OVERFLOW mDATA16_OVERFLOW;
+  raw_array<DATA16_OVERFLOW,DATA16_OVERFLOW,8> mDATA16_OVERFLOW_array;
+  raw_array_zero_suppress<DATA16_OVERFLOW,DATA16_OVERFLOW,8> mDATA16_OVERFLOW_array_zzp;
+  raw_list_zero_suppress<DATA16_OVERFLOW,DATA16_OVERFLOW,8> mDATA16_OVERFLOW_array_zzpii;
+  raw_array_multi_zero_suppress<DATA16_OVERFLOW,DATA16_OVERFLOW,8,4> mDATA16_OVERFLOW_array_zzpml;
+  raw_array<DATA16_OVERFLOW,DATA16_OVERFLOW,8> mDATA16_OVERFLOW_array2[2];
+  raw_array_zero_suppress<DATA16_OVERFLOW,DATA16_OVERFLOW,8> mDATA16_OVERFLOW_array2_zzp[2];
+  raw_list_zero_suppress<DATA16_OVERFLOW,DATA16_OVERFLOW,8> mDATA16_OVERFLOW_array2_zzpii[2];
+  raw_array_multi_zero_suppress<DATA16_OVERFLOW,DATA16_OVERFLOW,8,4> mDATA16_OVERFLOW_array2_zzpml[2];
+template<typename __data_src_t>
+  void __unpack(__data_src_t &__buffer);
+template<typename __data_src_t>
+  static bool __match(__data_src_t &__buffer);
+  STRUCT_FCNS_DECL(XTST_SUBEVENT_MEMBER_DATA16_OVERFLOW);
+};
+class XTST_SUBEVENT_MEMBER_DATA24
+{
+  DATA24 mDATA24;
+  raw_array<DATA24,DATA24,8> mDATA24_array;
+  raw_array_zero_suppress<DATA24,DATA24,8> mDATA24_array_zzp;
+  raw_list_zero_suppress<DATA24,DATA24,8> mDATA24_array_zzpii;
+  raw_array_multi_zero_suppress<DATA24,DATA24,8,4> mDATA24_array_zzpml;
+  raw_array<DATA24,DATA24,8> mDATA24_array2[2];
+  raw_array_zero_suppress<DATA24,DATA24,8> mDATA24_array2_zzp[2];
+  raw_list_zero_suppress<DATA24,DATA24,8> mDATA24_array2_zzpii[2];
+  raw_array_multi_zero_suppress<DATA24,DATA24,8,4> mDATA24_array2_zzpml[2];
+template<typename __data_src_t>
+  void __unpack(__data_src_t &__buffer);
+template<typename __data_src_t>
+  static bool __match(__data_src_t &__buffer);
+  STRUCT_FCNS_DECL(XTST_SUBEVENT_MEMBER_DATA24);
+};
+class XTST_SUBEVENT_MEMBER_DATA32
+{
+  DATA32 mDATA32;
+  raw_array<DATA32,DATA32,8> mDATA32_array;
+  raw_array_zero_suppress<DATA32,DATA32,8> mDATA32_array_zzp;
+  raw_list_zero_suppress<DATA32,DATA32,8> mDATA32_array_zzpii;
+  raw_array_multi_zero_suppress<DATA32,DATA32,8,4> mDATA32_array_zzpml;
+  raw_array<DATA32,DATA32,8> mDATA32_array2[2];
+  raw_array_zero_suppress<DATA32,DATA32,8> mDATA32_array2_zzp[2];
+  raw_list_zero_suppress<DATA32,DATA32,8> mDATA32_array2_zzpii[2];
+  raw_array_multi_zero_suppress<DATA32,DATA32,8,4> mDATA32_array2_zzpml[2];
+template<typename __data_src_t>
+  void __unpack(__data_src_t &__buffer);
+template<typename __data_src_t>
+  static bool __match(__data_src_t &__buffer);
+  STRUCT_FCNS_DECL(XTST_SUBEVENT_MEMBER_DATA32);
+};
+class XTST_SUBEVENT_MEMBER_DATA32_B
+{
+  raw_array_multi_zero_suppress<DATA32,DATA32,8,4> mDATA32_array_zzpml;
+template<typename __data_src_t>
+  void __unpack(__data_src_t &__buffer);
+template<typename __data_src_t>
+  static bool __match(__data_src_t &__buffer);
+  STRUCT_FCNS_DECL(XTST_SUBEVENT_MEMBER_DATA32_B);
+};
+class XTST_SUBEVENT_MEMBER_DATA8
+{
+  DATA8 mDATA8;
+  raw_array<DATA8,DATA8,8> mDATA8_array;
+  raw_array_zero_suppress<DATA8,DATA8,8> mDATA8_array_zzp;
+  raw_list_zero_suppress<DATA8,DATA8,8> mDATA8_array_zzpii;
+  raw_array_multi_zero_suppress<DATA8,DATA8,8,4> mDATA8_array_zzpml;
+  raw_array<DATA8,DATA8,8> mDATA8_array2[2];
+  raw_array_zero_suppress<DATA8,DATA8,8> mDATA8_array2_zzp[2];
+  raw_list_zero_suppress<DATA8,DATA8,8> mDATA8_array2_zzpii[2];
+  raw_array_multi_zero_suppress<DATA8,DATA8,8,4> mDATA8_array2_zzpml[2];
+template<typename __data_src_t>
+  void __unpack(__data_src_t &__buffer);
+template<typename __data_src_t>
+  static bool __match(__data_src_t &__buffer);
+  STRUCT_FCNS_DECL(XTST_SUBEVENT_MEMBER_DATA8);
+};
+class XTST_SUBEVENT_MEMBER_uint16
+{
+  uint16 muint16;
+template<typename __data_src_t>
+  void __unpack(__data_src_t &__buffer);
+template<typename __data_src_t>
+  static bool __match(__data_src_t &__buffer);
+  STRUCT_FCNS_DECL(XTST_SUBEVENT_MEMBER_uint16);
+};
+class XTST_SUBEVENT_MEMBER_uint32
+{
+  uint32 muint32;
+template<typename __data_src_t>
+  void __unpack(__data_src_t &__buffer);
+template<typename __data_src_t>
+  static bool __match(__data_src_t &__buffer);
+  STRUCT_FCNS_DECL(XTST_SUBEVENT_MEMBER_uint32);
+};
+class XTST_SUBEVENT_MEMBER_uint8
+{
+  uint8 muint8;
+template<typename __data_src_t>
+  void __unpack(__data_src_t &__buffer);
+template<typename __data_src_t>
+  static bool __match(__data_src_t &__buffer);
+  STRUCT_FCNS_DECL(XTST_SUBEVENT_MEMBER_uint8);
+};
+class BITS64
+ : public unpack_subevent_base
+{
+  DATA64 member64;
+  raw_array<DATA64,DATA64,7> array64;
+  DATA32 member32;
+  uint32 data32_1;
+  uint32 data32_2;
+  uint64 data64_1;
+  SINGLE(ITEM64,i[3]);
+template<typename __data_src_t>
+  void __unpack(__data_src_t &__buffer);
+template<typename __data_src_t>
+  static bool __match(__data_src_t &__buffer);
+  STRUCT_FCNS_DECL(BITS64);
+};
+class XTST_MDPP16
+ : public unpack_subevent_base
+{
+  union
+  {
+    struct
+    {
+      uint16 unaligned : 16;
+    };
+    uint16 u16;
+  } align;
+    uint16 pad;
+  SINGLE(VME_MESYTEC_MDPP16,mdpp16[2]);
+template<typename __data_src_t>
+  void __unpack(__data_src_t &__buffer);
+template<typename __data_src_t>
+  static bool __match(__data_src_t &__buffer);
+  STRUCT_FCNS_DECL(XTST_MDPP16);
+};
+class XTST_PLAIN
+ : public unpack_subevent_base
+{
+  uint32 u;
+  uint16 s;
+  uint8 c;
+template<typename __data_src_t>
+  void __unpack(__data_src_t &__buffer);
+template<typename __data_src_t>
+  static bool __match(__data_src_t &__buffer);
+  STRUCT_FCNS_DECL(XTST_PLAIN);
+};
+class XTST_REGRESS
+ : public unpack_subevent_base
+{
+  SINGLE(WR_STAMP,wr[6]);
+  uint32 seed;
+  SINGLE(VME_CAEN_V775,v775mod[2]);
+  SINGLE(VME_CAEN_V1290_SHORT,v1290mod[2]);
+  SINGLE(STICKY_ACTIVE,sticky_active);
+template<typename __data_src_t>
+  void __unpack(__data_src_t &__buffer);
+template<typename __data_src_t>
+  static bool __match(__data_src_t &__buffer);
+  STRUCT_FCNS_DECL(XTST_REGRESS);
+};
+class XTST_REGRESSEXTRA
+ : public unpack_subevent_base
+{
+  uint32 junk;
+template<typename __data_src_t>
+  void __unpack(__data_src_t &__buffer);
+template<typename __data_src_t>
+  static bool __match(__data_src_t &__buffer);
+  STRUCT_FCNS_DECL(XTST_REGRESSEXTRA);
+};
+class XTST_STICKY_CORR
+ : public unpack_sticky_subevent_base
+{
+  uint32 base;
+template<typename __data_src_t>
+  void __unpack(__data_src_t &__buffer);
+template<typename __data_src_t>
+  static bool __match(__data_src_t &__buffer);
+  STRUCT_FCNS_DECL(XTST_STICKY_CORR);
+};
+class XTST_SUBEVENT_ME2
+ : public unpack_subevent_base
+{
+  SINGLE(ITEM_ME2,i[3]);
+template<typename __data_src_t>
+  void __unpack(__data_src_t &__buffer);
+template<typename __data_src_t>
+  static bool __match(__data_src_t &__buffer);
+  STRUCT_FCNS_DECL(XTST_SUBEVENT_ME2);
+};
+class XTST_SUBEVENT_MEMBER_ENCODE
+ : public unpack_subevent_base
+{
+  SINGLE(XTST_SUBEVENT_MEMBER_DATA32,member_DATA32);
+  SINGLE(XTST_SUBEVENT_MEMBER_DATA24,member_DATA24);
+  SINGLE(XTST_SUBEVENT_MEMBER_DATA16,member_DATA16);
+  SINGLE(XTST_SUBEVENT_MEMBER_DATA16_OVERFLOW,member_DATA16_OVERFLOW);
+  SINGLE(XTST_SUBEVENT_MEMBER_DATA12,member_DATA12);
+  SINGLE(XTST_SUBEVENT_MEMBER_DATA12_OVERFLOW,member_DATA12_OVERFLOW);
+  SINGLE(XTST_SUBEVENT_MEMBER_DATA12_RANGE,member_DATA12_RANGE);
+  SINGLE(XTST_SUBEVENT_MEMBER_uint32,member_uint32);
+  SINGLE(XTST_SUBEVENT_MEMBER_uint16,member_uint16);
+  SINGLE(XTST_SUBEVENT_MEMBER_uint8,member_uint8);
+template<typename __data_src_t>
+  void __unpack(__data_src_t &__buffer);
+template<typename __data_src_t>
+  static bool __match(__data_src_t &__buffer);
+  STRUCT_FCNS_DECL(XTST_SUBEVENT_MEMBER_ENCODE);
+};
+class XTST_SUBEVENT_MEMBER_ENCODE_A
+ : public unpack_subevent_base
+{
+  SINGLE(XTST_SUBEVENT_MEMBER_DATA32,d32);
+template<typename __data_src_t>
+  void __unpack(__data_src_t &__buffer);
+template<typename __data_src_t>
+  static bool __match(__data_src_t &__buffer);
+  STRUCT_FCNS_DECL(XTST_SUBEVENT_MEMBER_ENCODE_A);
+};
+class XTST_SUBEVENT_MEMBER_ENCODE_B
+ : public unpack_subevent_base
+{
+  SINGLE(XTST_SUBEVENT_MEMBER_DATA32_B,d32);
+template<typename __data_src_t>
+  void __unpack(__data_src_t &__buffer);
+template<typename __data_src_t>
+  static bool __match(__data_src_t &__buffer);
+  STRUCT_FCNS_DECL(XTST_SUBEVENT_MEMBER_ENCODE_B);
+};
+class XTST_VME
+ : public unpack_subevent_base
+{
+  SINGLE(VME_CAEN_V775,tdc0);
+  SINGLE(VME_CAEN_V775,tdc1);
+  SINGLE(VME_CAEN_V775,tdc2);
+  SINGLE(VME_CAEN_V775,qdc0);
+  SINGLE(VME_CAEN_V775,qdc1);
+  SINGLE(VME_MESYTEC_MDPP16,mdpp16);
+  SINGLE(XTST_STD_VME,header);
+  SINGLE(SINGLE_DATA_MODULE,sdm);
+template<typename __data_src_t>
+  void __unpack(__data_src_t &__buffer);
+template<typename __data_src_t>
+  static bool __match(__data_src_t &__buffer);
+  STRUCT_FCNS_DECL(XTST_VME);
+};
+class unpack_event : public unpack_event_base
+{
+SINGLE(XTST_VME,vme);
+SINGLE(BITS64,bits64);
+SINGLE(XTST_SUBEVENT_MEMBER_ENCODE,me);
+SINGLE(XTST_SUBEVENT_MEMBER_ENCODE_A,mea);
+SINGLE(XTST_SUBEVENT_MEMBER_ENCODE_B,meb);
+SINGLE(XTST_SUBEVENT_ME2,me2);
+SINGLE(XTST_PLAIN,plain);
+SINGLE(XTST_REGRESS,regress[16]);
+SINGLE(XTST_REGRESSEXTRA,regressextra);
+SINGLE(XTST_MDPP16,mdpp);
+  bitsone<25> __visited;
+  void __clear_visited() { __visited.clear(); }
+  subevent_match_cache __match_cache;
+  bool ignore_unknown_subevent() { return false; }
+template<typename __data_src_t>
+  int __unpack_subevent(subevent_header *__header,__data_src_t &__buffer);
+  int __revoke_subevent(subevent_header *__header);
+  STRUCT_FCNS_DECL(unpack_event);
+};
+class unpack_sticky_event : public unpack_sticky_event_base
+{
+SINGLE(XTST_STICKY_CORR,corr);
+  bitsone<2> __visited;
+  void __clear_visited() { __visited.clear(); }
+  subevent_match_cache __match_cache;
+  bool ignore_unknown_subevent() { return true; }
+template<typename __data_src_t>
+  int __unpack_subevent(subevent_header *__header,__data_src_t &__buffer);
+  int __revoke_subevent(subevent_header *__header);
+  STRUCT_FCNS_DECL(unpack_sticky_event);
+};
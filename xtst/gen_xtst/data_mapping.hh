@@ -0,0 +1,86 @@
+/** BEGIN_EVENT_DATA_MAPPING *******************************************
+ *
+ * Event data mapping.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// The order in this file does not matter.
+// This information parsed once and not treated eventwise,
+// it is used to initialize a structure.
+
+SIGNAL_MAPPING(DATA12,GFI1_PM_E,vme.qdc0.data[21],GFI[0].PM.E);
+SIGNAL_MAPPING(DATA12,GFI1_PM_T,vme.qdc0.data[16],GFI[0].PM.T);
+SIGNAL_MAPPING(DATA12,GFI1_U_1_E,vme.qdc0.data[10],GFI[0].U[0].E);
+SIGNAL_MAPPING(DATA12,GFI1_U_2_E,vme.qdc0.data[11],GFI[0].U[1].E);
+SIGNAL_MAPPING(DATA12,GFI1_U_3_E,vme.qdc0.data[12],GFI[0].U[2].E);
+SIGNAL_MAPPING(DATA12,GFI1_U_4_E,vme.qdc0.data[13],GFI[0].U[3].E);
+SIGNAL_MAPPING(DATA12,GFI1_U_5_E,vme.qdc0.data[15],GFI[0].U[4].E);
+SIGNAL_MAPPING(DATA12,GFI1_U_6_E,vme.qdc0.data[14],GFI[0].U[5].E);
+SIGNAL_MAPPING(DATA12,MAPA1_1,vme.tdc1.data[0],MAPA[0][0]);
+SIGNAL_MAPPING(DATA12,MAPA1_2,vme.tdc1.data[1],MAPA[0][1]);
+SIGNAL_MAPPING(DATA12,MAPA1_3,vme.tdc1.data[2],MAPA[0][2]);
+SIGNAL_MAPPING(DATA12,MAPB1_1e,vme.tdc1.data[3],MAPB[0][0].e);
+SIGNAL_MAPPING(DATA12,MAPB1_2e,vme.tdc1.data[4],MAPB[0][1].e);
+SIGNAL_MAPPING(DATA12,MAPB1_3e,vme.tdc1.data[5],MAPB[0][2].e);
+SIGNAL_MAPPING(DATA12,MAPC1_1e,vme.tdc1.data[6],MAPC[0][0].e);
+SIGNAL_MAPPING(DATA12,MAPC2_1e,vme.tdc1.data[7],MAPC[1][0].e);
+SIGNAL_MAPPING(DATA12,MAPC3_1e,vme.tdc1.data[8],MAPC[2][0].e);
+SIGNAL_MAPPING(DATA12,MAPD1_4,vme.tdc1.data[9],MAPD[0][3]);
+SIGNAL_MAPPING(uint32,MAPS1,vme.sdm.data,MAPS[0]);
+SIGNAL_MAPPING(DATA12,N1_1_1_E,vme.qdc0.data[22],N[0][0][0].E);/*,ZERO_SUPPRESS_ITEM(N[0],0)*/
+SIGNAL_MAPPING(DATA12,N1_1_1_T,vme.qdc0.data[17],N[0][0][0].T);/*,ZERO_SUPPRESS_ITEM(N[0],0)*/
+SIGNAL_MAPPING(DATA12,N1_1_2_T,vme.qdc0.data[18],N[0][0][1].T);/*,ZERO_SUPPRESS_ITEM(N[0],0)*/
+SIGNAL_MAPPING(DATA12,N1_2_1_T,vme.qdc0.data[19],N[0][1][0].T);/*,ZERO_SUPPRESS_ITEM(N[0],1)*/
+SIGNAL_MAPPING(DATA12,N2_2_1_T,vme.qdc0.data[20],N[1][1][0].T);/*,ZERO_SUPPRESS_ITEM(N[1],1)*/
+SIGNAL_MAPPING(DATA12,PIN1_E,vme.qdc0.data[8],PIN[0].E);
+SIGNAL_MAPPING(DATA12,PIN2_E,vme.qdc0.data[9],PIN[1].E);
+SIGNAL_MAPPING(DATA12,POS1_1_T,vme.tdc0.data[0],POS[0][0].T);
+SIGNAL_MAPPING(DATA12,POS1_2_T,vme.tdc0.data[1],POS[0][1].T);
+SIGNAL_MAPPING(DATA12,POS1_3_T,vme.tdc0.data[2],POS[0][2].T);
+SIGNAL_MAPPING(DATA12,POS1_4_T,vme.tdc0.data[3],POS[0][3].T);
+SIGNAL_MAPPING(DATA12,POS2_1_E,vme.qdc0.data[4],POS[1][0].E);
+SIGNAL_MAPPING(DATA12,POS2_1_T,vme.tdc0.data[4],POS[1][0].T);
+SIGNAL_MAPPING(DATA12,POS2_2_E,vme.qdc0.data[5],POS[1][1].E);
+SIGNAL_MAPPING(DATA12,POS2_2_T,vme.tdc0.data[5],POS[1][1].T);
+SIGNAL_MAPPING(DATA12,POS2_3_E,vme.qdc0.data[6],POS[1][2].E);
+SIGNAL_MAPPING(DATA12,POS2_3_T,vme.tdc0.data[6],POS[1][2].T);
+SIGNAL_MAPPING(DATA12,POS2_4_E,vme.qdc0.data[7],POS[1][3].E);
+SIGNAL_MAPPING(DATA12,POS2_4_T,vme.tdc0.data[7],POS[1][3].T);
+SIGNAL_MAPPING(DATA12,POS3_1_E,vme.qdc1.data[1],TOGGLE 1:POS[2][0].E);
+SIGNAL_MAPPING(DATA12,POS3_1_E,vme.qdc1.data[17],TOGGLE 2:POS[2][0].E);
+SIGNAL_MAPPING(DATA12,POS3_2_E,vme.qdc1.data[0],TOGGLE 2:POS[2][1].E);
+SIGNAL_MAPPING(DATA12,POS3_3E,vme.qdc1.data[3],TOGGLE 1:POS[2][2].E);
+SIGNAL_MAPPING(DATA12,POS3_3T,vme.tdc2.data[19],TOGGLE 1:POS[2][2].T);
+SIGNAL_MAPPING(DATA12,POS3_3T,vme.tdc2.data[3],TOGGLE 2:POS[2][2].T);
+SIGNAL_MAPPING(DATA12,POS3_4E,vme.qdc1.data[4],TOGGLE 1:POS[2][3].E);
+SIGNAL_MAPPING(DATA12,POS3_4T,vme.tdc2.data[20],TOGGLE 1:POS[2][3].T);
+SIGNAL_MAPPING(DATA12,POS3_4T,vme.tdc2.data[4],TOGGLE 2:POS[2][3].T);
+SIGNAL_MAPPING(uint32,STCORR,regress[0].sticky_active.corr,STCORR);
+SIGNAL_MAPPING(DATA12,TGL1_1_E_1,vme.qdc1.data[10],TGL[0][0].E[0]);/*,ZERO_SUPPRESS_ITEM(TGL[0][0].E,0)*/
+SIGNAL_MAPPING(DATA12,TGL1_1_F_1,vme.tdc2.data[11],TOGGLE 2:TGL[0][0].F[0]);/*,ZERO_SUPPRESS_ITEM(TGL[0][0].F,0)*/
+SIGNAL_MAPPING(DATA12,TGL1_1_T_1,vme.tdc2.data[10],TOGGLE 2:TGL[0][0].T[0]);/*,ZERO_SUPPRESS_ITEM(TGL[0][0].T,0)*/
+SIGNAL_MAPPING(DATA12,ZZP1_1_D_1,vme.tdc2.data[6],ZZP[0][0].D[0]);/*,ZERO_SUPPRESS_ITEM(ZZP[0][0].D,0)*/
+SIGNAL_MAPPING(DATA12,ZZP1_1_E_1,vme.qdc1.data[2],ZZP[0][0].E[0]);/*,ZERO_SUPPRESS_ITEM(ZZP[0][0].E,0)*/
+SIGNAL_MAPPING(DATA12,ZZP1_1_F_1,vme.tdc2.data[5],ZZP[0][0].F[0]);/*,ZERO_SUPPRESS_ITEM(ZZP[0][0].F,0)*/
+SIGNAL_MAPPING(DATA12,ZZP1_1_L_1,vme.tdc2.data[8],ZZP[0][0].L[0]);/*,ZERO_SUPPRESS_ITEM(ZZP[0][0].L,0)*/
+SIGNAL_MAPPING(DATA12,ZZP1_1_U_1,vme.tdc2.data[7],ZZP[0][0].U[0]);/*,ZERO_SUPPRESS_ITEM(ZZP[0][0].U,0)*/
+SIGNAL_MAPPING(uint8,plain_c,plain.c,plain.c);
+SIGNAL_MAPPING(uint16,plain_s,plain.s,plain.s);
+SIGNAL_MAPPING(uint32,plain_u,plain.u,plain.u);
+
+/** END_EVENT_DATA_MAPPING ********************************************/
+/** BEGIN_EVENT_DATA_MAPPING *******************************************
+ *
+ * Event data mapping.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// The order in this file does not matter.
+// This information parsed once and not treated eventwise,
+// it is used to initialize a structure.
+
+STICKY_MAPPING(uint32,corrbase,corr.base,corrbase);
+
+/** END_EVENT_DATA_MAPPING ********************************************/
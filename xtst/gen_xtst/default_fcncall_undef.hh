@@ -0,0 +1,62 @@
+/***********************************************************************
+ *
+ * Default undef for fcncall,
+ *
+ * Do not edit - automatically generated.
+ */
+
+#ifdef __DEFAULT_DEF_FCNCALL_CALL_CTRL_WRAP
+#undef __DEFAULT_DEF_FCNCALL_CALL_CTRL_WRAP
+#undef               FCNCALL_CALL_CTRL_WRAP
+#endif
+
+#ifdef __DEFAULT_DEF_FCNCALL_CALL_CTRL_WRAP_ARRAY
+#undef __DEFAULT_DEF_FCNCALL_CALL_CTRL_WRAP_ARRAY
+#undef               FCNCALL_CALL_CTRL_WRAP_ARRAY
+#endif
+
+#ifdef __DEFAULT_DEF_FCNCALL_INIT
+#undef __DEFAULT_DEF_FCNCALL_INIT
+#undef               FCNCALL_INIT
+#endif
+
+#ifdef __DEFAULT_DEF_FCNCALL_RET
+#undef __DEFAULT_DEF_FCNCALL_RET
+#undef               FCNCALL_RET
+#endif
+
+#ifdef __DEFAULT_DEF_FCNCALL_RET_TYPE
+#undef __DEFAULT_DEF_FCNCALL_RET_TYPE
+#undef               FCNCALL_RET_TYPE
+#endif
+
+#ifdef __DEFAULT_DEF_FCNCALL_SUBINDEX
+#undef __DEFAULT_DEF_FCNCALL_SUBINDEX
+#undef               FCNCALL_SUBINDEX
+#endif
+
+#ifdef __DEFAULT_DEF_FCNCALL_SUBINDEX_END
+#undef __DEFAULT_DEF_FCNCALL_SUBINDEX_END
+#undef               FCNCALL_SUBINDEX_END
+#endif
+
+#ifdef __DEFAULT_DEF_FCNCALL_SUBNAME
+#undef __DEFAULT_DEF_FCNCALL_SUBNAME
+#undef               FCNCALL_SUBNAME
+#endif
+
+#ifdef __DEFAULT_DEF_FCNCALL_SUBNAME_END
+#undef __DEFAULT_DEF_FCNCALL_SUBNAME_END
+#undef               FCNCALL_SUBNAME_END
+#endif
+
+#ifdef __DEFAULT_DEF_FCNCALL_TEMPLATE
+#undef __DEFAULT_DEF_FCNCALL_TEMPLATE
+#undef               FCNCALL_TEMPLATE
+#endif
+
+#ifdef __DEFAULT_DEF_FCNCALL_UNIT
+#undef __DEFAULT_DEF_FCNCALL_UNIT
+#undef               FCNCALL_UNIT
+#endif
+
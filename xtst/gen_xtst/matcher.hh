@@ -0,0 +1,1821 @@
+/** BEGIN_MATCHER ******************************************************
+ *
+ * Event matcher for CAMAC_LECROY_4434.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// CAMAC_LECROY_4434(channels)
+template<typename __data_src_t>
+bool CAMAC_LECROY_4434::__match(__data_src_t &__buffer,uint32 channels)
+{
+  // MEMBER(DATA24 data[32] ZERO_SUPPRESS);
+  // list(0<=index<channels)
+
+  for (uint32 index = 0; index < (uint32) (channels); ++index)
+  {
+    // UINT32 ch_data NOENCODE
+    // {
+      //  0_23: value;
+      // 24_31: 0;
+      // ENCODE(data[index],(value=value));
+    // }
+    union
+    {
+      struct
+      {
+#if __BYTE_ORDER == __LITTLE_ENDIAN
+        uint32 value : 24; // 0..23
+        uint32 unnamed_24_31 : 8; // 24..31
+#endif
+#if __BYTE_ORDER == __BIG_ENDIAN
+        uint32 unnamed_24_31 : 8; // 24..31
+        uint32 value : 24; // 0..23
+#endif
+      };
+      uint32  u32;
+    } ch_data;
+    MATCH_READ_FROM_BUFFER_FULL(24,uint32 ,ch_data,ch_data.u32,1);
+    MATCH_BITS_EQUAL(21,ch_data.unnamed_24_31,0);
+    return true;
+    return false;
+  }
+  return false;
+}
+FORCE_IMPL_DATA_SRC_FCN_ARG(bool,CAMAC_LECROY_4434::__match,uint32 channels);
+
+/** END_MATCHER *******************************************************/
+/** BEGIN_MATCHER ******************************************************
+ *
+ * Event matcher for CAMAC_PHILLIPS_7164.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// CAMAC_PHILLIPS_7164(channels,mark_channel_no)
+template<typename __data_src_t>
+bool CAMAC_PHILLIPS_7164::__match(__data_src_t &__buffer,uint32 channels
+                                                        ,uint32 mark_channel_no)
+{
+  // MEMBER(DATA12 data[16] ZERO_SUPPRESS);
+  // list(0<=index<channels)
+
+  for (uint32 index = 0; index < (uint32) (channels); ++index)
+  {
+    // if(mark_channel_no)
+
+    // else
+
+    if (mark_channel_no)
+    {
+      // UINT16 ch_data NOENCODE
+      // {
+        //  0_11: value;
+        // 12_15: channel = CHECK(index);
+        // ENCODE(data[index],(value=value));
+      // }
+      union
+      {
+        struct
+        {
+#if __BYTE_ORDER == __LITTLE_ENDIAN
+          uint16 value : 12; // 0..11
+          uint16 channel : 4; // 12..15
+#endif
+#if __BYTE_ORDER == __BIG_ENDIAN
+          uint16 channel : 4; // 12..15
+          uint16 value : 12; // 0..11
+#endif
+        };
+        uint16  u16;
+      } ch_data;
+      MATCH_READ_FROM_BUFFER_FULL(72,uint16 ,ch_data,ch_data.u16,4);
+      MATCH_BITS_EQUAL(69,ch_data.channel,index);
+      return true;
+      return false;
+    }
+
+    else
+    {
+      // UINT16 ch_data NOENCODE
+      // {
+        //  0_11: value;
+        // ENCODE(data[index],(value=value));
+      // }
+      union
+      {
+        struct
+        {
+#if __BYTE_ORDER == __LITTLE_ENDIAN
+          uint16 value : 12; // 0..11
+          uint16 dummy_12_15 : 4;
+#endif
+#if __BYTE_ORDER == __BIG_ENDIAN
+          uint16 dummy_12_15 : 4;
+          uint16 value : 12; // 0..11
+#endif
+        };
+        uint16  u16;
+      } ch_data;
+      MATCH_READ_FROM_BUFFER_FULL(79,uint16 ,ch_data,ch_data.u16,5);
+      MATCH_UNNAMED_BITS_ZERO(79,ch_data.u16,0xf000);
+      return true;
+      return false;
+    }
+    return false;
+  }
+  return false;
+}
+FORCE_IMPL_DATA_SRC_FCN_ARG(bool,CAMAC_PHILLIPS_7164::__match,uint32 channels
+                                                             ,uint32 mark_channel_no);
+
+/** END_MATCHER *******************************************************/
+/** BEGIN_MATCHER ******************************************************
+ *
+ * Event matcher for CAMAC_SILENA_4418.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// CAMAC_SILENA_4418(channels,mark_channel_no)
+template<typename __data_src_t>
+bool CAMAC_SILENA_4418::__match(__data_src_t &__buffer,uint32 channels,uint32 mark_channel_no)
+{
+  // MEMBER(DATA12_OVERFLOW data[8] ZERO_SUPPRESS);
+  // list(0<=index<channels)
+
+  for (uint32 index = 0; index < (uint32) (channels); ++index)
+  {
+    // if(mark_channel_no)
+
+    // else
+
+    if (mark_channel_no)
+    {
+      // UINT16 ch_data NOENCODE
+      // {
+        //  0_11: value;
+        // 12_14: channel = CHECK(index);
+        //    15: overflow;
+        // ENCODE(data[index],(value=value,overflow=overflow));
+      // }
+      union
+      {
+        struct
+        {
+#if __BYTE_ORDER == __LITTLE_ENDIAN
+          uint16 value : 12; // 0..11
+          uint16 channel : 3; // 12..14
+          uint16 overflow : 1; // 15
+#endif
+#if __BYTE_ORDER == __BIG_ENDIAN
+          uint16 overflow : 1; // 15
+          uint16 channel : 3; // 12..14
+          uint16 value : 12; // 0..11
+#endif
+        };
+        uint16  u16;
+      } ch_data;
+      MATCH_READ_FROM_BUFFER_FULL(44,uint16 ,ch_data,ch_data.u16,8);
+      MATCH_BITS_EQUAL(40,ch_data.channel,index);
+      return true;
+      return false;
+    }
+
+    else
+    {
+      // UINT16 ch_data NOENCODE
+      // {
+        //  0_11: value;
+        //    15: overflow;
+        // ENCODE(data[index],(value=value,overflow=overflow));
+      // }
+      union
+      {
+        struct
+        {
+#if __BYTE_ORDER == __LITTLE_ENDIAN
+          uint16 value : 12; // 0..11
+          uint16 dummy_12_14 : 3;
+          uint16 overflow : 1; // 15
+#endif
+#if __BYTE_ORDER == __BIG_ENDIAN
+          uint16 overflow : 1; // 15
+          uint16 dummy_12_14 : 3;
+          uint16 value : 12; // 0..11
+#endif
+        };
+        uint16  u16;
+      } ch_data;
+      MATCH_READ_FROM_BUFFER_FULL(52,uint16 ,ch_data,ch_data.u16,9);
+      MATCH_UNNAMED_BITS_ZERO(52,ch_data.u16,0x7000);
+      return true;
+      return false;
+    }
+    return false;
+  }
+  return false;
+}
+FORCE_IMPL_DATA_SRC_FCN_ARG(bool,CAMAC_SILENA_4418::__match,uint32 channels
+                                                           ,uint32 mark_channel_no);
+
+/** END_MATCHER *******************************************************/
+/** BEGIN_MATCHER ******************************************************
+ *
+ * Event matcher for FASTBUS_LECROY_1875.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// FASTBUS_LECROY_1875(geom,channels)
+template<typename __data_src_t>
+bool FASTBUS_LECROY_1875::__match(__data_src_t &__buffer,uint32 geom,uint32 channels)
+{
+  // MEMBER(DATA12_RANGE data[64] ZERO_SUPPRESS);
+  // UINT32 ch_data NOENCODE
+  // {
+    //  0_11: value;
+    // 16_21: channel = RANGE(0,(channels - 1));
+    //    23: range;
+    // 24_26: n = CHECK(0);
+    // 27_31: geom = MATCH(geom);
+    // ENCODE(data[channel],(value=value,range=range));
+  // }
+  union
+  {
+    struct
+    {
+#if __BYTE_ORDER == __LITTLE_ENDIAN
+      uint32 value : 12; // 0..11
+      uint32 dummy_12_15 : 4;
+      uint32 channel : 6; // 16..21
+      uint32 dummy_22 : 1;
+      uint32 range : 1; // 23
+      uint32 n : 3; // 24..26
+      uint32 geom : 5; // 27..31
+#endif
+#if __BYTE_ORDER == __BIG_ENDIAN
+      uint32 geom : 5; // 27..31
+      uint32 n : 3; // 24..26
+      uint32 range : 1; // 23
+      uint32 dummy_22 : 1;
+      uint32 channel : 6; // 16..21
+      uint32 dummy_12_15 : 4;
+      uint32 value : 12; // 0..11
+#endif
+    };
+    uint32  u32;
+  } ch_data;
+  MATCH_READ_FROM_BUFFER_FULL(102,uint32 ,ch_data,ch_data.u32,11);
+  MATCH_BITS_RANGE_MAX(95,ch_data.channel,(channels - 1));
+  MATCH_BITS_EQUAL(98,ch_data.n,0);
+  MATCH_BITS_EQUAL(99,ch_data.geom,geom);
+  MATCH_UNNAMED_BITS_ZERO(102,ch_data.u32,0x0040f000);
+  return true;
+  return false;
+}
+FORCE_IMPL_DATA_SRC_FCN_ARG(bool,FASTBUS_LECROY_1875::__match,uint32 geom
+                                                             ,uint32 channels);
+
+/** END_MATCHER *******************************************************/
+/** BEGIN_MATCHER ******************************************************
+ *
+ * Event matcher for FASTBUS_LECROY_1885.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// FASTBUS_LECROY_1885(geom,channels)
+template<typename __data_src_t>
+bool FASTBUS_LECROY_1885::__match(__data_src_t &__buffer,uint32 geom,uint32 channels)
+{
+  // MEMBER(DATA12_RANGE data[96] ZERO_SUPPRESS);
+  // UINT32 ch_data NOENCODE
+  // {
+    //  0_11: value;
+    // 16_22: channel = RANGE(0,(channels - 1));
+    //    23: range;
+    // 24_26: n = CHECK(0);
+    // 27_31: geom = MATCH(geom);
+    // ENCODE(data[channel],(value=value,range=range));
+  // }
+  union
+  {
+    struct
+    {
+#if __BYTE_ORDER == __LITTLE_ENDIAN
+      uint32 value : 12; // 0..11
+      uint32 dummy_12_15 : 4;
+      uint32 channel : 7; // 16..22
+      uint32 range : 1; // 23
+      uint32 n : 3; // 24..26
+      uint32 geom : 5; // 27..31
+#endif
+#if __BYTE_ORDER == __BIG_ENDIAN
+      uint32 geom : 5; // 27..31
+      uint32 n : 3; // 24..26
+      uint32 range : 1; // 23
+      uint32 channel : 7; // 16..22
+      uint32 dummy_12_15 : 4;
+      uint32 value : 12; // 0..11
+#endif
+    };
+    uint32  u32;
+  } ch_data;
+  MATCH_READ_FROM_BUFFER_FULL(119,uint32 ,ch_data,ch_data.u32,13);
+  MATCH_BITS_RANGE_MAX(113,ch_data.channel,(channels - 1));
+  MATCH_BITS_EQUAL(115,ch_data.n,0);
+  MATCH_BITS_EQUAL(116,ch_data.geom,geom);
+  MATCH_UNNAMED_BITS_ZERO(119,ch_data.u32,0x0000f000);
+  return true;
+  return false;
+}
+FORCE_IMPL_DATA_SRC_FCN_ARG(bool,FASTBUS_LECROY_1885::__match,uint32 geom
+                                                             ,uint32 channels);
+
+/** END_MATCHER *******************************************************/
+/** BEGIN_MATCHER ******************************************************
+ *
+ * Event matcher for ITEM64.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// ITEM64(num)
+template<typename __data_src_t>
+bool ITEM64::__match(__data_src_t &__buffer,uint32 num)
+{
+  // MEMBER(DATA64 member64);
+  // UINT64 a
+  // {
+    //  0_01: 0;
+    //  5_07: num = MATCH(num);
+  // }
+  union
+  {
+    struct
+    {
+#if __BYTE_ORDER == __LITTLE_ENDIAN
+      uint64 unnamed_0_1 : 2; // 0..1
+      uint64 dummy_2_4 : 3;
+      uint64 num : 3; // 5..7
+      uint64 dummy_8_63 : 56;
+#endif
+#if __BYTE_ORDER == __BIG_ENDIAN
+      uint64 dummy_8_63 : 56;
+      uint64 num : 3; // 5..7
+      uint64 dummy_2_4 : 3;
+      uint64 unnamed_0_1 : 2; // 0..1
+#endif
+    };
+    uint64  u64;
+  } __a;
+  MATCH_READ_FROM_BUFFER_FULL(834,uint64 ,a,__a.u64,17);
+  MATCH_BITS_EQUAL(833,__a.unnamed_0_1,0);
+  MATCH_BITS_EQUAL(832,__a.num,num);
+  MATCH_UNNAMED_BITS_ZERO(834,__a.u64,0xffffffffffffff1cll);
+  return true;
+  return false;
+}
+FORCE_IMPL_DATA_SRC_FCN_ARG(bool,ITEM64::__match,uint32 num);
+
+/** END_MATCHER *******************************************************/
+/** BEGIN_MATCHER ******************************************************
+ *
+ * Event matcher for ITEMQ.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// ITEMQ(num)
+template<typename __data_src_t>
+bool ITEMQ::__match(__data_src_t &__buffer,uint32 num)
+{
+  // MEMBER(DATA32 chan);
+  // UINT64 w1
+  // {
+    //    21: c21;
+  // }
+  union
+  {
+    struct
+    {
+#if __BYTE_ORDER == __LITTLE_ENDIAN
+      uint64 dummy_0_20 : 21;
+      uint64 c21 : 1; // 21
+      uint64 dummy_22_63 : 42;
+#endif
+#if __BYTE_ORDER == __BIG_ENDIAN
+      uint64 dummy_22_63 : 42;
+      uint64 c21 : 1; // 21
+      uint64 dummy_0_20 : 21;
+#endif
+    };
+    uint64  u64;
+  } __w1;
+  MATCH_READ_FROM_BUFFER_FULL(864,uint64 ,w1,__w1.u64,20);
+  MATCH_UNNAMED_BITS_ZERO(864,__w1.u64,0xffffffffffdfffffll);
+  return true;
+  return false;
+}
+FORCE_IMPL_DATA_SRC_FCN_ARG(bool,ITEMQ::__match,uint32 num);
+
+/** END_MATCHER *******************************************************/
+/** BEGIN_MATCHER ******************************************************
+ *
+ * Event matcher for ITEM_ME2.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// ITEM_ME2(geom)
+template<typename __data_src_t>
+bool ITEM_ME2::__match(__data_src_t &__buffer,uint32 geom)
+{
+  // MEMBER(DATA16 data[32] ZERO_SUPPRESS);
+  // optional UINT32 padding NOENCODE
+  // {
+    //  0_31: value = MATCH(0x32323232);
+  // }
+  union
+  {
+    struct
+    {
+#if __BYTE_ORDER == __LITTLE_ENDIAN
+      uint32 value : 32; // 0..31
+#endif
+#if __BYTE_ORDER == __BIG_ENDIAN
+      uint32 value : 32; // 0..31
+#endif
+    };
+    uint32  u32;
+  } padding;
+  if (__buffer.empty()) goto data_done_1;
+  PEEK_FROM_BUFFER_FULL(906,uint32 ,padding,padding.u32,24);
+  MATCH_BITS_EQUAL(905,padding.value,0x32323232);
+  __buffer.advance(sizeof(padding.u32));
+  data_done_1:;
+  // UINT32 header NOENCODE
+  // {
+    // 16_23: geom = MATCH(geom);
+  // }
+  union
+  {
+    struct
+    {
+#if __BYTE_ORDER == __LITTLE_ENDIAN
+      uint32 dummy_0_15 : 16;
+      uint32 geom : 8; // 16..23
+      uint32 dummy_24_31 : 8;
+#endif
+#if __BYTE_ORDER == __BIG_ENDIAN
+      uint32 dummy_24_31 : 8;
+      uint32 geom : 8; // 16..23
+      uint32 dummy_0_15 : 16;
+#endif
+    };
+    uint32  u32;
+  } header;
+  MATCH_READ_FROM_BUFFER_FULL(910,uint32 ,header,header.u32,25);
+  MATCH_BITS_EQUAL(909,header.geom,geom);
+  MATCH_UNNAMED_BITS_ZERO(910,header.u32,0xff00ffff);
+  // MATCH_END;
+  return true;
+  return false;
+}
+FORCE_IMPL_DATA_SRC_FCN_ARG(bool,ITEM_ME2::__match,uint32 geom);
+
+/** END_MATCHER *******************************************************/
+/** BEGIN_MATCHER ******************************************************
+ *
+ * Event matcher for MADC32.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// MADC32(res,geo,channels)
+template<typename __data_src_t>
+bool MADC32::__match(__data_src_t &__buffer,uint32 res,uint32 geo,uint32 channels)
+{
+  // UINT32 header
+  // {
+    //  0_11: word_counts;
+    // 12_14: resolution = MATCH(res);
+    //    15: unused1;
+    // 16_23: id = MATCH(geo);
+    // 24_29: 0;
+    // 30_31: 1;
+  // }
+  union
+  {
+    struct
+    {
+#if __BYTE_ORDER == __LITTLE_ENDIAN
+      uint32 word_counts : 12; // 0..11
+      uint32 resolution : 3; // 12..14
+      uint32 unused1 : 1; // 15
+      uint32 id : 8; // 16..23
+      uint32 unnamed_24_29 : 6; // 24..29
+      uint32 unnamed_30_31 : 2; // 30..31
+#endif
+#if __BYTE_ORDER == __BIG_ENDIAN
+      uint32 unnamed_30_31 : 2; // 30..31
+      uint32 unnamed_24_29 : 6; // 24..29
+      uint32 id : 8; // 16..23
+      uint32 unused1 : 1; // 15
+      uint32 resolution : 3; // 12..14
+      uint32 word_counts : 12; // 0..11
+#endif
+    };
+    uint32  u32;
+  } __header;
+  MATCH_READ_FROM_BUFFER_FULL(1203,uint32 ,header,__header.u32,31);
+  MATCH_BITS_EQUAL(1198,__header.resolution,res);
+  MATCH_BITS_EQUAL(1200,__header.id,geo);
+  MATCH_BITS_EQUAL(1201,__header.unnamed_24_29,0);
+  MATCH_BITS_EQUAL(1202,__header.unnamed_30_31,1);
+  return true;
+  return false;
+}
+FORCE_IMPL_DATA_SRC_FCN_ARG(bool,MADC32::__match,uint32 res,uint32 geo,uint32 channels);
+
+/** END_MATCHER *******************************************************/
+/** BEGIN_MATCHER ******************************************************
+ *
+ * Event matcher for SINGLE_DATA_MODULE.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// SINGLE_DATA_MODULE()
+template<typename __data_src_t>
+bool SINGLE_DATA_MODULE::__match(__data_src_t &__buffer)
+{
+  // UINT32 data;
+  uint32  __data;
+  MATCH_READ_FROM_BUFFER(760,uint32 ,__data,33);
+  return true;
+  return false;
+}
+FORCE_IMPL_DATA_SRC_FCN(bool,SINGLE_DATA_MODULE::__match);
+
+/** END_MATCHER *******************************************************/
+/** BEGIN_MATCHER ******************************************************
+ *
+ * Event matcher for STICKY_ACTIVE.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// STICKY_ACTIVE()
+template<typename __data_src_t>
+bool STICKY_ACTIVE::__match(__data_src_t &__buffer)
+{
+  // UINT32 separator
+  // {
+    //  0_31: 7;
+  // }
+  union
+  {
+    struct
+    {
+#if __BYTE_ORDER == __LITTLE_ENDIAN
+      uint32 unnamed_0_31 : 32; // 0..31
+#endif
+#if __BYTE_ORDER == __BIG_ENDIAN
+      uint32 unnamed_0_31 : 32; // 0..31
+#endif
+    };
+    uint32  u32;
+  } __separator;
+  MATCH_READ_FROM_BUFFER_FULL(943,uint32 ,separator,__separator.u32,38);
+  MATCH_BITS_EQUAL(942,__separator.unnamed_0_31,7);
+  return true;
+  return false;
+}
+FORCE_IMPL_DATA_SRC_FCN(bool,STICKY_ACTIVE::__match);
+
+/** END_MATCHER *******************************************************/
+/** BEGIN_MATCHER ******************************************************
+ *
+ * Event matcher for VME_CAEN_V1190_SUBTDC.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// VME_CAEN_V1190_SUBTDC(tdc,event_id,data)
+template<typename __data_src_t>
+bool VME_CAEN_V1190_SUBTDC::__match(__data_src_t &__buffer,uint32 tdc,uint32 event_id)
+{
+  // MEMBER(DATA24 data[32] ZERO_SUPPRESS_MULTI(128));
+  // MARK_COUNT(tdc_start);
+  // UINT32 header
+  // {
+    //  0_11: bunch_id;
+    // 12_23: event_id = CHECK(event_id);
+    // 24_25: tdc = MATCH(tdc);
+    // 27_31: 1;
+  // }
+  union
+  {
+    struct
+    {
+#if __BYTE_ORDER == __LITTLE_ENDIAN
+      uint32 bunch_id : 12; // 0..11
+      uint32 event_id : 12; // 12..23
+      uint32 tdc : 2; // 24..25
+      uint32 dummy_26 : 1;
+      uint32 unnamed_27_31 : 5; // 27..31
+#endif
+#if __BYTE_ORDER == __BIG_ENDIAN
+      uint32 unnamed_27_31 : 5; // 27..31
+      uint32 dummy_26 : 1;
+      uint32 tdc : 2; // 24..25
+      uint32 event_id : 12; // 12..23
+      uint32 bunch_id : 12; // 0..11
+#endif
+    };
+    uint32  u32;
+  } __header;
+  MATCH_READ_FROM_BUFFER_FULL(423,uint32 ,header,__header.u32,43);
+  MATCH_BITS_EQUAL(419,__header.event_id,event_id);
+  MATCH_BITS_EQUAL(421,__header.tdc,tdc);
+  MATCH_BITS_EQUAL(422,__header.unnamed_27_31,1);
+  MATCH_UNNAMED_BITS_ZERO(423,__header.u32,0x04000000);
+  return true;
+  return false;
+}
+FORCE_IMPL_DATA_SRC_FCN_ARG(bool,VME_CAEN_V1190_SUBTDC::__match,uint32 tdc
+                                                               ,uint32 event_id);
+
+/** END_MATCHER *******************************************************/
+/** BEGIN_MATCHER ******************************************************
+ *
+ * Event matcher for VME_CAEN_V1190.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// VME_CAEN_V1190(geom)
+template<typename __data_src_t>
+bool VME_CAEN_V1190::__match(__data_src_t &__buffer,uint32 geom)
+{
+  // MEMBER(DATA24 data[32] ZERO_SUPPRESS_MULTI(128));
+  // MARK_COUNT(v1190_start);
+  // UINT32 header
+  // {
+    //  0_04: geom = MATCH(geom);
+    //  5_26: event_number;
+    // 27_31: 8;
+  // }
+  union
+  {
+    struct
+    {
+#if __BYTE_ORDER == __LITTLE_ENDIAN
+      uint32 geom : 5; // 0..4
+      uint32 event_number : 22; // 5..26
+      uint32 unnamed_27_31 : 5; // 27..31
+#endif
+#if __BYTE_ORDER == __BIG_ENDIAN
+      uint32 unnamed_27_31 : 5; // 27..31
+      uint32 event_number : 22; // 5..26
+      uint32 geom : 5; // 0..4
+#endif
+    };
+    uint32  u32;
+  } __header;
+  MATCH_READ_FROM_BUFFER_FULL(484,uint32 ,header,__header.u32,47);
+  MATCH_BITS_EQUAL(481,__header.geom,geom);
+  MATCH_BITS_EQUAL(483,__header.unnamed_27_31,8);
+  return true;
+  return false;
+}
+FORCE_IMPL_DATA_SRC_FCN_ARG(bool,VME_CAEN_V1190::__match,uint32 geom);
+
+/** END_MATCHER *******************************************************/
+/** BEGIN_MATCHER ******************************************************
+ *
+ * Event matcher for VME_CAEN_V1190_SHORT_SUBTDC.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// VME_CAEN_V1190_SHORT_SUBTDC(tdc,event_id,data)
+template<typename __data_src_t>
+bool VME_CAEN_V1190_SHORT_SUBTDC::__match(__data_src_t &__buffer,uint32 tdc
+                                                                ,uint32 event_id)
+{
+  // MEMBER(DATA24 data[32] ZERO_SUPPRESS_MULTI(128));
+  // UINT32 ch_data NOENCODE
+  // {
+    //  0_18: value;
+    // 19_23: channel_low;
+    // 24_25: tdc = CHECK(tdc);
+    //    26: trailing;
+    // 27_31: 0;
+    // ENCODE(data[((tdc << 5) | channel_low)],(value=value));
+  // }
+  union
+  {
+    struct
+    {
+#if __BYTE_ORDER == __LITTLE_ENDIAN
+      uint32 value : 19; // 0..18
+      uint32 channel_low : 5; // 19..23
+      uint32 tdc : 2; // 24..25
+      uint32 trailing : 1; // 26
+      uint32 unnamed_27_31 : 5; // 27..31
+#endif
+#if __BYTE_ORDER == __BIG_ENDIAN
+      uint32 unnamed_27_31 : 5; // 27..31
+      uint32 trailing : 1; // 26
+      uint32 tdc : 2; // 24..25
+      uint32 channel_low : 5; // 19..23
+      uint32 value : 19; // 0..18
+#endif
+    };
+    uint32  u32;
+  } ch_data;
+  MATCH_READ_FROM_BUFFER_FULL(547,uint32 ,ch_data,ch_data.u32,49);
+  MATCH_BITS_EQUAL(532,ch_data.tdc,tdc);
+  MATCH_BITS_EQUAL(537,ch_data.unnamed_27_31,0);
+  return true;
+  return false;
+}
+FORCE_IMPL_DATA_SRC_FCN_ARG(bool,VME_CAEN_V1190_SHORT_SUBTDC::__match,uint32 tdc
+                                                                     ,uint32 event_id);
+
+/** END_MATCHER *******************************************************/
+/** BEGIN_MATCHER ******************************************************
+ *
+ * Event matcher for VME_CAEN_V1190_SHORT_SUBTDC_ERROR.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// VME_CAEN_V1190_SHORT_SUBTDC_ERROR(tdc)
+template<typename __data_src_t>
+bool VME_CAEN_V1190_SHORT_SUBTDC_ERROR::__match(__data_src_t &__buffer,uint32 tdc)
+{
+  // UINT32 error_flags
+  // {
+    //  0_14: flags;
+    // 24_25: tdc = CHECK(tdc);
+    // 27_31: 4;
+  // }
+  union
+  {
+    struct
+    {
+#if __BYTE_ORDER == __LITTLE_ENDIAN
+      uint32 flags : 15; // 0..14
+      uint32 dummy_15_23 : 9;
+      uint32 tdc : 2; // 24..25
+      uint32 dummy_26 : 1;
+      uint32 unnamed_27_31 : 5; // 27..31
+#endif
+#if __BYTE_ORDER == __BIG_ENDIAN
+      uint32 unnamed_27_31 : 5; // 27..31
+      uint32 dummy_26 : 1;
+      uint32 tdc : 2; // 24..25
+      uint32 dummy_15_23 : 9;
+      uint32 flags : 15; // 0..14
+#endif
+    };
+    uint32  u32;
+  } __error_flags;
+  MATCH_READ_FROM_BUFFER_FULL(558,uint32 ,error_flags,__error_flags.u32,51);
+  MATCH_BITS_EQUAL(556,__error_flags.tdc,tdc);
+  MATCH_BITS_EQUAL(557,__error_flags.unnamed_27_31,4);
+  MATCH_UNNAMED_BITS_ZERO(558,__error_flags.u32,0x04ff8000);
+  return true;
+  return false;
+}
+FORCE_IMPL_DATA_SRC_FCN_ARG(bool,VME_CAEN_V1190_SHORT_SUBTDC_ERROR::__match,uint32 tdc);
+
+/** END_MATCHER *******************************************************/
+/** BEGIN_MATCHER ******************************************************
+ *
+ * Event matcher for VME_CAEN_V1190_SHORT.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// VME_CAEN_V1190_SHORT(geom)
+template<typename __data_src_t>
+bool VME_CAEN_V1190_SHORT::__match(__data_src_t &__buffer,uint32 geom)
+{
+  // MEMBER(DATA24 data[32] ZERO_SUPPRESS_MULTI(128));
+  // MARK_COUNT(v1190_start);
+  // UINT32 header
+  // {
+    //  0_04: geom = MATCH(geom);
+    //  5_26: event_number;
+    // 27_31: 8;
+  // }
+  union
+  {
+    struct
+    {
+#if __BYTE_ORDER == __LITTLE_ENDIAN
+      uint32 geom : 5; // 0..4
+      uint32 event_number : 22; // 5..26
+      uint32 unnamed_27_31 : 5; // 27..31
+#endif
+#if __BYTE_ORDER == __BIG_ENDIAN
+      uint32 unnamed_27_31 : 5; // 27..31
+      uint32 event_number : 22; // 5..26
+      uint32 geom : 5; // 0..4
+#endif
+    };
+    uint32  u32;
+  } __header;
+  MATCH_READ_FROM_BUFFER_FULL(573,uint32 ,header,__header.u32,55);
+  MATCH_BITS_EQUAL(570,__header.geom,geom);
+  MATCH_BITS_EQUAL(572,__header.unnamed_27_31,8);
+  return true;
+  return false;
+}
+FORCE_IMPL_DATA_SRC_FCN_ARG(bool,VME_CAEN_V1190_SHORT::__match,uint32 geom);
+
+/** END_MATCHER *******************************************************/
+/** BEGIN_MATCHER ******************************************************
+ *
+ * Event matcher for VME_CAEN_V1290_SUBTDC.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// VME_CAEN_V1290_SUBTDC(tdc,event_id,data)
+template<typename __data_src_t>
+bool VME_CAEN_V1290_SUBTDC::__match(__data_src_t &__buffer,uint32 tdc,uint32 event_id)
+{
+  // MEMBER(DATA24 data[32] ZERO_SUPPRESS_MULTI(128));
+  // MARK_COUNT(tdc_start);
+  // UINT32 header
+  // {
+    //  0_11: bunch_id;
+    // 12_23: event_id = CHECK(event_id);
+    // 24_25: tdc = MATCH(tdc);
+    // 27_31: 1;
+  // }
+  union
+  {
+    struct
+    {
+#if __BYTE_ORDER == __LITTLE_ENDIAN
+      uint32 bunch_id : 12; // 0..11
+      uint32 event_id : 12; // 12..23
+      uint32 tdc : 2; // 24..25
+      uint32 dummy_26 : 1;
+      uint32 unnamed_27_31 : 5; // 27..31
+#endif
+#if __BYTE_ORDER == __BIG_ENDIAN
+      uint32 unnamed_27_31 : 5; // 27..31
+      uint32 dummy_26 : 1;
+      uint32 tdc : 2; // 24..25
+      uint32 event_id : 12; // 12..23
+      uint32 bunch_id : 12; // 0..11
+#endif
+    };
+    uint32  u32;
+  } __header;
+  MATCH_READ_FROM_BUFFER_FULL(218,uint32 ,header,__header.u32,60);
+  MATCH_BITS_EQUAL(214,__header.event_id,event_id);
+  MATCH_BITS_EQUAL(216,__header.tdc,tdc);
+  MATCH_BITS_EQUAL(217,__header.unnamed_27_31,1);
+  MATCH_UNNAMED_BITS_ZERO(218,__header.u32,0x04000000);
+  return true;
+  return false;
+}
+FORCE_IMPL_DATA_SRC_FCN_ARG(bool,VME_CAEN_V1290_SUBTDC::__match,uint32 tdc
+                                                               ,uint32 event_id);
+
+/** END_MATCHER *******************************************************/
+/** BEGIN_MATCHER ******************************************************
+ *
+ * Event matcher for VME_CAEN_V1290.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// VME_CAEN_V1290(geom)
+template<typename __data_src_t>
+bool VME_CAEN_V1290::__match(__data_src_t &__buffer,uint32 geom)
+{
+  // MEMBER(DATA24 data[32] ZERO_SUPPRESS_MULTI(128));
+  // MARK_COUNT(v1190_start);
+  // UINT32 header
+  // {
+    //  0_04: geom = MATCH(geom);
+    //  5_26: event_number;
+    // 27_31: 8;
+  // }
+  union
+  {
+    struct
+    {
+#if __BYTE_ORDER == __LITTLE_ENDIAN
+      uint32 geom : 5; // 0..4
+      uint32 event_number : 22; // 5..26
+      uint32 unnamed_27_31 : 5; // 27..31
+#endif
+#if __BYTE_ORDER == __BIG_ENDIAN
+      uint32 unnamed_27_31 : 5; // 27..31
+      uint32 event_number : 22; // 5..26
+      uint32 geom : 5; // 0..4
+#endif
+    };
+    uint32  u32;
+  } __header;
+  MATCH_READ_FROM_BUFFER_FULL(279,uint32 ,header,__header.u32,64);
+  MATCH_BITS_EQUAL(276,__header.geom,geom);
+  MATCH_BITS_EQUAL(278,__header.unnamed_27_31,8);
+  return true;
+  return false;
+}
+FORCE_IMPL_DATA_SRC_FCN_ARG(bool,VME_CAEN_V1290::__match,uint32 geom);
+
+/** END_MATCHER *******************************************************/
+/** BEGIN_MATCHER ******************************************************
+ *
+ * Event matcher for VME_CAEN_V1290_SHORT_SUBTDC.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// VME_CAEN_V1290_SHORT_SUBTDC(tdc,event_id,data)
+template<typename __data_src_t>
+bool VME_CAEN_V1290_SHORT_SUBTDC::__match(__data_src_t &__buffer,uint32 tdc
+                                                                ,uint32 event_id)
+{
+  // MEMBER(DATA24 data[32] ZERO_SUPPRESS_MULTI(128));
+  // UINT32 ch_data NOENCODE
+  // {
+    //  0_20: value;
+    // 21_23: channel_low;
+    // 24_25: tdc = CHECK(tdc);
+    //    26: trailing;
+    // 27_31: 0;
+    // ENCODE(data[((tdc << 3) | channel_low)],(value=value));
+  // }
+  union
+  {
+    struct
+    {
+#if __BYTE_ORDER == __LITTLE_ENDIAN
+      uint32 value : 21; // 0..20
+      uint32 channel_low : 3; // 21..23
+      uint32 tdc : 2; // 24..25
+      uint32 trailing : 1; // 26
+      uint32 unnamed_27_31 : 5; // 27..31
+#endif
+#if __BYTE_ORDER == __BIG_ENDIAN
+      uint32 unnamed_27_31 : 5; // 27..31
+      uint32 trailing : 1; // 26
+      uint32 tdc : 2; // 24..25
+      uint32 channel_low : 3; // 21..23
+      uint32 value : 21; // 0..20
+#endif
+    };
+    uint32  u32;
+  } ch_data;
+  MATCH_READ_FROM_BUFFER_FULL(342,uint32 ,ch_data,ch_data.u32,66);
+  MATCH_BITS_EQUAL(322,ch_data.tdc,tdc);
+  MATCH_BITS_EQUAL(332,ch_data.unnamed_27_31,0);
+  return true;
+  return false;
+}
+FORCE_IMPL_DATA_SRC_FCN_ARG(bool,VME_CAEN_V1290_SHORT_SUBTDC::__match,uint32 tdc
+                                                                     ,uint32 event_id);
+
+/** END_MATCHER *******************************************************/
+/** BEGIN_MATCHER ******************************************************
+ *
+ * Event matcher for VME_CAEN_V1290_SHORT_SUBTDC_ERROR.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// VME_CAEN_V1290_SHORT_SUBTDC_ERROR(tdc)
+template<typename __data_src_t>
+bool VME_CAEN_V1290_SHORT_SUBTDC_ERROR::__match(__data_src_t &__buffer,uint32 tdc)
+{
+  // UINT32 error_flags
+  // {
+    //  0_14: flags;
+    // 24_25: tdc = CHECK(tdc);
+    // 27_31: 4;
+  // }
+  union
+  {
+    struct
+    {
+#if __BYTE_ORDER == __LITTLE_ENDIAN
+      uint32 flags : 15; // 0..14
+      uint32 dummy_15_23 : 9;
+      uint32 tdc : 2; // 24..25
+      uint32 dummy_26 : 1;
+      uint32 unnamed_27_31 : 5; // 27..31
+#endif
+#if __BYTE_ORDER == __BIG_ENDIAN
+      uint32 unnamed_27_31 : 5; // 27..31
+      uint32 dummy_26 : 1;
+      uint32 tdc : 2; // 24..25
+      uint32 dummy_15_23 : 9;
+      uint32 flags : 15; // 0..14
+#endif
+    };
+    uint32  u32;
+  } __error_flags;
+  MATCH_READ_FROM_BUFFER_FULL(353,uint32 ,error_flags,__error_flags.u32,68);
+  MATCH_BITS_EQUAL(351,__error_flags.tdc,tdc);
+  MATCH_BITS_EQUAL(352,__error_flags.unnamed_27_31,4);
+  MATCH_UNNAMED_BITS_ZERO(353,__error_flags.u32,0x04ff8000);
+  return true;
+  return false;
+}
+FORCE_IMPL_DATA_SRC_FCN_ARG(bool,VME_CAEN_V1290_SHORT_SUBTDC_ERROR::__match,uint32 tdc);
+
+/** END_MATCHER *******************************************************/
+/** BEGIN_MATCHER ******************************************************
+ *
+ * Event matcher for VME_CAEN_V1290_SHORT.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// VME_CAEN_V1290_SHORT(geom)
+template<typename __data_src_t>
+bool VME_CAEN_V1290_SHORT::__match(__data_src_t &__buffer,uint32 geom)
+{
+  // MEMBER(DATA24 data[32] ZERO_SUPPRESS_MULTI(128));
+  // MARK_COUNT(v1190_start);
+  // UINT32 header
+  // {
+    //  0_04: geom = MATCH(geom);
+    //  5_26: event_number;
+    // 27_31: 8;
+  // }
+  union
+  {
+    struct
+    {
+#if __BYTE_ORDER == __LITTLE_ENDIAN
+      uint32 geom : 5; // 0..4
+      uint32 event_number : 22; // 5..26
+      uint32 unnamed_27_31 : 5; // 27..31
+#endif
+#if __BYTE_ORDER == __BIG_ENDIAN
+      uint32 unnamed_27_31 : 5; // 27..31
+      uint32 event_number : 22; // 5..26
+      uint32 geom : 5; // 0..4
+#endif
+    };
+    uint32  u32;
+  } __header;
+  MATCH_READ_FROM_BUFFER_FULL(368,uint32 ,header,__header.u32,72);
+  MATCH_BITS_EQUAL(365,__header.geom,geom);
+  MATCH_BITS_EQUAL(367,__header.unnamed_27_31,8);
+  return true;
+  return false;
+}
+FORCE_IMPL_DATA_SRC_FCN_ARG(bool,VME_CAEN_V1290_SHORT::__match,uint32 geom);
+
+/** END_MATCHER *******************************************************/
+/** BEGIN_MATCHER ******************************************************
+ *
+ * Event matcher for VME_CAEN_V775.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// VME_CAEN_V775(geom,crate)
+template<typename __data_src_t>
+bool VME_CAEN_V775::__match(__data_src_t &__buffer,uint32 geom,uint32 crate)
+{
+  // MEMBER(DATA12_OVERFLOW data[32] ZERO_SUPPRESS);
+  // UINT32 header NOENCODE
+  // {
+    //  8_13: count;
+    // 16_23: crate = MATCH(crate);
+    // 24_26: 2;
+    // 27_31: geom = MATCH(geom);
+  // }
+  union
+  {
+    struct
+    {
+#if __BYTE_ORDER == __LITTLE_ENDIAN
+      uint32 dummy_0_7 : 8;
+      uint32 count : 6; // 8..13
+      uint32 dummy_14_15 : 2;
+      uint32 crate : 8; // 16..23
+      uint32 unnamed_24_26 : 3; // 24..26
+      uint32 geom : 5; // 27..31
+#endif
+#if __BYTE_ORDER == __BIG_ENDIAN
+      uint32 geom : 5; // 27..31
+      uint32 unnamed_24_26 : 3; // 24..26
+      uint32 crate : 8; // 16..23
+      uint32 dummy_14_15 : 2;
+      uint32 count : 6; // 8..13
+      uint32 dummy_0_7 : 8;
+#endif
+    };
+    uint32  u32;
+  } header;
+  MATCH_READ_FROM_BUFFER_FULL(137,uint32 ,header,header.u32,76);
+  MATCH_BITS_EQUAL(134,header.crate,crate);
+  MATCH_BITS_EQUAL(135,header.unnamed_24_26,2);
+  MATCH_BITS_EQUAL(136,header.geom,geom);
+  MATCH_UNNAMED_BITS_ZERO(137,header.u32,0x0000c0ff);
+  return true;
+  return false;
+}
+FORCE_IMPL_DATA_SRC_FCN_ARG(bool,VME_CAEN_V775::__match,uint32 geom,uint32 crate);
+
+/** END_MATCHER *******************************************************/
+/** BEGIN_MATCHER ******************************************************
+ *
+ * Event matcher for VME_CAEN_V830.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// VME_CAEN_V830(geom)
+template<typename __data_src_t>
+bool VME_CAEN_V830::__match(__data_src_t &__buffer,uint32 geom)
+{
+  // MEMBER(DATA32 data[32] ZERO_SUPPRESS);
+  // UINT32 header
+  // {
+    //  0_15: event_number;
+    // 16_17: ts;
+    // 18_23: count;
+    //    26: 1;
+    // 27_31: geom = MATCH(geom);
+  // }
+  union
+  {
+    struct
+    {
+#if __BYTE_ORDER == __LITTLE_ENDIAN
+      uint32 event_number : 16; // 0..15
+      uint32 ts : 2; // 16..17
+      uint32 count : 6; // 18..23
+      uint32 dummy_24_25 : 2;
+      uint32 unnamed_26_26 : 1; // 26
+      uint32 geom : 5; // 27..31
+#endif
+#if __BYTE_ORDER == __BIG_ENDIAN
+      uint32 geom : 5; // 27..31
+      uint32 unnamed_26_26 : 1; // 26
+      uint32 dummy_24_25 : 2;
+      uint32 count : 6; // 18..23
+      uint32 ts : 2; // 16..17
+      uint32 event_number : 16; // 0..15
+#endif
+    };
+    uint32  u32;
+  } __header;
+  MATCH_READ_FROM_BUFFER_FULL(185,uint32 ,header,__header.u32,79);
+  MATCH_BITS_EQUAL(183,__header.unnamed_26_26,1);
+  MATCH_BITS_EQUAL(184,__header.geom,geom);
+  MATCH_UNNAMED_BITS_ZERO(185,__header.u32,0x03000000);
+  return true;
+  return false;
+}
+FORCE_IMPL_DATA_SRC_FCN_ARG(bool,VME_CAEN_V830::__match,uint32 geom);
+
+/** END_MATCHER *******************************************************/
+/** BEGIN_MATCHER ******************************************************
+ *
+ * Event matcher for VME_MESYTEC_MADC32.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// VME_MESYTEC_MADC32(geom)
+template<typename __data_src_t>
+bool VME_MESYTEC_MADC32::__match(__data_src_t &__buffer,uint32 geom)
+{
+  // MEMBER(DATA14_OVERFLOW data[32] ZERO_SUPPRESS);
+  // MARK_COUNT(start);
+  // UINT32 header NOENCODE
+  // {
+    //  0_11: word_number;
+    // 12_14: adc_resol;
+    //    15: out_form;
+    // 16_23: geom = MATCH(geom);
+    // 24_29: 0;
+    // 30_31: 1;
+  // }
+  union
+  {
+    struct
+    {
+#if __BYTE_ORDER == __LITTLE_ENDIAN
+      uint32 word_number : 12; // 0..11
+      uint32 adc_resol : 3; // 12..14
+      uint32 out_form : 1; // 15
+      uint32 geom : 8; // 16..23
+      uint32 unnamed_24_29 : 6; // 24..29
+      uint32 unnamed_30_31 : 2; // 30..31
+#endif
+#if __BYTE_ORDER == __BIG_ENDIAN
+      uint32 unnamed_30_31 : 2; // 30..31
+      uint32 unnamed_24_29 : 6; // 24..29
+      uint32 geom : 8; // 16..23
+      uint32 out_form : 1; // 15
+      uint32 adc_resol : 3; // 12..14
+      uint32 word_number : 12; // 0..11
+#endif
+    };
+    uint32  u32;
+  } header;
+  MATCH_READ_FROM_BUFFER_FULL(624,uint32 ,header,header.u32,84);
+  MATCH_BITS_EQUAL(621,header.geom,geom);
+  MATCH_BITS_EQUAL(622,header.unnamed_24_29,0);
+  MATCH_BITS_EQUAL(623,header.unnamed_30_31,1);
+  return true;
+  return false;
+}
+FORCE_IMPL_DATA_SRC_FCN_ARG(bool,VME_MESYTEC_MADC32::__match,uint32 geom);
+
+/** END_MATCHER *******************************************************/
+/** BEGIN_MATCHER ******************************************************
+ *
+ * Event matcher for VME_MESYTEC_MDPP16.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// VME_MESYTEC_MDPP16(geom)
+template<typename __data_src_t>
+bool VME_MESYTEC_MDPP16::__match(__data_src_t &__buffer,uint32 geom)
+{
+  // MEMBER(DATA16_OVERFLOW adc[16] ZERO_SUPPRESS_MULTI(20));
+  // MEMBER(DATA16_OVERFLOW tdc[16] ZERO_SUPPRESS_MULTI(20));
+  // MEMBER(DATA16_OVERFLOW trig_tdc[16] ZERO_SUPPRESS_MULTI(20));
+  // MEMBER(DATA16_OVERFLOW adc_short[16] ZERO_SUPPRESS_MULTI(20));
+  // MARK_COUNT(start);
+  // UINT32 header NOENCODE
+  // {
+    //  0_09: word_number;
+    // 10_12: adc_res;
+    // 13_15: tdc_res;
+    // 16_23: geom = MATCH(geom);
+    // 24_29: 0;
+    // 30_31: 1;
+  // }
+  union
+  {
+    struct
+    {
+#if __BYTE_ORDER == __LITTLE_ENDIAN
+      uint32 word_number : 10; // 0..9
+      uint32 adc_res : 3; // 10..12
+      uint32 tdc_res : 3; // 13..15
+      uint32 geom : 8; // 16..23
+      uint32 unnamed_24_29 : 6; // 24..29
+      uint32 unnamed_30_31 : 2; // 30..31
+#endif
+#if __BYTE_ORDER == __BIG_ENDIAN
+      uint32 unnamed_30_31 : 2; // 30..31
+      uint32 unnamed_24_29 : 6; // 24..29
+      uint32 geom : 8; // 16..23
+      uint32 tdc_res : 3; // 13..15
+      uint32 adc_res : 3; // 10..12
+      uint32 word_number : 10; // 0..9
+#endif
+    };
+    uint32  u32;
+  } header;
+  MATCH_READ_FROM_BUFFER_FULL(671,uint32 ,header,header.u32,89);
+  MATCH_BITS_EQUAL(668,header.geom,geom);
+  MATCH_BITS_EQUAL(669,header.unnamed_24_29,0);
+  MATCH_BITS_EQUAL(670,header.unnamed_30_31,1);
+  return true;
+  return false;
+}
+FORCE_IMPL_DATA_SRC_FCN_ARG(bool,VME_MESYTEC_MDPP16::__match,uint32 geom);
+
+/** END_MATCHER *******************************************************/
+/** BEGIN_MATCHER ******************************************************
+ *
+ * Event matcher for WR_STAMP.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// WR_STAMP(id)
+template<typename __data_src_t>
+bool WR_STAMP::__match(__data_src_t &__buffer,uint32 id)
+{
+  // MEMBER(DATA16 srcid);
+  // MEMBER(DATA16 err);
+  // MEMBER(DATA16 t1);
+  // MEMBER(DATA16 t2);
+  // MEMBER(DATA16 t3);
+  // MEMBER(DATA16 t4);
+  // UINT32 header NOENCODE
+  // {
+    //  8_11: id = MATCH(id);
+    //    16: error;
+    // ENCODE(srcid,(value=id));
+    // ENCODE(err,(value=error));
+  // }
+  union
+  {
+    struct
+    {
+#if __BYTE_ORDER == __LITTLE_ENDIAN
+      uint32 dummy_0_7 : 8;
+      uint32 id : 4; // 8..11
+      uint32 dummy_12_15 : 4;
+      uint32 error : 1; // 16
+      uint32 dummy_17_31 : 15;
+#endif
+#if __BYTE_ORDER == __BIG_ENDIAN
+      uint32 dummy_17_31 : 15;
+      uint32 error : 1; // 16
+      uint32 dummy_12_15 : 4;
+      uint32 id : 4; // 8..11
+      uint32 dummy_0_7 : 8;
+#endif
+    };
+    uint32  u32;
+  } header;
+  MATCH_READ_FROM_BUFFER_FULL(966,uint32 ,header,header.u32,95);
+  MATCH_BITS_EQUAL(962,header.id,id);
+  MATCH_UNNAMED_BITS_ZERO(966,header.u32,0xfffef0ff);
+  {
+  }
+  return true;
+  return false;
+}
+FORCE_IMPL_DATA_SRC_FCN_ARG(bool,WR_STAMP::__match,uint32 id);
+
+/** END_MATCHER *******************************************************/
+/** BEGIN_MATCHER ******************************************************
+ *
+ * Event matcher for XTST_STD_VME.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// XTST_STD_VME()
+template<typename __data_src_t>
+bool XTST_STD_VME::__match(__data_src_t &__buffer)
+{
+  // UINT32 failure
+  // {
+    //     0: fail_general;
+    //     1: fail_data_corrupt;
+    //     2: fail_data_missing;
+    //     3: fail_data_too_much;
+    //     4: fail_event_counter_mismatch;
+    //     5: fail_readout_error_driver;
+    //     6: fail_unexpected_trigger;
+    //    27: has_no_zero_suppression;
+    //    28: has_multi_adctdc_counter0;
+    //    29: has_multi_scaler_counter0;
+    //    30: has_multi_event;
+    //    31: has_time_stamp;
+  // }
+  union
+  {
+    struct
+    {
+#if __BYTE_ORDER == __LITTLE_ENDIAN
+      uint32 fail_general : 1; // 0
+      uint32 fail_data_corrupt : 1; // 1
+      uint32 fail_data_missing : 1; // 2
+      uint32 fail_data_too_much : 1; // 3
+      uint32 fail_event_counter_mismatch : 1; // 4
+      uint32 fail_readout_error_driver : 1; // 5
+      uint32 fail_unexpected_trigger : 1; // 6
+      uint32 dummy_7_26 : 20;
+      uint32 has_no_zero_suppression : 1; // 27
+      uint32 has_multi_adctdc_counter0 : 1; // 28
+      uint32 has_multi_scaler_counter0 : 1; // 29
+      uint32 has_multi_event : 1; // 30
+      uint32 has_time_stamp : 1; // 31
+#endif
+#if __BYTE_ORDER == __BIG_ENDIAN
+      uint32 has_time_stamp : 1; // 31
+      uint32 has_multi_event : 1; // 30
+      uint32 has_multi_scaler_counter0 : 1; // 29
+      uint32 has_multi_adctdc_counter0 : 1; // 28
+      uint32 has_no_zero_suppression : 1; // 27
+      uint32 dummy_7_26 : 20;
+      uint32 fail_unexpected_trigger : 1; // 6
+      uint32 fail_readout_error_driver : 1; // 5
+      uint32 fail_event_counter_mismatch : 1; // 4
+      uint32 fail_data_too_much : 1; // 3
+      uint32 fail_data_missing : 1; // 2
+      uint32 fail_data_corrupt : 1; // 1
+      uint32 fail_general : 1; // 0
+#endif
+    };
+    uint32  u32;
+  } __failure;
+  MATCH_READ_FROM_BUFFER_FULL(737,uint32 ,failure,__failure.u32,101);
+  MATCH_UNNAMED_BITS_ZERO(737,__failure.u32,0x07ffff80);
+  return true;
+  return false;
+}
+FORCE_IMPL_DATA_SRC_FCN(bool,XTST_STD_VME::__match);
+
+/** END_MATCHER *******************************************************/
+/** BEGIN_MATCHER ******************************************************
+ *
+ * Event matcher for XTST_SUBEVENT_MEMBER_DATA12.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// XTST_SUBEVENT_MEMBER_DATA12()
+template<typename __data_src_t>
+bool XTST_SUBEVENT_MEMBER_DATA12::__match(__data_src_t &__buffer)
+{
+  // MEMBER(DATA12 mDATA12);
+  // MEMBER(DATA12 mDATA12_array[8]);
+  // MEMBER(DATA12 mDATA12_array_zzp[8] ZERO_SUPPRESS);
+  // MEMBER(DATA12 mDATA12_array_zzpii[8] ZERO_SUPPRESS_LIST);
+  // MEMBER(DATA12 mDATA12_array_zzpml[8] ZERO_SUPPRESS_MULTI(4));
+  // MEMBER(DATA12 mDATA12_array2[2][8]);
+  // MEMBER(DATA12 mDATA12_array2_zzp[2][8] ZERO_SUPPRESS);
+  // MEMBER(DATA12 mDATA12_array2_zzpii[2][8] ZERO_SUPPRESS_LIST);
+  // MEMBER(DATA12 mDATA12_array2_zzpml[2][8] ZERO_SUPPRESS_MULTI(4));
+  return false;
+}
+FORCE_IMPL_DATA_SRC_FCN(bool,XTST_SUBEVENT_MEMBER_DATA12::__match);
+
+/** END_MATCHER *******************************************************/
+/** BEGIN_MATCHER ******************************************************
+ *
+ * Event matcher for XTST_SUBEVENT_MEMBER_DATA12_OVERFLOW.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// XTST_SUBEVENT_MEMBER_DATA12_OVERFLOW()
+template<typename __data_src_t>
+bool XTST_SUBEVENT_MEMBER_DATA12_OVERFLOW::__match(__data_src_t &__buffer)
+{
+  // MEMBER(DATA12_OVERFLOW mDATA12_OVERFLOW);
+  // MEMBER(DATA12_OVERFLOW mDATA12_OVERFLOW_array[8]);
+  // MEMBER(DATA12_OVERFLOW mDATA12_OVERFLOW_array_zzp[8] ZERO_SUPPRESS);
+  // MEMBER(DATA12_OVERFLOW mDATA12_OVERFLOW_array_zzpii[8] ZERO_SUPPRESS_LIST);
+  // MEMBER(DATA12_OVERFLOW mDATA12_OVERFLOW_array_zzpml[8] ZERO_SUPPRESS_MULTI(4));
+  // MEMBER(DATA12_OVERFLOW mDATA12_OVERFLOW_array2[2][8]);
+  // MEMBER(DATA12_OVERFLOW mDATA12_OVERFLOW_array2_zzp[2][8] ZERO_SUPPRESS);
+  // MEMBER(DATA12_OVERFLOW mDATA12_OVERFLOW_array2_zzpii[2][8] ZERO_SUPPRESS_LIST);
+  // MEMBER(DATA12_OVERFLOW mDATA12_OVERFLOW_array2_zzpml[2][8] ZERO_SUPPRESS_MULTI(4));
+  return false;
+}
+FORCE_IMPL_DATA_SRC_FCN(bool,XTST_SUBEVENT_MEMBER_DATA12_OVERFLOW::__match);
+
+/** END_MATCHER *******************************************************/
+/** BEGIN_MATCHER ******************************************************
+ *
+ * Event matcher for XTST_SUBEVENT_MEMBER_DATA12_RANGE.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// XTST_SUBEVENT_MEMBER_DATA12_RANGE()
+template<typename __data_src_t>
+bool XTST_SUBEVENT_MEMBER_DATA12_RANGE::__match(__data_src_t &__buffer)
+{
+  // MEMBER(DATA12_RANGE mDATA12_RANGE);
+  // MEMBER(DATA12_RANGE mDATA12_RANGE_array[8]);
+  // MEMBER(DATA12_RANGE mDATA12_RANGE_array_zzp[8] ZERO_SUPPRESS);
+  // MEMBER(DATA12_RANGE mDATA12_RANGE_array_zzpii[8] ZERO_SUPPRESS_LIST);
+  // MEMBER(DATA12_RANGE mDATA12_RANGE_array_zzpml[8] ZERO_SUPPRESS_MULTI(4));
+  // MEMBER(DATA12_RANGE mDATA12_RANGE_array2[2][8]);
+  // MEMBER(DATA12_RANGE mDATA12_RANGE_array2_zzp[2][8] ZERO_SUPPRESS);
+  // MEMBER(DATA12_RANGE mDATA12_RANGE_array2_zzpii[2][8] ZERO_SUPPRESS_LIST);
+  // MEMBER(DATA12_RANGE mDATA12_RANGE_array2_zzpml[2][8] ZERO_SUPPRESS_MULTI(4));
+  return false;
+}
+FORCE_IMPL_DATA_SRC_FCN(bool,XTST_SUBEVENT_MEMBER_DATA12_RANGE::__match);
+
+/** END_MATCHER *******************************************************/
+/** BEGIN_MATCHER ******************************************************
+ *
+ * Event matcher for XTST_SUBEVENT_MEMBER_DATA16.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// XTST_SUBEVENT_MEMBER_DATA16()
+template<typename __data_src_t>
+bool XTST_SUBEVENT_MEMBER_DATA16::__match(__data_src_t &__buffer)
+{
+  // MEMBER(DATA16 mDATA16);
+  // MEMBER(DATA16 mDATA16_array[8]);
+  // MEMBER(DATA16 mDATA16_array_zzp[8] ZERO_SUPPRESS);
+  // MEMBER(DATA16 mDATA16_array_zzpii[8] ZERO_SUPPRESS_LIST);
+  // MEMBER(DATA16 mDATA16_array_zzpml[8] ZERO_SUPPRESS_MULTI(4));
+  // MEMBER(DATA16 mDATA16_array2[2][8]);
+  // MEMBER(DATA16 mDATA16_array2_zzp[2][8] ZERO_SUPPRESS);
+  // MEMBER(DATA16 mDATA16_array2_zzpii[2][8] ZERO_SUPPRESS_LIST);
+  // MEMBER(DATA16 mDATA16_array2_zzpml[2][8] ZERO_SUPPRESS_MULTI(4));
+  return false;
+}
+FORCE_IMPL_DATA_SRC_FCN(bool,XTST_SUBEVENT_MEMBER_DATA16::__match);
+
+/** END_MATCHER *******************************************************/
+/** BEGIN_MATCHER ******************************************************
+ *
+ * Event matcher for XTST_SUBEVENT_MEMBER_DATA16_OVERFLOW.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// XTST_SUBEVENT_MEMBER_DATA16_OVERFLOW()
+template<typename __data_src_t>
+bool XTST_SUBEVENT_MEMBER_DATA16_OVERFLOW::__match(__data_src_t &__buffer)
+{
+  // MEMBER(DATA16_OVERFLOW mDATA16_OVERFLOW);
+  // MEMBER(DATA16_OVERFLOW mDATA16_OVERFLOW_array[8]);
+  // MEMBER(DATA16_OVERFLOW mDATA16_OVERFLOW_array_zzp[8] ZERO_SUPPRESS);
+  // MEMBER(DATA16_OVERFLOW mDATA16_OVERFLOW_array_zzpii[8] ZERO_SUPPRESS_LIST);
+  // MEMBER(DATA16_OVERFLOW mDATA16_OVERFLOW_array_zzpml[8] ZERO_SUPPRESS_MULTI(4));
+  // MEMBER(DATA16_OVERFLOW mDATA16_OVERFLOW_array2[2][8]);
+  // MEMBER(DATA16_OVERFLOW mDATA16_OVERFLOW_array2_zzp[2][8] ZERO_SUPPRESS);
+  // MEMBER(DATA16_OVERFLOW mDATA16_OVERFLOW_array2_zzpii[2][8] ZERO_SUPPRESS_LIST);
+  // MEMBER(DATA16_OVERFLOW mDATA16_OVERFLOW_array2_zzpml[2][8] ZERO_SUPPRESS_MULTI(4));
+  return false;
+}
+FORCE_IMPL_DATA_SRC_FCN(bool,XTST_SUBEVENT_MEMBER_DATA16_OVERFLOW::__match);
+
+/** END_MATCHER *******************************************************/
+/** BEGIN_MATCHER ******************************************************
+ *
+ * Event matcher for XTST_SUBEVENT_MEMBER_DATA24.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// XTST_SUBEVENT_MEMBER_DATA24()
+template<typename __data_src_t>
+bool XTST_SUBEVENT_MEMBER_DATA24::__match(__data_src_t &__buffer)
+{
+  // MEMBER(DATA24 mDATA24);
+  // MEMBER(DATA24 mDATA24_array[8]);
+  // MEMBER(DATA24 mDATA24_array_zzp[8] ZERO_SUPPRESS);
+  // MEMBER(DATA24 mDATA24_array_zzpii[8] ZERO_SUPPRESS_LIST);
+  // MEMBER(DATA24 mDATA24_array_zzpml[8] ZERO_SUPPRESS_MULTI(4));
+  // MEMBER(DATA24 mDATA24_array2[2][8]);
+  // MEMBER(DATA24 mDATA24_array2_zzp[2][8] ZERO_SUPPRESS);
+  // MEMBER(DATA24 mDATA24_array2_zzpii[2][8] ZERO_SUPPRESS_LIST);
+  // MEMBER(DATA24 mDATA24_array2_zzpml[2][8] ZERO_SUPPRESS_MULTI(4));
+  return false;
+}
+FORCE_IMPL_DATA_SRC_FCN(bool,XTST_SUBEVENT_MEMBER_DATA24::__match);
+
+/** END_MATCHER *******************************************************/
+/** BEGIN_MATCHER ******************************************************
+ *
+ * Event matcher for XTST_SUBEVENT_MEMBER_DATA32.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// XTST_SUBEVENT_MEMBER_DATA32()
+template<typename __data_src_t>
+bool XTST_SUBEVENT_MEMBER_DATA32::__match(__data_src_t &__buffer)
+{
+  // MEMBER(DATA32 mDATA32);
+  // MEMBER(DATA32 mDATA32_array[8]);
+  // MEMBER(DATA32 mDATA32_array_zzp[8] ZERO_SUPPRESS);
+  // MEMBER(DATA32 mDATA32_array_zzpii[8] ZERO_SUPPRESS_LIST);
+  // MEMBER(DATA32 mDATA32_array_zzpml[8] ZERO_SUPPRESS_MULTI(4));
+  // MEMBER(DATA32 mDATA32_array2[2][8]);
+  // MEMBER(DATA32 mDATA32_array2_zzp[2][8] ZERO_SUPPRESS);
+  // MEMBER(DATA32 mDATA32_array2_zzpii[2][8] ZERO_SUPPRESS_LIST);
+  // MEMBER(DATA32 mDATA32_array2_zzpml[2][8] ZERO_SUPPRESS_MULTI(4));
+  return false;
+}
+FORCE_IMPL_DATA_SRC_FCN(bool,XTST_SUBEVENT_MEMBER_DATA32::__match);
+
+/** END_MATCHER *******************************************************/
+/** BEGIN_MATCHER ******************************************************
+ *
+ * Event matcher for XTST_SUBEVENT_MEMBER_DATA32_B.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// XTST_SUBEVENT_MEMBER_DATA32_B()
+template<typename __data_src_t>
+bool XTST_SUBEVENT_MEMBER_DATA32_B::__match(__data_src_t &__buffer)
+{
+  // MEMBER(DATA32 mDATA32_array_zzpml[8] ZERO_SUPPRESS_MULTI(4));
+  return false;
+}
+FORCE_IMPL_DATA_SRC_FCN(bool,XTST_SUBEVENT_MEMBER_DATA32_B::__match);
+
+/** END_MATCHER *******************************************************/
+/** BEGIN_MATCHER ******************************************************
+ *
+ * Event matcher for XTST_SUBEVENT_MEMBER_DATA8.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// XTST_SUBEVENT_MEMBER_DATA8()
+template<typename __data_src_t>
+bool XTST_SUBEVENT_MEMBER_DATA8::__match(__data_src_t &__buffer)
+{
+  // MEMBER(DATA8 mDATA8);
+  // MEMBER(DATA8 mDATA8_array[8]);
+  // MEMBER(DATA8 mDATA8_array_zzp[8] ZERO_SUPPRESS);
+  // MEMBER(DATA8 mDATA8_array_zzpii[8] ZERO_SUPPRESS_LIST);
+  // MEMBER(DATA8 mDATA8_array_zzpml[8] ZERO_SUPPRESS_MULTI(4));
+  // MEMBER(DATA8 mDATA8_array2[2][8]);
+  // MEMBER(DATA8 mDATA8_array2_zzp[2][8] ZERO_SUPPRESS);
+  // MEMBER(DATA8 mDATA8_array2_zzpii[2][8] ZERO_SUPPRESS_LIST);
+  // MEMBER(DATA8 mDATA8_array2_zzpml[2][8] ZERO_SUPPRESS_MULTI(4));
+  return false;
+}
+FORCE_IMPL_DATA_SRC_FCN(bool,XTST_SUBEVENT_MEMBER_DATA8::__match);
+
+/** END_MATCHER *******************************************************/
+/** BEGIN_MATCHER ******************************************************
+ *
+ * Event matcher for XTST_SUBEVENT_MEMBER_uint16.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// XTST_SUBEVENT_MEMBER_uint16()
+template<typename __data_src_t>
+bool XTST_SUBEVENT_MEMBER_uint16::__match(__data_src_t &__buffer)
+{
+  // MEMBER(uint16 muint16);
+  return false;
+}
+FORCE_IMPL_DATA_SRC_FCN(bool,XTST_SUBEVENT_MEMBER_uint16::__match);
+
+/** END_MATCHER *******************************************************/
+/** BEGIN_MATCHER ******************************************************
+ *
+ * Event matcher for XTST_SUBEVENT_MEMBER_uint32.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// XTST_SUBEVENT_MEMBER_uint32()
+template<typename __data_src_t>
+bool XTST_SUBEVENT_MEMBER_uint32::__match(__data_src_t &__buffer)
+{
+  // MEMBER(uint32 muint32);
+  return false;
+}
+FORCE_IMPL_DATA_SRC_FCN(bool,XTST_SUBEVENT_MEMBER_uint32::__match);
+
+/** END_MATCHER *******************************************************/
+/** BEGIN_MATCHER ******************************************************
+ *
+ * Event matcher for XTST_SUBEVENT_MEMBER_uint8.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// XTST_SUBEVENT_MEMBER_uint8()
+template<typename __data_src_t>
+bool XTST_SUBEVENT_MEMBER_uint8::__match(__data_src_t &__buffer)
+{
+  // MEMBER(uint8 muint8);
+  return false;
+}
+FORCE_IMPL_DATA_SRC_FCN(bool,XTST_SUBEVENT_MEMBER_uint8::__match);
+
+/** END_MATCHER *******************************************************/
+/** BEGIN_MATCHER ******************************************************
+ *
+ * Event matcher for BITS64.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// SUBEVENT(BITS64)
+// No __match function for subevents.
+
+/** END_MATCHER *******************************************************/
+/** BEGIN_MATCHER ******************************************************
+ *
+ * Event matcher for XTST_MDPP16.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// SUBEVENT(XTST_MDPP16)
+// No __match function for subevents.
+
+/** END_MATCHER *******************************************************/
+/** BEGIN_MATCHER ******************************************************
+ *
+ * Event matcher for XTST_PLAIN.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// SUBEVENT(XTST_PLAIN)
+// No __match function for subevents.
+
+/** END_MATCHER *******************************************************/
+/** BEGIN_MATCHER ******************************************************
+ *
+ * Event matcher for XTST_REGRESS.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// SUBEVENT(XTST_REGRESS)
+// No __match function for subevents.
+
+/** END_MATCHER *******************************************************/
+/** BEGIN_MATCHER ******************************************************
+ *
+ * Event matcher for XTST_REGRESSEXTRA.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// SUBEVENT(XTST_REGRESSEXTRA)
+// No __match function for subevents.
+
+/** END_MATCHER *******************************************************/
+/** BEGIN_MATCHER ******************************************************
+ *
+ * Event matcher for XTST_STICKY_CORR.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// SUBEVENT(XTST_STICKY_CORR)
+// No __match function for subevents.
+
+/** END_MATCHER *******************************************************/
+/** BEGIN_MATCHER ******************************************************
+ *
+ * Event matcher for XTST_SUBEVENT_ME2.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// SUBEVENT(XTST_SUBEVENT_ME2)
+// No __match function for subevents.
+
+/** END_MATCHER *******************************************************/
+/** BEGIN_MATCHER ******************************************************
+ *
+ * Event matcher for XTST_SUBEVENT_MEMBER_ENCODE.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// SUBEVENT(XTST_SUBEVENT_MEMBER_ENCODE)
+// No __match function for subevents.
+
+/** END_MATCHER *******************************************************/
+/** BEGIN_MATCHER ******************************************************
+ *
+ * Event matcher for XTST_SUBEVENT_MEMBER_ENCODE_A.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// SUBEVENT(XTST_SUBEVENT_MEMBER_ENCODE_A)
+// No __match function for subevents.
+
+/** END_MATCHER *******************************************************/
+/** BEGIN_MATCHER ******************************************************
+ *
+ * Event matcher for XTST_SUBEVENT_MEMBER_ENCODE_B.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// SUBEVENT(XTST_SUBEVENT_MEMBER_ENCODE_B)
+// No __match function for subevents.
+
+/** END_MATCHER *******************************************************/
+/** BEGIN_MATCHER ******************************************************
+ *
+ * Event matcher for XTST_VME.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// SUBEVENT(XTST_VME)
+// No __match function for subevents.
+
+/** END_MATCHER *******************************************************/
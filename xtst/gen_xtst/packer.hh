@@ -0,0 +1,1747 @@
+/** BEGIN_PACKER *******************************************************
+ *
+ * Event packer for CAMAC_LECROY_4434.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// CAMAC_LECROY_4434(channels)
+template<typename __data_dest_t>
+void PACKER_CAMAC_LECROY_4434::__packer(__data_dest_t &__buffer,uint32 channels)
+{
+  // MEMBER(DATA24 data[32] ZERO_SUPPRESS);
+  // list(0<=index<channels)
+
+  {
+    // UINT32 ch_data NOENCODE
+    // {
+      //  0_23: value;
+      // 24_31: 0;
+      // ENCODE(data[index],(value=value));
+    // }
+  }
+}
+FORCE_IMPL_DATA_SRC_FCN_ARG(void,CAMAC_LECROY_4434::__packer,uint32 channels);
+
+/** END_PACKER ********************************************************/
+/** BEGIN_PACKER *******************************************************
+ *
+ * Event packer for CAMAC_PHILLIPS_7164.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// CAMAC_PHILLIPS_7164(channels,mark_channel_no)
+template<typename __data_dest_t>
+void PACKER_CAMAC_PHILLIPS_7164::__packer(__data_dest_t &__buffer,uint32 channels
+                                                                 ,uint32 mark_channel_no)
+{
+  // MEMBER(DATA12 data[16] ZERO_SUPPRESS);
+  // list(0<=index<channels)
+
+  {
+    // if(mark_channel_no)
+
+    // else
+
+    if (mark_channel_no)
+    {
+      // UINT16 ch_data NOENCODE
+      // {
+        //  0_11: value;
+        // 12_15: channel = CHECK(index);
+        // ENCODE(data[index],(value=value));
+      // }
+    }
+
+    else
+    {
+      // UINT16 ch_data NOENCODE
+      // {
+        //  0_11: value;
+        // ENCODE(data[index],(value=value));
+      // }
+    }
+  }
+}
+FORCE_IMPL_DATA_SRC_FCN_ARG(void,CAMAC_PHILLIPS_7164::__packer,uint32 channels
+                                                              ,uint32 mark_channel_no);
+
+/** END_PACKER ********************************************************/
+/** BEGIN_PACKER *******************************************************
+ *
+ * Event packer for CAMAC_SILENA_4418.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// CAMAC_SILENA_4418(channels,mark_channel_no)
+template<typename __data_dest_t>
+void PACKER_CAMAC_SILENA_4418::__packer(__data_dest_t &__buffer,uint32 channels
+                                                               ,uint32 mark_channel_no)
+{
+  // MEMBER(DATA12_OVERFLOW data[8] ZERO_SUPPRESS);
+  // list(0<=index<channels)
+
+  {
+    // if(mark_channel_no)
+
+    // else
+
+    if (mark_channel_no)
+    {
+      // UINT16 ch_data NOENCODE
+      // {
+        //  0_11: value;
+        // 12_14: channel = CHECK(index);
+        //    15: overflow;
+        // ENCODE(data[index],(value=value,overflow=overflow));
+      // }
+    }
+
+    else
+    {
+      // UINT16 ch_data NOENCODE
+      // {
+        //  0_11: value;
+        //    15: overflow;
+        // ENCODE(data[index],(value=value,overflow=overflow));
+      // }
+    }
+  }
+}
+FORCE_IMPL_DATA_SRC_FCN_ARG(void,CAMAC_SILENA_4418::__packer,uint32 channels
+                                                            ,uint32 mark_channel_no);
+
+/** END_PACKER ********************************************************/
+/** BEGIN_PACKER *******************************************************
+ *
+ * Event packer for FASTBUS_LECROY_1875.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// FASTBUS_LECROY_1875(geom,channels)
+template<typename __data_dest_t>
+void PACKER_FASTBUS_LECROY_1875::__packer(__data_dest_t &__buffer,uint32 geom
+                                                                 ,uint32 channels)
+{
+  // MEMBER(DATA12_RANGE data[64] ZERO_SUPPRESS);
+  // UINT32 ch_data NOENCODE
+  // {
+    //  0_11: value;
+    // 16_21: channel = RANGE(0,(channels - 1));
+    //    23: range;
+    // 24_26: n = CHECK(0);
+    // 27_31: geom = MATCH(geom);
+    // ENCODE(data[channel],(value=value,range=range));
+  // }
+}
+FORCE_IMPL_DATA_SRC_FCN_ARG(void,FASTBUS_LECROY_1875::__packer,uint32 geom
+                                                              ,uint32 channels);
+
+/** END_PACKER ********************************************************/
+/** BEGIN_PACKER *******************************************************
+ *
+ * Event packer for FASTBUS_LECROY_1885.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// FASTBUS_LECROY_1885(geom,channels)
+template<typename __data_dest_t>
+void PACKER_FASTBUS_LECROY_1885::__packer(__data_dest_t &__buffer,uint32 geom
+                                                                 ,uint32 channels)
+{
+  // MEMBER(DATA12_RANGE data[96] ZERO_SUPPRESS);
+  // UINT32 ch_data NOENCODE
+  // {
+    //  0_11: value;
+    // 16_22: channel = RANGE(0,(channels - 1));
+    //    23: range;
+    // 24_26: n = CHECK(0);
+    // 27_31: geom = MATCH(geom);
+    // ENCODE(data[channel],(value=value,range=range));
+  // }
+}
+FORCE_IMPL_DATA_SRC_FCN_ARG(void,FASTBUS_LECROY_1885::__packer,uint32 geom
+                                                              ,uint32 channels);
+
+/** END_PACKER ********************************************************/
+/** BEGIN_PACKER *******************************************************
+ *
+ * Event packer for ITEM64.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// ITEM64(num)
+template<typename __data_dest_t>
+void PACKER_ITEM64::__packer(__data_dest_t &__buffer,uint32 num)
+{
+  // MEMBER(DATA64 member64);
+  // UINT64 a
+  // {
+    //  0_01: 0;
+    //  5_07: num = MATCH(num);
+  // }
+  // UINT64 b
+  // {
+    //  0_01: 0;
+    //  3_07: v;
+    // 20_63: 0x00123456;
+    // ENCODE(member64,(value=v));
+  // }
+  // UINT32 c
+  // {
+    //  0_01: 0;
+    //  3_07: v;
+    // 20_31: 0x123;
+    // ENCODE(member64,(value=v));
+  // }
+}
+FORCE_IMPL_DATA_SRC_FCN_ARG(void,ITEM64::__packer,uint32 num);
+
+/** END_PACKER ********************************************************/
+/** BEGIN_PACKER *******************************************************
+ *
+ * Event packer for ITEMQ.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// ITEMQ(num)
+template<typename __data_dest_t>
+void PACKER_ITEMQ::__packer(__data_dest_t &__buffer,uint32 num)
+{
+  // MEMBER(DATA32 chan);
+  // UINT64 w1
+  // {
+    //    21: c21;
+  // }
+  // UINT64 w2
+  // {
+    //    22: c22;
+  // }
+  // ENCODE(chan,(value=(((w1.c21 << 12) & 0xf00) | w2.c22)));
+
+}
+FORCE_IMPL_DATA_SRC_FCN_ARG(void,ITEMQ::__packer,uint32 num);
+
+/** END_PACKER ********************************************************/
+/** BEGIN_PACKER *******************************************************
+ *
+ * Event packer for ITEM_ME2.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// ITEM_ME2(geom)
+template<typename __data_dest_t>
+void PACKER_ITEM_ME2::__packer(__data_dest_t &__buffer,uint32 geom)
+{
+  // MEMBER(DATA16 data[32] ZERO_SUPPRESS);
+  // optional UINT32 padding NOENCODE
+  // {
+    //  0_31: value = MATCH(0x32323232);
+  // }
+  // UINT32 header NOENCODE
+  // {
+    // 16_23: geom = MATCH(geom);
+  // }
+  // MATCH_END;
+  // UINT32 data NOENCODE
+  // {
+    // 16_23: geom = MATCH(geom);
+  // }
+}
+FORCE_IMPL_DATA_SRC_FCN_ARG(void,ITEM_ME2::__packer,uint32 geom);
+
+/** END_PACKER ********************************************************/
+/** BEGIN_PACKER *******************************************************
+ *
+ * Event packer for MADC32.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// MADC32(res,geo,channels)
+template<typename __data_dest_t>
+void PACKER_MADC32::__packer(__data_dest_t &__buffer,uint32 res,uint32 geo
+                                                    ,uint32 channels)
+{
+  // UINT32 header
+  // {
+    //  0_11: word_counts;
+    // 12_14: resolution = MATCH(res);
+    //    15: unused1;
+    // 16_23: id = MATCH(geo);
+    // 24_29: 0;
+    // 30_31: 1;
+  // }
+  // if((header.resolution == 0))
+
+  // else
+
+  if ((header.resolution == 0))
+  {
+    // UINT32 madc32_data0
+    // {
+      //  0_10: adc_value;
+      // 11_13: 0;
+      //    14: unused;
+      //    15: 0;
+      // 16_20: channel = RANGE(0,channels);
+      // 21_29: 32;
+      // 30_31: 0;
+    // }
+  }
+
+  else
+  {
+    // if(((header.resolution == 1) || (header.resolution == 2)))
+
+    // else
+
+    if (((header.resolution == 1) || (header.resolution == 2)))
+    {
+      // UINT32 madc32_data1
+      // {
+        //  0_11: adc_value;
+        // 12_13: 0;
+        //    14: unused;
+        //    15: 0;
+        // 16_20: channel = RANGE(0,channels);
+        // 21_29: 32;
+        // 30_31: 0;
+      // }
+    }
+
+    else
+    {
+      // if(((header.resolution == 3) || (header.resolution == 4)))
+
+      if (((header.resolution == 3) || (header.resolution == 4)))
+      {
+        // UINT32 madc32_data3
+        // {
+          //  0_12: adc_value;
+          //    13: 0;
+          //    14: unused;
+          //    15: 0;
+          // 16_20: channel = RANGE(0,channels);
+          // 21_29: 32;
+          // 30_31: 0;
+        // }
+      }
+    }
+  }
+  // UINT32 trailer
+  // {
+    //  0_29: evt_counter;
+    // 30_31: 3;
+  // }
+}
+FORCE_IMPL_DATA_SRC_FCN_ARG(void,MADC32::__packer,uint32 res,uint32 geo,uint32 channels);
+
+/** END_PACKER ********************************************************/
+/** BEGIN_PACKER *******************************************************
+ *
+ * Event packer for SINGLE_DATA_MODULE.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// SINGLE_DATA_MODULE()
+template<typename __data_dest_t>
+void PACKER_SINGLE_DATA_MODULE::__packer(__data_dest_t &__buffer)
+{
+  // UINT32 data;
+}
+FORCE_IMPL_DATA_SRC_FCN(void,SINGLE_DATA_MODULE::__packer);
+
+/** END_PACKER ********************************************************/
+/** BEGIN_PACKER *******************************************************
+ *
+ * Event packer for STICKY_ACTIVE.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// STICKY_ACTIVE()
+template<typename __data_dest_t>
+void PACKER_STICKY_ACTIVE::__packer(__data_dest_t &__buffer)
+{
+  // UINT32 separator
+  // {
+    //  0_31: 7;
+  // }
+  // UINT32 active;
+  // UINT32 mark;
+  // UINT32 corr;
+}
+FORCE_IMPL_DATA_SRC_FCN(void,STICKY_ACTIVE::__packer);
+
+/** END_PACKER ********************************************************/
+/** BEGIN_PACKER *******************************************************
+ *
+ * Event packer for VME_CAEN_V1190_SUBTDC.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// VME_CAEN_V1190_SUBTDC(tdc,event_id,data)
+template<typename __data_dest_t>
+void PACKER_VME_CAEN_V1190_SUBTDC::__packer(__data_dest_t &__buffer,uint32 tdc
+                                                                   ,uint32 event_id
+                                                                   ,raw_array_multi_zero_suppress<DATA24,DATA24,32,128> &data)
+{
+  // MEMBER(DATA24 data[32] ZERO_SUPPRESS_MULTI(128));
+  // MARK_COUNT(tdc_start);
+  void *__mark_tdc_start = __buffer._offset;
+  // UINT32 header
+  // {
+    //  0_11: bunch_id;
+    // 12_23: event_id = CHECK(event_id);
+    // 24_25: tdc = MATCH(tdc);
+    // 27_31: 1;
+  // }
+  // several UINT32 ch_data NOENCODE
+  // {
+    //  0_18: value;
+    // 19_23: channel_low;
+    // 24_25: tdc = CHECK(tdc);
+    //    26: trailing;
+    // 27_31: 0;
+    // ENCODE(data[((tdc << 5) | channel_low)],(value=value));
+  // }
+  // optional UINT32 error_flags
+  // {
+    //  0_14: flags;
+    // 24_25: tdc = CHECK(tdc);
+    // 27_31: 4;
+  // }
+  // MARK_COUNT(tdc_end);
+  void *__mark_tdc_end = __buffer._offset;
+  // UINT32 trailer
+  // {
+    //  0_11: word_count = CHECK_COUNT(tdc_start,tdc_end,4,4);
+    // 12_23: event_id = CHECK(header.event_id);
+    // 24_25: tdc = CHECK(tdc);
+    // 27_31: 3;
+  // }
+}
+FORCE_IMPL_DATA_SRC_FCN_ARG(void,VME_CAEN_V1190_SUBTDC::__packer,uint32 tdc
+                                                                ,uint32 event_id);
+
+/** END_PACKER ********************************************************/
+/** BEGIN_PACKER *******************************************************
+ *
+ * Event packer for VME_CAEN_V1190.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// VME_CAEN_V1190(geom)
+template<typename __data_dest_t>
+void PACKER_VME_CAEN_V1190::__packer(__data_dest_t &__buffer,uint32 geom)
+{
+  // MEMBER(DATA24 data[32] ZERO_SUPPRESS_MULTI(128));
+  // MARK_COUNT(v1190_start);
+  void *__mark_v1190_start = __buffer._offset;
+  // UINT32 header
+  // {
+    //  0_04: geom = MATCH(geom);
+    //  5_26: event_number;
+    // 27_31: 8;
+  // }
+  // select several
+
+    // tdc[0] = VME_CAEN_V1190_SUBTDC(tdc=0,event_id=(header.event_number & 0xfff),
+                                   // data=data);
+    // tdc[1] = VME_CAEN_V1190_SUBTDC(tdc=1,event_id=(header.event_number & 0xfff),
+                                   // data=data);
+    // tdc[2] = VME_CAEN_V1190_SUBTDC(tdc=2,event_id=(header.event_number & 0xfff),
+                                   // data=data);
+    // tdc[3] = VME_CAEN_V1190_SUBTDC(tdc=3,event_id=(header.event_number & 0xfff),
+                                   // data=data);
+  {
+    PACK_DECL(488,VME_CAEN_V1190_SUBTDC,tdc[0],/*tdc*/0,/*event_id*/(header.event_number & 0xfff),/*data*/data);
+    PACK_DECL(489,VME_CAEN_V1190_SUBTDC,tdc[1],/*tdc*/1,/*event_id*/(header.event_number & 0xfff),/*data*/data);
+    PACK_DECL(490,VME_CAEN_V1190_SUBTDC,tdc[2],/*tdc*/2,/*event_id*/(header.event_number & 0xfff),/*data*/data);
+    PACK_DECL(491,VME_CAEN_V1190_SUBTDC,tdc[3],/*tdc*/3,/*event_id*/(header.event_number & 0xfff),/*data*/data);
+  }
+  // UINT32 trigger
+  // {
+    //  0_26: time_tag;
+    // 27_31: 17;
+  // }
+  // MARK_COUNT(v1190_end);
+  void *__mark_v1190_end = __buffer._offset;
+  // UINT32 trailer
+  // {
+    //  0_04: geom = CHECK(geom);
+    //  5_19: word_count = CHECK_COUNT(v1190_start,v1190_end,4,4);
+    //    24: tdc_error;
+    //    25: buffer_overflow;
+    //    26: trigger_lost;
+    // 27_31: 16;
+  // }
+}
+FORCE_IMPL_DATA_SRC_FCN_ARG(void,VME_CAEN_V1190::__packer,uint32 geom);
+
+/** END_PACKER ********************************************************/
+/** BEGIN_PACKER *******************************************************
+ *
+ * Event packer for VME_CAEN_V1190_SHORT_SUBTDC.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// VME_CAEN_V1190_SHORT_SUBTDC(tdc,event_id,data)
+template<typename __data_dest_t>
+void PACKER_VME_CAEN_V1190_SHORT_SUBTDC::__packer(__data_dest_t &__buffer,uint32 tdc
+                                                                         ,uint32 event_id
+                                                                         ,raw_array_multi_zero_suppress<DATA24,DATA24,32,128> &data)
+{
+  // MEMBER(DATA24 data[32] ZERO_SUPPRESS_MULTI(128));
+  // UINT32 ch_data NOENCODE
+  // {
+    //  0_18: value;
+    // 19_23: channel_low;
+    // 24_25: tdc = CHECK(tdc);
+    //    26: trailing;
+    // 27_31: 0;
+    // ENCODE(data[((tdc << 5) | channel_low)],(value=value));
+  // }
+}
+FORCE_IMPL_DATA_SRC_FCN_ARG(void,VME_CAEN_V1190_SHORT_SUBTDC::__packer,uint32 tdc
+                                                                      ,uint32 event_id);
+
+/** END_PACKER ********************************************************/
+/** BEGIN_PACKER *******************************************************
+ *
+ * Event packer for VME_CAEN_V1190_SHORT_SUBTDC_ERROR.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// VME_CAEN_V1190_SHORT_SUBTDC_ERROR(tdc)
+template<typename __data_dest_t>
+void PACKER_VME_CAEN_V1190_SHORT_SUBTDC_ERROR::__packer(__data_dest_t &__buffer,uint32 tdc)
+{
+  // UINT32 error_flags
+  // {
+    //  0_14: flags;
+    // 24_25: tdc = CHECK(tdc);
+    // 27_31: 4;
+  // }
+}
+FORCE_IMPL_DATA_SRC_FCN_ARG(void,VME_CAEN_V1190_SHORT_SUBTDC_ERROR::__packer,uint32 tdc);
+
+/** END_PACKER ********************************************************/
+/** BEGIN_PACKER *******************************************************
+ *
+ * Event packer for VME_CAEN_V1190_SHORT.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// VME_CAEN_V1190_SHORT(geom)
+template<typename __data_dest_t>
+void PACKER_VME_CAEN_V1190_SHORT::__packer(__data_dest_t &__buffer,uint32 geom)
+{
+  // MEMBER(DATA24 data[32] ZERO_SUPPRESS_MULTI(128));
+  // MARK_COUNT(v1190_start);
+  void *__mark_v1190_start = __buffer._offset;
+  // UINT32 header
+  // {
+    //  0_04: geom = MATCH(geom);
+    //  5_26: event_number;
+    // 27_31: 8;
+  // }
+  // select several
+
+    // tdc[0] = VME_CAEN_V1190_SHORT_SUBTDC(tdc=0,event_id=(header.event_number & 0xfff),
+                                         // data=data);
+    // tdc[1] = VME_CAEN_V1190_SHORT_SUBTDC(tdc=1,event_id=(header.event_number & 0xfff),
+                                         // data=data);
+    // tdc[2] = VME_CAEN_V1190_SHORT_SUBTDC(tdc=2,event_id=(header.event_number & 0xfff),
+                                         // data=data);
+    // tdc[3] = VME_CAEN_V1190_SHORT_SUBTDC(tdc=3,event_id=(header.event_number & 0xfff),
+                                         // data=data);
+    // norevisit err[0] = VME_CAEN_V1190_SHORT_SUBTDC_ERROR(tdc=0);
+    // norevisit err[1] = VME_CAEN_V1190_SHORT_SUBTDC_ERROR(tdc=1);
+    // norevisit err[2] = VME_CAEN_V1190_SHORT_SUBTDC_ERROR(tdc=2);
+    // norevisit err[3] = VME_CAEN_V1190_SHORT_SUBTDC_ERROR(tdc=3);
+  {
+    PACK_DECL(577,VME_CAEN_V1190_SHORT_SUBTDC,tdc[0],/*tdc*/0,/*event_id*/(header.event_number & 0xfff),/*data*/data);
+    PACK_DECL(578,VME_CAEN_V1190_SHORT_SUBTDC,tdc[1],/*tdc*/1,/*event_id*/(header.event_number & 0xfff),/*data*/data);
+    PACK_DECL(579,VME_CAEN_V1190_SHORT_SUBTDC,tdc[2],/*tdc*/2,/*event_id*/(header.event_number & 0xfff),/*data*/data);
+    PACK_DECL(580,VME_CAEN_V1190_SHORT_SUBTDC,tdc[3],/*tdc*/3,/*event_id*/(header.event_number & 0xfff),/*data*/data);
+    PACK_DECL(582,VME_CAEN_V1190_SHORT_SUBTDC_ERROR,err[0],/*tdc*/0);
+    PACK_DECL(583,VME_CAEN_V1190_SHORT_SUBTDC_ERROR,err[1],/*tdc*/1);
+    PACK_DECL(584,VME_CAEN_V1190_SHORT_SUBTDC_ERROR,err[2],/*tdc*/2);
+    PACK_DECL(585,VME_CAEN_V1190_SHORT_SUBTDC_ERROR,err[3],/*tdc*/3);
+  }
+  // UINT32 trigger
+  // {
+    //  0_26: time_tag;
+    // 27_31: 17;
+  // }
+  // MARK_COUNT(v1190_end);
+  void *__mark_v1190_end = __buffer._offset;
+  // UINT32 trailer
+  // {
+    //  0_04: geom = CHECK(geom);
+    //  5_19: word_count = CHECK_COUNT(v1190_start,v1190_end,4,4);
+    //    24: tdc_error;
+    //    25: buffer_overflow;
+    //    26: trigger_lost;
+    // 27_31: 16;
+  // }
+}
+FORCE_IMPL_DATA_SRC_FCN_ARG(void,VME_CAEN_V1190_SHORT::__packer,uint32 geom);
+
+/** END_PACKER ********************************************************/
+/** BEGIN_PACKER *******************************************************
+ *
+ * Event packer for VME_CAEN_V1290_SUBTDC.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// VME_CAEN_V1290_SUBTDC(tdc,event_id,data)
+template<typename __data_dest_t>
+void PACKER_VME_CAEN_V1290_SUBTDC::__packer(__data_dest_t &__buffer,uint32 tdc
+                                                                   ,uint32 event_id
+                                                                   ,raw_array_multi_zero_suppress<DATA24,DATA24,32,128> &data)
+{
+  // MEMBER(DATA24 data[32] ZERO_SUPPRESS_MULTI(128));
+  // MARK_COUNT(tdc_start);
+  void *__mark_tdc_start = __buffer._offset;
+  // UINT32 header
+  // {
+    //  0_11: bunch_id;
+    // 12_23: event_id = CHECK(event_id);
+    // 24_25: tdc = MATCH(tdc);
+    // 27_31: 1;
+  // }
+  // several UINT32 ch_data NOENCODE
+  // {
+    //  0_20: value;
+    // 21_23: channel_low;
+    // 24_25: tdc = CHECK(tdc);
+    //    26: trailing;
+    // 27_31: 0;
+    // ENCODE(data[((tdc << 3) | channel_low)],(value=value));
+  // }
+  // optional UINT32 error_flags
+  // {
+    //  0_14: flags;
+    // 24_25: tdc = CHECK(tdc);
+    // 27_31: 4;
+  // }
+  // MARK_COUNT(tdc_end);
+  void *__mark_tdc_end = __buffer._offset;
+  // UINT32 trailer
+  // {
+    //  0_11: word_count = CHECK_COUNT(tdc_start,tdc_end,4,4);
+    // 12_23: event_id = CHECK(header.event_id);
+    // 24_25: tdc = CHECK(tdc);
+    // 27_31: 3;
+  // }
+}
+FORCE_IMPL_DATA_SRC_FCN_ARG(void,VME_CAEN_V1290_SUBTDC::__packer,uint32 tdc
+                                                                ,uint32 event_id);
+
+/** END_PACKER ********************************************************/
+/** BEGIN_PACKER *******************************************************
+ *
+ * Event packer for VME_CAEN_V1290.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// VME_CAEN_V1290(geom)
+template<typename __data_dest_t>
+void PACKER_VME_CAEN_V1290::__packer(__data_dest_t &__buffer,uint32 geom)
+{
+  // MEMBER(DATA24 data[32] ZERO_SUPPRESS_MULTI(128));
+  // MARK_COUNT(v1190_start);
+  void *__mark_v1190_start = __buffer._offset;
+  // UINT32 header
+  // {
+    //  0_04: geom = MATCH(geom);
+    //  5_26: event_number;
+    // 27_31: 8;
+  // }
+  // select several
+
+    // tdc[0] = VME_CAEN_V1290_SUBTDC(tdc=0,event_id=(header.event_number & 0xfff),
+                                   // data=data);
+    // tdc[1] = VME_CAEN_V1290_SUBTDC(tdc=1,event_id=(header.event_number & 0xfff),
+                                   // data=data);
+    // tdc[2] = VME_CAEN_V1290_SUBTDC(tdc=2,event_id=(header.event_number & 0xfff),
+                                   // data=data);
+    // tdc[3] = VME_CAEN_V1290_SUBTDC(tdc=3,event_id=(header.event_number & 0xfff),
+                                   // data=data);
+  {
+    PACK_DECL(283,VME_CAEN_V1290_SUBTDC,tdc[0],/*tdc*/0,/*event_id*/(header.event_number & 0xfff),/*data*/data);
+    PACK_DECL(284,VME_CAEN_V1290_SUBTDC,tdc[1],/*tdc*/1,/*event_id*/(header.event_number & 0xfff),/*data*/data);
+    PACK_DECL(285,VME_CAEN_V1290_SUBTDC,tdc[2],/*tdc*/2,/*event_id*/(header.event_number & 0xfff),/*data*/data);
+    PACK_DECL(286,VME_CAEN_V1290_SUBTDC,tdc[3],/*tdc*/3,/*event_id*/(header.event_number & 0xfff),/*data*/data);
+  }
+  // UINT32 trigger
+  // {
+    //  0_26: time_tag;
+    // 27_31: 17;
+  // }
+  // MARK_COUNT(v1190_end);
+  void *__mark_v1190_end = __buffer._offset;
+  // UINT32 trailer
+  // {
+    //  0_04: geom = CHECK(geom);
+    //  5_19: word_count = CHECK_COUNT(v1190_start,v1190_end,4,4);
+    //    24: tdc_error;
+    //    25: buffer_overflow;
+    //    26: trigger_lost;
+    // 27_31: 16;
+  // }
+}
+FORCE_IMPL_DATA_SRC_FCN_ARG(void,VME_CAEN_V1290::__packer,uint32 geom);
+
+/** END_PACKER ********************************************************/
+/** BEGIN_PACKER *******************************************************
+ *
+ * Event packer for VME_CAEN_V1290_SHORT_SUBTDC.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// VME_CAEN_V1290_SHORT_SUBTDC(tdc,event_id,data)
+template<typename __data_dest_t>
+void PACKER_VME_CAEN_V1290_SHORT_SUBTDC::__packer(__data_dest_t &__buffer,uint32 tdc
+                                                                         ,uint32 event_id
+                                                                         ,raw_array_multi_zero_suppress<DATA24,DATA24,32,128> &data)
+{
+  // MEMBER(DATA24 data[32] ZERO_SUPPRESS_MULTI(128));
+  // UINT32 ch_data NOENCODE
+  // {
+    //  0_20: value;
+    // 21_23: channel_low;
+    // 24_25: tdc = CHECK(tdc);
+    //    26: trailing;
+    // 27_31: 0;
+    // ENCODE(data[((tdc << 3) | channel_low)],(value=value));
+  // }
+}
+FORCE_IMPL_DATA_SRC_FCN_ARG(void,VME_CAEN_V1290_SHORT_SUBTDC::__packer,uint32 tdc
+                                                                      ,uint32 event_id);
+
+/** END_PACKER ********************************************************/
+/** BEGIN_PACKER *******************************************************
+ *
+ * Event packer for VME_CAEN_V1290_SHORT_SUBTDC_ERROR.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// VME_CAEN_V1290_SHORT_SUBTDC_ERROR(tdc)
+template<typename __data_dest_t>
+void PACKER_VME_CAEN_V1290_SHORT_SUBTDC_ERROR::__packer(__data_dest_t &__buffer,uint32 tdc)
+{
+  // UINT32 error_flags
+  // {
+    //  0_14: flags;
+    // 24_25: tdc = CHECK(tdc);
+    // 27_31: 4;
+  // }
+}
+FORCE_IMPL_DATA_SRC_FCN_ARG(void,VME_CAEN_V1290_SHORT_SUBTDC_ERROR::__packer,uint32 tdc);
+
+/** END_PACKER ********************************************************/
+/** BEGIN_PACKER *******************************************************
+ *
+ * Event packer for VME_CAEN_V1290_SHORT.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// VME_CAEN_V1290_SHORT(geom)
+template<typename __data_dest_t>
+void PACKER_VME_CAEN_V1290_SHORT::__packer(__data_dest_t &__buffer,uint32 geom)
+{
+  // MEMBER(DATA24 data[32] ZERO_SUPPRESS_MULTI(128));
+  // MARK_COUNT(v1190_start);
+  void *__mark_v1190_start = __buffer._offset;
+  // UINT32 header
+  // {
+    //  0_04: geom = MATCH(geom);
+    //  5_26: event_number;
+    // 27_31: 8;
+  // }
+  // select several
+
+    // tdc[0] = VME_CAEN_V1290_SHORT_SUBTDC(tdc=0,event_id=(header.event_number & 0xfff),
+                                         // data=data);
+    // tdc[1] = VME_CAEN_V1290_SHORT_SUBTDC(tdc=1,event_id=(header.event_number & 0xfff),
+                                         // data=data);
+    // tdc[2] = VME_CAEN_V1290_SHORT_SUBTDC(tdc=2,event_id=(header.event_number & 0xfff),
+                                         // data=data);
+    // tdc[3] = VME_CAEN_V1290_SHORT_SUBTDC(tdc=3,event_id=(header.event_number & 0xfff),
+                                         // data=data);
+    // norevisit err[0] = VME_CAEN_V1290_SHORT_SUBTDC_ERROR(tdc=0);
+    // norevisit err[1] = VME_CAEN_V1290_SHORT_SUBTDC_ERROR(tdc=1);
+    // norevisit err[2] = VME_CAEN_V1290_SHORT_SUBTDC_ERROR(tdc=2);
+    // norevisit err[3] = VME_CAEN_V1290_SHORT_SUBTDC_ERROR(tdc=3);
+  {
+    PACK_DECL(372,VME_CAEN_V1290_SHORT_SUBTDC,tdc[0],/*tdc*/0,/*event_id*/(header.event_number & 0xfff),/*data*/data);
+    PACK_DECL(373,VME_CAEN_V1290_SHORT_SUBTDC,tdc[1],/*tdc*/1,/*event_id*/(header.event_number & 0xfff),/*data*/data);
+    PACK_DECL(374,VME_CAEN_V1290_SHORT_SUBTDC,tdc[2],/*tdc*/2,/*event_id*/(header.event_number & 0xfff),/*data*/data);
+    PACK_DECL(375,VME_CAEN_V1290_SHORT_SUBTDC,tdc[3],/*tdc*/3,/*event_id*/(header.event_number & 0xfff),/*data*/data);
+    PACK_DECL(377,VME_CAEN_V1290_SHORT_SUBTDC_ERROR,err[0],/*tdc*/0);
+    PACK_DECL(378,VME_CAEN_V1290_SHORT_SUBTDC_ERROR,err[1],/*tdc*/1);
+    PACK_DECL(379,VME_CAEN_V1290_SHORT_SUBTDC_ERROR,err[2],/*tdc*/2);
+    PACK_DECL(380,VME_CAEN_V1290_SHORT_SUBTDC_ERROR,err[3],/*tdc*/3);
+  }
+  // UINT32 trigger
+  // {
+    //  0_26: time_tag;
+    // 27_31: 17;
+  // }
+  // MARK_COUNT(v1190_end);
+  void *__mark_v1190_end = __buffer._offset;
+  // UINT32 trailer
+  // {
+    //  0_04: geom = CHECK(geom);
+    //  5_19: word_count = CHECK_COUNT(v1190_start,v1190_end,4,4);
+    //    24: tdc_error;
+    //    25: buffer_overflow;
+    //    26: trigger_lost;
+    // 27_31: 16;
+  // }
+}
+FORCE_IMPL_DATA_SRC_FCN_ARG(void,VME_CAEN_V1290_SHORT::__packer,uint32 geom);
+
+/** END_PACKER ********************************************************/
+/** BEGIN_PACKER *******************************************************
+ *
+ * Event packer for VME_CAEN_V775.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// VME_CAEN_V775(geom,crate)
+template<typename __data_dest_t>
+void PACKER_VME_CAEN_V775::__packer(__data_dest_t &__buffer,uint32 geom,uint32 crate)
+{
+  // MEMBER(DATA12_OVERFLOW data[32] ZERO_SUPPRESS);
+  // UINT32 header NOENCODE
+  // {
+    //  8_13: count;
+    // 16_23: crate = MATCH(crate);
+    // 24_26: 2;
+    // 27_31: geom = MATCH(geom);
+  // }
+  // list(0<=index<header.count)
+
+  {
+    // UINT32 ch_data NOENCODE
+    // {
+      //  0_11: value;
+      //    12: overflow;
+      //    13: underflow;
+      //    14: valid;
+      // 16_20: channel;
+      // 24_26: 0;
+      // 27_31: geom = CHECK(geom);
+      // ENCODE(data[channel],(value=value,overflow=overflow));
+    // }
+  }
+  // UINT32 eob
+  // {
+    //  0_23: event_number;
+    // 24_26: 4;
+    // 27_31: geom = CHECK(geom);
+  // }
+}
+FORCE_IMPL_DATA_SRC_FCN_ARG(void,VME_CAEN_V775::__packer,uint32 geom,uint32 crate);
+
+/** END_PACKER ********************************************************/
+/** BEGIN_PACKER *******************************************************
+ *
+ * Event packer for VME_CAEN_V830.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// VME_CAEN_V830(geom)
+template<typename __data_dest_t>
+void PACKER_VME_CAEN_V830::__packer(__data_dest_t &__buffer,uint32 geom)
+{
+  // MEMBER(DATA32 data[32] ZERO_SUPPRESS);
+  // UINT32 header
+  // {
+    //  0_15: event_number;
+    // 16_17: ts;
+    // 18_23: count;
+    //    26: 1;
+    // 27_31: geom = MATCH(geom);
+  // }
+  // list(0<=index<header.count)
+
+  {
+    // UINT32 ch_data NOENCODE
+    // {
+      //  0_25: value;
+      //    26: 0;
+      // 27_31: channel;
+      // ENCODE(data[channel],(value=value));
+    // }
+  }
+}
+FORCE_IMPL_DATA_SRC_FCN_ARG(void,VME_CAEN_V830::__packer,uint32 geom);
+
+/** END_PACKER ********************************************************/
+/** BEGIN_PACKER *******************************************************
+ *
+ * Event packer for VME_MESYTEC_MADC32.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// VME_MESYTEC_MADC32(geom)
+template<typename __data_dest_t>
+void PACKER_VME_MESYTEC_MADC32::__packer(__data_dest_t &__buffer,uint32 geom)
+{
+  // MEMBER(DATA14_OVERFLOW data[32] ZERO_SUPPRESS);
+  // MARK_COUNT(start);
+  void *__mark_start = __buffer._offset;
+  // UINT32 header NOENCODE
+  // {
+    //  0_11: word_number;
+    // 12_14: adc_resol;
+    //    15: out_form;
+    // 16_23: geom = MATCH(geom);
+    // 24_29: 0;
+    // 30_31: 1;
+  // }
+  // several UINT32 ch_data NOENCODE
+  // {
+    //  0_12: value;
+    //    14: outofrange;
+    // 16_20: channel;
+    // 21_29: 32;
+    // 30_31: 0;
+    // ENCODE(data[channel],(value=value,overflow=outofrange));
+  // }
+  // optional UINT32 filler NOENCODE
+  // {
+    //  0_31: 0;
+  // }
+  // UINT32 end_of_event
+  // {
+    //  0_29: counter;
+    // 30_31: 3;
+  // }
+  // MARK_COUNT(end);
+  void *__mark_end = __buffer._offset;
+  // CHECK_COUNT(header.word_number,start,end,( - 4),4)
+}
+FORCE_IMPL_DATA_SRC_FCN_ARG(void,VME_MESYTEC_MADC32::__packer,uint32 geom);
+
+/** END_PACKER ********************************************************/
+/** BEGIN_PACKER *******************************************************
+ *
+ * Event packer for VME_MESYTEC_MDPP16.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// VME_MESYTEC_MDPP16(geom)
+template<typename __data_dest_t>
+void PACKER_VME_MESYTEC_MDPP16::__packer(__data_dest_t &__buffer,uint32 geom)
+{
+  // MEMBER(DATA16_OVERFLOW adc[16] ZERO_SUPPRESS_MULTI(20));
+  // MEMBER(DATA16_OVERFLOW tdc[16] ZERO_SUPPRESS_MULTI(20));
+  // MEMBER(DATA16_OVERFLOW trig_tdc[16] ZERO_SUPPRESS_MULTI(20));
+  // MEMBER(DATA16_OVERFLOW adc_short[16] ZERO_SUPPRESS_MULTI(20));
+  // MARK_COUNT(start);
+  void *__mark_start = __buffer._offset;
+  // UINT32 header NOENCODE
+  // {
+    //  0_09: word_number;
+    // 10_12: adc_res;
+    // 13_15: tdc_res;
+    // 16_23: geom = MATCH(geom);
+    // 24_29: 0;
+    // 30_31: 1;
+  // }
+  // several UINT32 ch_data NOENCODE
+  // {
+    //  0_15: value;
+    // 16_19: channel;
+    // 20_21: ch_kind;
+    //    22: overflow;
+    //    23: pileup;
+    // 24_27: 0;
+    // 28_31: 1;
+    // if((ch_kind == 0))
+    // {
+      // ENCODE(adc[channel],(value=value,overflow=overflow,pileup=pileup));
+    // }
+    // if((ch_kind == 1))
+    // {
+      // ENCODE(tdc[channel],(value=value,overflow=overflow,pileup=pileup));
+    // }
+    // if((ch_kind == 2))
+    // {
+      // ENCODE(trig_tdc[channel],(value=value,overflow=overflow,pileup=pileup));
+    // }
+    // if((ch_kind == 3))
+    // {
+      // ENCODE(adc_short[channel],(value=value,overflow=overflow,pileup=pileup));
+    // }
+  // }
+  // several UINT32 fill_word NOENCODE
+  // {
+    //  0_31: 0;
+  // }
+  // UINT32 end_of_event
+  // {
+    //  0_29: counter;
+    // 30_31: 3;
+  // }
+  // MARK_COUNT(end);
+  void *__mark_end = __buffer._offset;
+  // CHECK_COUNT(header.word_number,start,end,( - 4),4)
+}
+FORCE_IMPL_DATA_SRC_FCN_ARG(void,VME_MESYTEC_MDPP16::__packer,uint32 geom);
+
+/** END_PACKER ********************************************************/
+/** BEGIN_PACKER *******************************************************
+ *
+ * Event packer for WR_STAMP.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// WR_STAMP(id)
+template<typename __data_dest_t>
+void PACKER_WR_STAMP::__packer(__data_dest_t &__buffer,uint32 id)
+{
+  // MEMBER(DATA16 srcid);
+  // MEMBER(DATA16 err);
+  // MEMBER(DATA16 t1);
+  // MEMBER(DATA16 t2);
+  // MEMBER(DATA16 t3);
+  // MEMBER(DATA16 t4);
+  // UINT32 header NOENCODE
+  // {
+    //  8_11: id = MATCH(id);
+    //    16: error;
+    // ENCODE(srcid,(value=id));
+    // ENCODE(err,(value=error));
+  // }
+  // UINT32 data0 NOENCODE
+  // {
+    //  0_15: t1;
+    // 16_31: 0x3e1;
+    // ENCODE(t1,(value=t1));
+  // }
+  // UINT32 data1 NOENCODE
+  // {
+    //  0_15: t2;
+    // 16_31: 0x4e1;
+    // ENCODE(t2,(value=t2));
+  // }
+  // UINT32 data2 NOENCODE
+  // {
+    //  0_15: t3;
+    // 16_31: 0x5e1;
+    // ENCODE(t3,(value=t3));
+  // }
+  // UINT32 data3 NOENCODE
+  // {
+    //  0_15: t4;
+    // 16_31: 0x6e1;
+    // ENCODE(t4,(value=t4));
+  // }
+}
+FORCE_IMPL_DATA_SRC_FCN_ARG(void,WR_STAMP::__packer,uint32 id);
+
+/** END_PACKER ********************************************************/
+/** BEGIN_PACKER *******************************************************
+ *
+ * Event packer for XTST_STD_VME.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// XTST_STD_VME()
+template<typename __data_dest_t>
+void PACKER_XTST_STD_VME::__packer(__data_dest_t &__buffer)
+{
+  // UINT32 failure
+  // {
+    //     0: fail_general;
+    //     1: fail_data_corrupt;
+    //     2: fail_data_missing;
+    //     3: fail_data_too_much;
+    //     4: fail_event_counter_mismatch;
+    //     5: fail_readout_error_driver;
+    //     6: fail_unexpected_trigger;
+    //    27: has_no_zero_suppression;
+    //    28: has_multi_adctdc_counter0;
+    //    29: has_multi_scaler_counter0;
+    //    30: has_multi_event;
+    //    31: has_time_stamp;
+  // }
+  // if(failure.has_time_stamp)
+
+  if (failure.has_time_stamp)
+  {
+    // UINT32 time_stamp;
+  }
+  // if(failure.has_multi_event)
+
+  if (failure.has_multi_event)
+  {
+    // UINT32 multi_events;
+  }
+  // if(failure.has_multi_scaler_counter0)
+
+  if (failure.has_multi_scaler_counter0)
+  {
+    // UINT32 multi_scaler_counter0;
+  }
+  // if(failure.has_multi_adctdc_counter0)
+
+  if (failure.has_multi_adctdc_counter0)
+  {
+    // UINT32 multi_adctdc_counter0;
+  }
+}
+FORCE_IMPL_DATA_SRC_FCN(void,XTST_STD_VME::__packer);
+
+/** END_PACKER ********************************************************/
+/** BEGIN_PACKER *******************************************************
+ *
+ * Event packer for XTST_SUBEVENT_MEMBER_DATA12.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// XTST_SUBEVENT_MEMBER_DATA12()
+template<typename __data_dest_t>
+void PACKER_XTST_SUBEVENT_MEMBER_DATA12::__packer(__data_dest_t &__buffer)
+{
+  // MEMBER(DATA12 mDATA12);
+  // MEMBER(DATA12 mDATA12_array[8]);
+  // MEMBER(DATA12 mDATA12_array_zzp[8] ZERO_SUPPRESS);
+  // MEMBER(DATA12 mDATA12_array_zzpii[8] ZERO_SUPPRESS_LIST);
+  // MEMBER(DATA12 mDATA12_array_zzpml[8] ZERO_SUPPRESS_MULTI(4));
+  // MEMBER(DATA12 mDATA12_array2[2][8]);
+  // MEMBER(DATA12 mDATA12_array2_zzp[2][8] ZERO_SUPPRESS);
+  // MEMBER(DATA12 mDATA12_array2_zzpii[2][8] ZERO_SUPPRESS_LIST);
+  // MEMBER(DATA12 mDATA12_array2_zzpml[2][8] ZERO_SUPPRESS_MULTI(4));
+}
+FORCE_IMPL_DATA_SRC_FCN(void,XTST_SUBEVENT_MEMBER_DATA12::__packer);
+
+/** END_PACKER ********************************************************/
+/** BEGIN_PACKER *******************************************************
+ *
+ * Event packer for XTST_SUBEVENT_MEMBER_DATA12_OVERFLOW.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// XTST_SUBEVENT_MEMBER_DATA12_OVERFLOW()
+template<typename __data_dest_t>
+void PACKER_XTST_SUBEVENT_MEMBER_DATA12_OVERFLOW::__packer(__data_dest_t &__buffer)
+{
+  // MEMBER(DATA12_OVERFLOW mDATA12_OVERFLOW);
+  // MEMBER(DATA12_OVERFLOW mDATA12_OVERFLOW_array[8]);
+  // MEMBER(DATA12_OVERFLOW mDATA12_OVERFLOW_array_zzp[8] ZERO_SUPPRESS);
+  // MEMBER(DATA12_OVERFLOW mDATA12_OVERFLOW_array_zzpii[8] ZERO_SUPPRESS_LIST);
+  // MEMBER(DATA12_OVERFLOW mDATA12_OVERFLOW_array_zzpml[8] ZERO_SUPPRESS_MULTI(4));
+  // MEMBER(DATA12_OVERFLOW mDATA12_OVERFLOW_array2[2][8]);
+  // MEMBER(DATA12_OVERFLOW mDATA12_OVERFLOW_array2_zzp[2][8] ZERO_SUPPRESS);
+  // MEMBER(DATA12_OVERFLOW mDATA12_OVERFLOW_array2_zzpii[2][8] ZERO_SUPPRESS_LIST);
+  // MEMBER(DATA12_OVERFLOW mDATA12_OVERFLOW_array2_zzpml[2][8] ZERO_SUPPRESS_MULTI(4));
+}
+FORCE_IMPL_DATA_SRC_FCN(void,XTST_SUBEVENT_MEMBER_DATA12_OVERFLOW::__packer);
+
+/** END_PACKER ********************************************************/
+/** BEGIN_PACKER *******************************************************
+ *
+ * Event packer for XTST_SUBEVENT_MEMBER_DATA12_RANGE.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// XTST_SUBEVENT_MEMBER_DATA12_RANGE()
+template<typename __data_dest_t>
+void PACKER_XTST_SUBEVENT_MEMBER_DATA12_RANGE::__packer(__data_dest_t &__buffer)
+{
+  // MEMBER(DATA12_RANGE mDATA12_RANGE);
+  // MEMBER(DATA12_RANGE mDATA12_RANGE_array[8]);
+  // MEMBER(DATA12_RANGE mDATA12_RANGE_array_zzp[8] ZERO_SUPPRESS);
+  // MEMBER(DATA12_RANGE mDATA12_RANGE_array_zzpii[8] ZERO_SUPPRESS_LIST);
+  // MEMBER(DATA12_RANGE mDATA12_RANGE_array_zzpml[8] ZERO_SUPPRESS_MULTI(4));
+  // MEMBER(DATA12_RANGE mDATA12_RANGE_array2[2][8]);
+  // MEMBER(DATA12_RANGE mDATA12_RANGE_array2_zzp[2][8] ZERO_SUPPRESS);
+  // MEMBER(DATA12_RANGE mDATA12_RANGE_array2_zzpii[2][8] ZERO_SUPPRESS_LIST);
+  // MEMBER(DATA12_RANGE mDATA12_RANGE_array2_zzpml[2][8] ZERO_SUPPRESS_MULTI(4));
+}
+FORCE_IMPL_DATA_SRC_FCN(void,XTST_SUBEVENT_MEMBER_DATA12_RANGE::__packer);
+
+/** END_PACKER ********************************************************/
+/** BEGIN_PACKER *******************************************************
+ *
+ * Event packer for XTST_SUBEVENT_MEMBER_DATA16.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// XTST_SUBEVENT_MEMBER_DATA16()
+template<typename __data_dest_t>
+void PACKER_XTST_SUBEVENT_MEMBER_DATA16::__packer(__data_dest_t &__buffer)
+{
+  // MEMBER(DATA16 mDATA16);
+  // MEMBER(DATA16 mDATA16_array[8]);
+  // MEMBER(DATA16 mDATA16_array_zzp[8] ZERO_SUPPRESS);
+  // MEMBER(DATA16 mDATA16_array_zzpii[8] ZERO_SUPPRESS_LIST);
+  // MEMBER(DATA16 mDATA16_array_zzpml[8] ZERO_SUPPRESS_MULTI(4));
+  // MEMBER(DATA16 mDATA16_array2[2][8]);
+  // MEMBER(DATA16 mDATA16_array2_zzp[2][8] ZERO_SUPPRESS);
+  // MEMBER(DATA16 mDATA16_array2_zzpii[2][8] ZERO_SUPPRESS_LIST);
+  // MEMBER(DATA16 mDATA16_array2_zzpml[2][8] ZERO_SUPPRESS_MULTI(4));
+}
+FORCE_IMPL_DATA_SRC_FCN(void,XTST_SUBEVENT_MEMBER_DATA16::__packer);
+
+/** END_PACKER ********************************************************/
+/** BEGIN_PACKER *******************************************************
+ *
+ * Event packer for XTST_SUBEVENT_MEMBER_DATA16_OVERFLOW.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// XTST_SUBEVENT_MEMBER_DATA16_OVERFLOW()
+template<typename __data_dest_t>
+void PACKER_XTST_SUBEVENT_MEMBER_DATA16_OVERFLOW::__packer(__data_dest_t &__buffer)
+{
+  // MEMBER(DATA16_OVERFLOW mDATA16_OVERFLOW);
+  // MEMBER(DATA16_OVERFLOW mDATA16_OVERFLOW_array[8]);
+  // MEMBER(DATA16_OVERFLOW mDATA16_OVERFLOW_array_zzp[8] ZERO_SUPPRESS);
+  // MEMBER(DATA16_OVERFLOW mDATA16_OVERFLOW_array_zzpii[8] ZERO_SUPPRESS_LIST);
+  // MEMBER(DATA16_OVERFLOW mDATA16_OVERFLOW_array_zzpml[8] ZERO_SUPPRESS_MULTI(4));
+  // MEMBER(DATA16_OVERFLOW mDATA16_OVERFLOW_array2[2][8]);
+  // MEMBER(DATA16_OVERFLOW mDATA16_OVERFLOW_array2_zzp[2][8] ZERO_SUPPRESS);
+  // MEMBER(DATA16_OVERFLOW mDATA16_OVERFLOW_array2_zzpii[2][8] ZERO_SUPPRESS_LIST);
+  // MEMBER(DATA16_OVERFLOW mDATA16_OVERFLOW_array2_zzpml[2][8] ZERO_SUPPRESS_MULTI(4));
+}
+FORCE_IMPL_DATA_SRC_FCN(void,XTST_SUBEVENT_MEMBER_DATA16_OVERFLOW::__packer);
+
+/** END_PACKER ********************************************************/
+/** BEGIN_PACKER *******************************************************
+ *
+ * Event packer for XTST_SUBEVENT_MEMBER_DATA24.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// XTST_SUBEVENT_MEMBER_DATA24()
+template<typename __data_dest_t>
+void PACKER_XTST_SUBEVENT_MEMBER_DATA24::__packer(__data_dest_t &__buffer)
+{
+  // MEMBER(DATA24 mDATA24);
+  // MEMBER(DATA24 mDATA24_array[8]);
+  // MEMBER(DATA24 mDATA24_array_zzp[8] ZERO_SUPPRESS);
+  // MEMBER(DATA24 mDATA24_array_zzpii[8] ZERO_SUPPRESS_LIST);
+  // MEMBER(DATA24 mDATA24_array_zzpml[8] ZERO_SUPPRESS_MULTI(4));
+  // MEMBER(DATA24 mDATA24_array2[2][8]);
+  // MEMBER(DATA24 mDATA24_array2_zzp[2][8] ZERO_SUPPRESS);
+  // MEMBER(DATA24 mDATA24_array2_zzpii[2][8] ZERO_SUPPRESS_LIST);
+  // MEMBER(DATA24 mDATA24_array2_zzpml[2][8] ZERO_SUPPRESS_MULTI(4));
+}
+FORCE_IMPL_DATA_SRC_FCN(void,XTST_SUBEVENT_MEMBER_DATA24::__packer);
+
+/** END_PACKER ********************************************************/
+/** BEGIN_PACKER *******************************************************
+ *
+ * Event packer for XTST_SUBEVENT_MEMBER_DATA32.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// XTST_SUBEVENT_MEMBER_DATA32()
+template<typename __data_dest_t>
+void PACKER_XTST_SUBEVENT_MEMBER_DATA32::__packer(__data_dest_t &__buffer)
+{
+  // MEMBER(DATA32 mDATA32);
+  // MEMBER(DATA32 mDATA32_array[8]);
+  // MEMBER(DATA32 mDATA32_array_zzp[8] ZERO_SUPPRESS);
+  // MEMBER(DATA32 mDATA32_array_zzpii[8] ZERO_SUPPRESS_LIST);
+  // MEMBER(DATA32 mDATA32_array_zzpml[8] ZERO_SUPPRESS_MULTI(4));
+  // MEMBER(DATA32 mDATA32_array2[2][8]);
+  // MEMBER(DATA32 mDATA32_array2_zzp[2][8] ZERO_SUPPRESS);
+  // MEMBER(DATA32 mDATA32_array2_zzpii[2][8] ZERO_SUPPRESS_LIST);
+  // MEMBER(DATA32 mDATA32_array2_zzpml[2][8] ZERO_SUPPRESS_MULTI(4));
+}
+FORCE_IMPL_DATA_SRC_FCN(void,XTST_SUBEVENT_MEMBER_DATA32::__packer);
+
+/** END_PACKER ********************************************************/
+/** BEGIN_PACKER *******************************************************
+ *
+ * Event packer for XTST_SUBEVENT_MEMBER_DATA32_B.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// XTST_SUBEVENT_MEMBER_DATA32_B()
+template<typename __data_dest_t>
+void PACKER_XTST_SUBEVENT_MEMBER_DATA32_B::__packer(__data_dest_t &__buffer)
+{
+  // MEMBER(DATA32 mDATA32_array_zzpml[8] ZERO_SUPPRESS_MULTI(4));
+}
+FORCE_IMPL_DATA_SRC_FCN(void,XTST_SUBEVENT_MEMBER_DATA32_B::__packer);
+
+/** END_PACKER ********************************************************/
+/** BEGIN_PACKER *******************************************************
+ *
+ * Event packer for XTST_SUBEVENT_MEMBER_DATA8.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// XTST_SUBEVENT_MEMBER_DATA8()
+template<typename __data_dest_t>
+void PACKER_XTST_SUBEVENT_MEMBER_DATA8::__packer(__data_dest_t &__buffer)
+{
+  // MEMBER(DATA8 mDATA8);
+  // MEMBER(DATA8 mDATA8_array[8]);
+  // MEMBER(DATA8 mDATA8_array_zzp[8] ZERO_SUPPRESS);
+  // MEMBER(DATA8 mDATA8_array_zzpii[8] ZERO_SUPPRESS_LIST);
+  // MEMBER(DATA8 mDATA8_array_zzpml[8] ZERO_SUPPRESS_MULTI(4));
+  // MEMBER(DATA8 mDATA8_array2[2][8]);
+  // MEMBER(DATA8 mDATA8_array2_zzp[2][8] ZERO_SUPPRESS);
+  // MEMBER(DATA8 mDATA8_array2_zzpii[2][8] ZERO_SUPPRESS_LIST);
+  // MEMBER(DATA8 mDATA8_array2_zzpml[2][8] ZERO_SUPPRESS_MULTI(4));
+}
+FORCE_IMPL_DATA_SRC_FCN(void,XTST_SUBEVENT_MEMBER_DATA8::__packer);
+
+/** END_PACKER ********************************************************/
+/** BEGIN_PACKER *******************************************************
+ *
+ * Event packer for XTST_SUBEVENT_MEMBER_uint16.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// XTST_SUBEVENT_MEMBER_uint16()
+template<typename __data_dest_t>
+void PACKER_XTST_SUBEVENT_MEMBER_uint16::__packer(__data_dest_t &__buffer)
+{
+  // MEMBER(uint16 muint16);
+}
+FORCE_IMPL_DATA_SRC_FCN(void,XTST_SUBEVENT_MEMBER_uint16::__packer);
+
+/** END_PACKER ********************************************************/
+/** BEGIN_PACKER *******************************************************
+ *
+ * Event packer for XTST_SUBEVENT_MEMBER_uint32.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// XTST_SUBEVENT_MEMBER_uint32()
+template<typename __data_dest_t>
+void PACKER_XTST_SUBEVENT_MEMBER_uint32::__packer(__data_dest_t &__buffer)
+{
+  // MEMBER(uint32 muint32);
+}
+FORCE_IMPL_DATA_SRC_FCN(void,XTST_SUBEVENT_MEMBER_uint32::__packer);
+
+/** END_PACKER ********************************************************/
+/** BEGIN_PACKER *******************************************************
+ *
+ * Event packer for XTST_SUBEVENT_MEMBER_uint8.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// XTST_SUBEVENT_MEMBER_uint8()
+template<typename __data_dest_t>
+void PACKER_XTST_SUBEVENT_MEMBER_uint8::__packer(__data_dest_t &__buffer)
+{
+  // MEMBER(uint8 muint8);
+}
+FORCE_IMPL_DATA_SRC_FCN(void,XTST_SUBEVENT_MEMBER_uint8::__packer);
+
+/** END_PACKER ********************************************************/
+/** BEGIN_PACKER *******************************************************
+ *
+ * Event packer for BITS64.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// SUBEVENT(BITS64)
+template<typename __data_dest_t>
+void PACKER_BITS64::__packer(__data_dest_t &__buffer)
+{
+  // MEMBER(DATA64 member64);
+  // MEMBER(DATA64 array64[7]);
+  // MEMBER(DATA32 member32);
+  // UINT32 data32_1;
+  // UINT32 data32_2;
+  // MARK_COUNT(start);
+  void *__mark_start = __buffer._offset;
+  // UINT64 data64_1;
+  // MARK_COUNT(end);
+  void *__mark_end = __buffer._offset;
+  // CHECK_COUNT(data32_1,start,end,4,4)
+  // select several
+
+    // i[0] = ITEM64(num=0);
+    // i[1] = ITEM64(num=1);
+    // i[2] = ITEM64(num=2);
+  {
+    PACK_DECL(893,ITEM64,i[0],/*num*/0);
+    PACK_DECL(894,ITEM64,i[1],/*num*/1);
+    PACK_DECL(895,ITEM64,i[2],/*num*/2);
+  }
+}
+FORCE_IMPL_DATA_SRC_FCN(void,BITS64::__packer);
+
+/** END_PACKER ********************************************************/
+/** BEGIN_PACKER *******************************************************
+ *
+ * Event packer for XTST_MDPP16.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// SUBEVENT(XTST_MDPP16)
+template<typename __data_dest_t>
+void PACKER_XTST_MDPP16::__packer(__data_dest_t &__buffer)
+{
+  // UINT16 align
+  // {
+    //  0_15: unaligned;
+  // }
+  // if(( ! align.unaligned))
+
+  if (( ! align.unaligned))
+  {
+    // UINT16 pad;
+  }
+  // select several
+
+    // mdpp16[0] = VME_MESYTEC_MDPP16(geom=1);
+    // mdpp16[1] = VME_MESYTEC_MDPP16(geom=2);
+  {
+    PACK_DECL(1059,VME_MESYTEC_MDPP16,mdpp16[0],/*geom*/1);
+    PACK_DECL(1060,VME_MESYTEC_MDPP16,mdpp16[1],/*geom*/2);
+  }
+}
+FORCE_IMPL_DATA_SRC_FCN(void,XTST_MDPP16::__packer);
+
+/** END_PACKER ********************************************************/
+/** BEGIN_PACKER *******************************************************
+ *
+ * Event packer for XTST_PLAIN.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// SUBEVENT(XTST_PLAIN)
+template<typename __data_dest_t>
+void PACKER_XTST_PLAIN::__packer(__data_dest_t &__buffer)
+{
+  // UINT32 u;
+  // UINT16 s;
+  // UINT8 c;
+}
+FORCE_IMPL_DATA_SRC_FCN(void,XTST_PLAIN::__packer);
+
+/** END_PACKER ********************************************************/
+/** BEGIN_PACKER *******************************************************
+ *
+ * Event packer for XTST_REGRESS.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// SUBEVENT(XTST_REGRESS)
+template<typename __data_dest_t>
+void PACKER_XTST_REGRESS::__packer(__data_dest_t &__buffer)
+{
+  // select several
+
+    // wr[1] = WR_STAMP(id=1);
+    // wr[2] = WR_STAMP(id=2);
+    // wr[3] = WR_STAMP(id=3);
+    // wr[4] = WR_STAMP(id=4);
+    // wr[5] = WR_STAMP(id=5);
+  {
+    PACK_DECL(997,WR_STAMP,wr[1],/*id*/1);
+    PACK_DECL(998,WR_STAMP,wr[2],/*id*/2);
+    PACK_DECL(999,WR_STAMP,wr[3],/*id*/3);
+    PACK_DECL(1000,WR_STAMP,wr[4],/*id*/4);
+    PACK_DECL(1001,WR_STAMP,wr[5],/*id*/5);
+  }
+  // UINT32 separator1 NOENCODE
+  // {
+    //  0_31: 0;
+  // }
+  // UINT32 seed;
+  // select several
+
+    // v775mod[0] = VME_CAEN_V775(geom=1,crate=127);
+    // v775mod[1] = VME_CAEN_V775(geom=2,crate=126);
+  {
+    PACK_DECL(1013,VME_CAEN_V775,v775mod[0],/*geom*/1,/*crate*/127);
+    PACK_DECL(1014,VME_CAEN_V775,v775mod[1],/*geom*/2,/*crate*/126);
+  }
+  // UINT32 separator2 NOENCODE
+  // {
+    //  0_31: 0;
+  // }
+  // select several
+
+    // v1290mod[0] = VME_CAEN_V1290_SHORT(geom=1);
+    // v1290mod[1] = VME_CAEN_V1290_SHORT(geom=2);
+  {
+    PACK_DECL(1024,VME_CAEN_V1290_SHORT,v1290mod[0],/*geom*/1);
+    PACK_DECL(1025,VME_CAEN_V1290_SHORT,v1290mod[1],/*geom*/2);
+  }
+  // select several
+
+    // sticky_active = STICKY_ACTIVE();
+  {
+    PACK_DECL(1030,STICKY_ACTIVE,sticky_active);
+  }
+}
+FORCE_IMPL_DATA_SRC_FCN(void,XTST_REGRESS::__packer);
+
+/** END_PACKER ********************************************************/
+/** BEGIN_PACKER *******************************************************
+ *
+ * Event packer for XTST_REGRESSEXTRA.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// SUBEVENT(XTST_REGRESSEXTRA)
+template<typename __data_dest_t>
+void PACKER_XTST_REGRESSEXTRA::__packer(__data_dest_t &__buffer)
+{
+  // UINT32 junk;
+}
+FORCE_IMPL_DATA_SRC_FCN(void,XTST_REGRESSEXTRA::__packer);
+
+/** END_PACKER ********************************************************/
+/** BEGIN_PACKER *******************************************************
+ *
+ * Event packer for XTST_STICKY_CORR.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// SUBEVENT(XTST_STICKY_CORR)
+template<typename __data_dest_t>
+void PACKER_XTST_STICKY_CORR::__packer(__data_dest_t &__buffer)
+{
+  // UINT32 base;
+}
+FORCE_IMPL_DATA_SRC_FCN(void,XTST_STICKY_CORR::__packer);
+
+/** END_PACKER ********************************************************/
+/** BEGIN_PACKER *******************************************************
+ *
+ * Event packer for XTST_SUBEVENT_ME2.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// SUBEVENT(XTST_SUBEVENT_ME2)
+template<typename __data_dest_t>
+void PACKER_XTST_SUBEVENT_ME2::__packer(__data_dest_t &__buffer)
+{
+  // select several
+
+    // i[0] = ITEM_ME2(geom=0);
+    // i[1] = ITEM_ME2(geom=1);
+    // i[2] = ITEM_ME2(geom=2);
+  {
+    PACK_DECL(924,ITEM_ME2,i[0],/*geom*/0);
+    PACK_DECL(925,ITEM_ME2,i[1],/*geom*/1);
+    PACK_DECL(926,ITEM_ME2,i[2],/*geom*/2);
+  }
+}
+FORCE_IMPL_DATA_SRC_FCN(void,XTST_SUBEVENT_ME2::__packer);
+
+/** END_PACKER ********************************************************/
+/** BEGIN_PACKER *******************************************************
+ *
+ * Event packer for XTST_SUBEVENT_MEMBER_ENCODE.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// SUBEVENT(XTST_SUBEVENT_MEMBER_ENCODE)
+template<typename __data_dest_t>
+void PACKER_XTST_SUBEVENT_MEMBER_ENCODE::__packer(__data_dest_t &__buffer)
+{
+  // member_DATA32 = XTST_SUBEVENT_MEMBER_DATA32();
+  PACK_DECL(801,XTST_SUBEVENT_MEMBER_DATA32,member_DATA32);
+  // member_DATA24 = XTST_SUBEVENT_MEMBER_DATA24();
+  PACK_DECL(802,XTST_SUBEVENT_MEMBER_DATA24,member_DATA24);
+  // member_DATA16 = XTST_SUBEVENT_MEMBER_DATA16();
+  PACK_DECL(803,XTST_SUBEVENT_MEMBER_DATA16,member_DATA16);
+  // member_DATA16_OVERFLOW = XTST_SUBEVENT_MEMBER_DATA16_OVERFLOW();
+  PACK_DECL(804,XTST_SUBEVENT_MEMBER_DATA16_OVERFLOW,member_DATA16_OVERFLOW);
+  // member_DATA12 = XTST_SUBEVENT_MEMBER_DATA12();
+  PACK_DECL(805,XTST_SUBEVENT_MEMBER_DATA12,member_DATA12);
+  // member_DATA12_OVERFLOW = XTST_SUBEVENT_MEMBER_DATA12_OVERFLOW();
+  PACK_DECL(806,XTST_SUBEVENT_MEMBER_DATA12_OVERFLOW,member_DATA12_OVERFLOW);
+  // member_DATA12_RANGE = XTST_SUBEVENT_MEMBER_DATA12_RANGE();
+  PACK_DECL(807,XTST_SUBEVENT_MEMBER_DATA12_RANGE,member_DATA12_RANGE);
+  // member_uint32 = XTST_SUBEVENT_MEMBER_uint32();
+  PACK_DECL(809,XTST_SUBEVENT_MEMBER_uint32,member_uint32);
+  // member_uint16 = XTST_SUBEVENT_MEMBER_uint16();
+  PACK_DECL(810,XTST_SUBEVENT_MEMBER_uint16,member_uint16);
+  // member_uint8 = XTST_SUBEVENT_MEMBER_uint8();
+  PACK_DECL(811,XTST_SUBEVENT_MEMBER_uint8,member_uint8);
+}
+FORCE_IMPL_DATA_SRC_FCN(void,XTST_SUBEVENT_MEMBER_ENCODE::__packer);
+
+/** END_PACKER ********************************************************/
+/** BEGIN_PACKER *******************************************************
+ *
+ * Event packer for XTST_SUBEVENT_MEMBER_ENCODE_A.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// SUBEVENT(XTST_SUBEVENT_MEMBER_ENCODE_A)
+template<typename __data_dest_t>
+void PACKER_XTST_SUBEVENT_MEMBER_ENCODE_A::__packer(__data_dest_t &__buffer)
+{
+  // d32 = XTST_SUBEVENT_MEMBER_DATA32();
+  PACK_DECL(818,XTST_SUBEVENT_MEMBER_DATA32,d32);
+}
+FORCE_IMPL_DATA_SRC_FCN(void,XTST_SUBEVENT_MEMBER_ENCODE_A::__packer);
+
+/** END_PACKER ********************************************************/
+/** BEGIN_PACKER *******************************************************
+ *
+ * Event packer for XTST_SUBEVENT_MEMBER_ENCODE_B.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// SUBEVENT(XTST_SUBEVENT_MEMBER_ENCODE_B)
+template<typename __data_dest_t>
+void PACKER_XTST_SUBEVENT_MEMBER_ENCODE_B::__packer(__data_dest_t &__buffer)
+{
+  // d32 = XTST_SUBEVENT_MEMBER_DATA32_B();
+  PACK_DECL(823,XTST_SUBEVENT_MEMBER_DATA32_B,d32);
+}
+FORCE_IMPL_DATA_SRC_FCN(void,XTST_SUBEVENT_MEMBER_ENCODE_B::__packer);
+
+/** END_PACKER ********************************************************/
+/** BEGIN_PACKER *******************************************************
+ *
+ * Event packer for XTST_VME.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// SUBEVENT(XTST_VME)
+template<typename __data_dest_t>
+void PACKER_XTST_VME::__packer(__data_dest_t &__buffer)
+{
+  // header = XTST_STD_VME();
+  PACK_DECL(765,XTST_STD_VME,header);
+  // sdm = SINGLE_DATA_MODULE();
+  PACK_DECL(767,SINGLE_DATA_MODULE,sdm);
+  // select several
+
+    // tdc0 = VME_CAEN_V775(geom=20,crate=20);
+    // tdc1 = VME_CAEN_V775(geom=21,crate=20);
+    // tdc2 = VME_CAEN_V775(geom=22,crate=20);
+    // qdc0 = VME_CAEN_V775(geom=21,crate=40);
+    // qdc1 = VME_CAEN_V775(geom=21,crate=40);
+  {
+    PACK_DECL(771,VME_CAEN_V775,tdc0,/*geom*/20,/*crate*/20);
+    PACK_DECL(772,VME_CAEN_V775,tdc1,/*geom*/21,/*crate*/20);
+    PACK_DECL(773,VME_CAEN_V775,tdc2,/*geom*/22,/*crate*/20);
+    PACK_DECL(774,VME_CAEN_V775,qdc0,/*geom*/21,/*crate*/40);
+    PACK_DECL(775,VME_CAEN_V775,qdc1,/*geom*/21,/*crate*/40);
+  }
+  // select several
+
+    // mdpp16 = VME_MESYTEC_MDPP16(geom=31);
+  {
+    PACK_DECL(779,VME_MESYTEC_MDPP16,mdpp16,/*geom*/31);
+  }
+}
+FORCE_IMPL_DATA_SRC_FCN(void,XTST_VME::__packer);
+
+/** END_PACKER ********************************************************/
+/** BEGIN_PACKER *******************************************************
+ *
+ * Event packer for EVENT.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// EVENT
+  // vme = XTST_VME(type=36,subtype=0xc1c);
+  // bits64 = BITS64(type=64,subtype=64);
+  // me = XTST_SUBEVENT_MEMBER_ENCODE(type=10);
+  // mea = XTST_SUBEVENT_MEMBER_ENCODE_A(type=12);
+  // meb = XTST_SUBEVENT_MEMBER_ENCODE_B(type=13);
+  // me2 = XTST_SUBEVENT_ME2(type=11);
+  // plain = XTST_PLAIN(type=12);
+  // regress[0] = XTST_REGRESS(type=0xcae,subtype=0xcae,subcrate=0);
+  // regress[1] = XTST_REGRESS(type=0xcae,subtype=0xcae,subcrate=1);
+  // regress[2] = XTST_REGRESS(type=0xcae,subtype=0xcae,subcrate=2);
+  // regress[3] = XTST_REGRESS(type=0xcae,subtype=0xcae,subcrate=3);
+  // regress[4] = XTST_REGRESS(type=0xcae,subtype=0xcae,subcrate=4);
+  // regress[5] = XTST_REGRESS(type=0xcae,subtype=0xcae,subcrate=5);
+  // regress[6] = XTST_REGRESS(type=0xcae,subtype=0xcae,subcrate=6);
+  // regress[7] = XTST_REGRESS(type=0xcae,subtype=0xcae,subcrate=7);
+  // regress[8] = XTST_REGRESS(type=0xcae,subtype=0xcae,subcrate=8);
+  // regress[9] = XTST_REGRESS(type=0xcae,subtype=0xcae,subcrate=9);
+  // regress[10] = XTST_REGRESS(type=0xcae,subtype=0xcae,subcrate=10);
+  // regress[11] = XTST_REGRESS(type=0xcae,subtype=0xcae,subcrate=11);
+  // regress[12] = XTST_REGRESS(type=0xcae,subtype=0xcae,subcrate=12);
+  // regress[13] = XTST_REGRESS(type=0xcae,subtype=0xcae,subcrate=13);
+  // regress[14] = XTST_REGRESS(type=0xcae,subtype=0xcae,subcrate=14);
+  // regress[15] = XTST_REGRESS(type=0xcae,subtype=0xcae,subcrate=15);
+  // regressextra = XTST_REGRESSEXTRA(type=0xde0,subtype=0xad0);
+  // mdpp = XTST_MDPP16(type=0xbd0,subtype=22);
+{
+}
+
+/** END_PACKER ********************************************************/
+/** BEGIN_PACKER *******************************************************
+ *
+ * Event packer for EVENT.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// STICKY_EVENT
+  // corr = XTST_STICKY_CORR(type=0xcae,subtype=0xcaf);
+  // ignore_unknown_subevent;
+{
+}
+
+/** END_PACKER ********************************************************/
@@ -0,0 +1,530 @@
+/** BEGIN_FUNCTION_CALL_PER_MEMBER *************************************
+ *
+ * Recursive function calls per member.
+ *
+ * Do not edit - automatically generated.
+ */
+
+#include "gen/default_fcncall_define.hh"
+
+#ifndef USER_DEF_raw_event_POS
+FCNCALL_TEMPLATE
+FCNCALL_RET_TYPE FCNCALL_CLASS_NAME(raw_event_POS)::FCNCALL_NAME(raw_event_POS)
+{
+  FCNCALL_INIT;
+  // TOGGLE(DATA12) T;
+  {
+  FCNCALL_SUBNAME("T");
+  { FCNCALL_CALL_CTRL_WRAP(T,T.FCNCALL_CALL(T)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // TOGGLE(DATA12) E;
+  {
+  FCNCALL_SUBNAME("E");
+  { FCNCALL_CALL_CTRL_WRAP(E,E.FCNCALL_CALL(E)); }
+  FCNCALL_SUBNAME_END;
+  }
+  FCNCALL_RET;
+}
+#endif//USER_DEF_raw_event_POS
+
+#ifndef USER_DEF_raw_event_PIN
+FCNCALL_TEMPLATE
+FCNCALL_RET_TYPE FCNCALL_CLASS_NAME(raw_event_PIN)::FCNCALL_NAME(raw_event_PIN)
+{
+  FCNCALL_INIT;
+  // DATA12 E;
+  {
+  FCNCALL_SUBNAME("E");
+  { FCNCALL_CALL_CTRL_WRAP(E,E.FCNCALL_CALL(E)); }
+  FCNCALL_SUBNAME_END;
+  }
+  FCNCALL_RET;
+}
+#endif//USER_DEF_raw_event_PIN
+
+#ifndef USER_DEF_raw_event_GFI_U
+FCNCALL_TEMPLATE
+FCNCALL_RET_TYPE FCNCALL_CLASS_NAME(raw_event_GFI_U)::FCNCALL_NAME(raw_event_GFI_U)
+{
+  FCNCALL_INIT;
+  // DATA12 E;
+  {
+  FCNCALL_SUBNAME("E");
+  { FCNCALL_CALL_CTRL_WRAP(E,E.FCNCALL_CALL(E)); }
+  FCNCALL_SUBNAME_END;
+  }
+  FCNCALL_RET;
+}
+#endif//USER_DEF_raw_event_GFI_U
+
+#ifndef USER_DEF_raw_event_GFI_PM
+FCNCALL_TEMPLATE
+FCNCALL_RET_TYPE FCNCALL_CLASS_NAME(raw_event_GFI_PM)::FCNCALL_NAME(raw_event_GFI_PM)
+{
+  FCNCALL_INIT;
+  // DATA12 T;
+  {
+  FCNCALL_SUBNAME("T");
+  { FCNCALL_CALL_CTRL_WRAP(T,T.FCNCALL_CALL(T)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // DATA12 E;
+  {
+  FCNCALL_SUBNAME("E");
+  { FCNCALL_CALL_CTRL_WRAP(E,E.FCNCALL_CALL(E)); }
+  FCNCALL_SUBNAME_END;
+  }
+  FCNCALL_RET;
+}
+#endif//USER_DEF_raw_event_GFI_PM
+
+#ifndef USER_DEF_raw_event_GFI_V
+FCNCALL_TEMPLATE
+FCNCALL_RET_TYPE FCNCALL_CLASS_NAME(raw_event_GFI_V)::FCNCALL_NAME(raw_event_GFI_V)
+{
+  FCNCALL_INIT;
+  // DATA12 E;
+  {
+  FCNCALL_SUBNAME("E");
+  { FCNCALL_CALL_CTRL_WRAP(E,E.FCNCALL_CALL(E)); }
+  FCNCALL_SUBNAME_END;
+  }
+  FCNCALL_RET;
+}
+#endif//USER_DEF_raw_event_GFI_V
+
+#ifndef USER_DEF_raw_event_GFI
+FCNCALL_TEMPLATE
+FCNCALL_RET_TYPE FCNCALL_CLASS_NAME(raw_event_GFI)::FCNCALL_NAME(raw_event_GFI)
+{
+  FCNCALL_INIT;
+  // raw_event_GFI_U U[18];
+  {
+  FCNCALL_SUBNAME("U");
+  FCNCALL_FOR(__i0,18)
+  {
+    FCNCALL_SUBINDEX(__i0);
+    { FCNCALL_CALL_CTRL_WRAP_ARRAY(U__i0,,__i0,U[__i0].FCNCALL_CALL(U[__i0])); }
+    FCNCALL_SUBINDEX_END(__i0);
+  }
+  FCNCALL_SUBNAME_END;
+  }
+  // raw_event_GFI_PM PM;
+  {
+  FCNCALL_SUBNAME("PM");
+  { FCNCALL_CALL_CTRL_WRAP(PM,PM.FCNCALL_CALL(PM)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // raw_event_GFI_V V[16];
+  {
+  FCNCALL_SUBNAME("V");
+  FCNCALL_FOR(__i0,16)
+  {
+    FCNCALL_SUBINDEX(__i0);
+    { FCNCALL_CALL_CTRL_WRAP_ARRAY(V__i0,,__i0,V[__i0].FCNCALL_CALL(V[__i0])); }
+    FCNCALL_SUBINDEX_END(__i0);
+  }
+  FCNCALL_SUBNAME_END;
+  }
+  FCNCALL_RET;
+}
+#endif//USER_DEF_raw_event_GFI
+
+#ifndef USER_DEF_raw_event_N
+FCNCALL_TEMPLATE
+FCNCALL_RET_TYPE FCNCALL_CLASS_NAME(raw_event_N)::FCNCALL_NAME(raw_event_N)
+{
+  FCNCALL_INIT;
+  // DATA12 T UNIT("ch");
+  {
+  FCNCALL_SUBNAME("T");
+  FCNCALL_UNIT("ch");
+  { FCNCALL_CALL_CTRL_WRAP(T,T.FCNCALL_CALL(T)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // DATA12 E;
+  {
+  FCNCALL_SUBNAME("E");
+  { FCNCALL_CALL_CTRL_WRAP(E,E.FCNCALL_CALL(E)); }
+  FCNCALL_SUBNAME_END;
+  }
+  FCNCALL_RET;
+}
+#endif//USER_DEF_raw_event_N
+
+#ifndef USER_DEF_raw_event_SST
+FCNCALL_TEMPLATE
+FCNCALL_RET_TYPE FCNCALL_CLASS_NAME(raw_event_SST)::FCNCALL_NAME(raw_event_SST)
+{
+  FCNCALL_INIT;
+  // DATA12 X[640];
+  {
+  FCNCALL_SUBNAME("X");
+  FCNCALL_FOR(__i0,640)
+  {
+    FCNCALL_SUBINDEX(__i0);
+    { FCNCALL_CALL_CTRL_WRAP_ARRAY(X__i0,,__i0,X[__i0].FCNCALL_CALL(X[__i0])); }
+    FCNCALL_SUBINDEX_END(__i0);
+  }
+  FCNCALL_SUBNAME_END;
+  }
+  // DATA12 Y[384];
+  {
+  FCNCALL_SUBNAME("Y");
+  FCNCALL_FOR(__i0,384)
+  {
+    FCNCALL_SUBINDEX(__i0);
+    { FCNCALL_CALL_CTRL_WRAP_ARRAY(Y__i0,,__i0,Y[__i0].FCNCALL_CALL(Y[__i0])); }
+    FCNCALL_SUBINDEX_END(__i0);
+  }
+  FCNCALL_SUBNAME_END;
+  }
+  FCNCALL_RET;
+}
+#endif//USER_DEF_raw_event_SST
+
+#ifndef USER_DEF_raw_event_TGL
+FCNCALL_TEMPLATE
+FCNCALL_RET_TYPE FCNCALL_CLASS_NAME(raw_event_TGL)::FCNCALL_NAME(raw_event_TGL)
+{
+  FCNCALL_INIT;
+  // raw_array_zero_suppress<DATA12,DATA12,3> E;
+  {
+  FCNCALL_SUBNAME("E");
+  { FCNCALL_CALL_CTRL_WRAP(E,E.FCNCALL_CALL(E)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // raw_array_zero_suppress<TOGGLE(DATA12),TOGGLE(DATA12),3> T;
+  {
+  FCNCALL_SUBNAME("T");
+  { FCNCALL_CALL_CTRL_WRAP(T,T.FCNCALL_CALL(T)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // raw_array_zero_suppress<TOGGLE(DATA12),TOGGLE(DATA12),3> F;
+  {
+  FCNCALL_SUBNAME("F");
+  { FCNCALL_CALL_CTRL_WRAP(F,F.FCNCALL_CALL(F)); }
+  FCNCALL_SUBNAME_END;
+  }
+  FCNCALL_RET;
+}
+#endif//USER_DEF_raw_event_TGL
+
+#ifndef USER_DEF_raw_event_MAPB
+FCNCALL_TEMPLATE
+FCNCALL_RET_TYPE FCNCALL_CLASS_NAME(raw_event_MAPB)::FCNCALL_NAME(raw_event_MAPB)
+{
+  FCNCALL_INIT;
+  // DATA12 e;
+  {
+  FCNCALL_SUBNAME("e");
+  { FCNCALL_CALL_CTRL_WRAP(e,e.FCNCALL_CALL(e)); }
+  FCNCALL_SUBNAME_END;
+  }
+  FCNCALL_RET;
+}
+#endif//USER_DEF_raw_event_MAPB
+
+#ifndef USER_DEF_raw_event_MAPC
+FCNCALL_TEMPLATE
+FCNCALL_RET_TYPE FCNCALL_CLASS_NAME(raw_event_MAPC)::FCNCALL_NAME(raw_event_MAPC)
+{
+  FCNCALL_INIT;
+  // DATA12 e;
+  {
+  FCNCALL_SUBNAME("e");
+  { FCNCALL_CALL_CTRL_WRAP(e,e.FCNCALL_CALL(e)); }
+  FCNCALL_SUBNAME_END;
+  }
+  FCNCALL_RET;
+}
+#endif//USER_DEF_raw_event_MAPC
+
+#ifndef USER_DEF_raw_event_plain
+FCNCALL_TEMPLATE
+FCNCALL_RET_TYPE FCNCALL_CLASS_NAME(raw_event_plain)::FCNCALL_NAME(raw_event_plain)
+{
+  FCNCALL_INIT;
+  // uint32 u;
+  {
+  FCNCALL_SUBNAME("u");
+  { FCNCALL_CALL_CTRL_WRAP(u,FCNCALL_CALL_TYPE(uint32,u)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // uint16 s;
+  {
+  FCNCALL_SUBNAME("s");
+  { FCNCALL_CALL_CTRL_WRAP(s,FCNCALL_CALL_TYPE(uint16,s)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // uint8 c;
+  {
+  FCNCALL_SUBNAME("c");
+  { FCNCALL_CALL_CTRL_WRAP(c,FCNCALL_CALL_TYPE(uint8,c)); }
+  FCNCALL_SUBNAME_END;
+  }
+  FCNCALL_RET;
+}
+#endif//USER_DEF_raw_event_plain
+
+#ifndef USER_DEF_raw_event_ZZP
+FCNCALL_TEMPLATE
+FCNCALL_RET_TYPE FCNCALL_CLASS_NAME(raw_event_ZZP)::FCNCALL_NAME(raw_event_ZZP)
+{
+  FCNCALL_INIT;
+  // raw_array_zero_suppress<DATA12,DATA12,10> E;
+  {
+  FCNCALL_SUBNAME("E");
+  { FCNCALL_CALL_CTRL_WRAP(E,E.FCNCALL_CALL(E)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // raw_array_zero_suppress<DATA12,DATA12,10> F;
+  {
+  FCNCALL_SUBNAME("F");
+  { FCNCALL_CALL_CTRL_WRAP(F,F.FCNCALL_CALL(F)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // raw_array_zero_suppress<DATA12,DATA12,10> D;
+  {
+  FCNCALL_SUBNAME("D");
+  { FCNCALL_CALL_CTRL_WRAP(D,D.FCNCALL_CALL(D)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // raw_array_zero_suppress<DATA12,DATA12,10> U;
+  {
+  FCNCALL_SUBNAME("U");
+  { FCNCALL_CALL_CTRL_WRAP(U,U.FCNCALL_CALL(U)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // raw_array_zero_suppress<DATA12,DATA12,10> L;
+  {
+  FCNCALL_SUBNAME("L");
+  { FCNCALL_CALL_CTRL_WRAP(L,L.FCNCALL_CALL(L)); }
+  FCNCALL_SUBNAME_END;
+  }
+  FCNCALL_RET;
+}
+#endif//USER_DEF_raw_event_ZZP
+
+#ifndef USER_DEF_raw_event
+FCNCALL_TEMPLATE
+FCNCALL_RET_TYPE FCNCALL_CLASS_NAME(raw_event)::FCNCALL_NAME(raw_event)
+{
+  FCNCALL_INIT;
+  FCNCALL_CALL_CTRL_WRAP(raw_event_base,FCNCALL_CLASS_NAME(raw_event_base)::FCNCALL_CALL_BASE());
+  // raw_event_POS POS[3][4];
+  {
+  FCNCALL_SUBNAME("POS");
+  FCNCALL_FOR(__i0,3)
+  {
+    FCNCALL_SUBINDEX(__i0);
+    FCNCALL_FOR(__i1,4)
+    {
+      FCNCALL_SUBINDEX(__i1);
+      { FCNCALL_CALL_CTRL_WRAP_ARRAY(POS__i0__i1,[__i0],__i1,POS[__i0][__i1].FCNCALL_CALL(POS[__i0][__i1])); }
+      FCNCALL_SUBINDEX_END(__i1);
+    }
+    FCNCALL_SUBINDEX_END(__i0);
+  }
+  FCNCALL_SUBNAME_END;
+  }
+  // raw_event_PIN PIN[2];
+  {
+  FCNCALL_SUBNAME("PIN");
+  FCNCALL_FOR(__i0,2)
+  {
+    FCNCALL_SUBINDEX(__i0);
+    { FCNCALL_CALL_CTRL_WRAP_ARRAY(PIN__i0,,__i0,PIN[__i0].FCNCALL_CALL(PIN[__i0])); }
+    FCNCALL_SUBINDEX_END(__i0);
+  }
+  FCNCALL_SUBNAME_END;
+  }
+  // raw_event_GFI GFI[1];
+  {
+  FCNCALL_SUBNAME("GFI");
+  FCNCALL_FOR(__i0,1)
+  {
+    FCNCALL_SUBINDEX(__i0);
+    { FCNCALL_CALL_CTRL_WRAP_ARRAY(GFI__i0,,__i0,GFI[__i0].FCNCALL_CALL(GFI[__i0])); }
+    FCNCALL_SUBINDEX_END(__i0);
+  }
+  FCNCALL_SUBNAME_END;
+  }
+  // raw_array_zero_suppress_1<raw_event_N,raw_event_N[2],20,2> N[10];
+  {
+  FCNCALL_SUBNAME("N");
+  FCNCALL_FOR(__i0,10)
+  {
+    FCNCALL_SUBINDEX(__i0);
+    { FCNCALL_CALL_CTRL_WRAP_ARRAY(N__i0,,__i0,N[__i0].FCNCALL_CALL(N[__i0])); }
+    FCNCALL_SUBINDEX_END(__i0);
+  }
+  FCNCALL_SUBNAME_END;
+  }
+  // raw_event_SST SST[1];
+  {
+  FCNCALL_SUBNAME("SST");
+  FCNCALL_FOR(__i0,1)
+  {
+    FCNCALL_SUBINDEX(__i0);
+    { FCNCALL_CALL_CTRL_WRAP_ARRAY(SST__i0,,__i0,SST[__i0].FCNCALL_CALL(SST[__i0])); }
+    FCNCALL_SUBINDEX_END(__i0);
+  }
+  FCNCALL_SUBNAME_END;
+  }
+  // raw_event_TGL TGL[1][1];
+  {
+  FCNCALL_SUBNAME("TGL");
+  FCNCALL_FOR(__i0,1)
+  {
+    FCNCALL_SUBINDEX(__i0);
+    FCNCALL_FOR(__i1,1)
+    {
+      FCNCALL_SUBINDEX(__i1);
+      { FCNCALL_CALL_CTRL_WRAP_ARRAY(TGL__i0__i1,[__i0],__i1,TGL[__i0][__i1].FCNCALL_CALL(TGL[__i0][__i1])); }
+      FCNCALL_SUBINDEX_END(__i1);
+    }
+    FCNCALL_SUBINDEX_END(__i0);
+  }
+  FCNCALL_SUBNAME_END;
+  }
+  // DATA12 MAPA[1][3];
+  {
+  FCNCALL_SUBNAME("MAPA");
+  FCNCALL_FOR(__i0,1)
+  {
+    FCNCALL_SUBINDEX(__i0);
+    FCNCALL_FOR(__i1,3)
+    {
+      FCNCALL_SUBINDEX(__i1);
+      { FCNCALL_CALL_CTRL_WRAP_ARRAY(MAPA__i0__i1,[__i0],__i1,MAPA[__i0][__i1].FCNCALL_CALL(MAPA[__i0][__i1])); }
+      FCNCALL_SUBINDEX_END(__i1);
+    }
+    FCNCALL_SUBINDEX_END(__i0);
+  }
+  FCNCALL_SUBNAME_END;
+  }
+  // raw_event_MAPB MAPB[1][3];
+  {
+  FCNCALL_SUBNAME("MAPB");
+  FCNCALL_FOR(__i0,1)
+  {
+    FCNCALL_SUBINDEX(__i0);
+    FCNCALL_FOR(__i1,3)
+    {
+      FCNCALL_SUBINDEX(__i1);
+      { FCNCALL_CALL_CTRL_WRAP_ARRAY(MAPB__i0__i1,[__i0],__i1,MAPB[__i0][__i1].FCNCALL_CALL(MAPB[__i0][__i1])); }
+      FCNCALL_SUBINDEX_END(__i1);
+    }
+    FCNCALL_SUBINDEX_END(__i0);
+  }
+  FCNCALL_SUBNAME_END;
+  }
+  // raw_event_MAPC MAPC[3][1];
+  {
+  FCNCALL_SUBNAME("MAPC");
+  FCNCALL_FOR(__i0,3)
+  {
+    FCNCALL_SUBINDEX(__i0);
+    FCNCALL_FOR(__i1,1)
+    {
+      FCNCALL_SUBINDEX(__i1);
+      { FCNCALL_CALL_CTRL_WRAP_ARRAY(MAPC__i0__i1,[__i0],__i1,MAPC[__i0][__i1].FCNCALL_CALL(MAPC[__i0][__i1])); }
+      FCNCALL_SUBINDEX_END(__i1);
+    }
+    FCNCALL_SUBINDEX_END(__i0);
+  }
+  FCNCALL_SUBNAME_END;
+  }
+  // DATA12 MAPD[1][4];
+  {
+  FCNCALL_SUBNAME("MAPD");
+  FCNCALL_FOR(__i0,1)
+  {
+    FCNCALL_SUBINDEX(__i0);
+    FCNCALL_FOR(__i1,4)
+    {
+      FCNCALL_SUBINDEX(__i1);
+      { FCNCALL_CALL_CTRL_WRAP_ARRAY(MAPD__i0__i1,[__i0],__i1,MAPD[__i0][__i1].FCNCALL_CALL(MAPD[__i0][__i1])); }
+      FCNCALL_SUBINDEX_END(__i1);
+    }
+    FCNCALL_SUBINDEX_END(__i0);
+  }
+  FCNCALL_SUBNAME_END;
+  }
+  // uint32 MAPS[1];
+  {
+  FCNCALL_SUBNAME("MAPS");
+  FCNCALL_FOR(__i0,1)
+  {
+    FCNCALL_SUBINDEX(__i0);
+    { FCNCALL_CALL_CTRL_WRAP_ARRAY(MAPS__i0,,__i0,FCNCALL_CALL_TYPE(uint32,MAPS[__i0])); }
+    FCNCALL_SUBINDEX_END(__i0);
+  }
+  FCNCALL_SUBNAME_END;
+  }
+  // raw_event_plain plain;
+  {
+  FCNCALL_SUBNAME("plain");
+  { FCNCALL_CALL_CTRL_WRAP(plain,plain.FCNCALL_CALL(plain)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // raw_event_ZZP ZZP[1][1];
+  {
+  FCNCALL_SUBNAME("ZZP");
+  FCNCALL_FOR(__i0,1)
+  {
+    FCNCALL_SUBINDEX(__i0);
+    FCNCALL_FOR(__i1,1)
+    {
+      FCNCALL_SUBINDEX(__i1);
+      { FCNCALL_CALL_CTRL_WRAP_ARRAY(ZZP__i0__i1,[__i0],__i1,ZZP[__i0][__i1].FCNCALL_CALL(ZZP[__i0][__i1])); }
+      FCNCALL_SUBINDEX_END(__i1);
+    }
+    FCNCALL_SUBINDEX_END(__i0);
+  }
+  FCNCALL_SUBNAME_END;
+  }
+  // uint64 ITEMsixtyfour;
+  {
+  FCNCALL_SUBNAME("ITEMsixtyfour");
+  { FCNCALL_CALL_CTRL_WRAP(ITEMsixtyfour,FCNCALL_CALL_TYPE(uint64,ITEMsixtyfour)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // uint32 STCORR;
+  {
+  FCNCALL_SUBNAME("STCORR");
+  { FCNCALL_CALL_CTRL_WRAP(STCORR,FCNCALL_CALL_TYPE(uint32,STCORR)); }
+  FCNCALL_SUBNAME_END;
+  }
+  FCNCALL_RET;
+}
+#endif//USER_DEF_raw_event
+
+#ifndef USER_DEF_raw_sticky
+FCNCALL_TEMPLATE
+FCNCALL_RET_TYPE FCNCALL_CLASS_NAME(raw_sticky)::FCNCALL_NAME(raw_sticky)
+{
+  FCNCALL_INIT;
+  FCNCALL_CALL_CTRL_WRAP(raw_sticky_base,FCNCALL_CLASS_NAME(raw_sticky_base)::FCNCALL_CALL_BASE());
+  // uint32 corrbase;
+  {
+  FCNCALL_SUBNAME("corrbase");
+  { FCNCALL_CALL_CTRL_WRAP(corrbase,FCNCALL_CALL_TYPE(uint32,corrbase)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // raw_array_zero_suppress<uint32,uint32,5> zzp;
+  {
+  FCNCALL_SUBNAME("zzp");
+  { FCNCALL_CALL_CTRL_WRAP(zzp,zzp.FCNCALL_CALL(zzp)); }
+  FCNCALL_SUBNAME_END;
+  }
+  FCNCALL_RET;
+}
+#endif//USER_DEF_raw_sticky
+
+#include "gen/default_fcncall_undef.hh"
+
+
+/** END_FUNCTION_CALL_PER_MEMBER **************************************/
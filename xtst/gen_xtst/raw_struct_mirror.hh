@@ -0,0 +1,261 @@
+/** BEGIN_MIRROR_STRUCT ************************************************
+ *
+ * Mirror (1 to 1) structure.
+ *
+ * Do not edit - automatically generated.
+ */
+
+#include "gen/default_mirror_define.hh"
+
+#ifndef USER_DEF_raw_event_POS
+STRUCT_MIRROR_TEMPLATE
+class STRUCT_MIRROR_STRUCT(raw_event_POS)
+{
+public:
+  STRUCT_MIRROR_ITEM_CTRL(T);
+  STRUCT_MIRROR_TYPE_TOGGLE(DATA12) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(T);
+  STRUCT_MIRROR_ITEM_CTRL(E);
+  STRUCT_MIRROR_TYPE_TOGGLE(DATA12) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(E);
+  STRUCT_MIRROR_FCNS_DECL(raw_event_POS);
+};
+#endif//USER_DEF_raw_event_POS
+
+#ifndef USER_DEF_raw_event_PIN
+STRUCT_MIRROR_TEMPLATE
+class STRUCT_MIRROR_STRUCT(raw_event_PIN)
+{
+public:
+  STRUCT_MIRROR_ITEM_CTRL(E);
+  STRUCT_MIRROR_TYPE(DATA12) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(E);
+  STRUCT_MIRROR_FCNS_DECL(raw_event_PIN);
+};
+#endif//USER_DEF_raw_event_PIN
+
+#ifndef USER_DEF_raw_event_GFI_U
+STRUCT_MIRROR_TEMPLATE
+class STRUCT_MIRROR_STRUCT(raw_event_GFI_U)
+{
+public:
+  STRUCT_MIRROR_ITEM_CTRL(E);
+  STRUCT_MIRROR_TYPE(DATA12) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(E);
+  STRUCT_MIRROR_FCNS_DECL(raw_event_GFI_U);
+};
+#endif//USER_DEF_raw_event_GFI_U
+
+#ifndef USER_DEF_raw_event_GFI_PM
+STRUCT_MIRROR_TEMPLATE
+class STRUCT_MIRROR_STRUCT(raw_event_GFI_PM)
+{
+public:
+  STRUCT_MIRROR_ITEM_CTRL(T);
+  STRUCT_MIRROR_TYPE(DATA12) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(T);
+  STRUCT_MIRROR_ITEM_CTRL(E);
+  STRUCT_MIRROR_TYPE(DATA12) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(E);
+  STRUCT_MIRROR_FCNS_DECL(raw_event_GFI_PM);
+};
+#endif//USER_DEF_raw_event_GFI_PM
+
+#ifndef USER_DEF_raw_event_GFI_V
+STRUCT_MIRROR_TEMPLATE
+class STRUCT_MIRROR_STRUCT(raw_event_GFI_V)
+{
+public:
+  STRUCT_MIRROR_ITEM_CTRL(E);
+  STRUCT_MIRROR_TYPE(DATA12) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(E);
+  STRUCT_MIRROR_FCNS_DECL(raw_event_GFI_V);
+};
+#endif//USER_DEF_raw_event_GFI_V
+
+#ifndef USER_DEF_raw_event_GFI
+STRUCT_MIRROR_TEMPLATE
+class STRUCT_MIRROR_STRUCT(raw_event_GFI)
+{
+public:
+  STRUCT_MIRROR_ITEM_CTRL(U);
+  STRUCT_MIRROR_ITEM_CTRL_ARRAY(U__i0,,18);
+  STRUCT_MIRROR_TYPE(raw_event_GFI_U) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(U[18]);
+  STRUCT_MIRROR_ITEM_CTRL(PM);
+  STRUCT_MIRROR_TYPE(raw_event_GFI_PM) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(PM);
+  STRUCT_MIRROR_ITEM_CTRL(V);
+  STRUCT_MIRROR_ITEM_CTRL_ARRAY(V__i0,,16);
+  STRUCT_MIRROR_TYPE(raw_event_GFI_V) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(V[16]);
+  STRUCT_MIRROR_FCNS_DECL(raw_event_GFI);
+};
+#endif//USER_DEF_raw_event_GFI
+
+#ifndef USER_DEF_raw_event_N
+STRUCT_MIRROR_TEMPLATE
+class STRUCT_MIRROR_STRUCT(raw_event_N)
+{
+public:
+  STRUCT_MIRROR_ITEM_CTRL(T);
+  STRUCT_MIRROR_TYPE(DATA12) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(T);
+  STRUCT_MIRROR_ITEM_CTRL(E);
+  STRUCT_MIRROR_TYPE(DATA12) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(E);
+  STRUCT_MIRROR_FCNS_DECL(raw_event_N);
+};
+#endif//USER_DEF_raw_event_N
+
+#ifndef USER_DEF_raw_event_SST
+STRUCT_MIRROR_TEMPLATE
+class STRUCT_MIRROR_STRUCT(raw_event_SST)
+{
+public:
+  STRUCT_MIRROR_ITEM_CTRL(X);
+  STRUCT_MIRROR_ITEM_CTRL_ARRAY(X__i0,,640);
+  STRUCT_MIRROR_TYPE(DATA12) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(X[640]);
+  STRUCT_MIRROR_ITEM_CTRL(Y);
+  STRUCT_MIRROR_ITEM_CTRL_ARRAY(Y__i0,,384);
+  STRUCT_MIRROR_TYPE(DATA12) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(Y[384]);
+  STRUCT_MIRROR_FCNS_DECL(raw_event_SST);
+};
+#endif//USER_DEF_raw_event_SST
+
+#ifndef USER_DEF_raw_event_TGL
+STRUCT_MIRROR_TEMPLATE
+class STRUCT_MIRROR_STRUCT(raw_event_TGL)
+{
+public:
+  STRUCT_MIRROR_ITEM_CTRL(E);
+  STRUCT_MIRROR_TYPE(raw_array_zero_suppress) < STRUCT_MIRROR_TYPE_TEMPLATE STRUCT_MIRROR_TEMPLATE_ARG(DATA12),STRUCT_MIRROR_TEMPLATE_ARG(DATA12),3> STRUCT_MIRROR_NAME(E);
+  STRUCT_MIRROR_ITEM_CTRL(T);
+  STRUCT_MIRROR_TYPE(raw_array_zero_suppress) < STRUCT_MIRROR_TYPE_TEMPLATE STRUCT_MIRROR_TEMPLATE_ARG_TOGGLE(DATA12),STRUCT_MIRROR_TEMPLATE_ARG_TOGGLE(DATA12),3> STRUCT_MIRROR_NAME(T);
+  STRUCT_MIRROR_ITEM_CTRL(F);
+  STRUCT_MIRROR_TYPE(raw_array_zero_suppress) < STRUCT_MIRROR_TYPE_TEMPLATE STRUCT_MIRROR_TEMPLATE_ARG_TOGGLE(DATA12),STRUCT_MIRROR_TEMPLATE_ARG_TOGGLE(DATA12),3> STRUCT_MIRROR_NAME(F);
+  STRUCT_MIRROR_FCNS_DECL(raw_event_TGL);
+};
+#endif//USER_DEF_raw_event_TGL
+
+#ifndef USER_DEF_raw_event_MAPB
+STRUCT_MIRROR_TEMPLATE
+class STRUCT_MIRROR_STRUCT(raw_event_MAPB)
+{
+public:
+  STRUCT_MIRROR_ITEM_CTRL(e);
+  STRUCT_MIRROR_TYPE(DATA12) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(e);
+  STRUCT_MIRROR_FCNS_DECL(raw_event_MAPB);
+};
+#endif//USER_DEF_raw_event_MAPB
+
+#ifndef USER_DEF_raw_event_MAPC
+STRUCT_MIRROR_TEMPLATE
+class STRUCT_MIRROR_STRUCT(raw_event_MAPC)
+{
+public:
+  STRUCT_MIRROR_ITEM_CTRL(e);
+  STRUCT_MIRROR_TYPE(DATA12) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(e);
+  STRUCT_MIRROR_FCNS_DECL(raw_event_MAPC);
+};
+#endif//USER_DEF_raw_event_MAPC
+
+#ifndef USER_DEF_raw_event_plain
+STRUCT_MIRROR_TEMPLATE
+class STRUCT_MIRROR_STRUCT(raw_event_plain)
+{
+public:
+  STRUCT_MIRROR_ITEM_CTRL(u);
+  STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(u);
+  STRUCT_MIRROR_ITEM_CTRL(s);
+  STRUCT_MIRROR_TYPE(uint16) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(s);
+  STRUCT_MIRROR_ITEM_CTRL(c);
+  STRUCT_MIRROR_TYPE(uint8) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(c);
+  STRUCT_MIRROR_FCNS_DECL(raw_event_plain);
+};
+#endif//USER_DEF_raw_event_plain
+
+#ifndef USER_DEF_raw_event_ZZP
+STRUCT_MIRROR_TEMPLATE
+class STRUCT_MIRROR_STRUCT(raw_event_ZZP)
+{
+public:
+  STRUCT_MIRROR_ITEM_CTRL(E);
+  STRUCT_MIRROR_TYPE(raw_array_zero_suppress) < STRUCT_MIRROR_TYPE_TEMPLATE STRUCT_MIRROR_TEMPLATE_ARG(DATA12),STRUCT_MIRROR_TEMPLATE_ARG(DATA12),10> STRUCT_MIRROR_NAME(E);
+  STRUCT_MIRROR_ITEM_CTRL(F);
+  STRUCT_MIRROR_TYPE(raw_array_zero_suppress) < STRUCT_MIRROR_TYPE_TEMPLATE STRUCT_MIRROR_TEMPLATE_ARG(DATA12),STRUCT_MIRROR_TEMPLATE_ARG(DATA12),10> STRUCT_MIRROR_NAME(F);
+  STRUCT_MIRROR_ITEM_CTRL(D);
+  STRUCT_MIRROR_TYPE(raw_array_zero_suppress) < STRUCT_MIRROR_TYPE_TEMPLATE STRUCT_MIRROR_TEMPLATE_ARG(DATA12),STRUCT_MIRROR_TEMPLATE_ARG(DATA12),10> STRUCT_MIRROR_NAME(D);
+  STRUCT_MIRROR_ITEM_CTRL(U);
+  STRUCT_MIRROR_TYPE(raw_array_zero_suppress) < STRUCT_MIRROR_TYPE_TEMPLATE STRUCT_MIRROR_TEMPLATE_ARG(DATA12),STRUCT_MIRROR_TEMPLATE_ARG(DATA12),10> STRUCT_MIRROR_NAME(U);
+  STRUCT_MIRROR_ITEM_CTRL(L);
+  STRUCT_MIRROR_TYPE(raw_array_zero_suppress) < STRUCT_MIRROR_TYPE_TEMPLATE STRUCT_MIRROR_TEMPLATE_ARG(DATA12),STRUCT_MIRROR_TEMPLATE_ARG(DATA12),10> STRUCT_MIRROR_NAME(L);
+  STRUCT_MIRROR_FCNS_DECL(raw_event_ZZP);
+};
+#endif//USER_DEF_raw_event_ZZP
+
+#ifndef USER_DEF_raw_event
+STRUCT_MIRROR_TEMPLATE
+class STRUCT_MIRROR_STRUCT(raw_event) : public STRUCT_MIRROR_BASE(raw_event_base)
+{
+public:
+  STRUCT_MIRROR_ITEM_CTRL_BASE(raw_event_base);
+  STRUCT_MIRROR_ITEM_CTRL(POS);
+  STRUCT_MIRROR_ITEM_CTRL_ARRAY(POS__i0,,3);
+  STRUCT_MIRROR_ITEM_CTRL_ARRAY(POS__i0__i1,[3],4);
+  STRUCT_MIRROR_TYPE(raw_event_POS) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(POS[3][4]);
+  STRUCT_MIRROR_ITEM_CTRL(PIN);
+  STRUCT_MIRROR_ITEM_CTRL_ARRAY(PIN__i0,,2);
+  STRUCT_MIRROR_TYPE(raw_event_PIN) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(PIN[2]);
+  STRUCT_MIRROR_ITEM_CTRL(GFI);
+  STRUCT_MIRROR_ITEM_CTRL_ARRAY(GFI__i0,,1);
+  STRUCT_MIRROR_TYPE(raw_event_GFI) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(GFI[1]);
+  STRUCT_MIRROR_ITEM_CTRL(N);
+  STRUCT_MIRROR_ITEM_CTRL_ARRAY(N__i0,,10);
+  STRUCT_MIRROR_TYPE(raw_array_zero_suppress_1) < STRUCT_MIRROR_TYPE_TEMPLATE STRUCT_MIRROR_TEMPLATE_ARG(raw_event_N),STRUCT_MIRROR_TEMPLATE_ARG_N(raw_event_N,[2]),20,2> STRUCT_MIRROR_NAME(N[10]);
+  STRUCT_MIRROR_ITEM_CTRL(SST);
+  STRUCT_MIRROR_ITEM_CTRL_ARRAY(SST__i0,,1);
+  STRUCT_MIRROR_TYPE(raw_event_SST) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(SST[1]);
+  STRUCT_MIRROR_ITEM_CTRL(TGL);
+  STRUCT_MIRROR_ITEM_CTRL_ARRAY(TGL__i0,,1);
+  STRUCT_MIRROR_ITEM_CTRL_ARRAY(TGL__i0__i1,[1],1);
+  STRUCT_MIRROR_TYPE(raw_event_TGL) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(TGL[1][1]);
+  STRUCT_MIRROR_ITEM_CTRL(MAPA);
+  STRUCT_MIRROR_ITEM_CTRL_ARRAY(MAPA__i0,,1);
+  STRUCT_MIRROR_ITEM_CTRL_ARRAY(MAPA__i0__i1,[1],3);
+  STRUCT_MIRROR_TYPE(DATA12) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(MAPA[1][3]);
+  STRUCT_MIRROR_ITEM_CTRL(MAPB);
+  STRUCT_MIRROR_ITEM_CTRL_ARRAY(MAPB__i0,,1);
+  STRUCT_MIRROR_ITEM_CTRL_ARRAY(MAPB__i0__i1,[1],3);
+  STRUCT_MIRROR_TYPE(raw_event_MAPB) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(MAPB[1][3]);
+  STRUCT_MIRROR_ITEM_CTRL(MAPC);
+  STRUCT_MIRROR_ITEM_CTRL_ARRAY(MAPC__i0,,3);
+  STRUCT_MIRROR_ITEM_CTRL_ARRAY(MAPC__i0__i1,[3],1);
+  STRUCT_MIRROR_TYPE(raw_event_MAPC) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(MAPC[3][1]);
+  STRUCT_MIRROR_ITEM_CTRL(MAPD);
+  STRUCT_MIRROR_ITEM_CTRL_ARRAY(MAPD__i0,,1);
+  STRUCT_MIRROR_ITEM_CTRL_ARRAY(MAPD__i0__i1,[1],4);
+  STRUCT_MIRROR_TYPE(DATA12) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(MAPD[1][4]);
+  STRUCT_MIRROR_ITEM_CTRL(MAPS);
+  STRUCT_MIRROR_ITEM_CTRL_ARRAY(MAPS__i0,,1);
+  STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(MAPS[1]);
+  STRUCT_MIRROR_ITEM_CTRL(plain);
+  STRUCT_MIRROR_TYPE(raw_event_plain) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(plain);
+  STRUCT_MIRROR_ITEM_CTRL(ZZP);
+  STRUCT_MIRROR_ITEM_CTRL_ARRAY(ZZP__i0,,1);
+  STRUCT_MIRROR_ITEM_CTRL_ARRAY(ZZP__i0__i1,[1],1);
+  STRUCT_MIRROR_TYPE(raw_event_ZZP) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(ZZP[1][1]);
+  STRUCT_MIRROR_ITEM_CTRL(ITEMsixtyfour);
+  STRUCT_MIRROR_TYPE(uint64) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(ITEMsixtyfour);
+  STRUCT_MIRROR_ITEM_CTRL(STCORR);
+  STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(STCORR);
+  STRUCT_MIRROR_FCNS_DECL(raw_event);
+};
+#endif//USER_DEF_raw_event
+
+#ifndef USER_DEF_raw_sticky
+STRUCT_MIRROR_TEMPLATE
+class STRUCT_MIRROR_STRUCT(raw_sticky) : public STRUCT_MIRROR_BASE(raw_sticky_base)
+{
+public:
+  STRUCT_MIRROR_ITEM_CTRL_BASE(raw_sticky_base);
+  STRUCT_MIRROR_ITEM_CTRL(corrbase);
+  STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(corrbase);
+  STRUCT_MIRROR_ITEM_CTRL(zzp);
+  STRUCT_MIRROR_TYPE(raw_array_zero_suppress) < STRUCT_MIRROR_TYPE_TEMPLATE STRUCT_MIRROR_TEMPLATE_ARG(uint32),STRUCT_MIRROR_TEMPLATE_ARG(uint32),5> STRUCT_MIRROR_NAME(zzp);
+  STRUCT_MIRROR_FCNS_DECL(raw_sticky);
+};
+#endif//USER_DEF_raw_sticky
+
+#include "gen/default_mirror_undef.hh"
+
+
+/** END_MIRROR_STRUCT *************************************************/
@@ -0,0 +1,353 @@
+/** BEGIN_EVENT_RAW_STRUCTURE ******************************************
+ *
+ * Event data structure.
+ *
+ * Do not edit - automatically generated.
+ */
+
+//DUMPY: 3 0
+//DUMPY: 4 0
+class raw_event_POS
+{
+public:
+  TOGGLE(DATA12) T;
+  TOGGLE(DATA12) E;
+
+public:
+#ifndef __PSDC__
+  STRUCT_FCNS_DECL(raw_event_POS);
+#endif//!__PSDC__
+} ;
+
+//DUMPY: 2 0
+class raw_event_PIN
+{
+public:
+  DATA12 E;
+
+public:
+#ifndef __PSDC__
+  STRUCT_FCNS_DECL(raw_event_PIN);
+#endif//!__PSDC__
+} ;
+
+//DUMPY: 18 0
+class raw_event_GFI_U
+{
+public:
+  DATA12 E;
+
+public:
+#ifndef __PSDC__
+  STRUCT_FCNS_DECL(raw_event_GFI_U);
+#endif//!__PSDC__
+} ;
+
+class raw_event_GFI_PM
+{
+public:
+  DATA12 T;
+  DATA12 E;
+
+public:
+#ifndef __PSDC__
+  STRUCT_FCNS_DECL(raw_event_GFI_PM);
+#endif//!__PSDC__
+} ;
+
+//DUMPY: 16 0
+class raw_event_GFI_V
+{
+public:
+  DATA12 E;
+
+public:
+#ifndef __PSDC__
+  STRUCT_FCNS_DECL(raw_event_GFI_V);
+#endif//!__PSDC__
+} ;
+
+//DUMPY: 1 0
+class raw_event_GFI
+{
+public:
+//DUMPY: 18 0
+  raw_event_GFI_U
+  /* {
+  public:
+    DATA12 E;
+  } */ U[18];
+  raw_event_GFI_PM
+  /* {
+  public:
+    DATA12 T;
+    DATA12 E;
+  } */ PM;
+//DUMPY: 16 0
+  raw_event_GFI_V
+  /* {
+  public:
+    DATA12 E;
+  } */ V[16];
+
+public:
+#ifndef __PSDC__
+  STRUCT_FCNS_DECL(raw_event_GFI);
+#endif//!__PSDC__
+} ;
+
+//DUMPY: 10 0
+//DUMPY: 20 1
+//DUMPY: 2 0
+class raw_event_N
+{
+public:
+  DATA12 T UNIT("ch");
+  DATA12 E;
+
+public:
+#ifndef __PSDC__
+  STRUCT_FCNS_DECL(raw_event_N);
+#endif//!__PSDC__
+} ;
+
+//DUMPY: 1 0
+class raw_event_SST
+{
+public:
+//DUMPY: 640 0
+  DATA12 X[640];
+//DUMPY: 384 0
+  DATA12 Y[384];
+
+public:
+#ifndef __PSDC__
+  STRUCT_FCNS_DECL(raw_event_SST);
+#endif//!__PSDC__
+} ;
+
+//DUMPY: 1 0
+//DUMPY: 1 0
+class raw_event_TGL
+{
+public:
+//DUMPY: 3 1
+  raw_array_zero_suppress<DATA12,DATA12,3> E;
+//DUMPY: 3 1
+  raw_array_zero_suppress<TOGGLE(DATA12),TOGGLE(DATA12),3> T;
+//DUMPY: 3 1
+  raw_array_zero_suppress<TOGGLE(DATA12),TOGGLE(DATA12),3> F;
+
+public:
+#ifndef __PSDC__
+  STRUCT_FCNS_DECL(raw_event_TGL);
+#endif//!__PSDC__
+} ;
+
+//DUMPY: 1 0
+//DUMPY: 3 0
+class raw_event_MAPB
+{
+public:
+  DATA12 e;
+
+public:
+#ifndef __PSDC__
+  STRUCT_FCNS_DECL(raw_event_MAPB);
+#endif//!__PSDC__
+} ;
+
+//DUMPY: 3 0
+//DUMPY: 1 0
+class raw_event_MAPC
+{
+public:
+  DATA12 e;
+
+public:
+#ifndef __PSDC__
+  STRUCT_FCNS_DECL(raw_event_MAPC);
+#endif//!__PSDC__
+} ;
+
+class raw_event_plain
+{
+public:
+  uint32 u;
+  uint16 s;
+  uint8 c;
+
+public:
+#ifndef __PSDC__
+  STRUCT_FCNS_DECL(raw_event_plain);
+#endif//!__PSDC__
+} ;
+
+//DUMPY: 1 0
+//DUMPY: 1 0
+class raw_event_ZZP
+{
+public:
+//DUMPY: 10 1
+  raw_array_zero_suppress<DATA12,DATA12,10> E;
+//DUMPY: 10 1
+  raw_array_zero_suppress<DATA12,DATA12,10> F;
+//DUMPY: 10 1
+  raw_array_zero_suppress<DATA12,DATA12,10> D;
+//DUMPY: 10 1
+  raw_array_zero_suppress<DATA12,DATA12,10> U;
+//DUMPY: 10 1
+  raw_array_zero_suppress<DATA12,DATA12,10> L;
+
+public:
+#ifndef __PSDC__
+  STRUCT_FCNS_DECL(raw_event_ZZP);
+#endif//!__PSDC__
+} ;
+
+class raw_event : public raw_event_base
+{
+public:
+//DUMPY: 3 0
+//DUMPY: 4 0
+  raw_event_POS
+  /* {
+  public:
+    TOGGLE(DATA12) T;
+    TOGGLE(DATA12) E;
+  } */ POS[3][4];
+//DUMPY: 2 0
+  raw_event_PIN
+  /* {
+  public:
+    DATA12 E;
+  } */ PIN[2];
+//DUMPY: 1 0
+  raw_event_GFI
+  /* {
+  public:
+//DUMPY: 18 0
+    raw_event_GFI_U
+    {
+    public:
+      DATA12 E;
+    } U[18];
+    raw_event_GFI_PM
+    {
+    public:
+      DATA12 T;
+      DATA12 E;
+    } PM;
+//DUMPY: 16 0
+    raw_event_GFI_V
+    {
+    public:
+      DATA12 E;
+    } V[16];
+  } */ GFI[1];
+//DUMPY: 10 0
+//DUMPY: 20 1
+//DUMPY: 2 0
+  raw_array_zero_suppress_1<raw_event_N,raw_event_N[2],20,2>
+  /* {
+  public:
+    DATA12 T UNIT("ch");
+    DATA12 E;
+  } */ N[10];
+//DUMPY: 1 0
+  raw_event_SST
+  /* {
+  public:
+//DUMPY: 640 0
+    DATA12 X[640];
+//DUMPY: 384 0
+    DATA12 Y[384];
+  } */ SST[1];
+//DUMPY: 1 0
+//DUMPY: 1 0
+  raw_event_TGL
+  /* {
+  public:
+//DUMPY: 3 1
+    raw_array_zero_suppress<DATA12,DATA12,3> E;
+//DUMPY: 3 1
+    raw_array_zero_suppress<TOGGLE(DATA12),TOGGLE(DATA12),3> T;
+//DUMPY: 3 1
+    raw_array_zero_suppress<TOGGLE(DATA12),TOGGLE(DATA12),3> F;
+  } */ TGL[1][1];
+//DUMPY: 1 0
+//DUMPY: 3 0
+  DATA12 MAPA[1][3];
+//DUMPY: 1 0
+//DUMPY: 3 0
+  raw_event_MAPB
+  /* {
+  public:
+    DATA12 e;
+  } */ MAPB[1][3];
+//DUMPY: 3 0
+//DUMPY: 1 0
+  raw_event_MAPC
+  /* {
+  public:
+    DATA12 e;
+  } */ MAPC[3][1];
+//DUMPY: 1 0
+//DUMPY: 4 0
+  DATA12 MAPD[1][4];
+//DUMPY: 1 0
+  uint32 MAPS[1];
+  raw_event_plain
+  /* {
+  public:
+    uint32 u;
+    uint16 s;
+    uint8 c;
+  } */ plain;
+//DUMPY: 1 0
+//DUMPY: 1 0
+  raw_event_ZZP
+  /* {
+  public:
+//DUMPY: 10 1
+    raw_array_zero_suppress<DATA12,DATA12,10> E;
+//DUMPY: 10 1
+    raw_array_zero_suppress<DATA12,DATA12,10> F;
+//DUMPY: 10 1
+    raw_array_zero_suppress<DATA12,DATA12,10> D;
+//DUMPY: 10 1
+    raw_array_zero_suppress<DATA12,DATA12,10> U;
+//DUMPY: 10 1
+    raw_array_zero_suppress<DATA12,DATA12,10> L;
+  } */ ZZP[1][1];
+  uint64 ITEMsixtyfour;
+  uint32 STCORR;
+
+public:
+#ifndef __PSDC__
+  STRUCT_FCNS_DECL(raw_event);
+#endif//!__PSDC__
+} ;
+
+/** END_EVENT_RAW_STRUCTURE *******************************************/
+/** BEGIN_EVENT_RAW_STRUCTURE ******************************************
+ *
+ * Event data structure.
+ *
+ * Do not edit - automatically generated.
+ */
+
+class raw_sticky : public raw_sticky_base
+{
+public:
+  uint32 corrbase;
+//DUMPY: 5 1
+  raw_array_zero_suppress<uint32,uint32,5> zzp;
+
+public:
+#ifndef __PSDC__
+  STRUCT_FCNS_DECL(raw_sticky);
+#endif//!__PSDC__
+} ;
+
+/** END_EVENT_RAW_STRUCTURE *******************************************/
@@ -0,0 +1,203 @@
+/** BEGIN_REVOKE *******************************************************
+ *
+ * Event revoker for EVENT.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// EVENT
+int unpack_event::__revoke_subevent(subevent_header *__header)
+  // vme = XTST_VME(type=36,subtype=0xc1c);
+  // bits64 = BITS64(type=64,subtype=64);
+  // me = XTST_SUBEVENT_MEMBER_ENCODE(type=10);
+  // mea = XTST_SUBEVENT_MEMBER_ENCODE_A(type=12);
+  // meb = XTST_SUBEVENT_MEMBER_ENCODE_B(type=13);
+  // me2 = XTST_SUBEVENT_ME2(type=11);
+  // plain = XTST_PLAIN(type=12);
+  // regress[0] = XTST_REGRESS(type=0xcae,subtype=0xcae,subcrate=0);
+  // regress[1] = XTST_REGRESS(type=0xcae,subtype=0xcae,subcrate=1);
+  // regress[2] = XTST_REGRESS(type=0xcae,subtype=0xcae,subcrate=2);
+  // regress[3] = XTST_REGRESS(type=0xcae,subtype=0xcae,subcrate=3);
+  // regress[4] = XTST_REGRESS(type=0xcae,subtype=0xcae,subcrate=4);
+  // regress[5] = XTST_REGRESS(type=0xcae,subtype=0xcae,subcrate=5);
+  // regress[6] = XTST_REGRESS(type=0xcae,subtype=0xcae,subcrate=6);
+  // regress[7] = XTST_REGRESS(type=0xcae,subtype=0xcae,subcrate=7);
+  // regress[8] = XTST_REGRESS(type=0xcae,subtype=0xcae,subcrate=8);
+  // regress[9] = XTST_REGRESS(type=0xcae,subtype=0xcae,subcrate=9);
+  // regress[10] = XTST_REGRESS(type=0xcae,subtype=0xcae,subcrate=10);
+  // regress[11] = XTST_REGRESS(type=0xcae,subtype=0xcae,subcrate=11);
+  // regress[12] = XTST_REGRESS(type=0xcae,subtype=0xcae,subcrate=12);
+  // regress[13] = XTST_REGRESS(type=0xcae,subtype=0xcae,subcrate=13);
+  // regress[14] = XTST_REGRESS(type=0xcae,subtype=0xcae,subcrate=14);
+  // regress[15] = XTST_REGRESS(type=0xcae,subtype=0xcae,subcrate=15);
+  // regressextra = XTST_REGRESSEXTRA(type=0xde0,subtype=0xad0);
+  // mdpp = XTST_MDPP16(type=0xbd0,subtype=22);
+{
+  int __match_no = 0;
+  SUBEVENT_MATCH_CACHE_LOOKUP(__match_no)
+  {
+    MATCH_SUBEVENT_DECL(1066,__match_no,1,((VES10_1_type==36)&&(VES10_1_subtype==0xc1c)),vme);
+    MATCH_SUBEVENT_DECL(1068,__match_no,2,((VES10_1_type==64)&&(VES10_1_subtype==64)),bits64);
+    MATCH_SUBEVENT_DECL(1070,__match_no,3,((VES10_1_type==10)),me);
+    MATCH_SUBEVENT_DECL(1072,__match_no,4,((VES10_1_type==12)),mea);
+    MATCH_SUBEVENT_DECL(1074,__match_no,5,((VES10_1_type==13)),meb);
+    MATCH_SUBEVENT_DECL(1076,__match_no,6,((VES10_1_type==11)),me2);
+    MATCH_SUBEVENT_DECL(1078,__match_no,7,((VES10_1_type==12)),plain);
+    MATCH_SUBEVENT_DECL(1080,__match_no,8,((VES10_1_type==0xcae)&&(VES10_1_subtype==0xcae)&&(VES10_1_subcrate==0)),regress[0]);
+    MATCH_SUBEVENT_DECL(1081,__match_no,9,((VES10_1_type==0xcae)&&(VES10_1_subtype==0xcae)&&(VES10_1_subcrate==1)),regress[1]);
+    MATCH_SUBEVENT_DECL(1082,__match_no,10,((VES10_1_type==0xcae)&&(VES10_1_subtype==0xcae)&&(VES10_1_subcrate==2)),regress[2]);
+    MATCH_SUBEVENT_DECL(1083,__match_no,11,((VES10_1_type==0xcae)&&(VES10_1_subtype==0xcae)&&(VES10_1_subcrate==3)),regress[3]);
+    MATCH_SUBEVENT_DECL(1084,__match_no,12,((VES10_1_type==0xcae)&&(VES10_1_subtype==0xcae)&&(VES10_1_subcrate==4)),regress[4]);
+    MATCH_SUBEVENT_DECL(1085,__match_no,13,((VES10_1_type==0xcae)&&(VES10_1_subtype==0xcae)&&(VES10_1_subcrate==5)),regress[5]);
+    MATCH_SUBEVENT_DECL(1086,__match_no,14,((VES10_1_type==0xcae)&&(VES10_1_subtype==0xcae)&&(VES10_1_subcrate==6)),regress[6]);
+    MATCH_SUBEVENT_DECL(1087,__match_no,15,((VES10_1_type==0xcae)&&(VES10_1_subtype==0xcae)&&(VES10_1_subcrate==7)),regress[7]);
+    MATCH_SUBEVENT_DECL(1088,__match_no,16,((VES10_1_type==0xcae)&&(VES10_1_subtype==0xcae)&&(VES10_1_subcrate==8)),regress[8]);
+    MATCH_SUBEVENT_DECL(1089,__match_no,17,((VES10_1_type==0xcae)&&(VES10_1_subtype==0xcae)&&(VES10_1_subcrate==9)),regress[9]);
+    MATCH_SUBEVENT_DECL(1090,__match_no,18,((VES10_1_type==0xcae)&&(VES10_1_subtype==0xcae)&&(VES10_1_subcrate==10)),regress[10]);
+    MATCH_SUBEVENT_DECL(1091,__match_no,19,((VES10_1_type==0xcae)&&(VES10_1_subtype==0xcae)&&(VES10_1_subcrate==11)),regress[11]);
+    MATCH_SUBEVENT_DECL(1092,__match_no,20,((VES10_1_type==0xcae)&&(VES10_1_subtype==0xcae)&&(VES10_1_subcrate==12)),regress[12]);
+    MATCH_SUBEVENT_DECL(1093,__match_no,21,((VES10_1_type==0xcae)&&(VES10_1_subtype==0xcae)&&(VES10_1_subcrate==13)),regress[13]);
+    MATCH_SUBEVENT_DECL(1094,__match_no,22,((VES10_1_type==0xcae)&&(VES10_1_subtype==0xcae)&&(VES10_1_subcrate==14)),regress[14]);
+    MATCH_SUBEVENT_DECL(1095,__match_no,23,((VES10_1_type==0xcae)&&(VES10_1_subtype==0xcae)&&(VES10_1_subcrate==15)),regress[15]);
+    MATCH_SUBEVENT_DECL(1097,__match_no,24,((VES10_1_type==0xde0)&&(VES10_1_subtype==0xad0)),regressextra);
+    MATCH_SUBEVENT_DECL(1099,__match_no,25,((VES10_1_type==0xbd0)&&(VES10_1_subtype==22)),mdpp);
+    SUBEVENT_MATCH_CACHE_STORE(__match_no);
+  }
+  if (!__match_no) return 0;
+  switch (__match_no)
+  {
+    case 1:
+      UNPACK_SUBEVENT_CHECK_NO_REVISIT(1066,XTST_VME,vme,0);
+      REVOKE_SUBEVENT_DECL(1066,0,XTST_VME,vme);
+      break;
+    case 2:
+      UNPACK_SUBEVENT_CHECK_NO_REVISIT(1068,BITS64,bits64,1);
+      REVOKE_SUBEVENT_DECL(1068,0,BITS64,bits64);
+      break;
+    case 3:
+      UNPACK_SUBEVENT_CHECK_NO_REVISIT(1070,XTST_SUBEVENT_MEMBER_ENCODE,me,2);
+      REVOKE_SUBEVENT_DECL(1070,0,XTST_SUBEVENT_MEMBER_ENCODE,me);
+      break;
+    case 4:
+      UNPACK_SUBEVENT_CHECK_NO_REVISIT(1072,XTST_SUBEVENT_MEMBER_ENCODE_A,mea,3);
+      REVOKE_SUBEVENT_DECL(1072,0,XTST_SUBEVENT_MEMBER_ENCODE_A,mea);
+      break;
+    case 5:
+      UNPACK_SUBEVENT_CHECK_NO_REVISIT(1074,XTST_SUBEVENT_MEMBER_ENCODE_B,meb,4);
+      REVOKE_SUBEVENT_DECL(1074,0,XTST_SUBEVENT_MEMBER_ENCODE_B,meb);
+      break;
+    case 6:
+      UNPACK_SUBEVENT_CHECK_NO_REVISIT(1076,XTST_SUBEVENT_ME2,me2,5);
+      REVOKE_SUBEVENT_DECL(1076,0,XTST_SUBEVENT_ME2,me2);
+      break;
+    case 7:
+      UNPACK_SUBEVENT_CHECK_NO_REVISIT(1078,XTST_PLAIN,plain,6);
+      REVOKE_SUBEVENT_DECL(1078,0,XTST_PLAIN,plain);
+      break;
+    case 8:
+      UNPACK_SUBEVENT_CHECK_NO_REVISIT(1080,XTST_REGRESS,regress[0],7);
+      REVOKE_SUBEVENT_DECL(1080,0,XTST_REGRESS,regress[0]);
+      break;
+    case 9:
+      UNPACK_SUBEVENT_CHECK_NO_REVISIT(1081,XTST_REGRESS,regress[1],8);
+      REVOKE_SUBEVENT_DECL(1081,0,XTST_REGRESS,regress[1]);
+      break;
+    case 10:
+      UNPACK_SUBEVENT_CHECK_NO_REVISIT(1082,XTST_REGRESS,regress[2],9);
+      REVOKE_SUBEVENT_DECL(1082,0,XTST_REGRESS,regress[2]);
+      break;
+    case 11:
+      UNPACK_SUBEVENT_CHECK_NO_REVISIT(1083,XTST_REGRESS,regress[3],10);
+      REVOKE_SUBEVENT_DECL(1083,0,XTST_REGRESS,regress[3]);
+      break;
+    case 12:
+      UNPACK_SUBEVENT_CHECK_NO_REVISIT(1084,XTST_REGRESS,regress[4],11);
+      REVOKE_SUBEVENT_DECL(1084,0,XTST_REGRESS,regress[4]);
+      break;
+    case 13:
+      UNPACK_SUBEVENT_CHECK_NO_REVISIT(1085,XTST_REGRESS,regress[5],12);
+      REVOKE_SUBEVENT_DECL(1085,0,XTST_REGRESS,regress[5]);
+      break;
+    case 14:
+      UNPACK_SUBEVENT_CHECK_NO_REVISIT(1086,XTST_REGRESS,regress[6],13);
+      REVOKE_SUBEVENT_DECL(1086,0,XTST_REGRESS,regress[6]);
+      break;
+    case 15:
+      UNPACK_SUBEVENT_CHECK_NO_REVISIT(1087,XTST_REGRESS,regress[7],14);
+      REVOKE_SUBEVENT_DECL(1087,0,XTST_REGRESS,regress[7]);
+      break;
+    case 16:
+      UNPACK_SUBEVENT_CHECK_NO_REVISIT(1088,XTST_REGRESS,regress[8],15);
+      REVOKE_SUBEVENT_DECL(1088,0,XTST_REGRESS,regress[8]);
+      break;
+    case 17:
+      UNPACK_SUBEVENT_CHECK_NO_REVISIT(1089,XTST_REGRESS,regress[9],16);
+      REVOKE_SUBEVENT_DECL(1089,0,XTST_REGRESS,regress[9]);
+      break;
+    case 18:
+      UNPACK_SUBEVENT_CHECK_NO_REVISIT(1090,XTST_REGRESS,regress[10],17);
+      REVOKE_SUBEVENT_DECL(1090,0,XTST_REGRESS,regress[10]);
+      break;
+    case 19:
+      UNPACK_SUBEVENT_CHECK_NO_REVISIT(1091,XTST_REGRESS,regress[11],18);
+      REVOKE_SUBEVENT_DECL(1091,0,XTST_REGRESS,regress[11]);
+      break;
+    case 20:
+      UNPACK_SUBEVENT_CHECK_NO_REVISIT(1092,XTST_REGRESS,regress[12],19);
+      REVOKE_SUBEVENT_DECL(1092,0,XTST_REGRESS,regress[12]);
+      break;
+    case 21:
+      UNPACK_SUBEVENT_CHECK_NO_REVISIT(1093,XTST_REGRESS,regress[13],20);
+      REVOKE_SUBEVENT_DECL(1093,0,XTST_REGRESS,regress[13]);
+      break;
+    case 22:
+      UNPACK_SUBEVENT_CHECK_NO_REVISIT(1094,XTST_REGRESS,regress[14],21);
+      REVOKE_SUBEVENT_DECL(1094,0,XTST_REGRESS,regress[14]);
+      break;
+    case 23:
+      UNPACK_SUBEVENT_CHECK_NO_REVISIT(1095,XTST_REGRESS,regress[15],22);
+      REVOKE_SUBEVENT_DECL(1095,0,XTST_REGRESS,regress[15]);
+      break;
+    case 24:
+      UNPACK_SUBEVENT_CHECK_NO_REVISIT(1097,XTST_REGRESSEXTRA,regressextra,23);
+      REVOKE_SUBEVENT_DECL(1097,0,XTST_REGRESSEXTRA,regressextra);
+      break;
+    case 25:
+      UNPACK_SUBEVENT_CHECK_NO_REVISIT(1099,XTST_MDPP16,mdpp,24);
+      REVOKE_SUBEVENT_DECL(1099,0,XTST_MDPP16,mdpp);
+      break;
+  }
+  return 0;
+}
+
+/** END_REVOKE ********************************************************/
+/** BEGIN_REVOKE *******************************************************
+ *
+ * Event revoker for EVENT.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// STICKY_EVENT
+int unpack_sticky_event::__revoke_subevent(subevent_header *__header)
+  // corr = XTST_STICKY_CORR(type=0xcae,subtype=0xcaf);
+  // ignore_unknown_subevent;
+{
+  int __match_no = 0;
+  SUBEVENT_MATCH_CACHE_LOOKUP(__match_no)
+  {
+    MATCH_SUBEVENT_DECL(1270,__match_no,1,((VES10_1_type==0xcae)&&(VES10_1_subtype==0xcaf)),corr);
+    SUBEVENT_MATCH_CACHE_STORE(__match_no);
+  }
+  if (!__match_no) return 0;
+  switch (__match_no)
+  {
+    case 1:
+      UNPACK_SUBEVENT_CHECK_NO_REVISIT(1270,XTST_STICKY_CORR,corr,0);
+      REVOKE_SUBEVENT_DECL(1270,1,XTST_STICKY_CORR,corr);
+      break;
+  }
+  return 0;
+}
+
+/** END_REVOKE ********************************************************/
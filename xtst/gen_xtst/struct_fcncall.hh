@@ -0,0 +1,3849 @@
+/** BEGIN_FUNCTION_CALL_PER_MEMBER *************************************
+ *
+ * Recursive function calls per member.
+ *
+ * Do not edit - automatically generated.
+ */
+
+#include "gen/default_fcncall_define.hh"
+
+#ifndef USER_DEF_CAMAC_LECROY_4434
+FCNCALL_TEMPLATE
+FCNCALL_RET_TYPE FCNCALL_CLASS_NAME(CAMAC_LECROY_4434)::FCNCALL_NAME(CAMAC_LECROY_4434)
+{
+  FCNCALL_INIT;
+  // raw_array_zero_suppress<DATA24,DATA24,32> data;
+  {
+  FCNCALL_SUBNAME("data");
+  { FCNCALL_CALL_CTRL_WRAP(data,data.FCNCALL_CALL(data)); }
+  FCNCALL_SUBNAME_END;
+  }
+  FCNCALL_RET;
+}
+#endif//USER_DEF_CAMAC_LECROY_4434
+
+#ifndef USER_DEF_CAMAC_PHILLIPS_7164
+FCNCALL_TEMPLATE
+FCNCALL_RET_TYPE FCNCALL_CLASS_NAME(CAMAC_PHILLIPS_7164)::FCNCALL_NAME(CAMAC_PHILLIPS_7164)
+{
+  FCNCALL_INIT;
+  // raw_array_zero_suppress<DATA12,DATA12,16> data;
+  {
+  FCNCALL_SUBNAME("data");
+  { FCNCALL_CALL_CTRL_WRAP(data,data.FCNCALL_CALL(data)); }
+  FCNCALL_SUBNAME_END;
+  }
+  FCNCALL_RET;
+}
+#endif//USER_DEF_CAMAC_PHILLIPS_7164
+
+#ifndef USER_DEF_CAMAC_SILENA_4418
+FCNCALL_TEMPLATE
+FCNCALL_RET_TYPE FCNCALL_CLASS_NAME(CAMAC_SILENA_4418)::FCNCALL_NAME(CAMAC_SILENA_4418)
+{
+  FCNCALL_INIT;
+  // raw_array_zero_suppress<DATA12_OVERFLOW,DATA12_OVERFLOW,8> data;
+  {
+  FCNCALL_SUBNAME("data");
+  { FCNCALL_CALL_CTRL_WRAP(data,data.FCNCALL_CALL(data)); }
+  FCNCALL_SUBNAME_END;
+  }
+  FCNCALL_RET;
+}
+#endif//USER_DEF_CAMAC_SILENA_4418
+
+#ifndef USER_DEF_FASTBUS_LECROY_1875
+FCNCALL_TEMPLATE
+FCNCALL_RET_TYPE FCNCALL_CLASS_NAME(FASTBUS_LECROY_1875)::FCNCALL_NAME(FASTBUS_LECROY_1875)
+{
+  FCNCALL_INIT;
+  // raw_array_zero_suppress<DATA12_RANGE,DATA12_RANGE,64> data;
+  {
+  FCNCALL_SUBNAME("data");
+  { FCNCALL_CALL_CTRL_WRAP(data,data.FCNCALL_CALL(data)); }
+  FCNCALL_SUBNAME_END;
+  }
+  FCNCALL_RET;
+}
+#endif//USER_DEF_FASTBUS_LECROY_1875
+
+#ifndef USER_DEF_FASTBUS_LECROY_1885
+FCNCALL_TEMPLATE
+FCNCALL_RET_TYPE FCNCALL_CLASS_NAME(FASTBUS_LECROY_1885)::FCNCALL_NAME(FASTBUS_LECROY_1885)
+{
+  FCNCALL_INIT;
+  // raw_array_zero_suppress<DATA12_RANGE,DATA12_RANGE,96> data;
+  {
+  FCNCALL_SUBNAME("data");
+  { FCNCALL_CALL_CTRL_WRAP(data,data.FCNCALL_CALL(data)); }
+  FCNCALL_SUBNAME_END;
+  }
+  FCNCALL_RET;
+}
+#endif//USER_DEF_FASTBUS_LECROY_1885
+
+#ifndef USER_DEF_ITEM64
+FCNCALL_TEMPLATE
+FCNCALL_RET_TYPE FCNCALL_CLASS_NAME(ITEM64)::FCNCALL_NAME(ITEM64)
+{
+  FCNCALL_INIT;
+  // DATA64 member64;
+  {
+  FCNCALL_SUBNAME("member64");
+  { FCNCALL_CALL_CTRL_WRAP(member64,member64.FCNCALL_CALL(member64)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // union 
+  // {
+    // struct 
+    // {
+      // uint64 unnamed_0_1 : 2;
+      // uint64 dummy_2_4 : 3;
+      // uint64 num : 3;
+      // uint64 dummy_8_63 : 56;
+    // } ;
+    // uint64 u64;
+  // } a;
+  {
+  FCNCALL_SUBNAME("a");
+#if !STRUCT_ONLY_LAST_UNION_MEMBER
+  // struct 
+  // {
+    // uint64 unnamed_0_1 : 2;
+    // uint64 dummy_2_4 : 3;
+    // uint64 num : 3;
+    // uint64 dummy_8_63 : 56;
+  // } ;
+  // uint64 unnamed_0_1 : 2;
+  {
+  FCNCALL_SUBNAME("unnamed_0_1");
+  { FCNCALL_CALL_CTRL_WRAP(a.unnamed_0_1,FCNCALL_CALL_TYPE/*_BITFIELD*/(uint64,a.unnamed_0_1)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // uint64 dummy_2_4 : 3;
+  {
+  FCNCALL_SUBNAME("dummy_2_4");
+  { FCNCALL_CALL_CTRL_WRAP(a.dummy_2_4,FCNCALL_CALL_TYPE/*_BITFIELD*/(uint64,a.dummy_2_4)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // uint64 num : 3;
+  {
+  FCNCALL_SUBNAME("num");
+  { FCNCALL_CALL_CTRL_WRAP(a.num,FCNCALL_CALL_TYPE/*_BITFIELD*/(uint64,a.num)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // uint64 dummy_8_63 : 56;
+  {
+  FCNCALL_SUBNAME("dummy_8_63");
+  { FCNCALL_CALL_CTRL_WRAP(a.dummy_8_63,FCNCALL_CALL_TYPE/*_BITFIELD*/(uint64,a.dummy_8_63)); }
+  FCNCALL_SUBNAME_END;
+  }
+#endif// !STRUCT_ONLY_LAST_UNION_MEMBER
+  // uint64 u64;
+  {
+  FCNCALL_SUBNAME("u64");
+  { FCNCALL_CALL_CTRL_WRAP(a.u64,FCNCALL_CALL_TYPE(uint64,a.u64)); }
+  FCNCALL_SUBNAME_END;
+  }
+  FCNCALL_SUBNAME_END;
+  }
+  // union 
+  // {
+    // struct 
+    // {
+      // uint64 unnamed_0_1 : 2;
+      // uint64 dummy_2 : 1;
+      // uint64 v : 5;
+      // uint64 dummy_8_19 : 12;
+      // uint64 unnamed_20_63 : 44;
+    // } ;
+    // uint64 u64;
+  // } b;
+  {
+  FCNCALL_SUBNAME("b");
+#if !STRUCT_ONLY_LAST_UNION_MEMBER
+  // struct 
+  // {
+    // uint64 unnamed_0_1 : 2;
+    // uint64 dummy_2 : 1;
+    // uint64 v : 5;
+    // uint64 dummy_8_19 : 12;
+    // uint64 unnamed_20_63 : 44;
+  // } ;
+  // uint64 unnamed_0_1 : 2;
+  {
+  FCNCALL_SUBNAME("unnamed_0_1");
+  { FCNCALL_CALL_CTRL_WRAP(b.unnamed_0_1,FCNCALL_CALL_TYPE/*_BITFIELD*/(uint64,b.unnamed_0_1)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // uint64 dummy_2 : 1;
+  {
+  FCNCALL_SUBNAME("dummy_2");
+  { FCNCALL_CALL_CTRL_WRAP(b.dummy_2,FCNCALL_CALL_TYPE/*_BITFIELD*/(uint64,b.dummy_2)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // uint64 v : 5;
+  {
+  FCNCALL_SUBNAME("v");
+  { FCNCALL_CALL_CTRL_WRAP(b.v,FCNCALL_CALL_TYPE/*_BITFIELD*/(uint64,b.v)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // uint64 dummy_8_19 : 12;
+  {
+  FCNCALL_SUBNAME("dummy_8_19");
+  { FCNCALL_CALL_CTRL_WRAP(b.dummy_8_19,FCNCALL_CALL_TYPE/*_BITFIELD*/(uint64,b.dummy_8_19)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // uint64 unnamed_20_63 : 44;
+  {
+  FCNCALL_SUBNAME("unnamed_20_63");
+  { FCNCALL_CALL_CTRL_WRAP(b.unnamed_20_63,FCNCALL_CALL_TYPE/*_BITFIELD*/(uint64,b.unnamed_20_63)); }
+  FCNCALL_SUBNAME_END;
+  }
+#endif// !STRUCT_ONLY_LAST_UNION_MEMBER
+  // uint64 u64;
+  {
+  FCNCALL_SUBNAME("u64");
+  { FCNCALL_CALL_CTRL_WRAP(b.u64,FCNCALL_CALL_TYPE(uint64,b.u64)); }
+  FCNCALL_SUBNAME_END;
+  }
+  FCNCALL_SUBNAME_END;
+  }
+  // union 
+  // {
+    // struct 
+    // {
+      // uint32 unnamed_0_1 : 2;
+      // uint32 dummy_2 : 1;
+      // uint32 v : 5;
+      // uint32 dummy_8_19 : 12;
+      // uint32 unnamed_20_31 : 12;
+    // } ;
+    // uint32 u32;
+  // } c;
+  {
+  FCNCALL_SUBNAME("c");
+#if !STRUCT_ONLY_LAST_UNION_MEMBER
+  // struct 
+  // {
+    // uint32 unnamed_0_1 : 2;
+    // uint32 dummy_2 : 1;
+    // uint32 v : 5;
+    // uint32 dummy_8_19 : 12;
+    // uint32 unnamed_20_31 : 12;
+  // } ;
+  // uint32 unnamed_0_1 : 2;
+  {
+  FCNCALL_SUBNAME("unnamed_0_1");
+  { FCNCALL_CALL_CTRL_WRAP(c.unnamed_0_1,FCNCALL_CALL_TYPE/*_BITFIELD*/(uint32,c.unnamed_0_1)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // uint32 dummy_2 : 1;
+  {
+  FCNCALL_SUBNAME("dummy_2");
+  { FCNCALL_CALL_CTRL_WRAP(c.dummy_2,FCNCALL_CALL_TYPE/*_BITFIELD*/(uint32,c.dummy_2)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // uint32 v : 5;
+  {
+  FCNCALL_SUBNAME("v");
+  { FCNCALL_CALL_CTRL_WRAP(c.v,FCNCALL_CALL_TYPE/*_BITFIELD*/(uint32,c.v)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // uint32 dummy_8_19 : 12;
+  {
+  FCNCALL_SUBNAME("dummy_8_19");
+  { FCNCALL_CALL_CTRL_WRAP(c.dummy_8_19,FCNCALL_CALL_TYPE/*_BITFIELD*/(uint32,c.dummy_8_19)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // uint32 unnamed_20_31 : 12;
+  {
+  FCNCALL_SUBNAME("unnamed_20_31");
+  { FCNCALL_CALL_CTRL_WRAP(c.unnamed_20_31,FCNCALL_CALL_TYPE/*_BITFIELD*/(uint32,c.unnamed_20_31)); }
+  FCNCALL_SUBNAME_END;
+  }
+#endif// !STRUCT_ONLY_LAST_UNION_MEMBER
+  // uint32 u32;
+  {
+  FCNCALL_SUBNAME("u32");
+  { FCNCALL_CALL_CTRL_WRAP(c.u32,FCNCALL_CALL_TYPE(uint32,c.u32)); }
+  FCNCALL_SUBNAME_END;
+  }
+  FCNCALL_SUBNAME_END;
+  }
+  FCNCALL_RET;
+}
+#endif//USER_DEF_ITEM64
+
+#ifndef USER_DEF_ITEMQ
+FCNCALL_TEMPLATE
+FCNCALL_RET_TYPE FCNCALL_CLASS_NAME(ITEMQ)::FCNCALL_NAME(ITEMQ)
+{
+  FCNCALL_INIT;
+  // DATA32 chan;
+  {
+  FCNCALL_SUBNAME("chan");
+  { FCNCALL_CALL_CTRL_WRAP(chan,chan.FCNCALL_CALL(chan)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // union 
+  // {
+    // struct 
+    // {
+      // uint64 dummy_0_20 : 21;
+      // uint64 c21 : 1;
+      // uint64 dummy_22_63 : 42;
+    // } ;
+    // uint64 u64;
+  // } w1;
+  {
+  FCNCALL_SUBNAME("w1");
+#if !STRUCT_ONLY_LAST_UNION_MEMBER
+  // struct 
+  // {
+    // uint64 dummy_0_20 : 21;
+    // uint64 c21 : 1;
+    // uint64 dummy_22_63 : 42;
+  // } ;
+  // uint64 dummy_0_20 : 21;
+  {
+  FCNCALL_SUBNAME("dummy_0_20");
+  { FCNCALL_CALL_CTRL_WRAP(w1.dummy_0_20,FCNCALL_CALL_TYPE/*_BITFIELD*/(uint64,w1.dummy_0_20)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // uint64 c21 : 1;
+  {
+  FCNCALL_SUBNAME("c21");
+  { FCNCALL_CALL_CTRL_WRAP(w1.c21,FCNCALL_CALL_TYPE/*_BITFIELD*/(uint64,w1.c21)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // uint64 dummy_22_63 : 42;
+  {
+  FCNCALL_SUBNAME("dummy_22_63");
+  { FCNCALL_CALL_CTRL_WRAP(w1.dummy_22_63,FCNCALL_CALL_TYPE/*_BITFIELD*/(uint64,w1.dummy_22_63)); }
+  FCNCALL_SUBNAME_END;
+  }
+#endif// !STRUCT_ONLY_LAST_UNION_MEMBER
+  // uint64 u64;
+  {
+  FCNCALL_SUBNAME("u64");
+  { FCNCALL_CALL_CTRL_WRAP(w1.u64,FCNCALL_CALL_TYPE(uint64,w1.u64)); }
+  FCNCALL_SUBNAME_END;
+  }
+  FCNCALL_SUBNAME_END;
+  }
+  // union 
+  // {
+    // struct 
+    // {
+      // uint64 dummy_0_21 : 22;
+      // uint64 c22 : 1;
+      // uint64 dummy_23_63 : 41;
+    // } ;
+    // uint64 u64;
+  // } w2;
+  {
+  FCNCALL_SUBNAME("w2");
+#if !STRUCT_ONLY_LAST_UNION_MEMBER
+  // struct 
+  // {
+    // uint64 dummy_0_21 : 22;
+    // uint64 c22 : 1;
+    // uint64 dummy_23_63 : 41;
+  // } ;
+  // uint64 dummy_0_21 : 22;
+  {
+  FCNCALL_SUBNAME("dummy_0_21");
+  { FCNCALL_CALL_CTRL_WRAP(w2.dummy_0_21,FCNCALL_CALL_TYPE/*_BITFIELD*/(uint64,w2.dummy_0_21)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // uint64 c22 : 1;
+  {
+  FCNCALL_SUBNAME("c22");
+  { FCNCALL_CALL_CTRL_WRAP(w2.c22,FCNCALL_CALL_TYPE/*_BITFIELD*/(uint64,w2.c22)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // uint64 dummy_23_63 : 41;
+  {
+  FCNCALL_SUBNAME("dummy_23_63");
+  { FCNCALL_CALL_CTRL_WRAP(w2.dummy_23_63,FCNCALL_CALL_TYPE/*_BITFIELD*/(uint64,w2.dummy_23_63)); }
+  FCNCALL_SUBNAME_END;
+  }
+#endif// !STRUCT_ONLY_LAST_UNION_MEMBER
+  // uint64 u64;
+  {
+  FCNCALL_SUBNAME("u64");
+  { FCNCALL_CALL_CTRL_WRAP(w2.u64,FCNCALL_CALL_TYPE(uint64,w2.u64)); }
+  FCNCALL_SUBNAME_END;
+  }
+  FCNCALL_SUBNAME_END;
+  }
+  FCNCALL_RET;
+}
+#endif//USER_DEF_ITEMQ
+
+#ifndef USER_DEF_ITEM_ME2
+FCNCALL_TEMPLATE
+FCNCALL_RET_TYPE FCNCALL_CLASS_NAME(ITEM_ME2)::FCNCALL_NAME(ITEM_ME2)
+{
+  FCNCALL_INIT;
+  // raw_array_zero_suppress<DATA16,DATA16,32> data;
+  {
+  FCNCALL_SUBNAME("data");
+  { FCNCALL_CALL_CTRL_WRAP(data,data.FCNCALL_CALL(data)); }
+  FCNCALL_SUBNAME_END;
+  }
+  FCNCALL_RET;
+}
+#endif//USER_DEF_ITEM_ME2
+
+#ifndef USER_DEF_MADC32
+FCNCALL_TEMPLATE
+FCNCALL_RET_TYPE FCNCALL_CLASS_NAME(MADC32)::FCNCALL_NAME(MADC32)
+{
+  FCNCALL_INIT;
+  // union 
+  // {
+    // struct 
+    // {
+      // uint32 word_counts : 12;
+      // uint32 resolution : 3;
+      // uint32 unused1 : 1;
+      // uint32 id : 8;
+      // uint32 unnamed_24_29 : 6;
+      // uint32 unnamed_30_31 : 2;
+    // } ;
+    // uint32 u32;
+  // } header;
+  {
+  FCNCALL_SUBNAME("header");
+#if !STRUCT_ONLY_LAST_UNION_MEMBER
+  // struct 
+  // {
+    // uint32 word_counts : 12;
+    // uint32 resolution : 3;
+    // uint32 unused1 : 1;
+    // uint32 id : 8;
+    // uint32 unnamed_24_29 : 6;
+    // uint32 unnamed_30_31 : 2;
+  // } ;
+  // uint32 word_counts : 12;
+  {
+  FCNCALL_SUBNAME("word_counts");
+  { FCNCALL_CALL_CTRL_WRAP(header.word_counts,FCNCALL_CALL_TYPE/*_BITFIELD*/(uint32,header.word_counts)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // uint32 resolution : 3;
+  {
+  FCNCALL_SUBNAME("resolution");
+  { FCNCALL_CALL_CTRL_WRAP(header.resolution,FCNCALL_CALL_TYPE/*_BITFIELD*/(uint32,header.resolution)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // uint32 unused1 : 1;
+  {
+  FCNCALL_SUBNAME("unused1");
+  { FCNCALL_CALL_CTRL_WRAP(header.unused1,FCNCALL_CALL_TYPE/*_BITFIELD*/(uint32,header.unused1)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // uint32 id : 8;
+  {
+  FCNCALL_SUBNAME("id");
+  { FCNCALL_CALL_CTRL_WRAP(header.id,FCNCALL_CALL_TYPE/*_BITFIELD*/(uint32,header.id)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // uint32 unnamed_24_29 : 6;
+  {
+  FCNCALL_SUBNAME("unnamed_24_29");
+  { FCNCALL_CALL_CTRL_WRAP(header.unnamed_24_29,FCNCALL_CALL_TYPE/*_BITFIELD*/(uint32,header.unnamed_24_29)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // uint32 unnamed_30_31 : 2;
+  {
+  FCNCALL_SUBNAME("unnamed_30_31");
+  { FCNCALL_CALL_CTRL_WRAP(header.unnamed_30_31,FCNCALL_CALL_TYPE/*_BITFIELD*/(uint32,header.unnamed_30_31)); }
+  FCNCALL_SUBNAME_END;
+  }
+#endif// !STRUCT_ONLY_LAST_UNION_MEMBER
+  // uint32 u32;
+  {
+  FCNCALL_SUBNAME("u32");
+  { FCNCALL_CALL_CTRL_WRAP(header.u32,FCNCALL_CALL_TYPE(uint32,header.u32)); }
+  FCNCALL_SUBNAME_END;
+  }
+  FCNCALL_SUBNAME_END;
+  }
+  // union 
+  // {
+    // struct 
+    // {
+      // uint32 adc_value : 11;
+      // uint32 unnamed_11_13 : 3;
+      // uint32 unused : 1;
+      // uint32 unnamed_15_15 : 1;
+      // uint32 channel : 5;
+      // uint32 unnamed_21_29 : 9;
+      // uint32 unnamed_30_31 : 2;
+    // } ;
+    // uint32 u32;
+  // } madc32_data0;
+  {
+  FCNCALL_SUBNAME("madc32_data0");
+#if !STRUCT_ONLY_LAST_UNION_MEMBER
+  // struct 
+  // {
+    // uint32 adc_value : 11;
+    // uint32 unnamed_11_13 : 3;
+    // uint32 unused : 1;
+    // uint32 unnamed_15_15 : 1;
+    // uint32 channel : 5;
+    // uint32 unnamed_21_29 : 9;
+    // uint32 unnamed_30_31 : 2;
+  // } ;
+  // uint32 adc_value : 11;
+  {
+  FCNCALL_SUBNAME("adc_value");
+  { FCNCALL_CALL_CTRL_WRAP(madc32_data0.adc_value,FCNCALL_CALL_TYPE/*_BITFIELD*/(uint32,madc32_data0.adc_value)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // uint32 unnamed_11_13 : 3;
+  {
+  FCNCALL_SUBNAME("unnamed_11_13");
+  { FCNCALL_CALL_CTRL_WRAP(madc32_data0.unnamed_11_13,FCNCALL_CALL_TYPE/*_BITFIELD*/(uint32,madc32_data0.unnamed_11_13)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // uint32 unused : 1;
+  {
+  FCNCALL_SUBNAME("unused");
+  { FCNCALL_CALL_CTRL_WRAP(madc32_data0.unused,FCNCALL_CALL_TYPE/*_BITFIELD*/(uint32,madc32_data0.unused)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // uint32 unnamed_15_15 : 1;
+  {
+  FCNCALL_SUBNAME("unnamed_15_15");
+  { FCNCALL_CALL_CTRL_WRAP(madc32_data0.unnamed_15_15,FCNCALL_CALL_TYPE/*_BITFIELD*/(uint32,madc32_data0.unnamed_15_15)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // uint32 channel : 5;
+  {
+  FCNCALL_SUBNAME("channel");
+  { FCNCALL_CALL_CTRL_WRAP(madc32_data0.channel,FCNCALL_CALL_TYPE/*_BITFIELD*/(uint32,madc32_data0.channel)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // uint32 unnamed_21_29 : 9;
+  {
+  FCNCALL_SUBNAME("unnamed_21_29");
+  { FCNCALL_CALL_CTRL_WRAP(madc32_data0.unnamed_21_29,FCNCALL_CALL_TYPE/*_BITFIELD*/(uint32,madc32_data0.unnamed_21_29)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // uint32 unnamed_30_31 : 2;
+  {
+  FCNCALL_SUBNAME("unnamed_30_31");
+  { FCNCALL_CALL_CTRL_WRAP(madc32_data0.unnamed_30_31,FCNCALL_CALL_TYPE/*_BITFIELD*/(uint32,madc32_data0.unnamed_30_31)); }
+  FCNCALL_SUBNAME_END;
+  }
+#endif// !STRUCT_ONLY_LAST_UNION_MEMBER
+  // uint32 u32;
+  {
+  FCNCALL_SUBNAME("u32");
+  { FCNCALL_CALL_CTRL_WRAP(madc32_data0.u32,FCNCALL_CALL_TYPE(uint32,madc32_data0.u32)); }
+  FCNCALL_SUBNAME_END;
+  }
+  FCNCALL_SUBNAME_END;
+  }
+  // union 
+  // {
+    // struct 
+    // {
+      // uint32 adc_value : 12;
+      // uint32 unnamed_12_13 : 2;
+      // uint32 unused : 1;
+      // uint32 unnamed_15_15 : 1;
+      // uint32 channel : 5;
+      // uint32 unnamed_21_29 : 9;
+      // uint32 unnamed_30_31 : 2;
+    // } ;
+    // uint32 u32;
+  // } madc32_data1;
+  {
+  FCNCALL_SUBNAME("madc32_data1");
+#if !STRUCT_ONLY_LAST_UNION_MEMBER
+  // struct 
+  // {
+    // uint32 adc_value : 12;
+    // uint32 unnamed_12_13 : 2;
+    // uint32 unused : 1;
+    // uint32 unnamed_15_15 : 1;
+    // uint32 channel : 5;
+    // uint32 unnamed_21_29 : 9;
+    // uint32 unnamed_30_31 : 2;
+  // } ;
+  // uint32 adc_value : 12;
+  {
+  FCNCALL_SUBNAME("adc_value");
+  { FCNCALL_CALL_CTRL_WRAP(madc32_data1.adc_value,FCNCALL_CALL_TYPE/*_BITFIELD*/(uint32,madc32_data1.adc_value)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // uint32 unnamed_12_13 : 2;
+  {
+  FCNCALL_SUBNAME("unnamed_12_13");
+  { FCNCALL_CALL_CTRL_WRAP(madc32_data1.unnamed_12_13,FCNCALL_CALL_TYPE/*_BITFIELD*/(uint32,madc32_data1.unnamed_12_13)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // uint32 unused : 1;
+  {
+  FCNCALL_SUBNAME("unused");
+  { FCNCALL_CALL_CTRL_WRAP(madc32_data1.unused,FCNCALL_CALL_TYPE/*_BITFIELD*/(uint32,madc32_data1.unused)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // uint32 unnamed_15_15 : 1;
+  {
+  FCNCALL_SUBNAME("unnamed_15_15");
+  { FCNCALL_CALL_CTRL_WRAP(madc32_data1.unnamed_15_15,FCNCALL_CALL_TYPE/*_BITFIELD*/(uint32,madc32_data1.unnamed_15_15)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // uint32 channel : 5;
+  {
+  FCNCALL_SUBNAME("channel");
+  { FCNCALL_CALL_CTRL_WRAP(madc32_data1.channel,FCNCALL_CALL_TYPE/*_BITFIELD*/(uint32,madc32_data1.channel)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // uint32 unnamed_21_29 : 9;
+  {
+  FCNCALL_SUBNAME("unnamed_21_29");
+  { FCNCALL_CALL_CTRL_WRAP(madc32_data1.unnamed_21_29,FCNCALL_CALL_TYPE/*_BITFIELD*/(uint32,madc32_data1.unnamed_21_29)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // uint32 unnamed_30_31 : 2;
+  {
+  FCNCALL_SUBNAME("unnamed_30_31");
+  { FCNCALL_CALL_CTRL_WRAP(madc32_data1.unnamed_30_31,FCNCALL_CALL_TYPE/*_BITFIELD*/(uint32,madc32_data1.unnamed_30_31)); }
+  FCNCALL_SUBNAME_END;
+  }
+#endif// !STRUCT_ONLY_LAST_UNION_MEMBER
+  // uint32 u32;
+  {
+  FCNCALL_SUBNAME("u32");
+  { FCNCALL_CALL_CTRL_WRAP(madc32_data1.u32,FCNCALL_CALL_TYPE(uint32,madc32_data1.u32)); }
+  FCNCALL_SUBNAME_END;
+  }
+  FCNCALL_SUBNAME_END;
+  }
+  // union 
+  // {
+    // struct 
+    // {
+      // uint32 adc_value : 13;
+      // uint32 unnamed_13_13 : 1;
+      // uint32 unused : 1;
+      // uint32 unnamed_15_15 : 1;
+      // uint32 channel : 5;
+      // uint32 unnamed_21_29 : 9;
+      // uint32 unnamed_30_31 : 2;
+    // } ;
+    // uint32 u32;
+  // } madc32_data3;
+  {
+  FCNCALL_SUBNAME("madc32_data3");
+#if !STRUCT_ONLY_LAST_UNION_MEMBER
+  // struct 
+  // {
+    // uint32 adc_value : 13;
+    // uint32 unnamed_13_13 : 1;
+    // uint32 unused : 1;
+    // uint32 unnamed_15_15 : 1;
+    // uint32 channel : 5;
+    // uint32 unnamed_21_29 : 9;
+    // uint32 unnamed_30_31 : 2;
+  // } ;
+  // uint32 adc_value : 13;
+  {
+  FCNCALL_SUBNAME("adc_value");
+  { FCNCALL_CALL_CTRL_WRAP(madc32_data3.adc_value,FCNCALL_CALL_TYPE/*_BITFIELD*/(uint32,madc32_data3.adc_value)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // uint32 unnamed_13_13 : 1;
+  {
+  FCNCALL_SUBNAME("unnamed_13_13");
+  { FCNCALL_CALL_CTRL_WRAP(madc32_data3.unnamed_13_13,FCNCALL_CALL_TYPE/*_BITFIELD*/(uint32,madc32_data3.unnamed_13_13)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // uint32 unused : 1;
+  {
+  FCNCALL_SUBNAME("unused");
+  { FCNCALL_CALL_CTRL_WRAP(madc32_data3.unused,FCNCALL_CALL_TYPE/*_BITFIELD*/(uint32,madc32_data3.unused)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // uint32 unnamed_15_15 : 1;
+  {
+  FCNCALL_SUBNAME("unnamed_15_15");
+  { FCNCALL_CALL_CTRL_WRAP(madc32_data3.unnamed_15_15,FCNCALL_CALL_TYPE/*_BITFIELD*/(uint32,madc32_data3.unnamed_15_15)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // uint32 channel : 5;
+  {
+  FCNCALL_SUBNAME("channel");
+  { FCNCALL_CALL_CTRL_WRAP(madc32_data3.channel,FCNCALL_CALL_TYPE/*_BITFIELD*/(uint32,madc32_data3.channel)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // uint32 unnamed_21_29 : 9;
+  {
+  FCNCALL_SUBNAME("unnamed_21_29");
+  { FCNCALL_CALL_CTRL_WRAP(madc32_data3.unnamed_21_29,FCNCALL_CALL_TYPE/*_BITFIELD*/(uint32,madc32_data3.unnamed_21_29)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // uint32 unnamed_30_31 : 2;
+  {
+  FCNCALL_SUBNAME("unnamed_30_31");
+  { FCNCALL_CALL_CTRL_WRAP(madc32_data3.unnamed_30_31,FCNCALL_CALL_TYPE/*_BITFIELD*/(uint32,madc32_data3.unnamed_30_31)); }
+  FCNCALL_SUBNAME_END;
+  }
+#endif// !STRUCT_ONLY_LAST_UNION_MEMBER
+  // uint32 u32;
+  {
+  FCNCALL_SUBNAME("u32");
+  { FCNCALL_CALL_CTRL_WRAP(madc32_data3.u32,FCNCALL_CALL_TYPE(uint32,madc32_data3.u32)); }
+  FCNCALL_SUBNAME_END;
+  }
+  FCNCALL_SUBNAME_END;
+  }
+  // union 
+  // {
+    // struct 
+    // {
+      // uint32 evt_counter : 30;
+      // uint32 unnamed_30_31 : 2;
+    // } ;
+    // uint32 u32;
+  // } trailer;
+  {
+  FCNCALL_SUBNAME("trailer");
+#if !STRUCT_ONLY_LAST_UNION_MEMBER
+  // struct 
+  // {
+    // uint32 evt_counter : 30;
+    // uint32 unnamed_30_31 : 2;
+  // } ;
+  // uint32 evt_counter : 30;
+  {
+  FCNCALL_SUBNAME("evt_counter");
+  { FCNCALL_CALL_CTRL_WRAP(trailer.evt_counter,FCNCALL_CALL_TYPE/*_BITFIELD*/(uint32,trailer.evt_counter)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // uint32 unnamed_30_31 : 2;
+  {
+  FCNCALL_SUBNAME("unnamed_30_31");
+  { FCNCALL_CALL_CTRL_WRAP(trailer.unnamed_30_31,FCNCALL_CALL_TYPE/*_BITFIELD*/(uint32,trailer.unnamed_30_31)); }
+  FCNCALL_SUBNAME_END;
+  }
+#endif// !STRUCT_ONLY_LAST_UNION_MEMBER
+  // uint32 u32;
+  {
+  FCNCALL_SUBNAME("u32");
+  { FCNCALL_CALL_CTRL_WRAP(trailer.u32,FCNCALL_CALL_TYPE(uint32,trailer.u32)); }
+  FCNCALL_SUBNAME_END;
+  }
+  FCNCALL_SUBNAME_END;
+  }
+  FCNCALL_RET;
+}
+#endif//USER_DEF_MADC32
+
+#ifndef USER_DEF_SINGLE_DATA_MODULE
+FCNCALL_TEMPLATE
+FCNCALL_RET_TYPE FCNCALL_CLASS_NAME(SINGLE_DATA_MODULE)::FCNCALL_NAME(SINGLE_DATA_MODULE)
+{
+  FCNCALL_INIT;
+  // uint32 data;
+  {
+  FCNCALL_SUBNAME("data");
+  { FCNCALL_CALL_CTRL_WRAP(data,FCNCALL_CALL_TYPE(uint32,data)); }
+  FCNCALL_SUBNAME_END;
+  }
+  FCNCALL_RET;
+}
+#endif//USER_DEF_SINGLE_DATA_MODULE
+
+#ifndef USER_DEF_STICKY_ACTIVE
+FCNCALL_TEMPLATE
+FCNCALL_RET_TYPE FCNCALL_CLASS_NAME(STICKY_ACTIVE)::FCNCALL_NAME(STICKY_ACTIVE)
+{
+  FCNCALL_INIT;
+  // union 
+  // {
+    // struct 
+    // {
+      // uint32 unnamed_0_31 : 32;
+    // } ;
+    // uint32 u32;
+  // } separator;
+  {
+  FCNCALL_SUBNAME("separator");
+#if !STRUCT_ONLY_LAST_UNION_MEMBER
+  // struct 
+  // {
+    // uint32 unnamed_0_31 : 32;
+  // } ;
+  // uint32 unnamed_0_31 : 32;
+  {
+  FCNCALL_SUBNAME("unnamed_0_31");
+  { FCNCALL_CALL_CTRL_WRAP(separator.unnamed_0_31,FCNCALL_CALL_TYPE/*_BITFIELD*/(uint32,separator.unnamed_0_31)); }
+  FCNCALL_SUBNAME_END;
+  }
+#endif// !STRUCT_ONLY_LAST_UNION_MEMBER
+  // uint32 u32;
+  {
+  FCNCALL_SUBNAME("u32");
+  { FCNCALL_CALL_CTRL_WRAP(separator.u32,FCNCALL_CALL_TYPE(uint32,separator.u32)); }
+  FCNCALL_SUBNAME_END;
+  }
+  FCNCALL_SUBNAME_END;
+  }
+  // uint32 active;
+  {
+  FCNCALL_SUBNAME("active");
+  { FCNCALL_CALL_CTRL_WRAP(active,FCNCALL_CALL_TYPE(uint32,active)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // uint32 mark;
+  {
+  FCNCALL_SUBNAME("mark");
+  { FCNCALL_CALL_CTRL_WRAP(mark,FCNCALL_CALL_TYPE(uint32,mark)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // uint32 corr;
+  {
+  FCNCALL_SUBNAME("corr");
+  { FCNCALL_CALL_CTRL_WRAP(corr,FCNCALL_CALL_TYPE(uint32,corr)); }
+  FCNCALL_SUBNAME_END;
+  }
+  FCNCALL_RET;
+}
+#endif//USER_DEF_STICKY_ACTIVE
+
+#ifndef USER_DEF_VME_CAEN_V1190_SUBTDC
+FCNCALL_TEMPLATE
+FCNCALL_RET_TYPE FCNCALL_CLASS_NAME(VME_CAEN_V1190_SUBTDC)::FCNCALL_NAME(VME_CAEN_V1190_SUBTDC)
+{
+  FCNCALL_INIT;
+  // union 
+  // {
+    // struct 
+    // {
+      // uint32 bunch_id : 12;
+      // uint32 event_id : 12;
+      // uint32 tdc : 2;
+      // uint32 dummy_26 : 1;
+      // uint32 unnamed_27_31 : 5;
+    // } ;
+    // uint32 u32;
+  // } header;
+  {
+  FCNCALL_SUBNAME("header");
+#if !STRUCT_ONLY_LAST_UNION_MEMBER
+  // struct 
+  // {
+    // uint32 bunch_id : 12;
+    // uint32 event_id : 12;
+    // uint32 tdc : 2;
+    // uint32 dummy_26 : 1;
+    // uint32 unnamed_27_31 : 5;
+  // } ;
+  // uint32 bunch_id : 12;
+  {
+  FCNCALL_SUBNAME("bunch_id");
+  { FCNCALL_CALL_CTRL_WRAP(header.bunch_id,FCNCALL_CALL_TYPE/*_BITFIELD*/(uint32,header.bunch_id)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // uint32 event_id : 12;
+  {
+  FCNCALL_SUBNAME("event_id");
+  { FCNCALL_CALL_CTRL_WRAP(header.event_id,FCNCALL_CALL_TYPE/*_BITFIELD*/(uint32,header.event_id)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // uint32 tdc : 2;
+  {
+  FCNCALL_SUBNAME("tdc");
+  { FCNCALL_CALL_CTRL_WRAP(header.tdc,FCNCALL_CALL_TYPE/*_BITFIELD*/(uint32,header.tdc)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // uint32 dummy_26 : 1;
+  {
+  FCNCALL_SUBNAME("dummy_26");
+  { FCNCALL_CALL_CTRL_WRAP(header.dummy_26,FCNCALL_CALL_TYPE/*_BITFIELD*/(uint32,header.dummy_26)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // uint32 unnamed_27_31 : 5;
+  {
+  FCNCALL_SUBNAME("unnamed_27_31");
+  { FCNCALL_CALL_CTRL_WRAP(header.unnamed_27_31,FCNCALL_CALL_TYPE/*_BITFIELD*/(uint32,header.unnamed_27_31)); }
+  FCNCALL_SUBNAME_END;
+  }
+#endif// !STRUCT_ONLY_LAST_UNION_MEMBER
+  // uint32 u32;
+  {
+  FCNCALL_SUBNAME("u32");
+  { FCNCALL_CALL_CTRL_WRAP(header.u32,FCNCALL_CALL_TYPE(uint32,header.u32)); }
+  FCNCALL_SUBNAME_END;
+  }
+  FCNCALL_SUBNAME_END;
+  }
+  // union 
+  // {
+    // struct 
+    // {
+      // uint32 flags : 15;
+      // uint32 dummy_15_23 : 9;
+      // uint32 tdc : 2;
+      // uint32 dummy_26 : 1;
+      // uint32 unnamed_27_31 : 5;
+    // } ;
+    // uint32 u32;
+  // } error_flags;
+  {
+  FCNCALL_SUBNAME("error_flags");
+#if !STRUCT_ONLY_LAST_UNION_MEMBER
+  // struct 
+  // {
+    // uint32 flags : 15;
+    // uint32 dummy_15_23 : 9;
+    // uint32 tdc : 2;
+    // uint32 dummy_26 : 1;
+    // uint32 unnamed_27_31 : 5;
+  // } ;
+  // uint32 flags : 15;
+  {
+  FCNCALL_SUBNAME("flags");
+  { FCNCALL_CALL_CTRL_WRAP(error_flags.flags,FCNCALL_CALL_TYPE/*_BITFIELD*/(uint32,error_flags.flags)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // uint32 dummy_15_23 : 9;
+  {
+  FCNCALL_SUBNAME("dummy_15_23");
+  { FCNCALL_CALL_CTRL_WRAP(error_flags.dummy_15_23,FCNCALL_CALL_TYPE/*_BITFIELD*/(uint32,error_flags.dummy_15_23)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // uint32 tdc : 2;
+  {
+  FCNCALL_SUBNAME("tdc");
+  { FCNCALL_CALL_CTRL_WRAP(error_flags.tdc,FCNCALL_CALL_TYPE/*_BITFIELD*/(uint32,error_flags.tdc)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // uint32 dummy_26 : 1;
+  {
+  FCNCALL_SUBNAME("dummy_26");
+  { FCNCALL_CALL_CTRL_WRAP(error_flags.dummy_26,FCNCALL_CALL_TYPE/*_BITFIELD*/(uint32,error_flags.dummy_26)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // uint32 unnamed_27_31 : 5;
+  {
+  FCNCALL_SUBNAME("unnamed_27_31");
+  { FCNCALL_CALL_CTRL_WRAP(error_flags.unnamed_27_31,FCNCALL_CALL_TYPE/*_BITFIELD*/(uint32,error_flags.unnamed_27_31)); }
+  FCNCALL_SUBNAME_END;
+  }
+#endif// !STRUCT_ONLY_LAST_UNION_MEMBER
+  // uint32 u32;
+  {
+  FCNCALL_SUBNAME("u32");
+  { FCNCALL_CALL_CTRL_WRAP(error_flags.u32,FCNCALL_CALL_TYPE(uint32,error_flags.u32)); }
+  FCNCALL_SUBNAME_END;
+  }
+  FCNCALL_SUBNAME_END;
+  }
+  // union 
+  // {
+    // struct 
+    // {
+      // uint32 word_count : 12;
+      // uint32 event_id : 12;
+      // uint32 tdc : 2;
+      // uint32 dummy_26 : 1;
+      // uint32 unnamed_27_31 : 5;
+    // } ;
+    // uint32 u32;
+  // } trailer;
+  {
+  FCNCALL_SUBNAME("trailer");
+#if !STRUCT_ONLY_LAST_UNION_MEMBER
+  // struct 
+  // {
+    // uint32 word_count : 12;
+    // uint32 event_id : 12;
+    // uint32 tdc : 2;
+    // uint32 dummy_26 : 1;
+    // uint32 unnamed_27_31 : 5;
+  // } ;
+  // uint32 word_count : 12;
+  {
+  FCNCALL_SUBNAME("word_count");
+  { FCNCALL_CALL_CTRL_WRAP(trailer.word_count,FCNCALL_CALL_TYPE/*_BITFIELD*/(uint32,trailer.word_count)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // uint32 event_id : 12;
+  {
+  FCNCALL_SUBNAME("event_id");
+  { FCNCALL_CALL_CTRL_WRAP(trailer.event_id,FCNCALL_CALL_TYPE/*_BITFIELD*/(uint32,trailer.event_id)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // uint32 tdc : 2;
+  {
+  FCNCALL_SUBNAME("tdc");
+  { FCNCALL_CALL_CTRL_WRAP(trailer.tdc,FCNCALL_CALL_TYPE/*_BITFIELD*/(uint32,trailer.tdc)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // uint32 dummy_26 : 1;
+  {
+  FCNCALL_SUBNAME("dummy_26");
+  { FCNCALL_CALL_CTRL_WRAP(trailer.dummy_26,FCNCALL_CALL_TYPE/*_BITFIELD*/(uint32,trailer.dummy_26)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // uint32 unnamed_27_31 : 5;
+  {
+  FCNCALL_SUBNAME("unnamed_27_31");
+  { FCNCALL_CALL_CTRL_WRAP(trailer.unnamed_27_31,FCNCALL_CALL_TYPE/*_BITFIELD*/(uint32,trailer.unnamed_27_31)); }
+  FCNCALL_SUBNAME_END;
+  }
+#endif// !STRUCT_ONLY_LAST_UNION_MEMBER
+  // uint32 u32;
+  {
+  FCNCALL_SUBNAME("u32");
+  { FCNCALL_CALL_CTRL_WRAP(trailer.u32,FCNCALL_CALL_TYPE(uint32,trailer.u32)); }
+  FCNCALL_SUBNAME_END;
+  }
+  FCNCALL_SUBNAME_END;
+  }
+  FCNCALL_RET;
+}
+#endif//USER_DEF_VME_CAEN_V1190_SUBTDC
+
+#ifndef USER_DEF_VME_CAEN_V1190
+FCNCALL_TEMPLATE
+FCNCALL_RET_TYPE FCNCALL_CLASS_NAME(VME_CAEN_V1190)::FCNCALL_NAME(VME_CAEN_V1190)
+{
+  FCNCALL_INIT;
+  // raw_array_multi_zero_suppress<DATA24,DATA24,32,128> data;
+  {
+  FCNCALL_SUBNAME("data");
+  { FCNCALL_CALL_CTRL_WRAP(data,data.FCNCALL_CALL(data)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // union 
+  // {
+    // struct 
+    // {
+      // uint32 geom : 5;
+      // uint32 event_number : 22;
+      // uint32 unnamed_27_31 : 5;
+    // } ;
+    // uint32 u32;
+  // } header;
+  {
+  FCNCALL_SUBNAME("header");
+#if !STRUCT_ONLY_LAST_UNION_MEMBER
+  // struct 
+  // {
+    // uint32 geom : 5;
+    // uint32 event_number : 22;
+    // uint32 unnamed_27_31 : 5;
+  // } ;
+  // uint32 geom : 5;
+  {
+  FCNCALL_SUBNAME("geom");
+  { FCNCALL_CALL_CTRL_WRAP(header.geom,FCNCALL_CALL_TYPE/*_BITFIELD*/(uint32,header.geom)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // uint32 event_number : 22;
+  {
+  FCNCALL_SUBNAME("event_number");
+  { FCNCALL_CALL_CTRL_WRAP(header.event_number,FCNCALL_CALL_TYPE/*_BITFIELD*/(uint32,header.event_number)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // uint32 unnamed_27_31 : 5;
+  {
+  FCNCALL_SUBNAME("unnamed_27_31");
+  { FCNCALL_CALL_CTRL_WRAP(header.unnamed_27_31,FCNCALL_CALL_TYPE/*_BITFIELD*/(uint32,header.unnamed_27_31)); }
+  FCNCALL_SUBNAME_END;
+  }
+#endif// !STRUCT_ONLY_LAST_UNION_MEMBER
+  // uint32 u32;
+  {
+  FCNCALL_SUBNAME("u32");
+  { FCNCALL_CALL_CTRL_WRAP(header.u32,FCNCALL_CALL_TYPE(uint32,header.u32)); }
+  FCNCALL_SUBNAME_END;
+  }
+  FCNCALL_SUBNAME_END;
+  }
+  // VME_CAEN_V1190_SUBTDC tdc[4];
+  {
+  FCNCALL_SUBNAME("tdc");
+  FCNCALL_FOR(__i0,4)
+  {
+    FCNCALL_SUBINDEX(__i0);
+    { FCNCALL_CALL_CTRL_WRAP_ARRAY(tdc__i0,,__i0,tdc[__i0].FCNCALL_CALL(tdc[__i0])); }
+    FCNCALL_SUBINDEX_END(__i0);
+  }
+  FCNCALL_SUBNAME_END;
+  }
+  // union 
+  // {
+    // struct 
+    // {
+      // uint32 time_tag : 27;
+      // uint32 unnamed_27_31 : 5;
+    // } ;
+    // uint32 u32;
+  // } trigger;
+  {
+  FCNCALL_SUBNAME("trigger");
+#if !STRUCT_ONLY_LAST_UNION_MEMBER
+  // struct 
+  // {
+    // uint32 time_tag : 27;
+    // uint32 unnamed_27_31 : 5;
+  // } ;
+  // uint32 time_tag : 27;
+  {
+  FCNCALL_SUBNAME("time_tag");
+  { FCNCALL_CALL_CTRL_WRAP(trigger.time_tag,FCNCALL_CALL_TYPE/*_BITFIELD*/(uint32,trigger.time_tag)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // uint32 unnamed_27_31 : 5;
+  {
+  FCNCALL_SUBNAME("unnamed_27_31");
+  { FCNCALL_CALL_CTRL_WRAP(trigger.unnamed_27_31,FCNCALL_CALL_TYPE/*_BITFIELD*/(uint32,trigger.unnamed_27_31)); }
+  FCNCALL_SUBNAME_END;
+  }
+#endif// !STRUCT_ONLY_LAST_UNION_MEMBER
+  // uint32 u32;
+  {
+  FCNCALL_SUBNAME("u32");
+  { FCNCALL_CALL_CTRL_WRAP(trigger.u32,FCNCALL_CALL_TYPE(uint32,trigger.u32)); }
+  FCNCALL_SUBNAME_END;
+  }
+  FCNCALL_SUBNAME_END;
+  }
+  // union 
+  // {
+    // struct 
+    // {
+      // uint32 geom : 5;
+      // uint32 word_count : 15;
+      // uint32 dummy_20_23 : 4;
+      // uint32 tdc_error : 1;
+      // uint32 buffer_overflow : 1;
+      // uint32 trigger_lost : 1;
+      // uint32 unnamed_27_31 : 5;
+    // } ;
+    // uint32 u32;
+  // } trailer;
+  {
+  FCNCALL_SUBNAME("trailer");
+#if !STRUCT_ONLY_LAST_UNION_MEMBER
+  // struct 
+  // {
+    // uint32 geom : 5;
+    // uint32 word_count : 15;
+    // uint32 dummy_20_23 : 4;
+    // uint32 tdc_error : 1;
+    // uint32 buffer_overflow : 1;
+    // uint32 trigger_lost : 1;
+    // uint32 unnamed_27_31 : 5;
+  // } ;
+  // uint32 geom : 5;
+  {
+  FCNCALL_SUBNAME("geom");
+  { FCNCALL_CALL_CTRL_WRAP(trailer.geom,FCNCALL_CALL_TYPE/*_BITFIELD*/(uint32,trailer.geom)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // uint32 word_count : 15;
+  {
+  FCNCALL_SUBNAME("word_count");
+  { FCNCALL_CALL_CTRL_WRAP(trailer.word_count,FCNCALL_CALL_TYPE/*_BITFIELD*/(uint32,trailer.word_count)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // uint32 dummy_20_23 : 4;
+  {
+  FCNCALL_SUBNAME("dummy_20_23");
+  { FCNCALL_CALL_CTRL_WRAP(trailer.dummy_20_23,FCNCALL_CALL_TYPE/*_BITFIELD*/(uint32,trailer.dummy_20_23)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // uint32 tdc_error : 1;
+  {
+  FCNCALL_SUBNAME("tdc_error");
+  { FCNCALL_CALL_CTRL_WRAP(trailer.tdc_error,FCNCALL_CALL_TYPE/*_BITFIELD*/(uint32,trailer.tdc_error)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // uint32 buffer_overflow : 1;
+  {
+  FCNCALL_SUBNAME("buffer_overflow");
+  { FCNCALL_CALL_CTRL_WRAP(trailer.buffer_overflow,FCNCALL_CALL_TYPE/*_BITFIELD*/(uint32,trailer.buffer_overflow)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // uint32 trigger_lost : 1;
+  {
+  FCNCALL_SUBNAME("trigger_lost");
+  { FCNCALL_CALL_CTRL_WRAP(trailer.trigger_lost,FCNCALL_CALL_TYPE/*_BITFIELD*/(uint32,trailer.trigger_lost)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // uint32 unnamed_27_31 : 5;
+  {
+  FCNCALL_SUBNAME("unnamed_27_31");
+  { FCNCALL_CALL_CTRL_WRAP(trailer.unnamed_27_31,FCNCALL_CALL_TYPE/*_BITFIELD*/(uint32,trailer.unnamed_27_31)); }
+  FCNCALL_SUBNAME_END;
+  }
+#endif// !STRUCT_ONLY_LAST_UNION_MEMBER
+  // uint32 u32;
+  {
+  FCNCALL_SUBNAME("u32");
+  { FCNCALL_CALL_CTRL_WRAP(trailer.u32,FCNCALL_CALL_TYPE(uint32,trailer.u32)); }
+  FCNCALL_SUBNAME_END;
+  }
+  FCNCALL_SUBNAME_END;
+  }
+  FCNCALL_RET;
+}
+#endif//USER_DEF_VME_CAEN_V1190
+
+#ifndef USER_DEF_VME_CAEN_V1190_SHORT_SUBTDC
+FCNCALL_TEMPLATE
+FCNCALL_RET_TYPE FCNCALL_CLASS_NAME(VME_CAEN_V1190_SHORT_SUBTDC)::FCNCALL_NAME(VME_CAEN_V1190_SHORT_SUBTDC)
+{
+  FCNCALL_INIT;
+  FCNCALL_RET;
+}
+#endif//USER_DEF_VME_CAEN_V1190_SHORT_SUBTDC
+
+#ifndef USER_DEF_VME_CAEN_V1190_SHORT_SUBTDC_ERROR
+FCNCALL_TEMPLATE
+FCNCALL_RET_TYPE FCNCALL_CLASS_NAME(VME_CAEN_V1190_SHORT_SUBTDC_ERROR)::FCNCALL_NAME(VME_CAEN_V1190_SHORT_SUBTDC_ERROR)
+{
+  FCNCALL_INIT;
+  // union 
+  // {
+    // struct 
+    // {
+      // uint32 flags : 15;
+      // uint32 dummy_15_23 : 9;
+      // uint32 tdc : 2;
+      // uint32 dummy_26 : 1;
+      // uint32 unnamed_27_31 : 5;
+    // } ;
+    // uint32 u32;
+  // } error_flags;
+  {
+  FCNCALL_SUBNAME("error_flags");
+#if !STRUCT_ONLY_LAST_UNION_MEMBER
+  // struct 
+  // {
+    // uint32 flags : 15;
+    // uint32 dummy_15_23 : 9;
+    // uint32 tdc : 2;
+    // uint32 dummy_26 : 1;
+    // uint32 unnamed_27_31 : 5;
+  // } ;
+  // uint32 flags : 15;
+  {
+  FCNCALL_SUBNAME("flags");
+  { FCNCALL_CALL_CTRL_WRAP(error_flags.flags,FCNCALL_CALL_TYPE/*_BITFIELD*/(uint32,error_flags.flags)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // uint32 dummy_15_23 : 9;
+  {
+  FCNCALL_SUBNAME("dummy_15_23");
+  { FCNCALL_CALL_CTRL_WRAP(error_flags.dummy_15_23,FCNCALL_CALL_TYPE/*_BITFIELD*/(uint32,error_flags.dummy_15_23)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // uint32 tdc : 2;
+  {
+  FCNCALL_SUBNAME("tdc");
+  { FCNCALL_CALL_CTRL_WRAP(error_flags.tdc,FCNCALL_CALL_TYPE/*_BITFIELD*/(uint32,error_flags.tdc)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // uint32 dummy_26 : 1;
+  {
+  FCNCALL_SUBNAME("dummy_26");
+  { FCNCALL_CALL_CTRL_WRAP(error_flags.dummy_26,FCNCALL_CALL_TYPE/*_BITFIELD*/(uint32,error_flags.dummy_26)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // uint32 unnamed_27_31 : 5;
+  {
+  FCNCALL_SUBNAME("unnamed_27_31");
+  { FCNCALL_CALL_CTRL_WRAP(error_flags.unnamed_27_31,FCNCALL_CALL_TYPE/*_BITFIELD*/(uint32,error_flags.unnamed_27_31)); }
+  FCNCALL_SUBNAME_END;
+  }
+#endif// !STRUCT_ONLY_LAST_UNION_MEMBER
+  // uint32 u32;
+  {
+  FCNCALL_SUBNAME("u32");
+  { FCNCALL_CALL_CTRL_WRAP(error_flags.u32,FCNCALL_CALL_TYPE(uint32,error_flags.u32)); }
+  FCNCALL_SUBNAME_END;
+  }
+  FCNCALL_SUBNAME_END;
+  }
+  FCNCALL_RET;
+}
+#endif//USER_DEF_VME_CAEN_V1190_SHORT_SUBTDC_ERROR
+
+#ifndef USER_DEF_VME_CAEN_V1190_SHORT
+FCNCALL_TEMPLATE
+FCNCALL_RET_TYPE FCNCALL_CLASS_NAME(VME_CAEN_V1190_SHORT)::FCNCALL_NAME(VME_CAEN_V1190_SHORT)
+{
+  FCNCALL_INIT;
+  // raw_array_multi_zero_suppress<DATA24,DATA24,32,128> data;
+  {
+  FCNCALL_SUBNAME("data");
+  { FCNCALL_CALL_CTRL_WRAP(data,data.FCNCALL_CALL(data)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // union 
+  // {
+    // struct 
+    // {
+      // uint32 geom : 5;
+      // uint32 event_number : 22;
+      // uint32 unnamed_27_31 : 5;
+    // } ;
+    // uint32 u32;
+  // } header;
+  {
+  FCNCALL_SUBNAME("header");
+#if !STRUCT_ONLY_LAST_UNION_MEMBER
+  // struct 
+  // {
+    // uint32 geom : 5;
+    // uint32 event_number : 22;
+    // uint32 unnamed_27_31 : 5;
+  // } ;
+  // uint32 geom : 5;
+  {
+  FCNCALL_SUBNAME("geom");
+  { FCNCALL_CALL_CTRL_WRAP(header.geom,FCNCALL_CALL_TYPE/*_BITFIELD*/(uint32,header.geom)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // uint32 event_number : 22;
+  {
+  FCNCALL_SUBNAME("event_number");
+  { FCNCALL_CALL_CTRL_WRAP(header.event_number,FCNCALL_CALL_TYPE/*_BITFIELD*/(uint32,header.event_number)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // uint32 unnamed_27_31 : 5;
+  {
+  FCNCALL_SUBNAME("unnamed_27_31");
+  { FCNCALL_CALL_CTRL_WRAP(header.unnamed_27_31,FCNCALL_CALL_TYPE/*_BITFIELD*/(uint32,header.unnamed_27_31)); }
+  FCNCALL_SUBNAME_END;
+  }
+#endif// !STRUCT_ONLY_LAST_UNION_MEMBER
+  // uint32 u32;
+  {
+  FCNCALL_SUBNAME("u32");
+  { FCNCALL_CALL_CTRL_WRAP(header.u32,FCNCALL_CALL_TYPE(uint32,header.u32)); }
+  FCNCALL_SUBNAME_END;
+  }
+  FCNCALL_SUBNAME_END;
+  }
+  // VME_CAEN_V1190_SHORT_SUBTDC tdc[4];
+  {
+  FCNCALL_SUBNAME("tdc");
+  FCNCALL_FOR(__i0,4)
+  {
+    FCNCALL_SUBINDEX(__i0);
+    { FCNCALL_CALL_CTRL_WRAP_ARRAY(tdc__i0,,__i0,tdc[__i0].FCNCALL_CALL(tdc[__i0])); }
+    FCNCALL_SUBINDEX_END(__i0);
+  }
+  FCNCALL_SUBNAME_END;
+  }
+  // VME_CAEN_V1190_SHORT_SUBTDC_ERROR err[4];
+  {
+  FCNCALL_SUBNAME("err");
+  FCNCALL_FOR(__i0,4)
+  {
+    FCNCALL_SUBINDEX(__i0);
+    { FCNCALL_CALL_CTRL_WRAP_ARRAY(err__i0,,__i0,err[__i0].FCNCALL_CALL(err[__i0])); }
+    FCNCALL_SUBINDEX_END(__i0);
+  }
+  FCNCALL_SUBNAME_END;
+  }
+  // union 
+  // {
+    // struct 
+    // {
+      // uint32 time_tag : 27;
+      // uint32 unnamed_27_31 : 5;
+    // } ;
+    // uint32 u32;
+  // } trigger;
+  {
+  FCNCALL_SUBNAME("trigger");
+#if !STRUCT_ONLY_LAST_UNION_MEMBER
+  // struct 
+  // {
+    // uint32 time_tag : 27;
+    // uint32 unnamed_27_31 : 5;
+  // } ;
+  // uint32 time_tag : 27;
+  {
+  FCNCALL_SUBNAME("time_tag");
+  { FCNCALL_CALL_CTRL_WRAP(trigger.time_tag,FCNCALL_CALL_TYPE/*_BITFIELD*/(uint32,trigger.time_tag)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // uint32 unnamed_27_31 : 5;
+  {
+  FCNCALL_SUBNAME("unnamed_27_31");
+  { FCNCALL_CALL_CTRL_WRAP(trigger.unnamed_27_31,FCNCALL_CALL_TYPE/*_BITFIELD*/(uint32,trigger.unnamed_27_31)); }
+  FCNCALL_SUBNAME_END;
+  }
+#endif// !STRUCT_ONLY_LAST_UNION_MEMBER
+  // uint32 u32;
+  {
+  FCNCALL_SUBNAME("u32");
+  { FCNCALL_CALL_CTRL_WRAP(trigger.u32,FCNCALL_CALL_TYPE(uint32,trigger.u32)); }
+  FCNCALL_SUBNAME_END;
+  }
+  FCNCALL_SUBNAME_END;
+  }
+  // union 
+  // {
+    // struct 
+    // {
+      // uint32 geom : 5;
+      // uint32 word_count : 15;
+      // uint32 dummy_20_23 : 4;
+      // uint32 tdc_error : 1;
+      // uint32 buffer_overflow : 1;
+      // uint32 trigger_lost : 1;
+      // uint32 unnamed_27_31 : 5;
+    // } ;
+    // uint32 u32;
+  // } trailer;
+  {
+  FCNCALL_SUBNAME("trailer");
+#if !STRUCT_ONLY_LAST_UNION_MEMBER
+  // struct 
+  // {
+    // uint32 geom : 5;
+    // uint32 word_count : 15;
+    // uint32 dummy_20_23 : 4;
+    // uint32 tdc_error : 1;
+    // uint32 buffer_overflow : 1;
+    // uint32 trigger_lost : 1;
+    // uint32 unnamed_27_31 : 5;
+  // } ;
+  // uint32 geom : 5;
+  {
+  FCNCALL_SUBNAME("geom");
+  { FCNCALL_CALL_CTRL_WRAP(trailer.geom,FCNCALL_CALL_TYPE/*_BITFIELD*/(uint32,trailer.geom)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // uint32 word_count : 15;
+  {
+  FCNCALL_SUBNAME("word_count");
+  { FCNCALL_CALL_CTRL_WRAP(trailer.word_count,FCNCALL_CALL_TYPE/*_BITFIELD*/(uint32,trailer.word_count)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // uint32 dummy_20_23 : 4;
+  {
+  FCNCALL_SUBNAME("dummy_20_23");
+  { FCNCALL_CALL_CTRL_WRAP(trailer.dummy_20_23,FCNCALL_CALL_TYPE/*_BITFIELD*/(uint32,trailer.dummy_20_23)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // uint32 tdc_error : 1;
+  {
+  FCNCALL_SUBNAME("tdc_error");
+  { FCNCALL_CALL_CTRL_WRAP(trailer.tdc_error,FCNCALL_CALL_TYPE/*_BITFIELD*/(uint32,trailer.tdc_error)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // uint32 buffer_overflow : 1;
+  {
+  FCNCALL_SUBNAME("buffer_overflow");
+  { FCNCALL_CALL_CTRL_WRAP(trailer.buffer_overflow,FCNCALL_CALL_TYPE/*_BITFIELD*/(uint32,trailer.buffer_overflow)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // uint32 trigger_lost : 1;
+  {
+  FCNCALL_SUBNAME("trigger_lost");
+  { FCNCALL_CALL_CTRL_WRAP(trailer.trigger_lost,FCNCALL_CALL_TYPE/*_BITFIELD*/(uint32,trailer.trigger_lost)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // uint32 unnamed_27_31 : 5;
+  {
+  FCNCALL_SUBNAME("unnamed_27_31");
+  { FCNCALL_CALL_CTRL_WRAP(trailer.unnamed_27_31,FCNCALL_CALL_TYPE/*_BITFIELD*/(uint32,trailer.unnamed_27_31)); }
+  FCNCALL_SUBNAME_END;
+  }
+#endif// !STRUCT_ONLY_LAST_UNION_MEMBER
+  // uint32 u32;
+  {
+  FCNCALL_SUBNAME("u32");
+  { FCNCALL_CALL_CTRL_WRAP(trailer.u32,FCNCALL_CALL_TYPE(uint32,trailer.u32)); }
+  FCNCALL_SUBNAME_END;
+  }
+  FCNCALL_SUBNAME_END;
+  }
+  FCNCALL_RET;
+}
+#endif//USER_DEF_VME_CAEN_V1190_SHORT
+
+#ifndef USER_DEF_VME_CAEN_V1290_SUBTDC
+FCNCALL_TEMPLATE
+FCNCALL_RET_TYPE FCNCALL_CLASS_NAME(VME_CAEN_V1290_SUBTDC)::FCNCALL_NAME(VME_CAEN_V1290_SUBTDC)
+{
+  FCNCALL_INIT;
+  // union 
+  // {
+    // struct 
+    // {
+      // uint32 bunch_id : 12;
+      // uint32 event_id : 12;
+      // uint32 tdc : 2;
+      // uint32 dummy_26 : 1;
+      // uint32 unnamed_27_31 : 5;
+    // } ;
+    // uint32 u32;
+  // } header;
+  {
+  FCNCALL_SUBNAME("header");
+#if !STRUCT_ONLY_LAST_UNION_MEMBER
+  // struct 
+  // {
+    // uint32 bunch_id : 12;
+    // uint32 event_id : 12;
+    // uint32 tdc : 2;
+    // uint32 dummy_26 : 1;
+    // uint32 unnamed_27_31 : 5;
+  // } ;
+  // uint32 bunch_id : 12;
+  {
+  FCNCALL_SUBNAME("bunch_id");
+  { FCNCALL_CALL_CTRL_WRAP(header.bunch_id,FCNCALL_CALL_TYPE/*_BITFIELD*/(uint32,header.bunch_id)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // uint32 event_id : 12;
+  {
+  FCNCALL_SUBNAME("event_id");
+  { FCNCALL_CALL_CTRL_WRAP(header.event_id,FCNCALL_CALL_TYPE/*_BITFIELD*/(uint32,header.event_id)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // uint32 tdc : 2;
+  {
+  FCNCALL_SUBNAME("tdc");
+  { FCNCALL_CALL_CTRL_WRAP(header.tdc,FCNCALL_CALL_TYPE/*_BITFIELD*/(uint32,header.tdc)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // uint32 dummy_26 : 1;
+  {
+  FCNCALL_SUBNAME("dummy_26");
+  { FCNCALL_CALL_CTRL_WRAP(header.dummy_26,FCNCALL_CALL_TYPE/*_BITFIELD*/(uint32,header.dummy_26)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // uint32 unnamed_27_31 : 5;
+  {
+  FCNCALL_SUBNAME("unnamed_27_31");
+  { FCNCALL_CALL_CTRL_WRAP(header.unnamed_27_31,FCNCALL_CALL_TYPE/*_BITFIELD*/(uint32,header.unnamed_27_31)); }
+  FCNCALL_SUBNAME_END;
+  }
+#endif// !STRUCT_ONLY_LAST_UNION_MEMBER
+  // uint32 u32;
+  {
+  FCNCALL_SUBNAME("u32");
+  { FCNCALL_CALL_CTRL_WRAP(header.u32,FCNCALL_CALL_TYPE(uint32,header.u32)); }
+  FCNCALL_SUBNAME_END;
+  }
+  FCNCALL_SUBNAME_END;
+  }
+  // union 
+  // {
+    // struct 
+    // {
+      // uint32 flags : 15;
+      // uint32 dummy_15_23 : 9;
+      // uint32 tdc : 2;
+      // uint32 dummy_26 : 1;
+      // uint32 unnamed_27_31 : 5;
+    // } ;
+    // uint32 u32;
+  // } error_flags;
+  {
+  FCNCALL_SUBNAME("error_flags");
+#if !STRUCT_ONLY_LAST_UNION_MEMBER
+  // struct 
+  // {
+    // uint32 flags : 15;
+    // uint32 dummy_15_23 : 9;
+    // uint32 tdc : 2;
+    // uint32 dummy_26 : 1;
+    // uint32 unnamed_27_31 : 5;
+  // } ;
+  // uint32 flags : 15;
+  {
+  FCNCALL_SUBNAME("flags");
+  { FCNCALL_CALL_CTRL_WRAP(error_flags.flags,FCNCALL_CALL_TYPE/*_BITFIELD*/(uint32,error_flags.flags)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // uint32 dummy_15_23 : 9;
+  {
+  FCNCALL_SUBNAME("dummy_15_23");
+  { FCNCALL_CALL_CTRL_WRAP(error_flags.dummy_15_23,FCNCALL_CALL_TYPE/*_BITFIELD*/(uint32,error_flags.dummy_15_23)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // uint32 tdc : 2;
+  {
+  FCNCALL_SUBNAME("tdc");
+  { FCNCALL_CALL_CTRL_WRAP(error_flags.tdc,FCNCALL_CALL_TYPE/*_BITFIELD*/(uint32,error_flags.tdc)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // uint32 dummy_26 : 1;
+  {
+  FCNCALL_SUBNAME("dummy_26");
+  { FCNCALL_CALL_CTRL_WRAP(error_flags.dummy_26,FCNCALL_CALL_TYPE/*_BITFIELD*/(uint32,error_flags.dummy_26)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // uint32 unnamed_27_31 : 5;
+  {
+  FCNCALL_SUBNAME("unnamed_27_31");
+  { FCNCALL_CALL_CTRL_WRAP(error_flags.unnamed_27_31,FCNCALL_CALL_TYPE/*_BITFIELD*/(uint32,error_flags.unnamed_27_31)); }
+  FCNCALL_SUBNAME_END;
+  }
+#endif// !STRUCT_ONLY_LAST_UNION_MEMBER
+  // uint32 u32;
+  {
+  FCNCALL_SUBNAME("u32");
+  { FCNCALL_CALL_CTRL_WRAP(error_flags.u32,FCNCALL_CALL_TYPE(uint32,error_flags.u32)); }
+  FCNCALL_SUBNAME_END;
+  }
+  FCNCALL_SUBNAME_END;
+  }
+  // union 
+  // {
+    // struct 
+    // {
+      // uint32 word_count : 12;
+      // uint32 event_id : 12;
+      // uint32 tdc : 2;
+      // uint32 dummy_26 : 1;
+      // uint32 unnamed_27_31 : 5;
+    // } ;
+    // uint32 u32;
+  // } trailer;
+  {
+  FCNCALL_SUBNAME("trailer");
+#if !STRUCT_ONLY_LAST_UNION_MEMBER
+  // struct 
+  // {
+    // uint32 word_count : 12;
+    // uint32 event_id : 12;
+    // uint32 tdc : 2;
+    // uint32 dummy_26 : 1;
+    // uint32 unnamed_27_31 : 5;
+  // } ;
+  // uint32 word_count : 12;
+  {
+  FCNCALL_SUBNAME("word_count");
+  { FCNCALL_CALL_CTRL_WRAP(trailer.word_count,FCNCALL_CALL_TYPE/*_BITFIELD*/(uint32,trailer.word_count)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // uint32 event_id : 12;
+  {
+  FCNCALL_SUBNAME("event_id");
+  { FCNCALL_CALL_CTRL_WRAP(trailer.event_id,FCNCALL_CALL_TYPE/*_BITFIELD*/(uint32,trailer.event_id)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // uint32 tdc : 2;
+  {
+  FCNCALL_SUBNAME("tdc");
+  { FCNCALL_CALL_CTRL_WRAP(trailer.tdc,FCNCALL_CALL_TYPE/*_BITFIELD*/(uint32,trailer.tdc)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // uint32 dummy_26 : 1;
+  {
+  FCNCALL_SUBNAME("dummy_26");
+  { FCNCALL_CALL_CTRL_WRAP(trailer.dummy_26,FCNCALL_CALL_TYPE/*_BITFIELD*/(uint32,trailer.dummy_26)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // uint32 unnamed_27_31 : 5;
+  {
+  FCNCALL_SUBNAME("unnamed_27_31");
+  { FCNCALL_CALL_CTRL_WRAP(trailer.unnamed_27_31,FCNCALL_CALL_TYPE/*_BITFIELD*/(uint32,trailer.unnamed_27_31)); }
+  FCNCALL_SUBNAME_END;
+  }
+#endif// !STRUCT_ONLY_LAST_UNION_MEMBER
+  // uint32 u32;
+  {
+  FCNCALL_SUBNAME("u32");
+  { FCNCALL_CALL_CTRL_WRAP(trailer.u32,FCNCALL_CALL_TYPE(uint32,trailer.u32)); }
+  FCNCALL_SUBNAME_END;
+  }
+  FCNCALL_SUBNAME_END;
+  }
+  FCNCALL_RET;
+}
+#endif//USER_DEF_VME_CAEN_V1290_SUBTDC
+
+#ifndef USER_DEF_VME_CAEN_V1290
+FCNCALL_TEMPLATE
+FCNCALL_RET_TYPE FCNCALL_CLASS_NAME(VME_CAEN_V1290)::FCNCALL_NAME(VME_CAEN_V1290)
+{
+  FCNCALL_INIT;
+  // raw_array_multi_zero_suppress<DATA24,DATA24,32,128> data;
+  {
+  FCNCALL_SUBNAME("data");
+  { FCNCALL_CALL_CTRL_WRAP(data,data.FCNCALL_CALL(data)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // union 
+  // {
+    // struct 
+    // {
+      // uint32 geom : 5;
+      // uint32 event_number : 22;
+      // uint32 unnamed_27_31 : 5;
+    // } ;
+    // uint32 u32;
+  // } header;
+  {
+  FCNCALL_SUBNAME("header");
+#if !STRUCT_ONLY_LAST_UNION_MEMBER
+  // struct 
+  // {
+    // uint32 geom : 5;
+    // uint32 event_number : 22;
+    // uint32 unnamed_27_31 : 5;
+  // } ;
+  // uint32 geom : 5;
+  {
+  FCNCALL_SUBNAME("geom");
+  { FCNCALL_CALL_CTRL_WRAP(header.geom,FCNCALL_CALL_TYPE/*_BITFIELD*/(uint32,header.geom)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // uint32 event_number : 22;
+  {
+  FCNCALL_SUBNAME("event_number");
+  { FCNCALL_CALL_CTRL_WRAP(header.event_number,FCNCALL_CALL_TYPE/*_BITFIELD*/(uint32,header.event_number)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // uint32 unnamed_27_31 : 5;
+  {
+  FCNCALL_SUBNAME("unnamed_27_31");
+  { FCNCALL_CALL_CTRL_WRAP(header.unnamed_27_31,FCNCALL_CALL_TYPE/*_BITFIELD*/(uint32,header.unnamed_27_31)); }
+  FCNCALL_SUBNAME_END;
+  }
+#endif// !STRUCT_ONLY_LAST_UNION_MEMBER
+  // uint32 u32;
+  {
+  FCNCALL_SUBNAME("u32");
+  { FCNCALL_CALL_CTRL_WRAP(header.u32,FCNCALL_CALL_TYPE(uint32,header.u32)); }
+  FCNCALL_SUBNAME_END;
+  }
+  FCNCALL_SUBNAME_END;
+  }
+  // VME_CAEN_V1290_SUBTDC tdc[4];
+  {
+  FCNCALL_SUBNAME("tdc");
+  FCNCALL_FOR(__i0,4)
+  {
+    FCNCALL_SUBINDEX(__i0);
+    { FCNCALL_CALL_CTRL_WRAP_ARRAY(tdc__i0,,__i0,tdc[__i0].FCNCALL_CALL(tdc[__i0])); }
+    FCNCALL_SUBINDEX_END(__i0);
+  }
+  FCNCALL_SUBNAME_END;
+  }
+  // union 
+  // {
+    // struct 
+    // {
+      // uint32 time_tag : 27;
+      // uint32 unnamed_27_31 : 5;
+    // } ;
+    // uint32 u32;
+  // } trigger;
+  {
+  FCNCALL_SUBNAME("trigger");
+#if !STRUCT_ONLY_LAST_UNION_MEMBER
+  // struct 
+  // {
+    // uint32 time_tag : 27;
+    // uint32 unnamed_27_31 : 5;
+  // } ;
+  // uint32 time_tag : 27;
+  {
+  FCNCALL_SUBNAME("time_tag");
+  { FCNCALL_CALL_CTRL_WRAP(trigger.time_tag,FCNCALL_CALL_TYPE/*_BITFIELD*/(uint32,trigger.time_tag)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // uint32 unnamed_27_31 : 5;
+  {
+  FCNCALL_SUBNAME("unnamed_27_31");
+  { FCNCALL_CALL_CTRL_WRAP(trigger.unnamed_27_31,FCNCALL_CALL_TYPE/*_BITFIELD*/(uint32,trigger.unnamed_27_31)); }
+  FCNCALL_SUBNAME_END;
+  }
+#endif// !STRUCT_ONLY_LAST_UNION_MEMBER
+  // uint32 u32;
+  {
+  FCNCALL_SUBNAME("u32");
+  { FCNCALL_CALL_CTRL_WRAP(trigger.u32,FCNCALL_CALL_TYPE(uint32,trigger.u32)); }
+  FCNCALL_SUBNAME_END;
+  }
+  FCNCALL_SUBNAME_END;
+  }
+  // union 
+  // {
+    // struct 
+    // {
+      // uint32 geom : 5;
+      // uint32 word_count : 15;
+      // uint32 dummy_20_23 : 4;
+      // uint32 tdc_error : 1;
+      // uint32 buffer_overflow : 1;
+      // uint32 trigger_lost : 1;
+      // uint32 unnamed_27_31 : 5;
+    // } ;
+    // uint32 u32;
+  // } trailer;
+  {
+  FCNCALL_SUBNAME("trailer");
+#if !STRUCT_ONLY_LAST_UNION_MEMBER
+  // struct 
+  // {
+    // uint32 geom : 5;
+    // uint32 word_count : 15;
+    // uint32 dummy_20_23 : 4;
+    // uint32 tdc_error : 1;
+    // uint32 buffer_overflow : 1;
+    // uint32 trigger_lost : 1;
+    // uint32 unnamed_27_31 : 5;
+  // } ;
+  // uint32 geom : 5;
+  {
+  FCNCALL_SUBNAME("geom");
+  { FCNCALL_CALL_CTRL_WRAP(trailer.geom,FCNCALL_CALL_TYPE/*_BITFIELD*/(uint32,trailer.geom)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // uint32 word_count : 15;
+  {
+  FCNCALL_SUBNAME("word_count");
+  { FCNCALL_CALL_CTRL_WRAP(trailer.word_count,FCNCALL_CALL_TYPE/*_BITFIELD*/(uint32,trailer.word_count)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // uint32 dummy_20_23 : 4;
+  {
+  FCNCALL_SUBNAME("dummy_20_23");
+  { FCNCALL_CALL_CTRL_WRAP(trailer.dummy_20_23,FCNCALL_CALL_TYPE/*_BITFIELD*/(uint32,trailer.dummy_20_23)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // uint32 tdc_error : 1;
+  {
+  FCNCALL_SUBNAME("tdc_error");
+  { FCNCALL_CALL_CTRL_WRAP(trailer.tdc_error,FCNCALL_CALL_TYPE/*_BITFIELD*/(uint32,trailer.tdc_error)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // uint32 buffer_overflow : 1;
+  {
+  FCNCALL_SUBNAME("buffer_overflow");
+  { FCNCALL_CALL_CTRL_WRAP(trailer.buffer_overflow,FCNCALL_CALL_TYPE/*_BITFIELD*/(uint32,trailer.buffer_overflow)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // uint32 trigger_lost : 1;
+  {
+  FCNCALL_SUBNAME("trigger_lost");
+  { FCNCALL_CALL_CTRL_WRAP(trailer.trigger_lost,FCNCALL_CALL_TYPE/*_BITFIELD*/(uint32,trailer.trigger_lost)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // uint32 unnamed_27_31 : 5;
+  {
+  FCNCALL_SUBNAME("unnamed_27_31");
+  { FCNCALL_CALL_CTRL_WRAP(trailer.unnamed_27_31,FCNCALL_CALL_TYPE/*_BITFIELD*/(uint32,trailer.unnamed_27_31)); }
+  FCNCALL_SUBNAME_END;
+  }
+#endif// !STRUCT_ONLY_LAST_UNION_MEMBER
+  // uint32 u32;
+  {
+  FCNCALL_SUBNAME("u32");
+  { FCNCALL_CALL_CTRL_WRAP(trailer.u32,FCNCALL_CALL_TYPE(uint32,trailer.u32)); }
+  FCNCALL_SUBNAME_END;
+  }
+  FCNCALL_SUBNAME_END;
+  }
+  FCNCALL_RET;
+}
+#endif//USER_DEF_VME_CAEN_V1290
+
+#ifndef USER_DEF_VME_CAEN_V1290_SHORT_SUBTDC
+FCNCALL_TEMPLATE
+FCNCALL_RET_TYPE FCNCALL_CLASS_NAME(VME_CAEN_V1290_SHORT_SUBTDC)::FCNCALL_NAME(VME_CAEN_V1290_SHORT_SUBTDC)
+{
+  FCNCALL_INIT;
+  FCNCALL_RET;
+}
+#endif//USER_DEF_VME_CAEN_V1290_SHORT_SUBTDC
+
+#ifndef USER_DEF_VME_CAEN_V1290_SHORT_SUBTDC_ERROR
+FCNCALL_TEMPLATE
+FCNCALL_RET_TYPE FCNCALL_CLASS_NAME(VME_CAEN_V1290_SHORT_SUBTDC_ERROR)::FCNCALL_NAME(VME_CAEN_V1290_SHORT_SUBTDC_ERROR)
+{
+  FCNCALL_INIT;
+  // union 
+  // {
+    // struct 
+    // {
+      // uint32 flags : 15;
+      // uint32 dummy_15_23 : 9;
+      // uint32 tdc : 2;
+      // uint32 dummy_26 : 1;
+      // uint32 unnamed_27_31 : 5;
+    // } ;
+    // uint32 u32;
+  // } error_flags;
+  {
+  FCNCALL_SUBNAME("error_flags");
+#if !STRUCT_ONLY_LAST_UNION_MEMBER
+  // struct 
+  // {
+    // uint32 flags : 15;
+    // uint32 dummy_15_23 : 9;
+    // uint32 tdc : 2;
+    // uint32 dummy_26 : 1;
+    // uint32 unnamed_27_31 : 5;
+  // } ;
+  // uint32 flags : 15;
+  {
+  FCNCALL_SUBNAME("flags");
+  { FCNCALL_CALL_CTRL_WRAP(error_flags.flags,FCNCALL_CALL_TYPE/*_BITFIELD*/(uint32,error_flags.flags)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // uint32 dummy_15_23 : 9;
+  {
+  FCNCALL_SUBNAME("dummy_15_23");
+  { FCNCALL_CALL_CTRL_WRAP(error_flags.dummy_15_23,FCNCALL_CALL_TYPE/*_BITFIELD*/(uint32,error_flags.dummy_15_23)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // uint32 tdc : 2;
+  {
+  FCNCALL_SUBNAME("tdc");
+  { FCNCALL_CALL_CTRL_WRAP(error_flags.tdc,FCNCALL_CALL_TYPE/*_BITFIELD*/(uint32,error_flags.tdc)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // uint32 dummy_26 : 1;
+  {
+  FCNCALL_SUBNAME("dummy_26");
+  { FCNCALL_CALL_CTRL_WRAP(error_flags.dummy_26,FCNCALL_CALL_TYPE/*_BITFIELD*/(uint32,error_flags.dummy_26)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // uint32 unnamed_27_31 : 5;
+  {
+  FCNCALL_SUBNAME("unnamed_27_31");
+  { FCNCALL_CALL_CTRL_WRAP(error_flags.unnamed_27_31,FCNCALL_CALL_TYPE/*_BITFIELD*/(uint32,error_flags.unnamed_27_31)); }
+  FCNCALL_SUBNAME_END;
+  }
+#endif// !STRUCT_ONLY_LAST_UNION_MEMBER
+  // uint32 u32;
+  {
+  FCNCALL_SUBNAME("u32");
+  { FCNCALL_CALL_CTRL_WRAP(error_flags.u32,FCNCALL_CALL_TYPE(uint32,error_flags.u32)); }
+  FCNCALL_SUBNAME_END;
+  }
+  FCNCALL_SUBNAME_END;
+  }
+  FCNCALL_RET;
+}
+#endif//USER_DEF_VME_CAEN_V1290_SHORT_SUBTDC_ERROR
+
+#ifndef USER_DEF_VME_CAEN_V1290_SHORT
+FCNCALL_TEMPLATE
+FCNCALL_RET_TYPE FCNCALL_CLASS_NAME(VME_CAEN_V1290_SHORT)::FCNCALL_NAME(VME_CAEN_V1290_SHORT)
+{
+  FCNCALL_INIT;
+  // raw_array_multi_zero_suppress<DATA24,DATA24,32,128> data;
+  {
+  FCNCALL_SUBNAME("data");
+  { FCNCALL_CALL_CTRL_WRAP(data,data.FCNCALL_CALL(data)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // union 
+  // {
+    // struct 
+    // {
+      // uint32 geom : 5;
+      // uint32 event_number : 22;
+      // uint32 unnamed_27_31 : 5;
+    // } ;
+    // uint32 u32;
+  // } header;
+  {
+  FCNCALL_SUBNAME("header");
+#if !STRUCT_ONLY_LAST_UNION_MEMBER
+  // struct 
+  // {
+    // uint32 geom : 5;
+    // uint32 event_number : 22;
+    // uint32 unnamed_27_31 : 5;
+  // } ;
+  // uint32 geom : 5;
+  {
+  FCNCALL_SUBNAME("geom");
+  { FCNCALL_CALL_CTRL_WRAP(header.geom,FCNCALL_CALL_TYPE/*_BITFIELD*/(uint32,header.geom)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // uint32 event_number : 22;
+  {
+  FCNCALL_SUBNAME("event_number");
+  { FCNCALL_CALL_CTRL_WRAP(header.event_number,FCNCALL_CALL_TYPE/*_BITFIELD*/(uint32,header.event_number)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // uint32 unnamed_27_31 : 5;
+  {
+  FCNCALL_SUBNAME("unnamed_27_31");
+  { FCNCALL_CALL_CTRL_WRAP(header.unnamed_27_31,FCNCALL_CALL_TYPE/*_BITFIELD*/(uint32,header.unnamed_27_31)); }
+  FCNCALL_SUBNAME_END;
+  }
+#endif// !STRUCT_ONLY_LAST_UNION_MEMBER
+  // uint32 u32;
+  {
+  FCNCALL_SUBNAME("u32");
+  { FCNCALL_CALL_CTRL_WRAP(header.u32,FCNCALL_CALL_TYPE(uint32,header.u32)); }
+  FCNCALL_SUBNAME_END;
+  }
+  FCNCALL_SUBNAME_END;
+  }
+  // VME_CAEN_V1290_SHORT_SUBTDC tdc[4];
+  {
+  FCNCALL_SUBNAME("tdc");
+  FCNCALL_FOR(__i0,4)
+  {
+    FCNCALL_SUBINDEX(__i0);
+    { FCNCALL_CALL_CTRL_WRAP_ARRAY(tdc__i0,,__i0,tdc[__i0].FCNCALL_CALL(tdc[__i0])); }
+    FCNCALL_SUBINDEX_END(__i0);
+  }
+  FCNCALL_SUBNAME_END;
+  }
+  // VME_CAEN_V1290_SHORT_SUBTDC_ERROR err[4];
+  {
+  FCNCALL_SUBNAME("err");
+  FCNCALL_FOR(__i0,4)
+  {
+    FCNCALL_SUBINDEX(__i0);
+    { FCNCALL_CALL_CTRL_WRAP_ARRAY(err__i0,,__i0,err[__i0].FCNCALL_CALL(err[__i0])); }
+    FCNCALL_SUBINDEX_END(__i0);
+  }
+  FCNCALL_SUBNAME_END;
+  }
+  // union 
+  // {
+    // struct 
+    // {
+      // uint32 time_tag : 27;
+      // uint32 unnamed_27_31 : 5;
+    // } ;
+    // uint32 u32;
+  // } trigger;
+  {
+  FCNCALL_SUBNAME("trigger");
+#if !STRUCT_ONLY_LAST_UNION_MEMBER
+  // struct 
+  // {
+    // uint32 time_tag : 27;
+    // uint32 unnamed_27_31 : 5;
+  // } ;
+  // uint32 time_tag : 27;
+  {
+  FCNCALL_SUBNAME("time_tag");
+  { FCNCALL_CALL_CTRL_WRAP(trigger.time_tag,FCNCALL_CALL_TYPE/*_BITFIELD*/(uint32,trigger.time_tag)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // uint32 unnamed_27_31 : 5;
+  {
+  FCNCALL_SUBNAME("unnamed_27_31");
+  { FCNCALL_CALL_CTRL_WRAP(trigger.unnamed_27_31,FCNCALL_CALL_TYPE/*_BITFIELD*/(uint32,trigger.unnamed_27_31)); }
+  FCNCALL_SUBNAME_END;
+  }
+#endif// !STRUCT_ONLY_LAST_UNION_MEMBER
+  // uint32 u32;
+  {
+  FCNCALL_SUBNAME("u32");
+  { FCNCALL_CALL_CTRL_WRAP(trigger.u32,FCNCALL_CALL_TYPE(uint32,trigger.u32)); }
+  FCNCALL_SUBNAME_END;
+  }
+  FCNCALL_SUBNAME_END;
+  }
+  // union 
+  // {
+    // struct 
+    // {
+      // uint32 geom : 5;
+      // uint32 word_count : 15;
+      // uint32 dummy_20_23 : 4;
+      // uint32 tdc_error : 1;
+      // uint32 buffer_overflow : 1;
+      // uint32 trigger_lost : 1;
+      // uint32 unnamed_27_31 : 5;
+    // } ;
+    // uint32 u32;
+  // } trailer;
+  {
+  FCNCALL_SUBNAME("trailer");
+#if !STRUCT_ONLY_LAST_UNION_MEMBER
+  // struct 
+  // {
+    // uint32 geom : 5;
+    // uint32 word_count : 15;
+    // uint32 dummy_20_23 : 4;
+    // uint32 tdc_error : 1;
+    // uint32 buffer_overflow : 1;
+    // uint32 trigger_lost : 1;
+    // uint32 unnamed_27_31 : 5;
+  // } ;
+  // uint32 geom : 5;
+  {
+  FCNCALL_SUBNAME("geom");
+  { FCNCALL_CALL_CTRL_WRAP(trailer.geom,FCNCALL_CALL_TYPE/*_BITFIELD*/(uint32,trailer.geom)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // uint32 word_count : 15;
+  {
+  FCNCALL_SUBNAME("word_count");
+  { FCNCALL_CALL_CTRL_WRAP(trailer.word_count,FCNCALL_CALL_TYPE/*_BITFIELD*/(uint32,trailer.word_count)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // uint32 dummy_20_23 : 4;
+  {
+  FCNCALL_SUBNAME("dummy_20_23");
+  { FCNCALL_CALL_CTRL_WRAP(trailer.dummy_20_23,FCNCALL_CALL_TYPE/*_BITFIELD*/(uint32,trailer.dummy_20_23)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // uint32 tdc_error : 1;
+  {
+  FCNCALL_SUBNAME("tdc_error");
+  { FCNCALL_CALL_CTRL_WRAP(trailer.tdc_error,FCNCALL_CALL_TYPE/*_BITFIELD*/(uint32,trailer.tdc_error)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // uint32 buffer_overflow : 1;
+  {
+  FCNCALL_SUBNAME("buffer_overflow");
+  { FCNCALL_CALL_CTRL_WRAP(trailer.buffer_overflow,FCNCALL_CALL_TYPE/*_BITFIELD*/(uint32,trailer.buffer_overflow)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // uint32 trigger_lost : 1;
+  {
+  FCNCALL_SUBNAME("trigger_lost");
+  { FCNCALL_CALL_CTRL_WRAP(trailer.trigger_lost,FCNCALL_CALL_TYPE/*_BITFIELD*/(uint32,trailer.trigger_lost)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // uint32 unnamed_27_31 : 5;
+  {
+  FCNCALL_SUBNAME("unnamed_27_31");
+  { FCNCALL_CALL_CTRL_WRAP(trailer.unnamed_27_31,FCNCALL_CALL_TYPE/*_BITFIELD*/(uint32,trailer.unnamed_27_31)); }
+  FCNCALL_SUBNAME_END;
+  }
+#endif// !STRUCT_ONLY_LAST_UNION_MEMBER
+  // uint32 u32;
+  {
+  FCNCALL_SUBNAME("u32");
+  { FCNCALL_CALL_CTRL_WRAP(trailer.u32,FCNCALL_CALL_TYPE(uint32,trailer.u32)); }
+  FCNCALL_SUBNAME_END;
+  }
+  FCNCALL_SUBNAME_END;
+  }
+  FCNCALL_RET;
+}
+#endif//USER_DEF_VME_CAEN_V1290_SHORT
+
+#ifndef USER_DEF_VME_CAEN_V775
+FCNCALL_TEMPLATE
+FCNCALL_RET_TYPE FCNCALL_CLASS_NAME(VME_CAEN_V775)::FCNCALL_NAME(VME_CAEN_V775)
+{
+  FCNCALL_INIT;
+  // raw_array_zero_suppress<DATA12_OVERFLOW,DATA12_OVERFLOW,32> data;
+  {
+  FCNCALL_SUBNAME("data");
+  { FCNCALL_CALL_CTRL_WRAP(data,data.FCNCALL_CALL(data)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // union 
+  // {
+    // struct 
+    // {
+      // uint32 event_number : 24;
+      // uint32 unnamed_24_26 : 3;
+      // uint32 geom : 5;
+    // } ;
+    // uint32 u32;
+  // } eob;
+  {
+  FCNCALL_SUBNAME("eob");
+#if !STRUCT_ONLY_LAST_UNION_MEMBER
+  // struct 
+  // {
+    // uint32 event_number : 24;
+    // uint32 unnamed_24_26 : 3;
+    // uint32 geom : 5;
+  // } ;
+  // uint32 event_number : 24;
+  {
+  FCNCALL_SUBNAME("event_number");
+  { FCNCALL_CALL_CTRL_WRAP(eob.event_number,FCNCALL_CALL_TYPE/*_BITFIELD*/(uint32,eob.event_number)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // uint32 unnamed_24_26 : 3;
+  {
+  FCNCALL_SUBNAME("unnamed_24_26");
+  { FCNCALL_CALL_CTRL_WRAP(eob.unnamed_24_26,FCNCALL_CALL_TYPE/*_BITFIELD*/(uint32,eob.unnamed_24_26)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // uint32 geom : 5;
+  {
+  FCNCALL_SUBNAME("geom");
+  { FCNCALL_CALL_CTRL_WRAP(eob.geom,FCNCALL_CALL_TYPE/*_BITFIELD*/(uint32,eob.geom)); }
+  FCNCALL_SUBNAME_END;
+  }
+#endif// !STRUCT_ONLY_LAST_UNION_MEMBER
+  // uint32 u32;
+  {
+  FCNCALL_SUBNAME("u32");
+  { FCNCALL_CALL_CTRL_WRAP(eob.u32,FCNCALL_CALL_TYPE(uint32,eob.u32)); }
+  FCNCALL_SUBNAME_END;
+  }
+  FCNCALL_SUBNAME_END;
+  }
+  FCNCALL_RET;
+}
+#endif//USER_DEF_VME_CAEN_V775
+
+#ifndef USER_DEF_VME_CAEN_V830
+FCNCALL_TEMPLATE
+FCNCALL_RET_TYPE FCNCALL_CLASS_NAME(VME_CAEN_V830)::FCNCALL_NAME(VME_CAEN_V830)
+{
+  FCNCALL_INIT;
+  // raw_array_zero_suppress<DATA32,DATA32,32> data;
+  {
+  FCNCALL_SUBNAME("data");
+  { FCNCALL_CALL_CTRL_WRAP(data,data.FCNCALL_CALL(data)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // union 
+  // {
+    // struct 
+    // {
+      // uint32 event_number : 16;
+      // uint32 ts : 2;
+      // uint32 count : 6;
+      // uint32 dummy_24_25 : 2;
+      // uint32 unnamed_26_26 : 1;
+      // uint32 geom : 5;
+    // } ;
+    // uint32 u32;
+  // } header;
+  {
+  FCNCALL_SUBNAME("header");
+#if !STRUCT_ONLY_LAST_UNION_MEMBER
+  // struct 
+  // {
+    // uint32 event_number : 16;
+    // uint32 ts : 2;
+    // uint32 count : 6;
+    // uint32 dummy_24_25 : 2;
+    // uint32 unnamed_26_26 : 1;
+    // uint32 geom : 5;
+  // } ;
+  // uint32 event_number : 16;
+  {
+  FCNCALL_SUBNAME("event_number");
+  { FCNCALL_CALL_CTRL_WRAP(header.event_number,FCNCALL_CALL_TYPE/*_BITFIELD*/(uint32,header.event_number)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // uint32 ts : 2;
+  {
+  FCNCALL_SUBNAME("ts");
+  { FCNCALL_CALL_CTRL_WRAP(header.ts,FCNCALL_CALL_TYPE/*_BITFIELD*/(uint32,header.ts)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // uint32 count : 6;
+  {
+  FCNCALL_SUBNAME("count");
+  { FCNCALL_CALL_CTRL_WRAP(header.count,FCNCALL_CALL_TYPE/*_BITFIELD*/(uint32,header.count)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // uint32 dummy_24_25 : 2;
+  {
+  FCNCALL_SUBNAME("dummy_24_25");
+  { FCNCALL_CALL_CTRL_WRAP(header.dummy_24_25,FCNCALL_CALL_TYPE/*_BITFIELD*/(uint32,header.dummy_24_25)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // uint32 unnamed_26_26 : 1;
+  {
+  FCNCALL_SUBNAME("unnamed_26_26");
+  { FCNCALL_CALL_CTRL_WRAP(header.unnamed_26_26,FCNCALL_CALL_TYPE/*_BITFIELD*/(uint32,header.unnamed_26_26)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // uint32 geom : 5;
+  {
+  FCNCALL_SUBNAME("geom");
+  { FCNCALL_CALL_CTRL_WRAP(header.geom,FCNCALL_CALL_TYPE/*_BITFIELD*/(uint32,header.geom)); }
+  FCNCALL_SUBNAME_END;
+  }
+#endif// !STRUCT_ONLY_LAST_UNION_MEMBER
+  // uint32 u32;
+  {
+  FCNCALL_SUBNAME("u32");
+  { FCNCALL_CALL_CTRL_WRAP(header.u32,FCNCALL_CALL_TYPE(uint32,header.u32)); }
+  FCNCALL_SUBNAME_END;
+  }
+  FCNCALL_SUBNAME_END;
+  }
+  FCNCALL_RET;
+}
+#endif//USER_DEF_VME_CAEN_V830
+
+#ifndef USER_DEF_VME_MESYTEC_MADC32
+FCNCALL_TEMPLATE
+FCNCALL_RET_TYPE FCNCALL_CLASS_NAME(VME_MESYTEC_MADC32)::FCNCALL_NAME(VME_MESYTEC_MADC32)
+{
+  FCNCALL_INIT;
+  // raw_array_zero_suppress<DATA14_OVERFLOW,DATA14_OVERFLOW,32> data;
+  {
+  FCNCALL_SUBNAME("data");
+  { FCNCALL_CALL_CTRL_WRAP(data,data.FCNCALL_CALL(data)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // union 
+  // {
+    // struct 
+    // {
+      // uint32 counter : 30;
+      // uint32 unnamed_30_31 : 2;
+    // } ;
+    // uint32 u32;
+  // } end_of_event;
+  {
+  FCNCALL_SUBNAME("end_of_event");
+#if !STRUCT_ONLY_LAST_UNION_MEMBER
+  // struct 
+  // {
+    // uint32 counter : 30;
+    // uint32 unnamed_30_31 : 2;
+  // } ;
+  // uint32 counter : 30;
+  {
+  FCNCALL_SUBNAME("counter");
+  { FCNCALL_CALL_CTRL_WRAP(end_of_event.counter,FCNCALL_CALL_TYPE/*_BITFIELD*/(uint32,end_of_event.counter)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // uint32 unnamed_30_31 : 2;
+  {
+  FCNCALL_SUBNAME("unnamed_30_31");
+  { FCNCALL_CALL_CTRL_WRAP(end_of_event.unnamed_30_31,FCNCALL_CALL_TYPE/*_BITFIELD*/(uint32,end_of_event.unnamed_30_31)); }
+  FCNCALL_SUBNAME_END;
+  }
+#endif// !STRUCT_ONLY_LAST_UNION_MEMBER
+  // uint32 u32;
+  {
+  FCNCALL_SUBNAME("u32");
+  { FCNCALL_CALL_CTRL_WRAP(end_of_event.u32,FCNCALL_CALL_TYPE(uint32,end_of_event.u32)); }
+  FCNCALL_SUBNAME_END;
+  }
+  FCNCALL_SUBNAME_END;
+  }
+  FCNCALL_RET;
+}
+#endif//USER_DEF_VME_MESYTEC_MADC32
+
+#ifndef USER_DEF_VME_MESYTEC_MDPP16
+FCNCALL_TEMPLATE
+FCNCALL_RET_TYPE FCNCALL_CLASS_NAME(VME_MESYTEC_MDPP16)::FCNCALL_NAME(VME_MESYTEC_MDPP16)
+{
+  FCNCALL_INIT;
+  // raw_array_multi_zero_suppress<DATA16_OVERFLOW,DATA16_OVERFLOW,16,20> adc;
+  {
+  FCNCALL_SUBNAME("adc");
+  { FCNCALL_CALL_CTRL_WRAP(adc,adc.FCNCALL_CALL(adc)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // raw_array_multi_zero_suppress<DATA16_OVERFLOW,DATA16_OVERFLOW,16,20> tdc;
+  {
+  FCNCALL_SUBNAME("tdc");
+  { FCNCALL_CALL_CTRL_WRAP(tdc,tdc.FCNCALL_CALL(tdc)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // raw_array_multi_zero_suppress<DATA16_OVERFLOW,DATA16_OVERFLOW,16,20> trig_tdc;
+  {
+  FCNCALL_SUBNAME("trig_tdc");
+  { FCNCALL_CALL_CTRL_WRAP(trig_tdc,trig_tdc.FCNCALL_CALL(trig_tdc)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // raw_array_multi_zero_suppress<DATA16_OVERFLOW,DATA16_OVERFLOW,16,20> adc_short;
+  {
+  FCNCALL_SUBNAME("adc_short");
+  { FCNCALL_CALL_CTRL_WRAP(adc_short,adc_short.FCNCALL_CALL(adc_short)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // union 
+  // {
+    // struct 
+    // {
+      // uint32 counter : 30;
+      // uint32 unnamed_30_31 : 2;
+    // } ;
+    // uint32 u32;
+  // } end_of_event;
+  {
+  FCNCALL_SUBNAME("end_of_event");
+#if !STRUCT_ONLY_LAST_UNION_MEMBER
+  // struct 
+  // {
+    // uint32 counter : 30;
+    // uint32 unnamed_30_31 : 2;
+  // } ;
+  // uint32 counter : 30;
+  {
+  FCNCALL_SUBNAME("counter");
+  { FCNCALL_CALL_CTRL_WRAP(end_of_event.counter,FCNCALL_CALL_TYPE/*_BITFIELD*/(uint32,end_of_event.counter)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // uint32 unnamed_30_31 : 2;
+  {
+  FCNCALL_SUBNAME("unnamed_30_31");
+  { FCNCALL_CALL_CTRL_WRAP(end_of_event.unnamed_30_31,FCNCALL_CALL_TYPE/*_BITFIELD*/(uint32,end_of_event.unnamed_30_31)); }
+  FCNCALL_SUBNAME_END;
+  }
+#endif// !STRUCT_ONLY_LAST_UNION_MEMBER
+  // uint32 u32;
+  {
+  FCNCALL_SUBNAME("u32");
+  { FCNCALL_CALL_CTRL_WRAP(end_of_event.u32,FCNCALL_CALL_TYPE(uint32,end_of_event.u32)); }
+  FCNCALL_SUBNAME_END;
+  }
+  FCNCALL_SUBNAME_END;
+  }
+  FCNCALL_RET;
+}
+#endif//USER_DEF_VME_MESYTEC_MDPP16
+
+#ifndef USER_DEF_WR_STAMP
+FCNCALL_TEMPLATE
+FCNCALL_RET_TYPE FCNCALL_CLASS_NAME(WR_STAMP)::FCNCALL_NAME(WR_STAMP)
+{
+  FCNCALL_INIT;
+  // DATA16 srcid;
+  {
+  FCNCALL_SUBNAME("srcid");
+  { FCNCALL_CALL_CTRL_WRAP(srcid,srcid.FCNCALL_CALL(srcid)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // DATA16 err;
+  {
+  FCNCALL_SUBNAME("err");
+  { FCNCALL_CALL_CTRL_WRAP(err,err.FCNCALL_CALL(err)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // DATA16 t1;
+  {
+  FCNCALL_SUBNAME("t1");
+  { FCNCALL_CALL_CTRL_WRAP(t1,t1.FCNCALL_CALL(t1)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // DATA16 t2;
+  {
+  FCNCALL_SUBNAME("t2");
+  { FCNCALL_CALL_CTRL_WRAP(t2,t2.FCNCALL_CALL(t2)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // DATA16 t3;
+  {
+  FCNCALL_SUBNAME("t3");
+  { FCNCALL_CALL_CTRL_WRAP(t3,t3.FCNCALL_CALL(t3)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // DATA16 t4;
+  {
+  FCNCALL_SUBNAME("t4");
+  { FCNCALL_CALL_CTRL_WRAP(t4,t4.FCNCALL_CALL(t4)); }
+  FCNCALL_SUBNAME_END;
+  }
+  FCNCALL_RET;
+}
+#endif//USER_DEF_WR_STAMP
+
+#ifndef USER_DEF_XTST_STD_VME
+FCNCALL_TEMPLATE
+FCNCALL_RET_TYPE FCNCALL_CLASS_NAME(XTST_STD_VME)::FCNCALL_NAME(XTST_STD_VME)
+{
+  FCNCALL_INIT;
+  // union 
+  // {
+    // struct 
+    // {
+      // uint32 fail_general : 1;
+      // uint32 fail_data_corrupt : 1;
+      // uint32 fail_data_missing : 1;
+      // uint32 fail_data_too_much : 1;
+      // uint32 fail_event_counter_mismatch : 1;
+      // uint32 fail_readout_error_driver : 1;
+      // uint32 fail_unexpected_trigger : 1;
+      // uint32 dummy_7_26 : 20;
+      // uint32 has_no_zero_suppression : 1;
+      // uint32 has_multi_adctdc_counter0 : 1;
+      // uint32 has_multi_scaler_counter0 : 1;
+      // uint32 has_multi_event : 1;
+      // uint32 has_time_stamp : 1;
+    // } ;
+    // uint32 u32;
+  // } failure;
+  {
+  FCNCALL_SUBNAME("failure");
+#if !STRUCT_ONLY_LAST_UNION_MEMBER
+  // struct 
+  // {
+    // uint32 fail_general : 1;
+    // uint32 fail_data_corrupt : 1;
+    // uint32 fail_data_missing : 1;
+    // uint32 fail_data_too_much : 1;
+    // uint32 fail_event_counter_mismatch : 1;
+    // uint32 fail_readout_error_driver : 1;
+    // uint32 fail_unexpected_trigger : 1;
+    // uint32 dummy_7_26 : 20;
+    // uint32 has_no_zero_suppression : 1;
+    // uint32 has_multi_adctdc_counter0 : 1;
+    // uint32 has_multi_scaler_counter0 : 1;
+    // uint32 has_multi_event : 1;
+    // uint32 has_time_stamp : 1;
+  // } ;
+  // uint32 fail_general : 1;
+  {
+  FCNCALL_SUBNAME("fail_general");
+  { FCNCALL_CALL_CTRL_WRAP(failure.fail_general,FCNCALL_CALL_TYPE/*_BITFIELD*/(uint32,failure.fail_general)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // uint32 fail_data_corrupt : 1;
+  {
+  FCNCALL_SUBNAME("fail_data_corrupt");
+  { FCNCALL_CALL_CTRL_WRAP(failure.fail_data_corrupt,FCNCALL_CALL_TYPE/*_BITFIELD*/(uint32,failure.fail_data_corrupt)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // uint32 fail_data_missing : 1;
+  {
+  FCNCALL_SUBNAME("fail_data_missing");
+  { FCNCALL_CALL_CTRL_WRAP(failure.fail_data_missing,FCNCALL_CALL_TYPE/*_BITFIELD*/(uint32,failure.fail_data_missing)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // uint32 fail_data_too_much : 1;
+  {
+  FCNCALL_SUBNAME("fail_data_too_much");
+  { FCNCALL_CALL_CTRL_WRAP(failure.fail_data_too_much,FCNCALL_CALL_TYPE/*_BITFIELD*/(uint32,failure.fail_data_too_much)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // uint32 fail_event_counter_mismatch : 1;
+  {
+  FCNCALL_SUBNAME("fail_event_counter_mismatch");
+  { FCNCALL_CALL_CTRL_WRAP(failure.fail_event_counter_mismatch,FCNCALL_CALL_TYPE/*_BITFIELD*/(uint32,failure.fail_event_counter_mismatch)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // uint32 fail_readout_error_driver : 1;
+  {
+  FCNCALL_SUBNAME("fail_readout_error_driver");
+  { FCNCALL_CALL_CTRL_WRAP(failure.fail_readout_error_driver,FCNCALL_CALL_TYPE/*_BITFIELD*/(uint32,failure.fail_readout_error_driver)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // uint32 fail_unexpected_trigger : 1;
+  {
+  FCNCALL_SUBNAME("fail_unexpected_trigger");
+  { FCNCALL_CALL_CTRL_WRAP(failure.fail_unexpected_trigger,FCNCALL_CALL_TYPE/*_BITFIELD*/(uint32,failure.fail_unexpected_trigger)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // uint32 dummy_7_26 : 20;
+  {
+  FCNCALL_SUBNAME("dummy_7_26");
+  { FCNCALL_CALL_CTRL_WRAP(failure.dummy_7_26,FCNCALL_CALL_TYPE/*_BITFIELD*/(uint32,failure.dummy_7_26)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // uint32 has_no_zero_suppression : 1;
+  {
+  FCNCALL_SUBNAME("has_no_zero_suppression");
+  { FCNCALL_CALL_CTRL_WRAP(failure.has_no_zero_suppression,FCNCALL_CALL_TYPE/*_BITFIELD*/(uint32,failure.has_no_zero_suppression)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // uint32 has_multi_adctdc_counter0 : 1;
+  {
+  FCNCALL_SUBNAME("has_multi_adctdc_counter0");
+  { FCNCALL_CALL_CTRL_WRAP(failure.has_multi_adctdc_counter0,FCNCALL_CALL_TYPE/*_BITFIELD*/(uint32,failure.has_multi_adctdc_counter0)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // uint32 has_multi_scaler_counter0 : 1;
+  {
+  FCNCALL_SUBNAME("has_multi_scaler_counter0");
+  { FCNCALL_CALL_CTRL_WRAP(failure.has_multi_scaler_counter0,FCNCALL_CALL_TYPE/*_BITFIELD*/(uint32,failure.has_multi_scaler_counter0)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // uint32 has_multi_event : 1;
+  {
+  FCNCALL_SUBNAME("has_multi_event");
+  { FCNCALL_CALL_CTRL_WRAP(failure.has_multi_event,FCNCALL_CALL_TYPE/*_BITFIELD*/(uint32,failure.has_multi_event)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // uint32 has_time_stamp : 1;
+  {
+  FCNCALL_SUBNAME("has_time_stamp");
+  { FCNCALL_CALL_CTRL_WRAP(failure.has_time_stamp,FCNCALL_CALL_TYPE/*_BITFIELD*/(uint32,failure.has_time_stamp)); }
+  FCNCALL_SUBNAME_END;
+  }
+#endif// !STRUCT_ONLY_LAST_UNION_MEMBER
+  // uint32 u32;
+  {
+  FCNCALL_SUBNAME("u32");
+  { FCNCALL_CALL_CTRL_WRAP(failure.u32,FCNCALL_CALL_TYPE(uint32,failure.u32)); }
+  FCNCALL_SUBNAME_END;
+  }
+  FCNCALL_SUBNAME_END;
+  }
+  // uint32 time_stamp;
+  {
+  FCNCALL_SUBNAME("time_stamp");
+  { FCNCALL_CALL_CTRL_WRAP(time_stamp,FCNCALL_CALL_TYPE(uint32,time_stamp)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // uint32 multi_events;
+  {
+  FCNCALL_SUBNAME("multi_events");
+  { FCNCALL_CALL_CTRL_WRAP(multi_events,FCNCALL_CALL_TYPE(uint32,multi_events)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // uint32 multi_scaler_counter0;
+  {
+  FCNCALL_SUBNAME("multi_scaler_counter0");
+  { FCNCALL_CALL_CTRL_WRAP(multi_scaler_counter0,FCNCALL_CALL_TYPE(uint32,multi_scaler_counter0)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // uint32 multi_adctdc_counter0;
+  {
+  FCNCALL_SUBNAME("multi_adctdc_counter0");
+  { FCNCALL_CALL_CTRL_WRAP(multi_adctdc_counter0,FCNCALL_CALL_TYPE(uint32,multi_adctdc_counter0)); }
+  FCNCALL_SUBNAME_END;
+  }
+  FCNCALL_RET;
+}
+#endif//USER_DEF_XTST_STD_VME
+
+#ifndef USER_DEF_XTST_SUBEVENT_MEMBER_DATA12
+FCNCALL_TEMPLATE
+FCNCALL_RET_TYPE FCNCALL_CLASS_NAME(XTST_SUBEVENT_MEMBER_DATA12)::FCNCALL_NAME(XTST_SUBEVENT_MEMBER_DATA12)
+{
+  FCNCALL_INIT;
+  // DATA12 mDATA12;
+  {
+  FCNCALL_SUBNAME("mDATA12");
+  { FCNCALL_CALL_CTRL_WRAP(mDATA12,mDATA12.FCNCALL_CALL(mDATA12)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // raw_array<DATA12,DATA12,8> mDATA12_array;
+  {
+  FCNCALL_SUBNAME("mDATA12_array");
+  { FCNCALL_CALL_CTRL_WRAP(mDATA12_array,mDATA12_array.FCNCALL_CALL(mDATA12_array)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // raw_array_zero_suppress<DATA12,DATA12,8> mDATA12_array_zzp;
+  {
+  FCNCALL_SUBNAME("mDATA12_array_zzp");
+  { FCNCALL_CALL_CTRL_WRAP(mDATA12_array_zzp,mDATA12_array_zzp.FCNCALL_CALL(mDATA12_array_zzp)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // raw_list_zero_suppress<DATA12,DATA12,8> mDATA12_array_zzpii;
+  {
+  FCNCALL_SUBNAME("mDATA12_array_zzpii");
+  { FCNCALL_CALL_CTRL_WRAP(mDATA12_array_zzpii,mDATA12_array_zzpii.FCNCALL_CALL(mDATA12_array_zzpii)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // raw_array_multi_zero_suppress<DATA12,DATA12,8,4> mDATA12_array_zzpml;
+  {
+  FCNCALL_SUBNAME("mDATA12_array_zzpml");
+  { FCNCALL_CALL_CTRL_WRAP(mDATA12_array_zzpml,mDATA12_array_zzpml.FCNCALL_CALL(mDATA12_array_zzpml)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // raw_array<DATA12,DATA12,8> mDATA12_array2[2];
+  {
+  FCNCALL_SUBNAME("mDATA12_array2");
+  FCNCALL_FOR(__i0,2)
+  {
+    FCNCALL_SUBINDEX(__i0);
+    { FCNCALL_CALL_CTRL_WRAP_ARRAY(mDATA12_array2__i0,,__i0,mDATA12_array2[__i0].FCNCALL_CALL(mDATA12_array2[__i0])); }
+    FCNCALL_SUBINDEX_END(__i0);
+  }
+  FCNCALL_SUBNAME_END;
+  }
+  // raw_array_zero_suppress<DATA12,DATA12,8> mDATA12_array2_zzp[2];
+  {
+  FCNCALL_SUBNAME("mDATA12_array2_zzp");
+  FCNCALL_FOR(__i0,2)
+  {
+    FCNCALL_SUBINDEX(__i0);
+    { FCNCALL_CALL_CTRL_WRAP_ARRAY(mDATA12_array2_zzp__i0,,__i0,mDATA12_array2_zzp[__i0].FCNCALL_CALL(mDATA12_array2_zzp[__i0])); }
+    FCNCALL_SUBINDEX_END(__i0);
+  }
+  FCNCALL_SUBNAME_END;
+  }
+  // raw_list_zero_suppress<DATA12,DATA12,8> mDATA12_array2_zzpii[2];
+  {
+  FCNCALL_SUBNAME("mDATA12_array2_zzpii");
+  FCNCALL_FOR(__i0,2)
+  {
+    FCNCALL_SUBINDEX(__i0);
+    { FCNCALL_CALL_CTRL_WRAP_ARRAY(mDATA12_array2_zzpii__i0,,__i0,mDATA12_array2_zzpii[__i0].FCNCALL_CALL(mDATA12_array2_zzpii[__i0])); }
+    FCNCALL_SUBINDEX_END(__i0);
+  }
+  FCNCALL_SUBNAME_END;
+  }
+  // raw_array_multi_zero_suppress<DATA12,DATA12,8,4> mDATA12_array2_zzpml[2];
+  {
+  FCNCALL_SUBNAME("mDATA12_array2_zzpml");
+  FCNCALL_FOR(__i0,2)
+  {
+    FCNCALL_SUBINDEX(__i0);
+    { FCNCALL_CALL_CTRL_WRAP_ARRAY(mDATA12_array2_zzpml__i0,,__i0,mDATA12_array2_zzpml[__i0].FCNCALL_CALL(mDATA12_array2_zzpml[__i0])); }
+    FCNCALL_SUBINDEX_END(__i0);
+  }
+  FCNCALL_SUBNAME_END;
+  }
+  FCNCALL_RET;
+}
+#endif//USER_DEF_XTST_SUBEVENT_MEMBER_DATA12
+
+#ifndef USER_DEF_XTST_SUBEVENT_MEMBER_DATA12_OVERFLOW
+FCNCALL_TEMPLATE
+FCNCALL_RET_TYPE FCNCALL_CLASS_NAME(XTST_SUBEVENT_MEMBER_DATA12_OVERFLOW)::FCNCALL_NAME(XTST_SUBEVENT_MEMBER_DATA12_OVERFLOW)
+{
+  FCNCALL_INIT;
+  // DATA12_OVERFLOW mDATA12_OVERFLOW;
+  {
+  FCNCALL_SUBNAME("mDATA12_OVERFLOW");
+  { FCNCALL_CALL_CTRL_WRAP(mDATA12_OVERFLOW,mDATA12_OVERFLOW.FCNCALL_CALL(mDATA12_OVERFLOW)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // raw_array<DATA12_OVERFLOW,DATA12_OVERFLOW,8> mDATA12_OVERFLOW_array;
+  {
+  FCNCALL_SUBNAME("mDATA12_OVERFLOW_array");
+  { FCNCALL_CALL_CTRL_WRAP(mDATA12_OVERFLOW_array,mDATA12_OVERFLOW_array.FCNCALL_CALL(mDATA12_OVERFLOW_array)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // raw_array_zero_suppress<DATA12_OVERFLOW,DATA12_OVERFLOW,8> mDATA12_OVERFLOW_array_zzp;
+  {
+  FCNCALL_SUBNAME("mDATA12_OVERFLOW_array_zzp");
+  { FCNCALL_CALL_CTRL_WRAP(mDATA12_OVERFLOW_array_zzp,mDATA12_OVERFLOW_array_zzp.FCNCALL_CALL(mDATA12_OVERFLOW_array_zzp)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // raw_list_zero_suppress<DATA12_OVERFLOW,DATA12_OVERFLOW,8> mDATA12_OVERFLOW_array_zzpii;
+  {
+  FCNCALL_SUBNAME("mDATA12_OVERFLOW_array_zzpii");
+  { FCNCALL_CALL_CTRL_WRAP(mDATA12_OVERFLOW_array_zzpii,mDATA12_OVERFLOW_array_zzpii.FCNCALL_CALL(mDATA12_OVERFLOW_array_zzpii)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // raw_array_multi_zero_suppress<DATA12_OVERFLOW,DATA12_OVERFLOW,8,4> mDATA12_OVERFLOW_array_zzpml;
+  {
+  FCNCALL_SUBNAME("mDATA12_OVERFLOW_array_zzpml");
+  { FCNCALL_CALL_CTRL_WRAP(mDATA12_OVERFLOW_array_zzpml,mDATA12_OVERFLOW_array_zzpml.FCNCALL_CALL(mDATA12_OVERFLOW_array_zzpml)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // raw_array<DATA12_OVERFLOW,DATA12_OVERFLOW,8> mDATA12_OVERFLOW_array2[2];
+  {
+  FCNCALL_SUBNAME("mDATA12_OVERFLOW_array2");
+  FCNCALL_FOR(__i0,2)
+  {
+    FCNCALL_SUBINDEX(__i0);
+    { FCNCALL_CALL_CTRL_WRAP_ARRAY(mDATA12_OVERFLOW_array2__i0,,__i0,mDATA12_OVERFLOW_array2[__i0].FCNCALL_CALL(mDATA12_OVERFLOW_array2[__i0])); }
+    FCNCALL_SUBINDEX_END(__i0);
+  }
+  FCNCALL_SUBNAME_END;
+  }
+  // raw_array_zero_suppress<DATA12_OVERFLOW,DATA12_OVERFLOW,8> mDATA12_OVERFLOW_array2_zzp[2];
+  {
+  FCNCALL_SUBNAME("mDATA12_OVERFLOW_array2_zzp");
+  FCNCALL_FOR(__i0,2)
+  {
+    FCNCALL_SUBINDEX(__i0);
+    { FCNCALL_CALL_CTRL_WRAP_ARRAY(mDATA12_OVERFLOW_array2_zzp__i0,,__i0,mDATA12_OVERFLOW_array2_zzp[__i0].FCNCALL_CALL(mDATA12_OVERFLOW_array2_zzp[__i0])); }
+    FCNCALL_SUBINDEX_END(__i0);
+  }
+  FCNCALL_SUBNAME_END;
+  }
+  // raw_list_zero_suppress<DATA12_OVERFLOW,DATA12_OVERFLOW,8> mDATA12_OVERFLOW_array2_zzpii[2];
+  {
+  FCNCALL_SUBNAME("mDATA12_OVERFLOW_array2_zzpii");
+  FCNCALL_FOR(__i0,2)
+  {
+    FCNCALL_SUBINDEX(__i0);
+    { FCNCALL_CALL_CTRL_WRAP_ARRAY(mDATA12_OVERFLOW_array2_zzpii__i0,,__i0,mDATA12_OVERFLOW_array2_zzpii[__i0].FCNCALL_CALL(mDATA12_OVERFLOW_array2_zzpii[__i0])); }
+    FCNCALL_SUBINDEX_END(__i0);
+  }
+  FCNCALL_SUBNAME_END;
+  }
+  // raw_array_multi_zero_suppress<DATA12_OVERFLOW,DATA12_OVERFLOW,8,4> mDATA12_OVERFLOW_array2_zzpml[2];
+  {
+  FCNCALL_SUBNAME("mDATA12_OVERFLOW_array2_zzpml");
+  FCNCALL_FOR(__i0,2)
+  {
+    FCNCALL_SUBINDEX(__i0);
+    { FCNCALL_CALL_CTRL_WRAP_ARRAY(mDATA12_OVERFLOW_array2_zzpml__i0,,__i0,mDATA12_OVERFLOW_array2_zzpml[__i0].FCNCALL_CALL(mDATA12_OVERFLOW_array2_zzpml[__i0])); }
+    FCNCALL_SUBINDEX_END(__i0);
+  }
+  FCNCALL_SUBNAME_END;
+  }
+  FCNCALL_RET;
+}
+#endif//USER_DEF_XTST_SUBEVENT_MEMBER_DATA12_OVERFLOW
+
+#ifndef USER_DEF_XTST_SUBEVENT_MEMBER_DATA12_RANGE
+FCNCALL_TEMPLATE
+FCNCALL_RET_TYPE FCNCALL_CLASS_NAME(XTST_SUBEVENT_MEMBER_DATA12_RANGE)::FCNCALL_NAME(XTST_SUBEVENT_MEMBER_DATA12_RANGE)
+{
+  FCNCALL_INIT;
+  // DATA12_RANGE mDATA12_RANGE;
+  {
+  FCNCALL_SUBNAME("mDATA12_RANGE");
+  { FCNCALL_CALL_CTRL_WRAP(mDATA12_RANGE,mDATA12_RANGE.FCNCALL_CALL(mDATA12_RANGE)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // raw_array<DATA12_RANGE,DATA12_RANGE,8> mDATA12_RANGE_array;
+  {
+  FCNCALL_SUBNAME("mDATA12_RANGE_array");
+  { FCNCALL_CALL_CTRL_WRAP(mDATA12_RANGE_array,mDATA12_RANGE_array.FCNCALL_CALL(mDATA12_RANGE_array)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // raw_array_zero_suppress<DATA12_RANGE,DATA12_RANGE,8> mDATA12_RANGE_array_zzp;
+  {
+  FCNCALL_SUBNAME("mDATA12_RANGE_array_zzp");
+  { FCNCALL_CALL_CTRL_WRAP(mDATA12_RANGE_array_zzp,mDATA12_RANGE_array_zzp.FCNCALL_CALL(mDATA12_RANGE_array_zzp)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // raw_list_zero_suppress<DATA12_RANGE,DATA12_RANGE,8> mDATA12_RANGE_array_zzpii;
+  {
+  FCNCALL_SUBNAME("mDATA12_RANGE_array_zzpii");
+  { FCNCALL_CALL_CTRL_WRAP(mDATA12_RANGE_array_zzpii,mDATA12_RANGE_array_zzpii.FCNCALL_CALL(mDATA12_RANGE_array_zzpii)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // raw_array_multi_zero_suppress<DATA12_RANGE,DATA12_RANGE,8,4> mDATA12_RANGE_array_zzpml;
+  {
+  FCNCALL_SUBNAME("mDATA12_RANGE_array_zzpml");
+  { FCNCALL_CALL_CTRL_WRAP(mDATA12_RANGE_array_zzpml,mDATA12_RANGE_array_zzpml.FCNCALL_CALL(mDATA12_RANGE_array_zzpml)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // raw_array<DATA12_RANGE,DATA12_RANGE,8> mDATA12_RANGE_array2[2];
+  {
+  FCNCALL_SUBNAME("mDATA12_RANGE_array2");
+  FCNCALL_FOR(__i0,2)
+  {
+    FCNCALL_SUBINDEX(__i0);
+    { FCNCALL_CALL_CTRL_WRAP_ARRAY(mDATA12_RANGE_array2__i0,,__i0,mDATA12_RANGE_array2[__i0].FCNCALL_CALL(mDATA12_RANGE_array2[__i0])); }
+    FCNCALL_SUBINDEX_END(__i0);
+  }
+  FCNCALL_SUBNAME_END;
+  }
+  // raw_array_zero_suppress<DATA12_RANGE,DATA12_RANGE,8> mDATA12_RANGE_array2_zzp[2];
+  {
+  FCNCALL_SUBNAME("mDATA12_RANGE_array2_zzp");
+  FCNCALL_FOR(__i0,2)
+  {
+    FCNCALL_SUBINDEX(__i0);
+    { FCNCALL_CALL_CTRL_WRAP_ARRAY(mDATA12_RANGE_array2_zzp__i0,,__i0,mDATA12_RANGE_array2_zzp[__i0].FCNCALL_CALL(mDATA12_RANGE_array2_zzp[__i0])); }
+    FCNCALL_SUBINDEX_END(__i0);
+  }
+  FCNCALL_SUBNAME_END;
+  }
+  // raw_list_zero_suppress<DATA12_RANGE,DATA12_RANGE,8> mDATA12_RANGE_array2_zzpii[2];
+  {
+  FCNCALL_SUBNAME("mDATA12_RANGE_array2_zzpii");
+  FCNCALL_FOR(__i0,2)
+  {
+    FCNCALL_SUBINDEX(__i0);
+    { FCNCALL_CALL_CTRL_WRAP_ARRAY(mDATA12_RANGE_array2_zzpii__i0,,__i0,mDATA12_RANGE_array2_zzpii[__i0].FCNCALL_CALL(mDATA12_RANGE_array2_zzpii[__i0])); }
+    FCNCALL_SUBINDEX_END(__i0);
+  }
+  FCNCALL_SUBNAME_END;
+  }
+  // raw_array_multi_zero_suppress<DATA12_RANGE,DATA12_RANGE,8,4> mDATA12_RANGE_array2_zzpml[2];
+  {
+  FCNCALL_SUBNAME("mDATA12_RANGE_array2_zzpml");
+  FCNCALL_FOR(__i0,2)
+  {
+    FCNCALL_SUBINDEX(__i0);
+    { FCNCALL_CALL_CTRL_WRAP_ARRAY(mDATA12_RANGE_array2_zzpml__i0,,__i0,mDATA12_RANGE_array2_zzpml[__i0].FCNCALL_CALL(mDATA12_RANGE_array2_zzpml[__i0])); }
+    FCNCALL_SUBINDEX_END(__i0);
+  }
+  FCNCALL_SUBNAME_END;
+  }
+  FCNCALL_RET;
+}
+#endif//USER_DEF_XTST_SUBEVENT_MEMBER_DATA12_RANGE
+
+#ifndef USER_DEF_XTST_SUBEVENT_MEMBER_DATA16
+FCNCALL_TEMPLATE
+FCNCALL_RET_TYPE FCNCALL_CLASS_NAME(XTST_SUBEVENT_MEMBER_DATA16)::FCNCALL_NAME(XTST_SUBEVENT_MEMBER_DATA16)
+{
+  FCNCALL_INIT;
+  // DATA16 mDATA16;
+  {
+  FCNCALL_SUBNAME("mDATA16");
+  { FCNCALL_CALL_CTRL_WRAP(mDATA16,mDATA16.FCNCALL_CALL(mDATA16)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // raw_array<DATA16,DATA16,8> mDATA16_array;
+  {
+  FCNCALL_SUBNAME("mDATA16_array");
+  { FCNCALL_CALL_CTRL_WRAP(mDATA16_array,mDATA16_array.FCNCALL_CALL(mDATA16_array)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // raw_array_zero_suppress<DATA16,DATA16,8> mDATA16_array_zzp;
+  {
+  FCNCALL_SUBNAME("mDATA16_array_zzp");
+  { FCNCALL_CALL_CTRL_WRAP(mDATA16_array_zzp,mDATA16_array_zzp.FCNCALL_CALL(mDATA16_array_zzp)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // raw_list_zero_suppress<DATA16,DATA16,8> mDATA16_array_zzpii;
+  {
+  FCNCALL_SUBNAME("mDATA16_array_zzpii");
+  { FCNCALL_CALL_CTRL_WRAP(mDATA16_array_zzpii,mDATA16_array_zzpii.FCNCALL_CALL(mDATA16_array_zzpii)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // raw_array_multi_zero_suppress<DATA16,DATA16,8,4> mDATA16_array_zzpml;
+  {
+  FCNCALL_SUBNAME("mDATA16_array_zzpml");
+  { FCNCALL_CALL_CTRL_WRAP(mDATA16_array_zzpml,mDATA16_array_zzpml.FCNCALL_CALL(mDATA16_array_zzpml)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // raw_array<DATA16,DATA16,8> mDATA16_array2[2];
+  {
+  FCNCALL_SUBNAME("mDATA16_array2");
+  FCNCALL_FOR(__i0,2)
+  {
+    FCNCALL_SUBINDEX(__i0);
+    { FCNCALL_CALL_CTRL_WRAP_ARRAY(mDATA16_array2__i0,,__i0,mDATA16_array2[__i0].FCNCALL_CALL(mDATA16_array2[__i0])); }
+    FCNCALL_SUBINDEX_END(__i0);
+  }
+  FCNCALL_SUBNAME_END;
+  }
+  // raw_array_zero_suppress<DATA16,DATA16,8> mDATA16_array2_zzp[2];
+  {
+  FCNCALL_SUBNAME("mDATA16_array2_zzp");
+  FCNCALL_FOR(__i0,2)
+  {
+    FCNCALL_SUBINDEX(__i0);
+    { FCNCALL_CALL_CTRL_WRAP_ARRAY(mDATA16_array2_zzp__i0,,__i0,mDATA16_array2_zzp[__i0].FCNCALL_CALL(mDATA16_array2_zzp[__i0])); }
+    FCNCALL_SUBINDEX_END(__i0);
+  }
+  FCNCALL_SUBNAME_END;
+  }
+  // raw_list_zero_suppress<DATA16,DATA16,8> mDATA16_array2_zzpii[2];
+  {
+  FCNCALL_SUBNAME("mDATA16_array2_zzpii");
+  FCNCALL_FOR(__i0,2)
+  {
+    FCNCALL_SUBINDEX(__i0);
+    { FCNCALL_CALL_CTRL_WRAP_ARRAY(mDATA16_array2_zzpii__i0,,__i0,mDATA16_array2_zzpii[__i0].FCNCALL_CALL(mDATA16_array2_zzpii[__i0])); }
+    FCNCALL_SUBINDEX_END(__i0);
+  }
+  FCNCALL_SUBNAME_END;
+  }
+  // raw_array_multi_zero_suppress<DATA16,DATA16,8,4> mDATA16_array2_zzpml[2];
+  {
+  FCNCALL_SUBNAME("mDATA16_array2_zzpml");
+  FCNCALL_FOR(__i0,2)
+  {
+    FCNCALL_SUBINDEX(__i0);
+    { FCNCALL_CALL_CTRL_WRAP_ARRAY(mDATA16_array2_zzpml__i0,,__i0,mDATA16_array2_zzpml[__i0].FCNCALL_CALL(mDATA16_array2_zzpml[__i0])); }
+    FCNCALL_SUBINDEX_END(__i0);
+  }
+  FCNCALL_SUBNAME_END;
+  }
+  FCNCALL_RET;
+}
+#endif//USER_DEF_XTST_SUBEVENT_MEMBER_DATA16
+
+#ifndef USER_DEF_XTST_SUBEVENT_MEMBER_DATA16_OVERFLOW
+FCNCALL_TEMPLATE
+FCNCALL_RET_TYPE FCNCALL_CLASS_NAME(XTST_SUBEVENT_MEMBER_DATA16_OVERFLOW)::FCNCALL_NAME(XTST_SUBEVENT_MEMBER_DATA16_OVERFLOW)
+{
+  FCNCALL_INIT;
+  // DATA16_OVERFLOW mDATA16_OVERFLOW;
+  {
+  FCNCALL_SUBNAME("mDATA16_OVERFLOW");
+  { FCNCALL_CALL_CTRL_WRAP(mDATA16_OVERFLOW,mDATA16_OVERFLOW.FCNCALL_CALL(mDATA16_OVERFLOW)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // raw_array<DATA16_OVERFLOW,DATA16_OVERFLOW,8> mDATA16_OVERFLOW_array;
+  {
+  FCNCALL_SUBNAME("mDATA16_OVERFLOW_array");
+  { FCNCALL_CALL_CTRL_WRAP(mDATA16_OVERFLOW_array,mDATA16_OVERFLOW_array.FCNCALL_CALL(mDATA16_OVERFLOW_array)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // raw_array_zero_suppress<DATA16_OVERFLOW,DATA16_OVERFLOW,8> mDATA16_OVERFLOW_array_zzp;
+  {
+  FCNCALL_SUBNAME("mDATA16_OVERFLOW_array_zzp");
+  { FCNCALL_CALL_CTRL_WRAP(mDATA16_OVERFLOW_array_zzp,mDATA16_OVERFLOW_array_zzp.FCNCALL_CALL(mDATA16_OVERFLOW_array_zzp)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // raw_list_zero_suppress<DATA16_OVERFLOW,DATA16_OVERFLOW,8> mDATA16_OVERFLOW_array_zzpii;
+  {
+  FCNCALL_SUBNAME("mDATA16_OVERFLOW_array_zzpii");
+  { FCNCALL_CALL_CTRL_WRAP(mDATA16_OVERFLOW_array_zzpii,mDATA16_OVERFLOW_array_zzpii.FCNCALL_CALL(mDATA16_OVERFLOW_array_zzpii)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // raw_array_multi_zero_suppress<DATA16_OVERFLOW,DATA16_OVERFLOW,8,4> mDATA16_OVERFLOW_array_zzpml;
+  {
+  FCNCALL_SUBNAME("mDATA16_OVERFLOW_array_zzpml");
+  { FCNCALL_CALL_CTRL_WRAP(mDATA16_OVERFLOW_array_zzpml,mDATA16_OVERFLOW_array_zzpml.FCNCALL_CALL(mDATA16_OVERFLOW_array_zzpml)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // raw_array<DATA16_OVERFLOW,DATA16_OVERFLOW,8> mDATA16_OVERFLOW_array2[2];
+  {
+  FCNCALL_SUBNAME("mDATA16_OVERFLOW_array2");
+  FCNCALL_FOR(__i0,2)
+  {
+    FCNCALL_SUBINDEX(__i0);
+    { FCNCALL_CALL_CTRL_WRAP_ARRAY(mDATA16_OVERFLOW_array2__i0,,__i0,mDATA16_OVERFLOW_array2[__i0].FCNCALL_CALL(mDATA16_OVERFLOW_array2[__i0])); }
+    FCNCALL_SUBINDEX_END(__i0);
+  }
+  FCNCALL_SUBNAME_END;
+  }
+  // raw_array_zero_suppress<DATA16_OVERFLOW,DATA16_OVERFLOW,8> mDATA16_OVERFLOW_array2_zzp[2];
+  {
+  FCNCALL_SUBNAME("mDATA16_OVERFLOW_array2_zzp");
+  FCNCALL_FOR(__i0,2)
+  {
+    FCNCALL_SUBINDEX(__i0);
+    { FCNCALL_CALL_CTRL_WRAP_ARRAY(mDATA16_OVERFLOW_array2_zzp__i0,,__i0,mDATA16_OVERFLOW_array2_zzp[__i0].FCNCALL_CALL(mDATA16_OVERFLOW_array2_zzp[__i0])); }
+    FCNCALL_SUBINDEX_END(__i0);
+  }
+  FCNCALL_SUBNAME_END;
+  }
+  // raw_list_zero_suppress<DATA16_OVERFLOW,DATA16_OVERFLOW,8> mDATA16_OVERFLOW_array2_zzpii[2];
+  {
+  FCNCALL_SUBNAME("mDATA16_OVERFLOW_array2_zzpii");
+  FCNCALL_FOR(__i0,2)
+  {
+    FCNCALL_SUBINDEX(__i0);
+    { FCNCALL_CALL_CTRL_WRAP_ARRAY(mDATA16_OVERFLOW_array2_zzpii__i0,,__i0,mDATA16_OVERFLOW_array2_zzpii[__i0].FCNCALL_CALL(mDATA16_OVERFLOW_array2_zzpii[__i0])); }
+    FCNCALL_SUBINDEX_END(__i0);
+  }
+  FCNCALL_SUBNAME_END;
+  }
+  // raw_array_multi_zero_suppress<DATA16_OVERFLOW,DATA16_OVERFLOW,8,4> mDATA16_OVERFLOW_array2_zzpml[2];
+  {
+  FCNCALL_SUBNAME("mDATA16_OVERFLOW_array2_zzpml");
+  FCNCALL_FOR(__i0,2)
+  {
+    FCNCALL_SUBINDEX(__i0);
+    { FCNCALL_CALL_CTRL_WRAP_ARRAY(mDATA16_OVERFLOW_array2_zzpml__i0,,__i0,mDATA16_OVERFLOW_array2_zzpml[__i0].FCNCALL_CALL(mDATA16_OVERFLOW_array2_zzpml[__i0])); }
+    FCNCALL_SUBINDEX_END(__i0);
+  }
+  FCNCALL_SUBNAME_END;
+  }
+  FCNCALL_RET;
+}
+#endif//USER_DEF_XTST_SUBEVENT_MEMBER_DATA16_OVERFLOW
+
+#ifndef USER_DEF_XTST_SUBEVENT_MEMBER_DATA24
+FCNCALL_TEMPLATE
+FCNCALL_RET_TYPE FCNCALL_CLASS_NAME(XTST_SUBEVENT_MEMBER_DATA24)::FCNCALL_NAME(XTST_SUBEVENT_MEMBER_DATA24)
+{
+  FCNCALL_INIT;
+  // DATA24 mDATA24;
+  {
+  FCNCALL_SUBNAME("mDATA24");
+  { FCNCALL_CALL_CTRL_WRAP(mDATA24,mDATA24.FCNCALL_CALL(mDATA24)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // raw_array<DATA24,DATA24,8> mDATA24_array;
+  {
+  FCNCALL_SUBNAME("mDATA24_array");
+  { FCNCALL_CALL_CTRL_WRAP(mDATA24_array,mDATA24_array.FCNCALL_CALL(mDATA24_array)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // raw_array_zero_suppress<DATA24,DATA24,8> mDATA24_array_zzp;
+  {
+  FCNCALL_SUBNAME("mDATA24_array_zzp");
+  { FCNCALL_CALL_CTRL_WRAP(mDATA24_array_zzp,mDATA24_array_zzp.FCNCALL_CALL(mDATA24_array_zzp)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // raw_list_zero_suppress<DATA24,DATA24,8> mDATA24_array_zzpii;
+  {
+  FCNCALL_SUBNAME("mDATA24_array_zzpii");
+  { FCNCALL_CALL_CTRL_WRAP(mDATA24_array_zzpii,mDATA24_array_zzpii.FCNCALL_CALL(mDATA24_array_zzpii)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // raw_array_multi_zero_suppress<DATA24,DATA24,8,4> mDATA24_array_zzpml;
+  {
+  FCNCALL_SUBNAME("mDATA24_array_zzpml");
+  { FCNCALL_CALL_CTRL_WRAP(mDATA24_array_zzpml,mDATA24_array_zzpml.FCNCALL_CALL(mDATA24_array_zzpml)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // raw_array<DATA24,DATA24,8> mDATA24_array2[2];
+  {
+  FCNCALL_SUBNAME("mDATA24_array2");
+  FCNCALL_FOR(__i0,2)
+  {
+    FCNCALL_SUBINDEX(__i0);
+    { FCNCALL_CALL_CTRL_WRAP_ARRAY(mDATA24_array2__i0,,__i0,mDATA24_array2[__i0].FCNCALL_CALL(mDATA24_array2[__i0])); }
+    FCNCALL_SUBINDEX_END(__i0);
+  }
+  FCNCALL_SUBNAME_END;
+  }
+  // raw_array_zero_suppress<DATA24,DATA24,8> mDATA24_array2_zzp[2];
+  {
+  FCNCALL_SUBNAME("mDATA24_array2_zzp");
+  FCNCALL_FOR(__i0,2)
+  {
+    FCNCALL_SUBINDEX(__i0);
+    { FCNCALL_CALL_CTRL_WRAP_ARRAY(mDATA24_array2_zzp__i0,,__i0,mDATA24_array2_zzp[__i0].FCNCALL_CALL(mDATA24_array2_zzp[__i0])); }
+    FCNCALL_SUBINDEX_END(__i0);
+  }
+  FCNCALL_SUBNAME_END;
+  }
+  // raw_list_zero_suppress<DATA24,DATA24,8> mDATA24_array2_zzpii[2];
+  {
+  FCNCALL_SUBNAME("mDATA24_array2_zzpii");
+  FCNCALL_FOR(__i0,2)
+  {
+    FCNCALL_SUBINDEX(__i0);
+    { FCNCALL_CALL_CTRL_WRAP_ARRAY(mDATA24_array2_zzpii__i0,,__i0,mDATA24_array2_zzpii[__i0].FCNCALL_CALL(mDATA24_array2_zzpii[__i0])); }
+    FCNCALL_SUBINDEX_END(__i0);
+  }
+  FCNCALL_SUBNAME_END;
+  }
+  // raw_array_multi_zero_suppress<DATA24,DATA24,8,4> mDATA24_array2_zzpml[2];
+  {
+  FCNCALL_SUBNAME("mDATA24_array2_zzpml");
+  FCNCALL_FOR(__i0,2)
+  {
+    FCNCALL_SUBINDEX(__i0);
+    { FCNCALL_CALL_CTRL_WRAP_ARRAY(mDATA24_array2_zzpml__i0,,__i0,mDATA24_array2_zzpml[__i0].FCNCALL_CALL(mDATA24_array2_zzpml[__i0])); }
+    FCNCALL_SUBINDEX_END(__i0);
+  }
+  FCNCALL_SUBNAME_END;
+  }
+  FCNCALL_RET;
+}
+#endif//USER_DEF_XTST_SUBEVENT_MEMBER_DATA24
+
+#ifndef USER_DEF_XTST_SUBEVENT_MEMBER_DATA32
+FCNCALL_TEMPLATE
+FCNCALL_RET_TYPE FCNCALL_CLASS_NAME(XTST_SUBEVENT_MEMBER_DATA32)::FCNCALL_NAME(XTST_SUBEVENT_MEMBER_DATA32)
+{
+  FCNCALL_INIT;
+  // DATA32 mDATA32;
+  {
+  FCNCALL_SUBNAME("mDATA32");
+  { FCNCALL_CALL_CTRL_WRAP(mDATA32,mDATA32.FCNCALL_CALL(mDATA32)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // raw_array<DATA32,DATA32,8> mDATA32_array;
+  {
+  FCNCALL_SUBNAME("mDATA32_array");
+  { FCNCALL_CALL_CTRL_WRAP(mDATA32_array,mDATA32_array.FCNCALL_CALL(mDATA32_array)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // raw_array_zero_suppress<DATA32,DATA32,8> mDATA32_array_zzp;
+  {
+  FCNCALL_SUBNAME("mDATA32_array_zzp");
+  { FCNCALL_CALL_CTRL_WRAP(mDATA32_array_zzp,mDATA32_array_zzp.FCNCALL_CALL(mDATA32_array_zzp)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // raw_list_zero_suppress<DATA32,DATA32,8> mDATA32_array_zzpii;
+  {
+  FCNCALL_SUBNAME("mDATA32_array_zzpii");
+  { FCNCALL_CALL_CTRL_WRAP(mDATA32_array_zzpii,mDATA32_array_zzpii.FCNCALL_CALL(mDATA32_array_zzpii)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // raw_array_multi_zero_suppress<DATA32,DATA32,8,4> mDATA32_array_zzpml;
+  {
+  FCNCALL_SUBNAME("mDATA32_array_zzpml");
+  { FCNCALL_CALL_CTRL_WRAP(mDATA32_array_zzpml,mDATA32_array_zzpml.FCNCALL_CALL(mDATA32_array_zzpml)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // raw_array<DATA32,DATA32,8> mDATA32_array2[2];
+  {
+  FCNCALL_SUBNAME("mDATA32_array2");
+  FCNCALL_FOR(__i0,2)
+  {
+    FCNCALL_SUBINDEX(__i0);
+    { FCNCALL_CALL_CTRL_WRAP_ARRAY(mDATA32_array2__i0,,__i0,mDATA32_array2[__i0].FCNCALL_CALL(mDATA32_array2[__i0])); }
+    FCNCALL_SUBINDEX_END(__i0);
+  }
+  FCNCALL_SUBNAME_END;
+  }
+  // raw_array_zero_suppress<DATA32,DATA32,8> mDATA32_array2_zzp[2];
+  {
+  FCNCALL_SUBNAME("mDATA32_array2_zzp");
+  FCNCALL_FOR(__i0,2)
+  {
+    FCNCALL_SUBINDEX(__i0);
+    { FCNCALL_CALL_CTRL_WRAP_ARRAY(mDATA32_array2_zzp__i0,,__i0,mDATA32_array2_zzp[__i0].FCNCALL_CALL(mDATA32_array2_zzp[__i0])); }
+    FCNCALL_SUBINDEX_END(__i0);
+  }
+  FCNCALL_SUBNAME_END;
+  }
+  // raw_list_zero_suppress<DATA32,DATA32,8> mDATA32_array2_zzpii[2];
+  {
+  FCNCALL_SUBNAME("mDATA32_array2_zzpii");
+  FCNCALL_FOR(__i0,2)
+  {
+    FCNCALL_SUBINDEX(__i0);
+    { FCNCALL_CALL_CTRL_WRAP_ARRAY(mDATA32_array2_zzpii__i0,,__i0,mDATA32_array2_zzpii[__i0].FCNCALL_CALL(mDATA32_array2_zzpii[__i0])); }
+    FCNCALL_SUBINDEX_END(__i0);
+  }
+  FCNCALL_SUBNAME_END;
+  }
+  // raw_array_multi_zero_suppress<DATA32,DATA32,8,4> mDATA32_array2_zzpml[2];
+  {
+  FCNCALL_SUBNAME("mDATA32_array2_zzpml");
+  FCNCALL_FOR(__i0,2)
+  {
+    FCNCALL_SUBINDEX(__i0);
+    { FCNCALL_CALL_CTRL_WRAP_ARRAY(mDATA32_array2_zzpml__i0,,__i0,mDATA32_array2_zzpml[__i0].FCNCALL_CALL(mDATA32_array2_zzpml[__i0])); }
+    FCNCALL_SUBINDEX_END(__i0);
+  }
+  FCNCALL_SUBNAME_END;
+  }
+  FCNCALL_RET;
+}
+#endif//USER_DEF_XTST_SUBEVENT_MEMBER_DATA32
+
+#ifndef USER_DEF_XTST_SUBEVENT_MEMBER_DATA32_B
+FCNCALL_TEMPLATE
+FCNCALL_RET_TYPE FCNCALL_CLASS_NAME(XTST_SUBEVENT_MEMBER_DATA32_B)::FCNCALL_NAME(XTST_SUBEVENT_MEMBER_DATA32_B)
+{
+  FCNCALL_INIT;
+  // raw_array_multi_zero_suppress<DATA32,DATA32,8,4> mDATA32_array_zzpml;
+  {
+  FCNCALL_SUBNAME("mDATA32_array_zzpml");
+  { FCNCALL_CALL_CTRL_WRAP(mDATA32_array_zzpml,mDATA32_array_zzpml.FCNCALL_CALL(mDATA32_array_zzpml)); }
+  FCNCALL_SUBNAME_END;
+  }
+  FCNCALL_RET;
+}
+#endif//USER_DEF_XTST_SUBEVENT_MEMBER_DATA32_B
+
+#ifndef USER_DEF_XTST_SUBEVENT_MEMBER_DATA8
+FCNCALL_TEMPLATE
+FCNCALL_RET_TYPE FCNCALL_CLASS_NAME(XTST_SUBEVENT_MEMBER_DATA8)::FCNCALL_NAME(XTST_SUBEVENT_MEMBER_DATA8)
+{
+  FCNCALL_INIT;
+  // DATA8 mDATA8;
+  {
+  FCNCALL_SUBNAME("mDATA8");
+  { FCNCALL_CALL_CTRL_WRAP(mDATA8,mDATA8.FCNCALL_CALL(mDATA8)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // raw_array<DATA8,DATA8,8> mDATA8_array;
+  {
+  FCNCALL_SUBNAME("mDATA8_array");
+  { FCNCALL_CALL_CTRL_WRAP(mDATA8_array,mDATA8_array.FCNCALL_CALL(mDATA8_array)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // raw_array_zero_suppress<DATA8,DATA8,8> mDATA8_array_zzp;
+  {
+  FCNCALL_SUBNAME("mDATA8_array_zzp");
+  { FCNCALL_CALL_CTRL_WRAP(mDATA8_array_zzp,mDATA8_array_zzp.FCNCALL_CALL(mDATA8_array_zzp)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // raw_list_zero_suppress<DATA8,DATA8,8> mDATA8_array_zzpii;
+  {
+  FCNCALL_SUBNAME("mDATA8_array_zzpii");
+  { FCNCALL_CALL_CTRL_WRAP(mDATA8_array_zzpii,mDATA8_array_zzpii.FCNCALL_CALL(mDATA8_array_zzpii)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // raw_array_multi_zero_suppress<DATA8,DATA8,8,4> mDATA8_array_zzpml;
+  {
+  FCNCALL_SUBNAME("mDATA8_array_zzpml");
+  { FCNCALL_CALL_CTRL_WRAP(mDATA8_array_zzpml,mDATA8_array_zzpml.FCNCALL_CALL(mDATA8_array_zzpml)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // raw_array<DATA8,DATA8,8> mDATA8_array2[2];
+  {
+  FCNCALL_SUBNAME("mDATA8_array2");
+  FCNCALL_FOR(__i0,2)
+  {
+    FCNCALL_SUBINDEX(__i0);
+    { FCNCALL_CALL_CTRL_WRAP_ARRAY(mDATA8_array2__i0,,__i0,mDATA8_array2[__i0].FCNCALL_CALL(mDATA8_array2[__i0])); }
+    FCNCALL_SUBINDEX_END(__i0);
+  }
+  FCNCALL_SUBNAME_END;
+  }
+  // raw_array_zero_suppress<DATA8,DATA8,8> mDATA8_array2_zzp[2];
+  {
+  FCNCALL_SUBNAME("mDATA8_array2_zzp");
+  FCNCALL_FOR(__i0,2)
+  {
+    FCNCALL_SUBINDEX(__i0);
+    { FCNCALL_CALL_CTRL_WRAP_ARRAY(mDATA8_array2_zzp__i0,,__i0,mDATA8_array2_zzp[__i0].FCNCALL_CALL(mDATA8_array2_zzp[__i0])); }
+    FCNCALL_SUBINDEX_END(__i0);
+  }
+  FCNCALL_SUBNAME_END;
+  }
+  // raw_list_zero_suppress<DATA8,DATA8,8> mDATA8_array2_zzpii[2];
+  {
+  FCNCALL_SUBNAME("mDATA8_array2_zzpii");
+  FCNCALL_FOR(__i0,2)
+  {
+    FCNCALL_SUBINDEX(__i0);
+    { FCNCALL_CALL_CTRL_WRAP_ARRAY(mDATA8_array2_zzpii__i0,,__i0,mDATA8_array2_zzpii[__i0].FCNCALL_CALL(mDATA8_array2_zzpii[__i0])); }
+    FCNCALL_SUBINDEX_END(__i0);
+  }
+  FCNCALL_SUBNAME_END;
+  }
+  // raw_array_multi_zero_suppress<DATA8,DATA8,8,4> mDATA8_array2_zzpml[2];
+  {
+  FCNCALL_SUBNAME("mDATA8_array2_zzpml");
+  FCNCALL_FOR(__i0,2)
+  {
+    FCNCALL_SUBINDEX(__i0);
+    { FCNCALL_CALL_CTRL_WRAP_ARRAY(mDATA8_array2_zzpml__i0,,__i0,mDATA8_array2_zzpml[__i0].FCNCALL_CALL(mDATA8_array2_zzpml[__i0])); }
+    FCNCALL_SUBINDEX_END(__i0);
+  }
+  FCNCALL_SUBNAME_END;
+  }
+  FCNCALL_RET;
+}
+#endif//USER_DEF_XTST_SUBEVENT_MEMBER_DATA8
+
+#ifndef USER_DEF_XTST_SUBEVENT_MEMBER_uint16
+FCNCALL_TEMPLATE
+FCNCALL_RET_TYPE FCNCALL_CLASS_NAME(XTST_SUBEVENT_MEMBER_uint16)::FCNCALL_NAME(XTST_SUBEVENT_MEMBER_uint16)
+{
+  FCNCALL_INIT;
+  // uint16 muint16;
+  {
+  FCNCALL_SUBNAME("muint16");
+  { FCNCALL_CALL_CTRL_WRAP(muint16,FCNCALL_CALL_TYPE(uint16,muint16)); }
+  FCNCALL_SUBNAME_END;
+  }
+  FCNCALL_RET;
+}
+#endif//USER_DEF_XTST_SUBEVENT_MEMBER_uint16
+
+#ifndef USER_DEF_XTST_SUBEVENT_MEMBER_uint32
+FCNCALL_TEMPLATE
+FCNCALL_RET_TYPE FCNCALL_CLASS_NAME(XTST_SUBEVENT_MEMBER_uint32)::FCNCALL_NAME(XTST_SUBEVENT_MEMBER_uint32)
+{
+  FCNCALL_INIT;
+  // uint32 muint32;
+  {
+  FCNCALL_SUBNAME("muint32");
+  { FCNCALL_CALL_CTRL_WRAP(muint32,FCNCALL_CALL_TYPE(uint32,muint32)); }
+  FCNCALL_SUBNAME_END;
+  }
+  FCNCALL_RET;
+}
+#endif//USER_DEF_XTST_SUBEVENT_MEMBER_uint32
+
+#ifndef USER_DEF_XTST_SUBEVENT_MEMBER_uint8
+FCNCALL_TEMPLATE
+FCNCALL_RET_TYPE FCNCALL_CLASS_NAME(XTST_SUBEVENT_MEMBER_uint8)::FCNCALL_NAME(XTST_SUBEVENT_MEMBER_uint8)
+{
+  FCNCALL_INIT;
+  // uint8 muint8;
+  {
+  FCNCALL_SUBNAME("muint8");
+  { FCNCALL_CALL_CTRL_WRAP(muint8,FCNCALL_CALL_TYPE(uint8,muint8)); }
+  FCNCALL_SUBNAME_END;
+  }
+  FCNCALL_RET;
+}
+#endif//USER_DEF_XTST_SUBEVENT_MEMBER_uint8
+
+#ifndef USER_DEF_BITS64
+FCNCALL_TEMPLATE
+FCNCALL_RET_TYPE FCNCALL_CLASS_NAME(BITS64)::FCNCALL_NAME(BITS64)
+{
+  FCNCALL_INIT;
+  FCNCALL_CALL_CTRL_WRAP(unpack_subevent_base,FCNCALL_CLASS_NAME(unpack_subevent_base)::FCNCALL_CALL_BASE());
+  // DATA64 member64;
+  {
+  FCNCALL_SUBNAME("member64");
+  { FCNCALL_CALL_CTRL_WRAP(member64,member64.FCNCALL_CALL(member64)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // raw_array<DATA64,DATA64,7> array64;
+  {
+  FCNCALL_SUBNAME("array64");
+  { FCNCALL_CALL_CTRL_WRAP(array64,array64.FCNCALL_CALL(array64)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // DATA32 member32;
+  {
+  FCNCALL_SUBNAME("member32");
+  { FCNCALL_CALL_CTRL_WRAP(member32,member32.FCNCALL_CALL(member32)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // uint32 data32_1;
+  {
+  FCNCALL_SUBNAME("data32_1");
+  { FCNCALL_CALL_CTRL_WRAP(data32_1,FCNCALL_CALL_TYPE(uint32,data32_1)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // uint32 data32_2;
+  {
+  FCNCALL_SUBNAME("data32_2");
+  { FCNCALL_CALL_CTRL_WRAP(data32_2,FCNCALL_CALL_TYPE(uint32,data32_2)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // uint64 data64_1;
+  {
+  FCNCALL_SUBNAME("data64_1");
+  { FCNCALL_CALL_CTRL_WRAP(data64_1,FCNCALL_CALL_TYPE(uint64,data64_1)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // ITEM64 i[3];
+  {
+  FCNCALL_SUBNAME("i");
+  FCNCALL_FOR(__i0,3)
+  {
+    FCNCALL_SUBINDEX(__i0);
+    { FCNCALL_CALL_CTRL_WRAP_ARRAY(i__i0,,__i0,i[__i0].FCNCALL_CALL(i[__i0])); }
+    FCNCALL_SUBINDEX_END(__i0);
+  }
+  FCNCALL_SUBNAME_END;
+  }
+  FCNCALL_RET;
+}
+#endif//USER_DEF_BITS64
+
+#ifndef USER_DEF_XTST_MDPP16
+FCNCALL_TEMPLATE
+FCNCALL_RET_TYPE FCNCALL_CLASS_NAME(XTST_MDPP16)::FCNCALL_NAME(XTST_MDPP16)
+{
+  FCNCALL_INIT;
+  FCNCALL_CALL_CTRL_WRAP(unpack_subevent_base,FCNCALL_CLASS_NAME(unpack_subevent_base)::FCNCALL_CALL_BASE());
+  // union 
+  // {
+    // struct 
+    // {
+      // uint16 unaligned : 16;
+    // } ;
+    // uint16 u16;
+  // } align;
+  {
+  FCNCALL_SUBNAME("align");
+#if !STRUCT_ONLY_LAST_UNION_MEMBER
+  // struct 
+  // {
+    // uint16 unaligned : 16;
+  // } ;
+  // uint16 unaligned : 16;
+  {
+  FCNCALL_SUBNAME("unaligned");
+  { FCNCALL_CALL_CTRL_WRAP(align.unaligned,FCNCALL_CALL_TYPE/*_BITFIELD*/(uint16,align.unaligned)); }
+  FCNCALL_SUBNAME_END;
+  }
+#endif// !STRUCT_ONLY_LAST_UNION_MEMBER
+  // uint16 u16;
+  {
+  FCNCALL_SUBNAME("u16");
+  { FCNCALL_CALL_CTRL_WRAP(align.u16,FCNCALL_CALL_TYPE(uint16,align.u16)); }
+  FCNCALL_SUBNAME_END;
+  }
+  FCNCALL_SUBNAME_END;
+  }
+  // uint16 pad;
+  {
+  FCNCALL_SUBNAME("pad");
+  { FCNCALL_CALL_CTRL_WRAP(pad,FCNCALL_CALL_TYPE(uint16,pad)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // VME_MESYTEC_MDPP16 mdpp16[2];
+  {
+  FCNCALL_SUBNAME("mdpp16");
+  FCNCALL_FOR(__i0,2)
+  {
+    FCNCALL_SUBINDEX(__i0);
+    { FCNCALL_CALL_CTRL_WRAP_ARRAY(mdpp16__i0,,__i0,mdpp16[__i0].FCNCALL_CALL(mdpp16[__i0])); }
+    FCNCALL_SUBINDEX_END(__i0);
+  }
+  FCNCALL_SUBNAME_END;
+  }
+  FCNCALL_RET;
+}
+#endif//USER_DEF_XTST_MDPP16
+
+#ifndef USER_DEF_XTST_PLAIN
+FCNCALL_TEMPLATE
+FCNCALL_RET_TYPE FCNCALL_CLASS_NAME(XTST_PLAIN)::FCNCALL_NAME(XTST_PLAIN)
+{
+  FCNCALL_INIT;
+  FCNCALL_CALL_CTRL_WRAP(unpack_subevent_base,FCNCALL_CLASS_NAME(unpack_subevent_base)::FCNCALL_CALL_BASE());
+  // uint32 u;
+  {
+  FCNCALL_SUBNAME("u");
+  { FCNCALL_CALL_CTRL_WRAP(u,FCNCALL_CALL_TYPE(uint32,u)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // uint16 s;
+  {
+  FCNCALL_SUBNAME("s");
+  { FCNCALL_CALL_CTRL_WRAP(s,FCNCALL_CALL_TYPE(uint16,s)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // uint8 c;
+  {
+  FCNCALL_SUBNAME("c");
+  { FCNCALL_CALL_CTRL_WRAP(c,FCNCALL_CALL_TYPE(uint8,c)); }
+  FCNCALL_SUBNAME_END;
+  }
+  FCNCALL_RET;
+}
+#endif//USER_DEF_XTST_PLAIN
+
+#ifndef USER_DEF_XTST_REGRESS
+FCNCALL_TEMPLATE
+FCNCALL_RET_TYPE FCNCALL_CLASS_NAME(XTST_REGRESS)::FCNCALL_NAME(XTST_REGRESS)
+{
+  FCNCALL_INIT;
+  FCNCALL_CALL_CTRL_WRAP(unpack_subevent_base,FCNCALL_CLASS_NAME(unpack_subevent_base)::FCNCALL_CALL_BASE());
+  // WR_STAMP wr[6];
+  {
+  FCNCALL_SUBNAME("wr");
+  FCNCALL_FOR(__i0,6)
+  {
+    FCNCALL_SUBINDEX(__i0);
+    { FCNCALL_CALL_CTRL_WRAP_ARRAY(wr__i0,,__i0,wr[__i0].FCNCALL_CALL(wr[__i0])); }
+    FCNCALL_SUBINDEX_END(__i0);
+  }
+  FCNCALL_SUBNAME_END;
+  }
+  // uint32 seed;
+  {
+  FCNCALL_SUBNAME("seed");
+  { FCNCALL_CALL_CTRL_WRAP(seed,FCNCALL_CALL_TYPE(uint32,seed)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // VME_CAEN_V775 v775mod[2];
+  {
+  FCNCALL_SUBNAME("v775mod");
+  FCNCALL_FOR(__i0,2)
+  {
+    FCNCALL_SUBINDEX(__i0);
+    { FCNCALL_CALL_CTRL_WRAP_ARRAY(v775mod__i0,,__i0,v775mod[__i0].FCNCALL_CALL(v775mod[__i0])); }
+    FCNCALL_SUBINDEX_END(__i0);
+  }
+  FCNCALL_SUBNAME_END;
+  }
+  // VME_CAEN_V1290_SHORT v1290mod[2];
+  {
+  FCNCALL_SUBNAME("v1290mod");
+  FCNCALL_FOR(__i0,2)
+  {
+    FCNCALL_SUBINDEX(__i0);
+    { FCNCALL_CALL_CTRL_WRAP_ARRAY(v1290mod__i0,,__i0,v1290mod[__i0].FCNCALL_CALL(v1290mod[__i0])); }
+    FCNCALL_SUBINDEX_END(__i0);
+  }
+  FCNCALL_SUBNAME_END;
+  }
+  // STICKY_ACTIVE sticky_active;
+  {
+  FCNCALL_SUBNAME("sticky_active");
+  { FCNCALL_CALL_CTRL_WRAP(sticky_active,sticky_active.FCNCALL_CALL(sticky_active)); }
+  FCNCALL_SUBNAME_END;
+  }
+  FCNCALL_RET;
+}
+#endif//USER_DEF_XTST_REGRESS
+
+#ifndef USER_DEF_XTST_REGRESSEXTRA
+FCNCALL_TEMPLATE
+FCNCALL_RET_TYPE FCNCALL_CLASS_NAME(XTST_REGRESSEXTRA)::FCNCALL_NAME(XTST_REGRESSEXTRA)
+{
+  FCNCALL_INIT;
+  FCNCALL_CALL_CTRL_WRAP(unpack_subevent_base,FCNCALL_CLASS_NAME(unpack_subevent_base)::FCNCALL_CALL_BASE());
+  // uint32 junk;
+  {
+  FCNCALL_SUBNAME("junk");
+  { FCNCALL_CALL_CTRL_WRAP(junk,FCNCALL_CALL_TYPE(uint32,junk)); }
+  FCNCALL_SUBNAME_END;
+  }
+  FCNCALL_RET;
+}
+#endif//USER_DEF_XTST_REGRESSEXTRA
+
+#ifndef USER_DEF_XTST_STICKY_CORR
+FCNCALL_TEMPLATE
+FCNCALL_RET_TYPE FCNCALL_CLASS_NAME(XTST_STICKY_CORR)::FCNCALL_NAME(XTST_STICKY_CORR)
+{
+  FCNCALL_INIT;
+  FCNCALL_CALL_CTRL_WRAP(unpack_sticky_subevent_base,FCNCALL_CLASS_NAME(unpack_sticky_subevent_base)::FCNCALL_CALL_BASE());
+  // uint32 base;
+  {
+  FCNCALL_SUBNAME("base");
+  { FCNCALL_CALL_CTRL_WRAP(base,FCNCALL_CALL_TYPE(uint32,base)); }
+  FCNCALL_SUBNAME_END;
+  }
+  FCNCALL_RET;
+}
+#endif//USER_DEF_XTST_STICKY_CORR
+
+#ifndef USER_DEF_XTST_SUBEVENT_ME2
+FCNCALL_TEMPLATE
+FCNCALL_RET_TYPE FCNCALL_CLASS_NAME(XTST_SUBEVENT_ME2)::FCNCALL_NAME(XTST_SUBEVENT_ME2)
+{
+  FCNCALL_INIT;
+  FCNCALL_CALL_CTRL_WRAP(unpack_subevent_base,FCNCALL_CLASS_NAME(unpack_subevent_base)::FCNCALL_CALL_BASE());
+  // ITEM_ME2 i[3];
+  {
+  FCNCALL_SUBNAME("i");
+  FCNCALL_FOR(__i0,3)
+  {
+    FCNCALL_SUBINDEX(__i0);
+    { FCNCALL_CALL_CTRL_WRAP_ARRAY(i__i0,,__i0,i[__i0].FCNCALL_CALL(i[__i0])); }
+    FCNCALL_SUBINDEX_END(__i0);
+  }
+  FCNCALL_SUBNAME_END;
+  }
+  FCNCALL_RET;
+}
+#endif//USER_DEF_XTST_SUBEVENT_ME2
+
+#ifndef USER_DEF_XTST_SUBEVENT_MEMBER_ENCODE
+FCNCALL_TEMPLATE
+FCNCALL_RET_TYPE FCNCALL_CLASS_NAME(XTST_SUBEVENT_MEMBER_ENCODE)::FCNCALL_NAME(XTST_SUBEVENT_MEMBER_ENCODE)
+{
+  FCNCALL_INIT;
+  FCNCALL_CALL_CTRL_WRAP(unpack_subevent_base,FCNCALL_CLASS_NAME(unpack_subevent_base)::FCNCALL_CALL_BASE());
+  // XTST_SUBEVENT_MEMBER_DATA32 member_DATA32;
+  {
+  FCNCALL_SUBNAME("member_DATA32");
+  { FCNCALL_CALL_CTRL_WRAP(member_DATA32,member_DATA32.FCNCALL_CALL(member_DATA32)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // XTST_SUBEVENT_MEMBER_DATA24 member_DATA24;
+  {
+  FCNCALL_SUBNAME("member_DATA24");
+  { FCNCALL_CALL_CTRL_WRAP(member_DATA24,member_DATA24.FCNCALL_CALL(member_DATA24)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // XTST_SUBEVENT_MEMBER_DATA16 member_DATA16;
+  {
+  FCNCALL_SUBNAME("member_DATA16");
+  { FCNCALL_CALL_CTRL_WRAP(member_DATA16,member_DATA16.FCNCALL_CALL(member_DATA16)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // XTST_SUBEVENT_MEMBER_DATA16_OVERFLOW member_DATA16_OVERFLOW;
+  {
+  FCNCALL_SUBNAME("member_DATA16_OVERFLOW");
+  { FCNCALL_CALL_CTRL_WRAP(member_DATA16_OVERFLOW,member_DATA16_OVERFLOW.FCNCALL_CALL(member_DATA16_OVERFLOW)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // XTST_SUBEVENT_MEMBER_DATA12 member_DATA12;
+  {
+  FCNCALL_SUBNAME("member_DATA12");
+  { FCNCALL_CALL_CTRL_WRAP(member_DATA12,member_DATA12.FCNCALL_CALL(member_DATA12)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // XTST_SUBEVENT_MEMBER_DATA12_OVERFLOW member_DATA12_OVERFLOW;
+  {
+  FCNCALL_SUBNAME("member_DATA12_OVERFLOW");
+  { FCNCALL_CALL_CTRL_WRAP(member_DATA12_OVERFLOW,member_DATA12_OVERFLOW.FCNCALL_CALL(member_DATA12_OVERFLOW)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // XTST_SUBEVENT_MEMBER_DATA12_RANGE member_DATA12_RANGE;
+  {
+  FCNCALL_SUBNAME("member_DATA12_RANGE");
+  { FCNCALL_CALL_CTRL_WRAP(member_DATA12_RANGE,member_DATA12_RANGE.FCNCALL_CALL(member_DATA12_RANGE)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // XTST_SUBEVENT_MEMBER_uint32 member_uint32;
+  {
+  FCNCALL_SUBNAME("member_uint32");
+  { FCNCALL_CALL_CTRL_WRAP(member_uint32,member_uint32.FCNCALL_CALL(member_uint32)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // XTST_SUBEVENT_MEMBER_uint16 member_uint16;
+  {
+  FCNCALL_SUBNAME("member_uint16");
+  { FCNCALL_CALL_CTRL_WRAP(member_uint16,member_uint16.FCNCALL_CALL(member_uint16)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // XTST_SUBEVENT_MEMBER_uint8 member_uint8;
+  {
+  FCNCALL_SUBNAME("member_uint8");
+  { FCNCALL_CALL_CTRL_WRAP(member_uint8,member_uint8.FCNCALL_CALL(member_uint8)); }
+  FCNCALL_SUBNAME_END;
+  }
+  FCNCALL_RET;
+}
+#endif//USER_DEF_XTST_SUBEVENT_MEMBER_ENCODE
+
+#ifndef USER_DEF_XTST_SUBEVENT_MEMBER_ENCODE_A
+FCNCALL_TEMPLATE
+FCNCALL_RET_TYPE FCNCALL_CLASS_NAME(XTST_SUBEVENT_MEMBER_ENCODE_A)::FCNCALL_NAME(XTST_SUBEVENT_MEMBER_ENCODE_A)
+{
+  FCNCALL_INIT;
+  FCNCALL_CALL_CTRL_WRAP(unpack_subevent_base,FCNCALL_CLASS_NAME(unpack_subevent_base)::FCNCALL_CALL_BASE());
+  // XTST_SUBEVENT_MEMBER_DATA32 d32;
+  {
+  FCNCALL_SUBNAME("d32");
+  { FCNCALL_CALL_CTRL_WRAP(d32,d32.FCNCALL_CALL(d32)); }
+  FCNCALL_SUBNAME_END;
+  }
+  FCNCALL_RET;
+}
+#endif//USER_DEF_XTST_SUBEVENT_MEMBER_ENCODE_A
+
+#ifndef USER_DEF_XTST_SUBEVENT_MEMBER_ENCODE_B
+FCNCALL_TEMPLATE
+FCNCALL_RET_TYPE FCNCALL_CLASS_NAME(XTST_SUBEVENT_MEMBER_ENCODE_B)::FCNCALL_NAME(XTST_SUBEVENT_MEMBER_ENCODE_B)
+{
+  FCNCALL_INIT;
+  FCNCALL_CALL_CTRL_WRAP(unpack_subevent_base,FCNCALL_CLASS_NAME(unpack_subevent_base)::FCNCALL_CALL_BASE());
+  // XTST_SUBEVENT_MEMBER_DATA32_B d32;
+  {
+  FCNCALL_SUBNAME("d32");
+  { FCNCALL_CALL_CTRL_WRAP(d32,d32.FCNCALL_CALL(d32)); }
+  FCNCALL_SUBNAME_END;
+  }
+  FCNCALL_RET;
+}
+#endif//USER_DEF_XTST_SUBEVENT_MEMBER_ENCODE_B
+
+#ifndef USER_DEF_XTST_VME
+FCNCALL_TEMPLATE
+FCNCALL_RET_TYPE FCNCALL_CLASS_NAME(XTST_VME)::FCNCALL_NAME(XTST_VME)
+{
+  FCNCALL_INIT;
+  FCNCALL_CALL_CTRL_WRAP(unpack_subevent_base,FCNCALL_CLASS_NAME(unpack_subevent_base)::FCNCALL_CALL_BASE());
+  // VME_CAEN_V775 tdc0;
+  {
+  FCNCALL_SUBNAME("tdc0");
+  { FCNCALL_CALL_CTRL_WRAP(tdc0,tdc0.FCNCALL_CALL(tdc0)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // VME_CAEN_V775 tdc1;
+  {
+  FCNCALL_SUBNAME("tdc1");
+  { FCNCALL_CALL_CTRL_WRAP(tdc1,tdc1.FCNCALL_CALL(tdc1)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // VME_CAEN_V775 tdc2;
+  {
+  FCNCALL_SUBNAME("tdc2");
+  { FCNCALL_CALL_CTRL_WRAP(tdc2,tdc2.FCNCALL_CALL(tdc2)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // VME_CAEN_V775 qdc0;
+  {
+  FCNCALL_SUBNAME("qdc0");
+  { FCNCALL_CALL_CTRL_WRAP(qdc0,qdc0.FCNCALL_CALL(qdc0)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // VME_CAEN_V775 qdc1;
+  {
+  FCNCALL_SUBNAME("qdc1");
+  { FCNCALL_CALL_CTRL_WRAP(qdc1,qdc1.FCNCALL_CALL(qdc1)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // VME_MESYTEC_MDPP16 mdpp16;
+  {
+  FCNCALL_SUBNAME("mdpp16");
+  { FCNCALL_CALL_CTRL_WRAP(mdpp16,mdpp16.FCNCALL_CALL(mdpp16)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // XTST_STD_VME header;
+  {
+  FCNCALL_SUBNAME("header");
+  { FCNCALL_CALL_CTRL_WRAP(header,header.FCNCALL_CALL(header)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // SINGLE_DATA_MODULE sdm;
+  {
+  FCNCALL_SUBNAME("sdm");
+  { FCNCALL_CALL_CTRL_WRAP(sdm,sdm.FCNCALL_CALL(sdm)); }
+  FCNCALL_SUBNAME_END;
+  }
+  FCNCALL_RET;
+}
+#endif//USER_DEF_XTST_VME
+
+#ifndef USER_DEF_unpack_event
+FCNCALL_TEMPLATE
+FCNCALL_RET_TYPE FCNCALL_CLASS_NAME(unpack_event)::FCNCALL_NAME(unpack_event)
+{
+  FCNCALL_INIT;
+  FCNCALL_CALL_CTRL_WRAP(unpack_event_base,FCNCALL_CLASS_NAME(unpack_event_base)::FCNCALL_CALL_BASE());
+  // XTST_VME vme;
+  {
+  FCNCALL_SUBNAME("vme");
+  { FCNCALL_CALL_CTRL_WRAP(vme,vme.FCNCALL_CALL(vme)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // BITS64 bits64;
+  {
+  FCNCALL_SUBNAME("bits64");
+  { FCNCALL_CALL_CTRL_WRAP(bits64,bits64.FCNCALL_CALL(bits64)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // XTST_SUBEVENT_MEMBER_ENCODE me;
+  {
+  FCNCALL_SUBNAME("me");
+  { FCNCALL_CALL_CTRL_WRAP(me,me.FCNCALL_CALL(me)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // XTST_SUBEVENT_MEMBER_ENCODE_A mea;
+  {
+  FCNCALL_SUBNAME("mea");
+  { FCNCALL_CALL_CTRL_WRAP(mea,mea.FCNCALL_CALL(mea)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // XTST_SUBEVENT_MEMBER_ENCODE_B meb;
+  {
+  FCNCALL_SUBNAME("meb");
+  { FCNCALL_CALL_CTRL_WRAP(meb,meb.FCNCALL_CALL(meb)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // XTST_SUBEVENT_ME2 me2;
+  {
+  FCNCALL_SUBNAME("me2");
+  { FCNCALL_CALL_CTRL_WRAP(me2,me2.FCNCALL_CALL(me2)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // XTST_PLAIN plain;
+  {
+  FCNCALL_SUBNAME("plain");
+  { FCNCALL_CALL_CTRL_WRAP(plain,plain.FCNCALL_CALL(plain)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // XTST_REGRESS regress[16];
+  {
+  FCNCALL_SUBNAME("regress");
+  FCNCALL_FOR(__i0,16)
+  {
+    FCNCALL_SUBINDEX(__i0);
+    { FCNCALL_CALL_CTRL_WRAP_ARRAY(regress__i0,,__i0,regress[__i0].FCNCALL_CALL(regress[__i0])); }
+    FCNCALL_SUBINDEX_END(__i0);
+  }
+  FCNCALL_SUBNAME_END;
+  }
+  // XTST_REGRESSEXTRA regressextra;
+  {
+  FCNCALL_SUBNAME("regressextra");
+  { FCNCALL_CALL_CTRL_WRAP(regressextra,regressextra.FCNCALL_CALL(regressextra)); }
+  FCNCALL_SUBNAME_END;
+  }
+  // XTST_MDPP16 mdpp;
+  {
+  FCNCALL_SUBNAME("mdpp");
+  { FCNCALL_CALL_CTRL_WRAP(mdpp,mdpp.FCNCALL_CALL(mdpp)); }
+  FCNCALL_SUBNAME_END;
+  }
+  FCNCALL_RET;
+}
+#endif//USER_DEF_unpack_event
+
+#ifndef USER_DEF_unpack_sticky_event
+FCNCALL_TEMPLATE
+FCNCALL_RET_TYPE FCNCALL_CLASS_NAME(unpack_sticky_event)::FCNCALL_NAME(unpack_sticky_event)
+{
+  FCNCALL_INIT;
+  FCNCALL_CALL_CTRL_WRAP(unpack_sticky_event_base,FCNCALL_CLASS_NAME(unpack_sticky_event_base)::FCNCALL_CALL_BASE());
+  // XTST_STICKY_CORR corr;
+  {
+  FCNCALL_SUBNAME("corr");
+  { FCNCALL_CALL_CTRL_WRAP(corr,corr.FCNCALL_CALL(corr)); }
+  FCNCALL_SUBNAME_END;
+  }
+  FCNCALL_RET;
+}
+#endif//USER_DEF_unpack_sticky_event
+
+#include "gen/default_fcncall_undef.hh"
+
+
+/** END_FUNCTION_CALL_PER_MEMBER **************************************/
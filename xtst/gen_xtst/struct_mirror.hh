@@ -0,0 +1,1830 @@
+/** BEGIN_MIRROR_STRUCT ************************************************
+ *
+ * Mirror (1 to 1) structure.
+ *
+ * Do not edit - automatically generated.
+ */
+
+#include "gen/default_mirror_define.hh"
+
+#ifndef USER_DEF_CAMAC_LECROY_4434
+STRUCT_MIRROR_TEMPLATE
+class STRUCT_MIRROR_STRUCT(CAMAC_LECROY_4434)
+{
+public:
+  STRUCT_MIRROR_ITEM_CTRL(data);
+  STRUCT_MIRROR_TYPE(raw_array_zero_suppress) < STRUCT_MIRROR_TYPE_TEMPLATE STRUCT_MIRROR_TEMPLATE_ARG(DATA24),STRUCT_MIRROR_TEMPLATE_ARG(DATA24),32> STRUCT_MIRROR_NAME(data);
+  STRUCT_MIRROR_FCNS_DECL(CAMAC_LECROY_4434);
+};
+#endif//USER_DEF_CAMAC_LECROY_4434
+
+#ifndef USER_DEF_CAMAC_PHILLIPS_7164
+STRUCT_MIRROR_TEMPLATE
+class STRUCT_MIRROR_STRUCT(CAMAC_PHILLIPS_7164)
+{
+public:
+  STRUCT_MIRROR_ITEM_CTRL(data);
+  STRUCT_MIRROR_TYPE(raw_array_zero_suppress) < STRUCT_MIRROR_TYPE_TEMPLATE STRUCT_MIRROR_TEMPLATE_ARG(DATA12),STRUCT_MIRROR_TEMPLATE_ARG(DATA12),16> STRUCT_MIRROR_NAME(data);
+  STRUCT_MIRROR_FCNS_DECL(CAMAC_PHILLIPS_7164);
+};
+#endif//USER_DEF_CAMAC_PHILLIPS_7164
+
+#ifndef USER_DEF_CAMAC_SILENA_4418
+STRUCT_MIRROR_TEMPLATE
+class STRUCT_MIRROR_STRUCT(CAMAC_SILENA_4418)
+{
+public:
+  STRUCT_MIRROR_ITEM_CTRL(data);
+  STRUCT_MIRROR_TYPE(raw_array_zero_suppress) < STRUCT_MIRROR_TYPE_TEMPLATE STRUCT_MIRROR_TEMPLATE_ARG(DATA12_OVERFLOW),STRUCT_MIRROR_TEMPLATE_ARG(DATA12_OVERFLOW),8> STRUCT_MIRROR_NAME(data);
+  STRUCT_MIRROR_FCNS_DECL(CAMAC_SILENA_4418);
+};
+#endif//USER_DEF_CAMAC_SILENA_4418
+
+#ifndef USER_DEF_FASTBUS_LECROY_1875
+STRUCT_MIRROR_TEMPLATE
+class STRUCT_MIRROR_STRUCT(FASTBUS_LECROY_1875)
+{
+public:
+  STRUCT_MIRROR_ITEM_CTRL(data);
+  STRUCT_MIRROR_TYPE(raw_array_zero_suppress) < STRUCT_MIRROR_TYPE_TEMPLATE STRUCT_MIRROR_TEMPLATE_ARG(DATA12_RANGE),STRUCT_MIRROR_TEMPLATE_ARG(DATA12_RANGE),64> STRUCT_MIRROR_NAME(data);
+  STRUCT_MIRROR_FCNS_DECL(FASTBUS_LECROY_1875);
+};
+#endif//USER_DEF_FASTBUS_LECROY_1875
+
+#ifndef USER_DEF_FASTBUS_LECROY_1885
+STRUCT_MIRROR_TEMPLATE
+class STRUCT_MIRROR_STRUCT(FASTBUS_LECROY_1885)
+{
+public:
+  STRUCT_MIRROR_ITEM_CTRL(data);
+  STRUCT_MIRROR_TYPE(raw_array_zero_suppress) < STRUCT_MIRROR_TYPE_TEMPLATE STRUCT_MIRROR_TEMPLATE_ARG(DATA12_RANGE),STRUCT_MIRROR_TEMPLATE_ARG(DATA12_RANGE),96> STRUCT_MIRROR_NAME(data);
+  STRUCT_MIRROR_FCNS_DECL(FASTBUS_LECROY_1885);
+};
+#endif//USER_DEF_FASTBUS_LECROY_1885
+
+#ifndef USER_DEF_ITEM64
+STRUCT_MIRROR_TEMPLATE
+class STRUCT_MIRROR_STRUCT(ITEM64)
+{
+public:
+  STRUCT_MIRROR_ITEM_CTRL(member64);
+  STRUCT_MIRROR_TYPE(DATA64) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(member64);
+#if STRUCT_ONLY_LAST_UNION_MEMBER
+  struct 
+#else
+  union 
+#endif
+
+  {
+  public:
+#if !STRUCT_ONLY_LAST_UNION_MEMBER
+    struct 
+    {
+    public:
+      STRUCT_MIRROR_ITEM_CTRL(unnamed_0_1);
+      STRUCT_MIRROR_TYPE(uint64) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(unnamed_0_1);
+      STRUCT_MIRROR_ITEM_CTRL(dummy_2_4);
+      STRUCT_MIRROR_TYPE(uint64) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(dummy_2_4);
+      STRUCT_MIRROR_ITEM_CTRL(num);
+      STRUCT_MIRROR_TYPE(uint64) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(num);
+      STRUCT_MIRROR_ITEM_CTRL(dummy_8_63);
+      STRUCT_MIRROR_TYPE(uint64) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(dummy_8_63);
+    };
+#endif// !STRUCT_ONLY_LAST_UNION_MEMBER
+    STRUCT_MIRROR_ITEM_CTRL(u64);
+    STRUCT_MIRROR_TYPE(uint64) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(u64);
+  } STRUCT_MIRROR_NAME(a);
+#if STRUCT_ONLY_LAST_UNION_MEMBER
+  struct 
+#else
+  union 
+#endif
+
+  {
+  public:
+#if !STRUCT_ONLY_LAST_UNION_MEMBER
+    struct 
+    {
+    public:
+      STRUCT_MIRROR_ITEM_CTRL(unnamed_0_1);
+      STRUCT_MIRROR_TYPE(uint64) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(unnamed_0_1);
+      STRUCT_MIRROR_ITEM_CTRL(dummy_2);
+      STRUCT_MIRROR_TYPE(uint64) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(dummy_2);
+      STRUCT_MIRROR_ITEM_CTRL(v);
+      STRUCT_MIRROR_TYPE(uint64) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(v);
+      STRUCT_MIRROR_ITEM_CTRL(dummy_8_19);
+      STRUCT_MIRROR_TYPE(uint64) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(dummy_8_19);
+      STRUCT_MIRROR_ITEM_CTRL(unnamed_20_63);
+      STRUCT_MIRROR_TYPE(uint64) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(unnamed_20_63);
+    };
+#endif// !STRUCT_ONLY_LAST_UNION_MEMBER
+    STRUCT_MIRROR_ITEM_CTRL(u64);
+    STRUCT_MIRROR_TYPE(uint64) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(u64);
+  } STRUCT_MIRROR_NAME(b);
+#if STRUCT_ONLY_LAST_UNION_MEMBER
+  struct 
+#else
+  union 
+#endif
+
+  {
+  public:
+#if !STRUCT_ONLY_LAST_UNION_MEMBER
+    struct 
+    {
+    public:
+      STRUCT_MIRROR_ITEM_CTRL(unnamed_0_1);
+      STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(unnamed_0_1);
+      STRUCT_MIRROR_ITEM_CTRL(dummy_2);
+      STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(dummy_2);
+      STRUCT_MIRROR_ITEM_CTRL(v);
+      STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(v);
+      STRUCT_MIRROR_ITEM_CTRL(dummy_8_19);
+      STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(dummy_8_19);
+      STRUCT_MIRROR_ITEM_CTRL(unnamed_20_31);
+      STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(unnamed_20_31);
+    };
+#endif// !STRUCT_ONLY_LAST_UNION_MEMBER
+    STRUCT_MIRROR_ITEM_CTRL(u32);
+    STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(u32);
+  } STRUCT_MIRROR_NAME(c);
+  STRUCT_MIRROR_FCNS_DECL(ITEM64);
+};
+#endif//USER_DEF_ITEM64
+
+#ifndef USER_DEF_ITEMQ
+STRUCT_MIRROR_TEMPLATE
+class STRUCT_MIRROR_STRUCT(ITEMQ)
+{
+public:
+  STRUCT_MIRROR_ITEM_CTRL(chan);
+  STRUCT_MIRROR_TYPE(DATA32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(chan);
+#if STRUCT_ONLY_LAST_UNION_MEMBER
+  struct 
+#else
+  union 
+#endif
+
+  {
+  public:
+#if !STRUCT_ONLY_LAST_UNION_MEMBER
+    struct 
+    {
+    public:
+      STRUCT_MIRROR_ITEM_CTRL(dummy_0_20);
+      STRUCT_MIRROR_TYPE(uint64) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(dummy_0_20);
+      STRUCT_MIRROR_ITEM_CTRL(c21);
+      STRUCT_MIRROR_TYPE(uint64) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(c21);
+      STRUCT_MIRROR_ITEM_CTRL(dummy_22_63);
+      STRUCT_MIRROR_TYPE(uint64) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(dummy_22_63);
+    };
+#endif// !STRUCT_ONLY_LAST_UNION_MEMBER
+    STRUCT_MIRROR_ITEM_CTRL(u64);
+    STRUCT_MIRROR_TYPE(uint64) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(u64);
+  } STRUCT_MIRROR_NAME(w1);
+#if STRUCT_ONLY_LAST_UNION_MEMBER
+  struct 
+#else
+  union 
+#endif
+
+  {
+  public:
+#if !STRUCT_ONLY_LAST_UNION_MEMBER
+    struct 
+    {
+    public:
+      STRUCT_MIRROR_ITEM_CTRL(dummy_0_21);
+      STRUCT_MIRROR_TYPE(uint64) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(dummy_0_21);
+      STRUCT_MIRROR_ITEM_CTRL(c22);
+      STRUCT_MIRROR_TYPE(uint64) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(c22);
+      STRUCT_MIRROR_ITEM_CTRL(dummy_23_63);
+      STRUCT_MIRROR_TYPE(uint64) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(dummy_23_63);
+    };
+#endif// !STRUCT_ONLY_LAST_UNION_MEMBER
+    STRUCT_MIRROR_ITEM_CTRL(u64);
+    STRUCT_MIRROR_TYPE(uint64) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(u64);
+  } STRUCT_MIRROR_NAME(w2);
+  STRUCT_MIRROR_FCNS_DECL(ITEMQ);
+};
+#endif//USER_DEF_ITEMQ
+
+#ifndef USER_DEF_ITEM_ME2
+STRUCT_MIRROR_TEMPLATE
+class STRUCT_MIRROR_STRUCT(ITEM_ME2)
+{
+public:
+  STRUCT_MIRROR_ITEM_CTRL(data);
+  STRUCT_MIRROR_TYPE(raw_array_zero_suppress) < STRUCT_MIRROR_TYPE_TEMPLATE STRUCT_MIRROR_TEMPLATE_ARG(DATA16),STRUCT_MIRROR_TEMPLATE_ARG(DATA16),32> STRUCT_MIRROR_NAME(data);
+  STRUCT_MIRROR_FCNS_DECL(ITEM_ME2);
+};
+#endif//USER_DEF_ITEM_ME2
+
+#ifndef USER_DEF_MADC32
+STRUCT_MIRROR_TEMPLATE
+class STRUCT_MIRROR_STRUCT(MADC32)
+{
+public:
+#if STRUCT_ONLY_LAST_UNION_MEMBER
+  struct 
+#else
+  union 
+#endif
+
+  {
+  public:
+#if !STRUCT_ONLY_LAST_UNION_MEMBER
+    struct 
+    {
+    public:
+      STRUCT_MIRROR_ITEM_CTRL(word_counts);
+      STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(word_counts);
+      STRUCT_MIRROR_ITEM_CTRL(resolution);
+      STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(resolution);
+      STRUCT_MIRROR_ITEM_CTRL(unused1);
+      STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(unused1);
+      STRUCT_MIRROR_ITEM_CTRL(id);
+      STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(id);
+      STRUCT_MIRROR_ITEM_CTRL(unnamed_24_29);
+      STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(unnamed_24_29);
+      STRUCT_MIRROR_ITEM_CTRL(unnamed_30_31);
+      STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(unnamed_30_31);
+    };
+#endif// !STRUCT_ONLY_LAST_UNION_MEMBER
+    STRUCT_MIRROR_ITEM_CTRL(u32);
+    STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(u32);
+  } STRUCT_MIRROR_NAME(header);
+#if STRUCT_ONLY_LAST_UNION_MEMBER
+  struct 
+#else
+  union 
+#endif
+
+  {
+  public:
+#if !STRUCT_ONLY_LAST_UNION_MEMBER
+    struct 
+    {
+    public:
+      STRUCT_MIRROR_ITEM_CTRL(adc_value);
+      STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(adc_value);
+      STRUCT_MIRROR_ITEM_CTRL(unnamed_11_13);
+      STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(unnamed_11_13);
+      STRUCT_MIRROR_ITEM_CTRL(unused);
+      STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(unused);
+      STRUCT_MIRROR_ITEM_CTRL(unnamed_15_15);
+      STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(unnamed_15_15);
+      STRUCT_MIRROR_ITEM_CTRL(channel);
+      STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(channel);
+      STRUCT_MIRROR_ITEM_CTRL(unnamed_21_29);
+      STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(unnamed_21_29);
+      STRUCT_MIRROR_ITEM_CTRL(unnamed_30_31);
+      STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(unnamed_30_31);
+    };
+#endif// !STRUCT_ONLY_LAST_UNION_MEMBER
+    STRUCT_MIRROR_ITEM_CTRL(u32);
+    STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(u32);
+  } STRUCT_MIRROR_NAME(madc32_data0);
+#if STRUCT_ONLY_LAST_UNION_MEMBER
+  struct 
+#else
+  union 
+#endif
+
+  {
+  public:
+#if !STRUCT_ONLY_LAST_UNION_MEMBER
+    struct 
+    {
+    public:
+      STRUCT_MIRROR_ITEM_CTRL(adc_value);
+      STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(adc_value);
+      STRUCT_MIRROR_ITEM_CTRL(unnamed_12_13);
+      STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(unnamed_12_13);
+      STRUCT_MIRROR_ITEM_CTRL(unused);
+      STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(unused);
+      STRUCT_MIRROR_ITEM_CTRL(unnamed_15_15);
+      STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(unnamed_15_15);
+      STRUCT_MIRROR_ITEM_CTRL(channel);
+      STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(channel);
+      STRUCT_MIRROR_ITEM_CTRL(unnamed_21_29);
+      STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(unnamed_21_29);
+      STRUCT_MIRROR_ITEM_CTRL(unnamed_30_31);
+      STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(unnamed_30_31);
+    };
+#endif// !STRUCT_ONLY_LAST_UNION_MEMBER
+    STRUCT_MIRROR_ITEM_CTRL(u32);
+    STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(u32);
+  } STRUCT_MIRROR_NAME(madc32_data1);
+#if STRUCT_ONLY_LAST_UNION_MEMBER
+  struct 
+#else
+  union 
+#endif
+
+  {
+  public:
+#if !STRUCT_ONLY_LAST_UNION_MEMBER
+    struct 
+    {
+    public:
+      STRUCT_MIRROR_ITEM_CTRL(adc_value);
+      STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(adc_value);
+      STRUCT_MIRROR_ITEM_CTRL(unnamed_13_13);
+      STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(unnamed_13_13);
+      STRUCT_MIRROR_ITEM_CTRL(unused);
+      STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(unused);
+      STRUCT_MIRROR_ITEM_CTRL(unnamed_15_15);
+      STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(unnamed_15_15);
+      STRUCT_MIRROR_ITEM_CTRL(channel);
+      STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(channel);
+      STRUCT_MIRROR_ITEM_CTRL(unnamed_21_29);
+      STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(unnamed_21_29);
+      STRUCT_MIRROR_ITEM_CTRL(unnamed_30_31);
+      STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(unnamed_30_31);
+    };
+#endif// !STRUCT_ONLY_LAST_UNION_MEMBER
+    STRUCT_MIRROR_ITEM_CTRL(u32);
+    STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(u32);
+  } STRUCT_MIRROR_NAME(madc32_data3);
+#if STRUCT_ONLY_LAST_UNION_MEMBER
+  struct 
+#else
+  union 
+#endif
+
+  {
+  public:
+#if !STRUCT_ONLY_LAST_UNION_MEMBER
+    struct 
+    {
+    public:
+      STRUCT_MIRROR_ITEM_CTRL(evt_counter);
+      STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(evt_counter);
+      STRUCT_MIRROR_ITEM_CTRL(unnamed_30_31);
+      STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(unnamed_30_31);
+    };
+#endif// !STRUCT_ONLY_LAST_UNION_MEMBER
+    STRUCT_MIRROR_ITEM_CTRL(u32);
+    STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(u32);
+  } STRUCT_MIRROR_NAME(trailer);
+  STRUCT_MIRROR_FCNS_DECL(MADC32);
+};
+#endif//USER_DEF_MADC32
+
+#ifndef USER_DEF_SINGLE_DATA_MODULE
+STRUCT_MIRROR_TEMPLATE
+class STRUCT_MIRROR_STRUCT(SINGLE_DATA_MODULE)
+{
+public:
+  STRUCT_MIRROR_ITEM_CTRL(data);
+  STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(data);
+  STRUCT_MIRROR_FCNS_DECL(SINGLE_DATA_MODULE);
+};
+#endif//USER_DEF_SINGLE_DATA_MODULE
+
+#ifndef USER_DEF_STICKY_ACTIVE
+STRUCT_MIRROR_TEMPLATE
+class STRUCT_MIRROR_STRUCT(STICKY_ACTIVE)
+{
+public:
+#if STRUCT_ONLY_LAST_UNION_MEMBER
+  struct 
+#else
+  union 
+#endif
+
+  {
+  public:
+#if !STRUCT_ONLY_LAST_UNION_MEMBER
+    struct 
+    {
+    public:
+      STRUCT_MIRROR_ITEM_CTRL(unnamed_0_31);
+      STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(unnamed_0_31);
+    };
+#endif// !STRUCT_ONLY_LAST_UNION_MEMBER
+    STRUCT_MIRROR_ITEM_CTRL(u32);
+    STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(u32);
+  } STRUCT_MIRROR_NAME(separator);
+  STRUCT_MIRROR_ITEM_CTRL(active);
+  STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(active);
+  STRUCT_MIRROR_ITEM_CTRL(mark);
+  STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(mark);
+  STRUCT_MIRROR_ITEM_CTRL(corr);
+  STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(corr);
+  STRUCT_MIRROR_FCNS_DECL(STICKY_ACTIVE);
+};
+#endif//USER_DEF_STICKY_ACTIVE
+
+#ifndef USER_DEF_VME_CAEN_V1190_SUBTDC
+STRUCT_MIRROR_TEMPLATE
+class STRUCT_MIRROR_STRUCT(VME_CAEN_V1190_SUBTDC)
+{
+public:
+#if STRUCT_ONLY_LAST_UNION_MEMBER
+  struct 
+#else
+  union 
+#endif
+
+  {
+  public:
+#if !STRUCT_ONLY_LAST_UNION_MEMBER
+    struct 
+    {
+    public:
+      STRUCT_MIRROR_ITEM_CTRL(bunch_id);
+      STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(bunch_id);
+      STRUCT_MIRROR_ITEM_CTRL(event_id);
+      STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(event_id);
+      STRUCT_MIRROR_ITEM_CTRL(tdc);
+      STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(tdc);
+      STRUCT_MIRROR_ITEM_CTRL(dummy_26);
+      STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(dummy_26);
+      STRUCT_MIRROR_ITEM_CTRL(unnamed_27_31);
+      STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(unnamed_27_31);
+    };
+#endif// !STRUCT_ONLY_LAST_UNION_MEMBER
+    STRUCT_MIRROR_ITEM_CTRL(u32);
+    STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(u32);
+  } STRUCT_MIRROR_NAME(header);
+#if STRUCT_ONLY_LAST_UNION_MEMBER
+  struct 
+#else
+  union 
+#endif
+
+  {
+  public:
+#if !STRUCT_ONLY_LAST_UNION_MEMBER
+    struct 
+    {
+    public:
+      STRUCT_MIRROR_ITEM_CTRL(flags);
+      STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(flags);
+      STRUCT_MIRROR_ITEM_CTRL(dummy_15_23);
+      STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(dummy_15_23);
+      STRUCT_MIRROR_ITEM_CTRL(tdc);
+      STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(tdc);
+      STRUCT_MIRROR_ITEM_CTRL(dummy_26);
+      STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(dummy_26);
+      STRUCT_MIRROR_ITEM_CTRL(unnamed_27_31);
+      STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(unnamed_27_31);
+    };
+#endif// !STRUCT_ONLY_LAST_UNION_MEMBER
+    STRUCT_MIRROR_ITEM_CTRL(u32);
+    STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(u32);
+  } STRUCT_MIRROR_NAME(error_flags);
+#if STRUCT_ONLY_LAST_UNION_MEMBER
+  struct 
+#else
+  union 
+#endif
+
+  {
+  public:
+#if !STRUCT_ONLY_LAST_UNION_MEMBER
+    struct 
+    {
+    public:
+      STRUCT_MIRROR_ITEM_CTRL(word_count);
+      STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(word_count);
+      STRUCT_MIRROR_ITEM_CTRL(event_id);
+      STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(event_id);
+      STRUCT_MIRROR_ITEM_CTRL(tdc);
+      STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(tdc);
+      STRUCT_MIRROR_ITEM_CTRL(dummy_26);
+      STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(dummy_26);
+      STRUCT_MIRROR_ITEM_CTRL(unnamed_27_31);
+      STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(unnamed_27_31);
+    };
+#endif// !STRUCT_ONLY_LAST_UNION_MEMBER
+    STRUCT_MIRROR_ITEM_CTRL(u32);
+    STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(u32);
+  } STRUCT_MIRROR_NAME(trailer);
+  STRUCT_MIRROR_FCNS_DECL(VME_CAEN_V1190_SUBTDC);
+};
+#endif//USER_DEF_VME_CAEN_V1190_SUBTDC
+
+#ifndef USER_DEF_VME_CAEN_V1190
+STRUCT_MIRROR_TEMPLATE
+class STRUCT_MIRROR_STRUCT(VME_CAEN_V1190)
+{
+public:
+  STRUCT_MIRROR_ITEM_CTRL(data);
+  STRUCT_MIRROR_TYPE(raw_array_multi_zero_suppress) < STRUCT_MIRROR_TYPE_TEMPLATE STRUCT_MIRROR_TEMPLATE_ARG(DATA24),STRUCT_MIRROR_TEMPLATE_ARG(DATA24),32,128> STRUCT_MIRROR_NAME(data);
+#if STRUCT_ONLY_LAST_UNION_MEMBER
+  struct 
+#else
+  union 
+#endif
+
+  {
+  public:
+#if !STRUCT_ONLY_LAST_UNION_MEMBER
+    struct 
+    {
+    public:
+      STRUCT_MIRROR_ITEM_CTRL(geom);
+      STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(geom);
+      STRUCT_MIRROR_ITEM_CTRL(event_number);
+      STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(event_number);
+      STRUCT_MIRROR_ITEM_CTRL(unnamed_27_31);
+      STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(unnamed_27_31);
+    };
+#endif// !STRUCT_ONLY_LAST_UNION_MEMBER
+    STRUCT_MIRROR_ITEM_CTRL(u32);
+    STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(u32);
+  } STRUCT_MIRROR_NAME(header);
+  STRUCT_MIRROR_ITEM_CTRL(tdc);
+  STRUCT_MIRROR_ITEM_CTRL_ARRAY(tdc__i0,,4);
+  STRUCT_MIRROR_TYPE(VME_CAEN_V1190_SUBTDC) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(tdc[4]);
+#if STRUCT_ONLY_LAST_UNION_MEMBER
+  struct 
+#else
+  union 
+#endif
+
+  {
+  public:
+#if !STRUCT_ONLY_LAST_UNION_MEMBER
+    struct 
+    {
+    public:
+      STRUCT_MIRROR_ITEM_CTRL(time_tag);
+      STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(time_tag);
+      STRUCT_MIRROR_ITEM_CTRL(unnamed_27_31);
+      STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(unnamed_27_31);
+    };
+#endif// !STRUCT_ONLY_LAST_UNION_MEMBER
+    STRUCT_MIRROR_ITEM_CTRL(u32);
+    STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(u32);
+  } STRUCT_MIRROR_NAME(trigger);
+#if STRUCT_ONLY_LAST_UNION_MEMBER
+  struct 
+#else
+  union 
+#endif
+
+  {
+  public:
+#if !STRUCT_ONLY_LAST_UNION_MEMBER
+    struct 
+    {
+    public:
+      STRUCT_MIRROR_ITEM_CTRL(geom);
+      STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(geom);
+      STRUCT_MIRROR_ITEM_CTRL(word_count);
+      STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(word_count);
+      STRUCT_MIRROR_ITEM_CTRL(dummy_20_23);
+      STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(dummy_20_23);
+      STRUCT_MIRROR_ITEM_CTRL(tdc_error);
+      STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(tdc_error);
+      STRUCT_MIRROR_ITEM_CTRL(buffer_overflow);
+      STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(buffer_overflow);
+      STRUCT_MIRROR_ITEM_CTRL(trigger_lost);
+      STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(trigger_lost);
+      STRUCT_MIRROR_ITEM_CTRL(unnamed_27_31);
+      STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(unnamed_27_31);
+    };
+#endif// !STRUCT_ONLY_LAST_UNION_MEMBER
+    STRUCT_MIRROR_ITEM_CTRL(u32);
+    STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(u32);
+  } STRUCT_MIRROR_NAME(trailer);
+  STRUCT_MIRROR_FCNS_DECL(VME_CAEN_V1190);
+};
+#endif//USER_DEF_VME_CAEN_V1190
+
+#ifndef USER_DEF_VME_CAEN_V1190_SHORT_SUBTDC
+STRUCT_MIRROR_TEMPLATE
+class STRUCT_MIRROR_STRUCT(VME_CAEN_V1190_SHORT_SUBTDC)
+{
+public:
+  STRUCT_MIRROR_FCNS_DECL(VME_CAEN_V1190_SHORT_SUBTDC);
+};
+#endif//USER_DEF_VME_CAEN_V1190_SHORT_SUBTDC
+
+#ifndef USER_DEF_VME_CAEN_V1190_SHORT_SUBTDC_ERROR
+STRUCT_MIRROR_TEMPLATE
+class STRUCT_MIRROR_STRUCT(VME_CAEN_V1190_SHORT_SUBTDC_ERROR)
+{
+public:
+#if STRUCT_ONLY_LAST_UNION_MEMBER
+  struct 
+#else
+  union 
+#endif
+
+  {
+  public:
+#if !STRUCT_ONLY_LAST_UNION_MEMBER
+    struct 
+    {
+    public:
+      STRUCT_MIRROR_ITEM_CTRL(flags);
+      STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(flags);
+      STRUCT_MIRROR_ITEM_CTRL(dummy_15_23);
+      STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(dummy_15_23);
+      STRUCT_MIRROR_ITEM_CTRL(tdc);
+      STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(tdc);
+      STRUCT_MIRROR_ITEM_CTRL(dummy_26);
+      STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(dummy_26);
+      STRUCT_MIRROR_ITEM_CTRL(unnamed_27_31);
+      STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(unnamed_27_31);
+    };
+#endif// !STRUCT_ONLY_LAST_UNION_MEMBER
+    STRUCT_MIRROR_ITEM_CTRL(u32);
+    STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(u32);
+  } STRUCT_MIRROR_NAME(error_flags);
+  STRUCT_MIRROR_FCNS_DECL(VME_CAEN_V1190_SHORT_SUBTDC_ERROR);
+};
+#endif//USER_DEF_VME_CAEN_V1190_SHORT_SUBTDC_ERROR
+
+#ifndef USER_DEF_VME_CAEN_V1190_SHORT
+STRUCT_MIRROR_TEMPLATE
+class STRUCT_MIRROR_STRUCT(VME_CAEN_V1190_SHORT)
+{
+public:
+  STRUCT_MIRROR_ITEM_CTRL(data);
+  STRUCT_MIRROR_TYPE(raw_array_multi_zero_suppress) < STRUCT_MIRROR_TYPE_TEMPLATE STRUCT_MIRROR_TEMPLATE_ARG(DATA24),STRUCT_MIRROR_TEMPLATE_ARG(DATA24),32,128> STRUCT_MIRROR_NAME(data);
+#if STRUCT_ONLY_LAST_UNION_MEMBER
+  struct 
+#else
+  union 
+#endif
+
+  {
+  public:
+#if !STRUCT_ONLY_LAST_UNION_MEMBER
+    struct 
+    {
+    public:
+      STRUCT_MIRROR_ITEM_CTRL(geom);
+      STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(geom);
+      STRUCT_MIRROR_ITEM_CTRL(event_number);
+      STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(event_number);
+      STRUCT_MIRROR_ITEM_CTRL(unnamed_27_31);
+      STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(unnamed_27_31);
+    };
+#endif// !STRUCT_ONLY_LAST_UNION_MEMBER
+    STRUCT_MIRROR_ITEM_CTRL(u32);
+    STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(u32);
+  } STRUCT_MIRROR_NAME(header);
+  STRUCT_MIRROR_ITEM_CTRL(tdc);
+  STRUCT_MIRROR_ITEM_CTRL_ARRAY(tdc__i0,,4);
+  STRUCT_MIRROR_TYPE(VME_CAEN_V1190_SHORT_SUBTDC) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(tdc[4]);
+  STRUCT_MIRROR_ITEM_CTRL(err);
+  STRUCT_MIRROR_ITEM_CTRL_ARRAY(err__i0,,4);
+  STRUCT_MIRROR_TYPE(VME_CAEN_V1190_SHORT_SUBTDC_ERROR) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(err[4]);
+#if STRUCT_ONLY_LAST_UNION_MEMBER
+  struct 
+#else
+  union 
+#endif
+
+  {
+  public:
+#if !STRUCT_ONLY_LAST_UNION_MEMBER
+    struct 
+    {
+    public:
+      STRUCT_MIRROR_ITEM_CTRL(time_tag);
+      STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(time_tag);
+      STRUCT_MIRROR_ITEM_CTRL(unnamed_27_31);
+      STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(unnamed_27_31);
+    };
+#endif// !STRUCT_ONLY_LAST_UNION_MEMBER
+    STRUCT_MIRROR_ITEM_CTRL(u32);
+    STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(u32);
+  } STRUCT_MIRROR_NAME(trigger);
+#if STRUCT_ONLY_LAST_UNION_MEMBER
+  struct 
+#else
+  union 
+#endif
+
+  {
+  public:
+#if !STRUCT_ONLY_LAST_UNION_MEMBER
+    struct 
+    {
+    public:
+      STRUCT_MIRROR_ITEM_CTRL(geom);
+      STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(geom);
+      STRUCT_MIRROR_ITEM_CTRL(word_count);
+      STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(word_count);
+      STRUCT_MIRROR_ITEM_CTRL(dummy_20_23);
+      STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(dummy_20_23);
+      STRUCT_MIRROR_ITEM_CTRL(tdc_error);
+      STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(tdc_error);
+      STRUCT_MIRROR_ITEM_CTRL(buffer_overflow);
+      STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(buffer_overflow);
+      STRUCT_MIRROR_ITEM_CTRL(trigger_lost);
+      STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(trigger_lost);
+      STRUCT_MIRROR_ITEM_CTRL(unnamed_27_31);
+      STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(unnamed_27_31);
+    };
+#endif// !STRUCT_ONLY_LAST_UNION_MEMBER
+    STRUCT_MIRROR_ITEM_CTRL(u32);
+    STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(u32);
+  } STRUCT_MIRROR_NAME(trailer);
+  STRUCT_MIRROR_FCNS_DECL(VME_CAEN_V1190_SHORT);
+};
+#endif//USER_DEF_VME_CAEN_V1190_SHORT
+
+#ifndef USER_DEF_VME_CAEN_V1290_SUBTDC
+STRUCT_MIRROR_TEMPLATE
+class STRUCT_MIRROR_STRUCT(VME_CAEN_V1290_SUBTDC)
+{
+public:
+#if STRUCT_ONLY_LAST_UNION_MEMBER
+  struct 
+#else
+  union 
+#endif
+
+  {
+  public:
+#if !STRUCT_ONLY_LAST_UNION_MEMBER
+    struct 
+    {
+    public:
+      STRUCT_MIRROR_ITEM_CTRL(bunch_id);
+      STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(bunch_id);
+      STRUCT_MIRROR_ITEM_CTRL(event_id);
+      STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(event_id);
+      STRUCT_MIRROR_ITEM_CTRL(tdc);
+      STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(tdc);
+      STRUCT_MIRROR_ITEM_CTRL(dummy_26);
+      STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(dummy_26);
+      STRUCT_MIRROR_ITEM_CTRL(unnamed_27_31);
+      STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(unnamed_27_31);
+    };
+#endif// !STRUCT_ONLY_LAST_UNION_MEMBER
+    STRUCT_MIRROR_ITEM_CTRL(u32);
+    STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(u32);
+  } STRUCT_MIRROR_NAME(header);
+#if STRUCT_ONLY_LAST_UNION_MEMBER
+  struct 
+#else
+  union 
+#endif
+
+  {
+  public:
+#if !STRUCT_ONLY_LAST_UNION_MEMBER
+    struct 
+    {
+    public:
+      STRUCT_MIRROR_ITEM_CTRL(flags);
+      STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(flags);
+      STRUCT_MIRROR_ITEM_CTRL(dummy_15_23);
+      STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(dummy_15_23);
+      STRUCT_MIRROR_ITEM_CTRL(tdc);
+      STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(tdc);
+      STRUCT_MIRROR_ITEM_CTRL(dummy_26);
+      STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(dummy_26);
+      STRUCT_MIRROR_ITEM_CTRL(unnamed_27_31);
+      STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(unnamed_27_31);
+    };
+#endif// !STRUCT_ONLY_LAST_UNION_MEMBER
+    STRUCT_MIRROR_ITEM_CTRL(u32);
+    STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(u32);
+  } STRUCT_MIRROR_NAME(error_flags);
+#if STRUCT_ONLY_LAST_UNION_MEMBER
+  struct 
+#else
+  union 
+#endif
+
+  {
+  public:
+#if !STRUCT_ONLY_LAST_UNION_MEMBER
+    struct 
+    {
+    public:
+      STRUCT_MIRROR_ITEM_CTRL(word_count);
+      STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(word_count);
+      STRUCT_MIRROR_ITEM_CTRL(event_id);
+      STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(event_id);
+      STRUCT_MIRROR_ITEM_CTRL(tdc);
+      STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(tdc);
+      STRUCT_MIRROR_ITEM_CTRL(dummy_26);
+      STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(dummy_26);
+      STRUCT_MIRROR_ITEM_CTRL(unnamed_27_31);
+      STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(unnamed_27_31);
+    };
+#endif// !STRUCT_ONLY_LAST_UNION_MEMBER
+    STRUCT_MIRROR_ITEM_CTRL(u32);
+    STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(u32);
+  } STRUCT_MIRROR_NAME(trailer);
+  STRUCT_MIRROR_FCNS_DECL(VME_CAEN_V1290_SUBTDC);
+};
+#endif//USER_DEF_VME_CAEN_V1290_SUBTDC
+
+#ifndef USER_DEF_VME_CAEN_V1290
+STRUCT_MIRROR_TEMPLATE
+class STRUCT_MIRROR_STRUCT(VME_CAEN_V1290)
+{
+public:
+  STRUCT_MIRROR_ITEM_CTRL(data);
+  STRUCT_MIRROR_TYPE(raw_array_multi_zero_suppress) < STRUCT_MIRROR_TYPE_TEMPLATE STRUCT_MIRROR_TEMPLATE_ARG(DATA24),STRUCT_MIRROR_TEMPLATE_ARG(DATA24),32,128> STRUCT_MIRROR_NAME(data);
+#if STRUCT_ONLY_LAST_UNION_MEMBER
+  struct 
+#else
+  union 
+#endif
+
+  {
+  public:
+#if !STRUCT_ONLY_LAST_UNION_MEMBER
+    struct 
+    {
+    public:
+      STRUCT_MIRROR_ITEM_CTRL(geom);
+      STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(geom);
+      STRUCT_MIRROR_ITEM_CTRL(event_number);
+      STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(event_number);
+      STRUCT_MIRROR_ITEM_CTRL(unnamed_27_31);
+      STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(unnamed_27_31);
+    };
+#endif// !STRUCT_ONLY_LAST_UNION_MEMBER
+    STRUCT_MIRROR_ITEM_CTRL(u32);
+    STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(u32);
+  } STRUCT_MIRROR_NAME(header);
+  STRUCT_MIRROR_ITEM_CTRL(tdc);
+  STRUCT_MIRROR_ITEM_CTRL_ARRAY(tdc__i0,,4);
+  STRUCT_MIRROR_TYPE(VME_CAEN_V1290_SUBTDC) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(tdc[4]);
+#if STRUCT_ONLY_LAST_UNION_MEMBER
+  struct 
+#else
+  union 
+#endif
+
+  {
+  public:
+#if !STRUCT_ONLY_LAST_UNION_MEMBER
+    struct 
+    {
+    public:
+      STRUCT_MIRROR_ITEM_CTRL(time_tag);
+      STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(time_tag);
+      STRUCT_MIRROR_ITEM_CTRL(unnamed_27_31);
+      STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(unnamed_27_31);
+    };
+#endif// !STRUCT_ONLY_LAST_UNION_MEMBER
+    STRUCT_MIRROR_ITEM_CTRL(u32);
+    STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(u32);
+  } STRUCT_MIRROR_NAME(trigger);
+#if STRUCT_ONLY_LAST_UNION_MEMBER
+  struct 
+#else
+  union 
+#endif
+
+  {
+  public:
+#if !STRUCT_ONLY_LAST_UNION_MEMBER
+    struct 
+    {
+    public:
+      STRUCT_MIRROR_ITEM_CTRL(geom);
+      STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(geom);
+      STRUCT_MIRROR_ITEM_CTRL(word_count);
+      STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(word_count);
+      STRUCT_MIRROR_ITEM_CTRL(dummy_20_23);
+      STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(dummy_20_23);
+      STRUCT_MIRROR_ITEM_CTRL(tdc_error);
+      STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(tdc_error);
+      STRUCT_MIRROR_ITEM_CTRL(buffer_overflow);
+      STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(buffer_overflow);
+      STRUCT_MIRROR_ITEM_CTRL(trigger_lost);
+      STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(trigger_lost);
+      STRUCT_MIRROR_ITEM_CTRL(unnamed_27_31);
+      STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(unnamed_27_31);
+    };
+#endif// !STRUCT_ONLY_LAST_UNION_MEMBER
+    STRUCT_MIRROR_ITEM_CTRL(u32);
+    STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(u32);
+  } STRUCT_MIRROR_NAME(trailer);
+  STRUCT_MIRROR_FCNS_DECL(VME_CAEN_V1290);
+};
+#endif//USER_DEF_VME_CAEN_V1290
+
+#ifndef USER_DEF_VME_CAEN_V1290_SHORT_SUBTDC
+STRUCT_MIRROR_TEMPLATE
+class STRUCT_MIRROR_STRUCT(VME_CAEN_V1290_SHORT_SUBTDC)
+{
+public:
+  STRUCT_MIRROR_FCNS_DECL(VME_CAEN_V1290_SHORT_SUBTDC);
+};
+#endif//USER_DEF_VME_CAEN_V1290_SHORT_SUBTDC
+
+#ifndef USER_DEF_VME_CAEN_V1290_SHORT_SUBTDC_ERROR
+STRUCT_MIRROR_TEMPLATE
+class STRUCT_MIRROR_STRUCT(VME_CAEN_V1290_SHORT_SUBTDC_ERROR)
+{
+public:
+#if STRUCT_ONLY_LAST_UNION_MEMBER
+  struct 
+#else
+  union 
+#endif
+
+  {
+  public:
+#if !STRUCT_ONLY_LAST_UNION_MEMBER
+    struct 
+    {
+    public:
+      STRUCT_MIRROR_ITEM_CTRL(flags);
+      STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(flags);
+      STRUCT_MIRROR_ITEM_CTRL(dummy_15_23);
+      STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(dummy_15_23);
+      STRUCT_MIRROR_ITEM_CTRL(tdc);
+      STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(tdc);
+      STRUCT_MIRROR_ITEM_CTRL(dummy_26);
+      STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(dummy_26);
+      STRUCT_MIRROR_ITEM_CTRL(unnamed_27_31);
+      STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(unnamed_27_31);
+    };
+#endif// !STRUCT_ONLY_LAST_UNION_MEMBER
+    STRUCT_MIRROR_ITEM_CTRL(u32);
+    STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(u32);
+  } STRUCT_MIRROR_NAME(error_flags);
+  STRUCT_MIRROR_FCNS_DECL(VME_CAEN_V1290_SHORT_SUBTDC_ERROR);
+};
+#endif//USER_DEF_VME_CAEN_V1290_SHORT_SUBTDC_ERROR
+
+#ifndef USER_DEF_VME_CAEN_V1290_SHORT
+STRUCT_MIRROR_TEMPLATE
+class STRUCT_MIRROR_STRUCT(VME_CAEN_V1290_SHORT)
+{
+public:
+  STRUCT_MIRROR_ITEM_CTRL(data);
+  STRUCT_MIRROR_TYPE(raw_array_multi_zero_suppress) < STRUCT_MIRROR_TYPE_TEMPLATE STRUCT_MIRROR_TEMPLATE_ARG(DATA24),STRUCT_MIRROR_TEMPLATE_ARG(DATA24),32,128> STRUCT_MIRROR_NAME(data);
+#if STRUCT_ONLY_LAST_UNION_MEMBER
+  struct 
+#else
+  union 
+#endif
+
+  {
+  public:
+#if !STRUCT_ONLY_LAST_UNION_MEMBER
+    struct 
+    {
+    public:
+      STRUCT_MIRROR_ITEM_CTRL(geom);
+      STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(geom);
+      STRUCT_MIRROR_ITEM_CTRL(event_number);
+      STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(event_number);
+      STRUCT_MIRROR_ITEM_CTRL(unnamed_27_31);
+      STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(unnamed_27_31);
+    };
+#endif// !STRUCT_ONLY_LAST_UNION_MEMBER
+    STRUCT_MIRROR_ITEM_CTRL(u32);
+    STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(u32);
+  } STRUCT_MIRROR_NAME(header);
+  STRUCT_MIRROR_ITEM_CTRL(tdc);
+  STRUCT_MIRROR_ITEM_CTRL_ARRAY(tdc__i0,,4);
+  STRUCT_MIRROR_TYPE(VME_CAEN_V1290_SHORT_SUBTDC) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(tdc[4]);
+  STRUCT_MIRROR_ITEM_CTRL(err);
+  STRUCT_MIRROR_ITEM_CTRL_ARRAY(err__i0,,4);
+  STRUCT_MIRROR_TYPE(VME_CAEN_V1290_SHORT_SUBTDC_ERROR) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(err[4]);
+#if STRUCT_ONLY_LAST_UNION_MEMBER
+  struct 
+#else
+  union 
+#endif
+
+  {
+  public:
+#if !STRUCT_ONLY_LAST_UNION_MEMBER
+    struct 
+    {
+    public:
+      STRUCT_MIRROR_ITEM_CTRL(time_tag);
+      STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(time_tag);
+      STRUCT_MIRROR_ITEM_CTRL(unnamed_27_31);
+      STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(unnamed_27_31);
+    };
+#endif// !STRUCT_ONLY_LAST_UNION_MEMBER
+    STRUCT_MIRROR_ITEM_CTRL(u32);
+    STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(u32);
+  } STRUCT_MIRROR_NAME(trigger);
+#if STRUCT_ONLY_LAST_UNION_MEMBER
+  struct 
+#else
+  union 
+#endif
+
+  {
+  public:
+#if !STRUCT_ONLY_LAST_UNION_MEMBER
+    struct 
+    {
+    public:
+      STRUCT_MIRROR_ITEM_CTRL(geom);
+      STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(geom);
+      STRUCT_MIRROR_ITEM_CTRL(word_count);
+      STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(word_count);
+      STRUCT_MIRROR_ITEM_CTRL(dummy_20_23);
+      STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(dummy_20_23);
+      STRUCT_MIRROR_ITEM_CTRL(tdc_error);
+      STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(tdc_error);
+      STRUCT_MIRROR_ITEM_CTRL(buffer_overflow);
+      STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(buffer_overflow);
+      STRUCT_MIRROR_ITEM_CTRL(trigger_lost);
+      STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(trigger_lost);
+      STRUCT_MIRROR_ITEM_CTRL(unnamed_27_31);
+      STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(unnamed_27_31);
+    };
+#endif// !STRUCT_ONLY_LAST_UNION_MEMBER
+    STRUCT_MIRROR_ITEM_CTRL(u32);
+    STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(u32);
+  } STRUCT_MIRROR_NAME(trailer);
+  STRUCT_MIRROR_FCNS_DECL(VME_CAEN_V1290_SHORT);
+};
+#endif//USER_DEF_VME_CAEN_V1290_SHORT
+
+#ifndef USER_DEF_VME_CAEN_V775
+STRUCT_MIRROR_TEMPLATE
+class STRUCT_MIRROR_STRUCT(VME_CAEN_V775)
+{
+public:
+  STRUCT_MIRROR_ITEM_CTRL(data);
+  STRUCT_MIRROR_TYPE(raw_array_zero_suppress) < STRUCT_MIRROR_TYPE_TEMPLATE STRUCT_MIRROR_TEMPLATE_ARG(DATA12_OVERFLOW),STRUCT_MIRROR_TEMPLATE_ARG(DATA12_OVERFLOW),32> STRUCT_MIRROR_NAME(data);
+#if STRUCT_ONLY_LAST_UNION_MEMBER
+  struct 
+#else
+  union 
+#endif
+
+  {
+  public:
+#if !STRUCT_ONLY_LAST_UNION_MEMBER
+    struct 
+    {
+    public:
+      STRUCT_MIRROR_ITEM_CTRL(event_number);
+      STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(event_number);
+      STRUCT_MIRROR_ITEM_CTRL(unnamed_24_26);
+      STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(unnamed_24_26);
+      STRUCT_MIRROR_ITEM_CTRL(geom);
+      STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(geom);
+    };
+#endif// !STRUCT_ONLY_LAST_UNION_MEMBER
+    STRUCT_MIRROR_ITEM_CTRL(u32);
+    STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(u32);
+  } STRUCT_MIRROR_NAME(eob);
+  STRUCT_MIRROR_FCNS_DECL(VME_CAEN_V775);
+};
+#endif//USER_DEF_VME_CAEN_V775
+
+#ifndef USER_DEF_VME_CAEN_V830
+STRUCT_MIRROR_TEMPLATE
+class STRUCT_MIRROR_STRUCT(VME_CAEN_V830)
+{
+public:
+  STRUCT_MIRROR_ITEM_CTRL(data);
+  STRUCT_MIRROR_TYPE(raw_array_zero_suppress) < STRUCT_MIRROR_TYPE_TEMPLATE STRUCT_MIRROR_TEMPLATE_ARG(DATA32),STRUCT_MIRROR_TEMPLATE_ARG(DATA32),32> STRUCT_MIRROR_NAME(data);
+#if STRUCT_ONLY_LAST_UNION_MEMBER
+  struct 
+#else
+  union 
+#endif
+
+  {
+  public:
+#if !STRUCT_ONLY_LAST_UNION_MEMBER
+    struct 
+    {
+    public:
+      STRUCT_MIRROR_ITEM_CTRL(event_number);
+      STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(event_number);
+      STRUCT_MIRROR_ITEM_CTRL(ts);
+      STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(ts);
+      STRUCT_MIRROR_ITEM_CTRL(count);
+      STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(count);
+      STRUCT_MIRROR_ITEM_CTRL(dummy_24_25);
+      STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(dummy_24_25);
+      STRUCT_MIRROR_ITEM_CTRL(unnamed_26_26);
+      STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(unnamed_26_26);
+      STRUCT_MIRROR_ITEM_CTRL(geom);
+      STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(geom);
+    };
+#endif// !STRUCT_ONLY_LAST_UNION_MEMBER
+    STRUCT_MIRROR_ITEM_CTRL(u32);
+    STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(u32);
+  } STRUCT_MIRROR_NAME(header);
+  STRUCT_MIRROR_FCNS_DECL(VME_CAEN_V830);
+};
+#endif//USER_DEF_VME_CAEN_V830
+
+#ifndef USER_DEF_VME_MESYTEC_MADC32
+STRUCT_MIRROR_TEMPLATE
+class STRUCT_MIRROR_STRUCT(VME_MESYTEC_MADC32)
+{
+public:
+  STRUCT_MIRROR_ITEM_CTRL(data);
+  STRUCT_MIRROR_TYPE(raw_array_zero_suppress) < STRUCT_MIRROR_TYPE_TEMPLATE STRUCT_MIRROR_TEMPLATE_ARG(DATA14_OVERFLOW),STRUCT_MIRROR_TEMPLATE_ARG(DATA14_OVERFLOW),32> STRUCT_MIRROR_NAME(data);
+#if STRUCT_ONLY_LAST_UNION_MEMBER
+  struct 
+#else
+  union 
+#endif
+
+  {
+  public:
+#if !STRUCT_ONLY_LAST_UNION_MEMBER
+    struct 
+    {
+    public:
+      STRUCT_MIRROR_ITEM_CTRL(counter);
+      STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(counter);
+      STRUCT_MIRROR_ITEM_CTRL(unnamed_30_31);
+      STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(unnamed_30_31);
+    };
+#endif// !STRUCT_ONLY_LAST_UNION_MEMBER
+    STRUCT_MIRROR_ITEM_CTRL(u32);
+    STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(u32);
+  } STRUCT_MIRROR_NAME(end_of_event);
+  STRUCT_MIRROR_FCNS_DECL(VME_MESYTEC_MADC32);
+};
+#endif//USER_DEF_VME_MESYTEC_MADC32
+
+#ifndef USER_DEF_VME_MESYTEC_MDPP16
+STRUCT_MIRROR_TEMPLATE
+class STRUCT_MIRROR_STRUCT(VME_MESYTEC_MDPP16)
+{
+public:
+  STRUCT_MIRROR_ITEM_CTRL(adc);
+  STRUCT_MIRROR_TYPE(raw_array_multi_zero_suppress) < STRUCT_MIRROR_TYPE_TEMPLATE STRUCT_MIRROR_TEMPLATE_ARG(DATA16_OVERFLOW),STRUCT_MIRROR_TEMPLATE_ARG(DATA16_OVERFLOW),16,20> STRUCT_MIRROR_NAME(adc);
+  STRUCT_MIRROR_ITEM_CTRL(tdc);
+  STRUCT_MIRROR_TYPE(raw_array_multi_zero_suppress) < STRUCT_MIRROR_TYPE_TEMPLATE STRUCT_MIRROR_TEMPLATE_ARG(DATA16_OVERFLOW),STRUCT_MIRROR_TEMPLATE_ARG(DATA16_OVERFLOW),16,20> STRUCT_MIRROR_NAME(tdc);
+  STRUCT_MIRROR_ITEM_CTRL(trig_tdc);
+  STRUCT_MIRROR_TYPE(raw_array_multi_zero_suppress) < STRUCT_MIRROR_TYPE_TEMPLATE STRUCT_MIRROR_TEMPLATE_ARG(DATA16_OVERFLOW),STRUCT_MIRROR_TEMPLATE_ARG(DATA16_OVERFLOW),16,20> STRUCT_MIRROR_NAME(trig_tdc);
+  STRUCT_MIRROR_ITEM_CTRL(adc_short);
+  STRUCT_MIRROR_TYPE(raw_array_multi_zero_suppress) < STRUCT_MIRROR_TYPE_TEMPLATE STRUCT_MIRROR_TEMPLATE_ARG(DATA16_OVERFLOW),STRUCT_MIRROR_TEMPLATE_ARG(DATA16_OVERFLOW),16,20> STRUCT_MIRROR_NAME(adc_short);
+#if STRUCT_ONLY_LAST_UNION_MEMBER
+  struct 
+#else
+  union 
+#endif
+
+  {
+  public:
+#if !STRUCT_ONLY_LAST_UNION_MEMBER
+    struct 
+    {
+    public:
+      STRUCT_MIRROR_ITEM_CTRL(counter);
+      STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(counter);
+      STRUCT_MIRROR_ITEM_CTRL(unnamed_30_31);
+      STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(unnamed_30_31);
+    };
+#endif// !STRUCT_ONLY_LAST_UNION_MEMBER
+    STRUCT_MIRROR_ITEM_CTRL(u32);
+    STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(u32);
+  } STRUCT_MIRROR_NAME(end_of_event);
+  STRUCT_MIRROR_FCNS_DECL(VME_MESYTEC_MDPP16);
+};
+#endif//USER_DEF_VME_MESYTEC_MDPP16
+
+#ifndef USER_DEF_WR_STAMP
+STRUCT_MIRROR_TEMPLATE
+class STRUCT_MIRROR_STRUCT(WR_STAMP)
+{
+public:
+  STRUCT_MIRROR_ITEM_CTRL(srcid);
+  STRUCT_MIRROR_TYPE(DATA16) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(srcid);
+  STRUCT_MIRROR_ITEM_CTRL(err);
+  STRUCT_MIRROR_TYPE(DATA16) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(err);
+  STRUCT_MIRROR_ITEM_CTRL(t1);
+  STRUCT_MIRROR_TYPE(DATA16) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(t1);
+  STRUCT_MIRROR_ITEM_CTRL(t2);
+  STRUCT_MIRROR_TYPE(DATA16) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(t2);
+  STRUCT_MIRROR_ITEM_CTRL(t3);
+  STRUCT_MIRROR_TYPE(DATA16) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(t3);
+  STRUCT_MIRROR_ITEM_CTRL(t4);
+  STRUCT_MIRROR_TYPE(DATA16) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(t4);
+  STRUCT_MIRROR_FCNS_DECL(WR_STAMP);
+};
+#endif//USER_DEF_WR_STAMP
+
+#ifndef USER_DEF_XTST_STD_VME
+STRUCT_MIRROR_TEMPLATE
+class STRUCT_MIRROR_STRUCT(XTST_STD_VME)
+{
+public:
+#if STRUCT_ONLY_LAST_UNION_MEMBER
+  struct 
+#else
+  union 
+#endif
+
+  {
+  public:
+#if !STRUCT_ONLY_LAST_UNION_MEMBER
+    struct 
+    {
+    public:
+      STRUCT_MIRROR_ITEM_CTRL(fail_general);
+      STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(fail_general);
+      STRUCT_MIRROR_ITEM_CTRL(fail_data_corrupt);
+      STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(fail_data_corrupt);
+      STRUCT_MIRROR_ITEM_CTRL(fail_data_missing);
+      STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(fail_data_missing);
+      STRUCT_MIRROR_ITEM_CTRL(fail_data_too_much);
+      STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(fail_data_too_much);
+      STRUCT_MIRROR_ITEM_CTRL(fail_event_counter_mismatch);
+      STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(fail_event_counter_mismatch);
+      STRUCT_MIRROR_ITEM_CTRL(fail_readout_error_driver);
+      STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(fail_readout_error_driver);
+      STRUCT_MIRROR_ITEM_CTRL(fail_unexpected_trigger);
+      STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(fail_unexpected_trigger);
+      STRUCT_MIRROR_ITEM_CTRL(dummy_7_26);
+      STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(dummy_7_26);
+      STRUCT_MIRROR_ITEM_CTRL(has_no_zero_suppression);
+      STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(has_no_zero_suppression);
+      STRUCT_MIRROR_ITEM_CTRL(has_multi_adctdc_counter0);
+      STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(has_multi_adctdc_counter0);
+      STRUCT_MIRROR_ITEM_CTRL(has_multi_scaler_counter0);
+      STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(has_multi_scaler_counter0);
+      STRUCT_MIRROR_ITEM_CTRL(has_multi_event);
+      STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(has_multi_event);
+      STRUCT_MIRROR_ITEM_CTRL(has_time_stamp);
+      STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(has_time_stamp);
+    };
+#endif// !STRUCT_ONLY_LAST_UNION_MEMBER
+    STRUCT_MIRROR_ITEM_CTRL(u32);
+    STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(u32);
+  } STRUCT_MIRROR_NAME(failure);
+  STRUCT_MIRROR_ITEM_CTRL(time_stamp);
+  STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(time_stamp);
+  STRUCT_MIRROR_ITEM_CTRL(multi_events);
+  STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(multi_events);
+  STRUCT_MIRROR_ITEM_CTRL(multi_scaler_counter0);
+  STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(multi_scaler_counter0);
+  STRUCT_MIRROR_ITEM_CTRL(multi_adctdc_counter0);
+  STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(multi_adctdc_counter0);
+  STRUCT_MIRROR_FCNS_DECL(XTST_STD_VME);
+};
+#endif//USER_DEF_XTST_STD_VME
+
+#ifndef USER_DEF_XTST_SUBEVENT_MEMBER_DATA12
+STRUCT_MIRROR_TEMPLATE
+class STRUCT_MIRROR_STRUCT(XTST_SUBEVENT_MEMBER_DATA12)
+{
+public:
+  STRUCT_MIRROR_ITEM_CTRL(mDATA12);
+  STRUCT_MIRROR_TYPE(DATA12) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(mDATA12);
+  STRUCT_MIRROR_ITEM_CTRL(mDATA12_array);
+  STRUCT_MIRROR_TYPE(raw_array) < STRUCT_MIRROR_TYPE_TEMPLATE STRUCT_MIRROR_TEMPLATE_ARG(DATA12),STRUCT_MIRROR_TEMPLATE_ARG(DATA12),8> STRUCT_MIRROR_NAME(mDATA12_array);
+  STRUCT_MIRROR_ITEM_CTRL(mDATA12_array_zzp);
+  STRUCT_MIRROR_TYPE(raw_array_zero_suppress) < STRUCT_MIRROR_TYPE_TEMPLATE STRUCT_MIRROR_TEMPLATE_ARG(DATA12),STRUCT_MIRROR_TEMPLATE_ARG(DATA12),8> STRUCT_MIRROR_NAME(mDATA12_array_zzp);
+  STRUCT_MIRROR_ITEM_CTRL(mDATA12_array_zzpii);
+  STRUCT_MIRROR_TYPE(raw_list_zero_suppress) < STRUCT_MIRROR_TYPE_TEMPLATE STRUCT_MIRROR_TEMPLATE_ARG(DATA12),STRUCT_MIRROR_TEMPLATE_ARG(DATA12),8> STRUCT_MIRROR_NAME(mDATA12_array_zzpii);
+  STRUCT_MIRROR_ITEM_CTRL(mDATA12_array_zzpml);
+  STRUCT_MIRROR_TYPE(raw_array_multi_zero_suppress) < STRUCT_MIRROR_TYPE_TEMPLATE STRUCT_MIRROR_TEMPLATE_ARG(DATA12),STRUCT_MIRROR_TEMPLATE_ARG(DATA12),8,4> STRUCT_MIRROR_NAME(mDATA12_array_zzpml);
+  STRUCT_MIRROR_ITEM_CTRL(mDATA12_array2);
+  STRUCT_MIRROR_ITEM_CTRL_ARRAY(mDATA12_array2__i0,,2);
+  STRUCT_MIRROR_TYPE(raw_array) < STRUCT_MIRROR_TYPE_TEMPLATE STRUCT_MIRROR_TEMPLATE_ARG(DATA12),STRUCT_MIRROR_TEMPLATE_ARG(DATA12),8> STRUCT_MIRROR_NAME(mDATA12_array2[2]);
+  STRUCT_MIRROR_ITEM_CTRL(mDATA12_array2_zzp);
+  STRUCT_MIRROR_ITEM_CTRL_ARRAY(mDATA12_array2_zzp__i0,,2);
+  STRUCT_MIRROR_TYPE(raw_array_zero_suppress) < STRUCT_MIRROR_TYPE_TEMPLATE STRUCT_MIRROR_TEMPLATE_ARG(DATA12),STRUCT_MIRROR_TEMPLATE_ARG(DATA12),8> STRUCT_MIRROR_NAME(mDATA12_array2_zzp[2]);
+  STRUCT_MIRROR_ITEM_CTRL(mDATA12_array2_zzpii);
+  STRUCT_MIRROR_ITEM_CTRL_ARRAY(mDATA12_array2_zzpii__i0,,2);
+  STRUCT_MIRROR_TYPE(raw_list_zero_suppress) < STRUCT_MIRROR_TYPE_TEMPLATE STRUCT_MIRROR_TEMPLATE_ARG(DATA12),STRUCT_MIRROR_TEMPLATE_ARG(DATA12),8> STRUCT_MIRROR_NAME(mDATA12_array2_zzpii[2]);
+  STRUCT_MIRROR_ITEM_CTRL(mDATA12_array2_zzpml);
+  STRUCT_MIRROR_ITEM_CTRL_ARRAY(mDATA12_array2_zzpml__i0,,2);
+  STRUCT_MIRROR_TYPE(raw_array_multi_zero_suppress) < STRUCT_MIRROR_TYPE_TEMPLATE STRUCT_MIRROR_TEMPLATE_ARG(DATA12),STRUCT_MIRROR_TEMPLATE_ARG(DATA12),8,4> STRUCT_MIRROR_NAME(mDATA12_array2_zzpml[2]);
+  STRUCT_MIRROR_FCNS_DECL(XTST_SUBEVENT_MEMBER_DATA12);
+};
+#endif//USER_DEF_XTST_SUBEVENT_MEMBER_DATA12
+
+#ifndef USER_DEF_XTST_SUBEVENT_MEMBER_DATA12_OVERFLOW
+STRUCT_MIRROR_TEMPLATE
+class STRUCT_MIRROR_STRUCT(XTST_SUBEVENT_MEMBER_DATA12_OVERFLOW)
+{
+public:
+  STRUCT_MIRROR_ITEM_CTRL(mDATA12_OVERFLOW);
+  STRUCT_MIRROR_TYPE(DATA12_OVERFLOW) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(mDATA12_OVERFLOW);
+  STRUCT_MIRROR_ITEM_CTRL(mDATA12_OVERFLOW_array);
+  STRUCT_MIRROR_TYPE(raw_array) < STRUCT_MIRROR_TYPE_TEMPLATE STRUCT_MIRROR_TEMPLATE_ARG(DATA12_OVERFLOW),STRUCT_MIRROR_TEMPLATE_ARG(DATA12_OVERFLOW),8> STRUCT_MIRROR_NAME(mDATA12_OVERFLOW_array);
+  STRUCT_MIRROR_ITEM_CTRL(mDATA12_OVERFLOW_array_zzp);
+  STRUCT_MIRROR_TYPE(raw_array_zero_suppress) < STRUCT_MIRROR_TYPE_TEMPLATE STRUCT_MIRROR_TEMPLATE_ARG(DATA12_OVERFLOW),STRUCT_MIRROR_TEMPLATE_ARG(DATA12_OVERFLOW),8> STRUCT_MIRROR_NAME(mDATA12_OVERFLOW_array_zzp);
+  STRUCT_MIRROR_ITEM_CTRL(mDATA12_OVERFLOW_array_zzpii);
+  STRUCT_MIRROR_TYPE(raw_list_zero_suppress) < STRUCT_MIRROR_TYPE_TEMPLATE STRUCT_MIRROR_TEMPLATE_ARG(DATA12_OVERFLOW),STRUCT_MIRROR_TEMPLATE_ARG(DATA12_OVERFLOW),8> STRUCT_MIRROR_NAME(mDATA12_OVERFLOW_array_zzpii);
+  STRUCT_MIRROR_ITEM_CTRL(mDATA12_OVERFLOW_array_zzpml);
+  STRUCT_MIRROR_TYPE(raw_array_multi_zero_suppress) < STRUCT_MIRROR_TYPE_TEMPLATE STRUCT_MIRROR_TEMPLATE_ARG(DATA12_OVERFLOW),STRUCT_MIRROR_TEMPLATE_ARG(DATA12_OVERFLOW),8,4> STRUCT_MIRROR_NAME(mDATA12_OVERFLOW_array_zzpml);
+  STRUCT_MIRROR_ITEM_CTRL(mDATA12_OVERFLOW_array2);
+  STRUCT_MIRROR_ITEM_CTRL_ARRAY(mDATA12_OVERFLOW_array2__i0,,2);
+  STRUCT_MIRROR_TYPE(raw_array) < STRUCT_MIRROR_TYPE_TEMPLATE STRUCT_MIRROR_TEMPLATE_ARG(DATA12_OVERFLOW),STRUCT_MIRROR_TEMPLATE_ARG(DATA12_OVERFLOW),8> STRUCT_MIRROR_NAME(mDATA12_OVERFLOW_array2[2]);
+  STRUCT_MIRROR_ITEM_CTRL(mDATA12_OVERFLOW_array2_zzp);
+  STRUCT_MIRROR_ITEM_CTRL_ARRAY(mDATA12_OVERFLOW_array2_zzp__i0,,2);
+  STRUCT_MIRROR_TYPE(raw_array_zero_suppress) < STRUCT_MIRROR_TYPE_TEMPLATE STRUCT_MIRROR_TEMPLATE_ARG(DATA12_OVERFLOW),STRUCT_MIRROR_TEMPLATE_ARG(DATA12_OVERFLOW),8> STRUCT_MIRROR_NAME(mDATA12_OVERFLOW_array2_zzp[2]);
+  STRUCT_MIRROR_ITEM_CTRL(mDATA12_OVERFLOW_array2_zzpii);
+  STRUCT_MIRROR_ITEM_CTRL_ARRAY(mDATA12_OVERFLOW_array2_zzpii__i0,,2);
+  STRUCT_MIRROR_TYPE(raw_list_zero_suppress) < STRUCT_MIRROR_TYPE_TEMPLATE STRUCT_MIRROR_TEMPLATE_ARG(DATA12_OVERFLOW),STRUCT_MIRROR_TEMPLATE_ARG(DATA12_OVERFLOW),8> STRUCT_MIRROR_NAME(mDATA12_OVERFLOW_array2_zzpii[2]);
+  STRUCT_MIRROR_ITEM_CTRL(mDATA12_OVERFLOW_array2_zzpml);
+  STRUCT_MIRROR_ITEM_CTRL_ARRAY(mDATA12_OVERFLOW_array2_zzpml__i0,,2);
+  STRUCT_MIRROR_TYPE(raw_array_multi_zero_suppress) < STRUCT_MIRROR_TYPE_TEMPLATE STRUCT_MIRROR_TEMPLATE_ARG(DATA12_OVERFLOW),STRUCT_MIRROR_TEMPLATE_ARG(DATA12_OVERFLOW),8,4> STRUCT_MIRROR_NAME(mDATA12_OVERFLOW_array2_zzpml[2]);
+  STRUCT_MIRROR_FCNS_DECL(XTST_SUBEVENT_MEMBER_DATA12_OVERFLOW);
+};
+#endif//USER_DEF_XTST_SUBEVENT_MEMBER_DATA12_OVERFLOW
+
+#ifndef USER_DEF_XTST_SUBEVENT_MEMBER_DATA12_RANGE
+STRUCT_MIRROR_TEMPLATE
+class STRUCT_MIRROR_STRUCT(XTST_SUBEVENT_MEMBER_DATA12_RANGE)
+{
+public:
+  STRUCT_MIRROR_ITEM_CTRL(mDATA12_RANGE);
+  STRUCT_MIRROR_TYPE(DATA12_RANGE) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(mDATA12_RANGE);
+  STRUCT_MIRROR_ITEM_CTRL(mDATA12_RANGE_array);
+  STRUCT_MIRROR_TYPE(raw_array) < STRUCT_MIRROR_TYPE_TEMPLATE STRUCT_MIRROR_TEMPLATE_ARG(DATA12_RANGE),STRUCT_MIRROR_TEMPLATE_ARG(DATA12_RANGE),8> STRUCT_MIRROR_NAME(mDATA12_RANGE_array);
+  STRUCT_MIRROR_ITEM_CTRL(mDATA12_RANGE_array_zzp);
+  STRUCT_MIRROR_TYPE(raw_array_zero_suppress) < STRUCT_MIRROR_TYPE_TEMPLATE STRUCT_MIRROR_TEMPLATE_ARG(DATA12_RANGE),STRUCT_MIRROR_TEMPLATE_ARG(DATA12_RANGE),8> STRUCT_MIRROR_NAME(mDATA12_RANGE_array_zzp);
+  STRUCT_MIRROR_ITEM_CTRL(mDATA12_RANGE_array_zzpii);
+  STRUCT_MIRROR_TYPE(raw_list_zero_suppress) < STRUCT_MIRROR_TYPE_TEMPLATE STRUCT_MIRROR_TEMPLATE_ARG(DATA12_RANGE),STRUCT_MIRROR_TEMPLATE_ARG(DATA12_RANGE),8> STRUCT_MIRROR_NAME(mDATA12_RANGE_array_zzpii);
+  STRUCT_MIRROR_ITEM_CTRL(mDATA12_RANGE_array_zzpml);
+  STRUCT_MIRROR_TYPE(raw_array_multi_zero_suppress) < STRUCT_MIRROR_TYPE_TEMPLATE STRUCT_MIRROR_TEMPLATE_ARG(DATA12_RANGE),STRUCT_MIRROR_TEMPLATE_ARG(DATA12_RANGE),8,4> STRUCT_MIRROR_NAME(mDATA12_RANGE_array_zzpml);
+  STRUCT_MIRROR_ITEM_CTRL(mDATA12_RANGE_array2);
+  STRUCT_MIRROR_ITEM_CTRL_ARRAY(mDATA12_RANGE_array2__i0,,2);
+  STRUCT_MIRROR_TYPE(raw_array) < STRUCT_MIRROR_TYPE_TEMPLATE STRUCT_MIRROR_TEMPLATE_ARG(DATA12_RANGE),STRUCT_MIRROR_TEMPLATE_ARG(DATA12_RANGE),8> STRUCT_MIRROR_NAME(mDATA12_RANGE_array2[2]);
+  STRUCT_MIRROR_ITEM_CTRL(mDATA12_RANGE_array2_zzp);
+  STRUCT_MIRROR_ITEM_CTRL_ARRAY(mDATA12_RANGE_array2_zzp__i0,,2);
+  STRUCT_MIRROR_TYPE(raw_array_zero_suppress) < STRUCT_MIRROR_TYPE_TEMPLATE STRUCT_MIRROR_TEMPLATE_ARG(DATA12_RANGE),STRUCT_MIRROR_TEMPLATE_ARG(DATA12_RANGE),8> STRUCT_MIRROR_NAME(mDATA12_RANGE_array2_zzp[2]);
+  STRUCT_MIRROR_ITEM_CTRL(mDATA12_RANGE_array2_zzpii);
+  STRUCT_MIRROR_ITEM_CTRL_ARRAY(mDATA12_RANGE_array2_zzpii__i0,,2);
+  STRUCT_MIRROR_TYPE(raw_list_zero_suppress) < STRUCT_MIRROR_TYPE_TEMPLATE STRUCT_MIRROR_TEMPLATE_ARG(DATA12_RANGE),STRUCT_MIRROR_TEMPLATE_ARG(DATA12_RANGE),8> STRUCT_MIRROR_NAME(mDATA12_RANGE_array2_zzpii[2]);
+  STRUCT_MIRROR_ITEM_CTRL(mDATA12_RANGE_array2_zzpml);
+  STRUCT_MIRROR_ITEM_CTRL_ARRAY(mDATA12_RANGE_array2_zzpml__i0,,2);
+  STRUCT_MIRROR_TYPE(raw_array_multi_zero_suppress) < STRUCT_MIRROR_TYPE_TEMPLATE STRUCT_MIRROR_TEMPLATE_ARG(DATA12_RANGE),STRUCT_MIRROR_TEMPLATE_ARG(DATA12_RANGE),8,4> STRUCT_MIRROR_NAME(mDATA12_RANGE_array2_zzpml[2]);
+  STRUCT_MIRROR_FCNS_DECL(XTST_SUBEVENT_MEMBER_DATA12_RANGE);
+};
+#endif//USER_DEF_XTST_SUBEVENT_MEMBER_DATA12_RANGE
+
+#ifndef USER_DEF_XTST_SUBEVENT_MEMBER_DATA16
+STRUCT_MIRROR_TEMPLATE
+class STRUCT_MIRROR_STRUCT(XTST_SUBEVENT_MEMBER_DATA16)
+{
+public:
+  STRUCT_MIRROR_ITEM_CTRL(mDATA16);
+  STRUCT_MIRROR_TYPE(DATA16) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(mDATA16);
+  STRUCT_MIRROR_ITEM_CTRL(mDATA16_array);
+  STRUCT_MIRROR_TYPE(raw_array) < STRUCT_MIRROR_TYPE_TEMPLATE STRUCT_MIRROR_TEMPLATE_ARG(DATA16),STRUCT_MIRROR_TEMPLATE_ARG(DATA16),8> STRUCT_MIRROR_NAME(mDATA16_array);
+  STRUCT_MIRROR_ITEM_CTRL(mDATA16_array_zzp);
+  STRUCT_MIRROR_TYPE(raw_array_zero_suppress) < STRUCT_MIRROR_TYPE_TEMPLATE STRUCT_MIRROR_TEMPLATE_ARG(DATA16),STRUCT_MIRROR_TEMPLATE_ARG(DATA16),8> STRUCT_MIRROR_NAME(mDATA16_array_zzp);
+  STRUCT_MIRROR_ITEM_CTRL(mDATA16_array_zzpii);
+  STRUCT_MIRROR_TYPE(raw_list_zero_suppress) < STRUCT_MIRROR_TYPE_TEMPLATE STRUCT_MIRROR_TEMPLATE_ARG(DATA16),STRUCT_MIRROR_TEMPLATE_ARG(DATA16),8> STRUCT_MIRROR_NAME(mDATA16_array_zzpii);
+  STRUCT_MIRROR_ITEM_CTRL(mDATA16_array_zzpml);
+  STRUCT_MIRROR_TYPE(raw_array_multi_zero_suppress) < STRUCT_MIRROR_TYPE_TEMPLATE STRUCT_MIRROR_TEMPLATE_ARG(DATA16),STRUCT_MIRROR_TEMPLATE_ARG(DATA16),8,4> STRUCT_MIRROR_NAME(mDATA16_array_zzpml);
+  STRUCT_MIRROR_ITEM_CTRL(mDATA16_array2);
+  STRUCT_MIRROR_ITEM_CTRL_ARRAY(mDATA16_array2__i0,,2);
+  STRUCT_MIRROR_TYPE(raw_array) < STRUCT_MIRROR_TYPE_TEMPLATE STRUCT_MIRROR_TEMPLATE_ARG(DATA16),STRUCT_MIRROR_TEMPLATE_ARG(DATA16),8> STRUCT_MIRROR_NAME(mDATA16_array2[2]);
+  STRUCT_MIRROR_ITEM_CTRL(mDATA16_array2_zzp);
+  STRUCT_MIRROR_ITEM_CTRL_ARRAY(mDATA16_array2_zzp__i0,,2);
+  STRUCT_MIRROR_TYPE(raw_array_zero_suppress) < STRUCT_MIRROR_TYPE_TEMPLATE STRUCT_MIRROR_TEMPLATE_ARG(DATA16),STRUCT_MIRROR_TEMPLATE_ARG(DATA16),8> STRUCT_MIRROR_NAME(mDATA16_array2_zzp[2]);
+  STRUCT_MIRROR_ITEM_CTRL(mDATA16_array2_zzpii);
+  STRUCT_MIRROR_ITEM_CTRL_ARRAY(mDATA16_array2_zzpii__i0,,2);
+  STRUCT_MIRROR_TYPE(raw_list_zero_suppress) < STRUCT_MIRROR_TYPE_TEMPLATE STRUCT_MIRROR_TEMPLATE_ARG(DATA16),STRUCT_MIRROR_TEMPLATE_ARG(DATA16),8> STRUCT_MIRROR_NAME(mDATA16_array2_zzpii[2]);
+  STRUCT_MIRROR_ITEM_CTRL(mDATA16_array2_zzpml);
+  STRUCT_MIRROR_ITEM_CTRL_ARRAY(mDATA16_array2_zzpml__i0,,2);
+  STRUCT_MIRROR_TYPE(raw_array_multi_zero_suppress) < STRUCT_MIRROR_TYPE_TEMPLATE STRUCT_MIRROR_TEMPLATE_ARG(DATA16),STRUCT_MIRROR_TEMPLATE_ARG(DATA16),8,4> STRUCT_MIRROR_NAME(mDATA16_array2_zzpml[2]);
+  STRUCT_MIRROR_FCNS_DECL(XTST_SUBEVENT_MEMBER_DATA16);
+};
+#endif//USER_DEF_XTST_SUBEVENT_MEMBER_DATA16
+
+#ifndef USER_DEF_XTST_SUBEVENT_MEMBER_DATA16_OVERFLOW
+STRUCT_MIRROR_TEMPLATE
+class STRUCT_MIRROR_STRUCT(XTST_SUBEVENT_MEMBER_DATA16_OVERFLOW)
+{
+public:
+  STRUCT_MIRROR_ITEM_CTRL(mDATA16_OVERFLOW);
+  STRUCT_MIRROR_TYPE(DATA16_OVERFLOW) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(mDATA16_OVERFLOW);
+  STRUCT_MIRROR_ITEM_CTRL(mDATA16_OVERFLOW_array);
+  STRUCT_MIRROR_TYPE(raw_array) < STRUCT_MIRROR_TYPE_TEMPLATE STRUCT_MIRROR_TEMPLATE_ARG(DATA16_OVERFLOW),STRUCT_MIRROR_TEMPLATE_ARG(DATA16_OVERFLOW),8> STRUCT_MIRROR_NAME(mDATA16_OVERFLOW_array);
+  STRUCT_MIRROR_ITEM_CTRL(mDATA16_OVERFLOW_array_zzp);
+  STRUCT_MIRROR_TYPE(raw_array_zero_suppress) < STRUCT_MIRROR_TYPE_TEMPLATE STRUCT_MIRROR_TEMPLATE_ARG(DATA16_OVERFLOW),STRUCT_MIRROR_TEMPLATE_ARG(DATA16_OVERFLOW),8> STRUCT_MIRROR_NAME(mDATA16_OVERFLOW_array_zzp);
+  STRUCT_MIRROR_ITEM_CTRL(mDATA16_OVERFLOW_array_zzpii);
+  STRUCT_MIRROR_TYPE(raw_list_zero_suppress) < STRUCT_MIRROR_TYPE_TEMPLATE STRUCT_MIRROR_TEMPLATE_ARG(DATA16_OVERFLOW),STRUCT_MIRROR_TEMPLATE_ARG(DATA16_OVERFLOW),8> STRUCT_MIRROR_NAME(mDATA16_OVERFLOW_array_zzpii);
+  STRUCT_MIRROR_ITEM_CTRL(mDATA16_OVERFLOW_array_zzpml);
+  STRUCT_MIRROR_TYPE(raw_array_multi_zero_suppress) < STRUCT_MIRROR_TYPE_TEMPLATE STRUCT_MIRROR_TEMPLATE_ARG(DATA16_OVERFLOW),STRUCT_MIRROR_TEMPLATE_ARG(DATA16_OVERFLOW),8,4> STRUCT_MIRROR_NAME(mDATA16_OVERFLOW_array_zzpml);
+  STRUCT_MIRROR_ITEM_CTRL(mDATA16_OVERFLOW_array2);
+  STRUCT_MIRROR_ITEM_CTRL_ARRAY(mDATA16_OVERFLOW_array2__i0,,2);
+  STRUCT_MIRROR_TYPE(raw_array) < STRUCT_MIRROR_TYPE_TEMPLATE STRUCT_MIRROR_TEMPLATE_ARG(DATA16_OVERFLOW),STRUCT_MIRROR_TEMPLATE_ARG(DATA16_OVERFLOW),8> STRUCT_MIRROR_NAME(mDATA16_OVERFLOW_array2[2]);
+  STRUCT_MIRROR_ITEM_CTRL(mDATA16_OVERFLOW_array2_zzp);
+  STRUCT_MIRROR_ITEM_CTRL_ARRAY(mDATA16_OVERFLOW_array2_zzp__i0,,2);
+  STRUCT_MIRROR_TYPE(raw_array_zero_suppress) < STRUCT_MIRROR_TYPE_TEMPLATE STRUCT_MIRROR_TEMPLATE_ARG(DATA16_OVERFLOW),STRUCT_MIRROR_TEMPLATE_ARG(DATA16_OVERFLOW),8> STRUCT_MIRROR_NAME(mDATA16_OVERFLOW_array2_zzp[2]);
+  STRUCT_MIRROR_ITEM_CTRL(mDATA16_OVERFLOW_array2_zzpii);
+  STRUCT_MIRROR_ITEM_CTRL_ARRAY(mDATA16_OVERFLOW_array2_zzpii__i0,,2);
+  STRUCT_MIRROR_TYPE(raw_list_zero_suppress) < STRUCT_MIRROR_TYPE_TEMPLATE STRUCT_MIRROR_TEMPLATE_ARG(DATA16_OVERFLOW),STRUCT_MIRROR_TEMPLATE_ARG(DATA16_OVERFLOW),8> STRUCT_MIRROR_NAME(mDATA16_OVERFLOW_array2_zzpii[2]);
+  STRUCT_MIRROR_ITEM_CTRL(mDATA16_OVERFLOW_array2_zzpml);
+  STRUCT_MIRROR_ITEM_CTRL_ARRAY(mDATA16_OVERFLOW_array2_zzpml__i0,,2);
+  STRUCT_MIRROR_TYPE(raw_array_multi_zero_suppress) < STRUCT_MIRROR_TYPE_TEMPLATE STRUCT_MIRROR_TEMPLATE_ARG(DATA16_OVERFLOW),STRUCT_MIRROR_TEMPLATE_ARG(DATA16_OVERFLOW),8,4> STRUCT_MIRROR_NAME(mDATA16_OVERFLOW_array2_zzpml[2]);
+  STRUCT_MIRROR_FCNS_DECL(XTST_SUBEVENT_MEMBER_DATA16_OVERFLOW);
+};
+#endif//USER_DEF_XTST_SUBEVENT_MEMBER_DATA16_OVERFLOW
+
+#ifndef USER_DEF_XTST_SUBEVENT_MEMBER_DATA24
+STRUCT_MIRROR_TEMPLATE
+class STRUCT_MIRROR_STRUCT(XTST_SUBEVENT_MEMBER_DATA24)
+{
+public:
+  STRUCT_MIRROR_ITEM_CTRL(mDATA24);
+  STRUCT_MIRROR_TYPE(DATA24) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(mDATA24);
+  STRUCT_MIRROR_ITEM_CTRL(mDATA24_array);
+  STRUCT_MIRROR_TYPE(raw_array) < STRUCT_MIRROR_TYPE_TEMPLATE STRUCT_MIRROR_TEMPLATE_ARG(DATA24),STRUCT_MIRROR_TEMPLATE_ARG(DATA24),8> STRUCT_MIRROR_NAME(mDATA24_array);
+  STRUCT_MIRROR_ITEM_CTRL(mDATA24_array_zzp);
+  STRUCT_MIRROR_TYPE(raw_array_zero_suppress) < STRUCT_MIRROR_TYPE_TEMPLATE STRUCT_MIRROR_TEMPLATE_ARG(DATA24),STRUCT_MIRROR_TEMPLATE_ARG(DATA24),8> STRUCT_MIRROR_NAME(mDATA24_array_zzp);
+  STRUCT_MIRROR_ITEM_CTRL(mDATA24_array_zzpii);
+  STRUCT_MIRROR_TYPE(raw_list_zero_suppress) < STRUCT_MIRROR_TYPE_TEMPLATE STRUCT_MIRROR_TEMPLATE_ARG(DATA24),STRUCT_MIRROR_TEMPLATE_ARG(DATA24),8> STRUCT_MIRROR_NAME(mDATA24_array_zzpii);
+  STRUCT_MIRROR_ITEM_CTRL(mDATA24_array_zzpml);
+  STRUCT_MIRROR_TYPE(raw_array_multi_zero_suppress) < STRUCT_MIRROR_TYPE_TEMPLATE STRUCT_MIRROR_TEMPLATE_ARG(DATA24),STRUCT_MIRROR_TEMPLATE_ARG(DATA24),8,4> STRUCT_MIRROR_NAME(mDATA24_array_zzpml);
+  STRUCT_MIRROR_ITEM_CTRL(mDATA24_array2);
+  STRUCT_MIRROR_ITEM_CTRL_ARRAY(mDATA24_array2__i0,,2);
+  STRUCT_MIRROR_TYPE(raw_array) < STRUCT_MIRROR_TYPE_TEMPLATE STRUCT_MIRROR_TEMPLATE_ARG(DATA24),STRUCT_MIRROR_TEMPLATE_ARG(DATA24),8> STRUCT_MIRROR_NAME(mDATA24_array2[2]);
+  STRUCT_MIRROR_ITEM_CTRL(mDATA24_array2_zzp);
+  STRUCT_MIRROR_ITEM_CTRL_ARRAY(mDATA24_array2_zzp__i0,,2);
+  STRUCT_MIRROR_TYPE(raw_array_zero_suppress) < STRUCT_MIRROR_TYPE_TEMPLATE STRUCT_MIRROR_TEMPLATE_ARG(DATA24),STRUCT_MIRROR_TEMPLATE_ARG(DATA24),8> STRUCT_MIRROR_NAME(mDATA24_array2_zzp[2]);
+  STRUCT_MIRROR_ITEM_CTRL(mDATA24_array2_zzpii);
+  STRUCT_MIRROR_ITEM_CTRL_ARRAY(mDATA24_array2_zzpii__i0,,2);
+  STRUCT_MIRROR_TYPE(raw_list_zero_suppress) < STRUCT_MIRROR_TYPE_TEMPLATE STRUCT_MIRROR_TEMPLATE_ARG(DATA24),STRUCT_MIRROR_TEMPLATE_ARG(DATA24),8> STRUCT_MIRROR_NAME(mDATA24_array2_zzpii[2]);
+  STRUCT_MIRROR_ITEM_CTRL(mDATA24_array2_zzpml);
+  STRUCT_MIRROR_ITEM_CTRL_ARRAY(mDATA24_array2_zzpml__i0,,2);
+  STRUCT_MIRROR_TYPE(raw_array_multi_zero_suppress) < STRUCT_MIRROR_TYPE_TEMPLATE STRUCT_MIRROR_TEMPLATE_ARG(DATA24),STRUCT_MIRROR_TEMPLATE_ARG(DATA24),8,4> STRUCT_MIRROR_NAME(mDATA24_array2_zzpml[2]);
+  STRUCT_MIRROR_FCNS_DECL(XTST_SUBEVENT_MEMBER_DATA24);
+};
+#endif//USER_DEF_XTST_SUBEVENT_MEMBER_DATA24
+
+#ifndef USER_DEF_XTST_SUBEVENT_MEMBER_DATA32
+STRUCT_MIRROR_TEMPLATE
+class STRUCT_MIRROR_STRUCT(XTST_SUBEVENT_MEMBER_DATA32)
+{
+public:
+  STRUCT_MIRROR_ITEM_CTRL(mDATA32);
+  STRUCT_MIRROR_TYPE(DATA32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(mDATA32);
+  STRUCT_MIRROR_ITEM_CTRL(mDATA32_array);
+  STRUCT_MIRROR_TYPE(raw_array) < STRUCT_MIRROR_TYPE_TEMPLATE STRUCT_MIRROR_TEMPLATE_ARG(DATA32),STRUCT_MIRROR_TEMPLATE_ARG(DATA32),8> STRUCT_MIRROR_NAME(mDATA32_array);
+  STRUCT_MIRROR_ITEM_CTRL(mDATA32_array_zzp);
+  STRUCT_MIRROR_TYPE(raw_array_zero_suppress) < STRUCT_MIRROR_TYPE_TEMPLATE STRUCT_MIRROR_TEMPLATE_ARG(DATA32),STRUCT_MIRROR_TEMPLATE_ARG(DATA32),8> STRUCT_MIRROR_NAME(mDATA32_array_zzp);
+  STRUCT_MIRROR_ITEM_CTRL(mDATA32_array_zzpii);
+  STRUCT_MIRROR_TYPE(raw_list_zero_suppress) < STRUCT_MIRROR_TYPE_TEMPLATE STRUCT_MIRROR_TEMPLATE_ARG(DATA32),STRUCT_MIRROR_TEMPLATE_ARG(DATA32),8> STRUCT_MIRROR_NAME(mDATA32_array_zzpii);
+  STRUCT_MIRROR_ITEM_CTRL(mDATA32_array_zzpml);
+  STRUCT_MIRROR_TYPE(raw_array_multi_zero_suppress) < STRUCT_MIRROR_TYPE_TEMPLATE STRUCT_MIRROR_TEMPLATE_ARG(DATA32),STRUCT_MIRROR_TEMPLATE_ARG(DATA32),8,4> STRUCT_MIRROR_NAME(mDATA32_array_zzpml);
+  STRUCT_MIRROR_ITEM_CTRL(mDATA32_array2);
+  STRUCT_MIRROR_ITEM_CTRL_ARRAY(mDATA32_array2__i0,,2);
+  STRUCT_MIRROR_TYPE(raw_array) < STRUCT_MIRROR_TYPE_TEMPLATE STRUCT_MIRROR_TEMPLATE_ARG(DATA32),STRUCT_MIRROR_TEMPLATE_ARG(DATA32),8> STRUCT_MIRROR_NAME(mDATA32_array2[2]);
+  STRUCT_MIRROR_ITEM_CTRL(mDATA32_array2_zzp);
+  STRUCT_MIRROR_ITEM_CTRL_ARRAY(mDATA32_array2_zzp__i0,,2);
+  STRUCT_MIRROR_TYPE(raw_array_zero_suppress) < STRUCT_MIRROR_TYPE_TEMPLATE STRUCT_MIRROR_TEMPLATE_ARG(DATA32),STRUCT_MIRROR_TEMPLATE_ARG(DATA32),8> STRUCT_MIRROR_NAME(mDATA32_array2_zzp[2]);
+  STRUCT_MIRROR_ITEM_CTRL(mDATA32_array2_zzpii);
+  STRUCT_MIRROR_ITEM_CTRL_ARRAY(mDATA32_array2_zzpii__i0,,2);
+  STRUCT_MIRROR_TYPE(raw_list_zero_suppress) < STRUCT_MIRROR_TYPE_TEMPLATE STRUCT_MIRROR_TEMPLATE_ARG(DATA32),STRUCT_MIRROR_TEMPLATE_ARG(DATA32),8> STRUCT_MIRROR_NAME(mDATA32_array2_zzpii[2]);
+  STRUCT_MIRROR_ITEM_CTRL(mDATA32_array2_zzpml);
+  STRUCT_MIRROR_ITEM_CTRL_ARRAY(mDATA32_array2_zzpml__i0,,2);
+  STRUCT_MIRROR_TYPE(raw_array_multi_zero_suppress) < STRUCT_MIRROR_TYPE_TEMPLATE STRUCT_MIRROR_TEMPLATE_ARG(DATA32),STRUCT_MIRROR_TEMPLATE_ARG(DATA32),8,4> STRUCT_MIRROR_NAME(mDATA32_array2_zzpml[2]);
+  STRUCT_MIRROR_FCNS_DECL(XTST_SUBEVENT_MEMBER_DATA32);
+};
+#endif//USER_DEF_XTST_SUBEVENT_MEMBER_DATA32
+
+#ifndef USER_DEF_XTST_SUBEVENT_MEMBER_DATA32_B
+STRUCT_MIRROR_TEMPLATE
+class STRUCT_MIRROR_STRUCT(XTST_SUBEVENT_MEMBER_DATA32_B)
+{
+public:
+  STRUCT_MIRROR_ITEM_CTRL(mDATA32_array_zzpml);
+  STRUCT_MIRROR_TYPE(raw_array_multi_zero_suppress) < STRUCT_MIRROR_TYPE_TEMPLATE STRUCT_MIRROR_TEMPLATE_ARG(DATA32),STRUCT_MIRROR_TEMPLATE_ARG(DATA32),8,4> STRUCT_MIRROR_NAME(mDATA32_array_zzpml);
+  STRUCT_MIRROR_FCNS_DECL(XTST_SUBEVENT_MEMBER_DATA32_B);
+};
+#endif//USER_DEF_XTST_SUBEVENT_MEMBER_DATA32_B
+
+#ifndef USER_DEF_XTST_SUBEVENT_MEMBER_DATA8
+STRUCT_MIRROR_TEMPLATE
+class STRUCT_MIRROR_STRUCT(XTST_SUBEVENT_MEMBER_DATA8)
+{
+public:
+  STRUCT_MIRROR_ITEM_CTRL(mDATA8);
+  STRUCT_MIRROR_TYPE(DATA8) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(mDATA8);
+  STRUCT_MIRROR_ITEM_CTRL(mDATA8_array);
+  STRUCT_MIRROR_TYPE(raw_array) < STRUCT_MIRROR_TYPE_TEMPLATE STRUCT_MIRROR_TEMPLATE_ARG(DATA8),STRUCT_MIRROR_TEMPLATE_ARG(DATA8),8> STRUCT_MIRROR_NAME(mDATA8_array);
+  STRUCT_MIRROR_ITEM_CTRL(mDATA8_array_zzp);
+  STRUCT_MIRROR_TYPE(raw_array_zero_suppress) < STRUCT_MIRROR_TYPE_TEMPLATE STRUCT_MIRROR_TEMPLATE_ARG(DATA8),STRUCT_MIRROR_TEMPLATE_ARG(DATA8),8> STRUCT_MIRROR_NAME(mDATA8_array_zzp);
+  STRUCT_MIRROR_ITEM_CTRL(mDATA8_array_zzpii);
+  STRUCT_MIRROR_TYPE(raw_list_zero_suppress) < STRUCT_MIRROR_TYPE_TEMPLATE STRUCT_MIRROR_TEMPLATE_ARG(DATA8),STRUCT_MIRROR_TEMPLATE_ARG(DATA8),8> STRUCT_MIRROR_NAME(mDATA8_array_zzpii);
+  STRUCT_MIRROR_ITEM_CTRL(mDATA8_array_zzpml);
+  STRUCT_MIRROR_TYPE(raw_array_multi_zero_suppress) < STRUCT_MIRROR_TYPE_TEMPLATE STRUCT_MIRROR_TEMPLATE_ARG(DATA8),STRUCT_MIRROR_TEMPLATE_ARG(DATA8),8,4> STRUCT_MIRROR_NAME(mDATA8_array_zzpml);
+  STRUCT_MIRROR_ITEM_CTRL(mDATA8_array2);
+  STRUCT_MIRROR_ITEM_CTRL_ARRAY(mDATA8_array2__i0,,2);
+  STRUCT_MIRROR_TYPE(raw_array) < STRUCT_MIRROR_TYPE_TEMPLATE STRUCT_MIRROR_TEMPLATE_ARG(DATA8),STRUCT_MIRROR_TEMPLATE_ARG(DATA8),8> STRUCT_MIRROR_NAME(mDATA8_array2[2]);
+  STRUCT_MIRROR_ITEM_CTRL(mDATA8_array2_zzp);
+  STRUCT_MIRROR_ITEM_CTRL_ARRAY(mDATA8_array2_zzp__i0,,2);
+  STRUCT_MIRROR_TYPE(raw_array_zero_suppress) < STRUCT_MIRROR_TYPE_TEMPLATE STRUCT_MIRROR_TEMPLATE_ARG(DATA8),STRUCT_MIRROR_TEMPLATE_ARG(DATA8),8> STRUCT_MIRROR_NAME(mDATA8_array2_zzp[2]);
+  STRUCT_MIRROR_ITEM_CTRL(mDATA8_array2_zzpii);
+  STRUCT_MIRROR_ITEM_CTRL_ARRAY(mDATA8_array2_zzpii__i0,,2);
+  STRUCT_MIRROR_TYPE(raw_list_zero_suppress) < STRUCT_MIRROR_TYPE_TEMPLATE STRUCT_MIRROR_TEMPLATE_ARG(DATA8),STRUCT_MIRROR_TEMPLATE_ARG(DATA8),8> STRUCT_MIRROR_NAME(mDATA8_array2_zzpii[2]);
+  STRUCT_MIRROR_ITEM_CTRL(mDATA8_array2_zzpml);
+  STRUCT_MIRROR_ITEM_CTRL_ARRAY(mDATA8_array2_zzpml__i0,,2);
+  STRUCT_MIRROR_TYPE(raw_array_multi_zero_suppress) < STRUCT_MIRROR_TYPE_TEMPLATE STRUCT_MIRROR_TEMPLATE_ARG(DATA8),STRUCT_MIRROR_TEMPLATE_ARG(DATA8),8,4> STRUCT_MIRROR_NAME(mDATA8_array2_zzpml[2]);
+  STRUCT_MIRROR_FCNS_DECL(XTST_SUBEVENT_MEMBER_DATA8);
+};
+#endif//USER_DEF_XTST_SUBEVENT_MEMBER_DATA8
+
+#ifndef USER_DEF_XTST_SUBEVENT_MEMBER_uint16
+STRUCT_MIRROR_TEMPLATE
+class STRUCT_MIRROR_STRUCT(XTST_SUBEVENT_MEMBER_uint16)
+{
+public:
+  STRUCT_MIRROR_ITEM_CTRL(muint16);
+  STRUCT_MIRROR_TYPE(uint16) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(muint16);
+  STRUCT_MIRROR_FCNS_DECL(XTST_SUBEVENT_MEMBER_uint16);
+};
+#endif//USER_DEF_XTST_SUBEVENT_MEMBER_uint16
+
+#ifndef USER_DEF_XTST_SUBEVENT_MEMBER_uint32
+STRUCT_MIRROR_TEMPLATE
+class STRUCT_MIRROR_STRUCT(XTST_SUBEVENT_MEMBER_uint32)
+{
+public:
+  STRUCT_MIRROR_ITEM_CTRL(muint32);
+  STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(muint32);
+  STRUCT_MIRROR_FCNS_DECL(XTST_SUBEVENT_MEMBER_uint32);
+};
+#endif//USER_DEF_XTST_SUBEVENT_MEMBER_uint32
+
+#ifndef USER_DEF_XTST_SUBEVENT_MEMBER_uint8
+STRUCT_MIRROR_TEMPLATE
+class STRUCT_MIRROR_STRUCT(XTST_SUBEVENT_MEMBER_uint8)
+{
+public:
+  STRUCT_MIRROR_ITEM_CTRL(muint8);
+  STRUCT_MIRROR_TYPE(uint8) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(muint8);
+  STRUCT_MIRROR_FCNS_DECL(XTST_SUBEVENT_MEMBER_uint8);
+};
+#endif//USER_DEF_XTST_SUBEVENT_MEMBER_uint8
+
+#ifndef USER_DEF_BITS64
+STRUCT_MIRROR_TEMPLATE
+class STRUCT_MIRROR_STRUCT(BITS64) : public STRUCT_MIRROR_BASE(unpack_subevent_base)
+{
+public:
+  STRUCT_MIRROR_ITEM_CTRL_BASE(unpack_subevent_base);
+  STRUCT_MIRROR_ITEM_CTRL(member64);
+  STRUCT_MIRROR_TYPE(DATA64) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(member64);
+  STRUCT_MIRROR_ITEM_CTRL(array64);
+  STRUCT_MIRROR_TYPE(raw_array) < STRUCT_MIRROR_TYPE_TEMPLATE STRUCT_MIRROR_TEMPLATE_ARG(DATA64),STRUCT_MIRROR_TEMPLATE_ARG(DATA64),7> STRUCT_MIRROR_NAME(array64);
+  STRUCT_MIRROR_ITEM_CTRL(member32);
+  STRUCT_MIRROR_TYPE(DATA32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(member32);
+  STRUCT_MIRROR_ITEM_CTRL(data32_1);
+  STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(data32_1);
+  STRUCT_MIRROR_ITEM_CTRL(data32_2);
+  STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(data32_2);
+  STRUCT_MIRROR_ITEM_CTRL(data64_1);
+  STRUCT_MIRROR_TYPE(uint64) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(data64_1);
+  STRUCT_MIRROR_ITEM_CTRL(i);
+  STRUCT_MIRROR_ITEM_CTRL_ARRAY(i__i0,,3);
+  STRUCT_MIRROR_TYPE(ITEM64) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(i[3]);
+  STRUCT_MIRROR_FCNS_DECL(BITS64);
+};
+#endif//USER_DEF_BITS64
+
+#ifndef USER_DEF_XTST_MDPP16
+STRUCT_MIRROR_TEMPLATE
+class STRUCT_MIRROR_STRUCT(XTST_MDPP16) : public STRUCT_MIRROR_BASE(unpack_subevent_base)
+{
+public:
+  STRUCT_MIRROR_ITEM_CTRL_BASE(unpack_subevent_base);
+#if STRUCT_ONLY_LAST_UNION_MEMBER
+  struct 
+#else
+  union 
+#endif
+
+  {
+  public:
+#if !STRUCT_ONLY_LAST_UNION_MEMBER
+    struct 
+    {
+    public:
+      STRUCT_MIRROR_ITEM_CTRL(unaligned);
+      STRUCT_MIRROR_TYPE(uint16) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(unaligned);
+    };
+#endif// !STRUCT_ONLY_LAST_UNION_MEMBER
+    STRUCT_MIRROR_ITEM_CTRL(u16);
+    STRUCT_MIRROR_TYPE(uint16) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(u16);
+  } STRUCT_MIRROR_NAME(align);
+  STRUCT_MIRROR_ITEM_CTRL(pad);
+  STRUCT_MIRROR_TYPE(uint16) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(pad);
+  STRUCT_MIRROR_ITEM_CTRL(mdpp16);
+  STRUCT_MIRROR_ITEM_CTRL_ARRAY(mdpp16__i0,,2);
+  STRUCT_MIRROR_TYPE(VME_MESYTEC_MDPP16) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(mdpp16[2]);
+  STRUCT_MIRROR_FCNS_DECL(XTST_MDPP16);
+};
+#endif//USER_DEF_XTST_MDPP16
+
+#ifndef USER_DEF_XTST_PLAIN
+STRUCT_MIRROR_TEMPLATE
+class STRUCT_MIRROR_STRUCT(XTST_PLAIN) : public STRUCT_MIRROR_BASE(unpack_subevent_base)
+{
+public:
+  STRUCT_MIRROR_ITEM_CTRL_BASE(unpack_subevent_base);
+  STRUCT_MIRROR_ITEM_CTRL(u);
+  STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(u);
+  STRUCT_MIRROR_ITEM_CTRL(s);
+  STRUCT_MIRROR_TYPE(uint16) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(s);
+  STRUCT_MIRROR_ITEM_CTRL(c);
+  STRUCT_MIRROR_TYPE(uint8) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(c);
+  STRUCT_MIRROR_FCNS_DECL(XTST_PLAIN);
+};
+#endif//USER_DEF_XTST_PLAIN
+
+#ifndef USER_DEF_XTST_REGRESS
+STRUCT_MIRROR_TEMPLATE
+class STRUCT_MIRROR_STRUCT(XTST_REGRESS) : public STRUCT_MIRROR_BASE(unpack_subevent_base)
+{
+public:
+  STRUCT_MIRROR_ITEM_CTRL_BASE(unpack_subevent_base);
+  STRUCT_MIRROR_ITEM_CTRL(wr);
+  STRUCT_MIRROR_ITEM_CTRL_ARRAY(wr__i0,,6);
+  STRUCT_MIRROR_TYPE(WR_STAMP) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(wr[6]);
+  STRUCT_MIRROR_ITEM_CTRL(seed);
+  STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(seed);
+  STRUCT_MIRROR_ITEM_CTRL(v775mod);
+  STRUCT_MIRROR_ITEM_CTRL_ARRAY(v775mod__i0,,2);
+  STRUCT_MIRROR_TYPE(VME_CAEN_V775) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(v775mod[2]);
+  STRUCT_MIRROR_ITEM_CTRL(v1290mod);
+  STRUCT_MIRROR_ITEM_CTRL_ARRAY(v1290mod__i0,,2);
+  STRUCT_MIRROR_TYPE(VME_CAEN_V1290_SHORT) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(v1290mod[2]);
+  STRUCT_MIRROR_ITEM_CTRL(sticky_active);
+  STRUCT_MIRROR_TYPE(STICKY_ACTIVE) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(sticky_active);
+  STRUCT_MIRROR_FCNS_DECL(XTST_REGRESS);
+};
+#endif//USER_DEF_XTST_REGRESS
+
+#ifndef USER_DEF_XTST_REGRESSEXTRA
+STRUCT_MIRROR_TEMPLATE
+class STRUCT_MIRROR_STRUCT(XTST_REGRESSEXTRA) : public STRUCT_MIRROR_BASE(unpack_subevent_base)
+{
+public:
+  STRUCT_MIRROR_ITEM_CTRL_BASE(unpack_subevent_base);
+  STRUCT_MIRROR_ITEM_CTRL(junk);
+  STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(junk);
+  STRUCT_MIRROR_FCNS_DECL(XTST_REGRESSEXTRA);
+};
+#endif//USER_DEF_XTST_REGRESSEXTRA
+
+#ifndef USER_DEF_XTST_STICKY_CORR
+STRUCT_MIRROR_TEMPLATE
+class STRUCT_MIRROR_STRUCT(XTST_STICKY_CORR) : public STRUCT_MIRROR_BASE(unpack_sticky_subevent_base)
+{
+public:
+  STRUCT_MIRROR_ITEM_CTRL_BASE(unpack_sticky_subevent_base);
+  STRUCT_MIRROR_ITEM_CTRL(base);
+  STRUCT_MIRROR_TYPE(uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(base);
+  STRUCT_MIRROR_FCNS_DECL(XTST_STICKY_CORR);
+};
+#endif//USER_DEF_XTST_STICKY_CORR
+
+#ifndef USER_DEF_XTST_SUBEVENT_ME2
+STRUCT_MIRROR_TEMPLATE
+class STRUCT_MIRROR_STRUCT(XTST_SUBEVENT_ME2) : public STRUCT_MIRROR_BASE(unpack_subevent_base)
+{
+public:
+  STRUCT_MIRROR_ITEM_CTRL_BASE(unpack_subevent_base);
+  STRUCT_MIRROR_ITEM_CTRL(i);
+  STRUCT_MIRROR_ITEM_CTRL_ARRAY(i__i0,,3);
+  STRUCT_MIRROR_TYPE(ITEM_ME2) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(i[3]);
+  STRUCT_MIRROR_FCNS_DECL(XTST_SUBEVENT_ME2);
+};
+#endif//USER_DEF_XTST_SUBEVENT_ME2
+
+#ifndef USER_DEF_XTST_SUBEVENT_MEMBER_ENCODE
+STRUCT_MIRROR_TEMPLATE
+class STRUCT_MIRROR_STRUCT(XTST_SUBEVENT_MEMBER_ENCODE) : public STRUCT_MIRROR_BASE(unpack_subevent_base)
+{
+public:
+  STRUCT_MIRROR_ITEM_CTRL_BASE(unpack_subevent_base);
+  STRUCT_MIRROR_ITEM_CTRL(member_DATA32);
+  STRUCT_MIRROR_TYPE(XTST_SUBEVENT_MEMBER_DATA32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(member_DATA32);
+  STRUCT_MIRROR_ITEM_CTRL(member_DATA24);
+  STRUCT_MIRROR_TYPE(XTST_SUBEVENT_MEMBER_DATA24) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(member_DATA24);
+  STRUCT_MIRROR_ITEM_CTRL(member_DATA16);
+  STRUCT_MIRROR_TYPE(XTST_SUBEVENT_MEMBER_DATA16) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(member_DATA16);
+  STRUCT_MIRROR_ITEM_CTRL(member_DATA16_OVERFLOW);
+  STRUCT_MIRROR_TYPE(XTST_SUBEVENT_MEMBER_DATA16_OVERFLOW) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(member_DATA16_OVERFLOW);
+  STRUCT_MIRROR_ITEM_CTRL(member_DATA12);
+  STRUCT_MIRROR_TYPE(XTST_SUBEVENT_MEMBER_DATA12) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(member_DATA12);
+  STRUCT_MIRROR_ITEM_CTRL(member_DATA12_OVERFLOW);
+  STRUCT_MIRROR_TYPE(XTST_SUBEVENT_MEMBER_DATA12_OVERFLOW) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(member_DATA12_OVERFLOW);
+  STRUCT_MIRROR_ITEM_CTRL(member_DATA12_RANGE);
+  STRUCT_MIRROR_TYPE(XTST_SUBEVENT_MEMBER_DATA12_RANGE) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(member_DATA12_RANGE);
+  STRUCT_MIRROR_ITEM_CTRL(member_uint32);
+  STRUCT_MIRROR_TYPE(XTST_SUBEVENT_MEMBER_uint32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(member_uint32);
+  STRUCT_MIRROR_ITEM_CTRL(member_uint16);
+  STRUCT_MIRROR_TYPE(XTST_SUBEVENT_MEMBER_uint16) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(member_uint16);
+  STRUCT_MIRROR_ITEM_CTRL(member_uint8);
+  STRUCT_MIRROR_TYPE(XTST_SUBEVENT_MEMBER_uint8) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(member_uint8);
+  STRUCT_MIRROR_FCNS_DECL(XTST_SUBEVENT_MEMBER_ENCODE);
+};
+#endif//USER_DEF_XTST_SUBEVENT_MEMBER_ENCODE
+
+#ifndef USER_DEF_XTST_SUBEVENT_MEMBER_ENCODE_A
+STRUCT_MIRROR_TEMPLATE
+class STRUCT_MIRROR_STRUCT(XTST_SUBEVENT_MEMBER_ENCODE_A) : public STRUCT_MIRROR_BASE(unpack_subevent_base)
+{
+public:
+  STRUCT_MIRROR_ITEM_CTRL_BASE(unpack_subevent_base);
+  STRUCT_MIRROR_ITEM_CTRL(d32);
+  STRUCT_MIRROR_TYPE(XTST_SUBEVENT_MEMBER_DATA32) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(d32);
+  STRUCT_MIRROR_FCNS_DECL(XTST_SUBEVENT_MEMBER_ENCODE_A);
+};
+#endif//USER_DEF_XTST_SUBEVENT_MEMBER_ENCODE_A
+
+#ifndef USER_DEF_XTST_SUBEVENT_MEMBER_ENCODE_B
+STRUCT_MIRROR_TEMPLATE
+class STRUCT_MIRROR_STRUCT(XTST_SUBEVENT_MEMBER_ENCODE_B) : public STRUCT_MIRROR_BASE(unpack_subevent_base)
+{
+public:
+  STRUCT_MIRROR_ITEM_CTRL_BASE(unpack_subevent_base);
+  STRUCT_MIRROR_ITEM_CTRL(d32);
+  STRUCT_MIRROR_TYPE(XTST_SUBEVENT_MEMBER_DATA32_B) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(d32);
+  STRUCT_MIRROR_FCNS_DECL(XTST_SUBEVENT_MEMBER_ENCODE_B);
+};
+#endif//USER_DEF_XTST_SUBEVENT_MEMBER_ENCODE_B
+
+#ifndef USER_DEF_XTST_VME
+STRUCT_MIRROR_TEMPLATE
+class STRUCT_MIRROR_STRUCT(XTST_VME) : public STRUCT_MIRROR_BASE(unpack_subevent_base)
+{
+public:
+  STRUCT_MIRROR_ITEM_CTRL_BASE(unpack_subevent_base);
+  STRUCT_MIRROR_ITEM_CTRL(tdc0);
+  STRUCT_MIRROR_TYPE(VME_CAEN_V775) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(tdc0);
+  STRUCT_MIRROR_ITEM_CTRL(tdc1);
+  STRUCT_MIRROR_TYPE(VME_CAEN_V775) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(tdc1);
+  STRUCT_MIRROR_ITEM_CTRL(tdc2);
+  STRUCT_MIRROR_TYPE(VME_CAEN_V775) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(tdc2);
+  STRUCT_MIRROR_ITEM_CTRL(qdc0);
+  STRUCT_MIRROR_TYPE(VME_CAEN_V775) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(qdc0);
+  STRUCT_MIRROR_ITEM_CTRL(qdc1);
+  STRUCT_MIRROR_TYPE(VME_CAEN_V775) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(qdc1);
+  STRUCT_MIRROR_ITEM_CTRL(mdpp16);
+  STRUCT_MIRROR_TYPE(VME_MESYTEC_MDPP16) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(mdpp16);
+  STRUCT_MIRROR_ITEM_CTRL(header);
+  STRUCT_MIRROR_TYPE(XTST_STD_VME) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(header);
+  STRUCT_MIRROR_ITEM_CTRL(sdm);
+  STRUCT_MIRROR_TYPE(SINGLE_DATA_MODULE) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(sdm);
+  STRUCT_MIRROR_FCNS_DECL(XTST_VME);
+};
+#endif//USER_DEF_XTST_VME
+
+#ifndef USER_DEF_unpack_event
+STRUCT_MIRROR_TEMPLATE
+class STRUCT_MIRROR_STRUCT(unpack_event) : public STRUCT_MIRROR_BASE(unpack_event_base)
+{
+public:
+  STRUCT_MIRROR_ITEM_CTRL_BASE(unpack_event_base);
+  STRUCT_MIRROR_ITEM_CTRL(vme);
+  STRUCT_MIRROR_TYPE(XTST_VME) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(vme);
+  STRUCT_MIRROR_ITEM_CTRL(bits64);
+  STRUCT_MIRROR_TYPE(BITS64) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(bits64);
+  STRUCT_MIRROR_ITEM_CTRL(me);
+  STRUCT_MIRROR_TYPE(XTST_SUBEVENT_MEMBER_ENCODE) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(me);
+  STRUCT_MIRROR_ITEM_CTRL(mea);
+  STRUCT_MIRROR_TYPE(XTST_SUBEVENT_MEMBER_ENCODE_A) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(mea);
+  STRUCT_MIRROR_ITEM_CTRL(meb);
+  STRUCT_MIRROR_TYPE(XTST_SUBEVENT_MEMBER_ENCODE_B) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(meb);
+  STRUCT_MIRROR_ITEM_CTRL(me2);
+  STRUCT_MIRROR_TYPE(XTST_SUBEVENT_ME2) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(me2);
+  STRUCT_MIRROR_ITEM_CTRL(plain);
+  STRUCT_MIRROR_TYPE(XTST_PLAIN) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(plain);
+  STRUCT_MIRROR_ITEM_CTRL(regress);
+  STRUCT_MIRROR_ITEM_CTRL_ARRAY(regress__i0,,16);
+  STRUCT_MIRROR_TYPE(XTST_REGRESS) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(regress[16]);
+  STRUCT_MIRROR_ITEM_CTRL(regressextra);
+  STRUCT_MIRROR_TYPE(XTST_REGRESSEXTRA) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(regressextra);
+  STRUCT_MIRROR_ITEM_CTRL(mdpp);
+  STRUCT_MIRROR_TYPE(XTST_MDPP16) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(mdpp);
+  STRUCT_MIRROR_FCNS_DECL(unpack_event);
+};
+#endif//USER_DEF_unpack_event
+
+#ifndef USER_DEF_unpack_sticky_event
+STRUCT_MIRROR_TEMPLATE
+class STRUCT_MIRROR_STRUCT(unpack_sticky_event) : public STRUCT_MIRROR_BASE(unpack_sticky_event_base)
+{
+public:
+  STRUCT_MIRROR_ITEM_CTRL_BASE(unpack_sticky_event_base);
+  STRUCT_MIRROR_ITEM_CTRL(corr);
+  STRUCT_MIRROR_TYPE(XTST_STICKY_CORR) STRUCT_MIRROR_TYPE_TEMPLATE_FULL STRUCT_MIRROR_NAME(corr);
+  STRUCT_MIRROR_FCNS_DECL(unpack_sticky_event);
+};
+#endif//USER_DEF_unpack_sticky_event
+
+#include "gen/default_mirror_undef.hh"
+
+
+/** END_MIRROR_STRUCT *************************************************/
@@ -0,0 +1,3605 @@
+/** BEGIN_STRUCTURES ***************************************************
+ *
+ * Event unpacker associated structures for CAMAC_LECROY_4434.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// CAMAC_LECROY_4434(channels)
+#if !PACKER_CODE
+# define DECLARED_UNPACK_CAMAC_LECROY_4434
+class CAMAC_LECROY_4434
+#else//PACKER_CODE
+# define DECLARED_PACKER_CAMAC_LECROY_4434
+class PACKER_CAMAC_LECROY_4434
+#endif//PACKER_CODE
+
+{
+public:
+  // MEMBER(DATA24 data[32] ZERO_SUPPRESS);
+  raw_array_zero_suppress<DATA24,DATA24,32> data;
+  // list(0<=index<channels)
+
+    // UINT32 ch_data NOENCODE
+    // {
+      //  0_23: value;
+      // 24_31: 0;
+      // ENCODE(data[index],(value=value));
+    // }
+
+public:
+#ifndef __PSDC__
+# if !PACKER_CODE
+template<typename __data_src_t>
+  void __unpack(__data_src_t &__buffer,uint32 channels);
+template<typename __data_src_t>
+  static bool __match(__data_src_t &__buffer,uint32 channels);
+  // void __clean();
+# else//PACKER_CODE
+template<typename __data_dest_t>
+  void __packer(__data_dest_t &__buffer,uint32 channels);
+# endif//PACKER_CODE
+
+  STRUCT_FCNS_DECL(CAMAC_LECROY_4434);
+#endif//!__PSDC__
+};
+
+/** END_STRUCTURES ****************************************************/
+/** BEGIN_STRUCTURES ***************************************************
+ *
+ * Event unpacker associated structures for CAMAC_PHILLIPS_7164.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// CAMAC_PHILLIPS_7164(channels,mark_channel_no)
+#if !PACKER_CODE
+# define DECLARED_UNPACK_CAMAC_PHILLIPS_7164
+class CAMAC_PHILLIPS_7164
+#else//PACKER_CODE
+# define DECLARED_PACKER_CAMAC_PHILLIPS_7164
+class PACKER_CAMAC_PHILLIPS_7164
+#endif//PACKER_CODE
+
+{
+public:
+  // MEMBER(DATA12 data[16] ZERO_SUPPRESS);
+  raw_array_zero_suppress<DATA12,DATA12,16> data;
+  // list(0<=index<channels)
+
+    // if(mark_channel_no)
+
+    // else
+
+      // UINT16 ch_data NOENCODE
+      // {
+        //  0_11: value;
+        // 12_15: channel = CHECK(index);
+        // ENCODE(data[index],(value=value));
+      // }
+      // UINT16 ch_data NOENCODE
+      // {
+        //  0_11: value;
+        // ENCODE(data[index],(value=value));
+      // }
+
+public:
+#ifndef __PSDC__
+# if !PACKER_CODE
+template<typename __data_src_t>
+  void __unpack(__data_src_t &__buffer,uint32 channels,uint32 mark_channel_no);
+template<typename __data_src_t>
+  static bool __match(__data_src_t &__buffer,uint32 channels,uint32 mark_channel_no);
+  // void __clean();
+# else//PACKER_CODE
+template<typename __data_dest_t>
+  void __packer(__data_dest_t &__buffer,uint32 channels,uint32 mark_channel_no);
+# endif//PACKER_CODE
+
+  STRUCT_FCNS_DECL(CAMAC_PHILLIPS_7164);
+#endif//!__PSDC__
+};
+
+/** END_STRUCTURES ****************************************************/
+/** BEGIN_STRUCTURES ***************************************************
+ *
+ * Event unpacker associated structures for CAMAC_SILENA_4418.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// CAMAC_SILENA_4418(channels,mark_channel_no)
+#if !PACKER_CODE
+# define DECLARED_UNPACK_CAMAC_SILENA_4418
+class CAMAC_SILENA_4418
+#else//PACKER_CODE
+# define DECLARED_PACKER_CAMAC_SILENA_4418
+class PACKER_CAMAC_SILENA_4418
+#endif//PACKER_CODE
+
+{
+public:
+  // MEMBER(DATA12_OVERFLOW data[8] ZERO_SUPPRESS);
+  raw_array_zero_suppress<DATA12_OVERFLOW,DATA12_OVERFLOW,8> data;
+  // list(0<=index<channels)
+
+    // if(mark_channel_no)
+
+    // else
+
+      // UINT16 ch_data NOENCODE
+      // {
+        //  0_11: value;
+        // 12_14: channel = CHECK(index);
+        //    15: overflow;
+        // ENCODE(data[index],(value=value,overflow=overflow));
+      // }
+      // UINT16 ch_data NOENCODE
+      // {
+        //  0_11: value;
+        //    15: overflow;
+        // ENCODE(data[index],(value=value,overflow=overflow));
+      // }
+
+public:
+#ifndef __PSDC__
+# if !PACKER_CODE
+template<typename __data_src_t>
+  void __unpack(__data_src_t &__buffer,uint32 channels,uint32 mark_channel_no);
+template<typename __data_src_t>
+  static bool __match(__data_src_t &__buffer,uint32 channels,uint32 mark_channel_no);
+  // void __clean();
+# else//PACKER_CODE
+template<typename __data_dest_t>
+  void __packer(__data_dest_t &__buffer,uint32 channels,uint32 mark_channel_no);
+# endif//PACKER_CODE
+
+  STRUCT_FCNS_DECL(CAMAC_SILENA_4418);
+#endif//!__PSDC__
+};
+
+/** END_STRUCTURES ****************************************************/
+/** BEGIN_STRUCTURES ***************************************************
+ *
+ * Event unpacker associated structures for FASTBUS_LECROY_1875.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// FASTBUS_LECROY_1875(geom,channels)
+#if !PACKER_CODE
+# define DECLARED_UNPACK_FASTBUS_LECROY_1875
+class FASTBUS_LECROY_1875
+#else//PACKER_CODE
+# define DECLARED_PACKER_FASTBUS_LECROY_1875
+class PACKER_FASTBUS_LECROY_1875
+#endif//PACKER_CODE
+
+{
+public:
+  // MEMBER(DATA12_RANGE data[64] ZERO_SUPPRESS);
+  raw_array_zero_suppress<DATA12_RANGE,DATA12_RANGE,64> data;
+  // UINT32 ch_data NOENCODE
+  // {
+    //  0_11: value;
+    // 16_21: channel = RANGE(0,(channels - 1));
+    //    23: range;
+    // 24_26: n = CHECK(0);
+    // 27_31: geom = MATCH(geom);
+    // ENCODE(data[channel],(value=value,range=range));
+  // }
+
+public:
+#ifndef __PSDC__
+# if !PACKER_CODE
+template<typename __data_src_t>
+  void __unpack(__data_src_t &__buffer,uint32 geom,uint32 channels);
+template<typename __data_src_t>
+  static bool __match(__data_src_t &__buffer,uint32 geom,uint32 channels);
+  // void __clean();
+# else//PACKER_CODE
+template<typename __data_dest_t>
+  void __packer(__data_dest_t &__buffer,uint32 geom,uint32 channels);
+# endif//PACKER_CODE
+
+  STRUCT_FCNS_DECL(FASTBUS_LECROY_1875);
+#endif//!__PSDC__
+};
+
+/** END_STRUCTURES ****************************************************/
+/** BEGIN_STRUCTURES ***************************************************
+ *
+ * Event unpacker associated structures for FASTBUS_LECROY_1885.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// FASTBUS_LECROY_1885(geom,channels)
+#if !PACKER_CODE
+# define DECLARED_UNPACK_FASTBUS_LECROY_1885
+class FASTBUS_LECROY_1885
+#else//PACKER_CODE
+# define DECLARED_PACKER_FASTBUS_LECROY_1885
+class PACKER_FASTBUS_LECROY_1885
+#endif//PACKER_CODE
+
+{
+public:
+  // MEMBER(DATA12_RANGE data[96] ZERO_SUPPRESS);
+  raw_array_zero_suppress<DATA12_RANGE,DATA12_RANGE,96> data;
+  // UINT32 ch_data NOENCODE
+  // {
+    //  0_11: value;
+    // 16_22: channel = RANGE(0,(channels - 1));
+    //    23: range;
+    // 24_26: n = CHECK(0);
+    // 27_31: geom = MATCH(geom);
+    // ENCODE(data[channel],(value=value,range=range));
+  // }
+
+public:
+#ifndef __PSDC__
+# if !PACKER_CODE
+template<typename __data_src_t>
+  void __unpack(__data_src_t &__buffer,uint32 geom,uint32 channels);
+template<typename __data_src_t>
+  static bool __match(__data_src_t &__buffer,uint32 geom,uint32 channels);
+  // void __clean();
+# else//PACKER_CODE
+template<typename __data_dest_t>
+  void __packer(__data_dest_t &__buffer,uint32 geom,uint32 channels);
+# endif//PACKER_CODE
+
+  STRUCT_FCNS_DECL(FASTBUS_LECROY_1885);
+#endif//!__PSDC__
+};
+
+/** END_STRUCTURES ****************************************************/
+/** BEGIN_STRUCTURES ***************************************************
+ *
+ * Event unpacker associated structures for ITEM64.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// ITEM64(num)
+#if !PACKER_CODE
+# define DECLARED_UNPACK_ITEM64
+class ITEM64
+#else//PACKER_CODE
+# define DECLARED_PACKER_ITEM64
+class PACKER_ITEM64
+#endif//PACKER_CODE
+
+{
+public:
+  // MEMBER(DATA64 member64);
+  DATA64 member64;
+  // UINT64 a
+  // {
+    //  0_01: 0;
+    //  5_07: num = MATCH(num);
+  // }
+  union
+  {
+    struct
+    {
+#if __BYTE_ORDER == __LITTLE_ENDIAN
+      uint64 unnamed_0_1 : 2; // 0..1
+      uint64 dummy_2_4 : 3;
+      uint64 num : 3; // 5..7
+      uint64 dummy_8_63 : 56;
+#endif
+#if __BYTE_ORDER == __BIG_ENDIAN
+      uint64 dummy_8_63 : 56;
+      uint64 num : 3; // 5..7
+      uint64 dummy_2_4 : 3;
+      uint64 unnamed_0_1 : 2; // 0..1
+#endif
+    };
+    uint64  u64;
+  } a;
+  // UINT64 b
+  // {
+    //  0_01: 0;
+    //  3_07: v;
+    // 20_63: 0x00123456;
+    // ENCODE(member64,(value=v));
+  // }
+  union
+  {
+    struct
+    {
+#if __BYTE_ORDER == __LITTLE_ENDIAN
+      uint64 unnamed_0_1 : 2; // 0..1
+      uint64 dummy_2 : 1;
+      uint64 v : 5; // 3..7
+      uint64 dummy_8_19 : 12;
+      uint64 unnamed_20_63 : 44; // 20..63
+#endif
+#if __BYTE_ORDER == __BIG_ENDIAN
+      uint64 unnamed_20_63 : 44; // 20..63
+      uint64 dummy_8_19 : 12;
+      uint64 v : 5; // 3..7
+      uint64 dummy_2 : 1;
+      uint64 unnamed_0_1 : 2; // 0..1
+#endif
+    };
+    uint64  u64;
+  } b;
+  // UINT32 c
+  // {
+    //  0_01: 0;
+    //  3_07: v;
+    // 20_31: 0x123;
+    // ENCODE(member64,(value=v));
+  // }
+  union
+  {
+    struct
+    {
+#if __BYTE_ORDER == __LITTLE_ENDIAN
+      uint32 unnamed_0_1 : 2; // 0..1
+      uint32 dummy_2 : 1;
+      uint32 v : 5; // 3..7
+      uint32 dummy_8_19 : 12;
+      uint32 unnamed_20_31 : 12; // 20..31
+#endif
+#if __BYTE_ORDER == __BIG_ENDIAN
+      uint32 unnamed_20_31 : 12; // 20..31
+      uint32 dummy_8_19 : 12;
+      uint32 v : 5; // 3..7
+      uint32 dummy_2 : 1;
+      uint32 unnamed_0_1 : 2; // 0..1
+#endif
+    };
+    uint32  u32;
+  } c;
+
+public:
+#ifndef __PSDC__
+# if !PACKER_CODE
+template<typename __data_src_t>
+  void __unpack(__data_src_t &__buffer,uint32 num);
+template<typename __data_src_t>
+  static bool __match(__data_src_t &__buffer,uint32 num);
+  // void __clean();
+# else//PACKER_CODE
+template<typename __data_dest_t>
+  void __packer(__data_dest_t &__buffer,uint32 num);
+# endif//PACKER_CODE
+
+  STRUCT_FCNS_DECL(ITEM64);
+#endif//!__PSDC__
+};
+
+/** END_STRUCTURES ****************************************************/
+/** BEGIN_STRUCTURES ***************************************************
+ *
+ * Event unpacker associated structures for ITEMQ.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// ITEMQ(num)
+#if !PACKER_CODE
+# define DECLARED_UNPACK_ITEMQ
+class ITEMQ
+#else//PACKER_CODE
+# define DECLARED_PACKER_ITEMQ
+class PACKER_ITEMQ
+#endif//PACKER_CODE
+
+{
+public:
+  // MEMBER(DATA32 chan);
+  DATA32 chan;
+  // UINT64 w1
+  // {
+    //    21: c21;
+  // }
+  union
+  {
+    struct
+    {
+#if __BYTE_ORDER == __LITTLE_ENDIAN
+      uint64 dummy_0_20 : 21;
+      uint64 c21 : 1; // 21
+      uint64 dummy_22_63 : 42;
+#endif
+#if __BYTE_ORDER == __BIG_ENDIAN
+      uint64 dummy_22_63 : 42;
+      uint64 c21 : 1; // 21
+      uint64 dummy_0_20 : 21;
+#endif
+    };
+    uint64  u64;
+  } w1;
+  // UINT64 w2
+  // {
+    //    22: c22;
+  // }
+  union
+  {
+    struct
+    {
+#if __BYTE_ORDER == __LITTLE_ENDIAN
+      uint64 dummy_0_21 : 22;
+      uint64 c22 : 1; // 22
+      uint64 dummy_23_63 : 41;
+#endif
+#if __BYTE_ORDER == __BIG_ENDIAN
+      uint64 dummy_23_63 : 41;
+      uint64 c22 : 1; // 22
+      uint64 dummy_0_21 : 22;
+#endif
+    };
+    uint64  u64;
+  } w2;
+  // ENCODE(chan,(value=(((w1.c21 << 12) & 0xf00) | w2.c22)));
+
+
+public:
+#ifndef __PSDC__
+# if !PACKER_CODE
+template<typename __data_src_t>
+  void __unpack(__data_src_t &__buffer,uint32 num);
+template<typename __data_src_t>
+  static bool __match(__data_src_t &__buffer,uint32 num);
+  // void __clean();
+# else//PACKER_CODE
+template<typename __data_dest_t>
+  void __packer(__data_dest_t &__buffer,uint32 num);
+# endif//PACKER_CODE
+
+  STRUCT_FCNS_DECL(ITEMQ);
+#endif//!__PSDC__
+};
+
+/** END_STRUCTURES ****************************************************/
+/** BEGIN_STRUCTURES ***************************************************
+ *
+ * Event unpacker associated structures for ITEM_ME2.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// ITEM_ME2(geom)
+#if !PACKER_CODE
+# define DECLARED_UNPACK_ITEM_ME2
+class ITEM_ME2
+#else//PACKER_CODE
+# define DECLARED_PACKER_ITEM_ME2
+class PACKER_ITEM_ME2
+#endif//PACKER_CODE
+
+{
+public:
+  // MEMBER(DATA16 data[32] ZERO_SUPPRESS);
+  raw_array_zero_suppress<DATA16,DATA16,32> data;
+  // optional UINT32 padding NOENCODE
+  // {
+    //  0_31: value = MATCH(0x32323232);
+  // }
+  // UINT32 header NOENCODE
+  // {
+    // 16_23: geom = MATCH(geom);
+  // }
+  // MATCH_END;
+  // UINT32 data NOENCODE
+  // {
+    // 16_23: geom = MATCH(geom);
+  // }
+
+public:
+#ifndef __PSDC__
+# if !PACKER_CODE
+template<typename __data_src_t>
+  void __unpack(__data_src_t &__buffer,uint32 geom);
+template<typename __data_src_t>
+  static bool __match(__data_src_t &__buffer,uint32 geom);
+  // void __clean();
+# else//PACKER_CODE
+template<typename __data_dest_t>
+  void __packer(__data_dest_t &__buffer,uint32 geom);
+# endif//PACKER_CODE
+
+  STRUCT_FCNS_DECL(ITEM_ME2);
+#endif//!__PSDC__
+};
+
+/** END_STRUCTURES ****************************************************/
+/** BEGIN_STRUCTURES ***************************************************
+ *
+ * Event unpacker associated structures for MADC32.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// MADC32(res,geo,channels)
+#if !PACKER_CODE
+# define DECLARED_UNPACK_MADC32
+class MADC32
+#else//PACKER_CODE
+# define DECLARED_PACKER_MADC32
+class PACKER_MADC32
+#endif//PACKER_CODE
+
+{
+public:
+  // UINT32 header
+  // {
+    //  0_11: word_counts;
+    // 12_14: resolution = MATCH(res);
+    //    15: unused1;
+    // 16_23: id = MATCH(geo);
+    // 24_29: 0;
+    // 30_31: 1;
+  // }
+  union
+  {
+    struct
+    {
+#if __BYTE_ORDER == __LITTLE_ENDIAN
+      uint32 word_counts : 12; // 0..11
+      uint32 resolution : 3; // 12..14
+      uint32 unused1 : 1; // 15
+      uint32 id : 8; // 16..23
+      uint32 unnamed_24_29 : 6; // 24..29
+      uint32 unnamed_30_31 : 2; // 30..31
+#endif
+#if __BYTE_ORDER == __BIG_ENDIAN
+      uint32 unnamed_30_31 : 2; // 30..31
+      uint32 unnamed_24_29 : 6; // 24..29
+      uint32 id : 8; // 16..23
+      uint32 unused1 : 1; // 15
+      uint32 resolution : 3; // 12..14
+      uint32 word_counts : 12; // 0..11
+#endif
+    };
+    uint32  u32;
+  } header;
+  // if((header.resolution == 0))
+
+  // else
+
+    // UINT32 madc32_data0
+    // {
+      //  0_10: adc_value;
+      // 11_13: 0;
+      //    14: unused;
+      //    15: 0;
+      // 16_20: channel = RANGE(0,channels);
+      // 21_29: 32;
+      // 30_31: 0;
+    // }
+    union
+    {
+      struct
+      {
+#if __BYTE_ORDER == __LITTLE_ENDIAN
+        uint32 adc_value : 11; // 0..10
+        uint32 unnamed_11_13 : 3; // 11..13
+        uint32 unused : 1; // 14
+        uint32 unnamed_15_15 : 1; // 15
+        uint32 channel : 5; // 16..20
+        uint32 unnamed_21_29 : 9; // 21..29
+        uint32 unnamed_30_31 : 2; // 30..31
+#endif
+#if __BYTE_ORDER == __BIG_ENDIAN
+        uint32 unnamed_30_31 : 2; // 30..31
+        uint32 unnamed_21_29 : 9; // 21..29
+        uint32 channel : 5; // 16..20
+        uint32 unnamed_15_15 : 1; // 15
+        uint32 unused : 1; // 14
+        uint32 unnamed_11_13 : 3; // 11..13
+        uint32 adc_value : 11; // 0..10
+#endif
+      };
+      uint32  u32;
+    } madc32_data0;
+    // if(((header.resolution == 1) || (header.resolution == 2)))
+
+    // else
+
+      // UINT32 madc32_data1
+      // {
+        //  0_11: adc_value;
+        // 12_13: 0;
+        //    14: unused;
+        //    15: 0;
+        // 16_20: channel = RANGE(0,channels);
+        // 21_29: 32;
+        // 30_31: 0;
+      // }
+      union
+      {
+        struct
+        {
+#if __BYTE_ORDER == __LITTLE_ENDIAN
+          uint32 adc_value : 12; // 0..11
+          uint32 unnamed_12_13 : 2; // 12..13
+          uint32 unused : 1; // 14
+          uint32 unnamed_15_15 : 1; // 15
+          uint32 channel : 5; // 16..20
+          uint32 unnamed_21_29 : 9; // 21..29
+          uint32 unnamed_30_31 : 2; // 30..31
+#endif
+#if __BYTE_ORDER == __BIG_ENDIAN
+          uint32 unnamed_30_31 : 2; // 30..31
+          uint32 unnamed_21_29 : 9; // 21..29
+          uint32 channel : 5; // 16..20
+          uint32 unnamed_15_15 : 1; // 15
+          uint32 unused : 1; // 14
+          uint32 unnamed_12_13 : 2; // 12..13
+          uint32 adc_value : 12; // 0..11
+#endif
+        };
+        uint32  u32;
+      } madc32_data1;
+      // if(((header.resolution == 3) || (header.resolution == 4)))
+
+        // UINT32 madc32_data3
+        // {
+          //  0_12: adc_value;
+          //    13: 0;
+          //    14: unused;
+          //    15: 0;
+          // 16_20: channel = RANGE(0,channels);
+          // 21_29: 32;
+          // 30_31: 0;
+        // }
+        union
+        {
+          struct
+          {
+#if __BYTE_ORDER == __LITTLE_ENDIAN
+            uint32 adc_value : 13; // 0..12
+            uint32 unnamed_13_13 : 1; // 13
+            uint32 unused : 1; // 14
+            uint32 unnamed_15_15 : 1; // 15
+            uint32 channel : 5; // 16..20
+            uint32 unnamed_21_29 : 9; // 21..29
+            uint32 unnamed_30_31 : 2; // 30..31
+#endif
+#if __BYTE_ORDER == __BIG_ENDIAN
+            uint32 unnamed_30_31 : 2; // 30..31
+            uint32 unnamed_21_29 : 9; // 21..29
+            uint32 channel : 5; // 16..20
+            uint32 unnamed_15_15 : 1; // 15
+            uint32 unused : 1; // 14
+            uint32 unnamed_13_13 : 1; // 13
+            uint32 adc_value : 13; // 0..12
+#endif
+          };
+          uint32  u32;
+        } madc32_data3;
+  // UINT32 trailer
+  // {
+    //  0_29: evt_counter;
+    // 30_31: 3;
+  // }
+  union
+  {
+    struct
+    {
+#if __BYTE_ORDER == __LITTLE_ENDIAN
+      uint32 evt_counter : 30; // 0..29
+      uint32 unnamed_30_31 : 2; // 30..31
+#endif
+#if __BYTE_ORDER == __BIG_ENDIAN
+      uint32 unnamed_30_31 : 2; // 30..31
+      uint32 evt_counter : 30; // 0..29
+#endif
+    };
+    uint32  u32;
+  } trailer;
+
+public:
+#ifndef __PSDC__
+# if !PACKER_CODE
+template<typename __data_src_t>
+  void __unpack(__data_src_t &__buffer,uint32 res,uint32 geo,uint32 channels);
+template<typename __data_src_t>
+  static bool __match(__data_src_t &__buffer,uint32 res,uint32 geo,uint32 channels);
+  // void __clean();
+# else//PACKER_CODE
+template<typename __data_dest_t>
+  void __packer(__data_dest_t &__buffer,uint32 res,uint32 geo,uint32 channels);
+# endif//PACKER_CODE
+
+  STRUCT_FCNS_DECL(MADC32);
+#endif//!__PSDC__
+};
+
+/** END_STRUCTURES ****************************************************/
+/** BEGIN_STRUCTURES ***************************************************
+ *
+ * Event unpacker associated structures for SINGLE_DATA_MODULE.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// SINGLE_DATA_MODULE()
+#if !PACKER_CODE
+# define DECLARED_UNPACK_SINGLE_DATA_MODULE
+class SINGLE_DATA_MODULE
+#else//PACKER_CODE
+# define DECLARED_PACKER_SINGLE_DATA_MODULE
+class PACKER_SINGLE_DATA_MODULE
+#endif//PACKER_CODE
+
+{
+public:
+  // UINT32 data;
+  uint32  data;
+
+public:
+#ifndef __PSDC__
+# if !PACKER_CODE
+template<typename __data_src_t>
+  void __unpack(__data_src_t &__buffer);
+template<typename __data_src_t>
+  static bool __match(__data_src_t &__buffer);
+  // void __clean();
+# else//PACKER_CODE
+template<typename __data_dest_t>
+  void __packer(__data_dest_t &__buffer);
+# endif//PACKER_CODE
+
+  STRUCT_FCNS_DECL(SINGLE_DATA_MODULE);
+#endif//!__PSDC__
+};
+
+/** END_STRUCTURES ****************************************************/
+/** BEGIN_STRUCTURES ***************************************************
+ *
+ * Event unpacker associated structures for STICKY_ACTIVE.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// STICKY_ACTIVE()
+#if !PACKER_CODE
+# define DECLARED_UNPACK_STICKY_ACTIVE
+class STICKY_ACTIVE
+#else//PACKER_CODE
+# define DECLARED_PACKER_STICKY_ACTIVE
+class PACKER_STICKY_ACTIVE
+#endif//PACKER_CODE
+
+{
+public:
+  // UINT32 separator
+  // {
+    //  0_31: 7;
+  // }
+  union
+  {
+    struct
+    {
+#if __BYTE_ORDER == __LITTLE_ENDIAN
+      uint32 unnamed_0_31 : 32; // 0..31
+#endif
+#if __BYTE_ORDER == __BIG_ENDIAN
+      uint32 unnamed_0_31 : 32; // 0..31
+#endif
+    };
+    uint32  u32;
+  } separator;
+  // UINT32 active;
+  uint32  active;
+  // UINT32 mark;
+  uint32  mark;
+  // UINT32 corr;
+  uint32  corr;
+
+public:
+#ifndef __PSDC__
+# if !PACKER_CODE
+template<typename __data_src_t>
+  void __unpack(__data_src_t &__buffer);
+template<typename __data_src_t>
+  static bool __match(__data_src_t &__buffer);
+  // void __clean();
+# else//PACKER_CODE
+template<typename __data_dest_t>
+  void __packer(__data_dest_t &__buffer);
+# endif//PACKER_CODE
+
+  STRUCT_FCNS_DECL(STICKY_ACTIVE);
+#endif//!__PSDC__
+};
+
+/** END_STRUCTURES ****************************************************/
+/** BEGIN_STRUCTURES ***************************************************
+ *
+ * Event unpacker associated structures for VME_CAEN_V1190_SUBTDC.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// VME_CAEN_V1190_SUBTDC(tdc,event_id,data)
+#if !PACKER_CODE
+# define DECLARED_UNPACK_VME_CAEN_V1190_SUBTDC
+class VME_CAEN_V1190_SUBTDC
+#else//PACKER_CODE
+# define DECLARED_PACKER_VME_CAEN_V1190_SUBTDC
+class PACKER_VME_CAEN_V1190_SUBTDC
+#endif//PACKER_CODE
+
+{
+public:
+  // MEMBER(DATA24 data[32] ZERO_SUPPRESS_MULTI(128));
+  // MARK_COUNT(tdc_start);
+  // UINT32 header
+  // {
+    //  0_11: bunch_id;
+    // 12_23: event_id = CHECK(event_id);
+    // 24_25: tdc = MATCH(tdc);
+    // 27_31: 1;
+  // }
+  union
+  {
+    struct
+    {
+#if __BYTE_ORDER == __LITTLE_ENDIAN
+      uint32 bunch_id : 12; // 0..11
+      uint32 event_id : 12; // 12..23
+      uint32 tdc : 2; // 24..25
+      uint32 dummy_26 : 1;
+      uint32 unnamed_27_31 : 5; // 27..31
+#endif
+#if __BYTE_ORDER == __BIG_ENDIAN
+      uint32 unnamed_27_31 : 5; // 27..31
+      uint32 dummy_26 : 1;
+      uint32 tdc : 2; // 24..25
+      uint32 event_id : 12; // 12..23
+      uint32 bunch_id : 12; // 0..11
+#endif
+    };
+    uint32  u32;
+  } header;
+  // several UINT32 ch_data NOENCODE
+  // {
+    //  0_18: value;
+    // 19_23: channel_low;
+    // 24_25: tdc = CHECK(tdc);
+    //    26: trailing;
+    // 27_31: 0;
+    // ENCODE(data[((tdc << 5) | channel_low)],(value=value));
+  // }
+  // optional UINT32 error_flags
+  // {
+    //  0_14: flags;
+    // 24_25: tdc = CHECK(tdc);
+    // 27_31: 4;
+  // }
+  union
+  {
+    struct
+    {
+#if __BYTE_ORDER == __LITTLE_ENDIAN
+      uint32 flags : 15; // 0..14
+      uint32 dummy_15_23 : 9;
+      uint32 tdc : 2; // 24..25
+      uint32 dummy_26 : 1;
+      uint32 unnamed_27_31 : 5; // 27..31
+#endif
+#if __BYTE_ORDER == __BIG_ENDIAN
+      uint32 unnamed_27_31 : 5; // 27..31
+      uint32 dummy_26 : 1;
+      uint32 tdc : 2; // 24..25
+      uint32 dummy_15_23 : 9;
+      uint32 flags : 15; // 0..14
+#endif
+    };
+    uint32  u32;
+  } error_flags;
+  // MARK_COUNT(tdc_end);
+  // UINT32 trailer
+  // {
+    //  0_11: word_count = CHECK_COUNT(tdc_start,tdc_end,4,4);
+    // 12_23: event_id = CHECK(header.event_id);
+    // 24_25: tdc = CHECK(tdc);
+    // 27_31: 3;
+  // }
+  union
+  {
+    struct
+    {
+#if __BYTE_ORDER == __LITTLE_ENDIAN
+      uint32 word_count : 12; // 0..11
+      uint32 event_id : 12; // 12..23
+      uint32 tdc : 2; // 24..25
+      uint32 dummy_26 : 1;
+      uint32 unnamed_27_31 : 5; // 27..31
+#endif
+#if __BYTE_ORDER == __BIG_ENDIAN
+      uint32 unnamed_27_31 : 5; // 27..31
+      uint32 dummy_26 : 1;
+      uint32 tdc : 2; // 24..25
+      uint32 event_id : 12; // 12..23
+      uint32 word_count : 12; // 0..11
+#endif
+    };
+    uint32  u32;
+  } trailer;
+
+public:
+#ifndef __PSDC__
+# if !PACKER_CODE
+template<typename __data_src_t>
+  void __unpack(__data_src_t &__buffer,uint32 tdc,uint32 event_id,raw_array_multi_zero_suppress<DATA24,DATA24,32,128> &data);
+template<typename __data_src_t>
+  static bool __match(__data_src_t &__buffer,uint32 tdc,uint32 event_id);
+  // void __clean();
+# else//PACKER_CODE
+template<typename __data_dest_t>
+  void __packer(__data_dest_t &__buffer,uint32 tdc,uint32 event_id,raw_array_multi_zero_suppress<DATA24,DATA24,32,128> &data);
+# endif//PACKER_CODE
+
+  STRUCT_FCNS_DECL(VME_CAEN_V1190_SUBTDC);
+#endif//!__PSDC__
+};
+
+/** END_STRUCTURES ****************************************************/
+/** BEGIN_STRUCTURES ***************************************************
+ *
+ * Event unpacker associated structures for VME_CAEN_V1190.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// VME_CAEN_V1190(geom)
+#if !PACKER_CODE
+# define DECLARED_UNPACK_VME_CAEN_V1190
+class VME_CAEN_V1190
+#else//PACKER_CODE
+# define DECLARED_PACKER_VME_CAEN_V1190
+class PACKER_VME_CAEN_V1190
+#endif//PACKER_CODE
+
+{
+public:
+  // MEMBER(DATA24 data[32] ZERO_SUPPRESS_MULTI(128));
+  raw_array_multi_zero_suppress<DATA24,DATA24,32,128> data;
+  // MARK_COUNT(v1190_start);
+  // UINT32 header
+  // {
+    //  0_04: geom = MATCH(geom);
+    //  5_26: event_number;
+    // 27_31: 8;
+  // }
+  union
+  {
+    struct
+    {
+#if __BYTE_ORDER == __LITTLE_ENDIAN
+      uint32 geom : 5; // 0..4
+      uint32 event_number : 22; // 5..26
+      uint32 unnamed_27_31 : 5; // 27..31
+#endif
+#if __BYTE_ORDER == __BIG_ENDIAN
+      uint32 unnamed_27_31 : 5; // 27..31
+      uint32 event_number : 22; // 5..26
+      uint32 geom : 5; // 0..4
+#endif
+    };
+    uint32  u32;
+  } header;
+  // select several
+
+    // tdc[0] = VME_CAEN_V1190_SUBTDC(tdc=0,event_id=(header.event_number & 0xfff),
+                                   // data=data);
+    // tdc[1] = VME_CAEN_V1190_SUBTDC(tdc=1,event_id=(header.event_number & 0xfff),
+                                   // data=data);
+    // tdc[2] = VME_CAEN_V1190_SUBTDC(tdc=2,event_id=(header.event_number & 0xfff),
+                                   // data=data);
+    // tdc[3] = VME_CAEN_V1190_SUBTDC(tdc=3,event_id=(header.event_number & 0xfff),
+                                   // data=data);
+  SINGLE(VME_CAEN_V1190_SUBTDC,tdc[4]);
+  // UINT32 trigger
+  // {
+    //  0_26: time_tag;
+    // 27_31: 17;
+  // }
+  union
+  {
+    struct
+    {
+#if __BYTE_ORDER == __LITTLE_ENDIAN
+      uint32 time_tag : 27; // 0..26
+      uint32 unnamed_27_31 : 5; // 27..31
+#endif
+#if __BYTE_ORDER == __BIG_ENDIAN
+      uint32 unnamed_27_31 : 5; // 27..31
+      uint32 time_tag : 27; // 0..26
+#endif
+    };
+    uint32  u32;
+  } trigger;
+  // MARK_COUNT(v1190_end);
+  // UINT32 trailer
+  // {
+    //  0_04: geom = CHECK(geom);
+    //  5_19: word_count = CHECK_COUNT(v1190_start,v1190_end,4,4);
+    //    24: tdc_error;
+    //    25: buffer_overflow;
+    //    26: trigger_lost;
+    // 27_31: 16;
+  // }
+  union
+  {
+    struct
+    {
+#if __BYTE_ORDER == __LITTLE_ENDIAN
+      uint32 geom : 5; // 0..4
+      uint32 word_count : 15; // 5..19
+      uint32 dummy_20_23 : 4;
+      uint32 tdc_error : 1; // 24
+      uint32 buffer_overflow : 1; // 25
+      uint32 trigger_lost : 1; // 26
+      uint32 unnamed_27_31 : 5; // 27..31
+#endif
+#if __BYTE_ORDER == __BIG_ENDIAN
+      uint32 unnamed_27_31 : 5; // 27..31
+      uint32 trigger_lost : 1; // 26
+      uint32 buffer_overflow : 1; // 25
+      uint32 tdc_error : 1; // 24
+      uint32 dummy_20_23 : 4;
+      uint32 word_count : 15; // 5..19
+      uint32 geom : 5; // 0..4
+#endif
+    };
+    uint32  u32;
+  } trailer;
+
+public:
+#ifndef __PSDC__
+# if !PACKER_CODE
+template<typename __data_src_t>
+  void __unpack(__data_src_t &__buffer,uint32 geom);
+template<typename __data_src_t>
+  static bool __match(__data_src_t &__buffer,uint32 geom);
+  // void __clean();
+# else//PACKER_CODE
+template<typename __data_dest_t>
+  void __packer(__data_dest_t &__buffer,uint32 geom);
+# endif//PACKER_CODE
+
+  STRUCT_FCNS_DECL(VME_CAEN_V1190);
+#endif//!__PSDC__
+};
+
+/** END_STRUCTURES ****************************************************/
+/** BEGIN_STRUCTURES ***************************************************
+ *
+ * Event unpacker associated structures for VME_CAEN_V1190_SHORT_SUBTDC.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// VME_CAEN_V1190_SHORT_SUBTDC(tdc,event_id,data)
+#if !PACKER_CODE
+# define DECLARED_UNPACK_VME_CAEN_V1190_SHORT_SUBTDC
+class VME_CAEN_V1190_SHORT_SUBTDC
+#else//PACKER_CODE
+# define DECLARED_PACKER_VME_CAEN_V1190_SHORT_SUBTDC
+class PACKER_VME_CAEN_V1190_SHORT_SUBTDC
+#endif//PACKER_CODE
+
+{
+public:
+  // MEMBER(DATA24 data[32] ZERO_SUPPRESS_MULTI(128));
+  // UINT32 ch_data NOENCODE
+  // {
+    //  0_18: value;
+    // 19_23: channel_low;
+    // 24_25: tdc = CHECK(tdc);
+    //    26: trailing;
+    // 27_31: 0;
+    // ENCODE(data[((tdc << 5) | channel_low)],(value=value));
+  // }
+
+public:
+#ifndef __PSDC__
+# if !PACKER_CODE
+template<typename __data_src_t>
+  void __unpack(__data_src_t &__buffer,uint32 tdc,uint32 event_id,raw_array_multi_zero_suppress<DATA24,DATA24,32,128> &data);
+template<typename __data_src_t>
+  static bool __match(__data_src_t &__buffer,uint32 tdc,uint32 event_id);
+  // void __clean();
+# else//PACKER_CODE
+template<typename __data_dest_t>
+  void __packer(__data_dest_t &__buffer,uint32 tdc,uint32 event_id,raw_array_multi_zero_suppress<DATA24,DATA24,32,128> &data);
+# endif//PACKER_CODE
+
+  STRUCT_FCNS_DECL(VME_CAEN_V1190_SHORT_SUBTDC);
+#endif//!__PSDC__
+};
+
+/** END_STRUCTURES ****************************************************/
+/** BEGIN_STRUCTURES ***************************************************
+ *
+ * Event unpacker associated structures for VME_CAEN_V1190_SHORT_SUBTDC_ERROR.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// VME_CAEN_V1190_SHORT_SUBTDC_ERROR(tdc)
+#if !PACKER_CODE
+# define DECLARED_UNPACK_VME_CAEN_V1190_SHORT_SUBTDC_ERROR
+class VME_CAEN_V1190_SHORT_SUBTDC_ERROR
+#else//PACKER_CODE
+# define DECLARED_PACKER_VME_CAEN_V1190_SHORT_SUBTDC_ERROR
+class PACKER_VME_CAEN_V1190_SHORT_SUBTDC_ERROR
+#endif//PACKER_CODE
+
+{
+public:
+  // UINT32 error_flags
+  // {
+    //  0_14: flags;
+    // 24_25: tdc = CHECK(tdc);
+    // 27_31: 4;
+  // }
+  union
+  {
+    struct
+    {
+#if __BYTE_ORDER == __LITTLE_ENDIAN
+      uint32 flags : 15; // 0..14
+      uint32 dummy_15_23 : 9;
+      uint32 tdc : 2; // 24..25
+      uint32 dummy_26 : 1;
+      uint32 unnamed_27_31 : 5; // 27..31
+#endif
+#if __BYTE_ORDER == __BIG_ENDIAN
+      uint32 unnamed_27_31 : 5; // 27..31
+      uint32 dummy_26 : 1;
+      uint32 tdc : 2; // 24..25
+      uint32 dummy_15_23 : 9;
+      uint32 flags : 15; // 0..14
+#endif
+    };
+    uint32  u32;
+  } error_flags;
+
+public:
+#ifndef __PSDC__
+# if !PACKER_CODE
+template<typename __data_src_t>
+  void __unpack(__data_src_t &__buffer,uint32 tdc);
+template<typename __data_src_t>
+  static bool __match(__data_src_t &__buffer,uint32 tdc);
+  // void __clean();
+# else//PACKER_CODE
+template<typename __data_dest_t>
+  void __packer(__data_dest_t &__buffer,uint32 tdc);
+# endif//PACKER_CODE
+
+  STRUCT_FCNS_DECL(VME_CAEN_V1190_SHORT_SUBTDC_ERROR);
+#endif//!__PSDC__
+};
+
+/** END_STRUCTURES ****************************************************/
+/** BEGIN_STRUCTURES ***************************************************
+ *
+ * Event unpacker associated structures for VME_CAEN_V1190_SHORT.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// VME_CAEN_V1190_SHORT(geom)
+#if !PACKER_CODE
+# define DECLARED_UNPACK_VME_CAEN_V1190_SHORT
+class VME_CAEN_V1190_SHORT
+#else//PACKER_CODE
+# define DECLARED_PACKER_VME_CAEN_V1190_SHORT
+class PACKER_VME_CAEN_V1190_SHORT
+#endif//PACKER_CODE
+
+{
+public:
+  // MEMBER(DATA24 data[32] ZERO_SUPPRESS_MULTI(128));
+  raw_array_multi_zero_suppress<DATA24,DATA24,32,128> data;
+  // MARK_COUNT(v1190_start);
+  // UINT32 header
+  // {
+    //  0_04: geom = MATCH(geom);
+    //  5_26: event_number;
+    // 27_31: 8;
+  // }
+  union
+  {
+    struct
+    {
+#if __BYTE_ORDER == __LITTLE_ENDIAN
+      uint32 geom : 5; // 0..4
+      uint32 event_number : 22; // 5..26
+      uint32 unnamed_27_31 : 5; // 27..31
+#endif
+#if __BYTE_ORDER == __BIG_ENDIAN
+      uint32 unnamed_27_31 : 5; // 27..31
+      uint32 event_number : 22; // 5..26
+      uint32 geom : 5; // 0..4
+#endif
+    };
+    uint32  u32;
+  } header;
+  // select several
+
+    // tdc[0] = VME_CAEN_V1190_SHORT_SUBTDC(tdc=0,event_id=(header.event_number & 0xfff),
+                                         // data=data);
+    // tdc[1] = VME_CAEN_V1190_SHORT_SUBTDC(tdc=1,event_id=(header.event_number & 0xfff),
+                                         // data=data);
+    // tdc[2] = VME_CAEN_V1190_SHORT_SUBTDC(tdc=2,event_id=(header.event_number & 0xfff),
+                                         // data=data);
+    // tdc[3] = VME_CAEN_V1190_SHORT_SUBTDC(tdc=3,event_id=(header.event_number & 0xfff),
+                                         // data=data);
+    // norevisit err[0] = VME_CAEN_V1190_SHORT_SUBTDC_ERROR(tdc=0);
+    // norevisit err[1] = VME_CAEN_V1190_SHORT_SUBTDC_ERROR(tdc=1);
+    // norevisit err[2] = VME_CAEN_V1190_SHORT_SUBTDC_ERROR(tdc=2);
+    // norevisit err[3] = VME_CAEN_V1190_SHORT_SUBTDC_ERROR(tdc=3);
+  SINGLE(VME_CAEN_V1190_SHORT_SUBTDC,tdc[4]);
+  SINGLE(VME_CAEN_V1190_SHORT_SUBTDC_ERROR,err[4]);
+  // UINT32 trigger
+  // {
+    //  0_26: time_tag;
+    // 27_31: 17;
+  // }
+  union
+  {
+    struct
+    {
+#if __BYTE_ORDER == __LITTLE_ENDIAN
+      uint32 time_tag : 27; // 0..26
+      uint32 unnamed_27_31 : 5; // 27..31
+#endif
+#if __BYTE_ORDER == __BIG_ENDIAN
+      uint32 unnamed_27_31 : 5; // 27..31
+      uint32 time_tag : 27; // 0..26
+#endif
+    };
+    uint32  u32;
+  } trigger;
+  // MARK_COUNT(v1190_end);
+  // UINT32 trailer
+  // {
+    //  0_04: geom = CHECK(geom);
+    //  5_19: word_count = CHECK_COUNT(v1190_start,v1190_end,4,4);
+    //    24: tdc_error;
+    //    25: buffer_overflow;
+    //    26: trigger_lost;
+    // 27_31: 16;
+  // }
+  union
+  {
+    struct
+    {
+#if __BYTE_ORDER == __LITTLE_ENDIAN
+      uint32 geom : 5; // 0..4
+      uint32 word_count : 15; // 5..19
+      uint32 dummy_20_23 : 4;
+      uint32 tdc_error : 1; // 24
+      uint32 buffer_overflow : 1; // 25
+      uint32 trigger_lost : 1; // 26
+      uint32 unnamed_27_31 : 5; // 27..31
+#endif
+#if __BYTE_ORDER == __BIG_ENDIAN
+      uint32 unnamed_27_31 : 5; // 27..31
+      uint32 trigger_lost : 1; // 26
+      uint32 buffer_overflow : 1; // 25
+      uint32 tdc_error : 1; // 24
+      uint32 dummy_20_23 : 4;
+      uint32 word_count : 15; // 5..19
+      uint32 geom : 5; // 0..4
+#endif
+    };
+    uint32  u32;
+  } trailer;
+
+public:
+#ifndef __PSDC__
+# if !PACKER_CODE
+template<typename __data_src_t>
+  void __unpack(__data_src_t &__buffer,uint32 geom);
+template<typename __data_src_t>
+  static bool __match(__data_src_t &__buffer,uint32 geom);
+  // void __clean();
+# else//PACKER_CODE
+template<typename __data_dest_t>
+  void __packer(__data_dest_t &__buffer,uint32 geom);
+# endif//PACKER_CODE
+
+  STRUCT_FCNS_DECL(VME_CAEN_V1190_SHORT);
+#endif//!__PSDC__
+};
+
+/** END_STRUCTURES ****************************************************/
+/** BEGIN_STRUCTURES ***************************************************
+ *
+ * Event unpacker associated structures for VME_CAEN_V1290_SUBTDC.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// VME_CAEN_V1290_SUBTDC(tdc,event_id,data)
+#if !PACKER_CODE
+# define DECLARED_UNPACK_VME_CAEN_V1290_SUBTDC
+class VME_CAEN_V1290_SUBTDC
+#else//PACKER_CODE
+# define DECLARED_PACKER_VME_CAEN_V1290_SUBTDC
+class PACKER_VME_CAEN_V1290_SUBTDC
+#endif//PACKER_CODE
+
+{
+public:
+  // MEMBER(DATA24 data[32] ZERO_SUPPRESS_MULTI(128));
+  // MARK_COUNT(tdc_start);
+  // UINT32 header
+  // {
+    //  0_11: bunch_id;
+    // 12_23: event_id = CHECK(event_id);
+    // 24_25: tdc = MATCH(tdc);
+    // 27_31: 1;
+  // }
+  union
+  {
+    struct
+    {
+#if __BYTE_ORDER == __LITTLE_ENDIAN
+      uint32 bunch_id : 12; // 0..11
+      uint32 event_id : 12; // 12..23
+      uint32 tdc : 2; // 24..25
+      uint32 dummy_26 : 1;
+      uint32 unnamed_27_31 : 5; // 27..31
+#endif
+#if __BYTE_ORDER == __BIG_ENDIAN
+      uint32 unnamed_27_31 : 5; // 27..31
+      uint32 dummy_26 : 1;
+      uint32 tdc : 2; // 24..25
+      uint32 event_id : 12; // 12..23
+      uint32 bunch_id : 12; // 0..11
+#endif
+    };
+    uint32  u32;
+  } header;
+  // several UINT32 ch_data NOENCODE
+  // {
+    //  0_20: value;
+    // 21_23: channel_low;
+    // 24_25: tdc = CHECK(tdc);
+    //    26: trailing;
+    // 27_31: 0;
+    // ENCODE(data[((tdc << 3) | channel_low)],(value=value));
+  // }
+  // optional UINT32 error_flags
+  // {
+    //  0_14: flags;
+    // 24_25: tdc = CHECK(tdc);
+    // 27_31: 4;
+  // }
+  union
+  {
+    struct
+    {
+#if __BYTE_ORDER == __LITTLE_ENDIAN
+      uint32 flags : 15; // 0..14
+      uint32 dummy_15_23 : 9;
+      uint32 tdc : 2; // 24..25
+      uint32 dummy_26 : 1;
+      uint32 unnamed_27_31 : 5; // 27..31
+#endif
+#if __BYTE_ORDER == __BIG_ENDIAN
+      uint32 unnamed_27_31 : 5; // 27..31
+      uint32 dummy_26 : 1;
+      uint32 tdc : 2; // 24..25
+      uint32 dummy_15_23 : 9;
+      uint32 flags : 15; // 0..14
+#endif
+    };
+    uint32  u32;
+  } error_flags;
+  // MARK_COUNT(tdc_end);
+  // UINT32 trailer
+  // {
+    //  0_11: word_count = CHECK_COUNT(tdc_start,tdc_end,4,4);
+    // 12_23: event_id = CHECK(header.event_id);
+    // 24_25: tdc = CHECK(tdc);
+    // 27_31: 3;
+  // }
+  union
+  {
+    struct
+    {
+#if __BYTE_ORDER == __LITTLE_ENDIAN
+      uint32 word_count : 12; // 0..11
+      uint32 event_id : 12; // 12..23
+      uint32 tdc : 2; // 24..25
+      uint32 dummy_26 : 1;
+      uint32 unnamed_27_31 : 5; // 27..31
+#endif
+#if __BYTE_ORDER == __BIG_ENDIAN
+      uint32 unnamed_27_31 : 5; // 27..31
+      uint32 dummy_26 : 1;
+      uint32 tdc : 2; // 24..25
+      uint32 event_id : 12; // 12..23
+      uint32 word_count : 12; // 0..11
+#endif
+    };
+    uint32  u32;
+  } trailer;
+
+public:
+#ifndef __PSDC__
+# if !PACKER_CODE
+template<typename __data_src_t>
+  void __unpack(__data_src_t &__buffer,uint32 tdc,uint32 event_id,raw_array_multi_zero_suppress<DATA24,DATA24,32,128> &data);
+template<typename __data_src_t>
+  static bool __match(__data_src_t &__buffer,uint32 tdc,uint32 event_id);
+  // void __clean();
+# else//PACKER_CODE
+template<typename __data_dest_t>
+  void __packer(__data_dest_t &__buffer,uint32 tdc,uint32 event_id,raw_array_multi_zero_suppress<DATA24,DATA24,32,128> &data);
+# endif//PACKER_CODE
+
+  STRUCT_FCNS_DECL(VME_CAEN_V1290_SUBTDC);
+#endif//!__PSDC__
+};
+
+/** END_STRUCTURES ****************************************************/
+/** BEGIN_STRUCTURES ***************************************************
+ *
+ * Event unpacker associated structures for VME_CAEN_V1290.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// VME_CAEN_V1290(geom)
+#if !PACKER_CODE
+# define DECLARED_UNPACK_VME_CAEN_V1290
+class VME_CAEN_V1290
+#else//PACKER_CODE
+# define DECLARED_PACKER_VME_CAEN_V1290
+class PACKER_VME_CAEN_V1290
+#endif//PACKER_CODE
+
+{
+public:
+  // MEMBER(DATA24 data[32] ZERO_SUPPRESS_MULTI(128));
+  raw_array_multi_zero_suppress<DATA24,DATA24,32,128> data;
+  // MARK_COUNT(v1190_start);
+  // UINT32 header
+  // {
+    //  0_04: geom = MATCH(geom);
+    //  5_26: event_number;
+    // 27_31: 8;
+  // }
+  union
+  {
+    struct
+    {
+#if __BYTE_ORDER == __LITTLE_ENDIAN
+      uint32 geom : 5; // 0..4
+      uint32 event_number : 22; // 5..26
+      uint32 unnamed_27_31 : 5; // 27..31
+#endif
+#if __BYTE_ORDER == __BIG_ENDIAN
+      uint32 unnamed_27_31 : 5; // 27..31
+      uint32 event_number : 22; // 5..26
+      uint32 geom : 5; // 0..4
+#endif
+    };
+    uint32  u32;
+  } header;
+  // select several
+
+    // tdc[0] = VME_CAEN_V1290_SUBTDC(tdc=0,event_id=(header.event_number & 0xfff),
+                                   // data=data);
+    // tdc[1] = VME_CAEN_V1290_SUBTDC(tdc=1,event_id=(header.event_number & 0xfff),
+                                   // data=data);
+    // tdc[2] = VME_CAEN_V1290_SUBTDC(tdc=2,event_id=(header.event_number & 0xfff),
+                                   // data=data);
+    // tdc[3] = VME_CAEN_V1290_SUBTDC(tdc=3,event_id=(header.event_number & 0xfff),
+                                   // data=data);
+  SINGLE(VME_CAEN_V1290_SUBTDC,tdc[4]);
+  // UINT32 trigger
+  // {
+    //  0_26: time_tag;
+    // 27_31: 17;
+  // }
+  union
+  {
+    struct
+    {
+#if __BYTE_ORDER == __LITTLE_ENDIAN
+      uint32 time_tag : 27; // 0..26
+      uint32 unnamed_27_31 : 5; // 27..31
+#endif
+#if __BYTE_ORDER == __BIG_ENDIAN
+      uint32 unnamed_27_31 : 5; // 27..31
+      uint32 time_tag : 27; // 0..26
+#endif
+    };
+    uint32  u32;
+  } trigger;
+  // MARK_COUNT(v1190_end);
+  // UINT32 trailer
+  // {
+    //  0_04: geom = CHECK(geom);
+    //  5_19: word_count = CHECK_COUNT(v1190_start,v1190_end,4,4);
+    //    24: tdc_error;
+    //    25: buffer_overflow;
+    //    26: trigger_lost;
+    // 27_31: 16;
+  // }
+  union
+  {
+    struct
+    {
+#if __BYTE_ORDER == __LITTLE_ENDIAN
+      uint32 geom : 5; // 0..4
+      uint32 word_count : 15; // 5..19
+      uint32 dummy_20_23 : 4;
+      uint32 tdc_error : 1; // 24
+      uint32 buffer_overflow : 1; // 25
+      uint32 trigger_lost : 1; // 26
+      uint32 unnamed_27_31 : 5; // 27..31
+#endif
+#if __BYTE_ORDER == __BIG_ENDIAN
+      uint32 unnamed_27_31 : 5; // 27..31
+      uint32 trigger_lost : 1; // 26
+      uint32 buffer_overflow : 1; // 25
+      uint32 tdc_error : 1; // 24
+      uint32 dummy_20_23 : 4;
+      uint32 word_count : 15; // 5..19
+      uint32 geom : 5; // 0..4
+#endif
+    };
+    uint32  u32;
+  } trailer;
+
+public:
+#ifndef __PSDC__
+# if !PACKER_CODE
+template<typename __data_src_t>
+  void __unpack(__data_src_t &__buffer,uint32 geom);
+template<typename __data_src_t>
+  static bool __match(__data_src_t &__buffer,uint32 geom);
+  // void __clean();
+# else//PACKER_CODE
+template<typename __data_dest_t>
+  void __packer(__data_dest_t &__buffer,uint32 geom);
+# endif//PACKER_CODE
+
+  STRUCT_FCNS_DECL(VME_CAEN_V1290);
+#endif//!__PSDC__
+};
+
+/** END_STRUCTURES ****************************************************/
+/** BEGIN_STRUCTURES ***************************************************
+ *
+ * Event unpacker associated structures for VME_CAEN_V1290_SHORT_SUBTDC.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// VME_CAEN_V1290_SHORT_SUBTDC(tdc,event_id,data)
+#if !PACKER_CODE
+# define DECLARED_UNPACK_VME_CAEN_V1290_SHORT_SUBTDC
+class VME_CAEN_V1290_SHORT_SUBTDC
+#else//PACKER_CODE
+# define DECLARED_PACKER_VME_CAEN_V1290_SHORT_SUBTDC
+class PACKER_VME_CAEN_V1290_SHORT_SUBTDC
+#endif//PACKER_CODE
+
+{
+public:
+  // MEMBER(DATA24 data[32] ZERO_SUPPRESS_MULTI(128));
+  // UINT32 ch_data NOENCODE
+  // {
+    //  0_20: value;
+    // 21_23: channel_low;
+    // 24_25: tdc = CHECK(tdc);
+    //    26: trailing;
+    // 27_31: 0;
+    // ENCODE(data[((tdc << 3) | channel_low)],(value=value));
+  // }
+
+public:
+#ifndef __PSDC__
+# if !PACKER_CODE
+template<typename __data_src_t>
+  void __unpack(__data_src_t &__buffer,uint32 tdc,uint32 event_id,raw_array_multi_zero_suppress<DATA24,DATA24,32,128> &data);
+template<typename __data_src_t>
+  static bool __match(__data_src_t &__buffer,uint32 tdc,uint32 event_id);
+  // void __clean();
+# else//PACKER_CODE
+template<typename __data_dest_t>
+  void __packer(__data_dest_t &__buffer,uint32 tdc,uint32 event_id,raw_array_multi_zero_suppress<DATA24,DATA24,32,128> &data);
+# endif//PACKER_CODE
+
+  STRUCT_FCNS_DECL(VME_CAEN_V1290_SHORT_SUBTDC);
+#endif//!__PSDC__
+};
+
+/** END_STRUCTURES ****************************************************/
+/** BEGIN_STRUCTURES ***************************************************
+ *
+ * Event unpacker associated structures for VME_CAEN_V1290_SHORT_SUBTDC_ERROR.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// VME_CAEN_V1290_SHORT_SUBTDC_ERROR(tdc)
+#if !PACKER_CODE
+# define DECLARED_UNPACK_VME_CAEN_V1290_SHORT_SUBTDC_ERROR
+class VME_CAEN_V1290_SHORT_SUBTDC_ERROR
+#else//PACKER_CODE
+# define DECLARED_PACKER_VME_CAEN_V1290_SHORT_SUBTDC_ERROR
+class PACKER_VME_CAEN_V1290_SHORT_SUBTDC_ERROR
+#endif//PACKER_CODE
+
+{
+public:
+  // UINT32 error_flags
+  // {
+    //  0_14: flags;
+    // 24_25: tdc = CHECK(tdc);
+    // 27_31: 4;
+  // }
+  union
+  {
+    struct
+    {
+#if __BYTE_ORDER == __LITTLE_ENDIAN
+      uint32 flags : 15; // 0..14
+      uint32 dummy_15_23 : 9;
+      uint32 tdc : 2; // 24..25
+      uint32 dummy_26 : 1;
+      uint32 unnamed_27_31 : 5; // 27..31
+#endif
+#if __BYTE_ORDER == __BIG_ENDIAN
+      uint32 unnamed_27_31 : 5; // 27..31
+      uint32 dummy_26 : 1;
+      uint32 tdc : 2; // 24..25
+      uint32 dummy_15_23 : 9;
+      uint32 flags : 15; // 0..14
+#endif
+    };
+    uint32  u32;
+  } error_flags;
+
+public:
+#ifndef __PSDC__
+# if !PACKER_CODE
+template<typename __data_src_t>
+  void __unpack(__data_src_t &__buffer,uint32 tdc);
+template<typename __data_src_t>
+  static bool __match(__data_src_t &__buffer,uint32 tdc);
+  // void __clean();
+# else//PACKER_CODE
+template<typename __data_dest_t>
+  void __packer(__data_dest_t &__buffer,uint32 tdc);
+# endif//PACKER_CODE
+
+  STRUCT_FCNS_DECL(VME_CAEN_V1290_SHORT_SUBTDC_ERROR);
+#endif//!__PSDC__
+};
+
+/** END_STRUCTURES ****************************************************/
+/** BEGIN_STRUCTURES ***************************************************
+ *
+ * Event unpacker associated structures for VME_CAEN_V1290_SHORT.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// VME_CAEN_V1290_SHORT(geom)
+#if !PACKER_CODE
+# define DECLARED_UNPACK_VME_CAEN_V1290_SHORT
+class VME_CAEN_V1290_SHORT
+#else//PACKER_CODE
+# define DECLARED_PACKER_VME_CAEN_V1290_SHORT
+class PACKER_VME_CAEN_V1290_SHORT
+#endif//PACKER_CODE
+
+{
+public:
+  // MEMBER(DATA24 data[32] ZERO_SUPPRESS_MULTI(128));
+  raw_array_multi_zero_suppress<DATA24,DATA24,32,128> data;
+  // MARK_COUNT(v1190_start);
+  // UINT32 header
+  // {
+    //  0_04: geom = MATCH(geom);
+    //  5_26: event_number;
+    // 27_31: 8;
+  // }
+  union
+  {
+    struct
+    {
+#if __BYTE_ORDER == __LITTLE_ENDIAN
+      uint32 geom : 5; // 0..4
+      uint32 event_number : 22; // 5..26
+      uint32 unnamed_27_31 : 5; // 27..31
+#endif
+#if __BYTE_ORDER == __BIG_ENDIAN
+      uint32 unnamed_27_31 : 5; // 27..31
+      uint32 event_number : 22; // 5..26
+      uint32 geom : 5; // 0..4
+#endif
+    };
+    uint32  u32;
+  } header;
+  // select several
+
+    // tdc[0] = VME_CAEN_V1290_SHORT_SUBTDC(tdc=0,event_id=(header.event_number & 0xfff),
+                                         // data=data);
+    // tdc[1] = VME_CAEN_V1290_SHORT_SUBTDC(tdc=1,event_id=(header.event_number & 0xfff),
+                                         // data=data);
+    // tdc[2] = VME_CAEN_V1290_SHORT_SUBTDC(tdc=2,event_id=(header.event_number & 0xfff),
+                                         // data=data);
+    // tdc[3] = VME_CAEN_V1290_SHORT_SUBTDC(tdc=3,event_id=(header.event_number & 0xfff),
+                                         // data=data);
+    // norevisit err[0] = VME_CAEN_V1290_SHORT_SUBTDC_ERROR(tdc=0);
+    // norevisit err[1] = VME_CAEN_V1290_SHORT_SUBTDC_ERROR(tdc=1);
+    // norevisit err[2] = VME_CAEN_V1290_SHORT_SUBTDC_ERROR(tdc=2);
+    // norevisit err[3] = VME_CAEN_V1290_SHORT_SUBTDC_ERROR(tdc=3);
+  SINGLE(VME_CAEN_V1290_SHORT_SUBTDC,tdc[4]);
+  SINGLE(VME_CAEN_V1290_SHORT_SUBTDC_ERROR,err[4]);
+  // UINT32 trigger
+  // {
+    //  0_26: time_tag;
+    // 27_31: 17;
+  // }
+  union
+  {
+    struct
+    {
+#if __BYTE_ORDER == __LITTLE_ENDIAN
+      uint32 time_tag : 27; // 0..26
+      uint32 unnamed_27_31 : 5; // 27..31
+#endif
+#if __BYTE_ORDER == __BIG_ENDIAN
+      uint32 unnamed_27_31 : 5; // 27..31
+      uint32 time_tag : 27; // 0..26
+#endif
+    };
+    uint32  u32;
+  } trigger;
+  // MARK_COUNT(v1190_end);
+  // UINT32 trailer
+  // {
+    //  0_04: geom = CHECK(geom);
+    //  5_19: word_count = CHECK_COUNT(v1190_start,v1190_end,4,4);
+    //    24: tdc_error;
+    //    25: buffer_overflow;
+    //    26: trigger_lost;
+    // 27_31: 16;
+  // }
+  union
+  {
+    struct
+    {
+#if __BYTE_ORDER == __LITTLE_ENDIAN
+      uint32 geom : 5; // 0..4
+      uint32 word_count : 15; // 5..19
+      uint32 dummy_20_23 : 4;
+      uint32 tdc_error : 1; // 24
+      uint32 buffer_overflow : 1; // 25
+      uint32 trigger_lost : 1; // 26
+      uint32 unnamed_27_31 : 5; // 27..31
+#endif
+#if __BYTE_ORDER == __BIG_ENDIAN
+      uint32 unnamed_27_31 : 5; // 27..31
+      uint32 trigger_lost : 1; // 26
+      uint32 buffer_overflow : 1; // 25
+      uint32 tdc_error : 1; // 24
+      uint32 dummy_20_23 : 4;
+      uint32 word_count : 15; // 5..19
+      uint32 geom : 5; // 0..4
+#endif
+    };
+    uint32  u32;
+  } trailer;
+
+public:
+#ifndef __PSDC__
+# if !PACKER_CODE
+template<typename __data_src_t>
+  void __unpack(__data_src_t &__buffer,uint32 geom);
+template<typename __data_src_t>
+  static bool __match(__data_src_t &__buffer,uint32 geom);
+  // void __clean();
+# else//PACKER_CODE
+template<typename __data_dest_t>
+  void __packer(__data_dest_t &__buffer,uint32 geom);
+# endif//PACKER_CODE
+
+  STRUCT_FCNS_DECL(VME_CAEN_V1290_SHORT);
+#endif//!__PSDC__
+};
+
+/** END_STRUCTURES ****************************************************/
+/** BEGIN_STRUCTURES ***************************************************
+ *
+ * Event unpacker associated structures for VME_CAEN_V775.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// VME_CAEN_V775(geom,crate)
+#if !PACKER_CODE
+# define DECLARED_UNPACK_VME_CAEN_V775
+class VME_CAEN_V775
+#else//PACKER_CODE
+# define DECLARED_PACKER_VME_CAEN_V775
+class PACKER_VME_CAEN_V775
+#endif//PACKER_CODE
+
+{
+public:
+  // MEMBER(DATA12_OVERFLOW data[32] ZERO_SUPPRESS);
+  raw_array_zero_suppress<DATA12_OVERFLOW,DATA12_OVERFLOW,32> data;
+  // UINT32 header NOENCODE
+  // {
+    //  8_13: count;
+    // 16_23: crate = MATCH(crate);
+    // 24_26: 2;
+    // 27_31: geom = MATCH(geom);
+  // }
+  // list(0<=index<header.count)
+
+    // UINT32 ch_data NOENCODE
+    // {
+      //  0_11: value;
+      //    12: overflow;
+      //    13: underflow;
+      //    14: valid;
+      // 16_20: channel;
+      // 24_26: 0;
+      // 27_31: geom = CHECK(geom);
+      // ENCODE(data[channel],(value=value,overflow=overflow));
+    // }
+  // UINT32 eob
+  // {
+    //  0_23: event_number;
+    // 24_26: 4;
+    // 27_31: geom = CHECK(geom);
+  // }
+  union
+  {
+    struct
+    {
+#if __BYTE_ORDER == __LITTLE_ENDIAN
+      uint32 event_number : 24; // 0..23
+      uint32 unnamed_24_26 : 3; // 24..26
+      uint32 geom : 5; // 27..31
+#endif
+#if __BYTE_ORDER == __BIG_ENDIAN
+      uint32 geom : 5; // 27..31
+      uint32 unnamed_24_26 : 3; // 24..26
+      uint32 event_number : 24; // 0..23
+#endif
+    };
+    uint32  u32;
+  } eob;
+
+public:
+#ifndef __PSDC__
+# if !PACKER_CODE
+template<typename __data_src_t>
+  void __unpack(__data_src_t &__buffer,uint32 geom,uint32 crate);
+template<typename __data_src_t>
+  static bool __match(__data_src_t &__buffer,uint32 geom,uint32 crate);
+  // void __clean();
+# else//PACKER_CODE
+template<typename __data_dest_t>
+  void __packer(__data_dest_t &__buffer,uint32 geom,uint32 crate);
+# endif//PACKER_CODE
+
+  STRUCT_FCNS_DECL(VME_CAEN_V775);
+#endif//!__PSDC__
+};
+
+/** END_STRUCTURES ****************************************************/
+/** BEGIN_STRUCTURES ***************************************************
+ *
+ * Event unpacker associated structures for VME_CAEN_V830.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// VME_CAEN_V830(geom)
+#if !PACKER_CODE
+# define DECLARED_UNPACK_VME_CAEN_V830
+class VME_CAEN_V830
+#else//PACKER_CODE
+# define DECLARED_PACKER_VME_CAEN_V830
+class PACKER_VME_CAEN_V830
+#endif//PACKER_CODE
+
+{
+public:
+  // MEMBER(DATA32 data[32] ZERO_SUPPRESS);
+  raw_array_zero_suppress<DATA32,DATA32,32> data;
+  // UINT32 header
+  // {
+    //  0_15: event_number;
+    // 16_17: ts;
+    // 18_23: count;
+    //    26: 1;
+    // 27_31: geom = MATCH(geom);
+  // }
+  union
+  {
+    struct
+    {
+#if __BYTE_ORDER == __LITTLE_ENDIAN
+      uint32 event_number : 16; // 0..15
+      uint32 ts : 2; // 16..17
+      uint32 count : 6; // 18..23
+      uint32 dummy_24_25 : 2;
+      uint32 unnamed_26_26 : 1; // 26
+      uint32 geom : 5; // 27..31
+#endif
+#if __BYTE_ORDER == __BIG_ENDIAN
+      uint32 geom : 5; // 27..31
+      uint32 unnamed_26_26 : 1; // 26
+      uint32 dummy_24_25 : 2;
+      uint32 count : 6; // 18..23
+      uint32 ts : 2; // 16..17
+      uint32 event_number : 16; // 0..15
+#endif
+    };
+    uint32  u32;
+  } header;
+  // list(0<=index<header.count)
+
+    // UINT32 ch_data NOENCODE
+    // {
+      //  0_25: value;
+      //    26: 0;
+      // 27_31: channel;
+      // ENCODE(data[channel],(value=value));
+    // }
+
+public:
+#ifndef __PSDC__
+# if !PACKER_CODE
+template<typename __data_src_t>
+  void __unpack(__data_src_t &__buffer,uint32 geom);
+template<typename __data_src_t>
+  static bool __match(__data_src_t &__buffer,uint32 geom);
+  // void __clean();
+# else//PACKER_CODE
+template<typename __data_dest_t>
+  void __packer(__data_dest_t &__buffer,uint32 geom);
+# endif//PACKER_CODE
+
+  STRUCT_FCNS_DECL(VME_CAEN_V830);
+#endif//!__PSDC__
+};
+
+/** END_STRUCTURES ****************************************************/
+/** BEGIN_STRUCTURES ***************************************************
+ *
+ * Event unpacker associated structures for VME_MESYTEC_MADC32.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// VME_MESYTEC_MADC32(geom)
+#if !PACKER_CODE
+# define DECLARED_UNPACK_VME_MESYTEC_MADC32
+class VME_MESYTEC_MADC32
+#else//PACKER_CODE
+# define DECLARED_PACKER_VME_MESYTEC_MADC32
+class PACKER_VME_MESYTEC_MADC32
+#endif//PACKER_CODE
+
+{
+public:
+  // MEMBER(DATA14_OVERFLOW data[32] ZERO_SUPPRESS);
+  raw_array_zero_suppress<DATA14_OVERFLOW,DATA14_OVERFLOW,32> data;
+  // MARK_COUNT(start);
+  // UINT32 header NOENCODE
+  // {
+    //  0_11: word_number;
+    // 12_14: adc_resol;
+    //    15: out_form;
+    // 16_23: geom = MATCH(geom);
+    // 24_29: 0;
+    // 30_31: 1;
+  // }
+  // several UINT32 ch_data NOENCODE
+  // {
+    //  0_12: value;
+    //    14: outofrange;
+    // 16_20: channel;
+    // 21_29: 32;
+    // 30_31: 0;
+    // ENCODE(data[channel],(value=value,overflow=outofrange));
+  // }
+  // optional UINT32 filler NOENCODE
+  // {
+    //  0_31: 0;
+  // }
+  // UINT32 end_of_event
+  // {
+    //  0_29: counter;
+    // 30_31: 3;
+  // }
+  union
+  {
+    struct
+    {
+#if __BYTE_ORDER == __LITTLE_ENDIAN
+      uint32 counter : 30; // 0..29
+      uint32 unnamed_30_31 : 2; // 30..31
+#endif
+#if __BYTE_ORDER == __BIG_ENDIAN
+      uint32 unnamed_30_31 : 2; // 30..31
+      uint32 counter : 30; // 0..29
+#endif
+    };
+    uint32  u32;
+  } end_of_event;
+  // MARK_COUNT(end);
+  // CHECK_COUNT(header.word_number,start,end,( - 4),4)
+
+public:
+#ifndef __PSDC__
+# if !PACKER_CODE
+template<typename __data_src_t>
+  void __unpack(__data_src_t &__buffer,uint32 geom);
+template<typename __data_src_t>
+  static bool __match(__data_src_t &__buffer,uint32 geom);
+  // void __clean();
+# else//PACKER_CODE
+template<typename __data_dest_t>
+  void __packer(__data_dest_t &__buffer,uint32 geom);
+# endif//PACKER_CODE
+
+  STRUCT_FCNS_DECL(VME_MESYTEC_MADC32);
+#endif//!__PSDC__
+};
+
+/** END_STRUCTURES ****************************************************/
+/** BEGIN_STRUCTURES ***************************************************
+ *
+ * Event unpacker associated structures for VME_MESYTEC_MDPP16.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// VME_MESYTEC_MDPP16(geom)
+#if !PACKER_CODE
+# define DECLARED_UNPACK_VME_MESYTEC_MDPP16
+class VME_MESYTEC_MDPP16
+#else//PACKER_CODE
+# define DECLARED_PACKER_VME_MESYTEC_MDPP16
+class PACKER_VME_MESYTEC_MDPP16
+#endif//PACKER_CODE
+
+{
+public:
+  // MEMBER(DATA16_OVERFLOW adc[16] ZERO_SUPPRESS_MULTI(20));
+  raw_array_multi_zero_suppress<DATA16_OVERFLOW,DATA16_OVERFLOW,16,20> adc;
+  // MEMBER(DATA16_OVERFLOW tdc[16] ZERO_SUPPRESS_MULTI(20));
+  raw_array_multi_zero_suppress<DATA16_OVERFLOW,DATA16_OVERFLOW,16,20> tdc;
+  // MEMBER(DATA16_OVERFLOW trig_tdc[16] ZERO_SUPPRESS_MULTI(20));
+  raw_array_multi_zero_suppress<DATA16_OVERFLOW,DATA16_OVERFLOW,16,20> trig_tdc;
+  // MEMBER(DATA16_OVERFLOW adc_short[16] ZERO_SUPPRESS_MULTI(20));
+  raw_array_multi_zero_suppress<DATA16_OVERFLOW,DATA16_OVERFLOW,16,20> adc_short;
+  // MARK_COUNT(start);
+  // UINT32 header NOENCODE
+  // {
+    //  0_09: word_number;
+    // 10_12: adc_res;
+    // 13_15: tdc_res;
+    // 16_23: geom = MATCH(geom);
+    // 24_29: 0;
+    // 30_31: 1;
+  // }
+  // several UINT32 ch_data NOENCODE
+  // {
+    //  0_15: value;
+    // 16_19: channel;
+    // 20_21: ch_kind;
+    //    22: overflow;
+    //    23: pileup;
+    // 24_27: 0;
+    // 28_31: 1;
+    // if((ch_kind == 0))
+    // {
+      // ENCODE(adc[channel],(value=value,overflow=overflow,pileup=pileup));
+    // }
+    // if((ch_kind == 1))
+    // {
+      // ENCODE(tdc[channel],(value=value,overflow=overflow,pileup=pileup));
+    // }
+    // if((ch_kind == 2))
+    // {
+      // ENCODE(trig_tdc[channel],(value=value,overflow=overflow,pileup=pileup));
+    // }
+    // if((ch_kind == 3))
+    // {
+      // ENCODE(adc_short[channel],(value=value,overflow=overflow,pileup=pileup));
+    // }
+  // }
+  // several UINT32 fill_word NOENCODE
+  // {
+    //  0_31: 0;
+  // }
+  // UINT32 end_of_event
+  // {
+    //  0_29: counter;
+    // 30_31: 3;
+  // }
+  union
+  {
+    struct
+    {
+#if __BYTE_ORDER == __LITTLE_ENDIAN
+      uint32 counter : 30; // 0..29
+      uint32 unnamed_30_31 : 2; // 30..31
+#endif
+#if __BYTE_ORDER == __BIG_ENDIAN
+      uint32 unnamed_30_31 : 2; // 30..31
+      uint32 counter : 30; // 0..29
+#endif
+    };
+    uint32  u32;
+  } end_of_event;
+  // MARK_COUNT(end);
+  // CHECK_COUNT(header.word_number,start,end,( - 4),4)
+
+public:
+#ifndef __PSDC__
+# if !PACKER_CODE
+template<typename __data_src_t>
+  void __unpack(__data_src_t &__buffer,uint32 geom);
+template<typename __data_src_t>
+  static bool __match(__data_src_t &__buffer,uint32 geom);
+  // void __clean();
+# else//PACKER_CODE
+template<typename __data_dest_t>
+  void __packer(__data_dest_t &__buffer,uint32 geom);
+# endif//PACKER_CODE
+
+  STRUCT_FCNS_DECL(VME_MESYTEC_MDPP16);
+#endif//!__PSDC__
+};
+
+/** END_STRUCTURES ****************************************************/
+/** BEGIN_STRUCTURES ***************************************************
+ *
+ * Event unpacker associated structures for WR_STAMP.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// WR_STAMP(id)
+#if !PACKER_CODE
+# define DECLARED_UNPACK_WR_STAMP
+class WR_STAMP
+#else//PACKER_CODE
+# define DECLARED_PACKER_WR_STAMP
+class PACKER_WR_STAMP
+#endif//PACKER_CODE
+
+{
+public:
+  // MEMBER(DATA16 srcid);
+  DATA16 srcid;
+  // MEMBER(DATA16 err);
+  DATA16 err;
+  // MEMBER(DATA16 t1);
+  DATA16 t1;
+  // MEMBER(DATA16 t2);
+  DATA16 t2;
+  // MEMBER(DATA16 t3);
+  DATA16 t3;
+  // MEMBER(DATA16 t4);
+  DATA16 t4;
+  // UINT32 header NOENCODE
+  // {
+    //  8_11: id = MATCH(id);
+    //    16: error;
+    // ENCODE(srcid,(value=id));
+    // ENCODE(err,(value=error));
+  // }
+  // UINT32 data0 NOENCODE
+  // {
+    //  0_15: t1;
+    // 16_31: 0x3e1;
+    // ENCODE(t1,(value=t1));
+  // }
+  // UINT32 data1 NOENCODE
+  // {
+    //  0_15: t2;
+    // 16_31: 0x4e1;
+    // ENCODE(t2,(value=t2));
+  // }
+  // UINT32 data2 NOENCODE
+  // {
+    //  0_15: t3;
+    // 16_31: 0x5e1;
+    // ENCODE(t3,(value=t3));
+  // }
+  // UINT32 data3 NOENCODE
+  // {
+    //  0_15: t4;
+    // 16_31: 0x6e1;
+    // ENCODE(t4,(value=t4));
+  // }
+
+public:
+#ifndef __PSDC__
+# if !PACKER_CODE
+template<typename __data_src_t>
+  void __unpack(__data_src_t &__buffer,uint32 id);
+template<typename __data_src_t>
+  static bool __match(__data_src_t &__buffer,uint32 id);
+  // void __clean();
+# else//PACKER_CODE
+template<typename __data_dest_t>
+  void __packer(__data_dest_t &__buffer,uint32 id);
+# endif//PACKER_CODE
+
+  STRUCT_FCNS_DECL(WR_STAMP);
+#endif//!__PSDC__
+};
+
+/** END_STRUCTURES ****************************************************/
+/** BEGIN_STRUCTURES ***************************************************
+ *
+ * Event unpacker associated structures for XTST_STD_VME.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// XTST_STD_VME()
+#if !PACKER_CODE
+# define DECLARED_UNPACK_XTST_STD_VME
+class XTST_STD_VME
+#else//PACKER_CODE
+# define DECLARED_PACKER_XTST_STD_VME
+class PACKER_XTST_STD_VME
+#endif//PACKER_CODE
+
+{
+public:
+  // UINT32 failure
+  // {
+    //     0: fail_general;
+    //     1: fail_data_corrupt;
+    //     2: fail_data_missing;
+    //     3: fail_data_too_much;
+    //     4: fail_event_counter_mismatch;
+    //     5: fail_readout_error_driver;
+    //     6: fail_unexpected_trigger;
+    //    27: has_no_zero_suppression;
+    //    28: has_multi_adctdc_counter0;
+    //    29: has_multi_scaler_counter0;
+    //    30: has_multi_event;
+    //    31: has_time_stamp;
+  // }
+  union
+  {
+    struct
+    {
+#if __BYTE_ORDER == __LITTLE_ENDIAN
+      uint32 fail_general : 1; // 0
+      uint32 fail_data_corrupt : 1; // 1
+      uint32 fail_data_missing : 1; // 2
+      uint32 fail_data_too_much : 1; // 3
+      uint32 fail_event_counter_mismatch : 1; // 4
+      uint32 fail_readout_error_driver : 1; // 5
+      uint32 fail_unexpected_trigger : 1; // 6
+      uint32 dummy_7_26 : 20;
+      uint32 has_no_zero_suppression : 1; // 27
+      uint32 has_multi_adctdc_counter0 : 1; // 28
+      uint32 has_multi_scaler_counter0 : 1; // 29
+      uint32 has_multi_event : 1; // 30
+      uint32 has_time_stamp : 1; // 31
+#endif
+#if __BYTE_ORDER == __BIG_ENDIAN
+      uint32 has_time_stamp : 1; // 31
+      uint32 has_multi_event : 1; // 30
+      uint32 has_multi_scaler_counter0 : 1; // 29
+      uint32 has_multi_adctdc_counter0 : 1; // 28
+      uint32 has_no_zero_suppression : 1; // 27
+      uint32 dummy_7_26 : 20;
+      uint32 fail_unexpected_trigger : 1; // 6
+      uint32 fail_readout_error_driver : 1; // 5
+      uint32 fail_event_counter_mismatch : 1; // 4
+      uint32 fail_data_too_much : 1; // 3
+      uint32 fail_data_missing : 1; // 2
+      uint32 fail_data_corrupt : 1; // 1
+      uint32 fail_general : 1; // 0
+#endif
+    };
+    uint32  u32;
+  } failure;
+  // if(failure.has_time_stamp)
+
+    // UINT32 time_stamp;
+    uint32  time_stamp;
+  // if(failure.has_multi_event)
+
+    // UINT32 multi_events;
+    uint32  multi_events;
+  // if(failure.has_multi_scaler_counter0)
+
+    // UINT32 multi_scaler_counter0;
+    uint32  multi_scaler_counter0;
+  // if(failure.has_multi_adctdc_counter0)
+
+    // UINT32 multi_adctdc_counter0;
+    uint32  multi_adctdc_counter0;
+
+public:
+#ifndef __PSDC__
+# if !PACKER_CODE
+template<typename __data_src_t>
+  void __unpack(__data_src_t &__buffer);
+template<typename __data_src_t>
+  static bool __match(__data_src_t &__buffer);
+  // void __clean();
+# else//PACKER_CODE
+template<typename __data_dest_t>
+  void __packer(__data_dest_t &__buffer);
+# endif//PACKER_CODE
+
+  STRUCT_FCNS_DECL(XTST_STD_VME);
+#endif//!__PSDC__
+};
+
+/** END_STRUCTURES ****************************************************/
+/** BEGIN_STRUCTURES ***************************************************
+ *
+ * Event unpacker associated structures for XTST_SUBEVENT_MEMBER_DATA12.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// XTST_SUBEVENT_MEMBER_DATA12()
+#if !PACKER_CODE
+# define DECLARED_UNPACK_XTST_SUBEVENT_MEMBER_DATA12
+class XTST_SUBEVENT_MEMBER_DATA12
+#else//PACKER_CODE
+# define DECLARED_PACKER_XTST_SUBEVENT_MEMBER_DATA12
+class PACKER_XTST_SUBEVENT_MEMBER_DATA12
+#endif//PACKER_CODE
+
+{
+public:
+  // MEMBER(DATA12 mDATA12);
+  DATA12 mDATA12;
+  // MEMBER(DATA12 mDATA12_array[8]);
+  raw_array<DATA12,DATA12,8> mDATA12_array;
+  // MEMBER(DATA12 mDATA12_array_zzp[8] ZERO_SUPPRESS);
+  raw_array_zero_suppress<DATA12,DATA12,8> mDATA12_array_zzp;
+  // MEMBER(DATA12 mDATA12_array_zzpii[8] ZERO_SUPPRESS_LIST);
+  raw_list_zero_suppress<DATA12,DATA12,8> mDATA12_array_zzpii;
+  // MEMBER(DATA12 mDATA12_array_zzpml[8] ZERO_SUPPRESS_MULTI(4));
+  raw_array_multi_zero_suppress<DATA12,DATA12,8,4> mDATA12_array_zzpml;
+  // MEMBER(DATA12 mDATA12_array2[2][8]);
+  raw_array<DATA12,DATA12,8> mDATA12_array2[2];
+  // MEMBER(DATA12 mDATA12_array2_zzp[2][8] ZERO_SUPPRESS);
+  raw_array_zero_suppress<DATA12,DATA12,8> mDATA12_array2_zzp[2];
+  // MEMBER(DATA12 mDATA12_array2_zzpii[2][8] ZERO_SUPPRESS_LIST);
+  raw_list_zero_suppress<DATA12,DATA12,8> mDATA12_array2_zzpii[2];
+  // MEMBER(DATA12 mDATA12_array2_zzpml[2][8] ZERO_SUPPRESS_MULTI(4));
+  raw_array_multi_zero_suppress<DATA12,DATA12,8,4> mDATA12_array2_zzpml[2];
+
+public:
+#ifndef __PSDC__
+# if !PACKER_CODE
+template<typename __data_src_t>
+  void __unpack(__data_src_t &__buffer);
+template<typename __data_src_t>
+  static bool __match(__data_src_t &__buffer);
+  // void __clean();
+# else//PACKER_CODE
+template<typename __data_dest_t>
+  void __packer(__data_dest_t &__buffer);
+# endif//PACKER_CODE
+
+  STRUCT_FCNS_DECL(XTST_SUBEVENT_MEMBER_DATA12);
+#endif//!__PSDC__
+};
+
+/** END_STRUCTURES ****************************************************/
+/** BEGIN_STRUCTURES ***************************************************
+ *
+ * Event unpacker associated structures for XTST_SUBEVENT_MEMBER_DATA12_OVERFLOW.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// XTST_SUBEVENT_MEMBER_DATA12_OVERFLOW()
+#if !PACKER_CODE
+# define DECLARED_UNPACK_XTST_SUBEVENT_MEMBER_DATA12_OVERFLOW
+class XTST_SUBEVENT_MEMBER_DATA12_OVERFLOW
+#else//PACKER_CODE
+# define DECLARED_PACKER_XTST_SUBEVENT_MEMBER_DATA12_OVERFLOW
+class PACKER_XTST_SUBEVENT_MEMBER_DATA12_OVERFLOW
+#endif//PACKER_CODE
+
+{
+public:
+  // MEMBER(DATA12_OVERFLOW mDATA12_OVERFLOW);
+  DATA12_OVERFLOW mDATA12_OVERFLOW;
+  // MEMBER(DATA12_OVERFLOW mDATA12_OVERFLOW_array[8]);
+  raw_array<DATA12_OVERFLOW,DATA12_OVERFLOW,8> mDATA12_OVERFLOW_array;
+  // MEMBER(DATA12_OVERFLOW mDATA12_OVERFLOW_array_zzp[8] ZERO_SUPPRESS);
+  raw_array_zero_suppress<DATA12_OVERFLOW,DATA12_OVERFLOW,8> mDATA12_OVERFLOW_array_zzp;
+  // MEMBER(DATA12_OVERFLOW mDATA12_OVERFLOW_array_zzpii[8] ZERO_SUPPRESS_LIST);
+  raw_list_zero_suppress<DATA12_OVERFLOW,DATA12_OVERFLOW,8> mDATA12_OVERFLOW_array_zzpii;
+  // MEMBER(DATA12_OVERFLOW mDATA12_OVERFLOW_array_zzpml[8] ZERO_SUPPRESS_MULTI(4));
+  raw_array_multi_zero_suppress<DATA12_OVERFLOW,DATA12_OVERFLOW,8,4> mDATA12_OVERFLOW_array_zzpml;
+  // MEMBER(DATA12_OVERFLOW mDATA12_OVERFLOW_array2[2][8]);
+  raw_array<DATA12_OVERFLOW,DATA12_OVERFLOW,8> mDATA12_OVERFLOW_array2[2];
+  // MEMBER(DATA12_OVERFLOW mDATA12_OVERFLOW_array2_zzp[2][8] ZERO_SUPPRESS);
+  raw_array_zero_suppress<DATA12_OVERFLOW,DATA12_OVERFLOW,8> mDATA12_OVERFLOW_array2_zzp[2];
+  // MEMBER(DATA12_OVERFLOW mDATA12_OVERFLOW_array2_zzpii[2][8] ZERO_SUPPRESS_LIST);
+  raw_list_zero_suppress<DATA12_OVERFLOW,DATA12_OVERFLOW,8> mDATA12_OVERFLOW_array2_zzpii[2];
+  // MEMBER(DATA12_OVERFLOW mDATA12_OVERFLOW_array2_zzpml[2][8] ZERO_SUPPRESS_MULTI(4));
+  raw_array_multi_zero_suppress<DATA12_OVERFLOW,DATA12_OVERFLOW,8,4> mDATA12_OVERFLOW_array2_zzpml[2];
+
+public:
+#ifndef __PSDC__
+# if !PACKER_CODE
+template<typename __data_src_t>
+  void __unpack(__data_src_t &__buffer);
+template<typename __data_src_t>
+  static bool __match(__data_src_t &__buffer);
+  // void __clean();
+# else//PACKER_CODE
+template<typename __data_dest_t>
+  void __packer(__data_dest_t &__buffer);
+# endif//PACKER_CODE
+
+  STRUCT_FCNS_DECL(XTST_SUBEVENT_MEMBER_DATA12_OVERFLOW);
+#endif//!__PSDC__
+};
+
+/** END_STRUCTURES ****************************************************/
+/** BEGIN_STRUCTURES ***************************************************
+ *
+ * Event unpacker associated structures for XTST_SUBEVENT_MEMBER_DATA12_RANGE.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// XTST_SUBEVENT_MEMBER_DATA12_RANGE()
+#if !PACKER_CODE
+# define DECLARED_UNPACK_XTST_SUBEVENT_MEMBER_DATA12_RANGE
+class XTST_SUBEVENT_MEMBER_DATA12_RANGE
+#else//PACKER_CODE
+# define DECLARED_PACKER_XTST_SUBEVENT_MEMBER_DATA12_RANGE
+class PACKER_XTST_SUBEVENT_MEMBER_DATA12_RANGE
+#endif//PACKER_CODE
+
+{
+public:
+  // MEMBER(DATA12_RANGE mDATA12_RANGE);
+  DATA12_RANGE mDATA12_RANGE;
+  // MEMBER(DATA12_RANGE mDATA12_RANGE_array[8]);
+  raw_array<DATA12_RANGE,DATA12_RANGE,8> mDATA12_RANGE_array;
+  // MEMBER(DATA12_RANGE mDATA12_RANGE_array_zzp[8] ZERO_SUPPRESS);
+  raw_array_zero_suppress<DATA12_RANGE,DATA12_RANGE,8> mDATA12_RANGE_array_zzp;
+  // MEMBER(DATA12_RANGE mDATA12_RANGE_array_zzpii[8] ZERO_SUPPRESS_LIST);
+  raw_list_zero_suppress<DATA12_RANGE,DATA12_RANGE,8> mDATA12_RANGE_array_zzpii;
+  // MEMBER(DATA12_RANGE mDATA12_RANGE_array_zzpml[8] ZERO_SUPPRESS_MULTI(4));
+  raw_array_multi_zero_suppress<DATA12_RANGE,DATA12_RANGE,8,4> mDATA12_RANGE_array_zzpml;
+  // MEMBER(DATA12_RANGE mDATA12_RANGE_array2[2][8]);
+  raw_array<DATA12_RANGE,DATA12_RANGE,8> mDATA12_RANGE_array2[2];
+  // MEMBER(DATA12_RANGE mDATA12_RANGE_array2_zzp[2][8] ZERO_SUPPRESS);
+  raw_array_zero_suppress<DATA12_RANGE,DATA12_RANGE,8> mDATA12_RANGE_array2_zzp[2];
+  // MEMBER(DATA12_RANGE mDATA12_RANGE_array2_zzpii[2][8] ZERO_SUPPRESS_LIST);
+  raw_list_zero_suppress<DATA12_RANGE,DATA12_RANGE,8> mDATA12_RANGE_array2_zzpii[2];
+  // MEMBER(DATA12_RANGE mDATA12_RANGE_array2_zzpml[2][8] ZERO_SUPPRESS_MULTI(4));
+  raw_array_multi_zero_suppress<DATA12_RANGE,DATA12_RANGE,8,4> mDATA12_RANGE_array2_zzpml[2];
+
+public:
+#ifndef __PSDC__
+# if !PACKER_CODE
+template<typename __data_src_t>
+  void __unpack(__data_src_t &__buffer);
+template<typename __data_src_t>
+  static bool __match(__data_src_t &__buffer);
+  // void __clean();
+# else//PACKER_CODE
+template<typename __data_dest_t>
+  void __packer(__data_dest_t &__buffer);
+# endif//PACKER_CODE
+
+  STRUCT_FCNS_DECL(XTST_SUBEVENT_MEMBER_DATA12_RANGE);
+#endif//!__PSDC__
+};
+
+/** END_STRUCTURES ****************************************************/
+/** BEGIN_STRUCTURES ***************************************************
+ *
+ * Event unpacker associated structures for XTST_SUBEVENT_MEMBER_DATA16.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// XTST_SUBEVENT_MEMBER_DATA16()
+#if !PACKER_CODE
+# define DECLARED_UNPACK_XTST_SUBEVENT_MEMBER_DATA16
+class XTST_SUBEVENT_MEMBER_DATA16
+#else//PACKER_CODE
+# define DECLARED_PACKER_XTST_SUBEVENT_MEMBER_DATA16
+class PACKER_XTST_SUBEVENT_MEMBER_DATA16
+#endif//PACKER_CODE
+
+{
+public:
+  // MEMBER(DATA16 mDATA16);
+  DATA16 mDATA16;
+  // MEMBER(DATA16 mDATA16_array[8]);
+  raw_array<DATA16,DATA16,8> mDATA16_array;
+  // MEMBER(DATA16 mDATA16_array_zzp[8] ZERO_SUPPRESS);
+  raw_array_zero_suppress<DATA16,DATA16,8> mDATA16_array_zzp;
+  // MEMBER(DATA16 mDATA16_array_zzpii[8] ZERO_SUPPRESS_LIST);
+  raw_list_zero_suppress<DATA16,DATA16,8> mDATA16_array_zzpii;
+  // MEMBER(DATA16 mDATA16_array_zzpml[8] ZERO_SUPPRESS_MULTI(4));
+  raw_array_multi_zero_suppress<DATA16,DATA16,8,4> mDATA16_array_zzpml;
+  // MEMBER(DATA16 mDATA16_array2[2][8]);
+  raw_array<DATA16,DATA16,8> mDATA16_array2[2];
+  // MEMBER(DATA16 mDATA16_array2_zzp[2][8] ZERO_SUPPRESS);
+  raw_array_zero_suppress<DATA16,DATA16,8> mDATA16_array2_zzp[2];
+  // MEMBER(DATA16 mDATA16_array2_zzpii[2][8] ZERO_SUPPRESS_LIST);
+  raw_list_zero_suppress<DATA16,DATA16,8> mDATA16_array2_zzpii[2];
+  // MEMBER(DATA16 mDATA16_array2_zzpml[2][8] ZERO_SUPPRESS_MULTI(4));
+  raw_array_multi_zero_suppress<DATA16,DATA16,8,4> mDATA16_array2_zzpml[2];
+
+public:
+#ifndef __PSDC__
+# if !PACKER_CODE
+template<typename __data_src_t>
+  void __unpack(__data_src_t &__buffer);
+template<typename __data_src_t>
+  static bool __match(__data_src_t &__buffer);
+  // void __clean();
+# else//PACKER_CODE
+template<typename __data_dest_t>
+  void __packer(__data_dest_t &__buffer);
+# endif//PACKER_CODE
+
+  STRUCT_FCNS_DECL(XTST_SUBEVENT_MEMBER_DATA16);
+#endif//!__PSDC__
+};
+
+/** END_STRUCTURES ****************************************************/
+/** BEGIN_STRUCTURES ***************************************************
+ *
+ * Event unpacker associated structures for XTST_SUBEVENT_MEMBER_DATA16_OVERFLOW.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// XTST_SUBEVENT_MEMBER_DATA16_OVERFLOW()
+#if !PACKER_CODE
+# define DECLARED_UNPACK_XTST_SUBEVENT_MEMBER_DATA16_OVERFLOW
+class XTST_SUBEVENT_MEMBER_DATA16_OVERFLOW
+#else//PACKER_CODE
+# define DECLARED_PACKER_XTST_SUBEVENT_MEMBER_DATA16_OVERFLOW
+class PACKER_XTST_SUBEVENT_MEMBER_DATA16_OVERFLOW
+#endif//PACKER_CODE
+
+{
+public:
+  // MEMBER(DATA16_OVERFLOW mDATA16_OVERFLOW);
+  DATA16_OVERFLOW mDATA16_OVERFLOW;
+  // MEMBER(DATA16_OVERFLOW mDATA16_OVERFLOW_array[8]);
+  raw_array<DATA16_OVERFLOW,DATA16_OVERFLOW,8> mDATA16_OVERFLOW_array;
+  // MEMBER(DATA16_OVERFLOW mDATA16_OVERFLOW_array_zzp[8] ZERO_SUPPRESS);
+  raw_array_zero_suppress<DATA16_OVERFLOW,DATA16_OVERFLOW,8> mDATA16_OVERFLOW_array_zzp;
+  // MEMBER(DATA16_OVERFLOW mDATA16_OVERFLOW_array_zzpii[8] ZERO_SUPPRESS_LIST);
+  raw_list_zero_suppress<DATA16_OVERFLOW,DATA16_OVERFLOW,8> mDATA16_OVERFLOW_array_zzpii;
+  // MEMBER(DATA16_OVERFLOW mDATA16_OVERFLOW_array_zzpml[8] ZERO_SUPPRESS_MULTI(4));
+  raw_array_multi_zero_suppress<DATA16_OVERFLOW,DATA16_OVERFLOW,8,4> mDATA16_OVERFLOW_array_zzpml;
+  // MEMBER(DATA16_OVERFLOW mDATA16_OVERFLOW_array2[2][8]);
+  raw_array<DATA16_OVERFLOW,DATA16_OVERFLOW,8> mDATA16_OVERFLOW_array2[2];
+  // MEMBER(DATA16_OVERFLOW mDATA16_OVERFLOW_array2_zzp[2][8] ZERO_SUPPRESS);
+  raw_array_zero_suppress<DATA16_OVERFLOW,DATA16_OVERFLOW,8> mDATA16_OVERFLOW_array2_zzp[2];
+  // MEMBER(DATA16_OVERFLOW mDATA16_OVERFLOW_array2_zzpii[2][8] ZERO_SUPPRESS_LIST);
+  raw_list_zero_suppress<DATA16_OVERFLOW,DATA16_OVERFLOW,8> mDATA16_OVERFLOW_array2_zzpii[2];
+  // MEMBER(DATA16_OVERFLOW mDATA16_OVERFLOW_array2_zzpml[2][8] ZERO_SUPPRESS_MULTI(4));
+  raw_array_multi_zero_suppress<DATA16_OVERFLOW,DATA16_OVERFLOW,8,4> mDATA16_OVERFLOW_array2_zzpml[2];
+
+public:
+#ifndef __PSDC__
+# if !PACKER_CODE
+template<typename __data_src_t>
+  void __unpack(__data_src_t &__buffer);
+template<typename __data_src_t>
+  static bool __match(__data_src_t &__buffer);
+  // void __clean();
+# else//PACKER_CODE
+template<typename __data_dest_t>
+  void __packer(__data_dest_t &__buffer);
+# endif//PACKER_CODE
+
+  STRUCT_FCNS_DECL(XTST_SUBEVENT_MEMBER_DATA16_OVERFLOW);
+#endif//!__PSDC__
+};
+
+/** END_STRUCTURES ****************************************************/
+/** BEGIN_STRUCTURES ***************************************************
+ *
+ * Event unpacker associated structures for XTST_SUBEVENT_MEMBER_DATA24.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// XTST_SUBEVENT_MEMBER_DATA24()
+#if !PACKER_CODE
+# define DECLARED_UNPACK_XTST_SUBEVENT_MEMBER_DATA24
+class XTST_SUBEVENT_MEMBER_DATA24
+#else//PACKER_CODE
+# define DECLARED_PACKER_XTST_SUBEVENT_MEMBER_DATA24
+class PACKER_XTST_SUBEVENT_MEMBER_DATA24
+#endif//PACKER_CODE
+
+{
+public:
+  // MEMBER(DATA24 mDATA24);
+  DATA24 mDATA24;
+  // MEMBER(DATA24 mDATA24_array[8]);
+  raw_array<DATA24,DATA24,8> mDATA24_array;
+  // MEMBER(DATA24 mDATA24_array_zzp[8] ZERO_SUPPRESS);
+  raw_array_zero_suppress<DATA24,DATA24,8> mDATA24_array_zzp;
+  // MEMBER(DATA24 mDATA24_array_zzpii[8] ZERO_SUPPRESS_LIST);
+  raw_list_zero_suppress<DATA24,DATA24,8> mDATA24_array_zzpii;
+  // MEMBER(DATA24 mDATA24_array_zzpml[8] ZERO_SUPPRESS_MULTI(4));
+  raw_array_multi_zero_suppress<DATA24,DATA24,8,4> mDATA24_array_zzpml;
+  // MEMBER(DATA24 mDATA24_array2[2][8]);
+  raw_array<DATA24,DATA24,8> mDATA24_array2[2];
+  // MEMBER(DATA24 mDATA24_array2_zzp[2][8] ZERO_SUPPRESS);
+  raw_array_zero_suppress<DATA24,DATA24,8> mDATA24_array2_zzp[2];
+  // MEMBER(DATA24 mDATA24_array2_zzpii[2][8] ZERO_SUPPRESS_LIST);
+  raw_list_zero_suppress<DATA24,DATA24,8> mDATA24_array2_zzpii[2];
+  // MEMBER(DATA24 mDATA24_array2_zzpml[2][8] ZERO_SUPPRESS_MULTI(4));
+  raw_array_multi_zero_suppress<DATA24,DATA24,8,4> mDATA24_array2_zzpml[2];
+
+public:
+#ifndef __PSDC__
+# if !PACKER_CODE
+template<typename __data_src_t>
+  void __unpack(__data_src_t &__buffer);
+template<typename __data_src_t>
+  static bool __match(__data_src_t &__buffer);
+  // void __clean();
+# else//PACKER_CODE
+template<typename __data_dest_t>
+  void __packer(__data_dest_t &__buffer);
+# endif//PACKER_CODE
+
+  STRUCT_FCNS_DECL(XTST_SUBEVENT_MEMBER_DATA24);
+#endif//!__PSDC__
+};
+
+/** END_STRUCTURES ****************************************************/
+/** BEGIN_STRUCTURES ***************************************************
+ *
+ * Event unpacker associated structures for XTST_SUBEVENT_MEMBER_DATA32.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// XTST_SUBEVENT_MEMBER_DATA32()
+#if !PACKER_CODE
+# define DECLARED_UNPACK_XTST_SUBEVENT_MEMBER_DATA32
+class XTST_SUBEVENT_MEMBER_DATA32
+#else//PACKER_CODE
+# define DECLARED_PACKER_XTST_SUBEVENT_MEMBER_DATA32
+class PACKER_XTST_SUBEVENT_MEMBER_DATA32
+#endif//PACKER_CODE
+
+{
+public:
+  // MEMBER(DATA32 mDATA32);
+  DATA32 mDATA32;
+  // MEMBER(DATA32 mDATA32_array[8]);
+  raw_array<DATA32,DATA32,8> mDATA32_array;
+  // MEMBER(DATA32 mDATA32_array_zzp[8] ZERO_SUPPRESS);
+  raw_array_zero_suppress<DATA32,DATA32,8> mDATA32_array_zzp;
+  // MEMBER(DATA32 mDATA32_array_zzpii[8] ZERO_SUPPRESS_LIST);
+  raw_list_zero_suppress<DATA32,DATA32,8> mDATA32_array_zzpii;
+  // MEMBER(DATA32 mDATA32_array_zzpml[8] ZERO_SUPPRESS_MULTI(4));
+  raw_array_multi_zero_suppress<DATA32,DATA32,8,4> mDATA32_array_zzpml;
+  // MEMBER(DATA32 mDATA32_array2[2][8]);
+  raw_array<DATA32,DATA32,8> mDATA32_array2[2];
+  // MEMBER(DATA32 mDATA32_array2_zzp[2][8] ZERO_SUPPRESS);
+  raw_array_zero_suppress<DATA32,DATA32,8> mDATA32_array2_zzp[2];
+  // MEMBER(DATA32 mDATA32_array2_zzpii[2][8] ZERO_SUPPRESS_LIST);
+  raw_list_zero_suppress<DATA32,DATA32,8> mDATA32_array2_zzpii[2];
+  // MEMBER(DATA32 mDATA32_array2_zzpml[2][8] ZERO_SUPPRESS_MULTI(4));
+  raw_array_multi_zero_suppress<DATA32,DATA32,8,4> mDATA32_array2_zzpml[2];
+
+public:
+#ifndef __PSDC__
+# if !PACKER_CODE
+template<typename __data_src_t>
+  void __unpack(__data_src_t &__buffer);
+template<typename __data_src_t>
+  static bool __match(__data_src_t &__buffer);
+  // void __clean();
+# else//PACKER_CODE
+template<typename __data_dest_t>
+  void __packer(__data_dest_t &__buffer);
+# endif//PACKER_CODE
+
+  STRUCT_FCNS_DECL(XTST_SUBEVENT_MEMBER_DATA32);
+#endif//!__PSDC__
+};
+
+/** END_STRUCTURES ****************************************************/
+/** BEGIN_STRUCTURES ***************************************************
+ *
+ * Event unpacker associated structures for XTST_SUBEVENT_MEMBER_DATA32_B.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// XTST_SUBEVENT_MEMBER_DATA32_B()
+#if !PACKER_CODE
+# define DECLARED_UNPACK_XTST_SUBEVENT_MEMBER_DATA32_B
+class XTST_SUBEVENT_MEMBER_DATA32_B
+#else//PACKER_CODE
+# define DECLARED_PACKER_XTST_SUBEVENT_MEMBER_DATA32_B
+class PACKER_XTST_SUBEVENT_MEMBER_DATA32_B
+#endif//PACKER_CODE
+
+{
+public:
+  // MEMBER(DATA32 mDATA32_array_zzpml[8] ZERO_SUPPRESS_MULTI(4));
+  raw_array_multi_zero_suppress<DATA32,DATA32,8,4> mDATA32_array_zzpml;
+
+public:
+#ifndef __PSDC__
+# if !PACKER_CODE
+template<typename __data_src_t>
+  void __unpack(__data_src_t &__buffer);
+template<typename __data_src_t>
+  static bool __match(__data_src_t &__buffer);
+  // void __clean();
+# else//PACKER_CODE
+template<typename __data_dest_t>
+  void __packer(__data_dest_t &__buffer);
+# endif//PACKER_CODE
+
+  STRUCT_FCNS_DECL(XTST_SUBEVENT_MEMBER_DATA32_B);
+#endif//!__PSDC__
+};
+
+/** END_STRUCTURES ****************************************************/
+/** BEGIN_STRUCTURES ***************************************************
+ *
+ * Event unpacker associated structures for XTST_SUBEVENT_MEMBER_DATA8.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// XTST_SUBEVENT_MEMBER_DATA8()
+#if !PACKER_CODE
+# define DECLARED_UNPACK_XTST_SUBEVENT_MEMBER_DATA8
+class XTST_SUBEVENT_MEMBER_DATA8
+#else//PACKER_CODE
+# define DECLARED_PACKER_XTST_SUBEVENT_MEMBER_DATA8
+class PACKER_XTST_SUBEVENT_MEMBER_DATA8
+#endif//PACKER_CODE
+
+{
+public:
+  // MEMBER(DATA8 mDATA8);
+  DATA8 mDATA8;
+  // MEMBER(DATA8 mDATA8_array[8]);
+  raw_array<DATA8,DATA8,8> mDATA8_array;
+  // MEMBER(DATA8 mDATA8_array_zzp[8] ZERO_SUPPRESS);
+  raw_array_zero_suppress<DATA8,DATA8,8> mDATA8_array_zzp;
+  // MEMBER(DATA8 mDATA8_array_zzpii[8] ZERO_SUPPRESS_LIST);
+  raw_list_zero_suppress<DATA8,DATA8,8> mDATA8_array_zzpii;
+  // MEMBER(DATA8 mDATA8_array_zzpml[8] ZERO_SUPPRESS_MULTI(4));
+  raw_array_multi_zero_suppress<DATA8,DATA8,8,4> mDATA8_array_zzpml;
+  // MEMBER(DATA8 mDATA8_array2[2][8]);
+  raw_array<DATA8,DATA8,8> mDATA8_array2[2];
+  // MEMBER(DATA8 mDATA8_array2_zzp[2][8] ZERO_SUPPRESS);
+  raw_array_zero_suppress<DATA8,DATA8,8> mDATA8_array2_zzp[2];
+  // MEMBER(DATA8 mDATA8_array2_zzpii[2][8] ZERO_SUPPRESS_LIST);
+  raw_list_zero_suppress<DATA8,DATA8,8> mDATA8_array2_zzpii[2];
+  // MEMBER(DATA8 mDATA8_array2_zzpml[2][8] ZERO_SUPPRESS_MULTI(4));
+  raw_array_multi_zero_suppress<DATA8,DATA8,8,4> mDATA8_array2_zzpml[2];
+
+public:
+#ifndef __PSDC__
+# if !PACKER_CODE
+template<typename __data_src_t>
+  void __unpack(__data_src_t &__buffer);
+template<typename __data_src_t>
+  static bool __match(__data_src_t &__buffer);
+  // void __clean();
+# else//PACKER_CODE
+template<typename __data_dest_t>
+  void __packer(__data_dest_t &__buffer);
+# endif//PACKER_CODE
+
+  STRUCT_FCNS_DECL(XTST_SUBEVENT_MEMBER_DATA8);
+#endif//!__PSDC__
+};
+
+/** END_STRUCTURES ****************************************************/
+/** BEGIN_STRUCTURES ***************************************************
+ *
+ * Event unpacker associated structures for XTST_SUBEVENT_MEMBER_uint16.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// XTST_SUBEVENT_MEMBER_uint16()
+#if !PACKER_CODE
+# define DECLARED_UNPACK_XTST_SUBEVENT_MEMBER_uint16
+class XTST_SUBEVENT_MEMBER_uint16
+#else//PACKER_CODE
+# define DECLARED_PACKER_XTST_SUBEVENT_MEMBER_uint16
+class PACKER_XTST_SUBEVENT_MEMBER_uint16
+#endif//PACKER_CODE
+
+{
+public:
+  // MEMBER(uint16 muint16);
+  uint16 muint16;
+
+public:
+#ifndef __PSDC__
+# if !PACKER_CODE
+template<typename __data_src_t>
+  void __unpack(__data_src_t &__buffer);
+template<typename __data_src_t>
+  static bool __match(__data_src_t &__buffer);
+  // void __clean();
+# else//PACKER_CODE
+template<typename __data_dest_t>
+  void __packer(__data_dest_t &__buffer);
+# endif//PACKER_CODE
+
+  STRUCT_FCNS_DECL(XTST_SUBEVENT_MEMBER_uint16);
+#endif//!__PSDC__
+};
+
+/** END_STRUCTURES ****************************************************/
+/** BEGIN_STRUCTURES ***************************************************
+ *
+ * Event unpacker associated structures for XTST_SUBEVENT_MEMBER_uint32.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// XTST_SUBEVENT_MEMBER_uint32()
+#if !PACKER_CODE
+# define DECLARED_UNPACK_XTST_SUBEVENT_MEMBER_uint32
+class XTST_SUBEVENT_MEMBER_uint32
+#else//PACKER_CODE
+# define DECLARED_PACKER_XTST_SUBEVENT_MEMBER_uint32
+class PACKER_XTST_SUBEVENT_MEMBER_uint32
+#endif//PACKER_CODE
+
+{
+public:
+  // MEMBER(uint32 muint32);
+  uint32 muint32;
+
+public:
+#ifndef __PSDC__
+# if !PACKER_CODE
+template<typename __data_src_t>
+  void __unpack(__data_src_t &__buffer);
+template<typename __data_src_t>
+  static bool __match(__data_src_t &__buffer);
+  // void __clean();
+# else//PACKER_CODE
+template<typename __data_dest_t>
+  void __packer(__data_dest_t &__buffer);
+# endif//PACKER_CODE
+
+  STRUCT_FCNS_DECL(XTST_SUBEVENT_MEMBER_uint32);
+#endif//!__PSDC__
+};
+
+/** END_STRUCTURES ****************************************************/
+/** BEGIN_STRUCTURES ***************************************************
+ *
+ * Event unpacker associated structures for XTST_SUBEVENT_MEMBER_uint8.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// XTST_SUBEVENT_MEMBER_uint8()
+#if !PACKER_CODE
+# define DECLARED_UNPACK_XTST_SUBEVENT_MEMBER_uint8
+class XTST_SUBEVENT_MEMBER_uint8
+#else//PACKER_CODE
+# define DECLARED_PACKER_XTST_SUBEVENT_MEMBER_uint8
+class PACKER_XTST_SUBEVENT_MEMBER_uint8
+#endif//PACKER_CODE
+
+{
+public:
+  // MEMBER(uint8 muint8);
+  uint8 muint8;
+
+public:
+#ifndef __PSDC__
+# if !PACKER_CODE
+template<typename __data_src_t>
+  void __unpack(__data_src_t &__buffer);
+template<typename __data_src_t>
+  static bool __match(__data_src_t &__buffer);
+  // void __clean();
+# else//PACKER_CODE
+template<typename __data_dest_t>
+  void __packer(__data_dest_t &__buffer);
+# endif//PACKER_CODE
+
+  STRUCT_FCNS_DECL(XTST_SUBEVENT_MEMBER_uint8);
+#endif//!__PSDC__
+};
+
+/** END_STRUCTURES ****************************************************/
+/** BEGIN_STRUCTURES ***************************************************
+ *
+ * Event unpacker associated structures for BITS64.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// SUBEVENT(BITS64)
+#if !PACKER_CODE
+# define DECLARED_UNPACK_BITS64
+class BITS64
+#else//PACKER_CODE
+# define DECLARED_PACKER_BITS64
+class PACKER_BITS64
+#endif//PACKER_CODE
+ : public unpack_subevent_base
+{
+public:
+  // MEMBER(DATA64 member64);
+  DATA64 member64;
+  // MEMBER(DATA64 array64[7]);
+  raw_array<DATA64,DATA64,7> array64;
+  // MEMBER(DATA32 member32);
+  DATA32 member32;
+  // UINT32 data32_1;
+  uint32  data32_1;
+  // UINT32 data32_2;
+  uint32  data32_2;
+  // MARK_COUNT(start);
+  // UINT64 data64_1;
+  uint64  data64_1;
+  // MARK_COUNT(end);
+  // CHECK_COUNT(data32_1,start,end,4,4)
+  // select several
+
+    // i[0] = ITEM64(num=0);
+    // i[1] = ITEM64(num=1);
+    // i[2] = ITEM64(num=2);
+  SINGLE(ITEM64,i[3]);
+
+public:
+#ifndef __PSDC__
+# if !PACKER_CODE
+template<typename __data_src_t>
+  void __unpack(__data_src_t &__buffer);
+template<typename __data_src_t>
+  static bool __match(__data_src_t &__buffer);
+  // void __clean();
+# else//PACKER_CODE
+template<typename __data_dest_t>
+  void __packer(__data_dest_t &__buffer);
+# endif//PACKER_CODE
+
+  STRUCT_FCNS_DECL(BITS64);
+#endif//!__PSDC__
+};
+
+/** END_STRUCTURES ****************************************************/
+/** BEGIN_STRUCTURES ***************************************************
+ *
+ * Event unpacker associated structures for XTST_MDPP16.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// SUBEVENT(XTST_MDPP16)
+#if !PACKER_CODE
+# define DECLARED_UNPACK_XTST_MDPP16
+class XTST_MDPP16
+#else//PACKER_CODE
+# define DECLARED_PACKER_XTST_MDPP16
+class PACKER_XTST_MDPP16
+#endif//PACKER_CODE
+ : public unpack_subevent_base
+{
+public:
+  // UINT16 align
+  // {
+    //  0_15: unaligned;
+  // }
+  union
+  {
+    struct
+    {
+#if __BYTE_ORDER == __LITTLE_ENDIAN
+      uint16 unaligned : 16; // 0..15
+#endif
+#if __BYTE_ORDER == __BIG_ENDIAN
+      uint16 unaligned : 16; // 0..15
+#endif
+    };
+    uint16  u16;
+  } align;
+  // if(( ! align.unaligned))
+
+    // UINT16 pad;
+    uint16  pad;
+  // select several
+
+    // mdpp16[0] = VME_MESYTEC_MDPP16(geom=1);
+    // mdpp16[1] = VME_MESYTEC_MDPP16(geom=2);
+  SINGLE(VME_MESYTEC_MDPP16,mdpp16[2]);
+
+public:
+#ifndef __PSDC__
+# if !PACKER_CODE
+template<typename __data_src_t>
+  void __unpack(__data_src_t &__buffer);
+template<typename __data_src_t>
+  static bool __match(__data_src_t &__buffer);
+  // void __clean();
+# else//PACKER_CODE
+template<typename __data_dest_t>
+  void __packer(__data_dest_t &__buffer);
+# endif//PACKER_CODE
+
+  STRUCT_FCNS_DECL(XTST_MDPP16);
+#endif//!__PSDC__
+};
+
+/** END_STRUCTURES ****************************************************/
+/** BEGIN_STRUCTURES ***************************************************
+ *
+ * Event unpacker associated structures for XTST_PLAIN.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// SUBEVENT(XTST_PLAIN)
+#if !PACKER_CODE
+# define DECLARED_UNPACK_XTST_PLAIN
+class XTST_PLAIN
+#else//PACKER_CODE
+# define DECLARED_PACKER_XTST_PLAIN
+class PACKER_XTST_PLAIN
+#endif//PACKER_CODE
+ : public unpack_subevent_base
+{
+public:
+  // UINT32 u;
+  uint32  u;
+  // UINT16 s;
+  uint16  s;
+  // UINT8 c;
+  uint8   c;
+
+public:
+#ifndef __PSDC__
+# if !PACKER_CODE
+template<typename __data_src_t>
+  void __unpack(__data_src_t &__buffer);
+template<typename __data_src_t>
+  static bool __match(__data_src_t &__buffer);
+  // void __clean();
+# else//PACKER_CODE
+template<typename __data_dest_t>
+  void __packer(__data_dest_t &__buffer);
+# endif//PACKER_CODE
+
+  STRUCT_FCNS_DECL(XTST_PLAIN);
+#endif//!__PSDC__
+};
+
+/** END_STRUCTURES ****************************************************/
+/** BEGIN_STRUCTURES ***************************************************
+ *
+ * Event unpacker associated structures for XTST_REGRESS.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// SUBEVENT(XTST_REGRESS)
+#if !PACKER_CODE
+# define DECLARED_UNPACK_XTST_REGRESS
+class XTST_REGRESS
+#else//PACKER_CODE
+# define DECLARED_PACKER_XTST_REGRESS
+class PACKER_XTST_REGRESS
+#endif//PACKER_CODE
+ : public unpack_subevent_base
+{
+public:
+  // select several
+
+    // wr[1] = WR_STAMP(id=1);
+    // wr[2] = WR_STAMP(id=2);
+    // wr[3] = WR_STAMP(id=3);
+    // wr[4] = WR_STAMP(id=4);
+    // wr[5] = WR_STAMP(id=5);
+  SINGLE(WR_STAMP,wr[6]);
+  // UINT32 separator1 NOENCODE
+  // {
+    //  0_31: 0;
+  // }
+  // UINT32 seed;
+  uint32  seed;
+  // select several
+
+    // v775mod[0] = VME_CAEN_V775(geom=1,crate=127);
+    // v775mod[1] = VME_CAEN_V775(geom=2,crate=126);
+  SINGLE(VME_CAEN_V775,v775mod[2]);
+  // UINT32 separator2 NOENCODE
+  // {
+    //  0_31: 0;
+  // }
+  // select several
+
+    // v1290mod[0] = VME_CAEN_V1290_SHORT(geom=1);
+    // v1290mod[1] = VME_CAEN_V1290_SHORT(geom=2);
+  SINGLE(VME_CAEN_V1290_SHORT,v1290mod[2]);
+  // select several
+
+    // sticky_active = STICKY_ACTIVE();
+  SINGLE(STICKY_ACTIVE,sticky_active);
+
+public:
+#ifndef __PSDC__
+# if !PACKER_CODE
+template<typename __data_src_t>
+  void __unpack(__data_src_t &__buffer);
+template<typename __data_src_t>
+  static bool __match(__data_src_t &__buffer);
+  // void __clean();
+# else//PACKER_CODE
+template<typename __data_dest_t>
+  void __packer(__data_dest_t &__buffer);
+# endif//PACKER_CODE
+
+  STRUCT_FCNS_DECL(XTST_REGRESS);
+#endif//!__PSDC__
+};
+
+/** END_STRUCTURES ****************************************************/
+/** BEGIN_STRUCTURES ***************************************************
+ *
+ * Event unpacker associated structures for XTST_REGRESSEXTRA.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// SUBEVENT(XTST_REGRESSEXTRA)
+#if !PACKER_CODE
+# define DECLARED_UNPACK_XTST_REGRESSEXTRA
+class XTST_REGRESSEXTRA
+#else//PACKER_CODE
+# define DECLARED_PACKER_XTST_REGRESSEXTRA
+class PACKER_XTST_REGRESSEXTRA
+#endif//PACKER_CODE
+ : public unpack_subevent_base
+{
+public:
+  // UINT32 junk;
+  uint32  junk;
+
+public:
+#ifndef __PSDC__
+# if !PACKER_CODE
+template<typename __data_src_t>
+  void __unpack(__data_src_t &__buffer);
+template<typename __data_src_t>
+  static bool __match(__data_src_t &__buffer);
+  // void __clean();
+# else//PACKER_CODE
+template<typename __data_dest_t>
+  void __packer(__data_dest_t &__buffer);
+# endif//PACKER_CODE
+
+  STRUCT_FCNS_DECL(XTST_REGRESSEXTRA);
+#endif//!__PSDC__
+};
+
+/** END_STRUCTURES ****************************************************/
+/** BEGIN_STRUCTURES ***************************************************
+ *
+ * Event unpacker associated structures for XTST_STICKY_CORR.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// SUBEVENT(XTST_STICKY_CORR)
+#if !PACKER_CODE
+# define DECLARED_UNPACK_XTST_STICKY_CORR
+class XTST_STICKY_CORR
+#else//PACKER_CODE
+# define DECLARED_PACKER_XTST_STICKY_CORR
+class PACKER_XTST_STICKY_CORR
+#endif//PACKER_CODE
+ : public unpack_sticky_subevent_base
+{
+public:
+  // UINT32 base;
+  uint32  base;
+
+public:
+#ifndef __PSDC__
+# if !PACKER_CODE
+template<typename __data_src_t>
+  void __unpack(__data_src_t &__buffer);
+template<typename __data_src_t>
+  static bool __match(__data_src_t &__buffer);
+  // void __clean();
+# else//PACKER_CODE
+template<typename __data_dest_t>
+  void __packer(__data_dest_t &__buffer);
+# endif//PACKER_CODE
+
+  STRUCT_FCNS_DECL(XTST_STICKY_CORR);
+#endif//!__PSDC__
+};
+
+/** END_STRUCTURES ****************************************************/
+/** BEGIN_STRUCTURES ***************************************************
+ *
+ * Event unpacker associated structures for XTST_SUBEVENT_ME2.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// SUBEVENT(XTST_SUBEVENT_ME2)
+#if !PACKER_CODE
+# define DECLARED_UNPACK_XTST_SUBEVENT_ME2
+class XTST_SUBEVENT_ME2
+#else//PACKER_CODE
+# define DECLARED_PACKER_XTST_SUBEVENT_ME2
+class PACKER_XTST_SUBEVENT_ME2
+#endif//PACKER_CODE
+ : public unpack_subevent_base
+{
+public:
+  // select several
+
+    // i[0] = ITEM_ME2(geom=0);
+    // i[1] = ITEM_ME2(geom=1);
+    // i[2] = ITEM_ME2(geom=2);
+  SINGLE(ITEM_ME2,i[3]);
+
+public:
+#ifndef __PSDC__
+# if !PACKER_CODE
+template<typename __data_src_t>
+  void __unpack(__data_src_t &__buffer);
+template<typename __data_src_t>
+  static bool __match(__data_src_t &__buffer);
+  // void __clean();
+# else//PACKER_CODE
+template<typename __data_dest_t>
+  void __packer(__data_dest_t &__buffer);
+# endif//PACKER_CODE
+
+  STRUCT_FCNS_DECL(XTST_SUBEVENT_ME2);
+#endif//!__PSDC__
+};
+
+/** END_STRUCTURES ****************************************************/
+/** BEGIN_STRUCTURES ***************************************************
+ *
+ * Event unpacker associated structures for XTST_SUBEVENT_MEMBER_ENCODE.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// SUBEVENT(XTST_SUBEVENT_MEMBER_ENCODE)
+#if !PACKER_CODE
+# define DECLARED_UNPACK_XTST_SUBEVENT_MEMBER_ENCODE
+class XTST_SUBEVENT_MEMBER_ENCODE
+#else//PACKER_CODE
+# define DECLARED_PACKER_XTST_SUBEVENT_MEMBER_ENCODE
+class PACKER_XTST_SUBEVENT_MEMBER_ENCODE
+#endif//PACKER_CODE
+ : public unpack_subevent_base
+{
+public:
+  // member_DATA32 = XTST_SUBEVENT_MEMBER_DATA32();
+  // member_DATA24 = XTST_SUBEVENT_MEMBER_DATA24();
+  // member_DATA16 = XTST_SUBEVENT_MEMBER_DATA16();
+  // member_DATA16_OVERFLOW = XTST_SUBEVENT_MEMBER_DATA16_OVERFLOW();
+  // member_DATA12 = XTST_SUBEVENT_MEMBER_DATA12();
+  // member_DATA12_OVERFLOW = XTST_SUBEVENT_MEMBER_DATA12_OVERFLOW();
+  // member_DATA12_RANGE = XTST_SUBEVENT_MEMBER_DATA12_RANGE();
+  // member_uint32 = XTST_SUBEVENT_MEMBER_uint32();
+  // member_uint16 = XTST_SUBEVENT_MEMBER_uint16();
+  // member_uint8 = XTST_SUBEVENT_MEMBER_uint8();
+  SINGLE(XTST_SUBEVENT_MEMBER_DATA32,member_DATA32);
+  SINGLE(XTST_SUBEVENT_MEMBER_DATA24,member_DATA24);
+  SINGLE(XTST_SUBEVENT_MEMBER_DATA16,member_DATA16);
+  SINGLE(XTST_SUBEVENT_MEMBER_DATA16_OVERFLOW,member_DATA16_OVERFLOW);
+  SINGLE(XTST_SUBEVENT_MEMBER_DATA12,member_DATA12);
+  SINGLE(XTST_SUBEVENT_MEMBER_DATA12_OVERFLOW,member_DATA12_OVERFLOW);
+  SINGLE(XTST_SUBEVENT_MEMBER_DATA12_RANGE,member_DATA12_RANGE);
+  SINGLE(XTST_SUBEVENT_MEMBER_uint32,member_uint32);
+  SINGLE(XTST_SUBEVENT_MEMBER_uint16,member_uint16);
+  SINGLE(XTST_SUBEVENT_MEMBER_uint8,member_uint8);
+
+public:
+#ifndef __PSDC__
+# if !PACKER_CODE
+template<typename __data_src_t>
+  void __unpack(__data_src_t &__buffer);
+template<typename __data_src_t>
+  static bool __match(__data_src_t &__buffer);
+  // void __clean();
+# else//PACKER_CODE
+template<typename __data_dest_t>
+  void __packer(__data_dest_t &__buffer);
+# endif//PACKER_CODE
+
+  STRUCT_FCNS_DECL(XTST_SUBEVENT_MEMBER_ENCODE);
+#endif//!__PSDC__
+};
+
+/** END_STRUCTURES ****************************************************/
+/** BEGIN_STRUCTURES ***************************************************
+ *
+ * Event unpacker associated structures for XTST_SUBEVENT_MEMBER_ENCODE_A.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// SUBEVENT(XTST_SUBEVENT_MEMBER_ENCODE_A)
+#if !PACKER_CODE
+# define DECLARED_UNPACK_XTST_SUBEVENT_MEMBER_ENCODE_A
+class XTST_SUBEVENT_MEMBER_ENCODE_A
+#else//PACKER_CODE
+# define DECLARED_PACKER_XTST_SUBEVENT_MEMBER_ENCODE_A
+class PACKER_XTST_SUBEVENT_MEMBER_ENCODE_A
+#endif//PACKER_CODE
+ : public unpack_subevent_base
+{
+public:
+  // d32 = XTST_SUBEVENT_MEMBER_DATA32();
+  SINGLE(XTST_SUBEVENT_MEMBER_DATA32,d32);
+
+public:
+#ifndef __PSDC__
+# if !PACKER_CODE
+template<typename __data_src_t>
+  void __unpack(__data_src_t &__buffer);
+template<typename __data_src_t>
+  static bool __match(__data_src_t &__buffer);
+  // void __clean();
+# else//PACKER_CODE
+template<typename __data_dest_t>
+  void __packer(__data_dest_t &__buffer);
+# endif//PACKER_CODE
+
+  STRUCT_FCNS_DECL(XTST_SUBEVENT_MEMBER_ENCODE_A);
+#endif//!__PSDC__
+};
+
+/** END_STRUCTURES ****************************************************/
+/** BEGIN_STRUCTURES ***************************************************
+ *
+ * Event unpacker associated structures for XTST_SUBEVENT_MEMBER_ENCODE_B.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// SUBEVENT(XTST_SUBEVENT_MEMBER_ENCODE_B)
+#if !PACKER_CODE
+# define DECLARED_UNPACK_XTST_SUBEVENT_MEMBER_ENCODE_B
+class XTST_SUBEVENT_MEMBER_ENCODE_B
+#else//PACKER_CODE
+# define DECLARED_PACKER_XTST_SUBEVENT_MEMBER_ENCODE_B
+class PACKER_XTST_SUBEVENT_MEMBER_ENCODE_B
+#endif//PACKER_CODE
+ : public unpack_subevent_base
+{
+public:
+  // d32 = XTST_SUBEVENT_MEMBER_DATA32_B();
+  SINGLE(XTST_SUBEVENT_MEMBER_DATA32_B,d32);
+
+public:
+#ifndef __PSDC__
+# if !PACKER_CODE
+template<typename __data_src_t>
+  void __unpack(__data_src_t &__buffer);
+template<typename __data_src_t>
+  static bool __match(__data_src_t &__buffer);
+  // void __clean();
+# else//PACKER_CODE
+template<typename __data_dest_t>
+  void __packer(__data_dest_t &__buffer);
+# endif//PACKER_CODE
+
+  STRUCT_FCNS_DECL(XTST_SUBEVENT_MEMBER_ENCODE_B);
+#endif//!__PSDC__
+};
+
+/** END_STRUCTURES ****************************************************/
+/** BEGIN_STRUCTURES ***************************************************
+ *
+ * Event unpacker associated structures for XTST_VME.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// SUBEVENT(XTST_VME)
+#if !PACKER_CODE
+# define DECLARED_UNPACK_XTST_VME
+class XTST_VME
+#else//PACKER_CODE
+# define DECLARED_PACKER_XTST_VME
+class PACKER_XTST_VME
+#endif//PACKER_CODE
+ : public unpack_subevent_base
+{
+public:
+  // header = XTST_STD_VME();
+  // sdm = SINGLE_DATA_MODULE();
+  // select several
+
+    // tdc0 = VME_CAEN_V775(geom=20,crate=20);
+    // tdc1 = VME_CAEN_V775(geom=21,crate=20);
+    // tdc2 = VME_CAEN_V775(geom=22,crate=20);
+    // qdc0 = VME_CAEN_V775(geom=21,crate=40);
+    // qdc1 = VME_CAEN_V775(geom=21,crate=40);
+  SINGLE(VME_CAEN_V775,tdc0);
+  SINGLE(VME_CAEN_V775,tdc1);
+  SINGLE(VME_CAEN_V775,tdc2);
+  SINGLE(VME_CAEN_V775,qdc0);
+  SINGLE(VME_CAEN_V775,qdc1);
+  // select several
+
+    // mdpp16 = VME_MESYTEC_MDPP16(geom=31);
+  SINGLE(VME_MESYTEC_MDPP16,mdpp16);
+  SINGLE(XTST_STD_VME,header);
+  SINGLE(SINGLE_DATA_MODULE,sdm);
+
+public:
+#ifndef __PSDC__
+# if !PACKER_CODE
+template<typename __data_src_t>
+  void __unpack(__data_src_t &__buffer);
+template<typename __data_src_t>
+  static bool __match(__data_src_t &__buffer);
+  // void __clean();
+# else//PACKER_CODE
+template<typename __data_dest_t>
+  void __packer(__data_dest_t &__buffer);
+# endif//PACKER_CODE
+
+  STRUCT_FCNS_DECL(XTST_VME);
+#endif//!__PSDC__
+};
+
+/** END_STRUCTURES ****************************************************/
+/** BEGIN_STRUCTURES ***************************************************
+ *
+ * Event unpacker associated structures for EVENT.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// EVENT
+class unpack_event : public unpack_event_base
+{
+public:
+  // vme = XTST_VME(type=36,subtype=0xc1c);
+  // bits64 = BITS64(type=64,subtype=64);
+  // me = XTST_SUBEVENT_MEMBER_ENCODE(type=10);
+  // mea = XTST_SUBEVENT_MEMBER_ENCODE_A(type=12);
+  // meb = XTST_SUBEVENT_MEMBER_ENCODE_B(type=13);
+  // me2 = XTST_SUBEVENT_ME2(type=11);
+  // plain = XTST_PLAIN(type=12);
+  // regress[0] = XTST_REGRESS(type=0xcae,subtype=0xcae,subcrate=0);
+  // regress[1] = XTST_REGRESS(type=0xcae,subtype=0xcae,subcrate=1);
+  // regress[2] = XTST_REGRESS(type=0xcae,subtype=0xcae,subcrate=2);
+  // regress[3] = XTST_REGRESS(type=0xcae,subtype=0xcae,subcrate=3);
+  // regress[4] = XTST_REGRESS(type=0xcae,subtype=0xcae,subcrate=4);
+  // regress[5] = XTST_REGRESS(type=0xcae,subtype=0xcae,subcrate=5);
+  // regress[6] = XTST_REGRESS(type=0xcae,subtype=0xcae,subcrate=6);
+  // regress[7] = XTST_REGRESS(type=0xcae,subtype=0xcae,subcrate=7);
+  // regress[8] = XTST_REGRESS(type=0xcae,subtype=0xcae,subcrate=8);
+  // regress[9] = XTST_REGRESS(type=0xcae,subtype=0xcae,subcrate=9);
+  // regress[10] = XTST_REGRESS(type=0xcae,subtype=0xcae,subcrate=10);
+  // regress[11] = XTST_REGRESS(type=0xcae,subtype=0xcae,subcrate=11);
+  // regress[12] = XTST_REGRESS(type=0xcae,subtype=0xcae,subcrate=12);
+  // regress[13] = XTST_REGRESS(type=0xcae,subtype=0xcae,subcrate=13);
+  // regress[14] = XTST_REGRESS(type=0xcae,subtype=0xcae,subcrate=14);
+  // regress[15] = XTST_REGRESS(type=0xcae,subtype=0xcae,subcrate=15);
+  // regressextra = XTST_REGRESSEXTRA(type=0xde0,subtype=0xad0);
+  // mdpp = XTST_MDPP16(type=0xbd0,subtype=22);
+SINGLE(XTST_VME,vme);
+SINGLE(BITS64,bits64);
+SINGLE(XTST_SUBEVENT_MEMBER_ENCODE,me);
+SINGLE(XTST_SUBEVENT_MEMBER_ENCODE_A,mea);
+SINGLE(XTST_SUBEVENT_MEMBER_ENCODE_B,meb);
+SINGLE(XTST_SUBEVENT_ME2,me2);
+SINGLE(XTST_PLAIN,plain);
+SINGLE(XTST_REGRESS,regress[16]);
+SINGLE(XTST_REGRESSEXTRA,regressextra);
+SINGLE(XTST_MDPP16,mdpp);
+public:
+#ifndef __PSDC__
+  bitsone<25> __visited;
+  void __clear_visited() { __visited.clear(); }
+  subevent_match_cache __match_cache;
+  bool ignore_unknown_subevent() { return false; }
+#endif//!__PSDC__
+
+public:
+#ifndef __PSDC__
+template<typename __data_src_t>
+  int __unpack_subevent(subevent_header *__header,__data_src_t &__buffer);
+  int __revoke_subevent(subevent_header *__header);
+  // void __clean_event();
+
+  STRUCT_FCNS_DECL(unpack_event);
+#endif//!__PSDC__
+};
+
+/** END_STRUCTURES ****************************************************/
+/** BEGIN_STRUCTURES ***************************************************
+ *
+ * Event unpacker associated structures for EVENT.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// STICKY_EVENT
+class unpack_sticky_event : public unpack_sticky_event_base
+{
+public:
+  // corr = XTST_STICKY_CORR(type=0xcae,subtype=0xcaf);
+  // ignore_unknown_subevent;
+SINGLE(XTST_STICKY_CORR,corr);
+public:
+#ifndef __PSDC__
+  bitsone<2> __visited;
+  void __clear_visited() { __visited.clear(); }
+  subevent_match_cache __match_cache;
+  bool ignore_unknown_subevent() { return true; }
+#endif//!__PSDC__
+
+public:
+#ifndef __PSDC__
+template<typename __data_src_t>
+  int __unpack_subevent(subevent_header *__header,__data_src_t &__buffer);
+  int __revoke_subevent(subevent_header *__header);
+  // void __clean_event();
+
+  STRUCT_FCNS_DECL(unpack_sticky_event);
+#endif//!__PSDC__
+};
+
+/** END_STRUCTURES ****************************************************/
@@ -0,0 +1,44 @@
+/** BEGIN_SUBEVENT_NAMES ***********************************************
+ *
+ * Mappings of names for [incl|excl] name lookup.
+ *
+ * Do not edit - automatically generated.
+ */
+
+{ "vme", "type=36:subtype=0xc1c" },
+{ "bits64", "type=64:subtype=64" },
+{ "me", "type=10" },
+{ "mea", "type=12" },
+{ "meb", "type=13" },
+{ "me2", "type=11" },
+{ "plain", "type=12" },
+{ "regress[0]", "type=0xcae:subtype=0xcae:subcrate=0" },
+{ "regress[1]", "type=0xcae:subtype=0xcae:subcrate=1" },
+{ "regress[2]", "type=0xcae:subtype=0xcae:subcrate=2" },
+{ "regress[3]", "type=0xcae:subtype=0xcae:subcrate=3" },
+{ "regress[4]", "type=0xcae:subtype=0xcae:subcrate=4" },
+{ "regress[5]", "type=0xcae:subtype=0xcae:subcrate=5" },
+{ "regress[6]", "type=0xcae:subtype=0xcae:subcrate=6" },
+{ "regress[7]", "type=0xcae:subtype=0xcae:subcrate=7" },
+{ "regress[8]", "type=0xcae:subtype=0xcae:subcrate=8" },
+{ "regress[9]", "type=0xcae:subtype=0xcae:subcrate=9" },
+{ "regress[10]", "type=0xcae:subtype=0xcae:subcrate=10" },
+{ "regress[11]", "type=0xcae:subtype=0xcae:subcrate=11" },
+{ "regress[12]", "type=0xcae:subtype=0xcae:subcrate=12" },
+{ "regress[13]", "type=0xcae:subtype=0xcae:subcrate=13" },
+{ "regress[14]", "type=0xcae:subtype=0xcae:subcrate=14" },
+{ "regress[15]", "type=0xcae:subtype=0xcae:subcrate=15" },
+{ "regressextra", "type=0xde0:subtype=0xad0" },
+{ "mdpp", "type=0xbd0:subtype=22" },
+
+/** END_SUBEVENT_NAMES ************************************************/
+/** BEGIN_SUBEVENT_NAMES ***********************************************
+ *
+ * Mappings of names for [incl|excl] name lookup.
+ *
+ * Do not edit - automatically generated.
+ */
+
+{ "corr", "type=0xcae:subtype=0xcaf" },
+
+/** END_SUBEVENT_NAMES ************************************************/
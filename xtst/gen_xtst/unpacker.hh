@@ -0,0 +1,3547 @@
+/** BEGIN_UNPACKER *****************************************************
+ *
+ * Event unpacker for CAMAC_LECROY_4434.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// CAMAC_LECROY_4434(channels)
+template<typename __data_src_t>
+void CAMAC_LECROY_4434::__unpack(__data_src_t &__buffer,uint32 channels)
+{
+  // MEMBER(DATA24 data[32] ZERO_SUPPRESS);
+  // list(0<=index<channels)
+
+  for (uint32 index = 0; index < (uint32) (channels); ++index)
+  {
+    // UINT32 ch_data NOENCODE
+    // {
+      //  0_23: value;
+      // 24_31: 0;
+      // ENCODE(data[index],(value=value));
+    // }
+    union
+    {
+      struct
+      {
+#if __BYTE_ORDER == __LITTLE_ENDIAN
+        uint32 value : 24; // 0..23
+        uint32 unnamed_24_31 : 8; // 24..31
+#endif
+#if __BYTE_ORDER == __BIG_ENDIAN
+        uint32 unnamed_24_31 : 8; // 24..31
+        uint32 value : 24; // 0..23
+#endif
+      };
+      uint32  u32;
+    } ch_data;
+    READ_FROM_BUFFER_FULL(24,uint32 ,ch_data,ch_data.u32,0);
+    CHECK_BITS_EQUAL(21,ch_data.unnamed_24_31,0);
+    {
+      typedef __typeof__(*(&(data))) __array_t;
+      typedef typename __array_t::item_t __item_t;
+      __item_t &__item = data.insert_index(23,index);
+      __item.value = ch_data.value;
+    }
+  }
+}
+FORCE_IMPL_DATA_SRC_FCN_ARG(void,CAMAC_LECROY_4434::__unpack,uint32 channels);
+
+/** END_UNPACKER ******************************************************/
+/** BEGIN_UNPACKER *****************************************************
+ *
+ * Event unpacker for CAMAC_PHILLIPS_7164.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// CAMAC_PHILLIPS_7164(channels,mark_channel_no)
+template<typename __data_src_t>
+void CAMAC_PHILLIPS_7164::__unpack(__data_src_t &__buffer,uint32 channels
+                                                         ,uint32 mark_channel_no)
+{
+  // MEMBER(DATA12 data[16] ZERO_SUPPRESS);
+  // list(0<=index<channels)
+
+  for (uint32 index = 0; index < (uint32) (channels); ++index)
+  {
+    // if(mark_channel_no)
+
+    // else
+
+    if (mark_channel_no)
+    {
+      // UINT16 ch_data NOENCODE
+      // {
+        //  0_11: value;
+        // 12_15: channel = CHECK(index);
+        // ENCODE(data[index],(value=value));
+      // }
+      union
+      {
+        struct
+        {
+#if __BYTE_ORDER == __LITTLE_ENDIAN
+          uint16 value : 12; // 0..11
+          uint16 channel : 4; // 12..15
+#endif
+#if __BYTE_ORDER == __BIG_ENDIAN
+          uint16 channel : 4; // 12..15
+          uint16 value : 12; // 0..11
+#endif
+        };
+        uint16  u16;
+      } ch_data;
+      READ_FROM_BUFFER_FULL(72,uint16 ,ch_data,ch_data.u16,2);
+      CHECK_BITS_EQUAL(69,ch_data.channel,index);
+      {
+        typedef __typeof__(*(&(data))) __array_t;
+        typedef typename __array_t::item_t __item_t;
+        __item_t &__item = data.insert_index(71,index);
+        __item.value = ch_data.value;
+      }
+    }
+
+    else
+    {
+      // UINT16 ch_data NOENCODE
+      // {
+        //  0_11: value;
+        // ENCODE(data[index],(value=value));
+      // }
+      union
+      {
+        struct
+        {
+#if __BYTE_ORDER == __LITTLE_ENDIAN
+          uint16 value : 12; // 0..11
+          uint16 dummy_12_15 : 4;
+#endif
+#if __BYTE_ORDER == __BIG_ENDIAN
+          uint16 dummy_12_15 : 4;
+          uint16 value : 12; // 0..11
+#endif
+        };
+        uint16  u16;
+      } ch_data;
+      READ_FROM_BUFFER_FULL(79,uint16 ,ch_data,ch_data.u16,3);
+      CHECK_UNNAMED_BITS_ZERO(79,ch_data.u16,0xf000);
+      {
+        typedef __typeof__(*(&(data))) __array_t;
+        typedef typename __array_t::item_t __item_t;
+        __item_t &__item = data.insert_index(78,index);
+        __item.value = ch_data.value;
+      }
+    }
+  }
+}
+FORCE_IMPL_DATA_SRC_FCN_ARG(void,CAMAC_PHILLIPS_7164::__unpack,uint32 channels
+                                                              ,uint32 mark_channel_no);
+
+/** END_UNPACKER ******************************************************/
+/** BEGIN_UNPACKER *****************************************************
+ *
+ * Event unpacker for CAMAC_SILENA_4418.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// CAMAC_SILENA_4418(channels,mark_channel_no)
+template<typename __data_src_t>
+void CAMAC_SILENA_4418::__unpack(__data_src_t &__buffer,uint32 channels,uint32 mark_channel_no)
+{
+  // MEMBER(DATA12_OVERFLOW data[8] ZERO_SUPPRESS);
+  // list(0<=index<channels)
+
+  for (uint32 index = 0; index < (uint32) (channels); ++index)
+  {
+    // if(mark_channel_no)
+
+    // else
+
+    if (mark_channel_no)
+    {
+      // UINT16 ch_data NOENCODE
+      // {
+        //  0_11: value;
+        // 12_14: channel = CHECK(index);
+        //    15: overflow;
+        // ENCODE(data[index],(value=value,overflow=overflow));
+      // }
+      union
+      {
+        struct
+        {
+#if __BYTE_ORDER == __LITTLE_ENDIAN
+          uint16 value : 12; // 0..11
+          uint16 channel : 3; // 12..14
+          uint16 overflow : 1; // 15
+#endif
+#if __BYTE_ORDER == __BIG_ENDIAN
+          uint16 overflow : 1; // 15
+          uint16 channel : 3; // 12..14
+          uint16 value : 12; // 0..11
+#endif
+        };
+        uint16  u16;
+      } ch_data;
+      READ_FROM_BUFFER_FULL(44,uint16 ,ch_data,ch_data.u16,6);
+      CHECK_BITS_EQUAL(40,ch_data.channel,index);
+      {
+        typedef __typeof__(*(&(data))) __array_t;
+        typedef typename __array_t::item_t __item_t;
+        __item_t &__item = data.insert_index(43,index);
+        __item.value = ch_data.value;
+        __item.overflow = ch_data.overflow;
+      }
+    }
+
+    else
+    {
+      // UINT16 ch_data NOENCODE
+      // {
+        //  0_11: value;
+        //    15: overflow;
+        // ENCODE(data[index],(value=value,overflow=overflow));
+      // }
+      union
+      {
+        struct
+        {
+#if __BYTE_ORDER == __LITTLE_ENDIAN
+          uint16 value : 12; // 0..11
+          uint16 dummy_12_14 : 3;
+          uint16 overflow : 1; // 15
+#endif
+#if __BYTE_ORDER == __BIG_ENDIAN
+          uint16 overflow : 1; // 15
+          uint16 dummy_12_14 : 3;
+          uint16 value : 12; // 0..11
+#endif
+        };
+        uint16  u16;
+      } ch_data;
+      READ_FROM_BUFFER_FULL(52,uint16 ,ch_data,ch_data.u16,7);
+      CHECK_UNNAMED_BITS_ZERO(52,ch_data.u16,0x7000);
+      {
+        typedef __typeof__(*(&(data))) __array_t;
+        typedef typename __array_t::item_t __item_t;
+        __item_t &__item = data.insert_index(51,index);
+        __item.value = ch_data.value;
+        __item.overflow = ch_data.overflow;
+      }
+    }
+  }
+}
+FORCE_IMPL_DATA_SRC_FCN_ARG(void,CAMAC_SILENA_4418::__unpack,uint32 channels
+                                                            ,uint32 mark_channel_no);
+
+/** END_UNPACKER ******************************************************/
+/** BEGIN_UNPACKER *****************************************************
+ *
+ * Event unpacker for FASTBUS_LECROY_1875.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// FASTBUS_LECROY_1875(geom,channels)
+template<typename __data_src_t>
+void FASTBUS_LECROY_1875::__unpack(__data_src_t &__buffer,uint32 geom,uint32 channels)
+{
+  // MEMBER(DATA12_RANGE data[64] ZERO_SUPPRESS);
+  // UINT32 ch_data NOENCODE
+  // {
+    //  0_11: value;
+    // 16_21: channel = RANGE(0,(channels - 1));
+    //    23: range;
+    // 24_26: n = CHECK(0);
+    // 27_31: geom = MATCH(geom);
+    // ENCODE(data[channel],(value=value,range=range));
+  // }
+  union
+  {
+    struct
+    {
+#if __BYTE_ORDER == __LITTLE_ENDIAN
+      uint32 value : 12; // 0..11
+      uint32 dummy_12_15 : 4;
+      uint32 channel : 6; // 16..21
+      uint32 dummy_22 : 1;
+      uint32 range : 1; // 23
+      uint32 n : 3; // 24..26
+      uint32 geom : 5; // 27..31
+#endif
+#if __BYTE_ORDER == __BIG_ENDIAN
+      uint32 geom : 5; // 27..31
+      uint32 n : 3; // 24..26
+      uint32 range : 1; // 23
+      uint32 dummy_22 : 1;
+      uint32 channel : 6; // 16..21
+      uint32 dummy_12_15 : 4;
+      uint32 value : 12; // 0..11
+#endif
+    };
+    uint32  u32;
+  } ch_data;
+  READ_FROM_BUFFER_FULL(102,uint32 ,ch_data,ch_data.u32,10);
+  CHECK_BITS_RANGE_MAX(95,ch_data.channel,(channels - 1));
+  CHECK_BITS_EQUAL(98,ch_data.n,0);
+  CHECK_BITS_EQUAL(99,ch_data.geom,geom);
+  CHECK_UNNAMED_BITS_ZERO(102,ch_data.u32,0x0040f000);
+  {
+    typedef __typeof__(*(&(data))) __array_t;
+    typedef typename __array_t::item_t __item_t;
+    __item_t &__item = data.insert_index(101,ch_data.channel);
+    __item.value = ch_data.value;
+    __item.range = ch_data.range;
+  }
+}
+FORCE_IMPL_DATA_SRC_FCN_ARG(void,FASTBUS_LECROY_1875::__unpack,uint32 geom
+                                                              ,uint32 channels);
+
+/** END_UNPACKER ******************************************************/
+/** BEGIN_UNPACKER *****************************************************
+ *
+ * Event unpacker for FASTBUS_LECROY_1885.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// FASTBUS_LECROY_1885(geom,channels)
+template<typename __data_src_t>
+void FASTBUS_LECROY_1885::__unpack(__data_src_t &__buffer,uint32 geom,uint32 channels)
+{
+  // MEMBER(DATA12_RANGE data[96] ZERO_SUPPRESS);
+  // UINT32 ch_data NOENCODE
+  // {
+    //  0_11: value;
+    // 16_22: channel = RANGE(0,(channels - 1));
+    //    23: range;
+    // 24_26: n = CHECK(0);
+    // 27_31: geom = MATCH(geom);
+    // ENCODE(data[channel],(value=value,range=range));
+  // }
+  union
+  {
+    struct
+    {
+#if __BYTE_ORDER == __LITTLE_ENDIAN
+      uint32 value : 12; // 0..11
+      uint32 dummy_12_15 : 4;
+      uint32 channel : 7; // 16..22
+      uint32 range : 1; // 23
+      uint32 n : 3; // 24..26
+      uint32 geom : 5; // 27..31
+#endif
+#if __BYTE_ORDER == __BIG_ENDIAN
+      uint32 geom : 5; // 27..31
+      uint32 n : 3; // 24..26
+      uint32 range : 1; // 23
+      uint32 channel : 7; // 16..22
+      uint32 dummy_12_15 : 4;
+      uint32 value : 12; // 0..11
+#endif
+    };
+    uint32  u32;
+  } ch_data;
+  READ_FROM_BUFFER_FULL(119,uint32 ,ch_data,ch_data.u32,12);
+  CHECK_BITS_RANGE_MAX(113,ch_data.channel,(channels - 1));
+  CHECK_BITS_EQUAL(115,ch_data.n,0);
+  CHECK_BITS_EQUAL(116,ch_data.geom,geom);
+  CHECK_UNNAMED_BITS_ZERO(119,ch_data.u32,0x0000f000);
+  {
+    typedef __typeof__(*(&(data))) __array_t;
+    typedef typename __array_t::item_t __item_t;
+    __item_t &__item = data.insert_index(118,ch_data.channel);
+    __item.value = ch_data.value;
+    __item.range = ch_data.range;
+  }
+}
+FORCE_IMPL_DATA_SRC_FCN_ARG(void,FASTBUS_LECROY_1885::__unpack,uint32 geom
+                                                              ,uint32 channels);
+
+/** END_UNPACKER ******************************************************/
+/** BEGIN_UNPACKER *****************************************************
+ *
+ * Event unpacker for ITEM64.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// ITEM64(num)
+template<typename __data_src_t>
+void ITEM64::__unpack(__data_src_t &__buffer,uint32 num)
+{
+  // MEMBER(DATA64 member64);
+  // UINT64 a
+  // {
+    //  0_01: 0;
+    //  5_07: num = MATCH(num);
+  // }
+  READ_FROM_BUFFER_FULL(834,uint64 ,a,a.u64,14);
+  CHECK_BITS_EQUAL(833,a.unnamed_0_1,0);
+  CHECK_BITS_EQUAL(832,a.num,num);
+  CHECK_UNNAMED_BITS_ZERO(834,a.u64,0xffffffffffffff1cll);
+  // UINT64 b
+  // {
+    //  0_01: 0;
+    //  3_07: v;
+    // 20_63: 0x00123456;
+    // ENCODE(member64,(value=v));
+  // }
+  READ_FROM_BUFFER_FULL(843,uint64 ,b,b.u64,15);
+  CHECK_BITS_EQUAL(839,b.unnamed_0_1,0);
+  CHECK_BITS_EQUAL(838,b.unnamed_20_63,0x00123456);
+  CHECK_UNNAMED_BITS_ZERO(843,b.u64,0x00000000000fff04ll);
+  {
+    member64.value = b.v;
+  }
+  // UINT32 c
+  // {
+    //  0_01: 0;
+    //  3_07: v;
+    // 20_31: 0x123;
+    // ENCODE(member64,(value=v));
+  // }
+  READ_FROM_BUFFER_FULL(852,uint32 ,c,c.u32,16);
+  CHECK_BITS_EQUAL(848,c.unnamed_0_1,0);
+  CHECK_BITS_EQUAL(847,c.unnamed_20_31,0x123);
+  CHECK_UNNAMED_BITS_ZERO(852,c.u32,0x000fff04);
+  {
+    member64.value = c.v;
+  }
+}
+FORCE_IMPL_DATA_SRC_FCN_ARG(void,ITEM64::__unpack,uint32 num);
+
+/** END_UNPACKER ******************************************************/
+/** BEGIN_UNPACKER *****************************************************
+ *
+ * Event unpacker for ITEMQ.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// ITEMQ(num)
+template<typename __data_src_t>
+void ITEMQ::__unpack(__data_src_t &__buffer,uint32 num)
+{
+  // MEMBER(DATA32 chan);
+  // UINT64 w1
+  // {
+    //    21: c21;
+  // }
+  READ_FROM_BUFFER_FULL(864,uint64 ,w1,w1.u64,18);
+  CHECK_UNNAMED_BITS_ZERO(864,w1.u64,0xffffffffffdfffffll);
+  // UINT64 w2
+  // {
+    //    22: c22;
+  // }
+  READ_FROM_BUFFER_FULL(869,uint64 ,w2,w2.u64,19);
+  CHECK_UNNAMED_BITS_ZERO(869,w2.u64,0xffffffffffbfffffll);
+  // ENCODE(chan,(value=(((w1.c21 << 12) & 0xf00) | w2.c22)));
+
+  {
+    chan.value = (((w1.c21 << 12) & 0xf00) | w2.c22);
+  }
+}
+FORCE_IMPL_DATA_SRC_FCN_ARG(void,ITEMQ::__unpack,uint32 num);
+
+/** END_UNPACKER ******************************************************/
+/** BEGIN_UNPACKER *****************************************************
+ *
+ * Event unpacker for ITEM_ME2.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// ITEM_ME2(geom)
+template<typename __data_src_t>
+void ITEM_ME2::__unpack(__data_src_t &__buffer,uint32 geom)
+{
+  // MEMBER(DATA16 data[32] ZERO_SUPPRESS);
+  // optional UINT32 padding NOENCODE
+  // {
+    //  0_31: value = MATCH(0x32323232);
+  // }
+  union
+  {
+    struct
+    {
+#if __BYTE_ORDER == __LITTLE_ENDIAN
+      uint32 value : 32; // 0..31
+#endif
+#if __BYTE_ORDER == __BIG_ENDIAN
+      uint32 value : 32; // 0..31
+#endif
+    };
+    uint32  u32;
+  } padding;
+  if (__buffer.empty()) goto data_done_0;
+  PEEK_FROM_BUFFER_FULL(906,uint32 ,padding,padding.u32,21);
+  CHECK_JUMP_BITS_EQUAL(905,padding.value,0x32323232,data_done_0);
+  __buffer.advance(sizeof(padding.u32));
+  data_done_0:;
+  // UINT32 header NOENCODE
+  // {
+    // 16_23: geom = MATCH(geom);
+  // }
+  union
+  {
+    struct
+    {
+#if __BYTE_ORDER == __LITTLE_ENDIAN
+      uint32 dummy_0_15 : 16;
+      uint32 geom : 8; // 16..23
+      uint32 dummy_24_31 : 8;
+#endif
+#if __BYTE_ORDER == __BIG_ENDIAN
+      uint32 dummy_24_31 : 8;
+      uint32 geom : 8; // 16..23
+      uint32 dummy_0_15 : 16;
+#endif
+    };
+    uint32  u32;
+  } header;
+  READ_FROM_BUFFER_FULL(910,uint32 ,header,header.u32,22);
+  CHECK_BITS_EQUAL(909,header.geom,geom);
+  CHECK_UNNAMED_BITS_ZERO(910,header.u32,0xff00ffff);
+  // MATCH_END;
+  // UINT32 data NOENCODE
+  // {
+    // 16_23: geom = MATCH(geom);
+  // }
+  union
+  {
+    struct
+    {
+#if __BYTE_ORDER == __LITTLE_ENDIAN
+      uint32 dummy_0_15 : 16;
+      uint32 geom : 8; // 16..23
+      uint32 dummy_24_31 : 8;
+#endif
+#if __BYTE_ORDER == __BIG_ENDIAN
+      uint32 dummy_24_31 : 8;
+      uint32 geom : 8; // 16..23
+      uint32 dummy_0_15 : 16;
+#endif
+    };
+    uint32  u32;
+  } data;
+  READ_FROM_BUFFER_FULL(916,uint32 ,data,data.u32,23);
+  CHECK_BITS_EQUAL(915,data.geom,geom);
+  CHECK_UNNAMED_BITS_ZERO(916,data.u32,0xff00ffff);
+}
+FORCE_IMPL_DATA_SRC_FCN_ARG(void,ITEM_ME2::__unpack,uint32 geom);
+
+/** END_UNPACKER ******************************************************/
+/** BEGIN_UNPACKER *****************************************************
+ *
+ * Event unpacker for MADC32.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// MADC32(res,geo,channels)
+template<typename __data_src_t>
+void MADC32::__unpack(__data_src_t &__buffer,uint32 res,uint32 geo,uint32 channels)
+{
+  // UINT32 header
+  // {
+    //  0_11: word_counts;
+    // 12_14: resolution = MATCH(res);
+    //    15: unused1;
+    // 16_23: id = MATCH(geo);
+    // 24_29: 0;
+    // 30_31: 1;
+  // }
+  READ_FROM_BUFFER_FULL(1203,uint32 ,header,header.u32,26);
+  CHECK_BITS_EQUAL(1198,header.resolution,res);
+  CHECK_BITS_EQUAL(1200,header.id,geo);
+  CHECK_BITS_EQUAL(1201,header.unnamed_24_29,0);
+  CHECK_BITS_EQUAL(1202,header.unnamed_30_31,1);
+  // if((header.resolution == 0))
+
+  // else
+
+  if ((header.resolution == 0))
+  {
+    // UINT32 madc32_data0
+    // {
+      //  0_10: adc_value;
+      // 11_13: 0;
+      //    14: unused;
+      //    15: 0;
+      // 16_20: channel = RANGE(0,channels);
+      // 21_29: 32;
+      // 30_31: 0;
+    // }
+    READ_FROM_BUFFER_FULL(1215,uint32 ,madc32_data0,madc32_data0.u32,27);
+    CHECK_BITS_EQUAL(1209,madc32_data0.unnamed_11_13,0);
+    CHECK_BITS_EQUAL(1211,madc32_data0.unnamed_15_15,0);
+    CHECK_BITS_RANGE_MAX(1212,madc32_data0.channel,channels);
+    CHECK_BITS_EQUAL(1213,madc32_data0.unnamed_21_29,32);
+    CHECK_BITS_EQUAL(1214,madc32_data0.unnamed_30_31,0);
+  }
+
+  else
+  {
+    // if(((header.resolution == 1) || (header.resolution == 2)))
+
+    // else
+
+    if (((header.resolution == 1) || (header.resolution == 2)))
+    {
+      // UINT32 madc32_data1
+      // {
+        //  0_11: adc_value;
+        // 12_13: 0;
+        //    14: unused;
+        //    15: 0;
+        // 16_20: channel = RANGE(0,channels);
+        // 21_29: 32;
+        // 30_31: 0;
+      // }
+      READ_FROM_BUFFER_FULL(1227,uint32 ,madc32_data1,madc32_data1.u32,28);
+      CHECK_BITS_EQUAL(1221,madc32_data1.unnamed_12_13,0);
+      CHECK_BITS_EQUAL(1223,madc32_data1.unnamed_15_15,0);
+      CHECK_BITS_RANGE_MAX(1224,madc32_data1.channel,channels);
+      CHECK_BITS_EQUAL(1225,madc32_data1.unnamed_21_29,32);
+      CHECK_BITS_EQUAL(1226,madc32_data1.unnamed_30_31,0);
+    }
+
+    else
+    {
+      // if(((header.resolution == 3) || (header.resolution == 4)))
+
+      if (((header.resolution == 3) || (header.resolution == 4)))
+      {
+        // UINT32 madc32_data3
+        // {
+          //  0_12: adc_value;
+          //    13: 0;
+          //    14: unused;
+          //    15: 0;
+          // 16_20: channel = RANGE(0,channels);
+          // 21_29: 32;
+          // 30_31: 0;
+        // }
+        READ_FROM_BUFFER_FULL(1239,uint32 ,madc32_data3,madc32_data3.u32,29);
+        CHECK_BITS_EQUAL(1233,madc32_data3.unnamed_13_13,0);
+        CHECK_BITS_EQUAL(1235,madc32_data3.unnamed_15_15,0);
+        CHECK_BITS_RANGE_MAX(1236,madc32_data3.channel,channels);
+        CHECK_BITS_EQUAL(1237,madc32_data3.unnamed_21_29,32);
+        CHECK_BITS_EQUAL(1238,madc32_data3.unnamed_30_31,0);
+      }
+    }
+  }
+  // UINT32 trailer
+  // {
+    //  0_29: evt_counter;
+    // 30_31: 3;
+  // }
+  READ_FROM_BUFFER_FULL(1245,uint32 ,trailer,trailer.u32,30);
+  CHECK_BITS_EQUAL(1244,trailer.unnamed_30_31,3);
+}
+FORCE_IMPL_DATA_SRC_FCN_ARG(void,MADC32::__unpack,uint32 res,uint32 geo,uint32 channels);
+
+/** END_UNPACKER ******************************************************/
+/** BEGIN_UNPACKER *****************************************************
+ *
+ * Event unpacker for SINGLE_DATA_MODULE.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// SINGLE_DATA_MODULE()
+template<typename __data_src_t>
+void SINGLE_DATA_MODULE::__unpack(__data_src_t &__buffer)
+{
+  // UINT32 data;
+  READ_FROM_BUFFER(760,uint32 ,data,32);
+}
+FORCE_IMPL_DATA_SRC_FCN(void,SINGLE_DATA_MODULE::__unpack);
+
+/** END_UNPACKER ******************************************************/
+/** BEGIN_UNPACKER *****************************************************
+ *
+ * Event unpacker for STICKY_ACTIVE.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// STICKY_ACTIVE()
+template<typename __data_src_t>
+void STICKY_ACTIVE::__unpack(__data_src_t &__buffer)
+{
+  // UINT32 separator
+  // {
+    //  0_31: 7;
+  // }
+  READ_FROM_BUFFER_FULL(943,uint32 ,separator,separator.u32,34);
+  CHECK_BITS_EQUAL(942,separator.unnamed_0_31,7);
+  // UINT32 active;
+  READ_FROM_BUFFER(945,uint32 ,active,35);
+  // UINT32 mark;
+  READ_FROM_BUFFER(946,uint32 ,mark,36);
+  // UINT32 corr;
+  READ_FROM_BUFFER(948,uint32 ,corr,37);
+}
+FORCE_IMPL_DATA_SRC_FCN(void,STICKY_ACTIVE::__unpack);
+
+/** END_UNPACKER ******************************************************/
+/** BEGIN_UNPACKER *****************************************************
+ *
+ * Event unpacker for VME_CAEN_V1190_SUBTDC.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// VME_CAEN_V1190_SUBTDC(tdc,event_id,data)
+template<typename __data_src_t>
+void VME_CAEN_V1190_SUBTDC::__unpack(__data_src_t &__buffer,uint32 tdc,uint32 event_id
+                                                           ,raw_array_multi_zero_suppress<DATA24,DATA24,32,128> &data)
+{
+  // MEMBER(DATA24 data[32] ZERO_SUPPRESS_MULTI(128));
+  // MARK_COUNT(tdc_start);
+  void *__mark_tdc_start = __buffer._data;
+  // UINT32 header
+  // {
+    //  0_11: bunch_id;
+    // 12_23: event_id = CHECK(event_id);
+    // 24_25: tdc = MATCH(tdc);
+    // 27_31: 1;
+  // }
+  READ_FROM_BUFFER_FULL(423,uint32 ,header,header.u32,39);
+  CHECK_BITS_EQUAL(419,header.event_id,event_id);
+  CHECK_BITS_EQUAL(421,header.tdc,tdc);
+  CHECK_BITS_EQUAL(422,header.unnamed_27_31,1);
+  CHECK_UNNAMED_BITS_ZERO(423,header.u32,0x04000000);
+  // several UINT32 ch_data NOENCODE
+  // {
+    //  0_18: value;
+    // 19_23: channel_low;
+    // 24_25: tdc = CHECK(tdc);
+    //    26: trailing;
+    // 27_31: 0;
+    // ENCODE(data[((tdc << 5) | channel_low)],(value=value));
+  // }
+  for ( ; ; ) {
+  union
+  {
+    struct
+    {
+#if __BYTE_ORDER == __LITTLE_ENDIAN
+      uint32 value : 19; // 0..18
+      uint32 channel_low : 5; // 19..23
+      uint32 tdc : 2; // 24..25
+      uint32 trailing : 1; // 26
+      uint32 unnamed_27_31 : 5; // 27..31
+#endif
+#if __BYTE_ORDER == __BIG_ENDIAN
+      uint32 unnamed_27_31 : 5; // 27..31
+      uint32 trailing : 1; // 26
+      uint32 tdc : 2; // 24..25
+      uint32 channel_low : 5; // 19..23
+      uint32 value : 19; // 0..18
+#endif
+    };
+    uint32  u32;
+  } ch_data;
+  if (__buffer.empty()) goto data_done_2;
+  PEEK_FROM_BUFFER_FULL(450,uint32 ,ch_data,ch_data.u32,40);
+  CHECK_JUMP_BITS_EQUAL(435,ch_data.tdc,tdc,data_done_2);
+  CHECK_JUMP_BITS_EQUAL(440,ch_data.unnamed_27_31,0,data_done_2);
+  __buffer.advance(sizeof(ch_data.u32));
+  {
+    typedef __typeof__(*(&(data))) __array_t;
+    typedef typename __array_t::item_t __item_t;
+    __item_t &__item = data.insert_index(448,((ch_data.tdc << 5) | ch_data.channel_low));
+    __item.value = ch_data.value;
+  }
+  }
+  data_done_2:;
+  // optional UINT32 error_flags
+  // {
+    //  0_14: flags;
+    // 24_25: tdc = CHECK(tdc);
+    // 27_31: 4;
+  // }
+  union
+  {
+    struct
+    {
+#if __BYTE_ORDER == __LITTLE_ENDIAN
+      uint32 flags : 15; // 0..14
+      uint32 dummy_15_23 : 9;
+      uint32 tdc : 2; // 24..25
+      uint32 dummy_26 : 1;
+      uint32 unnamed_27_31 : 5; // 27..31
+#endif
+#if __BYTE_ORDER == __BIG_ENDIAN
+      uint32 unnamed_27_31 : 5; // 27..31
+      uint32 dummy_26 : 1;
+      uint32 tdc : 2; // 24..25
+      uint32 dummy_15_23 : 9;
+      uint32 flags : 15; // 0..14
+#endif
+    };
+    uint32  u32;
+  } __error_flags;
+  if (__buffer.empty()) goto data_done_3;
+  PEEK_FROM_BUFFER_FULL(458,uint32 ,error_flags,__error_flags.u32,41);
+  CHECK_JUMP_BITS_EQUAL(456,__error_flags.tdc,tdc,data_done_3);
+  CHECK_JUMP_BITS_EQUAL(457,__error_flags.unnamed_27_31,4,data_done_3);
+  CHECK_JUMP_UNNAMED_BITS_ZERO(458,__error_flags.u32,0x04ff8000,data_done_3);
+  error_flags.u32 = __error_flags.u32;
+  __buffer.advance(sizeof(__error_flags.u32));
+  data_done_3:;
+  // MARK_COUNT(tdc_end);
+  void *__mark_tdc_end = __buffer._data;
+  // UINT32 trailer
+  // {
+    //  0_11: word_count = CHECK_COUNT(tdc_start,tdc_end,4,4);
+    // 12_23: event_id = CHECK(header.event_id);
+    // 24_25: tdc = CHECK(tdc);
+    // 27_31: 3;
+  // }
+  READ_FROM_BUFFER_FULL(469,uint32 ,trailer,trailer.u32,42);
+  CHECK_WORD_COUNT(464,trailer.word_count,tdc_start,tdc_end,4,4);
+  CHECK_BITS_EQUAL(465,trailer.event_id,header.event_id);
+  CHECK_BITS_EQUAL(467,trailer.tdc,tdc);
+  CHECK_BITS_EQUAL(468,trailer.unnamed_27_31,3);
+  CHECK_UNNAMED_BITS_ZERO(469,trailer.u32,0x04000000);
+}
+FORCE_IMPL_DATA_SRC_FCN_ARG(void,VME_CAEN_V1190_SUBTDC::__unpack,uint32 tdc
+                                                                ,uint32 event_id
+                                                                ,raw_array_multi_zero_suppress<DATA24,DATA24,32,128> &data);
+
+/** END_UNPACKER ******************************************************/
+/** BEGIN_UNPACKER *****************************************************
+ *
+ * Event unpacker for VME_CAEN_V1190.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// VME_CAEN_V1190(geom)
+template<typename __data_src_t>
+void VME_CAEN_V1190::__unpack(__data_src_t &__buffer,uint32 geom)
+{
+  // MEMBER(DATA24 data[32] ZERO_SUPPRESS_MULTI(128));
+  // MARK_COUNT(v1190_start);
+  void *__mark_v1190_start = __buffer._data;
+  // UINT32 header
+  // {
+    //  0_04: geom = MATCH(geom);
+    //  5_26: event_number;
+    // 27_31: 8;
+  // }
+  READ_FROM_BUFFER_FULL(484,uint32 ,header,header.u32,44);
+  CHECK_BITS_EQUAL(481,header.geom,geom);
+  CHECK_BITS_EQUAL(483,header.unnamed_27_31,8);
+  // select several
+
+    // tdc[0] = VME_CAEN_V1190_SUBTDC(tdc=0,event_id=(header.event_number & 0xfff),
+                                   // data=data);
+    // tdc[1] = VME_CAEN_V1190_SUBTDC(tdc=1,event_id=(header.event_number & 0xfff),
+                                   // data=data);
+    // tdc[2] = VME_CAEN_V1190_SUBTDC(tdc=2,event_id=(header.event_number & 0xfff),
+                                   // data=data);
+    // tdc[3] = VME_CAEN_V1190_SUBTDC(tdc=3,event_id=(header.event_number & 0xfff),
+                                   // data=data);
+  for ( ; ; )
+  {
+    if (__buffer.empty()) break;
+    int __match_no = 0;
+    // optimized match 1: VME_CAEN_V1190_SUBTDC tdc[0]: (s32) => (0xff000000,0x08000000)
+    // optimized match 2: VME_CAEN_V1190_SUBTDC tdc[1]: (s32) => (0xff000000,0x09000000)
+    // optimized match 3: VME_CAEN_V1190_SUBTDC tdc[2]: (s32) => (0xff000000,0x0a000000)
+    // optimized match 4: VME_CAEN_V1190_SUBTDC tdc[3]: (s32) => (0xff000000,0x0b000000)
+    {
+    uint32 __match_peek;
+    PEEK_FROM_BUFFER(492,uint32,__match_peek);
+    // differ = 03000000 : 24 25
+    uint32 __match_index = 0 | /* 24,25 */ ((__match_peek >> 24) & 0x00000003);
+    static const sint8 __match_index_array[4] = { 1, 2, 3, 4, };
+    __match_no = __match_index_array[__match_index];
+    // last_subevent_item = 0
+    }
+    if (!__match_no) break;
+    switch (__match_no)
+    {
+      case 1:
+        CHECK_SPURIOUS_MATCH_DECL(488,spurious_match_abort_loop_0,VME_CAEN_V1190_SUBTDC,/*tdc*/0,/*event_id*/(header.event_number & 0xfff)/*,data:member*/);
+        MATCH_PROFILE_COUNT(488,tdc[0]);
+        UNPACK_DECL(488,VME_CAEN_V1190_SUBTDC,tdc[0],/*tdc*/0,/*event_id*/(header.event_number & 0xfff),/*data*/data);
+        break;
+      case 2:
+        CHECK_SPURIOUS_MATCH_DECL(489,spurious_match_abort_loop_0,VME_CAEN_V1190_SUBTDC,/*tdc*/1,/*event_id*/(header.event_number & 0xfff)/*,data:member*/);
+        MATCH_PROFILE_COUNT(489,tdc[1]);
+        UNPACK_DECL(489,VME_CAEN_V1190_SUBTDC,tdc[1],/*tdc*/1,/*event_id*/(header.event_number & 0xfff),/*data*/data);
+        break;
+      case 3:
+        CHECK_SPURIOUS_MATCH_DECL(490,spurious_match_abort_loop_0,VME_CAEN_V1190_SUBTDC,/*tdc*/2,/*event_id*/(header.event_number & 0xfff)/*,data:member*/);
+        MATCH_PROFILE_COUNT(490,tdc[2]);
+        UNPACK_DECL(490,VME_CAEN_V1190_SUBTDC,tdc[2],/*tdc*/2,/*event_id*/(header.event_number & 0xfff),/*data*/data);
+        break;
+      case 4:
+        CHECK_SPURIOUS_MATCH_DECL(491,spurious_match_abort_loop_0,VME_CAEN_V1190_SUBTDC,/*tdc*/3,/*event_id*/(header.event_number & 0xfff)/*,data:member*/);
+        MATCH_PROFILE_COUNT(491,tdc[3]);
+        UNPACK_DECL(491,VME_CAEN_V1190_SUBTDC,tdc[3],/*tdc*/3,/*event_id*/(header.event_number & 0xfff),/*data*/data);
+        break;
+    }
+  }
+  spurious_match_abort_loop_0:;
+  // UINT32 trigger
+  // {
+    //  0_26: time_tag;
+    // 27_31: 17;
+  // }
+  READ_FROM_BUFFER_FULL(498,uint32 ,trigger,trigger.u32,45);
+  CHECK_BITS_EQUAL(497,trigger.unnamed_27_31,17);
+  // MARK_COUNT(v1190_end);
+  void *__mark_v1190_end = __buffer._data;
+  // UINT32 trailer
+  // {
+    //  0_04: geom = CHECK(geom);
+    //  5_19: word_count = CHECK_COUNT(v1190_start,v1190_end,4,4);
+    //    24: tdc_error;
+    //    25: buffer_overflow;
+    //    26: trigger_lost;
+    // 27_31: 16;
+  // }
+  READ_FROM_BUFFER_FULL(510,uint32 ,trailer,trailer.u32,46);
+  CHECK_BITS_EQUAL(504,trailer.geom,geom);
+  CHECK_WORD_COUNT(505,trailer.word_count,v1190_start,v1190_end,4,4);
+  CHECK_BITS_EQUAL(509,trailer.unnamed_27_31,16);
+  CHECK_UNNAMED_BITS_ZERO(510,trailer.u32,0x00f00000);
+}
+FORCE_IMPL_DATA_SRC_FCN_ARG(void,VME_CAEN_V1190::__unpack,uint32 geom);
+
+/** END_UNPACKER ******************************************************/
+/** BEGIN_UNPACKER *****************************************************
+ *
+ * Event unpacker for VME_CAEN_V1190_SHORT_SUBTDC.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// VME_CAEN_V1190_SHORT_SUBTDC(tdc,event_id,data)
+template<typename __data_src_t>
+void VME_CAEN_V1190_SHORT_SUBTDC::__unpack(__data_src_t &__buffer,uint32 tdc
+                                                                 ,uint32 event_id
+                                                                 ,raw_array_multi_zero_suppress<DATA24,DATA24,32,128> &data)
+{
+  // MEMBER(DATA24 data[32] ZERO_SUPPRESS_MULTI(128));
+  // UINT32 ch_data NOENCODE
+  // {
+    //  0_18: value;
+    // 19_23: channel_low;
+    // 24_25: tdc = CHECK(tdc);
+    //    26: trailing;
+    // 27_31: 0;
+    // ENCODE(data[((tdc << 5) | channel_low)],(value=value));
+  // }
+  union
+  {
+    struct
+    {
+#if __BYTE_ORDER == __LITTLE_ENDIAN
+      uint32 value : 19; // 0..18
+      uint32 channel_low : 5; // 19..23
+      uint32 tdc : 2; // 24..25
+      uint32 trailing : 1; // 26
+      uint32 unnamed_27_31 : 5; // 27..31
+#endif
+#if __BYTE_ORDER == __BIG_ENDIAN
+      uint32 unnamed_27_31 : 5; // 27..31
+      uint32 trailing : 1; // 26
+      uint32 tdc : 2; // 24..25
+      uint32 channel_low : 5; // 19..23
+      uint32 value : 19; // 0..18
+#endif
+    };
+    uint32  u32;
+  } ch_data;
+  READ_FROM_BUFFER_FULL(547,uint32 ,ch_data,ch_data.u32,48);
+  CHECK_BITS_EQUAL(532,ch_data.tdc,tdc);
+  CHECK_BITS_EQUAL(537,ch_data.unnamed_27_31,0);
+  {
+    typedef __typeof__(*(&(data))) __array_t;
+    typedef typename __array_t::item_t __item_t;
+    __item_t &__item = data.insert_index(545,((ch_data.tdc << 5) | ch_data.channel_low));
+    __item.value = ch_data.value;
+  }
+}
+FORCE_IMPL_DATA_SRC_FCN_ARG(void,VME_CAEN_V1190_SHORT_SUBTDC::__unpack,uint32 tdc
+                                                                      ,uint32 event_id
+                                                                      ,raw_array_multi_zero_suppress<DATA24,DATA24,32,128> &data);
+
+/** END_UNPACKER ******************************************************/
+/** BEGIN_UNPACKER *****************************************************
+ *
+ * Event unpacker for VME_CAEN_V1190_SHORT_SUBTDC_ERROR.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// VME_CAEN_V1190_SHORT_SUBTDC_ERROR(tdc)
+template<typename __data_src_t>
+void VME_CAEN_V1190_SHORT_SUBTDC_ERROR::__unpack(__data_src_t &__buffer,uint32 tdc)
+{
+  // UINT32 error_flags
+  // {
+    //  0_14: flags;
+    // 24_25: tdc = CHECK(tdc);
+    // 27_31: 4;
+  // }
+  READ_FROM_BUFFER_FULL(558,uint32 ,error_flags,error_flags.u32,50);
+  CHECK_BITS_EQUAL(556,error_flags.tdc,tdc);
+  CHECK_BITS_EQUAL(557,error_flags.unnamed_27_31,4);
+  CHECK_UNNAMED_BITS_ZERO(558,error_flags.u32,0x04ff8000);
+}
+FORCE_IMPL_DATA_SRC_FCN_ARG(void,VME_CAEN_V1190_SHORT_SUBTDC_ERROR::__unpack,uint32 tdc);
+
+/** END_UNPACKER ******************************************************/
+/** BEGIN_UNPACKER *****************************************************
+ *
+ * Event unpacker for VME_CAEN_V1190_SHORT.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// VME_CAEN_V1190_SHORT(geom)
+template<typename __data_src_t>
+void VME_CAEN_V1190_SHORT::__unpack(__data_src_t &__buffer,uint32 geom)
+{
+  // MEMBER(DATA24 data[32] ZERO_SUPPRESS_MULTI(128));
+  // MARK_COUNT(v1190_start);
+  void *__mark_v1190_start = __buffer._data;
+  // UINT32 header
+  // {
+    //  0_04: geom = MATCH(geom);
+    //  5_26: event_number;
+    // 27_31: 8;
+  // }
+  READ_FROM_BUFFER_FULL(573,uint32 ,header,header.u32,52);
+  CHECK_BITS_EQUAL(570,header.geom,geom);
+  CHECK_BITS_EQUAL(572,header.unnamed_27_31,8);
+  // select several
+
+    // tdc[0] = VME_CAEN_V1190_SHORT_SUBTDC(tdc=0,event_id=(header.event_number & 0xfff),
+                                         // data=data);
+    // tdc[1] = VME_CAEN_V1190_SHORT_SUBTDC(tdc=1,event_id=(header.event_number & 0xfff),
+                                         // data=data);
+    // tdc[2] = VME_CAEN_V1190_SHORT_SUBTDC(tdc=2,event_id=(header.event_number & 0xfff),
+                                         // data=data);
+    // tdc[3] = VME_CAEN_V1190_SHORT_SUBTDC(tdc=3,event_id=(header.event_number & 0xfff),
+                                         // data=data);
+    // norevisit err[0] = VME_CAEN_V1190_SHORT_SUBTDC_ERROR(tdc=0);
+    // norevisit err[1] = VME_CAEN_V1190_SHORT_SUBTDC_ERROR(tdc=1);
+    // norevisit err[2] = VME_CAEN_V1190_SHORT_SUBTDC_ERROR(tdc=2);
+    // norevisit err[3] = VME_CAEN_V1190_SHORT_SUBTDC_ERROR(tdc=3);
+  bitsone<4> __visited1;
+  __visited1.clear();
+  for ( ; ; )
+  {
+    if (__buffer.empty()) break;
+    int __match_no = 0;
+    // optimized match 1: VME_CAEN_V1190_SHORT_SUBTDC tdc[0]: (s32) => (0xfb000000,0x00000000)
+    // optimized match 2: VME_CAEN_V1190_SHORT_SUBTDC tdc[1]: (s32) => (0xfb000000,0x01000000)
+    // optimized match 3: VME_CAEN_V1190_SHORT_SUBTDC tdc[2]: (s32) => (0xfb000000,0x02000000)
+    // optimized match 4: VME_CAEN_V1190_SHORT_SUBTDC tdc[3]: (s32) => (0xfb000000,0x03000000)
+    // optimized match 5: VME_CAEN_V1190_SHORT_SUBTDC_ERROR err[0]: (s32) => (0xffff8000,0x20000000)
+    // optimized match 6: VME_CAEN_V1190_SHORT_SUBTDC_ERROR err[1]: (s32) => (0xffff8000,0x21000000)
+    // optimized match 7: VME_CAEN_V1190_SHORT_SUBTDC_ERROR err[2]: (s32) => (0xffff8000,0x22000000)
+    // optimized match 8: VME_CAEN_V1190_SHORT_SUBTDC_ERROR err[3]: (s32) => (0xffff8000,0x23000000)
+    {
+    uint32 __match_peek;
+    PEEK_FROM_BUFFER(586,uint32,__match_peek);
+    // differ = 23000000 : 24 25 29
+    uint32 __match_index = 0 | /* 24,25 */ ((__match_peek >> 24) & 0x00000003) | /* 29,29 */ ((__match_peek >> 27) & 0x00000004);
+    static const sint8 __match_index_array[8] = { 1, 2, 3, 4, 5, 6, 7, 8, };
+    __match_no = __match_index_array[__match_index];
+    // last_subevent_item = 0
+    }
+    if (!__match_no) break;
+    switch (__match_no)
+    {
+      case 1:
+        CHECK_SPURIOUS_MATCH_DECL(577,spurious_match_abort_loop_1,VME_CAEN_V1190_SHORT_SUBTDC,/*tdc*/0,/*event_id*/(header.event_number & 0xfff)/*,data:member*/);
+        MATCH_PROFILE_COUNT(577,tdc[0]);
+        UNPACK_DECL(577,VME_CAEN_V1190_SHORT_SUBTDC,tdc[0],/*tdc*/0,/*event_id*/(header.event_number & 0xfff),/*data*/data);
+        break;
+      case 2:
+        CHECK_SPURIOUS_MATCH_DECL(578,spurious_match_abort_loop_1,VME_CAEN_V1190_SHORT_SUBTDC,/*tdc*/1,/*event_id*/(header.event_number & 0xfff)/*,data:member*/);
+        MATCH_PROFILE_COUNT(578,tdc[1]);
+        UNPACK_DECL(578,VME_CAEN_V1190_SHORT_SUBTDC,tdc[1],/*tdc*/1,/*event_id*/(header.event_number & 0xfff),/*data*/data);
+        break;
+      case 3:
+        CHECK_SPURIOUS_MATCH_DECL(579,spurious_match_abort_loop_1,VME_CAEN_V1190_SHORT_SUBTDC,/*tdc*/2,/*event_id*/(header.event_number & 0xfff)/*,data:member*/);
+        MATCH_PROFILE_COUNT(579,tdc[2]);
+        UNPACK_DECL(579,VME_CAEN_V1190_SHORT_SUBTDC,tdc[2],/*tdc*/2,/*event_id*/(header.event_number & 0xfff),/*data*/data);
+        break;
+      case 4:
+        CHECK_SPURIOUS_MATCH_DECL(580,spurious_match_abort_loop_1,VME_CAEN_V1190_SHORT_SUBTDC,/*tdc*/3,/*event_id*/(header.event_number & 0xfff)/*,data:member*/);
+        MATCH_PROFILE_COUNT(580,tdc[3]);
+        UNPACK_DECL(580,VME_CAEN_V1190_SHORT_SUBTDC,tdc[3],/*tdc*/3,/*event_id*/(header.event_number & 0xfff),/*data*/data);
+        break;
+      case 5:
+        CHECK_SPURIOUS_MATCH_DECL(582,spurious_match_abort_loop_1,VME_CAEN_V1190_SHORT_SUBTDC_ERROR,/*tdc*/0);
+        UNPACK_CHECK_NO_REVISIT(582,VME_CAEN_V1190_SHORT_SUBTDC_ERROR,err[0],__visited1,0);
+        MATCH_PROFILE_COUNT(582,err[0]);
+        UNPACK_DECL(582,VME_CAEN_V1190_SHORT_SUBTDC_ERROR,err[0],/*tdc*/0);
+        break;
+      case 6:
+        CHECK_SPURIOUS_MATCH_DECL(583,spurious_match_abort_loop_1,VME_CAEN_V1190_SHORT_SUBTDC_ERROR,/*tdc*/1);
+        UNPACK_CHECK_NO_REVISIT(583,VME_CAEN_V1190_SHORT_SUBTDC_ERROR,err[1],__visited1,1);
+        MATCH_PROFILE_COUNT(583,err[1]);
+        UNPACK_DECL(583,VME_CAEN_V1190_SHORT_SUBTDC_ERROR,err[1],/*tdc*/1);
+        break;
+      case 7:
+        CHECK_SPURIOUS_MATCH_DECL(584,spurious_match_abort_loop_1,VME_CAEN_V1190_SHORT_SUBTDC_ERROR,/*tdc*/2);
+        UNPACK_CHECK_NO_REVISIT(584,VME_CAEN_V1190_SHORT_SUBTDC_ERROR,err[2],__visited1,2);
+        MATCH_PROFILE_COUNT(584,err[2]);
+        UNPACK_DECL(584,VME_CAEN_V1190_SHORT_SUBTDC_ERROR,err[2],/*tdc*/2);
+        break;
+      case 8:
+        CHECK_SPURIOUS_MATCH_DECL(585,spurious_match_abort_loop_1,VME_CAEN_V1190_SHORT_SUBTDC_ERROR,/*tdc*/3);
+        UNPACK_CHECK_NO_REVISIT(585,VME_CAEN_V1190_SHORT_SUBTDC_ERROR,err[3],__visited1,3);
+        MATCH_PROFILE_COUNT(585,err[3]);
+        UNPACK_DECL(585,VME_CAEN_V1190_SHORT_SUBTDC_ERROR,err[3],/*tdc*/3);
+        break;
+    }
+  }
+  spurious_match_abort_loop_1:;
+  // UINT32 trigger
+  // {
+    //  0_26: time_tag;
+    // 27_31: 17;
+  // }
+  READ_FROM_BUFFER_FULL(592,uint32 ,trigger,trigger.u32,53);
+  CHECK_BITS_EQUAL(591,trigger.unnamed_27_31,17);
+  // MARK_COUNT(v1190_end);
+  void *__mark_v1190_end = __buffer._data;
+  // UINT32 trailer
+  // {
+    //  0_04: geom = CHECK(geom);
+    //  5_19: word_count = CHECK_COUNT(v1190_start,v1190_end,4,4);
+    //    24: tdc_error;
+    //    25: buffer_overflow;
+    //    26: trigger_lost;
+    // 27_31: 16;
+  // }
+  READ_FROM_BUFFER_FULL(604,uint32 ,trailer,trailer.u32,54);
+  CHECK_BITS_EQUAL(598,trailer.geom,geom);
+  CHECK_WORD_COUNT(599,trailer.word_count,v1190_start,v1190_end,4,4);
+  CHECK_BITS_EQUAL(603,trailer.unnamed_27_31,16);
+  CHECK_UNNAMED_BITS_ZERO(604,trailer.u32,0x00f00000);
+}
+FORCE_IMPL_DATA_SRC_FCN_ARG(void,VME_CAEN_V1190_SHORT::__unpack,uint32 geom);
+
+/** END_UNPACKER ******************************************************/
+/** BEGIN_UNPACKER *****************************************************
+ *
+ * Event unpacker for VME_CAEN_V1290_SUBTDC.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// VME_CAEN_V1290_SUBTDC(tdc,event_id,data)
+template<typename __data_src_t>
+void VME_CAEN_V1290_SUBTDC::__unpack(__data_src_t &__buffer,uint32 tdc,uint32 event_id
+                                                           ,raw_array_multi_zero_suppress<DATA24,DATA24,32,128> &data)
+{
+  // MEMBER(DATA24 data[32] ZERO_SUPPRESS_MULTI(128));
+  // MARK_COUNT(tdc_start);
+  void *__mark_tdc_start = __buffer._data;
+  // UINT32 header
+  // {
+    //  0_11: bunch_id;
+    // 12_23: event_id = CHECK(event_id);
+    // 24_25: tdc = MATCH(tdc);
+    // 27_31: 1;
+  // }
+  READ_FROM_BUFFER_FULL(218,uint32 ,header,header.u32,56);
+  CHECK_BITS_EQUAL(214,header.event_id,event_id);
+  CHECK_BITS_EQUAL(216,header.tdc,tdc);
+  CHECK_BITS_EQUAL(217,header.unnamed_27_31,1);
+  CHECK_UNNAMED_BITS_ZERO(218,header.u32,0x04000000);
+  // several UINT32 ch_data NOENCODE
+  // {
+    //  0_20: value;
+    // 21_23: channel_low;
+    // 24_25: tdc = CHECK(tdc);
+    //    26: trailing;
+    // 27_31: 0;
+    // ENCODE(data[((tdc << 3) | channel_low)],(value=value));
+  // }
+  for ( ; ; ) {
+  union
+  {
+    struct
+    {
+#if __BYTE_ORDER == __LITTLE_ENDIAN
+      uint32 value : 21; // 0..20
+      uint32 channel_low : 3; // 21..23
+      uint32 tdc : 2; // 24..25
+      uint32 trailing : 1; // 26
+      uint32 unnamed_27_31 : 5; // 27..31
+#endif
+#if __BYTE_ORDER == __BIG_ENDIAN
+      uint32 unnamed_27_31 : 5; // 27..31
+      uint32 trailing : 1; // 26
+      uint32 tdc : 2; // 24..25
+      uint32 channel_low : 3; // 21..23
+      uint32 value : 21; // 0..20
+#endif
+    };
+    uint32  u32;
+  } ch_data;
+  if (__buffer.empty()) goto data_done_4;
+  PEEK_FROM_BUFFER_FULL(245,uint32 ,ch_data,ch_data.u32,57);
+  CHECK_JUMP_BITS_EQUAL(225,ch_data.tdc,tdc,data_done_4);
+  CHECK_JUMP_BITS_EQUAL(235,ch_data.unnamed_27_31,0,data_done_4);
+  __buffer.advance(sizeof(ch_data.u32));
+  {
+    typedef __typeof__(*(&(data))) __array_t;
+    typedef typename __array_t::item_t __item_t;
+    __item_t &__item = data.insert_index(239,((ch_data.tdc << 3) | ch_data.channel_low));
+    __item.value = ch_data.value;
+  }
+  }
+  data_done_4:;
+  // optional UINT32 error_flags
+  // {
+    //  0_14: flags;
+    // 24_25: tdc = CHECK(tdc);
+    // 27_31: 4;
+  // }
+  union
+  {
+    struct
+    {
+#if __BYTE_ORDER == __LITTLE_ENDIAN
+      uint32 flags : 15; // 0..14
+      uint32 dummy_15_23 : 9;
+      uint32 tdc : 2; // 24..25
+      uint32 dummy_26 : 1;
+      uint32 unnamed_27_31 : 5; // 27..31
+#endif
+#if __BYTE_ORDER == __BIG_ENDIAN
+      uint32 unnamed_27_31 : 5; // 27..31
+      uint32 dummy_26 : 1;
+      uint32 tdc : 2; // 24..25
+      uint32 dummy_15_23 : 9;
+      uint32 flags : 15; // 0..14
+#endif
+    };
+    uint32  u32;
+  } __error_flags;
+  if (__buffer.empty()) goto data_done_5;
+  PEEK_FROM_BUFFER_FULL(253,uint32 ,error_flags,__error_flags.u32,58);
+  CHECK_JUMP_BITS_EQUAL(251,__error_flags.tdc,tdc,data_done_5);
+  CHECK_JUMP_BITS_EQUAL(252,__error_flags.unnamed_27_31,4,data_done_5);
+  CHECK_JUMP_UNNAMED_BITS_ZERO(253,__error_flags.u32,0x04ff8000,data_done_5);
+  error_flags.u32 = __error_flags.u32;
+  __buffer.advance(sizeof(__error_flags.u32));
+  data_done_5:;
+  // MARK_COUNT(tdc_end);
+  void *__mark_tdc_end = __buffer._data;
+  // UINT32 trailer
+  // {
+    //  0_11: word_count = CHECK_COUNT(tdc_start,tdc_end,4,4);
+    // 12_23: event_id = CHECK(header.event_id);
+    // 24_25: tdc = CHECK(tdc);
+    // 27_31: 3;
+  // }
+  READ_FROM_BUFFER_FULL(264,uint32 ,trailer,trailer.u32,59);
+  CHECK_WORD_COUNT(259,trailer.word_count,tdc_start,tdc_end,4,4);
+  CHECK_BITS_EQUAL(260,trailer.event_id,header.event_id);
+  CHECK_BITS_EQUAL(262,trailer.tdc,tdc);
+  CHECK_BITS_EQUAL(263,trailer.unnamed_27_31,3);
+  CHECK_UNNAMED_BITS_ZERO(264,trailer.u32,0x04000000);
+}
+FORCE_IMPL_DATA_SRC_FCN_ARG(void,VME_CAEN_V1290_SUBTDC::__unpack,uint32 tdc
+                                                                ,uint32 event_id
+                                                                ,raw_array_multi_zero_suppress<DATA24,DATA24,32,128> &data);
+
+/** END_UNPACKER ******************************************************/
+/** BEGIN_UNPACKER *****************************************************
+ *
+ * Event unpacker for VME_CAEN_V1290.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// VME_CAEN_V1290(geom)
+template<typename __data_src_t>
+void VME_CAEN_V1290::__unpack(__data_src_t &__buffer,uint32 geom)
+{
+  // MEMBER(DATA24 data[32] ZERO_SUPPRESS_MULTI(128));
+  // MARK_COUNT(v1190_start);
+  void *__mark_v1190_start = __buffer._data;
+  // UINT32 header
+  // {
+    //  0_04: geom = MATCH(geom);
+    //  5_26: event_number;
+    // 27_31: 8;
+  // }
+  READ_FROM_BUFFER_FULL(279,uint32 ,header,header.u32,61);
+  CHECK_BITS_EQUAL(276,header.geom,geom);
+  CHECK_BITS_EQUAL(278,header.unnamed_27_31,8);
+  // select several
+
+    // tdc[0] = VME_CAEN_V1290_SUBTDC(tdc=0,event_id=(header.event_number & 0xfff),
+                                   // data=data);
+    // tdc[1] = VME_CAEN_V1290_SUBTDC(tdc=1,event_id=(header.event_number & 0xfff),
+                                   // data=data);
+    // tdc[2] = VME_CAEN_V1290_SUBTDC(tdc=2,event_id=(header.event_number & 0xfff),
+                                   // data=data);
+    // tdc[3] = VME_CAEN_V1290_SUBTDC(tdc=3,event_id=(header.event_number & 0xfff),
+                                   // data=data);
+  for ( ; ; )
+  {
+    if (__buffer.empty()) break;
+    int __match_no = 0;
+    // optimized match 1: VME_CAEN_V1290_SUBTDC tdc[0]: (s32) => (0xff000000,0x08000000)
+    // optimized match 2: VME_CAEN_V1290_SUBTDC tdc[1]: (s32) => (0xff000000,0x09000000)
+    // optimized match 3: VME_CAEN_V1290_SUBTDC tdc[2]: (s32) => (0xff000000,0x0a000000)
+    // optimized match 4: VME_CAEN_V1290_SUBTDC tdc[3]: (s32) => (0xff000000,0x0b000000)
+    {
+    uint32 __match_peek;
+    PEEK_FROM_BUFFER(287,uint32,__match_peek);
+    // differ = 03000000 : 24 25
+    uint32 __match_index = 0 | /* 24,25 */ ((__match_peek >> 24) & 0x00000003);
+    static const sint8 __match_index_array[4] = { 1, 2, 3, 4, };
+    __match_no = __match_index_array[__match_index];
+    // last_subevent_item = 0
+    }
+    if (!__match_no) break;
+    switch (__match_no)
+    {
+      case 1:
+        CHECK_SPURIOUS_MATCH_DECL(283,spurious_match_abort_loop_2,VME_CAEN_V1290_SUBTDC,/*tdc*/0,/*event_id*/(header.event_number & 0xfff)/*,data:member*/);
+        MATCH_PROFILE_COUNT(283,tdc[0]);
+        UNPACK_DECL(283,VME_CAEN_V1290_SUBTDC,tdc[0],/*tdc*/0,/*event_id*/(header.event_number & 0xfff),/*data*/data);
+        break;
+      case 2:
+        CHECK_SPURIOUS_MATCH_DECL(284,spurious_match_abort_loop_2,VME_CAEN_V1290_SUBTDC,/*tdc*/1,/*event_id*/(header.event_number & 0xfff)/*,data:member*/);
+        MATCH_PROFILE_COUNT(284,tdc[1]);
+        UNPACK_DECL(284,VME_CAEN_V1290_SUBTDC,tdc[1],/*tdc*/1,/*event_id*/(header.event_number & 0xfff),/*data*/data);
+        break;
+      case 3:
+        CHECK_SPURIOUS_MATCH_DECL(285,spurious_match_abort_loop_2,VME_CAEN_V1290_SUBTDC,/*tdc*/2,/*event_id*/(header.event_number & 0xfff)/*,data:member*/);
+        MATCH_PROFILE_COUNT(285,tdc[2]);
+        UNPACK_DECL(285,VME_CAEN_V1290_SUBTDC,tdc[2],/*tdc*/2,/*event_id*/(header.event_number & 0xfff),/*data*/data);
+        break;
+      case 4:
+        CHECK_SPURIOUS_MATCH_DECL(286,spurious_match_abort_loop_2,VME_CAEN_V1290_SUBTDC,/*tdc*/3,/*event_id*/(header.event_number & 0xfff)/*,data:member*/);
+        MATCH_PROFILE_COUNT(286,tdc[3]);
+        UNPACK_DECL(286,VME_CAEN_V1290_SUBTDC,tdc[3],/*tdc*/3,/*event_id*/(header.event_number & 0xfff),/*data*/data);
+        break;
+    }
+  }
+  spurious_match_abort_loop_2:;
+  // UINT32 trigger
+  // {
+    //  0_26: time_tag;
+    // 27_31: 17;
+  // }
+  READ_FROM_BUFFER_FULL(293,uint32 ,trigger,trigger.u32,62);
+  CHECK_BITS_EQUAL(292,trigger.unnamed_27_31,17);
+  // MARK_COUNT(v1190_end);
+  void *__mark_v1190_end = __buffer._data;
+  // UINT32 trailer
+  // {
+    //  0_04: geom = CHECK(geom);
+    //  5_19: word_count = CHECK_COUNT(v1190_start,v1190_end,4,4);
+    //    24: tdc_error;
+    //    25: buffer_overflow;
+    //    26: trigger_lost;
+    // 27_31: 16;
+  // }
+  READ_FROM_BUFFER_FULL(305,uint32 ,trailer,trailer.u32,63);
+  CHECK_BITS_EQUAL(299,trailer.geom,geom);
+  CHECK_WORD_COUNT(300,trailer.word_count,v1190_start,v1190_end,4,4);
+  CHECK_BITS_EQUAL(304,trailer.unnamed_27_31,16);
+  CHECK_UNNAMED_BITS_ZERO(305,trailer.u32,0x00f00000);
+}
+FORCE_IMPL_DATA_SRC_FCN_ARG(void,VME_CAEN_V1290::__unpack,uint32 geom);
+
+/** END_UNPACKER ******************************************************/
+/** BEGIN_UNPACKER *****************************************************
+ *
+ * Event unpacker for VME_CAEN_V1290_SHORT_SUBTDC.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// VME_CAEN_V1290_SHORT_SUBTDC(tdc,event_id,data)
+template<typename __data_src_t>
+void VME_CAEN_V1290_SHORT_SUBTDC::__unpack(__data_src_t &__buffer,uint32 tdc
+                                                                 ,uint32 event_id
+                                                                 ,raw_array_multi_zero_suppress<DATA24,DATA24,32,128> &data)
+{
+  // MEMBER(DATA24 data[32] ZERO_SUPPRESS_MULTI(128));
+  // UINT32 ch_data NOENCODE
+  // {
+    //  0_20: value;
+    // 21_23: channel_low;
+    // 24_25: tdc = CHECK(tdc);
+    //    26: trailing;
+    // 27_31: 0;
+    // ENCODE(data[((tdc << 3) | channel_low)],(value=value));
+  // }
+  union
+  {
+    struct
+    {
+#if __BYTE_ORDER == __LITTLE_ENDIAN
+      uint32 value : 21; // 0..20
+      uint32 channel_low : 3; // 21..23
+      uint32 tdc : 2; // 24..25
+      uint32 trailing : 1; // 26
+      uint32 unnamed_27_31 : 5; // 27..31
+#endif
+#if __BYTE_ORDER == __BIG_ENDIAN
+      uint32 unnamed_27_31 : 5; // 27..31
+      uint32 trailing : 1; // 26
+      uint32 tdc : 2; // 24..25
+      uint32 channel_low : 3; // 21..23
+      uint32 value : 21; // 0..20
+#endif
+    };
+    uint32  u32;
+  } ch_data;
+  READ_FROM_BUFFER_FULL(342,uint32 ,ch_data,ch_data.u32,65);
+  CHECK_BITS_EQUAL(322,ch_data.tdc,tdc);
+  CHECK_BITS_EQUAL(332,ch_data.unnamed_27_31,0);
+  {
+    typedef __typeof__(*(&(data))) __array_t;
+    typedef typename __array_t::item_t __item_t;
+    __item_t &__item = data.insert_index(336,((ch_data.tdc << 3) | ch_data.channel_low));
+    __item.value = ch_data.value;
+  }
+}
+FORCE_IMPL_DATA_SRC_FCN_ARG(void,VME_CAEN_V1290_SHORT_SUBTDC::__unpack,uint32 tdc
+                                                                      ,uint32 event_id
+                                                                      ,raw_array_multi_zero_suppress<DATA24,DATA24,32,128> &data);
+
+/** END_UNPACKER ******************************************************/
+/** BEGIN_UNPACKER *****************************************************
+ *
+ * Event unpacker for VME_CAEN_V1290_SHORT_SUBTDC_ERROR.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// VME_CAEN_V1290_SHORT_SUBTDC_ERROR(tdc)
+template<typename __data_src_t>
+void VME_CAEN_V1290_SHORT_SUBTDC_ERROR::__unpack(__data_src_t &__buffer,uint32 tdc)
+{
+  // UINT32 error_flags
+  // {
+    //  0_14: flags;
+    // 24_25: tdc = CHECK(tdc);
+    // 27_31: 4;
+  // }
+  READ_FROM_BUFFER_FULL(353,uint32 ,error_flags,error_flags.u32,67);
+  CHECK_BITS_EQUAL(351,error_flags.tdc,tdc);
+  CHECK_BITS_EQUAL(352,error_flags.unnamed_27_31,4);
+  CHECK_UNNAMED_BITS_ZERO(353,error_flags.u32,0x04ff8000);
+}
+FORCE_IMPL_DATA_SRC_FCN_ARG(void,VME_CAEN_V1290_SHORT_SUBTDC_ERROR::__unpack,uint32 tdc);
+
+/** END_UNPACKER ******************************************************/
+/** BEGIN_UNPACKER *****************************************************
+ *
+ * Event unpacker for VME_CAEN_V1290_SHORT.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// VME_CAEN_V1290_SHORT(geom)
+template<typename __data_src_t>
+void VME_CAEN_V1290_SHORT::__unpack(__data_src_t &__buffer,uint32 geom)
+{
+  // MEMBER(DATA24 data[32] ZERO_SUPPRESS_MULTI(128));
+  // MARK_COUNT(v1190_start);
+  void *__mark_v1190_start = __buffer._data;
+  // UINT32 header
+  // {
+    //  0_04: geom = MATCH(geom);
+    //  5_26: event_number;
+    // 27_31: 8;
+  // }
+  READ_FROM_BUFFER_FULL(368,uint32 ,header,header.u32,69);
+  CHECK_BITS_EQUAL(365,header.geom,geom);
+  CHECK_BITS_EQUAL(367,header.unnamed_27_31,8);
+  // select several
+
+    // tdc[0] = VME_CAEN_V1290_SHORT_SUBTDC(tdc=0,event_id=(header.event_number & 0xfff),
+                                         // data=data);
+    // tdc[1] = VME_CAEN_V1290_SHORT_SUBTDC(tdc=1,event_id=(header.event_number & 0xfff),
+                                         // data=data);
+    // tdc[2] = VME_CAEN_V1290_SHORT_SUBTDC(tdc=2,event_id=(header.event_number & 0xfff),
+                                         // data=data);
+    // tdc[3] = VME_CAEN_V1290_SHORT_SUBTDC(tdc=3,event_id=(header.event_number & 0xfff),
+                                         // data=data);
+    // norevisit err[0] = VME_CAEN_V1290_SHORT_SUBTDC_ERROR(tdc=0);
+    // norevisit err[1] = VME_CAEN_V1290_SHORT_SUBTDC_ERROR(tdc=1);
+    // norevisit err[2] = VME_CAEN_V1290_SHORT_SUBTDC_ERROR(tdc=2);
+    // norevisit err[3] = VME_CAEN_V1290_SHORT_SUBTDC_ERROR(tdc=3);
+  bitsone<4> __visited2;
+  __visited2.clear();
+  for ( ; ; )
+  {
+    if (__buffer.empty()) break;
+    int __match_no = 0;
+    // optimized match 1: VME_CAEN_V1290_SHORT_SUBTDC tdc[0]: (s32) => (0xfb000000,0x00000000)
+    // optimized match 2: VME_CAEN_V1290_SHORT_SUBTDC tdc[1]: (s32) => (0xfb000000,0x01000000)
+    // optimized match 3: VME_CAEN_V1290_SHORT_SUBTDC tdc[2]: (s32) => (0xfb000000,0x02000000)
+    // optimized match 4: VME_CAEN_V1290_SHORT_SUBTDC tdc[3]: (s32) => (0xfb000000,0x03000000)
+    // optimized match 5: VME_CAEN_V1290_SHORT_SUBTDC_ERROR err[0]: (s32) => (0xffff8000,0x20000000)
+    // optimized match 6: VME_CAEN_V1290_SHORT_SUBTDC_ERROR err[1]: (s32) => (0xffff8000,0x21000000)
+    // optimized match 7: VME_CAEN_V1290_SHORT_SUBTDC_ERROR err[2]: (s32) => (0xffff8000,0x22000000)
+    // optimized match 8: VME_CAEN_V1290_SHORT_SUBTDC_ERROR err[3]: (s32) => (0xffff8000,0x23000000)
+    {
+    uint32 __match_peek;
+    PEEK_FROM_BUFFER(381,uint32,__match_peek);
+    // differ = 23000000 : 24 25 29
+    uint32 __match_index = 0 | /* 24,25 */ ((__match_peek >> 24) & 0x00000003) | /* 29,29 */ ((__match_peek >> 27) & 0x00000004);
+    static const sint8 __match_index_array[8] = { 1, 2, 3, 4, 5, 6, 7, 8, };
+    __match_no = __match_index_array[__match_index];
+    // last_subevent_item = 0
+    }
+    if (!__match_no) break;
+    switch (__match_no)
+    {
+      case 1:
+        CHECK_SPURIOUS_MATCH_DECL(372,spurious_match_abort_loop_3,VME_CAEN_V1290_SHORT_SUBTDC,/*tdc*/0,/*event_id*/(header.event_number & 0xfff)/*,data:member*/);
+        MATCH_PROFILE_COUNT(372,tdc[0]);
+        UNPACK_DECL(372,VME_CAEN_V1290_SHORT_SUBTDC,tdc[0],/*tdc*/0,/*event_id*/(header.event_number & 0xfff),/*data*/data);
+        break;
+      case 2:
+        CHECK_SPURIOUS_MATCH_DECL(373,spurious_match_abort_loop_3,VME_CAEN_V1290_SHORT_SUBTDC,/*tdc*/1,/*event_id*/(header.event_number & 0xfff)/*,data:member*/);
+        MATCH_PROFILE_COUNT(373,tdc[1]);
+        UNPACK_DECL(373,VME_CAEN_V1290_SHORT_SUBTDC,tdc[1],/*tdc*/1,/*event_id*/(header.event_number & 0xfff),/*data*/data);
+        break;
+      case 3:
+        CHECK_SPURIOUS_MATCH_DECL(374,spurious_match_abort_loop_3,VME_CAEN_V1290_SHORT_SUBTDC,/*tdc*/2,/*event_id*/(header.event_number & 0xfff)/*,data:member*/);
+        MATCH_PROFILE_COUNT(374,tdc[2]);
+        UNPACK_DECL(374,VME_CAEN_V1290_SHORT_SUBTDC,tdc[2],/*tdc*/2,/*event_id*/(header.event_number & 0xfff),/*data*/data);
+        break;
+      case 4:
+        CHECK_SPURIOUS_MATCH_DECL(375,spurious_match_abort_loop_3,VME_CAEN_V1290_SHORT_SUBTDC,/*tdc*/3,/*event_id*/(header.event_number & 0xfff)/*,data:member*/);
+        MATCH_PROFILE_COUNT(375,tdc[3]);
+        UNPACK_DECL(375,VME_CAEN_V1290_SHORT_SUBTDC,tdc[3],/*tdc*/3,/*event_id*/(header.event_number & 0xfff),/*data*/data);
+        break;
+      case 5:
+        CHECK_SPURIOUS_MATCH_DECL(377,spurious_match_abort_loop_3,VME_CAEN_V1290_SHORT_SUBTDC_ERROR,/*tdc*/0);
+        UNPACK_CHECK_NO_REVISIT(377,VME_CAEN_V1290_SHORT_SUBTDC_ERROR,err[0],__visited2,0);
+        MATCH_PROFILE_COUNT(377,err[0]);
+        UNPACK_DECL(377,VME_CAEN_V1290_SHORT_SUBTDC_ERROR,err[0],/*tdc*/0);
+        break;
+      case 6:
+        CHECK_SPURIOUS_MATCH_DECL(378,spurious_match_abort_loop_3,VME_CAEN_V1290_SHORT_SUBTDC_ERROR,/*tdc*/1);
+        UNPACK_CHECK_NO_REVISIT(378,VME_CAEN_V1290_SHORT_SUBTDC_ERROR,err[1],__visited2,1);
+        MATCH_PROFILE_COUNT(378,err[1]);
+        UNPACK_DECL(378,VME_CAEN_V1290_SHORT_SUBTDC_ERROR,err[1],/*tdc*/1);
+        break;
+      case 7:
+        CHECK_SPURIOUS_MATCH_DECL(379,spurious_match_abort_loop_3,VME_CAEN_V1290_SHORT_SUBTDC_ERROR,/*tdc*/2);
+        UNPACK_CHECK_NO_REVISIT(379,VME_CAEN_V1290_SHORT_SUBTDC_ERROR,err[2],__visited2,2);
+        MATCH_PROFILE_COUNT(379,err[2]);
+        UNPACK_DECL(379,VME_CAEN_V1290_SHORT_SUBTDC_ERROR,err[2],/*tdc*/2);
+        break;
+      case 8:
+        CHECK_SPURIOUS_MATCH_DECL(380,spurious_match_abort_loop_3,VME_CAEN_V1290_SHORT_SUBTDC_ERROR,/*tdc*/3);
+        UNPACK_CHECK_NO_REVISIT(380,VME_CAEN_V1290_SHORT_SUBTDC_ERROR,err[3],__visited2,3);
+        MATCH_PROFILE_COUNT(380,err[3]);
+        UNPACK_DECL(380,VME_CAEN_V1290_SHORT_SUBTDC_ERROR,err[3],/*tdc*/3);
+        break;
+    }
+  }
+  spurious_match_abort_loop_3:;
+  // UINT32 trigger
+  // {
+    //  0_26: time_tag;
+    // 27_31: 17;
+  // }
+  READ_FROM_BUFFER_FULL(387,uint32 ,trigger,trigger.u32,70);
+  CHECK_BITS_EQUAL(386,trigger.unnamed_27_31,17);
+  // MARK_COUNT(v1190_end);
+  void *__mark_v1190_end = __buffer._data;
+  // UINT32 trailer
+  // {
+    //  0_04: geom = CHECK(geom);
+    //  5_19: word_count = CHECK_COUNT(v1190_start,v1190_end,4,4);
+    //    24: tdc_error;
+    //    25: buffer_overflow;
+    //    26: trigger_lost;
+    // 27_31: 16;
+  // }
+  READ_FROM_BUFFER_FULL(399,uint32 ,trailer,trailer.u32,71);
+  CHECK_BITS_EQUAL(393,trailer.geom,geom);
+  CHECK_WORD_COUNT(394,trailer.word_count,v1190_start,v1190_end,4,4);
+  CHECK_BITS_EQUAL(398,trailer.unnamed_27_31,16);
+  CHECK_UNNAMED_BITS_ZERO(399,trailer.u32,0x00f00000);
+}
+FORCE_IMPL_DATA_SRC_FCN_ARG(void,VME_CAEN_V1290_SHORT::__unpack,uint32 geom);
+
+/** END_UNPACKER ******************************************************/
+/** BEGIN_UNPACKER *****************************************************
+ *
+ * Event unpacker for VME_CAEN_V775.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// VME_CAEN_V775(geom,crate)
+template<typename __data_src_t>
+void VME_CAEN_V775::__unpack(__data_src_t &__buffer,uint32 geom,uint32 crate)
+{
+  // MEMBER(DATA12_OVERFLOW data[32] ZERO_SUPPRESS);
+  // UINT32 header NOENCODE
+  // {
+    //  8_13: count;
+    // 16_23: crate = MATCH(crate);
+    // 24_26: 2;
+    // 27_31: geom = MATCH(geom);
+  // }
+  union
+  {
+    struct
+    {
+#if __BYTE_ORDER == __LITTLE_ENDIAN
+      uint32 dummy_0_7 : 8;
+      uint32 count : 6; // 8..13
+      uint32 dummy_14_15 : 2;
+      uint32 crate : 8; // 16..23
+      uint32 unnamed_24_26 : 3; // 24..26
+      uint32 geom : 5; // 27..31
+#endif
+#if __BYTE_ORDER == __BIG_ENDIAN
+      uint32 geom : 5; // 27..31
+      uint32 unnamed_24_26 : 3; // 24..26
+      uint32 crate : 8; // 16..23
+      uint32 dummy_14_15 : 2;
+      uint32 count : 6; // 8..13
+      uint32 dummy_0_7 : 8;
+#endif
+    };
+    uint32  u32;
+  } header;
+  READ_FROM_BUFFER_FULL(137,uint32 ,header,header.u32,73);
+  CHECK_BITS_EQUAL(134,header.crate,crate);
+  CHECK_BITS_EQUAL(135,header.unnamed_24_26,2);
+  CHECK_BITS_EQUAL(136,header.geom,geom);
+  CHECK_UNNAMED_BITS_ZERO(137,header.u32,0x0000c0ff);
+  // list(0<=index<header.count)
+
+  for (uint32 index = 0; index < (uint32) (header.count); ++index)
+  {
+    // UINT32 ch_data NOENCODE
+    // {
+      //  0_11: value;
+      //    12: overflow;
+      //    13: underflow;
+      //    14: valid;
+      // 16_20: channel;
+      // 24_26: 0;
+      // 27_31: geom = CHECK(geom);
+      // ENCODE(data[channel],(value=value,overflow=overflow));
+    // }
+    union
+    {
+      struct
+      {
+#if __BYTE_ORDER == __LITTLE_ENDIAN
+        uint32 value : 12; // 0..11
+        uint32 overflow : 1; // 12
+        uint32 underflow : 1; // 13
+        uint32 valid : 1; // 14
+        uint32 dummy_15 : 1;
+        uint32 channel : 5; // 16..20
+        uint32 dummy_21_23 : 3;
+        uint32 unnamed_24_26 : 3; // 24..26
+        uint32 geom : 5; // 27..31
+#endif
+#if __BYTE_ORDER == __BIG_ENDIAN
+        uint32 geom : 5; // 27..31
+        uint32 unnamed_24_26 : 3; // 24..26
+        uint32 dummy_21_23 : 3;
+        uint32 channel : 5; // 16..20
+        uint32 dummy_15 : 1;
+        uint32 valid : 1; // 14
+        uint32 underflow : 1; // 13
+        uint32 overflow : 1; // 12
+        uint32 value : 12; // 0..11
+#endif
+      };
+      uint32  u32;
+    } ch_data;
+    READ_FROM_BUFFER_FULL(157,uint32 ,ch_data,ch_data.u32,74);
+    CHECK_BITS_EQUAL(153,ch_data.unnamed_24_26,0);
+    CHECK_BITS_EQUAL(154,ch_data.geom,geom);
+    CHECK_UNNAMED_BITS_ZERO(157,ch_data.u32,0x00e08000);
+    {
+      typedef __typeof__(*(&(data))) __array_t;
+      typedef typename __array_t::item_t __item_t;
+      __item_t &__item = data.insert_index(156,ch_data.channel);
+      __item.value = ch_data.value;
+      __item.overflow = ch_data.overflow;
+    }
+  }
+  // UINT32 eob
+  // {
+    //  0_23: event_number;
+    // 24_26: 4;
+    // 27_31: geom = CHECK(geom);
+  // }
+  READ_FROM_BUFFER_FULL(166,uint32 ,eob,eob.u32,75);
+  CHECK_BITS_EQUAL(163,eob.unnamed_24_26,4);
+  CHECK_BITS_EQUAL(164,eob.geom,geom);
+}
+FORCE_IMPL_DATA_SRC_FCN_ARG(void,VME_CAEN_V775::__unpack,uint32 geom,uint32 crate);
+
+/** END_UNPACKER ******************************************************/
+/** BEGIN_UNPACKER *****************************************************
+ *
+ * Event unpacker for VME_CAEN_V830.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// VME_CAEN_V830(geom)
+template<typename __data_src_t>
+void VME_CAEN_V830::__unpack(__data_src_t &__buffer,uint32 geom)
+{
+  // MEMBER(DATA32 data[32] ZERO_SUPPRESS);
+  // UINT32 header
+  // {
+    //  0_15: event_number;
+    // 16_17: ts;
+    // 18_23: count;
+    //    26: 1;
+    // 27_31: geom = MATCH(geom);
+  // }
+  READ_FROM_BUFFER_FULL(185,uint32 ,header,header.u32,77);
+  CHECK_BITS_EQUAL(183,header.unnamed_26_26,1);
+  CHECK_BITS_EQUAL(184,header.geom,geom);
+  CHECK_UNNAMED_BITS_ZERO(185,header.u32,0x03000000);
+  // list(0<=index<header.count)
+
+  for (uint32 index = 0; index < (uint32) (header.count); ++index)
+  {
+    // UINT32 ch_data NOENCODE
+    // {
+      //  0_25: value;
+      //    26: 0;
+      // 27_31: channel;
+      // ENCODE(data[channel],(value=value));
+    // }
+    union
+    {
+      struct
+      {
+#if __BYTE_ORDER == __LITTLE_ENDIAN
+        uint32 value : 26; // 0..25
+        uint32 unnamed_26_26 : 1; // 26
+        uint32 channel : 5; // 27..31
+#endif
+#if __BYTE_ORDER == __BIG_ENDIAN
+        uint32 channel : 5; // 27..31
+        uint32 unnamed_26_26 : 1; // 26
+        uint32 value : 26; // 0..25
+#endif
+      };
+      uint32  u32;
+    } ch_data;
+    READ_FROM_BUFFER_FULL(196,uint32 ,ch_data,ch_data.u32,78);
+    CHECK_BITS_EQUAL(192,ch_data.unnamed_26_26,0);
+    {
+      typedef __typeof__(*(&(data))) __array_t;
+      typedef typename __array_t::item_t __item_t;
+      __item_t &__item = data.insert_index(195,ch_data.channel);
+      __item.value = ch_data.value;
+    }
+  }
+}
+FORCE_IMPL_DATA_SRC_FCN_ARG(void,VME_CAEN_V830::__unpack,uint32 geom);
+
+/** END_UNPACKER ******************************************************/
+/** BEGIN_UNPACKER *****************************************************
+ *
+ * Event unpacker for VME_MESYTEC_MADC32.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// VME_MESYTEC_MADC32(geom)
+template<typename __data_src_t>
+void VME_MESYTEC_MADC32::__unpack(__data_src_t &__buffer,uint32 geom)
+{
+  // MEMBER(DATA14_OVERFLOW data[32] ZERO_SUPPRESS);
+  // MARK_COUNT(start);
+  void *__mark_start = __buffer._data;
+  // UINT32 header NOENCODE
+  // {
+    //  0_11: word_number;
+    // 12_14: adc_resol;
+    //    15: out_form;
+    // 16_23: geom = MATCH(geom);
+    // 24_29: 0;
+    // 30_31: 1;
+  // }
+  union
+  {
+    struct
+    {
+#if __BYTE_ORDER == __LITTLE_ENDIAN
+      uint32 word_number : 12; // 0..11
+      uint32 adc_resol : 3; // 12..14
+      uint32 out_form : 1; // 15
+      uint32 geom : 8; // 16..23
+      uint32 unnamed_24_29 : 6; // 24..29
+      uint32 unnamed_30_31 : 2; // 30..31
+#endif
+#if __BYTE_ORDER == __BIG_ENDIAN
+      uint32 unnamed_30_31 : 2; // 30..31
+      uint32 unnamed_24_29 : 6; // 24..29
+      uint32 geom : 8; // 16..23
+      uint32 out_form : 1; // 15
+      uint32 adc_resol : 3; // 12..14
+      uint32 word_number : 12; // 0..11
+#endif
+    };
+    uint32  u32;
+  } header;
+  READ_FROM_BUFFER_FULL(624,uint32 ,header,header.u32,80);
+  CHECK_BITS_EQUAL(621,header.geom,geom);
+  CHECK_BITS_EQUAL(622,header.unnamed_24_29,0);
+  CHECK_BITS_EQUAL(623,header.unnamed_30_31,1);
+  // several UINT32 ch_data NOENCODE
+  // {
+    //  0_12: value;
+    //    14: outofrange;
+    // 16_20: channel;
+    // 21_29: 32;
+    // 30_31: 0;
+    // ENCODE(data[channel],(value=value,overflow=outofrange));
+  // }
+  {
+    size_t __run = __buffer.run_uint32(0xffe0a000,0x04000000);
+    for ( ; __run; __run--) {
+    union
+    {
+      struct
+      {
+#if __BYTE_ORDER == __LITTLE_ENDIAN
+        uint32 value : 13; // 0..12
+        uint32 dummy_13 : 1;
+        uint32 outofrange : 1; // 14
+        uint32 dummy_15 : 1;
+        uint32 channel : 5; // 16..20
+        uint32 unnamed_21_29 : 9; // 21..29
+        uint32 unnamed_30_31 : 2; // 30..31
+#endif
+#if __BYTE_ORDER == __BIG_ENDIAN
+        uint32 unnamed_30_31 : 2; // 30..31
+        uint32 unnamed_21_29 : 9; // 21..29
+        uint32 channel : 5; // 16..20
+        uint32 dummy_15 : 1;
+        uint32 outofrange : 1; // 14
+        uint32 dummy_13 : 1;
+        uint32 value : 13; // 0..12
+#endif
+      };
+      uint32  u32;
+    } ch_data;
+    PEEK_FROM_BUFFER_FULL(635,uint32 ,ch_data,ch_data.u32,81);
+    __buffer.advance(sizeof(ch_data.u32));
+    {
+      typedef __typeof__(*(&(data))) __array_t;
+      typedef typename __array_t::item_t __item_t;
+      __item_t &__item = data.insert_index(634,ch_data.channel);
+      __item.value = ch_data.value;
+      __item.overflow = ch_data.outofrange;
+    }
+    }
+  }
+  for ( ; ; ) {
+  union
+  {
+    struct
+    {
+#if __BYTE_ORDER == __LITTLE_ENDIAN
+      uint32 value : 13; // 0..12
+      uint32 dummy_13 : 1;
+      uint32 outofrange : 1; // 14
+      uint32 dummy_15 : 1;
+      uint32 channel : 5; // 16..20
+      uint32 unnamed_21_29 : 9; // 21..29
+      uint32 unnamed_30_31 : 2; // 30..31
+#endif
+#if __BYTE_ORDER == __BIG_ENDIAN
+      uint32 unnamed_30_31 : 2; // 30..31
+      uint32 unnamed_21_29 : 9; // 21..29
+      uint32 channel : 5; // 16..20
+      uint32 dummy_15 : 1;
+      uint32 outofrange : 1; // 14
+      uint32 dummy_13 : 1;
+      uint32 value : 13; // 0..12
+#endif
+    };
+    uint32  u32;
+  } ch_data;
+  if (__buffer.empty()) goto data_done_6;
+  PEEK_FROM_BUFFER_FULL(635,uint32 ,ch_data,ch_data.u32,81);
+  CHECK_JUMP_BITS_EQUAL(631,ch_data.unnamed_21_29,32,data_done_6);
+  CHECK_JUMP_BITS_EQUAL(632,ch_data.unnamed_30_31,0,data_done_6);
+  CHECK_JUMP_UNNAMED_BITS_ZERO(635,ch_data.u32,0x0000a000,data_done_6);
+  __buffer.advance(sizeof(ch_data.u32));
+  {
+    typedef __typeof__(*(&(data))) __array_t;
+    typedef typename __array_t::item_t __item_t;
+    __item_t &__item = data.insert_index(634,ch_data.channel);
+    __item.value = ch_data.value;
+    __item.overflow = ch_data.outofrange;
+  }
+  }
+  data_done_6:;
+  // optional UINT32 filler NOENCODE
+  // {
+    //  0_31: 0;
+  // }
+  union
+  {
+    struct
+    {
+#if __BYTE_ORDER == __LITTLE_ENDIAN
+      uint32 unnamed_0_31 : 32; // 0..31
+#endif
+#if __BYTE_ORDER == __BIG_ENDIAN
+      uint32 unnamed_0_31 : 32; // 0..31
+#endif
+    };
+    uint32  u32;
+  } filler;
+  if (__buffer.empty()) goto data_done_7;
+  PEEK_FROM_BUFFER_FULL(641,uint32 ,filler,filler.u32,82);
+  CHECK_JUMP_BITS_EQUAL(640,filler.unnamed_0_31,0,data_done_7);
+  __buffer.advance(sizeof(filler.u32));
+  data_done_7:;
+  // UINT32 end_of_event
+  // {
+    //  0_29: counter;
+    // 30_31: 3;
+  // }
+  READ_FROM_BUFFER_FULL(647,uint32 ,end_of_event,end_of_event.u32,83);
+  CHECK_BITS_EQUAL(646,end_of_event.unnamed_30_31,3);
+  // MARK_COUNT(end);
+  void *__mark_end = __buffer._data;
+  // CHECK_COUNT(header.word_number,start,end,( - 4),4)
+  CHECK_WORD_COUNT(650,header.word_number,start,end,( - 4),4);
+}
+FORCE_IMPL_DATA_SRC_FCN_ARG(void,VME_MESYTEC_MADC32::__unpack,uint32 geom);
+
+/** END_UNPACKER ******************************************************/
+/** BEGIN_UNPACKER *****************************************************
+ *
+ * Event unpacker for VME_MESYTEC_MDPP16.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// VME_MESYTEC_MDPP16(geom)
+template<typename __data_src_t>
+void VME_MESYTEC_MDPP16::__unpack(__data_src_t &__buffer,uint32 geom)
+{
+  // MEMBER(DATA16_OVERFLOW adc[16] ZERO_SUPPRESS_MULTI(20));
+  // MEMBER(DATA16_OVERFLOW tdc[16] ZERO_SUPPRESS_MULTI(20));
+  // MEMBER(DATA16_OVERFLOW trig_tdc[16] ZERO_SUPPRESS_MULTI(20));
+  // MEMBER(DATA16_OVERFLOW adc_short[16] ZERO_SUPPRESS_MULTI(20));
+  // MARK_COUNT(start);
+  void *__mark_start = __buffer._data;
+  // UINT32 header NOENCODE
+  // {
+    //  0_09: word_number;
+    // 10_12: adc_res;
+    // 13_15: tdc_res;
+    // 16_23: geom = MATCH(geom);
+    // 24_29: 0;
+    // 30_31: 1;
+  // }
+  union
+  {
+    struct
+    {
+#if __BYTE_ORDER == __LITTLE_ENDIAN
+      uint32 word_number : 10; // 0..9
+      uint32 adc_res : 3; // 10..12
+      uint32 tdc_res : 3; // 13..15
+      uint32 geom : 8; // 16..23
+      uint32 unnamed_24_29 : 6; // 24..29
+      uint32 unnamed_30_31 : 2; // 30..31
+#endif
+#if __BYTE_ORDER == __BIG_ENDIAN
+      uint32 unnamed_30_31 : 2; // 30..31
+      uint32 unnamed_24_29 : 6; // 24..29
+      uint32 geom : 8; // 16..23
+      uint32 tdc_res : 3; // 13..15
+      uint32 adc_res : 3; // 10..12
+      uint32 word_number : 10; // 0..9
+#endif
+    };
+    uint32  u32;
+  } header;
+  READ_FROM_BUFFER_FULL(671,uint32 ,header,header.u32,85);
+  CHECK_BITS_EQUAL(668,header.geom,geom);
+  CHECK_BITS_EQUAL(669,header.unnamed_24_29,0);
+  CHECK_BITS_EQUAL(670,header.unnamed_30_31,1);
+  // several UINT32 ch_data NOENCODE
+  // {
+    //  0_15: value;
+    // 16_19: channel;
+    // 20_21: ch_kind;
+    //    22: overflow;
+    //    23: pileup;
+    // 24_27: 0;
+    // 28_31: 1;
+    // if((ch_kind == 0))
+    // {
+      // ENCODE(adc[channel],(value=value,overflow=overflow,pileup=pileup));
+    // }
+    // if((ch_kind == 1))
+    // {
+      // ENCODE(tdc[channel],(value=value,overflow=overflow,pileup=pileup));
+    // }
+    // if((ch_kind == 2))
+    // {
+      // ENCODE(trig_tdc[channel],(value=value,overflow=overflow,pileup=pileup));
+    // }
+    // if((ch_kind == 3))
+    // {
+      // ENCODE(adc_short[channel],(value=value,overflow=overflow,pileup=pileup));
+    // }
+  // }
+  {
+    size_t __run = __buffer.run_uint32(0xff000000,0x10000000);
+    for ( ; __run; __run--) {
+    union
+    {
+      struct
+      {
+#if __BYTE_ORDER == __LITTLE_ENDIAN
+        uint32 value : 16; // 0..15
+        uint32 channel : 4; // 16..19
+        uint32 ch_kind : 2; // 20..21
+        uint32 overflow : 1; // 22
+        uint32 pileup : 1; // 23
+        uint32 unnamed_24_27 : 4; // 24..27
+        uint32 unnamed_28_31 : 4; // 28..31
+#endif
+#if __BYTE_ORDER == __BIG_ENDIAN
+        uint32 unnamed_28_31 : 4; // 28..31
+        uint32 unnamed_24_27 : 4; // 24..27
+        uint32 pileup : 1; // 23
+        uint32 overflow : 1; // 22
+        uint32 ch_kind : 2; // 20..21
+        uint32 channel : 4; // 16..19
+        uint32 value : 16; // 0..15
+#endif
+      };
+      uint32  u32;
+    } ch_data;
+    PEEK_FROM_BUFFER_FULL(699,uint32 ,ch_data,ch_data.u32,86);
+    __buffer.advance(sizeof(ch_data.u32));
+    {
+      if ((ch_data.ch_kind == 0))
+      {
+        typedef __typeof__(*(&(adc))) __array_t;
+        typedef typename __array_t::item_t __item_t;
+        __item_t &__item = adc.insert_index(685,ch_data.channel);
+        __item.value = ch_data.value;
+        __item.overflow = ch_data.overflow;
+        __item.pileup = ch_data.pileup;
+      }
+      if ((ch_data.ch_kind == 1))
+      {
+        typedef __typeof__(*(&(tdc))) __array_t;
+        typedef typename __array_t::item_t __item_t;
+        __item_t &__item = tdc.insert_index(689,ch_data.channel);
+        __item.value = ch_data.value;
+        __item.overflow = ch_data.overflow;
+        __item.pileup = ch_data.pileup;
+      }
+      if ((ch_data.ch_kind == 2))
+      {
+        typedef __typeof__(*(&(trig_tdc))) __array_t;
+        typedef typename __array_t::item_t __item_t;
+        __item_t &__item = trig_tdc.insert_index(693,ch_data.channel);
+        __item.value = ch_data.value;
+        __item.overflow = ch_data.overflow;
+        __item.pileup = ch_data.pileup;
+      }
+      if ((ch_data.ch_kind == 3))
+      {
+        typedef __typeof__(*(&(adc_short))) __array_t;
+        typedef typename __array_t::item_t __item_t;
+        __item_t &__item = adc_short.insert_index(697,ch_data.channel);
+        __item.value = ch_data.value;
+        __item.overflow = ch_data.overflow;
+        __item.pileup = ch_data.pileup;
+      }
+    }
+    }
+  }
+  for ( ; ; ) {
+  union
+  {
+    struct
+    {
+#if __BYTE_ORDER == __LITTLE_ENDIAN
+      uint32 value : 16; // 0..15
+      uint32 channel : 4; // 16..19
+      uint32 ch_kind : 2; // 20..21
+      uint32 overflow : 1; // 22
+      uint32 pileup : 1; // 23
+      uint32 unnamed_24_27 : 4; // 24..27
+      uint32 unnamed_28_31 : 4; // 28..31
+#endif
+#if __BYTE_ORDER == __BIG_ENDIAN
+      uint32 unnamed_28_31 : 4; // 28..31
+      uint32 unnamed_24_27 : 4; // 24..27
+      uint32 pileup : 1; // 23
+      uint32 overflow : 1; // 22
+      uint32 ch_kind : 2; // 20..21
+      uint32 channel : 4; // 16..19
+      uint32 value : 16; // 0..15
+#endif
+    };
+    uint32  u32;
+  } ch_data;
+  if (__buffer.empty()) goto data_done_8;
+  PEEK_FROM_BUFFER_FULL(699,uint32 ,ch_data,ch_data.u32,86);
+  CHECK_JUMP_BITS_EQUAL(680,ch_data.unnamed_24_27,0,data_done_8);
+  CHECK_JUMP_BITS_EQUAL(681,ch_data.unnamed_28_31,1,data_done_8);
+  __buffer.advance(sizeof(ch_data.u32));
+  {
+    if ((ch_data.ch_kind == 0))
+    {
+      typedef __typeof__(*(&(adc))) __array_t;
+      typedef typename __array_t::item_t __item_t;
+      __item_t &__item = adc.insert_index(685,ch_data.channel);
+      __item.value = ch_data.value;
+      __item.overflow = ch_data.overflow;
+      __item.pileup = ch_data.pileup;
+    }
+    if ((ch_data.ch_kind == 1))
+    {
+      typedef __typeof__(*(&(tdc))) __array_t;
+      typedef typename __array_t::item_t __item_t;
+      __item_t &__item = tdc.insert_index(689,ch_data.channel);
+      __item.value = ch_data.value;
+      __item.overflow = ch_data.overflow;
+      __item.pileup = ch_data.pileup;
+    }
+    if ((ch_data.ch_kind == 2))
+    {
+      typedef __typeof__(*(&(trig_tdc))) __array_t;
+      typedef typename __array_t::item_t __item_t;
+      __item_t &__item = trig_tdc.insert_index(693,ch_data.channel);
+      __item.value = ch_data.value;
+      __item.overflow = ch_data.overflow;
+      __item.pileup = ch_data.pileup;
+    }
+    if ((ch_data.ch_kind == 3))
+    {
+      typedef __typeof__(*(&(adc_short))) __array_t;
+      typedef typename __array_t::item_t __item_t;
+      __item_t &__item = adc_short.insert_index(697,ch_data.channel);
+      __item.value = ch_data.value;
+      __item.overflow = ch_data.overflow;
+      __item.pileup = ch_data.pileup;
+    }
+  }
+  }
+  data_done_8:;
+  // several UINT32 fill_word NOENCODE
+  // {
+    //  0_31: 0;
+  // }
+  {
+    size_t __run = __buffer.run_uint32(0xffffffff,0x00000000);
+    for ( ; __run; __run--) {
+    union
+    {
+      struct
+      {
+#if __BYTE_ORDER == __LITTLE_ENDIAN
+        uint32 unnamed_0_31 : 32; // 0..31
+#endif
+#if __BYTE_ORDER == __BIG_ENDIAN
+        uint32 unnamed_0_31 : 32; // 0..31
+#endif
+      };
+      uint32  u32;
+    } fill_word;
+    PEEK_FROM_BUFFER_FULL(704,uint32 ,fill_word,fill_word.u32,87);
+    __buffer.advance(sizeof(fill_word.u32));
+    }
+  }
+  for ( ; ; ) {
+  union
+  {
+    struct
+    {
+#if __BYTE_ORDER == __LITTLE_ENDIAN
+      uint32 unnamed_0_31 : 32; // 0..31
+#endif
+#if __BYTE_ORDER == __BIG_ENDIAN
+      uint32 unnamed_0_31 : 32; // 0..31
+#endif
+    };
+    uint32  u32;
+  } fill_word;
+  if (__buffer.empty()) goto data_done_9;
+  PEEK_FROM_BUFFER_FULL(704,uint32 ,fill_word,fill_word.u32,87);
+  CHECK_JUMP_BITS_EQUAL(703,fill_word.unnamed_0_31,0,data_done_9);
+  __buffer.advance(sizeof(fill_word.u32));
+  }
+  data_done_9:;
+  // UINT32 end_of_event
+  // {
+    //  0_29: counter;
+    // 30_31: 3;
+  // }
+  READ_FROM_BUFFER_FULL(710,uint32 ,end_of_event,end_of_event.u32,88);
+  CHECK_BITS_EQUAL(709,end_of_event.unnamed_30_31,3);
+  // MARK_COUNT(end);
+  void *__mark_end = __buffer._data;
+  // CHECK_COUNT(header.word_number,start,end,( - 4),4)
+  CHECK_WORD_COUNT(713,header.word_number,start,end,( - 4),4);
+}
+FORCE_IMPL_DATA_SRC_FCN_ARG(void,VME_MESYTEC_MDPP16::__unpack,uint32 geom);
+
+/** END_UNPACKER ******************************************************/
+/** BEGIN_UNPACKER *****************************************************
+ *
+ * Event unpacker for WR_STAMP.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// WR_STAMP(id)
+template<typename __data_src_t>
+void WR_STAMP::__unpack(__data_src_t &__buffer,uint32 id)
+{
+  // MEMBER(DATA16 srcid);
+  // MEMBER(DATA16 err);
+  // MEMBER(DATA16 t1);
+  // MEMBER(DATA16 t2);
+  // MEMBER(DATA16 t3);
+  // MEMBER(DATA16 t4);
+  // UINT32 header NOENCODE
+  // {
+    //  8_11: id = MATCH(id);
+    //    16: error;
+    // ENCODE(srcid,(value=id));
+    // ENCODE(err,(value=error));
+  // }
+  union
+  {
+    struct
+    {
+#if __BYTE_ORDER == __LITTLE_ENDIAN
+      uint32 dummy_0_7 : 8;
+      uint32 id : 4; // 8..11
+      uint32 dummy_12_15 : 4;
+      uint32 error : 1; // 16
+      uint32 dummy_17_31 : 15;
+#endif
+#if __BYTE_ORDER == __BIG_ENDIAN
+      uint32 dummy_17_31 : 15;
+      uint32 error : 1; // 16
+      uint32 dummy_12_15 : 4;
+      uint32 id : 4; // 8..11
+      uint32 dummy_0_7 : 8;
+#endif
+    };
+    uint32  u32;
+  } header;
+  READ_FROM_BUFFER_FULL(966,uint32 ,header,header.u32,90);
+  CHECK_BITS_EQUAL(962,header.id,id);
+  CHECK_UNNAMED_BITS_ZERO(966,header.u32,0xfffef0ff);
+  {
+    {
+      srcid.value = header.id;
+    }
+    {
+      err.value = header.error;
+    }
+  }
+  // UINT32 data0 NOENCODE
+  // {
+    //  0_15: t1;
+    // 16_31: 0x3e1;
+    // ENCODE(t1,(value=t1));
+  // }
+  union
+  {
+    struct
+    {
+#if __BYTE_ORDER == __LITTLE_ENDIAN
+      uint32 t1 : 16; // 0..15
+      uint32 unnamed_16_31 : 16; // 16..31
+#endif
+#if __BYTE_ORDER == __BIG_ENDIAN
+      uint32 unnamed_16_31 : 16; // 16..31
+      uint32 t1 : 16; // 0..15
+#endif
+    };
+    uint32  u32;
+  } data0;
+  READ_FROM_BUFFER_FULL(972,uint32 ,data0,data0.u32,91);
+  CHECK_BITS_EQUAL(970,data0.unnamed_16_31,0x3e1);
+  {
+    t1.value = data0.t1;
+  }
+  // UINT32 data1 NOENCODE
+  // {
+    //  0_15: t2;
+    // 16_31: 0x4e1;
+    // ENCODE(t2,(value=t2));
+  // }
+  union
+  {
+    struct
+    {
+#if __BYTE_ORDER == __LITTLE_ENDIAN
+      uint32 t2 : 16; // 0..15
+      uint32 unnamed_16_31 : 16; // 16..31
+#endif
+#if __BYTE_ORDER == __BIG_ENDIAN
+      uint32 unnamed_16_31 : 16; // 16..31
+      uint32 t2 : 16; // 0..15
+#endif
+    };
+    uint32  u32;
+  } data1;
+  READ_FROM_BUFFER_FULL(978,uint32 ,data1,data1.u32,92);
+  CHECK_BITS_EQUAL(976,data1.unnamed_16_31,0x4e1);
+  {
+    t2.value = data1.t2;
+  }
+  // UINT32 data2 NOENCODE
+  // {
+    //  0_15: t3;
+    // 16_31: 0x5e1;
+    // ENCODE(t3,(value=t3));
+  // }
+  union
+  {
+    struct
+    {
+#if __BYTE_ORDER == __LITTLE_ENDIAN
+      uint32 t3 : 16; // 0..15
+      uint32 unnamed_16_31 : 16; // 16..31
+#endif
+#if __BYTE_ORDER == __BIG_ENDIAN
+      uint32 unnamed_16_31 : 16; // 16..31
+      uint32 t3 : 16; // 0..15
+#endif
+    };
+    uint32  u32;
+  } data2;
+  READ_FROM_BUFFER_FULL(984,uint32 ,data2,data2.u32,93);
+  CHECK_BITS_EQUAL(982,data2.unnamed_16_31,0x5e1);
+  {
+    t3.value = data2.t3;
+  }
+  // UINT32 data3 NOENCODE
+  // {
+    //  0_15: t4;
+    // 16_31: 0x6e1;
+    // ENCODE(t4,(value=t4));
+  // }
+  union
+  {
+    struct
+    {
+#if __BYTE_ORDER == __LITTLE_ENDIAN
+      uint32 t4 : 16; // 0..15
+      uint32 unnamed_16_31 : 16; // 16..31
+#endif
+#if __BYTE_ORDER == __BIG_ENDIAN
+      uint32 unnamed_16_31 : 16; // 16..31
+      uint32 t4 : 16; // 0..15
+#endif
+    };
+    uint32  u32;
+  } data3;
+  READ_FROM_BUFFER_FULL(990,uint32 ,data3,data3.u32,94);
+  CHECK_BITS_EQUAL(988,data3.unnamed_16_31,0x6e1);
+  {
+    t4.value = data3.t4;
+  }
+}
+FORCE_IMPL_DATA_SRC_FCN_ARG(void,WR_STAMP::__unpack,uint32 id);
+
+/** END_UNPACKER ******************************************************/
+/** BEGIN_UNPACKER *****************************************************
+ *
+ * Event unpacker for XTST_STD_VME.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// XTST_STD_VME()
+template<typename __data_src_t>
+void XTST_STD_VME::__unpack(__data_src_t &__buffer)
+{
+  // UINT32 failure
+  // {
+    //     0: fail_general;
+    //     1: fail_data_corrupt;
+    //     2: fail_data_missing;
+    //     3: fail_data_too_much;
+    //     4: fail_event_counter_mismatch;
+    //     5: fail_readout_error_driver;
+    //     6: fail_unexpected_trigger;
+    //    27: has_no_zero_suppression;
+    //    28: has_multi_adctdc_counter0;
+    //    29: has_multi_scaler_counter0;
+    //    30: has_multi_event;
+    //    31: has_time_stamp;
+  // }
+  READ_FROM_BUFFER_FULL(737,uint32 ,failure,failure.u32,96);
+  CHECK_UNNAMED_BITS_ZERO(737,failure.u32,0x07ffff80);
+  // if(failure.has_time_stamp)
+
+  if (failure.has_time_stamp)
+  {
+    // UINT32 time_stamp;
+    READ_FROM_BUFFER(740,uint32 ,time_stamp,97);
+  }
+  // if(failure.has_multi_event)
+
+  if (failure.has_multi_event)
+  {
+    // UINT32 multi_events;
+    READ_FROM_BUFFER(744,uint32 ,multi_events,98);
+  }
+  // if(failure.has_multi_scaler_counter0)
+
+  if (failure.has_multi_scaler_counter0)
+  {
+    // UINT32 multi_scaler_counter0;
+    READ_FROM_BUFFER(748,uint32 ,multi_scaler_counter0,99);
+  }
+  // if(failure.has_multi_adctdc_counter0)
+
+  if (failure.has_multi_adctdc_counter0)
+  {
+    // UINT32 multi_adctdc_counter0;
+    READ_FROM_BUFFER(752,uint32 ,multi_adctdc_counter0,100);
+  }
+}
+FORCE_IMPL_DATA_SRC_FCN(void,XTST_STD_VME::__unpack);
+
+/** END_UNPACKER ******************************************************/
+/** BEGIN_UNPACKER *****************************************************
+ *
+ * Event unpacker for XTST_SUBEVENT_MEMBER_DATA12.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// XTST_SUBEVENT_MEMBER_DATA12()
+template<typename __data_src_t>
+void XTST_SUBEVENT_MEMBER_DATA12::__unpack(__data_src_t &__buffer)
+{
+  // MEMBER(DATA12 mDATA12);
+  // MEMBER(DATA12 mDATA12_array[8]);
+  // MEMBER(DATA12 mDATA12_array_zzp[8] ZERO_SUPPRESS);
+  // MEMBER(DATA12 mDATA12_array_zzpii[8] ZERO_SUPPRESS_LIST);
+  // MEMBER(DATA12 mDATA12_array_zzpml[8] ZERO_SUPPRESS_MULTI(4));
+  // MEMBER(DATA12 mDATA12_array2[2][8]);
+  // MEMBER(DATA12 mDATA12_array2_zzp[2][8] ZERO_SUPPRESS);
+  // MEMBER(DATA12 mDATA12_array2_zzpii[2][8] ZERO_SUPPRESS_LIST);
+  // MEMBER(DATA12 mDATA12_array2_zzpml[2][8] ZERO_SUPPRESS_MULTI(4));
+}
+FORCE_IMPL_DATA_SRC_FCN(void,XTST_SUBEVENT_MEMBER_DATA12::__unpack);
+
+/** END_UNPACKER ******************************************************/
+/** BEGIN_UNPACKER *****************************************************
+ *
+ * Event unpacker for XTST_SUBEVENT_MEMBER_DATA12_OVERFLOW.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// XTST_SUBEVENT_MEMBER_DATA12_OVERFLOW()
+template<typename __data_src_t>
+void XTST_SUBEVENT_MEMBER_DATA12_OVERFLOW::__unpack(__data_src_t &__buffer)
+{
+  // MEMBER(DATA12_OVERFLOW mDATA12_OVERFLOW);
+  // MEMBER(DATA12_OVERFLOW mDATA12_OVERFLOW_array[8]);
+  // MEMBER(DATA12_OVERFLOW mDATA12_OVERFLOW_array_zzp[8] ZERO_SUPPRESS);
+  // MEMBER(DATA12_OVERFLOW mDATA12_OVERFLOW_array_zzpii[8] ZERO_SUPPRESS_LIST);
+  // MEMBER(DATA12_OVERFLOW mDATA12_OVERFLOW_array_zzpml[8] ZERO_SUPPRESS_MULTI(4));
+  // MEMBER(DATA12_OVERFLOW mDATA12_OVERFLOW_array2[2][8]);
+  // MEMBER(DATA12_OVERFLOW mDATA12_OVERFLOW_array2_zzp[2][8] ZERO_SUPPRESS);
+  // MEMBER(DATA12_OVERFLOW mDATA12_OVERFLOW_array2_zzpii[2][8] ZERO_SUPPRESS_LIST);
+  // MEMBER(DATA12_OVERFLOW mDATA12_OVERFLOW_array2_zzpml[2][8] ZERO_SUPPRESS_MULTI(4));
+}
+FORCE_IMPL_DATA_SRC_FCN(void,XTST_SUBEVENT_MEMBER_DATA12_OVERFLOW::__unpack);
+
+/** END_UNPACKER ******************************************************/
+/** BEGIN_UNPACKER *****************************************************
+ *
+ * Event unpacker for XTST_SUBEVENT_MEMBER_DATA12_RANGE.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// XTST_SUBEVENT_MEMBER_DATA12_RANGE()
+template<typename __data_src_t>
+void XTST_SUBEVENT_MEMBER_DATA12_RANGE::__unpack(__data_src_t &__buffer)
+{
+  // MEMBER(DATA12_RANGE mDATA12_RANGE);
+  // MEMBER(DATA12_RANGE mDATA12_RANGE_array[8]);
+  // MEMBER(DATA12_RANGE mDATA12_RANGE_array_zzp[8] ZERO_SUPPRESS);
+  // MEMBER(DATA12_RANGE mDATA12_RANGE_array_zzpii[8] ZERO_SUPPRESS_LIST);
+  // MEMBER(DATA12_RANGE mDATA12_RANGE_array_zzpml[8] ZERO_SUPPRESS_MULTI(4));
+  // MEMBER(DATA12_RANGE mDATA12_RANGE_array2[2][8]);
+  // MEMBER(DATA12_RANGE mDATA12_RANGE_array2_zzp[2][8] ZERO_SUPPRESS);
+  // MEMBER(DATA12_RANGE mDATA12_RANGE_array2_zzpii[2][8] ZERO_SUPPRESS_LIST);
+  // MEMBER(DATA12_RANGE mDATA12_RANGE_array2_zzpml[2][8] ZERO_SUPPRESS_MULTI(4));
+}
+FORCE_IMPL_DATA_SRC_FCN(void,XTST_SUBEVENT_MEMBER_DATA12_RANGE::__unpack);
+
+/** END_UNPACKER ******************************************************/
+/** BEGIN_UNPACKER *****************************************************
+ *
+ * Event unpacker for XTST_SUBEVENT_MEMBER_DATA16.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// XTST_SUBEVENT_MEMBER_DATA16()
+template<typename __data_src_t>
+void XTST_SUBEVENT_MEMBER_DATA16::__unpack(__data_src_t &__buffer)
+{
+  // MEMBER(DATA16 mDATA16);
+  // MEMBER(DATA16 mDATA16_array[8]);
+  // MEMBER(DATA16 mDATA16_array_zzp[8] ZERO_SUPPRESS);
+  // MEMBER(DATA16 mDATA16_array_zzpii[8] ZERO_SUPPRESS_LIST);
+  // MEMBER(DATA16 mDATA16_array_zzpml[8] ZERO_SUPPRESS_MULTI(4));
+  // MEMBER(DATA16 mDATA16_array2[2][8]);
+  // MEMBER(DATA16 mDATA16_array2_zzp[2][8] ZERO_SUPPRESS);
+  // MEMBER(DATA16 mDATA16_array2_zzpii[2][8] ZERO_SUPPRESS_LIST);
+  // MEMBER(DATA16 mDATA16_array2_zzpml[2][8] ZERO_SUPPRESS_MULTI(4));
+}
+FORCE_IMPL_DATA_SRC_FCN(void,XTST_SUBEVENT_MEMBER_DATA16::__unpack);
+
+/** END_UNPACKER ******************************************************/
+/** BEGIN_UNPACKER *****************************************************
+ *
+ * Event unpacker for XTST_SUBEVENT_MEMBER_DATA16_OVERFLOW.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// XTST_SUBEVENT_MEMBER_DATA16_OVERFLOW()
+template<typename __data_src_t>
+void XTST_SUBEVENT_MEMBER_DATA16_OVERFLOW::__unpack(__data_src_t &__buffer)
+{
+  // MEMBER(DATA16_OVERFLOW mDATA16_OVERFLOW);
+  // MEMBER(DATA16_OVERFLOW mDATA16_OVERFLOW_array[8]);
+  // MEMBER(DATA16_OVERFLOW mDATA16_OVERFLOW_array_zzp[8] ZERO_SUPPRESS);
+  // MEMBER(DATA16_OVERFLOW mDATA16_OVERFLOW_array_zzpii[8] ZERO_SUPPRESS_LIST);
+  // MEMBER(DATA16_OVERFLOW mDATA16_OVERFLOW_array_zzpml[8] ZERO_SUPPRESS_MULTI(4));
+  // MEMBER(DATA16_OVERFLOW mDATA16_OVERFLOW_array2[2][8]);
+  // MEMBER(DATA16_OVERFLOW mDATA16_OVERFLOW_array2_zzp[2][8] ZERO_SUPPRESS);
+  // MEMBER(DATA16_OVERFLOW mDATA16_OVERFLOW_array2_zzpii[2][8] ZERO_SUPPRESS_LIST);
+  // MEMBER(DATA16_OVERFLOW mDATA16_OVERFLOW_array2_zzpml[2][8] ZERO_SUPPRESS_MULTI(4));
+}
+FORCE_IMPL_DATA_SRC_FCN(void,XTST_SUBEVENT_MEMBER_DATA16_OVERFLOW::__unpack);
+
+/** END_UNPACKER ******************************************************/
+/** BEGIN_UNPACKER *****************************************************
+ *
+ * Event unpacker for XTST_SUBEVENT_MEMBER_DATA24.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// XTST_SUBEVENT_MEMBER_DATA24()
+template<typename __data_src_t>
+void XTST_SUBEVENT_MEMBER_DATA24::__unpack(__data_src_t &__buffer)
+{
+  // MEMBER(DATA24 mDATA24);
+  // MEMBER(DATA24 mDATA24_array[8]);
+  // MEMBER(DATA24 mDATA24_array_zzp[8] ZERO_SUPPRESS);
+  // MEMBER(DATA24 mDATA24_array_zzpii[8] ZERO_SUPPRESS_LIST);
+  // MEMBER(DATA24 mDATA24_array_zzpml[8] ZERO_SUPPRESS_MULTI(4));
+  // MEMBER(DATA24 mDATA24_array2[2][8]);
+  // MEMBER(DATA24 mDATA24_array2_zzp[2][8] ZERO_SUPPRESS);
+  // MEMBER(DATA24 mDATA24_array2_zzpii[2][8] ZERO_SUPPRESS_LIST);
+  // MEMBER(DATA24 mDATA24_array2_zzpml[2][8] ZERO_SUPPRESS_MULTI(4));
+}
+FORCE_IMPL_DATA_SRC_FCN(void,XTST_SUBEVENT_MEMBER_DATA24::__unpack);
+
+/** END_UNPACKER ******************************************************/
+/** BEGIN_UNPACKER *****************************************************
+ *
+ * Event unpacker for XTST_SUBEVENT_MEMBER_DATA32.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// XTST_SUBEVENT_MEMBER_DATA32()
+template<typename __data_src_t>
+void XTST_SUBEVENT_MEMBER_DATA32::__unpack(__data_src_t &__buffer)
+{
+  // MEMBER(DATA32 mDATA32);
+  // MEMBER(DATA32 mDATA32_array[8]);
+  // MEMBER(DATA32 mDATA32_array_zzp[8] ZERO_SUPPRESS);
+  // MEMBER(DATA32 mDATA32_array_zzpii[8] ZERO_SUPPRESS_LIST);
+  // MEMBER(DATA32 mDATA32_array_zzpml[8] ZERO_SUPPRESS_MULTI(4));
+  // MEMBER(DATA32 mDATA32_array2[2][8]);
+  // MEMBER(DATA32 mDATA32_array2_zzp[2][8] ZERO_SUPPRESS);
+  // MEMBER(DATA32 mDATA32_array2_zzpii[2][8] ZERO_SUPPRESS_LIST);
+  // MEMBER(DATA32 mDATA32_array2_zzpml[2][8] ZERO_SUPPRESS_MULTI(4));
+}
+FORCE_IMPL_DATA_SRC_FCN(void,XTST_SUBEVENT_MEMBER_DATA32::__unpack);
+
+/** END_UNPACKER ******************************************************/
+/** BEGIN_UNPACKER *****************************************************
+ *
+ * Event unpacker for XTST_SUBEVENT_MEMBER_DATA32_B.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// XTST_SUBEVENT_MEMBER_DATA32_B()
+template<typename __data_src_t>
+void XTST_SUBEVENT_MEMBER_DATA32_B::__unpack(__data_src_t &__buffer)
+{
+  // MEMBER(DATA32 mDATA32_array_zzpml[8] ZERO_SUPPRESS_MULTI(4));
+}
+FORCE_IMPL_DATA_SRC_FCN(void,XTST_SUBEVENT_MEMBER_DATA32_B::__unpack);
+
+/** END_UNPACKER ******************************************************/
+/** BEGIN_UNPACKER *****************************************************
+ *
+ * Event unpacker for XTST_SUBEVENT_MEMBER_DATA8.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// XTST_SUBEVENT_MEMBER_DATA8()
+template<typename __data_src_t>
+void XTST_SUBEVENT_MEMBER_DATA8::__unpack(__data_src_t &__buffer)
+{
+  // MEMBER(DATA8 mDATA8);
+  // MEMBER(DATA8 mDATA8_array[8]);
+  // MEMBER(DATA8 mDATA8_array_zzp[8] ZERO_SUPPRESS);
+  // MEMBER(DATA8 mDATA8_array_zzpii[8] ZERO_SUPPRESS_LIST);
+  // MEMBER(DATA8 mDATA8_array_zzpml[8] ZERO_SUPPRESS_MULTI(4));
+  // MEMBER(DATA8 mDATA8_array2[2][8]);
+  // MEMBER(DATA8 mDATA8_array2_zzp[2][8] ZERO_SUPPRESS);
+  // MEMBER(DATA8 mDATA8_array2_zzpii[2][8] ZERO_SUPPRESS_LIST);
+  // MEMBER(DATA8 mDATA8_array2_zzpml[2][8] ZERO_SUPPRESS_MULTI(4));
+}
+FORCE_IMPL_DATA_SRC_FCN(void,XTST_SUBEVENT_MEMBER_DATA8::__unpack);
+
+/** END_UNPACKER ******************************************************/
+/** BEGIN_UNPACKER *****************************************************
+ *
+ * Event unpacker for XTST_SUBEVENT_MEMBER_uint16.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// XTST_SUBEVENT_MEMBER_uint16()
+template<typename __data_src_t>
+void XTST_SUBEVENT_MEMBER_uint16::__unpack(__data_src_t &__buffer)
+{
+  // MEMBER(uint16 muint16);
+}
+FORCE_IMPL_DATA_SRC_FCN(void,XTST_SUBEVENT_MEMBER_uint16::__unpack);
+
+/** END_UNPACKER ******************************************************/
+/** BEGIN_UNPACKER *****************************************************
+ *
+ * Event unpacker for XTST_SUBEVENT_MEMBER_uint32.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// XTST_SUBEVENT_MEMBER_uint32()
+template<typename __data_src_t>
+void XTST_SUBEVENT_MEMBER_uint32::__unpack(__data_src_t &__buffer)
+{
+  // MEMBER(uint32 muint32);
+}
+FORCE_IMPL_DATA_SRC_FCN(void,XTST_SUBEVENT_MEMBER_uint32::__unpack);
+
+/** END_UNPACKER ******************************************************/
+/** BEGIN_UNPACKER *****************************************************
+ *
+ * Event unpacker for XTST_SUBEVENT_MEMBER_uint8.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// XTST_SUBEVENT_MEMBER_uint8()
+template<typename __data_src_t>
+void XTST_SUBEVENT_MEMBER_uint8::__unpack(__data_src_t &__buffer)
+{
+  // MEMBER(uint8 muint8);
+}
+FORCE_IMPL_DATA_SRC_FCN(void,XTST_SUBEVENT_MEMBER_uint8::__unpack);
+
+/** END_UNPACKER ******************************************************/
+/** BEGIN_UNPACKER *****************************************************
+ *
+ * Event unpacker for BITS64.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// SUBEVENT(BITS64)
+template<typename __data_src_t>
+void BITS64::__unpack(__data_src_t &__buffer)
+{
+  // MEMBER(DATA64 member64);
+  // MEMBER(DATA64 array64[7]);
+  // MEMBER(DATA32 member32);
+  // UINT32 data32_1;
+  READ_FROM_BUFFER(881,uint32 ,data32_1,102);
+  // UINT32 data32_2;
+  READ_FROM_BUFFER(882,uint32 ,data32_2,103);
+  // MARK_COUNT(start);
+  void *__mark_start = __buffer._data;
+  // UINT64 data64_1;
+  READ_FROM_BUFFER(886,uint64 ,data64_1,104);
+  // MARK_COUNT(end);
+  void *__mark_end = __buffer._data;
+  // CHECK_COUNT(data32_1,start,end,4,4)
+  CHECK_WORD_COUNT(889,data32_1,start,end,4,4);
+  // select several
+
+    // i[0] = ITEM64(num=0);
+    // i[1] = ITEM64(num=1);
+    // i[2] = ITEM64(num=2);
+  for ( ; ; )
+  {
+    if (__buffer.empty()) break;
+    int __match_no = 0;
+    // optimized match 1: ITEM64 i[0]: (s64) could not get bits
+    __buffer.peeking();
+    MATCH_DECL(893,__match_no,1,ITEM64,i[0],/*num*/0);
+    MATCH_DECL(894,__match_no,2,ITEM64,i[1],/*num*/1);
+    MATCH_DECL(895,__match_no,3,ITEM64,i[2],/*num*/2);
+    if (!__match_no) break;
+    switch (__match_no)
+    {
+      case 1:
+        MATCH_PROFILE_COUNT(893,i[0]);
+        UNPACK_DECL(893,ITEM64,i[0],/*num*/0);
+        break;
+      case 2:
+        MATCH_PROFILE_COUNT(894,i[1]);
+        UNPACK_DECL(894,ITEM64,i[1],/*num*/1);
+        break;
+      case 3:
+        MATCH_PROFILE_COUNT(895,i[2]);
+        UNPACK_DECL(895,ITEM64,i[2],/*num*/2);
+        break;
+    }
+  }
+}
+FORCE_IMPL_DATA_SRC_FCN(void,BITS64::__unpack);
+
+/** END_UNPACKER ******************************************************/
+/** BEGIN_UNPACKER *****************************************************
+ *
+ * Event unpacker for XTST_MDPP16.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// SUBEVENT(XTST_MDPP16)
+template<typename __data_src_t>
+void XTST_MDPP16::__unpack(__data_src_t &__buffer)
+{
+  // UINT16 align
+  // {
+    //  0_15: unaligned;
+  // }
+  READ_FROM_BUFFER_FULL(1051,uint16 ,align,align.u16,105);
+  // if(( ! align.unaligned))
+
+  if (( ! align.unaligned))
+  {
+    // UINT16 pad;
+    READ_FROM_BUFFER(1054,uint16 ,pad,106);
+  }
+  // select several
+
+    // mdpp16[0] = VME_MESYTEC_MDPP16(geom=1);
+    // mdpp16[1] = VME_MESYTEC_MDPP16(geom=2);
+  for ( ; ; )
+  {
+    if (__buffer.empty()) break;
+    int __match_no = 0;
+    // optimized match 1: VME_MESYTEC_MDPP16 mdpp16[0]: (s32) => (0xffff0000,0x40010000)
+    // optimized match 2: VME_MESYTEC_MDPP16 mdpp16[1]: (s32) => (0xffff0000,0x40020000)
+    {
+    uint32 __match_peek;
+    PEEK_FROM_BUFFER(1061,uint32,__match_peek);
+    // differ = 00030000 : 16 17
+    uint32 __match_index = 0 | /* 16,17 */ ((__match_peek >> 16) & 0x00000003);
+    static const sint8 __match_index_array[4] = { 0, 1, 2, 0, };
+    __match_no = __match_index_array[__match_index];
+    // last_subevent_item = 1
+    }
+    if (!__match_no) break;
+    switch (__match_no)
+    {
+      case 1:
+        MATCH_PROFILE_COUNT(1059,mdpp16[0]);
+        UNPACK_DECL(1059,VME_MESYTEC_MDPP16,mdpp16[0],/*geom*/1);
+        break;
+      case 2:
+        MATCH_PROFILE_COUNT(1060,mdpp16[1]);
+        UNPACK_DECL(1060,VME_MESYTEC_MDPP16,mdpp16[1],/*geom*/2);
+        break;
+    }
+  }
+}
+FORCE_IMPL_DATA_SRC_FCN(void,XTST_MDPP16::__unpack);
+
+/** END_UNPACKER ******************************************************/
+/** BEGIN_UNPACKER *****************************************************
+ *
+ * Event unpacker for XTST_PLAIN.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// SUBEVENT(XTST_PLAIN)
+template<typename __data_src_t>
+void XTST_PLAIN::__unpack(__data_src_t &__buffer)
+{
+  // UINT32 u;
+  READ_FROM_BUFFER(932,uint32 ,u,107);
+  // UINT16 s;
+  READ_FROM_BUFFER(933,uint16 ,s,108);
+  // UINT8 c;
+  READ_FROM_BUFFER(934,uint8  ,c,109);
+}
+FORCE_IMPL_DATA_SRC_FCN(void,XTST_PLAIN::__unpack);
+
+/** END_UNPACKER ******************************************************/
+/** BEGIN_UNPACKER *****************************************************
+ *
+ * Event unpacker for XTST_REGRESS.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// SUBEVENT(XTST_REGRESS)
+template<typename __data_src_t>
+void XTST_REGRESS::__unpack(__data_src_t &__buffer)
+{
+  // select several
+
+    // wr[1] = WR_STAMP(id=1);
+    // wr[2] = WR_STAMP(id=2);
+    // wr[3] = WR_STAMP(id=3);
+    // wr[4] = WR_STAMP(id=4);
+    // wr[5] = WR_STAMP(id=5);
+  for ( ; ; )
+  {
+    if (__buffer.empty()) break;
+    int __match_no = 0;
+    // optimized match 1: WR_STAMP wr[1]: (s32) => (0xfffeffff,0x00000100)
+    // optimized match 2: WR_STAMP wr[2]: (s32) => (0xfffeffff,0x00000200)
+    // optimized match 3: WR_STAMP wr[3]: (s32) => (0xfffeffff,0x00000300)
+    // optimized match 4: WR_STAMP wr[4]: (s32) => (0xfffeffff,0x00000400)
+    // optimized match 5: WR_STAMP wr[5]: (s32) => (0xfffeffff,0x00000500)
+    {
+    uint32 __match_peek;
+    PEEK_FROM_BUFFER(1002,uint32,__match_peek);
+    // differ = 00000700 : 8 9 10
+    uint32 __match_index = 0 | /* 8,10 */ ((__match_peek >> 8) & 0x00000007);
+    static const sint8 __match_index_array[8] = { 0, 1, 2, 3, 4, 5, 0, 0, };
+    __match_no = __match_index_array[__match_index];
+    // last_subevent_item = 0
+    }
+    if (!__match_no) break;
+    switch (__match_no)
+    {
+      case 1:
+        CHECK_SPURIOUS_MATCH_DECL(997,spurious_match_abort_loop_4,WR_STAMP,/*id*/1);
+        MATCH_PROFILE_COUNT(997,wr[1]);
+        UNPACK_DECL(997,WR_STAMP,wr[1],/*id*/1);
+        break;
+      case 2:
+        CHECK_SPURIOUS_MATCH_DECL(998,spurious_match_abort_loop_4,WR_STAMP,/*id*/2);
+        MATCH_PROFILE_COUNT(998,wr[2]);
+        UNPACK_DECL(998,WR_STAMP,wr[2],/*id*/2);
+        break;
+      case 3:
+        CHECK_SPURIOUS_MATCH_DECL(999,spurious_match_abort_loop_4,WR_STAMP,/*id*/3);
+        MATCH_PROFILE_COUNT(999,wr[3]);
+        UNPACK_DECL(999,WR_STAMP,wr[3],/*id*/3);
+        break;
+      case 4:
+        CHECK_SPURIOUS_MATCH_DECL(1000,spurious_match_abort_loop_4,WR_STAMP,/*id*/4);
+        MATCH_PROFILE_COUNT(1000,wr[4]);
+        UNPACK_DECL(1000,WR_STAMP,wr[4],/*id*/4);
+        break;
+      case 5:
+        CHECK_SPURIOUS_MATCH_DECL(1001,spurious_match_abort_loop_4,WR_STAMP,/*id*/5);
+        MATCH_PROFILE_COUNT(1001,wr[5]);
+        UNPACK_DECL(1001,WR_STAMP,wr[5],/*id*/5);
+        break;
+    }
+  }
+  spurious_match_abort_loop_4:;
+  // UINT32 separator1 NOENCODE
+  // {
+    //  0_31: 0;
+  // }
+  union
+  {
+    struct
+    {
+#if __BYTE_ORDER == __LITTLE_ENDIAN
+      uint32 unnamed_0_31 : 32; // 0..31
+#endif
+#if __BYTE_ORDER == __BIG_ENDIAN
+      uint32 unnamed_0_31 : 32; // 0..31
+#endif
+    };
+    uint32  u32;
+  } separator1;
+  READ_FROM_BUFFER_FULL(1007,uint32 ,separator1,separator1.u32,110);
+  CHECK_BITS_EQUAL(1006,separator1.unnamed_0_31,0);
+  // UINT32 seed;
+  READ_FROM_BUFFER(1009,uint32 ,seed,111);
+  // select several
+
+    // v775mod[0] = VME_CAEN_V775(geom=1,crate=127);
+    // v775mod[1] = VME_CAEN_V775(geom=2,crate=126);
+  for ( ; ; )
+  {
+    if (__buffer.empty()) break;
+    int __match_no = 0;
+    // optimized match 1: VME_CAEN_V775 v775mod[0]: (s32) => (0xffffc0ff,0x0a7f0000)
+    // optimized match 2: VME_CAEN_V775 v775mod[1]: (s32) => (0xffffc0ff,0x127e0000)
+    {
+    uint32 __match_peek;
+    PEEK_FROM_BUFFER(1015,uint32,__match_peek);
+    // differ = 18010000 : 16 27 28
+    uint32 __match_index = 0 | /* 16,16 */ ((__match_peek >> 16) & 0x00000001) | /* 27,28 */ ((__match_peek >> 26) & 0x00000006);
+    static const sint8 __match_index_array[8] = { 0, 0, 0, 1, 2, 0, 0, 0, };
+    __match_no = __match_index_array[__match_index];
+    // last_subevent_item = 0
+    }
+    if (!__match_no) break;
+    switch (__match_no)
+    {
+      case 1:
+        CHECK_SPURIOUS_MATCH_DECL(1013,spurious_match_abort_loop_5,VME_CAEN_V775,/*geom*/1,/*crate*/127);
+        MATCH_PROFILE_COUNT(1013,v775mod[0]);
+        UNPACK_DECL(1013,VME_CAEN_V775,v775mod[0],/*geom*/1,/*crate*/127);
+        break;
+      case 2:
+        CHECK_SPURIOUS_MATCH_DECL(1014,spurious_match_abort_loop_5,VME_CAEN_V775,/*geom*/2,/*crate*/126);
+        MATCH_PROFILE_COUNT(1014,v775mod[1]);
+        UNPACK_DECL(1014,VME_CAEN_V775,v775mod[1],/*geom*/2,/*crate*/126);
+        break;
+    }
+  }
+  spurious_match_abort_loop_5:;
+  // UINT32 separator2 NOENCODE
+  // {
+    //  0_31: 0;
+  // }
+  union
+  {
+    struct
+    {
+#if __BYTE_ORDER == __LITTLE_ENDIAN
+      uint32 unnamed_0_31 : 32; // 0..31
+#endif
+#if __BYTE_ORDER == __BIG_ENDIAN
+      uint32 unnamed_0_31 : 32; // 0..31
+#endif
+    };
+    uint32  u32;
+  } separator2;
+  READ_FROM_BUFFER_FULL(1020,uint32 ,separator2,separator2.u32,112);
+  CHECK_BITS_EQUAL(1019,separator2.unnamed_0_31,0);
+  // select several
+
+    // v1290mod[0] = VME_CAEN_V1290_SHORT(geom=1);
+    // v1290mod[1] = VME_CAEN_V1290_SHORT(geom=2);
+  for ( ; ; )
+  {
+    if (__buffer.empty()) break;
+    int __match_no = 0;
+    // optimized match 1: VME_CAEN_V1290_SHORT v1290mod[0]: (s32) => (0xf800001f,0x40000001)
+    // optimized match 2: VME_CAEN_V1290_SHORT v1290mod[1]: (s32) => (0xf800001f,0x40000002)
+    {
+    uint32 __match_peek;
+    PEEK_FROM_BUFFER(1026,uint32,__match_peek);
+    // differ = 00000003 : 0 1
+    uint32 __match_index = 0 | /* 0,1 */ ((__match_peek >> 0) & 0x00000003);
+    static const sint8 __match_index_array[4] = { 0, 1, 2, 0, };
+    __match_no = __match_index_array[__match_index];
+    // last_subevent_item = 0
+    }
+    if (!__match_no) break;
+    switch (__match_no)
+    {
+      case 1:
+        CHECK_SPURIOUS_MATCH_DECL(1024,spurious_match_abort_loop_6,VME_CAEN_V1290_SHORT,/*geom*/1);
+        MATCH_PROFILE_COUNT(1024,v1290mod[0]);
+        UNPACK_DECL(1024,VME_CAEN_V1290_SHORT,v1290mod[0],/*geom*/1);
+        break;
+      case 2:
+        CHECK_SPURIOUS_MATCH_DECL(1025,spurious_match_abort_loop_6,VME_CAEN_V1290_SHORT,/*geom*/2);
+        MATCH_PROFILE_COUNT(1025,v1290mod[1]);
+        UNPACK_DECL(1025,VME_CAEN_V1290_SHORT,v1290mod[1],/*geom*/2);
+        break;
+    }
+  }
+  spurious_match_abort_loop_6:;
+  // select several
+
+    // sticky_active = STICKY_ACTIVE();
+  for ( ; ; )
+  {
+    if (__buffer.empty()) break;
+    int __match_no = 0;
+    // optimized match 1: STICKY_ACTIVE sticky_active: (s32) => (0xffffffff,0x00000007)
+    {
+    uint32 __match_peek;
+    PEEK_FROM_BUFFER(1031,uint32,__match_peek);
+    // differ = 00000000 :
+    uint32 __match_index = 0;
+    static const sint8 __match_index_array[1] = { 1, };
+    __match_no = __match_index_array[__match_index];
+    // last_subevent_item = 1
+    }
+    if (!__match_no) break;
+    switch (__match_no)
+    {
+      case 1:
+        MATCH_PROFILE_COUNT(1030,sticky_active);
+        UNPACK_DECL(1030,STICKY_ACTIVE,sticky_active);
+        break;
+    }
+  }
+}
+FORCE_IMPL_DATA_SRC_FCN(void,XTST_REGRESS::__unpack);
+
+/** END_UNPACKER ******************************************************/
+/** BEGIN_UNPACKER *****************************************************
+ *
+ * Event unpacker for XTST_REGRESSEXTRA.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// SUBEVENT(XTST_REGRESSEXTRA)
+template<typename __data_src_t>
+void XTST_REGRESSEXTRA::__unpack(__data_src_t &__buffer)
+{
+  // UINT32 junk;
+  READ_FROM_BUFFER(1039,uint32 ,junk,113);
+}
+FORCE_IMPL_DATA_SRC_FCN(void,XTST_REGRESSEXTRA::__unpack);
+
+/** END_UNPACKER ******************************************************/
+/** BEGIN_UNPACKER *****************************************************
+ *
+ * Event unpacker for XTST_STICKY_CORR.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// SUBEVENT(XTST_STICKY_CORR)
+template<typename __data_src_t>
+void XTST_STICKY_CORR::__unpack(__data_src_t &__buffer)
+{
+  // UINT32 base;
+  READ_FROM_BUFFER(1265,uint32 ,base,114);
+}
+FORCE_IMPL_DATA_SRC_FCN(void,XTST_STICKY_CORR::__unpack);
+
+/** END_UNPACKER ******************************************************/
+/** BEGIN_UNPACKER *****************************************************
+ *
+ * Event unpacker for XTST_SUBEVENT_ME2.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// SUBEVENT(XTST_SUBEVENT_ME2)
+template<typename __data_src_t>
+void XTST_SUBEVENT_ME2::__unpack(__data_src_t &__buffer)
+{
+  // select several
+
+    // i[0] = ITEM_ME2(geom=0);
+    // i[1] = ITEM_ME2(geom=1);
+    // i[2] = ITEM_ME2(geom=2);
+  for ( ; ; )
+  {
+    if (__buffer.empty()) break;
+    int __match_no = 0;
+    // optimized match 1: ITEM_ME2 i[0]: (s32) optional could not get bits
+    __buffer.peeking();
+    MATCH_DECL(924,__match_no,1,ITEM_ME2,i[0],/*geom*/0);
+    MATCH_DECL(925,__match_no,2,ITEM_ME2,i[1],/*geom*/1);
+    MATCH_DECL(926,__match_no,3,ITEM_ME2,i[2],/*geom*/2);
+    if (!__match_no) break;
+    switch (__match_no)
+    {
+      case 1:
+        MATCH_PROFILE_COUNT(924,i[0]);
+        UNPACK_DECL(924,ITEM_ME2,i[0],/*geom*/0);
+        break;
+      case 2:
+        MATCH_PROFILE_COUNT(925,i[1]);
+        UNPACK_DECL(925,ITEM_ME2,i[1],/*geom*/1);
+        break;
+      case 3:
+        MATCH_PROFILE_COUNT(926,i[2]);
+        UNPACK_DECL(926,ITEM_ME2,i[2],/*geom*/2);
+        break;
+    }
+  }
+}
+FORCE_IMPL_DATA_SRC_FCN(void,XTST_SUBEVENT_ME2::__unpack);
+
+/** END_UNPACKER ******************************************************/
+/** BEGIN_UNPACKER *****************************************************
+ *
+ * Event unpacker for XTST_SUBEVENT_MEMBER_ENCODE.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// SUBEVENT(XTST_SUBEVENT_MEMBER_ENCODE)
+template<typename __data_src_t>
+void XTST_SUBEVENT_MEMBER_ENCODE::__unpack(__data_src_t &__buffer)
+{
+  // member_DATA32 = XTST_SUBEVENT_MEMBER_DATA32();
+  UNPACK_DECL(801,XTST_SUBEVENT_MEMBER_DATA32,member_DATA32);
+  // member_DATA24 = XTST_SUBEVENT_MEMBER_DATA24();
+  UNPACK_DECL(802,XTST_SUBEVENT_MEMBER_DATA24,member_DATA24);
+  // member_DATA16 = XTST_SUBEVENT_MEMBER_DATA16();
+  UNPACK_DECL(803,XTST_SUBEVENT_MEMBER_DATA16,member_DATA16);
+  // member_DATA16_OVERFLOW = XTST_SUBEVENT_MEMBER_DATA16_OVERFLOW();
+  UNPACK_DECL(804,XTST_SUBEVENT_MEMBER_DATA16_OVERFLOW,member_DATA16_OVERFLOW);
+  // member_DATA12 = XTST_SUBEVENT_MEMBER_DATA12();
+  UNPACK_DECL(805,XTST_SUBEVENT_MEMBER_DATA12,member_DATA12);
+  // member_DATA12_OVERFLOW = XTST_SUBEVENT_MEMBER_DATA12_OVERFLOW();
+  UNPACK_DECL(806,XTST_SUBEVENT_MEMBER_DATA12_OVERFLOW,member_DATA12_OVERFLOW);
+  // member_DATA12_RANGE = XTST_SUBEVENT_MEMBER_DATA12_RANGE();
+  UNPACK_DECL(807,XTST_SUBEVENT_MEMBER_DATA12_RANGE,member_DATA12_RANGE);
+  // member_uint32 = XTST_SUBEVENT_MEMBER_uint32();
+  UNPACK_DECL(809,XTST_SUBEVENT_MEMBER_uint32,member_uint32);
+  // member_uint16 = XTST_SUBEVENT_MEMBER_uint16();
+  UNPACK_DECL(810,XTST_SUBEVENT_MEMBER_uint16,member_uint16);
+  // member_uint8 = XTST_SUBEVENT_MEMBER_uint8();
+  UNPACK_DECL(811,XTST_SUBEVENT_MEMBER_uint8,member_uint8);
+}
+FORCE_IMPL_DATA_SRC_FCN(void,XTST_SUBEVENT_MEMBER_ENCODE::__unpack);
+
+/** END_UNPACKER ******************************************************/
+/** BEGIN_UNPACKER *****************************************************
+ *
+ * Event unpacker for XTST_SUBEVENT_MEMBER_ENCODE_A.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// SUBEVENT(XTST_SUBEVENT_MEMBER_ENCODE_A)
+template<typename __data_src_t>
+void XTST_SUBEVENT_MEMBER_ENCODE_A::__unpack(__data_src_t &__buffer)
+{
+  // d32 = XTST_SUBEVENT_MEMBER_DATA32();
+  UNPACK_DECL(818,XTST_SUBEVENT_MEMBER_DATA32,d32);
+}
+FORCE_IMPL_DATA_SRC_FCN(void,XTST_SUBEVENT_MEMBER_ENCODE_A::__unpack);
+
+/** END_UNPACKER ******************************************************/
+/** BEGIN_UNPACKER *****************************************************
+ *
+ * Event unpacker for XTST_SUBEVENT_MEMBER_ENCODE_B.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// SUBEVENT(XTST_SUBEVENT_MEMBER_ENCODE_B)
+template<typename __data_src_t>
+void XTST_SUBEVENT_MEMBER_ENCODE_B::__unpack(__data_src_t &__buffer)
+{
+  // d32 = XTST_SUBEVENT_MEMBER_DATA32_B();
+  UNPACK_DECL(823,XTST_SUBEVENT_MEMBER_DATA32_B,d32);
+}
+FORCE_IMPL_DATA_SRC_FCN(void,XTST_SUBEVENT_MEMBER_ENCODE_B::__unpack);
+
+/** END_UNPACKER ******************************************************/
+/** BEGIN_UNPACKER *****************************************************
+ *
+ * Event unpacker for XTST_VME.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// SUBEVENT(XTST_VME)
+template<typename __data_src_t>
+void XTST_VME::__unpack(__data_src_t &__buffer)
+{
+  // header = XTST_STD_VME();
+  UNPACK_DECL(765,XTST_STD_VME,header);
+  // sdm = SINGLE_DATA_MODULE();
+  UNPACK_DECL(767,SINGLE_DATA_MODULE,sdm);
+  // select several
+
+    // tdc0 = VME_CAEN_V775(geom=20,crate=20);
+    // tdc1 = VME_CAEN_V775(geom=21,crate=20);
+    // tdc2 = VME_CAEN_V775(geom=22,crate=20);
+    // qdc0 = VME_CAEN_V775(geom=21,crate=40);
+    // qdc1 = VME_CAEN_V775(geom=21,crate=40);
+  for ( ; ; )
+  {
+    if (__buffer.empty()) break;
+    int __match_no = 0;
+    // optimized match 1: VME_CAEN_V775 tdc0: (s32) => (0xffffc0ff,0xa2140000)
+    // optimized match 2: VME_CAEN_V775 tdc1: (s32) => (0xffffc0ff,0xaa140000)
+    // optimized match 3: VME_CAEN_V775 tdc2: (s32) => (0xffffc0ff,0xb2140000)
+    // optimized match 4: VME_CAEN_V775 qdc0: (s32) => (0xffffc0ff,0xaa280000)
+    // optimized match 5: VME_CAEN_V775 qdc1: (s32) => (0xffffc0ff,0xaa280000)
+    {
+    uint32 __match_peek;
+    PEEK_FROM_BUFFER(776,uint32,__match_peek);
+    // differ = 183c0000 : 18 19 20 21 27 28
+    uint32 __match_index = 0 | /* 18,21 */ ((__match_peek >> 18) & 0x0000000f) | /* 27,28 */ ((__match_peek >> 23) & 0x00000030);
+    static const sint8 __match_index_array[64] = { 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, /*4*//*5*/-1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, };
+    __match_no = __match_index_array[__match_index];
+    if (__match_no < 0)
+    {
+      switch (__match_no)
+      {
+        case -1:
+          __match_no = 0;
+          MATCH_DECL(774,__match_no,4,VME_CAEN_V775,qdc0,/*geom*/21,/*crate*/40);
+          MATCH_DECL(775,__match_no,5,VME_CAEN_V775,qdc1,/*geom*/21,/*crate*/40);
+          break;
+      }
+    }
+    // last_subevent_item = 0
+    }
+    if (!__match_no) break;
+    switch (__match_no)
+    {
+      case 1:
+        CHECK_SPURIOUS_MATCH_DECL(771,spurious_match_abort_loop_7,VME_CAEN_V775,/*geom*/20,/*crate*/20);
+        MATCH_PROFILE_COUNT(771,tdc0);
+        UNPACK_DECL(771,VME_CAEN_V775,tdc0,/*geom*/20,/*crate*/20);
+        break;
+      case 2:
+        CHECK_SPURIOUS_MATCH_DECL(772,spurious_match_abort_loop_7,VME_CAEN_V775,/*geom*/21,/*crate*/20);
+        MATCH_PROFILE_COUNT(772,tdc1);
+        UNPACK_DECL(772,VME_CAEN_V775,tdc1,/*geom*/21,/*crate*/20);
+        break;
+      case 3:
+        CHECK_SPURIOUS_MATCH_DECL(773,spurious_match_abort_loop_7,VME_CAEN_V775,/*geom*/22,/*crate*/20);
+        MATCH_PROFILE_COUNT(773,tdc2);
+        UNPACK_DECL(773,VME_CAEN_V775,tdc2,/*geom*/22,/*crate*/20);
+        break;
+      case 4:
+        CHECK_SPURIOUS_MATCH_DECL(774,spurious_match_abort_loop_7,VME_CAEN_V775,/*geom*/21,/*crate*/40);
+        MATCH_PROFILE_COUNT(774,qdc0);
+        UNPACK_DECL(774,VME_CAEN_V775,qdc0,/*geom*/21,/*crate*/40);
+        break;
+      case 5:
+        CHECK_SPURIOUS_MATCH_DECL(775,spurious_match_abort_loop_7,VME_CAEN_V775,/*geom*/21,/*crate*/40);
+        MATCH_PROFILE_COUNT(775,qdc1);
+        UNPACK_DECL(775,VME_CAEN_V775,qdc1,/*geom*/21,/*crate*/40);
+        break;
+    }
+  }
+  spurious_match_abort_loop_7:;
+  // select several
+
+    // mdpp16 = VME_MESYTEC_MDPP16(geom=31);
+  for ( ; ; )
+  {
+    if (__buffer.empty()) break;
+    int __match_no = 0;
+    // optimized match 1: VME_MESYTEC_MDPP16 mdpp16: (s32) => (0xffff0000,0x401f0000)
+    {
+    uint32 __match_peek;
+    PEEK_FROM_BUFFER(780,uint32,__match_peek);
+    // differ = 00000000 :
+    uint32 __match_index = 0;
+    static const sint8 __match_index_array[1] = { 1, };
+    __match_no = __match_index_array[__match_index];
+    // last_subevent_item = 1
+    }
+    if (!__match_no) break;
+    switch (__match_no)
+    {
+      case 1:
+        MATCH_PROFILE_COUNT(779,mdpp16);
+        UNPACK_DECL(779,VME_MESYTEC_MDPP16,mdpp16,/*geom*/31);
+        break;
+    }
+  }
+}
+FORCE_IMPL_DATA_SRC_FCN(void,XTST_VME::__unpack);
+
+/** END_UNPACKER ******************************************************/
+/** BEGIN_UNPACKER *****************************************************
+ *
+ * Event unpacker for EVENT.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// EVENT
+template<typename __data_src_t>
+int unpack_event::__unpack_subevent(subevent_header *__header,__data_src_t &__buffer)
+  // vme = XTST_VME(type=36,subtype=0xc1c);
+  // bits64 = BITS64(type=64,subtype=64);
+  // me = XTST_SUBEVENT_MEMBER_ENCODE(type=10);
+  // mea = XTST_SUBEVENT_MEMBER_ENCODE_A(type=12);
+  // meb = XTST_SUBEVENT_MEMBER_ENCODE_B(type=13);
+  // me2 = XTST_SUBEVENT_ME2(type=11);
+  // plain = XTST_PLAIN(type=12);
+  // regress[0] = XTST_REGRESS(type=0xcae,subtype=0xcae,subcrate=0);
+  // regress[1] = XTST_REGRESS(type=0xcae,subtype=0xcae,subcrate=1);
+  // regress[2] = XTST_REGRESS(type=0xcae,subtype=0xcae,subcrate=2);
+  // regress[3] = XTST_REGRESS(type=0xcae,subtype=0xcae,subcrate=3);
+  // regress[4] = XTST_REGRESS(type=0xcae,subtype=0xcae,subcrate=4);
+  // regress[5] = XTST_REGRESS(type=0xcae,subtype=0xcae,subcrate=5);
+  // regress[6] = XTST_REGRESS(type=0xcae,subtype=0xcae,subcrate=6);
+  // regress[7] = XTST_REGRESS(type=0xcae,subtype=0xcae,subcrate=7);
+  // regress[8] = XTST_REGRESS(type=0xcae,subtype=0xcae,subcrate=8);
+  // regress[9] = XTST_REGRESS(type=0xcae,subtype=0xcae,subcrate=9);
+  // regress[10] = XTST_REGRESS(type=0xcae,subtype=0xcae,subcrate=10);
+  // regress[11] = XTST_REGRESS(type=0xcae,subtype=0xcae,subcrate=11);
+  // regress[12] = XTST_REGRESS(type=0xcae,subtype=0xcae,subcrate=12);
+  // regress[13] = XTST_REGRESS(type=0xcae,subtype=0xcae,subcrate=13);
+  // regress[14] = XTST_REGRESS(type=0xcae,subtype=0xcae,subcrate=14);
+  // regress[15] = XTST_REGRESS(type=0xcae,subtype=0xcae,subcrate=15);
+  // regressextra = XTST_REGRESSEXTRA(type=0xde0,subtype=0xad0);
+  // mdpp = XTST_MDPP16(type=0xbd0,subtype=22);
+{
+  int __match_no = 0;
+  SUBEVENT_MATCH_CACHE_LOOKUP(__match_no)
+  {
+    MATCH_SUBEVENT_DECL(1066,__match_no,1,((VES10_1_type==36)&&(VES10_1_subtype==0xc1c)),vme);
+    MATCH_SUBEVENT_DECL(1068,__match_no,2,((VES10_1_type==64)&&(VES10_1_subtype==64)),bits64);
+    MATCH_SUBEVENT_DECL(1070,__match_no,3,((VES10_1_type==10)),me);
+    MATCH_SUBEVENT_DECL(1072,__match_no,4,((VES10_1_type==12)),mea);
+    MATCH_SUBEVENT_DECL(1074,__match_no,5,((VES10_1_type==13)),meb);
+    MATCH_SUBEVENT_DECL(1076,__match_no,6,((VES10_1_type==11)),me2);
+    MATCH_SUBEVENT_DECL(1078,__match_no,7,((VES10_1_type==12)),plain);
+    MATCH_SUBEVENT_DECL(1080,__match_no,8,((VES10_1_type==0xcae)&&(VES10_1_subtype==0xcae)&&(VES10_1_subcrate==0)),regress[0]);
+    MATCH_SUBEVENT_DECL(1081,__match_no,9,((VES10_1_type==0xcae)&&(VES10_1_subtype==0xcae)&&(VES10_1_subcrate==1)),regress[1]);
+    MATCH_SUBEVENT_DECL(1082,__match_no,10,((VES10_1_type==0xcae)&&(VES10_1_subtype==0xcae)&&(VES10_1_subcrate==2)),regress[2]);
+    MATCH_SUBEVENT_DECL(1083,__match_no,11,((VES10_1_type==0xcae)&&(VES10_1_subtype==0xcae)&&(VES10_1_subcrate==3)),regress[3]);
+    MATCH_SUBEVENT_DECL(1084,__match_no,12,((VES10_1_type==0xcae)&&(VES10_1_subtype==0xcae)&&(VES10_1_subcrate==4)),regress[4]);
+    MATCH_SUBEVENT_DECL(1085,__match_no,13,((VES10_1_type==0xcae)&&(VES10_1_subtype==0xcae)&&(VES10_1_subcrate==5)),regress[5]);
+    MATCH_SUBEVENT_DECL(1086,__match_no,14,((VES10_1_type==0xcae)&&(VES10_1_subtype==0xcae)&&(VES10_1_subcrate==6)),regress[6]);
+    MATCH_SUBEVENT_DECL(1087,__match_no,15,((VES10_1_type==0xcae)&&(VES10_1_subtype==0xcae)&&(VES10_1_subcrate==7)),regress[7]);
+    MATCH_SUBEVENT_DECL(1088,__match_no,16,((VES10_1_type==0xcae)&&(VES10_1_subtype==0xcae)&&(VES10_1_subcrate==8)),regress[8]);
+    MATCH_SUBEVENT_DECL(1089,__match_no,17,((VES10_1_type==0xcae)&&(VES10_1_subtype==0xcae)&&(VES10_1_subcrate==9)),regress[9]);
+    MATCH_SUBEVENT_DECL(1090,__match_no,18,((VES10_1_type==0xcae)&&(VES10_1_subtype==0xcae)&&(VES10_1_subcrate==10)),regress[10]);
+    MATCH_SUBEVENT_DECL(1091,__match_no,19,((VES10_1_type==0xcae)&&(VES10_1_subtype==0xcae)&&(VES10_1_subcrate==11)),regress[11]);
+    MATCH_SUBEVENT_DECL(1092,__match_no,20,((VES10_1_type==0xcae)&&(VES10_1_subtype==0xcae)&&(VES10_1_subcrate==12)),regress[12]);
+    MATCH_SUBEVENT_DECL(1093,__match_no,21,((VES10_1_type==0xcae)&&(VES10_1_subtype==0xcae)&&(VES10_1_subcrate==13)),regress[13]);
+    MATCH_SUBEVENT_DECL(1094,__match_no,22,((VES10_1_type==0xcae)&&(VES10_1_subtype==0xcae)&&(VES10_1_subcrate==14)),regress[14]);
+    MATCH_SUBEVENT_DECL(1095,__match_no,23,((VES10_1_type==0xcae)&&(VES10_1_subtype==0xcae)&&(VES10_1_subcrate==15)),regress[15]);
+    MATCH_SUBEVENT_DECL(1097,__match_no,24,((VES10_1_type==0xde0)&&(VES10_1_subtype==0xad0)),regressextra);
+    MATCH_SUBEVENT_DECL(1099,__match_no,25,((VES10_1_type==0xbd0)&&(VES10_1_subtype==22)),mdpp);
+    SUBEVENT_MATCH_CACHE_STORE(__match_no);
+  }
+  if (!__match_no) return 0;
+  switch (__match_no)
+  {
+    case 1:
+      UNPACK_SUBEVENT_CHECK_NO_REVISIT(1066,XTST_VME,vme,0);
+      UNPACK_SUBEVENT_DECL(1066,0,XTST_VME,vme);
+      break;
+    case 2:
+      UNPACK_SUBEVENT_CHECK_NO_REVISIT(1068,BITS64,bits64,1);
+      UNPACK_SUBEVENT_DECL(1068,0,BITS64,bits64);
+      break;
+    case 3:
+      UNPACK_SUBEVENT_CHECK_NO_REVISIT(1070,XTST_SUBEVENT_MEMBER_ENCODE,me,2);
+      UNPACK_SUBEVENT_DECL(1070,0,XTST_SUBEVENT_MEMBER_ENCODE,me);
+      break;
+    case 4:
+      UNPACK_SUBEVENT_CHECK_NO_REVISIT(1072,XTST_SUBEVENT_MEMBER_ENCODE_A,mea,3);
+      UNPACK_SUBEVENT_DECL(1072,0,XTST_SUBEVENT_MEMBER_ENCODE_A,mea);
+      break;
+    case 5:
+      UNPACK_SUBEVENT_CHECK_NO_REVISIT(1074,XTST_SUBEVENT_MEMBER_ENCODE_B,meb,4);
+      UNPACK_SUBEVENT_DECL(1074,0,XTST_SUBEVENT_MEMBER_ENCODE_B,meb);
+      break;
+    case 6:
+      UNPACK_SUBEVENT_CHECK_NO_REVISIT(1076,XTST_SUBEVENT_ME2,me2,5);
+      UNPACK_SUBEVENT_DECL(1076,0,XTST_SUBEVENT_ME2,me2);
+      break;
+    case 7:
+      UNPACK_SUBEVENT_CHECK_NO_REVISIT(1078,XTST_PLAIN,plain,6);
+      UNPACK_SUBEVENT_DECL(1078,0,XTST_PLAIN,plain);
+      break;
+    case 8:
+      UNPACK_SUBEVENT_CHECK_NO_REVISIT(1080,XTST_REGRESS,regress[0],7);
+      UNPACK_SUBEVENT_DECL(1080,0,XTST_REGRESS,regress[0]);
+      break;
+    case 9:
+      UNPACK_SUBEVENT_CHECK_NO_REVISIT(1081,XTST_REGRESS,regress[1],8);
+      UNPACK_SUBEVENT_DECL(1081,0,XTST_REGRESS,regress[1]);
+      break;
+    case 10:
+      UNPACK_SUBEVENT_CHECK_NO_REVISIT(1082,XTST_REGRESS,regress[2],9);
+      UNPACK_SUBEVENT_DECL(1082,0,XTST_REGRESS,regress[2]);
+      break;
+    case 11:
+      UNPACK_SUBEVENT_CHECK_NO_REVISIT(1083,XTST_REGRESS,regress[3],10);
+      UNPACK_SUBEVENT_DECL(1083,0,XTST_REGRESS,regress[3]);
+      break;
+    case 12:
+      UNPACK_SUBEVENT_CHECK_NO_REVISIT(1084,XTST_REGRESS,regress[4],11);
+      UNPACK_SUBEVENT_DECL(1084,0,XTST_REGRESS,regress[4]);
+      break;
+    case 13:
+      UNPACK_SUBEVENT_CHECK_NO_REVISIT(1085,XTST_REGRESS,regress[5],12);
+      UNPACK_SUBEVENT_DECL(1085,0,XTST_REGRESS,regress[5]);
+      break;
+    case 14:
+      UNPACK_SUBEVENT_CHECK_NO_REVISIT(1086,XTST_REGRESS,regress[6],13);
+      UNPACK_SUBEVENT_DECL(1086,0,XTST_REGRESS,regress[6]);
+      break;
+    case 15:
+      UNPACK_SUBEVENT_CHECK_NO_REVISIT(1087,XTST_REGRESS,regress[7],14);
+      UNPACK_SUBEVENT_DECL(1087,0,XTST_REGRESS,regress[7]);
+      break;
+    case 16:
+      UNPACK_SUBEVENT_CHECK_NO_REVISIT(1088,XTST_REGRESS,regress[8],15);
+      UNPACK_SUBEVENT_DECL(1088,0,XTST_REGRESS,regress[8]);
+      break;
+    case 17:
+      UNPACK_SUBEVENT_CHECK_NO_REVISIT(1089,XTST_REGRESS,regress[9],16);
+      UNPACK_SUBEVENT_DECL(1089,0,XTST_REGRESS,regress[9]);
+      break;
+    case 18:
+      UNPACK_SUBEVENT_CHECK_NO_REVISIT(1090,XTST_REGRESS,regress[10],17);
+      UNPACK_SUBEVENT_DECL(1090,0,XTST_REGRESS,regress[10]);
+      break;
+    case 19:
+      UNPACK_SUBEVENT_CHECK_NO_REVISIT(1091,XTST_REGRESS,regress[11],18);
+      UNPACK_SUBEVENT_DECL(1091,0,XTST_REGRESS,regress[11]);
+      break;
+    case 20:
+      UNPACK_SUBEVENT_CHECK_NO_REVISIT(1092,XTST_REGRESS,regress[12],19);
+      UNPACK_SUBEVENT_DECL(1092,0,XTST_REGRESS,regress[12]);
+      break;
+    case 21:
+      UNPACK_SUBEVENT_CHECK_NO_REVISIT(1093,XTST_REGRESS,regress[13],20);
+      UNPACK_SUBEVENT_DECL(1093,0,XTST_REGRESS,regress[13]);
+      break;
+    case 22:
+      UNPACK_SUBEVENT_CHECK_NO_REVISIT(1094,XTST_REGRESS,regress[14],21);
+      UNPACK_SUBEVENT_DECL(1094,0,XTST_REGRESS,regress[14]);
+      break;
+    case 23:
+      UNPACK_SUBEVENT_CHECK_NO_REVISIT(1095,XTST_REGRESS,regress[15],22);
+      UNPACK_SUBEVENT_DECL(1095,0,XTST_REGRESS,regress[15]);
+      break;
+    case 24:
+      UNPACK_SUBEVENT_CHECK_NO_REVISIT(1097,XTST_REGRESSEXTRA,regressextra,23);
+      UNPACK_SUBEVENT_DECL(1097,0,XTST_REGRESSEXTRA,regressextra);
+      break;
+    case 25:
+      UNPACK_SUBEVENT_CHECK_NO_REVISIT(1099,XTST_MDPP16,mdpp,24);
+      UNPACK_SUBEVENT_DECL(1099,0,XTST_MDPP16,mdpp);
+      break;
+  }
+  return 0;
+}
+FORCE_IMPL_DATA_SRC_FCN_HDR(int,unpack_event::__unpack_subevent);
+
+/** END_UNPACKER ******************************************************/
+/** BEGIN_UNPACKER *****************************************************
+ *
+ * Event unpacker for EVENT.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// STICKY_EVENT
+template<typename __data_src_t>
+int unpack_sticky_event::__unpack_subevent(subevent_header *__header,__data_src_t &__buffer)
+  // corr = XTST_STICKY_CORR(type=0xcae,subtype=0xcaf);
+  // ignore_unknown_subevent;
+{
+  int __match_no = 0;
+  SUBEVENT_MATCH_CACHE_LOOKUP(__match_no)
+  {
+    MATCH_SUBEVENT_DECL(1270,__match_no,1,((VES10_1_type==0xcae)&&(VES10_1_subtype==0xcaf)),corr);
+    SUBEVENT_MATCH_CACHE_STORE(__match_no);
+  }
+  if (!__match_no) return 0;
+  switch (__match_no)
+  {
+    case 1:
+      UNPACK_SUBEVENT_CHECK_NO_REVISIT(1270,XTST_STICKY_CORR,corr,0);
+      UNPACK_SUBEVENT_DECL(1270,1,XTST_STICKY_CORR,corr);
+      break;
+  }
+  return 0;
+}
+FORCE_IMPL_DATA_SRC_FCN_HDR(int,unpack_sticky_event::__unpack_subevent);
+
+/** END_UNPACKER ******************************************************/
+/** BEGIN_UNPACKER_DEFINES *********************************************
+ *
+ * Control
+ *
+ * Do not edit - automatically generated.
+ */
+
+#define STICKY_EVENT_IS_NONTRIVIAL  1
+
+
+/** END_UNPACKER_DEFINES **********************************************/
+/** BEGIN_UNPACKER_DEFINES *********************************************
+ *
+ * Data item sizes
+ *
+ * Do not edit - automatically generated.
+ */
+
+#define UNPACK_HAS_DATA64  1
+
+
+/** END_UNPACKER_DEFINES **********************************************/
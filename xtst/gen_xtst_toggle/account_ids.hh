@@ -0,0 +1,101 @@
+/** BEGIN_ACCOUNT_IDS **************************************************
+ *
+ * Structure and identifier for raw data items.
+ *
+ * Do not edit - automatically generated.
+ */
+
+account_id _account_ids[] =
+{ 
+  { 0, "CAMAC_LECROY_4434", "ch_data" },
+  { 1, "CAMAC_LECROY_4434", "ch_data" },
+  { 2, "CAMAC_PHILLIPS_7164", "ch_data" },
+  { 3, "CAMAC_PHILLIPS_7164", "ch_data" },
+  { 4, "CAMAC_PHILLIPS_7164", "ch_data" },
+  { 5, "CAMAC_PHILLIPS_7164", "ch_data" },
+  { 6, "CAMAC_SILENA_4418", "ch_data" },
+  { 7, "CAMAC_SILENA_4418", "ch_data" },
+  { 8, "CAMAC_SILENA_4418", "ch_data" },
+  { 9, "CAMAC_SILENA_4418", "ch_data" },
+  { 10, "FASTBUS_LECROY_1875", "ch_data" },
+  { 11, "FASTBUS_LECROY_1875", "ch_data" },
+  { 12, "FASTBUS_LECROY_1885", "ch_data" },
+  { 13, "FASTBUS_LECROY_1885", "ch_data" },
+  { 14, "ROLLING_TRLO_EVENT_TRIGGER", "time_lo" },
+  { 15, "ROLLING_TRLO_EVENT_TRIGGER", "time_hi" },
+  { 16, "ROLLING_TRLO_EVENT_TRIGGER", "status" },
+  { 17, "ROLLING_TRLO_EVENT_TRIGGER", "time_lo" },
+  { 18, "SINGLE_DATA_MODULE", "data" },
+  { 19, "SINGLE_DATA_MODULE", "data" },
+  { 20, "TRLO_SHADOW_MULTI_TRIGGERS", "header" },
+  { 21, "TRLO_SHADOW_MULTI_TRIGGERS", "header" },
+  { 22, "VME_CAEN_V1190_SUBTDC", "header" },
+  { 23, "VME_CAEN_V1190_SUBTDC", "ch_data" },
+  { 24, "VME_CAEN_V1190_SUBTDC", "error_flags" },
+  { 25, "VME_CAEN_V1190_SUBTDC", "trailer" },
+  { 26, "VME_CAEN_V1190_SUBTDC", "header" },
+  { 27, "VME_CAEN_V1190", "header" },
+  { 28, "VME_CAEN_V1190", "trigger" },
+  { 29, "VME_CAEN_V1190", "trailer" },
+  { 30, "VME_CAEN_V1190", "header" },
+  { 31, "VME_CAEN_V1190_SHORT_SUBTDC", "ch_data" },
+  { 32, "VME_CAEN_V1190_SHORT_SUBTDC", "ch_data" },
+  { 33, "VME_CAEN_V1190_SHORT_SUBTDC_ERROR", "error_flags" },
+  { 34, "VME_CAEN_V1190_SHORT_SUBTDC_ERROR", "error_flags" },
+  { 35, "VME_CAEN_V1190_SHORT", "header" },
+  { 36, "VME_CAEN_V1190_SHORT", "trigger" },
+  { 37, "VME_CAEN_V1190_SHORT", "trailer" },
+  { 38, "VME_CAEN_V1190_SHORT", "header" },
+  { 39, "VME_CAEN_V1290_SUBTDC", "header" },
+  { 40, "VME_CAEN_V1290_SUBTDC", "ch_data" },
+  { 41, "VME_CAEN_V1290_SUBTDC", "error_flags" },
+  { 42, "VME_CAEN_V1290_SUBTDC", "trailer" },
+  { 43, "VME_CAEN_V1290_SUBTDC", "header" },
+  { 44, "VME_CAEN_V1290", "header" },
+  { 45, "VME_CAEN_V1290", "trigger" },
+  { 46, "VME_CAEN_V1290", "trailer" },
+  { 47, "VME_CAEN_V1290", "header" },
+  { 48, "VME_CAEN_V1290_SHORT_SUBTDC", "ch_data" },
+  { 49, "VME_CAEN_V1290_SHORT_SUBTDC", "ch_data" },
+  { 50, "VME_CAEN_V1290_SHORT_SUBTDC_ERROR", "error_flags" },
+  { 51, "VME_CAEN_V1290_SHORT_SUBTDC_ERROR", "error_flags" },
+  { 52, "VME_CAEN_V1290_SHORT", "header" },
+  { 53, "VME_CAEN_V1290_SHORT", "trigger" },
+  { 54, "VME_CAEN_V1290_SHORT", "trailer" },
+  { 55, "VME_CAEN_V1290_SHORT", "header" },
+  { 56, "VME_CAEN_V775", "header" },
+  { 57, "VME_CAEN_V775", "ch_data" },
+  { 58, "VME_CAEN_V775", "eob" },
+  { 59, "VME_CAEN_V775", "header" },
+  { 60, "VME_CAEN_V830", "header" },
+  { 61, "VME_CAEN_V830", "ch_data" },
+  { 62, "VME_CAEN_V830", "header" },
+  { 63, "VME_MESYTEC_MADC32", "header" },
+  { 64, "VME_MESYTEC_MADC32", "ch_data" },
+  { 65, "VME_MESYTEC_MADC32", "filler" },
+  { 66, "VME_MESYTEC_MADC32", "end_of_event" },
+  { 67, "VME_MESYTEC_MADC32", "header" },
+  { 68, "VME_MESYTEC_MDPP16", "header" },
+  { 69, "VME_MESYTEC_MDPP16", "ch_data" },
+  { 70, "VME_MESYTEC_MDPP16", "fill_word" },
+  { 71, "VME_MESYTEC_MDPP16", "end_of_event" },
+  { 72, "VME_MESYTEC_MDPP16", "header" },
+  { 73, "XTST_STD_VME", "failure" },
+  { 74, "XTST_STD_VME", "time_stamp" },
+  { 75, "XTST_STD_VME", "multi_events" },
+  { 76, "XTST_STD_VME", "multi_scaler_counter0" },
+  { 77, "XTST_STD_VME", "multi_adctdc_counter0" },
+  { 78, "XTST_STD_VME", "failure" },
+  { 79, "XTST_TGL_STD_VME", "separator" },
+  { 80, "XTST_TGL_STD_VME", "multi_events" },
+  { 81, "XTST_TGL_STD_VME", "multi_adctdc_counter0" },
+  { 82, "XTST_TGL_STD_VME", "toggle" },
+  { 83, "XTST_TGL_STD_VME", "separator" },
+  { 84, "XTST_VME_TOGGLE", "separator1" },
+  { 85, "XTST_VME_TOGGLE", "seed" },
+  { 86, "XTST_VME_TOGGLE", "separator2" },
+};
+
+#define NUM_ACCOUNT_IDS  87
+
+/** END_ACCOUNT_IDS ***************************************************/
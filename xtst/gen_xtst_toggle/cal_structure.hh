@@ -0,0 +1,38 @@
+/** BEGIN_EVENT_CAL_STRUCTURE ******************************************
+ *
+ * Event data structure.
+ *
+ * Do not edit - automatically generated.
+ */
+
+//DUMPY: 2 0
+//DUMPY: 32 0
+class cal_event_MOD
+{
+public:
+  float T;
+
+public:
+#ifndef __PSDC__
+  STRUCT_FCNS_DECL(cal_event_MOD);
+#endif//!__PSDC__
+} ;
+
+class cal_event : public cal_event_base
+{
+public:
+//DUMPY: 2 0
+//DUMPY: 32 0
+  cal_event_MOD
+  /* {
+  public:
+    float T;
+  } */ MOD[2][32];
+
+public:
+#ifndef __PSDC__
+  STRUCT_FCNS_DECL(cal_event);
+#endif//!__PSDC__
+} ;
+
+/** END_EVENT_CAL_STRUCTURE *******************************************/
@@ -0,0 +1,11 @@
+class cal_event_MOD
+{
+  float T;
+  STRUCT_FCNS_DECL(cal_event_MOD);
+} ;
+class cal_event : public cal_event_base
+{
+  cal_event_MOD
+       MOD[2][32];
+  STRUCT_FCNS_DECL(cal_event);
+} ;
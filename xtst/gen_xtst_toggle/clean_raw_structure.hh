@@ -0,0 +1,15 @@
+class raw_event_MOD
+{
+  DATA12 T;
+  STRUCT_FCNS_DECL(raw_event_MOD);
+} ;
+class raw_event : public raw_event_base
+{
+  raw_event_MOD
+       MOD[2][32];
+  STRUCT_FCNS_DECL(raw_event);
+} ;
+class raw_sticky : public raw_sticky_base
+{
+  STRUCT_FCNS_DECL(raw_sticky);
+} ;
@@ -0,0 +1,605 @@
+class CAMAC_LECROY_4434
+{
+  raw_array_zero_suppress<DATA24,DATA24,32> data;
+template<typename __data_src_t>
+  void __unpack(__data_src_t &__buffer,uint32 channels);
+template<typename __data_src_t>
+  static bool __match(__data_src_t &__buffer,uint32 channels);
+  STRUCT_FCNS_DECL(CAMAC_LECROY_4434);
+};
+class CAMAC_PHILLIPS_7164
+{
+  raw_array_zero_suppress<DATA12,DATA12,16> data;
+template<typename __data_src_t>
+  void __unpack(__data_src_t &__buffer,uint32 channels,uint32 mark_channel_no);
+template<typename __data_src_t>
+  static bool __match(__data_src_t &__buffer,uint32 channels,uint32 mark_channel_no);
+  STRUCT_FCNS_DECL(CAMAC_PHILLIPS_7164);
+};
+class CAMAC_SILENA_4418
+{
+  raw_array_zero_suppress<DATA12_OVERFLOW,DATA12_OVERFLOW,8> data;
+template<typename __data_src_t>
+  void __unpack(__data_src_t &__buffer,uint32 channels,uint32 mark_channel_no);
+template<typename __data_src_t>
+  static bool __match(__data_src_t &__buffer,uint32 channels,uint32 mark_channel_no);
+  STRUCT_FCNS_DECL(CAMAC_SILENA_4418);
+};
+class FASTBUS_LECROY_1875
+{
+  raw_array_zero_suppress<DATA12_RANGE,DATA12_RANGE,64> data;
+template<typename __data_src_t>
+  void __unpack(__data_src_t &__buffer,uint32 geom,uint32 channels);
+template<typename __data_src_t>
+  static bool __match(__data_src_t &__buffer,uint32 geom,uint32 channels);
+  STRUCT_FCNS_DECL(FASTBUS_LECROY_1875);
+};
+class FASTBUS_LECROY_1885
+{
+  raw_array_zero_suppress<DATA12_RANGE,DATA12_RANGE,96> data;
+template<typename __data_src_t>
+  void __unpack(__data_src_t &__buffer,uint32 geom,uint32 channels);
+template<typename __data_src_t>
+  static bool __match(__data_src_t &__buffer,uint32 geom,uint32 channels);
+  STRUCT_FCNS_DECL(FASTBUS_LECROY_1885);
+};
+class ROLLING_TRLO_EVENT_TRIGGER
+{
+  DATA32 lo;
+  DATA32 hi;
+  DATA32 tpat;
+  union
+  {
+    struct
+    {
+      uint32 tpat : 24;
+      uint32 trig : 4;
+      uint32 count : 4;
+    };
+    uint32 u32;
+  } status;
+template<typename __data_src_t>
+  void __unpack(__data_src_t &__buffer);
+template<typename __data_src_t>
+  static bool __match(__data_src_t &__buffer);
+  STRUCT_FCNS_DECL(ROLLING_TRLO_EVENT_TRIGGER);
+};
+class SINGLE_DATA_MODULE
+{
+  uint32 data;
+template<typename __data_src_t>
+  void __unpack(__data_src_t &__buffer);
+template<typename __data_src_t>
+  static bool __match(__data_src_t &__buffer);
+  STRUCT_FCNS_DECL(SINGLE_DATA_MODULE);
+};
+class TRLO_SHADOW_MULTI_TRIGGERS
+{
+  union
+  {
+    struct
+    {
+      uint32 events : 17;
+      uint32 dummy_17_23 : 7;
+      uint32 unnamed_24_31 : 8;
+    };
+    uint32 u32;
+  } header;
+    MULTI(ROLLING_TRLO_EVENT_TRIGGER,events);
+template<typename __data_src_t>
+  void __unpack(__data_src_t &__buffer);
+template<typename __data_src_t>
+  static bool __match(__data_src_t &__buffer);
+  STRUCT_FCNS_DECL(TRLO_SHADOW_MULTI_TRIGGERS);
+};
+class VME_CAEN_V1190_SUBTDC
+{
+  union
+  {
+    struct
+    {
+      uint32 bunch_id : 12;
+      uint32 event_id : 12;
+      uint32 tdc : 2;
+      uint32 dummy_26 : 1;
+      uint32 unnamed_27_31 : 5;
+    };
+    uint32 u32;
+  } header;
+  union
+  {
+    struct
+    {
+      uint32 flags : 15;
+      uint32 dummy_15_23 : 9;
+      uint32 tdc : 2;
+      uint32 dummy_26 : 1;
+      uint32 unnamed_27_31 : 5;
+    };
+    uint32 u32;
+  } error_flags;
+  union
+  {
+    struct
+    {
+      uint32 word_count : 12;
+      uint32 event_id : 12;
+      uint32 tdc : 2;
+      uint32 dummy_26 : 1;
+      uint32 unnamed_27_31 : 5;
+    };
+    uint32 u32;
+  } trailer;
+template<typename __data_src_t>
+  void __unpack(__data_src_t &__buffer,uint32 tdc,uint32 event_id,raw_array_multi_zero_suppress<DATA24,DATA24,32,128> &data);
+template<typename __data_src_t>
+  static bool __match(__data_src_t &__buffer,uint32 tdc,uint32 event_id);
+  STRUCT_FCNS_DECL(VME_CAEN_V1190_SUBTDC);
+};
+class VME_CAEN_V1190
+{
+  raw_array_multi_zero_suppress<DATA24,DATA24,32,128> data;
+  union
+  {
+    struct
+    {
+      uint32 geom : 5;
+      uint32 event_number : 22;
+      uint32 unnamed_27_31 : 5;
+    };
+    uint32 u32;
+  } header;
+  SINGLE(VME_CAEN_V1190_SUBTDC,tdc[4]);
+  union
+  {
+    struct
+    {
+      uint32 time_tag : 27;
+      uint32 unnamed_27_31 : 5;
+    };
+    uint32 u32;
+  } trigger;
+  union
+  {
+    struct
+    {
+      uint32 geom : 5;
+      uint32 word_count : 15;
+      uint32 dummy_20_23 : 4;
+      uint32 tdc_error : 1;
+      uint32 buffer_overflow : 1;
+      uint32 trigger_lost : 1;
+      uint32 unnamed_27_31 : 5;
+    };
+    uint32 u32;
+  } trailer;
+template<typename __data_src_t>
+  void __unpack(__data_src_t &__buffer,uint32 geom);
+template<typename __data_src_t>
+  static bool __match(__data_src_t &__buffer,uint32 geom);
+  STRUCT_FCNS_DECL(VME_CAEN_V1190);
+};
+class VME_CAEN_V1190_SHORT_SUBTDC
+{
+template<typename __data_src_t>
+  void __unpack(__data_src_t &__buffer,uint32 tdc,uint32 event_id,raw_array_multi_zero_suppress<DATA24,DATA24,32,128> &data);
+template<typename __data_src_t>
+  static bool __match(__data_src_t &__buffer,uint32 tdc,uint32 event_id);
+  STRUCT_FCNS_DECL(VME_CAEN_V1190_SHORT_SUBTDC);
+};
+class VME_CAEN_V1190_SHORT_SUBTDC_ERROR
+{
+  union
+  {
+    struct
+    {
+      uint32 flags : 15;
+      uint32 dummy_15_23 : 9;
+      uint32 tdc : 2;
+      uint32 dummy_26 : 1;
+      uint32 unnamed_27_31 : 5;
+    };
+    uint32 u32;
+  } error_flags;
+template<typename __data_src_t>
+  void __unpack(__data_src_t &__buffer,uint32 tdc);
+template<typename __data_src_t>
+  static bool __match(__data_src_t &__buffer,uint32 tdc);
+  STRUCT_FCNS_DECL(VME_CAEN_V1190_SHORT_SUBTDC_ERROR);
+};
+class VME_CAEN_V1190_SHORT
+{
+  raw_array_multi_zero_suppress<DATA24,DATA24,32,128> data;
+  union
+  {
+    struct
+    {
+      uint32 geom : 5;
+      uint32 event_number : 22;
+      uint32 unnamed_27_31 : 5;
+    };
+    uint32 u32;
+  } header;
+  SINGLE(VME_CAEN_V1190_SHORT_SUBTDC,tdc[4]);
+  SINGLE(VME_CAEN_V1190_SHORT_SUBTDC_ERROR,err[4]);
+  union
+  {
+    struct
+    {
+      uint32 time_tag : 27;
+      uint32 unnamed_27_31 : 5;
+    };
+    uint32 u32;
+  } trigger;
+  union
+  {
+    struct
+    {
+      uint32 geom : 5;
+      uint32 word_count : 15;
+      uint32 dummy_20_23 : 4;
+      uint32 tdc_error : 1;
+      uint32 buffer_overflow : 1;
+      uint32 trigger_lost : 1;
+      uint32 unnamed_27_31 : 5;
+    };
+    uint32 u32;
+  } trailer;
+template<typename __data_src_t>
+  void __unpack(__data_src_t &__buffer,uint32 geom);
+template<typename __data_src_t>
+  static bool __match(__data_src_t &__buffer,uint32 geom);
+  STRUCT_FCNS_DECL(VME_CAEN_V1190_SHORT);
+};
+class VME_CAEN_V1290_SUBTDC
+{
+  union
+  {
+    struct
+    {
+      uint32 bunch_id : 12;
+      uint32 event_id : 12;
+      uint32 tdc : 2;
+      uint32 dummy_26 : 1;
+      uint32 unnamed_27_31 : 5;
+    };
+    uint32 u32;
+  } header;
+  union
+  {
+    struct
+    {
+      uint32 flags : 15;
+      uint32 dummy_15_23 : 9;
+      uint32 tdc : 2;
+      uint32 dummy_26 : 1;
+      uint32 unnamed_27_31 : 5;
+    };
+    uint32 u32;
+  } error_flags;
+  union
+  {
+    struct
+    {
+      uint32 word_count : 12;
+      uint32 event_id : 12;
+      uint32 tdc : 2;
+      uint32 dummy_26 : 1;
+      uint32 unnamed_27_31 : 5;
+    };
+    uint32 u32;
+  } trailer;
+template<typename __data_src_t>
+  void __unpack(__data_src_t &__buffer,uint32 tdc,uint32 event_id,raw_array_multi_zero_suppress<DATA24,DATA24,32,128> &data);
+template<typename __data_src_t>
+  static bool __match(__data_src_t &__buffer,uint32 tdc,uint32 event_id);
+  STRUCT_FCNS_DECL(VME_CAEN_V1290_SUBTDC);
+};
+class VME_CAEN_V1290
+{
+  raw_array_multi_zero_suppress<DATA24,DATA24,32,128> data;
+  union
+  {
+    struct
+    {
+      uint32 geom : 5;
+      uint32 event_number : 22;
+      uint32 unnamed_27_31 : 5;
+    };
+    uint32 u32;
+  } header;
+  SINGLE(VME_CAEN_V1290_SUBTDC,tdc[4]);
+  union
+  {
+    struct
+    {
+      uint32 time_tag : 27;
+      uint32 unnamed_27_31 : 5;
+    };
+    uint32 u32;
+  } trigger;
+  union
+  {
+    struct
+    {
+      uint32 geom : 5;
+      uint32 word_count : 15;
+      uint32 dummy_20_23 : 4;
+      uint32 tdc_error : 1;
+      uint32 buffer_overflow : 1;
+      uint32 trigger_lost : 1;
+      uint32 unnamed_27_31 : 5;
+    };
+    uint32 u32;
+  } trailer;
+template<typename __data_src_t>
+  void __unpack(__data_src_t &__buffer,uint32 geom);
+template<typename __data_src_t>
+  static bool __match(__data_src_t &__buffer,uint32 geom);
+  STRUCT_FCNS_DECL(VME_CAEN_V1290);
+};
+class VME_CAEN_V1290_SHORT_SUBTDC
+{
+template<typename __data_src_t>
+  void __unpack(__data_src_t &__buffer,uint32 tdc,uint32 event_id,raw_array_multi_zero_suppress<DATA24,DATA24,32,128> &data);
+template<typename __data_src_t>
+  static bool __match(__data_src_t &__buffer,uint32 tdc,uint32 event_id);
+  STRUCT_FCNS_DECL(VME_CAEN_V1290_SHORT_SUBTDC);
+};
+class VME_CAEN_V1290_SHORT_SUBTDC_ERROR
+{
+  union
+  {
+    struct
+    {
+      uint32 flags : 15;
+      uint32 dummy_15_23 : 9;
+      uint32 tdc : 2;
+      uint32 dummy_26 : 1;
+      uint32 unnamed_27_31 : 5;
+    };
+    uint32 u32;
+  } error_flags;
+template<typename __data_src_t>
+  void __unpack(__data_src_t &__buffer,uint32 tdc);
+template<typename __data_src_t>
+  static bool __match(__data_src_t &__buffer,uint32 tdc);
+  STRUCT_FCNS_DECL(VME_CAEN_V1290_SHORT_SUBTDC_ERROR);
+};
+class VME_CAEN_V1290_SHORT
+{
+  raw_array_multi_zero_suppress<DATA24,DATA24,32,128> data;
+  union
+  {
+    struct
+    {
+      uint32 geom : 5;
+      uint32 event_number : 22;
+      uint32 unnamed_27_31 : 5;
+    };
+    uint32 u32;
+  } header;
+  SINGLE(VME_CAEN_V1290_SHORT_SUBTDC,tdc[4]);
+  SINGLE(VME_CAEN_V1290_SHORT_SUBTDC_ERROR,err[4]);
+  union
+  {
+    struct
+    {
+      uint32 time_tag : 27;
+      uint32 unnamed_27_31 : 5;
+    };
+    uint32 u32;
+  } trigger;
+  union
+  {
+    struct
+    {
+      uint32 geom : 5;
+      uint32 word_count : 15;
+      uint32 dummy_20_23 : 4;
+      uint32 tdc_error : 1;
+      uint32 buffer_overflow : 1;
+      uint32 trigger_lost : 1;
+      uint32 unnamed_27_31 : 5;
+    };
+    uint32 u32;
+  } trailer;
+template<typename __data_src_t>
+  void __unpack(__data_src_t &__buffer,uint32 geom);
+template<typename __data_src_t>
+  static bool __match(__data_src_t &__buffer,uint32 geom);
+  STRUCT_FCNS_DECL(VME_CAEN_V1290_SHORT);
+};
+class VME_CAEN_V775
+{
+  raw_array_zero_suppress<DATA12_OVERFLOW,DATA12_OVERFLOW,32> data;
+  union
+  {
+    struct
+    {
+      uint32 event_number : 24;
+      uint32 unnamed_24_26 : 3;
+      uint32 geom : 5;
+    };
+    uint32 u32;
+  } eob;
+template<typename __data_src_t>
+  void __unpack(__data_src_t &__buffer,uint32 geom,uint32 crate);
+template<typename __data_src_t>
+  static bool __match(__data_src_t &__buffer,uint32 geom,uint32 crate);
+  STRUCT_FCNS_DECL(VME_CAEN_V775);
+};
+class VME_CAEN_V830
+{
+  raw_array_zero_suppress<DATA32,DATA32,32> data;
+  union
+  {
+    struct
+    {
+      uint32 event_number : 16;
+      uint32 ts : 2;
+      uint32 count : 6;
+      uint32 dummy_24_25 : 2;
+      uint32 unnamed_26_26 : 1;
+      uint32 geom : 5;
+    };
+    uint32 u32;
+  } header;
+template<typename __data_src_t>
+  void __unpack(__data_src_t &__buffer,uint32 geom);
+template<typename __data_src_t>
+  static bool __match(__data_src_t &__buffer,uint32 geom);
+  STRUCT_FCNS_DECL(VME_CAEN_V830);
+};
+class VME_MESYTEC_MADC32
+{
+  raw_array_zero_suppress<DATA14_OVERFLOW,DATA14_OVERFLOW,32> data;
+  union
+  {
+    struct
+    {
+      uint32 counter : 30;
+      uint32 unnamed_30_31 : 2;
+    };
+    uint32 u32;
+  } end_of_event;
+template<typename __data_src_t>
+  void __unpack(__data_src_t &__buffer,uint32 geom);
+template<typename __data_src_t>
+  static bool __match(__data_src_t &__buffer,uint32 geom);
+  STRUCT_FCNS_DECL(VME_MESYTEC_MADC32);
+};
+class VME_MESYTEC_MDPP16
+{
+  raw_array_multi_zero_suppress<DATA16_OVERFLOW,DATA16_OVERFLOW,16,20> adc;
+  raw_array_multi_zero_suppress<DATA16_OVERFLOW,DATA16_OVERFLOW,16,20> tdc;
+  raw_array_multi_zero_suppress<DATA16_OVERFLOW,DATA16_OVERFLOW,16,20> trig_tdc;
+  raw_array_multi_zero_suppress<DATA16_OVERFLOW,DATA16_OVERFLOW,16,20> adc_short;
+  union
+  {
+    struct
+    {
+      uint32 counter : 30;
+      uint32 unnamed_30_31 : 2;
+    };
+    uint32 u32;
+  } end_of_event;
+template<typename __data_src_t>
+  void __unpack(__data_src_t &__buffer,uint32 geom);
+template<typename __data_src_t>
+  static bool __match(__data_src_t &__buffer,uint32 geom);
+  STRUCT_FCNS_DECL(VME_MESYTEC_MDPP16);
+};
+class XTST_STD_VME
+{
+  union
+  {
+    struct
+    {
+      uint32 fail_general : 1;
+      uint32 fail_data_corrupt : 1;
+      uint32 fail_data_missing : 1;
+      uint32 fail_data_too_much : 1;
+      uint32 fail_event_counter_mismatch : 1;
+      uint32 fail_readout_error_driver : 1;
+      uint32 fail_unexpected_trigger : 1;
+      uint32 dummy_7_26 : 20;
+      uint32 has_no_zero_suppression : 1;
+      uint32 has_multi_adctdc_counter0 : 1;
+      uint32 has_multi_scaler_counter0 : 1;
+      uint32 has_multi_event : 1;
+      uint32 has_time_stamp : 1;
+    };
+    uint32 u32;
+  } failure;
+    uint32 time_stamp;
+    uint32 multi_events;
+    uint32 multi_scaler_counter0;
+    uint32 multi_adctdc_counter0;
+template<typename __data_src_t>
+  void __unpack(__data_src_t &__buffer);
+template<typename __data_src_t>
+  static bool __match(__data_src_t &__buffer);
+  STRUCT_FCNS_DECL(XTST_STD_VME);
+};
+class XTST_TGL_STD_VME
+{
+  union
+  {
+    struct
+    {
+      uint32 unnamed_0_31 : 32;
+    };
+    uint32 u32;
+  } separator;
+  uint32 multi_events;
+  uint32 multi_adctdc_counter0;
+  union
+  {
+    struct
+    {
+      uint32 ntgl1 : 16;
+      uint32 ntgl2 : 16;
+    };
+    uint32 u32;
+  } toggle;
+template<typename __data_src_t>
+  void __unpack(__data_src_t &__buffer);
+template<typename __data_src_t>
+  static bool __match(__data_src_t &__buffer);
+  STRUCT_FCNS_DECL(XTST_TGL_STD_VME);
+};
+class XTST_VME
+ : public unpack_subevent_base
+{
+  SINGLE(VME_CAEN_V775,tdc0);
+  SINGLE(VME_CAEN_V775,tdc1);
+  SINGLE(VME_CAEN_V775,tdc2);
+  SINGLE(VME_CAEN_V775,qdc0);
+  SINGLE(VME_CAEN_V775,qdc1);
+  SINGLE(VME_MESYTEC_MDPP16,mdpp16);
+  SINGLE(XTST_STD_VME,header);
+  SINGLE(SINGLE_DATA_MODULE,sdm);
+template<typename __data_src_t>
+  void __unpack(__data_src_t &__buffer);
+template<typename __data_src_t>
+  static bool __match(__data_src_t &__buffer);
+  STRUCT_FCNS_DECL(XTST_VME);
+};
+class XTST_VME_TOGGLE
+ : public unpack_subevent_base
+{
+  uint32 seed;
+  SINGLE(TRLO_SHADOW_MULTI_TRIGGERS,multitrig);
+  MULTI(VME_CAEN_V775,v775_tgl1[2]);
+  MULTI(VME_CAEN_V775,v775_tgl2[2]);
+  MULTI(VME_CAEN_V775,v775mod[2]);
+  SINGLE(XTST_TGL_STD_VME,header);
+template<typename __data_src_t>
+  void __unpack(__data_src_t &__buffer);
+template<typename __data_src_t>
+  static bool __match(__data_src_t &__buffer);
+  STRUCT_FCNS_DECL(XTST_VME_TOGGLE);
+};
+class unpack_event : public unpack_event_base
+{
+SINGLE(XTST_VME_TOGGLE,vme);
+  bitsone<1> __visited;
+  void __clear_visited() { __visited.clear(); }
+  subevent_match_cache __match_cache;
+  bool ignore_unknown_subevent() { return false; }
+template<typename __data_src_t>
+  int __unpack_subevent(subevent_header *__header,__data_src_t &__buffer);
+  int __revoke_subevent(subevent_header *__header);
+  STRUCT_FCNS_DECL(unpack_event);
+};
+class unpack_sticky_event : public unpack_sticky_event_base
+{
+  void __clear_visited() { }
+  subevent_match_cache __match_cache;
+  bool ignore_unknown_subevent() { return false; }
+template<typename __data_src_t>
+  int __unpack_subevent(subevent_header *__header,__data_src_t &__buffer);
+  int __revoke_subevent(subevent_header *__header);
+  STRUCT_FCNS_DECL(unpack_sticky_event);
+};
@@ -0,0 +1,90 @@
+/** BEGIN_EVENT_DATA_MAPPING *******************************************
+ *
+ * Event data mapping.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// The order in this file does not matter.
+// This information parsed once and not treated eventwise,
+// it is used to initialize a structure.
+
+SIGNAL_MAPPING(DATA12,MOD1_10T,vme.v775mod[0].data[9],MOD[0][9].T);
+SIGNAL_MAPPING(DATA12,MOD1_11T,vme.v775mod[0].data[10],MOD[0][10].T);
+SIGNAL_MAPPING(DATA12,MOD1_12T,vme.v775mod[0].data[11],MOD[0][11].T);
+SIGNAL_MAPPING(DATA12,MOD1_13T,vme.v775mod[0].data[12],MOD[0][12].T);
+SIGNAL_MAPPING(DATA12,MOD1_14T,vme.v775mod[0].data[13],MOD[0][13].T);
+SIGNAL_MAPPING(DATA12,MOD1_15T,vme.v775mod[0].data[14],MOD[0][14].T);
+SIGNAL_MAPPING(DATA12,MOD1_16T,vme.v775mod[0].data[15],MOD[0][15].T);
+SIGNAL_MAPPING(DATA12,MOD1_17T,vme.v775mod[0].data[16],MOD[0][16].T);
+SIGNAL_MAPPING(DATA12,MOD1_18T,vme.v775mod[0].data[17],MOD[0][17].T);
+SIGNAL_MAPPING(DATA12,MOD1_19T,vme.v775mod[0].data[18],MOD[0][18].T);
+SIGNAL_MAPPING(DATA12,MOD1_1T,vme.v775mod[0].data[0],MOD[0][0].T);
+SIGNAL_MAPPING(DATA12,MOD1_20T,vme.v775mod[0].data[19],MOD[0][19].T);
+SIGNAL_MAPPING(DATA12,MOD1_21T,vme.v775mod[0].data[20],MOD[0][20].T);
+SIGNAL_MAPPING(DATA12,MOD1_22T,vme.v775mod[0].data[21],MOD[0][21].T);
+SIGNAL_MAPPING(DATA12,MOD1_23T,vme.v775mod[0].data[22],MOD[0][22].T);
+SIGNAL_MAPPING(DATA12,MOD1_24T,vme.v775mod[0].data[23],MOD[0][23].T);
+SIGNAL_MAPPING(DATA12,MOD1_25T,vme.v775mod[0].data[24],MOD[0][24].T);
+SIGNAL_MAPPING(DATA12,MOD1_26T,vme.v775mod[0].data[25],MOD[0][25].T);
+SIGNAL_MAPPING(DATA12,MOD1_27T,vme.v775mod[0].data[26],MOD[0][26].T);
+SIGNAL_MAPPING(DATA12,MOD1_28T,vme.v775mod[0].data[27],MOD[0][27].T);
+SIGNAL_MAPPING(DATA12,MOD1_29T,vme.v775mod[0].data[28],MOD[0][28].T);
+SIGNAL_MAPPING(DATA12,MOD1_2T,vme.v775mod[0].data[1],MOD[0][1].T);
+SIGNAL_MAPPING(DATA12,MOD1_30T,vme.v775mod[0].data[29],MOD[0][29].T);
+SIGNAL_MAPPING(DATA12,MOD1_31T,vme.v775mod[0].data[30],MOD[0][30].T);
+SIGNAL_MAPPING(DATA12,MOD1_32T,vme.v775mod[0].data[31],MOD[0][31].T);
+SIGNAL_MAPPING(DATA12,MOD1_3T,vme.v775mod[0].data[2],MOD[0][2].T);
+SIGNAL_MAPPING(DATA12,MOD1_4T,vme.v775mod[0].data[3],MOD[0][3].T);
+SIGNAL_MAPPING(DATA12,MOD1_5T,vme.v775mod[0].data[4],MOD[0][4].T);
+SIGNAL_MAPPING(DATA12,MOD1_6T,vme.v775mod[0].data[5],MOD[0][5].T);
+SIGNAL_MAPPING(DATA12,MOD1_7T,vme.v775mod[0].data[6],MOD[0][6].T);
+SIGNAL_MAPPING(DATA12,MOD1_8T,vme.v775mod[0].data[7],MOD[0][7].T);
+SIGNAL_MAPPING(DATA12,MOD1_9T,vme.v775mod[0].data[8],MOD[0][8].T);
+SIGNAL_MAPPING(DATA12,MOD2_10T,vme.v775mod[1].data[9],MOD[1][9].T);
+SIGNAL_MAPPING(DATA12,MOD2_11T,vme.v775mod[1].data[10],MOD[1][10].T);
+SIGNAL_MAPPING(DATA12,MOD2_12T,vme.v775mod[1].data[11],MOD[1][11].T);
+SIGNAL_MAPPING(DATA12,MOD2_13T,vme.v775mod[1].data[12],MOD[1][12].T);
+SIGNAL_MAPPING(DATA12,MOD2_14T,vme.v775mod[1].data[13],MOD[1][13].T);
+SIGNAL_MAPPING(DATA12,MOD2_15T,vme.v775mod[1].data[14],MOD[1][14].T);
+SIGNAL_MAPPING(DATA12,MOD2_16T,vme.v775mod[1].data[15],MOD[1][15].T);
+SIGNAL_MAPPING(DATA12,MOD2_17T,vme.v775mod[1].data[16],MOD[1][16].T);
+SIGNAL_MAPPING(DATA12,MOD2_18T,vme.v775mod[1].data[17],MOD[1][17].T);
+SIGNAL_MAPPING(DATA12,MOD2_19T,vme.v775mod[1].data[18],MOD[1][18].T);
+SIGNAL_MAPPING(DATA12,MOD2_1T,vme.v775mod[1].data[0],MOD[1][0].T);
+SIGNAL_MAPPING(DATA12,MOD2_20T,vme.v775mod[1].data[19],MOD[1][19].T);
+SIGNAL_MAPPING(DATA12,MOD2_21T,vme.v775mod[1].data[20],MOD[1][20].T);
+SIGNAL_MAPPING(DATA12,MOD2_22T,vme.v775mod[1].data[21],MOD[1][21].T);
+SIGNAL_MAPPING(DATA12,MOD2_23T,vme.v775mod[1].data[22],MOD[1][22].T);
+SIGNAL_MAPPING(DATA12,MOD2_24T,vme.v775mod[1].data[23],MOD[1][23].T);
+SIGNAL_MAPPING(DATA12,MOD2_25T,vme.v775mod[1].data[24],MOD[1][24].T);
+SIGNAL_MAPPING(DATA12,MOD2_26T,vme.v775mod[1].data[25],MOD[1][25].T);
+SIGNAL_MAPPING(DATA12,MOD2_27T,vme.v775mod[1].data[26],MOD[1][26].T);
+SIGNAL_MAPPING(DATA12,MOD2_28T,vme.v775mod[1].data[27],MOD[1][27].T);
+SIGNAL_MAPPING(DATA12,MOD2_29T,vme.v775mod[1].data[28],MOD[1][28].T);
+SIGNAL_MAPPING(DATA12,MOD2_2T,vme.v775mod[1].data[1],MOD[1][1].T);
+SIGNAL_MAPPING(DATA12,MOD2_30T,vme.v775mod[1].data[29],MOD[1][29].T);
+SIGNAL_MAPPING(DATA12,MOD2_31T,vme.v775mod[1].data[30],MOD[1][30].T);
+SIGNAL_MAPPING(DATA12,MOD2_32T,vme.v775mod[1].data[31],MOD[1][31].T);
+SIGNAL_MAPPING(DATA12,MOD2_3T,vme.v775mod[1].data[2],MOD[1][2].T);
+SIGNAL_MAPPING(DATA12,MOD2_4T,vme.v775mod[1].data[3],MOD[1][3].T);
+SIGNAL_MAPPING(DATA12,MOD2_5T,vme.v775mod[1].data[4],MOD[1][4].T);
+SIGNAL_MAPPING(DATA12,MOD2_6T,vme.v775mod[1].data[5],MOD[1][5].T);
+SIGNAL_MAPPING(DATA12,MOD2_7T,vme.v775mod[1].data[6],MOD[1][6].T);
+SIGNAL_MAPPING(DATA12,MOD2_8T,vme.v775mod[1].data[7],MOD[1][7].T);
+SIGNAL_MAPPING(DATA12,MOD2_9T,vme.v775mod[1].data[8],MOD[1][8].T);
+
+/** END_EVENT_DATA_MAPPING ********************************************/
+/** BEGIN_EVENT_DATA_MAPPING *******************************************
+ *
+ * Event data mapping.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// The order in this file does not matter.
+// This information parsed once and not treated eventwise,
+// it is used to initialize a structure.
+
+
+/** END_EVENT_DATA_MAPPING ********************************************/
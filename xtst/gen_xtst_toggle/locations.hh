@@ -0,0 +1,61 @@
+/** BEGIN_LOCATIONS ****************************************************
+ *
+ * File and line locations from the parsed specification files.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// It's left to the compiler to only store one copy of each
+// unique string.
+
+location spec_locations[] =
+{ 
+  { 2, 0, "xtst_toggle.spec" },
+  { 3, 0, "<built-in>" },
+  { 4, 0, "<command-line>" },
+  { 5, 1, "/usr/include/stdc-predef.h" },
+  { 6, 0, "<command-line>" },
+  { 7, 1, "xtst_toggle.spec" },
+  { 8, 23, "xtst_toggle.spec" },
+  { 9, 1, "/root/repo/spec/spec.spec" },
+  { 10, 23, "/root/repo/spec/spec.spec" },
+  { 11, 1, "/root/repo/spec/camac_lecroy_4434.spec" },
+  { 12, 23, "/root/repo/spec/camac_lecroy_4434.spec" },
+  { 28, 24, "/root/repo/spec/spec.spec" },
+  { 29, 1, "/root/repo/spec/camac_silena_4418.spec" },
+  { 30, 28, "/root/repo/spec/camac_silena_4418.spec" },
+  { 57, 25, "/root/repo/spec/spec.spec" },
+  { 58, 1, "/root/repo/spec/camac_phillips_7164.spec" },
+  { 59, 26, "/root/repo/spec/camac_phillips_7164.spec" },
+  { 84, 26, "/root/repo/spec/spec.spec" },
+  { 86, 1, "/root/repo/spec/fastbus.spec" },
+  { 87, 23, "/root/repo/spec/fastbus.spec" },
+  { 122, 28, "/root/repo/spec/spec.spec" },
+  { 124, 1, "/root/repo/spec/vme_caen_v775.spec" },
+  { 125, 26, "/root/repo/spec/vme_caen_v775.spec" },
+  { 169, 30, "/root/repo/spec/spec.spec" },
+  { 170, 1, "/root/repo/spec/vme_caen_v830.spec" },
+  { 171, 23, "/root/repo/spec/vme_caen_v830.spec" },
+  { 200, 31, "/root/repo/spec/spec.spec" },
+  { 201, 1, "/root/repo/spec/vme_caen_v1290.spec" },
+  { 202, 27, "/root/repo/spec/vme_caen_v1290.spec" },
+  { 203, 1, "/root/repo/spec/vme_caen_v1290.spec" },
+  { 204, 39, "/root/repo/spec/vme_caen_v1290.spec" },
+  { 402, 28, "/root/repo/spec/vme_caen_v1290.spec" },
+  { 408, 1, "/root/repo/spec/vme_caen_v1290.spec" },
+  { 409, 39, "/root/repo/spec/vme_caen_v1290.spec" },
+  { 607, 34, "/root/repo/spec/vme_caen_v1290.spec" },
+  { 608, 32, "/root/repo/spec/spec.spec" },
+  { 610, 1, "/root/repo/spec/vme_mesytec_madc32.spec" },
+  { 611, 23, "/root/repo/spec/vme_mesytec_madc32.spec" },
+  { 653, 34, "/root/repo/spec/spec.spec" },
+  { 654, 1, "/root/repo/spec/vme_mesytec_mdpp16.spec" },
+  { 655, 45, "/root/repo/spec/vme_mesytec_mdpp16.spec" },
+  { 716, 35, "/root/repo/spec/spec.spec" },
+  { 717, 24, "xtst_toggle.spec" },
+  { 719, 1, "xtst_vme.spec" },
+  { 720, 23, "xtst_vme.spec" },
+  { 875, 26, "xtst_toggle.spec" },
+};
+
+/** END_LOCATIONS *****************************************************/
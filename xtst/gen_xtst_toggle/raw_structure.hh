@@ -0,0 +1,56 @@
+/** BEGIN_EVENT_RAW_STRUCTURE ******************************************
+ *
+ * Event data structure.
+ *
+ * Do not edit - automatically generated.
+ */
+
+//DUMPY: 2 0
+//DUMPY: 32 0
+class raw_event_MOD
+{
+public:
+  DATA12 T;
+
+public:
+#ifndef __PSDC__
+  STRUCT_FCNS_DECL(raw_event_MOD);
+#endif//!__PSDC__
+} ;
+
+class raw_event : public raw_event_base
+{
+public:
+//DUMPY: 2 0
+//DUMPY: 32 0
+  raw_event_MOD
+  /* {
+  public:
+    DATA12 T;
+  } */ MOD[2][32];
+
+public:
+#ifndef __PSDC__
+  STRUCT_FCNS_DECL(raw_event);
+#endif//!__PSDC__
+} ;
+
+/** END_EVENT_RAW_STRUCTURE *******************************************/
+/** BEGIN_EVENT_RAW_STRUCTURE ******************************************
+ *
+ * Event data structure.
+ *
+ * Do not edit - automatically generated.
+ */
+
+class raw_sticky : public raw_sticky_base
+{
+public:
+
+public:
+#ifndef __PSDC__
+  STRUCT_FCNS_DECL(raw_sticky);
+#endif//!__PSDC__
+} ;
+
+/** END_EVENT_RAW_STRUCTURE *******************************************/
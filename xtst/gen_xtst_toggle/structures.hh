@@ -0,0 +1,2168 @@
+/** BEGIN_STRUCTURES ***************************************************
+ *
+ * Event unpacker associated structures for CAMAC_LECROY_4434.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// CAMAC_LECROY_4434(channels)
+#if !PACKER_CODE
+# define DECLARED_UNPACK_CAMAC_LECROY_4434
+class CAMAC_LECROY_4434
+#else//PACKER_CODE
+# define DECLARED_PACKER_CAMAC_LECROY_4434
+class PACKER_CAMAC_LECROY_4434
+#endif//PACKER_CODE
+
+{
+public:
+  // MEMBER(DATA24 data[32] ZERO_SUPPRESS);
+  raw_array_zero_suppress<DATA24,DATA24,32> data;
+  // list(0<=index<channels)
+
+    // UINT32 ch_data NOENCODE
+    // {
+      //  0_23: value;
+      // 24_31: 0;
+      // ENCODE(data[index],(value=value));
+    // }
+
+public:
+#ifndef __PSDC__
+# if !PACKER_CODE
+template<typename __data_src_t>
+  void __unpack(__data_src_t &__buffer,uint32 channels);
+template<typename __data_src_t>
+  static bool __match(__data_src_t &__buffer,uint32 channels);
+  // void __clean();
+# else//PACKER_CODE
+template<typename __data_dest_t>
+  void __packer(__data_dest_t &__buffer,uint32 channels);
+# endif//PACKER_CODE
+
+  STRUCT_FCNS_DECL(CAMAC_LECROY_4434);
+#endif//!__PSDC__
+};
+
+/** END_STRUCTURES ****************************************************/
+/** BEGIN_STRUCTURES ***************************************************
+ *
+ * Event unpacker associated structures for CAMAC_PHILLIPS_7164.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// CAMAC_PHILLIPS_7164(channels,mark_channel_no)
+#if !PACKER_CODE
+# define DECLARED_UNPACK_CAMAC_PHILLIPS_7164
+class CAMAC_PHILLIPS_7164
+#else//PACKER_CODE
+# define DECLARED_PACKER_CAMAC_PHILLIPS_7164
+class PACKER_CAMAC_PHILLIPS_7164
+#endif//PACKER_CODE
+
+{
+public:
+  // MEMBER(DATA12 data[16] ZERO_SUPPRESS);
+  raw_array_zero_suppress<DATA12,DATA12,16> data;
+  // list(0<=index<channels)
+
+    // if(mark_channel_no)
+
+    // else
+
+      // UINT16 ch_data NOENCODE
+      // {
+        //  0_11: value;
+        // 12_15: channel = CHECK(index);
+        // ENCODE(data[index],(value=value));
+      // }
+      // UINT16 ch_data NOENCODE
+      // {
+        //  0_11: value;
+        // ENCODE(data[index],(value=value));
+      // }
+
+public:
+#ifndef __PSDC__
+# if !PACKER_CODE
+template<typename __data_src_t>
+  void __unpack(__data_src_t &__buffer,uint32 channels,uint32 mark_channel_no);
+template<typename __data_src_t>
+  static bool __match(__data_src_t &__buffer,uint32 channels,uint32 mark_channel_no);
+  // void __clean();
+# else//PACKER_CODE
+template<typename __data_dest_t>
+  void __packer(__data_dest_t &__buffer,uint32 channels,uint32 mark_channel_no);
+# endif//PACKER_CODE
+
+  STRUCT_FCNS_DECL(CAMAC_PHILLIPS_7164);
+#endif//!__PSDC__
+};
+
+/** END_STRUCTURES ****************************************************/
+/** BEGIN_STRUCTURES ***************************************************
+ *
+ * Event unpacker associated structures for CAMAC_SILENA_4418.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// CAMAC_SILENA_4418(channels,mark_channel_no)
+#if !PACKER_CODE
+# define DECLARED_UNPACK_CAMAC_SILENA_4418
+class CAMAC_SILENA_4418
+#else//PACKER_CODE
+# define DECLARED_PACKER_CAMAC_SILENA_4418
+class PACKER_CAMAC_SILENA_4418
+#endif//PACKER_CODE
+
+{
+public:
+  // MEMBER(DATA12_OVERFLOW data[8] ZERO_SUPPRESS);
+  raw_array_zero_suppress<DATA12_OVERFLOW,DATA12_OVERFLOW,8> data;
+  // list(0<=index<channels)
+
+    // if(mark_channel_no)
+
+    // else
+
+      // UINT16 ch_data NOENCODE
+      // {
+        //  0_11: value;
+        // 12_14: channel = CHECK(index);
+        //    15: overflow;
+        // ENCODE(data[index],(value=value,overflow=overflow));
+      // }
+      // UINT16 ch_data NOENCODE
+      // {
+        //  0_11: value;
+        //    15: overflow;
+        // ENCODE(data[index],(value=value,overflow=overflow));
+      // }
+
+public:
+#ifndef __PSDC__
+# if !PACKER_CODE
+template<typename __data_src_t>
+  void __unpack(__data_src_t &__buffer,uint32 channels,uint32 mark_channel_no);
+template<typename __data_src_t>
+  static bool __match(__data_src_t &__buffer,uint32 channels,uint32 mark_channel_no);
+  // void __clean();
+# else//PACKER_CODE
+template<typename __data_dest_t>
+  void __packer(__data_dest_t &__buffer,uint32 channels,uint32 mark_channel_no);
+# endif//PACKER_CODE
+
+  STRUCT_FCNS_DECL(CAMAC_SILENA_4418);
+#endif//!__PSDC__
+};
+
+/** END_STRUCTURES ****************************************************/
+/** BEGIN_STRUCTURES ***************************************************
+ *
+ * Event unpacker associated structures for FASTBUS_LECROY_1875.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// FASTBUS_LECROY_1875(geom,channels)
+#if !PACKER_CODE
+# define DECLARED_UNPACK_FASTBUS_LECROY_1875
+class FASTBUS_LECROY_1875
+#else//PACKER_CODE
+# define DECLARED_PACKER_FASTBUS_LECROY_1875
+class PACKER_FASTBUS_LECROY_1875
+#endif//PACKER_CODE
+
+{
+public:
+  // MEMBER(DATA12_RANGE data[64] ZERO_SUPPRESS);
+  raw_array_zero_suppress<DATA12_RANGE,DATA12_RANGE,64> data;
+  // UINT32 ch_data NOENCODE
+  // {
+    //  0_11: value;
+    // 16_21: channel = RANGE(0,(channels - 1));
+    //    23: range;
+    // 24_26: n = CHECK(0);
+    // 27_31: geom = MATCH(geom);
+    // ENCODE(data[channel],(value=value,range=range));
+  // }
+
+public:
+#ifndef __PSDC__
+# if !PACKER_CODE
+template<typename __data_src_t>
+  void __unpack(__data_src_t &__buffer,uint32 geom,uint32 channels);
+template<typename __data_src_t>
+  static bool __match(__data_src_t &__buffer,uint32 geom,uint32 channels);
+  // void __clean();
+# else//PACKER_CODE
+template<typename __data_dest_t>
+  void __packer(__data_dest_t &__buffer,uint32 geom,uint32 channels);
+# endif//PACKER_CODE
+
+  STRUCT_FCNS_DECL(FASTBUS_LECROY_1875);
+#endif//!__PSDC__
+};
+
+/** END_STRUCTURES ****************************************************/
+/** BEGIN_STRUCTURES ***************************************************
+ *
+ * Event unpacker associated structures for FASTBUS_LECROY_1885.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// FASTBUS_LECROY_1885(geom,channels)
+#if !PACKER_CODE
+# define DECLARED_UNPACK_FASTBUS_LECROY_1885
+class FASTBUS_LECROY_1885
+#else//PACKER_CODE
+# define DECLARED_PACKER_FASTBUS_LECROY_1885
+class PACKER_FASTBUS_LECROY_1885
+#endif//PACKER_CODE
+
+{
+public:
+  // MEMBER(DATA12_RANGE data[96] ZERO_SUPPRESS);
+  raw_array_zero_suppress<DATA12_RANGE,DATA12_RANGE,96> data;
+  // UINT32 ch_data NOENCODE
+  // {
+    //  0_11: value;
+    // 16_22: channel = RANGE(0,(channels - 1));
+    //    23: range;
+    // 24_26: n = CHECK(0);
+    // 27_31: geom = MATCH(geom);
+    // ENCODE(data[channel],(value=value,range=range));
+  // }
+
+public:
+#ifndef __PSDC__
+# if !PACKER_CODE
+template<typename __data_src_t>
+  void __unpack(__data_src_t &__buffer,uint32 geom,uint32 channels);
+template<typename __data_src_t>
+  static bool __match(__data_src_t &__buffer,uint32 geom,uint32 channels);
+  // void __clean();
+# else//PACKER_CODE
+template<typename __data_dest_t>
+  void __packer(__data_dest_t &__buffer,uint32 geom,uint32 channels);
+# endif//PACKER_CODE
+
+  STRUCT_FCNS_DECL(FASTBUS_LECROY_1885);
+#endif//!__PSDC__
+};
+
+/** END_STRUCTURES ****************************************************/
+/** BEGIN_STRUCTURES ***************************************************
+ *
+ * Event unpacker associated structures for ROLLING_TRLO_EVENT_TRIGGER.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// ROLLING_TRLO_EVENT_TRIGGER()
+#if !PACKER_CODE
+# define DECLARED_UNPACK_ROLLING_TRLO_EVENT_TRIGGER
+class ROLLING_TRLO_EVENT_TRIGGER
+#else//PACKER_CODE
+# define DECLARED_PACKER_ROLLING_TRLO_EVENT_TRIGGER
+class PACKER_ROLLING_TRLO_EVENT_TRIGGER
+#endif//PACKER_CODE
+
+{
+public:
+  // MEMBER(DATA32 lo);
+  DATA32 lo;
+  // MEMBER(DATA32 hi);
+  DATA32 hi;
+  // MEMBER(DATA32 tpat);
+  DATA32 tpat;
+  // UINT32 time_lo NOENCODE
+  // {
+    //  0_31: val;
+    // ENCODE(lo,(value=val));
+  // }
+  // UINT32 time_hi NOENCODE
+  // {
+    //  0_30: val;
+    //    31: missed_event = CHECK(0);
+    // ENCODE(hi,(value=val));
+  // }
+  // UINT32 status
+  // {
+    //  0_23: tpat;
+    // 24_27: trig;
+    // 28_31: count;
+    // ENCODE(tpat,(value=tpat));
+  // }
+  union
+  {
+    struct
+    {
+#if __BYTE_ORDER == __LITTLE_ENDIAN
+      uint32 tpat : 24; // 0..23
+      uint32 trig : 4; // 24..27
+      uint32 count : 4; // 28..31
+#endif
+#if __BYTE_ORDER == __BIG_ENDIAN
+      uint32 count : 4; // 28..31
+      uint32 trig : 4; // 24..27
+      uint32 tpat : 24; // 0..23
+#endif
+    };
+    uint32  u32;
+  } status;
+
+public:
+#ifndef __PSDC__
+# if !PACKER_CODE
+template<typename __data_src_t>
+  void __unpack(__data_src_t &__buffer);
+template<typename __data_src_t>
+  static bool __match(__data_src_t &__buffer);
+  // void __clean();
+# else//PACKER_CODE
+template<typename __data_dest_t>
+  void __packer(__data_dest_t &__buffer);
+# endif//PACKER_CODE
+
+  STRUCT_FCNS_DECL(ROLLING_TRLO_EVENT_TRIGGER);
+#endif//!__PSDC__
+};
+
+/** END_STRUCTURES ****************************************************/
+/** BEGIN_STRUCTURES ***************************************************
+ *
+ * Event unpacker associated structures for SINGLE_DATA_MODULE.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// SINGLE_DATA_MODULE()
+#if !PACKER_CODE
+# define DECLARED_UNPACK_SINGLE_DATA_MODULE
+class SINGLE_DATA_MODULE
+#else//PACKER_CODE
+# define DECLARED_PACKER_SINGLE_DATA_MODULE
+class PACKER_SINGLE_DATA_MODULE
+#endif//PACKER_CODE
+
+{
+public:
+  // UINT32 data;
+  uint32  data;
+
+public:
+#ifndef __PSDC__
+# if !PACKER_CODE
+template<typename __data_src_t>
+  void __unpack(__data_src_t &__buffer);
+template<typename __data_src_t>
+  static bool __match(__data_src_t &__buffer);
+  // void __clean();
+# else//PACKER_CODE
+template<typename __data_dest_t>
+  void __packer(__data_dest_t &__buffer);
+# endif//PACKER_CODE
+
+  STRUCT_FCNS_DECL(SINGLE_DATA_MODULE);
+#endif//!__PSDC__
+};
+
+/** END_STRUCTURES ****************************************************/
+/** BEGIN_STRUCTURES ***************************************************
+ *
+ * Event unpacker associated structures for TRLO_SHADOW_MULTI_TRIGGERS.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// TRLO_SHADOW_MULTI_TRIGGERS()
+#if !PACKER_CODE
+# define DECLARED_UNPACK_TRLO_SHADOW_MULTI_TRIGGERS
+class TRLO_SHADOW_MULTI_TRIGGERS
+#else//PACKER_CODE
+# define DECLARED_PACKER_TRLO_SHADOW_MULTI_TRIGGERS
+class PACKER_TRLO_SHADOW_MULTI_TRIGGERS
+#endif//PACKER_CODE
+
+{
+public:
+  // UINT32 header
+  // {
+    //  0_16: events;
+    // 24_31: 223;
+  // }
+  union
+  {
+    struct
+    {
+#if __BYTE_ORDER == __LITTLE_ENDIAN
+      uint32 events : 17; // 0..16
+      uint32 dummy_17_23 : 7;
+      uint32 unnamed_24_31 : 8; // 24..31
+#endif
+#if __BYTE_ORDER == __BIG_ENDIAN
+      uint32 unnamed_24_31 : 8; // 24..31
+      uint32 dummy_17_23 : 7;
+      uint32 events : 17; // 0..16
+#endif
+    };
+    uint32  u32;
+  } header;
+  // list(0<=index<header.events)
+
+    // multi events = ROLLING_TRLO_EVENT_TRIGGER();
+    MULTI(ROLLING_TRLO_EVENT_TRIGGER,events);
+
+public:
+#ifndef __PSDC__
+# if !PACKER_CODE
+template<typename __data_src_t>
+  void __unpack(__data_src_t &__buffer);
+template<typename __data_src_t>
+  static bool __match(__data_src_t &__buffer);
+  // void __clean();
+# else//PACKER_CODE
+template<typename __data_dest_t>
+  void __packer(__data_dest_t &__buffer);
+# endif//PACKER_CODE
+
+  STRUCT_FCNS_DECL(TRLO_SHADOW_MULTI_TRIGGERS);
+#endif//!__PSDC__
+};
+
+/** END_STRUCTURES ****************************************************/
+/** BEGIN_STRUCTURES ***************************************************
+ *
+ * Event unpacker associated structures for VME_CAEN_V1190_SUBTDC.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// VME_CAEN_V1190_SUBTDC(tdc,event_id,data)
+#if !PACKER_CODE
+# define DECLARED_UNPACK_VME_CAEN_V1190_SUBTDC
+class VME_CAEN_V1190_SUBTDC
+#else//PACKER_CODE
+# define DECLARED_PACKER_VME_CAEN_V1190_SUBTDC
+class PACKER_VME_CAEN_V1190_SUBTDC
+#endif//PACKER_CODE
+
+{
+public:
+  // MEMBER(DATA24 data[32] ZERO_SUPPRESS_MULTI(128));
+  // MARK_COUNT(tdc_start);
+  // UINT32 header
+  // {
+    //  0_11: bunch_id;
+    // 12_23: event_id = CHECK(event_id);
+    // 24_25: tdc = MATCH(tdc);
+    // 27_31: 1;
+  // }
+  union
+  {
+    struct
+    {
+#if __BYTE_ORDER == __LITTLE_ENDIAN
+      uint32 bunch_id : 12; // 0..11
+      uint32 event_id : 12; // 12..23
+      uint32 tdc : 2; // 24..25
+      uint32 dummy_26 : 1;
+      uint32 unnamed_27_31 : 5; // 27..31
+#endif
+#if __BYTE_ORDER == __BIG_ENDIAN
+      uint32 unnamed_27_31 : 5; // 27..31
+      uint32 dummy_26 : 1;
+      uint32 tdc : 2; // 24..25
+      uint32 event_id : 12; // 12..23
+      uint32 bunch_id : 12; // 0..11
+#endif
+    };
+    uint32  u32;
+  } header;
+  // several UINT32 ch_data NOENCODE
+  // {
+    //  0_18: value;
+    // 19_23: channel_low;
+    // 24_25: tdc = CHECK(tdc);
+    //    26: trailing;
+    // 27_31: 0;
+    // ENCODE(data[((tdc << 5) | channel_low)],(value=value));
+  // }
+  // optional UINT32 error_flags
+  // {
+    //  0_14: flags;
+    // 24_25: tdc = CHECK(tdc);
+    // 27_31: 4;
+  // }
+  union
+  {
+    struct
+    {
+#if __BYTE_ORDER == __LITTLE_ENDIAN
+      uint32 flags : 15; // 0..14
+      uint32 dummy_15_23 : 9;
+      uint32 tdc : 2; // 24..25
+      uint32 dummy_26 : 1;
+      uint32 unnamed_27_31 : 5; // 27..31
+#endif
+#if __BYTE_ORDER == __BIG_ENDIAN
+      uint32 unnamed_27_31 : 5; // 27..31
+      uint32 dummy_26 : 1;
+      uint32 tdc : 2; // 24..25
+      uint32 dummy_15_23 : 9;
+      uint32 flags : 15; // 0..14
+#endif
+    };
+    uint32  u32;
+  } error_flags;
+  // MARK_COUNT(tdc_end);
+  // UINT32 trailer
+  // {
+    //  0_11: word_count = CHECK_COUNT(tdc_start,tdc_end,4,4);
+    // 12_23: event_id = CHECK(header.event_id);
+    // 24_25: tdc = CHECK(tdc);
+    // 27_31: 3;
+  // }
+  union
+  {
+    struct
+    {
+#if __BYTE_ORDER == __LITTLE_ENDIAN
+      uint32 word_count : 12; // 0..11
+      uint32 event_id : 12; // 12..23
+      uint32 tdc : 2; // 24..25
+      uint32 dummy_26 : 1;
+      uint32 unnamed_27_31 : 5; // 27..31
+#endif
+#if __BYTE_ORDER == __BIG_ENDIAN
+      uint32 unnamed_27_31 : 5; // 27..31
+      uint32 dummy_26 : 1;
+      uint32 tdc : 2; // 24..25
+      uint32 event_id : 12; // 12..23
+      uint32 word_count : 12; // 0..11
+#endif
+    };
+    uint32  u32;
+  } trailer;
+
+public:
+#ifndef __PSDC__
+# if !PACKER_CODE
+template<typename __data_src_t>
+  void __unpack(__data_src_t &__buffer,uint32 tdc,uint32 event_id,raw_array_multi_zero_suppress<DATA24,DATA24,32,128> &data);
+template<typename __data_src_t>
+  static bool __match(__data_src_t &__buffer,uint32 tdc,uint32 event_id);
+  // void __clean();
+# else//PACKER_CODE
+template<typename __data_dest_t>
+  void __packer(__data_dest_t &__buffer,uint32 tdc,uint32 event_id,raw_array_multi_zero_suppress<DATA24,DATA24,32,128> &data);
+# endif//PACKER_CODE
+
+  STRUCT_FCNS_DECL(VME_CAEN_V1190_SUBTDC);
+#endif//!__PSDC__
+};
+
+/** END_STRUCTURES ****************************************************/
+/** BEGIN_STRUCTURES ***************************************************
+ *
+ * Event unpacker associated structures for VME_CAEN_V1190.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// VME_CAEN_V1190(geom)
+#if !PACKER_CODE
+# define DECLARED_UNPACK_VME_CAEN_V1190
+class VME_CAEN_V1190
+#else//PACKER_CODE
+# define DECLARED_PACKER_VME_CAEN_V1190
+class PACKER_VME_CAEN_V1190
+#endif//PACKER_CODE
+
+{
+public:
+  // MEMBER(DATA24 data[32] ZERO_SUPPRESS_MULTI(128));
+  raw_array_multi_zero_suppress<DATA24,DATA24,32,128> data;
+  // MARK_COUNT(v1190_start);
+  // UINT32 header
+  // {
+    //  0_04: geom = MATCH(geom);
+    //  5_26: event_number;
+    // 27_31: 8;
+  // }
+  union
+  {
+    struct
+    {
+#if __BYTE_ORDER == __LITTLE_ENDIAN
+      uint32 geom : 5; // 0..4
+      uint32 event_number : 22; // 5..26
+      uint32 unnamed_27_31 : 5; // 27..31
+#endif
+#if __BYTE_ORDER == __BIG_ENDIAN
+      uint32 unnamed_27_31 : 5; // 27..31
+      uint32 event_number : 22; // 5..26
+      uint32 geom : 5; // 0..4
+#endif
+    };
+    uint32  u32;
+  } header;
+  // select several
+
+    // tdc[0] = VME_CAEN_V1190_SUBTDC(tdc=0,event_id=(header.event_number & 0xfff),
+                                   // data=data);
+    // tdc[1] = VME_CAEN_V1190_SUBTDC(tdc=1,event_id=(header.event_number & 0xfff),
+                                   // data=data);
+    // tdc[2] = VME_CAEN_V1190_SUBTDC(tdc=2,event_id=(header.event_number & 0xfff),
+                                   // data=data);
+    // tdc[3] = VME_CAEN_V1190_SUBTDC(tdc=3,event_id=(header.event_number & 0xfff),
+                                   // data=data);
+  SINGLE(VME_CAEN_V1190_SUBTDC,tdc[4]);
+  // UINT32 trigger
+  // {
+    //  0_26: time_tag;
+    // 27_31: 17;
+  // }
+  union
+  {
+    struct
+    {
+#if __BYTE_ORDER == __LITTLE_ENDIAN
+      uint32 time_tag : 27; // 0..26
+      uint32 unnamed_27_31 : 5; // 27..31
+#endif
+#if __BYTE_ORDER == __BIG_ENDIAN
+      uint32 unnamed_27_31 : 5; // 27..31
+      uint32 time_tag : 27; // 0..26
+#endif
+    };
+    uint32  u32;
+  } trigger;
+  // MARK_COUNT(v1190_end);
+  // UINT32 trailer
+  // {
+    //  0_04: geom = CHECK(geom);
+    //  5_19: word_count = CHECK_COUNT(v1190_start,v1190_end,4,4);
+    //    24: tdc_error;
+    //    25: buffer_overflow;
+    //    26: trigger_lost;
+    // 27_31: 16;
+  // }
+  union
+  {
+    struct
+    {
+#if __BYTE_ORDER == __LITTLE_ENDIAN
+      uint32 geom : 5; // 0..4
+      uint32 word_count : 15; // 5..19
+      uint32 dummy_20_23 : 4;
+      uint32 tdc_error : 1; // 24
+      uint32 buffer_overflow : 1; // 25
+      uint32 trigger_lost : 1; // 26
+      uint32 unnamed_27_31 : 5; // 27..31
+#endif
+#if __BYTE_ORDER == __BIG_ENDIAN
+      uint32 unnamed_27_31 : 5; // 27..31
+      uint32 trigger_lost : 1; // 26
+      uint32 buffer_overflow : 1; // 25
+      uint32 tdc_error : 1; // 24
+      uint32 dummy_20_23 : 4;
+      uint32 word_count : 15; // 5..19
+      uint32 geom : 5; // 0..4
+#endif
+    };
+    uint32  u32;
+  } trailer;
+
+public:
+#ifndef __PSDC__
+# if !PACKER_CODE
+template<typename __data_src_t>
+  void __unpack(__data_src_t &__buffer,uint32 geom);
+template<typename __data_src_t>
+  static bool __match(__data_src_t &__buffer,uint32 geom);
+  // void __clean();
+# else//PACKER_CODE
+template<typename __data_dest_t>
+  void __packer(__data_dest_t &__buffer,uint32 geom);
+# endif//PACKER_CODE
+
+  STRUCT_FCNS_DECL(VME_CAEN_V1190);
+#endif//!__PSDC__
+};
+
+/** END_STRUCTURES ****************************************************/
+/** BEGIN_STRUCTURES ***************************************************
+ *
+ * Event unpacker associated structures for VME_CAEN_V1190_SHORT_SUBTDC.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// VME_CAEN_V1190_SHORT_SUBTDC(tdc,event_id,data)
+#if !PACKER_CODE
+# define DECLARED_UNPACK_VME_CAEN_V1190_SHORT_SUBTDC
+class VME_CAEN_V1190_SHORT_SUBTDC
+#else//PACKER_CODE
+# define DECLARED_PACKER_VME_CAEN_V1190_SHORT_SUBTDC
+class PACKER_VME_CAEN_V1190_SHORT_SUBTDC
+#endif//PACKER_CODE
+
+{
+public:
+  // MEMBER(DATA24 data[32] ZERO_SUPPRESS_MULTI(128));
+  // UINT32 ch_data NOENCODE
+  // {
+    //  0_18: value;
+    // 19_23: channel_low;
+    // 24_25: tdc = CHECK(tdc);
+    //    26: trailing;
+    // 27_31: 0;
+    // ENCODE(data[((tdc << 5) | channel_low)],(value=value));
+  // }
+
+public:
+#ifndef __PSDC__
+# if !PACKER_CODE
+template<typename __data_src_t>
+  void __unpack(__data_src_t &__buffer,uint32 tdc,uint32 event_id,raw_array_multi_zero_suppress<DATA24,DATA24,32,128> &data);
+template<typename __data_src_t>
+  static bool __match(__data_src_t &__buffer,uint32 tdc,uint32 event_id);
+  // void __clean();
+# else//PACKER_CODE
+template<typename __data_dest_t>
+  void __packer(__data_dest_t &__buffer,uint32 tdc,uint32 event_id,raw_array_multi_zero_suppress<DATA24,DATA24,32,128> &data);
+# endif//PACKER_CODE
+
+  STRUCT_FCNS_DECL(VME_CAEN_V1190_SHORT_SUBTDC);
+#endif//!__PSDC__
+};
+
+/** END_STRUCTURES ****************************************************/
+/** BEGIN_STRUCTURES ***************************************************
+ *
+ * Event unpacker associated structures for VME_CAEN_V1190_SHORT_SUBTDC_ERROR.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// VME_CAEN_V1190_SHORT_SUBTDC_ERROR(tdc)
+#if !PACKER_CODE
+# define DECLARED_UNPACK_VME_CAEN_V1190_SHORT_SUBTDC_ERROR
+class VME_CAEN_V1190_SHORT_SUBTDC_ERROR
+#else//PACKER_CODE
+# define DECLARED_PACKER_VME_CAEN_V1190_SHORT_SUBTDC_ERROR
+class PACKER_VME_CAEN_V1190_SHORT_SUBTDC_ERROR
+#endif//PACKER_CODE
+
+{
+public:
+  // UINT32 error_flags
+  // {
+    //  0_14: flags;
+    // 24_25: tdc = CHECK(tdc);
+    // 27_31: 4;
+  // }
+  union
+  {
+    struct
+    {
+#if __BYTE_ORDER == __LITTLE_ENDIAN
+      uint32 flags : 15; // 0..14
+      uint32 dummy_15_23 : 9;
+      uint32 tdc : 2; // 24..25
+      uint32 dummy_26 : 1;
+      uint32 unnamed_27_31 : 5; // 27..31
+#endif
+#if __BYTE_ORDER == __BIG_ENDIAN
+      uint32 unnamed_27_31 : 5; // 27..31
+      uint32 dummy_26 : 1;
+      uint32 tdc : 2; // 24..25
+      uint32 dummy_15_23 : 9;
+      uint32 flags : 15; // 0..14
+#endif
+    };
+    uint32  u32;
+  } error_flags;
+
+public:
+#ifndef __PSDC__
+# if !PACKER_CODE
+template<typename __data_src_t>
+  void __unpack(__data_src_t &__buffer,uint32 tdc);
+template<typename __data_src_t>
+  static bool __match(__data_src_t &__buffer,uint32 tdc);
+  // void __clean();
+# else//PACKER_CODE
+template<typename __data_dest_t>
+  void __packer(__data_dest_t &__buffer,uint32 tdc);
+# endif//PACKER_CODE
+
+  STRUCT_FCNS_DECL(VME_CAEN_V1190_SHORT_SUBTDC_ERROR);
+#endif//!__PSDC__
+};
+
+/** END_STRUCTURES ****************************************************/
+/** BEGIN_STRUCTURES ***************************************************
+ *
+ * Event unpacker associated structures for VME_CAEN_V1190_SHORT.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// VME_CAEN_V1190_SHORT(geom)
+#if !PACKER_CODE
+# define DECLARED_UNPACK_VME_CAEN_V1190_SHORT
+class VME_CAEN_V1190_SHORT
+#else//PACKER_CODE
+# define DECLARED_PACKER_VME_CAEN_V1190_SHORT
+class PACKER_VME_CAEN_V1190_SHORT
+#endif//PACKER_CODE
+
+{
+public:
+  // MEMBER(DATA24 data[32] ZERO_SUPPRESS_MULTI(128));
+  raw_array_multi_zero_suppress<DATA24,DATA24,32,128> data;
+  // MARK_COUNT(v1190_start);
+  // UINT32 header
+  // {
+    //  0_04: geom = MATCH(geom);
+    //  5_26: event_number;
+    // 27_31: 8;
+  // }
+  union
+  {
+    struct
+    {
+#if __BYTE_ORDER == __LITTLE_ENDIAN
+      uint32 geom : 5; // 0..4
+      uint32 event_number : 22; // 5..26
+      uint32 unnamed_27_31 : 5; // 27..31
+#endif
+#if __BYTE_ORDER == __BIG_ENDIAN
+      uint32 unnamed_27_31 : 5; // 27..31
+      uint32 event_number : 22; // 5..26
+      uint32 geom : 5; // 0..4
+#endif
+    };
+    uint32  u32;
+  } header;
+  // select several
+
+    // tdc[0] = VME_CAEN_V1190_SHORT_SUBTDC(tdc=0,event_id=(header.event_number & 0xfff),
+                                         // data=data);
+    // tdc[1] = VME_CAEN_V1190_SHORT_SUBTDC(tdc=1,event_id=(header.event_number & 0xfff),
+                                         // data=data);
+    // tdc[2] = VME_CAEN_V1190_SHORT_SUBTDC(tdc=2,event_id=(header.event_number & 0xfff),
+                                         // data=data);
+    // tdc[3] = VME_CAEN_V1190_SHORT_SUBTDC(tdc=3,event_id=(header.event_number & 0xfff),
+                                         // data=data);
+    // norevisit err[0] = VME_CAEN_V1190_SHORT_SUBTDC_ERROR(tdc=0);
+    // norevisit err[1] = VME_CAEN_V1190_SHORT_SUBTDC_ERROR(tdc=1);
+    // norevisit err[2] = VME_CAEN_V1190_SHORT_SUBTDC_ERROR(tdc=2);
+    // norevisit err[3] = VME_CAEN_V1190_SHORT_SUBTDC_ERROR(tdc=3);
+  SINGLE(VME_CAEN_V1190_SHORT_SUBTDC,tdc[4]);
+  SINGLE(VME_CAEN_V1190_SHORT_SUBTDC_ERROR,err[4]);
+  // UINT32 trigger
+  // {
+    //  0_26: time_tag;
+    // 27_31: 17;
+  // }
+  union
+  {
+    struct
+    {
+#if __BYTE_ORDER == __LITTLE_ENDIAN
+      uint32 time_tag : 27; // 0..26
+      uint32 unnamed_27_31 : 5; // 27..31
+#endif
+#if __BYTE_ORDER == __BIG_ENDIAN
+      uint32 unnamed_27_31 : 5; // 27..31
+      uint32 time_tag : 27; // 0..26
+#endif
+    };
+    uint32  u32;
+  } trigger;
+  // MARK_COUNT(v1190_end);
+  // UINT32 trailer
+  // {
+    //  0_04: geom = CHECK(geom);
+    //  5_19: word_count = CHECK_COUNT(v1190_start,v1190_end,4,4);
+    //    24: tdc_error;
+    //    25: buffer_overflow;
+    //    26: trigger_lost;
+    // 27_31: 16;
+  // }
+  union
+  {
+    struct
+    {
+#if __BYTE_ORDER == __LITTLE_ENDIAN
+      uint32 geom : 5; // 0..4
+      uint32 word_count : 15; // 5..19
+      uint32 dummy_20_23 : 4;
+      uint32 tdc_error : 1; // 24
+      uint32 buffer_overflow : 1; // 25
+      uint32 trigger_lost : 1; // 26
+      uint32 unnamed_27_31 : 5; // 27..31
+#endif
+#if __BYTE_ORDER == __BIG_ENDIAN
+      uint32 unnamed_27_31 : 5; // 27..31
+      uint32 trigger_lost : 1; // 26
+      uint32 buffer_overflow : 1; // 25
+      uint32 tdc_error : 1; // 24
+      uint32 dummy_20_23 : 4;
+      uint32 word_count : 15; // 5..19
+      uint32 geom : 5; // 0..4
+#endif
+    };
+    uint32  u32;
+  } trailer;
+
+public:
+#ifndef __PSDC__
+# if !PACKER_CODE
+template<typename __data_src_t>
+  void __unpack(__data_src_t &__buffer,uint32 geom);
+template<typename __data_src_t>
+  static bool __match(__data_src_t &__buffer,uint32 geom);
+  // void __clean();
+# else//PACKER_CODE
+template<typename __data_dest_t>
+  void __packer(__data_dest_t &__buffer,uint32 geom);
+# endif//PACKER_CODE
+
+  STRUCT_FCNS_DECL(VME_CAEN_V1190_SHORT);
+#endif//!__PSDC__
+};
+
+/** END_STRUCTURES ****************************************************/
+/** BEGIN_STRUCTURES ***************************************************
+ *
+ * Event unpacker associated structures for VME_CAEN_V1290_SUBTDC.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// VME_CAEN_V1290_SUBTDC(tdc,event_id,data)
+#if !PACKER_CODE
+# define DECLARED_UNPACK_VME_CAEN_V1290_SUBTDC
+class VME_CAEN_V1290_SUBTDC
+#else//PACKER_CODE
+# define DECLARED_PACKER_VME_CAEN_V1290_SUBTDC
+class PACKER_VME_CAEN_V1290_SUBTDC
+#endif//PACKER_CODE
+
+{
+public:
+  // MEMBER(DATA24 data[32] ZERO_SUPPRESS_MULTI(128));
+  // MARK_COUNT(tdc_start);
+  // UINT32 header
+  // {
+    //  0_11: bunch_id;
+    // 12_23: event_id = CHECK(event_id);
+    // 24_25: tdc = MATCH(tdc);
+    // 27_31: 1;
+  // }
+  union
+  {
+    struct
+    {
+#if __BYTE_ORDER == __LITTLE_ENDIAN
+      uint32 bunch_id : 12; // 0..11
+      uint32 event_id : 12; // 12..23
+      uint32 tdc : 2; // 24..25
+      uint32 dummy_26 : 1;
+      uint32 unnamed_27_31 : 5; // 27..31
+#endif
+#if __BYTE_ORDER == __BIG_ENDIAN
+      uint32 unnamed_27_31 : 5; // 27..31
+      uint32 dummy_26 : 1;
+      uint32 tdc : 2; // 24..25
+      uint32 event_id : 12; // 12..23
+      uint32 bunch_id : 12; // 0..11
+#endif
+    };
+    uint32  u32;
+  } header;
+  // several UINT32 ch_data NOENCODE
+  // {
+    //  0_20: value;
+    // 21_23: channel_low;
+    // 24_25: tdc = CHECK(tdc);
+    //    26: trailing;
+    // 27_31: 0;
+    // ENCODE(data[((tdc << 3) | channel_low)],(value=value));
+  // }
+  // optional UINT32 error_flags
+  // {
+    //  0_14: flags;
+    // 24_25: tdc = CHECK(tdc);
+    // 27_31: 4;
+  // }
+  union
+  {
+    struct
+    {
+#if __BYTE_ORDER == __LITTLE_ENDIAN
+      uint32 flags : 15; // 0..14
+      uint32 dummy_15_23 : 9;
+      uint32 tdc : 2; // 24..25
+      uint32 dummy_26 : 1;
+      uint32 unnamed_27_31 : 5; // 27..31
+#endif
+#if __BYTE_ORDER == __BIG_ENDIAN
+      uint32 unnamed_27_31 : 5; // 27..31
+      uint32 dummy_26 : 1;
+      uint32 tdc : 2; // 24..25
+      uint32 dummy_15_23 : 9;
+      uint32 flags : 15; // 0..14
+#endif
+    };
+    uint32  u32;
+  } error_flags;
+  // MARK_COUNT(tdc_end);
+  // UINT32 trailer
+  // {
+    //  0_11: word_count = CHECK_COUNT(tdc_start,tdc_end,4,4);
+    // 12_23: event_id = CHECK(header.event_id);
+    // 24_25: tdc = CHECK(tdc);
+    // 27_31: 3;
+  // }
+  union
+  {
+    struct
+    {
+#if __BYTE_ORDER == __LITTLE_ENDIAN
+      uint32 word_count : 12; // 0..11
+      uint32 event_id : 12; // 12..23
+      uint32 tdc : 2; // 24..25
+      uint32 dummy_26 : 1;
+      uint32 unnamed_27_31 : 5; // 27..31
+#endif
+#if __BYTE_ORDER == __BIG_ENDIAN
+      uint32 unnamed_27_31 : 5; // 27..31
+      uint32 dummy_26 : 1;
+      uint32 tdc : 2; // 24..25
+      uint32 event_id : 12; // 12..23
+      uint32 word_count : 12; // 0..11
+#endif
+    };
+    uint32  u32;
+  } trailer;
+
+public:
+#ifndef __PSDC__
+# if !PACKER_CODE
+template<typename __data_src_t>
+  void __unpack(__data_src_t &__buffer,uint32 tdc,uint32 event_id,raw_array_multi_zero_suppress<DATA24,DATA24,32,128> &data);
+template<typename __data_src_t>
+  static bool __match(__data_src_t &__buffer,uint32 tdc,uint32 event_id);
+  // void __clean();
+# else//PACKER_CODE
+template<typename __data_dest_t>
+  void __packer(__data_dest_t &__buffer,uint32 tdc,uint32 event_id,raw_array_multi_zero_suppress<DATA24,DATA24,32,128> &data);
+# endif//PACKER_CODE
+
+  STRUCT_FCNS_DECL(VME_CAEN_V1290_SUBTDC);
+#endif//!__PSDC__
+};
+
+/** END_STRUCTURES ****************************************************/
+/** BEGIN_STRUCTURES ***************************************************
+ *
+ * Event unpacker associated structures for VME_CAEN_V1290.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// VME_CAEN_V1290(geom)
+#if !PACKER_CODE
+# define DECLARED_UNPACK_VME_CAEN_V1290
+class VME_CAEN_V1290
+#else//PACKER_CODE
+# define DECLARED_PACKER_VME_CAEN_V1290
+class PACKER_VME_CAEN_V1290
+#endif//PACKER_CODE
+
+{
+public:
+  // MEMBER(DATA24 data[32] ZERO_SUPPRESS_MULTI(128));
+  raw_array_multi_zero_suppress<DATA24,DATA24,32,128> data;
+  // MARK_COUNT(v1190_start);
+  // UINT32 header
+  // {
+    //  0_04: geom = MATCH(geom);
+    //  5_26: event_number;
+    // 27_31: 8;
+  // }
+  union
+  {
+    struct
+    {
+#if __BYTE_ORDER == __LITTLE_ENDIAN
+      uint32 geom : 5; // 0..4
+      uint32 event_number : 22; // 5..26
+      uint32 unnamed_27_31 : 5; // 27..31
+#endif
+#if __BYTE_ORDER == __BIG_ENDIAN
+      uint32 unnamed_27_31 : 5; // 27..31
+      uint32 event_number : 22; // 5..26
+      uint32 geom : 5; // 0..4
+#endif
+    };
+    uint32  u32;
+  } header;
+  // select several
+
+    // tdc[0] = VME_CAEN_V1290_SUBTDC(tdc=0,event_id=(header.event_number & 0xfff),
+                                   // data=data);
+    // tdc[1] = VME_CAEN_V1290_SUBTDC(tdc=1,event_id=(header.event_number & 0xfff),
+                                   // data=data);
+    // tdc[2] = VME_CAEN_V1290_SUBTDC(tdc=2,event_id=(header.event_number & 0xfff),
+                                   // data=data);
+    // tdc[3] = VME_CAEN_V1290_SUBTDC(tdc=3,event_id=(header.event_number & 0xfff),
+                                   // data=data);
+  SINGLE(VME_CAEN_V1290_SUBTDC,tdc[4]);
+  // UINT32 trigger
+  // {
+    //  0_26: time_tag;
+    // 27_31: 17;
+  // }
+  union
+  {
+    struct
+    {
+#if __BYTE_ORDER == __LITTLE_ENDIAN
+      uint32 time_tag : 27; // 0..26
+      uint32 unnamed_27_31 : 5; // 27..31
+#endif
+#if __BYTE_ORDER == __BIG_ENDIAN
+      uint32 unnamed_27_31 : 5; // 27..31
+      uint32 time_tag : 27; // 0..26
+#endif
+    };
+    uint32  u32;
+  } trigger;
+  // MARK_COUNT(v1190_end);
+  // UINT32 trailer
+  // {
+    //  0_04: geom = CHECK(geom);
+    //  5_19: word_count = CHECK_COUNT(v1190_start,v1190_end,4,4);
+    //    24: tdc_error;
+    //    25: buffer_overflow;
+    //    26: trigger_lost;
+    // 27_31: 16;
+  // }
+  union
+  {
+    struct
+    {
+#if __BYTE_ORDER == __LITTLE_ENDIAN
+      uint32 geom : 5; // 0..4
+      uint32 word_count : 15; // 5..19
+      uint32 dummy_20_23 : 4;
+      uint32 tdc_error : 1; // 24
+      uint32 buffer_overflow : 1; // 25
+      uint32 trigger_lost : 1; // 26
+      uint32 unnamed_27_31 : 5; // 27..31
+#endif
+#if __BYTE_ORDER == __BIG_ENDIAN
+      uint32 unnamed_27_31 : 5; // 27..31
+      uint32 trigger_lost : 1; // 26
+      uint32 buffer_overflow : 1; // 25
+      uint32 tdc_error : 1; // 24
+      uint32 dummy_20_23 : 4;
+      uint32 word_count : 15; // 5..19
+      uint32 geom : 5; // 0..4
+#endif
+    };
+    uint32  u32;
+  } trailer;
+
+public:
+#ifndef __PSDC__
+# if !PACKER_CODE
+template<typename __data_src_t>
+  void __unpack(__data_src_t &__buffer,uint32 geom);
+template<typename __data_src_t>
+  static bool __match(__data_src_t &__buffer,uint32 geom);
+  // void __clean();
+# else//PACKER_CODE
+template<typename __data_dest_t>
+  void __packer(__data_dest_t &__buffer,uint32 geom);
+# endif//PACKER_CODE
+
+  STRUCT_FCNS_DECL(VME_CAEN_V1290);
+#endif//!__PSDC__
+};
+
+/** END_STRUCTURES ****************************************************/
+/** BEGIN_STRUCTURES ***************************************************
+ *
+ * Event unpacker associated structures for VME_CAEN_V1290_SHORT_SUBTDC.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// VME_CAEN_V1290_SHORT_SUBTDC(tdc,event_id,data)
+#if !PACKER_CODE
+# define DECLARED_UNPACK_VME_CAEN_V1290_SHORT_SUBTDC
+class VME_CAEN_V1290_SHORT_SUBTDC
+#else//PACKER_CODE
+# define DECLARED_PACKER_VME_CAEN_V1290_SHORT_SUBTDC
+class PACKER_VME_CAEN_V1290_SHORT_SUBTDC
+#endif//PACKER_CODE
+
+{
+public:
+  // MEMBER(DATA24 data[32] ZERO_SUPPRESS_MULTI(128));
+  // UINT32 ch_data NOENCODE
+  // {
+    //  0_20: value;
+    // 21_23: channel_low;
+    // 24_25: tdc = CHECK(tdc);
+    //    26: trailing;
+    // 27_31: 0;
+    // ENCODE(data[((tdc << 3) | channel_low)],(value=value));
+  // }
+
+public:
+#ifndef __PSDC__
+# if !PACKER_CODE
+template<typename __data_src_t>
+  void __unpack(__data_src_t &__buffer,uint32 tdc,uint32 event_id,raw_array_multi_zero_suppress<DATA24,DATA24,32,128> &data);
+template<typename __data_src_t>
+  static bool __match(__data_src_t &__buffer,uint32 tdc,uint32 event_id);
+  // void __clean();
+# else//PACKER_CODE
+template<typename __data_dest_t>
+  void __packer(__data_dest_t &__buffer,uint32 tdc,uint32 event_id,raw_array_multi_zero_suppress<DATA24,DATA24,32,128> &data);
+# endif//PACKER_CODE
+
+  STRUCT_FCNS_DECL(VME_CAEN_V1290_SHORT_SUBTDC);
+#endif//!__PSDC__
+};
+
+/** END_STRUCTURES ****************************************************/
+/** BEGIN_STRUCTURES ***************************************************
+ *
+ * Event unpacker associated structures for VME_CAEN_V1290_SHORT_SUBTDC_ERROR.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// VME_CAEN_V1290_SHORT_SUBTDC_ERROR(tdc)
+#if !PACKER_CODE
+# define DECLARED_UNPACK_VME_CAEN_V1290_SHORT_SUBTDC_ERROR
+class VME_CAEN_V1290_SHORT_SUBTDC_ERROR
+#else//PACKER_CODE
+# define DECLARED_PACKER_VME_CAEN_V1290_SHORT_SUBTDC_ERROR
+class PACKER_VME_CAEN_V1290_SHORT_SUBTDC_ERROR
+#endif//PACKER_CODE
+
+{
+public:
+  // UINT32 error_flags
+  // {
+    //  0_14: flags;
+    // 24_25: tdc = CHECK(tdc);
+    // 27_31: 4;
+  // }
+  union
+  {
+    struct
+    {
+#if __BYTE_ORDER == __LITTLE_ENDIAN
+      uint32 flags : 15; // 0..14
+      uint32 dummy_15_23 : 9;
+      uint32 tdc : 2; // 24..25
+      uint32 dummy_26 : 1;
+      uint32 unnamed_27_31 : 5; // 27..31
+#endif
+#if __BYTE_ORDER == __BIG_ENDIAN
+      uint32 unnamed_27_31 : 5; // 27..31
+      uint32 dummy_26 : 1;
+      uint32 tdc : 2; // 24..25
+      uint32 dummy_15_23 : 9;
+      uint32 flags : 15; // 0..14
+#endif
+    };
+    uint32  u32;
+  } error_flags;
+
+public:
+#ifndef __PSDC__
+# if !PACKER_CODE
+template<typename __data_src_t>
+  void __unpack(__data_src_t &__buffer,uint32 tdc);
+template<typename __data_src_t>
+  static bool __match(__data_src_t &__buffer,uint32 tdc);
+  // void __clean();
+# else//PACKER_CODE
+template<typename __data_dest_t>
+  void __packer(__data_dest_t &__buffer,uint32 tdc);
+# endif//PACKER_CODE
+
+  STRUCT_FCNS_DECL(VME_CAEN_V1290_SHORT_SUBTDC_ERROR);
+#endif//!__PSDC__
+};
+
+/** END_STRUCTURES ****************************************************/
+/** BEGIN_STRUCTURES ***************************************************
+ *
+ * Event unpacker associated structures for VME_CAEN_V1290_SHORT.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// VME_CAEN_V1290_SHORT(geom)
+#if !PACKER_CODE
+# define DECLARED_UNPACK_VME_CAEN_V1290_SHORT
+class VME_CAEN_V1290_SHORT
+#else//PACKER_CODE
+# define DECLARED_PACKER_VME_CAEN_V1290_SHORT
+class PACKER_VME_CAEN_V1290_SHORT
+#endif//PACKER_CODE
+
+{
+public:
+  // MEMBER(DATA24 data[32] ZERO_SUPPRESS_MULTI(128));
+  raw_array_multi_zero_suppress<DATA24,DATA24,32,128> data;
+  // MARK_COUNT(v1190_start);
+  // UINT32 header
+  // {
+    //  0_04: geom = MATCH(geom);
+    //  5_26: event_number;
+    // 27_31: 8;
+  // }
+  union
+  {
+    struct
+    {
+#if __BYTE_ORDER == __LITTLE_ENDIAN
+      uint32 geom : 5; // 0..4
+      uint32 event_number : 22; // 5..26
+      uint32 unnamed_27_31 : 5; // 27..31
+#endif
+#if __BYTE_ORDER == __BIG_ENDIAN
+      uint32 unnamed_27_31 : 5; // 27..31
+      uint32 event_number : 22; // 5..26
+      uint32 geom : 5; // 0..4
+#endif
+    };
+    uint32  u32;
+  } header;
+  // select several
+
+    // tdc[0] = VME_CAEN_V1290_SHORT_SUBTDC(tdc=0,event_id=(header.event_number & 0xfff),
+                                         // data=data);
+    // tdc[1] = VME_CAEN_V1290_SHORT_SUBTDC(tdc=1,event_id=(header.event_number & 0xfff),
+                                         // data=data);
+    // tdc[2] = VME_CAEN_V1290_SHORT_SUBTDC(tdc=2,event_id=(header.event_number & 0xfff),
+                                         // data=data);
+    // tdc[3] = VME_CAEN_V1290_SHORT_SUBTDC(tdc=3,event_id=(header.event_number & 0xfff),
+                                         // data=data);
+    // norevisit err[0] = VME_CAEN_V1290_SHORT_SUBTDC_ERROR(tdc=0);
+    // norevisit err[1] = VME_CAEN_V1290_SHORT_SUBTDC_ERROR(tdc=1);
+    // norevisit err[2] = VME_CAEN_V1290_SHORT_SUBTDC_ERROR(tdc=2);
+    // norevisit err[3] = VME_CAEN_V1290_SHORT_SUBTDC_ERROR(tdc=3);
+  SINGLE(VME_CAEN_V1290_SHORT_SUBTDC,tdc[4]);
+  SINGLE(VME_CAEN_V1290_SHORT_SUBTDC_ERROR,err[4]);
+  // UINT32 trigger
+  // {
+    //  0_26: time_tag;
+    // 27_31: 17;
+  // }
+  union
+  {
+    struct
+    {
+#if __BYTE_ORDER == __LITTLE_ENDIAN
+      uint32 time_tag : 27; // 0..26
+      uint32 unnamed_27_31 : 5; // 27..31
+#endif
+#if __BYTE_ORDER == __BIG_ENDIAN
+      uint32 unnamed_27_31 : 5; // 27..31
+      uint32 time_tag : 27; // 0..26
+#endif
+    };
+    uint32  u32;
+  } trigger;
+  // MARK_COUNT(v1190_end);
+  // UINT32 trailer
+  // {
+    //  0_04: geom = CHECK(geom);
+    //  5_19: word_count = CHECK_COUNT(v1190_start,v1190_end,4,4);
+    //    24: tdc_error;
+    //    25: buffer_overflow;
+    //    26: trigger_lost;
+    // 27_31: 16;
+  // }
+  union
+  {
+    struct
+    {
+#if __BYTE_ORDER == __LITTLE_ENDIAN
+      uint32 geom : 5; // 0..4
+      uint32 word_count : 15; // 5..19
+      uint32 dummy_20_23 : 4;
+      uint32 tdc_error : 1; // 24
+      uint32 buffer_overflow : 1; // 25
+      uint32 trigger_lost : 1; // 26
+      uint32 unnamed_27_31 : 5; // 27..31
+#endif
+#if __BYTE_ORDER == __BIG_ENDIAN
+      uint32 unnamed_27_31 : 5; // 27..31
+      uint32 trigger_lost : 1; // 26
+      uint32 buffer_overflow : 1; // 25
+      uint32 tdc_error : 1; // 24
+      uint32 dummy_20_23 : 4;
+      uint32 word_count : 15; // 5..19
+      uint32 geom : 5; // 0..4
+#endif
+    };
+    uint32  u32;
+  } trailer;
+
+public:
+#ifndef __PSDC__
+# if !PACKER_CODE
+template<typename __data_src_t>
+  void __unpack(__data_src_t &__buffer,uint32 geom);
+template<typename __data_src_t>
+  static bool __match(__data_src_t &__buffer,uint32 geom);
+  // void __clean();
+# else//PACKER_CODE
+template<typename __data_dest_t>
+  void __packer(__data_dest_t &__buffer,uint32 geom);
+# endif//PACKER_CODE
+
+  STRUCT_FCNS_DECL(VME_CAEN_V1290_SHORT);
+#endif//!__PSDC__
+};
+
+/** END_STRUCTURES ****************************************************/
+/** BEGIN_STRUCTURES ***************************************************
+ *
+ * Event unpacker associated structures for VME_CAEN_V775.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// VME_CAEN_V775(geom,crate)
+#if !PACKER_CODE
+# define DECLARED_UNPACK_VME_CAEN_V775
+class VME_CAEN_V775
+#else//PACKER_CODE
+# define DECLARED_PACKER_VME_CAEN_V775
+class PACKER_VME_CAEN_V775
+#endif//PACKER_CODE
+
+{
+public:
+  // MEMBER(DATA12_OVERFLOW data[32] ZERO_SUPPRESS);
+  raw_array_zero_suppress<DATA12_OVERFLOW,DATA12_OVERFLOW,32> data;
+  // UINT32 header NOENCODE
+  // {
+    //  8_13: count;
+    // 16_23: crate = MATCH(crate);
+    // 24_26: 2;
+    // 27_31: geom = MATCH(geom);
+  // }
+  // list(0<=index<header.count)
+
+    // UINT32 ch_data NOENCODE
+    // {
+      //  0_11: value;
+      //    12: overflow;
+      //    13: underflow;
+      //    14: valid;
+      // 16_20: channel;
+      // 24_26: 0;
+      // 27_31: geom = CHECK(geom);
+      // ENCODE(data[channel],(value=value,overflow=overflow));
+    // }
+  // UINT32 eob
+  // {
+    //  0_23: event_number;
+    // 24_26: 4;
+    // 27_31: geom = CHECK(geom);
+  // }
+  union
+  {
+    struct
+    {
+#if __BYTE_ORDER == __LITTLE_ENDIAN
+      uint32 event_number : 24; // 0..23
+      uint32 unnamed_24_26 : 3; // 24..26
+      uint32 geom : 5; // 27..31
+#endif
+#if __BYTE_ORDER == __BIG_ENDIAN
+      uint32 geom : 5; // 27..31
+      uint32 unnamed_24_26 : 3; // 24..26
+      uint32 event_number : 24; // 0..23
+#endif
+    };
+    uint32  u32;
+  } eob;
+
+public:
+#ifndef __PSDC__
+# if !PACKER_CODE
+template<typename __data_src_t>
+  void __unpack(__data_src_t &__buffer,uint32 geom,uint32 crate);
+template<typename __data_src_t>
+  static bool __match(__data_src_t &__buffer,uint32 geom,uint32 crate);
+  // void __clean();
+# else//PACKER_CODE
+template<typename __data_dest_t>
+  void __packer(__data_dest_t &__buffer,uint32 geom,uint32 crate);
+# endif//PACKER_CODE
+
+  STRUCT_FCNS_DECL(VME_CAEN_V775);
+#endif//!__PSDC__
+};
+
+/** END_STRUCTURES ****************************************************/
+/** BEGIN_STRUCTURES ***************************************************
+ *
+ * Event unpacker associated structures for VME_CAEN_V830.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// VME_CAEN_V830(geom)
+#if !PACKER_CODE
+# define DECLARED_UNPACK_VME_CAEN_V830
+class VME_CAEN_V830
+#else//PACKER_CODE
+# define DECLARED_PACKER_VME_CAEN_V830
+class PACKER_VME_CAEN_V830
+#endif//PACKER_CODE
+
+{
+public:
+  // MEMBER(DATA32 data[32] ZERO_SUPPRESS);
+  raw_array_zero_suppress<DATA32,DATA32,32> data;
+  // UINT32 header
+  // {
+    //  0_15: event_number;
+    // 16_17: ts;
+    // 18_23: count;
+    //    26: 1;
+    // 27_31: geom = MATCH(geom);
+  // }
+  union
+  {
+    struct
+    {
+#if __BYTE_ORDER == __LITTLE_ENDIAN
+      uint32 event_number : 16; // 0..15
+      uint32 ts : 2; // 16..17
+      uint32 count : 6; // 18..23
+      uint32 dummy_24_25 : 2;
+      uint32 unnamed_26_26 : 1; // 26
+      uint32 geom : 5; // 27..31
+#endif
+#if __BYTE_ORDER == __BIG_ENDIAN
+      uint32 geom : 5; // 27..31
+      uint32 unnamed_26_26 : 1; // 26
+      uint32 dummy_24_25 : 2;
+      uint32 count : 6; // 18..23
+      uint32 ts : 2; // 16..17
+      uint32 event_number : 16; // 0..15
+#endif
+    };
+    uint32  u32;
+  } header;
+  // list(0<=index<header.count)
+
+    // UINT32 ch_data NOENCODE
+    // {
+      //  0_25: value;
+      //    26: 0;
+      // 27_31: channel;
+      // ENCODE(data[channel],(value=value));
+    // }
+
+public:
+#ifndef __PSDC__
+# if !PACKER_CODE
+template<typename __data_src_t>
+  void __unpack(__data_src_t &__buffer,uint32 geom);
+template<typename __data_src_t>
+  static bool __match(__data_src_t &__buffer,uint32 geom);
+  // void __clean();
+# else//PACKER_CODE
+template<typename __data_dest_t>
+  void __packer(__data_dest_t &__buffer,uint32 geom);
+# endif//PACKER_CODE
+
+  STRUCT_FCNS_DECL(VME_CAEN_V830);
+#endif//!__PSDC__
+};
+
+/** END_STRUCTURES ****************************************************/
+/** BEGIN_STRUCTURES ***************************************************
+ *
+ * Event unpacker associated structures for VME_MESYTEC_MADC32.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// VME_MESYTEC_MADC32(geom)
+#if !PACKER_CODE
+# define DECLARED_UNPACK_VME_MESYTEC_MADC32
+class VME_MESYTEC_MADC32
+#else//PACKER_CODE
+# define DECLARED_PACKER_VME_MESYTEC_MADC32
+class PACKER_VME_MESYTEC_MADC32
+#endif//PACKER_CODE
+
+{
+public:
+  // MEMBER(DATA14_OVERFLOW data[32] ZERO_SUPPRESS);
+  raw_array_zero_suppress<DATA14_OVERFLOW,DATA14_OVERFLOW,32> data;
+  // MARK_COUNT(start);
+  // UINT32 header NOENCODE
+  // {
+    //  0_11: word_number;
+    // 12_14: adc_resol;
+    //    15: out_form;
+    // 16_23: geom = MATCH(geom);
+    // 24_29: 0;
+    // 30_31: 1;
+  // }
+  // several UINT32 ch_data NOENCODE
+  // {
+    //  0_12: value;
+    //    14: outofrange;
+    // 16_20: channel;
+    // 21_29: 32;
+    // 30_31: 0;
+    // ENCODE(data[channel],(value=value,overflow=outofrange));
+  // }
+  // optional UINT32 filler NOENCODE
+  // {
+    //  0_31: 0;
+  // }
+  // UINT32 end_of_event
+  // {
+    //  0_29: counter;
+    // 30_31: 3;
+  // }
+  union
+  {
+    struct
+    {
+#if __BYTE_ORDER == __LITTLE_ENDIAN
+      uint32 counter : 30; // 0..29
+      uint32 unnamed_30_31 : 2; // 30..31
+#endif
+#if __BYTE_ORDER == __BIG_ENDIAN
+      uint32 unnamed_30_31 : 2; // 30..31
+      uint32 counter : 30; // 0..29
+#endif
+    };
+    uint32  u32;
+  } end_of_event;
+  // MARK_COUNT(end);
+  // CHECK_COUNT(header.word_number,start,end,( - 4),4)
+
+public:
+#ifndef __PSDC__
+# if !PACKER_CODE
+template<typename __data_src_t>
+  void __unpack(__data_src_t &__buffer,uint32 geom);
+template<typename __data_src_t>
+  static bool __match(__data_src_t &__buffer,uint32 geom);
+  // void __clean();
+# else//PACKER_CODE
+template<typename __data_dest_t>
+  void __packer(__data_dest_t &__buffer,uint32 geom);
+# endif//PACKER_CODE
+
+  STRUCT_FCNS_DECL(VME_MESYTEC_MADC32);
+#endif//!__PSDC__
+};
+
+/** END_STRUCTURES ****************************************************/
+/** BEGIN_STRUCTURES ***************************************************
+ *
+ * Event unpacker associated structures for VME_MESYTEC_MDPP16.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// VME_MESYTEC_MDPP16(geom)
+#if !PACKER_CODE
+# define DECLARED_UNPACK_VME_MESYTEC_MDPP16
+class VME_MESYTEC_MDPP16
+#else//PACKER_CODE
+# define DECLARED_PACKER_VME_MESYTEC_MDPP16
+class PACKER_VME_MESYTEC_MDPP16
+#endif//PACKER_CODE
+
+{
+public:
+  // MEMBER(DATA16_OVERFLOW adc[16] ZERO_SUPPRESS_MULTI(20));
+  raw_array_multi_zero_suppress<DATA16_OVERFLOW,DATA16_OVERFLOW,16,20> adc;
+  // MEMBER(DATA16_OVERFLOW tdc[16] ZERO_SUPPRESS_MULTI(20));
+  raw_array_multi_zero_suppress<DATA16_OVERFLOW,DATA16_OVERFLOW,16,20> tdc;
+  // MEMBER(DATA16_OVERFLOW trig_tdc[16] ZERO_SUPPRESS_MULTI(20));
+  raw_array_multi_zero_suppress<DATA16_OVERFLOW,DATA16_OVERFLOW,16,20> trig_tdc;
+  // MEMBER(DATA16_OVERFLOW adc_short[16] ZERO_SUPPRESS_MULTI(20));
+  raw_array_multi_zero_suppress<DATA16_OVERFLOW,DATA16_OVERFLOW,16,20> adc_short;
+  // MARK_COUNT(start);
+  // UINT32 header NOENCODE
+  // {
+    //  0_09: word_number;
+    // 10_12: adc_res;
+    // 13_15: tdc_res;
+    // 16_23: geom = MATCH(geom);
+    // 24_29: 0;
+    // 30_31: 1;
+  // }
+  // several UINT32 ch_data NOENCODE
+  // {
+    //  0_15: value;
+    // 16_19: channel;
+    // 20_21: ch_kind;
+    //    22: overflow;
+    //    23: pileup;
+    // 24_27: 0;
+    // 28_31: 1;
+    // if((ch_kind == 0))
+    // {
+      // ENCODE(adc[channel],(value=value,overflow=overflow,pileup=pileup));
+    // }
+    // if((ch_kind == 1))
+    // {
+      // ENCODE(tdc[channel],(value=value,overflow=overflow,pileup=pileup));
+    // }
+    // if((ch_kind == 2))
+    // {
+      // ENCODE(trig_tdc[channel],(value=value,overflow=overflow,pileup=pileup));
+    // }
+    // if((ch_kind == 3))
+    // {
+      // ENCODE(adc_short[channel],(value=value,overflow=overflow,pileup=pileup));
+    // }
+  // }
+  // several UINT32 fill_word NOENCODE
+  // {
+    //  0_31: 0;
+  // }
+  // UINT32 end_of_event
+  // {
+    //  0_29: counter;
+    // 30_31: 3;
+  // }
+  union
+  {
+    struct
+    {
+#if __BYTE_ORDER == __LITTLE_ENDIAN
+      uint32 counter : 30; // 0..29
+      uint32 unnamed_30_31 : 2; // 30..31
+#endif
+#if __BYTE_ORDER == __BIG_ENDIAN
+      uint32 unnamed_30_31 : 2; // 30..31
+      uint32 counter : 30; // 0..29
+#endif
+    };
+    uint32  u32;
+  } end_of_event;
+  // MARK_COUNT(end);
+  // CHECK_COUNT(header.word_number,start,end,( - 4),4)
+
+public:
+#ifndef __PSDC__
+# if !PACKER_CODE
+template<typename __data_src_t>
+  void __unpack(__data_src_t &__buffer,uint32 geom);
+template<typename __data_src_t>
+  static bool __match(__data_src_t &__buffer,uint32 geom);
+  // void __clean();
+# else//PACKER_CODE
+template<typename __data_dest_t>
+  void __packer(__data_dest_t &__buffer,uint32 geom);
+# endif//PACKER_CODE
+
+  STRUCT_FCNS_DECL(VME_MESYTEC_MDPP16);
+#endif//!__PSDC__
+};
+
+/** END_STRUCTURES ****************************************************/
+/** BEGIN_STRUCTURES ***************************************************
+ *
+ * Event unpacker associated structures for XTST_STD_VME.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// XTST_STD_VME()
+#if !PACKER_CODE
+# define DECLARED_UNPACK_XTST_STD_VME
+class XTST_STD_VME
+#else//PACKER_CODE
+# define DECLARED_PACKER_XTST_STD_VME
+class PACKER_XTST_STD_VME
+#endif//PACKER_CODE
+
+{
+public:
+  // UINT32 failure
+  // {
+    //     0: fail_general;
+    //     1: fail_data_corrupt;
+    //     2: fail_data_missing;
+    //     3: fail_data_too_much;
+    //     4: fail_event_counter_mismatch;
+    //     5: fail_readout_error_driver;
+    //     6: fail_unexpected_trigger;
+    //    27: has_no_zero_suppression;
+    //    28: has_multi_adctdc_counter0;
+    //    29: has_multi_scaler_counter0;
+    //    30: has_multi_event;
+    //    31: has_time_stamp;
+  // }
+  union
+  {
+    struct
+    {
+#if __BYTE_ORDER == __LITTLE_ENDIAN
+      uint32 fail_general : 1; // 0
+      uint32 fail_data_corrupt : 1; // 1
+      uint32 fail_data_missing : 1; // 2
+      uint32 fail_data_too_much : 1; // 3
+      uint32 fail_event_counter_mismatch : 1; // 4
+      uint32 fail_readout_error_driver : 1; // 5
+      uint32 fail_unexpected_trigger : 1; // 6
+      uint32 dummy_7_26 : 20;
+      uint32 has_no_zero_suppression : 1; // 27
+      uint32 has_multi_adctdc_counter0 : 1; // 28
+      uint32 has_multi_scaler_counter0 : 1; // 29
+      uint32 has_multi_event : 1; // 30
+      uint32 has_time_stamp : 1; // 31
+#endif
+#if __BYTE_ORDER == __BIG_ENDIAN
+      uint32 has_time_stamp : 1; // 31
+      uint32 has_multi_event : 1; // 30
+      uint32 has_multi_scaler_counter0 : 1; // 29
+      uint32 has_multi_adctdc_counter0 : 1; // 28
+      uint32 has_no_zero_suppression : 1; // 27
+      uint32 dummy_7_26 : 20;
+      uint32 fail_unexpected_trigger : 1; // 6
+      uint32 fail_readout_error_driver : 1; // 5
+      uint32 fail_event_counter_mismatch : 1; // 4
+      uint32 fail_data_too_much : 1; // 3
+      uint32 fail_data_missing : 1; // 2
+      uint32 fail_data_corrupt : 1; // 1
+      uint32 fail_general : 1; // 0
+#endif
+    };
+    uint32  u32;
+  } failure;
+  // if(failure.has_time_stamp)
+
+    // UINT32 time_stamp;
+    uint32  time_stamp;
+  // if(failure.has_multi_event)
+
+    // UINT32 multi_events;
+    uint32  multi_events;
+  // if(failure.has_multi_scaler_counter0)
+
+    // UINT32 multi_scaler_counter0;
+    uint32  multi_scaler_counter0;
+  // if(failure.has_multi_adctdc_counter0)
+
+    // UINT32 multi_adctdc_counter0;
+    uint32  multi_adctdc_counter0;
+
+public:
+#ifndef __PSDC__
+# if !PACKER_CODE
+template<typename __data_src_t>
+  void __unpack(__data_src_t &__buffer);
+template<typename __data_src_t>
+  static bool __match(__data_src_t &__buffer);
+  // void __clean();
+# else//PACKER_CODE
+template<typename __data_dest_t>
+  void __packer(__data_dest_t &__buffer);
+# endif//PACKER_CODE
+
+  STRUCT_FCNS_DECL(XTST_STD_VME);
+#endif//!__PSDC__
+};
+
+/** END_STRUCTURES ****************************************************/
+/** BEGIN_STRUCTURES ***************************************************
+ *
+ * Event unpacker associated structures for XTST_TGL_STD_VME.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// XTST_TGL_STD_VME()
+#if !PACKER_CODE
+# define DECLARED_UNPACK_XTST_TGL_STD_VME
+class XTST_TGL_STD_VME
+#else//PACKER_CODE
+# define DECLARED_PACKER_XTST_TGL_STD_VME
+class PACKER_XTST_TGL_STD_VME
+#endif//PACKER_CODE
+
+{
+public:
+  // UINT32 separator
+  // {
+    //  0_31: 9;
+  // }
+  union
+  {
+    struct
+    {
+#if __BYTE_ORDER == __LITTLE_ENDIAN
+      uint32 unnamed_0_31 : 32; // 0..31
+#endif
+#if __BYTE_ORDER == __BIG_ENDIAN
+      uint32 unnamed_0_31 : 32; // 0..31
+#endif
+    };
+    uint32  u32;
+  } separator;
+  // UINT32 multi_events;
+  uint32  multi_events;
+  // UINT32 multi_adctdc_counter0;
+  uint32  multi_adctdc_counter0;
+  // UINT32 toggle
+  // {
+    //  0_15: ntgl1;
+    // 16_31: ntgl2;
+  // }
+  union
+  {
+    struct
+    {
+#if __BYTE_ORDER == __LITTLE_ENDIAN
+      uint32 ntgl1 : 16; // 0..15
+      uint32 ntgl2 : 16; // 16..31
+#endif
+#if __BYTE_ORDER == __BIG_ENDIAN
+      uint32 ntgl2 : 16; // 16..31
+      uint32 ntgl1 : 16; // 0..15
+#endif
+    };
+    uint32  u32;
+  } toggle;
+
+public:
+#ifndef __PSDC__
+# if !PACKER_CODE
+template<typename __data_src_t>
+  void __unpack(__data_src_t &__buffer);
+template<typename __data_src_t>
+  static bool __match(__data_src_t &__buffer);
+  // void __clean();
+# else//PACKER_CODE
+template<typename __data_dest_t>
+  void __packer(__data_dest_t &__buffer);
+# endif//PACKER_CODE
+
+  STRUCT_FCNS_DECL(XTST_TGL_STD_VME);
+#endif//!__PSDC__
+};
+
+/** END_STRUCTURES ****************************************************/
+/** BEGIN_STRUCTURES ***************************************************
+ *
+ * Event unpacker associated structures for XTST_VME.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// SUBEVENT(XTST_VME)
+#if !PACKER_CODE
+# define DECLARED_UNPACK_XTST_VME
+class XTST_VME
+#else//PACKER_CODE
+# define DECLARED_PACKER_XTST_VME
+class PACKER_XTST_VME
+#endif//PACKER_CODE
+ : public unpack_subevent_base
+{
+public:
+  // header = XTST_STD_VME();
+  // sdm = SINGLE_DATA_MODULE();
+  // select several
+
+    // tdc0 = VME_CAEN_V775(geom=20,crate=20);
+    // tdc1 = VME_CAEN_V775(geom=21,crate=20);
+    // tdc2 = VME_CAEN_V775(geom=22,crate=20);
+    // qdc0 = VME_CAEN_V775(geom=21,crate=40);
+    // qdc1 = VME_CAEN_V775(geom=21,crate=40);
+  SINGLE(VME_CAEN_V775,tdc0);
+  SINGLE(VME_CAEN_V775,tdc1);
+  SINGLE(VME_CAEN_V775,tdc2);
+  SINGLE(VME_CAEN_V775,qdc0);
+  SINGLE(VME_CAEN_V775,qdc1);
+  // select several
+
+    // mdpp16 = VME_MESYTEC_MDPP16(geom=31);
+  SINGLE(VME_MESYTEC_MDPP16,mdpp16);
+  SINGLE(XTST_STD_VME,header);
+  SINGLE(SINGLE_DATA_MODULE,sdm);
+
+public:
+#ifndef __PSDC__
+# if !PACKER_CODE
+template<typename __data_src_t>
+  void __unpack(__data_src_t &__buffer);
+template<typename __data_src_t>
+  static bool __match(__data_src_t &__buffer);
+  // void __clean();
+# else//PACKER_CODE
+template<typename __data_dest_t>
+  void __packer(__data_dest_t &__buffer);
+# endif//PACKER_CODE
+
+  STRUCT_FCNS_DECL(XTST_VME);
+#endif//!__PSDC__
+};
+
+/** END_STRUCTURES ****************************************************/
+/** BEGIN_STRUCTURES ***************************************************
+ *
+ * Event unpacker associated structures for XTST_VME_TOGGLE.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// SUBEVENT(XTST_VME_TOGGLE)
+#if !PACKER_CODE
+# define DECLARED_UNPACK_XTST_VME_TOGGLE
+class XTST_VME_TOGGLE
+#else//PACKER_CODE
+# define DECLARED_PACKER_XTST_VME_TOGGLE
+class PACKER_XTST_VME_TOGGLE
+#endif//PACKER_CODE
+ : public unpack_subevent_base
+{
+public:
+  // header = XTST_TGL_STD_VME();
+  // UINT32 separator1 NOENCODE
+  // {
+    //  0_31: 0;
+  // }
+  // UINT32 seed;
+  uint32  seed;
+  // select several
+
+    // multitrig = TRLO_SHADOW_MULTI_TRIGGERS();
+  SINGLE(TRLO_SHADOW_MULTI_TRIGGERS,multitrig);
+  // select several
+
+    // multi v775_tgl1[0] = VME_CAEN_V775(geom=1,crate=127);
+    // multi v775_tgl2[0] = VME_CAEN_V775(geom=2,crate=126);
+    // multi v775mod[0] = VME_CAEN_V775(geom=3,crate=125);
+    // multi v775_tgl1[1] = VME_CAEN_V775(geom=4,crate=124);
+    // multi v775_tgl2[1] = VME_CAEN_V775(geom=5,crate=123);
+    // multi v775mod[1] = VME_CAEN_V775(geom=6,crate=122);
+  MULTI(VME_CAEN_V775,v775_tgl1[2]);
+  MULTI(VME_CAEN_V775,v775_tgl2[2]);
+  MULTI(VME_CAEN_V775,v775mod[2]);
+  // UINT32 separator2 NOENCODE
+  // {
+    //  0_31: 0;
+  // }
+  SINGLE(XTST_TGL_STD_VME,header);
+
+public:
+#ifndef __PSDC__
+# if !PACKER_CODE
+template<typename __data_src_t>
+  void __unpack(__data_src_t &__buffer);
+template<typename __data_src_t>
+  static bool __match(__data_src_t &__buffer);
+  // void __clean();
+# else//PACKER_CODE
+template<typename __data_dest_t>
+  void __packer(__data_dest_t &__buffer);
+# endif//PACKER_CODE
+
+  STRUCT_FCNS_DECL(XTST_VME_TOGGLE);
+#endif//!__PSDC__
+};
+
+/** END_STRUCTURES ****************************************************/
+/** BEGIN_STRUCTURES ***************************************************
+ *
+ * Event unpacker associated structures for EVENT.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// EVENT
+class unpack_event : public unpack_event_base
+{
+public:
+  // vme = XTST_VME_TOGGLE(type=0xcae,subtype=0xcae);
+SINGLE(XTST_VME_TOGGLE,vme);
+public:
+#ifndef __PSDC__
+  bitsone<1> __visited;
+  void __clear_visited() { __visited.clear(); }
+  subevent_match_cache __match_cache;
+  bool ignore_unknown_subevent() { return false; }
+#endif//!__PSDC__
+
+public:
+#ifndef __PSDC__
+template<typename __data_src_t>
+  int __unpack_subevent(subevent_header *__header,__data_src_t &__buffer);
+  int __revoke_subevent(subevent_header *__header);
+  // void __clean_event();
+
+  STRUCT_FCNS_DECL(unpack_event);
+#endif//!__PSDC__
+};
+
+/** END_STRUCTURES ****************************************************/
+/** BEGIN_STRUCTURES ***************************************************
+ *
+ * Event unpacker associated structures for EVENT.
+ *
+ * Do not edit - automatically generated.
+ */
+
+// STICKY_EVENT
+class unpack_sticky_event : public unpack_sticky_event_base
+{
+public:
+public:
+#ifndef __PSDC__
+  void __clear_visited() { }
+  subevent_match_cache __match_cache;
+  bool ignore_unknown_subevent() { return false; }
+#endif//!__PSDC__
+
+public:
+#ifndef __PSDC__
+template<typename __data_src_t>
+  int __unpack_subevent(subevent_header *__header,__data_src_t &__buffer);
+  int __revoke_subevent(subevent_header *__header);
+  // void __clean_event();
+
+  STRUCT_FCNS_DECL(unpack_sticky_event);
+#endif//!__PSDC__
+};
+
+/** END_STRUCTURES ****************************************************/
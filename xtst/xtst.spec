@@ -333,6 +333,28 @@ SUBEVENT(XTST_REGRESSEXTRA)
   UINT32 junk;
 }
 
+SUBEVENT(XTST_MDPP16)
+{
+  /* Written by empty_file --mesytec-mdpp16.  With --unaligned, the
+   * modules of every other event are shifted by 16 bits, which must
+   * be rejected.
+   */
+  UINT16 align
+  {
+    0_15: unaligned;
+  }
+
+  if (!align.unaligned) {
+    UINT16 pad;
+  }
+
+  select several
+  {
+    mdpp16[0] = VME_MESYTEC_MDPP16(geom=1);
+    mdpp16[1] = VME_MESYTEC_MDPP16(geom=2);
+  }
+}
+
 EVENT
 {
   vme = XTST_VME(type=36,subtype=3100);
@@ -367,6 +389,8 @@ EVENT
   regress[15] = XTST_REGRESS(type=0x0cae,subtype=0x0cae,subcrate=15);
 
   regressextra = XTST_REGRESSEXTRA(type=0x0de0,subtype=0x0ad0);
+
+  mdpp = XTST_MDPP16(type=0x0bd0,subtype=0x0016);
 }
 
 SIGNAL(POS1_1_T,vme.tdc0.data[0],DATA12);
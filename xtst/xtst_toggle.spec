@@ -28,3 +28,11 @@ EVENT
 {
   vme = XTST_VME_TOGGLE(type=0x0cae,subtype=0x0cae);
 }
+
+// The modules that are not toggled, such that the mapping and
+// calibration of the multi-events can be checked.
+
+SIGNAL(MOD1_1_T,vme.v775mod[0].data[0],
+       MOD1_32_T,vme.v775mod[0].data[31],DATA12);
+SIGNAL(MOD2_1_T,vme.v775mod[1].data[0],
+       MOD2_32_T,vme.v775mod[1].data[31],(DATA12,float));
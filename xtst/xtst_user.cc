@@ -180,6 +180,10 @@ void raw_user_function(unpack_event *unpack_event,
 		(wrstamp->t2.value << 16) | wrstamp->t1.value;
 	      raw_event->tstamp_hi =
 		(wrstamp->t4.value << 16) | wrstamp->t3.value;
+
+	      USER_MARK_DIRTY(raw_event->tstamp_srcid);
+	      USER_MARK_DIRTY(raw_event->tstamp_lo);
+	      USER_MARK_DIRTY(raw_event->tstamp_hi);
 	    }
 	}
     }